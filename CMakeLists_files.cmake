@@ -34,8 +34,11 @@ list (APPEND MAIN_SOURCE_FILES
       opm/common/utility/ActiveGridCells.cpp
       opm/common/utility/DemangledType.cpp
       opm/common/utility/FileSystem.cpp
+      opm/common/utility/InternedString.cpp
       opm/common/utility/MemPacker.cpp
+      opm/common/utility/MemoryUsage.cpp
       opm/common/utility/OpmInputError.cpp
+      opm/common/utility/Profiler.cpp
       opm/common/utility/shmatch.cpp
       opm/common/utility/String.cpp
       opm/common/utility/TimeService.cpp
@@ -54,7 +57,7 @@ list (APPEND MAIN_SOURCE_FILES
       opm/material/components/H2.cpp
       opm/material/densead/Evaluation.cpp
       opm/material/fluidmatrixinteractions/EclEpsScalingPoints.cpp
-      opm/material/fluidsystems/BlackOilFluidSystem.cpp
+      opm/material/fluidsystems/BlackOilFluidSystemNonStatic.cpp
       opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.cpp
       opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.cpp
       opm/material/fluidsystems/blackoilpvt/Co2GasPvt.cpp
@@ -70,6 +73,7 @@ list (APPEND MAIN_SOURCE_FILES
       opm/material/fluidsystems/blackoilpvt/LiveOilPvt.cpp
       opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.cpp
       opm/material/fluidsystems/blackoilpvt/OilPvtThermal.cpp
+      opm/material/fluidsystems/blackoilpvt/BlackOilEorTables.cpp
       opm/material/fluidsystems/blackoilpvt/SolventPvt.cpp
       opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.cpp
       opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.cpp
@@ -197,8 +201,10 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+    opm/input/eclipse/Parser/DeckCache.cpp
     opm/input/eclipse/Parser/ErrorGuard.cpp
     opm/input/eclipse/Parser/InputErrorAction.cpp
+    opm/input/eclipse/Parser/InputFileManifest.cpp
     opm/input/eclipse/Parser/ParseContext.cpp
     opm/input/eclipse/Parser/Parser.cpp
     opm/input/eclipse/Parser/ParserEnums.cpp
@@ -212,10 +218,12 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/ArrayDimChecker.cpp
     opm/input/eclipse/Schedule/BCProp.cpp
     opm/input/eclipse/Schedule/CompletedCells.cpp
+    opm/input/eclipse/Schedule/ControlSnapshot.cpp
     opm/input/eclipse/Schedule/eval_uda.cpp
     opm/input/eclipse/Schedule/Events.cpp
     opm/input/eclipse/Schedule/GasLiftOpt.cpp
     opm/input/eclipse/Schedule/GasLiftOptKeywordHandlers.cpp
+    opm/input/eclipse/Schedule/GasLiftPlan.cpp
     opm/input/eclipse/Schedule/HandlerContext.cpp
     opm/input/eclipse/Schedule/KeywordHandlers.cpp
     opm/input/eclipse/Schedule/MessageLimits.cpp
@@ -236,8 +244,10 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Source.cpp
     opm/input/eclipse/Schedule/SummaryState.cpp
     opm/input/eclipse/Schedule/Tuning.cpp
+    opm/input/eclipse/Schedule/VFPEvaluator.cpp
     opm/input/eclipse/Schedule/VFPInjTable.cpp
     opm/input/eclipse/Schedule/VFPProdTable.cpp
+    opm/input/eclipse/Schedule/VFPTableCache.cpp
     opm/input/eclipse/Schedule/WriteRestartFileEvents.cpp
     opm/input/eclipse/Schedule/Action/ActionAST.cpp
     opm/input/eclipse/Schedule/Action/ActionContext.cpp
@@ -249,6 +259,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Action/ActionValue.cpp
     opm/input/eclipse/Schedule/Action/ASTNode.cpp
     opm/input/eclipse/Schedule/Action/Condition.cpp
+    opm/input/eclipse/Schedule/Action/ConditionProgram.cpp
     opm/input/eclipse/Schedule/Action/Enums.cpp
     opm/input/eclipse/Schedule/Action/PyAction.cpp
     opm/input/eclipse/Schedule/Action/State.cpp
@@ -263,13 +274,16 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Group/GConSale.cpp
     opm/input/eclipse/Schedule/Group/GConSump.cpp
     opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.cpp
+    opm/input/eclipse/Schedule/Group/GroupHierarchy.cpp
     opm/input/eclipse/Schedule/Group/GTNode.cpp
     opm/input/eclipse/Schedule/MSW/AICD.cpp
     opm/input/eclipse/Schedule/MSW/Compsegs.cpp
     opm/input/eclipse/Schedule/MSW/icd.cpp
+    opm/input/eclipse/Schedule/MSW/ICDEvaluator.cpp
     opm/input/eclipse/Schedule/MSW/MSWKeywordHandlers.cpp
     opm/input/eclipse/Schedule/MSW/Segment.cpp
     opm/input/eclipse/Schedule/MSW/SegmentMatcher.cpp
+    opm/input/eclipse/Schedule/MSW/SegmentTopology.cpp
     opm/input/eclipse/Schedule/MSW/SICD.cpp
     opm/input/eclipse/Schedule/MSW/Valve.cpp
     opm/input/eclipse/Schedule/MSW/WellSegments.cpp
@@ -277,6 +291,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Network/Balance.cpp
     opm/input/eclipse/Schedule/Network/Branch.cpp
     opm/input/eclipse/Schedule/Network/ExtNetwork.cpp
+    opm/input/eclipse/Schedule/Network/NetworkGraph.cpp
     opm/input/eclipse/Schedule/Network/NetworkKeywordHandlers.cpp
     opm/input/eclipse/Schedule/Network/Node.cpp
     opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.cpp
@@ -284,6 +299,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/ResCoup/GrupSlav.cpp
     opm/input/eclipse/Schedule/ResCoup/MasterGroup.cpp
     opm/input/eclipse/Schedule/ResCoup/Slaves.cpp
+    opm/input/eclipse/Schedule/ResCoup/SharedMemoryExchange.cpp
     opm/input/eclipse/Schedule/UDQ/UDQKeywordHandlers.cpp
     opm/input/eclipse/Schedule/UDQ/UDQActive.cpp
     opm/input/eclipse/Schedule/UDQ/UDQAssign.cpp
@@ -291,12 +307,14 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/UDQ/UDQConfig.cpp
     opm/input/eclipse/Schedule/UDQ/UDQContext.cpp
     opm/input/eclipse/Schedule/UDQ/UDQDefine.cpp
+    opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.cpp
     opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
     opm/input/eclipse/Schedule/UDQ/UDQFunction.cpp
     opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.cpp
     opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
     opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
     opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+    opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
     opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
     opm/input/eclipse/Schedule/UDQ/UDQState.cpp
     opm/input/eclipse/Schedule/UDQ/UDQToken.cpp
@@ -336,6 +354,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Units/Dimension.cpp
     opm/input/eclipse/Units/UnitSystem.cpp
     opm/input/eclipse/Utility/Functional.cpp
+    opm/input/eclipse/Utility/InputProfile.cpp
     opm/material/fluidmatrixinteractions/EclEpsConfig.cpp
     opm/material/fluidmatrixinteractions/EclEpsGridProperties.cpp
     opm/material/fluidmatrixinteractions/EclHysteresisConfig.cpp
@@ -343,6 +362,7 @@ if(ENABLE_ECL_INPUT)
     opm/material/fluidmatrixinteractions/EclMaterialLawManagerReadEffectiveParams.cpp
     opm/material/fluidmatrixinteractions/EclMaterialLawManagerInitParams.cpp
     opm/material/fluidmatrixinteractions/EclMaterialLawManagerHystParams.cpp
+    opm/material/fluidmatrixinteractions/EclRockCompactionLawManager.cpp
     opm/material/thermal/EclThermalLawManager.cpp
   )
 
@@ -387,9 +407,11 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          opm/io/eclipse/EclBinaryKernels.cpp
           opm/io/eclipse/EclFile.cpp
           opm/io/eclipse/EclOutput.cpp
           opm/io/eclipse/EclUtil.cpp
+          opm/io/eclipse/MappedFile.cpp
           opm/io/eclipse/EGrid.cpp
           opm/io/eclipse/EInit.cpp
           opm/io/eclipse/ERft.cpp
@@ -399,8 +421,10 @@ if(ENABLE_ECL_OUTPUT)
           opm/io/eclipse/ExtESmry.cpp
           opm/io/eclipse/ESmry_write_rsm.cpp
           opm/io/eclipse/OutputStream.cpp
+          opm/io/eclipse/ExtSmryCodec.cpp
           opm/io/eclipse/ExtSmryOutput.cpp
           opm/io/eclipse/RestartFileView.cpp
+          opm/io/eclipse/SummaryKeyIndex.cpp
           opm/io/eclipse/SummaryNode.cpp
           opm/io/eclipse/rst/action.cpp
           opm/io/eclipse/rst/aquifer.cpp
@@ -416,6 +440,8 @@ if(ENABLE_ECL_OUTPUT)
           opm/output/data/Aquifer.cpp
           opm/output/data/InterRegFlowMap.cpp
           opm/output/data/Solution.cpp
+          opm/output/data/WellsTable.cpp
+          opm/output/data/WellTracerRates.cpp
           opm/output/eclipse/ActiveIndexByColumns.cpp
           opm/output/eclipse/AggregateActionxData.cpp
           opm/output/eclipse/AggregateAquiferData.cpp
@@ -442,6 +468,7 @@ if(ENABLE_ECL_OUTPUT)
           opm/output/eclipse/Summary.cpp
           opm/output/eclipse/Tables.cpp
           opm/output/eclipse/UDQDims.cpp
+          opm/output/eclipse/RegionAverage.cpp
           opm/output/eclipse/RegionCache.cpp
           opm/output/eclipse/RestartValue.cpp
           opm/output/eclipse/WriteInit.cpp
@@ -459,21 +486,28 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_cubic.cpp
       tests/test_EvaluationFormat.cpp
       tests/test_densead.cpp
+      tests/test_EclipseName.cpp
+      tests/test_InternedString.cpp
+      tests/test_MemoryUsage.cpp
       tests/test_messagelimiter.cpp
       tests/test_nonuniformtablelinear.cpp
       tests/test_OpmInputError_format.cpp
       tests/test_OpmLog.cpp
       tests/test_param.cpp
+      tests/test_Profiler.cpp
       tests/test_RootFinders.cpp
       tests/test_SegmentMatcher.cpp
       tests/test_sparsevector.cpp
+      tests/test_TimeService.cpp
       tests/test_uniformtablelinear.cpp
       tests/material/test_2dtables.cpp
+      tests/material/test_blackoileortables.cpp
       tests/material/test_blackoilfluidstate.cpp
       tests/material/test_components.cpp
       tests/material/test_binarycoefficients.cpp
       tests/material/test_fluidmatrixinteractions.cpp
       tests/material/test_fluidsystems.cpp
+      tests/material/test_polynomialutils.cpp
       tests/material/test_spline.cpp
       tests/material/test_tabulation.cpp
       tests/test_Visitor.cpp
@@ -497,6 +531,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_DatumDepth.cpp
     tests/test_ERsm.cpp
     tests/test_GuideRate.cpp
+    tests/test_InputProfile.cpp
     tests/test_RestartFileView.cpp
     tests/test_EclIO.cpp
     tests/test_EGrid.cpp
@@ -509,6 +544,8 @@ if(ENABLE_ECL_INPUT)
     tests/test_RegionSetMatcher.cpp
     tests/test_PAvgCalculator.cpp
     tests/test_PAvgDynamicSourceData.cpp
+    tests/test_VFPEvaluator.cpp
+    tests/test_ICDEvaluator.cpp
     tests/test_Serialization.cpp
     tests/material/test_co2brinepvt.cpp
     tests/material/test_h2brinepvt.cpp
@@ -516,6 +553,8 @@ if(ENABLE_ECL_INPUT)
     tests/material/test_eclblackoilfluidsystem.cpp
     tests/material/test_eclblackoilpvt.cpp
     tests/material/test_eclmateriallawmanager.cpp
+    tests/material/test_eclrockcompactionlawmanager.cpp
+    tests/material/test_eclthermallawmanager.cpp
     tests/parser/ACTIONX.cpp
     tests/parser/ADDREGTests.cpp
     tests/parser/AquiferTests.cpp
@@ -624,6 +663,7 @@ if(ENABLE_ECL_OUTPUT)
           tests/test_LogiHEAD.cpp
           tests/test_OutputStream.cpp
           tests/test_PaddedOutputString.cpp
+          tests/test_RegionAverage.cpp
           tests/test_regionCache.cpp
           tests/test_restartwellinfo.cpp
           tests/test_rst.cpp
@@ -741,6 +781,8 @@ if(ENABLE_ECL_OUTPUT)
 endif()
 
 list (APPEND EXAMPLE_SOURCE_FILES
+  examples/cubic_bench.cpp
+  examples/densead_bench.cpp
 )
 if(ENABLE_ECL_INPUT)
   list (APPEND TEST_DATA_FILES
@@ -776,11 +818,14 @@ if(ENABLE_ECL_INPUT)
     examples/opmi.cpp
     examples/opmpack.cpp
     examples/opmhash.cpp
+    examples/make_synthetic_deck.cpp
     examples/rst_deck.cpp
     examples/wellgraph.cpp
     examples/make_ext_smry.cpp
     examples/co2brinepvt.cpp
     examples/hysteresis.cpp
+    examples/eclio_kernel_bench.cpp
+    examples/opmbench.cpp
   )
 endif()
 
@@ -819,10 +864,14 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/ActiveGridCells.hpp
       opm/common/utility/CSRGraphFromCoordinates.hpp
       opm/common/utility/CSRGraphFromCoordinates_impl.hpp
+      opm/common/utility/ConcurrentCounter.hpp
       opm/common/utility/DemangledType.hpp
       opm/common/utility/FileSystem.hpp
       opm/common/utility/gpuDecorators.hpp
+      opm/common/utility/EclipseName.hpp
+      opm/common/utility/InternedString.hpp
       opm/common/utility/MemPacker.hpp
+      opm/common/utility/MemoryUsage.hpp
       opm/common/utility/numeric/cmp.hpp
       opm/common/utility/numeric/blas_lapack.h
       opm/common/utility/numeric/calculateCellVol.hpp
@@ -844,6 +893,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/parameters/ParameterTools.hpp
       opm/common/utility/platform_dependent/disable_warnings.h
       opm/common/utility/platform_dependent/reenable_warnings.h
+      opm/common/utility/Profiler.hpp
       opm/common/utility/shmatch.hpp
       opm/common/utility/Serializer.hpp
       opm/common/utility/String.hpp
@@ -875,6 +925,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/components/Brine.hpp
       opm/material/components/BrineDynamic.hpp
       opm/material/fluidstates/BlackOilFluidState.hpp
+      opm/material/fluidstates/BlackOilFluidStateArray.hpp
       opm/material/fluidstates/NonEquilibriumFluidState.hpp
       opm/material/fluidstates/FluidStateSaturationModules.hpp
       opm/material/fluidstates/FluidStateCompositionModules.hpp
@@ -919,6 +970,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidsystems/GasPhase.hpp
       opm/material/fluidsystems/TwoPhaseImmiscibleFluidSystem.hpp
       opm/material/fluidsystems/BlackOilFluidSystem.hpp
+      opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp
       opm/material/fluidsystems/LiquidPhase.hpp
       opm/material/fluidsystems/PTFlashParameterCache.hpp
       opm/material/fluidsystems/Spe5ParameterCache.hpp
@@ -926,6 +978,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidsystems/H2OAirXyleneFluidSystem.hpp
       opm/material/fluidsystems/SinglePhaseFluidSystem.hpp
       opm/material/fluidsystems/Spe5FluidSystem.hpp
+      opm/material/fluidsystems/blackoilpvt/BlackOilEorTables.hpp
       opm/material/fluidsystems/blackoilpvt/SolventPvt.hpp
       opm/material/fluidsystems/blackoilpvt/WetHumidGasPvt.hpp
       opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp
@@ -989,7 +1042,9 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidmatrixinteractions/SplineTwoPhaseMaterialParams.hpp
       opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLaw.hpp
       opm/material/fluidmatrixinteractions/TwoPhaseLETCurves.hpp
+      opm/material/fluidmatrixinteractions/TwoPhaseLawTabulation.hpp
       opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp
+      opm/material/fluidmatrixinteractions/EclRockCompactionLawManager.hpp
       opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp
       opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp
       opm/material/fluidmatrixinteractions/RegularizedVanGenuchten.hpp
@@ -1009,6 +1064,8 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/UniformXTabulated2DFunction.hpp
       opm/material/common/MathToolbox.hpp
       opm/material/common/TridiagonalMatrix.hpp
+      opm/material/common/TridiagonalMatrixBatch.hpp
+      opm/material/common/DenseMatrixBatch.hpp
       opm/material/common/ResetLocale.hpp
       opm/material/common/HasMemberGeneratorMacros.hpp
       opm/material/common/UniformTabulated2DFunction.hpp
@@ -1030,6 +1087,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/densead/Evaluation1.hpp
       opm/material/densead/Evaluation12.hpp
       opm/material/densead/Evaluation2.hpp
+      opm/material/densead/EvaluationExpression.hpp
       opm/material/densead/EvaluationFormat.hpp
       opm/material/densead/EvaluationSpecializations.hpp
       opm/material/densead/Evaluation10.hpp
@@ -1132,18 +1190,21 @@ if(ENABLE_ECL_INPUT)
        opm/io/eclipse/SummaryNode.hpp
        opm/json/JsonObject.hpp
        opm/input/eclipse/Utility/Functional.hpp
+       opm/input/eclipse/Utility/InputProfile.hpp
        opm/input/eclipse/Utility/Typetools.hpp
        opm/input/eclipse/Generator/KeywordGenerator.hpp
        opm/input/eclipse/Generator/KeywordLoader.hpp
        opm/input/eclipse/Units/UnitSystem.hpp
        opm/input/eclipse/Units/Units.hpp
        opm/input/eclipse/Units/Dimension.hpp
+       opm/input/eclipse/Parser/DeckCache.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
        opm/input/eclipse/Parser/Parser.hpp
        opm/input/eclipse/Parser/ParserRecord.hpp
        opm/input/eclipse/Parser/ParserKeyword.hpp
        opm/input/eclipse/Parser/InputErrorAction.hpp
+       opm/input/eclipse/Parser/InputFileManifest.hpp
        opm/input/eclipse/Parser/ParserEnums.hpp
        opm/input/eclipse/Parser/ParseContext.hpp
        opm/input/eclipse/Parser/ParserConst.hpp
@@ -1292,6 +1353,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/Action/Actions.hpp
        opm/input/eclipse/Schedule/Action/ActionX.hpp
        opm/input/eclipse/Schedule/Action/Condition.hpp
+       opm/input/eclipse/Schedule/Action/ConditionProgram.hpp
        opm/input/eclipse/Schedule/Action/Enums.hpp
        opm/input/eclipse/Schedule/Action/ASTNode.hpp
        opm/input/eclipse/Schedule/Action/PyAction.hpp
@@ -1301,17 +1363,22 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/ArrayDimChecker.hpp
        opm/input/eclipse/Schedule/BCProp.hpp
        opm/input/eclipse/Schedule/GasLiftOpt.hpp
+       opm/input/eclipse/Schedule/GasLiftPlan.hpp
        opm/input/eclipse/Schedule/Network/Balance.hpp
        opm/input/eclipse/Schedule/Network/Branch.hpp
        opm/input/eclipse/Schedule/Network/ExtNetwork.hpp
+       opm/input/eclipse/Schedule/Network/NetworkGraph.hpp
        opm/input/eclipse/Schedule/Network/Node.hpp
        opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp
        opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingKeywordHandlers.hpp
        opm/input/eclipse/Schedule/ResCoup/GrupSlav.hpp
        opm/input/eclipse/Schedule/ResCoup/MasterGroup.hpp
        opm/input/eclipse/Schedule/ResCoup/Slaves.hpp
+       opm/input/eclipse/Schedule/ResCoup/SharedMemoryExchange.hpp
+       opm/input/eclipse/Schedule/VFPEvaluator.hpp
        opm/input/eclipse/Schedule/VFPInjTable.hpp
        opm/input/eclipse/Schedule/VFPProdTable.hpp
+       opm/input/eclipse/Schedule/VFPTableCache.hpp
        opm/input/eclipse/Schedule/Well/Connection.hpp
        opm/input/eclipse/Schedule/Well/FilterCake.hpp
        opm/input/eclipse/Schedule/Well/PAvg.hpp
@@ -1362,15 +1429,19 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/Group/GConSale.hpp
        opm/input/eclipse/Schedule/Group/GConSump.hpp
        opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp
+       opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp
        opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp
        opm/input/eclipse/Schedule/Group/GuideRateModel.hpp
        opm/input/eclipse/Schedule/MessageLimits.hpp
        opm/input/eclipse/Schedule/CompletedCells.hpp
+       opm/input/eclipse/Schedule/ControlSnapshot.hpp
        opm/input/eclipse/Schedule/Events.hpp
        opm/input/eclipse/Schedule/OilVaporizationProperties.hpp
        opm/input/eclipse/Schedule/MSW/icd.hpp
+       opm/input/eclipse/Schedule/MSW/ICDEvaluator.hpp
        opm/input/eclipse/Schedule/MSW/Segment.hpp
        opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp
+       opm/input/eclipse/Schedule/MSW/SegmentTopology.hpp
        opm/input/eclipse/Schedule/MSW/WellSegments.hpp
        opm/input/eclipse/Schedule/MSW/AICD.hpp
        opm/input/eclipse/Schedule/MSW/SICD.hpp
@@ -1392,11 +1463,13 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp
        opm/input/eclipse/Schedule/UDQ/UDQContext.hpp
        opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp
        opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp
        opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp
        opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
        opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
        opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
        opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
        opm/input/eclipse/Schedule/UDQ/UDQState.hpp
        opm/input/eclipse/Schedule/UDQ/UDQToken.hpp
@@ -1418,6 +1491,8 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/EclArrayView.hpp
+        opm/io/eclipse/EclBinaryKernels.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
@@ -1429,10 +1504,13 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/ERsm.hpp
         opm/io/eclipse/ESmry.hpp
         opm/io/eclipse/ExtESmry.hpp
+        opm/io/eclipse/MappedFile.hpp
         opm/io/eclipse/PaddedOutputString.hpp
         opm/io/eclipse/OutputStream.hpp
+        opm/io/eclipse/ExtSmryCodec.hpp
         opm/io/eclipse/ExtSmryOutput.hpp
         opm/io/eclipse/RestartFileView.hpp
+        opm/io/eclipse/SummaryKeyIndex.hpp
         opm/io/eclipse/SummaryNode.hpp
         opm/io/eclipse/rst/action.hpp
         opm/io/eclipse/rst/aquifer.hpp
@@ -1453,6 +1531,8 @@ if(ENABLE_ECL_OUTPUT)
         opm/output/data/InterRegFlowMap.hpp
         opm/output/data/Solution.hpp
         opm/output/data/Wells.hpp
+        opm/output/data/WellsTable.hpp
+        opm/output/data/WellTracerRates.hpp
         opm/output/eclipse/VectorItems/action.hpp
         opm/output/eclipse/VectorItems/aquifer.hpp
         opm/output/eclipse/VectorItems/connection.hpp
@@ -1481,6 +1561,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/output/eclipse/InteHEAD.hpp
         opm/output/eclipse/LinearisedOutputTable.hpp
         opm/output/eclipse/LogiHEAD.hpp
+        opm/output/eclipse/RegionAverage.hpp
         opm/output/eclipse/RegionCache.hpp
         opm/output/eclipse/RestartIO.hpp
         opm/output/eclipse/RestartValue.hpp
@@ -0,0 +1,166 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Micro benchmark comparing the cubic root solvers of PolynomialUtils on the
+// compressibility factor polynomials of the Peng-Robinson equation of state.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include <opm/material/common/PolynomialUtils.hpp>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure the throughput and accuracy of the cubic root solvers used by\n"
+              << "the Peng-Robinson equation of state.\n"
+              << "\nIn addition, the program takes these options:\n\n"
+              << "-n Number of polynomials (default 1000000).\n"
+              << "-r Number of repetitions (default 10).\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestOf(const int repeat, const std::function<void()>& fn)
+{
+    double best = 1.0e100;
+
+    for (int r = 0; r < repeat; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+// largest residual |p(x)|/(|a x^3| + |b x^2| + |c x| + |d|) of the computed roots
+double maxRelResidual(const std::vector<double>& b,
+                      const std::vector<double>& c,
+                      const std::vector<double>& d,
+                      const std::vector<double>& x)
+{
+    double res = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        const double v = x[i];
+        const double scale = std::abs(v*v*v) + std::abs(b[i]*v*v) + std::abs(c[i]*v) + std::abs(d[i]);
+        res = std::max(res, std::abs(d[i] + v*(c[i] + v*(b[i] + v))) / scale);
+    }
+    return res;
+}
+
+void report(const std::string& name, const std::size_t num, const double seconds,
+            const std::vector<double>& b, const std::vector<double>& c, const std::vector<double>& d,
+            const std::vector<double>& zMin, const std::vector<double>& zMax)
+{
+    const double residual = std::max(maxRelResidual(b, c, d, zMin), maxRelResidual(b, c, d, zMax));
+    std::cout << "  " << name << std::string(28 - std::min<std::size_t>(name.size(), 27), ' ')
+              << seconds * 1.0e9 / static_cast<double>(num) << " ns/op, max. rel. residual "
+              << residual << "\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t num = 1000000;
+    int repeat = 10;
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "n:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::atoll(optarg);
+            break;
+        case 'r':
+            repeat = std::atoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (num == 0) {
+        std::cerr << "The number of polynomials must be positive\n";
+        return EXIT_FAILURE;
+    }
+
+    // Z^3 - (1 - B) Z^2 + (A - 3 B^2 - 2 B) Z - B (A - B - B^2) for dimensionless
+    // attraction and co-volume parameters which cover both the one and the three
+    // root regime
+    std::vector<double> a(num, 1.0), b(num), cc(num), d(num);
+    for (std::size_t i = 0; i < num; ++i) {
+        const double A = 0.01 + 1.5 * static_cast<double>(i % 1009) / 1009.0;
+        const double B = 0.002 + 0.2 * static_cast<double>(i % 997) / 997.0;
+        b[i] = -(1 - B);
+        cc[i] = A - B*(3*B + 2);
+        d[i] = B*(-A + B*(1 + B));
+    }
+
+    std::vector<double> zMin(num), zMax(num);
+    std::vector<unsigned> numRoots(num);
+
+    std::cout << "Peng-Robinson cubic (" << num << " polynomials)\n";
+
+    report("cubicRoots", num, bestOf(repeat, [&]() {
+        double sol[3];
+        for (std::size_t i = 0; i < num; ++i) {
+            const unsigned n = Opm::cubicRoots(sol, a[i], b[i], cc[i], d[i]);
+            zMin[i] = sol[0];
+            zMax[i] = sol[n - 1];
+        }
+    }), b, cc, d, zMin, zMax);
+
+    report("invertCubicPolynomial", num, bestOf(repeat, [&]() {
+        double sol[3];
+        for (std::size_t i = 0; i < num; ++i) {
+            const unsigned n = Opm::invertCubicPolynomial(sol, a[i], b[i], cc[i], d[i]);
+            zMin[i] = sol[0];
+            zMax[i] = sol[n - 1];
+        }
+    }), b, cc, d, zMin, zMax);
+
+    report("cubicExtremeRoots", num, bestOf(repeat, [&]() {
+        for (std::size_t i = 0; i < num; ++i) {
+            Opm::cubicExtremeRoots(zMin[i], zMax[i], a[i], b[i], cc[i], d[i]);
+        }
+    }), b, cc, d, zMin, zMax);
+
+    report("cubicExtremeRoots (batch)", num, bestOf(repeat, [&]() {
+        Opm::cubicExtremeRoots(num, a.data(), b.data(), cc.data(), d.data(),
+                               zMin.data(), zMax.data(), numRoots.data());
+    }), b, cc, d, zMin, zMax);
+
+    const auto numThree = std::count(numRoots.begin(), numRoots.end(), 3u);
+    std::cout << "  (" << numThree << " polynomials with three real roots)\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,195 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Micro benchmark of the arithmetic operators and math functions of
+// DenseAd::Evaluation for the numbers of derivatives typically used by
+// the black-oil and compositional models, with static and run-time
+// numbers of derivatives.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationExpression.hpp>
+#include <opm/material/densead/Math.hpp>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure the cost of DenseAd::Evaluation operators and math functions.\n"
+              << "\nIn addition, the program takes these options:\n\n"
+              << "-n Number of evaluations per array (default 1000000).\n"
+              << "-r Number of repetitions (default 10).\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestOf(const int repeat, const std::function<void()>& fn)
+{
+    double best = 1.0e100;
+
+    for (int r = 0; r < repeat; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+void report(const std::string& name, const std::size_t num, const double seconds)
+{
+    std::cout << "  " << name << std::string(28 - std::min<std::size_t>(name.size(), 27), ' ')
+              << seconds * 1.0e9 / static_cast<double>(num) << " ns/op\n";
+}
+
+template <class Eval, class MakeVariable>
+void benchmark(const std::string& title,
+               const int numDerivs,
+               const MakeVariable& makeVariable,
+               const std::size_t num,
+               const int repeat)
+{
+    // Positive values in [1, 2) with non-trivial derivatives, so that
+    // log(), sqrt() and pow() stay in their domains.
+    std::vector<Eval> x(num);
+    std::vector<Eval> y(num);
+    for (std::size_t i = 0; i < num; ++i) {
+        x[i] = makeVariable(1.0 + static_cast<double>(i % 997) / 997.0, i % numDerivs);
+        y[i] = makeVariable(1.0 + static_cast<double>(i % 991) / 991.0, (i + 1) % numDerivs);
+        x[i].setDerivative((i + 2) % numDerivs, 0.25);
+    }
+
+    std::vector<Eval> result(num);
+
+    // The checksum keeps the compiler from removing the loops.
+    double checksum = 0.0;
+    const auto binary = [&](const std::string& name, auto op) {
+        report(name, num, bestOf(repeat, [&]() {
+            for (std::size_t i = 0; i < num; ++i)
+                result[i] = op(x[i], y[i]);
+        }));
+        checksum += result[num / 2].derivative(0);
+    };
+
+    std::cout << title << " (" << num << " evaluations)\n";
+
+    binary("x + y", [](const Eval& a, const Eval& b) { return a + b; });
+    binary("x - y", [](const Eval& a, const Eval& b) { return a - b; });
+    binary("x * y", [](const Eval& a, const Eval& b) { return a * b; });
+    binary("x / y", [](const Eval& a, const Eval& b) { return a / b; });
+    binary("x * 2.5", [](const Eval& a, const Eval&) { return a * 2.5; });
+    binary("x / 2.5", [](const Eval& a, const Eval&) { return a / 2.5; });
+    binary("x += y", [](Eval a, const Eval& b) { return a += b; });
+    binary("x *= y", [](Eval a, const Eval& b) { return a *= b; });
+    binary("exp(x)", [](const Eval& a, const Eval&) { return Opm::DenseAd::exp(a); });
+    binary("log(x)", [](const Eval& a, const Eval&) { return Opm::DenseAd::log(a); });
+    binary("sqrt(x)", [](const Eval& a, const Eval&) { return Opm::DenseAd::sqrt(a); });
+    binary("pow(x, 1.7)", [](const Eval& a, const Eval&) { return Opm::DenseAd::pow(a, 1.7); });
+    binary("pow(1.7, y)", [](const Eval&, const Eval& b) { return Opm::DenseAd::pow(1.7, b); });
+    binary("pow(x, y)", [](const Eval& a, const Eval& b) { return Opm::DenseAd::pow(a, b); });
+
+    // a chained expression, evaluated eagerly and as an expression template
+    binary("x*(1 - y*x)/y", [](const Eval& a, const Eval& b) { return a*(1.0 - b*a)/b; });
+    if constexpr (Eval::numVars != Opm::DenseAd::DynamicSize) {
+        binary("x*(1 - y*x)/y (lazy)", [](const Eval& a, const Eval& b) {
+            using Opm::DenseAd::lazy;
+            return evaluate(lazy(a)*(1.0 - lazy(b)*lazy(a))/lazy(b));
+        });
+    }
+
+    std::cout << "  (checksum " << checksum << ")\n\n";
+}
+
+template <int numDerivs>
+void benchmarkStatic(const std::size_t num, const int repeat)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, numDerivs>;
+
+    benchmark<Eval>("Evaluation<double, " + std::to_string(numDerivs) + ">", numDerivs,
+                    [](double value, int varIdx) { return Eval::createVariable(value, varIdx); },
+                    num, repeat);
+}
+
+// Run-time number of derivatives. With staticSize = 0 the derivatives live
+// on the heap, in buffers which are recycled by FastSmallVectorPool. With
+// staticSize > numDerivs they are stored inline like for static sizes.
+template <unsigned staticSize>
+void benchmarkDynamic(const int numDerivs, const std::size_t num, const int repeat)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, Opm::DenseAd::DynamicSize, staticSize>;
+
+    benchmark<Eval>("Evaluation<double, DynamicSize, " + std::to_string(staticSize)
+                    + "> with " + std::to_string(numDerivs) + " derivatives", numDerivs,
+                    [numDerivs](double value, int varIdx)
+                    { return Eval::createVariable(numDerivs, value, varIdx); },
+                    num, repeat);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t num = 1000000;
+    int repeat = 10;
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "n:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::atoll(optarg);
+            break;
+        case 'r':
+            repeat = std::atoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (num == 0) {
+        std::cerr << "The number of evaluations must be positive\n";
+        return EXIT_FAILURE;
+    }
+
+    benchmarkStatic<3>(num, repeat);
+    benchmarkStatic<4>(num, repeat);
+    benchmarkStatic<5>(num, repeat);
+    benchmarkStatic<6>(num, repeat);
+    benchmarkStatic<9>(num, repeat);
+    benchmarkStatic<12>(num, repeat);
+
+    benchmarkDynamic<0>(9, num, repeat);
+    benchmarkDynamic<16>(9, num, repeat);
+    benchmarkDynamic<0>(12, num, repeat);
+    benchmarkDynamic<16>(12, num, repeat);
+
+    return EXIT_SUCCESS;
+}
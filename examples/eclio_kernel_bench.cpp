@@ -0,0 +1,144 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Micro benchmark of the endian conversion and Fortran record kernels
+// used for binary ECLIPSE arrays, compared with the per element
+// flipEndian*() helpers.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure throughput of endian conversion kernels for binary ECLIPSE arrays.\n"
+              << "\nIn addition, the program takes these options:\n\n"
+              << "-n Number of array elements (default 10000000).\n"
+              << "-r Number of repetitions (default 10).\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestOf(const int repeat, const std::function<void()>& fn)
+{
+    double best = 1.0e100;
+
+    for (int r = 0; r < repeat; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+void report(const std::string& name, const std::size_t bytes, const double seconds)
+{
+    std::cout << "  " << name << std::string(28 - std::min<std::size_t>(name.size(), 27), ' ')
+              << seconds * 1000.0 << " ms, "
+              << static_cast<double>(bytes) / seconds / (1024.0 * 1024.0 * 1024.0) << " GiB/s\n";
+}
+
+template <typename T>
+void benchmark(const std::string& type, const std::int64_t num, const int repeat,
+               const Opm::EclIO::eclArrType arrType, T (*flip)(T))
+{
+    const int blockElements = std::get<1>(Opm::EclIO::block_size_data_binary(arrType)) / sizeof(T);
+
+    std::vector<T> data(num);
+    std::iota(data.begin(), data.end(), T{1});
+
+    std::vector<T> result(num);
+    std::vector<char> disk(Opm::EclIO::sizeOnDiskBinary(num, arrType, sizeof(T)));
+
+    const auto bytes = num * sizeof(T);
+
+    std::cout << type << " (" << num << " elements)\n";
+
+    report("per element flip", bytes, bestOf(repeat, [&]() {
+        std::transform(data.begin(), data.end(), result.begin(), flip);
+    }));
+
+    report("bulk swap", bytes, bestOf(repeat, [&]() {
+        if constexpr (sizeof(T) == 8)
+            Opm::EclIO::swapEndian64(data.data(), result.data(), num);
+        else
+            Opm::EclIO::swapEndian32(data.data(), result.data(), num);
+    }));
+
+    report("encode records", bytes, bestOf(repeat, [&]() {
+        Opm::EclIO::encodeBinaryRecords(data.data(), num, sizeof(T), blockElements, disk.data());
+    }));
+
+    report("decode records", bytes, bestOf(repeat, [&]() {
+        Opm::EclIO::decodeBinaryRecords(disk.data(), num, sizeof(T), blockElements, result.data());
+    }));
+
+    if (! std::equal(data.begin(), data.end(), result.begin())) {
+        std::cerr << "Round trip of " << type << " data failed\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    std::int64_t num = 10000000;
+    int repeat = 10;
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "n:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::atoll(optarg);
+            break;
+        case 'r':
+            repeat = std::atoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << "Kernel instruction set: " << Opm::EclIO::endianKernelISA() << "\n\n";
+
+    benchmark<int>   ("INTE", num, repeat, Opm::EclIO::INTE, &Opm::EclIO::flipEndianInt);
+    benchmark<float> ("REAL", num, repeat, Opm::EclIO::REAL, &Opm::EclIO::flipEndianFloat);
+    benchmark<double>("DOUB", num, repeat, Opm::EclIO::DOUB, &Opm::EclIO::flipEndianDouble);
+
+    return EXIT_SUCCESS;
+}
@@ -40,7 +40,10 @@ static void printHelp() {
               << "These files are created with input from the smspec and unsmry file. \n"
               << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
               << "-f if ESMRY file exist, this will be replaced. Default behaviour is that existing file is kept.\n"
-              << "-n Maximum number of threads to be used if mulitple files should be created.\n"
+              << "-n Maximum number of threads to be used. Threads are shared between files, and\n"
+              << "   used for batches of vectors within a file when only one file is created.\n"
+              << "-b Number of vectors read per batch (default: batches of about 64 MiB).\n"
+              << "-z Write chunked, compressed vector data with given number of time steps per chunk (e.g. 1024).\n"
               << "-h Print help and exit.\n\n";
 }
 
@@ -52,8 +55,10 @@ int main(int argc, char **argv) {
     int max_threads = -1;
 #endif
     bool force                     = false;
+    int chunk_size                 = 0;
+    std::size_t batch_size         = 0;
 
-    while ((c = getopt(argc, argv, "fn:h")) != -1) {
+    while ((c = getopt(argc, argv, "fn:hz:b:")) != -1) {
         switch (c) {
         case 'f':
             force = true;
@@ -61,6 +66,16 @@ int main(int argc, char **argv) {
         case 'h':
             printHelp();
             return 0;
+        case 'z':
+            chunk_size = atoi(optarg);
+            if (chunk_size < 1) {
+                std::cerr << "chunk size must be positive\n";
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'b':
+            batch_size = std::max(atoi(optarg), 0);
+            break;
         case 'n':
 #ifdef _OPENMP
             max_threads = atoi(optarg);
@@ -83,10 +98,14 @@ int main(int argc, char **argv) {
     else if (max_threads > (available_threads - 1))
         max_threads = available_threads-1;
 
-    if (max_threads > (argc-argOffset))
-        max_threads = argc-argOffset;
+    if (max_threads < 1)
+        max_threads = 1;
 
+    // Threads not needed for separate files are used for batches of
+    // vectors inside make_esmry_file.
     omp_set_num_threads(max_threads);
+
+    const int file_threads = std::min(max_threads, std::max(argc-argOffset, 1));
 #endif
 
     auto lap0 = std::chrono::system_clock::now();
@@ -94,7 +113,7 @@ int main(int argc, char **argv) {
     int num_esmry = argc-argOffset;
     std::vector<bool> status(num_esmry, false);
 
-    #pragma omp parallel for
+    #pragma omp parallel for num_threads(file_threads)
     for (int f = 0; f < num_esmry; f ++){
         std::filesystem::path inputFileName = argv[f + argOffset];
 
@@ -108,7 +127,7 @@ int main(int argc, char **argv) {
             Opm::EclIO::ESmry smry{ argv[f + argOffset] };
 
             if (smry.numberOfTimeSteps() > 0){
-                status[f] = smry.make_esmry_file();
+                status[f] = smry.make_esmry_file(chunk_size, batch_size);
                 if (! status[f]) {
                     std::cerr << "\n! Warning, smspec already have one esmry file, existing kept use option -f to replace this\n";
                 }
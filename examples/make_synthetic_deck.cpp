@@ -0,0 +1,335 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Generate synthetic decks of a given size for scaling tests of the
+// parser, the Schedule construction and the output layer.  The decks are
+// deterministic functions of the command line options, such that timings
+// of different builds can be compared.
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include <getopt.h>
+
+#include <fmt/format.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nWrite a synthetic corner point deck of a given size.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-x, -y, -z Number of cells in each direction (default 20 20 10).\n"
+              << "-w Number of wells (default 10).\n"
+              << "-m Number of segments of each well.  Zero (default) for standard wells.\n"
+              << "-t Number of report steps (default 12).\n"
+              << "-u Number of UDQs (default 0).\n"
+              << "-a Number of ACTIONX blocks (default 0).\n"
+              << "-r Number of FIP region sets in addition to FIPNUM (default 0).\n"
+              << "-o Output file (default SYNTHETIC.DATA).\n"
+              << "-h Print help and exit.\n\n";
+}
+
+struct Size
+{
+    int nx{20};
+    int ny{20};
+    int nz{10};
+    int wells{10};
+    int segments{0};
+    int steps{12};
+    int udqs{0};
+    int actions{0};
+    int regionSets{0};
+};
+
+constexpr double dx = 100.0;
+constexpr double dy = 100.0;
+constexpr double dz = 10.0;
+constexpr double top = 2000.0;
+constexpr int regionsPerSet = 10;
+
+std::string wellName(const int w)
+{
+    return fmt::format("W{:05}", w + 1);
+}
+
+// Wells spread over the grid on a stride which is coprime to typical
+// grid sizes.
+std::pair<int, int> wellLocation(const Size& size, const int w)
+{
+    const auto cell = (static_cast<long long>(w) * 7919) % (static_cast<long long>(size.nx) * size.ny);
+    return { static_cast<int>(cell % size.nx) + 1, static_cast<int>(cell / size.nx) + 1 };
+}
+
+void runspec(std::ostream& os, const Size& size)
+{
+    const auto maxSegments = std::max(size.segments, 1);
+
+    os << "RUNSPEC\n\n"
+       << "TITLE\n"
+       << fmt::format("SYNTHETIC {}x{}x{} W={} M={} T={} U={} A={} R={}\n\n",
+                      size.nx, size.ny, size.nz, size.wells, size.segments,
+                      size.steps, size.udqs, size.actions, size.regionSets)
+       << "DIMENS\n"
+       << fmt::format("  {} {} {} /\n\n", size.nx, size.ny, size.nz)
+       << "OIL\nWATER\nGAS\n\nMETRIC\n\n"
+       << "START\n  1 'JAN' 2000 /\n\n"
+       << "TABDIMS\n  1 1 20 20 /\n\n"
+       << "REGDIMS\n"
+       << fmt::format("  {} {} /\n\n", regionsPerSet, size.regionSets + 1)
+       << "WELLDIMS\n"
+       << fmt::format("  {} {} {} {} /\n\n", size.wells, size.nz,
+                      size.wells / 10 + 2, std::min(size.wells, 10))
+       << "WSEGDIMS\n"
+       << fmt::format("  {} {} 1 /\n\n", (size.segments > 0) ? size.wells : 0, maxSegments);
+
+    if (size.udqs > 0) {
+        os << "UDQDIMS\n"
+           << fmt::format("  50 25 0 {} 0 0 0 {} /\n\n", size.udqs, size.udqs);
+    }
+
+    if (size.actions > 0) {
+        os << "ACTDIMS\n"
+           << fmt::format("  {} 10 80 2 /\n\n", size.actions);
+    }
+
+    os << "UNIFOUT\n\n";
+}
+
+void grid(std::ostream& os, const Size& size)
+{
+    os << "GRID\n\nCOORD\n";
+    for (int j = 0; j <= size.ny; ++j) {
+        for (int i = 0; i <= size.nx; ++i) {
+            os << fmt::format("  {} {} {} {} {} {}\n", i*dx, j*dy, top,
+                              i*dx, j*dy, top + size.nz*dz);
+        }
+    }
+    os << "/\n\nZCORN\n";
+
+    // Each layer has a top and a bottom surface of 2*NX * 2*NY corners.
+    const auto surface = 4LL * size.nx * size.ny;
+    for (int k = 0; k < size.nz; ++k) {
+        os << fmt::format("  {}*{} {}*{}\n", surface, top + k*dz, surface, top + (k + 1)*dz);
+    }
+    os << "/\n\n";
+
+    const auto layer = static_cast<long long>(size.nx) * size.ny;
+    os << "PORO\n";
+    for (int k = 0; k < size.nz; ++k) {
+        os << fmt::format("  {}*{:g}\n", layer, 0.15 + 0.01*(k % 10));
+    }
+    os << "/\n\nPERMX\n";
+    for (int k = 0; k < size.nz; ++k) {
+        os << fmt::format("  {}*{}\n", layer, 100.0 * (1 + k % 5));
+    }
+    os << "/\n\n"
+       << "COPY\n  PERMX PERMY /\n  PERMX PERMZ /\n/\n\n"
+       << "MULTIPLY\n  PERMZ 0.1 /\n/\n\n";
+}
+
+void props(std::ostream& os)
+{
+    os << "PROPS\n\n"
+       << "SWOF\n  0.1 0.0 1.0 0.0\n  1.0 1.0 0.0 0.0 /\n\n"
+       << "SGOF\n  0.0 0.0 1.0 0.0\n  0.9 1.0 0.0 0.0 /\n\n"
+       << "PVTW\n  270 1.0 4.6E-5 0.3 0 /\n\n"
+       << "PVDO\n  100 1.10 1.0\n  400 1.00 1.1 /\n\n"
+       << "PVDG\n  100 0.010 0.015\n  400 0.004 0.020 /\n\n"
+       << "DENSITY\n  800 1000 1 /\n\n"
+       << "ROCK\n  270 1E-5 /\n\n";
+}
+
+void regions(std::ostream& os, const Size& size)
+{
+    os << "REGIONS\n\n";
+
+    const auto layer = static_cast<long long>(size.nx) * size.ny;
+    for (int set = 0; set <= size.regionSets; ++set) {
+        os << ((set == 0) ? std::string("FIPNUM") : fmt::format("FIPR{:02}", set)) << '\n';
+        for (int k = 0; k < size.nz; ++k) {
+            os << fmt::format("  {}*{}\n", layer, (k + set) % regionsPerSet + 1);
+        }
+        os << "/\n\n";
+    }
+}
+
+void solution(std::ostream& os, const Size& size)
+{
+    os << "SOLUTION\n\n"
+       << "EQUIL\n"
+       << fmt::format("  {} 270 {} 0 {} 0 /\n\n", top, top + 0.75*size.nz*dz, top);
+}
+
+void summary(std::ostream& os)
+{
+    os << "SUMMARY\n\n"
+       << "FOPR\nFWPR\nFGPR\nFGOR\n\n"
+       << "WOPR\n/\n\nWBHP\n/\n\n";
+}
+
+void wells(std::ostream& os, const Size& size)
+{
+    os << "WELSPECS\n";
+    for (int w = 0; w < size.wells; ++w) {
+        const auto [i, j] = wellLocation(size, w);
+        os << fmt::format("  '{}' 'G{:03}' {} {} {} 'OIL' /\n", wellName(w), w / 10 + 1, i, j, top);
+    }
+    os << "/\n\nCOMPDAT\n";
+    for (int w = 0; w < size.wells; ++w) {
+        const auto [i, j] = wellLocation(size, w);
+        os << fmt::format("  '{}' {} {} 1 {} 'OPEN' 1* 1* 0.2 /\n", wellName(w), i, j, size.nz);
+    }
+    os << "/\n\n";
+
+    if (size.segments <= 0) {
+        return;
+    }
+
+    // Vertical tubing from the top of the reservoir to its bottom.
+    const auto height = size.nz * dz;
+    for (int w = 0; w < size.wells; ++w) {
+        os << "WELSEGS\n"
+           << fmt::format("  '{}' {} {} 1E-5 'ABS' 'HFA' 'HO' /\n", wellName(w), top, top);
+        for (int s = 2; s <= size.segments; ++s) {
+            const auto pos = top + height * (s - 1) / std::max(size.segments - 1, 1);
+            os << fmt::format("  {} {} 1 {} {:g} {:g} 0.1 1E-5 /\n", s, s, s - 1, pos, pos);
+        }
+        os << "/\n\n";
+    }
+
+    for (int w = 0; w < size.wells; ++w) {
+        const auto [i, j] = wellLocation(size, w);
+        os << "COMPSEGS\n"
+           << fmt::format("  '{}' /\n", wellName(w));
+        for (int k = 0; k < size.nz; ++k) {
+            os << fmt::format("  {} {} {} 1 {} {} /\n", i, j, k + 1,
+                              top + k*dz, top + (k + 1)*dz);
+        }
+        os << "/\n\n";
+    }
+}
+
+void udqs(std::ostream& os, const Size& size)
+{
+    if (size.udqs <= 0) {
+        return;
+    }
+
+    os << "UDQ\n";
+    for (int u = 0; u < size.udqs; ++u) {
+        if (u % 2 == 0) {
+            os << fmt::format("  DEFINE FU{:05} FOPR * {} + FWPR /\n", u + 1, u % 7 + 1);
+        }
+        else {
+            os << fmt::format("  DEFINE WU{:05} WOPR '*' * {} /\n", u + 1, u % 5 + 1);
+        }
+    }
+    os << "/\n\n";
+}
+
+void actions(std::ostream& os, const Size& size)
+{
+    for (int a = 0; a < size.actions; ++a) {
+        const auto well = wellName(a % std::max(size.wells, 1));
+        os << "ACTIONX\n"
+           << fmt::format("  'A{:05}' 1 /\n", a + 1)
+           << fmt::format("  WBHP '{}' < {} /\n", well, 50 + a % 100)
+           << "/\n"
+           << "WELOPEN\n"
+           << fmt::format("  '{}' 'SHUT' /\n", well)
+           << "/\n"
+           << "ENDACTIO\n\n";
+    }
+}
+
+void schedule(std::ostream& os, const Size& size)
+{
+    os << "SCHEDULE\n\n";
+
+    wells(os, size);
+    udqs(os, size);
+    actions(os, size);
+
+    for (int t = 0; t < size.steps; ++t) {
+        os << "WCONHIST\n";
+        for (int w = 0; w < size.wells; ++w) {
+            const auto orat = 100.0 + (w * 37 + t * 11) % 400;
+            os << fmt::format("  '{}' 'OPEN' 'ORAT' {:g} {:g} {:g} /\n", wellName(w),
+                              orat, 0.1*t*orat / std::max(size.steps, 1), 50.0*orat);
+        }
+        os << "/\n\nTSTEP\n  30 /\n\n";
+    }
+
+    os << "END\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    Size size;
+    std::string output = "SYNTHETIC.DATA";
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "x:y:z:w:m:t:u:a:r:o:h")) != -1) {
+        switch (c) {
+        case 'x': size.nx = std::max(std::atoi(optarg), 1); break;
+        case 'y': size.ny = std::max(std::atoi(optarg), 1); break;
+        case 'z': size.nz = std::max(std::atoi(optarg), 1); break;
+        case 'w': size.wells = std::max(std::atoi(optarg), 0); break;
+        case 'm': size.segments = std::atoi(optarg); break;
+        case 't': size.steps = std::max(std::atoi(optarg), 0); break;
+        case 'u': size.udqs = std::max(std::atoi(optarg), 0); break;
+        case 'a': size.actions = std::max(std::atoi(optarg), 0); break;
+        case 'r': size.regionSets = std::clamp(std::atoi(optarg), 0, 99); break;
+        case 'o': output = optarg; break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    // A multi-segment well needs at least one segment below the top
+    // segment to attach its connections to.
+    size.segments = (size.segments > 0) ? std::max(size.segments, 2) : 0;
+
+    std::ofstream os { output };
+    if (! os) {
+        std::cerr << "Unable to open " << output << '\n';
+        return EXIT_FAILURE;
+    }
+
+    runspec(os, size);
+    grid(os, size);
+    props(os);
+    regions(os, size);
+    solution(os, size);
+    summary(os);
+    schedule(os, size);
+
+    return EXIT_SUCCESS;
+}
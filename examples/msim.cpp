@@ -33,9 +33,61 @@
 
 #include <opm/msim/msim.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
 
-int main(int /* argc */, char** argv) {
-    std::string deck_file = argv[1];
+#include <getopt.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nmsim DECK\n"
+              << "\nRun the schedule of DECK with fake well solutions and write all\n"
+              << "configured output.\n"
+              << "\nIn addition, the program takes these options:\n\n"
+              << "-s Stress mode.  Fill synthetic data for all wells, groups and cells\n"
+              << "   at every time step and print the time spent in each stage.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+void printStage(const std::string& name, const double seconds, const double total)
+{
+    std::cout << "  " << std::left << std::setw(16) << name << std::right
+              << std::fixed << std::setprecision(3) << std::setw(10) << seconds << " s"
+              << std::setw(8) << std::setprecision(1)
+              << (total > 0.0 ? 100.0 * seconds / total : 0.0) << " %\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    bool stress = false;
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "sh")) != -1) {
+        switch (c) {
+        case 's':
+            stress = true;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    std::string deck_file = argv[optind];
     Opm::Parser parser;
     Opm::ParseContext parse_context;
     Opm::ErrorGuard error_guard;
@@ -55,6 +107,30 @@ int main(int /* argc */, char** argv) {
 
     Opm::msim msim(state, schedule);
     Opm::EclipseIO io(state, state.getInputGrid(), schedule, summary_config);
+    msim.stress(stress);
+
+    const auto start = std::chrono::steady_clock::now();
     msim.run(io, false);
+    io.flush();
+    const std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+
+    if (stress) {
+        const auto& stages = msim.stage_times();
+        const auto& output = io.outputTimes();
+        const auto writeOther = stages.output - output.summary
+            - output.restart - output.rft - output.rpt;
+
+        std::cout << "\nStage breakdown, " << schedule.size() - 1 << " report steps:\n";
+        printStage("Simulate", stages.simulate, total.count());
+        printStage("Summary eval", stages.summary_eval, total.count());
+        printStage("UDQ", stages.udq, total.count());
+        printStage("ACTIONX", stages.actionx, total.count());
+        printStage("Summary write", output.summary, total.count());
+        printStage("Restart", output.restart, total.count());
+        printStage("RFT", output.rft, total.count());
+        printStage("RPT", output.rpt, total.count());
+        printStage("Output other", std::max(writeOther, 0.0), total.count());
+        printStage("Total", total.count(), total.count());
+    }
 }
 
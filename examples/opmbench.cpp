@@ -0,0 +1,384 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark suite covering deck input, tabulated functions, automatic
+// differentiation, PVT evaluation and ECLIPSE file I/O.  Results are
+// printed and optionally written as JSON, such that the timings of
+// different releases can be compared.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include <fmt/format.h>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nRun the opm-common benchmark suite.\n"
+              << "\nIn addition, the program takes these options:\n\n"
+              << "-d Deck for the input benchmarks.  May be repeated.\n"
+              << "-s Summary file (.SMSPEC or .ESMRY) for the summary read benchmark.\n"
+              << "-f Only run benchmarks whose name contains this string.\n"
+              << "-j Write results as JSON to this file.\n"
+              << "-n Number of evaluations of the kernel benchmarks (default 1000000).\n"
+              << "-r Number of repetitions (default 5).\n"
+              << "-h Print help and exit.\n\n";
+}
+
+struct Result
+{
+    std::string name{};
+    std::size_t items{0};
+    int repetitions{0};
+    double best{0.0};
+    double mean{0.0};
+};
+
+class Suite
+{
+public:
+    Suite(const int repeat, const std::string& filter)
+        : repeat_{ repeat }
+        , filter_{ filter }
+    {}
+
+    // Time fn() repeat_ times.  The cost per item assumes that each call
+    // processes 'items' items.
+    void run(const std::string& name, const std::size_t items,
+             const std::function<void()>& fn)
+    {
+        if (name.find(this->filter_) == std::string::npos)
+            return;
+
+        auto result = Result { name, items, this->repeat_, 1.0e100, 0.0 };
+        for (int r = 0; r < this->repeat_; ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            result.best = std::min(result.best, elapsed.count());
+            result.mean += elapsed.count() / this->repeat_;
+        }
+
+        std::cout << fmt::format("  {:<56} {:>12.6f} s {:>14.3f} ns/item\n", name,
+                                 result.best, result.best * 1.0e9 / std::max(items, std::size_t{1}));
+        this->results_.push_back(std::move(result));
+    }
+
+    void writeJSON(const std::string& fileName) const
+    {
+        std::ofstream os { fileName };
+        if (! os) {
+            std::cerr << "Unable to open " << fileName << '\n';
+            std::exit(EXIT_FAILURE);
+        }
+
+        char date[32];
+        const auto now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        os << "{\n  \"context\": {\"date\": \"" << date << "\", \"repetitions\": "
+           << this->repeat_ << "},\n  \"benchmarks\": [";
+
+        const char* sep = "\n";
+        for (const auto& result : this->results_) {
+            os << sep << fmt::format(R"(    {{"name": "{}", "items": {}, "repetitions": {}, )"
+                                     R"("best_time": {:.9g}, "mean_time": {:.9g}, "time_unit": "s"}})",
+                                     result.name, result.items, result.repetitions,
+                                     result.best, result.mean);
+            sep = ",\n";
+        }
+
+        os << "\n  ]\n}\n";
+    }
+
+private:
+    int repeat_{1};
+    std::string filter_{};
+    std::vector<Result> results_{};
+};
+
+// Opaque to the optimiser, such that the benchmarked work is kept.
+const void* volatile benchmarkSink = nullptr;
+
+template <class T>
+void doNotOptimize(const T& value)
+{
+    benchmarkSink = &value;
+}
+
+void tabulatedFunctions(Suite& suite, const std::size_t num)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 3>;
+
+    std::vector<double> x(100), y(100);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>(i);
+        y[i] = std::sqrt(x[i]);
+    }
+    const Opm::Tabulated1DFunction<double> fn1D(x, y, /*sortInputs=*/false);
+
+    std::vector<Eval> pos(num);
+    for (std::size_t i = 0; i < num; ++i)
+        pos[i] = Eval::createVariable(static_cast<double>(i % 9901) / 100.0, 0);
+
+    std::vector<Eval> res(num);
+    suite.run("Tabulated1DFunction::eval", num, [&]() {
+        for (std::size_t i = 0; i < num; ++i)
+            res[i] = fn1D.eval(pos[i], /*extrapolate=*/true);
+        doNotOptimize(res);
+    });
+
+    Opm::UniformXTabulated2DFunction<double> fn2D;
+    for (std::size_t i = 0; i < 20; ++i) {
+        const auto xi = static_cast<double>(i);
+        fn2D.appendXPos(xi);
+        for (std::size_t j = 0; j < 20 + i % 5; ++j) {
+            const auto yj = static_cast<double>(j) * (1.0 + 0.01*xi);
+            fn2D.appendSamplePoint(i, yj, xi*yj + 1.0);
+        }
+    }
+
+    std::vector<Eval> ypos(num);
+    for (std::size_t i = 0; i < num; ++i) {
+        pos[i] = Eval::createVariable(static_cast<double>(i % 1901) / 100.0, 0);
+        ypos[i] = Eval::createVariable(static_cast<double>(i % 1801) / 100.0, 1);
+    }
+
+    suite.run("UniformXTabulated2DFunction::eval", num, [&]() {
+        fn2D.eval(num, pos.data(), ypos.data(), res.data(), /*extrapolate=*/true);
+        doNotOptimize(res);
+    });
+}
+
+void denseAd(Suite& suite, const std::size_t num)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 3>;
+
+    std::vector<Eval> a(num), b(num), res(num);
+    for (std::size_t i = 0; i < num; ++i) {
+        a[i] = Eval::createVariable(1.0 + static_cast<double>(i % 997) / 997.0, i % 3);
+        b[i] = Eval::createVariable(1.0 + static_cast<double>(i % 991) / 991.0, (i + 1) % 3);
+    }
+
+    suite.run("DenseAd<3> a*b + a/b", num, [&]() {
+        for (std::size_t i = 0; i < num; ++i)
+            res[i] = a[i]*b[i] + a[i]/b[i];
+        doNotOptimize(res);
+    });
+
+    suite.run("DenseAd<3> exp(log(a)*b)", num, [&]() {
+        for (std::size_t i = 0; i < num; ++i)
+            res[i] = Opm::exp(Opm::log(a[i])*b[i]);
+        doNotOptimize(res);
+    });
+}
+
+void eclFileIO(Suite& suite, const std::size_t num)
+{
+    const auto fileName = (std::filesystem::temp_directory_path() /
+                           fmt::format("opmbench_{}.INIT", std::time(nullptr))).string();
+
+    std::vector<double> doub(num);
+    std::vector<int> inte(num);
+    for (std::size_t i = 0; i < num; ++i) {
+        doub[i] = static_cast<double>(i) * 0.5;
+        inte[i] = static_cast<int>(i);
+    }
+
+    suite.run("EclOutput::write", 2*num, [&]() {
+        Opm::EclIO::EclOutput output(fileName, /*formatted=*/false);
+        output.write("DOUB", doub);
+        output.write("INTE", inte);
+    });
+
+    suite.run("EclFile::loadData", 2*num, [&]() {
+        Opm::EclIO::EclFile file(fileName);
+        file.loadData();
+        doNotOptimize(file.get<double>("DOUB"));
+    });
+
+    std::filesystem::remove(fileName);
+}
+
+void summaryRead(Suite& suite, const std::string& fileName)
+{
+    suite.run(fmt::format("ESmry::loadData [{}]", fileName), 1, [&]() {
+        Opm::EclIO::ESmry smry(fileName);
+        smry.loadData();
+        doNotOptimize(smry);
+    });
+}
+
+void deckInput(Suite& suite, const std::string& deckFile, const std::size_t num)
+{
+    const auto name = std::filesystem::path(deckFile).filename().string();
+
+    Opm::ParseContext parseContext;
+    Opm::ErrorGuard errors;
+    Opm::Parser parser;
+
+    std::unique_ptr<Opm::Deck> deck;
+    suite.run(fmt::format("Parser::parseFile [{}]", name), 1, [&]() {
+        deck = std::make_unique<Opm::Deck>(parser.parseFile(deckFile, parseContext, errors));
+    });
+    if (deck == nullptr)
+        deck = std::make_unique<Opm::Deck>(parser.parseFile(deckFile, parseContext, errors));
+
+    std::unique_ptr<Opm::EclipseState> state;
+    suite.run(fmt::format("EclipseState [{}]", name), 1, [&]() {
+        state = std::make_unique<Opm::EclipseState>(*deck);
+    });
+    if (state == nullptr)
+        state = std::make_unique<Opm::EclipseState>(*deck);
+
+    std::unique_ptr<Opm::Schedule> schedule;
+    const auto python = std::make_shared<Opm::Python>();
+    suite.run(fmt::format("Schedule [{}]", name), 1, [&]() {
+        schedule = std::make_unique<Opm::Schedule>(*deck, *state, python);
+    });
+    if (schedule == nullptr)
+        schedule = std::make_unique<Opm::Schedule>(*deck, *state, python);
+
+    const auto& fp = state->fieldProps();
+    if (fp.has_double("PORO")) {
+        suite.run(fmt::format("FieldPropsManager::get_double(PORO) [{}]", name),
+                  state->getInputGrid().getNumActive(), [&]() {
+            doNotOptimize(fp.get_double("PORO"));
+        });
+    }
+
+    if (state->runspec().phases().active(Opm::Phase::OIL)) {
+        using Eval = Opm::DenseAd::Evaluation<double, 3>;
+
+        Opm::OilPvtMultiplexer<double> oilPvt;
+        oilPvt.initFromState(*state, *schedule);
+
+        std::vector<unsigned> region(num, 0);
+        std::vector<Eval> temperature(num, Eval{288.71});
+        std::vector<Eval> pressure(num), rs(num, Eval{0.0}), res(num);
+        for (std::size_t i = 0; i < num; ++i)
+            pressure[i] = Eval::createVariable(1.0e7 + 1.0e3*static_cast<double>(i % 10007), 0);
+
+        suite.run(fmt::format("OilPvt::viscosity [{}]", name), num, [&]() {
+            oilPvt.viscosity(num, region.data(), temperature.data(),
+                             pressure.data(), rs.data(), res.data());
+            doNotOptimize(res);
+        });
+
+        suite.run(fmt::format("OilPvt::inverseFormationVolumeFactor [{}]", name), num, [&]() {
+            for (std::size_t i = 0; i < num; ++i)
+                res[i] = oilPvt.inverseFormationVolumeFactor(0, temperature[i], pressure[i], rs[i]);
+            doNotOptimize(res);
+        });
+    }
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> decks;
+    std::vector<std::string> summaries;
+    std::string filter;
+    std::string json;
+    std::size_t num = 1000000;
+    int repeat = 5;
+    int c = 0;
+
+    while ((c = getopt(argc, argv, "d:s:f:j:n:r:h")) != -1) {
+        switch (c) {
+        case 'd':
+            decks.emplace_back(optarg);
+            break;
+        case 's':
+            summaries.emplace_back(optarg);
+            break;
+        case 'f':
+            filter = optarg;
+            break;
+        case 'j':
+            json = optarg;
+            break;
+        case 'n':
+            num = std::strtoull(optarg, nullptr, 10);
+            break;
+        case 'r':
+            repeat = std::max(std::atoi(optarg), 1);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    // The input benchmarks should not be dominated by message output.
+    Opm::OpmLog::removeAllBackends();
+
+    Suite suite(repeat, filter);
+
+    tabulatedFunctions(suite, num);
+    denseAd(suite, num);
+    eclFileIO(suite, num);
+
+    for (const auto& summary : summaries)
+        summaryRead(suite, summary);
+
+    for (const auto& deck : decks)
+        deckInput(suite, deck, num);
+
+    if (! json.empty())
+        suite.writeJSON(json);
+
+    return EXIT_SUCCESS;
+}
@@ -28,6 +28,7 @@
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Parser/InputFileManifest.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 
 
@@ -92,6 +93,12 @@ void print_keywords(const std::vector<keyword>& keywords, std::size_t deck_hash,
 }
 
 
+void print_manifest(const Opm::InputFileManifest& manifest) {
+    manifest.write(std::cout);
+    fmt::print("\n{:16s} : {:016x}\n", "Total", manifest.hash());
+}
+
+
 void print_help_and_exit() {
     const char * help_text = R"(The purpose of the opmhash program is to load a deck and create a summary, by
 diffing two such summaries it is simple to determine if two decks are similar.
@@ -118,6 +125,12 @@ Options:
  -l : Add filename and linenumber information to each keyword.
  -s : Short form - only print the hash of the complete deck.
  -S : Silent form - will not print any deck output.
+ -f : Fast form - do not parse the deck, but hash the raw content of the
+      DATA file and all files it refers to through INCLUDE, IMPORT and
+      GDFILE.  The files are hashed in parallel and the output is a
+      manifest with hash, size and path of each file.  The hash is
+      sensitive to any change in the files, including white-space and
+      comments, but insensitive to their location.
 
 It is possible to add multiple deck arguments, they are then scanned repeatedly,
 and the decks are compared. In the case of multiple deck arguments the exit
@@ -135,14 +148,18 @@ int main(int argc, char** argv) {
     bool location_info = false;
     bool short_form = false;
     bool silent = false;
+    bool fast = false;
 
     while (true) {
         int c;
-        c = getopt(argc, argv, "lsS");
+        c = getopt(argc, argv, "flsS");
         if (c == -1)
             break;
 
         switch(c) {
+        case 'f':
+            fast = true;
+            break;
         case 'l':
             location_info = true;
             break;
@@ -162,6 +179,20 @@ int main(int argc, char** argv) {
     std::vector<std::pair<std::string, std::size_t>> deck_hash_table;
     for (int iarg = arg_offset; iarg < argc; iarg++) {
         const std::string deck_file = argv[iarg];
+        if (fast) {
+            const auto manifest = Opm::InputFileManifest::create(deck_file, 0);
+            deck_hash_table.emplace_back(deck_file, manifest.hash());
+            if (silent)
+                continue;
+
+            if (short_form)
+                fmt::print("{:016x}\n", manifest.hash());
+            else
+                print_manifest(manifest);
+
+            continue;
+        }
+
         auto keywords = load_deck(deck_file);
         auto deck_hash = make_deck_hash(keywords);
         deck_hash_table.emplace_back(deck_file, deck_hash);
@@ -17,19 +17,32 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <iostream>
-#include <iomanip>
+#include <getopt.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <fmt/format.h>
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
-#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Utility/InputProfile.hpp>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
@@ -37,56 +50,265 @@
 #include <opm/common/utility/TimeService.hpp>
 
 
+struct Options {
+    int threads = 1;
+    bool lazy = false;
+    std::string cache_dir;
+    bool profile = false;
+    std::size_t top = 10;
+    std::string folded_file;
+};
+
+
+struct Stage {
+    std::string name;
+    double seconds;
+    std::optional<std::size_t> peak_rss;   // kB
+    bool peak_reset;
+    std::vector<Opm::InputProfile::Record> records;
+};
+
+
 void initLogging() {
     std::shared_ptr<Opm::StreamLog> cout_log = std::make_shared<Opm::StreamLog>(std::cout, Opm::Log::DefaultMessageTypes);
     Opm::OpmLog::addBackend( "COUT" , cout_log);
 }
 
-inline void loadDeck( const char * deck_file) {
+
+/*
+  Reset the peak resident set size of the process to the current size.
+  Only possible on Linux, elsewhere the peak of the whole process so far
+  is reported for each stage.
+*/
+bool resetPeakRss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (!clear_refs)
+        return false;
+
+    clear_refs << "5" << std::flush;
+    return static_cast<bool>(clear_refs);
+}
+
+
+std::optional<std::size_t> peakRss() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::stoul(line.substr(6));
+    }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return static_cast<std::size_t>(usage.ru_maxrss);
+
+    return {};
+}
+
+
+void runStage(const char* name, const Options& options, std::vector<Stage>& stages,
+              const std::function<void()>& stage) {
+    if (options.profile || !options.folded_file.empty())
+        Opm::InputProfile::clear();
+
+    const bool peak_reset = resetPeakRss();
+    const auto start = Opm::TimeService::now();
+    stage();
+    const auto elapsed = Opm::TimeService::now() - start;
+
+    std::vector<Opm::InputProfile::Record> records;
+    if (options.profile || !options.folded_file.empty())
+        records = Opm::InputProfile::records();
+
+    stages.push_back({name, std::chrono::duration<double>(elapsed).count(),
+                      peakRss(), peak_reset, std::move(records)});
+}
+
+
+void printStages(const std::vector<Stage>& stages, const Options& options) {
+    std::cout << "Time: " << std::endl;
+    for (const auto& stage : stages) {
+        fmt::print("   {:.<9s}: {:.3f} seconds", stage.name, stage.seconds);
+        if (stage.peak_rss.has_value())
+            fmt::print("   peak RSS{}: {:.1f} MB", stage.peak_reset ? "" : " (process)",
+                       stage.peak_rss.value() / 1024.0);
+        fmt::print("\n");
+    }
+
+    if (!options.profile)
+        return;
+
+    for (const auto& stage : stages) {
+        if (stage.records.empty())
+            continue;
+
+        fmt::print("\n{}:\n", stage.name);
+        fmt::print("   {:<10s} {:<40s} {:>8s} {:>10s} {:>12s}\n", "category", "name", "count", "seconds", "bytes");
+
+        std::map<std::string, std::size_t> shown;
+        for (const auto& record : stage.records) {
+            if (shown[record.category]++ >= options.top)
+                continue;
+
+            fmt::print("   {:<10s} {:<40s} {:>8d} {:>10.3f} {:>12d}\n",
+                       record.category, record.name, record.count, record.seconds, record.bytes);
+        }
+    }
+}
+
+
+std::string foldedFrame(std::string frame) {
+    std::replace(frame.begin(), frame.end(), ';', ':');
+    return frame;
+}
+
+
+/*
+  One line per profile entry, below a frame for the deck and the stage,
+  in the folded stack format of flamegraph.pl and speedscope.  The time
+  of the stage which is not covered by any entry is assigned to the
+  stage frame itself.  The "phase" entries overlap the other entries and
+  are left out.
+*/
+void writeFolded(std::ostream& os, const std::string& deck_file, const std::vector<Stage>& stages) {
+    const auto usec = [](double seconds) { return static_cast<long long>(seconds * 1.0e6 + 0.5); };
+    const auto deck = foldedFrame(deck_file);
+
+    for (const auto& stage : stages) {
+        double covered = 0;
+        for (const auto& record : stage.records) {
+            if (record.category == "phase")
+                continue;
+
+            covered += record.seconds;
+            os << deck << ';' << stage.name << ';' << foldedFrame(record.category)
+               << ';' << foldedFrame(record.name) << ' ' << usec(record.seconds) << '\n';
+        }
+
+        if (stage.seconds > covered)
+            os << deck << ';' << stage.name << ' ' << usec(stage.seconds - covered) << '\n';
+    }
+}
+
+
+inline void loadDeck( const char * deck_file, const Options& options, std::ostream* folded) {
     Opm::ParseContext parseContext;
     Opm::ErrorGuard errors;
     Opm::Parser parser;
     auto python = std::make_shared<Opm::Python>();
 
+    parser.setNumThreads( options.threads );
+    parser.setLazyKeywords( options.lazy );
+    if (!options.cache_dir.empty())
+        parser.setDeckCacheDirectory( options.cache_dir );
+
     std::cout << "Loading deck: " << deck_file << " ..... "; std::cout.flush();
 
-    Opm::time_point start;
+    std::vector<Stage> stages;
+    std::optional<Opm::Deck> deck;
+    std::optional<Opm::EclipseState> state;
+    std::optional<Opm::Schedule> schedule;
 
-    start = Opm::TimeService::now();
-    auto deck = parser.parseFile(deck_file, parseContext, errors);
-    auto deck_time = Opm::TimeService::now() - start;
+    runStage("deck", options, stages, [&]() {
+        deck.emplace( parser.parseFile(deck_file, parseContext, errors) );
+    });
 
     std::cout << "parse complete - creating EclipseState .... ";  std::cout.flush();
 
-    start = Opm::TimeService::now();
-    Opm::EclipseState state( deck );
-    auto state_time = Opm::TimeService::now() - start;
+    runStage("state", options, stages, [&]() {
+        state.emplace( *deck );
+    });
 
     std::cout << "creating Schedule .... ";  std::cout.flush();
 
-    start = Opm::TimeService::now();
-    Opm::Schedule schedule( deck, state, python);
-    auto schedule_time = Opm::TimeService::now() - start;
+    runStage("schedule", options, stages, [&]() {
+        schedule.emplace( *deck, *state, python );
+    });
 
     std::cout << "creating SummaryConfig .... ";  std::cout.flush();
 
-    start = Opm::TimeService::now();
-    Opm::SummaryConfig summary( deck, schedule, state.fieldProps(), state.aquifer(),
-                                parseContext, errors );
-    auto summary_time = Opm::TimeService::now() - start;
+    runStage("summary", options, stages, [&]() {
+        Opm::SummaryConfig summary( *deck, *schedule, state->fieldProps(), state->aquifer(),
+                                    parseContext, errors );
+    });
 
     std::cout << "complete." << std::endl << std::endl;
-    std::cout << "Time: " << std::endl;
-    std::cout << "   deck.....: "  << std::chrono::duration<double>(deck_time).count()  << " seconds" << std::endl;
-    std::cout << "   state....: "  << std::chrono::duration<double>(state_time).count()  << " seconds" << std::endl;
-    std::cout << "   schedule.: "  << std::chrono::duration<double>(schedule_time).count()  << " seconds" << std::endl;
-    std::cout << "   summary..: "  << std::chrono::duration<double>(summary_time).count()  << " seconds" << std::endl;
+    printStages(stages, options);
+
+    if (folded != nullptr)
+        writeFolded(*folded, deck_file, stages);
+}
+
+
+void print_help_and_exit() {
+    const char * help_text = R"(Usage: opmi [options] DECK [DECK ...]
+
+Load each deck, create EclipseState, Schedule and SummaryConfig, and print
+the time and peak resident set size of each stage.
+
+Options:
+
+ -j N    : Parse with N threads, zero selects all available threads.
+ -l      : Create data keywords lazily on first access.
+ -c DIR  : Load and store binary deck snapshots in DIR.
+ -p      : Print the most expensive input profile entries of each stage.
+ -n N    : Number of entries per category printed with -p, default 10.
+ -f FILE : Write the input profile of all stages to FILE in the folded
+           stack format of flamegraph.pl and speedscope.
+
+)";
+    std::cerr << help_text << std::endl;
+    std::exit(EXIT_FAILURE);
 }
 
 
 int main(int argc, char** argv) {
+    Options options;
+
+    int c;
+    while ((c = getopt(argc, argv, "j:lc:pn:f:h")) != -1) {
+        switch (c) {
+        case 'j':
+            options.threads = std::atoi(optarg);
+            break;
+        case 'l':
+            options.lazy = true;
+            break;
+        case 'c':
+            options.cache_dir = optarg;
+            break;
+        case 'p':
+            options.profile = true;
+            break;
+        case 'n':
+            options.top = std::strtoul(optarg, nullptr, 10);
+            break;
+        case 'f':
+            options.folded_file = optarg;
+            break;
+        default:
+            print_help_and_exit();
+        }
+    }
+
+    if (optind >= argc)
+        print_help_and_exit();
+
+    if (options.profile || !options.folded_file.empty()) {
+        Opm::InputProfile::enable(Opm::InputProfile::Format::CSV);
+        Opm::InputProfile::setAutoReport(false);
+    }
+
+    std::ofstream folded;
+    if (!options.folded_file.empty()) {
+        folded.open(options.folded_file);
+        if (!folded) {
+            std::cerr << "Could not open " << options.folded_file << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
     initLogging();
-    for (int iarg = 1; iarg < argc; iarg++)
-        loadDeck( argv[iarg] );
+    for (int iarg = optind; iarg < argc; iarg++)
+        loadDeck( argv[iarg], options, folded.is_open() ? &folded : nullptr );
 }
-
@@ -23,6 +23,7 @@
 #include <getopt.h>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckOutput.hpp>
 #include <opm/input/eclipse/EclipseState/InitConfig/InitConfig.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/I.hpp>
@@ -41,7 +42,11 @@ Opm::Deck pack_deck( const char * deck_file, std::ostream& os) {
     Opm::Parser parser;
 
     auto deck = parser.parseFile(deck_file, parseContext, errors);
-    os << deck;
+    {
+        Opm::DeckOutput out(os, 10, Opm::DeckOutput::file_buffer_size);
+        out.fmt.min_repeat = 4;
+        deck.write(out);
+    }
 
     return deck;
 }
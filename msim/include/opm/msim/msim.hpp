@@ -34,6 +34,17 @@ public:
     using well_rate_function = double(const EclipseState&, const Schedule&, const SummaryState& st, const data::Solution&, size_t report_step, double seconds_elapsed);
     using solution_function = void(const EclipseState&, const Schedule&, data::Solution&, size_t report_step, double seconds_elapsed);
 
+    /// Accumulated wall-clock time, in seconds, spent in each stage of
+    /// run().
+    struct StageTimes
+    {
+        double simulate{0.0};
+        double summary_eval{0.0};
+        double udq{0.0};
+        double actionx{0.0};
+        double output{0.0};
+    };
+
     msim(const EclipseState& state, const Schedule& schedule_arg);
 
     Opm::UDAValue uda_val();
@@ -41,6 +52,14 @@ public:
     void well_rate(const std::string& well, data::Rates::opt rate, std::function<well_rate_function> func);
     void solution(const std::string& field, std::function<solution_function> func);
     void run(EclipseIO& io, bool report_only);
+
+    /// Fill synthetic rates, pressures and connection data for all wells,
+    /// guide rates for all groups and PRESSURE/SWAT/SGAS for all active
+    /// cells at every time step.  Exercises the output layer at the scale
+    /// of the input model rather than of the registered callbacks.
+    void stress(bool enable);
+
+    const StageTimes& stage_times() const { return this->stage_times_; }
     void post_step(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, const time_point& sim_time);
 
 private:
@@ -66,10 +85,13 @@ private:
                 const data::Solution& sol, const data::Wells& well_data,
                 const data::GroupAndNetworkValues& group_data, EclipseIO& io);
     void simulate(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, double seconds_elapsed, double time_step);
+    void stress_fill(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, double seconds_elapsed) const;
 
     EclipseState state;
     std::map<std::string, std::map<data::Rates::opt, std::function<well_rate_function>>> well_rates;
     std::map<std::string, std::function<solution_function>> solutions;
+    bool stress_{false};
+    StageTimes stage_times_{};
 
 public:
     Schedule schedule;
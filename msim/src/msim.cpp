@@ -36,10 +36,14 @@
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQParams.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/Connection.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 
@@ -51,11 +55,14 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <ctime>
 #include <functional>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace {
     std::function<std::unique_ptr<Opm::RegionSetMatcher>()>
@@ -68,6 +75,36 @@ namespace {
             }
         };
     }
+
+    template <typename Func>
+    void timed(double& total, Func&& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        total += std::chrono::duration<double>
+            (std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Fill cell field with smoothly varying synthetic values.
+    void stressField(Opm::data::Solution&            sol,
+                     const std::string&              name,
+                     const Opm::UnitSystem::measure  measure,
+                     const std::size_t               numCells,
+                     const double                    base,
+                     const double                    ampl,
+                     const double                    phase)
+    {
+        if (! sol.has(name)) {
+            sol.insert(name, measure, std::vector<double>(numCells),
+                       Opm::data::TargetType::RESTART_SOLUTION);
+        }
+
+        auto& values = sol.data<double>(name);
+        values.resize(numCells);
+        for (auto cell = 0*numCells; cell < numCells; ++cell) {
+            values[cell] = base + ampl*std::sin(phase + 1.0e-3*cell);
+        }
+    }
 } // Anonymous namespace
 
 namespace Opm {
@@ -107,7 +144,9 @@ void msim::run(EclipseIO& io, bool report_only)
         }
 
         const auto sim_time = TimeService::from_time_t(schedule.simTime(report_step));
-        post_step(sol, well_data, group_nwrk_data, report_step, sim_time);
+        timed(this->stage_times_.actionx, [&]() {
+            post_step(sol, well_data, group_nwrk_data, report_step, sim_time);
+        });
 
         const auto& exit_status = schedule.exitStatus();
         if (exit_status.has_value()) {
@@ -117,6 +156,12 @@ void msim::run(EclipseIO& io, bool report_only)
 }
 
 
+void msim::stress(const bool enable)
+{
+    this->stress_ = enable;
+}
+
+
 UDAValue msim::uda_val()
 {
     return UDAValue();
@@ -146,10 +191,8 @@ void msim::post_step(data::Solution& /* sol */,
         }
     }
 
-    for (const auto& pyaction : actions.pending_python(this->action_state)) {
-        this->schedule.runPyAction(report_step, *pyaction,
-                                   this->action_state, this->state, this->st);
-    }
+    this->schedule.runPyActions(report_step, actions.pending_python(this->action_state),
+                                this->action_state, this->state, this->st);
 }
 
 
@@ -184,37 +227,45 @@ void msim::run_step(const WellTestState& wtest_state,
             time_step = end_time - seconds_elapsed;
         }
 
-        this->simulate(sol, well_data, group_nwrk_data, report_step, seconds_elapsed, time_step);
+        timed(this->stage_times_.simulate, [&]() {
+            this->simulate(sol, well_data, group_nwrk_data, report_step, seconds_elapsed, time_step);
+        });
 
         seconds_elapsed += time_step;
 
-        io.summary().eval(this->st,
-                          report_step,
-                          seconds_elapsed,
-                          well_data,
-                          /* wbp = */ {},
-                          group_nwrk_data,
-                          /* sing_values = */ {},
-                          /* initial_inplace = */ {},
-                          /* inplace = */ {});
-
-        this->schedule.getUDQConfig(report_step - 1)
-            .eval(report_step,
-                  this->schedule.wellMatcher(report_step),
-                  this->schedule.segmentMatcherFactory(report_step),
-                  createRegionSetMatcherFactory(this->state),
-                  this->st,
-                  udq_state);
-
-        this->output(wtest_state,
-                     udq_state,
-                     report_step,
-                     (seconds_elapsed < end_time),
-                     seconds_elapsed,
-                     sol,
-                     well_data,
-                     group_nwrk_data,
-                     io);
+        timed(this->stage_times_.summary_eval, [&]() {
+            io.summary().eval(this->st,
+                              report_step,
+                              seconds_elapsed,
+                              well_data,
+                              /* wbp = */ {},
+                              group_nwrk_data,
+                              /* sing_values = */ {},
+                              /* initial_inplace = */ {},
+                              /* inplace = */ {});
+        });
+
+        timed(this->stage_times_.udq, [&]() {
+            this->schedule.getUDQConfig(report_step - 1)
+                .eval(report_step,
+                      this->schedule.wellMatcher(report_step),
+                      this->schedule.segmentMatcherFactory(report_step),
+                      createRegionSetMatcherFactory(this->state),
+                      this->st,
+                      udq_state);
+        });
+
+        timed(this->stage_times_.output, [&]() {
+            this->output(wtest_state,
+                         udq_state,
+                         report_step,
+                         (seconds_elapsed < end_time),
+                         seconds_elapsed,
+                         sol,
+                         well_data,
+                         group_nwrk_data,
+                         io);
+        });
     }
 }
 
@@ -244,11 +295,16 @@ void msim::output(const WellTestState& wtest_state,
 
 void msim::simulate(data::Solution& sol,
                     data::Wells& well_data,
-                    data::GroupAndNetworkValues& /* group_nwrk_data */,
+                    data::GroupAndNetworkValues& group_nwrk_data,
                     const size_t report_step,
                     const double seconds_elapsed,
                     const double time_step)
 {
+    if (this->stress_) {
+        this->stress_fill(sol, well_data, group_nwrk_data,
+                          report_step, seconds_elapsed + time_step);
+    }
+
     for (const auto& sol_pair : this->solutions) {
         auto func = sol_pair.second;
         func(this->state, this->schedule, sol, report_step, seconds_elapsed + time_step);
@@ -275,7 +331,94 @@ void msim::simulate(data::Solution& sol,
 
         // This is complete bogus; a temporary fix to pass an assert() in the
         // the restart output.
-        well.connections.resize(100);
+        if (! this->stress_) {
+            well.connections.resize(100);
+        }
+    }
+}
+
+
+void msim::stress_fill(data::Solution& sol,
+                       data::Wells& well_data,
+                       data::GroupAndNetworkValues& group_nwrk_data,
+                       const size_t report_step,
+                       const double seconds_elapsed) const
+{
+    // Slow variation in time such that consecutive steps differ.
+    const double phase = seconds_elapsed / (30.0 * 86400.0);
+
+    const auto numCells = this->state.getInputGrid().getNumActive();
+    stressField(sol, "PRESSURE", UnitSystem::measure::pressure, numCells, 250.0e5, 50.0e5, phase);
+    stressField(sol, "SWAT", UnitSystem::measure::identity, numCells, 0.3, 0.1, phase);
+    stressField(sol, "SGAS", UnitSystem::measure::identity, numCells, 0.1, 0.05, phase);
+
+    const auto& pressure = sol.data<double>("PRESSURE");
+
+    for (const auto& wname : this->schedule.wellNames(report_step)) {
+        const auto& sched_well = this->schedule.getWell(wname, report_step);
+        const bool open = sched_well.getStatus() == Well::Status::OPEN;
+        const double sign = sched_well.isProducer() ? -1.0 : 1.0;
+        const double q = open ? sign * (1.0 + 0.5*std::sin(phase)) * 1.0e-2 : 0.0;
+
+        // Producers flow all phases, injectors only the injected one.
+        double oil = 1.0, wat = 0.5, gas = 100.0;
+        if (! sched_well.isProducer()) {
+            const auto itype = sched_well.injectorType();
+            oil = (itype == InjectorType::OIL) ? 1.0 : 0.0;
+            wat = (itype == InjectorType::WATER) ? 1.0 : 0.0;
+            gas = (itype == InjectorType::GAS) ? 100.0 : 0.0;
+        }
+
+        auto& well = well_data[wname];
+        well.rates.set(data::Rates::opt::oil, oil * q)
+                  .set(data::Rates::opt::wat, wat * q)
+                  .set(data::Rates::opt::gas, gas * q)
+                  .set(data::Rates::opt::reservoir_oil, 1.2 * oil * q)
+                  .set(data::Rates::opt::reservoir_water, wat * q)
+                  .set(data::Rates::opt::reservoir_gas, 0.008 * gas * q);
+        well.bhp = 200.0e5 + 10.0e5*std::cos(phase);
+        well.thp = 50.0e5;
+        well.temperature = 350.0;
+        well.dynamicStatus = open ? ::Opm::WellStatus::OPEN : ::Opm::WellStatus::SHUT;
+
+        const auto& connections = sched_well.getConnections();
+        const auto numConn = static_cast<double>(std::max(connections.size(), std::size_t{1}));
+        well.connections.resize(connections.size());
+        for (auto i = 0*connections.size(); i < connections.size(); ++i) {
+            auto& xconn = well.connections[i];
+            xconn.index = connections[i].global_index();
+            xconn.rates.set(data::Rates::opt::oil, oil * q / numConn)
+                       .set(data::Rates::opt::wat, wat * q / numConn)
+                       .set(data::Rates::opt::gas, gas * q / numConn);
+            xconn.pressure = well.bhp;
+            xconn.reservoir_rate = (1.2*oil + wat + 0.008*gas) * q / numConn;
+            xconn.cell_pressure = pressure.empty() ? well.bhp : pressure[i % pressure.size()];
+            xconn.cell_saturation_water = 0.3;
+            xconn.cell_saturation_gas = 0.1;
+            xconn.effective_Kh = connections[i].Kh();
+            xconn.trans_factor = connections[i].CF();
+        }
+
+        if (sched_well.isMultiSegment()) {
+            for (const auto& segment : sched_well.getSegments()) {
+                const auto segNumber = static_cast<std::size_t>(segment.segmentNumber());
+                auto& xseg = well.segments[segNumber];
+                xseg.segNumber = segNumber;
+                xseg.rates = well.rates;
+                xseg.pressures[data::SegmentPressures::Value::Pressure] =
+                    well.bhp + 1.0e4*segment.depth();
+            }
+        }
+    }
+
+    for (const auto& gname : this->schedule.groupNames(report_step)) {
+        auto& gdata = group_nwrk_data.groupData[gname];
+        gdata.guideRates.production
+            .set(data::GuideRateValue::Item::Oil, 1.0 + 0.5*std::sin(phase))
+            .set(data::GuideRateValue::Item::Water, 0.5)
+            .set(data::GuideRateValue::Item::Gas, 100.0);
+        gdata.guideRates.injection
+            .set(data::GuideRateValue::Item::Water, 1.0);
     }
 }
 
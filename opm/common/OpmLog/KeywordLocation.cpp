@@ -23,10 +23,16 @@
 
 namespace Opm {
 
+const InternedString& KeywordLocation::memoryString()
+{
+    static const auto memory = InternedString { "<memory string>" };
+    return memory;
+}
+
 std::string KeywordLocation::format(const std::string& msg_fmt) const {
     return fmt::format(fmt::runtime(msg_fmt),
-                       fmt::arg("keyword", this->keyword),
-                       fmt::arg("file", this->filename),
+                       fmt::arg("keyword", this->keyword.str()),
+                       fmt::arg("file", this->filename.str()),
                        fmt::arg("line", this->lineno));
 }
 
@@ -20,6 +20,9 @@
 #ifndef KEYWORD_LOCATION_HPP
 #define KEYWORD_LOCATION_HPP
 
+#include <opm/common/utility/InternedString.hpp>
+
+#include <cstddef>
 #include <string>
 
 namespace Opm {
@@ -39,17 +42,22 @@ public:
       string*.
      */
 
-    std::string keyword;
-    std::string filename = "<memory string>";
+    // Keyword and file names are interned.  A deck holds millions of
+    // locations but only a few hundred distinct file names, and copies of
+    // locations are kept in many schedule objects.
+    InternedString keyword;
+    InternedString filename = memoryString();
     std::size_t lineno = 0;
 
     KeywordLocation() = default;
-    KeywordLocation(std::string kw, std::string fname, std::size_t lno) :
-        keyword(std::move(kw)),
-        filename(std::move(fname)),
+    KeywordLocation(const std::string& kw, const std::string& fname, std::size_t lno) :
+        keyword(kw),
+        filename(fname),
         lineno(lno)
     {}
 
+    static const InternedString& memoryString();
+
 
     std::string format(const std::string& msg_fmt) const;
 
@@ -20,13 +20,153 @@
 #include <config.h>
 #include <opm/common/OpmLog/Logger.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <iostream>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 #include <opm/common/OpmLog/LogBackend.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 
 namespace Opm {
 
+    /// Multiple producer, single consumer queue of messages with a
+    /// background thread handing them to the backends.
+    ///
+    /// The queue is an intrusive linked list with a stub node: producers
+    /// link their node with a single atomic exchange of the head, and the
+    /// consumer advances the tail.  The mutex and the condition variables
+    /// are only used to put the consumer to sleep when the queue is empty
+    /// and to wake up threads waiting in flush().
+    class Logger::AsyncDispatcher {
+    public:
+        explicit AsyncDispatcher(const Logger& logger)
+            : m_logger(logger)
+            , m_head(new Node)
+            , m_tail(m_head.load())
+            , m_thread([this]() { this->run(); })
+        {}
+
+        ~AsyncDispatcher() {
+            {
+                std::lock_guard<std::mutex> guard(m_wakeLock);
+                m_stop = true;
+                m_wakeup.notify_one();
+            }
+            m_thread.join();
+            delete m_tail;
+        }
+
+        void push(int64_t messageType, const std::string& tag, const std::string& message) {
+            // Messages issued by a backend while it handles a message.
+            if (std::this_thread::get_id() == m_thread.get_id()) {
+                m_logger.dispatch(messageType, tag, message);
+                return;
+            }
+
+            Node* node = new Node;
+            node->messageType = messageType;
+            node->tag = tag;
+            node->message = message;
+
+            m_pushed.fetch_add(1);
+            Node* prev = m_head.exchange(node);
+            prev->next.store(node);
+
+            if (m_consumerWaiting.load()) {
+                std::lock_guard<std::mutex> guard(m_wakeLock);
+                m_wakeup.notify_one();
+            }
+        }
+
+        void flush() {
+            if (std::this_thread::get_id() == m_thread.get_id())
+                return;
+
+            const auto target = m_pushed.load();
+            if (m_processed.load() >= target)
+                return;
+
+            std::unique_lock<std::mutex> lock(m_wakeLock);
+            ++m_flushers;
+            m_progress.wait(lock, [this, target]() { return m_processed.load() >= target; });
+            --m_flushers;
+        }
+
+        /// Wait for the queue and keep the backends untouched by the
+        /// background thread while the returned lock is held.
+        std::unique_lock<std::mutex> quiesce() {
+            flush();
+            return std::unique_lock<std::mutex>(m_dispatchLock);
+        }
+
+    private:
+        struct Node {
+            std::atomic<Node*> next{nullptr};
+            int64_t messageType{0};
+            std::string tag{};
+            std::string message{};
+        };
+
+        void run() {
+            while (true) {
+                Node* next = m_tail->next.load();
+                if (next != nullptr) {
+                    {
+                        std::lock_guard<std::mutex> guard(m_dispatchLock);
+                        try {
+                            m_logger.dispatch(next->messageType, next->tag, next->message);
+                        }
+                        catch (const std::exception& e) {
+                            std::cerr << "Failed to write log message: " << e.what() << std::endl;
+                        }
+                    }
+
+                    // The node becomes the new stub.
+                    delete m_tail;
+                    m_tail = next;
+
+                    m_processed.fetch_add(1);
+                    if (m_flushers.load() > 0) {
+                        std::lock_guard<std::mutex> guard(m_wakeLock);
+                        m_progress.notify_all();
+                    }
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(m_wakeLock);
+                m_consumerWaiting = true;
+                if (m_tail->next.load() == nullptr) {
+                    if (m_stop && (m_processed.load() == m_pushed.load()))
+                        break;
+
+                    m_wakeup.wait(lock, [this]() { return (m_tail->next.load() != nullptr) || m_stop; });
+                }
+                m_consumerWaiting = false;
+            }
+        }
+
+        const Logger& m_logger;
+
+        std::atomic<Node*> m_head;
+        Node* m_tail;
+        std::atomic<uint64_t> m_pushed{0};
+        std::atomic<uint64_t> m_processed{0};
+
+        std::atomic<bool> m_consumerWaiting{false};
+        std::atomic<int> m_flushers{0};
+        bool m_stop{false};
+        std::mutex m_wakeLock{};
+        std::condition_variable m_wakeup{};
+        std::condition_variable m_progress{};
+
+        std::mutex m_dispatchLock{};
+        std::thread m_thread;
+    };
+
     Logger::Logger()
         : m_globalMask(0),
           m_enabledTypes(0)
@@ -40,16 +180,50 @@ namespace Opm {
         addMessageType( Log::MessageType::Note , "note");
     }
 
+    Logger::~Logger() {
+        setAsynchronous(false);
+    }
+
     void Logger::addTaggedMessage(int64_t messageType, const std::string& tag, const std::string& message) const {
         if ((m_enabledTypes & messageType) == 0)
             throw std::invalid_argument("Tried to issue message with unrecognized message ID");
 
-        if (m_globalMask & messageType) {
-            for (auto iter : m_backends) {
-                LogBackend& backend = *(iter.second);
-                backend.addTaggedMessage( messageType, tag, message );
-            }
+        if ((m_globalMask & messageType) == 0)
+            return;
+
+        if (!m_async) {
+            dispatch(messageType, tag, message);
+            return;
         }
+
+        m_async->push(messageType, tag, message);
+
+        const int64_t flushTypes = Log::MessageType::Error | Log::MessageType::Problem | Log::MessageType::Bug;
+        if (messageType & flushTypes)
+            m_async->flush();
+    }
+
+    void Logger::dispatch(int64_t messageType, const std::string& tag, const std::string& message) const {
+        for (const auto& iter : m_backends) {
+            LogBackend& backend = *(iter.second);
+            backend.addTaggedMessage( messageType, tag, message );
+        }
+    }
+
+    void Logger::setAsynchronous(bool asynchronous) {
+        if (asynchronous && !m_async)
+            m_async = std::make_unique<AsyncDispatcher>(*this);
+        else if (!asynchronous)
+            m_async.reset();
+    }
+
+    bool Logger::isAsynchronous() const {
+        return m_async != nullptr;
+    }
+
+    void Logger::flush() const {
+        if (m_async)
+            m_async->flush();
     }
 
     void Logger::addMessage(int64_t messageType , const std::string& message) const {
@@ -70,11 +244,19 @@ namespace Opm {
     }
 
     void Logger::removeAllBackends() {
+        std::unique_lock<std::mutex> guard;
+        if (m_async)
+            guard = m_async->quiesce();
+
         m_backends.clear();
         m_globalMask = 0;
     }
 
     bool Logger::removeBackend(const std::string& name) {
+        std::unique_lock<std::mutex> guard;
+        if (m_async)
+            guard = m_async->quiesce();
+
         size_t eraseCount = m_backends.erase( name );
         if (eraseCount == 1)
             return true;
@@ -84,6 +266,10 @@ namespace Opm {
 
 
     void Logger::addBackend(const std::string& name , std::shared_ptr<LogBackend> backend) {
+        std::unique_lock<std::mutex> guard;
+        if (m_async)
+            guard = m_async->quiesce();
+
         updateGlobalMask( backend->getMask() );
         m_backends[ name ] = backend;
     }
@@ -34,6 +34,8 @@ class Logger {
 
 public:
     Logger();
+    ~Logger();
+
     void addMessage(int64_t messageType , const std::string& message) const;
     void addTaggedMessage(int64_t messageType, const std::string& tag, const std::string& message) const;
 
@@ -47,8 +49,20 @@ public:
     bool removeBackend(const std::string& name);
     void removeAllBackends();
 
+    /// In asynchronous mode addMessage() only queues the message, and a
+    /// background thread hands it to the backends, which do the message
+    /// limiting, formatting and output.  Error, problem and bug messages
+    /// as well as changes of the backends wait until the queue is empty.
+    void setAsynchronous(bool asynchronous);
+    bool isAsynchronous() const;
+
+    /// Wait until all messages queued so far have been handed to the
+    /// backends.  Does nothing in synchronous mode.
+    void flush() const;
+
     template <class BackendType>
     std::shared_ptr<BackendType> getBackend(const std::string& name) const {
+        flush();
         auto pair = m_backends.find( name );
         if (pair == m_backends.end())
             throw std::invalid_argument("Invalid backend name: " + name);
@@ -70,12 +84,16 @@ public:
 
 
 private:
+    class AsyncDispatcher;
+
+    void dispatch(int64_t messageType, const std::string& tag, const std::string& message) const;
     void updateGlobalMask( int64_t mask );
     static bool enabledMessageType( int64_t enabledTypes , int64_t messageType);
 
     int64_t m_globalMask;
     int64_t m_enabledTypes;
     std::map<std::string , std::shared_ptr<LogBackend> > m_backends;
+    std::unique_ptr<AsyncDispatcher> m_async;
 };
 
 }
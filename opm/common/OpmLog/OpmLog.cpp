@@ -198,6 +198,23 @@ namespace Opm {
     }
 
 
+    void OpmLog::setAsynchronous(bool asynchronous) {
+        auto logger = OpmLog::getLogger();
+        logger->setAsynchronous( asynchronous );
+    }
+
+
+    void OpmLog::flush() {
+        if (m_logger)
+            m_logger->flush();
+    }
+
+
+    bool OpmLog::threadSafe() {
+        return !m_logger || m_logger->isAsynchronous();
+    }
+
+
     void OpmLog::addBackend(const std::string& name , std::shared_ptr<LogBackend> backend) {
         auto logger = OpmLog::getLogger();
         return logger->addBackend( name , backend );
@@ -65,6 +65,18 @@ public:
     static bool enabledMessageType( int64_t messageType );
     static void addMessageType( int64_t messageType , const std::string& prefix);
 
+    /// Queue messages and hand them to the backends from a background
+    /// thread, see Logger::setAsynchronous().  The queue is drained when
+    /// an error is logged, when the backends change, by flush() and when
+    /// the logger is destroyed at exit.
+    static void setAsynchronous(bool asynchronous);
+    static void flush();
+
+    /// Whether messages may be issued from several threads at once.  True
+    /// if no logger exists, in which case messages are discarded, or if
+    /// the logger is asynchronous.
+    static bool threadSafe();
+
     /// Create a basic logging setup that will send all log messages to standard output.
     ///
     /// By default category prefixes will be printed (i.e. Error: or
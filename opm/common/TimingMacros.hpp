@@ -24,6 +24,9 @@
 // OPM_TIMEFUNCTION - time block of main part of codes which do not effect performance with name from function
 // OPM_TIMEBLOCK_LOCAL - detailed timing which may effect performance
 // OPM_TIMEFUNCTION_LOCAL - detailed timing which may effect performance with name from function
+//
+// The macros are backed by Tracy when compiling with USE_TRACY, or by the
+// built-in Opm::Profiler when compiling with USE_OPM_PROFILER.
 
 #ifndef DETAILED_PROFILING
 #define DETAILED_PROFILING 0 // set to 1 to enable invasive profiling
@@ -38,6 +41,17 @@
 #define OPM_TIMEBLOCK_LOCAL(blockname) ZoneNamedN(blockname, #blockname, true)
 #define OPM_TIMEFUNCTION_LOCAL() ZoneNamedN(myname, __func__, true)
 #endif
+#elif USE_OPM_PROFILER
+#include <opm/common/utility/Profiler.hpp>
+#define OPM_PROFILER_SCOPE_(id, name)                                   \
+    static const ::Opm::Profiler::BlockId id##_id = ::Opm::Profiler::registerBlock(name); \
+    const ::Opm::Profiler::Scope id##_scope(id##_id)
+#define OPM_TIMEBLOCK(blockname) OPM_PROFILER_SCOPE_(opm_timeblock_##blockname, #blockname)
+#define OPM_TIMEFUNCTION() OPM_PROFILER_SCOPE_(opm_timefunction, __func__)
+#if DETAILED_PROFILING
+#define OPM_TIMEBLOCK_LOCAL(blockname) OPM_PROFILER_SCOPE_(opm_timeblock_##blockname, #blockname)
+#define OPM_TIMEFUNCTION_LOCAL() OPM_PROFILER_SCOPE_(opm_timefunction_local, __func__)
+#endif
 #endif
 
 #ifndef OPM_TIMEBLOCK
@@ -288,13 +288,11 @@ namespace Opm { namespace utility {
             template <class MessageBufferType>
             void write(MessageBufferType& buffer) const
             {
+                // The compressed index map describes the contributions of
+                // the sender and is meaningless to the receiver.
                 this->writeVector(this->ia_, buffer);
                 this->writeVector(this->ja_, buffer);
 
-                if constexpr (TrackCompressedIdx) {
-                    this->writeVector(this->compressedIdx_, buffer);
-                }
-
                 buffer.write(this->numRows_);
                 buffer.write(this->numCols_);
             }
@@ -307,7 +305,7 @@ namespace Opm { namespace utility {
                 this->readVector(buffer, this->ja_);
 
                 if constexpr (TrackCompressedIdx) {
-                    this->readVector(buffer, this->compressedIdx_);
+                    this->compressedIdx_.clear();
                 }
 
                 buffer.read(this->numRows_);
@@ -474,6 +472,37 @@ namespace Opm { namespace utility {
             void groupAndTrackColumnIndicesByRow(const Neighbours& rowIdx,
                                                  const Neighbours& colIdx);
 
+            // ---------------------------------------------------------
+            // Multi-threaded implementation of assemble() and compress()
+            // ---------------------------------------------------------
+
+            /// Group column indices by corresponding row index using a
+            /// per-thread histogram, a prefix sum and a per-thread scatter
+            /// of contiguous input chunks.
+            ///
+            /// Replaces preparePushbackRowGrouping() followed by
+            /// groupAndTrackColumnIndicesByRow() and produces identical \c
+            /// ia_, \c ja_, and \c compressedIdx_ arrays.
+            ///
+            /// \param[in] numRows Number of rows in final compressed
+            ///    structure.
+            ///
+            /// \param[in] rowIdx Row index of coordinate format input
+            ///    structure.
+            ///
+            /// \param[in] colIdx Column index of coordinate format input
+            ///    structure.
+            void groupColumnIndicesByRowParallel(const int         numRows,
+                                                 const Neighbours& rowIdx,
+                                                 const Neighbours& colIdx);
+
+            /// Sort and condense column indices of each row independently.
+            ///
+            /// Replaces sortColumnIndicesPerRow() followed by
+            /// condenseDuplicates() and produces identical \c ia_, \c ja_,
+            /// and \c compressedIdx_ arrays.
+            void sortAndCondenseRowsParallel();
+
             // ---------------------------------------------------------
             // General utilities
             // ---------------------------------------------------------
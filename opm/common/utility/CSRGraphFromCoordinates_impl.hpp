@@ -21,14 +21,83 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <iterator>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Opm { namespace utility { namespace CSRGraphDetail {
+
+    /// Minimum number of coordinate format contributions for which
+    /// assemble() and compress() switch to the multi-threaded
+    /// implementation.
+    constexpr std::size_t ParallelThreshold = std::size_t{1} << 16;
+
+    inline std::size_t maxThreads()
+    {
+#ifdef _OPENMP
+        return std::max(omp_get_max_threads(), 1);
+#else
+        return 1;
+#endif
+    }
+
+    /// In-place exclusive prefix sum.
+    ///
+    /// On entry, v[i] holds the count of item i for i < v.size() - 1.  On
+    /// exit, v[i] holds the sum of all counts before item i and v.back()
+    /// holds the total.  Each thread scans a contiguous block.
+    template <typename T>
+    void exclusiveScan(std::vector<T>& v)
+    {
+        const auto n = v.size() - 1;
+        const auto numBlocks = std::clamp(n / 4096, std::size_t{1}, maxThreads());
+        const auto blockSize = (n + numBlocks - 1) / numBlocks;
+
+        auto blockSum = std::vector<T>(numBlocks + 1, T{0});
+
+#ifdef _OPENMP
+#pragma omp parallel for if(numBlocks > 1)
+#endif
+        for (std::int64_t b = 0; b < static_cast<std::int64_t>(numBlocks); ++b) {
+            const auto begin = std::min(n, b * blockSize);
+            const auto end = std::min(n, begin + blockSize);
+
+            blockSum[b + 1] = std::accumulate(v.begin() + begin, v.begin() + end, T{0});
+        }
+
+        std::partial_sum(blockSum.begin(), blockSum.end(), blockSum.begin());
+
+#ifdef _OPENMP
+#pragma omp parallel for if(numBlocks > 1)
+#endif
+        for (std::int64_t b = 0; b < static_cast<std::int64_t>(numBlocks); ++b) {
+            const auto begin = std::min(n, b * blockSize);
+            const auto end = std::min(n, begin + blockSize);
+
+            auto sum = blockSum[b];
+            for (auto i = begin; i < end; ++i) {
+                const auto count = v[i];
+                v[i] = sum;
+                sum += count;
+            }
+        }
+
+        v[n] = blockSum.back();
+    }
+
+}}} // namespace Opm::utility::CSRGraphDetail
+
 // ---------------------------------------------------------------------
 // Class Opm::utility::CSRGraphFromCoordinates::Connections
 // ---------------------------------------------------------------------
@@ -272,9 +341,14 @@ CSR::assemble(const Neighbours&  rows,
     const auto thisNumRows = std::max(this->numRows_, maxRowIdx + 1);
     const auto thisNumCols = std::max(this->numCols_, maxColIdx + 1);
 
-    this->preparePushbackRowGrouping(thisNumRows, i);
+    if (i.size() >= CSRGraphDetail::ParallelThreshold) {
+        this->groupColumnIndicesByRowParallel(thisNumRows, i, j);
+    }
+    else {
+        this->preparePushbackRowGrouping(thisNumRows, i);
 
-    this->groupAndTrackColumnIndicesByRow(i, j);
+        this->groupAndTrackColumnIndicesByRow(i, j);
+    }
 
     if constexpr (TrackCompressedIdx) {
         if (expandExistingIdxMap) {
@@ -300,10 +374,15 @@ CSR::compress(const Offset maxNumVertices)
         };
     }
 
-    this->sortColumnIndicesPerRow();
+    if (this->ja_.size() >= CSRGraphDetail::ParallelThreshold) {
+        this->sortAndCondenseRowsParallel();
+    }
+    else {
+        this->sortColumnIndicesPerRow();
 
-    // Must be called *after* sortColumnIndicesPerRow().
-    this->condenseDuplicates();
+        // Must be called *after* sortColumnIndicesPerRow().
+        this->condenseDuplicates();
+    }
 
     const auto nRows = this->startPointers().size() - 1;
     if (nRows < maxNumVertices) {
@@ -447,6 +526,157 @@ CSR::groupAndTrackColumnIndicesByRow(const Neighbours& rowIdx,
     this->ia_[0] = 0;
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::groupColumnIndicesByRowParallel(const int         numRows,
+                                     const Neighbours& rowIdx,
+                                     const Neighbours& colIdx)
+{
+    assert (numRows >= 0);
+
+    const auto nnz = rowIdx.size();
+    const auto nRows = static_cast<std::size_t>(numRows);
+
+    // Contiguous input chunks, one histogram of nRows entries for each.
+    // Limit the number of chunks to keep the total histogram size
+    // proportional to the number of contributions.
+    const auto numChunks = std::clamp(nnz / std::max(nRows, std::size_t{1}),
+                                      std::size_t{1}, CSRGraphDetail::maxThreads());
+    const auto chunkSize = (nnz + numChunks - 1) / numChunks;
+
+    auto chunk = [nnz, chunkSize](const std::size_t c)
+    {
+        const auto begin = std::min(nnz, c * chunkSize);
+        return std::pair { begin, std::min(nnz, begin + chunkSize) };
+    };
+
+    // pos[c*nRows + r]: Number of row 'r' entries in chunk 'c'.
+    auto pos = Start(numChunks * nRows, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for if(numChunks > 1)
+#endif
+    for (std::int64_t c = 0; c < static_cast<std::int64_t>(numChunks); ++c) {
+        auto* count = &pos[c * nRows];
+
+        const auto [begin, end] = chunk(c);
+        for (auto nz = begin; nz < end; ++nz) {
+            ++count[rowIdx[nz]];
+        }
+    }
+
+    // Offset of each chunk's entries within its row, and row sizes.
+    this->ia_.assign(nRows + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for if(numChunks > 1)
+#endif
+    for (std::int64_t r = 0; r < static_cast<std::int64_t>(nRows); ++r) {
+        auto n = Offset{0};
+        for (auto c = 0*numChunks; c < numChunks; ++c) {
+            const auto count = pos[c*nRows + r];
+            pos[c*nRows + r] = n;
+            n += count;
+        }
+
+        this->ia_[r] = n;
+    }
+
+    CSRGraphDetail::exclusiveScan(this->ia_);
+
+    this->ja_.resize(nnz);
+
+    if constexpr (TrackCompressedIdx) {
+        this->compressedIdx_.resize(nnz);
+    }
+
+    // Chunks preserve the input order within each row, so the grouping
+    // matches that of groupAndTrackColumnIndicesByRow().
+#ifdef _OPENMP
+#pragma omp parallel for if(numChunks > 1)
+#endif
+    for (std::int64_t c = 0; c < static_cast<std::int64_t>(numChunks); ++c) {
+        auto* next = &pos[c * nRows];
+
+        const auto [begin, end] = chunk(c);
+        for (auto nz = begin; nz < end; ++nz) {
+            const auto row = rowIdx[nz];
+            const auto k = this->ia_[row] + next[row]++;
+
+            this->ja_[k] = colIdx[nz];
+
+            if constexpr (TrackCompressedIdx) {
+                this->compressedIdx_[nz] = k;
+            }
+        }
+    }
+}
+
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::sortAndCondenseRowsParallel()
+{
+    const auto numRows = this->ia_.size() - 1;
+    const auto nnz = this->ja_.size();
+
+    // Sorted unique column indices at the start of each row's range, and
+    // the position of each grouped entry among its row's unique indices.
+    auto sorted = this->ja_;
+    auto numUnique = Start(numRows + 1, 0);
+    auto pos = Start(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t r = 0; r < static_cast<std::int64_t>(numRows); ++r) {
+        auto first = sorted.begin() + this->ia_[r + 0];
+        auto last  = sorted.begin() + this->ia_[r + 1];
+
+        std::sort(first, last);
+        last = std::unique(first, last);
+
+        numUnique[r] = std::distance(first, last);
+
+        for (auto k = this->ia_[r + 0]; k < this->ia_[r + 1]; ++k) {
+            pos[k] = std::distance(first, std::lower_bound(first, last, this->ja_[k]));
+        }
+    }
+
+    CSRGraphDetail::exclusiveScan(numUnique);
+
+    auto colIdx = Neighbours(numUnique.back());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t r = 0; r < static_cast<std::int64_t>(numRows); ++r) {
+        const auto start = numUnique[r + 0];
+
+        std::copy_n(sorted.begin() + this->ia_[r], numUnique[r + 1] - start,
+                    colIdx.begin() + start);
+
+        for (auto k = this->ia_[r + 0]; k < this->ia_[r + 1]; ++k) {
+            pos[k] += start;
+        }
+    }
+
+    if constexpr (TrackCompressedIdx) {
+        const auto numContrib = this->compressedIdx_.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (std::int64_t i = 0; i < static_cast<std::int64_t>(numContrib); ++i) {
+            this->compressedIdx_[i] = pos[this->compressedIdx_[i]];
+        }
+    }
+
+    this->ia_.swap(numUnique);
+    this->ja_.swap(colIdx);
+}
+
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
@@ -0,0 +1,92 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_CONCURRENT_COUNTER_HPP
+#define OPM_UTILITY_CONCURRENT_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace Opm {
+
+/// Usage counter which may be incremented from several threads at once.
+///
+/// Unlike std::atomic the counter is copyable, copies take the current
+/// value, so it can replace a plain std::size_t member without custom copy
+/// operations in the enclosing class.  Increments are relaxed, the counter
+/// does not order any other memory access.
+class ConcurrentCounter
+{
+public:
+    ConcurrentCounter(const std::size_t value = 0) noexcept
+        : count_ { value }
+    {}
+
+    ConcurrentCounter(const ConcurrentCounter& other) noexcept
+        : count_ { other.value() }
+    {}
+
+    ConcurrentCounter& operator=(const ConcurrentCounter& other) noexcept
+    {
+        this->count_.store(other.value(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    ConcurrentCounter& operator=(const std::size_t value) noexcept
+    {
+        this->count_.store(value, std::memory_order_relaxed);
+        return *this;
+    }
+
+    ConcurrentCounter& operator++() noexcept
+    {
+        this->count_.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+
+    std::size_t operator++(int) noexcept
+    {
+        return this->count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t value() const noexcept
+    {
+        return this->count_.load(std::memory_order_relaxed);
+    }
+
+    operator std::size_t() const noexcept
+    {
+        return this->value();
+    }
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        auto count = this->value();
+        serializer(count);
+        this->count_.store(count, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::size_t> count_;
+};
+
+} // namespace Opm
+
+#endif // OPM_UTILITY_CONCURRENT_COUNTER_HPP
@@ -0,0 +1,191 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_ECLIPSE_NAME_HPP
+#define OPM_UTILITY_ECLIPSE_NAME_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace Opm {
+
+/// Name of at most eight characters, such as a well, group or keyword
+/// name, packed into a single 64-bit integer.
+///
+/// Trailing blanks are not part of the name, so "OP_1" and the blank
+/// padded "OP_1    " of the output files are the same name.  The
+/// characters are stored in the order of the most to the least significant
+/// byte, with unused bytes set to zero.  Comparing the integers thus gives
+/// the same order as comparing the names as strings, and copies,
+/// comparisons and hashing involve no memory allocation.
+class EclipseName
+{
+public:
+    static constexpr std::size_t maxSize = 8;
+
+    constexpr EclipseName() noexcept = default;
+
+    /// Throws std::invalid_argument if the name, without trailing blanks,
+    /// is longer than eight characters.
+    constexpr EclipseName(std::string_view name)
+        : value_ { pack(name) }
+    {}
+
+    EclipseName(const std::string& name)
+        : EclipseName { std::string_view { name } }
+    {}
+
+    constexpr EclipseName(const char* name)
+        : EclipseName { std::string_view { name } }
+    {}
+
+    /// Whether 'name' can be represented, i.e., has at most eight
+    /// characters besides trailing blanks.
+    static constexpr bool fits(std::string_view name) noexcept
+    {
+        return trimmedSize(name) <= maxSize;
+    }
+
+    /// The packed representation.
+    constexpr std::uint64_t key() const noexcept { return this->value_; }
+
+    constexpr std::size_t size() const noexcept
+    {
+        std::size_t n = 0;
+        while ((n < maxSize) && (this->charAt(n) != '\0'))
+            ++n;
+        return n;
+    }
+
+    constexpr bool empty() const noexcept { return this->value_ == 0; }
+
+    std::string str() const
+    {
+        std::string result(this->size(), ' ');
+        for (std::size_t i = 0; i < result.size(); ++i)
+            result[i] = this->charAt(i);
+        return result;
+    }
+
+    /// The name padded with blanks to eight characters, as in the output
+    /// files.
+    std::string padded() const
+    {
+        std::string result(maxSize, ' ');
+        for (std::size_t i = 0; i < this->size(); ++i)
+            result[i] = this->charAt(i);
+        return result;
+    }
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(this->value_);
+    }
+
+    friend constexpr bool operator==(const EclipseName& lhs, const EclipseName& rhs) noexcept
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend constexpr bool operator!=(const EclipseName& lhs, const EclipseName& rhs) noexcept
+    {
+        return lhs.value_ != rhs.value_;
+    }
+
+    friend constexpr bool operator<(const EclipseName& lhs, const EclipseName& rhs) noexcept
+    {
+        return lhs.value_ < rhs.value_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const EclipseName& name)
+    {
+        return os << name.str();
+    }
+
+private:
+    std::uint64_t value_{0};
+
+    constexpr char charAt(const std::size_t i) const noexcept
+    {
+        return static_cast<char>((this->value_ >> (8 * (maxSize - 1 - i))) & 0xFF);
+    }
+
+    static constexpr std::size_t trimmedSize(std::string_view name) noexcept
+    {
+        auto n = name.size();
+        while ((n > 0) && (name[n - 1] == ' '))
+            --n;
+        return n;
+    }
+
+    static constexpr std::uint64_t pack(std::string_view name)
+    {
+        const auto n = trimmedSize(name);
+        if (n > maxSize)
+            throw std::invalid_argument("Name is longer than eight characters");
+
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < maxSize; ++i) {
+            const auto c = (i < n) ? static_cast<unsigned char>(name[i]) : 0u;
+            value = (value << 8) | c;
+        }
+        return value;
+    }
+};
+
+} // namespace Opm
+
+namespace std {
+
+template <>
+struct hash<Opm::EclipseName>
+{
+    std::size_t operator()(const Opm::EclipseName& name) const noexcept
+    {
+        // Mix the bits so that names differing only in their last
+        // characters, i.e., the low bytes, spread over the buckets.
+        auto x = name.key();
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    }
+};
+
+} // namespace std
+
+template <>
+struct fmt::formatter<Opm::EclipseName> : fmt::formatter<fmt::string_view>
+{
+    template <typename FormatContext>
+    auto format(const Opm::EclipseName& name, FormatContext& ctx) const
+    {
+        return fmt::formatter<fmt::string_view>::format(name.str(), ctx);
+    }
+};
+
+#endif // OPM_UTILITY_ECLIPSE_NAME_HPP
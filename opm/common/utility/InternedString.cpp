@@ -0,0 +1,100 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/InternedString.hpp>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+    class StringPool
+    {
+    public:
+        const std::string* intern(std::string_view value)
+        {
+            {
+                std::shared_lock lock { this->mutex_ };
+                if (auto pos = this->index_.find(value); pos != this->index_.end()) {
+                    return pos->second;
+                }
+            }
+
+            std::unique_lock lock { this->mutex_ };
+            if (auto pos = this->index_.find(value); pos != this->index_.end()) {
+                // Inserted by another thread while unlocked.
+                return pos->second;
+            }
+
+            // std::deque::push_back() does not move existing elements, so
+            // both the returned pointer and the index key remain valid.
+            const auto& pooled = this->strings_.emplace_back(value);
+            this->index_.emplace(std::string_view { pooled }, &pooled);
+
+            return &pooled;
+        }
+
+        std::size_t size() const
+        {
+            std::shared_lock lock { this->mutex_ };
+            return this->strings_.size();
+        }
+
+    private:
+        mutable std::shared_mutex mutex_{};
+        std::deque<std::string> strings_{};
+        std::unordered_map<std::string_view, const std::string*> index_{};
+    };
+
+    StringPool& pool()
+    {
+        // Intentionally never destroyed, so that interned strings remain
+        // valid in destructors of other static objects.
+        static auto* stringPool = new StringPool{};
+        return *stringPool;
+    }
+
+    const std::string& emptyString()
+    {
+        static const auto empty = std::string{};
+        return empty;
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+InternedString::InternedString() noexcept
+    : value_ { &emptyString() }
+{}
+
+InternedString::InternedString(std::string_view value)
+    : value_ { value.empty() ? &emptyString() : pool().intern(value) }
+{}
+
+std::size_t InternedString::poolSize()
+{
+    return pool().size();
+}
+
+} // namespace Opm
@@ -0,0 +1,119 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_INTERNED_STRING_HPP
+#define OPM_UTILITY_INTERNED_STRING_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace Opm {
+
+/// Immutable string stored once in a process-wide, thread-safe pool.
+///
+/// Intended for values which are repeated many times, such as input
+/// file names and keyword names of deck locations.  An object holds a
+/// single pointer into the pool, so copies and equality comparisons are
+/// O(1).  Pooled strings are never released.
+class InternedString
+{
+public:
+    InternedString() noexcept;
+    InternedString(std::string_view value);
+    InternedString(const std::string& value)
+        : InternedString { std::string_view { value } }
+    {}
+    InternedString(const char* value)
+        : InternedString { std::string_view { value } }
+    {}
+
+    const std::string& str() const noexcept { return *this->value_; }
+    operator const std::string&() const noexcept { return *this->value_; }
+
+    const char* c_str() const noexcept { return this->value_->c_str(); }
+    std::size_t size() const noexcept { return this->value_->size(); }
+    bool empty() const noexcept { return this->value_->empty(); }
+
+    /// Number of distinct strings in the pool.
+    static std::size_t poolSize();
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        auto value = this->str();
+        serializer(value);
+        *this = InternedString { value };
+    }
+
+    // Operators are hidden friends, found only through argument-dependent
+    // lookup, to avoid ambiguities with comparisons of other string types
+    // convertible to InternedString.
+    friend bool operator==(const InternedString& lhs, const InternedString& rhs) noexcept
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend bool operator!=(const InternedString& lhs, const InternedString& rhs) noexcept
+    {
+        return lhs.value_ != rhs.value_;
+    }
+
+    friend bool operator==(const InternedString& lhs, const std::string& rhs) { return lhs.str() == rhs; }
+    friend bool operator==(const std::string& lhs, const InternedString& rhs) { return lhs == rhs.str(); }
+    friend bool operator==(const InternedString& lhs, const char* rhs) { return lhs.str() == rhs; }
+    friend bool operator==(const char* lhs, const InternedString& rhs) { return lhs == rhs.str(); }
+
+    friend bool operator!=(const InternedString& lhs, const std::string& rhs) { return lhs.str() != rhs; }
+    friend bool operator!=(const std::string& lhs, const InternedString& rhs) { return lhs != rhs.str(); }
+    friend bool operator!=(const InternedString& lhs, const char* rhs) { return lhs.str() != rhs; }
+    friend bool operator!=(const char* lhs, const InternedString& rhs) { return lhs != rhs.str(); }
+
+    friend bool operator<(const InternedString& lhs, const InternedString& rhs) { return lhs.str() < rhs.str(); }
+
+    friend std::string operator+(const InternedString& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+    friend std::string operator+(const std::string& lhs, const InternedString& rhs) { return lhs + rhs.str(); }
+    friend std::string operator+(const InternedString& lhs, const char* rhs) { return lhs.str() + rhs; }
+    friend std::string operator+(const char* lhs, const InternedString& rhs) { return lhs + rhs.str(); }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedString& value)
+    {
+        return os << value.str();
+    }
+
+private:
+    const std::string* value_;
+};
+
+} // namespace Opm
+
+template <>
+struct fmt::formatter<Opm::InternedString> : fmt::formatter<fmt::string_view>
+{
+    template <typename FormatContext>
+    auto format(const Opm::InternedString& value, FormatContext& ctx) const
+    {
+        return fmt::formatter<fmt::string_view>::format(value.str(), ctx);
+    }
+};
+
+#endif // OPM_UTILITY_INTERNED_STRING_HPP
@@ -0,0 +1,62 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/MemoryUsage.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+namespace {
+
+    void write(std::ostream& os, const Opm::MemoryUsage::Node& node, const int level)
+    {
+        os << fmt::format("{:{}}{:<{}} {:>14}\n", "", 2 * level,
+                          node.name, std::max(40 - 2 * level, 1), node.bytes);
+
+        for (const auto& child : node.children) {
+            write(os, child, level + 1);
+        }
+    }
+
+} // Anonymous namespace
+
+const Opm::MemoryUsage::Node&
+Opm::MemoryUsage::Node::child(const std::string& childName) const
+{
+    auto pos = std::find_if(this->children.begin(), this->children.end(),
+                            [&childName](const Node& c) { return c.name == childName; });
+
+    if (pos == this->children.end()) {
+        throw std::out_of_range {
+            fmt::format("No memory usage component {} in {}", childName, this->name)
+        };
+    }
+
+    return *pos;
+}
+
+std::ostream& Opm::operator<<(std::ostream& os, const MemoryUsage::Node& node)
+{
+    write(os, node, 0);
+    return os;
+}
@@ -0,0 +1,218 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_MEMORY_USAGE_HPP
+#define OPM_UTILITY_MEMORY_USAGE_HPP
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Opm {
+
+/// Estimate of the memory held by objects, found by walking them with
+/// their serializeOp() member.
+///
+/// The visitor acts as a serializer which is always packing, and adds
+/// up the heap memory owned by the containers, strings and smart
+/// pointers it is handed.  Objects behind a std::shared_ptr are counted
+/// the first time they are reached only, so members shared between
+/// several owners, e.g. the report steps of a Schedule, are accounted
+/// for once for the lifetime of the visitor.  Types without a
+/// serializeOp() member, other than the standard containers, are
+/// assumed to own no heap memory.
+///
+/// Allocator overhead is not included, and the per node size of the
+/// node based containers is that of the common implementations, so the
+/// numbers are estimates.
+class MemoryUsage
+{
+public:
+    /// Memory of a named component and its breakdown.  The bytes of a
+    /// node include those of its children, which need not add up to
+    /// the total.
+    struct Node
+    {
+        std::string name{};
+        std::size_t bytes{0};
+        std::vector<Node> children{};
+
+        /// Child named \p childName.  Throws std::out_of_range if there
+        /// is no such child.
+        const Node& child(const std::string& childName) const;
+    };
+
+    /// Memory of \p object, i.e. its size and the heap memory reached
+    /// from it which has not been accounted for earlier.
+    template <class T>
+    std::size_t measure(const T& object)
+    {
+        const auto before = this->m_heap;
+        (*this)(object);
+        return sizeof(T) + (this->m_heap - before);
+    }
+
+    /// Node named \p name with the memory of \p object.
+    template <class T>
+    Node node(const std::string& name, const T& object)
+    {
+        return { name, this->measure(object), {} };
+    }
+
+    /// Heap memory accounted for so far.
+    std::size_t heapBytes() const
+    {
+        return this->m_heap;
+    }
+
+    /// Serializer interface.
+    bool isSerializing() const
+    {
+        return true;
+    }
+
+    /// Account for the heap memory owned by \p data.
+    template <class T>
+    void operator()(const T& data)
+    {
+        if constexpr (is_shared_ptr<T>::value) {
+            this->shared_ptr(data);
+        } else if constexpr (is_unique_ptr<T>::value) {
+            if (data) {
+                this->m_heap += sizeof(typename T::element_type);
+                (*this)(*data);
+            }
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (data.capacity() > std::string{}.capacity())
+                this->m_heap += data.capacity() + 1;
+        } else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+            this->m_heap += (data.capacity() + 7) / 8;
+        } else if constexpr (is_vector<T>::value) {
+            this->m_heap += data.capacity() * sizeof(typename T::value_type);
+            this->elements(data);
+        } else if constexpr (is_array<T>::value) {
+            this->elements(data);
+        } else if constexpr (is_pair_or_tuple<T>::value) {
+            std::apply([this](const auto&... elem) { ((*this)(elem), ...); }, data);
+        } else if constexpr (is_variant<T>::value) {
+            std::visit([this](const auto& value) { (*this)(value); }, data);
+        } else if constexpr (is_optional<T>::value) {
+            if (data.has_value())
+                (*this)(*data);
+        } else if constexpr (is_ordered<T>::value) {
+            this->m_heap += data.size() * (TreeNodeOverhead + sizeof(typename T::value_type));
+            this->elements(data);
+        } else if constexpr (is_unordered<T>::value) {
+            this->m_heap += data.size() * (HashNodeOverhead + sizeof(typename T::value_type))
+                + data.bucket_count() * sizeof(void*);
+            this->elements(data);
+        } else if constexpr (has_serializeOp<T>::value) {
+            const_cast<T&>(data).serializeOp(*this);
+        }
+    }
+
+private:
+    // Colour and parent, left and right links of a red-black tree node.
+    static constexpr std::size_t TreeNodeOverhead = 4 * sizeof(void*);
+
+    // Link and cached hash value of a hash table node.
+    static constexpr std::size_t HashNodeOverhead = sizeof(void*) + sizeof(std::size_t);
+
+    // Reference counts of the control block.
+    static constexpr std::size_t ControlBlockOverhead = 2 * sizeof(void*);
+
+    template <class T>
+    void shared_ptr(const std::shared_ptr<T>& data)
+    {
+        if (!data || !this->m_seen.insert(data.get()).second)
+            return;
+
+        this->m_heap += ControlBlockOverhead + sizeof(T);
+        (*this)(*data);
+    }
+
+    template <class Container>
+    void elements(const Container& data)
+    {
+        for (const auto& elem : data)
+            (*this)(elem);
+    }
+
+    template <class T> struct is_shared_ptr : std::false_type {};
+    template <class T> struct is_shared_ptr<std::shared_ptr<T>> : std::true_type {};
+
+    template <class T> struct is_unique_ptr : std::false_type {};
+    template <class T, class D> struct is_unique_ptr<std::unique_ptr<T, D>> : std::true_type {};
+
+    template <class T> struct is_vector : std::false_type {};
+    template <class T, class A> struct is_vector<std::vector<T, A>> : std::true_type {};
+
+    template <class T> struct is_array : std::false_type {};
+    template <class T, std::size_t N> struct is_array<std::array<T, N>> : std::true_type {};
+
+    template <class T> struct is_pair_or_tuple : std::false_type {};
+    template <class... Ts> struct is_pair_or_tuple<std::tuple<Ts...>> : std::true_type {};
+    template <class T1, class T2> struct is_pair_or_tuple<std::pair<T1, T2>> : std::true_type {};
+
+    template <class T> struct is_variant : std::false_type {};
+    template <class... Ts> struct is_variant<std::variant<Ts...>> : std::true_type {};
+
+    template <class T> struct is_optional : std::false_type {};
+    template <class T> struct is_optional<std::optional<T>> : std::true_type {};
+
+    template <class T> struct is_ordered : std::false_type {};
+    template <class K, class T, class C, class A> struct is_ordered<std::map<K, T, C, A>> : std::true_type {};
+    template <class K, class C, class A> struct is_ordered<std::set<K, C, A>> : std::true_type {};
+
+    template <class T> struct is_unordered : std::false_type {};
+    template <class K, class T, class H, class E, class A>
+    struct is_unordered<std::unordered_map<K, T, H, E, A>> : std::true_type {};
+    template <class K, class H, class E, class A>
+    struct is_unordered<std::unordered_set<K, H, E, A>> : std::true_type {};
+
+    template <typename, class = void>
+    struct has_serializeOp : std::false_type {};
+
+    template <typename T>
+    struct has_serializeOp<
+        T, std::void_t<decltype(std::declval<T&>().serializeOp(std::declval<MemoryUsage&>()))>
+    > : std::true_type {};
+
+    std::size_t m_heap{0};
+    std::unordered_set<const void*> m_seen{};
+};
+
+/// Indented listing of \p node and its children in bytes.
+std::ostream& operator<<(std::ostream& os, const MemoryUsage::Node& node);
+
+} // namespace Opm
+
+#endif // OPM_UTILITY_MEMORY_USAGE_HPP
@@ -0,0 +1,363 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/Profiler.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    using BlockId = Opm::Profiler::BlockId;
+
+    struct Node
+    {
+        BlockId block{0};
+        std::uint32_t parent{0};
+        std::uint64_t calls{0};
+        std::int64_t inclusive{0};
+        std::vector<std::uint32_t> children{};
+    };
+
+    struct Event
+    {
+        BlockId block{0};
+        std::int64_t start{0};
+        std::int64_t end{0};
+    };
+
+    // Only touched by the owning thread while it is profiling, and by the
+    // reports while no thread is inside a timed block.
+    struct ThreadData
+    {
+        int index{0};
+        std::vector<Node> nodes{ Node{} }; // nodes[0] is the root
+        std::uint32_t current{0};
+
+        std::vector<Event> events{};
+        std::size_t next{0};
+        std::size_t recorded{0};
+
+        std::uint32_t enter(const BlockId block)
+        {
+            for (const auto child : this->nodes[this->current].children) {
+                if (this->nodes[child].block == block)
+                    return this->current = child;
+            }
+
+            const auto child = static_cast<std::uint32_t>(this->nodes.size());
+            this->nodes.push_back(Node{ block, this->current });
+            this->nodes[this->current].children.push_back(child);
+            return this->current = child;
+        }
+
+        void record(const Event& event, const std::size_t capacity)
+        {
+            if (this->events.size() != capacity) {
+                this->events.assign(capacity, Event{});
+                this->next = 0;
+                this->recorded = 0;
+            }
+
+            if (capacity == 0)
+                return;
+
+            this->events[this->next] = event;
+            if (++this->next == capacity)
+                this->next = 0;
+            ++this->recorded;
+        }
+
+        void clear()
+        {
+            this->nodes.assign(1, Node{});
+            this->current = 0;
+            this->next = 0;
+            this->recorded = 0;
+        }
+    };
+
+    struct State
+    {
+        std::atomic<bool> enabled{false};
+        std::atomic<std::size_t> eventsPerThread{65536};
+        int rank{0};
+        int size{1};
+        const std::int64_t origin{std::chrono::duration_cast<std::chrono::nanoseconds>
+            (std::chrono::steady_clock::now().time_since_epoch()).count()};
+
+        std::mutex lock{};
+        std::vector<std::string> blocks{ "" };
+        std::vector<std::shared_ptr<ThreadData>> threads{};
+
+        State()
+        {
+            const char* env = std::getenv("OPM_PROFILE");
+            if ((env != nullptr) && (std::string_view { env } != "") && (std::string_view { env } != "0"))
+                this->enabled = true;
+        }
+    };
+
+    State& state()
+    {
+        static State s;
+        return s;
+    }
+
+    ThreadData& threadData()
+    {
+        thread_local ThreadData* data = nullptr;
+        if (data == nullptr) {
+            auto& s = state();
+            std::lock_guard<std::mutex> guard { s.lock };
+            s.threads.push_back(std::make_shared<ThreadData>());
+            data = s.threads.back().get();
+            data->index = static_cast<int>(s.threads.size()) - 1;
+        }
+        return *data;
+    }
+
+    // Nanoseconds of the steady clock, relative to State::origin only when
+    // writing the trace to keep the timed blocks cheap.
+    std::int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>
+            (std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct MergedNode
+    {
+        BlockId block{0};
+        std::uint64_t calls{0};
+        std::int64_t inclusive{0};
+        std::vector<MergedNode> children{};
+    };
+
+    void merge(const ThreadData& data, const std::uint32_t nodeIdx, MergedNode& target)
+    {
+        const auto& node = data.nodes[nodeIdx];
+        target.calls += node.calls;
+        target.inclusive += node.inclusive;
+
+        for (const auto childIdx : node.children) {
+            const auto block = data.nodes[childIdx].block;
+            auto pos = std::find_if(target.children.begin(), target.children.end(),
+                                    [block](const auto& c) { return c.block == block; });
+            if (pos == target.children.end()) {
+                target.children.push_back(MergedNode{ block });
+                pos = target.children.end() - 1;
+            }
+            merge(data, childIdx, *pos);
+        }
+    }
+
+    void printTree(std::ostringstream& os,
+                   MergedNode& node,
+                   const std::vector<std::string>& blocks,
+                   const int depth)
+    {
+        std::sort(node.children.begin(), node.children.end(),
+                  [](const auto& c1, const auto& c2) { return c1.inclusive > c2.inclusive; });
+
+        for (auto& child : node.children) {
+            std::int64_t childTime = 0;
+            for (const auto& grandChild : child.children)
+                childTime += grandChild.inclusive;
+
+            const auto name = std::string(2*depth, ' ') + blocks[child.block];
+            os << fmt::format("{:<48} {:>12} {:>14.6f} {:>14.6f}\n", name, child.calls,
+                              child.inclusive*1.0e-9, (child.inclusive - childTime)*1.0e-9);
+            printTree(os, child, blocks, depth + 1);
+        }
+    }
+
+    std::string jsonString(const std::string& s)
+    {
+        std::string quoted = "\"";
+        for (const auto c : s) {
+            switch (c) {
+            case '"':  quoted += "\\\""; break;
+            case '\\': quoted += "\\\\"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    quoted += fmt::format("\\u{:04x}", static_cast<int>(c));
+                else
+                    quoted += c;
+            }
+        }
+        return quoted + '"';
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+bool Profiler::enabled()
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::enable(const std::size_t eventsPerThread)
+{
+    state().eventsPerThread = eventsPerThread;
+    state().enabled = true;
+}
+
+void Profiler::disable()
+{
+    state().enabled = false;
+}
+
+void Profiler::setRank(const int rank, const int size)
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+    s.rank = rank;
+    s.size = size;
+}
+
+Profiler::BlockId Profiler::registerBlock(const char* name)
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+
+    const auto pos = std::find(s.blocks.begin() + 1, s.blocks.end(), name);
+    if (pos != s.blocks.end())
+        return static_cast<BlockId>(pos - s.blocks.begin());
+
+    s.blocks.emplace_back(name);
+    return static_cast<BlockId>(s.blocks.size() - 1);
+}
+
+std::string Profiler::report()
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+
+    MergedNode root;
+    for (const auto& data : s.threads)
+        merge(*data, 0, root);
+
+    std::ostringstream os;
+    os << fmt::format("Profile of rank {} ({} thread(s))\n", s.rank, s.threads.size())
+       << fmt::format("{:<48} {:>12} {:>14} {:>14}\n",
+                      "block", "calls", "inclusive [s]", "exclusive [s]");
+    printTree(os, root, s.blocks, 0);
+
+    return os.str();
+}
+
+std::string Profiler::chromeTrace()
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+
+    std::ostringstream os;
+    os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    const char* sep = "\n";
+    for (const auto& data : s.threads) {
+        const auto capacity = data->events.size();
+        const auto count = std::min(data->recorded, capacity);
+        const auto first = (data->recorded > capacity) ? data->next : 0;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& event = data->events[(first + i) % capacity];
+            os << sep << fmt::format(R"(  {{"name": {}, "ph": "X", "pid": {}, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}})",
+                                     jsonString(s.blocks[event.block]), s.rank, data->index,
+                                     (event.start - s.origin)*1.0e-3, (event.end - event.start)*1.0e-3);
+            sep = ",\n";
+        }
+    }
+    os << "\n]}\n";
+
+    return os.str();
+}
+
+void Profiler::logReport()
+{
+    OpmLog::info(Profiler::report());
+}
+
+void Profiler::writeChromeTrace(const std::string& fileName)
+{
+    std::filesystem::path path { fileName };
+    if (state().size > 1) {
+        const auto extension = path.extension();
+        path.replace_extension(fmt::format(".{}{}", state().rank, extension.string()));
+    }
+
+    std::ofstream os { path };
+    if (! os)
+        throw std::runtime_error { fmt::format("Unable to open profile trace file {}", path.string()) };
+
+    os << Profiler::chromeTrace();
+}
+
+void Profiler::clear()
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+    for (auto& data : s.threads)
+        data->clear();
+}
+
+// ---------------------------------------------------------------------------
+
+Profiler::Scope::Scope(const BlockId block)
+    : active_ { Profiler::enabled() }
+{
+    if (! this->active_)
+        return;
+
+    this->node_ = threadData().enter(block);
+    this->start_ = now();
+}
+
+Profiler::Scope::~Scope()
+{
+    if (! this->active_)
+        return;
+
+    const auto end = now();
+    auto& data = threadData();
+    auto& node = data.nodes[this->node_];
+    node.calls += 1;
+    node.inclusive += end - this->start_;
+    data.current = node.parent;
+
+    data.record(Event{ node.block, this->start_, end },
+                state().eventsPerThread.load(std::memory_order_relaxed));
+}
+
+} // namespace Opm
@@ -0,0 +1,100 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PROFILER_HPP
+#define OPM_PROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Opm {
+
+/// Built-in hierarchical profiler, used as the backend of OPM_TIMEBLOCK
+/// and OPM_TIMEFUNCTION when compiling with USE_OPM_PROFILER.
+///
+/// Each thread owns its call tree and a ring buffer of the most recent
+/// (block, start, end) events, so timing a block never takes a lock.
+/// The call trees hold the number of calls and the inclusive time of
+/// every call path; the exclusive time is the inclusive time minus the
+/// one of the children.  When disabled a Scope costs a single atomic
+/// load.  The profiler is switched on by enable() or by setting the
+/// environment variable OPM_PROFILE to a non-zero value.
+///
+/// The reports merge the call trees of all threads and must only be
+/// requested while no other thread is inside a timed block, e.g.
+/// outside of OpenMP parallel regions.  Each MPI process profiles
+/// itself; setRank() tags its reports and trace files with the rank.
+class Profiler
+{
+public:
+    using BlockId = std::uint32_t;
+
+    static bool enabled();
+
+    /// Enable profiling, keeping up to eventsPerThread of the most
+    /// recent events of each thread for the Chrome trace.  Zero only
+    /// collects the call trees.
+    static void enable(std::size_t eventsPerThread = 65536);
+    static void disable();
+
+    static void setRank(int rank, int size);
+
+    /// Register the name of a timed block.  Called once per block
+    /// through a function local static by the timing macros.
+    static BlockId registerBlock(const char* name);
+
+    /// Call trees of all threads as a table with the number of calls,
+    /// the inclusive and the exclusive time of every call path.
+    static std::string report();
+
+    /// Recorded events in the Chrome trace event format, for
+    /// chrome://tracing or Perfetto.  The process id is the MPI rank.
+    static std::string chromeTrace();
+
+    /// Write report() through OpmLog::info().
+    static void logReport();
+
+    /// Write chromeTrace() to fileName.  With more than one MPI process
+    /// the rank is inserted before the extension, e.g. "trace.3.json".
+    static void writeChromeTrace(const std::string& fileName);
+
+    /// Remove all collected data.  No thread may be inside a timed block.
+    static void clear();
+
+    /// Time the lifetime of the object as one call of the block.
+    class Scope
+    {
+    public:
+        explicit Scope(BlockId block);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        bool active_{false};
+        std::uint32_t node_{0};
+        std::int64_t start_{0};
+    };
+};
+
+} // namespace Opm
+
+#endif // OPM_PROFILER_HPP
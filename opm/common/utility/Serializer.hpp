@@ -99,6 +99,13 @@ public:
         m_packer(packer)
     {}
 
+    //! \brief A contiguous piece of a message packed by packSegments().
+    struct Segment
+    {
+        const char* data; //!< Start of the piece
+        std::size_t size; //!< Number of bytes in the piece
+    };
+
     //! \brief Applies current serialization op to the passed data.
     template<class T>
     void operator()(const T& data)
@@ -129,28 +136,21 @@ public:
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data);
             else if (m_op == Operation::PACK)
-                m_packer.pack(data, m_buffer, m_position);
+                packData(data);
             else if (m_op == Operation::UNPACK)
                 m_packer.unpack(const_cast<T&>(data), m_buffer, m_position);
         }
     }
 
     //! \brief Call this to serialize data.
+    //! \details The data is traversed once, growing the buffer as needed.
+    //!          The capacity of the buffer is kept between calls.
     //! \tparam T Type of class to serialize
     //! \param data Class to serialize
     template<class T>
     void pack(const T& data)
     {
-        m_ptrmap.clear();
-        m_op = Operation::PACKSIZE;
-        m_packSize = 0;
-        (*this)(data);
-        m_position = 0;
-        m_buffer.resize(m_packSize);
-        m_ptrmap.clear();
-        m_op = Operation::PACK;
-        (*this)(data);
-        m_ptrmap.clear();
+        packAll(0, data);
     }
 
     //! \brief Call this to serialize data.
@@ -159,16 +159,46 @@ public:
     template<class... Args>
     void pack(const Args&... data)
     {
-        m_ptrmap.clear();
-        m_op = Operation::PACKSIZE;
-        m_packSize = 0;
-        variadic_call(data...);
-        m_position = 0;
-        m_buffer.resize(m_packSize);
-        m_ptrmap.clear();
-        m_op = Operation::PACK;
-        variadic_call(data...);
-        m_ptrmap.clear();
+        packAll(0, data...);
+    }
+
+    //! \brief Serialize data without copying large arrays into the buffer.
+    //! \details Arrays of POD of at least zeroCopyThreshold bytes, e.g. the
+    //!          contents of a std::vector<double>, are referenced in place.
+    //!          The concatenated segments are identical to the buffer filled
+    //!          by pack() when the packer stores arrays of POD as raw bytes,
+    //!          like MemPacker does. They can therefore be sent with a single
+    //!          gather operation, e.g. using MPI_Type_create_hindexed, and
+    //!          be unpacked from a contiguous buffer by unpack(). The data must
+    //!          not be modified while the segments are in use.
+    //! \param zeroCopyThreshold Smallest array in bytes to reference in place
+    //! \param data Classes to serialize
+    //! \return The segments of the message, valid until the next pack operation
+    template<class... Args>
+    const std::vector<Segment>& packSegments(std::size_t zeroCopyThreshold,
+                                             const Args&... data)
+    {
+        packAll(std::max(zeroCopyThreshold, std::size_t{1}), data...);
+
+        m_segments.clear();
+        std::size_t begin = 0;
+        for (const auto& [offset, segment] : m_external) {
+            if (offset > begin)
+                m_segments.push_back({m_buffer.data() + begin, offset - begin});
+            m_segments.push_back(segment);
+            begin = offset;
+        }
+        if (m_position > begin)
+            m_segments.push_back({m_buffer.data() + begin, m_position - begin});
+
+        return m_segments;
+    }
+
+    //! \brief Returns the size of the last packed message, including arrays
+    //!        referenced in place by packSegments().
+    size_t packSize() const
+    {
+        return m_packSize;
     }
 
     //! \brief Call this to de-serialize data.
@@ -225,7 +255,7 @@ protected:
           } else if (m_op == Operation::PACK) {
               (*this)(data.size());
               if (data.size() > 0) {
-                  m_packer.pack(data.data(), data.size(), m_buffer, m_position);
+                  packArray(data.data(), data.size());
               }
           } else if (m_op == Operation::UNPACK) {
               std::size_t size = 0;
@@ -285,7 +315,7 @@ protected:
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data.data(), data.size());
             else if (m_op == Operation::PACK)
-                m_packer.pack(data.data(), data.size(), m_buffer, m_position);
+                packArray(data.data(), data.size());
             else if (m_op == Operation::UNPACK) {
                 auto& data_mut = const_cast<Array&>(data);
                 m_packer.unpack(data_mut.data(), data_mut.size(), m_buffer, m_position);
@@ -386,6 +416,55 @@ protected:
         }
     }
 
+    //! \brief Single pass serialization into the buffer.
+    //! \param zeroCopyThreshold Smallest array to reference in place, 0 for none
+    template<class... Args>
+    void packAll(std::size_t zeroCopyThreshold, const Args&... data)
+    {
+        m_ptrmap.clear();
+        m_external.clear();
+        m_zeroCopyThreshold = zeroCopyThreshold;
+        m_op = Operation::PACK;
+        m_position = 0;
+        variadic_call(data...);
+        m_buffer.resize(m_position);
+        m_packSize = m_position;
+        for (const auto& external : m_external)
+            m_packSize += external.second.size;
+        m_ptrmap.clear();
+    }
+
+    //! \brief Make room for size more bytes after the current position.
+    void grow(std::size_t size)
+    {
+        if (m_position + size > m_buffer.size())
+            m_buffer.resize(std::max(m_position + size, 2*m_buffer.size()));
+    }
+
+    //! \brief Pack a variable at the current position.
+    template<class T>
+    void packData(const T& data)
+    {
+        grow(m_packer.packSize(data));
+        m_packer.pack(data, m_buffer, m_position);
+    }
+
+    //! \brief Pack an array of POD at the current position, or reference it
+    //!        in place if it reaches the zero-copy threshold.
+    template<class T>
+    void packArray(const T* data, std::size_t n)
+    {
+        const std::size_t size = m_packer.packSize(data, n);
+        if (m_zeroCopyThreshold > 0 && size >= m_zeroCopyThreshold) {
+            m_external.emplace_back(m_position,
+                                    Segment{reinterpret_cast<const char*>(data), size});
+            return;
+        }
+
+        grow(size);
+        m_packer.pack(data, n, m_buffer, m_position);
+    }
+
     template<typename T, typename... Args>
     void variadic_call(T& first,
                        Args&&... args)
@@ -600,9 +679,12 @@ protected:
 
     const Packer& m_packer; //!< Packer to use
     Operation m_op = Operation::PACKSIZE; //!< Current operation
-    size_t m_packSize = 0; //!< Required buffer size after PACKSIZE has been done
+    size_t m_packSize = 0; //!< Size of the packed message
     size_t m_position = 0; //!< Current position in buffer
     std::vector<char> m_buffer; //!< Buffer for serialized data
+    std::size_t m_zeroCopyThreshold = 0; //!< Smallest array referenced in place while packing, 0 for none
+    std::vector<std::pair<std::size_t, Segment>> m_external; //!< Arrays referenced in place and their position in the buffer
+    std::vector<Segment> m_segments; //!< Segments of the message packed by packSegments()
     std::map<std::uintptr_t, std::shared_ptr<void>> m_ptrmap; //!< Map to keep track of which pointer data has been serialized and actual pointers during unpacking
 };
 
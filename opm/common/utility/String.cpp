@@ -27,7 +27,6 @@
 #include <cctype>
 #include <cstdlib>
 #include <cstring>
-#include <sstream>
 #include <string_view>
 
 namespace Opm {
@@ -40,26 +39,78 @@ U& uppercase(const T& src, U& dst)
     return dst;
 }
 
-std::vector<std::string> split_string(const std::string& input,
-                                      char delimiter)
+namespace {
+    constexpr std::string_view whitespace = " \t\n\r\f\v";
+}
+
+std::string_view ltrim_view(std::string_view s)
+{
+    const auto start = s.find_first_not_of(whitespace);
+    if (start == std::string_view::npos)
+        return {};
+
+    return s.substr(start);
+}
+
+std::string_view rtrim_view(std::string_view s)
+{
+    const auto end = s.find_last_not_of(whitespace);
+    if (end == std::string_view::npos)
+        return {};
+
+    return s.substr(0, end + 1);
+}
+
+std::string_view trim_view(std::string_view s)
+{
+    return ltrim_view(rtrim_view(s));
+}
+
+void trim_in_place(std::string& s)
 {
-    std::vector<std::string> result;
-    std::string token;
-    std::istringstream tokenStream(input);
-    while (std::getline(tokenStream, token, delimiter))
-        result.push_back(token);
+    const auto end = s.find_last_not_of(whitespace);
+    if (end == std::string::npos) {
+        s.clear();
+        return;
+    }
+
+    s.erase(end + 1);
+    s.erase(0, s.find_first_not_of(whitespace));
+}
+
+void uppercase_in_place(std::string& s)
+{
+    for (auto& c : s)
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+}
+
+std::vector<std::string_view> split_string_view(std::string_view input,
+                                                char delimiter)
+{
+    // Same result as std::getline() on a stream: a trailing delimiter does
+    // not start another, empty, part.
+    std::vector<std::string_view> result;
+    std::string_view::size_type start = 0;
+    while (start < input.size()) {
+        auto end = input.find(delimiter, start);
+        if (end == std::string_view::npos)
+            end = input.size();
+
+        result.push_back(input.substr(start, end - start));
+        start = end + 1;
+    }
 
     return result;
 }
 
-std::vector<std::string> split_string(const std::string& input,
-                                      const std::string& delimiters)
+std::vector<std::string_view> split_string_view(std::string_view input,
+                                                std::string_view delimiters)
 {
-    std::vector<std::string> result;
-    std::string::size_type start = 0;
+    std::vector<std::string_view> result;
+    std::string_view::size_type start = 0;
     while (start < input.size()) {
         auto end = input.find_first_of(delimiters, start);
-        if (end == std::string::npos) {
+        if (end == std::string_view::npos) {
             result.push_back(input.substr(start));
             end = input.size() - 1;
         } else if (end != start)
@@ -71,6 +122,20 @@ std::vector<std::string> split_string(const std::string& input,
     return result;
 }
 
+std::vector<std::string> split_string(const std::string& input,
+                                      char delimiter)
+{
+    const auto parts = split_string_view(input, delimiter);
+    return { parts.begin(), parts.end() };
+}
+
+std::vector<std::string> split_string(const std::string& input,
+                                      const std::string& delimiters)
+{
+    const auto parts = split_string_view(input, delimiters);
+    return { parts.begin(), parts.end() };
+}
+
 std::string format_double(double d)
 {
     double integral_part;
@@ -96,31 +161,19 @@ std::optional<double> try_parse_double(const std::string& token)
 template<typename T>
 std::string ltrim_copy(const T& s)
 {
-    auto ret = std::string(s.c_str());
-
-    const auto start = ret.find_first_not_of(" \t\n\r\f\v");
-    if (start == std::string::npos)
-        return "";
-
-    return ret.substr(start);
+    return std::string { ltrim_view(s.c_str()) };
 }
 
 template<typename T>
 std::string rtrim_copy(const T& s)
 {
-    auto ret = std::string(s.c_str());
-
-    const auto end = ret.find_last_not_of(" \t\n\r\f\v");
-    if (end == std::string::npos)
-        return "";
-
-    return ret.substr(0, end + 1);
+    return std::string { rtrim_view(s.c_str()) };
 }
 
 template<typename T>
 std::string trim_copy(const T& s)
 {
-    return ltrim_copy(rtrim_copy(s));
+    return std::string { trim_view(s.c_str()) };
 }
 
 template<typename T>
@@ -22,6 +22,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -45,6 +46,18 @@ std::string rtrim_copy(const T& s);
 template<typename T>
 std::string trim_copy(const T& s);
 
+/// Views of s without leading, trailing, or leading and trailing
+/// whitespace.  The views refer to the characters of s.
+std::string_view ltrim_view(std::string_view s);
+std::string_view rtrim_view(std::string_view s);
+std::string_view trim_view(std::string_view s);
+
+/// Remove leading and trailing whitespace from s without reallocating.
+void trim_in_place(std::string& s);
+
+/// Convert s to upper case without reallocating.
+void uppercase_in_place(std::string& s);
+
 template<typename T>
 void replaceAll(T& data, const T& toSearch, const T& replace);
 
@@ -54,6 +67,14 @@ std::vector<std::string> split_string(const std::string& input,
 std::vector<std::string> split_string(const std::string& input,
                                       const std::string& delimiters);
 
+/// Same splitting rules as split_string(), but the parts are views into
+/// input rather than new strings.
+std::vector<std::string_view> split_string_view(std::string_view input,
+                                                char delimiter);
+
+std::vector<std::string_view> split_string_view(std::string_view input,
+                                                std::string_view delimiters);
+
 std::string format_double(double d);
 
 std::optional<double> try_parse_double(const std::string& token);
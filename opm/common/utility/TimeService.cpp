@@ -29,6 +29,7 @@
 #include <utility>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 
 namespace Opm {
 namespace TimeService {
@@ -98,6 +99,47 @@ namespace {
         return era * 146097 + static_cast<Int>(doe) - 719468;
     }
 
+    // Inverse of days_from_civil(), from the same source.  Returns year,
+    // month [1, 12] and day [1, 31] of the day 'z' days after 1970-01-01.
+    template <class Int>
+    constexpr
+    std::tuple<Int, unsigned, unsigned>
+    civil_from_days(Int z) noexcept
+    {
+        z += 719468;
+        const Int era = (z >= 0 ? z : z - 146096) / 146097;
+        const unsigned doe = static_cast<unsigned>(z - era * 146097);          // [0, 146096]
+        const unsigned yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;  // [0, 399]
+        const Int y = static_cast<Int>(yoe) + era * 400;
+        const unsigned doy = doe - (365*yoe + yoe/4 - yoe/100);                // [0, 365]
+        const unsigned mp = (5*doy + 2)/153;                                   // [0, 11]
+        const unsigned d = doy - (153*mp+2)/5 + 1;                             // [1, 31]
+        const unsigned m = mp < 10 ? mp+3 : mp-9;                              // [1, 12]
+        return std::tuple<Int, unsigned, unsigned>(y + (m <= 2), m, d);
+    }
+
+    constexpr bool is_leap(const int y) noexcept
+    {
+        return (y % 4 == 0) && ((y % 100 != 0) || (y % 400 == 0));
+    }
+
+    constexpr int last_day_of_month(const int y, const int m) noexcept
+    {
+        constexpr int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        return ((m != 2) || !is_leap(y)) ? days[m - 1] : 29;
+    }
+
+    constexpr std::time_t seconds_per_day = 86400;
+
+    // Largest forward move which is done by stepping one day at a time.
+    constexpr std::time_t max_day_steps = 31;
+
+    std::time_t floor_div(const std::time_t a, const std::time_t b)
+    {
+        const auto q = a / b;
+        return ((a % b != 0) && ((a < 0) != (b < 0))) ? q - 1 : q;
+    }
+
 } // anonymous namespace
 
 
@@ -242,14 +284,8 @@ namespace {
 }
 
 Opm::TimeStampUTC::TimeStampUTC(const std::time_t tp)
-{
-    auto t = tp;
-    const auto tm = *std::gmtime(&t);
-
-    this->ymd_ = YMD { tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday };
-
-    this->hour(tm.tm_hour).minutes(tm.tm_min).seconds(tm.tm_sec);
-}
+    : TimeStampUTC { CalendarCursor { tp }.timeStamp() }
+{}
 
 Opm::TimeStampUTC::TimeStampUTC(const Opm::TimeStampUTC::YMD& ymd,
                                 int hour, int minutes, int seconds, int usec)
@@ -262,12 +298,7 @@ Opm::TimeStampUTC::TimeStampUTC(const Opm::TimeStampUTC::YMD& ymd,
 
 Opm::TimeStampUTC& Opm::TimeStampUTC::operator=(const std::time_t tp)
 {
-    auto t = tp;
-    const auto tm = *std::gmtime(&t);
-
-    this->ymd_ = YMD { tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday };
-
-    this->hour(tm.tm_hour).minutes(tm.tm_min).seconds(tm.tm_sec);
+    *this = CalendarCursor { tp }.timeStamp();
 
     return *this;
 }
@@ -334,3 +365,95 @@ Opm::time_point Opm::asTimePoint(const TimeStampUTC& ts)
     return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
 }
 
+// ---------------------------------------------------------------------------
+
+namespace {
+    using Opm::TimeService::civil_from_days;
+    using Opm::TimeService::days_from_civil;
+    using Opm::TimeService::floor_div;
+    using Opm::TimeService::is_leap;
+    using Opm::TimeService::last_day_of_month;
+    using Opm::TimeService::max_day_steps;
+    using Opm::TimeService::seconds_per_day;
+}
+
+Opm::CalendarCursor::CalendarCursor(const std::time_t t)
+{
+    this->reset(t);
+}
+
+const Opm::TimeStampUTC& Opm::CalendarCursor::moveTo(const std::time_t t)
+{
+    if (! this->valid_ ||
+        (t < this->day_start_) ||
+        (t - this->day_start_ >= max_day_steps * seconds_per_day))
+    {
+        this->reset(t);
+        return this->stamp_;
+    }
+
+    this->time_ = t;
+    while (this->time_ - this->day_start_ >= seconds_per_day) {
+        this->nextDay();
+    }
+
+    this->setTimeOfDay();
+    return this->stamp_;
+}
+
+const Opm::TimeStampUTC&
+Opm::CalendarCursor::moveTo(const std::time_t start, const double elapsed)
+{
+    return this->moveTo(TimeService::advance(start, elapsed));
+}
+
+double Opm::CalendarCursor::decimalYear() const
+{
+    return this->stamp_.year()
+        + static_cast<double>(this->time_ - this->year_start_) / this->year_length_;
+}
+
+void Opm::CalendarCursor::reset(const std::time_t t)
+{
+    const auto days = floor_div(t, seconds_per_day);
+    const auto [y, m, d] = civil_from_days(static_cast<long long>(days));
+
+    this->time_ = t;
+    this->day_start_ = days * seconds_per_day;
+    this->stamp_ = TimeStampUTC { TimeStampUTC::YMD { static_cast<int>(y), static_cast<int>(m), static_cast<int>(d) } };
+    this->setYear(static_cast<int>(y));
+    this->setTimeOfDay();
+    this->valid_ = true;
+}
+
+void Opm::CalendarCursor::nextDay()
+{
+    auto year = this->stamp_.year();
+    auto month = this->stamp_.month();
+    auto day = this->stamp_.day() + 1;
+
+    if (day > last_day_of_month(year, month)) {
+        day = 1;
+        if (++month > 12) {
+            month = 1;
+            this->setYear(++year);
+        }
+    }
+
+    this->day_start_ += seconds_per_day;
+    this->stamp_ = TimeStampUTC { TimeStampUTC::YMD { year, month, day } };
+}
+
+void Opm::CalendarCursor::setTimeOfDay()
+{
+    const auto sec = static_cast<int>(this->time_ - this->day_start_);
+
+    this->stamp_.hour(sec / 3600).minutes((sec / 60) % 60).seconds(sec % 60);
+}
+
+void Opm::CalendarCursor::setYear(const int year)
+{
+    this->year_start_ = static_cast<std::time_t>(days_from_civil(static_cast<long long>(year), 1, 1))
+        * seconds_per_day;
+    this->year_length_ = (is_leap(year) ? 366 : 365) * static_cast<int>(seconds_per_day);
+}
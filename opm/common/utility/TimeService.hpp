@@ -120,6 +120,49 @@ namespace Opm {
         int usec_{0};
     };
 
+    /// Calendar position of a time which mostly moves forward in small
+    /// steps, such as the simulated time at successive ministeps.
+    ///
+    /// Moving the cursor within the current day only updates the time of
+    /// day, and moving it forward by less than a month steps the date one
+    /// day at a time.  Other moves recompute the date from the day count.
+    /// No call to gmtime() or timegm() is involved in either case.
+    class CalendarCursor
+    {
+    public:
+        CalendarCursor() = default;
+        explicit CalendarCursor(const std::time_t t);
+
+        /// Move the cursor to time t and return the calendar date and
+        /// time of day of t in UTC.
+        const TimeStampUTC& moveTo(const std::time_t t);
+
+        /// Move the cursor to 'elapsed' seconds after 'start', with the
+        /// same rounding as TimeService::advance().
+        const TimeStampUTC& moveTo(const std::time_t start, const double elapsed);
+
+        const TimeStampUTC& timeStamp() const { return this->stamp_; }
+        std::time_t time() const { return this->time_; }
+
+        /// Gregorian decimal year, i.e., the year plus the fraction of the
+        /// current year which has passed, measured in seconds relative to
+        /// the length of the year (365 or 366 days).
+        double decimalYear() const;
+
+    private:
+        void reset(const std::time_t t);
+        void nextDay();
+        void setTimeOfDay();
+        void setYear(const int year);
+
+        TimeStampUTC stamp_{};
+        std::time_t time_{0};
+        std::time_t day_start_{0};
+        std::time_t year_start_{0};
+        int year_length_{0};
+        bool valid_{false};
+    };
+
     TimeStampUTC operator+(const TimeStampUTC& lhs, std::chrono::duration<double> delta);
     std::time_t asTimeT(const TimeStampUTC& tp);
     std::time_t asLocalTimeT(const TimeStampUTC& tp);
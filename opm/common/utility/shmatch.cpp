@@ -55,3 +55,57 @@ bool Opm::shmatch(const std::string& pattern, const std::string& symbol)
 #endif
 }
 
+Opm::ShellPattern::ShellPattern(const std::string& pattern)
+    : m_pattern(pattern)
+{
+    const auto special = pattern.find_first_of("*?[\\");
+    this->m_prefix = pattern.substr(0, special);
+
+    if (special != std::string::npos) {
+        this->m_simple = pattern.find_first_of("[\\", special) == std::string::npos;
+    }
+}
+
+const std::string& Opm::ShellPattern::prefix() const
+{
+    return this->m_prefix;
+}
+
+bool Opm::ShellPattern::match(const std::string& symbol) const
+{
+    if (symbol.compare(0, this->m_prefix.size(), this->m_prefix) != 0)
+        return false;
+
+    if (! this->m_simple)
+        return shmatch(this->m_pattern, symbol);
+
+    // Wildcard matching with backtracking to the most recent '*'.
+    const auto& pattern = this->m_pattern;
+    auto p = this->m_prefix.size();
+    auto s = this->m_prefix.size();
+    auto star = std::string::npos;
+    auto star_s = std::string::npos;
+
+    while (s < symbol.size()) {
+        if ((p < pattern.size()) && ((pattern[p] == '?') || (pattern[p] == symbol[s]))) {
+            ++p;
+            ++s;
+        }
+        else if ((p < pattern.size()) && (pattern[p] == '*')) {
+            star = p++;
+            star_s = s;
+        }
+        else if (star != std::string::npos) {
+            p = star + 1;
+            s = ++star_s;
+        }
+        else {
+            return false;
+        }
+    }
+
+    while ((p < pattern.size()) && (pattern[p] == '*'))
+        ++p;
+
+    return p == pattern.size();
+}
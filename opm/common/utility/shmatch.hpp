@@ -32,6 +32,32 @@ namespace Opm {
 
 bool shmatch(const std::string& pattern, const std::string& symbol);
 
+/*
+  The ShellPattern class is a compiled shell pattern for matching many
+  symbols against the same pattern.  Patterns made up of literal characters
+  and the wildcards '*' and '?' are matched directly, without going through
+  fnmatch() or std::regex.  Other patterns, e.g. with bracket expressions or
+  backslash escapes, are forwarded to shmatch().  The result is always the
+  same as shmatch(pattern, symbol).
+*/
+
+class ShellPattern
+{
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(const std::string& symbol) const;
+
+    // The literal characters before the first special character.  All
+    // matching symbols start with this prefix.
+    const std::string& prefix() const;
+
+private:
+    std::string m_pattern;
+    std::string m_prefix;
+    bool m_simple{true};
+};
+
 
 }
 #endif //OPM_UTILITY_STRING_HPP
@@ -17,6 +17,9 @@
  */
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <vector>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -57,6 +60,34 @@ const DeckView& Deck::global_view() const {
     return *this->m_global_view;
 }
 
+    void Deck::prepareConcurrentAccess() const {
+        std::vector<const DeckKeyword*> pending;
+        for (const auto& kw : this->keywordList) {
+            if (kw.hasPendingRecords())
+                pending.push_back(&kw);
+        }
+
+        // Keep the first failure in deck order, as for serial access.
+        std::vector<std::exception_ptr> failure(pending.size());
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::int64_t i = 0; i < static_cast<std::int64_t>(pending.size()); ++i) {
+            try {
+                pending[i]->materialize();
+            }
+            catch (...) {
+                failure[i] = std::current_exception();
+            }
+        }
+
+        for (const auto& error : failure) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        this->global_view();
+    }
+
     Opm::DeckView Deck::operator[](const std::string& keyword) const {
         return this->global_view()[keyword];
     } 
@@ -243,7 +274,7 @@ const DeckView& Deck::global_view() const {
     }
 
     std::ostream& operator<<(std::ostream& os, const Deck& deck) {
-        DeckOutput out( os, 10 );
+        DeckOutput out( os, 10, DeckOutput::file_buffer_size );
         deck.write( out );
         return os;
     }
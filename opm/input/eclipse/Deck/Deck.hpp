@@ -33,6 +33,8 @@
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/common/utility/ConcurrentCounter.hpp>
+
 
 namespace Opm {
 
@@ -129,6 +131,16 @@ namespace Opm {
             }
             size_t count(const std::string& keyword) const;
 
+            /// Create all pending records of lazily parsed keywords,
+            /// concurrently, and the keyword index.
+            ///
+            /// Afterwards the const member functions of the deck, its
+            /// keywords and records may be called from several threads at
+            /// once.  The exception is the lazy unit conversion of double
+            /// items: threads must not request both raw and SI values of
+            /// the same item.
+            void prepareConcurrentAccess() const;
+
             void remove_keywords(int from, int to) { keywordList.erase(keywordList.begin() +from, keywordList.begin() + to); };     
 
         private:
@@ -140,7 +152,7 @@ namespace Opm {
             std::optional<std::string> m_dataFile;
             std::string input_path;
             DeckTree file_tree;
-            mutable std::size_t unit_system_access_count = 0;
+            mutable ConcurrentCounter unit_system_access_count{};
 
             const DeckView& global_view() const;
             mutable std::unique_ptr<DeckView> m_global_view{nullptr};
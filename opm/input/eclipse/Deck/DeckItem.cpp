@@ -37,60 +37,42 @@ std::vector< T >& DeckItem::value_ref() {
          );
 }
 
-template<>
-const std::vector< int >& DeckItem::value_ref< int >() const {
-    if( this->type != get_type< int >() )
-        throw std::invalid_argument( "DeckItem::value_ref<int> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
-
-    return this->ival;
-}
-
-template<>
-const std::vector< double >& DeckItem::value_ref< double >() const {
-    if (this->type == get_type<double>())
-        return this->dval;
-
-    throw std::invalid_argument( "DeckItem::value_ref<double> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
-}
-
-template<>
-const std::vector< std::string >& DeckItem::value_ref< std::string >() const {
-    if( this->type != get_type< std::string >() )
-        throw std::invalid_argument( "DeckItem::value_ref<std::string> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
-
-    return this->sval;
-}
+namespace {
 
-template<>
-const std::vector< RawString >& DeckItem::value_ref< RawString >() const {
-    if( this->type != get_type< RawString >() )
-        throw std::invalid_argument( "DeckItem::value_ref<RawString> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
+template< typename T > std::string value_type_name();
+template<> std::string value_type_name< int >() { return "int"; }
+template<> std::string value_type_name< double >() { return "double"; }
+template<> std::string value_type_name< std::string >() { return "std::string"; }
+template<> std::string value_type_name< RawString >() { return "RawString"; }
+template<> std::string value_type_name< UDAValue >() { return "UDAValue"; }
 
-    return this->rsval;
 }
 
-template<>
-const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
-    if( this->type != get_type< UDAValue >() )
-        throw std::invalid_argument( "DeckItem::value_ref<UDAValue> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
+template< typename T >
+const std::vector< T >& DeckItem::value_ref() const {
+    if( this->type != get_type< T >() )
+        throw std::invalid_argument( "DeckItem::value_ref<" + value_type_name< T >() + "> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->uval;
+    return std::get< std::vector< T > >( this->values );
 }
 
 
 DeckItem::DeckItem( const std::string& nm, int) :
+    values( std::in_place_type< std::vector< int > > ),
     type( get_type< int >() ),
     item_name( nm )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, std::string) :
+    values( std::in_place_type< std::vector< std::string > > ),
     type( get_type< std::string >() ),
     item_name( nm )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, RawString) :
+    values( std::in_place_type< std::vector< RawString > > ),
     type( get_type< RawString >() ),
     item_name( nm )
 {
@@ -98,6 +80,7 @@ DeckItem::DeckItem( const std::string& nm, RawString) :
 
 
 DeckItem::DeckItem( const std::string& nm, double, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    values( std::in_place_type< std::vector< double > > ),
     type( get_type< double >() ),
     item_name( nm ),
     active_dimensions(active_dim),
@@ -106,6 +89,7 @@ DeckItem::DeckItem( const std::string& nm, double, const std::vector<Dimension>&
 }
 
 DeckItem::DeckItem( const std::string& nm, UDAValue, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    values( std::in_place_type< std::vector< UDAValue > > ),
     type( get_type< UDAValue >() ),
     item_name( nm ),
     active_dimensions(active_dim),
@@ -116,10 +100,7 @@ DeckItem::DeckItem( const std::string& nm, UDAValue, const std::vector<Dimension
 DeckItem DeckItem::serializationTestObject()
 {
     DeckItem result;
-    result.dval = {1.0};
-    result.ival = {2};
-    result.sval = {"test1"};
-    result.uval = {UDAValue(3.0)};
+    result.values = std::vector<std::string>{"test1"};
     result.type = type_tag::string;
     result.item_name = "test2";
     result.value_status = {value::status::deck_value};
@@ -192,12 +173,12 @@ UDAValue DeckItem::get( size_t index ) const {
 
 template <>
 void DeckItem::shrink_to_fit<int>() {
-    this->ival.shrink_to_fit();
+    this->value_ref< int >().shrink_to_fit();
 }
 
 template <>
 void DeckItem::shrink_to_fit<double>() {
-    this->dval.shrink_to_fit();
+    this->value_ref< double >().shrink_to_fit();
 }
 
 
@@ -290,6 +271,29 @@ void DeckItem::push_backDefault( UDAValue x, std::size_t n ) {
     this->push_default( std::move( x ), n );
 }
 
+template< typename T >
+void DeckItem::push( std::vector<T>&& values, std::vector<value::status>&& status ) {
+    if (values.size() != status.size())
+        throw std::logic_error("Number of values and value status differ");
+
+    auto& val = this->value_ref< T >();
+    if (val.empty()) {
+        val = std::move(values);
+        this->value_status = std::move(status);
+        return;
+    }
+
+    val.insert( val.end(), values.begin(), values.end() );
+    this->value_status.insert( this->value_status.end(), status.begin(), status.end() );
+}
+
+void DeckItem::push_back( std::vector<int>&& values, std::vector<value::status>&& status ) {
+    this->push( std::move( values ), std::move( status ) );
+}
+
+void DeckItem::push_back( std::vector<double>&& values, std::vector<value::status>&& status ) {
+    this->push( std::move( values ), std::move( status ) );
+}
 
 template<typename T>
 void DeckItem::push_backDummyDefault( std::size_t n ) {
@@ -361,6 +365,45 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
 }
 
 
+void DeckItem::convertToSI()
+{
+    if ((this->type != type_tag::fdouble) || !this->raw_data || this->active_dimensions.empty())
+        return;
+
+    const auto context_dependent = [](const Dimension& dim) { return dim.isContextDependent(); };
+    if (std::any_of(this->active_dimensions.begin(), this->active_dimensions.end(), context_dependent) ||
+        std::any_of(this->default_dimensions.begin(), this->default_dimensions.end(), context_dependent))
+        return;
+
+    auto& data = this->value_ref< double >();
+    const auto dim_size = this->active_dimensions.size();
+    const auto sz = data.size();
+    const auto has_defaults = std::any_of(this->value_status.begin(), this->value_status.end(),
+                                          [](const value::status st) { return value::defaulted(st); });
+
+    if ((dim_size == 1) && !has_defaults) {
+        // Common case, e.g. the data keywords: a single scaling applied
+        // to every value, which the compiler can vectorize.
+        const auto factor = this->active_dimensions.front().getSIScaling();
+        const auto offset = this->active_dimensions.front().getSIOffset();
+        double* values = data.data();
+        for (auto index = 0*sz; index < sz; ++index)
+            values[index] = values[index]*factor + offset;
+    }
+    else {
+        for (auto index = 0*sz; index < sz; ++index) {
+            const auto& dim = value::defaulted(this->value_status[index])
+                ? this->default_dimensions
+                : this->active_dimensions;
+
+            data[index] = dim[index % dim_size].convertRawToSi(data[index]);
+        }
+    }
+
+    this->raw_data = false;
+}
+
+
 type_tag DeckItem::getType() const {
     return this->type;
 }
@@ -381,7 +424,7 @@ void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) cons
 void DeckItem::write(DeckOutput& stream) const {
     switch( this->type ) {
     case type_tag::integer:
-        this->write_vector( stream, this->ival );
+        this->write_vector( stream, this->value_ref< int >() );
         break;
     case type_tag::fdouble:
         {
@@ -390,13 +433,13 @@ void DeckItem::write(DeckOutput& stream) const {
             break;
         }
     case type_tag::string:
-        this->write_vector( stream,  this->sval );
+        this->write_vector( stream,  this->value_ref< std::string >() );
         break;
     case type_tag::raw_string:
-        this->write_vector( stream,  this->rsval );
+        this->write_vector( stream,  this->value_ref< RawString >() );
         break;
     case type_tag::uda:
-        this->write_vector( stream,  this->uval );
+        this->write_vector( stream,  this->value_ref< UDAValue >() );
         break;
     default:
         throw std::logic_error( "DeckItem::write: Type not set." );
@@ -442,11 +485,11 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
 
     switch( this->type ) {
     case type_tag::integer:
-        if (this->ival != other.ival)
+        if (this->value_ref< int >() != other.value_ref< int >())
             return false;
         break;
     case type_tag::string:
-        if (this->sval != other.sval)
+        if (this->value_ref< std::string >() != other.value_ref< std::string >())
             return false;
         break;
     case type_tag::fdouble:
@@ -461,7 +504,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
             }
         } else {
             if (this->raw_data == other.raw_data)
-                return (this->dval == other.dval);
+                return (this->value_ref< double >() == other.value_ref< double >());
             else {
                 const auto& this_data = this->getData<double>();
                 const auto& other_data = other.getData<double>();
@@ -525,7 +568,8 @@ bool DeckItem::to_bool(std::string string_value) {
 
 void DeckItem::reserve_additionalRawString(std::size_t n)
 {
-    this->rsval.reserve(rsval.size() + n);
+    auto& val = this->value_ref< RawString >();
+    val.reserve(val.size() + n);
 }
 
 /*
@@ -21,6 +21,7 @@
 #define DECKITEM_HPP
 
 #include <string>
+#include <variant>
 #include <vector>
 #include <memory>
 #include <iosfwd>
@@ -80,6 +81,13 @@ namespace Opm {
         template< typename T>
         void shrink_to_fit();
 
+        // Convert the values of a double item with dimensions to SI units
+        // in place.  Unlike the lazy conversion in getSIDoubleData() this
+        // is an explicit, non-const operation; afterwards
+        // getSIDoubleData() only reads the item.  Items with context
+        // dependent units are left unconverted.
+        void convertToSI();
+
 
         void push_back( UDAValue );
         void push_back( int );
@@ -95,6 +103,9 @@ namespace Opm {
         void push_backDefault( double, std::size_t n = 1 );
         void push_backDefault( std::string, std::size_t n = 1 );
         void push_backDefault( RawString, std::size_t n = 1 );
+        // append values scanned in bulk along with the status of each value
+        void push_back( std::vector<int>&&, std::vector<value::status>&& );
+        void push_back( std::vector<double>&&, std::vector<value::status>&& );
         // trying to access the data of a "dummy default item" will raise an exception
 
         template <typename T>
@@ -132,16 +143,12 @@ namespace Opm {
         bool is_string() { return  type == get_type< std::string >(); };
         bool is_raw_string() { return  type == get_type< RawString >(); };
 
-        UDAValue& get_uda() { return uval[0]; };
+        UDAValue& get_uda() { return std::get<std::vector<UDAValue>>(this->values)[0]; };
 
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
-            serializer(dval);
-            serializer(ival);
-            serializer(sval);
-            serializer(rsval);
-            serializer(uval);
+            serializer(values);
             serializer(type);
             serializer(item_name);
             serializer(value_status);
@@ -152,20 +159,29 @@ namespace Opm {
 
         void reserve_additionalRawString(std::size_t);
     private:
-        mutable std::vector< double > dval;
-        std::vector< int > ival;
-        std::vector< std::string > sval;
-        std::vector< RawString > rsval;
-        std::vector< UDAValue > uval;
+        /*
+          Only one of the value vectors is ever used, the one matching the
+          type of the item, so the values are kept in a variant holding
+          just that vector.  Decks with millions of small items, e.g.
+          COMPDAT or VFP tables, would otherwise spend more memory on empty
+          vectors than on the data.
+        */
+        using value_storage = std::variant< std::vector< double >,
+                                            std::vector< int >,
+                                            std::vector< std::string >,
+                                            std::vector< RawString >,
+                                            std::vector< UDAValue > >;
+
+        mutable value_storage values;
 
         type_tag type = type_tag::unknown;
 
         std::string item_name;
         std::vector<value::status> value_status;
         /*
-          To save space we mutate the dval object in place when asking for SI
-          data; the current state of of the dval member is tracked with the
-          raw_data bool member.
+          To save space we mutate the double values in place when asking for
+          SI data; the current state of of the double values is tracked with
+          the raw_data bool member.
         */
         mutable bool raw_data = true;
         std::vector< Dimension > active_dimensions;
@@ -176,6 +192,7 @@ namespace Opm {
         template< typename T > void push( T );
         template< typename T > void push( T, size_t );
         template< typename T > void push_default( T, std::size_t n );
+        template< typename T > void push( std::vector<T>&&, std::vector<value::status>&& );
         template< typename T > void write_vector(DeckOutput& writer, const std::vector<T>& data) const;
     };
 }
@@ -155,6 +155,11 @@ namespace Opm {
     }
 
     DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<int>& data) :
+        DeckKeyword(parserKeyword, std::vector<int>(data))
+    {}
+
+
+    DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, std::vector<int>&& data) :
         DeckKeyword(parserKeyword)
     {
         if (!parserKeyword.isDataKeyword())
@@ -168,7 +173,8 @@ namespace Opm {
             throw std::invalid_argument("Input to DeckKeyword '" + name() + "': cannot be std::vector<int>.");
 
         DeckItem item(parser_item.name(), int() );
-        std::for_each(data.begin(), data.end(), [&item](const int val) { item.push_back(val); });
+        std::vector<value::status> status(data.size(), value::status::deck_value);
+        item.push_back(std::move(data), std::move(status));
 
         DeckRecord deck_record;
         deck_record.addItem( std::move(item) );
@@ -177,6 +183,11 @@ namespace Opm {
 
 
     DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<double>& data, const UnitSystem& system_active, const UnitSystem& system_default) :
+        DeckKeyword(parserKeyword, std::vector<double>(data), system_active, system_default)
+    {}
+
+
+    DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, std::vector<double>&& data, const UnitSystem& system_active, const UnitSystem& system_default) :
         DeckKeyword(parserKeyword)
     {
         if (!parserKeyword.isDataKeyword())
@@ -197,7 +208,8 @@ namespace Opm {
              default_dimensions.push_back( system_default.parse(dim[0]) );
         }
         DeckItem item(parser_item.name(), double(), active_dimensions, default_dimensions);
-        std::for_each(data.begin(), data.end(), [&item](const double val) { item.push_back(val); });
+        std::vector<value::status> status(data.size(), value::status::deck_value);
+        item.push_back(std::move(data), std::move(status));
 
         DeckRecord deck_record;
         deck_record.addItem( std::move(item) );
@@ -231,34 +243,68 @@ namespace Opm {
     }
 
     const std::string& DeckKeyword::name() const {
-        return m_keywordName;
+        return m_keywordName.str();
     }
 
     size_t DeckKeyword::size() const {
+        this->materialize();
         return m_recordList.size();
     }
 
     bool DeckKeyword::empty() const {
+        this->materialize();
         return this->m_recordList.empty();
     }
 
     void DeckKeyword::addRecord(DeckRecord&& record) {
+        this->materialize();
         this->m_recordList.push_back( std::move( record ) );
     }
 
+    void DeckKeyword::setPendingRecords(std::function<std::vector<DeckRecord>()> parseRecords) {
+        this->m_recordList.clear();
+        this->m_pendingRecords = std::make_shared<const std::function<std::vector<DeckRecord>()>>( std::move( parseRecords ) );
+    }
+
+    void DeckKeyword::convertToSI() {
+        if (this->hasPendingRecords())
+            return;
+
+        for (auto& record : this->m_recordList) {
+            for (std::size_t index = 0; index < record.size(); ++index)
+                record.getItem(index).convertToSI();
+        }
+    }
+
+    bool DeckKeyword::hasPendingRecords() const {
+        return static_cast<bool>(this->m_pendingRecords);
+    }
+
+    void DeckKeyword::materialize() const {
+        if (!this->m_pendingRecords)
+            return;
+
+        this->m_recordList = (*this->m_pendingRecords)();
+        this->m_pendingRecords.reset();
+    }
+
     DeckKeyword::const_iterator DeckKeyword::begin() const {
+        this->materialize();
         return m_recordList.begin();
     }
 
     DeckKeyword::const_iterator DeckKeyword::end() const {
+        this->materialize();
         return m_recordList.end();
     }
 
     const DeckRecord& DeckKeyword::operator[](std::size_t index) const {
+        this->materialize();
         return this->m_recordList.at( index );
     }
 
     DeckRecord& DeckKeyword::operator[](std::size_t index) {
+        this->materialize();
         return this->m_recordList.at( index );
     }
 
@@ -271,6 +317,7 @@ namespace Opm {
     }
 
     const DeckRecord& DeckKeyword::getDataRecord() const {
+        this->materialize();
         if (m_recordList.size() == 1)
             return getRecord(0);
         else
@@ -335,7 +382,7 @@ namespace Opm {
     }
 
     std::ostream& operator<<(std::ostream& os, const DeckKeyword& keyword) {
-        DeckOutput out( os );
+        DeckOutput out( os, 10, DeckOutput::file_buffer_size );
         keyword.write( out );
         return os;
     }
@@ -20,6 +20,8 @@
 #ifndef DECKKEYWORD_HPP
 #define DECKKEYWORD_HPP
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -45,6 +47,9 @@ namespace Opm {
         DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<std::vector<DeckValue>>& record_list, const UnitSystem& system_active, const UnitSystem& system_default);
         DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<int>& data);
         DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<double>& data, const UnitSystem& system_active, const UnitSystem& system_default);
+        // The data is moved into the keyword, e.g., for large imported arrays.
+        DeckKeyword(const ParserKeyword& parserKeyword, std::vector<int>&& data);
+        DeckKeyword(const ParserKeyword& parserKeyword, std::vector<double>&& data, const UnitSystem& system_active, const UnitSystem& system_default);
 
         static DeckKeyword serializationTestObject();
 
@@ -56,6 +61,19 @@ namespace Opm {
         size_t size() const;
         bool empty() const;
         void addRecord(DeckRecord&& record);
+
+        /// Defer creating the records until they are first accessed.
+        ///
+        /// Used by the parser in lazy mode, see Parser::setLazyKeywords().
+        /// The records are created by \p parseRecords on the first call
+        /// to any member function which accesses them.  As for the SI
+        /// conversion in DeckItem, this first access is not thread safe.
+        void setPendingRecords(std::function<std::vector<DeckRecord>()> parseRecords);
+        bool hasPendingRecords() const;
+
+        /// Create pending records now rather than on first access.
+        void materialize() const;
+
         const DeckRecord& getRecord(size_t index) const;
         DeckRecord& getRecord(size_t index);
         const DeckRecord& getDataRecord() const;
@@ -69,6 +87,10 @@ namespace Opm {
         const std::vector<int>& getIntData() const;
         const std::vector<double>& getRawDoubleData() const;
         const std::vector<double>& getSIDoubleData() const;
+        // Convert all double items with dimensions to SI units, see
+        // DeckItem::convertToSI().  Keywords with pending records are left
+        // as they are.
+        void convertToSI();
         const std::vector<std::string>& getStringData() const;
         const std::vector<value::status>& getValueStatus() const;
         size_t getDataSize() const;
@@ -96,6 +118,9 @@ namespace Opm {
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
+            if (serializer.isSerializing())
+                this->materialize();
+
             serializer(m_keywordName);
             serializer(m_location);
             serializer(m_recordList);
@@ -105,10 +130,11 @@ namespace Opm {
         }
 
     private:
-        std::string m_keywordName;
+        InternedString m_keywordName;
         KeywordLocation m_location;
 
-        std::vector< DeckRecord > m_recordList;
+        mutable std::vector< DeckRecord > m_recordList;
+        mutable std::shared_ptr<const std::function<std::vector<DeckRecord>()>> m_pendingRecords;
         bool m_isDataKeyword;
         bool m_slashTerminated;
         bool m_isDoubleRecordKeyword = false;
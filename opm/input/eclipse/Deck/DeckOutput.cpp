@@ -17,77 +17,181 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <ostream>
-
 #include <opm/input/eclipse/Deck/DeckOutput.hpp>
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 
+#include <array>
+#include <charconv>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <fmt/format.h>
+
 
 namespace Opm {
 
-    DeckOutput::DeckOutput( std::ostream& s, int precision) :
+    DeckOutput::DeckOutput( std::ostream& s, int precision_arg, std::size_t buffer_size_arg) :
         os( s ),
+        buffer_size( buffer_size_arg ),
+        precision( precision_arg ),
         default_count( 0 ),
         row_count( 0 ),
         record_on( false ),
-        org_precision( os.precision(precision) ),
-        split_line( false )
+        split_line( false ),
+        repeat_count( 0 )
     {}
 
 
     DeckOutput::~DeckOutput() {
-        this->set_precision(this->org_precision);
+        this->write_repeat();
+        this->flush();
+    }
+
+
+    void DeckOutput::flush() {
+        if (!this->buffer.empty()) {
+            this->os.write(this->buffer.data(), this->buffer.size());
+            this->buffer.clear();
+        }
+        this->os.flush();
+    }
+
+
+    void DeckOutput::maybe_flush() {
+        if (this->buffer.size() >= this->buffer_size) {
+            this->os.write(this->buffer.data(), this->buffer.size());
+            this->buffer.clear();
+        }
     }
 
 
-    void DeckOutput::set_precision(int precision) {
-        this->os.precision(precision);
+    void DeckOutput::put(std::string_view s) {
+        this->buffer.append(s);
     }
 
 
     void DeckOutput::endl() {
-        this->os << std::endl;
+        this->write_repeat();
+        this->put("\n");
+        this->maybe_flush();
     }
 
     void DeckOutput::write_string(const std::string& s) {
-        this->os << s;
+        this->write_repeat();
+        this->put(s);
+        this->maybe_flush();
     }
 
 
     template <typename T>
     void DeckOutput::write( const T& value ) {
         if (default_count > 0) {
-            write_sep( );
-
-            os << default_count << "*";
+            std::array<char, 24> count;
+            write_item( format_number(default_count, count.data(), count.data() + count.size()) );
+            put( "*" );
             default_count = 0;
-            row_count++;
         }
 
-        write_sep( );
         write_value( value );
+        maybe_flush();
+    }
+
+
+    template <typename T>
+    std::string_view DeckOutput::format_number(const T& value, char* first, char* last) const {
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point_v<T>)
+            result = std::to_chars(first, last, value, std::chars_format::general, this->precision);
+        else
+            result = std::to_chars(first, last, value);
+
+        if (result.ec != std::errc{})
+            throw std::logic_error(fmt::format("Formatting of deck value {} failed", value));
+
+        return { first, static_cast<std::size_t>(result.ptr - first) };
+    }
+
+
+    void DeckOutput::write_item(std::string_view value) {
+        write_sep( );
+        put( value );
         row_count++;
     }
 
+
+    /*
+      With fmt.min_repeat > 0 numbers are not written immediately, but
+      collected into a run of equal values which is written by write_repeat()
+      as N*value once a different value, a default or the end of the record
+      is encountered.
+    */
+    void DeckOutput::write_number(std::string_view value) {
+        if (this->fmt.min_repeat == 0) {
+            write_item( value );
+            return;
+        }
+
+        if (this->repeat_count > 0 && this->repeat_value == value) {
+            this->repeat_count++;
+            return;
+        }
+
+        write_repeat();
+        this->repeat_value.assign(value);
+        this->repeat_count = 1;
+    }
+
+
+    void DeckOutput::write_repeat() {
+        if (this->repeat_count == 0)
+            return;
+
+        if (this->repeat_count > 1 && this->repeat_count >= this->fmt.min_repeat) {
+            std::array<char, 24> count;
+            write_item( format_number(this->repeat_count, count.data(), count.data() + count.size()) );
+            put( "*" );
+            put( this->repeat_value );
+        }
+        else {
+            for (std::size_t i = 0; i < this->repeat_count; i++)
+                write_item( this->repeat_value );
+        }
+
+        this->repeat_count = 0;
+    }
+
     template <>
     void DeckOutput::write_value( const std::string& value ) {
-        this->os << "'" << value << "'";
+        write_repeat();
+        write_sep( );
+        put( "'" );
+        put( value );
+        put( "'" );
+        row_count++;
     }
 
     template <>
     void DeckOutput::write_value( const RawString& value ) {
-        this->os << value;
+        write_repeat();
+        write_item( value );
     }
 
     template <>
     void DeckOutput::write_value( const int& value ) {
-        this->os << value;
+        std::array<char, 16> text;
+        write_number( format_number(value, text.data(), text.data() + text.size()) );
     }
 
     template <>
     void DeckOutput::write_value( const double& value ) {
-        this->os << value;
+        std::array<char, 64> text;
+        if (this->precision < 40)
+            write_number( format_number(value, text.data(), text.data() + text.size()) );
+        else
+            write_number( fmt::format("{:.{}g}", value, this->precision) );
     }
 
     template <>
@@ -101,19 +205,25 @@ namespace Opm {
     }
 
     void DeckOutput::stash_default( ) {
+        this->write_repeat();
         this->default_count++;
     }
 
 
     void DeckOutput::start_keyword(const std::string& kw, bool split_line_arg) {
-        this->os << kw << std::endl;
+        this->write_repeat();
+        this->put(kw);
+        this->put("\n");
         this->split_line = split_line_arg;
+        this->maybe_flush();
     }
 
 
     void DeckOutput::end_keyword(bool add_slash) {
+        this->write_repeat();
         if (add_slash)
-            this->os << "/" << std::endl;
+            this->put("/\n");
+        this->maybe_flush();
     }
 
 
@@ -124,12 +234,13 @@ namespace Opm {
         }
 
         if (row_count > 0)
-            os << this->fmt.item_sep;
+            put( this->fmt.item_sep );
         else if (record_on)
-            os << this->fmt.record_indent;
+            put( this->fmt.record_indent );
     }
 
     void DeckOutput::start_record( ) {
+        this->write_repeat();
         this->default_count = 0;
         this->row_count = 0;
         this->record_on = true;
@@ -137,14 +248,16 @@ namespace Opm {
 
 
     void DeckOutput::split_record() {
-        this->os << std::endl;
+        this->put("\n");
         this->row_count = 0;
     }
 
 
     void DeckOutput::end_record( ) {
-        this->os << " /" << std::endl;
+        this->write_repeat();
+        this->put(" /\n");
         this->record_on = false;
+        this->maybe_flush();
     }
 
 
@@ -22,6 +22,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <cstddef>
 
 namespace Opm {
@@ -33,10 +34,22 @@ namespace Opm {
             size_t      columns = 7;          // The maximum number of columns on a record.
             std::string record_indent = " "; // The indentation when starting a new line.
             std::string keyword_sep = "";  // The separation between keywords;
+            size_t      min_repeat = 0;   // Runs of at least this many equal numbers are written as N*value, 0 disables.
         };
 
-        explicit DeckOutput(std::ostream& s, int precision = 10);
+        /*
+          Numbers are formatted with std::to_chars() into an internal buffer
+          which is written to the stream when it holds at least buffer_size
+          bytes, when flush() is called and on destruction. With the default
+          buffer_size of zero every call writes through to the stream.
+        */
+        explicit DeckOutput(std::ostream& s, int precision = 10, std::size_t buffer_size = 0);
+
+        // Buffer size suitable for writing complete decks and files.
+        static constexpr std::size_t file_buffer_size = std::size_t{1} << 20;
+
         ~DeckOutput();
+        void flush();
         void stash_default( );
 
         void start_record( );
@@ -51,16 +64,25 @@ namespace Opm {
         format fmt;
     private:
         std::ostream& os;
+        std::string buffer;
+        size_t buffer_size;
+        int precision;
         size_t default_count;
         size_t row_count;
         bool record_on;
-        int org_precision;
         bool split_line;
+        std::string repeat_value;
+        size_t repeat_count;
 
         template <typename T> void write_value(const T& value);
+        template <typename T> std::string_view format_number(const T& value, char* first, char* last) const;
+        void write_number(std::string_view value);
+        void write_item(std::string_view value);
+        void write_repeat();
+        void put(std::string_view s);
+        void maybe_flush();
         void split_record();
         void write_sep( );
-        void set_precision(int precision);
     };
 }
 
@@ -27,6 +27,9 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/S.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/T.hpp>
 
+#include <cstdint>
+#include <exception>
+#include <fstream>
 #include <iostream>
 
 namespace fs = std::filesystem;
@@ -36,13 +39,17 @@ namespace Opm {
 
 namespace {
 
-void INCLUDE(std::ostream& stream , const std::string& fname)
+std::string include_string(const std::string& fname)
 {
-    auto include_string = fmt::format(R"(
+    return fmt::format(R"(
 INCLUDE
    '{}' /
 )", fname);
-    stream << include_string;
+}
+
+void INCLUDE(std::ostream& stream , const std::string& fname)
+{
+    stream << include_string(fname);
 }
 
 void touch_file(const fs::path& file) {
@@ -278,7 +285,7 @@ const FileDeck::Index FileDeck::stop() const {
 }
 
 void FileDeck::dump(std::ostream& os) const {
-    DeckOutput out( os , 10 );
+    DeckOutput out( os , 10, DeckOutput::file_buffer_size );
     for (const auto& block : this->blocks)
         block.dump(out);
 }
@@ -289,12 +296,12 @@ void FileDeck::dump_inline() const {
 }
 
 
-std::string FileDeck::dump_block(const FileDeck::Block& block, const std::string& output_dir, const std::optional<std::string>& data_file , FileDeck::DumpContext& context) const {
+std::string FileDeck::dump_block(std::size_t block_index, const std::string& output_dir, const std::optional<std::string>& data_file , FileDeck::DumpContext& context) const {
+    const auto& block = this->blocks[block_index];
     const auto& deck_name = block.fname;
-    auto old_stream = context.get_stream(deck_name);
-    if (old_stream.has_value()) {
-        DeckOutput out(*old_stream.value(), 10);
-        block.dump( out );
+    auto old_file = context.get_file(deck_name);
+    if (old_file.has_value()) {
+        context.files[old_file.value()].content.emplace_back(block_index);
         return "";
     }
 
@@ -311,9 +318,8 @@ std::string FileDeck::dump_block(const FileDeck::Block& block, const std::string
     touch_file(output_file);
     output_file = fs::canonical(output_file);
 
-    auto& stream = context.open_file(deck_name, output_file);
-    DeckOutput out(stream, 10);
-    block.dump( out );
+    auto& file = context.open_file(deck_name, output_file);
+    file.content.emplace_back(block_index);
     return output_file.string();
 }
 
@@ -322,11 +328,11 @@ void FileDeck::include_block(const std::string& input_file, const std::string& o
     auto current_file = input_file;
     while (true) {
         const auto& parent = this->deck_tree.parent(current_file);
-        auto stream = context.get_stream(parent);
-        if (stream.has_value()) {
+        auto file = context.get_file(parent);
+        if (file.has_value()) {
             // Should ideally use fs::relative()
             std::string include_file = fs::proximate(output_file, output_dir);
-            INCLUDE(*stream.value(), include_file);
+            context.files[file.value()].content.emplace_back(include_string(include_file));
             break;
         }
         current_file = parent;
@@ -348,14 +354,16 @@ void FileDeck::dump(const std::string& output_dir, const std::string& fname, Out
 
     if (mode == OutputMode::COPY) {
         DumpContext context;
-        this->dump_block(this->blocks[0], output_dir, fname, context);
+        this->dump_block(0, output_dir, fname, context);
 
         for (std::size_t block_index = 1; block_index < this->blocks.size(); block_index++) {
             const auto& block = this->blocks[block_index];
-            const auto& include_file = this->dump_block(block, output_dir, {}, context);
+            const auto& include_file = this->dump_block(block_index, output_dir, {}, context);
             if (block.fname != this->deck_tree.root())
                 this->include_block(block.fname, include_file, output_dir, context);
         }
+
+        this->write_files(context);
     }
 
 
@@ -366,11 +374,74 @@ void FileDeck::dump(const std::string& output_dir, const std::string& fname, Out
 }
 
 
+void FileDeck::write_files(FileDeck::DumpContext& context) const {
+    // A file which consists of a single unmodified block without INCLUDE
+    // statements is identical to its input file up to formatting and
+    // comments, and is copied instead of formatted.
+    for (auto& file : context.files) {
+        if (file.content.size() != 1)
+            continue;
+
+        const auto* block_index = std::get_if<std::size_t>(&file.content.front());
+        if (block_index == nullptr || *block_index == 0)
+            continue;
+
+        const auto& block = this->blocks[*block_index];
+        if (this->modified_files.count(block.fname) > 0 ||
+            this->deck_tree.has_include(block.fname) ||
+            fs::equivalent(block.fname, file.path))
+            continue;
+
+        file.copy_from = block.fname;
+    }
+
+    // Keep the first failure in file order, as for serial output.
+    std::vector<std::exception_ptr> failure(context.files.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(context.files.size()); ++i) {
+        try {
+            this->write_file(context.files[i]);
+        }
+        catch (...) {
+            failure[i] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : failure) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+
+void FileDeck::write_file(const FileDeck::OutputFile& file) const {
+    if (file.copy_from.has_value()) {
+        // copy_file() lets the kernel copy the data, e.g. with
+        // copy_file_range(), without passing it through user space.
+        fs::copy_file(file.copy_from.value(), file.path, fs::copy_options::overwrite_existing);
+        return;
+    }
+
+    std::ofstream stream{file.path};
+    if (!stream)
+        throw std::logic_error(fmt::format("Opening {} for writing failed", file.path));
+
+    DeckOutput out(stream, 10, DeckOutput::file_buffer_size);
+    for (const auto& content : file.content) {
+        if (const auto* block_index = std::get_if<std::size_t>(&content))
+            this->blocks[*block_index].dump(out);
+        else
+            out.write_string(std::get<std::string>(content));
+    }
+}
+
+
 void FileDeck::dump_shared(std::ostream& stream, const std::string& output_dir) const {
     for (std::size_t block_index = 0; block_index < this->blocks.size(); block_index++) {
         const auto& block = this->blocks[block_index];
         if (block_index == 0 || this->modified_files.count(block.fname) > 0 || this->deck_tree.has_include(block.fname)) {
-            DeckOutput out(stream, 10);
+            DeckOutput out(stream, 10, DeckOutput::file_buffer_size);
             block.dump( out );
         } else {
             // Should ideally use fs::relative()
@@ -22,10 +22,12 @@
 
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <filesystem>
-#include <fstream>
 #include <iosfwd>
+#include <variant>
+#include <vector>
 #include <fmt/format.h>
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
@@ -117,37 +119,49 @@ private:
     std::unordered_set<std::string> modified_files;
     DeckTree deck_tree;
 
+    /*
+      The files written in OutputMode::COPY are first planned in deck order,
+      and then written independently of each other. The content of a file
+      is a sequence of blocks, given by their index, and INCLUDE statements.
+      Files which are unchanged copies of an input file are copied instead.
+    */
+    struct OutputFile {
+        std::string path;
+        std::vector<std::variant<std::size_t, std::string>> content;
+        std::optional<std::string> copy_from;
+    };
+
     struct DumpContext {
-        std::unordered_map<std::string, std::ofstream> stream_map;
-        std::unordered_map<std::string, std::string> file_map;
+        std::vector<OutputFile> files;
+        std::unordered_map<std::string, std::size_t> output_map;
+        std::unordered_map<std::string, std::size_t> file_map;
 
         bool has_file(const std::string& fname) const {
             return this->file_map.count(fname) > 0;
         }
 
-        std::optional<std::ofstream *> get_stream(const std::string& deck_name) {
+        std::optional<std::size_t> get_file(const std::string& deck_name) const {
             auto name_iter = this->file_map.find(deck_name);
             if (name_iter == this->file_map.end())
                 return {};
 
-            return &this->stream_map.at(name_iter->second);
+            return name_iter->second;
         }
 
 
-        std::ofstream& open_file(const std::string& deck_name, const fs::path& output_file)
+        OutputFile& open_file(const std::string& deck_name, const fs::path& output_file)
         {
-            if (this->stream_map.count(output_file.string()) == 0) {
-                this->file_map.insert(std::make_pair( deck_name, output_file.string() ));
+            auto output_iter = this->output_map.find(output_file.string());
+            if (output_iter == this->output_map.end()) {
+                this->file_map.insert(std::make_pair( deck_name, this->files.size() ));
 
                 if (!fs::is_directory(output_file.parent_path()))
                     fs::create_directories(output_file.parent_path());
 
-                std::ofstream stream{output_file};
-                if (!stream)
-                    throw std::logic_error(fmt::format("Opening {} for writing failed", output_file.string()));
-                this->stream_map.insert(std::make_pair(output_file.string(), std::move(stream)));
+                output_iter = this->output_map.emplace(output_file.string(), this->files.size()).first;
+                this->files.push_back(OutputFile{ output_file.string(), {}, {} });
             }
-            return this->stream_map.at(output_file.string());
+            return this->files[output_iter->second];
         }
 
     };
@@ -155,8 +169,10 @@ private:
     void dump(std::ostream& os) const;
     void dump_shared(std::ostream& stream, const std::string& output_dir) const;
     void dump_inline() const;
-    std::string dump_block(const Block& block, const std::string& dir, const std::optional<std::string>& fname, DumpContext& context) const;
+    std::string dump_block(std::size_t block_index, const std::string& dir, const std::optional<std::string>& fname, DumpContext& context) const;
     void include_block(const std::string& source_file, const std::string& target_file, const std::string& dir, DumpContext& context) const;
+    void write_files(DumpContext& context) const;
+    void write_file(const OutputFile& file) const;
 };
 
 }
@@ -28,10 +28,33 @@
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+namespace {
+
+/*
+  Binary files are memory mapped and each array is decoded once, directly
+  into the vector which is moved into the DeckKeyword. Formatted files go
+  through the EclFile array cache.
+*/
+template <typename T, typename U = T>
+std::vector<U> load_array(Opm::EclIO::EclFile& ecl_file, std::size_t kw_index)
+{
+    if (ecl_file.formattedInput()) {
+        const auto& data = ecl_file.get<T>(kw_index);
+        return { data.begin(), data.end() };
+    }
+
+    return ecl_file.getView<T>(kw_index).template toVectorAs<U>();
+}
+
+}
+
 namespace Opm {
 
 ImportContainer::ImportContainer(const Parser& parser, const UnitSystem& unit_system, const std::string& fname, bool formatted, std::size_t deck_size) {
     EclIO::EclFile ecl_file(fname, EclIO::EclFile::Formatted{formatted});
+    if (!formatted)
+        ecl_file.memoryMap();
+
     const auto& header = ecl_file.getList();
     for (std::size_t kw_index = 0; kw_index < header.size(); kw_index++) {
         const auto& [name, data_type, _] = header[kw_index];
@@ -50,16 +73,12 @@ ImportContainer::ImportContainer(const Parser& parser, const UnitSystem& unit_sy
         const auto& parser_item = parser_kw.getRecord(0).get(0);
         if (parser_item.dataType() == type_tag::fdouble) {
             if (data_type == EclIO::REAL) {
-                auto& float_data = ecl_file.get<float>(kw_index);
-                std::vector<double> double_data{ float_data.begin(), float_data.end() };
-                this->keywords.emplace_back(parser_kw, double_data, unit_system, unit_system);
+                this->keywords.emplace_back(parser_kw, load_array<float, double>(ecl_file, kw_index), unit_system, unit_system);
             } else if (data_type == EclIO::DOUB) {
-                auto& double_data = ecl_file.get<double>(kw_index);
-                this->keywords.emplace_back(parser_kw, double_data, unit_system, unit_system);
+                this->keywords.emplace_back(parser_kw, load_array<double>(ecl_file, kw_index), unit_system, unit_system);
             }
         } else if (parser_item.dataType() == type_tag::integer) {
-            const auto& data = ecl_file.get<int>(kw_index);
-            this->keywords.emplace_back(parser_kw, data);
+            this->keywords.emplace_back(parser_kw, load_array<int>(ecl_file, kw_index));
         } else
             throw std::logic_error(fmt::format("File: {} keyword:{}\nIMPORT keyword only supports integer and floating point data keywords", fname, name));
 
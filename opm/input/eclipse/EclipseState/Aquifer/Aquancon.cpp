@@ -36,14 +36,18 @@
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <iterator>
-#include <map>
 #include <optional>
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -100,16 +104,21 @@ namespace Opm {
             }
         }
 
+        /// Classification of one cell of an AQUANCON box.
+        enum class BoxCell : std::uint8_t {
+            Inactive, Shielded, Connected, Failed
+        };
+
         void add_cell(const KeywordLocation& location,
-                      std::map<std::size_t, Aquancon::AquancCell>& work,
+                      std::unordered_map<std::size_t, Aquancon::AquancCell>& work,
                       const EclipseGrid& grid,
                       const int aquiferID,
                       const std::size_t global_index,
                       std::optional<double> influx_coeff,
                       const double influx_mult,
-                      const FaceDir::DirEnum face_dir)
+                      const FaceDir::DirEnum face_dir,
+                      const double faceArea)
         {
-            const auto faceArea = face_area(face_dir, global_index, grid);
             auto cell_iter = work.find(global_index);
             if (cell_iter == work.end()) {
                 if (!influx_coeff.has_value())
@@ -142,7 +151,9 @@ namespace Opm {
 
     Aquancon::Aquancon(const EclipseGrid& grid, const Deck& deck)
     {
-        std::map<std::size_t, Aquancon::AquancCell> work;
+        constexpr std::size_t min_parallel_size = 4096;
+
+        std::unordered_map<std::size_t, Aquancon::AquancCell> work;
         const std::vector<int>& actnum = grid.getACTNUM();
         for (std::size_t iaq = 0; iaq < deck.count("AQUANCON"); iaq++) {
             const auto& aquanconKeyword = deck["AQUANCON"][iaq];
@@ -164,29 +175,77 @@ namespace Opm {
                     = aquanconRecord.getItem("CONNECT_ADJOINING_ACTIVE_CELL").getTrimmedString(0);
                 const bool allow_aquifer_inside_reservoir = DeckItem::to_bool(str_inside_reservoir);
 
-                // Loop over the cartesian indices to convert to the global grid index
-                for (int k = k1; k <= k2; k++) {
-                    for (int j = j1; j <= j2; j++) {
-                        for (int i = i1; i <= i2; i++) {
-                            if (actnum[grid.getGlobalIndex(i, j, k)]) { // the cell itself needs to be active
-                                if (allow_aquifer_inside_reservoir
-                                    || !AquiferHelpers::neighborCellInsideReservoirAndActive(grid, i, j, k, faceDir, actnum)) {
-                                    std::optional<double> influx_coeff;
-                                    if (aquanconRecord.getItem("INFLUX_COEFF").hasValue(0))
-                                        influx_coeff = aquanconRecord.getItem("INFLUX_COEFF").getSIDouble(0);
-
-                                    auto global_index = grid.getGlobalIndex(i,j,k);
-                                    add_cell(aquanconKeyword.location(), work, grid, aquiferID, global_index, influx_coeff, influx_mult, faceDir);
-                                }
-                            } else {
-                                ++num_connections_to_inactive_cells;
-                                const auto& location = aquanconKeyword.location();
-                                auto msg = fmt::format("Problem with keyword {}\n"
-                                                       "In {} line {} \n"
-                                                       "Connection to inactive cell ({},{},{}) is ignored", location.keyword, location.filename, location.lineno, i+1, j+1, k+1);
-                                OpmLog::warning("AQUANCON_INACTIVE_CELL", msg);
-                            }
-                        }
+                std::optional<double> influx_coeff;
+                if (aquanconRecord.getItem("INFLUX_COEFF").hasValue(0))
+                    influx_coeff = aquanconRecord.getItem("INFLUX_COEFF").getSIDouble(0);
+
+                // Cells of the box in natural order, I cycling fastest.
+                const auto ni = static_cast<std::size_t>(std::max(i2 - i1 + 1, 0));
+                const auto nj = static_cast<std::size_t>(std::max(j2 - j1 + 1, 0));
+                const auto nk = static_cast<std::size_t>(std::max(k2 - k1 + 1, 0));
+                const auto numBoxCells = ni * nj * nk;
+
+                const auto cellIJK = [i1, j1, k1, ni, nj](const std::size_t n)
+                {
+                    return std::array<int, 3> {
+                        i1 + static_cast<int>(n % ni),
+                        j1 + static_cast<int>((n / ni) % nj),
+                        k1 + static_cast<int>(n / (ni * nj))
+                    };
+                };
+
+                const auto classify = [&](const std::size_t n, double& faceArea)
+                {
+                    const auto [i, j, k] = cellIJK(n);
+                    const auto global_index = grid.getGlobalIndex(i, j, k);
+                    if (!actnum[global_index]) // the cell itself needs to be active
+                        return BoxCell::Inactive;
+
+                    if (!allow_aquifer_inside_reservoir &&
+                        AquiferHelpers::neighborCellInsideReservoirAndActive(grid, i, j, k, faceDir, actnum))
+                        return BoxCell::Shielded;
+
+                    faceArea = face_area(faceDir, global_index, grid);
+                    return BoxCell::Connected;
+                };
+
+                // The cells are classified, and the face areas of the
+                // connected ones computed, concurrently.  The connections
+                // are then added in box order, which determines how
+                // repeated connections accumulate and which error is
+                // reported.  A cell whose classification failed is
+                // classified again there to raise the error.
+                std::vector<BoxCell> status(numBoxCells);
+                std::vector<double> faceAreas(numBoxCells, 0.0);
+
+#pragma omp parallel for schedule(static) if(numBoxCells >= min_parallel_size)
+                for (std::ptrdiff_t n = 0; n < static_cast<std::ptrdiff_t>(numBoxCells); ++n) {
+                    try {
+                        status[n] = classify(n, faceAreas[n]);
+                    }
+                    catch (...) {
+                        status[n] = BoxCell::Failed;
+                    }
+                }
+
+                work.reserve(work.size() + numBoxCells);
+                for (std::size_t n = 0; n < numBoxCells; ++n) {
+                    if (status[n] == BoxCell::Failed)
+                        status[n] = classify(n, faceAreas[n]);
+
+                    const auto [i, j, k] = cellIJK(n);
+                    if (status[n] == BoxCell::Connected) {
+                        add_cell(aquanconKeyword.location(), work, grid, aquiferID,
+                                 grid.getGlobalIndex(i, j, k), influx_coeff,
+                                 influx_mult, faceDir, faceAreas[n]);
+                    }
+                    else if (status[n] == BoxCell::Inactive) {
+                        ++num_connections_to_inactive_cells;
+                        const auto& location = aquanconKeyword.location();
+                        auto msg = fmt::format("Problem with keyword {}\n"
+                                               "In {} line {} \n"
+                                               "Connection to inactive cell ({},{},{}) is ignored", location.keyword, location.filename, location.lineno, i+1, j+1, k+1);
+                        OpmLog::warning("AQUANCON_INACTIVE_CELL", msg);
                     }
                 }
             }
@@ -200,12 +259,19 @@ namespace Opm {
             }
         }
 
-        for (const auto& gi_cell : work) {
-            auto cell = gi_cell.second;
+        for (auto& gi_cell : work) {
+            auto& cell = gi_cell.second;
             const auto aquiferID = cell.aquiferID;
 
             this->cells[aquiferID].emplace_back(std::move(cell));
         }
+
+        // Connections of each aquifer in increasing global cell index order.
+        for (auto& conns : this->cells) {
+            std::sort(conns.second.begin(), conns.second.end(),
+                      [](const AquancCell& c1, const AquancCell& c2)
+                      { return c1.global_index < c2.global_index; });
+        }
     }
 
 
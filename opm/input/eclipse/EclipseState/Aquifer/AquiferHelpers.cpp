@@ -23,7 +23,7 @@
 namespace Opm::AquiferHelpers {
     bool cellInsideReservoirAndActive(const EclipseGrid& grid, const int i, const int j, const int k,
                                       const std::vector<int>& actnum,
-                                      const std::optional<const std::unordered_set<std::size_t>>& numerical_aquifer_cells = std::nullopt)
+                                      const std::unordered_set<std::size_t>* numerical_aquifer_cells)
     {
         if ( i < 0 || j < 0 || k < 0
              || size_t(i) > grid.getNX() - 1
@@ -38,7 +38,7 @@ namespace Opm::AquiferHelpers {
 
         // we consider a numerical aquifer cell is outside the reservoir, so we can create aquifer connection between a
         // reservoir cell and a numerical aquifer cell
-        const bool is_numerical_aquifer_cells = numerical_aquifer_cells.has_value() &&
+        const bool is_numerical_aquifer_cells = (numerical_aquifer_cells != nullptr) &&
                                                 numerical_aquifer_cells->count(globalIndex) > 0;
 
         if (is_numerical_aquifer_cells) return false;
@@ -48,7 +48,7 @@ namespace Opm::AquiferHelpers {
 
     bool neighborCellInsideReservoirAndActive(const EclipseGrid& grid, const int i, const int j, const int k,
                                               const Opm::FaceDir::DirEnum faceDir, const std::vector<int>& actnum,
-                                              const std::optional<const std::unordered_set<std::size_t>>& numerical_aquifer_cells)
+                                              const std::unordered_set<std::size_t>* numerical_aquifer_cells)
     {
         switch(faceDir) {
             case FaceDir::XMinus:
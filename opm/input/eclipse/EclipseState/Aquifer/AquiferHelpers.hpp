@@ -21,16 +21,19 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 
-#include <vector>
-#include <optional>
+#include <cstddef>
 #include <unordered_set>
+#include <vector>
 
 namespace Opm {
     class EclipseGrid;
     namespace AquiferHelpers {
+        /// Whether the neighbour of cell (i,j,k) across faceDir is an
+        /// active reservoir cell.  Cells in numerical_aquifer_cells, if
+        /// given, are considered outside of the reservoir.  Thread safe.
         bool neighborCellInsideReservoirAndActive(const EclipseGrid &grid, int i, int j, int k,
                                                   FaceDir::DirEnum faceDir, const std::vector<int>& actnum,
-                                                  const std::optional<const std::unordered_set<std::size_t>>& numerical_aquifer_cells = std::nullopt);
+                                                  const std::unordered_set<std::size_t>* numerical_aquifer_cells = nullptr);
     }
 }
 
@@ -48,9 +48,12 @@ namespace Opm {
                     const size_t aqu_id = con.aquifer_id;
                     const size_t global_index = con.global_index;
                     auto& aqu_cons = connections[aqu_id];
-                    if (aqu_cons.find(global_index) == aqu_cons.end()) {
-                        aqu_cons.insert({global_index, con});
-                    } else {
+
+                    // The cells of a record come in increasing global
+                    // index order, so appending is the common case.
+                    const auto numCons = aqu_cons.size();
+                    aqu_cons.emplace_hint(aqu_cons.end(), global_index, con);
+                    if (aqu_cons.size() == numCons) {
                         auto error = fmt::format("Numerical aquifer cell at ({}, {}, {}) is declared more than once"
                                                  " as a connection for numerical aquifer {}",
                                                  con.I + 1, con.J + 1, con.K + 1, con.aquifer_id);
@@ -94,11 +97,22 @@ namespace Opm {
 
         const bool allow_internal_cells = DeckItem::to_bool( record.getItem<AQUCON::ALLOW_INTERNAL_CELLS>().getTrimmedString(0) );
 
+        // All connections of the record share the record's items, so read
+        // them once and only vary the cell.
+        const NumericalAquiferConnection prototype(i1, j1, k1, grid.getGlobalIndex(i1, j1, k1),
+                                                   allow_internal_cells, record);
+
+        if ((i2 >= i1) && (j2 >= j1) && (k2 >= k1))
+            cons.reserve((i2 - i1 + 1) * (j2 - j1 + 1) * (k2 - k1 + 1));
+
         for (size_t k = k1; k <= k2; ++k) {
             for (size_t j = j1; j <=j2; ++j) {
                 for (size_t i = i1; i <= i2; ++i) {
-                    const size_t global_index = grid.getGlobalIndex(i, j, k);
-                    cons.emplace_back(i, j, k, global_index, allow_internal_cells, record);
+                    auto& con = cons.emplace_back(prototype);
+                    con.I = i;
+                    con.J = j;
+                    con.K = k;
+                    con.global_index = grid.getGlobalIndex(i, j, k);
                 }
             }
         }
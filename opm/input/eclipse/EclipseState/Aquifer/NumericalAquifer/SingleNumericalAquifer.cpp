@@ -29,7 +29,11 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <fmt/format.h>
+
+#include <cstddef>
+#include <cstdint>
 #include <unordered_set>
+#include <vector>
 
 namespace Opm {
     SingleNumericalAquifer::SingleNumericalAquifer(const size_t aqu_id)
@@ -185,20 +189,34 @@ namespace Opm {
     }
 
     void SingleNumericalAquifer::postProcessConnections(const EclipseGrid& grid, const std::vector<int>& actnum) {
+        constexpr std::size_t min_parallel_size = 4096;
+
         std::unordered_set<size_t> cell_global_indices;
+        cell_global_indices.reserve(this->cells_.size());
         for (const auto& cell : this->cells_) {
             cell_global_indices.insert(cell.global_index);
         }
 
-        std::vector<NumericalAquiferConnection> conns;
-        for (const auto& con : this->connections_) {
+        // The connections are independent, so decide which to keep
+        // concurrently and compact them in their original order afterwards.
+        const auto numConnections = this->connections_.size();
+        std::vector<std::uint8_t> keep(numConnections, 0);
+
+#pragma omp parallel for schedule(static) if(numConnections >= min_parallel_size)
+        for (std::ptrdiff_t c = 0; c < static_cast<std::ptrdiff_t>(numConnections); ++c) {
+            const auto& con = this->connections_[c];
             const size_t i = con.I;
             const size_t j = con.J;
             const size_t k = con.K;
             if (!actnum[grid.getGlobalIndex(i, j, k)]) continue;
-            if (con.connect_active_cell
-               || !AquiferHelpers::neighborCellInsideReservoirAndActive(grid, i, j, k, con.face_dir, actnum, cell_global_indices)) {
-                conns.push_back(con);
+            keep[c] = con.connect_active_cell
+                || !AquiferHelpers::neighborCellInsideReservoirAndActive(grid, i, j, k, con.face_dir, actnum, &cell_global_indices);
+        }
+
+        std::vector<NumericalAquiferConnection> conns;
+        for (std::size_t c = 0; c < numConnections; ++c) {
+            if (keep[c]) {
+                conns.push_back(this->connections_[c]);
             }
         }
         this->connections_ = std::move(conns);
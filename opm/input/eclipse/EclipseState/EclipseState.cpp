@@ -56,8 +56,10 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
+#include <future>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -129,13 +131,52 @@ namespace Opm {
 // process is done twice, first after the initial field_props processing and
 // subsequently after the processing of numerical aquifers.
 
+    /// Sub-objects which depend on the deck alone and are built while the
+    /// constructor creates the other members.
+    ///
+    /// The table manager and the input grid are the most expensive of
+    /// these, and read disjoint sets of keywords.  They are built on
+    /// separate threads unless log messages must be issued from a single
+    /// thread, in which case they are built on first use, in the same
+    /// order as before.
+    struct EclipseState::ConcurrentParts
+    {
+        std::future<TableManager> tables;
+        std::future<EclipseGrid> grid;
+
+        explicit ConcurrentParts(const Deck& deck)
+        {
+            deck.prepareConcurrentAccess();
+
+            const auto policy = OpmLog::threadSafe()
+                ? std::launch::async
+                : std::launch::deferred;
+
+            this->tables = std::async(policy, [&deck]() { return TableManager { deck }; });
+            this->grid = std::async(policy, [&deck]() { return EclipseGrid { deck, nullptr }; });
+        }
+    };
+
     EclipseState::EclipseState(const Deck& deck)
     try
-        : m_tables(            deck )
+        : EclipseState(deck, ConcurrentParts { deck })
+    {}
+    catch (const OpmInputError& opm_error) {
+        OpmLog::error(opm_error.what());
+        throw;
+    }
+    catch (const std::exception& std_error) {
+        OpmLog::error(fmt::format("\nAn error occurred while creating the reservoir properties\n"
+                                  "Internal error: {}\n", std_error.what()));
+        throw;
+    }
+
+    EclipseState::EclipseState(const Deck& deck, ConcurrentParts&& parts)
+        : m_tables(            parts.tables.get() )
         , m_runspec(           deck )
         , m_eclipseConfig(     deck )
         , m_deckUnitSystem(    deck.getActiveUnitSystem() )
-        , m_inputGrid(         deck, nullptr )
+        , m_inputGrid(         parts.grid.get() )
         , m_inputNnc(          m_inputGrid, deck)
         , m_gridDims(          deck )
         , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps())
@@ -170,15 +211,6 @@ namespace Opm {
                                                   this->getIOConfig(), this->getInitConfig());
         }
     }
-    catch (const OpmInputError& opm_error) {
-        OpmLog::error(opm_error.what());
-        throw;
-    }
-    catch (const std::exception& std_error) {
-        OpmLog::error(fmt::format("\nAn error occurred while creating the reservoir properties\n"
-                                  "Internal error: {}\n", std_error.what()));
-        throw;
-    }
 
 
 
@@ -316,9 +348,7 @@ namespace Opm {
     }
 
     void EclipseState::appendInputNNC(const std::vector<NNCdata>& nnc) {
-        for (const auto& nnc_data : nnc ) {
-            this->m_inputNnc.addNNC(nnc_data.cell1, nnc_data.cell2, nnc_data.trans);
-        }
+        this->m_inputNnc.addNNC(nnc);
     }
 
     bool EclipseState::hasInputNNC() const {
@@ -542,8 +572,10 @@ namespace Opm {
       calculated, i.e. to increase the permeability you must use a multiplier
       greater than one.
     */
-    void EclipseState::apply_schedule_keywords(const std::vector<DeckKeyword>& keywords) {
+    std::vector<std::size_t>
+    EclipseState::apply_schedule_keywords(const std::vector<DeckKeyword>& keywords) {
         using namespace ParserKeywords;
+        std::vector<std::size_t> updated_cells;
         static const std::unordered_set<std::string> multipliers = {"MULTFLT", "MULTX", "MULTX-", "MULTY", "MULTY-", "MULTZ", "MULTZ-"};
         for (const auto& keyword : keywords) {
             if (keyword.is<MULTFLT>()) {
@@ -554,6 +586,10 @@ namespace Opm {
 
                     fault.setTransMult( multflt );
                     m_transMult.applyMULTFLT( fault );
+
+                    for (const auto& face : fault) {
+                        updated_cells.insert(updated_cells.end(), face.begin(), face.end());
+                    }
                 }
             }
 
@@ -567,9 +603,17 @@ namespace Opm {
         // though. Only the transmissibility multipliers will get broadcasted.
         if (this->field_props.is_usable())
         {
-            this->field_props.apply_schedule_keywords(keywords);
+            const auto mult_cells = this->field_props.apply_schedule_keywords(keywords);
             this->applyMULTXYZ();
+
+            updated_cells.insert(updated_cells.end(), mult_cells.begin(), mult_cells.end());
         }
+
+        std::sort(updated_cells.begin(), updated_cells.end());
+        updated_cells.erase(std::unique(updated_cells.begin(), updated_cells.end()),
+                            updated_cells.end());
+
+        return updated_cells;
     }
 
 
@@ -603,4 +647,37 @@ bool rst_cmp_obj(const T& full_arg, const T& rst_arg, const std::string& object_
             rst_cmp_obj(full_state.tracer_config, rst_state.tracer_config, "Tracer");
     }
 
+    MemoryUsage::Node EclipseState::memoryUsage(MemoryUsage& usage) const
+    {
+        const auto before = usage.heapBytes();
+
+        auto node = MemoryUsage::Node { "EclipseState" };
+        node.children.push_back(usage.node("TableManager", this->m_tables));
+        node.children.push_back(this->field_props.memoryUsage(usage));
+        node.children.push_back(usage.node("Runspec", this->m_runspec));
+        node.children.push_back(usage.node("EclipseConfig", this->m_eclipseConfig));
+        node.children.push_back(usage.node("NNC", this->m_inputNnc));
+        node.children.push_back(usage.node("AquiferConfig", this->aquifer_config));
+        node.children.push_back(usage.node("FaultCollection", this->m_faults));
+
+        usage(this->m_deckUnitSystem);
+        usage(this->m_pinchNnc);
+        usage(this->m_gridDims);
+        usage(this->m_lgrs);
+        usage(this->m_simulationConfig);
+        usage(this->compositional_config);
+        usage(this->m_transMult);
+        usage(this->tracer_config);
+        usage(this->m_micppara);
+        usage(this->wag_hyst_config);
+        usage(this->co2_store_config);
+        usage(this->m_title);
+        usage(this->m_restart_network_pressures);
+        usage(this->fipRegionStatistics_);
+
+        node.bytes = sizeof(*this) + (usage.heapBytes() - before);
+
+        return node;
+    }
+
 }
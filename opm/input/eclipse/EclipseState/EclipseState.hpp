@@ -20,6 +20,8 @@
 #ifndef OPM_ECLIPSE_STATE_HPP
 #define OPM_ECLIPSE_STATE_HPP
 
+#include <opm/common/utility/MemoryUsage.hpp>
+
 #include <opm/input/eclipse/EclipseState/Aquifer/AquiferConfig.hpp>
 #include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseConfig.hpp>
@@ -122,7 +124,15 @@ namespace Opm {
 
         const std::string& getTitle() const;
 
-        void apply_schedule_keywords(const std::vector<DeckKeyword>& keywords);
+        /// Apply the MULTFLT and MULTX, ..., MULTZ- keywords of a report
+        /// step to the transmissibility multipliers.
+        ///
+        /// \return Global indices, in increasing order, of the cells whose
+        /// transmissibility multipliers were changed, i.e., the cells of
+        /// the faults in MULTFLT and the cells with MULTX, ..., MULTZ-
+        /// different from one.  Only the transmissibilities of faces of
+        /// these cells, and of NNCs connected to them, must be recomputed.
+        std::vector<std::size_t> apply_schedule_keywords(const std::vector<DeckKeyword>& keywords);
 
         const Runspec& runspec() const;
         const AquiferConfig& aquifer() const;
@@ -146,6 +156,11 @@ namespace Opm {
         void loadRestartNetworkPressures(const RestartIO::RstNetwork& network);
         const std::optional<std::map<std::string, double> >& getRestartNetworkPressures() const { return this->m_restart_network_pressures; }
 
+        /// Memory of the state, broken down into the tables, the field
+        /// properties and the larger configuration objects.  The input
+        /// grid is counted by its object size only.  See MemoryUsage.
+        MemoryUsage::Node memoryUsage(MemoryUsage& usage) const;
+
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -175,6 +190,10 @@ namespace Opm {
         static bool rst_cmp(const EclipseState& full_state, const EclipseState& rst_state);
 
     private:
+        struct ConcurrentParts;
+
+        EclipseState(const Deck& deck, ConcurrentParts&& parts);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void assignRunTitle(const Deck& deck);
         void reportNumberOfActivePhases() const;
@@ -18,6 +18,8 @@
 */
 
 #include <cstddef>
+#include <exception>
+#include <iterator>
 #include <stdexcept>
 #include <vector>
 #define _USE_MATH_DEFINES
@@ -95,6 +97,50 @@ void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units,
                    [scale_factor](const auto& v) { return v * scale_factor; });
 }
 
+std::array<double,3> cellCenter(const std::array<double,8>& X,
+                                const std::array<double,8>& Y,
+                                const std::array<double,8>& Z)
+{
+    return { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+               std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+               std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+}
+
+double cellThickness(const std::array<double,8>& Z)
+{
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return z2 - z1;
+}
+
+double cellDepth(const std::array<double,8>& Z)
+{
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return (z1 + z2)/2.0;
+}
+
+std::array<double,3> cellDims(const std::array<double,8>& X,
+                              const std::array<double,8>& Y,
+                              const std::array<double,8>& Z)
+{
+    // calculate dx
+    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+    double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+    // calculate dy
+    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+    return { { dx, dy, cellThickness(Z) } };
+}
+
 }
 EclipseGrid::EclipseGrid()
     : GridDims(),
@@ -230,6 +276,7 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std:
         for (std::size_t n=0; n < sizeZcorn; n++) {
             m_zcorn[n] = zcorn[n];
         }
+        m_input_zcorn_adjustments.clear();
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
         zcorn_fixed = mapper.fixupZCORN( m_zcorn );
@@ -242,6 +289,107 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const std::vector<int>& actnum)
         : EclipseGrid( src , nullptr , actnum )
 { }
 
+EclipseGrid EclipseGrid::partition(const std::array<int, 3>& lower,
+                                   const std::array<int, 3>& upper) const
+{
+    const auto dims = this->getNXYZ();
+    for (std::size_t d = 0; d < 3; d++) {
+        if ((lower[d] < 0) || (lower[d] >= upper[d]) || (upper[d] > dims[d]))
+            throw std::invalid_argument {
+                fmt::format("Invalid partition [{}, {}) in direction {} of a grid with {} cells",
+                            lower[d], upper[d], d, dims[d])
+            };
+    }
+
+    if (this->m_coord.empty() || this->m_zcorn.empty())
+        throw std::logic_error("Can not partition a grid without corner point geometry");
+
+    const std::size_t nx = dims[0];
+    const std::size_t ny = dims[1];
+    const std::size_t lx = upper[0] - lower[0];
+    const std::size_t ly = upper[1] - lower[1];
+    const std::size_t lz = upper[2] - lower[2];
+
+    EclipseGrid part { GridDims { lx, ly, lz } };
+    part.m_minpvMode = this->m_minpvMode;
+    part.m_pinch = this->m_pinch;
+    part.m_pinchoutMode = this->m_pinchoutMode;
+    part.m_multzMode = this->m_multzMode;
+    part.m_pinchGapMode = this->m_pinchGapMode;
+    part.m_pinchMaxEmptyGap = this->m_pinchMaxEmptyGap;
+    part.m_circle = this->m_circle;
+    part.m_mapaxes = this->m_mapaxes;
+
+    // Pillars (lower[0] .. upper[0]) x (lower[1] .. upper[1]).
+    part.m_coord.reserve((lx + 1) * (ly + 1) * 6);
+    for (std::size_t j = 0; j <= ly; j++) {
+        const auto begin = this->m_coord.begin() + ((lower[1] + j) * (nx + 1) + lower[0]) * 6;
+        part.m_coord.insert(part.m_coord.end(), begin, begin + (lx + 1) * 6);
+    }
+
+    // For every layer, top and bottom corners; for every row, the
+    // south and north corners of the 2*lx corners along i.
+    part.m_zcorn.reserve(lx * ly * lz * 8);
+    for (std::size_t k = 0; k < lz; k++)
+        for (std::size_t bottom = 0; bottom < 2; bottom++)
+            for (std::size_t j = 0; j < ly; j++)
+                for (std::size_t north = 0; north < 2; north++) {
+                    const auto offset = (lower[2] + k) * 8 * nx * ny + bottom * 4 * nx * ny
+                        + (lower[1] + j) * 4 * nx + north * 2 * nx + 2 * lower[0];
+                    const auto begin = this->m_zcorn.begin() + offset;
+                    part.m_zcorn.insert(part.m_zcorn.end(), begin, begin + 2 * lx);
+                }
+
+    if (this->m_rv.has_value())
+        part.m_rv.emplace(this->m_rv->begin() + lower[0], this->m_rv->begin() + upper[0] + 1);
+
+    if (this->m_thetav.has_value())
+        part.m_thetav.emplace(this->m_thetav->begin() + lower[1], this->m_thetav->begin() + upper[1]);
+
+    std::vector<int> actnum(part.getCartesianSize());
+    if (!this->m_minpvVector.empty())
+        part.m_minpvVector.resize(part.getCartesianSize());
+
+    for (std::size_t k = 0; k < lz; k++)
+        for (std::size_t j = 0; j < ly; j++)
+            for (std::size_t i = 0; i < lx; i++) {
+                const auto local_index = part.getGlobalIndex(i, j, k);
+                const auto global_index = this->getGlobalIndex(lower[0] + i, lower[1] + j, lower[2] + k);
+                actnum[local_index] = this->m_actnum[global_index];
+                if (!this->m_minpvVector.empty())
+                    part.m_minpvVector[local_index] = this->m_minpvVector[global_index];
+            }
+
+    const auto local_index = [&lower, &upper, &part, this](const std::size_t global_index)
+        -> std::optional<std::size_t>
+    {
+        const auto ijk = this->getIJK(global_index);
+        for (std::size_t d = 0; d < 3; d++) {
+            if ((ijk[d] < lower[d]) || (ijk[d] >= upper[d]))
+                return std::nullopt;
+        }
+        return part.getGlobalIndex(ijk[0] - lower[0], ijk[1] - lower[1], ijk[2] - lower[2]);
+    };
+
+    for (const auto global_index : this->m_aquifer_cells) {
+        if (const auto index = local_index(global_index); index.has_value())
+            part.m_aquifer_cells.insert(*index);
+    }
+
+    for (const auto& [global_index, depth] : this->m_aquifer_cell_depths) {
+        if (const auto index = local_index(global_index); index.has_value())
+            part.m_aquifer_cell_depths.emplace(*index, depth);
+    }
+
+    for (const auto& [global_index, tabnums] : this->m_aquifer_cell_tabnums) {
+        if (const auto index = local_index(global_index); index.has_value())
+            part.m_aquifer_cell_tabnums.emplace(*index, tabnums);
+    }
+
+    part.resetACTNUM(actnum.data());
+    return part;
+}
+
 /*
   This is the main EclipseGrid constructor, it will inspect the
   input Deck for grid keywords, either the corner point keywords
@@ -322,13 +470,10 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             if (this->m_rv.has_value())
                 apply_GRIDUNIT(deck.getActiveUnitSystem(), grid_units.value(), this->m_rv.value());
 
-            if (this->m_input_coord.has_value()) {
-                apply_GRIDUNIT(deck.getActiveUnitSystem(), grid_units.value(), this->m_input_coord.value());
-            }
-
-            if (this->m_input_zcorn.has_value()) {
-                apply_GRIDUNIT(deck.getActiveUnitSystem(), grid_units.value(), this->m_input_zcorn.value());
-            }
+            const double scale_factor = grid_units->getDimension(UnitSystem::measure::length).getSIScaling()
+                / deck.getActiveUnitSystem().getDimension(UnitSystem::measure::length).getSIScaling();
+            for (auto& adjustment : this->m_input_zcorn_adjustments)
+                adjustment.second *= scale_factor;
         }
     }
 }
@@ -477,13 +622,19 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             this->m_nz = gridhead[3];
         }
 
-        {
+        if (egridfile.formattedInput()) {
             const std::vector<float>& coord_f = egridfile.get<float>("COORD");
             const std::vector<float>& zcorn_f = egridfile.get<float>("ZCORN");
 
             m_coord.assign(coord_f.begin(), coord_f.end());
             m_zcorn.assign(zcorn_f.begin(), zcorn_f.end());
         }
+        else {
+            // Decode the mapped file directly to double precision, without
+            // caching the single precision arrays in the EclFile.
+            m_coord = egridfile.getView<float>("COORD").toVectorAs<double>();
+            m_zcorn = egridfile.getView<float>("ZCORN").toVectorAs<double>();
+        }
 
         if (const auto& gridunit = egridfile.get<std::string>("GRIDUNIT");
             gridunit[0] != "METRES")
@@ -1222,11 +1373,20 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         m_coord = coord;
         m_zcorn = zcorn;
 
-        m_input_coord = coord;
-        m_input_zcorn = zcorn;
-
         ZcornMapper mapper( getNX(), getNY(), getNZ());
         zcorn_fixed = mapper.fixupZCORN( m_zcorn );
+
+        // Remember the input values of the adjusted corners only, rather
+        // than a full copy of the input ZCORN, so that save() can write
+        // the grid as it was input.
+        m_input_zcorn_adjustments.clear();
+        if (zcorn_fixed > 0) {
+            for (std::size_t n = 0; n < m_zcorn.size(); n++) {
+                if (m_zcorn[n] != zcorn[n])
+                    m_input_zcorn_adjustments.emplace_back(n, zcorn[n]);
+            }
+        }
+
         this->resetACTNUM(actnum);
     }
 
@@ -1545,6 +1705,9 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     const std::vector<double>& EclipseGrid::activeVolume() const {
+        if (this->active_geometry.has_value())
+            return this->active_geometry->volume;
+
         if (!this->active_volume.has_value()) {
             std::vector<double> volume(this->m_nactive);
 
@@ -1570,12 +1733,58 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return this->active_volume.value();
     }
 
+    const EclipseGrid::ActiveGeometry& EclipseGrid::activeGeometry() const {
+        if (!this->active_geometry.has_value()) {
+            const auto nactive = this->m_active_to_global.size();
+
+            ActiveGeometry geometry;
+            for (auto* v : { &geometry.center_x, &geometry.center_y, &geometry.center_z,
+                             &geometry.depth, &geometry.volume,
+                             &geometry.dx, &geometry.dy, &geometry.dz })
+                v->resize(nactive);
+
+            #pragma omp parallel for schedule(static)
+            for (std::size_t active_index = 0; active_index < nactive; active_index++) {
+                std::array<double,8> X;
+                std::array<double,8> Y;
+                std::array<double,8> Z;
+                auto global_index = this->m_active_to_global[active_index];
+                this->getCellCorners(global_index, X, Y, Z );
+
+                const auto center = cellCenter(X, Y, Z);
+                geometry.center_x[active_index] = center[0];
+                geometry.center_y[active_index] = center[1];
+                geometry.center_z[active_index] = center[2];
+                geometry.depth[active_index] = cellDepth(Z);
+
+                const auto dims = cellDims(X, Y, Z);
+                geometry.dx[active_index] = dims[0];
+                geometry.dy[active_index] = dims[1];
+                geometry.dz[active_index] = dims[2];
+
+                if (m_rv && m_thetav) {
+                    const auto[i,j,k] = this->getIJK(global_index);
+                    const auto& r = *m_rv;
+                    const auto& t = *m_thetav;
+                    geometry.volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+                } else
+                    geometry.volume[active_index] = calculateCellVol(X, Y, Z);
+            }
+
+            this->active_geometry = std::move(geometry);
+            this->active_volume = std::nullopt;
+        }
+
+        return this->active_geometry.value();
+    }
+
 
     double EclipseGrid::getCellVolume(std::size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
-        if (this->cellActive(globalIndex) && this->active_volume.has_value()) {
+        if (this->cellActive(globalIndex) &&
+            (this->active_volume.has_value() || this->active_geometry.has_value())) {
             auto active_index = this->activeIndex(globalIndex);
-            return this->active_volume.value()[active_index];
+            return this->activeVolume()[active_index];
         }
 
         std::array<double,8> X;
@@ -1609,47 +1818,30 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     double EclipseGrid::getCellThickness(std::size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (this->active_geometry.has_value() && this->cellActive(globalIndex))
+            return this->active_geometry->dz[this->activeIndex(globalIndex)];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-        return dz;
+        return cellThickness(Z);
     }
 
 
     std::array<double, 3> EclipseGrid::getCellDims(std::size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (this->active_geometry.has_value() && this->cellActive(globalIndex)) {
+            const auto active_index = this->activeIndex(globalIndex);
+            const auto& geometry = this->active_geometry.value();
+            return { { geometry.dx[active_index], geometry.dy[active_index], geometry.dz[active_index] } };
+        }
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cellDims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(std::size_t i , std::size_t j , std::size_t k) const {
@@ -1714,13 +1906,19 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     std::array<double, 3> EclipseGrid::getCellCenter(std::size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (this->active_geometry.has_value() && this->cellActive(globalIndex)) {
+            const auto active_index = this->activeIndex(globalIndex);
+            const auto& geometry = this->active_geometry.value();
+            return { { geometry.center_x[active_index],
+                       geometry.center_y[active_index],
+                       geometry.center_z[active_index] } };
+        }
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
-                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
-                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+        return cellCenter(X, Y, Z);
     }
 
 
@@ -1772,6 +1970,23 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         }
     }
 
+    std::array<std::array<double, 3>, 8>
+    EclipseGrid::getCornerPositions(const std::size_t globalIndex) const
+    {
+        std::array<double,8> X = {0.0};
+        std::array<double,8> Y = {0.0};
+        std::array<double,8> Z = {0.0};
+
+        getCellCorners(globalIndex, X, Y, Z);
+
+        std::array<std::array<double, 3>, 8> corners;
+        for (std::size_t l = 0; l < 8; ++l) {
+            corners[l] = {X[l], Y[l], Z[l]};
+        }
+
+        return corners;
+    }
+
     bool EclipseGrid::isValidCellGeomtry(const std::size_t globalIndex,
                                          const UnitSystem& usys) const
     {
@@ -1815,14 +2030,14 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     double EclipseGrid::computeCellGeometricDepth(std::size_t globalIndex) const {
+        if (this->active_geometry.has_value() && this->cellActive(globalIndex))
+            return this->active_geometry->depth[this->activeIndex(globalIndex)];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        return (z1 + z2)/2.0;
+        return cellDepth(Z);
     }
 
     double EclipseGrid::getCellDepth(std::size_t i, std::size_t j, std::size_t k) const {
@@ -1849,6 +2064,8 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
+        this->active_volume = std::nullopt;
+        this->active_geometry = std::nullopt;
         return mapper.fixupZCORN( m_zcorn );
     }
 
@@ -1872,24 +2089,17 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         auto convert_length = [&units](const double x) { return static_cast<float>(units.from_si(length, x)); };
 
-        if (m_input_coord.has_value()) {
-            std::transform(m_input_coord.value().begin(), m_input_coord.value().end(), coord_f.begin(), convert_length);
-        } else {
-            std::transform(m_coord.begin(), m_coord.end(), coord_f.begin(), convert_length);
-        }
+        std::transform(m_coord.begin(), m_coord.end(), coord_f.begin(), convert_length);
 
         // create zcorn vector of floats with input units, converted from SI
         std::vector<float> zcorn_f;
         zcorn_f.resize(m_zcorn.size());
 
-        if (m_input_zcorn.has_value()) {
-            std::transform(m_input_zcorn.value().begin(), m_input_zcorn.value().end(), zcorn_f.begin(), convert_length);
-        } else {
-            std::transform(m_zcorn.begin(), m_zcorn.end(), zcorn_f.begin(), convert_length);
-        }
+        std::transform(m_zcorn.begin(), m_zcorn.end(), zcorn_f.begin(), convert_length);
+        for (const auto& [index, input_value] : m_input_zcorn_adjustments)
+            zcorn_f[index] = convert_length(input_value);
 
-        m_input_coord.reset();
-        m_input_zcorn.reset();
+        m_input_zcorn_adjustments.clear();
 
         std::vector<int> filehead(100,0);
         filehead[0] = 3;                     // version number
@@ -2091,20 +2301,49 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
             return std::make_tuple(i_list, j_list, k_list);
         };
 
+        std::vector<std::size_t> children;
         for (std::size_t index = 0; index < lgr_input.size(); index++) {
-            const auto lgr_cell = lgr_input.getLgr(index);
-            if (this->lgr_label == lgr_cell.PARENT_NAME())            {
-                lgr_grid = true;
-                // auto [i_list, j_list, k_list] = lgr_cell.parent_cellsIJK();                
+            if (this->lgr_label == lgr_input.getLgr(index).PARENT_NAME()) {
+                children.push_back(index);
+            }
+        }
+        if (!children.empty()) {
+            lgr_grid = true;
+        }
+
+        // The refined grids of different CARFINs are independent of each
+        // other, so they are built in parallel, including their own nested
+        // refinements.
+        const auto num_children = static_cast<int>(children.size());
+        std::vector<EclipseGridLGR> new_children(num_children);
+        std::vector<std::exception_ptr> failure(num_children);
+
+#pragma omp parallel for schedule(dynamic)
+        for (int child = 0; child < num_children; child++) {
+            try {
+                const auto& lgr_cell = lgr_input.getLgr(children[child]);
                 auto [i_list, j_list, k_list] = parent_cellsIJK(lgr_cell);
 
                 auto father_lgr_index = IJK_global(i_list, j_list, k_list);
-                lgr_children_cells.emplace_back(lgr_cell.NAME(), this->lgr_label, this->lgr_level, 
-                                                lgr_cell.NX(), lgr_cell.NY(), lgr_cell.NZ(), father_lgr_index);
-                
-                lgr_children_cells.back().create_lgr_cells_tree(lgr_input);              
+                new_children[child] = EclipseGridLGR(lgr_cell.NAME(), this->lgr_label, this->lgr_level,
+                                                     lgr_cell.NX(), lgr_cell.NY(), lgr_cell.NZ(),
+                                                     father_lgr_index);
+                new_children[child].create_lgr_cells_tree(lgr_input);
+            }
+            catch (...) {
+                failure[child] = std::current_exception();
+            }
+        }
+
+        for (const auto& error : failure) {
+            if (error) {
+                std::rethrow_exception(error);
             }
         }
+
+        lgr_children_cells.insert(lgr_children_cells.end(),
+                                  std::make_move_iterator(new_children.begin()),
+                                  std::make_move_iterator(new_children.end()));
         std::sort(lgr_children_cells.begin(), lgr_children_cells.end(),
                   [](const EclipseGridLGR& a, const EclipseGridLGR& b) {
                       return a.get_father_global()[0] < b.get_father_global()[0]; // Sort by another property
@@ -2117,29 +2356,22 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     void EclipseGrid::init_lgr_cells_index(){
-        auto set_map_scalar = [&](const auto& vec, const auto& value){
-             num_lgr_children_cells[vec] = value;
-        };
-        auto set_vec_value = []( auto& vec, const auto& num_ref, const auto& data){
-            for (std::size_t index = 0; index < num_ref.size(); index++) {              
-                vec[num_ref[index]] = data;
-            }
-        };        
+        // The children are sorted by the first (smallest) host cell index,
+        // which is unique since the refined regions do not overlap, so that
+        // index identifies each child.  The host cell of a child is counted
+        // with all active cells of the child, the other cells it spans are
+        // not counted.
         std::vector<std::size_t> lgr_level_numbering_counting(getNumActive(),1);
         lgr_level_active_map.resize(getNumActive(),0);
-        for (const auto& cell:lgr_children_cells) {
-            set_map_scalar(cell.getFatherGlobalID(), cell.getTotalActiveLGR());
-        }                  
-        std::vector<std::size_t> bottom_lgr_cells;
-        std::size_t index = 0;
-        for (const auto& [key, value] : num_lgr_children_cells) {
-            const std::size_t head_lgr_cell = key[0];
-            lgr_level_numbering_counting[head_lgr_cell] = value;
+        for (std::size_t index = 0; index < lgr_children_cells.size(); index++) {
+            const auto& father_global_id = lgr_children_cells[index].getFatherGlobalID();
+            const std::size_t head_lgr_cell = father_global_id[0];
+            lgr_level_numbering_counting[head_lgr_cell] = lgr_children_cells[index].getTotalActiveLGR();
             lgr_active_index[index] = head_lgr_cell;
-            bottom_lgr_cells.insert(bottom_lgr_cells.end(), key.begin() + 1, key.end());
-            set_vec_value(lgr_level_numbering_counting, bottom_lgr_cells, 0);
-            index++;
-        }        
+            for (auto cell = father_global_id.begin() + 1; cell != father_global_id.end(); ++cell) {
+                lgr_level_numbering_counting[*cell] = 0;
+            }
+        }
         std::partial_sum(lgr_level_numbering_counting.begin(), lgr_level_numbering_counting.end(),
                          lgr_level_active_map.begin());
         lgr_level_active_map.reserve(lgr_level_active_map.size()+1);
@@ -2168,6 +2400,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
         this->active_volume = std::nullopt;
+        this->active_geometry = std::nullopt;
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
@@ -2196,6 +2429,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 }
             }
             this->active_volume = std::nullopt;
+            this->active_geometry = std::nullopt;
         }
     }
 
@@ -2319,32 +2553,41 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
         std::size_t cells_adjusted = 0;
 
-        for (std::size_t k=0; k < this->dims[2]; k++)
-            for (std::size_t j=0; j < this->dims[1]; j++)
-                for (std::size_t i=0; i < this->dims[0]; i++)
-                    for (std::size_t c=0; c < 4; c++) {
-                        /* Cell to cell */
-                        if (k > 0) {
-                            std::size_t index1 = this->index(i,j,k-1,c+4);
-                            std::size_t index2 = this->index(i,j,k,c);
-
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+        // The corners of each I-J column only depend on the corners above
+        // them in the same column, so the columns are fixed up in parallel.
+        // Within a column the layers are processed top to bottom as before.
+        const std::size_t num_columns = this->dims[0] * this->dims[1];
+
+#pragma omp parallel for schedule(static) reduction(+:cells_adjusted)
+        for (std::size_t column = 0; column < num_columns; column++) {
+            const std::size_t i = column % this->dims[0];
+            const std::size_t j = column / this->dims[0];
+
+            for (std::size_t k=0; k < this->dims[2]; k++)
+                for (std::size_t c=0; c < 4; c++) {
+                    /* Cell to cell */
+                    if (k > 0) {
+                        std::size_t index1 = this->index(i,j,k-1,c+4);
+                        std::size_t index2 = this->index(i,j,k,c);
+
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                            zcorn[index2] = zcorn[index1];
+                            cells_adjusted++;
                         }
+                    }
 
-                        /* Cell internal */
-                        {
-                            std::size_t index1 = this->index(i,j,k,c);
-                            std::size_t index2 = this->index(i,j,k,c+4);
+                    /* Cell internal */
+                    {
+                        std::size_t index1 = this->index(i,j,k,c);
+                        std::size_t index2 = this->index(i,j,k,c+4);
 
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                            zcorn[index2] = zcorn[index1];
+                            cells_adjusted++;
                         }
                     }
+                }
+        }
         return cells_adjusted;
     }
 
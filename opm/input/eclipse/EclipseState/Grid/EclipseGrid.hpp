@@ -31,6 +31,7 @@
 #include <optional>
 #include <stdexcept>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -81,6 +82,17 @@ namespace Opm {
         /// explicitly.  If a null pointer is passed, every cell is active.
         explicit EclipseGrid(const Deck& deck, const int * actnum = nullptr);
 
+        /// Copy of the cells lower <= (i,j,k) < upper of this grid as a
+        /// grid of its own, e.g., the partition of a process including
+        /// its halo cells.  Only the pillars, corners, ACTNUM, MINPV and
+        /// numerical aquifer cells inside the window are copied, so a
+        /// process can be handed its partition without ever holding the
+        /// global ZCORN and COORD arrays.  Local cell (i,j,k) of the
+        /// result is global cell (lower[0]+i, lower[1]+j, lower[2]+k).
+        /// Local grid refinements are not part of the window.
+        EclipseGrid partition(const std::array<int, 3>& lower,
+                              const std::array<int, 3>& upper) const;
+
         static bool hasGDFILE(const Deck& deck);
         static bool hasRadialKeywords(const Deck& deck);
         static bool hasSpiderKeywords(const Deck& deck);
@@ -186,7 +198,32 @@ namespace Opm {
         std::array<double, 3> getCellCenter(size_t i,size_t j, size_t k) const;
         std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
+        /// All eight corners of a cell, numbered as in getCornerPos(), from
+        /// a single evaluation of the corner point geometry.
+        std::array<std::array<double, 3>, 8> getCornerPositions(size_t globalIndex) const;
         const std::vector<double>& activeVolume() const;
+
+        /// Geometry of all active cells, one array per quantity indexed
+        /// by active cell index.
+        struct ActiveGeometry
+        {
+            std::vector<double> center_x;
+            std::vector<double> center_y;
+            std::vector<double> center_z;
+            std::vector<double> depth;
+            std::vector<double> volume;
+            std::vector<double> dx;
+            std::vector<double> dy;
+            std::vector<double> dz;
+        };
+
+        /// Compute the geometry of all active cells in parallel and keep
+        /// it until ACTNUM or ZCORN change.  Once computed,
+        /// getCellCenter(), getCellVolume(), getCellThickness(),
+        /// getCellDims() and getCellDepth() read active cells from it
+        /// instead of evaluating the corner point geometry.  Like
+        /// activeVolume(), the first call is not thread safe.
+        const ActiveGeometry& activeGeometry() const;
         double getCellVolume(size_t globalIndex) const;
         double getCellVolume(size_t i , size_t j , size_t k) const;
         double getCellThickness(size_t globalIndex) const;
@@ -265,7 +302,6 @@ namespace Opm {
         std::vector<std::size_t> lgr_active_index;
         std::vector<std::size_t> lgr_level_active_map;
         std::vector<std::string> all_lgr_labels;
-        std::map<std::vector<std::size_t>, std::size_t> num_lgr_children_cells;        
 
     private:
         std::vector<double> m_minpvVector;
@@ -281,14 +317,15 @@ namespace Opm {
         double    m_pinchMaxEmptyGap;
         bool lgr_grid = false;
         mutable std::optional<std::vector<double>> active_volume;
+        mutable std::optional<ActiveGeometry> active_geometry;
 
         bool m_circle = false;
         size_t zcorn_fixed = 0;
         bool m_useActnumFromGdfile = false;
 
-        // Input grid data.
-        mutable std::optional<std::vector<double>> m_input_zcorn;
-        mutable std::optional<std::vector<double>> m_input_coord;
+        // Input values of the ZCORN entries modified by fixupZCORN, as
+        // (index, value) pairs.
+        mutable std::vector<std::pair<std::size_t, double>> m_input_zcorn_adjustments;
 
         std::vector<double> m_zcorn;
         std::vector<double> m_coord;
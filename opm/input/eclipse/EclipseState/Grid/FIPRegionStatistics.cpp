@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -60,25 +62,58 @@ namespace {
         return strings;
     }
 
-    int localMaxRegionID(const std::string& regSet, const Opm::FieldPropsManager& fldPropsMgr)
-    {
-        const auto& regID = fldPropsMgr.get_int(regSet);
-
-        return regID.empty()
-            ? -1
-            : *std::max_element(regID.begin(), regID.end());
-    }
-
     std::vector<int> localMaxRegionID(const std::vector<std::string>& regSets,
                                       const Opm::FieldPropsManager&   fldPropsMgr)
     {
-        auto maxRegionID = std::vector<int>(regSets.size());
+        // Region arrays are retrieved serially, since the field properties
+        // may be created on first access.  The maxima of all region sets
+        // are then computed in a single pass over blocks of cells.
+        auto regIDs = std::vector<const std::vector<int>*>{};
+        regIDs.reserve(regSets.size());
+
+        auto numCells = std::size_t{0};
+        for (const auto& regSet : regSets) {
+            regIDs.push_back(&fldPropsMgr.get_int("FIP" + regSet));
+            numCells = std::max(numCells, regIDs.back()->size());
+        }
+
+        // Empty region arrays have a maximum region ID of -1.
+        auto maxRegionID = std::vector<int>(regSets.size(), -1);
+        for (auto set = 0*regIDs.size(); set < regIDs.size(); ++set) {
+            if (! regIDs[set]->empty()) {
+                maxRegionID[set] = std::numeric_limits<int>::min();
+            }
+        }
 
-        std::transform(regSets.begin(), regSets.end(), maxRegionID.begin(),
-                       [&fldPropsMgr](const std::string& regSet)
-                       {
-                           return localMaxRegionID("FIP" + regSet, fldPropsMgr);
-                       });
+        constexpr auto blockSize = std::size_t{4096};
+        const auto numBlocks = static_cast<std::int64_t>((numCells + blockSize - 1) / blockSize);
+
+#pragma omp parallel if (numBlocks > 1)
+        {
+            auto threadMax = maxRegionID;
+
+#pragma omp for schedule(static)
+            for (std::int64_t block = 0; block < numBlocks; ++block) {
+                const auto begin = static_cast<std::size_t>(block) * blockSize;
+
+                for (auto set = 0*regIDs.size(); set < regIDs.size(); ++set) {
+                    const auto& regID = *regIDs[set];
+                    const auto end = std::min(begin + blockSize, regID.size());
+
+                    auto m = threadMax[set];
+                    for (auto cell = begin; cell < end; ++cell) {
+                        m = std::max(m, regID[cell]);
+                    }
+
+                    threadMax[set] = m;
+                }
+            }
+
+#pragma omp critical
+            for (auto set = 0*regIDs.size(); set < regIDs.size(); ++set) {
+                maxRegionID[set] = std::max(maxRegionID[set], threadMax[set]);
+            }
+        }
 
         return maxRegionID;
     }
@@ -42,6 +42,7 @@ checkInitialisedCopy(const FieldData&                    src,
                      const KeywordLocation&              loc,
                      const bool                          global)
 {
+    this->expand();
     auto unInit = 0;
 
     const auto& from_data = global? *src.global_data: src.data;
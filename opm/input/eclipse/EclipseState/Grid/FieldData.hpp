@@ -32,6 +32,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -77,13 +78,32 @@ namespace Opm::Fieldprops {
         std::optional<std::vector<value::status>> global_value_status{std::nullopt};
         mutable bool all_set{false};
 
+        // Value and status of every element, and number of elements, while
+        // the arrays are released by compact().
+        std::optional<std::pair<T, value::status>> uniform{};
+        std::size_t uniform_size{0};
+
         bool operator==(const FieldData& other) const
         {
-            return this->data == other.data &&
-                   this->value_status == other.value_status &&
-                   this->kw_info == other.kw_info &&
-                   this->global_data == other.global_data &&
-                   this->global_value_status == other.global_value_status;
+            if (!(this->kw_info == other.kw_info &&
+                  this->global_data == other.global_data &&
+                  this->global_value_status == other.global_value_status))
+                return false;
+
+            if (!this->uniform && !other.uniform)
+                return this->data == other.data &&
+                       this->value_status == other.value_status;
+
+            if (this->dataSize() != other.dataSize())
+                return false;
+
+            for (std::size_t i = 0; i < this->dataSize(); ++i) {
+                if (this->value_at(i) != other.value_at(i) ||
+                    this->status_at(i) != other.status_at(i))
+                    return false;
+            }
+
+            return true;
         }
 
         FieldData() = default;
@@ -108,12 +128,64 @@ namespace Opm::Fieldprops {
 
         std::size_t numCells() const
         {
-            return this->data.size() / this->numValuePerCell();
+            return this->dataSize() / this->numValuePerCell();
         }
 
         std::size_t dataSize() const
         {
-            return this->data.size();
+            return this->uniform ? this->uniform_size : this->data.size();
+        }
+
+        bool is_compact() const
+        {
+            return this->uniform.has_value();
+        }
+
+        /// Release the data and value_status arrays if all elements have
+        /// the same value and status, e.g., MULTX defaulted to 1 or NTG
+        /// set to 1 with EQUALS over the whole grid.  Arrays with global
+        /// storage are always kept.  The caller must call expand() before
+        /// accessing data or value_status directly.
+        bool compact()
+        {
+            if (this->uniform || this->global_data || this->data.empty())
+                return this->uniform.has_value();
+
+            const auto value = this->data.front();
+            const auto status = this->value_status.front();
+            if (std::any_of(this->data.begin(), this->data.end(),
+                            [value](const T& v) { return !(v == value); }) ||
+                std::any_of(this->value_status.begin(), this->value_status.end(),
+                            [status](const value::status s) { return s != status; }))
+                return false;
+
+            this->uniform.emplace(value, status);
+            this->uniform_size = this->data.size();
+            std::vector<T>{}.swap(this->data);
+            std::vector<value::status>{}.swap(this->value_status);
+            return true;
+        }
+
+        /// Restore the arrays released by compact().
+        void expand()
+        {
+            if (!this->uniform)
+                return;
+
+            this->data.assign(this->uniform_size, this->uniform->first);
+            this->value_status.assign(this->uniform_size, this->uniform->second);
+            this->uniform.reset();
+            this->uniform_size = 0;
+        }
+
+        const T& value_at(const std::size_t index) const
+        {
+            return this->uniform ? this->uniform->first : this->data[index];
+        }
+
+        value::status status_at(const std::size_t index) const
+        {
+            return this->uniform ? this->uniform->second : this->value_status[index];
         }
 
         std::size_t numValuePerCell() const
@@ -127,6 +199,12 @@ namespace Opm::Fieldprops {
                 return true;
             }
 
+            if (this->uniform) {
+                return this->all_set =
+                    (this->uniform->second != value::status::uninitialized) &&
+                    (this->uniform->second != value::status::empty_default);
+            }
+
             // Object is "valid" if the 'value_status' of every element is
             // neither uninitialised nor empty.
             return this->all_set =
@@ -140,6 +218,10 @@ namespace Opm::Fieldprops {
 
         bool valid_default() const
         {
+            if (this->uniform) {
+                return this->uniform->second == value::status::valid_default;
+            }
+
             return std::all_of(this->value_status.begin(), this->value_status.end(),
                                [](const value::status& status)
                                {
@@ -149,6 +231,16 @@ namespace Opm::Fieldprops {
 
         void compress(const std::vector<bool>& active_map)
         {
+            if (this->uniform) {
+                if (this->uniform_size != active_map.size() * this->numValuePerCell()) {
+                    throw std::invalid_argument("Data size does not match the size of active_map times values_per_cell.");
+                }
+
+                this->uniform_size = this->numValuePerCell() *
+                    std::count(active_map.begin(), active_map.end(), true);
+                return;
+            }
+
             Fieldprops::compress(this->data, active_map, this->numValuePerCell());
             Fieldprops::compress(this->value_status, active_map, this->numValuePerCell());
         }
@@ -162,6 +254,7 @@ namespace Opm::Fieldprops {
 
         void default_assign(T value)
         {
+            this->expand();
             std::fill(this->data.begin(), this->data.end(), value);
             std::fill(this->value_status.begin(),
                       this->value_status.end(),
@@ -179,6 +272,7 @@ namespace Opm::Fieldprops {
 
         void default_assign(const std::vector<T>& src)
         {
+            this->expand();
             if (src.size() != this->dataSize()) {
                 throw std::invalid_argument {
                     "Size mismatch got: " + std::to_string(src.size()) +
@@ -218,6 +312,7 @@ namespace Opm::Fieldprops {
                     "Cannot call update_local_from_gloabl on keyword with local storage"
                 };
             }
+            this->expand();
             std::size_t i{};
             auto current_status = this->value_status.begin();
             for(auto current = this->data.begin(); current != this->data.end(); ++current, ++current_status, ++i)
@@ -230,6 +325,7 @@ namespace Opm::Fieldprops {
 
         void default_update(const std::vector<T>& src)
         {
+            this->expand();
             if (src.size() != this->dataSize()) {
                 throw std::invalid_argument {
                     "Size mismatch got: " + std::to_string(src.size()) +
@@ -249,6 +345,7 @@ namespace Opm::Fieldprops {
                     T value,
                     const value::status status)
         {
+            this->expand();
             this->data[index] = value;
             this->value_status[index] = status;
         }
@@ -37,6 +37,8 @@
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/input/eclipse/Utility/InputProfile.hpp>
+
 #include <opm/input/eclipse/Deck/Deck.hpp>
 
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
@@ -103,6 +105,27 @@ namespace {
         return (keyword == "PCW")  || (keyword == "PCG")
             || (keyword == "IPCG") || (keyword == "IPCW");
     }
+
+    // FieldData has no serializeOp(), so the arrays of each property are
+    // handed to the visitor explicitly.
+    template <typename T>
+    std::size_t fieldDataHeap(Opm::MemoryUsage& usage,
+                              const std::unordered_map<std::string, Opm::Fieldprops::FieldData<T>>& fields)
+    {
+        const auto before = usage.heapBytes();
+
+        usage(fields);
+        for (const auto& entry : fields) {
+            const auto& field = entry.second;
+            usage(field.data);
+            usage(field.value_status);
+            usage(field.kw_info.unit);
+            usage(field.global_data);
+            usage(field.global_value_status);
+        }
+
+        return usage.heapBytes() - before;
+    }
 } // Anonymous namespace
 
 namespace Opm {
@@ -396,15 +419,48 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
     }
 }
 
+// Box operations update every cell independently of the others, so large
+// boxes are processed in parallel.  The per cell arithmetic is unchanged,
+// so the result does not depend on the number of threads.
+constexpr std::size_t min_parallel_box_size = 16 * 1024;
+
+template <typename T, typename Op>
+std::size_t update_defined_values(std::vector<T>&                     data,
+                                  const std::vector<value::status>&   value_status,
+                                  const std::vector<Box::cell_index>& index_list,
+                                  Op&&                                op)
+{
+    const auto num_cells = index_list.size();
+    std::size_t unInit = 0;
+
+#pragma omp parallel for schedule(static) reduction(+:unInit) if(num_cells >= min_parallel_box_size)
+    for (std::size_t i = 0; i < num_cells; ++i) {
+        const auto ix = index_list[i].active_index;
+
+        if (value::has_value(value_status[ix])) {
+            data[ix] = op(data[ix]);
+        }
+        else {
+            ++unInit;
+        }
+    }
+
+    return unInit;
+}
+
 template <typename T>
 void assign_scalar(std::vector<T>&                     data,
                    std::vector<value::status>&         value_status,
                    const T                             value,
                    const std::vector<Box::cell_index>& index_list)
 {
-    for (const auto& cell_index : index_list) {
-        data[cell_index.active_index] = value;
-        value_status[cell_index.active_index] = value::status::deck_value;
+    const auto num_cells = index_list.size();
+
+#pragma omp parallel for schedule(static) if(num_cells >= min_parallel_box_size)
+    for (std::size_t i = 0; i < num_cells; ++i) {
+        const auto ix = index_list[i].active_index;
+        data[ix] = value;
+        value_status[ix] = value::status::deck_value;
     }
 }
 
@@ -416,18 +472,8 @@ void multiply_scalar(const KeywordLocation&              loc,
                      const T                             value,
                      const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] *= value;
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = update_defined_values(data, value_status, index_list,
+                                              [value](const T x) { return x * value; });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -444,18 +490,8 @@ void add_scalar(const KeywordLocation&              loc,
                 const T                             value,
                 const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] += value;
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = update_defined_values(data, value_status, index_list,
+                                              [value](const T x) { return x + value; });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -472,18 +508,8 @@ void min_value(const KeywordLocation&              loc,
                const T                             value,
                const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::max(data[ix], value);
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = update_defined_values(data, value_status, index_list,
+                                              [value](const T x) { return std::max(x, value); });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -501,18 +527,8 @@ void max_value(const KeywordLocation&              loc,
                const T                             value,
                const std::vector<Box::cell_index>& index_list)
 {
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::min(data[ix], value);
-        }
-        else {
-            ++unInit;
-        }
-    }
+    const auto unInit = update_defined_values(data, value_status, index_list,
+                                              [value](const T x) { return std::min(x, value); });
 
     if (unInit > 0) {
         reject_undefined_operation(loc, unInit,
@@ -635,11 +651,15 @@ void handle_box_keyword(const DeckKeyword& deckKeyword, Box& box)
 
 std::vector<double> extract_cell_volume(const EclipseGrid& grid)
 {
-    return grid.activeVolume();
+    return grid.activeGeometry().volume;
 }
 
 std::vector<double> extract_cell_depth(const EclipseGrid& grid)
 {
+    // getCellDepth() reads the cached geometry, and applies the depths
+    // of numerical aquifer cells on top.
+    grid.activeGeometry();
+
     std::vector<double> cell_depth(grid.getNumActive());
 
     for (std::size_t active_index = 0; active_index < grid.getNumActive(); ++active_index) {
@@ -763,6 +783,7 @@ FieldProps::init_get(const std::string& keyword_name,
 
     auto iter = this->double_data.find(mult_keyword);
     if (iter != this->double_data.end()) {
+        iter->second.expand();
         return iter->second;
     }
     else if (multiplier_in_edit) {
@@ -812,6 +833,7 @@ FieldProps::init_get(const std::string&                             keyword,
 {
     auto iter = this->int_data.find(keyword);
     if (iter != this->int_data.end()) {
+        iter->second.expand();
         return iter->second;
     }
 
@@ -855,6 +877,8 @@ FieldProps::FieldProps(const Deck& deck,
     , grid_ptr(&grid)
     , tables(tables_arg)
 {
+    InputProfile::Phase profile { "FieldProps" };
+
     this->tran.emplace("TRANX", "TRANX");
     this->tran.emplace("TRANY", "TRANY");
     this->tran.emplace("TRANZ", "TRANZ");
@@ -873,10 +897,12 @@ FieldProps::FieldProps(const Deck& deck,
             data.update_local_from_global([&grid](std::size_t i){ return grid.getGlobalIndex(i);});
         }
         this->scanGRIDSection(GRIDSection(deck));
+        this->compact_arrays();
     }
 
     if (DeckSection::hasEDIT(deck)) {
         this->scanEDITSection(EDITSection(deck));
+        this->compact_arrays();
     }
 
     grid.resetACTNUM(this->actnum());
@@ -884,6 +910,7 @@ FieldProps::FieldProps(const Deck& deck,
 
     if (DeckSection::hasREGIONS(deck)) {
         this->scanREGIONSSection(REGIONSSection(deck));
+        this->compact_arrays();
     }
 
     // Update PVTNUM/SATNUM for numerical aquifer cells
@@ -893,8 +920,8 @@ FieldProps::FieldProps(const Deck& deck,
         const bool has_pvtnum = this->int_data.count("PVTNUM") != 0;
         const bool has_satnum = this->int_data.count("SATNUM") != 0;
 
-        std::vector<int>* pvtnum = has_pvtnum ? &(this->int_data["PVTNUM"].data) : nullptr;
-        std::vector<int>* satnum = has_satnum ? &(this->int_data["SATNUM"].data) : nullptr;
+        std::vector<int>* pvtnum = has_pvtnum ? &(this->init_get<int>("PVTNUM").data) : nullptr;
+        std::vector<int>* satnum = has_satnum ? &(this->init_get<int>("SATNUM").data) : nullptr;
         for (const auto& [globCell, regionID] : aqcell_tabnums) {
             const auto aix = grid.activeIndex(globCell);
             if (has_pvtnum) { (*pvtnum)[aix] = std::max(regionID[0], (*pvtnum)[aix]); }
@@ -904,10 +931,26 @@ FieldProps::FieldProps(const Deck& deck,
 
     if (DeckSection::hasPROPS(deck)) {
         this->scanPROPSSection(PROPSSection(deck));
+        this->compact_arrays();
     }
 
     if (DeckSection::hasSOLUTION(deck)) {
         this->scanSOLUTIONSection(SOLUTIONSection(deck), ncomps);
+        this->compact_arrays();
+    }
+}
+
+void FieldProps::compact_arrays()
+{
+    for (auto& [key, field] : this->int_data) {
+        // ACTNUM is read through m_actnum and actnum().
+        if (key != "ACTNUM")
+            field.compact();
+    }
+
+    for (auto& [key, field] : this->double_data) {
+        static_cast<void>(key);
+        field.compact();
     }
 }
 
@@ -1170,6 +1213,8 @@ void FieldProps::apply_multipliers()
                          std::forward_as_tuple(kw_info, this->active_size, kw_info.global ? this->global_size : 0))
                 .first;
         }
+        mult_iter->second.expand();
+        iter->second.expand();
 
         std::transform(iter->second.data.begin(), iter->second.data.end(),
                        mult_iter->second.data.begin(), iter->second.data.begin(),
@@ -1260,6 +1305,7 @@ std::vector<int> FieldProps::extract<int>(const std::string& keyword)
     auto field_iter = this->int_data.find(keyword);
 
     auto field = std::move(field_iter->second);
+    field.expand();
     std::vector<int> data = std::move(field.data);
 
     this->int_data.erase(field_iter);
@@ -1273,6 +1319,7 @@ std::vector<double> FieldProps::extract<double>(const std::string& keyword)
     auto field_iter = this->double_data.find(keyword);
 
     auto field = std::move(field_iter->second);
+    field.expand();
     std::vector<double> data = std::move(field.data);
 
     this->double_data.erase(field_iter);
@@ -1408,29 +1455,31 @@ void FieldProps::operate(const DeckRecord&                   record,
     const auto& from_data = global? *src_data.global_data : src_data.data;
     auto& from_status = global? *src_data.global_value_status : src_data.value_status;
 
+    const auto num_cells = index_list.size();
+
+    // Validate the whole box before modifying the target array, so that an
+    // unset value leaves the target untouched.
     for (const auto& cell_index : index_list) {
         // This is the global index if global is true and global storage is used.
         const auto ix = cell_index.active_index;
 
-        if (value::has_value(from_status[ix])) {
-            if (!check_target || value::has_value(to_status[ix])) {
-                to_data[ix] = func(to_data[ix], from_data[ix]);
-                to_status[ix] = from_status[ix];
-            }
-            else {
-                throw std::invalid_argument {
-                    "Tried to use unset property value "
-                    "in OPERATE/OPERATER keyword"
-                };
-            }
-        }
-        else {
+        if (!value::has_value(from_status[ix]) ||
+            (check_target && !value::has_value(to_status[ix])))
+        {
             throw std::invalid_argument {
                 "Tried to use unset property value in "
                 "OPERATE/OPERATER keyword"
             };
         }
     }
+
+#pragma omp parallel for schedule(static) if(num_cells >= min_parallel_box_size)
+    for (std::size_t i = 0; i < num_cells; ++i) {
+        const auto ix = index_list[i].active_index;
+
+        to_data[ix] = func(to_data[ix], from_data[ix]);
+        to_status[ix] = from_status[ix];
+    }
 }
 
 void FieldProps::handle_operateR(const DeckKeyword& keyword)
@@ -1841,6 +1890,7 @@ void FieldProps::handle_keyword(const Section      section,
                                 Box&               box)
 {
     const auto& name = keyword.name();
+    InputProfile::Scope profile { "FieldProps", name };
 
     if (Fieldprops::keywords::oper_keywords.count(name) == 1) {
         this->handle_operation(section, keyword, box);
@@ -1877,7 +1927,8 @@ void FieldProps::init_tempi(Fieldprops::FieldData<double>& tempi)
         for (size_t active_index = 0; active_index < this->active_size; active_index++) {
             const auto& table = rtempvd.getTable<RtempvdTable>(eqlnum[active_index] - 1);
             double depth = this->cell_depth[active_index];
-            tempi_values[active_index] = table.evaluate("Temperature", depth);
+            const auto index = table.getDepthColumn().lookup(depth);
+            tempi_values[active_index] = table.getTemperatureColumn().eval(index);
         }
 
         tempi.default_update(tempi_values);
@@ -2139,12 +2190,18 @@ void FieldProps::init_satfunc(const std::string& keyword,
         this->m_rtep = satfunc::getRawTableEndpoints(this->tables, this->m_phases,
                                                      this->m_satfuncctrl.minimumRelpermMobilityThreshold());
 
+    // The function values only depend on the saturation tables, so compute
+    // them once for all KR* and PC* keywords rather than once per keyword.
+    if (!this->m_rfunc.has_value())
+        this->m_rfunc = satfunc::getRawFunctionValues(this->tables, this->m_phases,
+                                                      this->m_rtep.value());
+
     const auto& endnum = this->get<int>("ENDNUM");
     const auto& satreg = (keyword[0] == 'I')
         ? this->get<int>("IMBNUM")
         : this->get<int>("SATNUM");
 
-    satfunc.default_update(satfunc::init(keyword, this->tables, this->m_phases, this->m_rtep.value(), this->cell_depth, satreg, endnum));
+    satfunc.default_update(satfunc::init(keyword, this->tables, this->m_phases, this->m_rtep.value(), this->m_rfunc.value(), this->cell_depth, satreg, endnum));
 }
 
 void FieldProps::scanPROPSSection(const PROPSSection& props_section)
@@ -2237,7 +2294,8 @@ void FieldProps::scanSOLUTIONSection(const SOLUTIONSection& solution_section,
     }
 }
 
-void FieldProps::handle_schedule_keywords(const std::vector<DeckKeyword>& keywords)
+std::vector<std::size_t>
+FieldProps::handle_schedule_keywords(const std::vector<DeckKeyword>& keywords)
 {
     auto box = makeGlobalGridBox(this->grid_ptr, &this->m_actnum, &this->m_active_index);
 
@@ -2266,6 +2324,36 @@ void FieldProps::handle_schedule_keywords(const std::vector<DeckKeyword>& keywor
             continue;
         }
     }
+
+    // The multipliers are applied on top of the current transmissibilities,
+    // so only cells with a multiplier different from one are affected.
+    std::vector<bool> updated(this->active_size, false);
+    for (const auto& [kw, _] : Fieldprops::keywords::SCHEDULE::double_keywords) {
+        (void)_;
+        if (! this->has<double>(kw)) {
+            continue;
+        }
+
+        const auto& mult = this->init_get<double>(kw).data;
+        for (std::size_t i = 0; i < this->active_size; ++i) {
+            if (mult[i] != 1.0) {
+                updated[i] = true;
+            }
+        }
+    }
+
+    std::vector<std::size_t> updated_cells;
+    std::size_t i = 0;
+    for (std::size_t g = 0; g < this->global_size; ++g) {
+        if (this->m_actnum[g]) {
+            if (updated[i]) {
+                updated_cells.push_back(g);
+            }
+            ++i;
+        }
+    }
+
+    return updated_cells;
 }
 
 const std::string& FieldProps::default_region() const
@@ -2275,6 +2363,11 @@ const std::string& FieldProps::default_region() const
 
 void FieldProps::apply_tran(const std::string& keyword, std::vector<double>& data)
 {
+    for (const auto& action : this->tran.at(keyword)) {
+        if (auto iter = this->double_data.find(action.field); iter != this->double_data.end())
+            iter->second.expand();
+    }
+
     ::Opm::apply_tran(this->tran, this->double_data, this->active_size, keyword, data);
 }
 
@@ -2342,6 +2435,33 @@ void FieldProps::set_active_indices(const std::vector<int>& indices)
     }
 }
 
+MemoryUsage::Node FieldProps::memoryUsage(MemoryUsage& usage) const
+{
+    const auto before = usage.heapBytes();
+
+    auto node = MemoryUsage::Node { "FieldProps" };
+    node.children.push_back({ "int_data", sizeof(this->int_data) + fieldDataHeap(usage, this->int_data), {} });
+    node.children.push_back({ "double_data", sizeof(this->double_data) + fieldDataHeap(usage, this->double_data), {} });
+    node.children.push_back(usage.node("tran", this->tran));
+    node.children.push_back(usage.node("TableManager", this->tables));
+
+    usage(this->unit_system);
+    usage(this->m_actnum);
+    usage(this->m_active_index);
+    usage(this->cell_volume);
+    usage(this->cell_depth);
+    usage(this->m_default_region);
+    usage(this->m_rtep);
+    usage(this->m_rfunc);
+    usage(this->multregp);
+    usage(this->fipreg_shortname_translation);
+    usage(this->multiplier_kw_infos_);
+
+    node.bytes = sizeof(*this) + (usage.heapBytes() - before);
+
+    return node;
+}
+
 template std::vector<bool> FieldProps::defaulted<int>(const std::string& keyword);
 template std::vector<bool> FieldProps::defaulted<double>(const std::string& keyword);
 }
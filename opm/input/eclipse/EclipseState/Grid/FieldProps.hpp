@@ -19,6 +19,7 @@
 #ifndef FIELDPROPS_HPP
 #define FIELDPROPS_HPP
 
+#include <opm/common/utility/MemoryUsage.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
@@ -694,7 +695,12 @@ public:
         return this->double_data.size();
     }
 
-    void handle_schedule_keywords(const std::vector<DeckKeyword>& keywords);
+    /// Apply the transmissibility multipliers of a report step, see
+    /// FieldPropsManager::apply_schedule_keywords().
+    ///
+    /// \return Global indices, in increasing order, of the active cells
+    /// with at least one multiplier different from one.
+    std::vector<std::size_t> handle_schedule_keywords(const std::vector<DeckKeyword>& keywords);
     bool tran_active(const std::string& keyword) const;
     void apply_tran(const std::string& keyword, std::vector<double>& data);
     void apply_tranz_global(const std::vector<size_t>& indices, std::vector<double>& data) const;
@@ -712,6 +718,8 @@ public:
 
     void set_active_indices(const std::vector<int>& indices);
 
+    MemoryUsage::Node memoryUsage(MemoryUsage& usage) const;
+
 private:
     void processMULTREGP(const Deck& deck);
     void scanGRIDSection(const GRIDSection& grid_section);
@@ -796,6 +804,11 @@ private:
                             const Box& box);
 
     void init_satfunc(const std::string& keyword, Fieldprops::FieldData<double>& satfunc);
+
+    // Release the arrays of all uniform properties, see
+    // FieldData::compact().  Accessors go through init_get(), which
+    // expands them again.
+    void compact_arrays();
     void init_porv(Fieldprops::FieldData<double>& porv);
     void init_tempi(Fieldprops::FieldData<double>& tempi);
 
@@ -827,6 +840,7 @@ private:
     const EclipseGrid * grid_ptr;      // A bit undecided whether to properly use the grid or not ...
     TableManager tables;
     std::optional<satfunc::RawTableEndPoints> m_rtep;
+    std::optional<satfunc::RawFunctionValues> m_rfunc;
     std::vector<MultregpRecord> multregp;
     std::unordered_map<std::string, Fieldprops::FieldData<int>> int_data;
     std::unordered_map<std::string, Fieldprops::FieldData<double>> double_data;
@@ -53,8 +53,9 @@ bool FieldPropsManager::is_usable() const
     return static_cast<bool>(this->fp);
 }
 
-void FieldPropsManager::apply_schedule_keywords(const std::vector<DeckKeyword>& keywords) {
-    this->fp->handle_schedule_keywords(keywords);
+std::vector<std::size_t>
+FieldPropsManager::apply_schedule_keywords(const std::vector<DeckKeyword>& keywords) {
+    return this->fp->handle_schedule_keywords(keywords);
 }
 
 
@@ -190,6 +191,18 @@ void FieldPropsManager::set_active_indices(const std::vector<int>& indices)
     fp->set_active_indices(indices);
 }
 
+MemoryUsage::Node FieldPropsManager::memoryUsage(MemoryUsage& usage) const
+{
+    if (!this->fp) {
+        return { "FieldProps", sizeof(*this), {} };
+    }
+
+    auto node = this->fp->memoryUsage(usage);
+    node.bytes += sizeof(*this);
+
+    return node;
+}
+
 void apply_action(const Fieldprops::ScalarOperation& op,
                   const std::vector<double>& action_data,
                   std::vector<double>& data,
@@ -19,6 +19,9 @@
 #ifndef FIELDPROPS_MANAGER_HPP
 #define FIELDPROPS_MANAGER_HPP
 
+#include <opm/common/utility/MemoryUsage.hpp>
+
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -57,7 +60,14 @@ public:
     virtual std::vector<double> porv(bool global = false) const;
 
 
-    void apply_schedule_keywords(const std::vector<DeckKeyword>& keywords);
+    /// Apply the MULTX, MULTX-, ..., MULTZ- keywords of a report step.
+    ///
+    /// The multipliers are reset to one before the keywords are applied.
+    ///
+    /// \return Global indices, in increasing order, of the active cells
+    /// with at least one multiplier different from one, i.e., the cells
+    /// whose transmissibilities must be recomputed.
+    std::vector<std::size_t> apply_schedule_keywords(const std::vector<DeckKeyword>& keywords);
 
     /// \brief Whether we can call methods on the manager
     bool is_usable() const;
@@ -253,6 +263,11 @@ public:
 
     void set_active_indices(const std::vector<int>& indices);
 
+    /// Memory of the property container, broken down into the integer
+    /// and floating point properties, the transmissibility multipliers
+    /// and the tables.  See MemoryUsage.
+    MemoryUsage::Node memoryUsage(MemoryUsage& usage) const;
+
 private:
     /*
       Return the keyword values as a std::vector<>. All elements in the return
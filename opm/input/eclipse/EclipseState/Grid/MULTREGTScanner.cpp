@@ -154,6 +154,8 @@ namespace Opm {
 
         this->template fillSearchMap<0>(m_records);
         this->template fillSearchMap<1>(m_records_same);
+
+        this->buildLookup();
     }
 
     template<int index>
@@ -191,6 +193,81 @@ namespace Opm {
         }
     }
 
+    // The dense tables hold (max region ID + 1)^2 entries per region set,
+    // which is small for the usual FLUXNUM, MULTNUM and OPERNUM arrays.
+    // Region sets with larger or negative IDs use the search maps.
+    void MULTREGTScanner::buildLookup()
+    {
+        constexpr std::size_t max_dense_size = std::size_t{1} << 22;
+
+        this->m_lookup.clear();
+
+        for (const auto& [regName, regMaps] : this->m_searchMap) {
+            const auto regionPos = this->regions.find(regName);
+            if (regionPos == this->regions.end()) {
+                continue;
+            }
+
+            auto& lookup = this->m_lookup.emplace_back();
+            lookup.maps = &regMaps;
+            lookup.region = &regionPos->second;
+
+            const auto& region_data = regionPos->second;
+            if (region_data.empty()) {
+                continue;
+            }
+
+            const auto [minId, maxId] = std::minmax_element(region_data.begin(), region_data.end());
+            const auto num_ids = static_cast<std::size_t>(*maxId) + 1;
+            if ((*minId < 0) || (num_ids * num_ids > max_dense_size)) {
+                continue;
+            }
+
+            lookup.num_ids = num_ids;
+            lookup.different.assign(num_ids * num_ids, -1);
+            lookup.same.assign(num_ids, -1);
+
+            for (const auto& [regPair, recordIx] : std::get<0>(regMaps)) {
+                const auto& [id1, id2] = regPair;
+                if ((id1 >= 0) && (static_cast<std::size_t>(id2) < num_ids)) {
+                    lookup.different[id1*num_ids + id2] = static_cast<int>(recordIx);
+                }
+            }
+
+            for (const auto& [regPair, recordIx] : std::get<1>(regMaps)) {
+                const auto id = regPair.first;
+                if ((id >= 0) && (static_cast<std::size_t>(id) < num_ids)) {
+                    lookup.same[id] = static_cast<int>(recordIx);
+                }
+            }
+        }
+    }
+
+    int MULTREGTScanner::RegionLookup::findDifferent(const int regionId1,
+                                                     const int regionId2) const
+    {
+        if (this->num_ids > 0) {
+            return this->different[regionId1*this->num_ids + regionId2];
+        }
+
+        const auto& myMap = std::get<0>(*this->maps);
+        const auto regPairPos = myMap.find({ regionId1, regionId2 });
+
+        return (regPairPos == myMap.end()) ? -1 : static_cast<int>(regPairPos->second);
+    }
+
+    int MULTREGTScanner::RegionLookup::findSame(const int regionId) const
+    {
+        if (this->num_ids > 0) {
+            return this->same[regionId];
+        }
+
+        const auto& myMap = std::get<1>(*this->maps);
+        const auto regPairPos = myMap.find({ regionId, regionId });
+
+        return (regPairPos == myMap.end()) ? -1 : static_cast<int>(regPairPos->second);
+    }
+
     MULTREGTScanner::MULTREGTScanner(const MULTREGTScanner& rhs)
     {
         *this = rhs;
@@ -237,6 +314,8 @@ namespace Opm {
         this->regions = data.regions;
         this->aquifer_cells = data.aquifer_cells;
 
+        this->buildLookup();
+
         return *this;
     }
 
@@ -281,20 +360,13 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_lookup.empty()) {
             return multiplier;
         }
 
-        auto regPairFoundDifferent = [faceDir, this](const auto& regMap, const auto& regPairPos)
-        {
-            return (regPairPos != regMap.end())
-                && ((this->m_records[regPairPos->second].directions & faceDir) != 0);
-        };
-
-        auto regPairFoundSame = [faceDir, this](const auto& regMap, const auto& regPairPos)
+        auto regPairFound = [faceDir](const MULTREGTRecord& record)
         {
-            return (regPairPos != regMap.end())
-                && ((this->m_records_same[regPairPos->second].directions & faceDir) != 0);
+            return (record.directions & faceDir) != 0;
         };
 
         auto ignoreMultiplierRecord =
@@ -314,8 +386,8 @@ namespace Opm {
         };
 
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+        for (const auto& lookup : this->m_lookup) {
+            const auto& region_data = *lookup.region;
 
             auto regionId1 = region_data[globalIndex1];
             auto regionId2 = region_data[globalIndex2];
@@ -330,22 +402,22 @@ namespace Opm {
                 ! ignoreMultiplierRecord(record.nnc_behaviour);
             };
 
-            multiplier = this->template applyMultiplierDifferentRegion(regMaps,
+            multiplier = this->template applyMultiplierDifferentRegion(lookup,
                                                                        multiplier,
                                                                        regionId1,
                                                                        regionId2,
                                                                        applyMultiplier,
-                                                                       regPairFoundDifferent);
+                                                                       regPairFound);
             // same region. Note that a pair where both region indices are the same is special.
             // For connections between it and all other regions the multipliers
             // will not override otherwise explicitly specified (as pairs with
             // different ids) multipliers, but accumulated to these.
-            multiplier = this->template applyMultiplierSameRegion(regMaps,
+            multiplier = this->template applyMultiplierSameRegion(lookup,
                                                                   multiplier,
                                                                   regionId1,
                                                                   regionId2,
                                                                   applyMultiplier,
-                                                                  regPairFoundSame);
+                                                                  regPairFound);
         }
 
         return multiplier;
@@ -360,7 +432,7 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_lookup.empty()) {
             return multiplier;
         }
 
@@ -372,8 +444,8 @@ namespace Opm {
                 || (is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
         };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+        for (const auto& lookup : this->m_lookup) {
+            const auto& region_data = *lookup.region;
 
             auto regionId1 = region_data[globalCellIdx1];
             auto regionId2 = region_data[globalCellIdx2];
@@ -386,13 +458,13 @@ namespace Opm {
                 return ! ignoreMultiplierRecord(record.nnc_behaviour);
             };
 
-            const auto regPairFound = [](const auto& regMap, const auto& regPairPos)
+            const auto regPairFound = [](const MULTREGTRecord&)
             {
                 // all entries match no matter what FaceDir says.
-                return (regPairPos != regMap.end());
+                return true;
             };
 
-            multiplier = this->template applyMultiplierSameRegion(regMaps,
+            multiplier = this->template applyMultiplierSameRegion(lookup,
                                                                   multiplier,
                                                                   regionId1,
                                                                   regionId2,
@@ -402,7 +474,7 @@ namespace Opm {
             // For connections between it and all other regions the multipliers
             // will not override otherwise explicitly specified (as pairs with
             // different ids) multipliers, but accumulated to these.
-            multiplier = this->template applyMultiplierDifferentRegion(regMaps,
+            multiplier = this->template applyMultiplierDifferentRegion(lookup,
                                                                        multiplier,
                                                                        regionId1,
                                                                        regionId2,
@@ -413,24 +485,51 @@ namespace Opm {
         return multiplier;
     }
 
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliers(const std::vector<std::size_t>&      globalCellIdx1,
+                                          const std::vector<std::size_t>&      globalCellIdx2,
+                                          const std::vector<FaceDir::DirEnum>& faceDir) const
+    {
+        const auto num_conn = globalCellIdx1.size();
+
+        if ((globalCellIdx2.size() != num_conn) || (faceDir.size() != num_conn)) {
+            throw std::invalid_argument {
+                "getRegionMultipliers() requires cell and "
+                "direction lists of the same size"
+            };
+        }
+
+        std::vector<double> multipliers(num_conn, 1.0);
+        if (this->m_lookup.empty()) {
+            return multipliers;
+        }
+
+#pragma omp parallel for schedule(static)
+        for (std::size_t i = 0; i < num_conn; ++i) {
+            multipliers[i] = this->getRegionMultiplier(globalCellIdx1[i],
+                                                       globalCellIdx2[i],
+                                                       faceDir[i]);
+        }
+
+        return multipliers;
+    }
+
     template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+    double MULTREGTScanner::applyMultiplierDifferentRegion(const RegionLookup& lookup,
                                                            double multiplier,
                                                            std::size_t regionId1,
                                                            std::size_t regionId2,
                                                            const ApplyDecision& applyMultiplier,
                                                            const RegPairFound& regPairFound) const
     {
-        const auto& myMap = std::get<0>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
-        regPairPos = myMap.find({ regionId1, regionId2 });
+        const auto recordIx = lookup.findDifferent(static_cast<int>(regionId1),
+                                                   static_cast<int>(regionId2));
 
-        if (!regPairFound(myMap, regPairPos)) {
+        if ((recordIx < 0) || !regPairFound(this->m_records[recordIx])) {
             // Pair not found.
             return multiplier;
         }
-        const auto& record = this->m_records[regPairPos->second];
+        const auto& record = this->m_records[recordIx];
 
         if (applyMultiplier(record)) {
             multiplier *= record.trans_mult;
@@ -441,22 +540,19 @@ namespace Opm {
 
 
     template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+    double MULTREGTScanner::applyMultiplierSameRegion(const RegionLookup& lookup,
                                                       double multiplier,
                                                       std::size_t regionId1,
                                                       std::size_t regionId2,
                                                       const ApplyDecision& applyMultiplier,
                                                       const RegPairFound& regPairFound) const
     {
-        const auto& myMap = std::get<1>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
         // search for entry where the two region ids are the same
         // where one of those is a region of ours.
-        regPairPos = myMap.find({ regionId1, regionId1 });
+        auto recordIx = lookup.findSame(static_cast<int>(regionId1));
 
-        if (regPairFound(myMap, regPairPos)) {
-            const auto& record = this->m_records_same[regPairPos->second];
+        if ((recordIx >= 0) && regPairFound(this->m_records_same[recordIx])) {
+            const auto& record = this->m_records_same[recordIx];
 
             if (applyMultiplier(record)) {
                 multiplier *= record.trans_mult;
@@ -465,10 +561,10 @@ namespace Opm {
         if (regionId1 != regionId2)
         {
             // also try to apply other region multiplier.
-            regPairPos = myMap.find({ regionId2, regionId2 });
+            recordIx = lookup.findSame(static_cast<int>(regionId2));
 
-            if (regPairFound(myMap, regPairPos)) {
-                const auto& record = this->m_records_same[regPairPos->second];
+            if ((recordIx >= 0) && regPairFound(this->m_records_same[recordIx])) {
+                const auto& record = this->m_records_same[recordIx];
 
                 if (applyMultiplier(record)) {
                     multiplier *= record.trans_mult;
@@ -109,6 +109,16 @@ namespace Opm {
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
+        /// Region multipliers of a list of connections.
+        ///
+        /// Equivalent to calling getRegionMultiplier() for each connection
+        /// (globalCellIdx1[i], globalCellIdx2[i], faceDir[i]), but the
+        /// connections are processed in parallel.
+        std::vector<double>
+        getRegionMultipliers(const std::vector<std::size_t>&      globalCellIdx1,
+                             const std::vector<std::size_t>&      globalCellIdx2,
+                             const std::vector<FaceDir::DirEnum>& faceDir) const;
+
         template <class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -120,6 +130,10 @@ namespace Opm {
 
             serializer(regions);
             serializer(aquifer_cells);
+
+            if (!serializer.isSerializing()) {
+                this->buildLookup();
+            }
         }
 
     private:
@@ -130,17 +144,40 @@ namespace Opm {
             std::vector<MULTREGTRecord>::size_type
         >;
 
+        /// \brief Precompiled form of the search maps of one region set.
+        ///
+        /// When the region IDs are small non-negative numbers the record
+        /// indices are stored in dense tables indexed by the region IDs,
+        /// otherwise the search maps are used.
+        struct RegionLookup
+        {
+            const std::array<MULTREGTSearchMap,2>* maps{nullptr};
+            const std::vector<int>* region{nullptr};
+
+            /// Number of region IDs covered by the dense tables, zero if
+            /// the search maps are used.
+            std::size_t num_ids{0};
+
+            /// Index into m_records, or -1, of the pair (id1, id2), id1 <
+            /// id2, at position id1*num_ids + id2.
+            std::vector<int> different{};
+
+            /// Index into m_records_same, or -1, of the pair (id, id).
+            std::vector<int> same{};
+
+            int findDifferent(int regionId1, int regionId2) const;
+            int findSame(int regionId) const;
+        };
+
         /// \brief Apply regionMultiplier from entries where source and target region differ
         ///
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
+        /// \param lookup the record lookup for the region name (FLUXNUM or else)
         /// \param regionId1 Id of egion for first cell
         /// \param regionId Id of regions for the second cell (not less than regionId1!)
         /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
+        /// \param regPairFound Functor to check whether a found record applies.
         template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+        double applyMultiplierDifferentRegion(const RegionLookup& lookup,
                                               double multiplier,
                                               std::size_t regionId1,
                                               std::size_t regionId2,
@@ -153,15 +190,13 @@ namespace Opm {
         /// For connections between it and all other regions the multipliers
         /// will not override otherwise explicitly specified (as pairs with
         /// different ids) multipliers, but accumulated to these.
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
+        /// \param lookup the record lookup for the region name (FLUXNUM or else)
         /// \param regionId1 Id of egion for first cell
         /// \param regionId Id of regions for the second cell (not less than regionId1!)
         /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
+        /// \param regPairFound Functor to check whether a found record applies.
         template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+        double applyMultiplierSameRegion(const RegionLookup& lookup,
                                          double multiplier,
                                          std::size_t regionId1,
                                          std::size_t regionId2,
@@ -170,6 +205,8 @@ namespace Opm {
         template<int index>
         void fillSearchMap(const std::vector<MULTREGTRecord>& records);
 
+        void buildLookup();
+
         GridDims gridDims{};
         const FieldPropsManager* fp{nullptr};
 
@@ -187,6 +224,9 @@ namespace Opm {
         std::map<std::string, std::vector<int>> regions{};
         std::vector<std::size_t> aquifer_cells{};
 
+        // Derived from m_searchMap and regions, in the order of m_searchMap.
+        std::vector<RegionLookup> m_lookup{};
+
         void addKeyword(const DeckKeyword& deckKeyword);
 
         bool isAquNNC(std::size_t globalCellIdx1, std::size_t globalCellIdx2) const;
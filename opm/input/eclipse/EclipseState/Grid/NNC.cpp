@@ -21,6 +21,8 @@
 #include <deque>
 #include <cstddef>
 #include <algorithm>
+#include <iterator>
+#include <utility>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
@@ -275,6 +277,25 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
         return true;
     }
 
+    void NNC::addNNC(const std::vector<NNCdata>& nncs) {
+        // addNNC() inserts each element in front of the existing elements
+        // for the same cell pair, so the new elements for a cell pair end
+        // up in reverse order, and before the old ones.
+        std::vector<NNCdata> added(nncs.rbegin(), nncs.rend());
+        for (auto& item : added) {
+            if (item.cell1 > item.cell2)
+                std::swap(item.cell1, item.cell2);
+        }
+        std::stable_sort(added.begin(), added.end());
+
+        std::vector<NNCdata> input;
+        input.reserve(this->m_input.size() + added.size());
+        std::merge(added.begin(), added.end(),
+                   this->m_input.begin(), this->m_input.end(),
+                   std::back_inserter(input));
+        this->m_input = std::move(input);
+    }
+
     void NNC::merge(const std::vector<NNCdata>& data) {
         auto old_size = m_input.size();
         m_input.insert(m_input.end(), data.begin(), data.end());
@@ -109,6 +109,13 @@ public:
 
     bool addNNC(const size_t cell1, const size_t cell2, const double trans);
 
+    /// \brief Add several NNCs
+    ///
+    /// Same result as calling addNNC() for each element of \p nncs in
+    /// turn, but sorts and merges in O(n log n) rather than inserting each
+    /// element into the sorted list.
+    void addNNC(const std::vector<NNCdata>& nncs);
+
     /// \brief Merge additional NNCs into sorted NNCs
     void merge(const std::vector<NNCdata>& nncs);
     /// \brief Get the combined information from NNC
@@ -65,6 +65,7 @@
 namespace {
 
     using ::Opm::satfunc::RawTableEndPoints;
+    using ::Opm::satfunc::RawFunctionValues;
 
     /*
      * See the "Saturation Functions" chapter in the Eclipse Technical
@@ -1427,28 +1428,15 @@ namespace {
         }
     }
 
-    double selectValue(const Opm::TableContainer& depthTables,
-                       int tableIdx,
-                       const std::string& columnName,
-                       double cellDepth,
-                       double fallbackValue,
-                       bool useOneMinusTableValue)
+    double selectValue(const double tableValue,
+                       const double fallbackValue,
+                       const bool   useOneMinusTableValue)
     {
-        if( tableIdx < 0 ) return fallbackValue;
-
-        const auto& table = depthTables.getTable( tableIdx );
-
-        if( tableIdx >= int( depthTables.size() ) )
-            throw std::invalid_argument("Not enough tables!");
-
-        // evaluate the table at the cell depth
-        const double value = table.evaluate( columnName, cellDepth );
-
         // a column can be fully defaulted. In this case, eval() returns a NaN
         // and we have to use the data from saturation tables
-        if( !std::isfinite( value ) ) return fallbackValue;
-        if( useOneMinusTableValue ) return 1 - value;
-        return value;
+        if( !std::isfinite( tableValue ) ) return fallbackValue;
+        if( useOneMinusTableValue ) return 1 - tableValue;
+        return tableValue;
     }
 
     void checkSatRegions(const std::size_t  cellIdx,
@@ -1467,45 +1455,86 @@ namespace {
     }
 
     std::vector<double>
-    satnumApply(size_t size,
-                const std::string& columnName,
+    regionApply(const std::string&          columnName,
                 const std::vector< double >& fallbackValues,
-                const Opm::TableManager& tableManager,
-                const std::vector<double>& cell_depth,
-                const std::vector<int>& satnum_data,
-                const std::vector<int>& endnum_data,
-                bool useOneMinusTableValue)
-    {
+                const bool                  useDepthTables,
+                const Opm::TableContainer&  depthTables,
+                const std::vector<double>&  cell_depth,
+                const std::vector<int>&     satreg_data,
+                const std::vector<int>&     endnum_data,
+                const bool                  useOneMinusTableValue,
+                const std::string&          satregname)
+    {
+        const auto size = cell_depth.size();
+
+        // Active cell better have {SAT,IMB,END}NUM > 0.  Validate all
+        // cells before the values are computed in parallel.
+        for (std::size_t cellIdx = 0; cellIdx < size; ++cellIdx) {
+            const int satTableIdx = satreg_data[cellIdx] - 1;
+            const int endNum = endnum_data[cellIdx] - 1;
+
+            checkSatRegions(cellIdx, satTableIdx, endNum, satregname);
+
+            if (useDepthTables && (endNum >= static_cast<int>(depthTables.size())))
+                throw std::invalid_argument("Not enough tables!");
+        }
+
         std::vector< double > values( size, 0 );
 
-        // Actually assign the defaults. If the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useEnptvd = tableManager.useEnptvd();
-        const auto& enptvdTables = tableManager.getEnptvdTables();
-        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int satTableIdx = satnum_data[cellIdx] - 1;
-            int endNum = endnum_data[cellIdx] - 1;
-
-            // Active cell better have {SAT,END}NUM > 0.
-            checkSatRegions(cellIdx, satTableIdx, endNum, "SATNUM");
-
-            values[cellIdx] = selectValue(enptvdTables,
-                                          (useEnptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallbackValues[ satTableIdx ],
+        if (! useDepthTables) {
+            for (std::size_t cellIdx = 0; cellIdx < size; ++cellIdx)
+                values[cellIdx] = fallbackValues[satreg_data[cellIdx] - 1];
+
+            return values;
+        }
+
+        // Look up the depth and value columns of each ENDNUM region's
+        // depth table once rather than once for every cell.
+        std::vector<const Opm::TableColumn*> depthColumns;
+        std::vector<const Opm::TableColumn*> valueColumns;
+        for (std::size_t tableIdx = 0; tableIdx < depthTables.size(); ++tableIdx) {
+            const auto& table = depthTables.getTable(tableIdx);
+            depthColumns.push_back(&table.getColumn(0));
+            valueColumns.push_back(&table.getColumn(columnName));
+
+            // lookup() only throws for malformed depth columns.  Probe
+            // each column once so no exception escapes the parallel loop.
+            static_cast<void>(depthColumns.back()->lookup(0.0));
+        }
+
+#pragma omp parallel for schedule(static)
+        for (std::size_t cellIdx = 0; cellIdx < size; ++cellIdx) {
+            const auto endNum = endnum_data[cellIdx] - 1;
+            const auto index = depthColumns[endNum]->lookup(cell_depth[cellIdx]);
+
+            values[cellIdx] = selectValue(valueColumns[endNum]->eval(index),
+                                          fallbackValues[satreg_data[cellIdx] - 1],
                                           useOneMinusTableValue);
         }
 
         return values;
     }
 
+    // Actually assign the defaults.  If the ENPTVD/IMPTVD keywords were
+    // specified in the deck, the endpoints are interpolated in the depth
+    // tables of the cell's ENDNUM region at the cell's depth.
     std::vector<double>
-    imbnumApply(size_t size,
-                const std::string& columnName,
+    satnumApply(const std::string& columnName,
+                const std::vector< double >& fallbackValues,
+                const Opm::TableManager& tableManager,
+                const std::vector<double>& cell_depth,
+                const std::vector<int>& satnum_data,
+                const std::vector<int>& endnum_data,
+                bool useOneMinusTableValue)
+    {
+        return regionApply(columnName, fallbackValues,
+                           tableManager.useEnptvd(), tableManager.getEnptvdTables(),
+                           cell_depth, satnum_data, endnum_data,
+                           useOneMinusTableValue, "SATNUM");
+    }
+
+    std::vector<double>
+    imbnumApply(const std::string& columnName,
                 const std::vector< double >& fallBackValues,
                 const Opm::TableManager& tableManager,
                 const std::vector<double>& cell_depth,
@@ -1513,42 +1542,22 @@ namespace {
                 const std::vector<int>& endnum_data,
                 bool useOneMinusTableValue )
     {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. if the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useImptvd = tableManager.useImptvd();
-        const Opm::TableContainer& imptvdTables = tableManager.getImptvdTables();
-        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int imbTableIdx = imbnum_data[ cellIdx ] - 1;
-            int endNum = endnum_data[ cellIdx ] - 1;
-
-            // Active cell better have {IMB,END}NUM > 0.
-            checkSatRegions(cellIdx, imbTableIdx, endNum, "IMBNUM");
-
-            values[cellIdx] = selectValue(imptvdTables,
-                                          (useImptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallBackValues[imbTableIdx],
-                                          useOneMinusTableValue);
-        }
-
-        return values;
+        return regionApply(columnName, fallBackValues,
+                           tableManager.useImptvd(), tableManager.getImptvdTables(),
+                           cell_depth, imbnum_data, endnum_data,
+                           useOneMinusTableValue, "IMBNUM");
     }
 
     std::vector<double>
     SGLEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         /* phases */,
                 const RawTableEndPoints&   ep,
+                const RawFunctionValues*   /* fval */,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SGCO", ep.connate.gas,
+        return satnumApply("SGCO", ep.connate.gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1556,11 +1565,12 @@ namespace {
     ISGLEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         /* phases */,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   /* fval */,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SGCO", ep.connate.gas,
+        return imbnumApply("SGCO", ep.connate.gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1568,11 +1578,12 @@ namespace {
     SGUEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         /* phases */,
                 const RawTableEndPoints&   ep,
+                const RawFunctionValues*   /* fval */,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SGMAX", ep.maximum.gas,
+        return satnumApply("SGMAX", ep.maximum.gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1580,11 +1591,12 @@ namespace {
     ISGUEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         /* phases */,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   /* fval */,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SGMAX", ep.maximum.gas,
+        return imbnumApply("SGMAX", ep.maximum.gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1592,11 +1604,12 @@ namespace {
     SWLEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         /* phases */,
                 const RawTableEndPoints&   ep,
+                const RawFunctionValues*   /* fval */,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SWCO", ep.connate.water,
+        return satnumApply("SWCO", ep.connate.water,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1604,11 +1617,12 @@ namespace {
     ISWLEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         /* phases */,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   /* fval */,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SWCO", ep.connate.water,
+        return imbnumApply("SWCO", ep.connate.water,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1616,11 +1630,12 @@ namespace {
     SWUEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         /* phases */,
                 const RawTableEndPoints&   ep,
+                const RawFunctionValues*   /* fval */,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SWMAX", ep.maximum.water,
+        return satnumApply("SWMAX", ep.maximum.water,
                            tableManager, cell_depth, satnum, endnum, true);
     }
 
@@ -1628,11 +1643,12 @@ namespace {
     ISWUEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         /* phases */,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   /* fval */,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SWMAX", ep.maximum.water,
+        return imbnumApply("SWMAX", ep.maximum.water,
                            tableManager, cell_depth, imbnum, endnum, true);
     }
 
@@ -1640,11 +1656,12 @@ namespace {
     SGCREndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         /* phases */,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   /* fval */,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    satnum,
                  const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SGCRIT", ep.critical.gas,
+        return satnumApply("SGCRIT", ep.critical.gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1652,11 +1669,12 @@ namespace {
     ISGCREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         /* phases */,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   /* fval */,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    imbnum,
                   const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SGCRIT", ep.critical.gas,
+        return imbnumApply("SGCRIT", ep.critical.gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1664,11 +1682,12 @@ namespace {
     SOWCREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         /* phases */,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   /* fval */,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    satnum,
                   const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SOWCRIT", ep.critical.oil_in_water,
+        return satnumApply("SOWCRIT", ep.critical.oil_in_water,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1676,11 +1695,12 @@ namespace {
     ISOWCREndpoint(const Opm::TableManager&   tableManager,
                    const Opm::Phases&         /* phases */,
                    const RawTableEndPoints&   ep,
+                   const RawFunctionValues*   /* fval */,
                    const std::vector<double>& cell_depth,
                    const std::vector<int>&    imbnum,
                    const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SOWCRIT", ep.critical.oil_in_water,
+        return imbnumApply("SOWCRIT", ep.critical.oil_in_water,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1688,11 +1708,12 @@ namespace {
     SOGCREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         /* phases */,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   /* fval */,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    satnum,
                   const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SOGCRIT", ep.critical.oil_in_gas,
+        return satnumApply("SOGCRIT", ep.critical.oil_in_gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1700,11 +1721,12 @@ namespace {
     ISOGCREndpoint(const Opm::TableManager&   tableManager,
                    const Opm::Phases&         /* phases */,
                    const RawTableEndPoints&   ep,
+                   const RawFunctionValues*   /* fval */,
                    const std::vector<double>& cell_depth,
                    const std::vector<int>&    imbnum,
                    const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SOGCRIT", ep.critical.oil_in_gas,
+        return imbnumApply("SOGCRIT", ep.critical.oil_in_gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1712,11 +1734,12 @@ namespace {
     SWCREndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         /* phases */,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   /* fval */,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    satnum,
                  const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SWCRIT", ep.critical.water,
+        return satnumApply("SWCRIT", ep.critical.water,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1724,11 +1747,12 @@ namespace {
     ISWCREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         /* phases */,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   /* fval */,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    imbnum,
                   const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SWCRIT", ep.critical.water,
+        return imbnumApply("SWCRIT", ep.critical.water,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1736,12 +1760,15 @@ namespace {
     PCWEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         phases,
                 const RawTableEndPoints&   /* ep */,
+                const RawFunctionValues*   fval,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        const auto max_pcow = findMaxPcow(tableManager, phases);
-        return satnumApply(cell_depth.size(), "PCW", max_pcow, tableManager,
+        const auto max_pcow = (fval != nullptr)
+            ? fval->pc.w
+            : findMaxPcow(tableManager, phases);
+        return satnumApply("PCW", max_pcow, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1749,12 +1776,15 @@ namespace {
     IPCWEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   /* ep */,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        const auto max_pcow = findMaxPcow(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IPCW", max_pcow, tableManager,
+        const auto max_pcow = (fval != nullptr)
+            ? fval->pc.w
+            : findMaxPcow(tableManager, phases);
+        return imbnumApply("IPCW", max_pcow, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1762,12 +1792,15 @@ namespace {
     PCGEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         phases,
                 const RawTableEndPoints&   /* ep */,
+                const RawFunctionValues*   fval,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    imbnum)
     {
-        const auto max_pcog = findMaxPcog(tableManager, phases);
-        return satnumApply(cell_depth.size(), "PCG", max_pcog, tableManager,
+        const auto max_pcog = (fval != nullptr)
+            ? fval->pc.g
+            : findMaxPcog(tableManager, phases);
+        return satnumApply("PCG", max_pcog, tableManager,
                            cell_depth, satnum, imbnum, false );
     }
 
@@ -1775,12 +1808,15 @@ namespace {
     IPCGEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   /* ep */,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        const auto max_pcog = findMaxPcog(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IPCG", max_pcog, tableManager,
+        const auto max_pcog = (fval != nullptr)
+            ? fval->pc.g
+            : findMaxPcog(tableManager, phases);
+        return imbnumApply("IPCG", max_pcog, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1788,12 +1824,15 @@ namespace {
     KRWEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         phases,
                 const RawTableEndPoints&   /* ep */,
+                const RawFunctionValues*   fval,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        const auto max_krw = findMaxKrw(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRW", max_krw, tableManager,
+        const auto max_krw = (fval != nullptr)
+            ? fval->krw.max
+            : findMaxKrw(tableManager, phases);
+        return satnumApply("KRW", max_krw, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1801,12 +1840,15 @@ namespace {
     IKRWEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   /* ep */,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        const auto max_krw = findMaxKrw(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRW", max_krw, tableManager,
+        const auto max_krw = (fval != nullptr)
+            ? fval->krw.max
+            : findMaxKrw(tableManager, phases);
+        return imbnumApply("IKRW", max_krw, tableManager,
                            cell_depth, imbnum, endnum, false );
     }
 
@@ -1814,12 +1856,15 @@ namespace {
     KRWREndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    satnum,
                  const std::vector<int>&    endnum)
     {
-        const auto krwr = findKrwr(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRWR", krwr, tableManager,
+        const auto krwr = (fval != nullptr)
+            ? fval->krw.r
+            : findKrwr(tableManager, phases, ep);
+        return satnumApply("KRWR", krwr, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1827,12 +1872,15 @@ namespace {
     IKRWREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   fval,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    imbnum,
                   const std::vector<int>&    endnum)
     {
-        const auto krwr = findKrwr(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRWR", krwr, tableManager,
+        const auto krwr = (fval != nullptr)
+            ? fval->krw.r
+            : findKrwr(tableManager, phases, ep);
+        return imbnumApply("IKRWR", krwr, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1840,12 +1888,15 @@ namespace {
     KROEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         phases,
                 const RawTableEndPoints&   /* ep */,
+                const RawFunctionValues*   fval,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        const auto max_kro = findMaxKro(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRO", max_kro, tableManager,
+        const auto max_kro = (fval != nullptr)
+            ? fval->kro.max
+            : findMaxKro(tableManager, phases);
+        return satnumApply("KRO", max_kro, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1853,12 +1904,15 @@ namespace {
     IKROEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   /* ep */,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        const auto max_kro = findMaxKro(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRO", max_kro, tableManager,
+        const auto max_kro = (fval != nullptr)
+            ? fval->kro.max
+            : findMaxKro(tableManager, phases);
+        return imbnumApply("IKRO", max_kro, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1866,12 +1920,15 @@ namespace {
     KRORWEndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   fval,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    satnum,
                   const std::vector<int>&    endnum)
     {
-        const auto krorw = findKrorw(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRORW", krorw, tableManager,
+        const auto krorw = (fval != nullptr)
+            ? fval->kro.rw
+            : findKrorw(tableManager, phases, ep);
+        return satnumApply("KRORW", krorw, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1879,12 +1936,15 @@ namespace {
     IKRORWEndpoint(const Opm::TableManager&   tableManager,
                    const Opm::Phases&         phases,
                    const RawTableEndPoints&   ep,
+                   const RawFunctionValues*   fval,
                    const std::vector<double>& cell_depth,
                    const std::vector<int>&    imbnum,
                    const std::vector<int>&    endnum)
     {
-        const auto krorw = findKrorw(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRORW", krorw, tableManager,
+        const auto krorw = (fval != nullptr)
+            ? fval->kro.rw
+            : findKrorw(tableManager, phases, ep);
+        return imbnumApply("IKRORW", krorw, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1892,12 +1952,15 @@ namespace {
     KRORGEndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   fval,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    satnum,
                   const std::vector<int>&    endnum)
     {
-        const auto krorg = findKrorg(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRORG", krorg, tableManager,
+        const auto krorg = (fval != nullptr)
+            ? fval->kro.rg
+            : findKrorg(tableManager, phases, ep);
+        return satnumApply("KRORG", krorg, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1905,12 +1968,15 @@ namespace {
     IKRORGEndpoint(const Opm::TableManager&   tableManager,
                    const Opm::Phases&         phases,
                    const RawTableEndPoints&   ep,
+                   const RawFunctionValues*   fval,
                    const std::vector<double>& cell_depth,
                    const std::vector<int>&    imbnum,
                    const std::vector<int>&    endnum)
     {
-        const auto krorg = findKrorg(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRORG", krorg, tableManager,
+        const auto krorg = (fval != nullptr)
+            ? fval->kro.rg
+            : findKrorg(tableManager, phases, ep);
+        return imbnumApply("IKRORG", krorg, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1918,12 +1984,15 @@ namespace {
     KRGEndpoint(const Opm::TableManager&   tableManager,
                 const Opm::Phases&         phases,
                 const RawTableEndPoints&   /* ep */,
+                const RawFunctionValues*   fval,
                 const std::vector<double>& cell_depth,
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        const auto max_krg = findMaxKrg(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRG", max_krg, tableManager,
+        const auto max_krg = (fval != nullptr)
+            ? fval->krg.max
+            : findMaxKrg(tableManager, phases);
+        return satnumApply("KRG", max_krg, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1931,12 +2000,15 @@ namespace {
     IKRGEndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   /* ep */,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        const auto max_krg = findMaxKrg(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRG", max_krg, tableManager,
+        const auto max_krg = (fval != nullptr)
+            ? fval->krg.max
+            : findMaxKrg(tableManager, phases);
+        return imbnumApply("IKRG", max_krg, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1944,12 +2016,15 @@ namespace {
     KRGREndpoint(const Opm::TableManager&   tableManager,
                  const Opm::Phases&         phases,
                  const RawTableEndPoints&   ep,
+                 const RawFunctionValues*   fval,
                  const std::vector<double>& cell_depth,
                  const std::vector<int>&    satnum,
                  const std::vector<int>&    endnum)
     {
-        const auto krgr = findKrgr(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRGR", krgr, tableManager,
+        const auto krgr = (fval != nullptr)
+            ? fval->krg.r
+            : findKrgr(tableManager, phases, ep);
+        return satnumApply("KRGR", krgr, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1957,12 +2032,15 @@ namespace {
     IKRGREndpoint(const Opm::TableManager&   tableManager,
                   const Opm::Phases&         phases,
                   const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   fval,
                   const std::vector<double>& cell_depth,
                   const std::vector<int>&    imbnum,
                   const std::vector<int>&    endnum)
     {
-        const auto krgr = findKrgr(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRGR", krgr, tableManager,
+        const auto krgr = (fval != nullptr)
+            ? fval->krg.r
+            : findKrgr(tableManager, phases, ep);
+        return imbnumApply("IKRGR", krgr, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 } // namespace Anonymous
@@ -2012,6 +2090,67 @@ Opm::satfunc::getRawFunctionValues(const Opm::TableManager& tm,
     return fval;
 }
 
+namespace {
+
+    std::vector<double>
+    initEndpoints(const std::string&         keyword,
+                  const Opm::TableManager&   tables,
+                  const Opm::Phases&         phases,
+                  const RawTableEndPoints&   ep,
+                  const RawFunctionValues*   fval,
+                  const std::vector<double>& cell_depth,
+                  const std::vector<int>&    num,
+                  const std::vector<int>&    endnum)
+    {
+        using func_type = decltype(&IKRGEndpoint);
+
+#define dirfunc(base, func) \
+        {base, func}, \
+        {base "X", func}, {base "X-", func},  \
+        {base "Y", func}, {base "Y-", func},  \
+        {base "Z", func}, {base "Z-", func}
+
+        static const std::map<std::string, func_type> func_table = {
+            // Drainage                      Imbibition
+            {"SGLPC", SGLEndpoint},          {"ISGLPC", ISGLEndpoint},
+            {"SWLPC", SWLEndpoint},          {"ISWLPC", ISWLEndpoint},
+
+            dirfunc("SGL",   SGLEndpoint),   dirfunc("ISGL",   ISGLEndpoint),
+            dirfunc("SGU",   SGUEndpoint),   dirfunc("ISGU",   ISGUEndpoint),
+            dirfunc("SWL",   SWLEndpoint),   dirfunc("ISWL",   ISWLEndpoint),
+            dirfunc("SWU",   SWUEndpoint),   dirfunc("ISWU",   ISWUEndpoint),
+
+            dirfunc("SGCR",  SGCREndpoint),  dirfunc("ISGCR",  ISGCREndpoint),
+            dirfunc("SOGCR", SOGCREndpoint), dirfunc("ISOGCR", ISOGCREndpoint),
+            dirfunc("SOWCR", SOWCREndpoint), dirfunc("ISOWCR", ISOWCREndpoint),
+            dirfunc("SWCR",  SWCREndpoint),  dirfunc("ISWCR",  ISWCREndpoint),
+
+            {"PCG", PCGEndpoint},            {"IPCG", IPCGEndpoint},
+            {"PCW", PCWEndpoint},            {"IPCW", IPCWEndpoint},
+
+            dirfunc("KRG",   KRGEndpoint),   dirfunc("IKRG",   IKRGEndpoint),
+            dirfunc("KRGR",  KRGREndpoint),  dirfunc("IKRGR",  IKRGREndpoint),
+            dirfunc("KRO",   KROEndpoint),   dirfunc("IKRO",   IKROEndpoint),
+            dirfunc("KRORW", KRORWEndpoint), dirfunc("IKRORW", IKRORWEndpoint),
+            dirfunc("KRORG", KRORGEndpoint), dirfunc("IKRORG", IKRORGEndpoint),
+            dirfunc("KRW",   KRWEndpoint),   dirfunc("IKRW",   IKRWEndpoint),
+            dirfunc("KRWR",  KRWREndpoint),  dirfunc("IKRWR",  IKRWREndpoint),
+        };
+
+#undef dirfunc
+
+        auto func = func_table.find(keyword);
+        if (func == func_table.end())
+            throw std::invalid_argument {
+                "Unsupported saturation function scaling '"
+                + keyword + '\''
+            };
+
+        return func->second(tables, phases, ep, fval, cell_depth, num, endnum);
+    }
+
+} // namespace Anonymous
+
 std::vector<double>
 Opm::satfunc::init(const std::string&         keyword,
                    const TableManager&        tables,
@@ -2021,49 +2160,20 @@ Opm::satfunc::init(const std::string&         keyword,
                    const std::vector<int>&    num,
                    const std::vector<int>&    endnum)
 {
-    using func_type = decltype(&IKRGEndpoint);
-
-#define dirfunc(base, func) \
-    {base, func}, \
-    {base "X", func}, {base "X-", func},  \
-    {base "Y", func}, {base "Y-", func},  \
-    {base "Z", func}, {base "Z-", func}
-
-    static const std::map<std::string, func_type> func_table = {
-        // Drainage                      Imbibition
-        {"SGLPC", SGLEndpoint},          {"ISGLPC", ISGLEndpoint},
-        {"SWLPC", SWLEndpoint},          {"ISWLPC", ISWLEndpoint},
-
-        dirfunc("SGL",   SGLEndpoint),   dirfunc("ISGL",   ISGLEndpoint),
-        dirfunc("SGU",   SGUEndpoint),   dirfunc("ISGU",   ISGUEndpoint),
-        dirfunc("SWL",   SWLEndpoint),   dirfunc("ISWL",   ISWLEndpoint),
-        dirfunc("SWU",   SWUEndpoint),   dirfunc("ISWU",   ISWUEndpoint),
-
-        dirfunc("SGCR",  SGCREndpoint),  dirfunc("ISGCR",  ISGCREndpoint),
-        dirfunc("SOGCR", SOGCREndpoint), dirfunc("ISOGCR", ISOGCREndpoint),
-        dirfunc("SOWCR", SOWCREndpoint), dirfunc("ISOWCR", ISOWCREndpoint),
-        dirfunc("SWCR",  SWCREndpoint),  dirfunc("ISWCR",  ISWCREndpoint),
-
-        {"PCG", PCGEndpoint},            {"IPCG", IPCGEndpoint},
-        {"PCW", PCWEndpoint},            {"IPCW", IPCWEndpoint},
-
-        dirfunc("KRG",   KRGEndpoint),   dirfunc("IKRG",   IKRGEndpoint),
-        dirfunc("KRGR",  KRGREndpoint),  dirfunc("IKRGR",  IKRGREndpoint),
-        dirfunc("KRO",   KROEndpoint),   dirfunc("IKRO",   IKROEndpoint),
-        dirfunc("KRORW", KRORWEndpoint), dirfunc("IKRORW", IKRORWEndpoint),
-        dirfunc("KRORG", KRORGEndpoint), dirfunc("IKRORG", IKRORGEndpoint),
-        dirfunc("KRW",   KRWEndpoint),   dirfunc("IKRW",   IKRWEndpoint),
-        dirfunc("KRWR",  KRWREndpoint),  dirfunc("IKRWR",  IKRWREndpoint),
-    };
-
-#undef dirfunc
-
-    auto func = func_table.find(keyword);
-    if (func == func_table.end())
-        throw std::invalid_argument {
-            "Unsupported saturation function scaling '"
-            + keyword + '\''
-        };
+    return initEndpoints(keyword, tables, phases, ep, nullptr,
+                         cell_depth, num, endnum);
+}
 
-    return func->second(tables, phases, ep, cell_depth, num, endnum);
+std::vector<double>
+Opm::satfunc::init(const std::string&         keyword,
+                   const TableManager&        tables,
+                   const Phases&              phases,
+                   const RawTableEndPoints&   ep,
+                   const RawFunctionValues&   fval,
+                   const std::vector<double>& cell_depth,
+                   const std::vector<int>&    num,
+                   const std::vector<int>&    endnum)
+{
+    return initEndpoints(keyword, tables, phases, ep, &fval,
+                         cell_depth, num, endnum);
 }
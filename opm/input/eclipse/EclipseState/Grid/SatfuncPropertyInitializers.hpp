@@ -169,6 +169,19 @@ namespace Opm { namespace satfunc {
                              const std::vector<int>& num,
                              const std::vector<int>& endnum);
 
+    /// Same as the above, but uses the precomputed per-region function
+    /// values \p fval from getRawFunctionValues() for the KR* and PC*
+    /// keywords instead of rescanning the saturation function tables for
+    /// each keyword.
+    std::vector<double> init(const std::string& keyword,
+                             const TableManager& tables,
+                             const Phases& phases,
+                             const RawTableEndPoints& ep,
+                             const RawFunctionValues& fval,
+                             const std::vector<double>& cell_depth,
+                             const std::vector<int>& num,
+                             const std::vector<int>& endnum);
+
 }} // namespace Opm::satfunc
 
 #endif // ECLIPSE_SATFUNCPROPERTY_INITIALIZERS_HPP
@@ -17,7 +17,11 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cstddef>
+#include <map>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -121,6 +125,12 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplierNNC(globalCellIndex1, globalCellIndex2);
     }
 
+    std::vector<double> TransMult::getRegionMultipliers(const std::vector<std::size_t>& globalCellIndex1,
+                                                        const std::vector<std::size_t>& globalCellIndex2,
+                                                        const std::vector<FaceDir::DirEnum>& faceDir) const {
+        return m_multregtScanner.getRegionMultipliers(globalCellIndex1, globalCellIndex2, faceDir);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -157,9 +167,31 @@ namespace Opm {
 
 
     void TransMult::applyMULTFLT(const FaultCollection& faults) {
+        // The faces of each direction update their own multiplier array,
+        // so the directions are processed in parallel.  Within a direction
+        // the faces are applied in fault order as before.
+        using FaceList = std::vector<std::pair<const FaultFace*, double>>;
+
+        std::map<FaceDir::DirEnum, FaceList> dir_faces;
         for (size_t faultIndex = 0; faultIndex < faults.size(); faultIndex++) {
-            auto& fault = faults.getFault(faultIndex);
-            this->applyMULTFLT(fault);
+            const auto& fault = faults.getFault(faultIndex);
+            for (const auto& face : fault)
+                dir_faces[face.getDir()].emplace_back(&face, fault.getTransMult());
+        }
+
+        // getDirectionProperty() may insert into m_trans, so the arrays
+        // are looked up before the parallel region.
+        std::vector<std::pair<std::vector<double>*, const FaceList*>> dir_work;
+        for (const auto& [faceDir, faces] : dir_faces)
+            dir_work.emplace_back(&this->getDirectionProperty(faceDir), &faces);
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::size_t d = 0; d < dir_work.size(); ++d) {
+            auto& multProperty = *dir_work[d].first;
+            for (const auto& [face, transMult] : *dir_work[d].second) {
+                for (auto globalIndex : *face)
+                    multProperty[globalIndex] *= transMult;
+            }
         }
     }
 
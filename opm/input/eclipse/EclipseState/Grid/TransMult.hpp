@@ -61,6 +61,9 @@ namespace Opm {
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplierNNC(std::size_t globalCellIndex1, std::size_t globalCellIndex2) const;
+        std::vector<double> getRegionMultipliers(const std::vector<std::size_t>& globalCellIndex1,
+                                                 const std::vector<std::size_t>& globalCellIndex2,
+                                                 const std::vector<FaceDir::DirEnum>& faceDir) const;
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
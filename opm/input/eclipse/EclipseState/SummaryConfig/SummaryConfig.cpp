@@ -53,6 +53,8 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <regex>
@@ -585,6 +587,36 @@ void keywordAquifer( SummaryConfig::keyword_list& list,
 }
 
 
+// Expand summary nodes for each of a list of wells.  Wildcard requests
+// such as CWPR '*' with thousands of wells are expanded in parallel into
+// per-well lists which are then concatenated in well order.  The
+// expansion function must not report errors.
+template <typename ExpandWell>
+void expandWells(SummaryConfig::keyword_list&    list,
+                 const std::vector<std::string>& well_names,
+                 ExpandWell&&                    expand)
+{
+    constexpr auto min_parallel_wells = std::size_t{64};
+
+    const auto numWells = static_cast<std::int64_t>(well_names.size());
+    auto perWell = std::vector<SummaryConfig::keyword_list>(well_names.size());
+
+#pragma omp parallel for schedule(dynamic) if(well_names.size() >= min_parallel_wells)
+    for (std::int64_t w = 0; w < numWells; ++w) {
+        expand(well_names[w], perWell[w]);
+    }
+
+    auto total = list.size();
+    for (const auto& nodes : perWell) {
+        total += nodes.size();
+    }
+
+    list.reserve(total);
+    for (auto& nodes : perWell) {
+        std::move(nodes.begin(), nodes.end(), std::back_inserter(list));
+    }
+}
+
 inline std::array< int, 3 > getijk( const DeckRecord& record ) {
     return {{
         record.getItem( "I" ).get< int >( 0 ) - 1,
@@ -616,32 +648,44 @@ inline void keywordCL(SummaryConfig::keyword_list& list,
         }
 
         const auto ijk_defaulted = record.getItem(1).defaultApplied(0);
-        for (const auto& wname : well_names) {
-            const auto& well = schedule.getWellatEnd(wname);
-            const auto& all_connections = well.getConnections();
+        if (ijk_defaulted) {
+            expandWells(list, well_names,
+                        [&node, &schedule](const std::string& wname,
+                                           SummaryConfig::keyword_list& wellNodes)
+            {
+                const auto& all_connections = schedule.getWellatEnd(wname).getConnections();
 
-            node.namedEntity(wname);
-            if (ijk_defaulted) {
+                auto wellNode = node;
+                wellNode.namedEntity(wname);
+
+                wellNodes.reserve(all_connections.size());
                 std::transform(all_connections.begin(), all_connections.end(),
-                               std::back_inserter(list),
-                               [&node](const auto& conn)
+                               std::back_inserter(wellNodes),
+                               [&wellNode](const auto& conn)
                                {
-                                    return node.number(1 + conn.global_index());
+                                    return wellNode.number(1 + conn.global_index());
                                });
+            });
+
+            continue;
+        }
+
+        const auto& ijk = getijk(record);
+        const auto global_index = dims.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
+
+        for (const auto& wname : well_names) {
+            const auto& all_connections = schedule.getWellatEnd(wname).getConnections();
+
+            node.namedEntity(wname);
+            if (all_connections.hasGlobalIndex(global_index)) {
+                const auto& conn = all_connections.getFromGlobalIndex(global_index);
+                list.push_back( node.number( 1 + conn.global_index()));
             } else {
-                const auto& ijk = getijk(record);
-                auto global_index = dims.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
-
-                if (all_connections.hasGlobalIndex(global_index)) {
-                    const auto& conn = all_connections.getFromGlobalIndex(global_index);
-                    list.push_back( node.number( 1 + conn.global_index()));
-                } else {
-                    std::string msg = fmt::format("Problem with keyword {{keyword}}\n"
-                                                  "In {{file}} line {{line}}\n"
-                                                  "Connection ({},{},{}) not defined for well {}",
-                                                  ijk[0] + 1, ijk[1] + 1, ijk[2] + 1, wname);
-                    parseContext.handleError( ParseContext::SUMMARY_UNHANDLED_KEYWORD, msg, keyword.location(), errors);
-                }
+                std::string msg = fmt::format("Problem with keyword {{keyword}}\n"
+                                              "In {{file}} line {{line}}\n"
+                                              "Connection ({},{},{}) not defined for well {}",
+                                              ijk[0] + 1, ijk[1] + 1, ijk[2] + 1, wname);
+                parseContext.handleError( ParseContext::SUMMARY_UNHANDLED_KEYWORD, msg, keyword.location(), errors);
             }
         }
     }
@@ -1163,8 +1207,16 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
         if( well_names.empty() )
             handleMissingWell( parseContext, errors, keyword.location(), wellitem.getTrimmedString( 0 ) );
 
-        for(const auto& name : well_names) {
-            param.namedEntity(name);
+        const auto ijk = ijk_defaulted
+            ? std::array<int, 3>{}
+            : getijk(record);
+
+        expandWells(list, well_names,
+                    [&param, &schedule, &dims, &ijk, ijk_defaulted]
+                    (const std::string& name, SummaryConfig::keyword_list& wellNodes)
+        {
+            auto wellParam = param;
+            wellParam.namedEntity(name);
             const auto& well = schedule.getWellatEnd(name);
             /*
              * we don't want to add connections that don't exist, so we iterate
@@ -1174,12 +1226,12 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
             for( const auto& connection : well.getConnections() ) {
                 auto cijk = getijk( connection );
 
-                if( ijk_defaulted || ( cijk == getijk(record) ) ) {
+                if( ijk_defaulted || ( cijk == ijk ) ) {
                     const int global_index = 1 + dims.getGlobalIndex(cijk[0], cijk[1], cijk[2]);
-                    list.push_back( param.number(global_index) );
+                    wellNodes.push_back( wellParam.number(global_index) );
                 }
             }
-        }
+        });
     }
 }
 
@@ -1268,9 +1320,12 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
 
         const auto segID = -1;
 
-        for (const auto& well : schedule.getWellsatEnd()) {
-            makeSegmentNodes(segID, keyword, well, list);
-        }
+        expandWells(list, schedule.wellNames(),
+                    [&keyword, &schedule](const std::string& well_name,
+                                          SummaryConfig::keyword_list& wellNodes)
+        {
+            makeSegmentNodes(segID, keyword, schedule.getWellatEnd(well_name), wellNodes);
+        });
     }
 
     void keywordSWithRecords(const ParseContext&          parseContext,
@@ -1544,10 +1599,87 @@ inline void handleKW( SummaryConfig::keyword_list& list,
 }
 
 
+  // Hash consistent with operator==(SummaryConfigNode, SummaryConfigNode).
+  struct NodeHash
+  {
+      const SummaryConfig::keyword_list& vec;
+
+      std::size_t operator()(const std::size_t i) const
+      {
+          using Cat = SummaryConfigNode::Category;
+
+          const auto& node = vec[i];
+          auto h = std::hash<std::string>{}(node.keyword());
+
+          auto combine = [&h](const std::size_t v)
+          {
+              h ^= v + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+          };
+
+          switch (node.category()) {
+          case Cat::Well: [[fallthrough]];
+          case Cat::Node: [[fallthrough]];
+          case Cat::Group:
+              combine(std::hash<std::string>{}(node.namedEntity()));
+              break;
+
+          case Cat::Aquifer: [[fallthrough]];
+          case Cat::Region: [[fallthrough]];
+          case Cat::Block:
+              combine(std::hash<int>{}(node.number()));
+              break;
+
+          case Cat::Connection: [[fallthrough]];
+          case Cat::Completion: [[fallthrough]];
+          case Cat::Segment:
+              combine(std::hash<std::string>{}(node.namedEntity()));
+              combine(std::hash<int>{}(node.number()));
+              break;
+
+          default:
+              break;
+          }
+
+          return h;
+      }
+  };
+
+  struct NodeEqual
+  {
+      const SummaryConfig::keyword_list& vec;
+
+      bool operator()(const std::size_t i, const std::size_t j) const
+      {
+          return vec[i] == vec[j];
+      }
+  };
+
   inline void uniq( SummaryConfig::keyword_list& vec ) {
+      // Remove duplicates through a hash set before sorting.  Wildcard
+      // expansions typically produce many duplicates, and sorting only
+      // the distinct nodes is much cheaper than sorting all of them.
+      {
+          auto seen = std::unordered_set<std::size_t, NodeHash, NodeEqual> {
+              vec.size(), NodeHash { vec }, NodeEqual { vec }
+          };
+
+          auto kept = std::size_t{0};
+          for (auto i = 0*vec.size(); i < vec.size(); ++i) {
+              if (seen.find(i) != seen.end()) {
+                  continue;
+              }
+
+              if (kept != i) {
+                  vec[kept] = std::move(vec[i]);
+              }
+
+              seen.insert(kept++);
+          }
+
+          vec.erase(vec.begin() + kept, vec.end());
+      }
+
       std::sort( vec.begin(), vec.end());
-      auto logical_end = std::unique( vec.begin(), vec.end() );
-      vec.erase( logical_end, vec.end() );
       if (vec.empty())
           return;
 
@@ -1626,7 +1758,7 @@ SummaryConfigNode::Category parseKeywordCategory(const std::string& keyword)
 SummaryConfigNode::SummaryConfigNode(std::string keyword, const Category cat, KeywordLocation loc_arg)
     : keyword_ (std::move(keyword))
     , category_(cat)
-    , loc      (std::move(loc_arg))
+    , loc      (std::make_shared<KeywordLocation>(std::move(loc_arg)))
 {}
 
 SummaryConfigNode SummaryConfigNode::serializationTestObject()
@@ -1634,7 +1766,7 @@ SummaryConfigNode SummaryConfigNode::serializationTestObject()
     SummaryConfigNode result;
     result.keyword_ = "test1";
     result.category_ = Category::Region;
-    result.loc = KeywordLocation::serializationTestObject();
+    result.loc = std::make_shared<KeywordLocation>(KeywordLocation::serializationTestObject());
     result.type_ = Type::Pressure;
     result.name_ = "test2";
     result.number_ = 2;
@@ -1643,6 +1775,13 @@ SummaryConfigNode SummaryConfigNode::serializationTestObject()
     return result;
 }
 
+const KeywordLocation& SummaryConfigNode::location() const
+{
+    static const auto unknown = KeywordLocation{};
+
+    return this->loc ? *this->loc : unknown;
+}
+
 SummaryConfigNode& SummaryConfigNode::fip_region(const std::string& fip_region)
 {
     this->fip_region_ = fip_region;
@@ -1834,10 +1973,21 @@ SummaryConfig::SummaryConfig( const Deck& deck,
         }
 
         uniq(this->m_keywords);
+
+        const auto numKeywords = static_cast<std::int64_t>(this->m_keywords.size());
+        auto uniqueKeys = std::vector<std::string>(this->m_keywords.size());
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t i = 0; i < numKeywords; ++i) {
+            uniqueKeys[i] = this->m_keywords[i].uniqueNodeKey();
+        }
+
         for (const auto& kw : this->m_keywords) {
             this->short_keywords.insert(kw.keyword());
-            this->summary_keywords.insert(kw.uniqueNodeKey());
         }
+
+        this->summary_keywords.insert(std::make_move_iterator(uniqueKeys.begin()),
+                                      std::make_move_iterator(uniqueKeys.end()));
     }
     catch (const OpmInputError& opm_error) {
         throw;
@@ -26,6 +26,7 @@
 
 #include <array>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -73,7 +74,7 @@ namespace Opm {
         const std::string& fip_region() const { return *this->fip_region_ ; }
 
         std::string uniqueNodeKey() const;
-        const KeywordLocation& location() const { return this->loc; }
+        const KeywordLocation& location() const;
 
         operator Opm::EclIO::SummaryNode() const {
             return { keyword_, category_, type_, name_, number_, fip_region_, {}};
@@ -95,7 +96,9 @@ namespace Opm {
     private:
         std::string keyword_{};
         Category    category_{};
-        KeywordLocation loc{};
+        // Shared by all copies of a node, e.g., all nodes expanded from
+        // the same SUMMARY keyword.
+        std::shared_ptr<KeywordLocation> loc{};
         Type        type_{ Type::Undefined };
         std::string name_{};
         int         number_{std::numeric_limits<int>::min()};
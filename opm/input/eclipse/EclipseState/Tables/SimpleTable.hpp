@@ -70,6 +70,10 @@ namespace Opm {
          */
         double evaluate(const std::string& columnName, double xPos) const;
 
+        /// Same as evaluate(columnName, xPos), without the lookup of the
+        /// column by name.
+        double evaluate(size_t columnIndex, double xPos) const;
+
         /// throws std::invalid_argument if jf != m_jfunc
         void assertJFuncPressure(const bool jf) const;
 
@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include <stdexcept>
 #include <algorithm>
+#include <functional>
 
 #include <opm/input/eclipse/EclipseState/Tables/ColumnSchema.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableColumn.hpp>
@@ -203,20 +204,29 @@ namespace Opm {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
 
-        if (argValue >= max()) {
-            const auto max_iter = std::max_element( m_values.begin() , m_values.end());
+        // The column is ordered, so its extreme values are at the ends and
+        // the first occurrence of each is found by bisection.
+        const bool isDescending = m_schema.isDecreasing( );
+        const double maxValue = isDescending ? m_values.front() : m_values.back();
+        const double minValue = isDescending ? m_values.back() : m_values.front();
+
+        if (argValue >= maxValue) {
+            const auto max_iter = isDescending
+                ? m_values.begin()
+                : std::lower_bound( m_values.begin() , m_values.end() , maxValue );
             const size_t max_index = max_iter - m_values.begin();
             return TableIndex( max_index , 1.0 );
         }
 
-        if (argValue <= min()) {
-            const auto min_iter = std::min_element( m_values.begin() , m_values.end());
+        if (argValue <= minValue) {
+            const auto min_iter = isDescending
+                ? std::lower_bound( m_values.begin() , m_values.end() , minValue , std::greater<>{} )
+                : m_values.begin();
             const size_t min_index = min_iter - m_values.begin();
             return TableIndex( min_index , 1.0 );
         }
 
         {
-            bool isDescending = m_schema.isDecreasing( );
             size_t lowIntervalIdx = 0;
             size_t intervalIdx = (size() - 1)/2;
             size_t highIntervalIdx = size() - 1;
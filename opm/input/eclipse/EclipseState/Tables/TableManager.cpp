@@ -20,11 +20,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <iomanip>
 #include <ios>
 #include <iterator>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -127,6 +129,73 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
     return JFunc(deck);
 }
 
+/*
+ * Add one table per record of tableKeyword to container.  An empty record
+ * repeats the table of the previous complete record.
+ *
+ * The tables of the complete records are independent, and are built
+ * concurrently once the records have been materialised.  A table which
+ * fails to build is rebuilt serially in record order afterwards, so the
+ * error reported is the same as the one of a serial build.
+ */
+template <class TableType, class MakeTable>
+void addSimpleTables(const DeckKeyword& tableKeyword,
+                     TableContainer& container,
+                     MakeTable&& makeTable)
+{
+    constexpr std::size_t min_parallel_size = 4;
+
+    std::vector<const DeckItem*> items;
+    items.reserve(tableKeyword.size());
+    for (std::size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
+        items.push_back(&tableKeyword.getRecord(tableIdx).getItem("DATA"));
+    }
+
+    const auto numItems = static_cast<std::ptrdiff_t>(items.size());
+    std::vector<std::shared_ptr<TableType>> tables(items.size());
+
+#pragma omp parallel for schedule(dynamic) if(items.size() >= min_parallel_size)
+    for (std::ptrdiff_t i = 0; i < numItems; ++i) {
+        const auto tableIdx = static_cast<std::size_t>(i);
+        if (items[tableIdx]->data_size() == 0) {
+            continue;
+        }
+
+        try {
+            tables[tableIdx] = makeTable(*items[tableIdx], tableIdx);
+        }
+        catch (...) {
+            // Rebuilt below to report the error.
+        }
+    }
+
+    auto lastComplete = std::size_t{0};
+    for (std::size_t tableIdx = 0; tableIdx < items.size(); ++tableIdx) {
+        if (items[tableIdx]->data_size() > 0) {
+            try {
+                if (tables[tableIdx] == nullptr) {
+                    tables[tableIdx] = makeTable(*items[tableIdx], tableIdx);
+                }
+                container.addTable(tableIdx, tables[tableIdx]);
+                lastComplete = tableIdx;
+            } catch (const std::runtime_error& err) {
+                throw OpmInputError(err, tableKeyword.location());
+            } catch (const std::invalid_argument& err) {
+                throw OpmInputError(err, tableKeyword.location());
+            }
+        }
+        else if (tableIdx > std::size_t{0}) {
+            container.addTable(tableIdx, makeTable(*items[lastComplete], tableIdx));
+        }
+        else {
+            throw OpmInputError {
+                fmt::format("Cannot default region {}'s table data", tableIdx + 1),
+                tableKeyword.location()
+            };
+        }
+    }
+}
+
 }
 
 
@@ -1553,32 +1622,12 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             return;
         }
 
-        auto lastComplete = 0 * numTables;
-        const auto& tableKeyword = deck[keywordName].back();
-        for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
-            const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem("DATA");
-            if (dataItem.data_size() > 0) {
-                try {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, useJFunc(), tableIdx );
-                    container.addTable( tableIdx , table );
-                    lastComplete = tableIdx;
-                } catch (const std::runtime_error& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                } catch (const std::invalid_argument& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
-            }
-            else if (tableIdx > static_cast<size_t>(0)) {
-                const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, useJFunc(), tableIdx));
-            }
-            else {
-                throw OpmInputError {
-                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
-                    tableKeyword.location()
-                };
-            }
-        }
+        const auto useJFunc = this->useJFunc();
+        addSimpleTables<TableType>(deck[keywordName].back(), container,
+            [useJFunc](const DeckItem& item, const std::size_t tableIdx)
+            {
+                return std::make_shared<TableType>(item, useJFunc, tableIdx);
+            });
     }
 
     template <class TableType>
@@ -1596,32 +1645,11 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             return;
         }
 
-        auto lastComplete = 0 * numTables;
-        const auto& tableKeyword = deck[keywordName].back();
-        for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
-            const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem("DATA");
-            if (dataItem.data_size() > 0) {
-                try {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, tableIdx );
-                    container.addTable( tableIdx , table );
-                    lastComplete = tableIdx;
-                } catch (const std::runtime_error& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                } catch (const std::invalid_argument& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
-            }
-            else if (tableIdx > static_cast<size_t>(0)) {
-                const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, tableIdx));
-            }
-            else {
-                throw OpmInputError {
-                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
-                    tableKeyword.location()
-                };
-            }
-        }
+        addSimpleTables<TableType>(deck[keywordName].back(), container,
+            [](const DeckItem& item, const std::size_t tableIdx)
+            {
+                return std::make_shared<TableType>(item, tableIdx);
+            });
     }
 
     template <class TableType>
@@ -58,14 +58,22 @@ const TracerConfig::TracerEntry& TracerConfig::operator[](std::size_t index) con
 }
 
 const TracerConfig::TracerEntry& TracerConfig::operator[](const std::string& name) const {
+    const auto index = this->index(name);
+    if (! index.has_value())
+        throw std::logic_error(fmt::format("No such tracer: {}", name));
+
+    return this->tracers[*index];
+}
+
+std::optional<std::size_t> TracerConfig::index(const std::string& name) const {
     auto iter = std::find_if(this->tracers.begin(), this->tracers.end(), [&name](const TracerEntry& tracer) {
             return tracer.name == name;
         });
 
     if (iter == this->tracers.end())
-        throw std::logic_error(fmt::format("No such tracer: {}", name));
+        return std::nullopt;
 
-    return *iter;
+    return static_cast<std::size_t>(std::distance(this->tracers.begin(), iter));
 }
 
 
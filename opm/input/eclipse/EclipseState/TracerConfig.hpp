@@ -131,6 +131,10 @@ public:
     const TracerEntry& operator[](const std::string& name) const;
     const TracerEntry& operator[](std::size_t index) const;
 
+    /// Dense index, in the range [0, size()), of the tracer named \p name.
+    /// Nullopt if there is no such tracer.
+    std::optional<std::size_t> index(const std::string& name) const;
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -17,11 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <fstream>
 #include <filesystem>
 #include <iostream>
 #include <sstream>
 #include <cctype>
+#include <string>
+#include <vector>
 #include <fmt/format.h>
 
 #include <opm/json/JsonObject.hpp>
@@ -222,8 +225,25 @@ void addDefaultKeywords{0}([[maybe_unused]] Parser& p){{
 )",
                                      first_char);
                 const auto& keywords = kw_pair.second;
-                for (const auto& kw : keywords)
-                    sourceStr << fmt::format("    p.addParserKeyword( {}() );", kw.className()) << std::endl;
+                for (const auto& kw : keywords) {
+                    // Keywords matching a regular expression or opening a
+                    // code section must be known up front, the others are
+                    // created on first lookup.
+                    if (kw.hasMatchRegex() || kw.isCodeKeyword()) {
+                        sourceStr << fmt::format("    p.addParserKeyword( {}() );", kw.className()) << std::endl;
+                        continue;
+                    }
+
+                    std::vector<std::string> deck_names(kw.deck_names().begin(), kw.deck_names().end());
+                    std::sort(deck_names.begin(), deck_names.end());
+
+                    std::string names;
+                    for (const auto& deck_name : deck_names)
+                        names += fmt::format("{}\"{}\"", names.empty() ? "" : ", ", deck_name);
+
+                    sourceStr << fmt::format("    p.addLazyParserKeyword( {{{}}}, []() -> ParserKeyword {{ return {}(); }} );",
+                                             names, kw.className()) << std::endl;
+                }
             sourceStr << R"(
 
 }
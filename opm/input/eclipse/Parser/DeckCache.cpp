@@ -0,0 +1,264 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/InputFileManifest.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace {
+
+const std::string snapshot_magic = "OPM_DECK_SNAPSHOT";
+
+const Opm::Serialization::MemPacker packer{};
+
+// The Serializer keeps its buffer to itself; expose it so that the
+// serialized data can be written to and read from file.
+class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+{
+public:
+    BufferSerializer()
+        : Opm::Serializer<Opm::Serialization::MemPacker>(packer)
+    {}
+
+    std::vector<char>& buffer()
+    {
+        return this->m_buffer;
+    }
+};
+
+struct InputFiles
+{
+    std::vector<std::string> paths{};
+    std::vector<std::size_t> sizes{};
+    std::vector<std::uint64_t> hashes{};
+};
+
+std::optional<std::string> readFile(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+        return {};
+
+    std::string content { std::istreambuf_iterator<char>(stream),
+                          std::istreambuf_iterator<char>() };
+    if (stream.bad())
+        return {};
+
+    return content;
+}
+
+std::uint64_t contentHash(const std::string& content)
+{
+    return Opm::InputFileManifest::hash(content);
+}
+
+bool consistent(const InputFiles& files)
+{
+    return (files.sizes.size() == files.paths.size())
+        && (files.hashes.size() == files.paths.size());
+}
+
+bool unchanged(const InputFiles& files)
+{
+    if (!consistent(files))
+        return false;
+
+    for (std::size_t i = 0; i < files.paths.size(); ++i) {
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(files.paths[i], ec);
+        if (ec || (size != files.sizes[i]))
+            return false;
+
+        const auto content = readFile(files.paths[i]);
+        if (!content.has_value() || (contentHash(*content) != files.hashes[i]))
+            return false;
+    }
+
+    return true;
+}
+
+bool unchanged(const InputFiles& files, const Opm::InputFileManifest& manifest)
+{
+    if (!consistent(files))
+        return false;
+
+    for (std::size_t i = 0; i < files.paths.size(); ++i) {
+        const auto entry = manifest.find(files.paths[i]);
+        if (!entry.has_value() || !entry->found ||
+            (entry->size != files.sizes[i]) || (entry->hash != files.hashes[i]))
+            return false;
+    }
+
+    return true;
+}
+
+// Read the snapshot of dataFile and key, if it exists and its input files
+// pass the unchanged check.
+template <typename Unchanged>
+std::optional<Opm::Deck> loadSnapshot(const std::filesystem::path& snapshot,
+                                      const std::string& dataFile,
+                                      const std::string& key,
+                                      Unchanged&& unchanged)
+{
+    try {
+        std::ifstream stream(snapshot, std::ios::binary);
+        if (!stream)
+            return {};
+
+        const auto snapshot_size = std::filesystem::file_size(snapshot);
+
+        std::uint64_t header_size = 0;
+        stream.read(reinterpret_cast<char*>(&header_size), sizeof header_size);
+        if (!stream || (header_size > snapshot_size - sizeof header_size))
+            return {};
+
+        BufferSerializer header;
+        header.buffer().resize(header_size);
+        stream.read(header.buffer().data(), header_size);
+        if (!stream)
+            return {};
+
+        std::string magic;
+        int snapshot_version = 0;
+        std::string snapshot_data_file;
+        std::string snapshot_key;
+        InputFiles files;
+        header.unpack(magic, snapshot_version, snapshot_data_file, snapshot_key,
+                      files.paths, files.sizes, files.hashes);
+
+        if ((magic != snapshot_magic) || (snapshot_version != Opm::DeckCache::version) ||
+            (snapshot_data_file != dataFile) || (snapshot_key != key) ||
+            !unchanged(files))
+            return {};
+
+        BufferSerializer body;
+        body.buffer().assign(std::istreambuf_iterator<char>(stream),
+                             std::istreambuf_iterator<char>());
+
+        Opm::Deck deck;
+        body.unpack(deck);
+        return deck;
+    }
+    catch (const std::exception&) {
+        // Truncated or otherwise corrupt snapshot.
+        return {};
+    }
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+    DeckCache::DeckCache(std::filesystem::path directory)
+        : m_directory(std::move(directory))
+    {}
+
+    std::filesystem::path DeckCache::snapshotPath(const std::string& dataFile,
+                                                  const std::string& key) const
+    {
+        const auto name_hash = InputFileManifest::hash(dataFile + '\0' + key);
+        return this->m_directory / fmt::format("{:016x}.deck", name_hash);
+    }
+
+    std::optional<Deck> DeckCache::load(const std::string& dataFile,
+                                        const std::string& key) const
+    {
+        return loadSnapshot(this->snapshotPath(dataFile, key), dataFile, key,
+                            [](const InputFiles& files) { return unchanged(files); });
+    }
+
+    std::optional<Deck> DeckCache::load(const std::string& dataFile,
+                                        const std::string& key,
+                                        const InputFileManifest& manifest) const
+    {
+        return loadSnapshot(this->snapshotPath(dataFile, key), dataFile, key,
+                            [&manifest](const InputFiles& files) { return unchanged(files, manifest); });
+    }
+
+    bool DeckCache::store(const std::string& dataFile,
+                          const std::string& key,
+                          const Deck& deck,
+                          const std::vector<std::filesystem::path>& inputFiles) const
+    {
+        InputFiles files;
+        for (const auto& path : inputFiles) {
+            const auto content = readFile(path);
+            if (!content.has_value())
+                return false;
+
+            files.paths.push_back(path.string());
+            files.sizes.push_back(content->size());
+            files.hashes.push_back(contentHash(*content));
+        }
+
+        const auto snapshot = this->snapshotPath(dataFile, key);
+        const auto tmp = std::filesystem::path {
+            unique_path(snapshot.string() + ".%%%%-%%%%.tmp")
+        };
+
+        try {
+            BufferSerializer header;
+            header.pack(snapshot_magic, version, dataFile, key,
+                        files.paths, files.sizes, files.hashes);
+
+            BufferSerializer body;
+            body.pack(deck);
+
+            std::filesystem::create_directories(this->m_directory);
+            {
+                std::ofstream stream(tmp, std::ios::binary);
+                const std::uint64_t header_size = header.buffer().size();
+                stream.write(reinterpret_cast<const char*>(&header_size), sizeof header_size);
+                stream.write(header.buffer().data(), header.buffer().size());
+                stream.write(body.buffer().data(), body.buffer().size());
+                if (!stream)
+                    throw std::runtime_error("Write error");
+            }
+
+            std::filesystem::rename(tmp, snapshot);
+        }
+        catch (const std::exception& e) {
+            std::error_code ec;
+            std::filesystem::remove(tmp, ec);
+            OpmLog::warning(fmt::format("Could not store deck snapshot {}: {}", snapshot.string(), e.what()));
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace Opm
@@ -0,0 +1,90 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+    class Deck;
+    class InputFileManifest;
+
+    /// Binary snapshots of parsed decks.
+    ///
+    /// A snapshot holds the serialized Deck together with the size and
+    /// content hash of every input file, i.e., the DATA file and all
+    /// INCLUDE files, that went into it.  Snapshots are stored in one
+    /// directory, one file per DATA file and key, where the key is an
+    /// arbitrary string describing the parser configuration which
+    /// produced the Deck.  A snapshot is only loaded if none of its
+    /// input files have changed since it was stored.
+    ///
+    /// Failing to read or write the snapshots is never an error, the
+    /// caller then simply has to parse the deck.
+    class DeckCache {
+    public:
+        /// Incremented whenever the snapshot layout or the serialized
+        /// representation of Deck changes.
+        static constexpr int version = 3;
+
+        explicit DeckCache(std::filesystem::path directory);
+
+        /// Load the snapshot of \p dataFile parsed with \p key.
+        ///
+        /// \return Deck from the snapshot, or nullopt if there is no
+        ///    such snapshot, it can not be read or any of its input
+        ///    files have changed.
+        std::optional<Deck> load(const std::string& dataFile,
+                                 const std::string& key) const;
+
+        /// Load the snapshot of \p dataFile parsed with \p key, using
+        /// the content hashes of \p manifest instead of reading the
+        /// input files again.  Input files missing from the manifest
+        /// count as changed.
+        std::optional<Deck> load(const std::string& dataFile,
+                                 const std::string& key,
+                                 const InputFileManifest& manifest) const;
+
+        /// Store the snapshot of \p deck, parsed from \p dataFile with
+        /// \p key.  Existing snapshots are replaced atomically, so that
+        /// concurrent processes sharing the directory always see a
+        /// complete snapshot.
+        ///
+        /// \return Whether the snapshot was stored.
+        bool store(const std::string& dataFile,
+                   const std::string& key,
+                   const Deck& deck,
+                   const std::vector<std::filesystem::path>& inputFiles) const;
+
+        /// Snapshot file of \p dataFile parsed with \p key.
+        std::filesystem::path snapshotPath(const std::string& dataFile,
+                                           const std::string& key) const;
+
+    private:
+        std::filesystem::path m_directory;
+    };
+
+} // namespace Opm
+
+#endif // OPM_DECK_CACHE_HPP
@@ -19,6 +19,8 @@
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 
+#include <opm/common/utility/OpmInputError.hpp>
+
 #include <iostream>
 #include <iomanip>
 #include <numeric>
@@ -33,7 +35,28 @@ namespace Opm {
 
 
     void ErrorGuard::addWarning(const std::string& errorKey, const std::string& msg) {
-        this->warning_list.emplace_back(errorKey, msg);
+        this->warning_list.push_back({errorKey, msg, std::nullopt});
+    }
+
+
+    void ErrorGuard::addWarning(const std::string& errorKey,
+                                const std::string& msg_format,
+                                const std::optional<KeywordLocation>& location) {
+        this->warning_list.push_back({errorKey, msg_format, location});
+    }
+
+
+    std::string ErrorGuard::Warning::message() const {
+        if (! this->location.has_value())
+            return this->msg;
+
+        try {
+            return OpmInputError::format(this->msg, *this->location);
+        }
+        catch (const fmt::format_error&) {
+            // Printed from the destructor, so must not throw.
+            return this->msg;
+        }
     }
 
 
@@ -42,8 +65,8 @@ namespace Opm {
 
         if (!this->warning_list.empty()) {
             std::cerr << "Warnings:" << std::endl;
-            for (const auto& pair : this->warning_list)
-                std::cerr << "  " << std::setw(width) << pair.first << ": " << pair.second << std::endl;
+            for (const auto& warning : this->warning_list)
+                std::cerr << "  " << std::setw(width) << warning.key << ": " << warning.message() << std::endl;
             std::cerr << std::endl;
         }
 
@@ -76,7 +99,11 @@ namespace Opm {
                          return std::max(acc, pair.first.size());
                      };
         std::size_t width = std::accumulate(this->warning_list.begin(),
-                                            this->warning_list.end(), 0UL, maxit);
+                                            this->warning_list.end(), 0UL,
+                                            [](const auto acc, const auto& warning)
+                                            {
+                                                return std::max(acc, warning.key.size());
+                                            });
         width = std::accumulate(this->error_list.begin(),
                                 this->error_list.end(), width, maxit);
         return width;
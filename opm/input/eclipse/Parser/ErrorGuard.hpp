@@ -21,7 +21,10 @@
 #ifndef ERROR_GUARD_HPP
 #define ERROR_GUARD_HPP
 
+#include <opm/common/OpmLog/KeywordLocation.hpp>
+
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -31,9 +34,20 @@ class ErrorGuard {
 public:
     void addError(const std::string& errorKey, const std::string& msg);
     void addWarning(const std::string& errorKey, const std::string &msg);
+
+    /*
+      Add a warning whose message is the format string 'msg_format' applied
+      to 'location' with OpmInputError::format(). The message is only
+      formatted if the warning is printed, so ignored errors on the hot
+      parsing path do not pay for the formatting.
+    */
+    void addWarning(const std::string& errorKey,
+                    const std::string& msg_format,
+                    const std::optional<KeywordLocation>& location);
     void clear();
 
     explicit operator bool() const { return !this->error_list.empty(); }
+    bool hasWarnings() const { return !this->warning_list.empty(); }
 
     /*
       Observe that this destructor has somewhat special semantics. If there
@@ -46,10 +60,18 @@ public:
     std::string formattedErrors() const;
 
 private:
+    struct Warning {
+        std::string key;
+        std::string msg;
+        std::optional<KeywordLocation> location;
+
+        std::string message() const;
+    };
+
     std::size_t maxMessageWidth() const;
 
     std::vector<std::pair<std::string, std::string>> error_list;
-    std::vector<std::pair<std::string, std::string>> warning_list;
+    std::vector<Warning> warning_list;
 };
 
 }
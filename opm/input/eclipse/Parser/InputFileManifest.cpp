@@ -0,0 +1,453 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/InputFileManifest.hpp>
+
+#include <opm/common/utility/String.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+// Constants and round functions of the XXH64 algorithm.
+constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+constexpr std::uint64_t rotl(const std::uint64_t x, const int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+std::uint64_t read64(const char* p)
+{
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof v);
+    return v;
+}
+
+std::uint64_t read32(const char* p)
+{
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof v);
+    return v;
+}
+
+constexpr std::uint64_t hashRound(std::uint64_t acc, const std::uint64_t input)
+{
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+constexpr std::uint64_t mergeRound(std::uint64_t acc, const std::uint64_t val)
+{
+    acc ^= hashRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+bool readFile(const std::filesystem::path& path, std::string& buffer)
+{
+    const auto closer = [](std::FILE* f) { std::fclose(f); };
+    std::unique_ptr<std::FILE, decltype(closer)> ufp(std::fopen(path.c_str(), "rb"), closer);
+    if (!ufp)
+        return false;
+
+    auto* fp = ufp.get();
+    std::fseek(fp, 0, SEEK_END);
+    const auto size = std::ftell(fp);
+    if (size < 0)
+        return false;
+
+    buffer.resize(size);
+    std::rewind(fp);
+    const auto readc = std::fread(buffer.data(), 1, buffer.size(), fp);
+    return !std::ferror(fp) && (readc == buffer.size());
+}
+
+// Files referred to by one input file.
+struct References
+{
+    std::vector<std::string> includes{};
+    std::vector<std::string> binaries{};
+    std::vector<std::pair<std::string, std::string>> paths{};
+};
+
+std::string_view stripComment(std::string_view line)
+{
+    char quote = 0;
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        const char c = line[i];
+        if (quote != 0) {
+            if (c == quote)
+                quote = 0;
+        }
+        else if ((c == '\'') || (c == '"'))
+            quote = c;
+        else if ((c == '-') && (i + 1 < line.size()) && (line[i + 1] == '-'))
+            return line.substr(0, i);
+    }
+
+    return line;
+}
+
+/*
+ * Find the file names of the INCLUDE, IMPORT and GDFILE keywords, and the
+ * aliases of the PATHS keyword, in the raw text of an input file.  Records
+ * are split into tokens on white space, quoted tokens may contain white
+ * space and slashes, and an unquoted slash terminates the record.
+ */
+References scanReferences(std::string_view input)
+{
+    enum class Pending { None, Include, Binary, Paths };
+
+    References refs;
+    auto pending = Pending::None;
+    std::vector<std::string> tokens;
+
+    const auto endRecord = [&refs, &pending, &tokens]()
+    {
+        switch (pending) {
+        case Pending::Include:
+        case Pending::Binary:
+            if (!tokens.empty()) {
+                auto& names = (pending == Pending::Include) ? refs.includes : refs.binaries;
+                names.push_back(tokens.front());
+            }
+            pending = Pending::None;
+            break;
+
+        case Pending::Paths:
+            if (tokens.empty())
+                pending = Pending::None;
+            else if (tokens.size() >= 2)
+                refs.paths.emplace_back(tokens[0], tokens[1]);
+            break;
+
+        case Pending::None:
+            break;
+        }
+
+        tokens.clear();
+    };
+
+    std::size_t start = 0;
+    while (start < input.size()) {
+        auto end = input.find('\n', start);
+        if (end == std::string_view::npos)
+            end = input.size();
+
+        auto line = stripComment(input.substr(start, end - start));
+        start = end + 1;
+
+        if (pending == Pending::None) {
+            line = Opm::trim_view(line);
+            const auto name = line.substr(0, line.find_first_of(" \t\r/'\""));
+            if (name.empty() || (name.size() > 8))
+                continue;
+
+            const auto keyword = Opm::uppercase(std::string(name));
+            if (keyword == "INCLUDE")
+                pending = Pending::Include;
+            else if ((keyword == "IMPORT") || (keyword == "GDFILE"))
+                pending = Pending::Binary;
+            else if (keyword == "PATHS")
+                pending = Pending::Paths;
+            else
+                continue;
+
+            line.remove_prefix(name.size());
+        }
+
+        std::size_t pos = 0;
+        while ((pos < line.size()) && (pending != Pending::None)) {
+            const char c = line[pos];
+            if ((c == ' ') || (c == '\t') || (c == '\r')) {
+                ++pos;
+            }
+            else if (c == '/') {
+                endRecord();
+                ++pos;
+            }
+            else if ((c == '\'') || (c == '"')) {
+                const auto close = line.find(c, pos + 1);
+                const auto stop = (close == std::string_view::npos) ? line.size() : close;
+                tokens.emplace_back(line.substr(pos + 1, stop - pos - 1));
+                pos = stop + 1;
+            }
+            else {
+                const auto stop = std::min(line.find_first_of(" \t\r/'\"", pos), line.size());
+                tokens.emplace_back(line.substr(pos, stop - pos));
+                pos = stop;
+            }
+        }
+    }
+
+    return refs;
+}
+
+// Resolve a file name the same way as the parser resolves INCLUDE files.
+std::optional<std::filesystem::path>
+resolvePath(std::string path,
+            const std::map<std::string, std::string>& aliases,
+            const std::filesystem::path& root)
+{
+    static const std::string validPathNameCharacters("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+
+    const auto dollar = path.find('$');
+    if (dollar != std::string::npos) {
+        const auto alias = path.substr(dollar + 1, path.find_first_not_of(validPathNameCharacters, dollar + 1) - dollar - 1);
+        const auto it = aliases.find(alias);
+        if (it == aliases.end())
+            return {};
+
+        path.replace(dollar, alias.size() + 1, it->second);
+    }
+
+    std::replace(path.begin(), path.end(), '\\', '/');
+
+    std::filesystem::path file(Opm::trim_copy(path));
+    if (file.is_relative())
+        file = root / file;
+
+    std::error_code ec;
+    file = std::filesystem::canonical(file, ec);
+    if (ec)
+        return {};
+
+    return file;
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+    std::uint64_t InputFileManifest::hash(std::string_view data, const std::uint64_t seed)
+    {
+        const char* p = data.data();
+        const char* const end = p + data.size();
+
+        std::uint64_t h;
+        if (data.size() >= 32) {
+            std::uint64_t v1 = seed + prime1 + prime2;
+            std::uint64_t v2 = seed + prime2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - prime1;
+
+            const char* const limit = end - 32;
+            do {
+                v1 = hashRound(v1, read64(p));
+                v2 = hashRound(v2, read64(p + 8));
+                v3 = hashRound(v3, read64(p + 16));
+                v4 = hashRound(v4, read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            h = mergeRound(h, v1);
+            h = mergeRound(h, v2);
+            h = mergeRound(h, v3);
+            h = mergeRound(h, v4);
+        }
+        else
+            h = seed + prime5;
+
+        h += data.size();
+
+        for (; p + 8 <= end; p += 8) {
+            h ^= hashRound(0, read64(p));
+            h = rotl(h, 27) * prime1 + prime4;
+        }
+
+        if (p + 4 <= end) {
+            h ^= read32(p) * prime1;
+            h = rotl(h, 23) * prime2 + prime3;
+            p += 4;
+        }
+
+        for (; p < end; ++p) {
+            h ^= static_cast<unsigned char>(*p) * prime5;
+            h = rotl(h, 11) * prime1;
+        }
+
+        h ^= h >> 33;
+        h *= prime2;
+        h ^= h >> 29;
+        h *= prime3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    InputFileManifest InputFileManifest::create(const std::string& dataFile, int numThreads)
+    {
+#ifdef _OPENMP
+        if (numThreads <= 0)
+            numThreads = omp_get_max_threads();
+#else
+        numThreads = 1;
+#endif
+
+        std::error_code ec;
+        const auto root_file = std::filesystem::canonical(dataFile, ec);
+        if (ec)
+            throw std::runtime_error(fmt::format("Could not read from file: {}", dataFile));
+
+        const auto root = root_file.parent_path();
+
+        InputFileManifest manifest;
+        std::map<std::string, std::string> aliases;
+
+        // Files of the current level of the include graph, and whether
+        // they should be scanned for references.
+        std::vector<std::pair<std::filesystem::path, bool>> level { { root_file, true } };
+        std::set<std::filesystem::path> seen { root_file };
+
+        while (!level.empty()) {
+            std::vector<Entry> entries(level.size());
+            std::vector<References> refs(level.size());
+            std::vector<std::exception_ptr> failure(level.size());
+
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads)
+            for (std::int64_t i = 0; i < static_cast<std::int64_t>(level.size()); ++i) {
+                try {
+                    const auto& [path, scan] = level[i];
+                    auto& entry = entries[i];
+                    entry.path = path;
+
+                    std::string buffer;
+                    if (!readFile(path, buffer))
+                        continue;
+
+                    entry.found = true;
+                    entry.size = buffer.size();
+                    entry.hash = hash(buffer);
+                    if (scan)
+                        refs[i] = scanReferences(buffer);
+                }
+                catch (...) {
+                    failure[i] = std::current_exception();
+                }
+            }
+
+            for (const auto& error : failure) {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+
+            if (!entries.front().found && manifest.m_files.empty())
+                throw std::runtime_error(fmt::format("Could not read from file: {}", dataFile));
+
+            std::vector<std::pair<std::filesystem::path, bool>> next;
+            const auto add = [&](const std::string& name, const bool scan)
+            {
+                auto path = resolvePath(name, aliases, root);
+                if (!path.has_value()) {
+                    // Listed as missing, so that the manifest changes
+                    // when the file appears.
+                    Entry missing;
+                    missing.path = name;
+                    entries.push_back(std::move(missing));
+                    return;
+                }
+
+                if (seen.insert(path.value()).second)
+                    next.emplace_back(std::move(path.value()), scan);
+            };
+
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                for (const auto& [alias, path] : refs[i].paths)
+                    aliases.insert_or_assign(alias, path);
+            }
+
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                for (const auto& name : refs[i].includes)
+                    add(name, true);
+
+                for (const auto& name : refs[i].binaries)
+                    add(name, false);
+            }
+
+            for (auto& entry : entries) {
+                manifest.m_index.emplace(entry.path, manifest.m_files.size());
+                manifest.m_files.push_back(std::move(entry));
+            }
+
+            level = std::move(next);
+        }
+
+        return manifest;
+    }
+
+    std::optional<InputFileManifest::Entry>
+    InputFileManifest::find(const std::filesystem::path& path) const
+    {
+        std::error_code ec;
+        auto file = std::filesystem::weakly_canonical(path, ec);
+        if (ec)
+            file = path;
+
+        const auto it = this->m_index.find(file);
+        if (it == this->m_index.end())
+            return {};
+
+        return this->m_files[it->second];
+    }
+
+    std::uint64_t InputFileManifest::hash() const
+    {
+        std::vector<std::uint64_t> content;
+        content.reserve(2 * this->m_files.size());
+        for (const auto& entry : this->m_files) {
+            content.push_back(entry.found ? entry.hash : hash(entry.path.string()));
+            content.push_back(entry.found ? entry.size : ~std::uintmax_t{0});
+        }
+
+        return hash({ reinterpret_cast<const char*>(content.data()),
+                      content.size() * sizeof(std::uint64_t) });
+    }
+
+    void InputFileManifest::write(std::ostream& os) const
+    {
+        for (const auto& entry : this->m_files) {
+            if (entry.found)
+                os << fmt::format("{:016x} {:>12} {}\n", entry.hash, entry.size, entry.path.string());
+            else
+                os << fmt::format("{:16s} {:>12} {}\n", "missing", "-", entry.path.string());
+        }
+    }
+
+} // namespace Opm
@@ -0,0 +1,96 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_INPUT_FILE_MANIFEST_HPP
+#define OPM_INPUT_FILE_MANIFEST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm {
+
+    /// Content hashes of all files making up a deck, found without
+    /// parsing it.
+    ///
+    /// Starting from the DATA file, the raw files are scanned for the
+    /// INCLUDE, IMPORT, GDFILE and PATHS keywords, and the files they
+    /// refer to are hashed in turn.  The include graph is processed one
+    /// level at a time, with the files of each level read, hashed and
+    /// scanned concurrently.  INCLUDE files are scanned recursively,
+    /// IMPORT and GDFILE files are binary and only hashed.
+    ///
+    /// The scan is deliberately simple: files referenced from within a
+    /// SKIP block are included, and PATHS aliases are only known for
+    /// files on later levels of the include graph than the PATHS
+    /// keyword.  A manifest may therefore list a few more or fewer files
+    /// than the parser reads, which is acceptable for change detection.
+    class InputFileManifest {
+    public:
+        struct Entry {
+            /// Canonical path, or the path as written in the deck if
+            /// the file does not exist.
+            std::filesystem::path path{};
+            std::uintmax_t size{0};
+            std::uint64_t hash{0};
+            bool found{false};
+        };
+
+        /// Scan \p dataFile and everything it includes using up to
+        /// \p numThreads threads.  Zero means all available threads.
+        ///
+        /// Throws std::runtime_error if \p dataFile can not be read.
+        static InputFileManifest create(const std::string& dataFile,
+                                        int numThreads = 1);
+
+        /// 64 bit XXH64 hash of \p data with \p seed.  Identical to the
+        /// reference implementation on little endian platforms.
+        static std::uint64_t hash(std::string_view data,
+                                  std::uint64_t seed = 0);
+
+        /// All files in the order they were found, the DATA file first.
+        const std::vector<Entry>& files() const
+        {
+            return this->m_files;
+        }
+
+        /// Entry of the file at \p path, which is made canonical first.
+        std::optional<Entry> find(const std::filesystem::path& path) const;
+
+        /// Hash of the content of all files in order.  Insensitive to
+        /// the location of the files.
+        std::uint64_t hash() const;
+
+        /// Write one line with hash, size and path for each file.
+        void write(std::ostream& os) const;
+
+    private:
+        std::vector<Entry> m_files{};
+        std::map<std::filesystem::path, std::size_t> m_index{};
+    };
+
+} // namespace Opm
+
+#endif // OPM_INPUT_FILE_MANIFEST_HPP
@@ -19,6 +19,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <iterator>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
@@ -158,15 +159,32 @@ namespace Opm {
             const std::string& msg_fmt,
             const std::optional<KeywordLocation>& location,
             ErrorGuard& errors) const {
+        this->handleError(errorKey, this->get(errorKey), msg_fmt, location, errors);
+    }
 
-        InputErrorAction action = get( errorKey );
-        std::string msg = location ? OpmInputError::format(msg_fmt, *location) : msg_fmt;
+    void ParseContext::handleError(
+            Check check,
+            const std::string& msg_fmt,
+            const std::optional<KeywordLocation>& location,
+            ErrorGuard& errors) const {
+        this->handleError(checkKey(check), this->get(check), msg_fmt, location, errors);
+    }
+
+    void ParseContext::handleError(
+            const std::string& errorKey,
+            InputErrorAction action,
+            const std::string& msg_fmt,
+            const std::optional<KeywordLocation>& location,
+            ErrorGuard& errors) const {
 
         if (action == InputErrorAction::IGNORE) {
-            errors.addWarning(errorKey, msg);
+            // The message is only formatted if the warnings are printed.
+            errors.addWarning(errorKey, msg_fmt, location);
             return;
         }
 
+        const std::string msg = location ? OpmInputError::format(msg_fmt, *location) : msg_fmt;
+
         if (action == InputErrorAction::WARN) {
             OpmLog::warning(msg);
             errors.addWarning(errorKey, msg);
@@ -200,7 +218,7 @@ namespace Opm {
     void ParseContext::handleUnknownKeyword(const std::string& keyword, const std::optional<KeywordLocation>& location, ErrorGuard& errors) const {
         if (this->ignore_keywords.find(keyword) == this->ignore_keywords.end()) {
             std::string msg = "Unknown keyword: " + keyword;
-            this->handleError(ParseContext::PARSE_UNKNOWN_KEYWORD, msg, location, errors);
+            this->handleError(Check::UnknownKeyword, msg, location, errors);
         }
     }
 
@@ -237,17 +255,51 @@ namespace Opm {
             throw std::invalid_argument("The ParseContext keys can not contain '|', '*' or ':'");
 
         if (!hasKey(key))
-            m_errorContexts.insert( std::pair<std::string , InputErrorAction>( key , default_action));
+            this->setAction(key, default_action);
     }
 
 
     InputErrorAction ParseContext::get(const std::string& key) const {
-        if (hasKey( key ))
-            return m_errorContexts.find( key )->second;
+        const auto pos = m_errorContexts.find( key );
+        if (pos != m_errorContexts.end())
+            return pos->second;
         else
             throw std::invalid_argument("The errormode key: " + key + " has not been registered");
     }
 
+
+    InputErrorAction ParseContext::get(Check check) const {
+        return this->m_checkActions[static_cast<std::size_t>(check)];
+    }
+
+
+    void ParseContext::setAction(const std::string& key, InputErrorAction action) {
+        m_errorContexts[key] = action;
+
+        for (std::size_t i = 0; i < this->m_checkActions.size(); ++i) {
+            if (checkKey(static_cast<Check>(i)) == key)
+                this->m_checkActions[i] = action;
+        }
+    }
+
+
+    const std::string& ParseContext::checkKey(Check check) {
+        static const std::string* const keys[] = {
+            &PARSE_EXTRA_RECORDS,
+            &PARSE_UNKNOWN_KEYWORD,
+            &PARSE_RANDOM_TEXT,
+            &PARSE_RANDOM_SLASH,
+            &PARSE_MISSING_DIMS_KEYWORD,
+            &PARSE_EXTRA_DATA,
+            &PARSE_MISSING_INCLUDE,
+            &PARSE_LONG_KEYWORD,
+            &PARSE_INVALID_KEYWORD_COMBINATION,
+        };
+        static_assert(std::size(keys) == static_cast<std::size_t>(Check::NumChecks));
+
+        return *keys[static_cast<std::size_t>(check)];
+    }
+
     /*****************************************************************/
 
     /*
@@ -264,7 +316,7 @@ namespace Opm {
 
     void ParseContext::updateKey(const std::string& key , InputErrorAction action) {
         if (hasKey(key))
-            m_errorContexts[key] = action;
+            this->setAction(key, action);
         else
             throw std::invalid_argument("The errormode key: " + key + " has not been registered");
     }
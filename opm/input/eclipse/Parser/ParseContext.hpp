@@ -21,6 +21,8 @@
 #ifndef OPM_PARSE_CONTEXT_HPP
 #define OPM_PARSE_CONTEXT_HPP
 
+#include <array>
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <set>
@@ -77,17 +79,38 @@ class KeywordLocation;
        The update function itself is quite tolerant, and will silently
        ignore unknown keys. If you use the updateKey() function only
        recognizd keys will be allowed.
+
+       The actions of the checks the parser performs for every keyword and
+       record are additionally kept in a table indexed by the Check enum,
+       which is updated together with the string keys. The parser uses the
+       Check overloads so that a clean deck does not pay for any string
+       lookups, and messages are only formatted when the action requires
+       them to be shown.
     */
 
     class ErrorGuard;
 
     class ParseContext {
     public:
+        enum class Check : std::size_t {
+            ExtraRecords,
+            UnknownKeyword,
+            RandomText,
+            RandomSlash,
+            MissingDimsKeyword,
+            ExtraData,
+            MissingInclude,
+            LongKeyword,
+            InvalidKeywordCombination,
+            NumChecks,
+        };
+
         ParseContext();
         explicit ParseContext(InputErrorAction default_action);
         explicit ParseContext(const std::vector<std::pair<std::string , InputErrorAction>>& initial);
 
         void handleError( const std::string& errorKey, const std::string& msg, const std::optional<KeywordLocation>& location, ErrorGuard& errors)  const;
+        void handleError(Check check, const std::string& msg, const std::optional<KeywordLocation>& location, ErrorGuard& errors) const;
         void handleUnknownKeyword(const std::string& keyword, const std::optional<KeywordLocation>& location, ErrorGuard& errors) const;
         bool hasKey(const std::string& key) const;
         ParseContext  withKey(const std::string& key, InputErrorAction action) const;
@@ -97,6 +120,7 @@ class KeywordLocation;
         void update(const std::string& keyString , InputErrorAction action);
         void ignoreKeyword(const std::string& keyword);
         InputErrorAction get(const std::string& key) const;
+        InputErrorAction get(Check check) const;
         std::map<std::string,InputErrorAction>::const_iterator begin() const;
         std::map<std::string,InputErrorAction>::const_iterator end() const;
         /*
@@ -385,8 +409,17 @@ class KeywordLocation;
         void initEnv();
         void envUpdate( const std::string& envVariable , InputErrorAction action );
         void patternUpdate( const std::string& pattern , InputErrorAction action);
+        void setAction(const std::string& key, InputErrorAction action);
+        void handleError(const std::string& errorKey,
+                         InputErrorAction action,
+                         const std::string& msg_fmt,
+                         const std::optional<KeywordLocation>& location,
+                         ErrorGuard& errors) const;
+
+        static const std::string& checkKey(Check check);
 
         std::map<std::string , InputErrorAction> m_errorContexts;
+        std::array<InputErrorAction, static_cast<std::size_t>(Check::NumChecks)> m_checkActions{};
         std::set<std::string> ignore_keywords;
         std::string m_input_skip_mode{"100"};
     };
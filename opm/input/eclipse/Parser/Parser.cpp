@@ -23,7 +23,10 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Parser/InputFileManifest.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
@@ -47,6 +50,10 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <opm/input/eclipse/Utility/InputProfile.hpp>
+
 #include <opm/json/JsonObject.hpp>
 
 #include <opm/common/utility/String.hpp>
@@ -59,11 +66,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <cstdio>
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <list>
+#include <map>
+#include <memory>
 #include <optional>
+#include <set>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -74,6 +87,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace {
     /// \brief Whether a keyword is a global keyword.
     ///
@@ -456,6 +473,130 @@ void InputStack::push( std::string&& input, std::filesystem::path p ) {
     this->emplace( p, this->string_storage.back() );
 }
 
+/*
+ * Read the entire input file into buffer, with a terminating newline
+ * appended.  Returns false if the file could not be opened.
+ */
+bool readInputFile(const std::filesystem::path& inputFile, std::string& buffer) {
+
+    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+    std::unique_ptr< std::FILE, decltype( closer ) > ufp(
+            std::fopen( inputFile.c_str(), "rb" ),
+            closer
+            );
+
+    if( !ufp )
+        return false;
+
+    /*
+     * read the input file C-style. This is done for performance
+     * reasons, as streams are slow
+     */
+
+    auto* fp = ufp.get();
+    std::fseek( fp, 0, SEEK_END );
+    buffer.resize( std::ftell( fp ) + 1 );
+    std::rewind( fp );
+    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
+    buffer.back() = '\n';
+
+    if( std::ferror( fp ) || readc != buffer.size() - 1 )
+        throw std::runtime_error( "Error when reading input file '"
+                                  + inputFile.string() + "'" );
+
+    return true;
+}
+
+/*
+ * Speculatively extract the names of the files included from a cleaned
+ * input string.  Only used to prefetch include files, so it is
+ * acceptable to miss a few unusual constructs or to find INCLUDE within
+ * a SKIP block; the parser proper will still process the INCLUDE
+ * keywords in the normal way.
+ */
+std::vector<std::string> includeFileNames(std::string_view input) {
+    std::vector<std::string> names;
+    std::string_view line;
+
+    while (str::getline(input, line)) {
+        if (str::make_deck_name(line) != RawConsts::include)
+            continue;
+
+        bool found = false;
+        while (!found && str::getline(input, line))
+            found = !line.empty();
+
+        if (!found)
+            break;
+
+        std::string_view name;
+        if ((line.front() == '\'') || (line.front() == '"')) {
+            const auto end = line.find(line.front(), 1);
+            if (end == std::string_view::npos)
+                continue;
+
+            name = line.substr(1, end - 1);
+        }
+        else
+            name = line.substr(0, line.find_first_of(" \t/"));
+
+        if (!name.empty())
+            names.emplace_back(name);
+    }
+
+    return names;
+}
+
+struct DeferredKeyword {
+    DeferredKeyword( std::unique_ptr<RawKeyword> raw, const ParserKeyword& parser_keyword ) :
+        raw_keyword( std::move( raw ) ),
+        parserKeyword( &parser_keyword )
+    {}
+
+    std::unique_ptr<RawKeyword> raw_keyword;
+    const ParserKeyword* parserKeyword;
+};
+
+// Dimensions are created when the keywords are parsed, so the unit
+// systems are modified as part of parsing.  Create the dimensions of
+// parserKeyword without parsing it, for keywords which are parsed
+// elsewhere, i.e., in another thread or lazily, with copies of the unit
+// systems.
+void addDimensions(const ParserKeyword& parserKeyword,
+                   UnitSystem& active_unitsystem,
+                   UnitSystem& default_unitsystem)
+{
+    for (const auto& record : parserKeyword) {
+        for (const auto& item : record) {
+            if ((item.dataType() != type_tag::fdouble) && (item.dataType() != type_tag::uda))
+                continue;
+
+            for (const auto& dim : item.dimensions()) {
+                active_unitsystem.getNewDimension( dim );
+                default_unitsystem.getNewDimension( dim );
+            }
+        }
+    }
+}
+
+[[noreturn]] void rethrowKeywordError(const std::exception& e, const KeywordLocation& location) {
+    /*
+      This catch-all of parsing errors is to be able to write a good
+      error message; the parser is quite confused at this state and
+      we should not be tempted to continue the parsing.
+
+      We log a error message with the name of the problematic
+      keyword and the location in the input deck. We rethrow the
+      same exception without updating the what() message of the
+      exception.
+    */
+    const OpmInputError opm_error { e, location } ;
+
+    OpmLog::error(opm_error.what());
+
+    std::throw_with_nested(opm_error);
+}
+
 class ParserState {
     public:
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
@@ -470,8 +611,8 @@ class ParserState {
         void loadFile( const std::filesystem::path& );
         void openRootFile( const std::filesystem::path& );
 
-        void handleRandomText(const std::string_view& ) const;
-        std::optional<std::filesystem::path> getIncludeFilePath( std::string ) const;
+        void handleRandomText(const std::string_view& );
+        std::optional<std::filesystem::path> getIncludeFilePath( std::string );
         void addPathAlias( const std::string& alias, const std::string& path );
 
         const std::filesystem::path& current_path() const;
@@ -485,19 +626,39 @@ class ParserState {
         const std::set<Opm::Ecl::SectionType>& get_ignore() {return ignore_sections; };
         bool check_section_keywords(bool& has_edit, bool& has_regions, bool& has_summary);
 
+        void setNumThreads( int );
+        void prefetchIncludeFiles();
+
+        bool deferKeyword( std::unique_ptr<RawKeyword>&, const ParserKeyword& );
+        void flushDeferredKeywords();
+
+        void setLazyKeywords( bool );
+        bool addLazyKeyword( const RawKeyword&, const ParserKeyword& );
+
     private:
+        std::optional<std::filesystem::path> prefetchPath( const std::string& ) const;
+
         const std::vector<std::pair<std::string, std::string>> code_keywords;
         InputStack input_stack;
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
         std::map< std::string, std::string > pathMap;
 
+        int num_threads = 1;
+        std::map< std::filesystem::path, std::string > prefetched;
+        std::vector< DeferredKeyword > deferred;
+
+        bool lazy_keywords = false;
+        std::shared_ptr<const UnitSystem> lazy_active_unitsystem;
+        std::shared_ptr<const UnitSystem> lazy_default_unitsystem;
+
     public:
         ParserKeywordSizeEnum lastSizeType = SLASH_TERMINATED;
         std::string lastKeyWord;
 
         Deck deck;
         std::filesystem::path rootPath;
+        std::vector<std::filesystem::path> input_files;
         std::unique_ptr<Python> python;
         const ParseContext& parseContext;
         ErrorGuard& errors;
@@ -621,37 +782,301 @@ void ParserState::loadString(const std::string& input) {
 
 void ParserState::loadFile(const std::filesystem::path& inputFile) {
 
-    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
-    std::unique_ptr< std::FILE, decltype( closer ) > ufp(
-            std::fopen( inputFile.c_str(), "rb" ),
-            closer
-            );
+    auto cached = this->prefetched.find( inputFile );
+    if (cached != this->prefetched.end()) {
+        auto input = std::move( cached->second );
+        this->prefetched.erase( cached );
+        this->input_stack.push( std::move( input ), inputFile );
+        this->input_files.push_back( inputFile );
+        return;
+    }
+
+    InputProfile::Scope profile { "include", inputFile.string() };
+    std::string buffer;
 
     // make sure the file we'd like to parse is readable
-    if( !ufp ) {
+    if( !readInputFile( inputFile, buffer ) ) {
+        this->flushDeferredKeywords();
         std::string msg = "Could not read from file: " + inputFile.string();
-        parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
+        parseContext.handleError( ParseContext::Check::MissingInclude , msg, {}, errors);
         return;
     }
 
-    /*
-     * read the input file C-style. This is done for performance
-     * reasons, as streams are slow
-     */
+    profile.addBytes( buffer.size() );
+    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    this->input_files.push_back( inputFile );
+}
 
-    auto* fp = ufp.get();
-    std::string buffer;
-    std::fseek( fp, 0, SEEK_END );
-    buffer.resize( std::ftell( fp ) + 1 );
-    std::rewind( fp );
-    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
-    buffer.back() = '\n';
+void ParserState::setNumThreads(int threads) {
+#ifdef _OPENMP
+    this->num_threads = (threads > 0) ? threads : omp_get_max_threads();
+#else
+    static_cast<void>(threads);
+    this->num_threads = 1;
+#endif
+}
 
-    if( std::ferror( fp ) || readc != buffer.size() - 1 )
-        throw std::runtime_error( "Error when reading input file '"
-                                  + inputFile.string() + "'" );
+/*
+ * Resolve an include file name the same way as getIncludeFilePath(), but
+ * without reporting anything.  Names using PATHS aliases are not
+ * resolved since the aliases are not known before the deck is parsed.
+ */
+std::optional<std::filesystem::path> ParserState::prefetchPath(const std::string& name) const {
+    if (name.find('$') != std::string::npos)
+        return {};
 
-    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    std::string path = name;
+    std::replace(path.begin(), path.end(), '\\', '/');
+
+    std::filesystem::path includeFilePath(path);
+    if (includeFilePath.is_relative())
+        includeFilePath = this->rootPath / includeFilePath;
+
+    std::error_code ec;
+    includeFilePath = std::filesystem::canonical(includeFilePath, ec);
+    if (ec)
+        return {};
+
+    return includeFilePath;
+}
+
+/*
+ * Read and clean all files reachable through INCLUDE from the files
+ * currently on the input stack, one level of the include graph at a
+ * time with the files of each level processed concurrently.  The
+ * parser picks the files up in loadFile(); files which can not be
+ * prefetched are left for loadFile() to read and report on.
+ */
+void ParserState::prefetchIncludeFiles() {
+    if ((this->num_threads < 2) || this->input_stack.empty())
+        return;
+
+    std::set<std::filesystem::path> seen;
+    std::vector<std::filesystem::path> level;
+
+    const auto add_includes = [this, &seen](const std::vector<std::string>& names,
+                                           std::vector<std::filesystem::path>& paths)
+    {
+        for (const auto& name : names) {
+            auto path = this->prefetchPath(name);
+            if (path.has_value() && seen.insert(path.value()).second)
+                paths.push_back(std::move(path.value()));
+        }
+    };
+
+    add_includes(includeFileNames(this->input_stack.top().input), level);
+
+    while (!level.empty()) {
+        std::vector<std::optional<std::string>> contents(level.size());
+        std::vector<std::vector<std::string>> names(level.size());
+
+#pragma omp parallel for schedule(dynamic) num_threads(this->num_threads)
+        for (std::size_t i = 0; i < level.size(); ++i) {
+            try {
+                InputProfile::Scope profile { "include", level[i].string() };
+                std::string buffer;
+                if (readInputFile(level[i], buffer)) {
+                    profile.addBytes(buffer.size());
+                    contents[i] = str::clean(this->code_keywords, buffer);
+                    names[i] = includeFileNames(contents[i].value());
+                }
+            }
+            catch (const std::exception&) {
+                // Left for loadFile() to report.
+                contents[i].reset();
+            }
+        }
+
+        std::vector<std::filesystem::path> next;
+        for (std::size_t i = 0; i < level.size(); ++i) {
+            if (!contents[i].has_value())
+                continue;
+
+            add_includes(names[i], next);
+            this->prefetched.emplace(level[i], std::move(contents[i].value()));
+        }
+
+        level = std::move(next);
+    }
+}
+
+/*
+ * Data keywords like PORO and ZCORN, which hold a single array, dominate
+ * the parse time of large decks.  In parallel mode they are not parsed
+ * immediately, but collected and converted concurrently when the parser
+ * encounters a keyword which depends on the deck assembled so far, when
+ * a diagnostic is about to be reported, or at the end of input.  Data
+ * keywords never influence how subsequent keywords are tokenized, so
+ * the deck is identical to the one assembled by the serial parser.
+ */
+bool ParserState::deferKeyword(std::unique_ptr<RawKeyword>& rawKeyword, const ParserKeyword& parserKeyword) {
+    if ((this->num_threads < 2) || !this->ignore_sections.empty())
+        return false;
+
+    if (!parserKeyword.isDataKeyword() ||
+        !parserKeyword.prohibitedKeywords().empty() ||
+        !parserKeyword.requiredKeywords().empty())
+        return false;
+
+    this->deferred.emplace_back( std::move( rawKeyword ), parserKeyword );
+
+    if (this->deferred.size() >= 4 * static_cast<std::size_t>(this->num_threads))
+        this->flushDeferredKeywords();
+
+    return true;
+}
+
+void ParserState::flushDeferredKeywords() {
+    if (this->deferred.empty())
+        return;
+
+    auto keywords = std::move( this->deferred );
+    this->deferred.clear();
+
+    // Create all dimensions in private copies up front so that the
+    // thread local copies are never modified, and apply the effect on
+    // the real unit systems in order when the keywords are added to the
+    // deck.
+    // The serial parser accesses the active unit system once per
+    // keyword.  This access serves the first keyword.
+    auto* active_unitsystem = &this->deck.getActiveUnitSystem();
+    auto& default_unitsystem = this->deck.getDefaultUnitSystem();
+
+    auto shared_active = *active_unitsystem;
+    auto shared_default = default_unitsystem;
+    for (const auto& keyword : keywords) {
+        // Invalid dimensions are reported by the serial fallback.
+        try {
+            addDimensions(*keyword.parserKeyword, shared_active, shared_default);
+        }
+        catch (const std::exception&) {}
+    }
+
+    // A keyword is accepted from a worker thread only if it was parsed
+    // without any diagnostics whatsoever.  Everything else is parsed
+    // once more below, in order and with the real ParseContext and
+    // ErrorGuard, so that messages, warnings and errors are reported
+    // exactly as in serial mode.
+    std::vector<std::optional<DeckKeyword>> parsed(keywords.size());
+
+#pragma omp parallel num_threads(this->num_threads)
+    {
+        auto local_active = shared_active;
+        auto local_default = shared_default;
+        auto local_context = this->parseContext;
+        local_context.update( InputErrorAction::IGNORE );
+
+#pragma omp for schedule(dynamic)
+        for (std::size_t i = 0; i < keywords.size(); ++i) {
+            ErrorGuard local_errors;
+
+            try {
+                InputProfile::Scope profile { "parse", keywords[i].raw_keyword->getKeywordName() };
+                auto deck_keyword = keywords[i].parserKeyword->parse( local_context,
+                                                                      local_errors,
+                                                                      *keywords[i].raw_keyword,
+                                                                      local_active,
+                                                                      local_default );
+                if (!local_errors.hasWarnings())
+                    parsed[i] = std::move( deck_keyword );
+            }
+            catch (const std::exception&) {
+                parsed[i].reset();
+            }
+
+            local_errors.clear();
+        }
+    }
+
+    for (std::size_t i = 0; i < keywords.size(); ++i) {
+        auto& rawKeyword = *keywords[i].raw_keyword;
+        if (i > 0)
+            active_unitsystem = &this->deck.getActiveUnitSystem();
+
+        {
+            const auto& location = rawKeyword.location();
+            auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", this->deck.size(), rawKeyword.getKeywordName(), location.filename, location.lineno);
+            OpmLog::info(msg);
+        }
+
+        if (parsed[i].has_value()) {
+            addDimensions(*keywords[i].parserKeyword, *active_unitsystem, default_unitsystem);
+            this->deck.addKeyword( std::move( parsed[i].value() ) );
+            continue;
+        }
+
+        // The worker consumed the record tokens, re-tokenize the
+        // records before parsing again.
+        std::list<std::string> record_strings;
+        for (auto& record : rawKeyword) {
+            record_strings.push_back( record.getRecordString() );
+            record = RawRecord( record_strings.back(), rawKeyword.location() );
+        }
+
+        try {
+            this->deck.addKeyword( keywords[i].parserKeyword->parse( this->parseContext,
+                                                                     this->errors,
+                                                                     rawKeyword,
+                                                                     *active_unitsystem,
+                                                                     default_unitsystem ) );
+        } catch (const OpmInputError& opm_error) {
+            throw;
+        } catch (const std::exception& e) {
+            rethrowKeywordError(e, rawKeyword.location());
+        }
+    }
+}
+
+void ParserState::setLazyKeywords(bool lazy) {
+    this->lazy_keywords = lazy;
+}
+
+/*
+ * In lazy mode data keywords are added to the deck with their record
+ * strings only, and the typed items are created on first access to the
+ * DeckKeyword.  Data keywords are parsed without reference to the
+ * ParseContext, so any errors are reported as OpmInputError from the
+ * first access.  The unit systems are snapshotted at the point where the
+ * keyword is added, shared between consecutive keywords as long as the
+ * unit systems do not change.
+ */
+bool ParserState::addLazyKeyword(const RawKeyword& rawKeyword, const ParserKeyword& parserKeyword) {
+    if (!this->lazy_keywords)
+        return false;
+
+    if (!parserKeyword.isDataKeyword() ||
+        !parserKeyword.prohibitedKeywords().empty() ||
+        !parserKeyword.requiredKeywords().empty())
+        return false;
+
+    this->flushDeferredKeywords();
+    {
+        const auto& location = rawKeyword.location();
+        auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", this->deck.size(), rawKeyword.getKeywordName(), location.filename, location.lineno);
+        OpmLog::info(msg);
+    }
+
+    try {
+        auto& active_unitsystem = this->deck.getActiveUnitSystem();
+        auto& default_unitsystem = this->deck.getDefaultUnitSystem();
+        addDimensions(parserKeyword, active_unitsystem, default_unitsystem);
+
+        if (!this->lazy_active_unitsystem || !(*this->lazy_active_unitsystem == active_unitsystem))
+            this->lazy_active_unitsystem = std::make_shared<const UnitSystem>( active_unitsystem );
+
+        if (!this->lazy_default_unitsystem || !(*this->lazy_default_unitsystem == default_unitsystem))
+            this->lazy_default_unitsystem = std::make_shared<const UnitSystem>( default_unitsystem );
+
+        this->deck.addKeyword( parserKeyword.parseLazy( rawKeyword,
+                                                        this->lazy_active_unitsystem,
+                                                        this->lazy_default_unitsystem ) );
+    } catch (const OpmInputError& opm_error) {
+        throw;
+    } catch (const std::exception& e) {
+        rethrowKeywordError(e, rawKeyword.location());
+    }
+
+    return true;
 }
 
 /*
@@ -660,27 +1085,29 @@ void ParserState::loadFile(const std::filesystem::path& inputFile) {
  * of the data section of any keyword.
  */
 
-void ParserState::handleRandomText(const std::string_view& keywordString ) const {
-    std::string errorKey;
+void ParserState::handleRandomText(const std::string_view& keywordString ) {
+    this->flushDeferredKeywords();
+
+    ParseContext::Check check;
     std::string trimmedCopy = std::string( keywordString );
     std::string msg;
     KeywordLocation location{lastKeyWord, this->current_path(), this->line()};
 
     if (trimmedCopy == "/") {
-        errorKey = ParseContext::PARSE_RANDOM_SLASH;
+        check = ParseContext::Check::RandomSlash;
         msg = "Extra '/' detected in {file} line {line}";
     }
     else if (lastSizeType == OTHER_KEYWORD_IN_DECK) {
-      errorKey = ParseContext::PARSE_EXTRA_RECORDS;
+      check = ParseContext::Check::ExtraRecords;
       msg = "Too many records in keyword {keyword}\n"
             "In {} line {}";
     }
     else {
-        errorKey = ParseContext::PARSE_RANDOM_TEXT;
+        check = ParseContext::Check::RandomText;
         msg = fmt::format("String {} not formatted as valid keyword\n"
                           "In {{file}} line {{line}}.", keywordString);
     }
-    parseContext.handleError( errorKey , msg, location, errors );
+    parseContext.handleError( check , msg, location, errors );
 }
 
 
@@ -692,7 +1119,7 @@ void ParserState::openRootFile( const std::filesystem::path& inputFile) {
     this->rootPath = inputFileCanonical.parent_path();
 }
 
-std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::string path ) const {
+std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::string path ) {
     static const std::string pathKeywordPrefix("$");
     static const std::string validPathNameCharacters("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
 
@@ -710,6 +1137,7 @@ std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::strin
     if (path.find('\\') != std::string::npos) {
         // ... if so, replace with slashes and create a warning.
         std::replace(path.begin(), path.end(), '\\', '/');
+        this->flushDeferredKeywords();
         OpmLog::warning("Replaced one or more backslash with a slash in an INCLUDE path.");
     }
 
@@ -724,7 +1152,8 @@ std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::strin
     try {
         includeFilePath = std::filesystem::canonical(includeFilePath);
     } catch (const std::filesystem::filesystem_error& fs_error) {
-        parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE ,
+        this->flushDeferredKeywords();
+        parseContext.handleError( ParseContext::Check::MissingInclude ,
                                   fmt::format("File '{}' included via INCLUDE"
                                               " directive does not exist.",
                                               trimmed_path),
@@ -745,12 +1174,20 @@ newRawKeyword(const ParserKeyword& parserKeyword,
               ParserState&         parserState,
               const Parser&        parser)
 {
+    // Keywords which inspect the deck assembled so far must see all
+    // preceding keywords.
+    if (!parserKeyword.prohibitedKeywords().empty() ||
+        !parserKeyword.requiredKeywords().empty() ||
+        (parserKeyword.getSizeType() == OTHER_KEYWORD_IN_DECK) ||
+        (parserKeyword.getSizeType() == SPECIAL_CASE_ROCK))
+        parserState.flushDeferredKeywords();
+
     for (const auto& keyword : parserKeyword.prohibitedKeywords()) {
         if (parserState.deck.hasKeyword(keyword)) {
             parserState
                 .parseContext
                 .handleError(
-                    ParseContext::PARSE_INVALID_KEYWORD_COMBINATION,
+                    ParseContext::Check::InvalidKeywordCombination,
                     fmt::format("Incompatible keyword combination: {} declared when {} is already present.", keywordString, keyword),
                     KeywordLocation { keywordString, parserState.current_path(), parserState.line() } ,
                     parserState.errors
@@ -763,7 +1200,7 @@ newRawKeyword(const ParserKeyword& parserKeyword,
             parserState
                 .parseContext
                 .handleError(
-                    ParseContext::PARSE_INVALID_KEYWORD_COMBINATION,
+                    ParseContext::Check::InvalidKeywordCombination,
                     fmt::format("Incompatible keyword combination: {} declared, but {} is missing.", keywordString, keyword),
                     KeywordLocation { keywordString, parserState.current_path(), parserState.line() } ,
                     parserState.errors
@@ -860,7 +1297,7 @@ newRawKeyword(const ParserKeyword& parserKeyword,
                                      "keyword {0}, {0} was not found",
                                      keyword_size.keyword());
 
-    parserState.parseContext.handleError(ParseContext::PARSE_MISSING_DIMS_KEYWORD,
+    parserState.parseContext.handleError(ParseContext::Check::MissingDimsKeyword,
                                          msg_fmt,
                                          KeywordLocation {
                                              keywordString,
@@ -892,13 +1329,14 @@ newRawKeyword(const std::string&      deck_name,
     if (deck_name.size() > RawConsts::maxKeywordLength) {
         const std::string keyword8 = deck_name.substr(0, RawConsts::maxKeywordLength);
         if (parser.isRecognizedKeyword(keyword8)) {
+            parserState.flushDeferredKeywords();
             const auto msg = std::string {
                 "Keyword {keyword} to long - only eight "
                 "first characters recognized\n"
                 "In {file} line {line}\n"
             };
 
-            parserState.parseContext.handleError(ParseContext::PARSE_LONG_KEYWORD,
+            parserState.parseContext.handleError(ParseContext::Check::LongKeyword,
                                                  msg,
                                                  KeywordLocation {
                                                      deck_name,
@@ -920,6 +1358,7 @@ newRawKeyword(const std::string&      deck_name,
             return newRawKeyword(parserKeyword, deck_name, parserState, parser);
         }
         else {
+            parserState.flushDeferredKeywords();
             parserState.parseContext.handleUnknownKeyword(deck_name,
                                                           KeywordLocation {
                                                               deck_name,
@@ -940,6 +1379,7 @@ newRawKeyword(const std::string&      deck_name,
     }
 
     if (ParserKeyword::validDeckName(deck_name)) {
+        parserState.flushDeferredKeywords();
         parserState.parseContext.handleUnknownKeyword(deck_name,
                                                       KeywordLocation{
                                                           deck_name,
@@ -972,10 +1412,12 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
 
         std::string deck_name = str::make_deck_name( line );
         if (parserState.parseContext.isActiveSkipKeyword(deck_name)) {
+            parserState.flushDeferredKeywords();
             skip = true;
             auto msg = fmt::format("{:5} Reading {:<8} in {} line {} \n      ... ignoring everything until 'ENDSKIP' ... ", "", "SKIP", parserState.current_path().string(), parserState.line());
             OpmLog::info(msg);
         } else if (deck_name == "ENDSKIP") {
+            parserState.flushDeferredKeywords();
             skip = false;
             auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", "", "ENDSKIP", parserState.current_path().string(), parserState.line());
             OpmLog::info(msg);
@@ -1078,8 +1520,13 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
 
             if (str::isTerminatedRecordString(record_buffer)) {
                 std::size_t size = std::distance(record_buffer.begin(), record_buffer.end()) - 1;
-                RawRecord record( std::string_view{ record_buffer.begin(), size }, rawKeyword->location());
-                if (rawKeyword->addRecord(record))
+                const auto record_string = std::string_view{ record_buffer.begin(), size };
+                // The values of data keywords are scanned in bulk by
+                // ParserItem::scan(), so do not split them up front.
+                auto record = parserKeyword->isDataKeyword()
+                    ? RawRecord( record_string, rawKeyword->location(), RawRecord::DeferSplit{} )
+                    : RawRecord( record_string, rawKeyword->location() );
+                if (rawKeyword->addRecord(std::move(record)))
                     return rawKeyword;
 
                 record_buffer = str::emptystr;
@@ -1126,6 +1573,40 @@ void addSectionKeyword(ParserState& parserState, const std::string& keyw)
     }
 }
 
+/*
+ * Everything besides the input files which determines the Deck of a
+ * clean parse: the sections read, the SKIP100/SKIP300 mode and the set
+ * of keywords known to the parser.  The error modes are included as
+ * well, even if they only matter once a diagnostic is raised.
+ */
+std::string deckCacheKey(const Parser& parser, const ParseContext& parseContext,
+                         const std::vector<Opm::Ecl::SectionType>& sections)
+{
+    std::set<Opm::Ecl::SectionType> read_sections(sections.begin(), sections.end());
+    std::string key = "sections:";
+    for (const auto& section : read_sections)
+        key += fmt::format("{},", static_cast<int>(section));
+
+    key += fmt::format(";skip:{}{}", parseContext.isActiveSkipKeyword("SKIP100"),
+                                     parseContext.isActiveSkipKeyword("SKIP300"));
+
+    key += ";modes:";
+    for (const auto& [error_key, action] : parseContext)
+        key += fmt::format("{}={},", error_key, static_cast<int>(action));
+
+    auto deck_names = parser.getAllDeckNames();
+    std::sort(deck_names.begin(), deck_names.end());
+    std::string names;
+    for (const auto& name : deck_names)
+        names += name + ',';
+
+    for (const auto& [keyword, end] : parser.codeKeywords())
+        names += keyword + ':' + end + ',';
+
+    key += fmt::format(";keywords:{:016x}", std::hash<std::string>{}(names));
+    return key;
+}
+
 void cleanup_deck_keyword_list(ParserState& parserState, const std::set<Opm::Ecl::SectionType>& ignore)
 {
     bool ignore_runspec = ignore.find(Opm::Ecl::RUNSPEC) !=ignore.end()  ? true : false;
@@ -1289,8 +1770,16 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         ignore_solution = false;
     
     while( !parserState.done() ) {
-        
-        auto rawKeyword = tryParseKeyword( parserState, parser);
+
+        std::unique_ptr<RawKeyword> rawKeyword;
+        try {
+            rawKeyword = tryParseKeyword( parserState, parser);
+        } catch (const std::exception&) {
+            // Errors in deferred keywords precede this one.
+            parserState.flushDeferredKeywords();
+            throw;
+        }
+
         bool do_not_add = false;
          
         if( !rawKeyword )
@@ -1364,8 +1853,10 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             return true;
         }
         
-        if (rawKeyword->getKeywordName() == Opm::RawConsts::end)
+        if (rawKeyword->getKeywordName() == Opm::RawConsts::end) {
+            parserState.flushDeferredKeywords();
             return true;
+        }
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::endinclude) {
             parserState.closeFile();
@@ -1398,6 +1889,13 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if( parser.isRecognizedKeyword( rawKeyword->getKeywordName() ) ) {
             const auto& kwname = rawKeyword->getKeywordName();
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
+            if (parserState.addLazyKeyword( *rawKeyword, parserKeyword ))
+                continue;
+
+            if (parserState.deferKeyword( rawKeyword, parserKeyword ))
+                continue;
+
+            parserState.flushDeferredKeywords();
             {
                 const auto& location = rawKeyword->location();
                 auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
@@ -1413,6 +1911,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                         throw std::logic_error("Cannot yet embed Python while still running Python.");
                 }
                 else {
+                    InputProfile::Scope profile { "parse", kwname };
                     auto deck_keyword = parserKeyword.parse( parserState.parseContext,
                                                              parserState.errors,
                                                              *rawKeyword,
@@ -1433,29 +1932,17 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             } catch (const OpmInputError& opm_error) {
                 throw;
             } catch (const std::exception& e) {
-                /*
-                  This catch-all of parsing errors is to be able to write a good
-                  error message; the parser is quite confused at this state and
-                  we should not be tempted to continue the parsing.
-
-                  We log a error message with the name of the problematic
-                  keyword and the location in the input deck. We rethrow the
-                  same exception without updating the what() message of the
-                  exception.
-                */
-                const OpmInputError opm_error { e, rawKeyword->location() } ;
-
-                OpmLog::error(opm_error.what());
-
-                std::throw_with_nested(opm_error);
+                rethrowKeywordError(e, rawKeyword->location());
             }
         } else {
+            parserState.flushDeferredKeywords();
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
             KeywordLocation location(rawKeyword->getKeywordName(), parserState.current_path().string(), parserState.line());
             OpmLog::warning(Log::fileMessage(location, msg));
         }
     }
 
+    parserState.flushDeferredKeywords();
     return true;
 }
 
@@ -1535,7 +2022,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     Deck Parser::parseFile(const std::string &dataFileName, const ParseContext& parseContext,
                            ErrorGuard& errors, const std::vector<Opm::Ecl::SectionType>& sections) const {
 
-        
+        InputProfile::Phase profile { "Parser::parseFile" };
         std::set<Opm::Ecl::SectionType> ignore_sections;
 
         if (sections.size() > 0) {
@@ -1569,7 +2056,34 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         else
             data_file = std::filesystem::proximate( std::filesystem::canonical(dataFileName) );
 
+        std::optional<DeckCache> cache;
+        std::string cache_key;
+        if (!this->m_deck_cache_dir.empty()) {
+            cache.emplace( this->m_deck_cache_dir );
+            cache_key = deckCacheKey( *this, parseContext, sections );
+
+            // Hash the input files concurrently; the snapshot is checked
+            // against the files found without parsing.
+            std::optional<Deck> deck;
+            try {
+                const auto manifest = InputFileManifest::create( data_file, this->m_num_threads );
+                deck = cache->load( data_file, cache_key, manifest );
+            }
+            catch (const std::exception&) {
+                deck = cache->load( data_file, cache_key );
+            }
+
+            if (deck.has_value()) {
+                OpmLog::info(fmt::format("Loaded {} from snapshot {}", data_file,
+                                         cache->snapshotPath( data_file, cache_key ).string()));
+                return std::move( deck.value() );
+            }
+        }
+
         ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections);
+        parserState.setNumThreads( this->m_num_threads );
+        parserState.setLazyKeywords( this->m_lazy_keywords );
+        parserState.prefetchIncludeFiles();
         parseState( parserState, *this );
         
         auto ignore = parserState.get_ignore();
@@ -1577,6 +2091,9 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if (ignore.size() > 0)
             cleanup_deck_keyword_list(parserState, ignore);
 
+        if (cache.has_value() && !errors && !errors.hasWarnings())
+            cache->store( data_file, cache_key, parserState.deck, parserState.input_files );
+
         return std::move( parserState.deck );
     }
 
@@ -1602,7 +2119,9 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
 
     Deck Parser::parseString(const std::string &data, const ParseContext& parseContext, ErrorGuard& errors) const {
+        InputProfile::Phase profile { "Parser::parseString" };
         ParserState parserState( this->codeKeywords(), parseContext, errors );
+        parserState.setLazyKeywords( this->m_lazy_keywords );
         parserState.loadString( data );
         parseState( parserState, *this );
         return std::move( parserState.deck );
@@ -1618,19 +2137,104 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseString(data, ParseContext(), errors);
     }
 
+    void Parser::setNumThreads(int numThreads) {
+        this->m_num_threads = numThreads;
+    }
+
+    int Parser::numThreads() const {
+        return this->m_num_threads;
+    }
+
+    void Parser::setLazyKeywords(bool lazy) {
+        this->m_lazy_keywords = lazy;
+    }
+
+    bool Parser::lazyKeywords() const {
+        return this->m_lazy_keywords;
+    }
+
+    void Parser::setDeckCacheDirectory(const std::filesystem::path& directory) {
+        this->m_deck_cache_dir = directory;
+    }
+
+    const std::filesystem::path& Parser::deckCacheDirectory() const {
+        return this->m_deck_cache_dir;
+    }
+
     size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        return m_deckParserKeywords.size()
+            + std::count_if(m_lazyParserKeywords.begin(), m_lazyParserKeywords.end(),
+                            [this](const auto& lazy)
+                            {
+                                return m_deckParserKeywords.count(lazy.first) == 0;
+                            });
+    }
+
+    const ParserKeyword* Parser::lazyKeyword(std::string_view deckName) const
+    {
+        const auto lazy = this->m_lazyParserKeywords.find(deckName);
+        if (lazy == this->m_lazyParserKeywords.end())
+            return nullptr;
+
+        const auto& entry = *lazy->second;
+        auto keyword = std::atomic_load(&entry.keyword);
+        if (keyword == nullptr) {
+            // Several threads may race to create the keyword; all but the
+            // first one to publish it discard their copy.
+            auto created = std::shared_ptr<const ParserKeyword>
+                { std::make_shared<ParserKeyword>(entry.create()) };
+
+            if (std::atomic_compare_exchange_strong(&entry.keyword, &keyword, created))
+                keyword = std::move(created);
+        }
+
+        return keyword.get();
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const
     {
-        const auto it = std::find_if(m_wildCardKeywords.begin(),
-                                     m_wildCardKeywords.end(),
-                                     [&name](const auto& wild)
+        if (name.empty())
+            return nullptr;
+
+        const auto bucket = this->m_wildCardIndex.find(name.front());
+        const auto& candidates = (bucket != this->m_wildCardIndex.end())
+            ? bucket->second
+            : this->m_unindexedWildCardKeywords;
+
+        const auto it = std::find_if(candidates.begin(), candidates.end(),
+                                     [&name](const ParserKeyword* wild)
                                      {
-                                         return wild.second->matches(name);
+                                         return wild->matches(name);
                                      });
-        return it != m_wildCardKeywords.end() ? it->second : nullptr;
+        return it != candidates.end() ? *it : nullptr;
+    }
+
+    void Parser::indexWildCardKeywords()
+    {
+        this->m_wildCardIndex.clear();
+        this->m_unindexedWildCardKeywords.clear();
+
+        std::vector<std::pair<const ParserKeyword*, std::optional<std::string>>> leading;
+        for (const auto& wild : this->m_wildCardKeywords) {
+            leading.emplace_back(wild.second, wild.second->deckNameLeadingCharacters());
+            if (leading.back().second.has_value()) {
+                for (const auto c : *leading.back().second)
+                    this->m_wildCardIndex[c];
+            }
+        }
+
+        for (const auto& [keyword, chars] : leading) {
+            if (chars.has_value()) {
+                for (const auto c : *chars)
+                    this->m_wildCardIndex[c].push_back(keyword);
+            }
+            else {
+                for (auto& bucket : this->m_wildCardIndex)
+                    bucket.second.push_back(keyword);
+
+                this->m_unindexedWildCardKeywords.push_back(keyword);
+            }
+        }
     }
 
     bool Parser::hasWildCardKeyword(const std::string& internalKeywordName) const {
@@ -1644,13 +2248,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
 
         return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+            || (this->m_lazyParserKeywords.find(name) != this->m_lazyParserKeywords.end())
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
         return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+            && ((this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+                || (this->m_lazyParserKeywords.find(name) != this->m_lazyParserKeywords.end()));
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1681,6 +2287,7 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
     if (ptr->hasMatchRegex()) {
         std::string_view name( ptr->getName() );
         m_wildCardKeywords[ name ] = ptr;
+        this->indexWildCardKeywords();
     }
 
     if (ptr->isCodeKeyword())
@@ -1688,13 +2295,27 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
 }
 
 
+void Parser::addLazyParserKeyword(std::vector<std::string> deckNames,
+                                  ParserKeyword (*create)())
+{
+    this->lazy_keyword_storage.push_back( LazyKeyword{ std::move( deckNames ), create } );
+    const auto* ptr = std::addressof(this->lazy_keyword_storage.back());
+    for (const auto& deck_name : ptr->deck_names) {
+        // The most recently added keyword wins, as in addParserKeyword().
+        m_deckParserKeywords.erase(deck_name);
+        m_lazyParserKeywords[deck_name] = ptr;
+    }
+}
+
 void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
     addParserKeyword( ParserKeyword( jsonKeyword ) );
 }
 
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return (this->m_deckParserKeywords.find( std::string_view( name ) )
+            != this->m_deckParserKeywords.end())
+        || (this->m_lazyParserKeywords.find( std::string_view( name ) )
+            != this->m_lazyParserKeywords.end());
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1706,6 +2327,8 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view
 
     if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
 
+    if( const auto* lazy = lazyKeyword( name ); lazy != nullptr ) return *lazy;
+
     const auto* wildCardKeyword = matchingKeyword( name );
 
     if ( !wildCardKeyword )
@@ -1719,6 +2342,10 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
+    for (const auto& lazy : m_lazyParserKeywords) {
+        if (m_deckParserKeywords.count(lazy.first) == 0)
+            keywords.emplace_back(lazy.first);
+    }
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
@@ -1773,20 +2400,14 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     }
 
 
-#if 0
     void Parser::applyUnitsToDeck(Deck& deck) const {
+        const auto num_keywords = static_cast<std::ptrdiff_t>(deck.size());
+        const auto keywords = deck.begin();
 
-        for( auto& deckKeyword : deck ) {
-
-            if( !isRecognizedKeyword( deckKeyword.name() ) ) continue;
-
-            const auto& parserKeyword = getParserKeywordFromDeckName( deckKeyword.name() );
-            if( !parserKeyword.hasDimension() ) continue;
-
-            parserKeyword.applyUnitsToDeck(deck , deckKeyword);
-        }
+#pragma omp parallel for schedule(dynamic) num_threads(this->m_num_threads)
+        for (std::ptrdiff_t index = 0; index < num_keywords; ++index)
+            (keywords + index)->convertToSI();
     }
-#endif
 
 
     static bool isSectionDelimiter( const DeckKeyword& keyword )
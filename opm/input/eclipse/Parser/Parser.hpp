@@ -26,6 +26,8 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -79,6 +81,47 @@ namespace Opm {
 
         Deck parseFile(const std::string& datafile) const;
 
+        /// Number of threads used by parseFile().
+        ///
+        /// With more than one thread, the INCLUDE files reachable from the
+        /// DATA file are read and preprocessed concurrently ahead of the
+        /// parser, and consecutive data keywords such as PORO or ZCORN
+        /// are converted to DeckKeywords in parallel.  The resulting Deck
+        /// and all diagnostics reported through ParseContext/ErrorGuard
+        /// are identical to those of the serial parser.  Zero selects the
+        /// OpenMP default number of threads.  Default value is one, i.e.,
+        /// serial parsing.
+        void setNumThreads(int numThreads);
+        int numThreads() const;
+
+        /// Whether parseFile() and parseString() create data keywords lazily.
+        ///
+        /// In lazy mode data keywords such as PORO or ZCORN keep a copy of
+        /// their record text in the Deck, and the typed records and items
+        /// are only created on the first access to the DeckKeyword, e.g.,
+        /// through DeckView or DeckSection.  Consumers which only use a
+        /// few sections, e.g., schedule-only tools, never pay for parsing
+        /// the large grid and property arrays.  Since the data is not
+        /// parsed up front, malformed data is reported as an OpmInputError
+        /// from the first access rather than through ParseContext and
+        /// ErrorGuard.  The first access is not thread safe.  Default
+        /// value is false, i.e., all keywords are parsed immediately.
+        void setLazyKeywords(bool lazy);
+        bool lazyKeywords() const;
+
+        /// Directory of binary Deck snapshots used by parseFile().
+        ///
+        /// When set, parseFile() stores a snapshot of every Deck which
+        /// was parsed without warnings or errors, keyed by the DATA file,
+        /// the requested sections and the parser configuration.  Later
+        /// parseFile() calls load the snapshot instead of parsing the
+        /// deck as long as none of the DATA and INCLUDE files have
+        /// changed.  Decks with diagnostics are never stored since the
+        /// snapshot does not reproduce them.  An empty path, the
+        /// default, disables the snapshots.  See DeckCache.
+        void setDeckCacheDirectory(const std::filesystem::path& directory);
+        const std::filesystem::path& deckCacheDirectory() const;
+
         Deck parseString(const std::string &data,
                          const ParseContext&,
                          ErrorGuard& errors) const;
@@ -91,6 +134,15 @@ namespace Opm {
         void addParserKeyword(const Json::JsonObject& jsonKeyword);
         void addParserKeyword(ParserKeyword parserKeyword);
 
+        /// Register a keyword which is only constructed, by calling \p
+        /// create, the first time one of \p deckNames is looked up.  Used
+        /// for the builtin keywords so that short lived tools do not pay
+        /// for building the records and items of every known keyword.
+        /// Keywords matching a regular expression or delimiting code
+        /// sections must be added with addParserKeyword().
+        void addLazyParserKeyword(std::vector<std::string> deckNames,
+                                  ParserKeyword (*create)());
+
         /*!
          * \brief Returns whether the parser knows about a keyword
          */
@@ -128,6 +180,13 @@ namespace Opm {
         bool loadKeywordFromFile(const std::filesystem::path& configFile);
 
         void loadKeywordsFromDirectory(const std::filesystem::path& directory , bool recursive = true);
+
+        /// Convert all double items with dimensions in \p deck to SI units
+        /// up front, in parallel over the keywords with the number of
+        /// threads set by setNumThreads().  Afterwards
+        /// DeckItem::getSIDoubleData() is a plain read, so the deck can be
+        /// read from several threads.  Keywords created lazily, see
+        /// setLazyKeywords(), are converted on first access as before.
         void applyUnitsToDeck(Deck& deck) const;
 
         /*!
@@ -171,19 +230,43 @@ namespace Opm {
     private:
         bool hasWildCardKeyword(const std::string& keyword) const;
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
+        void indexWildCardKeywords();
+        const ParserKeyword* lazyKeyword(std::string_view deckName) const;
         void addDefaultKeywords();
 
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage;
 
         // associative map of deck names and the corresponding ParserKeyword object
-        std::map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
+        std::unordered_map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
 
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
 
+        // the wildcard keywords, in the order of m_wildCardKeywords, which
+        // may match a deck name starting with a given character.  Keywords
+        // whose leading characters can not be determined are listed under
+        // every character and in m_unindexedWildCardKeywords.
+        std::unordered_map< char, std::vector< const ParserKeyword* > > m_wildCardIndex;
+        std::vector< const ParserKeyword* > m_unindexedWildCardKeywords;
+
+        // keywords registered with addLazyParserKeyword().  The keyword is
+        // created on first lookup and published through an atomic
+        // shared_ptr store, so concurrent lookups are safe.
+        struct LazyKeyword {
+            std::vector<std::string> deck_names;
+            ParserKeyword (*create)();
+            mutable std::shared_ptr<const ParserKeyword> keyword{};
+        };
+        std::list<LazyKeyword> lazy_keyword_storage;
+        std::unordered_map< std::string_view, const LazyKeyword* > m_lazyParserKeywords;
+
         std::vector<std::pair<std::string,std::string>> code_keywords;
+
+        int m_num_threads{1};
+        bool m_lazy_keywords{false};
+        std::filesystem::path m_deck_cache_dir{};
     };
 
 } // namespace Opm
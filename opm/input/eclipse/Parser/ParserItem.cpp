@@ -21,6 +21,9 @@
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <optional>
+#include <type_traits>
+#include <vector>
 
 #include <opm/json/JsonObject.hpp>
 
@@ -472,6 +475,24 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, double>) {
+            // Data records of numeric keywords, e.g. PORO or ZCORN, are
+            // scanned in one pass without splitting them into tokens.
+            if (record.isDeferred()) {
+                std::optional<T> default_value;
+                if (parser_item.hasDefault())
+                    default_value = parser_item.getDefault< T >();
+
+                std::vector<T> values;
+                std::vector<value::status> status;
+                if (scanNumericArray(record.deferredString(), default_value, values, status)) {
+                    record.consumeDeferred();
+                    deck_item.push_back( std::move(values), std::move(status) );
+                    return;
+                }
+            }
+        }
+
         while( record.size() > 0 ) {
             auto token = record.pop_front();
 
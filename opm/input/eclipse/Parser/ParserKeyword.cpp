@@ -23,19 +23,80 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <opm/json/JsonObject.hpp>
 
+#include <opm/common/utility/OpmInputError.hpp>
+
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserConst.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Parser/ParserRecord.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
 
 #include "raw/RawConsts.hpp"
 #include "raw/RawKeyword.hpp"
 #include "raw/RawRecord.hpp"
 
+namespace {
+
+// Scan the alternatives of the regular expression 'pattern' and append the
+// characters a matching string may start with to 'leading'.  Every '|' is
+// treated as the start of an alternative, which may add characters which
+// can not actually start a match but never misses one.  Returns false for
+// patterns where the leading character is not a plain, non-optional
+// literal.
+bool appendLeadingCharacters(const std::string& pattern, std::string& leading)
+{
+    if (pattern.find('\\') != std::string::npos)
+        return false;
+
+    const auto optional = [&pattern](const std::size_t pos)
+    {
+        return (pos < pattern.size())
+            && (std::string_view { "?*{" }.find(pattern[pos]) != std::string_view::npos);
+    };
+
+    auto start = std::size_t{0};
+    while (true) {
+        auto pos = start;
+        while ((pos < pattern.size()) && (pattern[pos] == '(')) {
+            auto depth = 0;
+            auto close = pos;
+            for (; close < pattern.size(); ++close) {
+                if (pattern[close] == '(')
+                    ++depth;
+                else if ((pattern[close] == ')') && (--depth == 0))
+                    break;
+            }
+
+            if ((close == pattern.size()) || optional(close + 1))
+                return false;
+
+            ++pos;
+        }
+
+        if ((pos == pattern.size()) || !std::isalnum(static_cast<unsigned char>(pattern[pos])) || optional(pos + 1))
+            return false;
+
+        if (leading.find(pattern[pos]) == std::string::npos)
+            leading.push_back(pattern[pos]);
+
+        start = pattern.find('|', start);
+        if (start == std::string::npos)
+            return true;
+
+        ++start;
+    }
+}
+
+}
+
 namespace Opm {
 KeywordSize::KeywordSize(const std::string& in_keyword, const std::string& in_item, int in_shift)
     : KeywordSize(in_keyword, in_item, false, in_shift)
@@ -777,6 +838,60 @@ void set_dimensions( ParserItem& item,
             }
         }
 
+        this->setKeywordSize( keyword );
+        return keyword;
+    }
+
+    DeckKeyword ParserKeyword::parseLazy(const RawKeyword& rawKeyword,
+                                         std::shared_ptr<const UnitSystem> active_unitsystem,
+                                         std::shared_ptr<const UnitSystem> default_unitsystem) const {
+
+        if( !this->isDataKeyword() )
+            throw std::logic_error("Only data keywords can be parsed lazily, not " + rawKeyword.getKeywordName());
+
+        if( !rawKeyword.isFinished() )
+            throw std::invalid_argument("Tried to create a deck keyword from an incomplete raw keyword " + rawKeyword.getKeywordName());
+
+        DeckKeyword keyword( rawKeyword.location(), rawKeyword.getKeywordName() );
+        keyword.setDataKeyword( true );
+        this->setKeywordSize( keyword );
+
+        std::vector<std::string> record_strings;
+        for (const auto& rawRecord : rawKeyword)
+            record_strings.push_back( rawRecord.getRecordString() );
+
+        keyword.setPendingRecords(
+            [record_strings = std::move(record_strings),
+             parserRecord = this->m_records.front(),
+             location = rawKeyword.location(),
+             active_unitsystem = std::move(active_unitsystem),
+             default_unitsystem = std::move(default_unitsystem)]()
+        {
+            // Dimensions are created while parsing, so work on copies.
+            auto active = *active_unitsystem;
+            auto default_units = *default_unitsystem;
+            const ParseContext parseContext( InputErrorAction::THROW_EXCEPTION );
+            ErrorGuard errors;
+
+            std::vector<DeckRecord> records;
+            try {
+                for (const auto& record_string : record_strings) {
+                    RawRecord rawRecord( record_string, location, RawRecord::DeferSplit{} );
+                    records.push_back( parserRecord.parse( parseContext, errors, rawRecord, active, default_units, location ) );
+                }
+            } catch (const OpmInputError&) {
+                throw;
+            } catch (const std::exception& e) {
+                throw OpmInputError( e, location );
+            }
+
+            return records;
+        });
+
+        return keyword;
+    }
+
+    void ParserKeyword::setKeywordSize(DeckKeyword& keyword) const {
         if (this->hasFixedSize( ))
             keyword.setFixedSize( );
 
@@ -788,8 +903,6 @@ void set_dimensions( ParserItem& item,
 
         if (kw_size.size_type() == UNKNOWN)
             keyword.setFixedSize( );
-
-        return keyword;
     }
 
     std::optional<std::size_t> ParserKeyword::min_size() const {
@@ -909,6 +1022,20 @@ void set_dimensions( ParserItem& item,
         return false;
     }
 
+    std::optional<std::string> ParserKeyword::deckNameLeadingCharacters() const
+    {
+        auto leading = std::string{};
+        for (const auto& deckName : this->m_deckNames) {
+            if (! appendLeadingCharacters(deckName, leading))
+                return std::nullopt;
+        }
+
+        if (hasMatchRegex() && !appendLeadingCharacters(m_matchRegexString, leading))
+            return std::nullopt;
+
+        return leading;
+    }
+
     bool ParserKeyword::matchesDeckNames(std::string_view name) const
     {
         const auto nameStr = std::string { name };
@@ -20,6 +20,7 @@
 #define PARSER_KEYWORD_H
 
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <regex>
 #include <string>
@@ -98,6 +99,11 @@ namespace Opm {
         void setMatchRegex(const std::string& deckNameRegexp);
         void setMatchRegexSuffix(const std::string& deckNameRegexp);
         bool matches(const std::string_view& ) const;
+
+        // Characters which a deck name accepted by matches() may start
+        // with, or nullopt if that can not be determined from the deck
+        // names and the match regex by a simple scan.
+        std::optional<std::string> deckNameLeadingCharacters() const;
         bool hasDimension() const;
         void addRecord( ParserRecord );
         void addDataRecord( ParserRecord );
@@ -132,6 +138,16 @@ namespace Opm {
         const std::unordered_set<std::string>& sections() const;
 
         DeckKeyword parse(const ParseContext& parseContext, ErrorGuard& errors, RawKeyword& rawKeyword, UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const;
+
+        /// Deck keyword which keeps a copy of the raw record strings and
+        /// only parses them once the records are first accessed.  Only
+        /// supported for data keywords, whose single item consumes the
+        /// entire record so that parsing never depends on a ParseContext.
+        /// Errors in the data are reported as OpmInputError from the
+        /// first access instead of from the parser.
+        DeckKeyword parseLazy(const RawKeyword& rawKeyword,
+                              std::shared_ptr<const UnitSystem> active_unitsystem,
+                              std::shared_ptr<const UnitSystem> default_unitsystem) const;
         enum ParserKeywordSizeEnum getSizeType() const;
         const KeywordSize& getKeywordSize() const;
         bool isDataKeyword() const;
@@ -179,6 +195,7 @@ namespace Opm {
         void addItems( const Json::JsonObject& jsonConfig);
         void parseRecords( const Json::JsonObject& recordsConfig);
         bool matchesDeckNames(std::string_view name) const;
+        void setKeywordSize(DeckKeyword& keyword) const;
     };
 
 std::ostream& operator<<( std::ostream&, const ParserKeyword& );
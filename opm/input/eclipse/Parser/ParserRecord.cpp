@@ -142,7 +142,7 @@ namespace {
             std::string msg_format = fmt::format("Record contains too many items in keyword {{0}}. Expected {} items, found {}.\n", this->size(), rawRecord.max_size()) +
                                                  "In file {1} at line {2}.\n" +
                                      fmt::format("Record is \"{}\".", rawRecord.getRecordString());
-            parseContext.handleError(ParseContext::PARSE_EXTRA_DATA , msg_format, location, errors);
+            parseContext.handleError(ParseContext::Check::ExtraData , msg_format, location, errors);
         }
 
         return DeckRecord{ std::move( items ), false };
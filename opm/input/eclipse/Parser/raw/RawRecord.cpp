@@ -101,7 +101,36 @@ inline bool even_quotes( const T& str ) {
         RawRecord(singleRecordString, location, false)
     {}
 
+    RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location, DeferSplit) :
+        m_sanitizedRecordString( singleRecordString ),
+        m_max_size( 0 ),
+        m_deferred( true )
+    {
+        if( !even_quotes( singleRecordString ) ) {
+            std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
+            throw OpmInputError(error, location);
+        }
+    }
+
+    void RawRecord::split() const {
+        this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
+        this->m_max_size = this->m_recordItems.size();
+        this->m_deferred = false;
+    }
+
+    void RawRecord::consumeDeferred() {
+        this->m_deferred = false;
+    }
+
+    bool RawRecord::empty() const {
+        if (this->m_deferred)
+            return std::all_of( m_sanitizedRecordString.begin(), m_sanitizedRecordString.end(), RawConsts::is_separator() );
+
+        return this->m_recordItems.empty();
+    }
+
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
+        if (this->m_deferred) this->split();
         this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
         this->m_max_size += count;
     }
@@ -111,6 +140,7 @@ inline bool even_quotes( const T& str ) {
     }
 
     std::size_t RawRecord::max_size() const {
+        if (this->m_deferred) this->split();
         return this->m_max_size;
     }
 }
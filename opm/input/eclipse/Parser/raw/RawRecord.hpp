@@ -35,22 +35,43 @@ class KeywordLocation;
 
     class RawRecord {
     public:
+        /// Tag selecting deferred splitting of the record string.
+        struct DeferSplit {};
+
         RawRecord( const std::string_view&, const KeywordLocation&, bool text);
         explicit RawRecord( const std::string_view&, const KeywordLocation&);
 
+        /// Record whose string is only split into items once the items
+        /// are accessed.  Used for the data records of numeric keywords
+        /// like PORO and ZCORN, whose values are typically scanned in
+        /// bulk from deferredString() without ever creating the items.
+        RawRecord( const std::string_view&, const KeywordLocation&, DeferSplit);
+
         inline std::string_view pop_front();
         inline std::string_view front() const;
         void push_front( std::string_view token, std::size_t count );
         inline size_t size() const;
+        bool empty() const;
         std::size_t max_size() const;
 
         std::string getRecordString() const;
         inline std::string_view getItem(size_t index) const;
 
+        /// Whether the record string has not yet been split into items.
+        bool isDeferred() const { return this->m_deferred; }
+
+        /// Record string of a deferred record.  Call consumeDeferred()
+        /// once all values have been scanned from it.
+        std::string_view deferredString() const { return this->m_sanitizedRecordString; }
+        void consumeDeferred();
+
     private:
+        void split() const;
+
         std::string_view m_sanitizedRecordString;
-        std::deque< std::string_view > m_recordItems;
-        std::size_t m_max_size;
+        mutable std::deque< std::string_view > m_recordItems;
+        mutable std::size_t m_max_size;
+        mutable bool m_deferred = false;
     };
 
     /*
@@ -58,20 +79,24 @@ class KeywordLocation;
      * inlining the calls gives a decent low-effort performance benefit.
      */
     std::string_view RawRecord::pop_front() {
+        if (this->m_deferred) this->split();
         auto result = m_recordItems.front();
         this->m_recordItems.pop_front();
         return result;
     }
 
     std::string_view RawRecord::front() const {
+        if (this->m_deferred) this->split();
         return this->m_recordItems.front();
     }
 
     size_t RawRecord::size() const {
+        if (this->m_deferred) this->split();
         return m_recordItems.size();
     }
 
     std::string_view RawRecord::getItem(size_t index) const {
+        if (this->m_deferred) this->split();
         return this->m_recordItems.at( index );
     }
 }
@@ -20,6 +20,7 @@
 #include <array>
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <string>
 #include <stdexcept>
 #include <cstdlib>
@@ -28,10 +29,112 @@
 
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 
+#include "RawConsts.hpp"
 #include "StarToken.hpp"
 
 namespace qi = boost::spirit::qi;
 
+namespace {
+
+    bool is_digit(const char c) {
+        return (c >= '0') && (c <= '9');
+    }
+
+    // Powers of ten which are exactly representable as double.
+    constexpr std::array<double, 23> exact_pow10 = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+
+    // Plain decimal integers of at most nine digits, which can not
+    // overflow.  Everything else is left to readValueToken<int>().
+    bool fast_read(std::string_view token, int& value) {
+        auto p = token.begin();
+        bool negative = false;
+        if (p != token.end() && (*p == '+' || *p == '-'))
+            negative = (*p++ == '-');
+
+        const auto digits = std::distance(p, token.end());
+        if (digits == 0 || digits > 9)
+            return false;
+
+        int n = 0;
+        for (; p != token.end(); ++p) {
+            if (!is_digit(*p))
+                return false;
+            n = 10*n + (*p - '0');
+        }
+
+        value = negative ? -n : n;
+        return true;
+    }
+
+    // Decimal numbers [+-]ddd[.ddd][(e|E|d|D)[+-]ddd] whose mantissa is
+    // below 2^53 and whose decimal exponent is at most 22 in magnitude.
+    // Both factors are then exact, so the conversion is a single
+    // correctly rounded multiplication or division.  This is what the
+    // Boost.Spirit parser in readValueToken<double>() computes for these
+    // numbers, and the remaining cases like 1e300 or long mantissas are
+    // left to it.
+    bool fast_read(std::string_view token, double& value) {
+        auto p = token.begin();
+        const auto end = token.end();
+
+        bool negative = false;
+        if (p != end && (*p == '+' || *p == '-'))
+            negative = (*p++ == '-');
+
+        std::uint64_t mantissa = 0;
+        int num_digits = 0;
+        int frac_digits = 0;
+        for (; p != end && is_digit(*p); ++p, ++num_digits)
+            mantissa = 10*mantissa + (*p - '0');
+
+        if (p != end && *p == '.') {
+            for (++p; p != end && is_digit(*p); ++p, ++num_digits, ++frac_digits)
+                mantissa = 10*mantissa + (*p - '0');
+        }
+
+        // At most 18 digits can not overflow the accumulator.
+        if (num_digits == 0 || num_digits > 18 || mantissa > (std::uint64_t{1} << 53))
+            return false;
+
+        int exponent = 0;
+        if (p != end) {
+            if (*p != 'e' && *p != 'E' && *p != 'd' && *p != 'D')
+                return false;
+
+            ++p;
+            bool negative_exponent = false;
+            if (p != end && (*p == '+' || *p == '-'))
+                negative_exponent = (*p++ == '-');
+
+            const auto exp_begin = p;
+            for (; p != end && is_digit(*p) && (p - exp_begin) < 4; ++p)
+                exponent = 10*exponent + (*p - '0');
+
+            if (p == exp_begin || p != end)
+                return false;
+
+            if (negative_exponent)
+                exponent = -exponent;
+        }
+
+        exponent -= frac_digits;
+        if (exponent < -22 || exponent > 22)
+            return false;
+
+        const auto n = static_cast<double>(mantissa);
+        value = (exponent >= 0) ? n * exact_pow10[exponent] : n / exact_pow10[-exponent];
+        if (negative)
+            value = -value;
+
+        return true;
+    }
+
+}
+
 namespace Opm {
 
     bool isStarToken(const std::string_view& token,
@@ -158,4 +261,83 @@ namespace Opm {
         }
     }
 
+    template <class T>
+    bool scanNumericArray( std::string_view record,
+                           const std::optional<T>& defaultValue,
+                           std::vector<T>& values,
+                           std::vector<value::status>& status ) {
+        const auto append = [&values, &status](const T& value, const std::size_t count, const value::status s) {
+            values.insert(values.end(), count, value);
+            status.insert(status.end(), count, s);
+        };
+
+        auto current = record.begin();
+        const auto end = record.end();
+        while ((current = std::find_if_not(current, end, RawConsts::is_separator())) != end) {
+            if (*current == RawConsts::quote)
+                return false;
+
+            const auto token_end = std::find_if(current, end, RawConsts::is_separator());
+            const auto token = record.substr(std::distance(record.begin(), current),
+                                             std::distance(current, token_end));
+            current = token_end;
+
+            T value;
+            if (fast_read(token, value)) {
+                values.push_back(value);
+                status.push_back(value::status::deck_value);
+                continue;
+            }
+
+            // Repeat counts "N*value" and "N*" with a count of at most
+            // nine digits.
+            const auto star = std::find_if_not(token.begin(), token.end(), is_digit);
+            const auto count_digits = std::distance(token.begin(), star);
+            if (star != token.end() && *star == '*' && count_digits > 0 && count_digits < 10) {
+                std::size_t count = 0;
+                for (auto p = token.begin(); p != star; ++p)
+                    count = 10*count + (*p - '0');
+
+                const auto value_string = token.substr(count_digits + 1);
+                if (count > 0 && value_string.empty()) {
+                    if (defaultValue.has_value())
+                        append(*defaultValue, count, value::status::valid_default);
+                    else
+                        append(T(), count, value::status::empty_default);
+                    continue;
+                }
+
+                if (count > 0 && fast_read(value_string, value)) {
+                    append(value, count, value::status::deck_value);
+                    continue;
+                }
+            }
+
+            // Everything else, including malformed tokens, goes through
+            // the regular token parser.
+            std::string countString;
+            std::string valueString;
+            if (!isStarToken(token, countString, valueString)) {
+                values.push_back(readValueToken<T>(token));
+                status.push_back(value::status::deck_value);
+                continue;
+            }
+
+            StarToken st(token, countString, valueString);
+            if (st.hasValue())
+                append(readValueToken<T>(st.valueString()), st.count(), value::status::deck_value);
+            else if (defaultValue.has_value())
+                append(*defaultValue, st.count(), value::status::valid_default);
+            else
+                append(T(), st.count(), value::status::empty_default);
+        }
+
+        return true;
+    }
+
+    template bool scanNumericArray<int>(std::string_view, const std::optional<int>&,
+                                        std::vector<int>&, std::vector<value::status>&);
+    template bool scanNumericArray<double>(std::string_view, const std::optional<double>&,
+                                           std::vector<double>&, std::vector<value::status>&);
+
 }
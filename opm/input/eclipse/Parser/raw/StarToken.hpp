@@ -21,8 +21,12 @@
 #define STAR_TOKEN_HPP
 
 #include <cctype>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include <opm/input/eclipse/Deck/value_status.hpp>
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 
 namespace Opm {
@@ -33,6 +37,27 @@ namespace Opm {
     template <class T>
     T readValueToken( std::string_view );
 
+    /// Scan all tokens of a record holding a single numeric array, like
+    /// the data record of PORO or ZCORN, in one pass.
+    ///
+    /// Plain values and repeat counts "N*value" and "N*" are interpreted
+    /// exactly as isStarToken(), StarToken and readValueToken<T>() would
+    /// do token by token, and malformed tokens raise the same exceptions.
+    /// Values are appended to \p values and their status to \p status.
+    /// Defaulted values are set to \p defaultValue if it has a value and
+    /// are otherwise dummy defaults.
+    ///
+    /// Instantiated for int and double.
+    ///
+    /// \return False if the record contains a quoted token, in which case
+    ///    the record must be split into items by the RawRecord rules and
+    ///    the contents of \p values and \p status are unspecified.
+    template <class T>
+    bool scanNumericArray( std::string_view record,
+                           const std::optional<T>& defaultValue,
+                           std::vector<T>& values,
+                           std::vector<value::status>& status );
+
 class StarToken {
 public:
     explicit StarToken(const std::string_view& token)
@@ -31,6 +31,9 @@ error BUG: The PyRunModule.hpp header should *not* be included in a configuratio
 
 #include <fmt/format.h>
 
+#include <fstream>
+#include <sstream>
+
 #include <pybind11/stl.h>
 namespace Opm {
 
@@ -61,18 +64,45 @@ PyRunModule::PyRunModule(std::shared_ptr<const Python> python, const std::string
     }
 }
 
-namespace {
+void PyRunModule::bindObjects(EclipseState& ecl_state, Schedule& sched, SummaryState& st) {
+    if ((this->bound_ecl_state == &ecl_state) &&
+        (this->bound_schedule == &sched) &&
+        (this->bound_summary_state == &st))
+        return;
 
-py::cpp_function py_actionx_callback(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) {
-    return py::cpp_function( actionx_callback );
-}
+    this->ecl_state_obj = py::cast(&ecl_state, py::return_value_policy::reference);
+    this->schedule_obj = py::cast(&sched, py::return_value_policy::reference);
+    this->summary_state_obj = py::cast(&st, py::return_value_policy::reference);
+
+    this->opm_embedded.attr("current_ecl_state") = this->ecl_state_obj;
+    this->opm_embedded.attr("current_schedule") = this->schedule_obj;
+    this->opm_embedded.attr("current_summary_state") = this->summary_state_obj;
 
+    this->bound_ecl_state = &ecl_state;
+    this->bound_schedule = &sched;
+    this->bound_summary_state = &st;
 }
 
-bool PyRunModule::executeInnerRunFunction(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) {
-    auto cpp_callback = py_actionx_callback(actionx_callback);
+bool PyRunModule::executeInnerRunFunction(const ActionXCallback& actionx_callback) {
+    // The Python callable is created once, and forwards to whichever
+    // callback the current run() call was given.
+    if (!this->actionx_callback_obj) {
+        this->actionx_callback_obj = py::cpp_function(
+            [this](const std::string& action_name, const std::vector<std::string>& matching_wells) {
+                if (this->current_callback != nullptr)
+                    (*this->current_callback)(action_name, matching_wells);
+            });
+    }
+
+    struct CallbackScope {
+        const ActionXCallback*& current;
+        ~CallbackScope() { current = nullptr; }
+    };
+
+    this->current_callback = &actionx_callback;
+    CallbackScope scope{this->current_callback};
     try {
-        py::object result = this->run_function(this->opm_embedded.attr("current_ecl_state"), this->opm_embedded.attr("current_schedule"), this->opm_embedded.attr("current_report_step"), this->opm_embedded.attr("current_summary_state"), cpp_callback);
+        py::object result = this->run_function(this->ecl_state_obj, this->schedule_obj, this->opm_embedded.attr("current_report_step"), this->summary_state_obj, this->actionx_callback_obj);
         return result.cast<bool>();
     } catch (const std::exception& e) {
         OpmLog::error(fmt::format("Exception thrown when calling run(ecl_state, schedule, report_step, summary_state, actionx_callback) function of {}: {}", this->module_name, e.what()));
@@ -82,15 +112,34 @@ bool PyRunModule::executeInnerRunFunction(const std::function<void(const std::st
     }
 }
 
-bool PyRunModule::run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) {
+void PyRunModule::executeModuleCode() {
+    // Compiling the module source once and executing the code object in
+    // the module namespace is equivalent to module.reload(), without
+    // locating, reading and compiling the file on every call.
+    if (!this->module_code) {
+        const auto file = this->module.attr("__file__").cast<std::string>();
+        std::ifstream is(file);
+        if (!is)
+            OPM_THROW(std::runtime_error, fmt::format("Could not read Python module {} from {}", this->module_name, file));
+
+        std::stringstream source;
+        source << is.rdbuf();
+        this->module_code = py::module::import("builtins").attr("compile")(source.str(), file, "exec");
+    }
+
+    py::object globals = this->module.attr("__dict__");
+    auto result = py::reinterpret_steal<py::object>(PyEval_EvalCode(this->module_code.ptr(), globals.ptr(), globals.ptr()));
+    if (!result)
+        throw py::error_already_set();
+}
+
+bool PyRunModule::run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const ActionXCallback& actionx_callback) {
     // The attributes need to be set before the user defined module is loaded; it needs to be set in every call.
     this->opm_embedded.attr("current_report_step") = report_step;
+    // The remaining attributes are references to the objects, they are only rebound if run() is called with different objects.
+    this->bindObjects(ecl_state, sched, st);
 
     if (!this->module) {
-        // The attributes need to be set before the user defined module is loaded; they need to be set only once since they are shared pointers.
-        this->opm_embedded.attr("current_schedule") = &sched;
-        this->opm_embedded.attr("current_summary_state") = &st;
-        this->opm_embedded.attr("current_ecl_state") = &ecl_state;
         try {
             if (!this->module_path.empty()) {
                 py::module sys = py::module::import("sys");
@@ -138,7 +187,7 @@ help(opm_embedded.current_summary_state)
             return this->executeInnerRunFunction(actionx_callback);            
         } else {
             try {
-                this->module.reload();
+                this->executeModuleCode();
             } catch (const std::exception& e) {
                 OpmLog::error(fmt::format("Exception thrown in python module {}: {}", this->module_name, e.what()));
                 throw e;
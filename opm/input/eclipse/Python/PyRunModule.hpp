@@ -31,6 +31,8 @@ namespace py = pybind11;
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
+
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
@@ -40,9 +42,13 @@ namespace Opm {
 
 class __attribute__((visibility("default"))) PyRunModule {
 public:
+    using ActionXCallback = std::function<void(const std::string&, const std::vector<std::string>&)>;
+
     PyRunModule(std::shared_ptr<const Python> python, const std::string& fname);
+    PyRunModule(const PyRunModule&) = delete;
+    PyRunModule& operator=(const PyRunModule&) = delete;
 
-    bool run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback);
+    bool run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const ActionXCallback& actionx_callback);
 
 private:
     py::object run_function = py::none();
@@ -52,7 +58,27 @@ private:
     std::string module_name;
     py::module opm_embedded;
     py::dict storage;
-    bool executeInnerRunFunction(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback);
+
+    // Python proxies of the objects passed to run(), created once and
+    // reused as long as run() is called with the same objects.
+    const void* bound_ecl_state = nullptr;
+    const void* bound_schedule = nullptr;
+    const void* bound_summary_state = nullptr;
+    py::object ecl_state_obj;
+    py::object schedule_obj;
+    py::object summary_state_obj;
+
+    // Python callable forwarding to the callback of the current run() call.
+    py::object actionx_callback_obj;
+    const ActionXCallback* current_callback = nullptr;
+
+    // Compiled code of a module without a run() function, executed in the
+    // module namespace on every call after the first.
+    py::object module_code;
+
+    void bindObjects(EclipseState& ecl_state, Schedule& sched, SummaryState& st);
+    bool executeInnerRunFunction(const ActionXCallback& actionx_callback);
+    void executeModuleCode();
 };
 
 }
@@ -165,6 +165,8 @@ public:
     }
 
 private:
+    friend class ConditionProgram;
+
     // Note: data member order here is dictated by initialisation list in
     // four-argument constructor.
 
@@ -22,6 +22,7 @@
 #include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/Action/ConditionProgram.hpp>
 
 #include "ActionParser.hpp"
 
@@ -32,12 +33,15 @@
 
 Opm::Action::AST::AST(const std::vector<std::string>& tokens)
     : condition { std::make_shared<ASTNode>(::Opm::Action::Parser::parse(tokens)) }
-{}
+{
+    this->compile();
+}
 
 Opm::Action::AST Opm::Action::AST::serializationTestObject()
 {
     AST result;
     result.condition = std::make_shared<ASTNode>(ASTNode::serializationTestObject());
+    result.compile();
 
     return result;
 }
@@ -49,6 +53,13 @@ Opm::Action::AST::eval(const Action::Context& context) const
         return Result { false };
     }
 
+    if (this->compiled != nullptr) {
+        auto inputs = ConditionProgram::Inputs{};
+        this->compiled->inputs(context, inputs);
+
+        return this->compiled->eval(inputs);
+    }
+
     return this->condition->eval(context);
 }
 
@@ -72,3 +83,10 @@ void Opm::Action::AST::required_summary(std::unordered_set<std::string>& require
 
     this->condition->required_summary(required_summary);
 }
+
+void Opm::Action::AST::compile()
+{
+    this->compiled = ((this->condition == nullptr) || this->condition->empty())
+        ? nullptr
+        : ConditionProgram::compile(*this->condition);
+}
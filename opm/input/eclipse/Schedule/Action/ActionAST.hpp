@@ -31,6 +31,7 @@ namespace Opm::Action {
 
 class Context;
 class ASTNode;
+class ConditionProgram;
 
 } // namespace Opm::Action
 
@@ -90,6 +91,10 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(condition);
+
+        if (! serializer.isSerializing()) {
+            this->compile();
+        }
     }
 
     /// Export all summary vectors needed to evaluate the expression tree.
@@ -100,6 +105,13 @@ public:
     /// this set.
     void required_summary(std::unordered_set<std::string>& required_summary) const;
 
+    /// Compiled form of the expression tree.  Nullptr if the condition
+    /// could not be compiled, in which case eval() evaluates the tree.
+    const ConditionProgram* program() const
+    {
+        return this->compiled.get();
+    }
+
 private:
     // The pointer type enables creating this class with only a forward
     // declaration of the ASTNode class.  Would have prefered to use a
@@ -108,6 +120,13 @@ private:
 
     /// Internalised condition object in expression tree form.
     std::shared_ptr<ASTNode> condition;
+
+    /// Compiled form of the condition.  Derived from the expression tree,
+    /// and neither serialised nor compared.
+    std::shared_ptr<const ConditionProgram> compiled{};
+
+    /// Form compiled condition from expression tree.
+    void compile();
 };
 
 } // namespace Opm::Action
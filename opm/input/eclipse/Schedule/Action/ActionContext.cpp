@@ -29,6 +29,8 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace {
@@ -60,6 +62,11 @@ void Opm::Action::Context::add(const std::string& func,
                                const double       value)
 {
     this->values_.insert_or_assign(func, value);
+
+    if (const auto sep = func.find(':'); sep != std::string::npos) {
+        const auto& entity_func = *this->entity_overrides_.insert(func.substr(0, sep)).first;
+        this->well_values_.erase(entity_func);
+    }
 }
 
 double Opm::Action::Context::get(std::string_view func,
@@ -82,3 +89,28 @@ Opm::Action::Context::wells(const std::string& key) const
 {
     return this->summaryState_.get().wells(key);
 }
+
+const Opm::Action::Context::WellValues&
+Opm::Action::Context::well_values(const std::string& func) const
+{
+    auto pos = this->well_values_.find(func);
+    if (pos != this->well_values_.end()) {
+        return pos->second;
+    }
+
+    auto& well_values = this->well_values_[func];
+    well_values.wells = this->wells(func);
+
+    if (this->entity_overrides_.count(func) == 0) {
+        this->summaryState_.get()
+            .get_well_vars(func, well_values.wells, well_values.values);
+    }
+    else {
+        well_values.values.reserve(well_values.wells.size());
+        for (const auto& well : well_values.wells) {
+            well_values.values.push_back(this->get(func, well));
+        }
+    }
+
+    return well_values;
+}
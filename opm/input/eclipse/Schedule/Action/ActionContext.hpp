@@ -24,6 +24,8 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace Opm {
@@ -95,6 +97,28 @@ public:
     /// \return All wells for which the named summary function is defined.
     std::vector<std::string> wells(const std::string& func) const;
 
+    /// Names and values of all wells for which a well level summary
+    /// function is defined.
+    struct WellValues
+    {
+        /// Well names, in the order of wells().
+        std::vector<std::string> wells{};
+
+        /// Function value of each well.
+        std::vector<double> values{};
+    };
+
+    /// Retrieve values of well level summary function for all wells for
+    /// which the function is defined.
+    ///
+    /// Collected once per function and context object, so evaluating
+    /// many conditions on the same function reads the summary state only
+    /// once.
+    ///
+    /// \param[in] func Named well-level summary function, e.g., WOPR or
+    /// WMCTL.
+    const WellValues& well_values(const std::string& func) const;
+
     /// Get read-only access to run's well lists.
     ///
     /// Convenience method.
@@ -115,6 +139,13 @@ private:
     /// Primary source for get() requests, and only object for which add()
     /// requests are destined.
     std::map<std::string, double> values_{};
+
+    /// Functions for which add() has assigned values of specific
+    /// entities.  These override the summary state in well_values().
+    std::unordered_set<std::string> entity_overrides_{};
+
+    /// Cache of well_values() results.
+    mutable std::unordered_map<std::string, WellValues> well_values_{};
 };
 
 } // namespace Opm::Action
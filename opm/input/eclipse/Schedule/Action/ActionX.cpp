@@ -25,6 +25,7 @@
 
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actdims.hpp>
+#include <opm/input/eclipse/Schedule/Action/ConditionProgram.hpp>
 #include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 
@@ -230,6 +231,26 @@ Result ActionX::eval(const Action::Context& context) const
     return this->condition.eval(context);
 }
 
+Result ActionX::eval(const Action::Context& context, State& state) const
+{
+    const auto* program = this->condition.program();
+    if (program == nullptr) {
+        return this->eval(context);
+    }
+
+    auto inputs = ConditionProgram::Inputs{};
+    program->inputs(context, inputs);
+
+    if (const auto* result = state.condition_result(*this, inputs); result != nullptr) {
+        return *result;
+    }
+
+    auto result = program->eval(inputs);
+    state.record_condition(*this, inputs, result);
+
+    return result;
+}
+
 std::vector<std::string>
 ActionX::wellpi_wells(const WellMatcher&              well_matcher,
                       const Result::MatchingEntities& matches) const
@@ -197,6 +197,22 @@ public:
     /// wells.
     Result eval(const Context& context) const;
 
+    /// Evaluate the action's conditions at current dynamic state, reusing
+    /// the previous result if possible.
+    ///
+    /// Same as eval(context), except that if the action's condition is
+    /// compiled and none of its inputs changed since the previous call,
+    /// the result of that call is returned without evaluating the
+    /// condition again.
+    ///
+    /// \param[in] context Current summary vectors and wells
+    ///
+    /// \param[in,out] state Dynamic action state.  Holds the previous
+    /// condition inputs and result.
+    ///
+    /// \return Condition value, as for eval(context).
+    Result eval(const Context& context, State& state) const;
+
     /// Retrive list of well names used in action block WELPI keywords
     ///
     /// \param[in] well_matcher Final arbiter for wells currently known to
@@ -0,0 +1,331 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Action/ConditionProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace {
+
+    // Same rules as Value::eval_cmp().
+    bool isComparison(const Opm::Action::TokenType op)
+    {
+        return (op == Opm::Action::TokenType::op_gt)
+            || (op == Opm::Action::TokenType::op_ge)
+            || (op == Opm::Action::TokenType::op_lt)
+            || (op == Opm::Action::TokenType::op_le)
+            || (op == Opm::Action::TokenType::op_eq)
+            || (op == Opm::Action::TokenType::op_ne)
+            ;
+    }
+
+    bool comparisonHolds(const double                 lhs,
+                         const Opm::Action::TokenType op,
+                         const double                 rhs)
+    {
+        switch (op) {
+        case Opm::Action::TokenType::op_gt: return lhs >  rhs;
+        case Opm::Action::TokenType::op_ge: return lhs >= rhs;
+        case Opm::Action::TokenType::op_lt: return lhs <  rhs;
+        case Opm::Action::TokenType::op_le: return lhs <= rhs;
+        case Opm::Action::TokenType::op_eq: return lhs == rhs;
+        default:                            return lhs != rhs;
+        }
+    }
+
+    // Same as in ASTNode::getWellList().
+    std::string normalisePattern(const std::string& patt)
+    {
+        return (patt.front() == '\\') ? patt.substr(1) : patt;
+    }
+
+    bool sameValue(const double a, const double b)
+    {
+        return (a == b) || (std::isnan(a) && std::isnan(b));
+    }
+
+} // Anonymous namespace
+
+namespace Opm::Action {
+
+bool ConditionProgram::Inputs::operator==(const Inputs& that) const
+{
+    if ((this->values.size() != that.values.size()) ||
+        (this->wells != that.wells))
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < this->values.size(); ++i) {
+        if (! sameValue(this->values[i], that.values[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::shared_ptr<const ConditionProgram>
+ConditionProgram::compile(const ASTNode& condition)
+{
+    auto program = std::make_shared<ConditionProgram>();
+    if (! program->compile_node(condition)) {
+        return {};
+    }
+
+    return program;
+}
+
+bool ConditionProgram::compile_node(const ASTNode& node)
+{
+    if (node.empty()) {
+        return false;
+    }
+
+    if ((node.type != TokenType::op_and) &&
+        (node.type != TokenType::op_or))
+    {
+        return this->compile_comparison(node);
+    }
+
+    for (const auto& child : node.children) {
+        if (! this->compile_node(child)) {
+            return false;
+        }
+    }
+
+    auto& instr = this->code_.emplace_back();
+    instr.op = (node.type == TokenType::op_and)
+        ? Instruction::OpCode::And
+        : Instruction::OpCode::Or;
+    instr.count = node.children.size();
+
+    return true;
+}
+
+bool ConditionProgram::compile_comparison(const ASTNode& node)
+{
+    if (! isComparison(node.type) || (node.size() != 2)) {
+        return false;
+    }
+
+    const auto& lhs = node.children.front();
+    const auto& rhs = node.children[1];
+
+    auto cmp = Comparison{};
+    cmp.op = node.type;
+
+    if (! compile_operand(lhs, false, cmp.lhs) ||
+        ! compile_operand(rhs, true, cmp.rhs))
+    {
+        return false;
+    }
+
+    // Numeric months are compared to the nearest integer, see
+    // ASTNode::evalComparison().
+    if ((lhs.func_type == FuncType::time_month) &&
+        (cmp.rhs.kind == Operand::Kind::Number))
+    {
+        cmp.rhs.number = std::round(cmp.rhs.number);
+    }
+
+    this->comparisons_.push_back(std::move(cmp));
+
+    auto& instr = this->code_.emplace_back();
+    instr.op = Instruction::OpCode::Compare;
+
+    return true;
+}
+
+bool ConditionProgram::compile_operand(const ASTNode& leaf,
+                                       const bool     rhs,
+                                       Operand&       operand)
+{
+    if (! leaf.empty()) {
+        return false;
+    }
+
+    if (leaf.type == TokenType::number) {
+        operand.kind = Operand::Kind::Number;
+        operand.number = leaf.number;
+        return true;
+    }
+
+    if (leaf.arg_list.empty()) {
+        operand.kind = Operand::Kind::Scalar;
+        operand.key = leaf.func;
+        return true;
+    }
+
+    if (leaf.argListIsPattern()) {
+        // Well lists on the right hand side, or lists of anything but
+        // wells, are errors reported by ASTNode::eval().
+        if (rhs || (leaf.func_type != FuncType::well)) {
+            return false;
+        }
+
+        operand.kind = Operand::Kind::Wells;
+        operand.key = leaf.func;
+        operand.well_list = leaf.argListIsWellList();
+        operand.wells = operand.well_list
+            ? leaf.arg_list.front()
+            : normalisePattern(leaf.arg_list.front());
+
+        return true;
+    }
+
+    operand.key = fmt::format("{}:{}", leaf.func, fmt::join(leaf.arg_list, ":"));
+
+    if (leaf.func_type != FuncType::well) {
+        operand.kind = Operand::Kind::Scalar;
+        return true;
+    }
+
+    if (rhs) {
+        return false;
+    }
+
+    operand.kind = Operand::Kind::Wells;
+    operand.single_well = true;
+    operand.wells = leaf.arg_list.front();
+
+    return true;
+}
+
+void ConditionProgram::inputs(const Context& context, Inputs& inputs) const
+{
+    inputs.values.clear();
+    inputs.wells.clear();
+
+    const auto scalar = [&context, &inputs](const Operand& operand)
+    {
+        inputs.values.push_back((operand.kind == Operand::Kind::Number)
+                                ? operand.number
+                                : context.get(operand.key));
+    };
+
+    for (const auto& cmp : this->comparisons_) {
+        // Right hand side first, as in ASTNode::evalComparison().
+        scalar(cmp.rhs);
+
+        if (cmp.lhs.kind != Operand::Kind::Wells) {
+            scalar(cmp.lhs);
+            continue;
+        }
+
+        // Number of wells, to separate the wells of consecutive
+        // comparisons.
+        const auto count = inputs.values.size();
+        const auto first = inputs.wells.size();
+        inputs.values.push_back(0.0);
+
+        if (cmp.lhs.single_well) {
+            inputs.wells.push_back(cmp.lhs.wells);
+            inputs.values.push_back(context.get(cmp.lhs.key));
+        }
+        else if (cmp.lhs.well_list) {
+            for (const auto& well : context.wlist_manager().wells(cmp.lhs.wells)) {
+                inputs.wells.push_back(well);
+                inputs.values.push_back(context.get(cmp.lhs.key, well));
+            }
+        }
+        else {
+            const auto& well_values = context.well_values(cmp.lhs.key);
+            for (std::size_t i = 0; i < well_values.wells.size(); ++i) {
+                if (shmatch(cmp.lhs.wells, well_values.wells[i])) {
+                    inputs.wells.push_back(well_values.wells[i]);
+                    inputs.values.push_back(well_values.values[i]);
+                }
+            }
+        }
+
+        inputs.values[count] = static_cast<double>(inputs.wells.size() - first);
+    }
+}
+
+Result ConditionProgram::eval(const Inputs& inputs) const
+{
+    auto stack = std::vector<Result>{};
+    stack.reserve(this->comparisons_.size());
+
+    auto cmp = this->comparisons_.begin();
+    auto value = inputs.values.begin();
+    auto well = inputs.wells.begin();
+
+    for (const auto& instr : this->code_) {
+        if (instr.op == Instruction::OpCode::Compare) {
+            const auto rhs = *value++;
+
+            if (cmp->lhs.kind != Operand::Kind::Wells) {
+                stack.emplace_back(comparisonHolds(*value++, cmp->op, rhs));
+            }
+            else {
+                const auto num_wells = static_cast<std::size_t>(*value++);
+
+                auto matching_wells = std::vector<std::string>{};
+                for (std::size_t i = 0; i < num_wells; ++i) {
+                    if (comparisonHolds(value[i], cmp->op, rhs)) {
+                        matching_wells.push_back(well[i]);
+                    }
+                }
+
+                value += num_wells;
+                well += num_wells;
+
+                stack.push_back(Result { !matching_wells.empty() }.wells(matching_wells));
+            }
+
+            ++cmp;
+            continue;
+        }
+
+        const auto first = stack.size() - instr.count;
+
+        auto result = Result { instr.op == Instruction::OpCode::And };
+        auto setOp = (instr.op == Instruction::OpCode::Or)
+            ? &Result::makeSetUnion
+            : &Result::makeSetIntersection;
+
+        for (auto i = first; i < stack.size(); ++i) {
+            (result.*setOp)(stack[i]);
+        }
+
+        stack.erase(stack.begin() + first, stack.end());
+        stack.push_back(std::move(result));
+    }
+
+    return stack.back();
+}
+
+} // namespace Opm::Action
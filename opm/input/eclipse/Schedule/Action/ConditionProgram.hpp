@@ -0,0 +1,138 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_CONDITION_PROGRAM_HPP
+#define ACTION_CONDITION_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm::Action {
+
+class ASTNode;
+class Context;
+
+/// Flat form of an ACTIONX condition.
+///
+/// Compiled once from the condition's syntax tree.  All summary keys and
+/// well name patterns are resolved at compile time, and evaluation is
+/// split into two phases.  The first, inputs(), collects the values of
+/// every summary vector referenced by the condition, and the names of the
+/// wells of any well level comparison, into flat arrays.  The second,
+/// eval(), computes the condition from those arrays alone.  Callers may
+/// therefore skip the second phase if the inputs are the same as at the
+/// previous evaluation.  The results are the same as those of
+/// ASTNode::eval().
+///
+/// Conditions which ASTNode::eval() reports as errors, e.g., well level
+/// right hand sides, are not compiled.
+class ConditionProgram
+{
+public:
+    /// Values read by a condition.
+    struct Inputs
+    {
+        /// Numeric values of all operands, in comparison order.  Well
+        /// level operands contribute the number of wells followed by one
+        /// value for each well.
+        std::vector<double> values{};
+
+        /// Names of the wells of well level operands, in comparison
+        /// order.
+        std::vector<std::string> wells{};
+
+        /// Equality predicate.  NaN values compare equal.
+        bool operator==(const Inputs& that) const;
+    };
+
+    /// Compile a condition.  Nullptr if the condition is not supported.
+    static std::shared_ptr<const ConditionProgram> compile(const ASTNode& condition);
+
+    /// Collect the current values of the condition's inputs.
+    ///
+    /// Throws the same exceptions as ASTNode::eval(), e.g., for unknown
+    /// summary vectors.
+    void inputs(const Context& context, Inputs& inputs) const;
+
+    /// Evaluate the condition for a set of inputs collected by inputs().
+    Result eval(const Inputs& inputs) const;
+
+    /// Number of comparisons in the condition.
+    std::size_t size() const
+    {
+        return this->comparisons_.size();
+    }
+
+private:
+    /// Operand of a comparison.
+    struct Operand
+    {
+        enum class Kind { Number, Scalar, Wells };
+
+        Kind kind{Kind::Number};
+
+        /// Number: the constant.
+        double number{0.0};
+
+        /// Scalar: the full summary key, e.g., FOPR or WWCT:P1.
+        /// Wells: the summary vector, e.g., WWCT, or the full key for a
+        /// single well.
+        std::string key{};
+
+        /// Wells: normalised well name pattern, well list name or name of
+        /// single well.
+        std::string wells{};
+        bool well_list{false};
+        bool single_well{false};
+    };
+
+    struct Comparison
+    {
+        TokenType op{TokenType::op_eq};
+        Operand lhs{};
+        Operand rhs{};
+    };
+
+    /// Postfix code.  Compare pushes the result of one comparison, in
+    /// order, while And and Or combine the top 'count' results.
+    struct Instruction
+    {
+        enum class OpCode { Compare, And, Or };
+
+        OpCode op{OpCode::Compare};
+        std::size_t count{0};
+    };
+
+    std::vector<Comparison> comparisons_{};
+    std::vector<Instruction> code_{};
+
+    bool compile_node(const ASTNode& node);
+    bool compile_comparison(const ASTNode& node);
+
+    static bool compile_operand(const ASTNode& leaf, bool rhs, Operand& operand);
+};
+
+} // namespace Opm::Action
+
+#endif // ACTION_CONDITION_PROGRAM_HPP
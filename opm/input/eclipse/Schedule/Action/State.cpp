@@ -141,12 +141,35 @@ Opm::Action::State::python_result(const std::string& action) const
     return iter->second;
 }
 
+const Opm::Action::Result*
+Opm::Action::State::condition_result(const ActionX&                  action,
+                                     const ConditionProgram::Inputs& inputs) const
+{
+    auto iter = this->conditions.find(makeID(action));
+    if ((iter == this->conditions.end()) || !(iter->second.inputs == inputs)) {
+        return nullptr;
+    }
+
+    return &iter->second.result;
+}
+
+void Opm::Action::State::record_condition(const ActionX&                  action,
+                                          const ConditionProgram::Inputs& inputs,
+                                          const Result&                   result)
+{
+    auto& evaluation = this->conditions[makeID(action)];
+    evaluation.inputs = inputs;
+    evaluation.result = result;
+}
+
 // When restoring from restart file we initialize the number of times it has
 // run and the last run time.  From the evaluation only the 'true'
 // evaluation is restored, not the well/group set.
 void Opm::Action::State::load_rst(const Actions&             action_config,
                                   const RestartIO::RstState& rst_state)
 {
+    this->conditions.clear();
+
     for (const auto& rst_action : rst_state.actions) {
         if (! (rst_action.run_count > 0)) {
             continue;
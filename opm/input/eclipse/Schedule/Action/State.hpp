@@ -20,6 +20,9 @@
 #ifndef ACTION_STATE_HPP
 #define ACTION_STATE_HPP
 
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ConditionProgram.hpp>
+
 #include <cstddef>
 #include <ctime>
 #include <map>
@@ -38,7 +41,6 @@ namespace Opm::Action {
     class ActionX;
     class Actions;
     class PyAction;
-    class Result;
 
 } // namespace Opm::Action
 
@@ -142,6 +144,32 @@ public:
     /// \return PyAction result.  Nullopt if the action has not yet run.
     std::optional<bool> python_result(const std::string& action) const;
 
+    /// Query for the result of the previous evaluation of an action's
+    /// condition.
+    ///
+    /// \param[in] action Action object.
+    ///
+    /// \param[in] inputs Current values of the inputs to the action's
+    /// compiled condition.
+    ///
+    /// \return Result recorded by record_condition().  Nullptr if the
+    /// condition has not been evaluated or if any of its inputs changed
+    /// since it was.
+    const Result* condition_result(const ActionX& action,
+                                   const ConditionProgram::Inputs& inputs) const;
+
+    /// Record result of evaluating an action's condition.
+    ///
+    /// \param[in] action Action object.
+    ///
+    /// \param[in] inputs Values of the inputs to the action's compiled
+    /// condition.
+    ///
+    /// \param[in] result Condition value for \p inputs.
+    void record_condition(const ActionX& action,
+                          const ConditionProgram::Inputs& inputs,
+                          const Result& result);
+
     /// Load action state from restart file
     ///
     /// \param[in] action_config Run's ActionX and PyAction objects.
@@ -162,6 +190,10 @@ public:
         serializer(this->run_state);
         serializer(this->last_result);
         serializer(this->m_python_result);
+
+        if (! serializer.isSerializing()) {
+            this->conditions.clear();
+        }
     }
 
     /// Create a serialisation test object.
@@ -257,6 +289,17 @@ private:
 
     /// PyAction results.
     std::map<std::string, bool> m_python_result{};
+
+    /// Inputs and result of most recent condition evaluation.
+    struct ConditionEvaluation
+    {
+        ConditionProgram::Inputs inputs{};
+        Result result{false};
+    };
+
+    /// Most recent condition evaluations of all ActionX objects with
+    /// compiled conditions.  Transient, neither serialised nor compared.
+    std::map<ActionID, ConditionEvaluation> conditions{};
 };
 
 } // namespace Opm::Action
@@ -19,10 +19,12 @@
 */
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/SimulationConfig/BCConfig.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/B.hpp>
 #include <opm/input/eclipse/Schedule/BCProp.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <string>
 
 namespace Opm {
@@ -234,6 +236,69 @@ const BCProp::BCFace& BCProp::operator[](int index) const
     return this->m_faces[0];
 }
 
+std::array<std::size_t, 2> BCProp::FaceTable::range(std::size_t cell) const
+{
+    const auto [first, last] = std::equal_range(this->cells.begin(), this->cells.end(), cell);
+    return { static_cast<std::size_t>(first - this->cells.begin()),
+             static_cast<std::size_t>(last - this->cells.begin()) };
+}
+
+BCProp::FaceTable BCProp::faceTable(const BCConfig& config, const GridDims& grid) const
+{
+    struct Face
+    {
+        std::size_t cell;
+        FaceDir::DirEnum dir;
+        const BCFace* bc;
+    };
+
+    std::vector<Face> faces;
+    for (const auto& region : config) {
+        const auto bc = std::find_if(this->m_faces.begin(), this->m_faces.end(),
+                                     [&region](const auto& face)
+                                     {
+                                         return face.index == region.index;
+                                     });
+        if (bc == this->m_faces.end())
+            continue;
+
+        for (int k = region.k1; k <= region.k2; ++k)
+            for (int j = region.j1; j <= region.j2; ++j)
+                for (int i = region.i1; i <= region.i2; ++i)
+                    faces.push_back({ grid.getGlobalIndex(i, j, k), region.dir, &*bc });
+    }
+
+    std::stable_sort(faces.begin(), faces.end(),
+                     [](const Face& lhs, const Face& rhs)
+                     {
+                         return (lhs.cell < rhs.cell) ||
+                             ((lhs.cell == rhs.cell) && (lhs.dir < rhs.dir));
+                     });
+
+    constexpr auto missing = std::numeric_limits<double>::quiet_NaN();
+
+    FaceTable table;
+    table.cells.reserve(faces.size());
+    table.dirs.reserve(faces.size());
+    table.bctypes.reserve(faces.size());
+    table.components.reserve(faces.size());
+    table.rates.reserve(faces.size());
+    table.pressures.reserve(faces.size());
+    table.temperatures.reserve(faces.size());
+
+    for (const auto& face : faces) {
+        table.cells.push_back(face.cell);
+        table.dirs.push_back(face.dir);
+        table.bctypes.push_back(face.bc->bctype);
+        table.components.push_back(face.bc->component);
+        table.rates.push_back(face.bc->rate);
+        table.pressures.push_back(face.bc->pressure.value_or(missing));
+        table.temperatures.push_back(face.bc->temperature.value_or(missing));
+    }
+
+    return table;
+}
+
 bool BCProp::operator==(const BCProp& other) const {
     return this->m_faces == other.m_faces;
 }
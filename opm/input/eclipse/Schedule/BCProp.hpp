@@ -21,6 +21,7 @@
 #ifndef OPM_BC_PROP_HPP
 #define OPM_BC_PROP_HPP
 
+#include <array>
 #include <vector>
 #include <cstddef>
 #include <optional>
@@ -30,6 +31,7 @@
 
 namespace Opm {
 
+class BCConfig;
 class Deck;
 class DeckRecord;
 
@@ -121,10 +123,40 @@ public:
         }
     };
 
+    /// Boundary conditions of a report step expanded to the individual
+    /// cell faces of the BCCON regions, for assembly in a single pass.
+    ///
+    /// Faces are sorted by global cell index and then by direction, with
+    /// the type and values of each face in parallel arrays.  Faces of
+    /// regions without a BCPROP record are left out, and a face in more
+    /// than one region is listed once per region, in region order.
+    struct FaceTable
+    {
+        std::vector<std::size_t> cells{};
+        std::vector<FaceDir::DirEnum> dirs{};
+        std::vector<BCType> bctypes{};
+        std::vector<BCComponent> components{};
+        std::vector<double> rates{};
+
+        /// Pressure and temperature of the faces, NaN where not given.
+        std::vector<double> pressures{};
+        std::vector<double> temperatures{};
+
+        std::size_t size() const { return this->cells.size(); }
+        bool empty() const { return this->cells.empty(); }
+
+        /// Positions [first, last) of the faces of global cell \p cell.
+        std::array<std::size_t, 2> range(std::size_t cell) const;
+    };
+
     BCProp() = default;
 
     static BCProp serializationTestObject();
 
+    /// Faces of the regions of \p config on the grid \p grid with the
+    /// current boundary conditions.
+    FaceTable faceTable(const BCConfig& config, const GridDims& grid) const;
+
     std::size_t size() const;
     std::vector<BCFace>::const_iterator begin() const;
     std::vector<BCFace>::const_iterator end() const;
@@ -96,6 +96,11 @@ Opm::CompletedCells::try_get(std::size_t i, std::size_t j, std::size_t k)
     return { !inserted, pos->second };
 }
 
+void Opm::CompletedCells::reserve(std::size_t n)
+{
+    this->cells.reserve(this->cells.size() + n);
+}
+
 bool Opm::CompletedCells::operator==(const Opm::CompletedCells& other) const
 {
     return (this->dims == other.dims)
@@ -108,6 +108,9 @@ public:
     const Cell& get(std::size_t i, std::size_t j, std::size_t k) const;
     std::pair<bool, Cell&> try_get(std::size_t i, std::size_t j, std::size_t k);
 
+    /// Prepare for 'n' more cells, e.g., before a batch of lookups.
+    void reserve(std::size_t n);
+
     bool operator==(const CompletedCells& other) const;
     static CompletedCells serializationTestObject();
 
@@ -0,0 +1,148 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/ControlSnapshot.hpp>
+
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    template <typename T>
+    const T& lookup(const std::vector<std::optional<T>>& controls,
+                    const std::size_t                    index,
+                    const char*                          what,
+                    const std::string&                   name)
+    {
+        if ((index >= controls.size()) || !controls[index].has_value()) {
+            throw std::logic_error {
+                fmt::format("No {} controls for {} in control snapshot", what, name)
+            };
+        }
+
+        return *controls[index];
+    }
+
+    template <typename T>
+    void resizeFor(std::vector<T>& dest, const std::size_t index)
+    {
+        if (dest.size() <= index) {
+            dest.resize(index + 1);
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+void ControlSnapshot::update(const ScheduleState& sched_state, const SummaryState& st)
+{
+    if (this->isCurrent(sched_state, st)) {
+        return;
+    }
+
+    this->well_prod_.clear();
+    this->well_inj_.clear();
+    for (const auto& [name, well] : sched_state.wells) {
+        const auto index = well->seqIndex();
+        resizeFor(this->well_prod_, index);
+        resizeFor(this->well_inj_, index);
+
+        if (well->isProducer()) {
+            this->well_prod_[index] = well->productionControls(st);
+        }
+        else {
+            this->well_inj_[index] = well->injectionControls(st);
+        }
+    }
+
+    this->group_prod_.clear();
+    this->group_inj_.clear();
+    for (const auto& [name, group] : sched_state.groups) {
+        const auto index = group->insert_index();
+        resizeFor(this->group_prod_, index);
+        resizeFor(this->group_inj_, index);
+
+        this->group_prod_[index] = group->productionControls(st);
+
+        auto& inj = this->group_inj_[index];
+        for (const auto& [phase, props] : group->injectionProperties()) {
+            inj.emplace_back(phase, group->injectionControls(phase, st));
+        }
+    }
+
+    this->wells_version_ = sched_state.wells.version();
+    this->groups_version_ = sched_state.groups.version();
+    this->udq_version_ = st.udq_version();
+}
+
+bool ControlSnapshot::isCurrent(const ScheduleState& sched_state, const SummaryState& st) const
+{
+    return (this->udq_version_ == st.udq_version())
+        && (this->wells_version_ == sched_state.wells.version())
+        && (this->groups_version_ == sched_state.groups.version());
+}
+
+const Well::ProductionControls&
+ControlSnapshot::productionControls(const Well& well) const
+{
+    return lookup(this->well_prod_, well.seqIndex(), "production", well.name());
+}
+
+const Well::InjectionControls&
+ControlSnapshot::injectionControls(const Well& well) const
+{
+    return lookup(this->well_inj_, well.seqIndex(), "injection", well.name());
+}
+
+const Group::ProductionControls&
+ControlSnapshot::productionControls(const Group& group) const
+{
+    return lookup(this->group_prod_, group.insert_index(), "production", group.name());
+}
+
+const Group::InjectionControls&
+ControlSnapshot::injectionControls(const Group& group, const Phase phase) const
+{
+    const auto index = group.insert_index();
+    if (index < this->group_inj_.size()) {
+        const auto& inj = this->group_inj_[index];
+        auto pos = std::find_if(inj.begin(), inj.end(),
+                                [phase](const auto& elem) { return elem.first == phase; });
+        if (pos != inj.end()) {
+            return pos->second;
+        }
+    }
+
+    throw std::out_of_range {
+        fmt::format("No injection controls for group {} in control snapshot", group.name())
+    };
+}
+
+} // namespace Opm
@@ -0,0 +1,90 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CONTROL_SNAPSHOT_HPP
+#define OPM_CONTROL_SNAPSHOT_HPP
+
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+class ScheduleState;
+class SummaryState;
+
+/// Production and injection controls of all wells and groups of one
+/// report step, with all UDAs evaluated.
+///
+/// Well::productionControls(), Well::injectionControls() and their Group
+/// counterparts evaluate every UDA through string lookups in the summary
+/// state on each call.  The snapshot evaluates them once, typically right
+/// after the UDQs have been evaluated, and stores the result in dense
+/// arrays indexed by Well::seqIndex() and Group::insert_index().
+///
+/// The snapshot remembers the versions of the wells, the groups and the
+/// UDQ values it was built from, so update() is cheap if none of them has
+/// changed.  Lookups are const and may be made from several threads.
+class ControlSnapshot
+{
+public:
+    /// Evaluate the controls of all wells and groups in \p sched_state
+    /// unless the snapshot is already current.
+    void update(const ScheduleState& sched_state, const SummaryState& st);
+
+    /// Whether the snapshot was built from the current wells, groups and
+    /// UDQ values.
+    bool isCurrent(const ScheduleState& sched_state, const SummaryState& st) const;
+
+    /// Controls of a producer.  Throws std::logic_error for injectors and
+    /// wells which are not in the snapshot.
+    const Well::ProductionControls& productionControls(const Well& well) const;
+
+    /// Controls of an injector.  Throws std::logic_error for producers
+    /// and wells which are not in the snapshot.
+    const Well::InjectionControls& injectionControls(const Well& well) const;
+
+    /// Production controls of a group.  Throws std::logic_error for
+    /// groups which are not in the snapshot.
+    const Group::ProductionControls& productionControls(const Group& group) const;
+
+    /// Injection controls of a group for one phase.  Throws
+    /// std::out_of_range if the group has no injection controls for
+    /// \p phase.
+    const Group::InjectionControls& injectionControls(const Group& group, Phase phase) const;
+
+private:
+    std::size_t wells_version_{0};
+    std::size_t groups_version_{0};
+    std::size_t udq_version_{0};
+
+    std::vector<std::optional<Well::ProductionControls>> well_prod_{};
+    std::vector<std::optional<Well::InjectionControls>> well_inj_{};
+
+    std::vector<std::optional<Group::ProductionControls>> group_prod_{};
+    std::vector<std::vector<std::pair<Phase, Group::InjectionControls>>> group_inj_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_CONTROL_SNAPSHOT_HPP
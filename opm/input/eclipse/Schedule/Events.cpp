@@ -16,10 +16,18 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
-#include <fmt/format.h>
-
 #include <opm/input/eclipse/Schedule/Events.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
 namespace Opm {
 
 
@@ -59,57 +67,132 @@ namespace Opm {
         return wg;
     }
 
+    void WellGroupEvents::add(const std::string& wgname, bool is_well, ScheduleEvents::Events event) {
+        if (this->has(wgname))
+            return;
+
+        if (!this->m_entities)
+            this->m_entities = std::make_shared<Entities>();
+        else if (this->m_entities.use_count() > 1)
+            this->m_entities = std::make_shared<Entities>(*this->m_entities);
+
+        auto& entities = *this->m_entities;
+        entities.index.emplace(wgname, entities.names.size());
+        entities.names.push_back(wgname);
+        entities.is_well.push_back(is_well);
+
+        this->m_events.emplace_back().addEvent(event);
+    }
+
     void WellGroupEvents::addWell(const std::string& wname) {
-        Events events;
-        events.addEvent( ScheduleEvents::NEW_WELL );
-        this->m_wellgroup_events.insert( std::make_pair( wname, events ));
+        this->add(wname, true, ScheduleEvents::NEW_WELL);
     }
 
     void WellGroupEvents::addGroup(const std::string& gname) {
-        Events events;
-        events.addEvent( ScheduleEvents::NEW_GROUP );
-        this->m_wellgroup_events.insert( std::make_pair( gname, events ));
+        this->add(gname, false, ScheduleEvents::NEW_GROUP);
+    }
+
+    std::size_t WellGroupEvents::size() const {
+        return this->m_events.size();
+    }
+
+    std::optional<std::size_t> WellGroupEvents::index(const std::string& wgname) const {
+        if (!this->m_entities)
+            return std::nullopt;
+
+        const auto iter = this->m_entities->index.find(wgname);
+        if (iter == this->m_entities->index.end())
+            return std::nullopt;
+
+        return iter->second;
+    }
+
+    bool WellGroupEvents::hasEvent(std::size_t index, uint64_t eventMask) const {
+        return this->m_events[index].hasEvent(eventMask);
     }
 
     bool WellGroupEvents::hasEvent(const std::string& wgname, uint64_t eventMask) const {
-        const auto events_iter = this->m_wellgroup_events.find(wgname);
-        if (events_iter == this->m_wellgroup_events.end())
+        const auto index = this->index(wgname);
+        if (!index.has_value())
             return false;
-        return events_iter->second.hasEvent(eventMask);
+        return this->hasEvent(*index, eventMask);
+    }
+
+    bool WellGroupEvents::anyHasEvent(uint64_t eventMask) const {
+        uint64_t all_events = 0;
+        for (const auto& events : this->m_events)
+            all_events |= events.m_events;
+
+        return (all_events & eventMask) != 0;
+    }
+
+    std::vector<std::string> WellGroupEvents::withEvent(bool wells, uint64_t eventMask) const {
+        std::vector<std::string> names;
+        for (std::size_t i = 0; i < this->m_events.size(); ++i) {
+            if (this->m_events[i].hasEvent(eventMask) && (this->m_entities->is_well[i] == wells))
+                names.push_back(this->m_entities->names[i]);
+        }
+        return names;
+    }
+
+    std::vector<std::string> WellGroupEvents::wellsWithEvent(uint64_t eventMask) const {
+        return this->withEvent(true, eventMask);
+    }
+
+    std::vector<std::string> WellGroupEvents::groupsWithEvent(uint64_t eventMask) const {
+        return this->withEvent(false, eventMask);
     }
 
     void WellGroupEvents::clearEvent(const std::string& wgname, uint64_t eventMask) {
-        const auto events_iter = this->m_wellgroup_events.find(wgname);
-        if (events_iter != this->m_wellgroup_events.end())
-            events_iter->second.clearEvent(eventMask);
+        const auto index = this->index(wgname);
+        if (index.has_value())
+            this->m_events[*index].clearEvent(eventMask);
     }
 
     void WellGroupEvents::addEvent(const std::string& wgname, ScheduleEvents::Events event) {
-        const auto events_iter = this->m_wellgroup_events.find(wgname);
-        if (events_iter == this->m_wellgroup_events.end())
+        const auto index = this->index(wgname);
+        if (!index.has_value())
             throw std::logic_error(fmt::format("Adding event for unknown well/group: {}", wgname));
-        events_iter->second.addEvent(event);
+        this->m_events[*index].addEvent(event);
     }
 
     void WellGroupEvents::reset() {
-        for (auto& [_, events] : this->m_wellgroup_events) {
-            (void)_;
+        for (auto& events : this->m_events)
             events.reset();
-        }
     }
 
     bool WellGroupEvents::operator==(const WellGroupEvents& data) const {
-        return this->m_wellgroup_events == data.m_wellgroup_events;
+        if (this->m_events.size() != data.m_events.size())
+            return false;
+
+        if (this->m_events.empty())
+            return true;
+
+        if ((this->m_entities == data.m_entities) ||
+            ((this->m_entities->names == data.m_entities->names) &&
+             (this->m_entities->is_well == data.m_entities->is_well)))
+            return this->m_events == data.m_events;
+
+        // Same wells and groups added in different order.
+        for (std::size_t i = 0; i < this->m_events.size(); ++i) {
+            const auto other = data.index(this->m_entities->names[i]);
+            if (!other.has_value() || !(this->m_events[i] == data.m_events[*other]))
+                return false;
+        }
+        return true;
     }
 
 
     const Events& WellGroupEvents::at(const std::string& wgname) const {
-        return this->m_wellgroup_events.at(wgname);
+        const auto index = this->index(wgname);
+        if (!index.has_value())
+            throw std::out_of_range(fmt::format("No events for unknown well/group: {}", wgname));
+        return this->m_events[*index];
     }
 
 
     bool WellGroupEvents::has(const std::string& wgname) const {
-        return this->m_wellgroup_events.count(wgname);
+        return this->index(wgname).has_value();
     }
 
 }
@@ -19,9 +19,13 @@
 #ifndef SCHEDULE_EVENTS_HPP
 #define SCHEDULE_EVENTS_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Opm
 {
@@ -169,10 +173,21 @@ namespace Opm
         }
 
     private:
+        friend class WellGroupEvents;
+
         uint64_t m_events = 0;
     };
 
 
+    /*
+      Events of the individual wells and groups.
+
+      The event masks are stored densely, indexed by the order in which the
+      wells and groups were added, and the table of names is shared between
+      copies until a new well or group is added. Copying the events from one
+      report step to the next is therefore cheap, and the index() of a well
+      or group is the same in all copies.
+    */
     class WellGroupEvents {
     public:
         static WellGroupEvents serializationTestObject();
@@ -187,15 +202,50 @@ namespace Opm
         const Events& at(const std::string& wgname) const;
         bool operator==(const WellGroupEvents& data) const;
 
+        std::size_t size() const;
+        std::optional<std::size_t> index(const std::string& wgname) const;
+        bool hasEvent(std::size_t index, uint64_t eventMask) const;
+
+        // Whether any well or group has one of the events in eventMask.
+        bool anyHasEvent(uint64_t eventMask) const;
+
+        // Names of the wells, or groups, which have one of the events in
+        // eventMask, in the order they were added.
+        std::vector<std::string> wellsWithEvent(uint64_t eventMask) const;
+        std::vector<std::string> groupsWithEvent(uint64_t eventMask) const;
+
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
-            serializer(m_wellgroup_events);
+            serializer(m_entities);
+            serializer(m_events);
         }
     private:
-        std::unordered_map<std::string, Events> m_wellgroup_events;
-    };
+        struct Entities {
+            std::vector<std::string> names{};
+            std::vector<bool> is_well{};
+            std::unordered_map<std::string, std::size_t> index{};
+
+            template<class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                serializer(names);
+                serializer(is_well);
+                if (!serializer.isSerializing()) {
+                    index.clear();
+                    for (std::size_t i = 0; i < names.size(); ++i)
+                        index.emplace(names[i], i);
+                }
+            }
+        };
+
+        // Shared between copies, must be copied before it is modified.
+        std::shared_ptr<Entities> m_entities{};
+        std::vector<Events> m_events{};
 
+        void add(const std::string& wgname, bool is_well, ScheduleEvents::Events event);
+        std::vector<std::string> withEvent(bool wells, uint64_t eventMask) const;
+    };
 
 }
 
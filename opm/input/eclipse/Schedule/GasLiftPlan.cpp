@@ -0,0 +1,144 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/GasLiftPlan.hpp>
+
+#include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+#include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    std::optional<std::size_t>
+    lookup(const std::unordered_map<std::string, std::size_t>& index,
+           std::string_view                                    name)
+    {
+        const auto pos = index.find(std::string { name });
+        if (pos == index.end()) {
+            return std::nullopt;
+        }
+
+        return pos->second;
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+GasLiftPlan::GasLiftPlan(const ScheduleState& state)
+{
+    const auto& glo = state.glo();
+
+    this->increment_ = glo.gaslift_increment();
+    this->minEcoGradient_ = glo.min_eco_gradient();
+    this->minWait_ = glo.min_wait();
+    this->allNewton_ = glo.all_newton();
+
+    for (const auto& gname : state.group_order()) {
+        if (! glo.has_group(gname)) {
+            continue;
+        }
+
+        const auto& group = glo.group(gname);
+
+        this->groupIndex_.emplace(gname, this->groupNames_.size());
+        this->groupNames_.push_back(gname);
+        this->maxLiftGas_.push_back(group.max_lift_gas());
+        this->maxTotalGas_.push_back(group.max_total_gas());
+    }
+
+    for (const auto& wname : state.well_order().names()) {
+        if (! glo.has_well(wname) || ! state.wells.has(wname)) {
+            continue;
+        }
+
+        const auto& well = glo.well(wname);
+
+        this->wellIndex_.emplace(wname, this->wellNames_.size());
+        this->wellNames_.push_back(wname);
+        this->useGlo_.push_back(well.use_glo());
+        this->maxRate_.push_back(well.max_rate());
+        this->minRate_.push_back(well.min_rate());
+        this->weight_.push_back(well.weight_factor());
+        this->incWeight_.push_back(well.inc_weight_factor());
+        this->allocExtraGas_.push_back(well.alloc_extra_gas());
+
+        // Walk up the group tree once.  The number of steps is bounded in
+        // case of a malformed tree.
+        auto gname = state.wells(wname).groupName();
+        for (std::size_t steps = 0;
+             ! gname.empty() && state.groups.has(gname) && (steps <= state.groups.size());
+             ++steps)
+        {
+            if (const auto group = this->groupIndex(gname); group.has_value()) {
+                this->chainGroups_.push_back(*group);
+            }
+
+            const auto parent = state.groups(gname).control_group();
+            if (! parent.has_value()) {
+                break;
+            }
+
+            gname = *parent;
+        }
+
+        this->chainStart_.push_back(this->chainGroups_.size());
+    }
+
+    // Invert the chains.  Wells are visited in increasing order, so the
+    // wells of each group are too.
+    this->groupWellStart_.assign(this->groupNames_.size() + 1, 0);
+    for (const auto& group : this->chainGroups_) {
+        ++this->groupWellStart_[group + 1];
+    }
+
+    for (std::size_t group = 0; group < this->groupNames_.size(); ++group) {
+        this->groupWellStart_[group + 1] += this->groupWellStart_[group];
+    }
+
+    this->groupWells_.resize(this->chainGroups_.size());
+    auto next = std::vector<std::size_t>(this->groupWellStart_.begin(),
+                                         this->groupWellStart_.end() - 1);
+
+    for (std::size_t well = 0; well < this->wellNames_.size(); ++well) {
+        for (const auto& group : this->groupChain(well)) {
+            this->groupWells_[next[group]++] = well;
+        }
+    }
+}
+
+std::optional<std::size_t> GasLiftPlan::wellIndex(std::string_view name) const
+{
+    return lookup(this->wellIndex_, name);
+}
+
+std::optional<std::size_t> GasLiftPlan::groupIndex(std::string_view name) const
+{
+    return lookup(this->groupIndex_, name);
+}
+
+} // namespace Opm
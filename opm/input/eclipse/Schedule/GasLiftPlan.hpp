@@ -0,0 +1,188 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GAS_LIFT_PLAN_HPP
+#define GAS_LIFT_PLAN_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+    class ScheduleState;
+} // namespace Opm
+
+namespace Opm {
+
+/// Integer indexed form of the gas lift optimisation settings of one
+/// report step.
+///
+/// Wells with WLIFTOPT settings and groups with GLIFTOPT limits are
+/// identified by their position in wellNames() and groupNames(), which
+/// follow the well and group insertion order of the report step.  Well
+/// parameters are held in dense arrays, and for each well the GLIFTOPT
+/// groups above it in the group tree are precomputed, so gas lift
+/// iterations need neither name lookups nor walks up the group tree.
+/// An object is never modified after construction.
+class GasLiftPlan
+{
+public:
+    /// Contiguous range of well or group indices.
+    class IndexRange
+    {
+    public:
+        using const_iterator = std::vector<std::size_t>::const_iterator;
+
+        IndexRange(const_iterator begin, const_iterator end)
+            : begin_{ begin }
+            , end_  { end }
+        {}
+
+        const_iterator begin() const { return this->begin_; }
+        const_iterator end() const { return this->end_; }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(this->end_ - this->begin_);
+        }
+
+        bool empty() const { return this->begin_ == this->end_; }
+
+        std::size_t operator[](const std::size_t i) const
+        {
+            return *(this->begin_ + i);
+        }
+
+    private:
+        const_iterator begin_{};
+        const_iterator end_{};
+    };
+
+    /// Default constructor.
+    ///
+    /// No gas lift optimisation.
+    GasLiftPlan() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] state Report step whose LIFTOPT, GLIFTOPT and WLIFTOPT
+    ///   settings, wells and group tree define the plan.
+    explicit GasLiftPlan(const ScheduleState& state);
+
+    /// Whether gas lift optimisation is active, i.e., whether the lift
+    /// gas increment is positive.
+    bool active() const { return this->increment_ > 0.0; }
+
+    /// Lift gas increment from LIFTOPT.
+    double increment() const { return this->increment_; }
+
+    double minEcoGradient() const { return this->minEcoGradient_; }
+    double minWait() const { return this->minWait_; }
+    bool allNewton() const { return this->allNewton_; }
+
+    std::size_t numWells() const { return this->wellNames_.size(); }
+    const std::vector<std::string>& wellNames() const { return this->wellNames_; }
+
+    /// Index of named well.
+    ///
+    /// \return Well index, or nullopt if the well has no WLIFTOPT
+    ///   settings.
+    std::optional<std::size_t> wellIndex(std::string_view name) const;
+
+    bool useGlo(const std::size_t well) const { return this->useGlo_[well] != 0; }
+
+    /// Maximum lift gas rate.  See GasLiftWell::max_rate() for the
+    /// meaning of an empty value.
+    const std::optional<double>& maxRate(const std::size_t well) const
+    {
+        return this->maxRate_[well];
+    }
+
+    double minRate(const std::size_t well) const { return this->minRate_[well]; }
+    double weightFactor(const std::size_t well) const { return this->weight_[well]; }
+    double incWeightFactor(const std::size_t well) const { return this->incWeight_[well]; }
+    bool allocExtraGas(const std::size_t well) const { return this->allocExtraGas_[well] != 0; }
+
+    std::size_t numGroups() const { return this->groupNames_.size(); }
+    const std::vector<std::string>& groupNames() const { return this->groupNames_; }
+
+    /// Index of named group.
+    ///
+    /// \return Group index, or nullopt if the group has no GLIFTOPT
+    ///   limits.
+    std::optional<std::size_t> groupIndex(std::string_view name) const;
+
+    const std::optional<double>& maxLiftGas(const std::size_t group) const
+    {
+        return this->maxLiftGas_[group];
+    }
+
+    const std::optional<double>& maxTotalGas(const std::size_t group) const
+    {
+        return this->maxTotalGas_[group];
+    }
+
+    /// GLIFTOPT groups constraining a well, from the well's own group
+    /// towards the FIELD group.
+    IndexRange groupChain(const std::size_t well) const
+    {
+        return { this->chainGroups_.begin() + this->chainStart_[well],
+                 this->chainGroups_.begin() + this->chainStart_[well + 1] };
+    }
+
+    /// Wells constrained by a GLIFTOPT group, i.e., the wells whose
+    /// groupChain() contains the group.  Increasing order.
+    IndexRange groupWells(const std::size_t group) const
+    {
+        return { this->groupWells_.begin() + this->groupWellStart_[group],
+                 this->groupWells_.begin() + this->groupWellStart_[group + 1] };
+    }
+
+private:
+    double increment_{0.0};
+    double minEcoGradient_{0.0};
+    double minWait_{0.0};
+    bool allNewton_{true};
+
+    std::vector<std::string> wellNames_{};
+    std::unordered_map<std::string, std::size_t> wellIndex_{};
+    std::vector<char> useGlo_{};
+    std::vector<std::optional<double>> maxRate_{};
+    std::vector<double> minRate_{};
+    std::vector<double> weight_{};
+    std::vector<double> incWeight_{};
+    std::vector<char> allocExtraGas_{};
+
+    std::vector<std::string> groupNames_{};
+    std::unordered_map<std::string, std::size_t> groupIndex_{};
+    std::vector<std::optional<double>> maxLiftGas_{};
+    std::vector<std::optional<double>> maxTotalGas_{};
+
+    std::vector<std::size_t> chainStart_{0};
+    std::vector<std::size_t> chainGroups_{};
+    std::vector<std::size_t> groupWellStart_{0};
+    std::vector<std::size_t> groupWells_{};
+};
+
+} // namespace Opm
+
+#endif // GAS_LIFT_PLAN_HPP
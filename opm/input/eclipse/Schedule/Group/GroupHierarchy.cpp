@@ -0,0 +1,161 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
+
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+GroupHierarchy::GroupHierarchy(const std::size_t version,
+                               const std::vector<const Group*>& groups)
+    : version_(version)
+{
+    std::size_t size = 0;
+    for (const auto* group : groups) {
+        size = std::max(size, group->insert_index() + 1);
+    }
+
+    this->name_.resize(size);
+    this->parent_.assign(size, npos);
+    this->level_.assign(size, npos);
+
+    auto index = std::unordered_map<std::string, std::size_t>{};
+    for (const auto* group : groups) {
+        this->name_[group->insert_index()] = group->name();
+        index.emplace(group->name(), group->insert_index());
+    }
+
+    auto children = std::vector<std::vector<std::size_t>>(size);
+    for (const auto* group : groups) {
+        auto& child_index = children[group->insert_index()];
+        for (const auto& child : group->groups()) {
+            if (auto pos = index.find(child); pos != index.end()) {
+                child_index.push_back(pos->second);
+            }
+        }
+    }
+
+    this->buildChildWells(groups, children);
+
+    const auto root = index.find("FIELD");
+    if (root == index.end()) {
+        return;
+    }
+
+    this->pre_order_.reserve(groups.size());
+    this->post_order_.reserve(groups.size());
+
+    // Depth first traversal from FIELD.  Each stack entry holds a group
+    // and the number of its children visited so far.
+    auto stack = std::vector<std::pair<std::size_t, std::size_t>>{};
+    stack.emplace_back(root->second, 0);
+    this->level_[root->second] = 0;
+    this->pre_order_.push_back(root->second);
+
+    while (! stack.empty()) {
+        auto& [current, next_child] = stack.back();
+        const auto& child_index = children[current];
+
+        if (next_child == child_index.size()) {
+            this->post_order_.push_back(current);
+            stack.pop_back();
+            continue;
+        }
+
+        const auto child = child_index[next_child++];
+        if (this->level_[child] != npos) {
+            // Already visited.  Guards against malformed input.
+            continue;
+        }
+
+        this->parent_[child] = current;
+        this->level_[child] = this->level_[current] + 1;
+        this->pre_order_.push_back(child);
+        stack.emplace_back(child, 0);
+    }
+}
+
+void GroupHierarchy::buildChildWells(const std::vector<const Group*>& groups,
+                                     const std::vector<std::vector<std::size_t>>& children)
+{
+    const auto size = this->parent_.size();
+
+    auto group_ptr = std::vector<const Group*>(size, nullptr);
+    for (const auto* group : groups) {
+        group_ptr[group->insert_index()] = group;
+    }
+
+    // Wells below each group, assembled bottom up so that every group
+    // is only visited once.
+    auto wells = std::vector<std::vector<std::string>>(size);
+    auto state = std::vector<char>(size, 0);  // 0: new, 1: active, 2: done
+
+    const auto collect = [&](const std::size_t index, const auto& self) -> void
+    {
+        if (state[index] != 0) {
+            // Done, or a cycle in malformed input.
+            return;
+        }
+
+        state[index] = 1;
+        const auto* group = group_ptr[index];
+        auto& group_wells = wells[index];
+
+        if (group != nullptr) {
+            if (! group->groups().empty()) {
+                for (const auto child : children[index]) {
+                    self(child, self);
+                    group_wells.insert(group_wells.end(),
+                                       wells[child].begin(), wells[child].end());
+                }
+            }
+            else {
+                group_wells.assign(group->wells().begin(), group->wells().end());
+            }
+        }
+
+        state[index] = 2;
+    };
+
+    for (std::size_t index = 0; index < size; ++index) {
+        collect(index, collect);
+    }
+
+    this->child_well_offset_.assign(1, 0);
+    this->child_well_offset_.reserve(size + 1);
+    for (const auto& group_wells : wells) {
+        this->child_well_offset_.push_back(this->child_well_offset_.back() + group_wells.size());
+    }
+
+    this->child_wells_.reserve(this->child_well_offset_.back());
+    for (auto& group_wells : wells) {
+        std::move(group_wells.begin(), group_wells.end(), std::back_inserter(this->child_wells_));
+    }
+}
+
+} // namespace Opm
@@ -0,0 +1,151 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GROUP_HIERARCHY_HPP
+#define OPM_GROUP_HIERARCHY_HPP
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class Group;
+
+/// Flat representation of the group tree at one report step.
+///
+/// Groups are identified by Group::insert_index(), i.e., the same index
+/// as in Schedule::getGroup(index, report_step), and all per-group arrays
+/// are indexed by it.  The tree is rooted at FIELD, and groups which are
+/// not connected to FIELD are not part of the traversal orders.
+///
+/// Obtained from ScheduleState::group_hierarchy(), which builds it once
+/// per change of the group structure.  version() identifies the group
+/// structure the hierarchy was built from, so downstream caches keyed on
+/// it can be invalidated by comparing one integer.
+class GroupHierarchy
+{
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /// Contiguous range of well names.
+    class NameRange
+    {
+    public:
+        using const_iterator = std::vector<std::string>::const_iterator;
+
+        NameRange(const_iterator begin, const_iterator end)
+            : begin_{ begin }
+            , end_  { end }
+        {}
+
+        const_iterator begin() const { return this->begin_; }
+        const_iterator end() const { return this->end_; }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(this->end_ - this->begin_);
+        }
+
+        bool empty() const { return this->begin_ == this->end_; }
+
+    private:
+        const_iterator begin_{};
+        const_iterator end_{};
+    };
+
+    GroupHierarchy() = default;
+    GroupHierarchy(std::size_t version, const std::vector<const Group*>& groups);
+
+    std::size_t version() const { return this->version_; }
+
+    /// Number of index slots, i.e., one more than the largest group index.
+    std::size_t size() const { return this->parent_.size(); }
+
+    /// Whether index is a group in the tree rooted at FIELD.
+    bool contains(std::size_t index) const
+    {
+        return (index < this->size()) && (this->level_[index] != npos);
+    }
+
+    const std::string& name(std::size_t index) const { return this->name_[index]; }
+
+    /// Index of the parent group, npos for FIELD.
+    std::size_t parent(std::size_t index) const { return this->parent_[index]; }
+
+    /// Distance from FIELD, zero for FIELD itself.
+    std::size_t level(std::size_t index) const { return this->level_[index]; }
+
+    /// Groups with every group before its children, starting with FIELD.
+    /// Children are in the order they were added to the parent.  Suitable
+    /// for passes which distribute values down the tree.
+    const std::vector<std::size_t>& preOrder() const { return this->pre_order_; }
+
+    /// Groups with every group after its children, ending with FIELD.
+    /// Suitable for passes which aggregate values up the tree.
+    const std::vector<std::size_t>& postOrder() const { return this->post_order_; }
+
+    /// Wells below a group, in the order of Schedule::getChildWells2():
+    /// the wells of all child groups in turn for a group with child
+    /// groups, and the group's own wells otherwise.  Available for all
+    /// groups, also those which are not connected to FIELD.
+    NameRange childWells(std::size_t index) const
+    {
+        return {
+            this->child_wells_.begin() + this->child_well_offset_[index],
+            this->child_wells_.begin() + this->child_well_offset_[index + 1]
+        };
+    }
+
+    /// Add the value of every group to the value of its parent, so that
+    /// every group ends up with the total over its subtree.  The values
+    /// are indexed by group index.
+    template <typename T>
+    void sumToParents(std::vector<T>& values) const
+    {
+        for (const auto index : this->post_order_) {
+            const auto parent = this->parent_[index];
+            if (parent != npos) {
+                values[parent] += values[index];
+            }
+        }
+    }
+
+private:
+    void buildChildWells(const std::vector<const Group*>& groups,
+                         const std::vector<std::vector<std::size_t>>& children);
+
+    std::size_t version_{0};
+
+    std::vector<std::string> name_{};
+    std::vector<std::size_t> parent_{};
+    std::vector<std::size_t> level_{};
+
+    std::vector<std::size_t> pre_order_{};
+    std::vector<std::size_t> post_order_{};
+
+    // CSR representation of childWells().
+    std::vector<std::size_t> child_well_offset_{};
+    std::vector<std::string> child_wells_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_GROUP_HIERARCHY_HPP
@@ -32,6 +32,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/core.h>
 
@@ -77,6 +78,7 @@ void Opm::GuideRate::setSerializationTestData()
     injection_group_values = {{{Phase::FOAM, "test2"}, 1.0}};
     potentials = {{"test3", RateVector::serializationTestObject()}};
     guide_rates_expired = true;
+    this->rebuild_handle_tables();
 }
 
 double Opm::GuideRate::get(const std::string&          well,
@@ -96,16 +98,67 @@ double Opm::GuideRate::get(const std::string&               group,
 double Opm::GuideRate::get(const std::string&           name,
                            const GuideRateModel::Target model_target,
                            const RateVector&            rates) const
+{
+    auto entry = HandleEntry{};
+    if (auto iter = this->values.find(name); iter != this->values.end()) {
+        entry.value = iter->second.get();
+    }
+    if (auto iter = this->potentials.find(name); iter != this->potentials.end()) {
+        entry.potentials = &iter->second;
+    }
+
+    return this->get_value(entry, name, model_target, rates);
+}
+
+double Opm::GuideRate::getWell(const std::size_t            well_index,
+                               const GuideRateModel::Target model_target,
+                               const RateVector&            rates) const
+{
+    if (well_index >= this->well_entries.size()) {
+        throw std::out_of_range {
+            fmt::format("No guide rate or potentials for well index {}", well_index)
+        };
+    }
+
+    return this->get_value(this->well_entries[well_index],
+                           fmt::format("well index {}", well_index),
+                           model_target, rates);
+}
+
+double Opm::GuideRate::getGroup(const std::size_t            group_index,
+                                const GuideRateModel::Target model_target,
+                                const RateVector&            rates) const
+{
+    if (group_index >= this->group_entries.size()) {
+        throw std::out_of_range {
+            fmt::format("No guide rate or potentials for group index {}", group_index)
+        };
+    }
+
+    return this->get_value(this->group_entries[group_index],
+                           fmt::format("group index {}", group_index),
+                           model_target, rates);
+}
+
+double Opm::GuideRate::get_value(const HandleEntry&           entry,
+                                 const std::string&           name,
+                                 const GuideRateModel::Target model_target,
+                                 const RateVector&            rates) const
 {
     using namespace unit;
     using prefix::micro;
 
-    auto iter = this->values.find(name);
-    if (iter == this->values.end()) {
-        return this->potentials.at(name).eval(model_target);
+    if (entry.value == nullptr) {
+        if (entry.potentials == nullptr) {
+            throw std::out_of_range {
+                fmt::format("No guide rate or potentials for {}", name)
+            };
+        }
+
+        return entry.potentials->eval(model_target);
     }
 
-    const auto& value = *iter->second;
+    const auto& value = *entry.value;
     const auto grvalue = this->get_grvalue_result(value);
     if (value.curr.target == model_target) {
         return grvalue;
@@ -222,23 +275,82 @@ void Opm::GuideRate::compute(const std::string& wgname,
                              const double       gas_pot,
                              const double       wat_pot)
 {
-    this->potentials[wgname] = RateVector{oil_pot, gas_pot, wat_pot};
+    this->set_potentials(wgname, RateVector{oil_pot, gas_pot, wat_pot});
 
-    const auto& config = this->schedule[report_step].guide_rate();
-    if (config.has_production_group(wgname)) {
-        this->group_compute(wgname, report_step, sim_time, oil_pot, gas_pot, wat_pot);
+    if (this->prepare_compute(wgname, report_step, sim_time)) {
+        const auto& model = this->schedule[report_step].guide_rate().model();
+        const auto guide_rate = this->eval_form(model, oil_pot, gas_pot, wat_pot);
+        this->assign_grvalue(wgname, model, { sim_time, guide_rate, model.target() });
     }
-    else {
-        this->well_compute(wgname, report_step, sim_time, oil_pot, gas_pot, wat_pot);
+}
+
+void Opm::GuideRate::compute(const std::vector<std::string>& wgnames,
+                             const std::size_t               report_step,
+                             const double                    sim_time,
+                             const std::vector<RateVector>&  pots)
+{
+    if (pots.size() != wgnames.size()) {
+        throw std::invalid_argument {
+            fmt::format("Guide rate computation for {} wells/groups "
+                        "with {} potentials", wgnames.size(), pots.size())
+        };
+    }
+
+    auto formula = std::vector<std::size_t>{};
+    auto oil_pot = std::vector<double>{};
+    auto gas_pot = std::vector<double>{};
+    auto wat_pot = std::vector<double>{};
+
+    for (auto i = 0*wgnames.size(); i < wgnames.size(); ++i) {
+        this->set_potentials(wgnames[i], pots[i]);
+
+        if (this->prepare_compute(wgnames[i], report_step, sim_time)) {
+            formula.push_back(i);
+            oil_pot.push_back(pots[i].oil_rat);
+            gas_pot.push_back(pots[i].gas_rat);
+            wat_pot.push_back(pots[i].wat_rat);
+        }
     }
+
+    if (formula.empty()) {
+        return;
+    }
+
+    const auto& model = this->schedule[report_step].guide_rate().model();
+
+    auto guide_rates = std::vector<double>{};
+    model.eval(oil_pot, gas_pot, wat_pot, guide_rates);
+
+    for (auto i = 0*formula.size(); i < formula.size(); ++i) {
+        this->assign_grvalue(wgnames[formula[i]], model,
+                             { sim_time, guide_rates[i], model.target() });
+    }
+}
+
+void Opm::GuideRate::set_potentials(const std::string& wgname,
+                                    const RateVector&  pots)
+{
+    auto [pos, inserted] = this->potentials.insert_or_assign(wgname, pots);
+    static_cast<void>(pos);
+
+    if (inserted) {
+        this->update_handle_entry(wgname);
+    }
+}
+
+bool Opm::GuideRate::prepare_compute(const std::string& wgname,
+                                     const std::size_t  report_step,
+                                     const double       sim_time)
+{
+    const auto& config = this->schedule[report_step].guide_rate();
+    return config.has_production_group(wgname)
+        ? this->group_prepare(wgname, report_step, sim_time)
+        : this->well_prepare(wgname, report_step, sim_time);
 }
 
-void Opm::GuideRate::group_compute(const std::string& wgname,
+bool Opm::GuideRate::group_prepare(const std::string& wgname,
                                    const std::size_t  report_step,
-                                   const double       sim_time,
-                                   const double       oil_pot,
-                                   const double       gas_pot,
-                                   const double       wat_pot)
+                                   const double       sim_time)
 {
     const auto& config = this->schedule[report_step].guide_rate();
     const auto& group = config.production_group(wgname);
@@ -247,6 +359,7 @@ void Opm::GuideRate::group_compute(const std::string& wgname,
 
         const auto& model = config.has_model() ? config.model() : GuideRateModel{};
         this->assign_grvalue(wgname, model, { sim_time, group.guide_rate, model_target });
+        return false;
     }
     else {
         const auto is_formula = group.target == Group::GuideRateProdTarget::FORM;
@@ -265,7 +378,7 @@ void Opm::GuideRate::group_compute(const std::string& wgname,
             !this->guide_rates_expired &&
             (iter->second->curr.value > 0.0))
         {
-            return;
+            return false;
         }
 
         if (group.target == Group::GuideRateProdTarget::INJV) {
@@ -276,10 +389,7 @@ void Opm::GuideRate::group_compute(const std::string& wgname,
             throw std::logic_error("Group guide rate mode: POTN not implemented");
         }
 
-        if (is_formula) {
-            const auto guide_rate = this->eval_form(config.model(), oil_pot, gas_pot, wat_pot);
-            this->assign_grvalue(wgname, config.model(), { sim_time, guide_rate, config.model().target() });
-        }
+        return is_formula;
     }
 }
 
@@ -304,12 +414,9 @@ void Opm::GuideRate::compute(const std::string& wgname,
     this->injection_group_values[std::make_pair(phase, wgname)] = group.guide_rate;
 }
 
-void Opm::GuideRate::well_compute(const std::string& wgname,
+bool Opm::GuideRate::well_prepare(const std::string& wgname,
                                   const std::size_t  report_step,
-                                  const double       sim_time,
-                                  const double       oil_pot,
-                                  const double       gas_pot,
-                                  const double       wat_pot)
+                                  const double       sim_time)
 {
     const auto& config = this->schedule[report_step].guide_rate();
 
@@ -325,12 +432,12 @@ void Opm::GuideRate::well_compute(const std::string& wgname,
     else if (config.has_model()) { // GUIDERAT
         if (! this->schedule.hasWell(wgname, report_step)) {
             // 'wgname' might be a group or the well is not yet online.
-            return;
+            return false;
         }
 
         // GUIDERAT does not apply to injectors
         if (this->schedule.getWell(wgname, report_step).isInjector()) {
-            return;
+            return false;
         }
 
         // Use existing guide rate value if sufficiently recent.
@@ -340,14 +447,14 @@ void Opm::GuideRate::well_compute(const std::string& wgname,
                 !this->guide_rates_expired &&
                 (existing->second->curr.value > 0.0))
             {
-                return;
+                return false;
             }
         }
 
-        const auto& model = config.model();
-        const auto guide_rate = this->eval_form(model, oil_pot, gas_pot, wat_pot);
-        this->assign_grvalue(wgname, model, { sim_time, guide_rate, model.target() });
+        return true;
     }
+
+    return false;
 }
 
 double Opm::GuideRate::eval_form(const GuideRateModel& model,
@@ -375,6 +482,7 @@ void Opm::GuideRate::assign_grvalue(const std::string&    wgname,
     auto& v = this->values[wgname];
     if (v == nullptr) {
         v = std::make_unique<GRValState>();
+        this->update_handle_entry(wgname);
     }
 
     if (value.sim_time > v->curr.sim_time) {
@@ -442,6 +550,50 @@ void Opm::GuideRate::init_grvalue_SI(const std::size_t  report_step,
     this->init_grvalue(report_step, wgname, std::move(value));
 }
 
+void Opm::GuideRate::update_handle_entry(const std::string& wgname)
+{
+    auto entry = HandleEntry{};
+    if (auto iter = this->values.find(wgname); iter != this->values.end()) {
+        entry.value = iter->second.get();
+    }
+    if (auto iter = this->potentials.find(wgname); iter != this->potentials.end()) {
+        entry.potentials = &iter->second;
+    }
+
+    auto assign = [&entry](std::vector<HandleEntry>& entries, const std::size_t index)
+    {
+        if (entries.size() <= index) {
+            entries.resize(index + 1);
+        }
+
+        entries[index] = entry;
+    };
+
+    if (const auto well_index = this->schedule.wellIndex(wgname); well_index.has_value()) {
+        assign(this->well_entries, *well_index);
+    }
+
+    if (const auto group_index = this->schedule.groupIndex(wgname); group_index.has_value()) {
+        assign(this->group_entries, *group_index);
+    }
+}
+
+void Opm::GuideRate::rebuild_handle_tables()
+{
+    this->well_entries.clear();
+    this->group_entries.clear();
+
+    for (const auto& [wgname, _] : this->values) {
+        static_cast<void>(_);
+        this->update_handle_entry(wgname);
+    }
+
+    for (const auto& [wgname, _] : this->potentials) {
+        static_cast<void>(_);
+        this->update_handle_entry(wgname);
+    }
+}
+
 double Opm::GuideRate::get_grvalue_result(const GRValState& gr) const
 {
     return (gr.curr.sim_time < 0.0)
@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Opm {
 
@@ -122,6 +123,14 @@ public:
                  const double       gas_pot,
                  const double       wat_pot);
 
+    /// Same as calling the compute() above for each element of wgnames
+    /// and the corresponding potentials, but with all GUIDERAT formula
+    /// evaluations done in one batch.
+    void compute(const std::vector<std::string>& wgnames,
+                 const std::size_t               report_step,
+                 const double                    sim_time,
+                 const std::vector<RateVector>&  pots);
+
     void compute(const std::string& wgname,
                  const Phase&       phase,
                  const std::size_t  report_step,
@@ -136,6 +145,13 @@ public:
     double get(const std::string& name, const GuideRateModel::Target model_target, const RateVector& rates) const;
     double get(const std::string& group, const Phase& phase) const;
 
+    /// Same as get(name, model_target, rates), but with the well or group
+    /// identified by Schedule::wellIndex() or Schedule::groupIndex().
+    /// Dense table lookups without hashing the name, for repeated queries
+    /// in the group control iterations.
+    double getWell(const std::size_t well_index, const GuideRateModel::Target model_target, const RateVector& rates) const;
+    double getGroup(const std::size_t group_index, const GuideRateModel::Target model_target, const RateVector& rates) const;
+
     double getSI(const std::string& well, const WellGuideRateTarget target, const RateVector& rates) const;
     double getSI(const std::string& group, const Group::GuideRateProdTarget target, const RateVector& rates) const;
     double getSI(const std::string& wgname, const GuideRateModel::Target target, const RateVector& rates) const;
@@ -154,6 +170,8 @@ public:
         serializer(injection_group_values);
         serializer(potentials);
         serializer(guide_rates_expired);
+        if (!serializer.isSerializing())
+            this->rebuild_handle_tables();
     }
 
 private:
@@ -185,22 +203,33 @@ private:
         }
     };
 
+    /// Guide rate state and potentials of one well or group, indexed by
+    /// well or group index.  Points into values and potentials, whose
+    /// elements do not move when the maps grow.
+    struct HandleEntry
+    {
+        const GRValState* value{nullptr};
+        const RateVector* potentials{nullptr};
+    };
+
     using GRValPtr = std::unique_ptr<GRValState>;
     using pair = std::pair<Phase, std::string>;
 
-    void well_compute(const std::string& wgname,
+    void set_potentials(const std::string& wgname, const RateVector& pots);
+
+    // Assign fixed guide rates.  Return whether the guide rate must be
+    // computed from the GUIDERAT formula.
+    bool prepare_compute(const std::string& wgname,
+                         const std::size_t  report_step,
+                         const double       sim_time);
+
+    bool well_prepare(const std::string& wgname,
                       const std::size_t  report_step,
-                      const double       sim_time,
-                      const double       oil_pot,
-                      const double       gas_pot,
-                      const double       wat_pot);
+                      const double       sim_time);
 
-    void group_compute(const std::string& wgname,
+    bool group_prepare(const std::string& wgname,
                        const std::size_t  report_step,
-                       const double       sim_time,
-                       const double       oil_pot,
-                       const double       gas_pot,
-                       const double       wat_pot);
+                       const double       sim_time);
 
     double eval_form(const GuideRateModel& model,
                      const double          oil_pot,
@@ -214,12 +243,23 @@ private:
                         GuideRateValue&&      value);
     double get_grvalue_result(const GRValState& gr) const;
 
+    double get_value(const HandleEntry&           entry,
+                     const std::string&           name,
+                     const GuideRateModel::Target model_target,
+                     const RateVector&            rates) const;
+
+    void update_handle_entry(const std::string& wgname);
+    void rebuild_handle_tables();
+
     const Schedule& schedule;
 
     std::unordered_map<std::string, GRValPtr> values{};
     std::unordered_map<pair, double, pair_hash> injection_group_values{};
     std::unordered_map<std::string, RateVector> potentials{};
     bool guide_rates_expired {false};
+
+    std::vector<HandleEntry> well_entries{};
+    std::vector<HandleEntry> group_entries{};
 };
 
 } // namespace Opm
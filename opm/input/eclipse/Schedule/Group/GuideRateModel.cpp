@@ -18,8 +18,10 @@
 */
 #include <stdexcept>
 #include <cmath>
+#include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <opm/input/eclipse/Parser/ParserKeywords/L.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateModel.hpp>
@@ -143,12 +145,53 @@ double GuideRateModel::pot(Target target, double oil_pot, double gas_pot, double
 
 
 double GuideRateModel::eval(double oil_pot, double gas_pot, double wat_pot) const {
+    this->check_evaluable();
+    return this->eval_formula(oil_pot, gas_pot, wat_pot);
+}
+
+void GuideRateModel::eval(const std::vector<double>& oil_pot,
+                          const std::vector<double>& gas_pot,
+                          const std::vector<double>& wat_pot,
+                          std::vector<double>& guide_rates) const
+{
+    this->check_evaluable();
+
+    const auto n = oil_pot.size();
+    if ((gas_pot.size() != n) || (wat_pot.size() != n))
+        throw std::invalid_argument("Potential vectors must have the same size");
+
+    guide_rates.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+        guide_rates[i] = this->eval_formula(oil_pot[i], gas_pot[i], wat_pot[i]);
+}
+
+void GuideRateModel::check_evaluable() const {
     if (this->default_model)
         throw std::invalid_argument("The default GuideRateModel can not be evaluated - must enter GUIDERAT information explicitly.");
 
     if (this->m_target == Target::COMB)
         throw std::logic_error("Sorry the COMB target model is not supported");
+}
+
+namespace {
+
+    /*
+      The exponents are very often 0 or 1, for which std::pow() returns 1
+      and x respectively, so skip the call in these cases.
+    */
+    double power(double x, double e) {
+        if (e == 0.0)
+            return 1.0;
+
+        if (e == 1.0)
+            return x;
+
+        return std::pow(x, e);
+    }
+
+}
 
+double GuideRateModel::eval_formula(double oil_pot, double gas_pot, double wat_pot) const {
     double val = this->pot(oil_pot, gas_pot, wat_pot);
     if (val == 0) {
         return 0;
@@ -185,7 +228,7 @@ double GuideRateModel::eval(double oil_pot, double gas_pot, double wat_pot) cons
     }
 
 
-    double denom = this->B + this->C*std::pow(R1, this->D) + this->E*std::pow(R2, this->F);
+    double denom = this->B + this->C*power(R1, this->D) + this->E*power(R2, this->F);
     /*
       The values pot, R1 and R2 are runtime simulation results, so here
       basically anything could happen. Quite dangerous to have hard error
@@ -195,7 +238,7 @@ double GuideRateModel::eval(double oil_pot, double gas_pot, double wat_pot) cons
         throw std::range_error("Invalid denominator: " + std::to_string(denom));
     }
 
-    return std::pow(val, this->A) / denom;
+    return power(val, this->A) / denom;
 }
 
 bool GuideRateModel::operator==(const GuideRateModel& other) const {
@@ -23,6 +23,8 @@
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Schedule/Group/Group.hpp>
 
+#include <vector>
+
 namespace Opm {
 
 enum class WellGuideRateTarget;
@@ -69,6 +71,16 @@ public:
     static GuideRateModel serializationTestObject();
 
     double eval(double oil_pot, double gas_pot, double wat_pot) const;
+
+    /*
+      Evaluate the formula for many sets of potentials at once, with the
+      same result as calling the scalar eval() for each element. Throws
+      before assigning any result if one of them can not be evaluated.
+    */
+    void eval(const std::vector<double>& oil_pot,
+              const std::vector<double>& gas_pot,
+              const std::vector<double>& wat_pot,
+              std::vector<double>& guide_rates) const;
     bool updateLINCOM(const UDAValue& alpha, const UDAValue& beta, const UDAValue& gamma) const;
     double update_delay() const;
     bool allow_increase() const;
@@ -110,6 +122,8 @@ public:
 
 private:
     double pot(double oil_pot, double gas_pot, double wat_pot) const;
+    void check_evaluable() const;
+    double eval_formula(double oil_pot, double gas_pot, double wat_pot) const;
     /*
       Unfortunately the default values will give a GuideRateModel which can not
       be evaluated, due to a division by zero problem.
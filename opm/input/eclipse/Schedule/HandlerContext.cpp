@@ -110,6 +110,16 @@ const ScheduleStatic& HandlerContext::static_schedule() const
     return schedule_.m_static;
 }
 
+std::optional<VFPProdTable> HandlerContext::preparedVFPProd()
+{
+    return schedule_.m_vfp_tables.takeProd(this->keyword);
+}
+
+std::optional<VFPInjTable> HandlerContext::preparedVFPInj()
+{
+    return schedule_.m_vfp_tables.takeInj(this->keyword);
+}
+
 double HandlerContext::getWellPI(const std::string& well_name) const
 {
     if (!target_wellpi) {
@@ -45,6 +45,8 @@ class ScheduleGrid;
 class ScheduleState;
 struct ScheduleStatic;
 struct SimulatorUpdate;
+class VFPInjTable;
+class VFPProdTable;
 enum class WellStatus;
 class WelSegsSet;
 }
@@ -103,6 +105,12 @@ public:
     //! \brief Returns a const-ref to the static schedule.
     const ScheduleStatic& static_schedule() const;
 
+    //! \brief VFPPROD table built ahead of the handler, if any.
+    std::optional<VFPProdTable> preparedVFPProd();
+
+    //! \brief VFPINJ table built ahead of the handler, if any.
+    std::optional<VFPInjTable> preparedVFPInj();
+
     /// \brief Mark that the well occured in a WELSEGS keyword.
     void welsegs_handled(const std::string& well_name);
 
@@ -304,19 +304,25 @@ void handleTUNING(HandlerContext& handlerContext)
 
 void handleVFPINJ(HandlerContext& handlerContext)
 {
-    auto table = VFPInjTable(handlerContext.keyword,
-                             handlerContext.static_schedule().m_unit_system);
+    auto table = handlerContext.preparedVFPInj();
+    if (! table.has_value()) {
+        table = VFPInjTable(handlerContext.keyword,
+                            handlerContext.static_schedule().m_unit_system);
+    }
     handlerContext.state().events().addEvent( ScheduleEvents::VFPINJ_UPDATE );
-    handlerContext.state().vfpinj.update( std::move(table) );
+    handlerContext.state().vfpinj.update( std::move(*table) );
 }
 
 void handleVFPPROD(HandlerContext& handlerContext)
 {
-    auto table = VFPProdTable(handlerContext.keyword,
-                              handlerContext.static_schedule().gaslift_opt_active,
-                              handlerContext.static_schedule().m_unit_system);
+    auto table = handlerContext.preparedVFPProd();
+    if (! table.has_value()) {
+        table = VFPProdTable(handlerContext.keyword,
+                             handlerContext.static_schedule().gaslift_opt_active,
+                             handlerContext.static_schedule().m_unit_system);
+    }
     handlerContext.state().events().addEvent( ScheduleEvents::VFPPROD_UPDATE );
-    handlerContext.state().vfpprod.update( std::move(table) );
+    handlerContext.state().vfpprod.update( std::move(*table) );
 }
 
 }
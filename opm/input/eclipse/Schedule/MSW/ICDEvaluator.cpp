@@ -0,0 +1,123 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/MSW/ICDEvaluator.hpp>
+
+#include <opm/input/eclipse/Schedule/MSW/AICD.hpp>
+#include <opm/input/eclipse/Schedule/MSW/SICD.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Valve.hpp>
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+Opm::ICDEvaluator::ICDEvaluator(const WellSegments& segments, const UnitSystem& units)
+{
+    using M = UnitSystem::measure;
+
+    const double unit_volume_rate = units.to_si(M::geometric_volume_rate, 1.0);
+
+    for (std::size_t index = 0; index < segments.size(); ++index) {
+        const auto& segment = segments[index];
+        if (segment.isRegular()) {
+            continue;
+        }
+
+        const auto device = this->segments_.size();
+        this->segments_.push_back(segment.segmentNumber());
+
+        if (segment.isSpiralICD()) {
+            const auto& sicd = segment.spiralICD();
+            auto& s = this->spiral_;
+
+            s.device.push_back(device);
+            s.strength.push_back(sicd.strength());
+            s.density_calibration.push_back(sicd.densityCalibration());
+            s.viscosity_calibration.push_back(sicd.viscosityCalibration());
+            s.critical_value.push_back(sicd.criticalValue());
+            s.width_transition.push_back(sicd.widthTransitionRegion());
+            s.max_viscosity_ratio.push_back(sicd.maxViscosityRatio());
+            s.scaling.push_back(sicd.scalingFactor());
+        }
+        else if (segment.isAICD()) {
+            const auto& aicd = segment.autoICD();
+            auto& a = this->auto_;
+
+            a.device.push_back(device);
+            a.strength.push_back(aicd.strength());
+            a.density_calibration.push_back(aicd.densityCalibration());
+            a.viscosity_calibration.push_back(aicd.viscosityCalibration());
+            a.scaling.push_back(aicd.scalingFactor());
+            a.flow_rate_exponent.push_back(aicd.flowRateExponent());
+            a.visc_exponent.push_back(aicd.viscExponent());
+
+            a.phase_density_exponent[Water].push_back(aicd.waterDensityExponent());
+            a.phase_density_exponent[Oil].push_back(aicd.oilDensityExponent());
+            a.phase_density_exponent[Gas].push_back(aicd.gasDensityExponent());
+
+            a.phase_visc_exponent[Water].push_back(aicd.waterViscExponent());
+            a.phase_visc_exponent[Oil].push_back(aicd.oilViscExponent());
+            a.phase_visc_exponent[Gas].push_back(aicd.gasViscExponent());
+
+            a.rate_scale.push_back(std::pow(unit_volume_rate, 2.0 - aicd.flowRateExponent()));
+        }
+        else if (segment.isValve()) {
+            const auto& valve = segment.valve();
+            auto& v = this->valve_;
+
+            v.device.push_back(device);
+            v.flow_coefficient.push_back(valve.conFlowCoefficient());
+            v.con_area.push_back(valve.conCrossArea());
+            v.additional_length.push_back(valve.pipeAdditionalLength());
+            v.diameter.push_back(valve.pipeDiameter());
+            v.roughness.push_back(valve.pipeRoughness());
+            v.pipe_area.push_back(valve.pipeCrossArea());
+            v.valve.push_back(valve);
+        }
+    }
+}
+
+void Opm::ICDEvaluator::updateValveAreas(const SummaryState& summary_state,
+                                         const std::string&  well_name)
+{
+    auto& v = this->valve_;
+    for (std::size_t k = 0; k < v.device.size(); ++k) {
+        const auto segment = static_cast<std::size_t>(this->segments_[v.device[k]]);
+        v.con_area[k] = v.valve[k].conCrossArea(ValveUDAEval { summary_state, well_name, segment });
+    }
+}
+
+void Opm::ICDEvaluator::checkSize(const char*       name,
+                                  const std::size_t size,
+                                  const bool        required) const
+{
+    if (required && (size != this->size())) {
+        throw std::invalid_argument {
+            fmt::format("ICD evaluation: {} has {} elements, expected {}",
+                        name, size, this->size())
+        };
+    }
+}
@@ -0,0 +1,392 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ICD_EVALUATOR_HPP
+#define OPM_ICD_EVALUATOR_HPP
+
+#include <opm/input/eclipse/Schedule/MSW/Valve.hpp>
+
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class SummaryState;
+class UnitSystem;
+class WellSegments;
+
+/// Flow conditions at the devices of a well, one element per device in
+/// the order of ICDEvaluator::segments().
+///
+/// All quantities in SI units.  The phase arrays are indexed by
+/// ICDEvaluator::Water, Oil and Gas and are left empty for inactive
+/// phases.  The values are normally those of the upwind segment, and
+/// may be plain doubles or DenseAd::Evaluation objects.
+template <class Evaluation>
+struct ICDFlow
+{
+    /// Mass rate through the device, negative for flow towards the outlet
+    /// segment, i.e., for production.
+    std::vector<Evaluation> mass_rate{};
+
+    /// Mixture density.  Used by spiral ICDs and valves.
+    std::vector<Evaluation> density{};
+
+    /// Mixture viscosity.  Used by valves only.
+    std::vector<Evaluation> viscosity{};
+
+    /// Volume fractions of the phases.
+    std::array<std::vector<Evaluation>, 3> fraction{};
+
+    /// Densities of the phases.  Used by autonomous ICDs only.
+    std::array<std::vector<Evaluation>, 3> phase_density{};
+
+    /// Viscosities of the phases.  Used by spiral and autonomous ICDs.
+    std::array<std::vector<Evaluation>, 3> phase_viscosity{};
+};
+
+/// Pressure drop over the devices of a multisegment well.
+///
+/// The spiral ICDs (WSEGSICD), autonomous ICDs (WSEGAICD) and valves
+/// (WSEGVALV) of a well are gathered once, with the parameters of each
+/// kind of device stored as one array per parameter.  The pressure drop
+/// correlations are then evaluated for all devices of a kind in a single
+/// loop, with derivatives if the flow conditions are automatic
+/// differentiation types.
+///
+/// The correlations are those of the reference simulator manual, as
+/// implemented in the OPM Flow multisegment well model.  The status of a
+/// device is not considered, i.e., the pressure drop of a shut device is
+/// that of an open one.
+class ICDEvaluator
+{
+public:
+    enum Phase : std::size_t { Water = 0, Oil = 1, Gas = 2 };
+
+    ICDEvaluator() = default;
+
+    /// Gather the devices of \p segments.  The autonomous ICD
+    /// correlation is defined in METRIC units, \p units is the unit
+    /// system of the rates in the keywords' strength parameters.
+    ICDEvaluator(const WellSegments& segments, const UnitSystem& units);
+
+    /// Number of devices.
+    std::size_t size() const
+    {
+        return this->segments_.size();
+    }
+
+    /// Segment numbers of the devices.
+    const std::vector<int>& segments() const
+    {
+        return this->segments_;
+    }
+
+    /// Reevaluate the constriction areas of the valves, which may be
+    /// user defined quantities.
+    void updateValveAreas(const SummaryState& summary_state,
+                          const std::string&  well_name);
+
+    /// Pressure drop over each device, positive for production.  Element
+    /// i of \p dp is the pressure drop of the device in segment
+    /// segments()[i].  Throws std::invalid_argument if an array of
+    /// \p flow, other than an empty phase array, has the wrong size.
+    template <class Evaluation>
+    void pressureDrop(const ICDFlow<Evaluation>& flow,
+                      std::vector<Evaluation>&   dp) const
+    {
+        this->checkSize("mass_rate", flow.mass_rate.size(), true);
+        this->checkSize("density", flow.density.size(), !this->spiral_.device.empty() ||
+                                                        !this->valve_.device.empty());
+        this->checkSize("viscosity", flow.viscosity.size(), !this->valve_.device.empty());
+        for (const auto* phases : { &flow.fraction, &flow.phase_density, &flow.phase_viscosity }) {
+            for (const auto& values : *phases) {
+                this->checkSize("phase array", values.size(), !values.empty());
+            }
+        }
+
+        dp.assign(this->size(), Evaluation{0.0});
+
+        this->spiralPressureDrop(flow, dp);
+        this->autoPressureDrop(flow, dp);
+        this->valvePressureDrop(flow, dp);
+    }
+
+private:
+    struct SpiralDevices
+    {
+        std::vector<std::size_t> device{};
+        std::vector<double> strength{};
+        std::vector<double> density_calibration{};
+        std::vector<double> viscosity_calibration{};
+        std::vector<double> critical_value{};
+        std::vector<double> width_transition{};
+        std::vector<double> max_viscosity_ratio{};
+        std::vector<double> scaling{};
+    };
+
+    struct AutoDevices
+    {
+        std::vector<std::size_t> device{};
+        std::vector<double> strength{};
+        std::vector<double> density_calibration{};
+        std::vector<double> viscosity_calibration{};
+        std::vector<double> scaling{};
+        std::vector<double> flow_rate_exponent{};
+        std::vector<double> visc_exponent{};
+        std::array<std::vector<double>, 3> phase_density_exponent{};
+        std::array<std::vector<double>, 3> phase_visc_exponent{};
+
+        // Unit volume rate raised to 2 - flow_rate_exponent.
+        std::vector<double> rate_scale{};
+    };
+
+    struct ValveDevices
+    {
+        std::vector<std::size_t> device{};
+        std::vector<double> flow_coefficient{};
+        std::vector<double> con_area{};
+        std::vector<double> additional_length{};
+        std::vector<double> diameter{};
+        std::vector<double> roughness{};
+        std::vector<double> pipe_area{};
+        std::vector<Valve> valve{};
+    };
+
+    std::vector<int> segments_{};
+    SpiralDevices spiral_{};
+    AutoDevices auto_{};
+    ValveDevices valve_{};
+
+    void checkSize(const char* name, std::size_t size, bool required) const;
+
+    template <class Evaluation>
+    static Evaluation phaseValue(const std::vector<Evaluation>& values, const std::size_t i)
+    {
+        return values.empty() ? Evaluation{0.0} : values[i];
+    }
+
+    template <class T>
+    static T cappedRatio(const T& x, const double max_ratio)
+    {
+        using std::pow;
+
+        const T ratio = pow(1.0 / (1.0 - x), 2.5);
+        return (ratio <= max_ratio) ? ratio : T{max_ratio};
+    }
+
+    // Water-in-oil emulsion.
+    template <class T>
+    static T wioRatio(const T& water_liquid_fraction, const double max_ratio)
+    {
+        return cappedRatio<T>(0.8415 / 0.7480 * water_liquid_fraction, max_ratio);
+    }
+
+    // Oil-in-water emulsion.
+    template <class T>
+    static T oiwRatio(const T& water_liquid_fraction, const double max_ratio)
+    {
+        return cappedRatio<T>(0.6019 / 0.6410 * (1.0 - water_liquid_fraction), max_ratio);
+    }
+
+    template <class Evaluation>
+    static Evaluation emulsionViscosity(const Evaluation& water_fraction,
+                                        const Evaluation& water_viscosity,
+                                        const Evaluation& oil_fraction,
+                                        const Evaluation& oil_viscosity,
+                                        const double      critical_value,
+                                        const double      width,
+                                        const double      max_ratio)
+    {
+        const Evaluation liquid_fraction = water_fraction + oil_fraction;
+        if (liquid_fraction == 0.0) {
+            return Evaluation{0.0};
+        }
+
+        const Evaluation wlf = water_fraction / liquid_fraction;
+
+        // A non-positive width is treated as a sharp transition.
+        if (! (width > 0.0)) {
+            return (wlf < critical_value)
+                ? Evaluation{oil_viscosity * wioRatio(wlf, max_ratio)}
+                : Evaluation{water_viscosity * oiwRatio(wlf, max_ratio)};
+        }
+
+        const double start = critical_value - width / 2.0;
+        const double end = critical_value + width / 2.0;
+
+        if (wlf <= start) {
+            return oil_viscosity * wioRatio(wlf, max_ratio);
+        }
+
+        if (wlf >= end) {
+            return water_viscosity * oiwRatio(wlf, max_ratio);
+        }
+
+        const Evaluation start_viscosity = oil_viscosity * wioRatio(start, max_ratio);
+        const Evaluation end_viscosity = water_viscosity * oiwRatio(end, max_ratio);
+
+        return (start_viscosity * (end - wlf) + end_viscosity * (wlf - start)) / width;
+    }
+
+    static double haaland(const double re, const double diameter, const double roughness)
+    {
+        const double value = -3.6 * std::log10(6.9 / re + std::pow(roughness / (3.7 * diameter), 10.0 / 9.0));
+        return 1.0 / (value * value);
+    }
+
+    template <class Evaluation>
+    static Evaluation haaland(const Evaluation& re, const double diameter, const double roughness)
+    {
+        using std::log10;
+
+        const Evaluation value = -3.6 * log10(6.9 / re + std::pow(roughness / (3.7 * diameter), 10.0 / 9.0));
+        return 1.0 / (value * value);
+    }
+
+    template <class Evaluation>
+    static Evaluation frictionPressureLoss(const double      length,
+                                           const double      diameter,
+                                           const double      area,
+                                           const double      roughness,
+                                           const Evaluation& density,
+                                           const Evaluation& mass_rate,
+                                           const Evaluation& viscosity)
+    {
+        using std::abs;
+
+        const Evaluation re = abs(diameter * mass_rate / (area * viscosity));
+        if (re == 0.0) {
+            return Evaluation{0.0};
+        }
+
+        constexpr double re_laminar = 2000.0;
+        constexpr double re_turbulent = 4000.0;
+
+        Evaluation f{0.0};
+        if (re < re_laminar) {
+            f = 16.0 / re;
+        }
+        else if (re > re_turbulent) {
+            f = haaland(re, diameter, roughness);
+        }
+        else {
+            const double f1 = 16.0 / re_laminar;
+            const double f2 = haaland(re_turbulent, diameter, roughness);
+            f = f1 + (re - re_laminar) / (re_turbulent - re_laminar) * (f2 - f1);
+        }
+
+        return 2.0 * f * length * mass_rate * mass_rate / (area * area * diameter * density);
+    }
+
+    template <class Evaluation>
+    void spiralPressureDrop(const ICDFlow<Evaluation>& flow, std::vector<Evaluation>& dp) const
+    {
+        using std::pow;
+
+        const auto& s = this->spiral_;
+        for (std::size_t k = 0; k < s.device.size(); ++k) {
+            const auto i = s.device[k];
+
+            const Evaluation water_fraction = phaseValue(flow.fraction[Water], i);
+            const Evaluation oil_fraction = phaseValue(flow.fraction[Oil], i);
+            const Evaluation gas_fraction = phaseValue(flow.fraction[Gas], i);
+
+            const Evaluation emulsion_viscosity =
+                emulsionViscosity(water_fraction, phaseValue(flow.phase_viscosity[Water], i),
+                                  oil_fraction, phaseValue(flow.phase_viscosity[Oil], i),
+                                  s.critical_value[k], s.width_transition[k],
+                                  s.max_viscosity_ratio[k]);
+
+            const Evaluation mixture_viscosity = (water_fraction + oil_fraction) * emulsion_viscosity
+                + gas_fraction * phaseValue(flow.phase_viscosity[Gas], i);
+
+            const Evaluation rate = flow.mass_rate[i] / flow.density[i] * s.scaling[k];
+            const double sign = (rate <= 0.0) ? 1.0 : -1.0;
+
+            dp[i] = sign * s.strength[k] * rate * rate
+                * pow(flow.density[i] / s.density_calibration[k], 0.75)
+                * pow(mixture_viscosity / s.viscosity_calibration[k], 0.25);
+        }
+    }
+
+    template <class Evaluation>
+    void autoPressureDrop(const ICDFlow<Evaluation>& flow, std::vector<Evaluation>& dp) const
+    {
+        using std::pow;
+
+        const auto& a = this->auto_;
+        for (std::size_t k = 0; k < a.device.size(); ++k) {
+            const auto i = a.device[k];
+
+            Evaluation mixture_density{0.0};
+            Evaluation mixture_viscosity{0.0};
+            for (const std::size_t p : { Water, Oil, Gas }) {
+                const Evaluation fraction = phaseValue(flow.fraction[p], i);
+                if (! (fraction > 0.0)) {
+                    continue;
+                }
+
+                mixture_density += pow(fraction, a.phase_density_exponent[p][k]) * flow.phase_density[p][i];
+                mixture_viscosity += pow(fraction, a.phase_visc_exponent[p][k]) * flow.phase_viscosity[p][i];
+            }
+
+            const Evaluation rate = flow.mass_rate[i] * a.scaling[k] / mixture_density;
+            const double sign = (rate <= 0.0) ? 1.0 : -1.0;
+
+            dp[i] = sign / a.density_calibration[k] * mixture_density * mixture_density
+                * pow(a.viscosity_calibration[k] / mixture_viscosity, a.visc_exponent[k])
+                * a.strength[k] * pow(-sign * rate, a.flow_rate_exponent[k])
+                * a.rate_scale[k];
+        }
+    }
+
+    template <class Evaluation>
+    void valvePressureDrop(const ICDFlow<Evaluation>& flow, std::vector<Evaluation>& dp) const
+    {
+        const auto& v = this->valve_;
+        for (std::size_t k = 0; k < v.device.size(); ++k) {
+            const auto i = v.device[k];
+
+            const auto& mass_rate = flow.mass_rate[i];
+            const auto& density = flow.density[i];
+
+            const Evaluation friction =
+                frictionPressureLoss(v.additional_length[k], v.diameter[k], v.pipe_area[k],
+                                     v.roughness[k], density, mass_rate, flow.viscosity[i]);
+
+            const double area = std::max(v.con_area[k], 1.0e-10);
+            const double cv = v.flow_coefficient[k];
+            const Evaluation constriction = mass_rate * mass_rate / (2.0 * density * cv * cv * area * area);
+
+            const double sign = (mass_rate <= 0.0) ? 1.0 : -1.0;
+            dp[i] = sign * (friction + constriction);
+        }
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_ICD_EVALUATOR_HPP
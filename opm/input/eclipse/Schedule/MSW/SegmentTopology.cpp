@@ -0,0 +1,173 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/MSW/SegmentTopology.hpp>
+
+#include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
+#include <opm/input/eclipse/Schedule/Well/Connection.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+    /// Fill CSR structure from the bin of each element, keeping the
+    /// elements of a bin in increasing order.  Negative bins are ignored.
+    void buildCSR(const std::vector<int>&   bin,
+                  const std::size_t         numBins,
+                  std::vector<std::size_t>& start,
+                  std::vector<std::size_t>& elements)
+    {
+        start.assign(numBins + 1, 0);
+        for (const auto b : bin) {
+            if (b >= 0) {
+                ++start[b + 1];
+            }
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+
+        elements.resize(start.back());
+        auto pos = std::vector<std::size_t>(start.begin(), start.end() - 1);
+        for (auto i = 0*bin.size(); i < bin.size(); ++i) {
+            if (bin[i] >= 0) {
+                elements[pos[bin[i]]++] = i;
+            }
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+SegmentTopology::SegmentTopology(const std::vector<Segment>& segments)
+{
+    const auto numSeg = segments.size();
+    if (numSeg == 0) {
+        return;
+    }
+
+    const auto maxNumber = std::max_element(segments.begin(), segments.end(),
+        [](const Segment& s1, const Segment& s2)
+    {
+        return s1.segmentNumber() < s2.segmentNumber();
+    })->segmentNumber();
+
+    this->numberToIndex_.assign(std::max(maxNumber, 0) + 1, -1);
+    this->branch_.resize(numSeg);
+    for (auto segIx = 0*numSeg; segIx < numSeg; ++segIx) {
+        const auto number = segments[segIx].segmentNumber();
+        if (number >= 0) {
+            this->numberToIndex_[number] = static_cast<int>(segIx);
+        }
+
+        this->branch_[segIx] = segments[segIx].branchNumber();
+    }
+
+    this->outlet_.resize(numSeg);
+    std::transform(segments.begin(), segments.end(), this->outlet_.begin(),
+                   [this](const Segment& segment)
+                   { return this->index(segment.outletSegment()); });
+
+    buildCSR(this->outlet_, numSeg, this->inletStart_, this->inlets_);
+
+    this->numInletBranches_.assign(numSeg, 0);
+    for (auto segIx = 0*numSeg; segIx < numSeg; ++segIx) {
+        const auto branch = this->branch_[segIx];
+        for (const auto inlet : this->inlets(segIx)) {
+            this->numInletBranches_[segIx] += this->branch_[inlet] != branch;
+        }
+    }
+
+    const auto maxBranch = *std::max_element(this->branch_.begin(), this->branch_.end());
+    buildCSR(this->branch_, std::max(maxBranch, 0) + 1,
+             this->branchStart_, this->branchSegments_);
+
+    this->inflowOrder_.reserve(numSeg);
+    this->appendInflowOrder(0);
+}
+
+SegmentTopology::IndexRange SegmentTopology::branch(const int branchID) const
+{
+    if ((branchID < 0) ||
+        (static_cast<std::size_t>(branchID) + 1 >= this->branchStart_.size()))
+    {
+        return { this->branchSegments_.end(), this->branchSegments_.end() };
+    }
+
+    return { this->branchSegments_.begin() + this->branchStart_[branchID],
+             this->branchSegments_.begin() + this->branchStart_[branchID + 1] };
+}
+
+SegmentTopology::ConnectionMap
+SegmentTopology::connections(const WellConnections& connections) const
+{
+    auto segment = std::vector<int>{};
+    segment.reserve(connections.size());
+    for (const auto& conn : connections) {
+        segment.push_back(this->index(conn.segment()));
+    }
+
+    auto connMap = ConnectionMap{};
+    buildCSR(segment, this->size(), connMap.start_, connMap.conns_);
+
+    return connMap;
+}
+
+void SegmentTopology::appendInflowOrder(const std::size_t segIx)
+{
+    // Walk from segIx towards the toe of its branch.  Inflow branches are
+    // emitted, recursively, as they are encountered and the segments of
+    // the current branch, from toe to segIx, once the toe is reached.
+    const auto numSeg = this->size();
+    const auto origBranch = this->branch_[segIx];
+
+    auto currentBranch = std::vector<std::size_t> { segIx };
+    auto current = segIx;
+    while (current < numSeg) {
+        const auto previous = current;
+        for (const auto inlet : this->inlets(previous)) {
+            if (inlet == 0) {
+                // Top segment with an outlet.  Don't loop.
+                continue;
+            }
+
+            if (this->branch_[inlet] == origBranch) {
+                currentBranch.push_back(inlet);
+                current = inlet;
+            }
+            else {
+                this->appendInflowOrder(inlet);
+            }
+        }
+
+        if (current == previous) {
+            // Toe of current branch.
+            this->inflowOrder_.insert(this->inflowOrder_.end(),
+                                      currentBranch.rbegin(),
+                                      currentBranch.rend());
+            current = numSeg;
+        }
+    }
+}
+
+} // namespace Opm
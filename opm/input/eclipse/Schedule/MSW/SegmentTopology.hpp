@@ -0,0 +1,197 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SEGMENT_TOPOLOGY_HPP
+#define SEGMENT_TOPOLOGY_HPP
+
+#include <cstddef>
+#include <vector>
+
+/// \file Immutable index of the tree structure of a multi-segmented well.
+
+namespace Opm {
+    class Segment;
+    class WellConnections;
+} // namespace Opm
+
+namespace Opm {
+
+/// Tree structure of a set of well segments in terms of the storage
+/// indices of those segments.
+///
+/// All relations are computed once, when the topology is created, and
+/// stored in compressed (CSR) form such that the inlets of a segment, the
+/// segments of a branch, or the connections of a segment, are contiguous
+/// ranges of indices.  An object is never modified after construction and
+/// may be shared between copies of the WellSegments object from which it
+/// was created.
+class SegmentTopology
+{
+public:
+    /// Contiguous range of segment or connection indices.
+    class IndexRange
+    {
+    public:
+        using const_iterator = std::vector<std::size_t>::const_iterator;
+
+        IndexRange(const_iterator begin, const_iterator end)
+            : begin_{ begin }
+            , end_  { end }
+        {}
+
+        /// Start of range.
+        const_iterator begin() const { return this->begin_; }
+
+        /// End of range.
+        const_iterator end() const { return this->end_; }
+
+        /// Number of indices in range.
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(this->end_ - this->begin_);
+        }
+
+        /// Whether or not range is empty.
+        bool empty() const { return this->begin_ == this->end_; }
+
+        /// Random access into range.
+        std::size_t operator[](const std::size_t i) const
+        {
+            return *(this->begin_ + i);
+        }
+
+    private:
+        const_iterator begin_{};
+        const_iterator end_{};
+    };
+
+    /// Connection indices of each segment of a well.
+    ///
+    /// Created from a specific set of connections, through
+    /// SegmentTopology::connections(), since the connections of a well
+    /// may change without any change to its segments.
+    class ConnectionMap
+    {
+    public:
+        /// Indices, into the WellConnections object, of the connections
+        /// attached to segment segIx.  Increasing order.
+        IndexRange connections(const std::size_t segIx) const
+        {
+            return { this->conns_.begin() + this->start_[segIx],
+                     this->conns_.begin() + this->start_[segIx + 1] };
+        }
+
+        /// Number of connections attached to segments with storage index
+        /// less than segIx.
+        std::size_t connectionsBefore(const std::size_t segIx) const
+        {
+            return this->start_[segIx];
+        }
+
+        friend class SegmentTopology;
+
+    private:
+        std::vector<std::size_t> start_{0};
+        std::vector<std::size_t> conns_{};
+    };
+
+    /// Default constructor.
+    ///
+    /// Topology of empty segment set.
+    SegmentTopology() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] segments Well segments in storage order.  The outlet of
+    ///   a segment is identified through Segment::outletSegment().
+    explicit SegmentTopology(const std::vector<Segment>& segments);
+
+    /// Number of segments.
+    std::size_t size() const { return this->outlet_.size(); }
+
+    /// Storage index of segment with a particular segment number.
+    ///
+    /// \return Storage index, or -1 if no such segment exists.
+    int index(const int segmentNumber) const
+    {
+        return ((segmentNumber < 0) ||
+                (static_cast<std::size_t>(segmentNumber) >= this->numberToIndex_.size()))
+            ? -1 : this->numberToIndex_[segmentNumber];
+    }
+
+    /// Storage index of outlet segment of segment segIx.
+    ///
+    /// \return Outlet's storage index, or -1 for the top segment.
+    int outlet(const std::size_t segIx) const { return this->outlet_[segIx]; }
+
+    /// Storage indices of the segments whose outlet is segIx.  Increasing
+    /// order.
+    IndexRange inlets(const std::size_t segIx) const
+    {
+        return { this->inlets_.begin() + this->inletStart_[segIx],
+                 this->inlets_.begin() + this->inletStart_[segIx + 1] };
+    }
+
+    /// Number of inlets of segment segIx which are on a different branch
+    /// than segIx itself.
+    std::size_t numInletBranches(const std::size_t segIx) const
+    {
+        return this->numInletBranches_[segIx];
+    }
+
+    /// Storage indices of the segments on a particular branch.
+    /// Increasing order.  Empty for unknown branches.
+    IndexRange branch(const int branchID) const;
+
+    /// All segments, ordered from the toe towards the heel of each branch
+    /// with every inflow branch preceding the segment into which it flows.
+    ///
+    /// This is the segment order of the restart file's ISEG array.  The
+    /// top segment is last.
+    const std::vector<std::size_t>& inflowOrder() const
+    {
+        return this->inflowOrder_;
+    }
+
+    /// Connection indices of each segment.
+    ///
+    /// \param[in] connections Connections of the well.  Connections
+    ///   referring to unknown segments are ignored.
+    ConnectionMap connections(const WellConnections& connections) const;
+
+private:
+    std::vector<int> numberToIndex_{};
+    std::vector<int> branch_{};
+    std::vector<int> outlet_{};
+
+    std::vector<std::size_t> inletStart_{0};
+    std::vector<std::size_t> inlets_{};
+    std::vector<std::size_t> numInletBranches_{};
+
+    std::vector<std::size_t> branchStart_{0};
+    std::vector<std::size_t> branchSegments_{};
+
+    std::vector<std::size_t> inflowOrder_{};
+
+    void appendInflowOrder(std::size_t segIx);
+};
+
+} // namespace Opm
+
+#endif // SEGMENT_TOPOLOGY_HPP
@@ -34,6 +34,7 @@
 #include <cstddef>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <set>
 #include <stdexcept>
@@ -57,6 +58,8 @@ namespace Opm {
     {
         for (const auto& segment : segments)
             this->addSegment(segment);
+
+        this->buildTopology();
     }
 
 
@@ -71,6 +74,7 @@ namespace Opm {
         result.m_comp_pressure_drop = CompPressureDrop::HF_;
         result.m_segments = {Opm::Segment::serializationTestObject()};
         result.segment_number_to_index = {{1, 2}};
+        result.buildTopology();
 
         return result;
     }
@@ -568,6 +572,20 @@ namespace Opm {
             segment_number_to_index[segment_number] = current_index;
             current_index++;
         }
+
+        this->buildTopology();
+    }
+
+    void WellSegments::buildTopology()
+    {
+        this->m_topology = std::make_shared<const SegmentTopology>(this->m_segments);
+    }
+
+    const SegmentTopology& WellSegments::topology() const
+    {
+        static const SegmentTopology empty{};
+
+        return this->m_topology ? *this->m_topology : empty;
     }
 
     bool WellSegments::operator==( const WellSegments& rhs ) const {
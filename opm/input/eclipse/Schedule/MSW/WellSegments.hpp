@@ -21,10 +21,12 @@
 #define SEGMENTSET_HPP_HEADER_INCLUDED
 
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
 #include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
+#include <opm/input/eclipse/Schedule/MSW/SegmentTopology.hpp>
 
 namespace Opm {
     class SICD;
@@ -103,6 +105,10 @@ namespace Opm {
         std::vector<Segment> branchSegments(int branch) const;
         std::set<int> branches() const;
 
+        // inlets, branches and restart order of the segments in terms of
+        // their storage indices.  Shared between copies of this object.
+        const SegmentTopology& topology() const;
+
         // it returns true if there is no error encountered during the update
         bool updateWSEGSICD(const std::vector<std::pair<int, SICD> >& sicd_pairs);
 
@@ -117,6 +123,10 @@ namespace Opm {
             serializer(m_comp_pressure_drop);
             serializer(m_segments);
             serializer(segment_number_to_index);
+
+            if (!serializer.isSerializing()) {
+                this->buildTopology();
+            }
         }
 
     private:
@@ -137,6 +147,7 @@ namespace Opm {
                         const double node_x,
                         const double node_y);
         const Segment& topSegment() const;
+        void buildTopology();
 
         // components of the pressure drop to be included
         CompPressureDrop m_comp_pressure_drop{CompPressureDrop::HFA};
@@ -147,6 +158,9 @@ namespace Opm {
         // the mapping from the segment number to the
         // storage index in the vector
         std::map<int, int> segment_number_to_index{};
+
+        // derived from m_segments and not part of the object's state
+        std::shared_ptr<const SegmentTopology> m_topology{};
     };
 }
 
@@ -18,8 +18,11 @@
 */
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <fmt/format.h>
+#include <string>
+#include <unordered_set>
 #include <vector>
 #include <functional>
 
@@ -34,6 +37,7 @@ ExtNetwork ExtNetwork::serializationTestObject() {
     object.insert_indexed_node_names = {"test1", "test2"};
     object.m_nodes = {{"test3", Node::serializationTestObject()}};
     object.m_is_standard_network = false;
+    object.rebuild_graph();
     return object;
 }
 
@@ -96,6 +100,7 @@ void ExtNetwork::add_branch(Branch branch)
         }
     }
     this->m_branches.push_back( std::move(branch) );
+    this->rebuild_graph();
 }
 
 void ExtNetwork::add_or_replace_branch(Branch branch)
@@ -122,6 +127,7 @@ void ExtNetwork::add_or_replace_branch(Branch branch)
     }
 
     this->m_branches.push_back( std::move(branch) );
+    this->rebuild_graph();
 }
 
 void ExtNetwork::drop_branch(const std::string& uptree_node, const std::string& downtree_node) {
@@ -130,6 +136,7 @@ void ExtNetwork::drop_branch(const std::string& uptree_node, const std::string&
                                     [&uptree_node, &downtree_node](const Branch& b) { return (b.uptree_node() == uptree_node && b.downtree_node() == downtree_node); });
     if (branch_iter != this->m_branches.end()) {
         this->m_branches.erase(branch_iter);
+        this->rebuild_graph();
     }
 }
 
@@ -140,17 +147,15 @@ std::optional<Branch> ExtNetwork::uptree_branch(const std::string& node) const {
         throw std::out_of_range(msg);
     }
 
-    std::vector<Branch> branch;
-    std::copy_if(this->m_branches.begin(), this->m_branches.end(),
-                 std::back_inserter(branch),
-                 [&node](const Branch& b) { return b.downtree_node() == node; });
+    const auto& graph = this->graph();
+    const auto branch = graph.uptreeBranches(*graph.nodeIndex(node));
 
     if (branch.empty()) {
         return {};
     }
 
     if (branch.size() == 1) {
-        return std::move(branch[0]);
+        return this->m_branches[branch[0]];
     }
 
     throw std::logic_error("Bug - more than one uptree branch for node: " + node);
@@ -163,10 +168,14 @@ std::vector<Branch> ExtNetwork::downtree_branches(const std::string& node) const
         throw std::out_of_range(msg);
     }
 
+    const auto& graph = this->graph();
+    const auto downtree = graph.downtreeBranches(*graph.nodeIndex(node));
+
     std::vector<Branch> branch;
-    std::copy_if(this->m_branches.begin(), this->m_branches.end(),
-                 std::back_inserter(branch),
-                 [&node](const Branch& b) { return b.uptree_node() == node; });
+    branch.reserve(downtree.size());
+    std::transform(downtree.begin(), downtree.end(),
+                   std::back_inserter(branch),
+                   [this](const std::size_t b) { return this->m_branches[b]; });
     return branch;
 }
 
@@ -186,6 +195,37 @@ int ExtNetwork::NoOfNodes() const {
     return this->m_nodes.size();
 }
 
+const NetworkGraph& ExtNetwork::graph() const {
+    static const NetworkGraph empty{};
+
+    return this->m_graph ? *this->m_graph : empty;
+}
+
+void ExtNetwork::rebuild_graph()
+{
+    // Insertion indexed nodes first, followed by any nodes known only
+    // through NODEPROP or the branch definitions.
+    auto names = this->insert_indexed_node_names;
+    auto known = std::unordered_set<std::string>(names.begin(), names.end());
+    auto add_name = [&names, &known](const std::string& name)
+    {
+        if (known.insert(name).second) {
+            names.push_back(name);
+        }
+    };
+
+    for (const auto& node : this->m_nodes) {
+        add_name(node.first);
+    }
+
+    for (const auto& branch : this->m_branches) {
+        add_name(branch.uptree_node());
+        add_name(branch.downtree_node());
+    }
+
+    this->m_graph = std::make_shared<const NetworkGraph>(names, this->m_branches);
+}
+
 /*
   The validation of the network structure is very weak. The current validation
   goes as follows:
@@ -215,7 +255,11 @@ void ExtNetwork::update_node(Node node)
     }
 
 
+    const auto is_new = !this->has_node(name);
     this->m_nodes.insert_or_assign(name, std::move(node) );
+    if (is_new) {
+        this->rebuild_graph();
+    }
 }
 
 void ExtNetwork::add_indexed_node_name(std::string name)
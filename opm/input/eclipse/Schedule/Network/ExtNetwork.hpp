@@ -22,12 +22,14 @@
 #define EXT_NETWORK_HPP
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 #include <functional>
 
 #include <opm/input/eclipse/Schedule/Network/Branch.hpp>
+#include <opm/input/eclipse/Schedule/Network/NetworkGraph.hpp>
 #include <opm/input/eclipse/Schedule/Network/Node.hpp>
 
 namespace Opm {
@@ -54,6 +56,11 @@ public:
     int NoOfBranches() const;
     int NoOfNodes() const;
 
+    // Integer indexed form of the network, rebuilt whenever branches or
+    // nodes are added or removed.  The leading node indices follow
+    // node_names() and branch indices follow branches().
+    const NetworkGraph& graph() const;
+
     bool operator==(const ExtNetwork& other) const;
     static ExtNetwork serializationTestObject();
 
@@ -64,6 +71,10 @@ public:
         serializer(insert_indexed_node_names);
         serializer(m_nodes);
         serializer(m_is_standard_network);
+
+        if (!serializer.isSerializing()) {
+            this->rebuild_graph();
+        }
     }
 
 private:
@@ -71,8 +82,10 @@ private:
     std::vector<std::string> insert_indexed_node_names;
     std::map<std::string, Node> m_nodes;
     bool m_is_standard_network{false};
+    std::shared_ptr<const NetworkGraph> m_graph{};
     bool has_indexed_node_name(const std::string& name) const;
     void add_indexed_node_name(std::string name);
+    void rebuild_graph();
 };
 
 }
@@ -0,0 +1,136 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Network/NetworkGraph.hpp>
+
+#include <opm/input/eclipse/Schedule/Network/Branch.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    /// Fill CSR structure from the node of each branch, keeping the
+    /// branches of a node in increasing order.
+    void buildCSR(const std::vector<std::size_t>& node,
+                  const std::size_t               numNodes,
+                  std::vector<std::size_t>&       start,
+                  std::vector<std::size_t>&       branches)
+    {
+        start.assign(numNodes + 1, 0);
+        for (const auto n : node) {
+            ++start[n + 1];
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+
+        branches.resize(start.back());
+        auto pos = std::vector<std::size_t>(start.begin(), start.end() - 1);
+        for (auto b = 0*node.size(); b < node.size(); ++b) {
+            branches[pos[node[b]]++] = b;
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace Network {
+
+NetworkGraph::NetworkGraph(const std::vector<std::string>& nodeNames,
+                           const std::vector<Branch>&      branches)
+    : nodeNames_ { nodeNames }
+{
+    const auto numNodes = this->nodeNames_.size();
+
+    this->nodeIndex_.reserve(numNodes);
+    for (auto node = 0*numNodes; node < numNodes; ++node) {
+        this->nodeIndex_.emplace(this->nodeNames_[node], node);
+    }
+
+    auto index = [this](const std::string& name)
+    {
+        const auto pos = this->nodeIndex_.find(name);
+        if (pos == this->nodeIndex_.end()) {
+            throw std::invalid_argument {
+                fmt::format("Network branch refers to undefined node: {}", name)
+            };
+        }
+
+        return pos->second;
+    };
+
+    this->uptreeNode_.reserve(branches.size());
+    this->downtreeNode_.reserve(branches.size());
+    this->vfpTable_.reserve(branches.size());
+    for (const auto& branch : branches) {
+        this->uptreeNode_.push_back(index(branch.uptree_node()));
+        this->downtreeNode_.push_back(index(branch.downtree_node()));
+        this->vfpTable_.push_back(branch.vfp_table().value_or(-1));
+    }
+
+    buildCSR(this->downtreeNode_, numNodes, this->uptreeStart_, this->uptreeBranches_);
+    buildCSR(this->uptreeNode_, numNodes, this->downtreeStart_, this->downtreeBranches_);
+
+    // Leaves first.  A node is emitted once all of its downtree
+    // neighbours have been emitted.
+    auto pending = std::vector<std::size_t>(numNodes);
+    for (auto node = 0*numNodes; node < numNodes; ++node) {
+        pending[node] = this->downtreeBranches(node).size();
+        if (pending[node] == 0) {
+            this->topologicalOrder_.push_back(node);
+        }
+    }
+
+    for (auto i = 0*numNodes; i < this->topologicalOrder_.size(); ++i) {
+        for (const auto branch : this->uptreeBranches(this->topologicalOrder_[i])) {
+            const auto uptree = this->uptreeNode_[branch];
+            if (--pending[uptree] == 0) {
+                this->topologicalOrder_.push_back(uptree);
+            }
+        }
+    }
+}
+
+std::optional<std::size_t> NetworkGraph::nodeIndex(std::string_view name) const
+{
+    const auto pos = this->nodeIndex_.find(std::string { name });
+    if (pos == this->nodeIndex_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+std::optional<int> NetworkGraph::vfpTable(const std::size_t branch) const
+{
+    const auto table = this->vfpTable_[branch];
+    if (table < 0) {
+        return std::nullopt;
+    }
+
+    return table;
+}
+
+}} // namespace Opm::Network
@@ -0,0 +1,164 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NETWORK_GRAPH_HPP
+#define NETWORK_GRAPH_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm { namespace Network {
+    class Branch;
+}} // namespace Opm::Network
+
+namespace Opm { namespace Network {
+
+/// Integer indexed form of an extended network.
+///
+/// Nodes are identified by their position in the list of node names and
+/// branches by their position in the network's list of branches.  The
+/// branches going into and out of each node are stored in compressed
+/// (CSR) form.  An object is never modified after construction and may be
+/// shared between copies of the ExtNetwork from which it was created.
+class NetworkGraph
+{
+public:
+    /// Contiguous range of branch indices.
+    class IndexRange
+    {
+    public:
+        using const_iterator = std::vector<std::size_t>::const_iterator;
+
+        IndexRange(const_iterator begin, const_iterator end)
+            : begin_{ begin }
+            , end_  { end }
+        {}
+
+        const_iterator begin() const { return this->begin_; }
+        const_iterator end() const { return this->end_; }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(this->end_ - this->begin_);
+        }
+
+        bool empty() const { return this->begin_ == this->end_; }
+
+        std::size_t operator[](const std::size_t i) const
+        {
+            return *(this->begin_ + i);
+        }
+
+    private:
+        const_iterator begin_{};
+        const_iterator end_{};
+    };
+
+    /// Default constructor.
+    ///
+    /// Empty network.
+    NetworkGraph() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] nodeNames Names of all nodes of the network.  Defines
+    ///   the node indices.
+    ///
+    /// \param[in] branches All branches of the network.  Defines the
+    ///   branch indices.  Throws std::invalid_argument if a branch
+    ///   refers to an unknown node.
+    NetworkGraph(const std::vector<std::string>& nodeNames,
+                 const std::vector<Branch>&      branches);
+
+    std::size_t numNodes() const { return this->nodeNames_.size(); }
+    std::size_t numBranches() const { return this->uptreeNode_.size(); }
+
+    const std::string& nodeName(const std::size_t node) const
+    {
+        return this->nodeNames_[node];
+    }
+
+    /// Index of named node.
+    ///
+    /// \return Node index, or nullopt if no such node exists.
+    std::optional<std::size_t> nodeIndex(std::string_view name) const;
+
+    /// Node index of the uptree end of a branch.
+    std::size_t uptreeNode(const std::size_t branch) const
+    {
+        return this->uptreeNode_[branch];
+    }
+
+    /// Node index of the downtree end of a branch.
+    std::size_t downtreeNode(const std::size_t branch) const
+    {
+        return this->downtreeNode_[branch];
+    }
+
+    /// VFP table of a branch, or nullopt if the branch has no pressure
+    /// loss.
+    std::optional<int> vfpTable(const std::size_t branch) const;
+
+    /// Branches from a node towards the root of the network.  At most one
+    /// in a valid (gathering) network.
+    IndexRange uptreeBranches(const std::size_t node) const
+    {
+        return { this->uptreeBranches_.begin() + this->uptreeStart_[node],
+                 this->uptreeBranches_.begin() + this->uptreeStart_[node + 1] };
+    }
+
+    /// Branches into a node from the leaves of the network.  Increasing
+    /// order.
+    IndexRange downtreeBranches(const std::size_t node) const
+    {
+        return { this->downtreeBranches_.begin() + this->downtreeStart_[node],
+                 this->downtreeBranches_.begin() + this->downtreeStart_[node + 1] };
+    }
+
+    /// Node indices ordered such that every node precedes the uptree ends
+    /// of its uptree branches, i.e., from the leaves towards the roots.
+    /// Nodes on cycles, and nodes uptree of those, are not included.
+    const std::vector<std::size_t>& topologicalOrder() const
+    {
+        return this->topologicalOrder_;
+    }
+
+private:
+    std::vector<std::string> nodeNames_{};
+    std::unordered_map<std::string, std::size_t> nodeIndex_{};
+
+    std::vector<std::size_t> uptreeNode_{};
+    std::vector<std::size_t> downtreeNode_{};
+    std::vector<int> vfpTable_{};
+
+    std::vector<std::size_t> uptreeStart_{0};
+    std::vector<std::size_t> uptreeBranches_{};
+    std::vector<std::size_t> downtreeStart_{0};
+    std::vector<std::size_t> downtreeBranches_{};
+
+    std::vector<std::size_t> topologicalOrder_{};
+};
+
+}} // namespace Opm::Network
+
+#endif // NETWORK_GRAPH_HPP
@@ -0,0 +1,401 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/ResCoup/SharedMemoryExchange.hpp>
+
+#include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+namespace {
+
+    constexpr std::uint64_t ringMagic = 0x4f504d52494e4731ULL; // "OPMRING1"
+    constexpr std::size_t cacheLine = 64;
+
+    std::size_t roundUpPow2(std::size_t n)
+    {
+        std::size_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    std::size_t alignUp(const std::size_t n)
+    {
+        return (n + cacheLine - 1) / cacheLine * cacheLine;
+    }
+
+} // Anonymous namespace
+
+namespace Opm::ReservoirCoupling {
+
+// ---------------------------------------------------------------------------
+// GroupRecordRing
+// ---------------------------------------------------------------------------
+
+struct GroupRecordRing::Header
+{
+    std::uint64_t magic{ringMagic};
+    std::uint64_t record_size{sizeof(GroupRecord)};
+    std::uint64_t capacity{0};
+
+    // Written by the writer only.
+    alignas(cacheLine) std::atomic<std::uint64_t> head{0};
+
+    // Written by the reader only.
+    alignas(cacheLine) std::atomic<std::uint64_t> tail{0};
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Shared memory rings require lock-free 64 bit atomics");
+
+std::size_t GroupRecordRing::ringBytes(const std::size_t capacity)
+{
+    return alignUp(sizeof(Header)) + roundUpPow2(capacity) * sizeof(GroupRecord);
+}
+
+GroupRecordRing GroupRecordRing::create(void* memory, const std::size_t capacity)
+{
+    if (capacity == 0) {
+        throw std::invalid_argument {
+            "Reservoir coupling record ring must have a positive capacity"
+        };
+    }
+
+    auto* header = new (memory) Header{};
+    header->capacity = roundUpPow2(capacity);
+
+    return GroupRecordRing { header };
+}
+
+GroupRecordRing GroupRecordRing::attach(void* memory)
+{
+    auto* header = static_cast<Header*>(memory);
+    if ((header->magic != ringMagic) ||
+        (header->record_size != sizeof(GroupRecord)))
+    {
+        throw std::runtime_error {
+            "Shared memory does not hold a compatible reservoir coupling record ring"
+        };
+    }
+
+    return GroupRecordRing { header };
+}
+
+GroupRecordRing::GroupRecordRing(Header* header)
+    : header_  { header }
+    , records_ { reinterpret_cast<GroupRecord*>
+                 (reinterpret_cast<char*>(header) + alignUp(sizeof(Header))) }
+{}
+
+std::size_t GroupRecordRing::capacity() const
+{
+    return this->header_->capacity;
+}
+
+std::size_t GroupRecordRing::size() const
+{
+    const auto tail = this->header_->tail.load(std::memory_order_acquire);
+    const auto head = this->header_->head.load(std::memory_order_acquire);
+
+    return head - tail;
+}
+
+bool GroupRecordRing::push(const GroupRecord& record)
+{
+    auto& hdr = *this->header_;
+
+    const auto head = hdr.head.load(std::memory_order_relaxed);
+    if (head - hdr.tail.load(std::memory_order_acquire) == hdr.capacity) {
+        return false;
+    }
+
+    this->records_[head & (hdr.capacity - 1)] = record;
+    hdr.head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+std::optional<GroupRecord> GroupRecordRing::pop()
+{
+    auto& hdr = *this->header_;
+
+    const auto tail = hdr.tail.load(std::memory_order_relaxed);
+    if (tail == hdr.head.load(std::memory_order_acquire)) {
+        return std::nullopt;
+    }
+
+    const auto record = this->records_[tail & (hdr.capacity - 1)];
+    hdr.tail.store(tail + 1, std::memory_order_release);
+
+    return record;
+}
+
+// ---------------------------------------------------------------------------
+// GroupIndexMap
+// ---------------------------------------------------------------------------
+
+GroupIndexMap GroupIndexMap::fromMaster(const CouplingInfo& info,
+                                        const std::string& slave_name)
+{
+    GroupIndexMap map;
+    for (const auto& [name, group] : info.masterGroups()) {
+        if (group.slaveName() == slave_name) {
+            map.add(name, name);
+        }
+    }
+
+    map.finalize();
+    return map;
+}
+
+GroupIndexMap GroupIndexMap::fromSlave(const CouplingInfo& info)
+{
+    GroupIndexMap map;
+    for (const auto& [name, group] : info.grupSlavs()) {
+        map.add(group.masterGroupName(), name);
+    }
+
+    map.finalize();
+    return map;
+}
+
+std::int32_t GroupIndexMap::index(const std::string& name) const
+{
+    auto pos = this->index_.find(name);
+    if (pos == this->index_.end()) {
+        throw std::out_of_range {
+            fmt::format("Group {} is not part of the reservoir coupling", name)
+        };
+    }
+
+    return pos->second;
+}
+
+const std::string& GroupIndexMap::name(const std::int32_t index) const
+{
+    if ((index < 0) || (static_cast<std::size_t>(index) >= this->names_.size())) {
+        throw std::out_of_range {
+            fmt::format("Reservoir coupling group index {} out of range", index)
+        };
+    }
+
+    return this->names_[index];
+}
+
+void GroupIndexMap::add(const std::string& master_group, const std::string& local_name)
+{
+    const auto [pos, inserted] = this->master_to_local_.emplace(master_group, local_name);
+    if (!inserted && (pos->second != local_name)) {
+        throw std::invalid_argument {
+            fmt::format("Master group {} is coupled to both {} and {}",
+                        master_group, pos->second, local_name)
+        };
+    }
+}
+
+void GroupIndexMap::finalize()
+{
+    // std::map iterates in sorted order of the master group names, which
+    // is what makes the numbering agree between master and slave.
+    for (const auto& [master_group, local_name] : this->master_to_local_) {
+        const auto index = static_cast<std::int32_t>(this->names_.size());
+        this->names_.push_back(local_name);
+        this->index_.emplace(local_name, index);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// SharedMemoryChannel
+// ---------------------------------------------------------------------------
+
+SharedMemoryChannel
+SharedMemoryChannel::create(const std::string& slave_name, const std::size_t capacity)
+{
+    const auto name = segmentName(slave_name);
+    const auto ringSize = alignUp(GroupRecordRing::ringBytes(capacity));
+    const auto size = 2 * ringSize;
+
+    // Remove a segment left behind by a previous run which did not exit
+    // cleanly.
+    ::shm_unlink(name.c_str());
+
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error {
+            fmt::format("Unable to create shared memory segment '{}': {}",
+                        name, std::strerror(errno))
+        };
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        const auto err = errno;
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+
+        throw std::runtime_error {
+            fmt::format("Unable to size shared memory segment '{}': {}",
+                        name, std::strerror(err))
+        };
+    }
+
+    void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const auto err = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+
+        throw std::runtime_error {
+            fmt::format("Unable to map shared memory segment '{}': {}",
+                        name, std::strerror(err))
+        };
+    }
+
+    auto* base = static_cast<char*>(addr);
+    auto s2m = GroupRecordRing::create(base, capacity);
+    auto m2s = GroupRecordRing::create(base + ringSize, capacity);
+
+    return { name, addr, size, /* owner = */ true, s2m, m2s };
+}
+
+SharedMemoryChannel SharedMemoryChannel::open(const std::string& slave_name)
+{
+    const auto name = segmentName(slave_name);
+
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error {
+            fmt::format("Unable to open shared memory segment '{}': {}",
+                        name, std::strerror(errno))
+        };
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        const auto err = errno;
+        ::close(fd);
+
+        throw std::runtime_error {
+            fmt::format("Unable to determine size of shared memory segment '{}': {}",
+                        name, std::strerror(err))
+        };
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const auto err = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        throw std::runtime_error {
+            fmt::format("Unable to map shared memory segment '{}': {}",
+                        name, std::strerror(err))
+        };
+    }
+
+    auto* base = static_cast<char*>(addr);
+    auto s2m = GroupRecordRing::attach(base);
+    const auto ringSize = alignUp(GroupRecordRing::ringBytes(s2m.capacity()));
+    if (size != 2 * ringSize) {
+        ::munmap(addr, size);
+
+        throw std::runtime_error {
+            fmt::format("Shared memory segment '{}' has unexpected size {}",
+                        name, size)
+        };
+    }
+
+    auto m2s = GroupRecordRing::attach(base + ringSize);
+
+    return { name, addr, size, /* owner = */ false, s2m, m2s };
+}
+
+std::string SharedMemoryChannel::segmentName(const std::string& slave_name)
+{
+    return fmt::format("/opm-rescoup-{}-{}", ::getuid(), slave_name);
+}
+
+SharedMemoryChannel::SharedMemoryChannel(std::string name, void* address,
+                                         const std::size_t size, const bool owner,
+                                         GroupRecordRing slave_to_master,
+                                         GroupRecordRing master_to_slave)
+    : name_            { std::move(name) }
+    , address_         { address }
+    , size_            { size }
+    , owner_           { owner }
+    , slave_to_master_ { slave_to_master }
+    , master_to_slave_ { master_to_slave }
+{}
+
+SharedMemoryChannel::SharedMemoryChannel(SharedMemoryChannel&& other) noexcept
+    : name_            { std::move(other.name_) }
+    , address_         { std::exchange(other.address_, nullptr) }
+    , size_            { std::exchange(other.size_, 0) }
+    , owner_           { std::exchange(other.owner_, false) }
+    , slave_to_master_ { other.slave_to_master_ }
+    , master_to_slave_ { other.master_to_slave_ }
+{}
+
+SharedMemoryChannel& SharedMemoryChannel::operator=(SharedMemoryChannel&& other) noexcept
+{
+    if (this != &other) {
+        this->release();
+
+        this->name_ = std::move(other.name_);
+        this->address_ = std::exchange(other.address_, nullptr);
+        this->size_ = std::exchange(other.size_, 0);
+        this->owner_ = std::exchange(other.owner_, false);
+        this->slave_to_master_ = other.slave_to_master_;
+        this->master_to_slave_ = other.master_to_slave_;
+    }
+
+    return *this;
+}
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+    this->release();
+}
+
+void SharedMemoryChannel::release()
+{
+    if (this->address_ != nullptr) {
+        ::munmap(this->address_, this->size_);
+        this->address_ = nullptr;
+    }
+
+    if (this->owner_) {
+        ::shm_unlink(this->name_.c_str());
+        this->owner_ = false;
+    }
+}
+
+} // namespace Opm::ReservoirCoupling
@@ -0,0 +1,213 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef RESERVOIR_COUPLING_SHARED_MEMORY_EXCHANGE_HPP
+#define RESERVOIR_COUPLING_SHARED_MEMORY_EXCHANGE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm::ReservoirCoupling {
+
+class CouplingInfo;
+
+/// Fixed-layout record exchanged between a master and a slave run.
+///
+/// The record only holds trivially copyable members so that it can be
+/// placed in memory shared between processes.  Groups are identified by
+/// their position in the GroupIndexMap of the slave.
+struct GroupRecord
+{
+    enum class Kind : std::int32_t {
+        /// Production potentials of a slave group (oil, gas, water, reservoir)
+        Potentials,
+        /// Production target of a master group (oil, gas, water, reservoir)
+        ProductionTarget,
+        /// Injection target of a master group (oil, gas, water, reservoir)
+        InjectionTarget,
+    };
+
+    /// Elapsed simulation time in seconds the values refer to
+    double time{0.0};
+
+    std::int32_t group_index{-1};
+    Kind kind{Kind::Potentials};
+
+    std::array<double, 4> values{};
+};
+
+static_assert(std::is_trivially_copyable_v<GroupRecord>);
+static_assert(std::is_standard_layout_v<GroupRecord>);
+
+/// Lock-free ring buffer of GroupRecords for one writer and one reader.
+///
+/// The ring does not own its memory.  It is constructed in a region of
+/// ringBytes() bytes, typically inside a shared memory segment, by the
+/// process which creates the segment and attached to by the other one.
+/// Writer and reader may live in different processes.  The head and tail
+/// counters are kept on separate cache lines so that the two sides do not
+/// invalidate each other's cache line on every operation.
+class GroupRecordRing
+{
+public:
+    /// Number of bytes needed for a ring of the given capacity.  The
+    /// capacity is rounded up to the next power of two.
+    static std::size_t ringBytes(std::size_t capacity);
+
+    /// Initialise a new ring in the memory at 'memory' which must be at
+    /// least ringBytes(capacity) bytes and aligned to 64 bytes.
+    static GroupRecordRing create(void* memory, std::size_t capacity);
+
+    /// Attach to a ring previously initialised by create().  Throws
+    /// std::runtime_error if the memory does not hold a compatible ring.
+    static GroupRecordRing attach(void* memory);
+
+    /// Number of records the ring can hold.
+    std::size_t capacity() const;
+
+    /// Number of records currently in the ring.
+    std::size_t size() const;
+
+    bool empty() const { return this->size() == 0; }
+
+    /// Append a record.  Must only be called by the writer.  Returns false
+    /// without writing if the ring is full.
+    bool push(const GroupRecord& record);
+
+    /// Remove the oldest record.  Must only be called by the reader.
+    std::optional<GroupRecord> pop();
+
+    /// Remove all available records and hand them to 'func' in order.
+    /// Must only be called by the reader.  Returns the number of records.
+    template <class Function>
+    std::size_t drain(Function&& func)
+    {
+        std::size_t count = 0;
+        while (auto record = this->pop()) {
+            func(*record);
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    struct Header;
+
+    explicit GroupRecordRing(Header* header);
+
+    Header* header_{nullptr};
+    GroupRecord* records_{nullptr};
+};
+
+/// Positions of the master groups of one slave in the exchanged records.
+///
+/// The master group names which map to a slave are sorted alphabetically
+/// and numbered.  The master side finds the index of a master group by its
+/// name (GRUPMAST), and the slave side by the master group name given for
+/// its slave group (GRUPSLAV), so both sides use the same numbering without
+/// any communication.
+class GroupIndexMap
+{
+public:
+    /// Index of the master groups coupled to slave 'slave_name', built from
+    /// the GRUPMAST records of the master run.
+    static GroupIndexMap fromMaster(const CouplingInfo& info,
+                                    const std::string& slave_name);
+
+    /// Index of the slave groups of a slave run, built from its GRUPSLAV
+    /// records.
+    static GroupIndexMap fromSlave(const CouplingInfo& info);
+
+    std::size_t size() const { return this->names_.size(); }
+
+    /// Index of group 'name'.  Throws std::out_of_range if the group is
+    /// not coupled.
+    std::int32_t index(const std::string& name) const;
+
+    /// Name of the group at index 'index' of the records.
+    const std::string& name(std::int32_t index) const;
+
+private:
+    void add(const std::string& master_group, const std::string& local_name);
+    void finalize();
+
+    // master group name -> local group name
+    std::map<std::string, std::string> master_to_local_{};
+    std::vector<std::string> names_{};
+    std::map<std::string, std::int32_t> index_{};
+};
+
+/// Shared memory segment with one ring in each direction between a master
+/// run and one of its slaves on the same node.
+///
+/// The master creates the channel, which unlinks the segment on
+/// destruction; the slave opens it by the same slave name.  The segment
+/// is a POSIX shared memory object, so this is only available where
+/// shm_open() exists.
+class SharedMemoryChannel
+{
+public:
+    /// Create the segment for slave 'slave_name' with rings of 'capacity'
+    /// records each.  An existing stale segment of the same name is
+    /// replaced.
+    static SharedMemoryChannel create(const std::string& slave_name,
+                                      std::size_t capacity);
+
+    /// Open the segment created by the master for slave 'slave_name'.
+    static SharedMemoryChannel open(const std::string& slave_name);
+
+    /// Name of the shared memory object of a slave.
+    static std::string segmentName(const std::string& slave_name);
+
+    SharedMemoryChannel(SharedMemoryChannel&& other) noexcept;
+    SharedMemoryChannel& operator=(SharedMemoryChannel&& other) noexcept;
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+    ~SharedMemoryChannel();
+
+    /// Potentials sent from the slave to the master.
+    GroupRecordRing& slaveToMaster() { return this->slave_to_master_; }
+
+    /// Targets sent from the master to the slave.
+    GroupRecordRing& masterToSlave() { return this->master_to_slave_; }
+
+private:
+    SharedMemoryChannel(std::string name, void* address,
+                        std::size_t size, bool owner,
+                        GroupRecordRing slave_to_master,
+                        GroupRecordRing master_to_slave);
+
+    void release();
+
+    std::string name_{};
+    void* address_{nullptr};
+    std::size_t size_{0};
+    bool owner_{false};
+    GroupRecordRing slave_to_master_;
+    GroupRecordRing master_to_slave_;
+};
+
+} // namespace Opm::ReservoirCoupling
+
+#endif // RESERVOIR_COUPLING_SHARED_MEMORY_EXCHANGE_HPP
@@ -34,6 +34,7 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
@@ -41,10 +42,13 @@
 #include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
 #include <opm/input/eclipse/Schedule/Group/GTNode.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
+#include <opm/input/eclipse/Schedule/GasLiftPlan.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/MSW/SICD.hpp>
 #include <opm/input/eclipse/Schedule/MSW/Valve.hpp>
@@ -59,29 +63,39 @@
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Tuning.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/Connection.hpp>
+#include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
 #include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPDP.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPEXP.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellBrineProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellEconProductionLimits.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellEnums.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellFoamProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMICPProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellPolymerProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTracerProperties.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <opm/input/eclipse/Utility/InputProfile.hpp>
+
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/B.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/C.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/E.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/V.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/W.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -97,6 +111,7 @@
 #include "Well/injection.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <ctime>
 #include <functional>
 #include <initializer_list>
@@ -140,10 +155,14 @@ namespace Opm {
     try :
         m_static(python, ScheduleRestartInfo(rst, deck), deck, runspec,
                  output_interval, parseContext, errors, slave_mode)
-        , m_sched_deck(TimeService::from_time_t(runspec.start_time()), deck, m_static.rst_info)
+        , m_sched_deck(TimeService::from_time_t(runspec.start_time()),
+                       std::make_shared<ScheduleKeywordStream>(deck),
+                       m_static.rst_info)
         , completed_cells(ecl_grid.getNX(), ecl_grid.getNY(), ecl_grid.getNZ())
         , m_lowActionParsingStrictness(lowActionParsingStrictness)
     {
+        InputProfile::Phase profile { "Schedule" };
+
         this->restart_output.resize(this->m_sched_deck.size());
         this->restart_output.clearRemainingEvents(0);
         this->simUpdateFromPython = std::make_shared<SimulatorUpdate>();
@@ -183,6 +202,8 @@ namespace Opm {
             this->iterateScheduleSection(0, this->m_sched_deck.size(),
                                          parseContext, errors, grid, nullptr, "", keepKeywords);
         }
+
+        this->m_sched_deck.finish_loading();
     }
     catch (const OpmInputError& opm_error) {
         OpmLog::error(opm_error.what());
@@ -400,6 +421,7 @@ namespace Opm {
                                  WelSegsSet* welsegs_wells,
                                  std::set<std::string>* compsegs_wells)
     {
+        InputProfile::Scope profile { "Schedule", keyword.name() };
         HandlerContext handlerContext { *this, block, keyword, grid, currentStep,
                                         matches, actionx_mode,
                                         parseContext, errors, sim_update, target_wellpi,
@@ -567,6 +589,53 @@ void check_compsegs_consistency(const Opm::WelSegsSet& welsegs,
         throw Opm::OpmInputError(msg, std::get<1>(difference[0]));
     }
 }
+
+/// \brief Number of report steps prepared ahead of the keyword handlers.
+constexpr std::size_t schedule_prepare_window = 32;
+
+/// \brief Load and prepare the keywords of report steps [first, last).
+///
+/// Converting the keywords of a report step to SI units does not depend on
+/// any other report step, so the blocks are converted concurrently.  The
+/// VFP tables of the window do not depend on the schedule state either and
+/// are built concurrently afterwards.  The keyword handlers update the
+/// ScheduleState of the previous report step and must still run in order.
+void prepare_schedule_blocks(Opm::ScheduleDeck& sched_deck,
+                             const std::size_t first,
+                             const std::size_t last,
+                             Opm::VFPTableCache& vfp_tables,
+                             const Opm::ScheduleStatic& static_schedule)
+{
+    for (auto report_step = first; report_step < last; ++report_step) {
+        sched_deck.load_keywords(report_step);
+    }
+
+    const auto num_blocks = static_cast<std::ptrdiff_t>(last - first);
+
+#pragma omp parallel for schedule(dynamic) if(num_blocks > 1)
+    for (std::ptrdiff_t block = 0; block < num_blocks; ++block) {
+        sched_deck[first + block].convertToSI();
+    }
+
+    // Keywords within ACTIONX blocks are only handled when the action
+    // runs.
+    std::vector<const Opm::DeckKeyword*> vfp_keywords;
+    for (auto report_step = first; report_step < last; ++report_step) {
+        bool in_action = false;
+        for (const auto& keyword : sched_deck[report_step]) {
+            if (keyword.is<Opm::ParserKeywords::ACTIONX>())
+                in_action = true;
+            else if (keyword.is<Opm::ParserKeywords::ENDACTIO>())
+                in_action = false;
+            else if (!in_action && (keyword.is<Opm::ParserKeywords::VFPPROD>() ||
+                                    keyword.is<Opm::ParserKeywords::VFPINJ>()))
+                vfp_keywords.push_back(&keyword);
+        }
+    }
+
+    vfp_tables.prepare(vfp_keywords, static_schedule.gaslift_opt_active,
+                       static_schedule.m_unit_system);
+}
 }// end anonymous namespace
 
 namespace Opm
@@ -633,8 +702,14 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
         const auto matches = Action::Result { false }.matches();
 
+        auto prepared_end = load_start;
         for (auto report_step = load_start; report_step < load_end; report_step++) {
             std::size_t keyword_index = 0;
+            if (report_step == prepared_end) {
+                prepared_end = std::min(report_step + schedule_prepare_window, load_end);
+                prepare_schedule_blocks(this->m_sched_deck, report_step, prepared_end,
+                                        this->m_vfp_tables, this->m_static);
+            }
             auto& block = this->m_sched_deck[report_step];
             auto time_type = block.time_type();
             if (time_type == ScheduleTimeType::DATES || time_type == ScheduleTimeType::TSTEP) {
@@ -1125,6 +1200,22 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         return this->snapshots[timeStep].wells.has(wellName);
     }
 
+    bool Schedule::hasWell(std::size_t well_index, std::size_t timeStep) const {
+        return this->snapshots[timeStep].wells.find_index(well_index) != nullptr;
+    }
+
+    std::optional<std::size_t> Schedule::wellIndex(const std::string& wellName) const {
+        return this->snapshots.back().well_order().index(wellName);
+    }
+
+    std::optional<std::size_t> Schedule::groupIndex(const std::string& groupName) const {
+        const auto group_ptr = this->snapshots.back().groups.get_ptr(groupName);
+        if (group_ptr == nullptr)
+            return std::nullopt;
+
+        return group_ptr->insert_index();
+    }
+
     bool Schedule::hasGroup(const std::string& groupName, std::size_t timeStep) const {
         return this->snapshots[timeStep].groups.has(groupName);
     }
@@ -1147,24 +1238,24 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     std::vector< Well > Schedule::getChildWells2(const std::string& group_name, std::size_t timeStep) const {
+        const auto well_ptrs = this->getChildWellPtrs(group_name, timeStep);
+
+        std::vector<Well> wells;
+        wells.reserve(well_ptrs.size());
+        for (const auto* well : well_ptrs)
+            wells.push_back(*well);
+
+        return wells;
+    }
+
+    std::vector<const Well*> Schedule::getChildWellPtrs(const std::string& group_name, std::size_t timeStep) const {
         const auto& sched_state = this->snapshots[timeStep];
         const auto& group = sched_state.groups.get(group_name);
 
-        std::vector<Well> wells;
+        std::vector<const Well*> wells;
+        for (const auto& well_name : sched_state.group_hierarchy().childWells(group.insert_index()))
+            wells.push_back(std::addressof(sched_state.wells.get(well_name)));
 
-        if (group.groups().size()) {
-            for (const auto& child_name : group.groups()) {
-                const auto& child_wells = this->getChildWells2(child_name, timeStep);
-                wells.insert(wells.end(), child_wells.begin(), child_wells.end());
-            }
-        } else {
-            std::transform(group.wells().begin(), group.wells().end(),
-                           std::back_inserter(wells),
-                           [this, timeStep](const auto& well_name) -> decltype(auto)
-                           {
-                               return this->getWell(well_name, timeStep);
-                           });
-        }
         return wells;
     }
 
@@ -1202,7 +1293,19 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
     std::vector<Well> Schedule::getWells(std::size_t timeStep) const
     {
+        const auto well_ptrs = this->getWellPtrs(timeStep);
+
         auto wells = std::vector<Well>{};
+        wells.reserve(well_ptrs.size());
+        for (const auto* well : well_ptrs)
+            wells.push_back(*well);
+
+        return wells;
+    }
+
+    std::vector<const Well*> Schedule::getWellPtrs(std::size_t timeStep) const
+    {
+        auto wells = std::vector<const Well*>{};
 
         if (timeStep >= this->snapshots.size()) {
             throw std::invalid_argument {
@@ -1213,11 +1316,12 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         }
 
         const auto& well_order = this->snapshots[timeStep].well_order();
+        wells.reserve(well_order.size());
         std::transform(well_order.begin(), well_order.end(),
                        std::back_inserter(wells),
                        [&wells = this->snapshots[timeStep].wells]
-                       (const auto& wname) -> decltype(auto)
-                       { return wells.get(wname); });
+                       (const auto& wname)
+                       { return std::addressof(wells.get(wname)); });
 
         return wells;
     }
@@ -1226,15 +1330,27 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         return this->getWells(this->snapshots.size() - 1);
     }
 
+    std::vector<const Well*> Schedule::getWellPtrsAtEnd() const {
+        return this->getWellPtrs(this->snapshots.size() - 1);
+    }
+
     std::vector<Well> Schedule::getActiveWellsAtEnd() const {
         std::vector<Well> wells;
+        for (const auto* well : this->getActiveWellPtrsAtEnd())
+            wells.push_back(*well);
+
+        return wells;
+    }
+
+    std::vector<const Well*> Schedule::getActiveWellPtrsAtEnd() const {
+        std::vector<const Well*> wells;
         const auto lastStep = this->snapshots.size() - 1;
         const auto& well_order = this->snapshots[lastStep].well_order();
 
         for (const auto& wname : well_order) {
             const auto& well = this->snapshots[lastStep].wells.get(wname);
             if (well.hasProduced() || well.hasInjected() || name_match_any(this->potential_wellopen_patterns, wname))
-                wells.push_back(well);
+                wells.push_back(&well);
         }
 
         return wells;
@@ -1280,12 +1396,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     const Well& Schedule::getWell(std::size_t well_index, std::size_t timeStep) const {
-        const auto find_pred = [well_index] (const auto& well_pair) -> bool
-        {
-            return well_pair.second->seqIndex() == well_index;
-        };
-
-        auto well_ptr = this->snapshots[timeStep].wells.find( find_pred );
+        const auto* well_ptr = this->snapshots[timeStep].wells.find_index(well_index);
         if (well_ptr == nullptr)
             throw std::invalid_argument(fmt::format("There is no well with well_index:{} at report_step:{}", well_index, timeStep));
 
@@ -1296,6 +1407,14 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         return this->snapshots[timeStep].groups.get(groupName);
     }
 
+    const Group& Schedule::getGroup(std::size_t group_index, std::size_t timeStep) const {
+        const auto* group_ptr = this->snapshots[timeStep].groups.find_index(group_index);
+        if (group_ptr == nullptr)
+            throw std::invalid_argument(fmt::format("There is no group with group_index:{} at report_step:{}", group_index, timeStep));
+
+        return *group_ptr;
+    }
+
     void Schedule::updateGuideRateModel(const GuideRateModel& new_model, std::size_t report_step) {
         auto new_config = this->snapshots[report_step].guide_rate();
         if (new_config.update_model(new_model))
@@ -1405,12 +1524,13 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
+            const auto compiled = ShellPattern { pattern };
             std::vector<std::string> names;
             std::copy_if(group_order.begin(), group_order.end(),
                          std::back_inserter(names),
-                         [&pattern](const auto& gname)
+                         [&compiled](const auto& gname)
                          {
-                             return shmatch(pattern, gname);
+                             return compiled.match(gname);
                          });
             return names;
         }
@@ -1928,6 +2048,14 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         return *(this->simUpdateFromPython);
     }
 
+    SimulatorUpdate Schedule::runPyActions(std::size_t reportStep, const std::vector<const Action::PyAction*>& pyactions, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state) {
+        SimulatorUpdate sim_update;
+        for (const auto* pyaction : pyactions)
+            sim_update.append(this->runPyAction(reportStep, *pyaction, action_state, ecl_state, summary_state));
+
+        return sim_update;
+    }
+
     void Schedule::applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double newWellPI) {
         if (reportStep >= this->snapshots.size())
             return;
@@ -2349,6 +2477,53 @@ namespace {
         return this->snapshots[report_step].glo();
     }
 
+    GasLiftPlan Schedule::glo_plan(std::size_t report_step) const {
+        return GasLiftPlan { this->snapshots[report_step] };
+    }
+
+    std::vector<Schedule::MemoryUsage> Schedule::memoryUsage() const {
+        std::vector<MemoryUsage> usage;
+        usage.reserve(this->snapshots.size());
+
+        std::unordered_set<const void*> seen;
+        auto first_seen = [&seen](const void* object) { return seen.insert(object).second; };
+
+        for (const auto& state : this->snapshots) {
+            auto& step = usage.emplace_back();
+
+            for (const auto& [_, well] : state.wells) {
+                (void)_;
+                if (!first_seen(well.get()))
+                    continue;
+
+                step.wells += 1;
+                step.bytes += sizeof(Well);
+
+                const auto& connections = well->getConnections();
+                if (first_seen(&connections)) {
+                    step.connections += 1;
+                    step.bytes += sizeof(WellConnections) + connections.size() * sizeof(Connection);
+                }
+
+                if (well->isMultiSegment()) {
+                    const auto& segments = well->getSegments();
+                    if (first_seen(&segments)) {
+                        step.segments += 1;
+                        step.bytes += sizeof(WellSegments) + segments.size() * sizeof(Segment);
+                    }
+                }
+
+                if (first_seen(&well->getProductionProperties()))
+                    step.bytes += sizeof(Well::WellProductionProperties);
+
+                if (first_seen(&well->getInjectionProperties()))
+                    step.bytes += sizeof(Well::WellInjectionProperties);
+            }
+        }
+
+        return usage;
+    }
+
 namespace {
 /*
   The insane trickery here (thank you Stackoverflow!) is to be able to provide a
@@ -2671,6 +2846,31 @@ void Schedule::dump_deck(std::ostream& os) const
     this->m_sched_deck.dump_deck(os, this->getUnits());
 }
 
+Opm::MemoryUsage::Node Schedule::memoryUsage(Opm::MemoryUsage& usage) const
+{
+    const auto before = usage.heapBytes();
+
+    auto node = Opm::MemoryUsage::Node { "Schedule" };
+    node.children.push_back(usage.node("ScheduleStatic", this->m_static));
+    node.children.push_back(usage.node("ScheduleDeck", this->m_sched_deck));
+
+    // Visiting the report steps in order attributes each shared member
+    // to the first step which holds it.
+    node.children.push_back(usage.node("ScheduleState", this->snapshots));
+
+    usage(this->action_wgnames);
+    usage(this->potential_wellopen_patterns);
+    usage(this->exit_status);
+    usage(this->restart_output);
+    usage(this->completed_cells);
+    usage(this->possibleFutureConnections);
+    usage(this->simUpdateFromPython);
+
+    node.bytes = sizeof(*this) + (usage.heapBytes() - before);
+
+    return node;
+}
+
 std::ostream& operator<<(std::ostream& os, const Schedule& sched)
 {
     sched.dump_deck(os);
@@ -32,6 +32,8 @@
 #include <utility>
 #include <vector>
 
+#include <opm/common/utility/MemoryUsage.hpp>
+
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
 #include <opm/input/eclipse/Schedule/Action/WGNames.hpp>
@@ -40,6 +42,7 @@
 #include <opm/input/eclipse/Schedule/ScheduleDeck.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleStatic.hpp>
+#include <opm/input/eclipse/Schedule/VFPTableCache.hpp>
 #include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/input/eclipse/Schedule/WriteRestartFileEvents.hpp>
@@ -56,6 +59,7 @@ namespace Opm {
     class ErrorGuard;
     class FieldPropsManager;
     class GasLiftOpt;
+    class GasLiftPlan;
     class GTNode;
     class GuideRateConfig;
     class GuideRateModel;
@@ -216,6 +220,17 @@ namespace Opm {
         std::size_t numWells(std::size_t timestep) const;
         bool hasWell(const std::string& wellName) const;
         bool hasWell(const std::string& wellName, std::size_t timeStep) const;
+        bool hasWell(std::size_t well_index, std::size_t timeStep) const;
+
+        /// Dense, stable integer handle of a well or group.
+        ///
+        /// The handle is the well's Well::seqIndex() or the group's
+        /// Group::insert_index() and does not change between report steps.
+        /// It can be used with the index based overloads of hasWell(),
+        /// getWell() and getGroup() which do not hash the name.  Returns
+        /// nullopt if the well or group is never defined.
+        std::optional<std::size_t> wellIndex(const std::string& wellName) const;
+        std::optional<std::size_t> groupIndex(const std::string& groupName) const;
 
         WellMatcher wellMatcher(std::size_t report_step) const;
         std::function<std::unique_ptr<SegmentMatcher>()> segmentMatcherFactory(std::size_t report_step) const;
@@ -251,6 +266,14 @@ namespace Opm {
         std::vector<Well> getActiveWellsAtEnd() const; // Get wells that have been active any time during simulation
         std::vector<std::string> getInactiveWellNamesAtEnd() const; // Get well names of wells that have never been active
 
+        // Same wells as getWells(), getWellsatEnd() and
+        // getActiveWellsAtEnd(), but without copying them.  The pointers
+        // refer to the wells stored in the Schedule and remain valid
+        // until the report step is modified, e.g., by an ACTIONX.
+        std::vector<const Well*> getWellPtrs(std::size_t timeStep) const;
+        std::vector<const Well*> getWellPtrsAtEnd() const;
+        std::vector<const Well*> getActiveWellPtrsAtEnd() const;
+
         const std::unordered_map<std::string, std::set<int>>& getPossibleFutureConnections() const;
 
         void shut_well(const std::string& well_name, std::size_t report_step);
@@ -264,6 +287,8 @@ namespace Opm {
 
         std::vector<const Group*> getChildGroups2(const std::string& group_name, std::size_t timeStep) const;
         std::vector<Well> getChildWells2(const std::string& group_name, std::size_t timeStep) const;
+        // Same wells as getChildWells2(), without copying them.
+        std::vector<const Well*> getChildWellPtrs(const std::string& group_name, std::size_t timeStep) const;
         WellProducerCMode getGlobalWhistctlMmode(std::size_t timestep) const;
 
         const UDQConfig& getUDQConfig(std::size_t timeStep) const;
@@ -272,6 +297,7 @@ namespace Opm {
         GTNode groupTree(std::size_t report_step) const;
         GTNode groupTree(const std::string& root_node, std::size_t report_step) const;
         const Group& getGroup(const std::string& groupName, std::size_t timeStep) const;
+        const Group& getGroup(std::size_t group_index, std::size_t timeStep) const;
 
         std::optional<std::size_t> first_RFT() const;
         /*
@@ -307,9 +333,53 @@ namespace Opm {
         */
         SimulatorUpdate runPyAction(std::size_t reportStep, const Action::PyAction& pyaction, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state);
 
+        /*
+          Run all the PYACTION keywords in pyactions, typically the ones
+          returned from Actions::pending_python(), in order. The return value
+          combines the updates from all of them.
+        */
+        SimulatorUpdate runPyActions(std::size_t reportStep, const std::vector<const Action::PyAction*>& pyactions, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state);
+
 
         const GasLiftOpt& glo(std::size_t report_step) const;
 
+        /// Integer indexed gas lift optimisation settings of one report
+        /// step, for use throughout the step's gas lift iterations.
+        GasLiftPlan glo_plan(std::size_t report_step) const;
+
+        /// Estimated memory held by the well objects of one report step.
+        struct MemoryUsage
+        {
+            /// Number of Well objects first referenced at this step.
+            std::size_t wells{0};
+
+            /// Number of connection sets first referenced at this step.
+            std::size_t connections{0};
+
+            /// Number of segment sets first referenced at this step.
+            std::size_t segments{0};
+
+            /// Estimated size in bytes of the above and of the
+            /// production and injection properties first referenced at
+            /// this step.
+            std::size_t bytes{0};
+        };
+
+        /// Memory uniquely held by each report step.
+        ///
+        /// Objects shared with an earlier report step, e.g., the
+        /// connections of a well whose rates changed, are only counted for
+        /// the first report step which refers to them.  The byte counts
+        /// are estimated from the object sizes and the number of
+        /// connections and segments, and exclude heap storage of strings.
+        std::vector<MemoryUsage> memoryUsage() const;
+
+        /// Memory of the whole schedule, including the heap storage of
+        /// all members, broken down into the static part, the SCHEDULE
+        /// section keywords and the report steps.  Members shared between
+        /// report steps are counted once.  See Opm::MemoryUsage.
+        Opm::MemoryUsage::Node memoryUsage(Opm::MemoryUsage& usage) const;
+
         bool operator==(const Schedule& data) const;
         std::shared_ptr<const Python> python() const;
 
@@ -342,7 +412,18 @@ namespace Opm {
             serializer(this->action_wgnames);
             serializer(this->potential_wellopen_patterns);
             serializer(this->exit_status);
-            serializer(this->snapshots);
+
+            // Each report step is written as the difference to the
+            // previous one, which is why the snapshots are not serialized
+            // as a plain vector.
+            std::size_t num_snapshots = this->snapshots.size();
+            serializer(num_snapshots);
+            if (!serializer.isSerializing())
+                this->snapshots.resize(num_snapshots);
+
+            for (std::size_t index = 0; index < num_snapshots; ++index)
+                this->snapshots[index].serializeOp(serializer, (index > 0) ? &this->snapshots[index - 1] : nullptr);
+
             serializer(this->restart_output);
             serializer(this->completed_cells);
             serializer(this->m_treat_critical_as_non_critical);
@@ -420,6 +501,11 @@ namespace Opm {
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
 
+        // VFP tables built ahead of their keyword handlers while loading
+        // the SCHEDULE section.  Transient, neither compared nor
+        // serialized.
+        VFPTableCache m_vfp_tables{VFPTableCache::fromEnvironment()};
+
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
                       const ScheduleGrid& grid,
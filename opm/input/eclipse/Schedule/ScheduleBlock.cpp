@@ -52,6 +52,11 @@ void ScheduleBlock::push_back(const DeckKeyword& keyword)
     this->m_keywords.push_back(keyword);
 }
 
+void ScheduleBlock::push_back(DeckKeyword&& keyword)
+{
+    this->m_keywords.push_back(std::move(keyword));
+}
+
 std::optional<DeckKeyword> ScheduleBlock::get(const std::string& kw) const
 {
     auto kwPos = std::find_if(this->m_keywords.begin(),
@@ -195,4 +200,10 @@ void ScheduleBlock::clearKeywords()
     m_keywords.clear();
 }
 
+void ScheduleBlock::convertToSI()
+{
+    for (auto& keyword : this->m_keywords)
+        keyword.convertToSI();
+}
+
 } // namespace Opm
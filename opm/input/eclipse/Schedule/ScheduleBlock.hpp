@@ -57,6 +57,7 @@ public:
                   const time_point& start_time);
     std::size_t size() const;
     void push_back(const DeckKeyword& keyword);
+    void push_back(DeckKeyword&& keyword);
     std::optional<DeckKeyword> get(const std::string& kw) const;
     const time_point& start_time() const;
     const std::optional<time_point>& end_time() const;
@@ -72,6 +73,10 @@ public:
 
     void clearKeywords();
 
+    // Convert the double items of all keywords in the block to SI units,
+    // see DeckKeyword::convertToSI().
+    void convertToSI();
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
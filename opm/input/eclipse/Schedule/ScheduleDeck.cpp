@@ -27,7 +27,6 @@
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckOutput.hpp>
-#include <opm/input/eclipse/Deck/DeckSection.hpp>
 
 #include <opm/input/eclipse/Schedule/ScheduleRestartInfo.hpp>
 
@@ -36,6 +35,7 @@
 #include <chrono>
 #include <ctime>
 #include <unordered_set>
+#include <utility>
 
 #include <fmt/format.h>
 #include <fmt/chrono.h>
@@ -65,7 +65,56 @@ std::size_t ScheduleDeck::restart_offset() const {
 }
 
 
+ScheduleKeywordStream::ScheduleKeywordStream(const Deck& deck)
+    : m_deck(&deck)
+{}
+
+ScheduleKeywordStream::ScheduleKeywordStream(Deck& deck, bool release_keywords)
+    : m_deck(&deck)
+    , m_release_deck(release_keywords ? &deck : nullptr)
+{}
+
+const Deck& ScheduleKeywordStream::deck() const {
+    return *this->m_deck;
+}
+
+DeckKeyword ScheduleKeywordStream::pull(const std::size_t deck_index) {
+    if (this->m_release_deck == nullptr)
+        return (*this->m_deck)[deck_index];
+
+    auto& keyword = *(this->m_release_deck->begin() + deck_index);
+    auto pulled = std::move(keyword);
+    keyword = DeckKeyword { pulled.location(), pulled.name() };
+    return pulled;
+}
+
+
 ScheduleDeck::ScheduleDeck(time_point start_time, const Deck& deck, const ScheduleRestartInfo& rst_info) {
+    this->init(start_time, deck, rst_info);
+}
+
+
+ScheduleDeck::ScheduleDeck(time_point start_time, std::shared_ptr<ScheduleKeywordStream> stream, const ScheduleRestartInfo& rst_info)
+    : m_stream(std::move(stream))
+{
+    this->init(start_time, this->m_stream->deck(), rst_info);
+}
+
+
+void ScheduleDeck::add_keyword(const std::size_t block, const std::size_t deck_index, const DeckKeyword& keyword) {
+    if (! this->m_stream) {
+        this->m_blocks[block].push_back(keyword);
+        return;
+    }
+
+    if (this->m_pending.size() <= block)
+        this->m_pending.resize(block + 1);
+
+    this->m_pending[block].push_back(deck_index);
+}
+
+
+void ScheduleDeck::init(time_point start_time, const Deck& deck, const ScheduleRestartInfo& rst_info) {
     const std::unordered_set<std::string> skiprest_include = {"VFPPROD", "VFPINJ", "RPTSCHED", "RPTRST", "TUNING", "MESSAGES"};
 
     this->m_restart_time = TimeService::from_time_t(rst_info.time);
@@ -86,8 +135,15 @@ ScheduleDeck::ScheduleDeck(time_point start_time, const Deck& deck, const Schedu
     } else
         this->m_blocks.emplace_back(KeywordLocation{}, ScheduleTimeType::START, start_time);
 
+    // The SCHEDULE section is the last section of the deck, i.e. the same
+    // keywords as in SCHEDULESection(deck), but iterated by deck index so
+    // that they can be pulled from a ScheduleKeywordStream later.
+    const auto section_start = deck.hasKeyword("SCHEDULE")
+        ? deck.index("SCHEDULE").front() : deck.size();
+
     ScheduleDeckContext context(this->skiprest, this->m_blocks.back().start_time());
-    for( const auto& keyword : SCHEDULESection(deck)) {
+    for (auto deck_index = section_start; deck_index < deck.size(); ++deck_index) {
+        const auto& keyword = deck[deck_index];
         if (keyword.name() == "DATES") {
             for (size_t recordIndex = 0; recordIndex < keyword.size(); recordIndex++) {
                 const auto &record = keyword.getRecord(recordIndex);
@@ -127,9 +183,9 @@ ScheduleDeck::ScheduleDeck(time_point start_time, const Deck& deck, const Schedu
 
         if (context.rst_skip) {
             if (skiprest_include.count(keyword.name()) != 0)
-                this->m_blocks[0].push_back(keyword);
+                this->add_keyword(0, deck_index, keyword);
         } else {
-            this->m_blocks.back().push_back(keyword);
+            this->add_keyword(this->m_blocks.size() - 1, deck_index, keyword);
         }
     }
 }
@@ -297,5 +353,25 @@ void ScheduleDeck::clearKeywords(const std::size_t idx)
     m_blocks[idx].clearKeywords();
 }
 
+void ScheduleDeck::load_keywords(const std::size_t idx)
+{
+    if (!this->m_stream || (idx >= this->m_pending.size()))
+        return;
+
+    auto pending = std::move(this->m_pending[idx]);
+    this->m_pending[idx].clear();
+    for (const auto deck_index : pending)
+        this->m_blocks[idx].push_back(this->m_stream->pull(deck_index));
+}
+
+void ScheduleDeck::finish_loading()
+{
+    for (std::size_t idx = 0; idx < this->m_pending.size(); ++idx)
+        this->load_keywords(idx);
+
+    this->m_pending.clear();
+    this->m_stream.reset();
+}
+
 
 }
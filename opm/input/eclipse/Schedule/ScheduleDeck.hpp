@@ -28,6 +28,7 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <vector>
 
 
@@ -41,6 +42,29 @@ namespace Opm {
     class Runspec;
     class UnitSystem;
 
+    /*
+      The ScheduleKeywordStream hands the keywords of the SCHEDULE section
+      of a Deck to a ScheduleDeck one report step at a time, when
+      ScheduleDeck::load_keywords() is called for that step.  When created
+      from a mutable Deck with release_keywords set the records of each
+      keyword are moved out of the Deck as the keyword is pulled, leaving
+      only the keyword name and location behind, so that the Deck and the
+      ScheduleDeck do not both hold the full SCHEDULE section.
+    */
+
+    class ScheduleKeywordStream {
+    public:
+        explicit ScheduleKeywordStream(const Deck& deck);
+        ScheduleKeywordStream(Deck& deck, bool release_keywords);
+
+        const Deck& deck() const;
+        DeckKeyword pull(std::size_t deck_index);
+
+    private:
+        const Deck* m_deck{nullptr};
+        Deck* m_release_deck{nullptr};
+    };
+
     /*
       The purpose of the ScheduleDeck class is to serve as a container holding
       all the keywords of the SCHEDULE section, when the Schedule class is
@@ -48,11 +72,19 @@ namespace Opm {
       The ScheduleDeck class can be indexed with report step through operator[].
       Internally the ScheduleDeck class is a vector of ScheduleBlock instances -
       one for each report step.
+
+      When the ScheduleDeck is created from a ScheduleKeywordStream only the
+      report step structure is established up front; the keywords of a
+      report step are added by load_keywords(), typically just before the
+      Schedule processes that step.  finish_loading() adds any remaining
+      keywords and drops the stream, after which the ScheduleDeck no longer
+      refers to the Deck.
     */
 
     class ScheduleDeck {
     public:
         explicit ScheduleDeck(time_point start_time, const Deck& deck, const ScheduleRestartInfo& rst_info);
+        ScheduleDeck(time_point start_time, std::shared_ptr<ScheduleKeywordStream> stream, const ScheduleRestartInfo& rst_info);
         ScheduleDeck();
         void add_block(ScheduleTimeType time_type, const time_point& t,
                        ScheduleDeckContext& context, const KeywordLocation& location);
@@ -80,6 +112,8 @@ namespace Opm {
         void dump_deck(std::ostream& os, const UnitSystem& usys) const;
 
         void clearKeywords(const std::size_t idx);
+        void load_keywords(const std::size_t idx);
+        void finish_loading();
 
     private:
         time_point m_restart_time{};
@@ -87,6 +121,14 @@ namespace Opm {
         bool skiprest{false};
         KeywordLocation m_location{};
         std::vector<ScheduleBlock> m_blocks{};
+
+        // deck indices of the keywords not yet pulled from m_stream, one
+        // list per report step.
+        std::shared_ptr<ScheduleKeywordStream> m_stream{};
+        std::vector<std::vector<std::size_t>> m_pending{};
+
+        void init(time_point start_time, const Deck& deck, const ScheduleRestartInfo& rst_info);
+        void add_keyword(std::size_t block, std::size_t deck_index, const DeckKeyword& keyword);
     };
 }
 
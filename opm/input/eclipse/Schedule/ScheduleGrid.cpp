@@ -24,8 +24,11 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 
+#include <array>
 #include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -42,24 +45,104 @@ Opm::ScheduleGrid::ScheduleGrid(Opm::CompletedCells& completed_cells)
 {}
 
 namespace {
-    double try_get_value(const Opm::FieldPropsManager& fp,
-                         const std::string& kw,
-                         const std::size_t active_index)
+    /// Field property arrays of the completed cells.  The arrays are looked
+    /// up by name on first use only, so that a batch of cells costs one
+    /// lookup per keyword rather than one per cell.
+    class CellPropertyLookup
     {
-        if (! fp.has_double(kw)) {
-            throw std::logic_error(fmt::format("FieldPropsManager is missing keyword '{}'", kw));
+    public:
+        explicit CellPropertyLookup(const Opm::FieldPropsManager& fp)
+            : fp_ { fp }
+        {}
+
+        double porv(const std::size_t active_index)
+        {
+            return value(this->porv_, "PORV", active_index);
         }
 
-        return fp.try_get<double>(kw)->at(active_index);
-    }
+        void assign(Opm::CompletedCells::Cell::Props& props)
+        {
+            const auto active_index = props.active_index;
+
+            props.permx = value(this->permx_, "PERMX", active_index);
+            props.permy = value(this->permy_, "PERMY", active_index);
+            props.permz = value(this->permz_, "PERMZ", active_index);
+            props.poro = value(this->poro_, "PORO", active_index);
+            props.satnum = int_value(this->satnum_, "SATNUM", active_index);
+            props.pvtnum = int_value(this->pvtnum_, "PVTNUM", active_index);
+
+            if (! this->ntg_resolved_) {
+                this->ntg_ = this->fp_.has_double("NTG")
+                    ? this->fp_.try_get<double>("NTG")
+                    : nullptr;
+                this->ntg_resolved_ = true;
+            }
+
+            props.ntg = (this->ntg_ != nullptr)
+                ? this->ntg_->at(active_index)
+                : 1.0;
+        }
+
+    private:
+        const Opm::FieldPropsManager& fp_;
+
+        const std::vector<double>* porv_{nullptr};
+        const std::vector<double>* permx_{nullptr};
+        const std::vector<double>* permy_{nullptr};
+        const std::vector<double>* permz_{nullptr};
+        const std::vector<double>* poro_{nullptr};
+        const std::vector<double>* ntg_{nullptr};
+        const std::vector<int>* satnum_{nullptr};
+        const std::vector<int>* pvtnum_{nullptr};
+        bool ntg_resolved_{false};
+
+        double value(const std::vector<double>*& data,
+                     const std::string& kw,
+                     const std::size_t active_index)
+        {
+            if (data == nullptr) {
+                if (! this->fp_.has_double(kw)) {
+                    throw std::logic_error(fmt::format("FieldPropsManager is missing keyword '{}'", kw));
+                }
+
+                data = this->fp_.try_get<double>(kw);
+            }
 
-    double try_get_ntg_value(const Opm::FieldPropsManager& fp,
-                             const std::string& kw,
-                             const std::size_t active_index)
+            return data->at(active_index);
+        }
+
+        int int_value(const std::vector<int>*& data,
+                      const std::string& kw,
+                      const std::size_t active_index)
+        {
+            if (data == nullptr) {
+                data = &this->fp_.get_int(kw);
+            }
+
+            return data->at(active_index);
+        }
+    };
+
+    void fill_cell(const Opm::EclipseGrid& grid,
+                   CellPropertyLookup& properties,
+                   Opm::CompletedCells::Cell& cell)
     {
-        return fp.has_double(kw)
-            ? fp.try_get<double>(kw)->at(active_index)
-            : 1.0;
+        const auto i = cell.i;
+        const auto j = cell.j;
+        const auto k = cell.k;
+
+        cell.depth = grid.getCellDepth(i, j, k);
+        cell.dimensions = grid.getCellDimensions(i, j, k);
+
+        if (grid.cellActive(i, j, k)) {
+            const auto active_index = grid.getActiveIndex(i, j, k);
+            const double porv = properties.porv(active_index);
+            if (grid.cellActiveAfterMINPV(i, j, k, porv)) {
+                auto& props = cell.props.emplace(Opm::CompletedCells::Cell::Props{});
+                props.active_index = active_index;
+                properties.assign(props);
+            }
+        }
     }
 }
 
@@ -73,30 +156,72 @@ Opm::ScheduleGrid::get_cell(std::size_t i, std::size_t j, std::size_t k) const
     auto [valid, cellRef] = this->cells.try_get(i, j, k);
 
     if (!valid) {
-        cellRef.depth = this->grid->getCellDepth(i, j, k);
-        cellRef.dimensions = this->grid->getCellDimensions(i, j, k);
-
-        if (this->grid->cellActive(i, j, k)) {
-            const auto active_index = this->grid->getActiveIndex(i, j, k);
-            const double porv = try_get_value(*this->fp, "PORV", active_index);
-            if (this->grid->cellActiveAfterMINPV(i, j, k, porv)) {
-                auto& props = cellRef.props.emplace(CompletedCells::Cell::Props{});
-                props.active_index = active_index;
-                props.permx = try_get_value(*this->fp, "PERMX", props.active_index);
-                props.permy = try_get_value(*this->fp, "PERMY", props.active_index);
-                props.permz = try_get_value(*this->fp, "PERMZ", props.active_index);
-                props.poro = try_get_value(*this->fp, "PORO", props.active_index);
-                props.satnum = this->fp->get_int("SATNUM").at(props.active_index);
-                props.pvtnum = this->fp->get_int("PVTNUM").at(props.active_index);
-                props.ntg = try_get_ntg_value(*this->fp, "NTG", props.active_index);
-            }
-        }
+        CellPropertyLookup properties { *this->fp };
+        fill_cell(*this->grid, properties, cellRef);
     }
 
     return cellRef;
 }
 
+std::vector<const Opm::CompletedCells::Cell*>
+Opm::ScheduleGrid::get_cells(const std::vector<std::array<std::size_t, 3>>& ijk) const
+{
+    std::vector<const CompletedCells::Cell*> result;
+    result.reserve(ijk.size());
+
+    if (this->grid == nullptr) {
+        for (const auto& [i, j, k] : ijk) {
+            result.push_back(&this->cells.get(i, j, k));
+        }
+
+        return result;
+    }
+
+    for (const auto& [i, j, k] : ijk) {
+        if ((i >= this->grid->getNX()) ||
+            (j >= this->grid->getNY()) ||
+            (k >= this->grid->getNZ()))
+        {
+            throw std::invalid_argument {
+                fmt::format("Cell ({},{},{}) is outside the grid", i + 1, j + 1, k + 1)
+            };
+        }
+    }
+
+    std::vector<CompletedCells::Cell*> missing;
+    this->cells.reserve(ijk.size());
+    for (const auto& [i, j, k] : ijk) {
+        auto [valid, cellRef] = this->cells.try_get(i, j, k);
+        if (!valid) {
+            missing.push_back(&cellRef);
+        }
+
+        result.push_back(&cellRef);
+    }
+
+    // Computing the geometry of all active cells is done in parallel and
+    // kept by the grid, after which depths and dimensions of active cells
+    // are plain lookups.  This pays off once the batch touches a noticeable
+    // fraction of the active cells.
+    if (32 * missing.size() >= this->grid->getNumActive()) {
+        this->grid->activeGeometry();
+    }
+
+    CellPropertyLookup properties { *this->fp };
+    for (auto* cell : missing) {
+        fill_cell(*this->grid, properties, *cell);
+    }
+
+    return result;
+}
+
 const Opm::EclipseGrid* Opm::ScheduleGrid::get_grid() const
 {
     return this->grid;
 }
+
+external::cvf::ref<external::cvf::BoundingBoxTree>&
+Opm::ScheduleGrid::cellSearchTree() const
+{
+    return this->cell_search_tree;
+}
@@ -21,8 +21,12 @@
 
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 
+#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
+
+#include <array>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace Opm {
 
@@ -45,12 +49,27 @@ public:
     const CompletedCells::Cell&
     get_cell(std::size_t i, std::size_t j, std::size_t k) const;
 
+    /// Look up a set of cells at once.  Equivalent to calling get_cell()
+    /// for each (I,J,K) triplet, but the field properties are looked up
+    /// once for the whole set and large sets use the grid's geometry cache.
+    /// Throws std::invalid_argument if a cell is outside the grid.  The
+    /// returned pointers stay valid as long as the CompletedCells object.
+    std::vector<const CompletedCells::Cell*>
+    get_cells(const std::vector<std::array<std::size_t, 3>>& ijk) const;
+
     const Opm::EclipseGrid* get_grid() const;
 
+    /// Search tree over the cell bounding boxes of the grid, used to
+    /// intersect COMPTRAJ well paths with the grid.  Empty until the first
+    /// COMPTRAJ keyword builds it, and then kept for all later keywords
+    /// and report steps.
+    external::cvf::ref<external::cvf::BoundingBoxTree>& cellSearchTree() const;
+
 private:
     const EclipseGrid* grid{nullptr};
     const FieldPropsManager* fp{nullptr};
     CompletedCells& cells;
+    mutable external::cvf::ref<external::cvf::BoundingBoxTree> cell_search_tree{};
 };
 
 } // namespace Opm
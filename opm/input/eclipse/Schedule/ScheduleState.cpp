@@ -26,6 +26,7 @@
 #include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/Network/Balance.hpp>
 #include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
@@ -41,9 +42,11 @@
 #include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <ctime>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -470,5 +473,32 @@ bool ScheduleState::has_gpmaint() const
     });
 }
 
+const GroupHierarchy& ScheduleState::group_hierarchy() const
+{
+    auto hierarchy = std::atomic_load(&this->m_group_hierarchy);
+    if (hierarchy && (hierarchy->version() == this->groups.version())) {
+        return *hierarchy;
+    }
+
+    auto group_ptrs = std::vector<const Group*>{};
+    group_ptrs.reserve(this->groups.size());
+    for (const auto& [_, group] : this->groups) {
+        (void)_;
+        group_ptrs.push_back(group.get());
+    }
+
+    std::shared_ptr<const GroupHierarchy> new_hierarchy =
+        std::make_shared<GroupHierarchy>(this->groups.version(), group_ptrs);
+
+    // A concurrent caller may have published a hierarchy for the same
+    // version in the meantime.  Keep that one, since references to it may
+    // already have been handed out.
+    if (std::atomic_compare_exchange_strong(&this->m_group_hierarchy, &hierarchy, new_hierarchy)) {
+        return *new_hierarchy;
+    }
+
+    return *hierarchy;
+}
+
 
 } // namespace Opm
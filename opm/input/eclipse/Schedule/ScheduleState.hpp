@@ -38,12 +38,14 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/RSTConfig.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <optional>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -66,6 +68,7 @@ namespace Opm {
     class GConSale;
     class GConSump;
     class GroupEconProductionLimits;
+    class GroupHierarchy;
     class GroupOrder;
     class GuideRateConfig;
     class NameOrder;
@@ -114,6 +117,22 @@ namespace Opm {
 
 
 
+        /*
+          Source of the map_member<K,T>::version() numbers. The numbers are
+          unique across all maps, so equal version numbers imply equal
+          content.
+        */
+        static std::size_t next_map_version() {
+            static std::atomic<std::size_t> version{0};
+            return ++version;
+        }
+
+        template <typename T, typename = void>
+        struct has_seq_index : std::false_type {};
+
+        template <typename T>
+        struct has_seq_index<T, std::void_t<decltype(std::declval<const T&>().seqIndex())>> : std::true_type {};
+
         template <typename T>
         class ptr_member {
         public:
@@ -203,6 +222,8 @@ namespace Opm {
             void update(T object) {
                 auto key = object.name();
                 this->m_data[key] = std::make_shared<T>( std::move(object) );
+                this->m_index_table.reset();
+                this->m_version = next_map_version();
             }
 
             void update(const K& key, const map_member<K,T>& other) {
@@ -211,6 +232,46 @@ namespace Opm {
                     this->m_data[key] = other.get_ptr(key);
                 else
                     throw std::logic_error(std::string{"Tried to update member: "} + as_string(key) + std::string{"with uninitialized object"});
+                this->m_index_table.reset();
+                this->m_version = next_map_version();
+            }
+
+            /*
+              Changes with every update() of the map and is shared by copies
+              of the map, so caches derived from the map content can be
+              validated by comparing the version they were built from. Zero
+              for a default constructed, empty map.
+            */
+            std::size_t version() const {
+                return this->m_version;
+            }
+
+            /*
+              Lookup by the dense insertion index of the object, i.e.
+              Well::seqIndex() or Group::insert_index(), without hashing the
+              name. The index table is built by the first lookup after the
+              map has changed and is shared with copies of the map, so the
+              report steps which do not modify the map share one table.
+              Returns nullptr if there is no object with this index.
+            */
+            const T* find_index(std::size_t index) const {
+                auto table = std::atomic_load(&this->m_index_table);
+                if (!table) {
+                    auto new_table = std::make_shared<std::vector<const T*>>();
+                    for (const auto& [_, elm_ptr] : this->m_data) {
+                        (void)_;
+                        const auto elm_index = insert_index(*elm_ptr);
+                        if (new_table->size() <= elm_index)
+                            new_table->resize(elm_index + 1, nullptr);
+
+                        (*new_table)[elm_index] = elm_ptr.get();
+                    }
+
+                    table = std::move(new_table);
+                    std::atomic_store(&this->m_index_table, table);
+                }
+
+                return (index < table->size()) ? (*table)[index] : nullptr;
             }
 
             const T& operator()(const K& key) const {
@@ -280,6 +341,7 @@ namespace Opm {
                 T value_object = T::serializationTestObject();
                 K key = value_object.name();
                 map_object.m_data.emplace( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.m_version = next_map_version();
                 return map_object;
             }
 
@@ -287,10 +349,86 @@ namespace Opm {
             void serializeOp(Serializer& serializer)
             {
                 serializer(m_data);
+                if (!serializer.isSerializing()) {
+                    this->m_index_table.reset();
+                    this->m_version = next_map_version();
+                }
+            }
+
+            /*
+              Serialize the map as the difference to the same map of the
+              previous report step, i.e. the keys which have been removed
+              and the entries which point to a different object. An
+              unchanged map is only a marker, and is unpacked as a copy of
+              the previous map which shares its version and index table.
+              When unpacking, previous must be the map of the previous
+              report step which has already been unpacked.
+            */
+            template<class Serializer>
+            void serializeOp(Serializer& serializer, const map_member<K,T>* previous)
+            {
+                enum : int { Full = 0, Delta = 1, Unchanged = 2 };
+
+                int mode = Full;
+                if (serializer.isSerializing() && (previous != nullptr))
+                    mode = (previous->m_version == this->m_version) ? Unchanged : Delta;
+                serializer(mode);
+
+                if (mode == Full) {
+                    this->serializeOp(serializer);
+                    return;
+                }
+
+                if (mode == Unchanged) {
+                    if (!serializer.isSerializing())
+                        *this = *previous;
+                    return;
+                }
+
+                std::vector<K> removed;
+                std::vector<std::pair<K, std::shared_ptr<T>>> changed;
+                if (serializer.isSerializing()) {
+                    for (const auto& [key, _] : previous->m_data) {
+                        (void)_;
+                        if (this->m_data.count(key) == 0)
+                            removed.push_back(key);
+                    }
+
+                    for (const auto& [key, ptr] : this->m_data) {
+                        auto iter = previous->m_data.find(key);
+                        if ((iter == previous->m_data.end()) || (iter->second != ptr))
+                            changed.emplace_back(key, ptr);
+                    }
+                }
+
+                serializer(removed);
+                serializer(changed);
+
+                if (!serializer.isSerializing()) {
+                    this->m_data = previous->m_data;
+                    for (const auto& key : removed)
+                        this->m_data.erase(key);
+
+                    for (auto& [key, ptr] : changed)
+                        this->m_data[key] = std::move(ptr);
+
+                    this->m_index_table.reset();
+                    this->m_version = next_map_version();
+                }
             }
 
         private:
+            template <typename U>
+            static std::size_t insert_index(const U& object) {
+                if constexpr (has_seq_index<U>::value)
+                    return object.seqIndex();
+                else
+                    return object.insert_index();
+            }
+
             std::unordered_map<K, std::shared_ptr<T>> m_data;
+            mutable std::shared_ptr<const std::vector<const T*>> m_index_table{};
+            std::size_t m_version{0};
         };
 
         struct BHPDefaults {
@@ -387,6 +525,13 @@ namespace Opm {
 
         bool has_gpmaint() const;
 
+        /*
+          The group tree as flat arrays. Built on first use after the
+          group structure has changed, and shared with copies of this
+          ScheduleState until the group structure changes again.
+        */
+        const GroupHierarchy& group_hierarchy() const;
+
         bool hasAnalyticalAquifers() const
         {
             return ! this->aqufluxs.empty();
@@ -509,6 +654,19 @@ namespace Opm {
         using WellPIMapType = std::unordered_map<std::string, double>;
         template<class Serializer>
         void serializeOp(Serializer& serializer)
+        {
+            this->serializeOp(serializer, nullptr);
+        }
+
+        /*
+          Serialize the report step with the map members written as the
+          difference to the previous report step, see
+          map_member<K,T>::serializeOp(). The objects behind the shared
+          pointers are written once by the serializer and shared again
+          when unpacking.
+        */
+        template<class Serializer>
+        void serializeOp(Serializer& serializer, const ScheduleState* previous)
         {
             serializer(gconsale);
             serializer(gconsump);
@@ -531,10 +689,10 @@ namespace Opm {
             serializer(rst_config);
             serializer(bhp_defaults);
             serializer(source);
-            serializer(vfpprod);
-            serializer(vfpinj);
-            serializer(groups);
-            serializer(wells);
+            vfpprod.serializeOp(serializer, previous ? &previous->vfpprod : nullptr);
+            vfpinj.serializeOp(serializer, previous ? &previous->vfpinj : nullptr);
+            groups.serializeOp(serializer, previous ? &previous->groups : nullptr);
+            wells.serializeOp(serializer, previous ? &previous->wells : nullptr);
             serializer(aqufluxs);
             serializer(bcprop);
             serializer(target_wellpi);
@@ -580,6 +738,8 @@ namespace Opm {
         WellProducerCMode m_whistctl_mode = WellProducerCMode::CMODE_UNDEFINED;
         std::optional<double> m_sumthin{};
         bool m_rptonly{false};
+
+        mutable std::shared_ptr<const GroupHierarchy> m_group_hierarchy{};
     };
 }
 
@@ -19,10 +19,12 @@
 */
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/GridDims.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/S.hpp>
 #include <opm/input/eclipse/Schedule/Source.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <string>
 
 namespace Opm {
@@ -226,6 +228,52 @@ double Source::temperature(const std::pair<std::array<int, 3>, SourceComponent>&
     return 0.0;
 }
 
+int Source::CellTable::find(std::size_t cell) const
+{
+    const auto it = std::lower_bound(this->cells.begin(), this->cells.end(), cell);
+    if ((it == this->cells.end()) || (*it != cell))
+        return -1;
+
+    return static_cast<int>(it - this->cells.begin());
+}
+
+Source::CellTable Source::cellTable(const GridDims& grid) const
+{
+    std::vector<std::pair<std::size_t, const SourceCell*>> terms;
+    terms.reserve(this->m_cells.size());
+    for (const auto& source : this->m_cells)
+        terms.emplace_back(grid.getGlobalIndex(source.ijk[0], source.ijk[1], source.ijk[2]), &source);
+
+    std::stable_sort(terms.begin(), terms.end(),
+                     [](const auto& lhs, const auto& rhs)
+                     {
+                         return lhs.first < rhs.first;
+                     });
+
+    constexpr auto missing = std::numeric_limits<double>::quiet_NaN();
+
+    CellTable table;
+    table.components.reserve(terms.size());
+    table.rates.reserve(terms.size());
+    table.hrates.reserve(terms.size());
+    table.temperatures.reserve(terms.size());
+
+    for (const auto& [cell, source] : terms) {
+        if (table.cells.empty() || (table.cells.back() != cell)) {
+            table.cells.push_back(cell);
+            table.start.push_back(table.start.back());
+        }
+
+        ++table.start.back();
+        table.components.push_back(source->component);
+        table.rates.push_back(source->rate);
+        table.hrates.push_back(source->hrate.value_or(missing));
+        table.temperatures.push_back(source->temperature.value_or(missing));
+    }
+
+    return table;
+}
+
 bool Source::operator==(const Source& other) const {
     return this->m_cells == other.m_cells;
 }
@@ -30,6 +30,7 @@ namespace Opm {
 
 class Deck;
 class DeckRecord;
+class GridDims;
 
 enum class SourceComponent {
      OIL,
@@ -71,10 +72,38 @@ public:
         }
     };
 
+    /// Source terms of a report step grouped by cell, for assembly in a
+    /// single pass.
+    ///
+    /// Cells with source terms are sorted by global cell index.  The
+    /// terms of cell \c cells[c] are at positions [start[c], start[c+1])
+    /// of the per term arrays, one term per component.
+    struct CellTable
+    {
+        std::vector<std::size_t> cells{};
+        std::vector<std::size_t> start{0};
+        std::vector<SourceComponent> components{};
+        std::vector<double> rates{};
+
+        /// Energy rate and temperature of the terms, NaN where not given.
+        std::vector<double> hrates{};
+        std::vector<double> temperatures{};
+
+        std::size_t numCells() const { return this->cells.size(); }
+        std::size_t numTerms() const { return this->rates.size(); }
+
+        /// Position of global cell \p cell in \c cells, or -1 if the
+        /// cell has no source terms.
+        int find(std::size_t cell) const;
+    };
+
     Source() = default;
 
     static Source serializationTestObject();
 
+    /// Source terms by global cell index on the grid \p grid.
+    CellTable cellTable(const GridDims& grid) const;
+
     std::size_t size() const;
     std::vector<SourceCell>::const_iterator begin() const;
     std::vector<SourceCell>::const_iterator end() const;
@@ -26,6 +26,7 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <ctime>
@@ -54,6 +55,12 @@ namespace {
             && (keyword.find_first_of("WGFCRBSA") == sz_t{0});
     }
 
+    std::size_t next_udq_version()
+    {
+        static std::atomic<std::size_t> version{0};
+        return ++version;
+    }
+
     bool is_well_udq(std::string_view keyword)
     {
         // Does 'keyword' match the pattern
@@ -131,17 +138,44 @@ namespace {
         return true;
     }
 
+    template <class T>
+    using map3 = map2<std::unordered_map<std::size_t, T>>;
+
+    template <class T>
+    const T* find_var(const map3<T>& values,
+                      const std::string& var1,
+                      const std::string& var2,
+                      const std::size_t  num)
+    {
+        auto var1_iter = values.find(var1);
+        if (var1_iter == values.end())
+            return nullptr;
+
+        auto var2_iter = var1_iter->second.find(var2);
+        if (var2_iter == var1_iter->second.end())
+            return nullptr;
+
+        auto num_iter = var2_iter->second.find(num);
+        return (num_iter == var2_iter->second.end())
+            ? nullptr : &num_iter->second;
+    }
+
     template <class T>
     void erase_var(map2<T>& values,
                    std::set<std::string>& var2_set,
                    const std::string& var1,
-                   const std::string& var2)
+                   const std::string& var2,
+                   const T& value)
     {
         const auto& var1_iter = values.find(var1);
         if (var1_iter == values.end())
             return;
 
-        var1_iter->second.erase(var2);
+        auto var2_iter = var1_iter->second.find(var2);
+        if ((var2_iter == var1_iter->second.end()) || !(var2_iter->second == value))
+            return;
+
+        var1_iter->second.erase(var2_iter);
         var2_set.clear();
         for (const auto& [_, var2_map] : values) {
             (void)_;
@@ -152,6 +186,21 @@ namespace {
         }
     }
 
+    template <class T>
+    void erase_var(map3<T>& values,
+                   const std::string& var1,
+                   const std::string& var2,
+                   const std::size_t  num)
+    {
+        auto var1_iter = values.find(var1);
+        if (var1_iter == values.end())
+            return;
+
+        auto var2_iter = var1_iter->second.find(var2);
+        if (var2_iter != var1_iter->second.end())
+            var2_iter->second.erase(num);
+    }
+
     template <class T>
     std::vector<std::string>
     var2_list(const map2<T>& values, const std::string& var1)
@@ -209,12 +258,66 @@ namespace {
 namespace Opm
 {
 
+    bool SummaryState::Vector::operator==(const Vector& that) const
+    {
+        return (this->key == that.key)
+            && (this->category == that.category)
+            && (this->var == that.var)
+            && (this->entity == that.entity)
+            && (this->number == that.number)
+            && (this->total == that.total)
+            && (this->erased == that.erased)
+            ;
+    }
+
+    SummaryState::const_iterator::const_iterator(const SummaryState* st,
+                                                 const std::size_t   index)
+        : st_    { st }
+        , index_ { index }
+    {
+        this->skip_erased();
+    }
+
+    SummaryState::const_iterator::value_type
+    SummaryState::const_iterator::operator*() const
+    {
+        return { this->st_->vectors[this->index_].key,
+                 this->st_->slot_values[this->index_] };
+    }
+
+    SummaryState::const_iterator&
+    SummaryState::const_iterator::operator++()
+    {
+        ++this->index_;
+        this->skip_erased();
+
+        return *this;
+    }
+
+    SummaryState::const_iterator
+    SummaryState::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++*this;
+
+        return prev;
+    }
+
+    void SummaryState::const_iterator::skip_erased()
+    {
+        const auto& vectors = this->st_->vectors;
+        while ((this->index_ < vectors.size()) && vectors[this->index_].erased) {
+            ++this->index_;
+        }
+    }
+
     SummaryState::SummaryState(const time_point sim_start_arg,
                                const double     udqUndefined)
         : sim_start     { sim_start_arg }
         , udq_undefined { udqUndefined }
     {
         this->update_elapsed(0);
+        this->bump_udq_version();
     }
 
     SummaryState::SummaryState(const std::time_t sim_start_arg)
@@ -224,80 +327,68 @@ namespace Opm
 
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
-    }
+        const auto slot = this->slot(key);
+        this->slot_values[slot.index] = value;
 
-    bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        if (is_udq(this->vectors[slot.index].var)) {
+            this->bump_udq_version();
+        }
     }
 
-    bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
+    bool SummaryState::erase(const std::string& key)
     {
-        std::string key = var + ":" + well;
-        if (!this->erase(key))
+        auto keyPos = this->key_index.find(key);
+        if (keyPos == this->key_index.end()) {
             return false;
+        }
 
-        erase_var(this->well_values, this->m_wells, var, well);
-        this->well_names.reset();
+        this->erase_slot(keyPos->second);
         return true;
     }
 
-    bool SummaryState::erase_group_var(const std::string& group, const std::string& var)
+    bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
     {
-        std::string key = var + ":" + group;
-        if (!this->erase(key))
-            return false;
+        return this->erase(fmt::format("{}:{}", var, well));
+    }
 
-        erase_var(this->group_values, this->m_groups, var, group);
-        this->group_names.reset();
-        return true;
+    bool SummaryState::erase_group_var(const std::string& group, const std::string& var)
+    {
+        return this->erase(fmt::format("{}:{}", var, group));
     }
 
     bool SummaryState::has(const std::string& key) const
     {
-        return (this->values.find(key) != this->values.end()) || is_udq(key);
+        return (this->key_index.find(key) != this->key_index.end()) || is_udq(key);
     }
 
     bool SummaryState::has_well_var(const std::string& well,
                                     const std::string& var) const
     {
-        return has_var(this->well_values, var, well)
+        return has_var(this->well_index, var, well)
             || is_well_udq(var);
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return (this->well_values.count(var) != 0) || is_well_udq(var);
+        return (this->well_index.count(var) != 0) || is_well_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& group,
                                      const std::string& var) const
     {
-        return has_var(this->group_values, var, group) || is_group_udq(var);
+        return has_var(this->group_index, var, group) || is_group_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return (this->group_values.count(var) != 0) || is_group_udq(var);
+        return (this->group_index.count(var) != 0) || is_group_udq(var);
     }
 
     bool SummaryState::has_conn_var(const std::string& well,
                                     const std::string& var,
                                     const std::size_t  global_index) const
     {
-        // Connection Values = [var][well][index] -> double
-
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return false;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return false;
-        }
-
-        return wellPos->second.find(global_index) != wellPos->second.end();
+        return find_var(this->conn_index, var, well, global_index) != nullptr;
     }
 
     bool SummaryState::has_segment_var(const std::string& well,
@@ -306,8 +397,8 @@ namespace Opm
     {
         // Segment Values = [var][well][segment] -> double
 
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
+        auto varPos = this->segment_index.find(var);
+        if (varPos == this->segment_index.end()) {
             return false;
         }
 
@@ -324,75 +415,169 @@ namespace Opm
                                       const std::string& var,
                                       const std::size_t  region) const
     {
-        // Region Values = [var][regSet][region] -> double
+        return find_var(this->region_index,
+                        EclIO::SummaryNode::normalise_region_keyword(var),
+                        normalise_region_set_name(regSet), region) != nullptr;
+    }
 
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
-            return false;
+    SummaryState::Slot SummaryState::slot(const std::string& key)
+    {
+        auto keyPos = this->key_index.find(key);
+        if (keyPos != this->key_index.end()) {
+            return { keyPos->second };
         }
 
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
-            return false;
+        auto vector = Vector{};
+        vector.key = key;
+        vector.var = key;
+        vector.total = is_total(key);
+
+        return this->insert(std::move(vector));
+    }
+
+    SummaryState::Slot
+    SummaryState::well_slot(const std::string& well, const std::string& var)
+    {
+        if (auto varPos = this->well_index.find(var); varPos != this->well_index.end()) {
+            if (auto wellPos = varPos->second.find(well); wellPos != varPos->second.end()) {
+                return { wellPos->second };
+            }
         }
 
-        return regSetPos->second.find(region) != regSetPos->second.end();
+        auto vector = Vector{};
+        vector.key = fmt::format("{}:{}", var, well);
+        vector.category = Category::Well;
+        vector.var = var;
+        vector.entity = well;
+        vector.total = is_total(var);
+
+        return this->insert(std::move(vector));
     }
 
-    void SummaryState::update(const std::string& key, double value)
+    SummaryState::Slot
+    SummaryState::group_slot(const std::string& group, const std::string& var)
     {
-        auto& val_ref = this->values[key];
+        if (auto varPos = this->group_index.find(var); varPos != this->group_index.end()) {
+            if (auto groupPos = varPos->second.find(group); groupPos != varPos->second.end()) {
+                return { groupPos->second };
+            }
+        }
 
-        if (is_total(key)) {
-            val_ref += value;
+        auto vector = Vector{};
+        vector.key = fmt::format("{}:{}", var, group);
+        vector.category = Category::Group;
+        vector.var = var;
+        vector.entity = group;
+        vector.total = is_total(var);
+
+        return this->insert(std::move(vector));
+    }
+
+    SummaryState::Slot
+    SummaryState::conn_slot(const std::string& well,
+                            const std::string& var,
+                            const std::size_t  global_index)
+    {
+        if (const auto* slot = find_var(this->conn_index, var, well, global_index);
+            slot != nullptr)
+        {
+            return { *slot };
         }
-        else {
-            val_ref = value;
+
+        auto vector = Vector{};
+        vector.key = fmt::format("{}:{}:{}", var, well, global_index);
+        vector.category = Category::Connection;
+        vector.var = var;
+        vector.entity = well;
+        vector.number = global_index;
+        vector.total = is_total(var);
+
+        return this->insert(std::move(vector));
+    }
+
+    SummaryState::Slot
+    SummaryState::segment_slot(const std::string& well,
+                               const std::string& var,
+                               const std::size_t  segment)
+    {
+        if (const auto* slot = find_var(this->segment_index, var, well, segment);
+            slot != nullptr)
+        {
+            return { *slot };
         }
+
+        auto vector = Vector{};
+        vector.key = fmt::format("{}:{}:{}", var, well, segment);
+        vector.category = Category::Segment;
+        vector.var = var;
+        vector.entity = well;
+        vector.number = segment;
+        vector.total = is_total(var);
+
+        return this->insert(std::move(vector));
     }
 
-    void SummaryState::update_well_var(const std::string& well,
-                                       const std::string& var,
-                                       const double       value)
+    SummaryState::Slot
+    SummaryState::region_slot(const std::string& regSet,
+                              const std::string& var,
+                              const std::size_t  region)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+        const auto regSetName = normalise_region_set_name(regSet);
 
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
+        if (const auto* slot = find_var(this->region_index, regKw, regSetName, region);
+            slot != nullptr)
+        {
+            return { *slot };
         }
 
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        auto vector = Vector{};
+        vector.key = region_key(regKw, regSet, region);
+        vector.category = Category::Region;
+        vector.var = regKw;
+        vector.entity = regSetName;
+        vector.number = region;
+        vector.total = is_total(regKw);
+
+        return this->insert(std::move(vector));
     }
 
-    void SummaryState::update_group_var(const std::string& group,
-                                        const std::string& var,
-                                        const double       value)
+    void SummaryState::update(const Slot slot, const double value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
+        auto& val_ref = this->slot_values[slot.index];
 
-        if (is_total(var)) {
-            val_ref  += value;
-            gval_ref += value;
+        const auto& vector = this->vectors[slot.index];
+        if (vector.total) {
+            val_ref += value;
         }
         else {
-            val_ref = gval_ref = value;
+            val_ref = value;
         }
 
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
+        if (is_udq(vector.var)) {
+            this->bump_udq_version();
         }
     }
 
+    void SummaryState::update(const std::string& key, double value)
+    {
+        this->update(this->slot(key), value);
+    }
+
+    void SummaryState::update_well_var(const std::string& well,
+                                       const std::string& var,
+                                       const double       value)
+    {
+        this->update(this->well_slot(well, var), value);
+    }
+
+    void SummaryState::update_group_var(const std::string& group,
+                                        const std::string& var,
+                                        const double       value)
+    {
+        this->update(this->group_slot(group, var), value);
+    }
+
     void SummaryState::update_elapsed(double delta)
     {
         this->elapsed += delta;
@@ -402,25 +587,25 @@ namespace Opm
     {
         const auto var_type = udq_set.var_type();
         if (var_type == UDQVarType::WELL_VAR) {
-            for (const auto& udq_value : udq_set) {
-                this->update_well_var(udq_value.wgname(), udq_set.name(), udq_value.value().value_or(this->udq_undefined));
+            for (std::size_t i = 0; i < udq_set.size(); ++i) {
+                this->update_well_var(udq_set.wgname(i), udq_set.name(), udq_set.value(i).value_or(this->udq_undefined));
             }
         }
         else if (var_type == UDQVarType::GROUP_VAR) {
-            for (const auto& udq_value : udq_set) {
-                this->update_group_var(udq_value.wgname(), udq_set.name(), udq_value.value().value_or(this->udq_undefined));
+            for (std::size_t i = 0; i < udq_set.size(); ++i) {
+                this->update_group_var(udq_set.wgname(i), udq_set.name(), udq_set.value(i).value_or(this->udq_undefined));
             }
         }
         else if (var_type == UDQVarType::SEGMENT_VAR) {
-            for (const auto& udq_value : udq_set) {
-                this->update_segment_var(udq_value.wgname(),
+            for (std::size_t i = 0; i < udq_set.size(); ++i) {
+                this->update_segment_var(udq_set.wgname(i),
                                          udq_set.name(),
-                                         udq_value.number(),
-                                         udq_value.value().value_or(this->udq_undefined));
+                                         udq_set.number(i),
+                                         udq_set.value(i).value_or(this->udq_undefined));
             }
         }
         else {
-            const auto& udq_var = udq_set[0].value();
+            const auto udq_var = udq_set[0].value();
             this->update(udq_set.name(), udq_var.value_or(this->udq_undefined));
         }
     }
@@ -430,16 +615,7 @@ namespace Opm
                                        const std::size_t  global_index,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, global_index)];
-        auto& cval_ref = this->conn_values[var][well][global_index];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            cval_ref += value;
-        }
-        else {
-            val_ref = cval_ref = value;
-        }
+        this->update(this->conn_slot(well, var, global_index), value);
     }
 
     void SummaryState::update_segment_var(const std::string& well,
@@ -447,16 +623,7 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
-        }
-        else {
-            val_ref = sval_ref = value;
-        }
+        this->update(this->segment_slot(well, var, segment), value);
     }
 
     void SummaryState::update_region_var(const std::string& regSet,
@@ -464,25 +631,14 @@ namespace Opm
                                          const std::size_t  region,
                                          const double       value)
     {
-        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
-
-        auto& val_ref  = this->values[region_key(regKw, regSet, region)];
-        auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
-
-        if (is_total(regKw)) {
-            val_ref  += value;
-            rval_ref += value;
-        }
-        else {
-            val_ref = rval_ref = value;
-        }
+        this->update(this->region_slot(regSet, var, region), value);
     }
 
     double SummaryState::get(const std::string& key) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
+        auto iter = this->key_index.find(key);
+        if (iter != this->key_index.end()) {
+            return this->slot_values[iter->second];
         }
 
         if (is_udq(key)) {
@@ -497,9 +653,9 @@ namespace Opm
     double SummaryState::get(const std::string& key,
                              const double       default_value) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
+        auto iter = this->key_index.find(key);
+        if (iter != this->key_index.end()) {
+            return this->slot_values[iter->second];
         }
 
         if (is_udq(key)) {
@@ -519,8 +675,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_well_udq(var);
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
+        auto varPos = this->well_index.find(var);
+        if (varPos == this->well_index.end()) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -544,7 +700,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return wellPos->second;
+        return this->slot_values[wellPos->second];
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -552,8 +708,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_group_udq(var);
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
+        auto varPos = this->group_index.find(var);
+        if (varPos == this->group_index.end()) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -577,15 +733,15 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return groupPos->second;
+        return this->slot_values[groupPos->second];
     }
 
     double SummaryState::get_conn_var(const std::string& well,
                                       const std::string& var,
                                       const std::size_t  global_index) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
+        auto varPos = this->conn_index.find(var);
+        if (varPos == this->conn_index.end()) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the connection level", var)
@@ -612,7 +768,7 @@ namespace Opm
             };
         }
 
-        return connPos->second;
+        return this->slot_values[connPos->second];
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -621,8 +777,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_segment_udq(var);
 
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
+        auto varPos = this->segment_index.find(var);
+        if (varPos == this->segment_index.end()) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -661,15 +817,15 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return segPos->second;
+        return this->slot_values[segPos->second];
     }
 
     double SummaryState::get_region_var(const std::string& regSet,
                                         const std::string& var,
                                         const std::size_t  region) const
     {
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
+        auto varPos = this->region_index.find(EclIO::SummaryNode::normalise_region_keyword(var));
+        if (varPos == this->region_index.end()) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the region level", var)
@@ -696,7 +852,7 @@ namespace Opm
             };
         }
 
-        return regionPos->second;
+        return this->slot_values[regionPos->second];
     }
 
     double SummaryState::get_well_var(const std::string& well,
@@ -707,15 +863,35 @@ namespace Opm
             ? this->udq_undefined
             : default_value;
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
+        auto varPos = this->well_index.find(var);
+        if (varPos == this->well_index.end()) {
             return fallback;
         }
 
         auto wellPos = varPos->second.find(well);
         return (wellPos == varPos->second.end())
             ? fallback
-            : wellPos->second;
+            : this->slot_values[wellPos->second];
+    }
+
+    void SummaryState::get_well_vars(const std::string&              var,
+                                     const std::vector<std::string>& wells,
+                                     std::vector<double>&            values) const
+    {
+        values.assign(wells.size(), std::numeric_limits<double>::quiet_NaN());
+
+        auto varPos = this->well_index.find(var);
+        if (varPos == this->well_index.end()) {
+            return;
+        }
+
+        const auto& var_slots = varPos->second;
+        for (std::size_t i = 0; i < wells.size(); ++i) {
+            auto wellPos = var_slots.find(wells[i]);
+            if (wellPos != var_slots.end()) {
+                values[i] = this->slot_values[wellPos->second];
+            }
+        }
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -726,15 +902,15 @@ namespace Opm
             ? this->udq_undefined
             : default_value;
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
+        auto varPos = this->group_index.find(var);
+        if (varPos == this->group_index.end()) {
             return fallback;
         }
 
         auto groupPos = varPos->second.find(group);
         return (groupPos == varPos->second.end())
             ? fallback
-            : groupPos->second;
+            : this->slot_values[groupPos->second];
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -742,20 +918,11 @@ namespace Opm
                                       const std::size_t  global_index,
                                       const double       default_value) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return default_value;
-        }
+        const auto* slot = find_var(this->conn_index, var, well, global_index);
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
-
-        auto connPos = wellPos->second.find(global_index);
-        return (connPos == wellPos->second.end())
+        return (slot == nullptr)
             ? default_value
-            : connPos->second;
+            : this->slot_values[*slot];
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -763,20 +930,25 @@ namespace Opm
                                          const std::size_t  segment,
                                          const double       default_value) const
     {
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return default_value;
-        }
+        const auto* slot = find_var(this->segment_index, var, well, segment);
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
+        return (slot == nullptr)
+            ? default_value
+            : this->slot_values[*slot];
+    }
+
+    double SummaryState::get_region_var(const std::string& regSet,
+                                        const std::string& var,
+                                        const std::size_t  region,
+                                        const double       default_value) const
+    {
+        const auto* slot = find_var(this->region_index,
+                                    EclIO::SummaryNode::normalise_region_keyword(var),
+                                    normalise_region_set_name(regSet), region);
 
-        auto valPos = wellPos->second.find(segment);
-        return (valPos == wellPos->second.end())
+        return (slot == nullptr)
             ? default_value
-            : valPos->second;
+            : this->slot_values[*slot];
     }
 
     const std::vector<std::string>& SummaryState::wells() const
@@ -790,7 +962,7 @@ namespace Opm
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        return var2_list(this->well_index, var);
     }
 
     const std::vector<std::string>& SummaryState::groups() const
@@ -804,44 +976,36 @@ namespace Opm
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        return var2_list(this->group_index, var);
     }
 
     void SummaryState::append(const SummaryState& buffer)
     {
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
-        this->values = buffer.values;
-        this->well_names.reset();
-        this->group_names.reset();
-
-        this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
-        }
+        this->bump_udq_version();
 
-        this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
-        }
-
-        for (const auto& [var, vals] : buffer.conn_values) {
-            this->conn_values.insert_or_assign(var, vals);
+        if (this->vectors == buffer.vectors) {
+            this->slot_values = buffer.slot_values;
+            return;
         }
 
-        for (const auto& [var, vals] : buffer.segment_values) {
-            this->segment_values.insert_or_assign(var, vals);
+        for (std::size_t i = 0; i < buffer.vectors.size(); ++i) {
+            if (! buffer.vectors[i].erased) {
+                const auto slot = this->insert(buffer.vectors[i]);
+                this->slot_values[slot.index] = buffer.slot_values[i];
+            }
         }
     }
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { this, 0 };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { this, this->vectors.size() };
     }
 
     std::size_t SummaryState::num_wells() const
@@ -851,75 +1015,189 @@ namespace Opm
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return this->key_index.size();
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
     {
-        return (this->sim_start == other.sim_start)
-            && (this->udq_undefined == other.udq_undefined)
-            && (this->elapsed == other.elapsed)
-            && (this->values == other.values)
-            && (this->well_values == other.well_values)
-            && (this->m_wells == other.m_wells)
-            && (this->wells() == other.wells())
-            && (this->group_values == other.group_values)
-            && (this->m_groups == other.m_groups)
-            && (this->groups() == other.groups())
-            && (this->conn_values == other.conn_values)
-            && (this->segment_values == other.segment_values)
-            && (this->region_values == other.region_values)
-            ;
+        if (! ((this->sim_start == other.sim_start) &&
+               (this->udq_undefined == other.udq_undefined) &&
+               (this->elapsed == other.elapsed) &&
+               (this->key_index.size() == other.key_index.size()) &&
+               (this->m_wells == other.m_wells) &&
+               (this->m_groups == other.m_groups)))
+        {
+            return false;
+        }
+
+        // Same vectors and values, irrespective of slot order.
+        return std::all_of(this->key_index.begin(), this->key_index.end(),
+                           [&other, this](const auto& key_slot)
+                           {
+                               auto otherPos = other.key_index.find(key_slot.first);
+                               if (otherPos == other.key_index.end()) {
+                                   return false;
+                               }
+
+                               const auto& v1 = this->vectors[key_slot.second];
+                               const auto& v2 = other.vectors[otherPos->second];
+
+                               return (v1.category == v2.category)
+                                   && (v1.var == v2.var)
+                                   && (v1.entity == v2.entity)
+                                   && (v1.number == v2.number)
+                                   && (this->slot_values[key_slot.second] ==
+                                       other.slot_values[otherPos->second]);
+                           });
     }
 
-    SummaryState SummaryState::serializationTestObject()
+    SummaryState::Slot SummaryState::insert(Vector vector)
     {
-        auto st = SummaryState{TimeService::from_time_t(101), 1.234};
+        // A vector which is already known through its key, e.g., one which
+        // was added with update() before being added with update_well_var(),
+        // keeps its slot and value.
+        auto keyPos = this->key_index.find(vector.key);
+        if (keyPos != this->key_index.end()) {
+            const auto slot = keyPos->second;
+            this->vectors[slot] = std::move(vector);
+            this->index_slot(slot);
+            this->bump_udq_version();
+
+            return { slot };
+        }
 
-        st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
-        st.m_wells = {"test4"};
-        st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
-        st.m_groups = {"test7"};
-        st.group_names = {"test8"},
-        st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
+        vector.erased = false;
+        this->vectors.push_back(std::move(vector));
+        this->slot_values.push_back(0.0);
 
-        {
-            auto& sval = st.segment_values["SU1"];
-            sval.emplace("W1", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 1},  123.456   },
-                    { std::size_t{ 2},   17.29    },
-                    { std::size_t{10}, -  2.71828 },
-                });
+        const auto slot = this->vectors.size() - 1;
+        this->index_slot(slot);
+        this->bump_udq_version();
 
-            sval.emplace("W6", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 7}, 3.1415926535 },
-                });
-        }
+        return { slot };
+    }
 
-        {
-            auto& sval = st.segment_values["SUVIS"];
-            sval.emplace("I2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
+    void SummaryState::index_slot(const std::size_t slot)
+    {
+        const auto& vector = this->vectors[slot];
+
+        this->key_index.insert_or_assign(vector.key, slot);
+
+        switch (vector.category) {
+        case Category::Well:
+            this->well_index[vector.var].insert_or_assign(vector.entity, slot);
+            if (this->m_wells.insert(vector.entity).second) {
+                this->well_names.reset();
+            }
+            break;
+
+        case Category::Group:
+            this->group_index[vector.var].insert_or_assign(vector.entity, slot);
+            if (this->m_groups.insert(vector.entity).second) {
+                this->group_names.reset();
+            }
+            break;
+
+        case Category::Connection:
+            this->conn_index[vector.var][vector.entity].insert_or_assign(vector.number, slot);
+            break;
+
+        case Category::Segment:
+            this->segment_index[vector.var][vector.entity].insert_or_assign(vector.number, slot);
+            break;
+
+        case Category::Region:
+            this->region_index[vector.var][vector.entity].insert_or_assign(vector.number, slot);
+            break;
+
+        case Category::Misc:
+            break;
         }
+    }
 
-        {
-            auto& rval = st.region_values["ROPT"]["NUM"];
-            rval.emplace(12, 34.56);
-            rval.emplace(3,  14.15926);
+    void SummaryState::erase_slot(const std::size_t slot)
+    {
+        auto& vector = this->vectors[slot];
+
+        this->key_index.erase(vector.key);
+
+        // The same key may have been added both as a well and as a group
+        // variable.
+        erase_var(this->well_index, this->m_wells, vector.var, vector.entity, slot);
+        erase_var(this->group_index, this->m_groups, vector.var, vector.entity, slot);
+        this->well_names.reset();
+        this->group_names.reset();
+
+        switch (vector.category) {
+        case Category::Connection:
+            erase_var(this->conn_index, vector.var, vector.entity, vector.number);
+            break;
+
+        case Category::Segment:
+            erase_var(this->segment_index, vector.var, vector.entity, vector.number);
+            break;
+
+        case Category::Region:
+            erase_var(this->region_index, vector.var, vector.entity, vector.number);
+            break;
+
+        default:
+            break;
         }
 
-        {
-            auto& rval = st.region_values["RGPR"];
-            rval.try_emplace("RE2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
+        vector.erased = true;
+        this->bump_udq_version();
+    }
+
+    void SummaryState::rebuild_index()
+    {
+        this->key_index.clear();
+        this->well_index.clear();
+        this->m_wells.clear();
+        this->well_names.reset();
+        this->group_index.clear();
+        this->m_groups.clear();
+        this->group_names.reset();
+        this->conn_index.clear();
+        this->segment_index.clear();
+        this->region_index.clear();
+
+        for (std::size_t slot = 0; slot < this->vectors.size(); ++slot) {
+            if (! this->vectors[slot].erased) {
+                this->index_slot(slot);
+            }
         }
+    }
+
+    void SummaryState::bump_udq_version()
+    {
+        this->m_udq_version = next_udq_version();
+    }
+
+    SummaryState SummaryState::serializationTestObject()
+    {
+        auto st = SummaryState{TimeService::from_time_t(101), 1.234};
+
+        st.elapsed = 1.0;
+        st.update("test1", 2.0);
+        st.update_well_var("test3", "test2", 3.0);
+        st.update_group_var("test7", "test6", 4.0);
+        st.update_conn_var("test10", "test9", 5, 6.0);
+
+        st.update_segment_var("W1", "SU1",  1, 123.456);
+        st.update_segment_var("W1", "SU1",  2, 17.29);
+        st.update_segment_var("W1", "SU1", 10, -2.71828);
+        st.update_segment_var("W6", "SU1",  7, 3.1415926535);
+        st.update_segment_var("I2", "SUVIS", 17, 29.0);
+        st.update_segment_var("I2", "SUVIS", 42, -1.618);
+
+        st.update_region_var("FIPNUM", "ROPT", 12, 34.56);
+        st.update_region_var("FIPNUM", "ROPT",  3, 14.15926);
+        st.update_region_var("FIPRE2", "RGPR", 17, 29.0);
+        st.update_region_var("FIPRE2", "RGPR", 42, -1.618);
+
+        st.update_well_var("test4", "test5", 7.0);
+        st.erase_well_var("test4", "test5");
 
         return st;
     }
@@ -25,10 +25,12 @@
 #include <cstddef>
 #include <ctime>
 #include <iosfwd>
+#include <iterator>
 #include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -47,8 +49,8 @@ class UDQSet;
 // well 'OPX'.  The main usage of the SummaryState class is a temporary
 // holding ground while assembling data for the summary output, but it is
 // also used as a context object when evaulating the condition in ACTIONX
-// keywords. For that reason some of the data is duplicated both in the
-// general structure and a specialized structure:
+// keywords. For that reason some of the data is accessible both through
+// the general key based interface and a specialized interface:
 //
 //     SummaryState st { start, udqUndefined };
 //
@@ -70,8 +72,85 @@ namespace Opm {
 
 class SummaryState
 {
+private:
+    enum class Category : unsigned char {
+        Misc, Well, Group, Connection, Segment, Region,
+    };
+
+    // Description of one summary vector in the flat value store.
+    struct Vector
+    {
+        std::string key{};
+        Category category{Category::Misc};
+        std::string var{};
+        std::string entity{};
+        std::size_t number{0};
+        bool total{false};
+        bool erased{false};
+
+        bool operator==(const Vector& that) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(key);
+            serializer(category);
+            serializer(var);
+            serializer(entity);
+            serializer(number);
+            serializer(total);
+            serializer(erased);
+        }
+    };
+
 public:
-    using const_iterator = std::unordered_map<std::string, double>::const_iterator;
+    /// Handle to a summary vector in the flat value store.
+    ///
+    /// Obtained once from one of the slot() functions, after which the
+    /// vector may be updated and read without any string operations.  A
+    /// handle is valid only for the SummaryState object which created it,
+    /// and only until the vector is erased.
+    struct Slot
+    {
+        std::size_t index{0};
+
+        bool operator==(const Slot& that) const { return this->index == that.index; }
+    };
+
+    /// Iterator over the key and value of all summary vectors, in the
+    /// order they were added.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const std::string&, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        struct arrow_proxy
+        {
+            value_type pair;
+            const value_type* operator->() const { return &this->pair; }
+        };
+
+        const_iterator(const SummaryState* st, std::size_t index);
+
+        value_type operator*() const;
+        arrow_proxy operator->() const { return { **this }; }
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& that) const { return this->index_ == that.index_; }
+        bool operator!=(const const_iterator& that) const { return ! (*this == that); }
+
+    private:
+        const SummaryState* st_{nullptr};
+        std::size_t index_{0};
+
+        void skip_erased();
+    };
 
     explicit SummaryState(time_point sim_start_arg, double udqUndefined);
 
@@ -102,6 +181,16 @@ public:
     bool has_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
     bool has_region_var(const std::string& regSet, const std::string& var, std::size_t region) const;
 
+    // Slots of summary vectors.  The vector is created, with value zero,
+    // if it does not already exist.
+    Slot slot(const std::string& key);
+    Slot well_slot(const std::string& well, const std::string& var);
+    Slot group_slot(const std::string& group, const std::string& var);
+    Slot conn_slot(const std::string& well, const std::string& var, std::size_t global_index);
+    Slot segment_slot(const std::string& well, const std::string& var, std::size_t segment);
+    Slot region_slot(const std::string& regSet, const std::string& var, std::size_t region);
+
+    void update(Slot slot, double value);
     void update(const std::string& key, double value);
     void update_well_var(const std::string& well, const std::string& var, double value);
     void update_group_var(const std::string& group, const std::string& var, double value);
@@ -111,6 +200,11 @@ public:
     void update_segment_var(const std::string& well, const std::string& var, std::size_t segment, double value);
     void update_region_var(const std::string& regSet, const std::string& var, std::size_t region, double value);
 
+    double get(Slot slot) const
+    {
+        return this->slot_values[slot.index];
+    }
+
     double get(const std::string&) const;
     double get(const std::string&, double) const;
     double get_elapsed() const;
@@ -120,6 +214,12 @@ public:
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region) const;
     double get_well_var(const std::string& well, const std::string& var, double) const;
+
+    /// Values of well variable var for a sequence of wells, NaN for wells
+    /// without a value.  Resizes values to the number of wells.
+    void get_well_vars(const std::string& var,
+                       const std::vector<std::string>& wells,
+                       std::vector<double>& values) const;
     double get_group_var(const std::string& group, const std::string& var, double) const;
     double get_conn_var(const std::string& conn, const std::string& var, std::size_t global_index, double) const;
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment, double) const;
@@ -127,11 +227,25 @@ public:
 
     bool is_undefined_value(const double val) const { return val == udq_undefined; }
 
+    /// Changes whenever a UDQ value changes, or a summary vector is added
+    /// or erased.  The numbers are unique across all SummaryState objects
+    /// and shared by copies, so caches of values derived from UDQs, e.g.,
+    /// evaluated UDAs, can be validated by comparing the version they were
+    /// built from.
+    std::size_t udq_version() const { return this->m_udq_version; }
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
     std::vector<std::string> groups(const std::string& var) const;
+
+    /// Take all summary vectors from buffer, overwriting the values of
+    /// existing vectors.  Vectors which are not in buffer are kept.  If
+    /// both objects have the same vectors in the same order, e.g., because
+    /// this object was previously appended to from a buffer with the same
+    /// layout, the values are copied as one array.
     void append(const SummaryState& buffer);
+
     const_iterator begin() const;
     const_iterator end() const;
     std::size_t num_wells() const;
@@ -144,47 +258,69 @@ public:
         serializer(sim_start);
         serializer(this->udq_undefined);
         serializer(elapsed);
-        serializer(values);
-        serializer(well_values);
-        serializer(m_wells);
-        serializer(well_names);
-        serializer(group_values);
-        serializer(m_groups);
-        serializer(group_names);
-        serializer(conn_values);
-        serializer(segment_values);
-        serializer(this->region_values);
+        serializer(this->vectors);
+        serializer(this->slot_values);
+
+        if (! serializer.isSerializing()) {
+            this->rebuild_index();
+            this->bump_udq_version();
+        }
     }
 
     static SummaryState serializationTestObject();
 
 private:
+    template <class T>
+    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
+
+    template <class T>
+    using map3 = std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, T>>>;
+
     time_point sim_start;
     double udq_undefined{};
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
+    std::size_t m_udq_version{0};
+
+    // Flat value store.  One element in each array for every summary
+    // vector ever added.  Erased vectors keep their slots, but are removed
+    // from all index structures below.
+    std::vector<Vector> vectors{};
+    std::vector<double> slot_values{};
+
+    // The index structures are derived from 'vectors'.  Every vector is
+    // accessible through its key, while the specialised structures only
+    // hold the vectors which are added through the corresponding
+    // update_xxx_var() functions.
+    std::unordered_map<std::string, std::size_t> key_index;
 
     // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    map2<std::size_t> well_index;
     std::set<std::string> m_wells;
     mutable std::optional<std::vector<std::string>> well_names;
 
     // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
+    map2<std::size_t> group_index;
     std::set<std::string> m_groups;
     mutable std::optional<std::vector<std::string>> group_names;
 
     // The first key is the variable and the second key is the well and the
     // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+    map3<std::size_t> conn_index;
 
     // The first key is the variable and the second key is the well and the
     // third is the one-based segment number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values;
-
-    // First key is variable (e.g., ROIP), second key is region set (e.g.,
-    // FIPNUM, FIPABC), and the third key is the one-based region number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> region_values;
+    map3<std::size_t> segment_index;
+
+    // First key is variable (e.g., ROIP), second key is normalised region
+    // set (e.g., NUM, ABC), and the third key is the one-based region
+    // number.
+    map3<std::size_t> region_index;
+
+    Slot insert(Vector vector);
+    void index_slot(std::size_t slot);
+    void erase_slot(std::size_t slot);
+    void rebuild_index();
+    void bump_udq_version();
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
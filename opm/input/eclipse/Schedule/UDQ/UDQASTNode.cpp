@@ -26,12 +26,15 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
 
+#include <cmath>
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -301,6 +304,48 @@ void UDQASTNode::required_summary(std::unordered_set<std::string>& summary_keys)
     }
 }
 
+bool UDQASTNode::input_vectors(std::set<std::pair<std::string, std::string>>& inputs) const
+{
+    if ((this->type == UDQTokenType::elemental_func_randn) ||
+        (this->type == UDQTokenType::elemental_func_randu) ||
+        (this->type == UDQTokenType::elemental_func_rrandn) ||
+        (this->type == UDQTokenType::elemental_func_rrandu))
+    {
+        return false;
+    }
+
+    if (this->type == UDQTokenType::ecl_expr) {
+        const auto& keyword = std::get<std::string>(this->value);
+
+        switch (UDQ::targetType(keyword)) {
+        case UDQVarType::WELL_VAR:
+        case UDQVarType::GROUP_VAR:
+            if (this->selector.empty()) {
+                inputs.emplace(keyword, "");
+            }
+            else if (this->selector.front().find_first_of("*?") == std::string::npos) {
+                inputs.emplace(keyword, this->selector.front());
+            }
+            else {
+                return false;
+            }
+            break;
+
+        case UDQVarType::SEGMENT_VAR:
+        case UDQVarType::REGION_VAR:
+        case UDQVarType::TABLE_LOOKUP:
+            return false;
+
+        default:
+            inputs.emplace(keyword, "");
+            break;
+        }
+    }
+
+    return ((this->left == nullptr) || this->left->input_vectors(inputs))
+        && ((this->right == nullptr) || this->right->input_vectors(inputs));
+}
+
 UDQSet
 UDQASTNode::eval_expression(const UDQContext& context) const
 {
@@ -643,10 +688,15 @@ UDQASTNode::eval_table_lookup_well(const std::string& string_value,
 {
     const UDT& udt = context.get_udt(string_value);
     UDQSet result = UDQSet::wells("dummy", context.wells());
-    for (const auto& well : context.wells()) {
-        const auto xvar = context.get_well_var(well, this->selector[0]);
-        if (xvar.has_value()) {
-            result.assign(well, udt(*xvar));
+
+    // Undefined well values are NaN and give NaN.
+    std::vector<double> values;
+    context.get_well_vars(this->selector[0], values);
+    udt(values, values);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (! std::isnan(values[i])) {
+            result.assign(i, values[i]);
         }
     }
 
@@ -28,6 +28,7 @@
 #include <set>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -74,6 +75,14 @@ public:
     bool operator==(const UDQASTNode& data) const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
 
+    /// Summary vectors and UDQs read by the expression, as pairs of
+    /// vector name and well or group name.  The well or group name is
+    /// empty for all wells or groups, and for scalars.  Returns false if
+    /// the value of the expression depends on more than these vectors,
+    /// e.g., for random numbers, name patterns, segments, regions and
+    /// table lookups.
+    bool input_vectors(std::set<std::pair<std::string, std::string>>& inputs) const;
+
     template <class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -87,6 +96,8 @@ public:
     }
 
 private:
+    friend class UDQProgram;
+
     UDQTokenType type;
 
     std::variant<std::string, double> value;
@@ -31,7 +31,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -271,12 +273,11 @@ int Opm::UDQActive::update(const UDQConfig&   udq_config,
         };
     }
 
-    for (auto record = this->input_data.begin();
-         record != this->input_data.end(); ++record)
-    {
-        if ((record->wgname != wgname) || (record->control != control)) {
-            continue;
-        }
+    this->ensureInputIndex();
+
+    const auto key = std::pair { wgname, control };
+    if (auto pos = this->input_index.find(key); pos != this->input_index.end()) {
+        const auto record = this->input_data.begin() + pos->second;
 
         if (isString && (record->udq == quantity)) {
             // Alternative 3
@@ -284,15 +285,16 @@ int Opm::UDQActive::update(const UDQConfig&   udq_config,
         }
 
         this->input_data.erase(record);
+        this->input_index.clear();
         this->output_data.clear();
 
-        if (isString) {
-            // Alternative 4
-            break;
+        if (! isString) {
+            // Alternative 2
+            return 1;
         }
 
-        // Alternative 2
-        return 1;
+        // Alternative 4
+        this->ensureInputIndex();
     }
 
     // Alternatives 4 & 5
@@ -300,6 +302,7 @@ int Opm::UDQActive::update(const UDQConfig&   udq_config,
         const auto udq_index = udq_config[quantity].index.insert_index;
 
         this->input_data.emplace_back(udq_index, quantity, wgname, control);
+        this->input_index.emplace(key, this->input_data.size() - 1);
         this->output_data.clear();
 
         return 1;
@@ -320,28 +323,29 @@ const std::vector<Opm::UDQActive::OutputRecord>& Opm::UDQActive::iuad() const
 
 std::vector<Opm::UDQActive::InputRecord> Opm::UDQActive::iuap() const
 {
+    // Records with the same control and UDQ are stored consecutively, in
+    // order of first appearance of the (control, UDQ) combination.
+    auto groups = std::map<std::pair<UDAControl, std::string>, std::size_t>{};
+    auto members = std::vector<std::vector<std::size_t>>{};
+
+    for (auto i = 0*this->input_data.size(); i < this->input_data.size(); ++i) {
+        const auto& record = this->input_data[i];
+        const auto pos = groups.emplace(std::pair { record.control, record.udq },
+                                        members.size()).first;
+
+        if (pos->second == members.size()) {
+            members.emplace_back();
+        }
+
+        members[pos->second].push_back(i);
+    }
+
     auto iuap_data = std::vector<UDQActive::InputRecord>{};
+    iuap_data.reserve(this->input_data.size());
 
-    auto input_rcpy = this->input_data;
-    while (! input_rcpy.empty()) {
-        // Store next active control (new control).
-        //
-        // Recall: We must not take a reference to the new element here
-        // since push_back() below may reallocate.  In that case, all
-        // element references are invalidated.
-        const auto cur_rec =
-            iuap_data.emplace_back(input_rcpy.front());
-
-        // Find and store active controls with same control and UDQ.
-        auto it = input_rcpy.erase(input_rcpy.begin());
-        while (it != input_rcpy.end()) {
-            if ((it->control == cur_rec.control) && (it->udq == cur_rec.udq)) {
-                iuap_data.push_back(*it);
-                it = input_rcpy.erase(it);
-            }
-            else {
-                ++it;
-            }
+    for (const auto& group : members) {
+        for (const auto i : group) {
+            iuap_data.push_back(this->input_data[i]);
         }
     }
 
@@ -361,16 +365,16 @@ bool Opm::UDQActive::operator==(const UDQActive& data) const
 
 void Opm::UDQActive::constructOutputRecords() const
 {
+    // Position in output_data of each (UDQ, control) combination.
+    auto output_index = std::map<std::pair<std::string, UDAControl>, std::size_t>{};
+
     for (const auto& input_record : this->input_data) {
-        auto it = std::find_if(this->output_data.begin(), this->output_data.end(),
-                               [&input_record](const auto& output_record)
-                               {
-                                   return (output_record.udq     == input_record.udq)
-                                       && (output_record.control == input_record.control);
-                               });
-
-        if (it != this->output_data.end()) {
-            ++it->use_count;
+        const auto pos = output_index
+            .emplace(std::pair { input_record.udq, input_record.control },
+                     this->output_data.size()).first;
+
+        if (pos->second < this->output_data.size()) {
+            ++this->output_data[pos->second].use_count;
         }
         else {
             // Recall: Constructor gives use_count = 1 in this case.
@@ -394,6 +398,19 @@ void Opm::UDQActive::constructOutputRecords() const
     }
 }
 
+void Opm::UDQActive::ensureInputIndex()
+{
+    if (this->input_index.size() == this->input_data.size()) {
+        return;
+    }
+
+    this->input_index.clear();
+    for (auto i = 0*this->input_data.size(); i < this->input_data.size(); ++i) {
+        const auto& record = this->input_data[i];
+        this->input_index.emplace(std::pair { record.wgname, record.control }, i);
+    }
+}
+
 // ===========================================================================
 // Additional free functions
 // ===========================================================================
@@ -28,8 +28,10 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <map>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -389,6 +391,14 @@ private:
     /// Current set of UDAs entered in the input source.
     std::vector<InputRecord> input_data{};
 
+    /// Position in input_data of the UDA of each (well/group name,
+    /// constraint keyword item) combination.
+    ///
+    /// Not serialised.  Cleared whenever records are removed from
+    /// input_data, and rebuilt on demand when its size does not match
+    /// that of input_data.
+    std::map<std::pair<std::string, UDAControl>, std::size_t> input_index{};
+
     /// Current set of UDAs condensed by use counts and IUAP start pointers.
     ///
     /// Intended for restart file output as the IUAD vector.  Cleared if
@@ -400,6 +410,9 @@ private:
 
     /// Form output_data structure from input_data.
     void constructOutputRecords() const;
+
+    /// Rebuild input_index if it is out of date.
+    void ensureInputIndex();
 };
 
 // ===========================================================================
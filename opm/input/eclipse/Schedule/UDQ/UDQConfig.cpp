@@ -31,6 +31,7 @@
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
@@ -43,7 +44,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -650,6 +654,8 @@ namespace Opm {
 
     void UDQConfig::add_node(const std::string& quantity, const UDQAction action)
     {
+        this->dependency_graph_.reset();
+
         auto index_iter = this->input_index.find(quantity);
         if (this->input_index.find(quantity) == this->input_index.end()) {
             auto var_type = UDQ::varType(quantity);
@@ -725,7 +731,7 @@ namespace Opm {
     }
 
     void UDQConfig::eval_define(const std::size_t report_step,
-                                const UDQState&   udq_state,
+                                UDQState&         udq_state,
                                 UDQContext&       context) const
     {
         auto var_type_bit = [](const UDQVarType var_type)
@@ -739,6 +745,104 @@ namespace Opm {
         select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
         select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
 
+        const auto& graph = this->dependency_graph();
+        const auto& nodes = graph.nodes();
+
+        for (const auto& level : graph.levels()) {
+            auto defs = std::vector<std::pair<const UDQDependencyGraph::Node*, const UDQDefine*>>{};
+            for (const auto node_index : level) {
+                const auto& node = nodes[node_index];
+                const auto& def = this->m_definitions.at(node.keyword);
+
+                if (((select_var_type & var_type_bit(def.var_type())) == 0) || // Unwanted Var Type
+                    ! udq_state.define(def.status())) // UDQ def not applicable now
+                {
+                    continue;
+                }
+
+                defs.emplace_back(&node, &def);
+            }
+
+            const auto num_defs = static_cast<int>(defs.size());
+
+            auto results = std::vector<std::optional<UDQSet>>(num_defs);
+            auto inputs = std::vector<std::vector<double>>(num_defs);
+            auto have_inputs = std::vector<char>(num_defs, 0);
+            std::vector<std::exception_ptr> failure(num_defs);
+
+            auto evaluate = [&](const int i)
+            {
+                const auto& [node, def] = defs[i];
+
+                try {
+                    if (node->cacheable) {
+                        have_inputs[i] = UDQDependencyGraph::input_values(*node, context, inputs[i]);
+
+                        if (have_inputs[i] &&
+                            (def->status().first == UDQUpdate::ON) &&
+                            udq_state.define_inputs_unchanged(node->keyword, node->expression,
+                                                              context.wells(), context.groups(),
+                                                              inputs[i]))
+                        {
+                            return;
+                        }
+                    }
+
+                    results[i] = def->eval(context);
+                }
+                catch (...) {
+                    failure[i] = std::current_exception();
+                }
+            };
+
+            if (num_defs > 1) {
+                // Only cacheable DEFINEs share a level.  These read the
+                // summary and UDQ states, but do not modify them, apart
+                // from the list of group names built on first use.
+                context.groups();
+
+#pragma omp parallel for schedule(dynamic)
+                for (int i = 0; i < num_defs; ++i) {
+                    evaluate(i);
+                }
+            }
+            else if (num_defs == 1) {
+                evaluate(0);
+            }
+
+            for (int i = 0; i < num_defs; ++i) {
+                if (failure[i]) {
+                    std::rethrow_exception(failure[i]);
+                }
+
+                const auto& [node, def] = defs[i];
+
+                if (results[i].has_value()) {
+                    context.update_define(report_step, node->keyword, *results[i]);
+
+                    if (have_inputs[i]) {
+                        udq_state.record_define_inputs(node->keyword, node->expression,
+                                                       context.wells(), context.groups(),
+                                                       std::move(inputs[i]));
+                    }
+                }
+                else {
+                    udq_state.retain_define(report_step, node->keyword);
+                }
+
+                def->clear_next();
+            }
+        }
+    }
+
+    const UDQDependencyGraph& UDQConfig::dependency_graph() const
+    {
+        auto graph = std::atomic_load(&this->dependency_graph_);
+        if (graph != nullptr) {
+            return *graph;
+        }
+
+        auto defines = std::vector<const UDQDefine*>{};
         for (const auto& [keyword, index] : this->input_index) {
             if (index.action != UDQAction::DEFINE) {
                 continue;
@@ -752,16 +856,17 @@ namespace Opm {
                 };
             }
 
-            const auto& def = def_pos->second;
-            if (((select_var_type & var_type_bit(def.var_type())) == 0) || // Unwanted Var Type
-                ! udq_state.define(def.status())) // UDQ def not applicable now
-            {
-                continue;
-            }
+            defines.push_back(&def_pos->second);
+        }
 
-            context.update_define(report_step, keyword, def.eval(context));
-            def.clear_next();
+        std::shared_ptr<const UDQDependencyGraph> new_graph =
+            std::make_shared<UDQDependencyGraph>(defines);
+
+        if (std::atomic_compare_exchange_strong(&this->dependency_graph_, &graph, new_graph)) {
+            return *new_graph;
         }
+
+        return *graph;
     }
 
     void UDQConfig::add_enumerated_assign(const std::string&              quantity,
@@ -51,6 +51,7 @@ namespace Opm {
     class Schedule;
     class SegmentMatcher;
     class SummaryState;
+    class UDQDependencyGraph;
     class UDQState;
     class WellMatcher;
 
@@ -530,6 +531,7 @@ namespace Opm {
             // just construct a new instance here.
             if (!serializer.isSerializing()) {
                 udqft = UDQFunctionTable(udq_params);
+                dependency_graph_.reset();
             }
         }
 
@@ -584,6 +586,13 @@ namespace Opm {
         /// Number of UDQs of each category currently active.
         std::map<UDQVarType, std::size_t> type_count{};
 
+        /// Dependencies between the current DEFINE statements.
+        ///
+        /// Built on first use by eval_define() and reset whenever the set
+        /// of DEFINE statements changes.  Not part of the object state
+        /// proper.
+        mutable std::shared_ptr<const UDQDependencyGraph> dependency_graph_{};
+
         /// List of pending assignment statements.
         ///
         /// Marked mutable because this will be modified in member function
@@ -629,17 +638,23 @@ namespace Opm {
         /// Compute new values for all UDQs
         ///
         /// Evaluates all applicable defining expressions.  Assigns new UDQ
-        /// values to both the summary and UDQ state objects.
+        /// values to both the summary and UDQ state objects.  DEFINEs which
+        /// are ON and whose inputs are unchanged since their previous
+        /// evaluation are not evaluated again, and independent DEFINEs are
+        /// evaluated concurrently.
         ///
         /// \param[in] report_step Current report step.
         ///
-        /// \param[in] schedule Full dynamic input schedule.
+        /// \param[in,out] udq_state Dynamic values for all known UDQs.
         ///
         /// \param[in,out] context Pattern matchers and state objects.
         /// Values pertaining to UDQs being evaluated here will be updated.
-        void eval_define(std::size_t     report_step,
-                         const UDQState& udq_state,
-                         UDQContext&     context) const;
+        void eval_define(std::size_t report_step,
+                         UDQState&   udq_state,
+                         UDQContext& context) const;
+
+        /// Dependency graph of the current DEFINE statements.
+        const UDQDependencyGraph& dependency_graph() const;
 
         /// Incorporate an enumerated assignment statement into known UDQ
         /// collection.
@@ -129,6 +129,30 @@ namespace Opm {
         };
     }
 
+    void UDQContext::get_well_vars(const std::string&   var,
+                                   std::vector<double>& values) const
+    {
+        if (this->wells().empty()) {
+            // No per-well lookups, hence no check that var exists.
+            values.clear();
+            return;
+        }
+
+        if (is_udq(var)) {
+            this->udq_state.get_well_vars(var, this->wells(), values);
+            return;
+        }
+
+        if (this->summary_state.has_well_var(var)) {
+            this->summary_state.get_well_vars(var, this->wells(), values);
+            return;
+        }
+
+        throw std::logic_error {
+            fmt::format("Summary well variable: {} not registered", var)
+        };
+    }
+
     std::optional<double>
     UDQContext::get_group_var(const std::string& group,
                               const std::string& var) const
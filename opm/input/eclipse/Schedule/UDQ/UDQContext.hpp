@@ -66,6 +66,11 @@ namespace Opm {
         std::optional<double>
         get_well_var(const std::string& well, const std::string& var) const;
 
+        /// Values of well variable var for all wells(), NaN for wells
+        /// without a value.  Same source and error handling as
+        /// get_well_var(), but with a single variable lookup.
+        void get_well_vars(const std::string& var, std::vector<double>& values) const;
+
         std::optional<double>
         get_group_var(const std::string& group, const std::string& var) const;
 
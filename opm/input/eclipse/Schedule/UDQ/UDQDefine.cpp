@@ -25,6 +25,7 @@
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
@@ -284,6 +285,15 @@ UDQDefine::UDQDefine(const UDQParams&                udq_params,
                                    this->m_tokens,
                                    parseContext,
                                    errors);
+
+    this->compile_program();
+}
+
+void UDQDefine::compile_program()
+{
+    this->program = ((this->ast != nullptr) && this->ast->valid())
+        ? UDQProgram::compile(*this->ast, this->m_var_type)
+        : nullptr;
 }
 
 void UDQDefine::update_status(const UDQUpdate   update,
@@ -312,11 +322,25 @@ void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys)
     this->ast->required_summary(summary_keys);
 }
 
+bool UDQDefine::input_vectors(std::set<std::pair<std::string, std::string>>& inputs) const
+{
+    return (this->ast != nullptr)
+        && this->ast->valid()
+        && this->ast->input_vectors(inputs);
+}
+
 UDQSet UDQDefine::eval(const UDQContext& context) const
 {
     auto res = std::optional<UDQSet>{};
     try {
-        res = this->ast->eval(this->m_var_type, context);
+        if (this->program != nullptr) {
+            res = this->program->eval(context);
+        }
+
+        if (! res.has_value()) {
+            res = this->ast->eval(this->m_var_type, context);
+        }
+
         res->name(this->m_keyword);
 
         if (! dynamic_type_check(this->var_type(), res->var_type())) {
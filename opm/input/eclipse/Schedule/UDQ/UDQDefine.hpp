@@ -40,6 +40,7 @@
 namespace Opm {
 
 class UDQASTNode;
+class UDQProgram;
 class ParseContext;
 class ErrorGuard;
 
@@ -84,6 +85,7 @@ public:
     UDQVarType var_type() const;
     std::set<UDQTokenType> func_tokens() const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
+    bool input_vectors(std::set<std::pair<std::string, std::string>>& inputs) const;
     void update_status(UDQUpdate update_status, std::size_t report_step);
     std::pair<UDQUpdate, std::size_t> status() const;
     const std::vector<Opm::UDQToken> tokens() const;
@@ -102,18 +104,28 @@ public:
         serializer(string_data);
         serializer(m_update_status);
         serializer(m_report_step);
+
+        if (!serializer.isSerializing()) {
+            this->compile_program();
+        }
     }
 
 private:
     std::string m_keyword{};
     std::vector<Opm::UDQToken> m_tokens{};
     std::shared_ptr<UDQASTNode> ast{};
+
+    // Compiled form of ast for well level UDQs.  Null if the expression
+    // must be evaluated by walking the tree.
+    std::shared_ptr<const UDQProgram> program{};
     UDQVarType m_var_type{UDQVarType::NONE};
     KeywordLocation m_location{};
     std::size_t m_report_step{};
     mutable UDQUpdate m_update_status{UDQUpdate::NEXT};
     mutable std::optional<std::string> string_data;
 
+    void compile_program();
+
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
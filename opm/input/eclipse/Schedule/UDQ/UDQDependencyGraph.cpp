@@ -0,0 +1,157 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+UDQDependencyGraph::UDQDependencyGraph(const std::vector<const UDQDefine*>& defines)
+{
+    this->nodes_.reserve(defines.size());
+
+    auto index = std::unordered_map<std::string, std::size_t>{};
+    for (const auto* def : defines) {
+        auto& node = this->nodes_.emplace_back();
+        node.keyword = def->keyword();
+        node.expression = def->input_string();
+        node.var_type = def->var_type();
+
+        auto inputs = std::set<std::pair<std::string, std::string>>{};
+        node.cacheable = ((node.var_type == UDQVarType::WELL_VAR) ||
+                          (node.var_type == UDQVarType::GROUP_VAR) ||
+                          (node.var_type == UDQVarType::FIELD_VAR))
+            && def->input_vectors(inputs);
+
+        if (node.cacheable) {
+            node.inputs.assign(inputs.begin(), inputs.end());
+        }
+
+        index.emplace(node.keyword, this->nodes_.size() - 1);
+    }
+
+    // Earlier nodes which read the UDQ of a later node must be evaluated
+    // before that node.
+    auto preceding_readers = std::vector<std::vector<std::size_t>>(this->nodes_.size());
+    for (std::size_t j = 0; j < this->nodes_.size(); ++j) {
+        for (const auto& input : this->nodes_[j].inputs) {
+            auto pos = index.find(input.first);
+            if ((pos != index.end()) && (pos->second > j)) {
+                preceding_readers[pos->second].push_back(j);
+            }
+        }
+    }
+
+    // Nodes which are not cacheable have unknown inputs and act as
+    // barriers between the nodes before and after them.
+    auto num_levels = std::size_t{0};
+    auto min_level = std::size_t{0};
+    for (std::size_t i = 0; i < this->nodes_.size(); ++i) {
+        auto& node = this->nodes_[i];
+
+        if (! node.cacheable) {
+            node.level = num_levels;
+            min_level = node.level + 1;
+            num_levels = node.level + 1;
+            continue;
+        }
+
+        auto level = min_level;
+        for (const auto& input : node.inputs) {
+            auto pos = index.find(input.first);
+            if ((pos != index.end()) && (pos->second < i)) {
+                level = std::max(level, this->nodes_[pos->second].level + 1);
+            }
+        }
+
+        for (const auto j : preceding_readers[i]) {
+            level = std::max(level, this->nodes_[j].level + 1);
+        }
+
+        node.level = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+
+    this->levels_.resize(num_levels);
+    for (std::size_t i = 0; i < this->nodes_.size(); ++i) {
+        this->levels_[this->nodes_[i].level].push_back(i);
+    }
+}
+
+bool UDQDependencyGraph::input_values(const Node&          node,
+                                      const UDQContext&    context,
+                                      std::vector<double>& values)
+{
+    constexpr auto undefined = std::numeric_limits<double>::quiet_NaN();
+
+    values.clear();
+
+    try {
+        auto well_values = std::vector<double>{};
+
+        for (const auto& [vector, name] : node.inputs) {
+            switch (UDQ::targetType(vector)) {
+            case UDQVarType::WELL_VAR:
+                if (name.empty()) {
+                    context.get_well_vars(vector, well_values);
+                    values.insert(values.end(), well_values.begin(), well_values.end());
+                }
+                else {
+                    values.push_back(context.get_well_var(name, vector).value_or(undefined));
+                }
+                break;
+
+            case UDQVarType::GROUP_VAR:
+                if (name.empty()) {
+                    for (const auto& group : context.groups()) {
+                        values.push_back(context.get_group_var(group, vector).value_or(undefined));
+                    }
+                }
+                else {
+                    values.push_back(context.get_group_var(name, vector).value_or(undefined));
+                }
+                break;
+
+            default:
+                values.push_back(context.get(vector).value_or(undefined));
+                break;
+            }
+        }
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Opm
@@ -0,0 +1,93 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_DEPENDENCY_GRAPH_HPP
+#define UDQ_DEPENDENCY_GRAPH_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+class UDQContext;
+class UDQDefine;
+
+/// Dependencies between the DEFINE statements of a UDQConfig.
+///
+/// DEFINEs are evaluated in input order, so a DEFINE which refers to a
+/// UDQ defined earlier sees the new value of that UDQ, while one which
+/// refers to a UDQ defined later sees the value from the previous
+/// evaluation.  The graph has an edge from the earlier to the later
+/// DEFINE in both cases, and groups the DEFINEs into levels such that
+/// DEFINEs in the same level are independent of each other and only
+/// depend on DEFINEs in earlier levels.  Evaluating the levels in order
+/// gives the same results as evaluating in input order.
+///
+/// DEFINEs whose value is fully determined by the summary vectors and
+/// UDQs they read are cacheable: they need not be evaluated again as long
+/// as those inputs are unchanged.  The others, e.g., those using random
+/// numbers, segments or regions, keep their relative input order.
+class UDQDependencyGraph
+{
+public:
+    struct Node
+    {
+        std::string keyword{};
+        std::string expression{};
+        UDQVarType var_type{UDQVarType::NONE};
+
+        /// Vectors read by the DEFINE as pairs of vector name and well or
+        /// group name, see UDQASTNode::input_vectors().  Only for
+        /// cacheable DEFINEs.
+        std::vector<std::pair<std::string, std::string>> inputs{};
+        bool cacheable{false};
+
+        std::size_t level{0};
+    };
+
+    UDQDependencyGraph() = default;
+
+    /// \param[in] defines DEFINE statements in input order.
+    explicit UDQDependencyGraph(const std::vector<const UDQDefine*>& defines);
+
+    /// DEFINEs in input order.
+    const std::vector<Node>& nodes() const { return this->nodes_; }
+
+    /// Node indices of each level, in input order within a level.
+    const std::vector<std::vector<std::size_t>>& levels() const { return this->levels_; }
+
+    /// Current values of the inputs of a cacheable node, with NaN for
+    /// undefined values.  Returns false if the values are not available,
+    /// in which case evaluating the node reports the problem.
+    static bool input_values(const Node&          node,
+                             const UDQContext&    context,
+                             std::vector<double>& values);
+
+private:
+    std::vector<Node> nodes_{};
+    std::vector<std::vector<std::size_t>> levels_{};
+};
+
+} // namespace Opm
+
+#endif // UDQ_DEPENDENCY_GRAPH_HPP
@@ -22,7 +22,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <stdexcept>
@@ -31,6 +33,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 UDQFunction::UDQFunction(const std::string& name)
@@ -76,117 +82,165 @@ UDQSet UDQUnaryElementalFunction::eval(const UDQSet& arg) const
 
 //-----------------------------------------------------------------
 
+namespace {
+
+    // Reductions over the defined elements of a UDQ set, straight from
+    // the dense value array.  Undefined elements are NaN and fail the
+    // self-comparison, so the loops have no branches and vectorise.
+
+    struct DefinedSum
+    {
+        double value{0.0};
+        std::size_t count{0};
+    };
+
+    template <typename Transform>
+    DefinedSum sumDefined(const std::vector<double>& values, Transform&& f)
+    {
+        const auto* x = values.data();
+        const auto n = values.size();
+
+        auto sum = 0.0;
+        auto count = std::size_t{0};
+
+#pragma omp simd reduction(+:sum,count)
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto defined = x[i] == x[i];
+            sum += defined ? f(x[i]) : 0.0;
+            count += defined;
+        }
+
+        return { sum, count };
+    }
+
+    DefinedSum prodDefined(const std::vector<double>& values)
+    {
+        const auto* x = values.data();
+        const auto n = values.size();
+
+        auto prod = 1.0;
+        auto count = std::size_t{0};
+
+#pragma omp simd reduction(*:prod) reduction(+:count)
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto defined = x[i] == x[i];
+            prod *= defined ? x[i] : 1.0;
+            count += defined;
+        }
+
+        return { prod, count };
+    }
+
+    template <typename Transform>
+    DefinedSum maxDefined(const std::vector<double>& values, Transform&& f)
+    {
+        const auto* x = values.data();
+        const auto n = values.size();
+
+        auto max = -std::numeric_limits<double>::infinity();
+        auto count = std::size_t{0};
+
+#pragma omp simd reduction(max:max) reduction(+:count)
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto defined = x[i] == x[i];
+            const auto y = defined ? f(x[i]) : max;
+            max = (y > max) ? y : max;
+            count += defined;
+        }
+
+        return { max, count };
+    }
+
+    UDQSet scalarOrEmpty(const std::string& name, const DefinedSum& result)
+    {
+        return (result.count == 0)
+            ? UDQSet::empty(name)
+            : UDQSet::scalar(name, result.value);
+    }
+
+    const auto identity = [](const double x) { return x; };
+
+} // Anonymous namespace
+
 UDQSet UDQScalarFunction::UDQ_MIN(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("MIN");
-    }
+    auto result = maxDefined(arg.values(), [](const double x) { return -x; });
+    result.value = -result.value;
 
-    return UDQSet::scalar("MIN", *std::min_element(defined_values.begin(), defined_values.end()));
+    return scalarOrEmpty("MIN", result);
 }
 
 UDQSet UDQScalarFunction::UDQ_MAX(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("MAX");
-    }
-
-    return UDQSet::scalar("MAX", *std::max_element(defined_values.begin(), defined_values.end()));
+    return scalarOrEmpty("MAX", maxDefined(arg.values(), identity));
 }
 
 UDQSet UDQScalarFunction::SUM(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("SUM");
-    }
-
-    return UDQSet::scalar("SUM", std::accumulate(defined_values.begin(), defined_values.end(), 0.0));
+    return scalarOrEmpty("SUM", sumDefined(arg.values(), identity));
 }
 
 UDQSet UDQScalarFunction::PROD(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("PROD");
-    }
-
-    return UDQSet::scalar("PROD", std::accumulate(defined_values.begin(), defined_values.end(),
-                                                  1.0, std::multiplies<double>{}));
+    return scalarOrEmpty("PROD", prodDefined(arg.values()));
 }
 
 UDQSet UDQScalarFunction::AVEA(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("AVEA");
-    }
+    auto result = sumDefined(arg.values(), identity);
+    result.value /= result.count;
 
-    return UDQSet::scalar("AVEA", std::accumulate( defined_values.begin(), defined_values.end(), 0.0)
-                          / defined_values.size());
+    return scalarOrEmpty("AVEA", result);
 }
 
 UDQSet UDQScalarFunction::AVEG(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
+    const auto& values = arg.values();
+
+    const auto nonPositive = sumDefined(values, [](const double x) { return (x <= 0.0) ? 1.0 : 0.0; });
+    if (nonPositive.count == 0) {
         return UDQSet::empty("AVEG");
     }
 
-    if (std::find_if(defined_values.begin(), defined_values.end(), [](double x) { return x <= 0; }) != defined_values.end())
-    {
+    if (nonPositive.value > 0.0) {
         throw std::invalid_argument("Function AVEG must have only positive arguments");
     }
 
-    double log_mean = std::accumulate( defined_values.begin(), defined_values.end(), 0.0,
-                                       [](double x, double y) { return x + std::log(y); }) / defined_values.size();
+    auto result = sumDefined(values, [](const double x) { return std::log(x); });
+    result.value = std::exp(result.value / result.count);
 
-    return UDQSet::scalar("AVEG", std::exp(log_mean));
+    return scalarOrEmpty("AVEG", result);
 }
 
 UDQSet UDQScalarFunction::AVEH(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("AVEH");
-    }
+    auto result = sumDefined(arg.values(), [](const double x) { return 1.0 / x; });
+    result.value = result.count / result.value;
 
-    return UDQSet::scalar("AVEH", defined_values.size() / std::accumulate(defined_values.begin(), defined_values.end(), 0.0, [](double x, double y) { return x + 1.0/y; }));
+    return scalarOrEmpty("AVEH", result);
 }
 
 UDQSet UDQScalarFunction::NORMI(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("NORMI");
-    }
+    auto result = maxDefined(arg.values(), [](const double x) { return std::fabs(x); });
+
+    // Maximum of zero and the absolute values.
+    result.value = std::max(result.value, 0.0);
 
-    return UDQSet::scalar("NORMI", std::accumulate( defined_values.begin(), defined_values.end(), 0.0,
-                                                    [](double x, double y) { return std::max(x, std::fabs(y)); }));
+    return scalarOrEmpty("NORMI", result);
 }
 
 UDQSet UDQScalarFunction::NORM1(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("NORM1");
-    }
-
-    return UDQSet::scalar("NORM1", std::accumulate( defined_values.begin(), defined_values.end(), 0.0,
-                                                    [](double x, double y) { return x + std::fabs(y); }));
+    return scalarOrEmpty("NORM1", sumDefined(arg.values(), [](const double x) { return std::fabs(x); }));
 }
 
 UDQSet UDQScalarFunction::NORM2(const UDQSet& arg)
 {
-    auto defined_values = arg.defined_values();
-    if (defined_values.empty()) {
-        return UDQSet::empty("NORM2");
-    }
+    auto result = sumDefined(arg.values(), [](const double x) { return x * x; });
+    result.value = std::sqrt(result.value);
 
-    return UDQSet::scalar("NORM2", std::sqrt(std::inner_product(defined_values.begin(), defined_values.end(),
-                                                                defined_values.begin(), 0.0)));
+    return scalarOrEmpty("NORM2", result);
 }
 
 UDQUnaryElementalFunction::UDQUnaryElementalFunction(const std::string&name, std::function<UDQSet(const UDQSet& arg)> f)
@@ -198,9 +252,8 @@ UDQSet UDQUnaryElementalFunction::ABS(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        auto& udq_value = result[index];
-        if (udq_value) {
-            result.assign(index, std::fabs(udq_value.get()));
+        if (const auto udq_value = arg.value(index); udq_value.has_value()) {
+            result.assign(index, std::fabs(*udq_value));
         }
     }
 
@@ -211,8 +264,7 @@ UDQSet UDQUnaryElementalFunction::DEF(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); ++index) {
-        const auto& udq_value = result[index];
-        if (udq_value) {
+        if (arg.defined(index)) {
             result.assign(index, 1);
         }
     }
@@ -224,9 +276,8 @@ UDQSet UDQUnaryElementalFunction::UNDEF(const UDQSet& arg)
 {
     UDQSet result(arg.name(), arg.size());
     for (std::size_t index=0; index < result.size(); ++index) {
-        const auto& udq_value = arg[index];
-        if (!udq_value) {
-            result.assign( index, 1 );
+        if (! arg.defined(index)) {
+            result.assign(index, 1);
         }
     }
 
@@ -237,7 +288,7 @@ UDQSet UDQUnaryElementalFunction::IDV(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        result.assign(index, arg[index].defined());
+        result.assign(index, arg.defined(index));
     }
 
     return result;
@@ -247,8 +298,8 @@ UDQSet UDQUnaryElementalFunction::EXP(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (const auto& udq_value = result[index]; udq_value) {
-            result.assign(index, std::exp(udq_value.get()));
+        if (const auto udq_value = arg.value(index); udq_value.has_value()) {
+            result.assign(index, std::exp(*udq_value));
         }
     }
 
@@ -259,8 +310,8 @@ UDQSet UDQUnaryElementalFunction::NINT(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (const auto& udq_value = result[index]; udq_value) {
-            result.assign(index, std::nearbyint(udq_value.get()));
+        if (const auto udq_value = arg.value(index); udq_value.has_value()) {
+            result.assign(index, std::nearbyint(*udq_value));
         }
     }
 
@@ -272,7 +323,7 @@ UDQSet UDQUnaryElementalFunction::RANDN(std::mt19937& rng, const UDQSet& arg)
     auto result = arg;
     std::normal_distribution<double> dist(0.0, 1.0);
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (const auto& udq_value = result[index]; udq_value) {
+        if (arg.defined(index)) {
             result.assign(index, dist(rng));
         }
     }
@@ -285,7 +336,7 @@ UDQSet UDQUnaryElementalFunction::RANDU(std::mt19937& rng, const UDQSet& arg)
     auto result = arg;
     std::uniform_real_distribution<double> dist(-1.0, 1.0);
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (const auto& udq_value = result[index]; udq_value) {
+        if (arg.defined(index)) {
             result.assign(index, dist(rng));
         }
     }
@@ -297,8 +348,8 @@ UDQSet UDQUnaryElementalFunction::LN(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto& udq_value = result[index]; udq_value) {
-            if (const double elm = udq_value.get(); elm > 0.0) {
+        if (const auto udq_value = arg.value(index); udq_value.has_value()) {
+            if (const double elm = *udq_value; elm > 0.0) {
                 result.assign(index, std::log(elm));
             }
             else {
@@ -316,8 +367,8 @@ UDQSet UDQUnaryElementalFunction::LOG(const UDQSet& arg)
 {
     auto result = arg;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto& udq_value = result[index]; udq_value) {
-            if (const double elm = udq_value.get(); elm > 0.0) {
+        if (const auto udq_value = arg.value(index); udq_value.has_value()) {
+            if (const double elm = *udq_value; elm > 0.0) {
                 result.assign(index, std::log10(elm));
             }
             else {
@@ -343,53 +394,100 @@ namespace {
 
         UDQSet result = arg1;
         for (std::size_t index = 0; index < result.size(); ++index) {
-            const auto& elm1 = arg1[index];
-            const auto& elm2 = arg2[index];
-            if (elm1.defined() != elm2.defined()) {
-                if (elm1) {
-                    result.assign(index, elm1.get());
-                }
-
-                if (elm2) {
-                    result.assign(index, elm2.get());
-                }
+            if (! arg1.defined(index) && arg2.defined(index)) {
+                result.assign(index, arg2.value(index));
             }
         }
 
         return result;
     }
 
+    // Key of a defined element in a sort.  Ties are broken by element
+    // index so the resulting order does not depend on the sort algorithm.
+    struct SortKey
+    {
+        double value;
+        std::size_t index;
+    };
+
+    // Sets of at least this many defined elements are sorted in parallel.
+    constexpr std::size_t parallelSortThreshold = std::size_t{1} << 15;
+
+    template <typename Less>
+    void sortKeys(std::vector<SortKey>& keys, const Less& less)
+    {
+#ifdef _OPENMP
+        const auto numChunks = static_cast<std::size_t>(omp_get_max_threads());
+#else
+        const auto numChunks = std::size_t{1};
+#endif
+
+        if ((numChunks < 2) || (keys.size() < parallelSortThreshold)) {
+            std::sort(keys.begin(), keys.end(), less);
+            return;
+        }
+
+        // Sort equal sized chunks concurrently, then merge pairs of
+        // adjacent runs until a single run remains.
+        auto bounds = std::vector<std::size_t>(numChunks + 1);
+        for (auto c = 0*numChunks; c <= numChunks; ++c) {
+            bounds[c] = (c * keys.size()) / numChunks;
+        }
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t c = 0; c < static_cast<std::int64_t>(numChunks); ++c) {
+            std::sort(keys.begin() + bounds[c], keys.begin() + bounds[c + 1], less);
+        }
+
+        for (auto width = std::size_t{1}; width < numChunks; width *= 2) {
+            const auto numMerges = static_cast<std::int64_t>((numChunks + 2*width - 1) / (2*width));
+
+#pragma omp parallel for schedule(static)
+            for (std::int64_t m = 0; m < numMerges; ++m) {
+                const auto first = 2 * width * static_cast<std::size_t>(m);
+                const auto middle = std::min(first + width, numChunks);
+                const auto last = std::min(first + 2*width, numChunks);
+
+                if (middle < last) {
+                    std::inplace_merge(keys.begin() + bounds[first],
+                                       keys.begin() + bounds[middle],
+                                       keys.begin() + bounds[last], less);
+                }
+            }
+        }
+    }
+
 template <typename Compare>
 UDQSet sortOrder(const UDQSet& arg, Compare&& cmp)
 {
     auto result = arg;
 
-    auto ix = std::vector<int>{};
-    {
-        auto i = 0;
-        for (const auto& elm : arg) {
-            if (elm.defined()) {
-                ix.push_back(i);
-            }
+    const auto& values = arg.values();
 
-            ++i;
+    auto keys = std::vector<SortKey>{};
+    keys.reserve(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (! std::isnan(values[i])) {
+            keys.push_back({ values[i], i });
         }
     }
 
-    if (ix.empty()) {
+    if (keys.empty()) {
         // No defined values in UDQ set 'arg'.  Nothing to do.
         return result;
     }
 
-    std::sort(ix.begin(), ix.end(), [&arg, cmp = std::forward<Compare>(cmp)]
-              (const int i1, const int i2)
+    sortKeys(keys, [&cmp](const SortKey& k1, const SortKey& k2)
     {
-        return cmp(*arg[i1].value(), *arg[i2].value());
+        if (cmp(k1.value, k2.value)) { return true; }
+        if (cmp(k2.value, k1.value)) { return false; }
+
+        return k1.index < k2.index;
     });
 
     auto sort_value = 1.0;
-    for (const auto& i : ix) {
-        result.assign(i, sort_value++);
+    for (const auto& key : keys) {
+        result.assign(key.index, sort_value++);
     }
 
     return result;
@@ -425,8 +523,8 @@ UDQSet UDQBinaryFunction::LE(double eps, const UDQSet& lhs, const UDQSet& rhs)
     auto rel_diff = result / lhs;
 
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto elm = result[index]; elm) {
-            if (const double abs_diff = elm.get(); abs_diff == 0) {
+        if (const auto elm = result.value(index); elm.has_value()) {
+            if (const double abs_diff = *elm; abs_diff == 0) {
                 result.assign(index, 1);
             }
             else {
@@ -444,8 +542,8 @@ UDQSet UDQBinaryFunction::GE(double eps, const UDQSet& lhs, const UDQSet& rhs)
     auto rel_diff = result / lhs;
 
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto elm = result[index]; elm) {
-            if (const double abs_diff = elm.get(); abs_diff == 0) {
+        if (const auto elm = result.value(index); elm.has_value()) {
+            if (const double abs_diff = *elm; abs_diff == 0) {
                 result.assign(index, 1);
             }
             else {
@@ -463,8 +561,8 @@ UDQSet UDQBinaryFunction::EQ(double eps, const UDQSet& lhs, const UDQSet& rhs)
     auto rel_diff = result / lhs;
 
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto elm = result[index]; elm) {
-            if (const double abs_diff = elm.get(); abs_diff == 0) {
+        if (const auto elm = result.value(index); elm.has_value()) {
+            if (const double abs_diff = *elm; abs_diff == 0) {
                 result.assign(index, 1);
             }
             else {
@@ -480,8 +578,8 @@ UDQSet UDQBinaryFunction::NE(double eps, const UDQSet& lhs, const UDQSet& rhs)
 {
     auto result = UDQBinaryFunction::EQ(eps, lhs, rhs);
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto elm = result[index]; elm) {
-            result.assign(index, 1 - elm.get());
+        if (const auto elm = result.value(index); elm.has_value()) {
+            result.assign(index, 1 - *elm);
         }
     }
 
@@ -493,8 +591,8 @@ UDQSet UDQBinaryFunction::GT(const UDQSet& lhs, const UDQSet& rhs)
     auto result = lhs - rhs;
 
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto elm = result[index]; elm) {
-            result.assign(index, elm.get() > 0.0);
+        if (const auto elm = result.value(index); elm.has_value()) {
+            result.assign(index, *elm > 0.0);
         }
     }
 
@@ -506,8 +604,8 @@ UDQSet UDQBinaryFunction::LT(const UDQSet& lhs, const UDQSet& rhs)
     auto result = lhs - rhs;
 
     for (std::size_t index = 0; index < result.size(); ++index) {
-        if (auto elm = result[index]; elm) {
-            result.assign(index, elm.get() < 0.0);
+        if (const auto elm = result.value(index); elm.has_value()) {
+            result.assign(index, *elm < 0.0);
         }
     }
 
@@ -523,11 +621,8 @@ UDQSet UDQBinaryFunction::UADD(const UDQSet& lhs, const UDQSet& rhs)
 {
     UDQSet result = udq_union(lhs,rhs);
     for (std::size_t index = 0; index < lhs.size(); ++index) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm) {
-            result.assign(index, rhs_elm.get() + lhs_elm.get());
+        if (lhs.defined(index) && rhs.defined(index)) {
+            result.assign(index, rhs.values()[index] + lhs.values()[index]);
         }
     }
 
@@ -538,11 +633,8 @@ UDQSet UDQBinaryFunction::UMUL(const UDQSet& lhs, const UDQSet& rhs)
 {
     UDQSet result = udq_union(lhs, rhs);
     for (std::size_t index = 0; index < lhs.size(); ++index) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm) {
-            result.assign(index, rhs_elm.get() * lhs_elm.get());
+        if (lhs.defined(index) && rhs.defined(index)) {
+            result.assign(index, rhs.values()[index] * lhs.values()[index]);
         }
     }
 
@@ -553,11 +645,8 @@ UDQSet UDQBinaryFunction::UMIN(const UDQSet& lhs, const UDQSet& rhs)
 {
     UDQSet result = udq_union(lhs, rhs);
     for (std::size_t index = 0; index < lhs.size(); ++index) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm) {
-            result.assign(index, std::min(rhs_elm.get(), lhs_elm.get()));
+        if (lhs.defined(index) && rhs.defined(index)) {
+            result.assign(index, std::min(rhs.values()[index], lhs.values()[index]));
         }
     }
 
@@ -568,11 +657,8 @@ UDQSet UDQBinaryFunction::UMAX(const UDQSet& lhs, const UDQSet& rhs)
 {
     UDQSet result = udq_union(lhs, rhs);
     for (std::size_t index = 0; index < lhs.size(); ++index) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm) {
-            result.assign(index, std::max(rhs_elm.get(), lhs_elm.get()));
+        if (lhs.defined(index) && rhs.defined(index)) {
+            result.assign(index, std::max(rhs.values()[index], lhs.values()[index]));
         }
     }
 
@@ -596,13 +682,16 @@ UDQSet UDQBinaryFunction::DIV(const UDQSet& lhs, const UDQSet& rhs)
 
 UDQSet UDQBinaryFunction::POW(const UDQSet& lhs, const UDQSet& rhs)
 {
+    if (rhs.size() < lhs.size()) {
+        throw std::out_of_range {
+            "Exponent UDQ set smaller than base in function POW"
+        };
+    }
+
     UDQSet result = lhs;
     for (std::size_t index = 0; index < result.size(); ++index) {
-        auto& lhs_elm = lhs[index];
-        auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm) {
-            result.assign(index, std::pow(lhs_elm.get(), rhs_elm.get()));
+        if (lhs.defined(index) && rhs.defined(index)) {
+            result.assign(index, std::pow(lhs.values()[index], rhs.values()[index]));
         }
     }
 
@@ -0,0 +1,346 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+
+    constexpr double undefined = std::numeric_limits<double>::quiet_NaN();
+
+    // Same rule as UDQScalar::assign(): non-finite values are undefined.
+    double normalise(const double value)
+    {
+        return std::isfinite(value) ? value : undefined;
+    }
+
+    void normalise(std::vector<double>& values)
+    {
+        for (auto& value : values) {
+            value = normalise(value);
+        }
+    }
+
+    // Binary operators are only compiled when the token text is the one
+    // registered in the default function table.  Anything else is left to
+    // UDQASTNode::eval() which reports unknown functions.
+    bool is_arithmetic(const Opm::UDQTokenType type, const std::string& text)
+    {
+        switch (type) {
+        case Opm::UDQTokenType::binary_op_add: return text == "+";
+        case Opm::UDQTokenType::binary_op_sub: return text == "-";
+        case Opm::UDQTokenType::binary_op_mul: return text == "*";
+        case Opm::UDQTokenType::binary_op_div: return text == "/";
+        default: return false;
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+struct UDQProgram::Register
+{
+    bool scalar{true};
+    double value{undefined};
+    std::vector<double> values{};
+};
+
+namespace {
+
+    template <typename Op, typename Register>
+    bool apply(Register& lhs, Register& rhs, Op op)
+    {
+        if (lhs.scalar && rhs.scalar) {
+            lhs.value = normalise(op(lhs.value, rhs.value));
+            return true;
+        }
+
+        // Combining an undefined scalar with a well vector is an error in
+        // udq_cast().  Leave it to the expression tree to report it.
+        if ((lhs.scalar && std::isnan(lhs.value)) ||
+            (rhs.scalar && std::isnan(rhs.value)))
+        {
+            return false;
+        }
+
+        if (lhs.scalar) {
+            for (auto& value : rhs.values) {
+                value = normalise(op(lhs.value, value));
+            }
+
+            lhs.scalar = false;
+            lhs.values.swap(rhs.values);
+            return true;
+        }
+
+        if (rhs.scalar) {
+            for (auto& value : lhs.values) {
+                value = normalise(op(value, rhs.value));
+            }
+
+            return true;
+        }
+
+        const auto n = lhs.values.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            lhs.values[i] = normalise(op(lhs.values[i], rhs.values[i]));
+        }
+
+        return true;
+    }
+
+} // Anonymous namespace
+
+std::shared_ptr<const UDQProgram>
+UDQProgram::compile(const UDQASTNode& ast, const UDQVarType var_type)
+{
+    if (var_type != UDQVarType::WELL_VAR) {
+        return {};
+    }
+
+    auto program = std::make_shared<UDQProgram>();
+    if (! program->compile_node(ast, 0)) {
+        return {};
+    }
+
+    return program;
+}
+
+bool UDQProgram::compile_node(const UDQASTNode& node, const std::size_t depth)
+{
+    this->stack_depth_ = std::max(this->stack_depth_, depth + 1);
+
+    auto sign = node.sign;
+
+    if (node.type == UDQTokenType::number) {
+        auto& instr = this->code_.emplace_back();
+        instr.op = OpCode::Number;
+        instr.value = std::get<double>(node.value) * sign;
+        sign = 1.0;
+    }
+    else if (node.type == UDQTokenType::ecl_expr) {
+        const auto& name = std::get<std::string>(node.value);
+        const auto data_type = UDQ::targetType(name);
+
+        if (data_type == UDQVarType::WELL_VAR) {
+            if (node.selector.empty()) {
+                auto& instr = this->code_.emplace_back();
+                instr.op = OpCode::WellVar;
+                instr.var = this->add_string(name);
+            }
+            else if (node.selector.front().find('*') == std::string::npos) {
+                auto& instr = this->code_.emplace_back();
+                instr.op = OpCode::SingleWellVar;
+                instr.var = this->add_string(name);
+                instr.well = this->add_string(node.selector.front());
+            }
+            else {
+                return false;
+            }
+        }
+        else if (data_type == UDQVarType::FIELD_VAR) {
+            auto& instr = this->code_.emplace_back();
+            instr.op = OpCode::FieldVar;
+            instr.var = this->add_string(name);
+        }
+        else if ((data_type == UDQVarType::TABLE_LOOKUP) &&
+                 (node.selector.size() == 1) &&
+                 (UDQ::targetType(node.selector.front()) == UDQVarType::WELL_VAR))
+        {
+            auto& load = this->code_.emplace_back();
+            load.op = OpCode::WellVar;
+            load.var = this->add_string(node.selector.front());
+
+            auto& instr = this->code_.emplace_back();
+            instr.op = OpCode::TableLookup;
+            instr.var = this->add_string(name);
+        }
+        else {
+            return false;
+        }
+    }
+    else if (std::holds_alternative<std::string>(node.value) &&
+             is_arithmetic(node.type, std::get<std::string>(node.value)))
+    {
+        if ((node.left == nullptr) || (node.right == nullptr) ||
+            ! this->compile_node(*node.left, depth) ||
+            ! this->compile_node(*node.right, depth + 1))
+        {
+            return false;
+        }
+
+        auto& instr = this->code_.emplace_back();
+        switch (node.type) {
+        case UDQTokenType::binary_op_add: instr.op = OpCode::Add; break;
+        case UDQTokenType::binary_op_sub: instr.op = OpCode::Sub; break;
+        case UDQTokenType::binary_op_mul: instr.op = OpCode::Mul; break;
+        default:                          instr.op = OpCode::Div; break;
+        }
+    }
+    else {
+        return false;
+    }
+
+    if (sign != 1.0) {
+        auto& instr = this->code_.emplace_back();
+        instr.op = OpCode::Scale;
+        instr.value = sign;
+    }
+
+    return true;
+}
+
+std::size_t UDQProgram::add_string(const std::string& s)
+{
+    auto pos = std::find(this->strings_.begin(), this->strings_.end(), s);
+    if (pos != this->strings_.end()) {
+        return std::distance(this->strings_.begin(), pos);
+    }
+
+    this->strings_.push_back(s);
+    return this->strings_.size() - 1;
+}
+
+std::optional<UDQSet> UDQProgram::eval(const UDQContext& context) const
+{
+    const auto& wells = context.wells();
+
+    auto stack = std::vector<Register>(this->stack_depth_);
+    std::size_t top = 0;
+
+    for (const auto& instr : this->code_) {
+        switch (instr.op) {
+        case OpCode::Number: {
+            auto& reg = stack[top++];
+            reg.scalar = false;
+            reg.values.assign(wells.size(), instr.value);
+            break;
+        }
+
+        case OpCode::WellVar: {
+            auto& reg = stack[top++];
+            reg.scalar = false;
+            context.get_well_vars(this->strings_[instr.var], reg.values);
+            normalise(reg.values);
+            break;
+        }
+
+        case OpCode::SingleWellVar: {
+            auto& reg = stack[top++];
+            reg.scalar = true;
+            reg.value = normalise(context.get_well_var(this->strings_[instr.well],
+                                                       this->strings_[instr.var])
+                                  .value_or(undefined));
+            break;
+        }
+
+        case OpCode::FieldVar: {
+            auto& reg = stack[top++];
+            reg.scalar = true;
+            reg.value = normalise(context.get(this->strings_[instr.var]).value_or(undefined));
+            break;
+        }
+
+        case OpCode::Scale: {
+            auto& reg = stack[top - 1];
+            if (reg.scalar) {
+                reg.value = normalise(reg.value * instr.value);
+            }
+            else {
+                for (auto& value : reg.values) {
+                    value = normalise(value * instr.value);
+                }
+            }
+            break;
+        }
+
+        case OpCode::TableLookup: {
+            // Only compiled for well vectors, see compile_node().
+            auto& reg = stack[top - 1];
+            context.get_udt(this->strings_[instr.var])(reg.values, reg.values);
+            normalise(reg.values);
+            break;
+        }
+
+        default: {
+            auto& lhs = stack[top - 2];
+            auto& rhs = stack[top - 1];
+            --top;
+
+            auto ok = false;
+            switch (instr.op) {
+            case OpCode::Add:
+                ok = apply(lhs, rhs, [](const double a, const double b) { return a + b; });
+                break;
+
+            case OpCode::Sub:
+                // Same as UDQSet::operator-=(), i.e., a + (-1*b).
+                ok = apply(lhs, rhs, [](const double a, const double b) { return a + b*(-1.0); });
+                break;
+
+            case OpCode::Mul:
+                ok = apply(lhs, rhs, [](const double a, const double b) { return a * b; });
+                break;
+
+            default:
+                ok = apply(lhs, rhs, [](const double a, const double b) { return a / b; });
+                break;
+            }
+
+            if (! ok) {
+                return std::nullopt;
+            }
+            break;
+        }
+        }
+    }
+
+    const auto& result = stack.front();
+    if (result.scalar) {
+        return UDQSet::scalar("", std::isnan(result.value)
+                              ? std::optional<double>{}
+                              : std::optional<double>{result.value});
+    }
+
+    auto set = UDQSet::wells("", wells);
+    for (std::size_t i = 0; i < result.values.size(); ++i) {
+        if (! std::isnan(result.values[i])) {
+            set.assign(i, result.values[i]);
+        }
+    }
+
+    return set;
+}
+
+} // namespace Opm
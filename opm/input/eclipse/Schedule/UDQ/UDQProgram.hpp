@@ -0,0 +1,109 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+/// Flat, stack based form of a well level UDQ DEFINE expression.
+///
+/// Compiled once from the expression tree and evaluated over dense arrays
+/// of doubles with one element per well in UDQContext::wells() order.
+/// Undefined values are represented as NaN, which the arithmetic
+/// operations propagate, and non-finite intermediate results are turned
+/// into undefined values, as in UDQScalar::assign().  The results are the
+/// same as those of UDQASTNode::eval().
+///
+/// Only the expressions which dominate large models are compiled:
+/// numbers, well vectors for all wells or for a single named well, field
+/// vectors, the arithmetic operators + - * / and user defined table (UDT)
+/// lookups of well vectors.  Tables are referenced by name index and looked
+/// up once per evaluation, and are then applied to the values of all wells
+/// in one call.  Everything else, including functions, well name patterns
+/// and lookups of other vectors, is left to UDQASTNode::eval().
+class UDQProgram
+{
+public:
+    /// Compile the expression of a DEFINE of the given variable type.
+    /// Nullptr if the expression is not supported.
+    static std::shared_ptr<const UDQProgram>
+    compile(const UDQASTNode& ast, UDQVarType var_type);
+
+    /// Evaluate the program.  Nullopt if the expression tree must be
+    /// evaluated instead, i.e., if an undefined scalar would be combined
+    /// with a well vector, which UDQASTNode::eval() reports as an error.
+    std::optional<UDQSet> eval(const UDQContext& context) const;
+
+    std::size_t size() const
+    {
+        return this->code_.size();
+    }
+
+private:
+    enum class OpCode
+    {
+        Number,          // Constant value
+        WellVar,         // Summary or UDQ vector for all wells
+        SingleWellVar,   // Summary or UDQ vector of one named well
+        FieldVar,        // Field level summary or UDQ vector
+        Add, Sub, Mul, Div,
+        Scale,           // Multiply top of stack by constant
+        TableLookup,     // Apply UDT to top of stack
+    };
+
+    struct Instruction
+    {
+        OpCode op{OpCode::Number};
+
+        // Number and Scale: the constant.
+        double value{0.0};
+
+        // Variables: index into strings_ of the variable name and, for
+        // SingleWellVar, of the well name.  TableLookup: index into
+        // strings_ of the table name.
+        std::size_t var{0};
+        std::size_t well{0};
+    };
+
+    struct Register;
+
+    std::vector<Instruction> code_{};
+    std::vector<std::string> strings_{};
+    std::size_t stack_depth_{0};
+
+    bool compile_node(const UDQASTNode& node, std::size_t depth);
+    std::size_t add_string(const std::string& s);
+};
+
+} // namespace Opm
+
+#endif // UDQ_PROGRAM_HPP
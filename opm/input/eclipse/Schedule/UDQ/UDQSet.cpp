@@ -27,6 +27,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -161,6 +163,62 @@ UDQSet::EnumeratedItems::serializationTestObject()
     return { "PROD01", std::vector<std::size_t>{ 17, 29 } };
 }
 
+struct UDQSet::Items
+{
+    std::vector<std::string> wgnames{};
+    std::vector<std::size_t> numbers{};
+
+    bool operator==(const Items& that) const
+    {
+        return (this->wgnames == that.wgnames)
+            && (this->numbers == that.numbers);
+    }
+};
+
+namespace {
+
+    constexpr double undefined = std::numeric_limits<double>::quiet_NaN();
+
+    double normalise(const double value)
+    {
+        return std::isfinite(value) ? value : undefined;
+    }
+
+    double normalise(const std::optional<double>& value)
+    {
+        return value.has_value() ? normalise(*value) : undefined;
+    }
+
+    const std::string& unnamed()
+    {
+        static const auto name = std::string{};
+        return name;
+    }
+
+} // Anonymous namespace
+
+std::shared_ptr<const UDQSet::Items> UDQSet::intern(Items&& items)
+{
+    // Evaluating a UDQ expression forms many sets for the same few
+    // collections of wells and groups, so a short list of recently used
+    // indices is sufficient.
+    constexpr auto cache_size = std::size_t{4};
+    thread_local std::shared_ptr<const Items> recent[cache_size]{};
+    thread_local std::size_t next = 0;
+
+    for (const auto& cached : recent) {
+        if ((cached != nullptr) && (*cached == items)) {
+            return cached;
+        }
+    }
+
+    auto shared = std::make_shared<const Items>(std::move(items));
+    recent[next] = shared;
+    next = (next + 1) % cache_size;
+
+    return shared;
+}
+
 const std::string& UDQSet::name() const
 {
     return this->m_name;
@@ -174,18 +232,21 @@ UDQSet::UDQSet(const std::string& name,
                const UDQVarType   var_type)
     : m_name    (name)
     , m_var_type(var_type)
-{
-    this->values.resize(1);
-}
+    , m_values  (1, undefined)
+{}
 
 UDQSet::UDQSet(const std::string&              name,
                const UDQVarType                var_type,
                const std::vector<std::string>& wgnames)
     : m_name    (name)
     , m_var_type(var_type)
+    , m_values  (wgnames.size(), undefined)
 {
-    for (const auto& wgname : wgnames)
-        this->values.emplace_back(wgname);
+    auto items = Items{};
+    items.wgnames = wgnames;
+    items.numbers.assign(wgnames.size(), 0);
+
+    this->m_items = intern(std::move(items));
 }
 
 UDQSet::UDQSet(const std::string&                  name,
@@ -194,11 +255,14 @@ UDQSet::UDQSet(const std::string&                  name,
     : m_name    (name)
     , m_var_type(var_type)
 {
+    auto index = Items{};
     for (const auto& item : items) {
-        for (const auto& number : item.numbers) {
-            this->values.emplace_back(item.name, number);
-        }
+        index.wgnames.insert(index.wgnames.end(), item.numbers.size(), item.name);
+        index.numbers.insert(index.numbers.end(), item.numbers.begin(), item.numbers.end());
     }
+
+    this->m_values.assign(index.wgnames.size(), undefined);
+    this->m_items = std::make_shared<const Items>(std::move(index));
 }
 
 UDQSet::UDQSet(const std::string& name,
@@ -206,15 +270,13 @@ UDQSet::UDQSet(const std::string& name,
                const std::size_t  size)
     : m_name    (name)
     , m_var_type(var_type)
-{
-    this->values.resize(size);
-}
+    , m_values  (size, undefined)
+{}
 
 UDQSet::UDQSet(const std::string& name, const std::size_t size)
-    : m_name(name)
-{
-    this->values.resize(size);
-}
+    : m_name  (name)
+    , m_values(size, undefined)
+{}
 
 UDQSet UDQSet::scalar(const std::string& name, const double scalar_value)
 {
@@ -305,47 +367,37 @@ UDQSet UDQSet::regions(const std::string&                  name,
 
 bool UDQSet::has(const std::string& name) const
 {
-    return std::any_of(this->values.begin(), this->values.end(),
-                       [&name](const UDQScalar& value)
-                       {
-                           return value.wgname() == name;
-                       });
+    for (std::size_t index = 0; index < this->size(); ++index) {
+        if (this->wgname(index) == name) {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 std::size_t UDQSet::size() const
 {
-    return this->values.size();
+    return this->m_values.size();
 }
 
 void UDQSet::assign(const std::string& wgname, const double value)
 {
-    bool assigned = false;
-    for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
-            udq_value.assign(value);
-            assigned = true;
-        }
-    }
-
-    if (! assigned) {
-        throw std::out_of_range {
-            fmt::format("No well/group matching: {}", wgname)
-        };
-    }
+    this->assign(wgname, std::optional<double>{value});
 }
 
 void UDQSet::assign(const std::size_t index, const std::optional<double>& value)
 {
-    this->values[index].assign(value);
+    this->m_values[index] = normalise(value);
 }
 
 void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
     bool assigned = false;
-    for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
-            udq_value.assign(value);
+    for (std::size_t index = 0; index < this->size(); ++index) {
+        if (shmatch(wgname, this->wgname(index))) {
+            this->m_values[index] = normalise(value);
             assigned = true;
         }
     }
@@ -363,9 +415,9 @@ void UDQSet::assign(const std::string&           wgname,
 {
     auto assigned = false;
 
-    for (auto& udq : this->values) {
-        if ((udq.number() == number) && shmatch(wgname, udq.wgname())) {
-            udq.assign(value);
+    for (std::size_t index = 0; index < this->size(); ++index) {
+        if ((this->number(index) == number) && shmatch(wgname, this->wgname(index))) {
+            this->m_values[index] = normalise(value);
             assigned = true;
         }
     }
@@ -379,19 +431,17 @@ void UDQSet::assign(const std::string&           wgname,
 
 void UDQSet::assign(double value)
 {
-    for (auto& v : this->values)
-        v.assign(value);
+    std::fill(this->m_values.begin(), this->m_values.end(), normalise(value));
 }
 
 void UDQSet::assign(const std::optional<double>& value)
 {
-    for (auto& v : this->values)
-        v.assign(value);
+    std::fill(this->m_values.begin(), this->m_values.end(), normalise(value));
 }
 
 void UDQSet::assign(std::size_t index, const double value)
 {
-    this->values[index].assign(value);
+    this->m_values[index] = normalise(value);
 }
 
 UDQVarType UDQSet::var_type() const
@@ -401,13 +451,11 @@ UDQVarType UDQSet::var_type() const
 
 std::vector<std::string> UDQSet::wgnames() const
 {
-    auto names = std::vector<std::string> {};
-    names.reserve(this->values.size());
-
-    std::transform(this->values.begin(), this->values.end(), std::back_inserter(names),
-                   [](const UDQScalar& value) { return value.wgname(); });
+    if (this->m_items == nullptr) {
+        return std::vector<std::string>(this->size());
+    }
 
-    return names;
+    return this->m_items->wgnames;
 }
 
 // ------------------------------------------------------------------------
@@ -418,20 +466,25 @@ void UDQSet::operator+=(const UDQSet& rhs)
         throw std::logic_error("Incompatible size in UDQSet operator+");
 
     for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] += rhs[index];
+        this->m_values[index] = normalise(this->m_values[index] + rhs.m_values[index]);
 }
 
 void UDQSet::operator+=(double rhs) {
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] += rhs;
+    for (auto& value : this->m_values)
+        value = normalise(value + rhs);
 }
 
 void UDQSet::operator-=(double rhs) {
     *(this) += (-rhs);
 }
 
-void UDQSet::operator-=(const UDQSet& rhs) {
-    *(this) += (rhs * -1.0);
+void UDQSet::operator-=(const UDQSet& rhs)
+{
+    if (this->size() != rhs.size())
+        throw std::logic_error("Incompatible size in UDQSet operator-");
+
+    for (std::size_t index = 0; index < this->size(); index++)
+        this->m_values[index] = normalise(this->m_values[index] - rhs.m_values[index]);
 }
 
 void UDQSet::operator*=(const UDQSet& rhs)
@@ -441,14 +494,14 @@ void UDQSet::operator*=(const UDQSet& rhs)
     }
 
     for (std::size_t index = 0; index < this->size(); ++index) {
-        this->values[index] *= rhs[index];
+        this->m_values[index] = normalise(this->m_values[index] * rhs.m_values[index]);
     }
 }
 
 void UDQSet::operator*=(double rhs)
 {
-    for (std::size_t index = 0; index < this->size(); ++index) {
-        this->values[index] *= rhs;
+    for (auto& value : this->m_values) {
+        value = normalise(value * rhs);
     }
 }
 
@@ -459,24 +512,25 @@ void UDQSet::operator/=(const UDQSet& rhs)
     }
 
     for (std::size_t index = 0; index < this->size(); ++index) {
-        this->values[index] /= rhs[index];
+        this->m_values[index] = normalise(this->m_values[index] / rhs.m_values[index]);
     }
 }
 
 void UDQSet::operator/=(double rhs)
 {
-    for (std::size_t index = 0; index < this->size(); ++index) {
-        this->values[index] /= rhs;
+    for (auto& value : this->m_values) {
+        value = normalise(value / rhs);
     }
 }
 
 std::vector<double> UDQSet::defined_values() const
 {
     std::vector<double> dv;
+    dv.reserve(this->size());
 
-    for (const auto& v : this->values) {
-        if (v) {
-            dv.push_back(v.get());
+    for (const auto& value : this->m_values) {
+        if (! std::isnan(value)) {
+            dv.push_back(value);
         }
     }
 
@@ -485,65 +539,92 @@ std::vector<double> UDQSet::defined_values() const
 
 std::size_t UDQSet::defined_size() const
 {
-    return std::count_if(this->values.begin(), this->values.end(),
-                         [](const UDQScalar& value)
+    return std::count_if(this->m_values.begin(), this->m_values.end(),
+                         [](const double value)
                          {
-                             return value.defined();
+                             return ! std::isnan(value);
                          });
 }
 
-const UDQScalar& UDQSet::operator[](std::size_t index) const
+bool UDQSet::defined(const std::size_t index) const
+{
+    return ! std::isnan(this->m_values[index]);
+}
+
+std::optional<double> UDQSet::value(const std::size_t index) const
+{
+    if (! this->defined(index)) {
+        return std::nullopt;
+    }
+
+    return this->m_values[index];
+}
+
+const std::string& UDQSet::wgname(const std::size_t index) const
+{
+    return (this->m_items == nullptr)
+        ? unnamed()
+        : this->m_items->wgnames[index];
+}
+
+std::size_t UDQSet::number(const std::size_t index) const
+{
+    return (this->m_items == nullptr)
+        ? std::size_t{0}
+        : this->m_items->numbers[index];
+}
+
+UDQScalar UDQSet::element(const std::size_t index) const
+{
+    auto scalar = UDQScalar { this->wgname(index), this->number(index) };
+    scalar.assign(this->m_values[index]);
+
+    return scalar;
+}
+
+UDQScalar UDQSet::operator[](std::size_t index) const
 {
     if (index >= this->size()) {
         throw std::out_of_range("Index out of range in UDQset::operator[]");
     }
 
-    return this->values[index];
+    return this->element(index);
 }
 
-const UDQScalar& UDQSet::operator[](const std::string& wgname) const
+UDQScalar UDQSet::operator[](const std::string& wgname) const
 {
-    auto value_iter = std::find_if(this->values.begin(), this->values.end(),
-                                   [&wgname](const UDQScalar& value)
-                                   {
-                                       return value.wgname() == wgname;
-                                   });
-
-    if (value_iter == this->values.end()) {
-        throw std::out_of_range("No such well/group: " + wgname);
+    for (std::size_t index = 0; index < this->size(); ++index) {
+        if (this->wgname(index) == wgname) {
+            return this->element(index);
+        }
     }
 
-    return *value_iter;
+    throw std::out_of_range("No such well/group: " + wgname);
 }
 
-const UDQScalar&
+UDQScalar
 UDQSet::operator()(const std::string& well,
                    const std::size_t  item) const
 {
-    auto value_iter = std::find_if(this->values.begin(), this->values.end(),
-                                   [&well, item](const UDQScalar& value)
-                                   {
-                                       return (value.number() == item)
-                                           && (value.wgname() == well);
-                                   });
-
-    if (value_iter == this->values.end()) {
-        throw std::out_of_range {
-            fmt::format("No such well/item: {}/{}", well, item)
-        };
+    for (std::size_t index = 0; index < this->size(); ++index) {
+        if ((this->number(index) == item) && (this->wgname(index) == well)) {
+            return this->element(index);
+        }
     }
 
-    return *value_iter;
+    throw std::out_of_range {
+        fmt::format("No such well/item: {}/{}", well, item)
+    };
 }
 
-std::vector<UDQScalar>::const_iterator UDQSet::begin() const
+UDQSet::const_iterator UDQSet::begin() const
 {
-    return this->values.begin();
+    return { this, 0 };
 }
 
-std::vector<UDQScalar>::const_iterator UDQSet::end() const
+UDQSet::const_iterator UDQSet::end() const
 {
-    return this->values.end();
+    return { this, this->size() };
 }
 
 // ----------------------------------------------------------------
@@ -659,24 +740,31 @@ std::pair<UDQSet, UDQSet> udq_cast(const UDQSet& lhs, const UDQSet& rhs)
         return { lhs, rhs };
     }
 
-    if (is_scalar(lhs)) {
-        if (rhs.var_type() == UDQVarType::WELL_VAR) {
-            return { UDQSet::wells(lhs.name(), rhs.wgnames(), lhs[0].get()), rhs };
-        }
+    // The promoted set is a copy of the other set and shares its
+    // well/group index.
+    const auto promote = [](const UDQSet& scalar, const UDQSet& layout)
+    {
+        const auto value = scalar[0].get();
 
-        if (rhs.var_type() == UDQVarType::GROUP_VAR) {
-            return { UDQSet::groups(lhs.name(), rhs.wgnames(), lhs[0].get()), rhs };
-        }
-    }
+        auto promoted = layout;
+        promoted.name(scalar.name());
+        promoted.assign(value);
 
-    if (is_scalar(rhs)) {
-        if (lhs.var_type() == UDQVarType::WELL_VAR) {
-            return { lhs, UDQSet::wells(rhs.name(), lhs.wgnames(), rhs[0].get()) };
-        }
+        return promoted;
+    };
 
-        if (lhs.var_type() == UDQVarType::GROUP_VAR) {
-            return { lhs, UDQSet::groups(rhs.name(), lhs.wgnames(), rhs[0].get()) };
-        }
+    const auto is_named = [](const UDQSet& udq_set)
+    {
+        return (udq_set.var_type() == UDQVarType::WELL_VAR)
+            || (udq_set.var_type() == UDQVarType::GROUP_VAR);
+    };
+
+    if (is_scalar(lhs) && is_named(rhs)) {
+        return { promote(lhs, rhs), rhs };
+    }
+
+    if (is_scalar(rhs) && is_named(lhs)) {
+        return { lhs, promote(rhs, lhs) };
     }
 
     throw std::logic_error {
@@ -772,10 +860,7 @@ UDQSet operator/(double lhs, const UDQSet& rhs)
     UDQSet result = rhs;
 
     for (std::size_t index = 0; index < rhs.size(); ++index) {
-        const auto& elm = rhs[index];
-        if (elm) {
-            result.assign(index, lhs / elm.get());
-        }
+        result.assign(index, lhs / rhs.values()[index]);
     }
 
     return result;
@@ -783,9 +868,23 @@ UDQSet operator/(double lhs, const UDQSet& rhs)
 
 bool UDQSet::operator==(const UDQSet& other) const
 {
-    return (this->m_name == other.m_name)
-        && (this->m_var_type == other.m_var_type)
-        && (this->values == other.values);
+    if ((this->m_name != other.m_name) ||
+        (this->m_var_type != other.m_var_type) ||
+        (this->size() != other.size()))
+    {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < this->size(); ++index) {
+        if ((this->wgname(index) != other.wgname(index)) ||
+            (this->number(index) != other.number(index)) ||
+            (this->value(index) != other.value(index)))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 std::vector<UDQSet::EnumeratedItems>
@@ -23,6 +23,8 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
 #include <cstddef>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -183,9 +185,47 @@ public:
 };
 
 
+/// Collection of UDQ values for a set of wells, groups, segments &c.
+///
+/// Element values are stored contiguously, with NaN representing undefined
+/// elements.  This is unambiguous since assigning a non-finite value to an
+/// element makes that element undefined.  The well/group names and item
+/// numbers of the elements are held in a separate, immutable index which
+/// is shared between copies of the set and between sets formed for the
+/// same well or group names.  Arithmetic on UDQ sets therefore works on
+/// plain arrays of doubles and does not copy any names.
 class UDQSet
 {
 public:
+    /// Range-for traversal support.  Dereferencing creates a UDQScalar
+    /// for the current element.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = UDQScalar;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = UDQScalar;
+
+        const_iterator() = default;
+        const_iterator(const UDQSet* set, const std::size_t index)
+            : set_(set), index_(index)
+        {}
+
+        UDQScalar operator*() const { return this->set_->element(this->index_); }
+
+        const_iterator& operator++() { ++this->index_; return *this; }
+        const_iterator operator++(int) { auto i = *this; ++this->index_; return i; }
+
+        bool operator==(const const_iterator& that) const { return this->index_ == that.index_; }
+        bool operator!=(const const_iterator& that) const { return ! (*this == that); }
+
+    private:
+        const UDQSet* set_{nullptr};
+        std::size_t index_{0};
+    };
+
     // Connections and segments.
     struct EnumeratedItems
     {
@@ -459,14 +499,14 @@ public:
     /// \param[in] index Linear index into UDQ set.  Must be in the range
     ///    0..size()-1 inclusive.  Indexing operator throws an exception if
     ///    the index is out of bounds.
-    const UDQScalar& operator[](std::size_t index) const;
+    UDQScalar operator[](std::size_t index) const;
 
     /// Access individual UDQ scalar assiociated to particular named entity
     /// (well or group).
     ///
     /// \param[in] wgname Named entity.  Indexing operator throws an
     ///    exception if no element exists for this named entity.
-    const UDQScalar& operator[](const std::string& wgname) const;
+    UDQScalar operator[](const std::string& wgname) const;
 
     /// Access individual UDQ scalar assiociated to particular named well
     /// and numbered sub-entity of that named well.
@@ -478,13 +518,44 @@ public:
     ///    segment or connection number.  Indexing operator throws an
     ///    exception if no element exists for the numbered sub-entity of
     ///    this well.
-    const UDQScalar& operator()(const std::string& well, const std::size_t item) const;
+    UDQScalar operator()(const std::string& well, const std::size_t item) const;
+
+    /// Predicate for whether or not element at particular index is defined.
+    ///
+    /// \param[in] index Linear index into UDQ set.  Must be in the range
+    ///    0..size()-1 inclusive.
+    bool defined(const std::size_t index) const;
+
+    /// Numeric value of element at particular index.  Empty optional if
+    /// the element is undefined.
+    ///
+    /// \param[in] index Linear index into UDQ set.  Must be in the range
+    ///    0..size()-1 inclusive.
+    std::optional<double> value(const std::size_t index) const;
+
+    /// Named well/group of element at particular index.  Empty string for
+    /// unnamed elements.
+    ///
+    /// \param[in] index Linear index into UDQ set.  Must be in the range
+    ///    0..size()-1 inclusive.
+    const std::string& wgname(const std::size_t index) const;
+
+    /// Numbered item, typically segment or connection, of element at
+    /// particular index.  Zero for non-numbered elements.
+    ///
+    /// \param[in] index Linear index into UDQ set.  Must be in the range
+    ///    0..size()-1 inclusive.
+    std::size_t number(const std::size_t index) const;
+
+    /// All element values in linear index order, with NaN for undefined
+    /// elements.
+    const std::vector<double>& values() const { return this->m_values; }
 
     /// Range-for traversal support (beginning of range)
-    std::vector<UDQScalar>::const_iterator begin() const;
+    const_iterator begin() const;
 
     /// Range-for traversal support (one past end of range)
-    std::vector<UDQScalar>::const_iterator end() const;
+    const_iterator end() const;
 
     /// Retrive names of entities associate to this UDQ set.
     std::vector<std::string> wgnames() const;
@@ -517,11 +588,26 @@ private:
     /// UDQ set's variable type
     UDQVarType m_var_type = UDQVarType::NONE;
 
-    /// UDQ set's element values.
-    std::vector<UDQScalar> values;
+    /// Well/group names and item numbers of the elements.
+    struct Items;
+
+    /// Shared element names and numbers.  Null if all elements are
+    /// unnamed and non-numbered, e.g., for scalars.
+    std::shared_ptr<const Items> m_items{};
+
+    /// UDQ set's element values.  NaN for undefined elements.
+    std::vector<double> m_values{};
 
     /// Default constructor.  For implementing the named constructors only.
     UDQSet() = default;
+
+    /// Shared index for a collection of well/group names.  Reuses the
+    /// index of recently formed sets with the same names.
+    static std::shared_ptr<const Items> intern(Items&& items);
+
+    /// Create UDQ scalar for element at particular index.  No bounds
+    /// checking.
+    UDQScalar element(const std::size_t index) const;
 };
 
 
@@ -25,12 +25,16 @@
 
 #include <opm/io/eclipse/rst/state.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -66,6 +70,27 @@ bool has_var(const S2Map<double>& values,
         && (res_iter->second.count(wgname) > 0);
 }
 
+void get_vars(const S2Map<double>&            values,
+              const std::string&              udq_key,
+              const std::vector<std::string>& wgnames,
+              std::vector<double>&            output)
+{
+    output.assign(wgnames.size(), std::numeric_limits<double>::quiet_NaN());
+
+    auto varPos = values.find(udq_key);
+    if (varPos == values.end()) {
+        return;
+    }
+
+    const auto& var_values = varPos->second;
+    for (std::size_t i = 0; i < wgnames.size(); ++i) {
+        auto wgPos = var_values.find(wgnames[i]);
+        if (wgPos != var_values.end()) {
+            output[i] = wgPos->second;
+        }
+    }
+}
+
 void undefine_results(const Opm::UDQScalar& result,
                       SMap<double>&         values)
 {
@@ -204,6 +229,8 @@ namespace Opm {
 
 void UDQState::load_rst(const RestartIO::RstState& rst_state)
 {
+    this->define_inputs.clear();
+
     for (const auto& udq : rst_state.udqs) {
         // Note: Cases listed in order of increasing enumerator values from
         // the UDQEnums.hpp header file (Opm::UDQVarType).
@@ -313,14 +340,59 @@ void UDQState::add(const std::string& udq_key, const UDQSet& result)
 void UDQState::add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result)
 {
     this->defines[udq_key] = report_step;
+    this->define_inputs.erase(udq_key);
     this->add(udq_key, result);
 }
 
 void UDQState::add_assign(const std::string& udq_key, const UDQSet& result)
 {
+    this->define_inputs.erase(udq_key);
     this->add(udq_key, result);
 }
 
+bool UDQState::define_inputs_unchanged(const std::string&              udq_key,
+                                       const std::string&              expression,
+                                       const std::vector<std::string>& wells,
+                                       const std::vector<std::string>& groups,
+                                       const std::vector<double>&      values) const
+{
+    auto pos = this->define_inputs.find(udq_key);
+    if (pos == this->define_inputs.end()) {
+        return false;
+    }
+
+    const auto& prev = pos->second;
+
+    return (prev.expression == expression)
+        && (prev.wells == wells)
+        && (prev.groups == groups)
+        && std::equal(prev.values.begin(), prev.values.end(),
+                      values.begin(), values.end(),
+                      [](const double a, const double b)
+                      {
+                          return (a == b) || (std::isnan(a) && std::isnan(b));
+                      });
+}
+
+void UDQState::record_define_inputs(const std::string&              udq_key,
+                                    const std::string&              expression,
+                                    const std::vector<std::string>& wells,
+                                    const std::vector<std::string>& groups,
+                                    std::vector<double>             values)
+{
+    auto& inputs = this->define_inputs[udq_key];
+
+    inputs.expression = expression;
+    inputs.wells = wells;
+    inputs.groups = groups;
+    inputs.values = std::move(values);
+}
+
+void UDQState::retain_define(const std::size_t report_step, const std::string& udq_key)
+{
+    this->defines[udq_key] = report_step;
+}
+
 double UDQState::get(const std::string& key) const
 {
     if (!is_udq(key)) {
@@ -344,6 +416,20 @@ double UDQState::get_well_var(const std::string& well, const std::string& key) c
     return get_wg(this->well_values, well, key, this->undef_value);
 }
 
+void UDQState::get_well_vars(const std::string&              var,
+                             const std::vector<std::string>& wells,
+                             std::vector<double>&            values) const
+{
+    get_vars(this->well_values, var, wells, values);
+}
+
+void UDQState::get_group_vars(const std::string&              var,
+                              const std::vector<std::string>& groups,
+                              std::vector<double>&            values) const
+{
+    get_vars(this->group_values, var, groups, values);
+}
+
 double UDQState::get_segment_var(const std::string& well,
                                  const std::string& var,
                                  const std::size_t  segment) const
@@ -28,6 +28,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Opm::RestartIO {
     struct RstState;
@@ -56,12 +57,45 @@ public:
     double get_well_var(const std::string& well, const std::string& var) const;
     double get_segment_var(const std::string& well, const std::string& var, const std::size_t segment) const;
 
+    /// Values of well level UDQ var for a sequence of wells, NaN for
+    /// wells without a value.  Resizes values to the number of wells.
+    void get_well_vars(const std::string& var,
+                       const std::vector<std::string>& wells,
+                       std::vector<double>& values) const;
+
+    /// Values of group level UDQ var for a sequence of groups, NaN for
+    /// groups without a value.  Resizes values to the number of groups.
+    void get_group_vars(const std::string& var,
+                        const std::vector<std::string>& groups,
+                        std::vector<double>& values) const;
+
     void exportSegmentUDQ(const std::string& var,
                           const std::string& well,
                           ExportRange&       output) const;
 
     void add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result);
     void add_assign(const std::string& udq_key, const UDQSet& result);
+
+    /// Whether the DEFINE of udq_key was last evaluated from the same
+    /// expression and input values, with NaN for undefined inputs.  If so
+    /// the values stored for udq_key are still current.
+    bool define_inputs_unchanged(const std::string&              udq_key,
+                                 const std::string&              expression,
+                                 const std::vector<std::string>& wells,
+                                 const std::vector<std::string>& groups,
+                                 const std::vector<double>&      values) const;
+
+    /// Record the inputs of a DEFINE just evaluated and stored with
+    /// add_define().  Not part of the restart state.
+    void record_define_inputs(const std::string&              udq_key,
+                              const std::string&              expression,
+                              const std::vector<std::string>& wells,
+                              const std::vector<std::string>& groups,
+                              std::vector<double>             values);
+
+    /// Mark a DEFINE as evaluated at report_step without changing its
+    /// values, when its inputs are unchanged.
+    void retain_define(std::size_t report_step, const std::string& udq_key);
     bool define(const std::pair<UDQUpdate, std::size_t>& update_status) const;
     double undefined_value() const;
 
@@ -78,6 +112,10 @@ public:
         serializer(this->group_values);
         serializer(this->segment_values);
         serializer(this->defines);
+
+        if (!serializer.isSerializing()) {
+            this->define_inputs.clear();
+        }
     }
 
 private:
@@ -95,6 +133,17 @@ private:
 
     std::unordered_map<std::string, std::size_t> defines{};
 
+    struct DefineInputs
+    {
+        std::string expression{};
+        std::vector<std::string> wells{};
+        std::vector<std::string> groups{};
+        std::vector<double> values{};
+    };
+
+    // [var] -> inputs of latest evaluation
+    std::unordered_map<std::string, DefineInputs> define_inputs{};
+
     void add(const std::string& udq_key, const UDQSet& result);
     double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
 };
@@ -19,10 +19,12 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
 
-#include <opm/common/utility/numeric/linearInterpolation.hpp>
-
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
 
 namespace Opm {
 
@@ -33,38 +35,127 @@ UDT::UDT(const std::vector<double>& xvals,
     , yvals_(yvals)
     , interp_type_(interp_type)
 {
+    this->setupGrid();
 }
 
-UDT UDT::serializationTestObject()
+void UDT::setupGrid()
 {
-    return UDT({1.0, 2.0}, {3.0, 4.0}, InterpolationType::NearestNeighbour);
+    this->uniform_ = false;
+
+    const auto n = this->xvals_.size();
+    if (n < 3) {
+        return;
+    }
+
+    const auto dx = (this->xvals_.back() - this->xvals_.front()) / (n - 1);
+    if (! (dx > 0.0)) {
+        return;
+    }
+
+    for (std::size_t i = 1; i < n; ++i) {
+        const auto expected = this->xvals_.front() + i*dx;
+        if (std::abs(this->xvals_[i] - expected) > 1.0e-10 * dx) {
+            return;
+        }
+    }
+
+    this->uniform_ = true;
+    this->x0_ = this->xvals_.front();
+    this->inv_dx_ = 1.0 / dx;
 }
 
-bool UDT::operator==(const UDT& rhs) const
+// Same interval as Opm::tableIndex(): the last data point less than x,
+// clamped to [0, size-2].  On uniform grids the estimate from the spacing
+// is at most one interval off due to rounding, and corrected against the
+// data points.
+std::size_t UDT::index(const double x) const
 {
-    return this->xvals_ == rhs.xvals_ &&
-           this->yvals_ == rhs.yvals_ &&
-           this->interp_type_ == rhs.interp_type_;
+    const auto n = this->xvals_.size();
+    if (n < 2) {
+        return 0;
+    }
+
+    if (! this->uniform_) {
+        const auto lower = std::lower_bound(this->xvals_.begin(), this->xvals_.end(), x);
+        if (lower == this->xvals_.begin()) {
+            return 0;
+        }
+
+        return std::min(static_cast<std::size_t>(std::distance(this->xvals_.begin(), lower)) - 1, n - 2);
+    }
+
+    const auto last = n - 2;
+    const auto t = std::floor((x - this->x0_) * this->inv_dx_);
+
+    auto i = ! (t > 0.0) ? std::size_t{0}
+        : (t >= static_cast<double>(last)) ? last
+        : static_cast<std::size_t>(t);
+
+    while ((i > 0) && ! (this->xvals_[i] < x)) {
+        --i;
+    }
+
+    while ((i < last) && (this->xvals_[i + 1] < x)) {
+        ++i;
+    }
+
+    return i;
 }
 
-double UDT::operator()(const double x) const
+double UDT::lookup(const double x) const
 {
+    const auto i = this->index(x);
+
     switch (interp_type_) {
     case InterpolationType::NearestNeighbour:
     {
-        const int idx = Opm::tableIndex(xvals_, x);
-        const double dist1 = std::abs(x - xvals_[idx]);
-        const double dist2 = std::abs(x - xvals_[idx+1]);
-        return dist1 < dist2 ? yvals_[idx] : yvals_[idx+1];
+        const double dist1 = std::abs(x - xvals_[i]);
+        const double dist2 = std::abs(x - xvals_[i+1]);
+        return dist1 < dist2 ? yvals_[i] : yvals_[i+1];
     }
     case InterpolationType::LinearClamp:
-        return linearInterpolationNoExtrapolation(xvals_, yvals_, x);
+        if (x < xvals_.front()) {
+            return yvals_.front();
+        }
+        if (x > xvals_.back()) {
+            return yvals_.back();
+        }
+        [[fallthrough]];
     case InterpolationType::LinearExtrapolate:
+    {
         // TOOD: Use std::lerp when available ?
-        return linearInterpolation(xvals_, yvals_, x);
+        const auto slope = (yvals_[i + 1] - yvals_[i]) / (xvals_[i + 1] - xvals_[i]);
+        return slope * (x - xvals_[i]) + yvals_[i];
+    }
     }
 
     assert(0); // Should be unreachable
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+UDT UDT::serializationTestObject()
+{
+    return UDT({1.0, 2.0}, {3.0, 4.0}, InterpolationType::NearestNeighbour);
+}
+
+bool UDT::operator==(const UDT& rhs) const
+{
+    return this->xvals_ == rhs.xvals_ &&
+           this->yvals_ == rhs.yvals_ &&
+           this->interp_type_ == rhs.interp_type_;
+}
+
+double UDT::operator()(const double x) const
+{
+    return this->lookup(x);
+}
+
+void UDT::operator()(const std::vector<double>& x, std::vector<double>& y) const
+{
+    y.resize(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        y[i] = std::isnan(x[i]) ? x[i] : this->lookup(x[i]);
+    }
 }
 
 } // namespace Opm
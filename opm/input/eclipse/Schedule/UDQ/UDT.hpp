@@ -20,6 +20,7 @@
 #ifndef UDT_HPP
 #define UDT_HPP
 
+#include <cstddef>
 #include <vector>
 
 namespace Opm {
@@ -45,6 +46,17 @@ public:
 
     double operator()(const double x) const;
 
+    /// Look up all of \p x at once, e.g., one value per well.  NaN
+    /// entries, i.e., undefined values, give NaN results.
+    void operator()(const std::vector<double>& x, std::vector<double>& y) const;
+
+    /// Whether the data points are equally spaced, in which case the
+    /// interval of a value is found without searching.
+    bool uniform() const
+    {
+        return this->uniform_;
+    }
+
     bool operator==(const UDT& data) const;
 
     template <class Serializer>
@@ -53,12 +65,25 @@ public:
         serializer(xvals_);
         serializer(yvals_);
         serializer(interp_type_);
+
+        if (! serializer.isSerializing()) {
+            this->setupGrid();
+        }
     }
 
 private:
     std::vector<double> xvals_; //!< Data points
     std::vector<double> yvals_; //!< Data values
     InterpolationType interp_type_ = InterpolationType::LinearClamp; //!< Interpolation type
+
+    // Uniform grid lookup, derived from xvals_.
+    bool uniform_{false};
+    double x0_{0.0};
+    double inv_dx_{0.0};
+
+    void setupGrid();
+    std::size_t index(double x) const;
+    double lookup(double x) const;
 };
 
 } // Namespace Opm
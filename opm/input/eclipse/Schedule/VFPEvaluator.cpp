@@ -0,0 +1,194 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    bool isUniform(const std::vector<double>& points)
+    {
+        const auto n = points.size();
+        const auto spacing = (points.back() - points.front()) / (n - 1);
+        if (! (spacing > 0.0)) {
+            return false;
+        }
+
+        for (std::size_t i = 1; i < n; ++i) {
+            const auto expected = points.front() + i*spacing;
+            if (std::abs(points[i] - expected) > 1.0e-6*spacing) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void checkBatchSize(const std::size_t expected,
+                        const std::size_t size,
+                        const char*       name)
+    {
+        if (size != expected) {
+            throw std::invalid_argument {
+                fmt::format("VFP evaluation: {} has {} elements, expected {}",
+                            name, size, expected)
+            };
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+VFPAxis::VFPAxis(const std::vector<double>& points)
+    : points_(points)
+{
+    if (this->points_.empty()) {
+        throw std::invalid_argument { "VFP table axis must not be empty" };
+    }
+
+    if (this->points_.size() > 2) {
+        this->uniform_ = isUniform(this->points_);
+        if (this->uniform_) {
+            this->inv_spacing_ = (this->points_.size() - 1)
+                / (this->points_.back() - this->points_.front());
+        }
+    }
+}
+
+VFPAxisBracket VFPAxis::bracket(const double x) const
+{
+    auto result = VFPAxisBracket{};
+
+    const auto n = this->points_.size();
+    if (n == 1) {
+        return result;
+    }
+
+    // Interval [i-1, i] with i the first index in 1..n-1 such that
+    // points_[i] >= x, the first interval if x is below the axis, and the
+    // last interval if x is at or above the last point.
+    std::size_t i = 1;
+    if (x >= this->points_.back()) {
+        i = n - 1;
+    }
+    else if (x >= this->points_.front()) {
+        if (this->uniform_) {
+            const auto guess = std::floor((x - this->points_.front()) * this->inv_spacing_) + 1;
+            i = std::clamp(static_cast<std::size_t>(guess), std::size_t{1}, n - 1);
+
+            // Correct for rounding and slightly non-uniform spacing.
+            while ((i > 1) && (this->points_[i - 1] >= x)) { --i; }
+            while ((i < n - 1) && (this->points_[i] < x)) { ++i; }
+        }
+        else {
+            i = std::lower_bound(this->points_.begin() + 1, this->points_.end(), x)
+                - this->points_.begin();
+        }
+    }
+
+    result.lower = i - 1;
+    result.upper = i;
+
+    const auto start = this->points_[result.lower];
+    const auto end = this->points_[result.upper];
+    if (end > start) {
+        result.inv_dist = 1.0 / (end - start);
+    }
+
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+
+VFPProdEvaluator::VFPProdEvaluator(const VFPProdTable& table)
+    : flo_ (table.getFloAxis())
+    , thp_ (table.getTHPAxis())
+    , wfr_ (table.getWFRAxis())
+    , gfr_ (table.getGFRAxis())
+    , alq_ (table.getALQAxis())
+    , data_(table.getTable())
+{
+    const auto nf = this->flo_.size();
+    const auto na = this->alq_.size();
+    const auto ng = this->gfr_.size();
+    const auto nw = this->wfr_.size();
+
+    // Same layout as VFPProdTable::operator()(t, w, g, a, f).
+    this->stride_ = { nw*ng*na*nf, ng*na*nf, na*nf, nf, 1 };
+}
+
+std::vector<double>
+VFPProdEvaluator::bhp(const std::vector<double>& flo,
+                      const std::vector<double>& thp,
+                      const std::vector<double>& wfr,
+                      const std::vector<double>& gfr,
+                      const std::vector<double>& alq) const
+{
+    const auto n = flo.size();
+    checkBatchSize(n, thp.size(), "THP");
+    checkBatchSize(n, wfr.size(), "WFR");
+    checkBatchSize(n, gfr.size(), "GFR");
+    checkBatchSize(n, alq.size(), "ALQ");
+
+    auto result = std::vector<double>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = this->bhp(flo[i], thp[i], wfr[i], gfr[i], alq[i]);
+    }
+
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+
+VFPInjEvaluator::VFPInjEvaluator(const VFPInjTable& table)
+    : flo_ (table.getFloAxis())
+    , thp_ (table.getTHPAxis())
+    , data_(table.getTable())
+{
+    // Same layout as VFPInjTable::operator()(t, f).
+    this->stride_ = { this->flo_.size(), 1 };
+}
+
+std::vector<double>
+VFPInjEvaluator::bhp(const std::vector<double>& flo,
+                     const std::vector<double>& thp) const
+{
+    const auto n = flo.size();
+    checkBatchSize(n, thp.size(), "THP");
+
+    auto result = std::vector<double>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = this->bhp(flo[i], thp[i]);
+    }
+
+    return result;
+}
+
+} // namespace Opm
@@ -0,0 +1,240 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_EVALUATOR_HPP
+#define OPM_VFP_EVALUATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Opm {
+
+class VFPInjTable;
+class VFPProdTable;
+
+/// Interpolation interval of a value along one axis of a VFP table.
+struct VFPAxisBracket
+{
+    /// Index of the lower axis point of the interval.
+    std::size_t lower{0};
+
+    /// Index of the upper axis point of the interval.  Equal to lower if
+    /// the axis has a single point.
+    std::size_t upper{0};
+
+    /// Inverse length of the interval, zero for an empty interval.
+    double inv_dist{0.0};
+};
+
+/// One axis of a VFP table with a precomputed interval search.
+///
+/// Values below the first or above the last axis point select the first
+/// or last interval, i.e., the tables are extrapolated linearly.  For
+/// axes with (nearly) uniform spacing the interval is computed directly
+/// and corrected against the axis points, otherwise it is found by binary
+/// search.  Either way the interval is the same as the one found by a
+/// linear search from the start of the axis.
+class VFPAxis
+{
+public:
+    VFPAxis() = default;
+    explicit VFPAxis(const std::vector<double>& points);
+
+    /// Interpolation interval of \p x.
+    VFPAxisBracket bracket(double x) const;
+
+    /// Relative position of \p x within \p bracket, i.e., zero at the
+    /// lower and one at the upper axis point.  Works for plain doubles
+    /// and for automatic differentiation types such as
+    /// DenseAd::Evaluation, for which the derivatives of \p x carry over.
+    template <class Evaluation>
+    Evaluation factor(const Evaluation& x, const VFPAxisBracket& bracket) const
+    {
+        return (x - this->points_[bracket.lower]) * bracket.inv_dist;
+    }
+
+    std::size_t size() const
+    {
+        return this->points_.size();
+    }
+
+private:
+    std::vector<double> points_{};
+    bool uniform_{false};
+    double inv_spacing_{0.0};
+};
+
+namespace VFPEvaluatorDetail {
+
+    template <class Evaluation>
+    double scalarValue(const Evaluation& x)
+    {
+        if constexpr (std::is_arithmetic_v<Evaluation>) {
+            return static_cast<double>(x);
+        }
+        else {
+            return x.value();
+        }
+    }
+
+    /// Multilinear interpolation in a dense table with the last dimension
+    /// stored contiguously.
+    template <std::size_t D, class Evaluation>
+    Evaluation interpolate(const std::vector<double>&           data,
+                           const std::array<std::size_t, D>&    stride,
+                           const std::array<VFPAxisBracket, D>& brackets,
+                           const std::array<Evaluation, D>&     factors)
+    {
+        constexpr std::size_t numCorners = std::size_t{1} << D;
+
+        // The last dimension is the least significant bit of the corner
+        // number, so the pairs reduced first are adjacent in the table.
+        std::array<Evaluation, numCorners> values;
+        for (std::size_t corner = 0; corner < numCorners; ++corner) {
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < D; ++d) {
+                const bool upper = (corner >> (D - 1 - d)) & 1;
+                offset += stride[d] * (upper ? brackets[d].upper : brackets[d].lower);
+            }
+
+            values[corner] = data[offset];
+        }
+
+        auto num = numCorners;
+        for (std::size_t d = D; d-- > 0;) {
+            num /= 2;
+            for (std::size_t i = 0; i < num; ++i) {
+                values[i] = (1.0 - factors[d])*values[2*i] + factors[d]*values[2*i + 1];
+            }
+        }
+
+        return values[0];
+    }
+
+} // namespace VFPEvaluatorDetail
+
+/// Bottom hole pressure from a VFPPROD table.
+///
+/// Multilinear interpolation, and linear extrapolation outside the table,
+/// in the THP, WFR, GFR, ALQ and flow rate axes.  The evaluator keeps its
+/// own copy of the table, so it remains valid if the table is destroyed,
+/// and is safe for concurrent use.
+class VFPProdEvaluator
+{
+public:
+    explicit VFPProdEvaluator(const VFPProdTable& table);
+
+    /// Bottom hole pressure for a single well.  All arguments in SI
+    /// units, as in the table's axes.  With automatic differentiation
+    /// types the result holds the derivatives with respect to the same
+    /// variables as the arguments.
+    template <class Evaluation>
+    Evaluation bhp(const Evaluation& flo,
+                   const Evaluation& thp,
+                   const Evaluation& wfr,
+                   const Evaluation& gfr,
+                   const Evaluation& alq) const
+    {
+        using VFPEvaluatorDetail::scalarValue;
+
+        const auto brackets = std::array {
+            this->thp_.bracket(scalarValue(thp)),
+            this->wfr_.bracket(scalarValue(wfr)),
+            this->gfr_.bracket(scalarValue(gfr)),
+            this->alq_.bracket(scalarValue(alq)),
+            this->flo_.bracket(scalarValue(flo)),
+        };
+
+        const auto factors = std::array<Evaluation, 5> {
+            this->thp_.factor(thp, brackets[0]),
+            this->wfr_.factor(wfr, brackets[1]),
+            this->gfr_.factor(gfr, brackets[2]),
+            this->alq_.factor(alq, brackets[3]),
+            this->flo_.factor(flo, brackets[4]),
+        };
+
+        return VFPEvaluatorDetail::interpolate(this->data_, this->stride_, brackets, factors);
+    }
+
+    /// Bottom hole pressures for many wells.  All arguments must have the
+    /// same size, and element i of the result is the bottom hole pressure
+    /// for element i of the arguments.
+    std::vector<double> bhp(const std::vector<double>& flo,
+                            const std::vector<double>& thp,
+                            const std::vector<double>& wfr,
+                            const std::vector<double>& gfr,
+                            const std::vector<double>& alq) const;
+
+private:
+    VFPAxis flo_{};
+    VFPAxis thp_{};
+    VFPAxis wfr_{};
+    VFPAxis gfr_{};
+    VFPAxis alq_{};
+
+    std::array<std::size_t, 5> stride_{};
+    std::vector<double> data_{};
+};
+
+/// Bottom hole pressure from a VFPINJ table.
+///
+/// Bilinear interpolation, and linear extrapolation outside the table, in
+/// the THP and flow rate axes.  See VFPProdEvaluator.
+class VFPInjEvaluator
+{
+public:
+    explicit VFPInjEvaluator(const VFPInjTable& table);
+
+    /// Bottom hole pressure for a single well.  See VFPProdEvaluator.
+    template <class Evaluation>
+    Evaluation bhp(const Evaluation& flo,
+                   const Evaluation& thp) const
+    {
+        using VFPEvaluatorDetail::scalarValue;
+
+        const auto brackets = std::array {
+            this->thp_.bracket(scalarValue(thp)),
+            this->flo_.bracket(scalarValue(flo)),
+        };
+
+        const auto factors = std::array<Evaluation, 2> {
+            this->thp_.factor(thp, brackets[0]),
+            this->flo_.factor(flo, brackets[1]),
+        };
+
+        return VFPEvaluatorDetail::interpolate(this->data_, this->stride_, brackets, factors);
+    }
+
+    /// Bottom hole pressures for many wells.  See VFPProdEvaluator.
+    std::vector<double> bhp(const std::vector<double>& flo,
+                            const std::vector<double>& thp) const;
+
+private:
+    VFPAxis flo_{};
+    VFPAxis thp_{};
+
+    std::array<std::size_t, 2> stride_{};
+    std::vector<double> data_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_VFP_EVALUATOR_HPP
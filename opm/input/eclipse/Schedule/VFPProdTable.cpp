@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -181,7 +182,8 @@ VFPProdTable VFPProdTable::serializationTestObject()
   If the gaslift_opt flag is set to true the ALQ_TYPE item will default to GRAT.
 */
 
-VFPProdTable::VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, const UnitSystem& deck_unit_system) :
+VFPProdTable::VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, const UnitSystem& deck_unit_system,
+                            std::vector<std::string>* warnings) :
     m_location(table.location())
 {
     using ParserKeywords::VFPPROD;
@@ -322,13 +324,16 @@ VFPProdTable::VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, c
                                        this->m_location.filename, this->m_location.lineno,
                                        t,w,g,a,bhp_tht[f]);
 
-                OpmLog::warning(msg);
+                if (warnings != nullptr)
+                    warnings->push_back(std::move(msg));
+                else
+                    OpmLog::warning(msg);
             }
             (*this)(t,w,g,a,f) = table_scaling_factor*bhp_tht[f];
         }
     }
 
-    check();
+    check(warnings);
 }
 
 
@@ -347,7 +352,7 @@ void check_axis(const std::vector<double>& axis) {
 }
 
 
-void VFPProdTable::check() {
+void VFPProdTable::check(std::vector<std::string>* warnings) {
     if (this->m_table_num <= 0)
         throw std::invalid_argument(fmt::format("Invalid table number: {}", this->m_table_num));
 
@@ -397,13 +402,18 @@ void VFPProdTable::check() {
 
     if (error_count > 0) {
         const auto& location = this->m_location;
-        OpmLog::warning(fmt::format("VFPPROD table {0} has {1} non-monotonic points of BHP(THP)\n"
-                                    "In {2} line {3}\n"
-                                    "This may cause convergence issues due to switching between BHP and THP control.\n",
-                                    m_table_num,
-                                    error_count,
-                                    location.filename,
-                                    location.lineno));
+        auto msg = fmt::format("VFPPROD table {0} has {1} non-monotonic points of BHP(THP)\n"
+                               "In {2} line {3}\n"
+                               "This may cause convergence issues due to switching between BHP and THP control.\n",
+                               m_table_num,
+                               error_count,
+                               location.filename,
+                               location.lineno);
+
+        if (warnings != nullptr)
+            warnings->push_back(std::move(msg));
+        else
+            OpmLog::warning(msg);
     }
 }
 
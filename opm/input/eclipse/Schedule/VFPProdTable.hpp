@@ -22,6 +22,7 @@
 
 
 #include <array>
+#include <string>
 #include <vector>
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
@@ -67,7 +68,10 @@ public:
     };
 
     VFPProdTable();
-    VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, const UnitSystem& deck_unit_system);
+    /// If \p warnings is non-null, warnings about suspicious table
+    /// values are appended to it instead of being logged.
+    VFPProdTable( const DeckKeyword& table, bool gaslift_opt_active, const UnitSystem& deck_unit_system,
+                  std::vector<std::string>* warnings = nullptr);
     VFPProdTable(int table_num,
                  double datum_depth,
                  FLO_TYPE flo_type,
@@ -196,7 +200,7 @@ private:
     std::vector<double> m_data;
     KeywordLocation m_location;
 
-    void check();
+    void check(std::vector<std::string>* warnings = nullptr);
 
     double& operator()(size_t thp_idx, size_t wfr_idx, size_t gfr_idx, size_t alq_idx, size_t flo_idx);
 
@@ -0,0 +1,337 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/VFPTableCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Parser/InputFileManifest.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/V.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace {
+
+const std::string snapshot_magic = "OPM_VFP_SNAPSHOT";
+
+const Opm::Serialization::MemPacker packer{};
+
+// The Serializer keeps its buffer to itself; expose it so that the
+// serialized data can be written to and read from file.
+class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+{
+public:
+    BufferSerializer()
+        : Opm::Serializer<Opm::Serialization::MemPacker>(packer)
+    {}
+
+    std::vector<char>& buffer()
+    {
+        return this->m_buffer;
+    }
+};
+
+std::optional<std::uint64_t> fileHash(const std::string& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+        return {};
+
+    const std::string content { std::istreambuf_iterator<char>(stream),
+                                std::istreambuf_iterator<char>() };
+    if (stream.bad())
+        return {};
+
+    return Opm::InputFileManifest::hash(content);
+}
+
+template <class Table>
+bool loadSnapshot(const std::filesystem::path& snapshot,
+                  const std::string& key,
+                  Table& table,
+                  std::vector<std::string>& warnings)
+{
+    try {
+        std::ifstream stream(snapshot, std::ios::binary);
+        if (!stream)
+            return false;
+
+        const auto snapshot_size = std::filesystem::file_size(snapshot);
+
+        std::uint64_t header_size = 0;
+        stream.read(reinterpret_cast<char*>(&header_size), sizeof header_size);
+        if (!stream || (header_size > snapshot_size - sizeof header_size))
+            return false;
+
+        BufferSerializer header;
+        header.buffer().resize(header_size);
+        stream.read(header.buffer().data(), header_size);
+        if (!stream)
+            return false;
+
+        std::string magic;
+        int snapshot_version = 0;
+        std::string snapshot_key;
+        header.unpack(magic, snapshot_version, snapshot_key);
+
+        if ((magic != snapshot_magic) ||
+            (snapshot_version != Opm::VFPTableCache::version) ||
+            (snapshot_key != key))
+            return false;
+
+        BufferSerializer body;
+        body.buffer().assign(std::istreambuf_iterator<char>(stream),
+                             std::istreambuf_iterator<char>());
+
+        Table snapshot_table;
+        std::vector<std::string> snapshot_warnings;
+        body.unpack(snapshot_table, snapshot_warnings);
+
+        table = std::move(snapshot_table);
+        warnings = std::move(snapshot_warnings);
+        return true;
+    }
+    catch (const std::exception&) {
+        // Truncated or otherwise corrupt snapshot.
+        return false;
+    }
+}
+
+// Existing snapshots are replaced atomically, so that concurrent
+// processes sharing the directory always see a complete snapshot.  Runs
+// concurrently for different tables, so failures are silently ignored.
+template <class Table>
+void storeSnapshot(const std::filesystem::path& snapshot,
+                   const std::string& key,
+                   const Table& table,
+                   const std::vector<std::string>& warnings)
+{
+    const auto tmp = std::filesystem::path {
+        Opm::unique_path(snapshot.string() + ".%%%%-%%%%.tmp")
+    };
+
+    try {
+        BufferSerializer header;
+        header.pack(snapshot_magic, Opm::VFPTableCache::version, key);
+
+        BufferSerializer body;
+        body.pack(table, warnings);
+
+        std::filesystem::create_directories(snapshot.parent_path());
+        {
+            std::ofstream stream(tmp, std::ios::binary);
+            const std::uint64_t header_size = header.buffer().size();
+            stream.write(reinterpret_cast<const char*>(&header_size), sizeof header_size);
+            stream.write(header.buffer().data(), header.buffer().size());
+            stream.write(body.buffer().data(), body.buffer().size());
+            if (!stream)
+                throw std::runtime_error("Write error");
+        }
+
+        std::filesystem::rename(tmp, snapshot);
+    }
+    catch (const std::exception&) {
+        std::error_code ec;
+        std::filesystem::remove(tmp, ec);
+    }
+}
+
+// Table of a single keyword, loaded from its snapshot if there is one and
+// otherwise built and stored.  False if the table could not be built.
+template <class Table, class Build>
+bool loadOrBuild(const std::optional<std::filesystem::path>& snapshot,
+                 const std::string& key,
+                 Table& table,
+                 std::vector<std::string>& warnings,
+                 Build&& build)
+{
+    if (snapshot.has_value() && loadSnapshot(*snapshot, key, table, warnings))
+        return true;
+
+    try {
+        build(table, warnings);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+
+    if (snapshot.has_value())
+        storeSnapshot(*snapshot, key, table, warnings);
+
+    return true;
+}
+
+template <class Prepared>
+auto take(std::unordered_map<const Opm::DeckKeyword*, Prepared>& prepared,
+          const Opm::DeckKeyword& keyword)
+    -> std::optional<decltype(Prepared::table)>
+{
+    auto pos = prepared.find(&keyword);
+    if (pos == prepared.end())
+        return {};
+
+    // Keyword objects may be reused after their report step is done.
+    if (!(pos->second.table.location() == keyword.location())) {
+        prepared.erase(pos);
+        return {};
+    }
+
+    for (const auto& warning : pos->second.warnings)
+        Opm::OpmLog::warning(warning);
+
+    auto table = std::move(pos->second.table);
+    prepared.erase(pos);
+
+    return table;
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+    VFPTableCache::VFPTableCache(std::filesystem::path directory)
+        : m_directory(std::move(directory))
+    {}
+
+    VFPTableCache VFPTableCache::fromEnvironment()
+    {
+        const char* env = std::getenv("OPM_VFP_CACHE");
+        if ((env == nullptr) || (*env == '\0'))
+            return VFPTableCache{};
+
+        return VFPTableCache { std::filesystem::path { env } };
+    }
+
+    std::filesystem::path
+    VFPTableCache::snapshotPath(const std::uint64_t file_hash,
+                                const DeckKeyword& keyword,
+                                const std::string& settings) const
+    {
+        const auto& location = keyword.location();
+        const auto name_hash = InputFileManifest::
+            hash(fmt::format("{}\n{}\n{}\n{}", location.filename,
+                             location.lineno, keyword.name(), settings),
+                 file_hash);
+
+        return *this->m_directory / fmt::format("{:016x}.vfp", name_hash);
+    }
+
+    void VFPTableCache::prepare(const std::vector<const DeckKeyword*>& keywords,
+                                const bool gaslift_opt_active,
+                                const UnitSystem& unit_system)
+    {
+        this->m_prod.clear();
+        this->m_inj.clear();
+
+        const auto num_keywords = keywords.size();
+
+        // Snapshot file and key of every keyword, if snapshots are kept.
+        std::vector<std::optional<std::filesystem::path>> snapshots(num_keywords);
+        std::vector<std::string> keys(num_keywords);
+
+        if (this->m_directory.has_value()) {
+            const auto settings = fmt::format("{}:{}", unit_system.getName(),
+                                              static_cast<int>(unit_system.getType()));
+
+            for (std::size_t i = 0; i < num_keywords; ++i) {
+                const auto& keyword = *keywords[i];
+                const auto& filename = keyword.location().filename;
+
+                auto hash = this->m_file_hashes.find(filename);
+                if (hash == this->m_file_hashes.end())
+                    hash = this->m_file_hashes.emplace(filename, fileHash(filename)).first;
+
+                if (!hash->second.has_value())
+                    continue;
+
+                const auto table_settings = keyword.is<ParserKeywords::VFPPROD>()
+                    ? fmt::format("{}:{}", settings, gaslift_opt_active)
+                    : settings;
+
+                snapshots[i] = this->snapshotPath(*hash->second, keyword, table_settings);
+                keys[i] = fmt::format("{}\n{}\n{:016x}\n{}", filename,
+                                      keyword.location().lineno,
+                                      *hash->second, table_settings);
+            }
+        }
+
+        std::vector<Prepared<VFPProdTable>> prod(num_keywords);
+        std::vector<Prepared<VFPInjTable>> inj(num_keywords);
+        std::vector<char> built(num_keywords, 0);
+
+        const auto n = static_cast<std::ptrdiff_t>(num_keywords);
+
+#pragma omp parallel for schedule(dynamic) if(n > 1)
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            const auto& keyword = *keywords[i];
+
+            if (keyword.is<ParserKeywords::VFPPROD>()) {
+                built[i] = loadOrBuild(snapshots[i], keys[i], prod[i].table, prod[i].warnings,
+                    [&keyword, gaslift_opt_active, &unit_system]
+                    (VFPProdTable& table, std::vector<std::string>& warnings)
+                {
+                    table = VFPProdTable(keyword, gaslift_opt_active, unit_system, &warnings);
+                });
+            }
+            else if (keyword.is<ParserKeywords::VFPINJ>()) {
+                built[i] = loadOrBuild(snapshots[i], keys[i], inj[i].table, inj[i].warnings,
+                    [&keyword, &unit_system]
+                    (VFPInjTable& table, std::vector<std::string>&)
+                {
+                    table = VFPInjTable(keyword, unit_system);
+                });
+            }
+        }
+
+        for (std::size_t i = 0; i < num_keywords; ++i) {
+            if (!built[i])
+                continue;
+
+            if (keywords[i]->is<ParserKeywords::VFPPROD>())
+                this->m_prod.emplace(keywords[i], std::move(prod[i]));
+            else
+                this->m_inj.emplace(keywords[i], std::move(inj[i]));
+        }
+    }
+
+    std::optional<VFPProdTable> VFPTableCache::takeProd(const DeckKeyword& keyword)
+    {
+        return take(this->m_prod, keyword);
+    }
+
+    std::optional<VFPInjTable> VFPTableCache::takeInj(const DeckKeyword& keyword)
+    {
+        return take(this->m_inj, keyword);
+    }
+
+} // namespace Opm
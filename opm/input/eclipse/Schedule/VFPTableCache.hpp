@@ -0,0 +1,106 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_TABLE_CACHE_HPP
+#define OPM_VFP_TABLE_CACHE_HPP
+
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+    class DeckKeyword;
+    class UnitSystem;
+
+    /// VFP tables built ahead of the VFPPROD and VFPINJ keyword handlers.
+    ///
+    /// The tables of a batch of keywords are independent of each other
+    /// and are built concurrently.  If a cache directory is set, every
+    /// table is in addition stored there as a binary snapshot of its flat
+    /// arrays.  A snapshot is keyed by the path and content hash of the
+    /// file holding the keyword, the keyword's line number and the unit
+    /// system and gas lift settings the table depends on, so later runs
+    /// load the table instead of converting the deck keyword again.
+    ///
+    /// Warnings raised while building a table are kept, also in the
+    /// snapshot, and logged when the handler takes the table.  The
+    /// warnings then appear in the same order as without preparation.
+    /// Failing to build, read or write a table is never an error here,
+    /// the handler then builds the table itself and reports any error.
+    class VFPTableCache {
+    public:
+        /// Incremented whenever the snapshot layout or the serialized
+        /// representation of the tables changes.
+        static constexpr int version = 1;
+
+        /// Prepare tables without snapshots.
+        VFPTableCache() = default;
+
+        /// Prepare tables and keep snapshots in \p directory.
+        explicit VFPTableCache(std::filesystem::path directory);
+
+        /// Snapshot directory taken from the OPM_VFP_CACHE environment
+        /// variable, or no snapshots if it is unset or empty.
+        static VFPTableCache fromEnvironment();
+
+        /// Build the tables of \p keywords, which are VFPPROD or VFPINJ
+        /// keywords.  Drops all tables prepared earlier and not taken.
+        void prepare(const std::vector<const DeckKeyword*>& keywords,
+                     bool gaslift_opt_active,
+                     const UnitSystem& unit_system);
+
+        /// Table prepared for \p keyword, which is removed from the
+        /// cache, or nullopt if there is none.  Logs the warnings raised
+        /// when building the table.
+        std::optional<VFPProdTable> takeProd(const DeckKeyword& keyword);
+
+        /// Table prepared for \p keyword, see takeProd().
+        std::optional<VFPInjTable> takeInj(const DeckKeyword& keyword);
+
+    private:
+        template <class Table>
+        struct Prepared {
+            Table table{};
+            std::vector<std::string> warnings{};
+        };
+
+        std::optional<std::filesystem::path> m_directory{};
+
+        std::unordered_map<const DeckKeyword*, Prepared<VFPProdTable>> m_prod{};
+        std::unordered_map<const DeckKeyword*, Prepared<VFPInjTable>> m_inj{};
+
+        // Content hash of every file holding a VFP keyword so far, or
+        // nullopt if the file could not be read.
+        std::unordered_map<std::string, std::optional<std::uint64_t>> m_file_hashes{};
+
+        std::filesystem::path snapshotPath(std::uint64_t file_hash,
+                                           const DeckKeyword& keyword,
+                                           const std::string& settings) const;
+    };
+
+} // namespace Opm
+
+#endif // OPM_VFP_TABLE_CACHE_HPP
@@ -19,9 +19,15 @@
 
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
 
+#include <opm/common/utility/shmatch.hpp>
+
 #include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -29,6 +35,28 @@
 
 namespace Opm {
 
+struct NameOrder::MatchCache
+{
+    // Bound on the number of memoized patterns per name set.
+    static constexpr std::size_t max_patterns = 1024;
+
+    std::mutex lock{};
+
+    // Insertion indices sorted by name.  Built on first use.
+    std::vector<std::size_t> sorted{};
+
+    std::unordered_map<std::string, std::vector<std::string>> results{};
+};
+
+NameOrder::NameOrder()
+    : m_match_cache { std::make_shared<MatchCache>() }
+{}
+
+void NameOrder::resetMatchCache()
+{
+    this->m_match_cache = std::make_shared<MatchCache>();
+}
+
 void NameOrder::add(const std::string& name)
 {
     const auto emplaceResult = this->m_index_map
@@ -37,10 +65,12 @@ void NameOrder::add(const std::string& name)
     if (emplaceResult.second) {
         // New element inserted.  Update name list.
         this->m_name_list.push_back(name);
+        this->resetMatchCache();
     }
 }
 
 NameOrder::NameOrder(const std::vector<std::string>& names)
+    : NameOrder()
 {
     for (const auto& w : names) {
         this->add(w);
@@ -48,6 +78,7 @@ NameOrder::NameOrder(const std::vector<std::string>& names)
 }
 
 NameOrder::NameOrder(std::initializer_list<std::string> names)
+    : NameOrder()
 {
     for (const auto& w : names) {
         this->add(w);
@@ -59,6 +90,88 @@ bool NameOrder::has(const std::string& wname) const
     return this->m_index_map.find(wname) != this->m_index_map.end();
 }
 
+std::optional<std::size_t> NameOrder::index(const std::string& wname) const
+{
+    auto iter = this->m_index_map.find(wname);
+    if (iter == this->m_index_map.end()) {
+        return std::nullopt;
+    }
+
+    return iter->second;
+}
+
+std::vector<std::string> NameOrder::match(const std::string& pattern) const
+{
+    if (this->m_match_cache == nullptr) {
+        // Moved-from object.
+        auto names = std::vector<std::string>{};
+        std::copy_if(this->m_name_list.begin(), this->m_name_list.end(),
+                     std::back_inserter(names),
+                     [&pattern](const std::string& name) { return shmatch(pattern, name); });
+        return names;
+    }
+
+    auto& cache = *this->m_match_cache;
+    std::lock_guard<std::mutex> guard { cache.lock };
+
+    if (auto pos = cache.results.find(pattern); pos != cache.results.end()) {
+        return pos->second;
+    }
+
+    const auto compiled = ShellPattern { pattern };
+    const auto& prefix = compiled.prefix();
+
+    auto indices = std::vector<std::size_t>{};
+    if (prefix.empty()) {
+        for (std::size_t index = 0; index < this->m_name_list.size(); ++index) {
+            if (compiled.match(this->m_name_list[index])) {
+                indices.push_back(index);
+            }
+        }
+    }
+    else {
+        if (cache.sorted.size() != this->m_name_list.size()) {
+            cache.sorted.resize(this->m_name_list.size());
+            std::iota(cache.sorted.begin(), cache.sorted.end(), std::size_t{0});
+            std::sort(cache.sorted.begin(), cache.sorted.end(),
+                      [this](const std::size_t i1, const std::size_t i2)
+                      { return this->m_name_list[i1] < this->m_name_list[i2]; });
+        }
+
+        // Candidates are the names starting with the literal prefix, a
+        // contiguous range of the sorted index.
+        auto candidate = std::lower_bound(cache.sorted.begin(), cache.sorted.end(), prefix,
+                                          [this](const std::size_t index, const std::string& value)
+                                          { return this->m_name_list[index] < value; });
+
+        for (; candidate != cache.sorted.end(); ++candidate) {
+            const auto& name = this->m_name_list[*candidate];
+            if (name.compare(0, prefix.size(), prefix) != 0) {
+                break;
+            }
+
+            if (compiled.match(name)) {
+                indices.push_back(*candidate);
+            }
+        }
+
+        std::sort(indices.begin(), indices.end());
+    }
+
+    auto names = std::vector<std::string>{};
+    names.reserve(indices.size());
+    for (const auto index : indices) {
+        names.push_back(this->m_name_list[index]);
+    }
+
+    if (cache.results.size() >= MatchCache::max_patterns) {
+        cache.results.clear();
+    }
+
+    cache.results.emplace(pattern, names);
+    return names;
+}
+
 const std::vector<std::string>& NameOrder::names() const
 {
     return this->m_name_list;
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -34,7 +35,7 @@ namespace Opm {
 class NameOrder
 {
 public:
-    NameOrder() = default;
+    NameOrder();
     explicit NameOrder(std::initializer_list<std::string> names);
     explicit NameOrder(const std::vector<std::string>& names);
 
@@ -43,11 +44,25 @@ public:
     const std::vector<std::string>& names() const;
     bool has(const std::string& wname) const;
 
+    /// Insertion index of \p wname, i.e., its position in names(), or
+    /// nullopt if the name is not known.
+    std::optional<std::size_t> index(const std::string& wname) const;
+
+    /// Names matching a shell pattern, in insertion order.
+    ///
+    /// Equivalent to filtering names() with shmatch(), but the results are
+    /// memoized per name set and candidates are taken from a sorted name
+    /// index when the pattern starts with literal characters.  Safe to
+    /// call concurrently.
+    std::vector<std::string> match(const std::string& pattern) const;
+
     template <class Serializer>
     void serializeOp(Serializer& serializer)
     {
         serializer(m_index_map);
         serializer(m_name_list);
+        if (!serializer.isSerializing())
+            this->resetMatchCache();
     }
 
     static NameOrder serializationTestObject();
@@ -60,8 +75,17 @@ public:
     auto size()  const { return this->m_name_list.size(); }
 
 private:
+    struct MatchCache;
+
+    void resetMatchCache();
+
     std::unordered_map<std::string, std::size_t> m_index_map;
     std::vector<std::string> m_name_list;
+
+    // Sorted name index and memoized match() results.  Replaced whenever
+    // a name is added, and otherwise shared between copies with the same
+    // names.
+    std::shared_ptr<MatchCache> m_match_cache;
 };
 
 class GroupOrder
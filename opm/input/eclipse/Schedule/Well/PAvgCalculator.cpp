@@ -735,14 +735,37 @@ void PAvgCalculator<Scalar>::accumulateLocalContributions(const Sources& sources
     this->accumCTF_.prepareAccumulation();
     this->accumPV_.prepareAccumulation();
 
+    this->gatherCellSources(sources);
+
     const auto connDP =
         this->connectionPressureOffset(sources, controls, gravity, refDepth);
 
     if (controls.open_connections()) {
-        this->accumulateLocalContribOpen(sources, controls, connDP);
+        this->accumulateLocalContribOpen(controls, connDP);
     }
     else {
-        this->accumulateLocalContribAll(sources, controls, connDP);
+        this->accumulateLocalContribAll(controls, connDP);
+    }
+}
+
+template<class Scalar>
+void PAvgCalculator<Scalar>::gatherCellSources(const Sources& sources)
+{
+    using Item = typename PAvgDynamicSourceData<Scalar>::template SourceDataSpan<const Scalar>::Item;
+
+    const auto ncell = this->contributingCells_.size();
+
+    auto& values = this->cellSources_;
+    values.pressure.resize(ncell);
+    values.mixtureDensity.resize(ncell);
+    values.poreVol.resize(ncell);
+
+    for (auto i = 0*ncell; i < ncell; ++i) {
+        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
+
+        values.pressure[i] = src[Item::Pressure];
+        values.mixtureDensity[i] = src[Item::MixtureDensity];
+        values.poreVol[i] = src[Item::PoreVol];
     }
 }
 
@@ -945,8 +968,7 @@ addNeighbours_Z(const GridDims& cellIndexMap, SetupMap& setupHelperMap)
 template<class Scalar>
 template <typename ConnIndexMap, typename CTFPressureWeightFunction>
 void PAvgCalculator<Scalar>::
-accumulateLocalContributions(const Sources&             sources,
-                             const PAvg&                controls,
+accumulateLocalContributions(const PAvg&                controls,
                              const std::vector<Scalar>& connDP,
                              ConnIndexMap               connIndex,
                              CTFPressureWeightFunction  ctfPressWeight)
@@ -964,17 +986,16 @@ accumulateLocalContributions(const Sources&             sources,
     // Intermediate, per connection results pertaining to CTF-weighted sum.
     auto accumCTF_c = Accumulator{};
 
-    auto addContrib = [&sources, &ctfPressWeight, &accumCTF_c, this]
+    const auto& values = this->cellSources_;
+
+    auto addContrib = [&values, &ctfPressWeight, &accumCTF_c, this]
         (const ContrIndexType i, const Scalar dp, PressureTermHandler handler)
     {
-        using Item = typename PAvgDynamicSourceData<Scalar>::template SourceDataSpan<const Scalar>::Item;
-
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
-        const auto p   = src[Item::Pressure] + dp;
+        const auto p = values.pressure[i] + dp;
 
         // Use std::invoke() to simplify the calling syntax here.
-        std::invoke(handler, accumCTF_c    , ctfPressWeight(src), p);
-        std::invoke(handler, this->accumPV_, src[Item::PoreVol] , p);
+        std::invoke(handler, accumCTF_c    , ctfPressWeight(i), p);
+        std::invoke(handler, this->accumPV_, values.poreVol[i], p);
     };
 
     const auto handlers = std::array {
@@ -1013,8 +1034,7 @@ accumulateLocalContributions(const Sources&             sources,
 template<class Scalar>
 template <typename ConnIndexMap>
 void PAvgCalculator<Scalar>::
-accumulateLocalContributions(const Sources&             sources,
-                             const PAvg&                controls,
+accumulateLocalContributions(const PAvg&                controls,
                              const std::vector<Scalar>& connDP,
                              ConnIndexMap&&             connIndex)
 {
@@ -1022,49 +1042,43 @@ accumulateLocalContributions(const Sources&             sources,
         // F1 < 0 => pore-volume weighting of individual cell contributions,
         // no weighting when commiting term.
 
-        this->accumulateLocalContributions(sources, controls, connDP,
+        this->accumulateLocalContributions(controls, connDP,
                                            std::forward<ConnIndexMap>(connIndex),
-                                           [](const auto& src)
+                                           [this](const ContrIndexType i)
                                            {
-                                               using Span = std::remove_cv_t<
-                                                   std::remove_reference_t<decltype(src)>>;
-                                               using Item = typename Span::Item;
-
-                                               return src[Item::PoreVol];
+                                               return this->cellSources_.poreVol[i];
                                            });
     }
     else {
         // F1 >= 0 => unit weighting of individual cell contributions,
         // F1-weighting when committing term.
 
-        this->accumulateLocalContributions(sources, controls, connDP,
+        this->accumulateLocalContributions(controls, connDP,
                                            std::forward<ConnIndexMap>(connIndex),
-                                           [](const auto&) { return 1.0; });
+                                           [](const ContrIndexType) { return 1.0; });
     }
 }
 
 template<class Scalar>
 void PAvgCalculator<Scalar>::
-accumulateLocalContribOpen(const Sources&             sources,
-                           const PAvg&                controls,
+accumulateLocalContribOpen(const PAvg&                controls,
                            const std::vector<Scalar>& connDP)
 {
     assert (connDP.size() == this->openConns_.size());
 
-    this->accumulateLocalContributions(sources, controls, connDP,
+    this->accumulateLocalContributions(controls, connDP,
                                        [this](const auto i)
                                        { return this->openConns_[i]; });
 }
 
 template<class Scalar>
 void PAvgCalculator<Scalar>::
-accumulateLocalContribAll(const Sources&             sources,
-                          const PAvg&                controls,
+accumulateLocalContribAll(const PAvg&                controls,
                           const std::vector<Scalar>& connDP)
 {
     assert (connDP.size() == this->connections_.size());
 
-    this->accumulateLocalContributions(sources, controls, connDP,
+    this->accumulateLocalContributions(controls, connDP,
                                        [](const auto i) { return i; });
 }
 
@@ -1100,7 +1114,6 @@ template<class Scalar>
 template <typename ConnIndexMap>
 std::vector<Scalar> PAvgCalculator<Scalar>::
 connectionPressureOffsetRes(const std::size_t nconn,
-                            const Sources&    sources,
                             const Scalar      gravity,
                             const Scalar      refDepth,
                             ConnIndexMap      connIndex) const
@@ -1114,13 +1127,11 @@ connectionPressureOffsetRes(const std::size_t nconn,
 
     auto density = WeightedRunningAverage<Scalar, Scalar>{};
 
-    auto includeDensity = [this, &sources, &density](const ContrIndexType i)
-    {
-        using Item = typename PAvgDynamicSourceData<Scalar>::template SourceDataSpan<const Scalar>::Item;
+    const auto& values = this->cellSources_;
 
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
-
-        density.add(src[Item::MixtureDensity], src[Item::PoreVol]);
+    auto includeDensity = [&values, &density](const ContrIndexType i)
+    {
+        density.add(values.mixtureDensity[i], values.poreVol[i]);
     };
 
     for (auto connID = 0*nconn; connID < nconn; ++connID) {
@@ -1167,11 +1178,11 @@ connectionPressureOffset(const Sources& sources,
 
     if (controls.depth_correction() == PAvg::DepthCorrection::RES) {
         if (! controls.open_connections()) {
-            return this->connectionPressureOffsetRes(nconn, sources, gravity, refDepth,
+            return this->connectionPressureOffsetRes(nconn, gravity, refDepth,
                                                      [](const auto i) { return i; });
         }
 
-        return this->connectionPressureOffsetRes(nconn, sources, gravity, refDepth,
+        return this->connectionPressureOffsetRes(nconn, gravity, refDepth,
                                                  [this](const auto i)
                                                  {
                                                      return this->openConns_[i];
@@ -35,6 +35,7 @@ namespace Opm {
 class Connection;
 class GridDims;
 class PAvg;
+template<class Scalar> class PAvgCalculatorCollection;
 template<class Scalar> class PAvgDynamicSourceData;
 class WellConnections;
 
@@ -139,6 +140,10 @@ class PAvgCalculator
 protected:
     class Accumulator;
 
+    /// Evaluates all calculators of a collection in phases, see
+    /// PAvgCalculatorCollection::inferBlockAveragePressures().
+    friend class PAvgCalculatorCollection<Scalar>;
+
 public:
     /// References to source contributions owned by other party
     class Sources
@@ -483,6 +488,28 @@ private:
     /// Cached end result from \code inferBlockAveragePressures() \endcode.
     PAvgCalculatorResult<Scalar> averagePressures_{};
 
+    /// Dynamic source values of the contributing cells, in the order of
+    /// \c contributingCells_.
+    ///
+    /// Gathered from the well block sources once at the start of each
+    /// calculation so that the connection loops, which visit most cells
+    /// several times, read plain arrays instead of looking up each source
+    /// location.
+    struct CellSourceValues
+    {
+        /// Dynamic pressure of each contributing cell.
+        std::vector<Scalar> pressure{};
+
+        /// Dynamic mixture density of each contributing cell.
+        std::vector<Scalar> mixtureDensity{};
+
+        /// Dynamic pore volume of each contributing cell.
+        std::vector<Scalar> poreVol{};
+    };
+
+    /// Source values of current calculation.
+    CellSourceValues cellSources_{};
+
     /// Include reservoir connection and all direction-dependent level 1 and
     /// level 2 neighbours of connection's connecting cell into known cell
     /// set.
@@ -512,6 +539,12 @@ private:
     ///   the active status of \code allWBPCells()[i] \endcode.
     void pruneInactiveConnections(const std::vector<bool>& isActive);
 
+    /// Copy dynamic source values of all contributing cells into
+    /// \c cellSources_.
+    ///
+    /// \param[in] sources Connection and cell-level raw data.
+    void gatherCellSources(const Sources& sources);
+
     /// Top-level entry point for accumulating local WBP contributions.
     ///
     /// Will dispatch to lower-level entry points depending on control's
@@ -632,16 +665,14 @@ private:
     ///   weighting values for the CTF-weighted connection contributions.
     ///   Must provide a call operator such that
     /// \code
-    ///   double w = weight(src)
+    ///   double w = weight(i)
     /// \endcode
     ///   is well formed for an object \c weight of type \p
-    ///   CTFPressureWeightFunction and a \c src object of type \code
-    ///   PAvgDynamicSourceData::SourceDataSpan<const double> \endcode.
-    ///   Will typically be a lambda that returns the pore volume in \c src
-    ///   if the weighting factor F1 in WPAVE is negative, or a lambda that
-    ///   just returns the number one (1.0) otherwise.
-    ///
-    /// \param[in] sources Connection and cell-level raw data.
+    ///   CTFPressureWeightFunction and a contributing cell index \c i.
+    ///   Will typically be a lambda that returns the pore volume of cell
+    ///   \c i in \c cellSources_ if the weighting factor F1 in WPAVE is
+    ///   negative, or a lambda that just returns the number one (1.0)
+    ///   otherwise.
     ///
     /// \param[in] controls Averaging procedure controls.
     ///
@@ -654,8 +685,7 @@ private:
     /// \param[in] ctfPressWeight Pressure weighting method for CTF term's
     ///   individual contributions.
     template <typename ConnIndexMap, typename CTFPressureWeightFunction>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const std::vector<Scalar>& connDP,
                                       ConnIndexMap               connIndex,
                                       CTFPressureWeightFunction  ctfPressWeight);
@@ -682,8 +712,6 @@ private:
     ///   identity mapping \code [](i){return i} \endcode or the open
     ///   connection mapping \code [](i){return openConns_[i]} \endcode.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
@@ -692,8 +720,7 @@ private:
     /// \param[in] connIndex Translation method from active connection index
     ///   to index into all known reservoir connections.
     template <typename ConnIndexMap>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const std::vector<Scalar>& connDP,
                                       ConnIndexMap&&             connIndex);
 
@@ -702,14 +729,11 @@ private:
     ///
     /// Invokes final dispatch level on set of open connections only.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
     ///   connection.
-    void accumulateLocalContribOpen(const Sources&             sources,
-                                    const PAvg&                controls,
+    void accumulateLocalContribOpen(const PAvg&                controls,
                                     const std::vector<Scalar>& connDP);
 
     /// First dispatch level before going to calculation routine which
@@ -717,14 +741,11 @@ private:
     ///
     /// Invokes final dispatch level on set of all known connections.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] connDP Pressure correction term for each reservoir
     ///   connection.
-    void accumulateLocalContribAll(const Sources&             sources,
-                                   const PAvg&                controls,
+    void accumulateLocalContribAll(const PAvg&                controls,
                                    const std::vector<Scalar>& connDP);
 
     /// Compute pressure correction term/offset using Well method
@@ -784,8 +805,6 @@ private:
     ///
     /// \param[in] nconn Number of elements in active connection subset.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
     ///
     /// \param[in] refDepth Well's reference depth for block-average
@@ -799,7 +818,6 @@ private:
     template <typename ConnIndexMap>
     std::vector<Scalar>
     connectionPressureOffsetRes(const std::size_t nconn,
-                                const Sources&    sources,
                                 const Scalar      gravity,
                                 const Scalar      refDepth,
                                 ConnIndexMap      connIndex) const;
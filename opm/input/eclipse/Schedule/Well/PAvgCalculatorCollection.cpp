@@ -23,9 +23,11 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <exception>
 #include <initializer_list>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -125,6 +127,106 @@ allWBPCells() const
     return { wbpCells.begin(), std::unique(wbpCells.begin(), wbpCells.end()) };
 }
 
+template<class Scalar>
+void PAvgCalculatorCollection<Scalar>::
+inferBlockAveragePressures(const std::vector<WellInputs>& inputs,
+                           const Scalar                   gravity)
+{
+    if (inputs.size() != this->calculators_.size()) {
+        throw std::invalid_argument {
+            fmt::format("Block-average pressure inputs for {} wells "
+                        "do not match {} calculation objects",
+                        inputs.size(), this->calculators_.size())
+        };
+    }
+
+    // The local contributions of a well only read the well's sources and
+    // write to the well's own accumulators.
+    const auto numCalc = static_cast<int>(this->calculators_.size());
+    std::vector<std::exception_ptr> failure(numCalc);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int calc = 0; calc < numCalc; ++calc) {
+        try {
+            const auto& input = inputs[calc];
+            this->calculators_[calc]->
+                accumulateLocalContributions(input.sources, input.controls,
+                                             gravity, input.refDepth);
+        }
+        catch (...) {
+            failure[calc] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : failure) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    this->collectGlobalContributions();
+
+    for (int calc = 0; calc < numCalc; ++calc) {
+        this->calculators_[calc]->assignResults(inputs[calc].controls);
+    }
+}
+
+template<class Scalar>
+void PAvgCalculatorCollection<Scalar>::collectGlobalContributions()
+{
+    for (auto& calculatorPtr : this->calculators_) {
+        calculatorPtr->collectGlobalContributions();
+    }
+}
+
+template<class Scalar>
+std::vector<Scalar> PAvgCalculatorCollection<Scalar>::runningAverages() const
+{
+    using LocalRunningAverages = typename PAvgCalculator<Scalar>::
+        Accumulator::LocalRunningAverages;
+
+    auto avg = std::vector<Scalar>{};
+    avg.reserve(2 * std::tuple_size_v<LocalRunningAverages> * this->calculators_.size());
+
+    for (const auto& calculatorPtr : this->calculators_) {
+        for (const auto* accum : { &calculatorPtr->accumCTF_, &calculatorPtr->accumPV_ }) {
+            const auto localAvg = accum->getRunningAverages();
+            avg.insert(avg.end(), localAvg.begin(), localAvg.end());
+        }
+    }
+
+    return avg;
+}
+
+template<class Scalar>
+void PAvgCalculatorCollection<Scalar>::
+assignRunningAverages(const std::vector<Scalar>& avg)
+{
+    using LocalRunningAverages = typename PAvgCalculator<Scalar>::
+        Accumulator::LocalRunningAverages;
+
+    constexpr auto numAvg = std::tuple_size_v<LocalRunningAverages>;
+
+    if (avg.size() != 2 * numAvg * this->calculators_.size()) {
+        throw std::invalid_argument {
+            fmt::format("Running averages of size {} do not "
+                        "match {} calculation objects",
+                        avg.size(), this->calculators_.size())
+        };
+    }
+
+    auto begin = avg.begin();
+    for (auto& calculatorPtr : this->calculators_) {
+        for (auto* accum : { &calculatorPtr->accumCTF_, &calculatorPtr->accumPV_ }) {
+            auto localAvg = LocalRunningAverages{};
+            std::copy_n(begin, numAvg, localAvg.begin());
+            accum->assignRunningAverages(localAvg);
+
+            begin += numAvg;
+        }
+    }
+}
+
 template class PAvgCalculatorCollection<double>;
 template class PAvgCalculatorCollection<float>;
 
@@ -20,16 +20,15 @@
 #ifndef PAVE_CALC_COLLECTIONHPP
 #define PAVE_CALC_COLLECTIONHPP
 
+#include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
-namespace Opm {
-    template<class Scalar> class PAvgCalculator;
-} // namespace Opm
-
 namespace Opm {
 
 /// Collection of WBPn calculation objects, one for each well.
@@ -56,11 +55,24 @@ public:
     using ActivePredicate = std::function<
         std::vector<bool>(const std::vector<std::size_t>&)>;
 
+    /// Input to the block-average pressure calculation of a single well.
+    struct WellInputs
+    {
+        /// Well's connection and cell-level source terms.
+        typename PAvgCalculator<Scalar>::Sources sources{};
+
+        /// Well's averaging procedure controls.
+        PAvg controls{};
+
+        /// Well's reference depth for block-average pressure calculation.
+        Scalar refDepth{};
+    };
+
     /// Default constructor.
     PAvgCalculatorCollection() = default;
 
     /// Destructor.
-    ~PAvgCalculatorCollection() = default;
+    virtual ~PAvgCalculatorCollection() = default;
 
     /// Copy constructor.
     PAvgCalculatorCollection(const PAvgCalculatorCollection&) = delete;
@@ -125,6 +137,46 @@ public:
     /// Mainly intended to configure \c PAvgDynamicSourceData objects.
     std::vector<std::size_t> allWBPCells() const;
 
+    /// Compute block-average pressures for all wells in this collection.
+    ///
+    /// Gives the same results as calling inferBlockAveragePressures() on
+    /// each calculation object, but the local contributions of all wells
+    /// are accumulated concurrently and the global contributions of all
+    /// wells are collected in a single call to member function
+    /// collectGlobalContributions().  Results are available through the
+    /// individual calculation objects' averagePressures().
+    ///
+    /// \param[in] inputs Sources, controls and reference depth of each
+    ///   well.  One element for each calculation object, in the order of
+    ///   the indices returned from setCalculator().
+    ///
+    /// \param[in] gravity Strength of gravity in SI units [m/s^2].
+    void inferBlockAveragePressures(const std::vector<WellInputs>& inputs,
+                                    const Scalar                   gravity);
+
+protected:
+    /// Communicate local contributions of all wells and collect global
+    /// (off-rank) contributions.
+    ///
+    /// Intended as an MPI-aware customisation point.  The default
+    /// implementation calls each calculation object's own
+    /// collectGlobalContributions().  A parallel implementation may
+    /// instead sum the array from runningAverages() across all ranks in a
+    /// single collective operation and pass the result to
+    /// assignRunningAverages().
+    virtual void collectGlobalContributions();
+
+    /// Local running averages of all calculation objects, in calculator
+    /// index order, as one contiguous array.  Opaque apart from applying a
+    /// global sum.
+    std::vector<Scalar> runningAverages() const;
+
+    /// Assign globally summed running averages to all calculation objects.
+    ///
+    /// \param[in] avg Array of the same size and layout as returned from
+    ///   runningAverages().
+    void assignRunningAverages(const std::vector<Scalar>& avg);
+
 private:
     /// Representation of calculator indices.
     using CalcIndex = typename std::vector<CalculatorPtr>::size_type;
@@ -18,14 +18,14 @@
 */
 
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
-#include <algorithm>
 
 namespace Opm {
 
 WList::WList(const storage& wlist, const std::string& wlname)
-    : well_list(wlist)
-    , name(wlname)
+    : name(wlname)
 {
+    for (const auto& well : wlist)
+        this->add(well);
 }
 
 
@@ -39,22 +39,45 @@ std::string WList::getName() const {
 }
 
 bool WList::has(const std::string& well) const {
-    return (std::count(this->well_list.begin(), this->well_list.end(), well) > 0);
+    return this->well_pos.find(well) != this->well_pos.end();
+}
+
+std::optional<std::size_t> WList::position(const std::string& well) const {
+    auto it = this->well_pos.find(well);
+    if (it == this->well_pos.end())
+        return std::nullopt;
+
+    return it->second;
 }
 
 void WList::add(const std::string& well) {
     //add well if it is not already in the well list
-    if (std::count(this->well_list.begin(), this->well_list.end(), well) == 0)
+    if (this->well_pos.emplace(well, this->well_list.size()).second)
         this->well_list.push_back(well);
 }
 
 void WList::del(const std::string& well) {
-    auto end_keep = std::remove(this->well_list.begin(), this->well_list.end(), well);
-    this->well_list.erase(end_keep, this->well_list.end());
+    auto it = this->well_pos.find(well);
+    if (it == this->well_pos.end())
+        return;
+
+    // The list order is part of the restart output, so the wells after
+    // the deleted one are moved up rather than swapped in.
+    const auto pos = it->second;
+    this->well_pos.erase(it);
+    this->well_list.erase(this->well_list.begin() + pos);
+    for (auto i = pos; i < this->well_list.size(); ++i)
+        this->well_pos[this->well_list[i]] = i;
+}
+
+void WList::buildIndex() {
+    this->well_pos.clear();
+    for (std::size_t i = 0; i < this->well_list.size(); ++i)
+        this->well_pos.emplace(this->well_list[i], i);
 }
 
 
-std::vector<std::string> WList::wells() const {
+const WList::storage& WList::wells() const {
     return this->well_list;
 }
 
@@ -20,7 +20,8 @@
 #define WLIST_HPP
 
 #include <cstddef>
-#include <unordered_set>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -38,7 +39,13 @@ public:
     bool has(const std::string& well) const;
     std::string getName() const;
 
-    std::vector<std::string> wells() const;
+    /// Position of \p well in the list, or nullopt if the well is not
+    /// a member.
+    std::optional<std::size_t> position(const std::string& well) const;
+
+    /// Wells in the order they were added.  The reference is
+    /// invalidated by add() and del().
+    const storage& wells() const;
     bool operator==(const WList& data) const;
 
     template<class Serializer>
@@ -46,12 +53,19 @@ public:
     {
         serializer(well_list);
         serializer(name);
+        if (!serializer.isSerializing())
+            this->buildIndex();
     }
 
 private:
+    void buildIndex();
+
     storage well_list;
     std::string name;
 
+    // Position of each well in well_list.
+    std::unordered_map<std::string, std::size_t> well_pos{};
+
 };
 
 }
@@ -24,6 +24,8 @@
 #include <opm/io/eclipse/rst/state.hpp>
 
 #include <algorithm>
+#include <set>
+#include <unordered_set>
 
 namespace Opm {
 
@@ -31,6 +33,7 @@ namespace Opm {
     {
         WListManager result;
         result.wlists = {{"test1", WList({"test2", "test3"}, "test1")}};
+        result.buildIndex();
 
         return result;
     }
@@ -54,7 +57,8 @@ namespace Opm {
             if (new_well_names.size() > 0) {
                 // new well list contains wells
                 std::vector<std::string> replace_wellnames;
-                for (const auto& wname : wlist.wells()){
+                const auto old_wellnames = wlist.wells();
+                for (const auto& wname : old_wellnames){
                     if (std::count(new_well_names.begin(), new_well_names.end(), wname) == 0) {
                         this->delWListWell(wname, name);
                     } else {
@@ -64,6 +68,7 @@ namespace Opm {
                 for (const auto& rwname : replace_wellnames) {
                     // delete wells to be replaced from well list
                     wlist.del(rwname);
+                    this->dropMember(rwname, name);
                 }
                 for (const auto& wname : new_well_names) {
                     // add wells on new wlist
@@ -71,7 +76,8 @@ namespace Opm {
                 }
             } else  {
                 // remove all wells from existing well list (empty WLIST NEW)
-                for (const auto& wname : wlist.wells()){
+                const auto old_wellnames = wlist.wells();
+                for (const auto& wname : old_wellnames){
                     this->delWListWell(wname, name);
                 }
             }
@@ -113,6 +119,7 @@ namespace Opm {
         //add well to wlist if it is not already in the well list
         auto& wlist = this->getList(wlname);
         wlist.add(wname);
+        this->well_member_of[wname].insert(wlname);
         //add well list to well if not in vector already
         if (this->well_wlist_names.count(wname) > 0) {
             auto& no_wl = this->no_wlists_well.at(wname);
@@ -132,28 +139,62 @@ namespace Opm {
     }
 
     void WListManager::delWell(const std::string& wname) {
-        for (auto& pair: this->wlists) {
-            auto& wlist = pair.second;
-            wlist.del(wname);
-            if (this->well_wlist_names.count(wname) > 0) {
-                auto& wlist_vec = this->well_wlist_names.at(wname);
-                auto& no_wl = this->no_wlists_well.at(wname);
-                auto itwl = std::find(wlist_vec.begin(), wlist_vec.end(), wlist.getName());
-                if (itwl != wlist_vec.end()) {
-                    wlist_vec.erase(itwl);
-                    no_wl -= 1;
-                    if (no_wl == 0) {
-                        wlist_vec.clear();
-                    }
+        // Only the lists holding the well, or recorded for it in
+        // well_wlist_names, are affected.  They are visited in name order.
+        std::set<std::string> affected;
+        if (auto it = this->well_member_of.find(wname); it != this->well_member_of.end())
+            affected.insert(it->second.begin(), it->second.end());
+
+        if (auto it = this->well_wlist_names.find(wname); it != this->well_wlist_names.end())
+            affected.insert(it->second.begin(), it->second.end());
+
+        for (const auto& wlname : affected) {
+            if (this->hasList(wlname))
+                this->delWellFromList(wname, this->getList(wlname));
+        }
+    }
+
+    void WListManager::delWellFromList(const std::string& wname, WList& wlist) {
+        wlist.del(wname);
+        this->dropMember(wname, wlist.getName());
+
+        if (this->well_wlist_names.count(wname) > 0) {
+            auto& wlist_vec = this->well_wlist_names.at(wname);
+            auto& no_wl = this->no_wlists_well.at(wname);
+            auto itwl = std::find(wlist_vec.begin(), wlist_vec.end(), wlist.getName());
+            if (itwl != wlist_vec.end()) {
+                wlist_vec.erase(itwl);
+                no_wl -= 1;
+                if (no_wl == 0) {
+                    wlist_vec.clear();
                 }
             }
         }
     }
 
+    void WListManager::dropMember(const std::string& wname, const std::string& wlname) {
+        auto it = this->well_member_of.find(wname);
+        if (it == this->well_member_of.end())
+            return;
+
+        it->second.erase(wlname);
+        if (it->second.empty())
+            this->well_member_of.erase(it);
+    }
+
+    void WListManager::buildIndex() {
+        this->well_member_of.clear();
+        for (const auto& [wlname, wlist] : this->wlists) {
+            for (const auto& wname : wlist.wells())
+                this->well_member_of[wname].insert(wlname);
+        }
+    }
+
     void WListManager::delWListWell(const std::string& wname, const std::string& wlname) {
         //delete well from well list
         auto& wlist = this->getList(wlname);
         wlist.del(wname);
+        this->dropMember(wname, wlname);
 
         if (this->well_wlist_names.count(wname) > 0) {
             auto& wlist_vec = this->well_wlist_names.at(wname);
@@ -180,14 +221,14 @@ namespace Opm {
             return { wlist.wells() };
         } else {
             std::vector<std::string> well_set;
+            std::unordered_set<std::string> seen;
             auto pattern = wlist_pattern.substr(1);
             for (const auto& [name, wlist] : this->wlists) {
                 auto wlist_name = name.substr(1);
                 if (shmatch(pattern, wlist_name)) {
-                    const auto& well_names = wlist.wells();
-                    for ( auto it = well_names.begin(); it != well_names.end(); it++ ) {
-                       if (std::count(well_set.begin(), well_set.end(), *it) == 0)
-                           well_set.push_back(*it);
+                    for (const auto& wname : wlist.wells()) {
+                       if (seen.insert(wname).second)
+                           well_set.push_back(wname);
                     }
                 }
             }
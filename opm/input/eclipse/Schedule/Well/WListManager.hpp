@@ -21,6 +21,8 @@
 
 #include <cstddef>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <string>
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
@@ -58,12 +60,23 @@ public:
         serializer(wlists);
         serializer(well_wlist_names);
         serializer(no_wlists_well);
+        if (!serializer.isSerializing())
+            this->buildIndex();
     }
 
 private:
+    void buildIndex();
+    void delWellFromList(const std::string& wname, WList& wlist);
+    void dropMember(const std::string& wname, const std::string& wlname);
+
     std::map<std::string, WList> wlists;
     std::map<std::string, std::vector<std::string>> well_wlist_names;
     std::map<std::string, std::size_t> no_wlists_well;
+
+    // Lists each well is currently a member of.  Unlike well_wlist_names,
+    // which keeps the restart file slot of each list, this follows the
+    // list contents exactly.
+    std::unordered_map<std::string, std::unordered_set<std::string>> well_member_of{};
 };
 
 }
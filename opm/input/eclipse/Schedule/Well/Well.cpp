@@ -1567,7 +1567,11 @@ bool Opm::Well::applyGlobalWPIMULT(const double scaling_factor)
 
 
 void Well::updateSegments(std::shared_ptr<WellSegments> segments_arg) {
-    this->segments = std::move(segments_arg);
+    // Keep sharing the existing segment set with earlier report steps if
+    // the new one is equal.
+    if (!this->segments || (*this->segments != *segments_arg))
+        this->segments = std::move(segments_arg);
+
     this->updateRefDepth( this->segments->depthTopSegment() );
     this->derive_refdepth_from_conns_ = false;
 }
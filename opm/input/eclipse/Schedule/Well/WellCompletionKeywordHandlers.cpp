@@ -23,8 +23,12 @@
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Deck/DeckRecord.hpp>
+
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
 #include <opm/input/eclipse/Schedule/Action/WGNames.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
@@ -36,48 +40,127 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Opm {
 
 namespace {
 
+/// Look up the cells of the COMPDAT records with explicit I and J in one
+/// batch, so that loading the records only finds cached cells.  Records
+/// with defaulted I/J, which take the well head, and cells outside the grid
+/// are left to loadCOMPDAT(), which also reports the errors.
+void prefetchCOMPDATCells(const ScheduleGrid& grid,
+                          const std::vector<const DeckRecord*>& records)
+{
+    const auto* ecl_grid = grid.get_grid();
+    if (ecl_grid == nullptr) {
+        return;
+    }
+
+    const auto in_range = [](const int index, const std::size_t n)
+    {
+        return (index >= 0) && (static_cast<std::size_t>(index) < n);
+    };
+
+    std::vector<std::array<std::size_t, 3>> ijk;
+    for (const auto* record : records) {
+        const auto& itemI = record->getItem("I");
+        const auto& itemJ = record->getItem("J");
+        if (itemI.defaultApplied(0) || itemJ.defaultApplied(0)) {
+            continue;
+        }
+
+        const auto I = itemI.get<int>(0) - 1;
+        const auto J = itemJ.get<int>(0) - 1;
+        if (!in_range(I, ecl_grid->getNX()) || !in_range(J, ecl_grid->getNY())) {
+            continue;
+        }
+
+        const auto K1 = record->getItem("K1").get<int>(0) - 1;
+        const auto K2 = record->getItem("K2").get<int>(0) - 1;
+        for (auto k = K1; k <= K2; ++k) {
+            if (in_range(k, ecl_grid->getNZ())) {
+                ijk.push_back({ static_cast<std::size_t>(I),
+                                static_cast<std::size_t>(J),
+                                static_cast<std::size_t>(k) });
+            }
+        }
+    }
+
+    grid.get_cells(ijk);
+}
+
 void handleCOMPDAT(HandlerContext& handlerContext)
 {
-    std::unordered_set<std::string> wells;
-    std::unordered_map<std::string, bool> well_connected;
+    // Collect the records for each well first, so that a keyword with many
+    // records for the same well copies, compares and updates the well's
+    // connection set once rather than once per record.
+    std::vector<std::string> well_order;
+    std::unordered_map<std::string, std::vector<const DeckRecord*>> well_records;
+    std::vector<const DeckRecord*> matched_records;
     for (const auto& record : handlerContext.keyword) {
         const auto wellNamePattern = record.getItem("WELL").getTrimmedString(0);
         const auto wellnames = handlerContext.wellNames(wellNamePattern);
+        if (!wellnames.empty()) {
+            matched_records.push_back(&record);
+        }
 
         for (const auto& name : wellnames) {
-            auto well2 = handlerContext.state().wells.get(name);
+            auto& records = well_records[name];
+            if (records.empty()) {
+                well_order.push_back(name);
+            }
 
-            auto connections = std::make_shared<WellConnections>(well2.getConnections());
-            const auto origWellConnSetIsEmpty = connections->empty();
+            records.push_back(&record);
+        }
+    }
 
-            connections->loadCOMPDAT(record, handlerContext.grid, name,
-                                     well2.getWDFAC(), handlerContext.keyword.location());
+    prefetchCOMPDATCells(handlerContext.grid, matched_records);
 
-            const auto isConnected = !origWellConnSetIsEmpty || !connections->empty();
-            if (well_connected.count(name))
-                well_connected[name] = (isConnected || well_connected[name]);
-            else
-                well_connected[name] = isConnected;
+    std::unordered_set<std::string> wells;
+    std::unordered_map<std::string, bool> well_connected;
+    for (const auto& name : well_order) {
+        auto well2 = handlerContext.state().wells.get(name);
 
-            if (well2.updateConnections(std::move(connections), handlerContext.grid)) {
-                auto wdfac = std::make_shared<WDFAC>(well2.getWDFAC());
-                wdfac->updateWDFACType(well2.getConnections());
+        auto connections = std::make_shared<WellConnections>(well2.getConnections());
+        const auto origWellConnSetIsEmpty = connections->empty();
 
-                well2.updateWDFAC(std::move(wdfac));
-                handlerContext.state().wells.update( well2 );
+        const auto& records = well_records[name];
+        for (auto recordPos = records.begin(); recordPos != records.end(); ++recordPos) {
+            connections->loadCOMPDAT(**recordPos, handlerContext.grid, name,
+                                     well2.getWDFAC(), handlerContext.keyword.location());
 
-                wells.insert(name);
+            // Order the connections after each record, like one record at
+            // a time would, since the tie breaks in order() depend on the
+            // existing order.  Well::updateConnections() orders after the
+            // last record.
+            if (std::next(recordPos) != records.end()) {
+                connections->order();
             }
+        }
 
-            handlerContext.state().wellgroup_events()
-                .addEvent(name, ScheduleEvents::COMPLETION_CHANGE);
+        well_connected[name] = !origWellConnSetIsEmpty || !connections->empty();
+
+        if (well2.updateConnections(std::move(connections), handlerContext.grid)) {
+            auto wdfac = std::make_shared<WDFAC>(well2.getWDFAC());
+            wdfac->updateWDFACType(well2.getConnections());
+
+            well2.updateWDFAC(std::move(wdfac));
+            handlerContext.state().wells.update( well2 );
+
+            wells.insert(name);
         }
+
+        handlerContext.state().wellgroup_events()
+            .addEvent(name, ScheduleEvents::COMPLETION_CHANGE);
     }
     // Output warning messages per well/keyword (not per COMPDAT record..)
     for (const auto& [wname, connected] : well_connected) {
@@ -138,7 +221,7 @@ void handleCOMPTRAJ(HandlerContext& handlerContext)
 {
     // Keyword WELTRAJ must be read first
     std::unordered_set<std::string> wells;
-    external::cvf::ref<external::cvf::BoundingBoxTree> cellSearchTree{};
+    auto& cellSearchTree = handlerContext.grid.cellSearchTree();
 
     for (const auto& record : handlerContext.keyword) {
         const auto wellNamePattern = record.getItem("WELL").getTrimmedString(0);
@@ -148,8 +231,8 @@ void handleCOMPTRAJ(HandlerContext& handlerContext)
             auto well2 = handlerContext.state().wells.get(name);
             auto connections = std::make_shared<WellConnections>(well2.getConnections());
 
-            // cellsearchTree is calculated only once and is used to
-            // calculated cell intersections of the perforations
+            // cellsearchTree is calculated only once per grid and is used
+            // to calculate cell intersections of the perforations
             // specified in COMPTRAJ
             connections->loadCOMPTRAJ(record, handlerContext.grid, name,
                                       handlerContext.keyword.location(),
@@ -50,7 +50,9 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -331,6 +333,7 @@ namespace Opm {
         this->m_connections.emplace_back(conn_i, conn_j, k, global_index, complnum,
                                          state, direction, ctf_kind, satTableId,
                                          depth, ctf_props, seqIndex, defaultSatTabId);
+        this->appendedConnection();
     }
 
     void WellConnections::addConnection(const int i, const int j, const int k,
@@ -512,12 +515,7 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
             ctf_props.static_dfac_corr_coeff =
                 staticForchheimerCoefficient(ctf_props, props->poro, wdfac);
 
-            auto prev = std::find_if(this->m_connections.begin(),
-                                     this->m_connections.end(),
-                                     [I, J, k](const Connection& c)
-                                     {
-                                         return c.sameCoordinate(I, J, k);
-                                     });
+            auto prev = this->findConnection(I, J, k);
 
             if (prev == this->m_connections.end()) {
                 const std::size_t noConn = this->m_connections.size();
@@ -625,6 +623,19 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
         // exit cell face point and connection length.
         auto intersections = e->cellIntersectionInfosAlongWellPath();
 
+        {
+            std::vector<std::array<std::size_t, 3>> intersected_cells;
+            intersected_cells.reserve(intersections.size());
+            for (const auto& intersection : intersections) {
+                const auto ijk = ecl_grid->getIJK(intersection.globCellIndex);
+                intersected_cells.push_back({ static_cast<std::size_t>(ijk[0]),
+                                              static_cast<std::size_t>(ijk[1]),
+                                              static_cast<std::size_t>(ijk[2]) });
+            }
+
+            grid.get_cells(intersected_cells);
+        }
+
         for (size_t is = 0; is < intersections.size(); ++is) {
             const auto ijk = ecl_grid->getIJK(intersections[is].globCellIndex);
 
@@ -728,10 +739,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                 ctf_props.Ke = std::sqrt(K[0] * K[1]);
             }
 
-            auto prev = std::find_if(this->m_connections.begin(),
-                                     this->m_connections.end(),
-                                     [&ijk](const Connection& c)
-                                     { return c.sameCoordinate(ijk[0], ijk[1], ijk[2]); });
+            auto prev = this->findConnection(ijk[0], ijk[1], ijk[2]);
 
             if (prev == this->m_connections.end()) {
                 const std::size_t noConn = this->m_connections.size();
@@ -838,48 +846,135 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
     bool WellConnections::hasGlobalIndex(std::size_t global_index) const
     {
-        return std::any_of(this->begin(), this->end(),
-                           [global_index](const Connection& conn)
-                           {
-                               return conn.global_index() == global_index;
-                           });
+        const auto table = this->lookupTable();
+        return table->global_index.find(global_index) != table->global_index.end();
     }
 
     const Connection&
     WellConnections::getFromIJK(const int i, const int j, const int k) const
     {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return get(ic);
-            }
+        const auto table = this->lookupTable();
+        const auto pos = table->ijk.find({i, j, k});
+        if (pos == table->ijk.end()) {
+            throw std::runtime_error(" the connection is not found! \n ");
         }
 
-        throw std::runtime_error(" the connection is not found! \n ");
+        return this->m_connections[pos->second];
     }
 
     const Connection& WellConnections::getFromGlobalIndex(std::size_t global_index) const
     {
-        auto conn_iter =
-            std::find_if(this->begin(), this->end(),
-                         [global_index] (const Connection& conn)
-                         { return conn.global_index() == global_index; });
-
-        if (conn_iter == this->end()) {
+        const auto table = this->lookupTable();
+        const auto pos = table->global_index.find(global_index);
+        if (pos == table->global_index.end()) {
             throw std::logic_error(fmt::format("No connection with global index {}", global_index));
         }
 
-        return *conn_iter;
+        return this->m_connections[pos->second];
     }
 
     Connection& WellConnections::getFromIJK(const int i, const int j, const int k)
     {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return this->m_connections[ic];
+        auto conn = this->findConnection(i, j, k);
+        if (conn == this->m_connections.end()) {
+            throw std::runtime_error(" the connection is not found! \n ");
+        }
+
+        return *conn;
+    }
+
+    WellConnections::PropertyArrays WellConnections::propertyArrays() const
+    {
+        auto arrays = PropertyArrays{};
+
+        const auto num_conn = this->m_connections.size();
+        arrays.global_index.reserve(num_conn);
+        arrays.CF.reserve(num_conn);
+        arrays.Kh.reserve(num_conn);
+        arrays.depth.reserve(num_conn);
+
+        for (const auto& conn : this->m_connections) {
+            arrays.global_index.push_back(conn.global_index());
+            arrays.CF.push_back(conn.CF());
+            arrays.Kh.push_back(conn.Kh());
+            arrays.depth.push_back(conn.depth());
+        }
+
+        return arrays;
+    }
+
+    std::size_t WellConnections::IJKHash::operator()(const std::array<int, 3>& ijk) const
+    {
+        auto seed = std::hash<int>{}(ijk[0]);
+        for (const auto c : { ijk[1], ijk[2] }) {
+            seed ^= std::hash<int>{}(c) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+
+    void WellConnections::LookupTable::insert(const Connection& conn, const std::size_t pos)
+    {
+        // Keep the first connection in a cell, as a linear search would.
+        this->ijk.try_emplace({ conn.getI(), conn.getJ(), conn.getK() }, pos);
+        this->global_index.try_emplace(conn.global_index(), pos);
+    }
+
+    std::shared_ptr<const WellConnections::LookupTable>
+    WellConnections::lookupTable() const
+    {
+        auto table = std::atomic_load(&this->m_lookup);
+        if (table == nullptr) {
+            table = std::make_shared<LookupTable>();
+            table->ijk.reserve(this->m_connections.size());
+            table->global_index.reserve(this->m_connections.size());
+
+            for (std::size_t pos = 0; pos < this->m_connections.size(); ++pos) {
+                table->insert(this->m_connections[pos], pos);
             }
+
+            std::atomic_store(&this->m_lookup, table);
+        }
+
+        return table;
+    }
+
+    WellConnections::LookupTable& WellConnections::ownLookupTable()
+    {
+        // A table shared with a copy of this connection set must not be
+        // extended, so build a private one.
+        if ((this->m_lookup != nullptr) && (this->m_lookup.use_count() > 1)) {
+            this->m_lookup.reset();
+        }
+
+        this->lookupTable();
+        return *this->m_lookup;
+    }
+
+    std::vector<Connection>::iterator
+    WellConnections::findConnection(const int i, const int j, const int k)
+    {
+        const auto& table = this->ownLookupTable();
+        const auto pos = table.ijk.find({i, j, k});
+
+        return (pos == table.ijk.end())
+            ? this->m_connections.end()
+            : this->m_connections.begin() + pos->second;
+    }
+
+    void WellConnections::appendedConnection()
+    {
+        if (this->m_lookup == nullptr) {
+            return;
+        }
+
+        if (this->m_lookup.use_count() > 1) {
+            this->m_lookup.reset();
+            return;
         }
 
-        throw std::runtime_error(" the connection is not found! \n ");
+        const auto pos = this->m_connections.size() - 1;
+        this->m_lookup->insert(this->m_connections[pos], pos);
     }
 
     bool WellConnections::allConnectionsShut() const
@@ -900,6 +995,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
             return;
         }
 
+        this->m_lookup.reset();
+
         if (this->m_connections[0].attachedToSegment()) {
             this->orderMSW();
         }
@@ -1005,6 +1102,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
         auto new_end = std::remove_if(m_connections.begin(), m_connections.end(), isInactive);
         m_connections.erase(new_end, m_connections.end());
+        this->m_lookup.reset();
     }
 
     double WellConnections::segment_perf_length(int segment) const
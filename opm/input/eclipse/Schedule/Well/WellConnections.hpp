@@ -25,8 +25,10 @@
 
 #include <array>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -49,6 +51,16 @@ namespace Opm {
     public:
         using const_iterator = std::vector<Connection>::const_iterator;
 
+        /// Connection properties in structure-of-arrays layout, one
+        /// element per connection in the order of the connection set.
+        struct PropertyArrays
+        {
+            std::vector<std::size_t> global_index{};
+            std::vector<double> CF{};
+            std::vector<double> Kh{};
+            std::vector<double> depth{};
+        };
+
         WellConnections() = default;
         WellConnections(const Connection::Order ordering, const int headI, const int headJ);
         WellConnections(const Connection::Order ordering, const int headI, const int headJ,
@@ -73,6 +85,7 @@ namespace Opm {
         void add(const Connection& conn)
         {
             this->m_connections.push_back(conn);
+            this->appendedConnection();
         }
 
         void addConnection(const int i, const int j, const int k,
@@ -121,6 +134,10 @@ namespace Opm {
         bool hasGlobalIndex(std::size_t global_index) const;
         double segment_perf_length(int segment) const;
 
+        /// Export global cell index, CF, Kh and depth of all connections
+        /// as contiguous arrays.
+        PropertyArrays propertyArrays() const;
+
         const_iterator begin() const { return this->m_connections.begin(); }
         const_iterator end() const { return this->m_connections.end(); }
         void filter(const ActiveGridCells& grid);
@@ -174,6 +191,10 @@ namespace Opm {
             serializer(this->m_connections);
             serializer(this->coord);
             serializer(this->md);
+
+            if (! serializer.isSerializing()) {
+                this->m_lookup.reset();
+            }
         }
 
     private:
@@ -185,6 +206,31 @@ namespace Opm {
         std::array<std::vector<double>, 3> coord{};
         std::vector<double> md{};
 
+        struct IJKHash
+        {
+            std::size_t operator()(const std::array<int, 3>& ijk) const;
+        };
+
+        // Position of the first connection in each cell, by (I,J,K) and
+        // by global cell index.  Built by the first lookup, extended when
+        // connections are appended and reset when connections are removed
+        // or reordered.  Copies of the connection set share the table
+        // until one of them is modified.
+        struct LookupTable
+        {
+            std::unordered_map<std::array<int, 3>, std::size_t, IJKHash> ijk{};
+            std::unordered_map<std::size_t, std::size_t> global_index{};
+
+            void insert(const Connection& conn, std::size_t pos);
+        };
+
+        mutable std::shared_ptr<LookupTable> m_lookup{};
+
+        std::shared_ptr<const LookupTable> lookupTable() const;
+        LookupTable& ownLookupTable();
+        std::vector<Connection>::iterator findConnection(int i, int j, int k);
+        void appendedConnection();
+
         void addConnection(const int i, const int j, const int k,
                            const std::size_t global_index,
                            const int complnum,
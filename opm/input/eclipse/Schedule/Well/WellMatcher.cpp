@@ -19,12 +19,10 @@
 
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 
-#include <opm/common/utility/shmatch.hpp>
-
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <initializer_list>
-#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -186,17 +184,7 @@ Opm::WellMatcher::wells(const std::string& pattern) const
 
     // Normal pattern matching
     if (patt.find('*') != std::string::npos) {
-        auto names = std::vector<std::string> {};
-        names.reserve(this->m_well_order->size());
-
-        std::copy_if(this->m_well_order->begin(),
-                     this->m_well_order->end(),
-                     std::back_inserter(names),
-                     [&patt](const auto& wname)
-                     { return shmatch(patt, wname); });
-
-        names.shrink_to_fit();
-        return names;
+        return this->m_well_order->match(patt);
     }
 
     if (this->m_well_order->has(patt)) {
@@ -205,3 +193,21 @@ Opm::WellMatcher::wells(const std::string& pattern) const
 
     return {};
 }
+
+std::vector<std::size_t>
+Opm::WellMatcher::wellIndices(const std::string& pattern) const
+{
+    const auto names = this->wells(pattern);
+
+    auto indices = std::vector<std::size_t>{};
+    indices.reserve(names.size());
+
+    for (const auto& wname : names) {
+        const auto index = this->m_well_order->index(wname);
+        if (index.has_value()) {
+            indices.push_back(*index);
+        }
+    }
+
+    return indices;
+}
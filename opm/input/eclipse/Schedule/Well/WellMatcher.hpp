@@ -22,6 +22,7 @@
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
 #include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <initializer_list>
 #include <memory>
@@ -126,6 +127,19 @@ public:
     /// name order.
     std::vector<std::string> wells(const std::string& pattern) const;
 
+    /// Retrieve sorted list of insertion indices of wells matching a
+    /// pattern.
+    ///
+    /// The indices equal Well::seqIndex() and may be used with the index
+    /// based Schedule::getWell() overload.
+    ///
+    /// \param[in] pattern Well name, well template, well list name or well
+    /// list template.
+    ///
+    /// \return Insertion indices of the unique wells matching \p pattern,
+    /// in increasing order.
+    std::vector<std::size_t> wellIndices(const std::string& pattern) const;
+
     /// Retrieve list of known wells.
     const std::vector<std::string>& wells() const;
 
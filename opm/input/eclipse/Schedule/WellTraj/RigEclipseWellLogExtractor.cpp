@@ -36,7 +36,10 @@
 #include <external/resinsight/CommonCode/cvfStructGrid.h>
 #include <external/resinsight/LibGeometry/cvfBoundingBox.h>
 
+#include <array>
+#include <cstddef>
 #include <map>
+#include <vector>
 
 
 namespace external {
@@ -186,17 +189,20 @@ void RigEclipseWellLogExtractor::findCellLocalXYZ( const std::array<cvf::Vec3d,
 // Convert opm to resinsight numbering of cornerpoints, see RigCellGeometryTools.cpp
 void RigEclipseWellLogExtractor::hexCornersOpmToResinsight( cvf::Vec3d hexCorners[8], size_t cellIndex ) const
 {
-    const auto[i,j,k] = m_grid.getIJK(cellIndex);
+    const auto corners = m_grid.getCornerPositions(cellIndex);
     std::array<std::size_t, 8> opm2resinsight = {0, 1, 3, 2, 4, 5, 7, 6};
-   
+
     for (std::size_t l = 0; l < 8; l++) {
-         std::array<double, 3> cornerPointArray;
-         cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-         hexCorners[opm2resinsight[l]]= cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-    } 
+         hexCorners[opm2resinsight[l]]= cvf::Vec3d(corners[l][0], corners[l][1], corners[l][2]);
+    }
 }
 
 // Modified version of ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
+//
+// The bounding boxes are computed in parallel into one slot per cell and
+// then compacted in cell order, so the tree does not depend on the number
+// of threads.  The tree is built once per grid and passed on to the next
+// extractor through getCellSearchTree().
 void RigEclipseWellLogExtractor::buildCellSearchTree()
 {
     if (m_cellSearchTree.isNull()) {
@@ -205,52 +211,36 @@ void RigEclipseWellLogExtractor::buildCellSearchTree()
         auto ny = m_grid.getNY();
         auto nz = m_grid.getNZ();
 
-        size_t cellCount = nx * ny * nz;
-        std::vector<size_t>           cellIndicesForBoundingBoxes;
-        std::vector<cvf::BoundingBox> cellBoundingBoxes;
-
-// #pragma omp parallel
-//         {
-            size_t threadCellCount = cellCount;
-
-            std::vector<size_t>           threadIndicesForBoundingBoxes;
-            std::vector<cvf::BoundingBox> threadBoundingBoxes;
-
-            threadIndicesForBoundingBoxes.reserve( threadCellCount );
-            threadBoundingBoxes.reserve( threadCellCount );
-
-            std::array<double, 3> cornerPointArray;
-            cvf::Vec3d cornerPoint;
-
-// #pragma omp for
-            for (int cIdx = 0; cIdx < (int)cellCount; ++cIdx) {
-                const auto[i,j,k] = m_grid.getIJK(cIdx);
-                cvf::BoundingBox cellBB;
-                for (std::size_t l = 0; l < 8; l++) {
-                     cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-                     cornerPoint = cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-                     cellBB.add(cornerPoint);
-                }
-
-                if (cellBB.isValid()) {
-                    threadIndicesForBoundingBoxes.emplace_back(cIdx);
-                    threadBoundingBoxes.emplace_back(cellBB);
-                }
+        const auto cellCount = static_cast<std::ptrdiff_t>(nx * ny * nz);
+        std::vector<cvf::BoundingBox> cellBoundingBoxes(cellCount);
+
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t cIdx = 0; cIdx < cellCount; ++cIdx) {
+            const auto corners = m_grid.getCornerPositions(cIdx);
+
+            auto& cellBB = cellBoundingBoxes[cIdx];
+            for (const auto& corner : corners) {
+                cellBB.add(cvf::Vec3d(corner[0], corner[1], corner[2]));
             }
+        }
+
+        std::vector<size_t> cellIndicesForBoundingBoxes;
+        cellIndicesForBoundingBoxes.reserve(cellCount);
+
+        std::size_t numValid = 0;
+        for (std::ptrdiff_t cIdx = 0; cIdx < cellCount; ++cIdx) {
+            if (cellBoundingBoxes[cIdx].isValid()) {
+                cellIndicesForBoundingBoxes.push_back(cIdx);
+                cellBoundingBoxes[numValid++] = cellBoundingBoxes[cIdx];
+            }
+        }
+
+        cellBoundingBoxes.resize(numValid);
+        cellBoundingBoxes.shrink_to_fit();
+        cellIndicesForBoundingBoxes.shrink_to_fit();
 
-            threadIndicesForBoundingBoxes.shrink_to_fit();
-            threadBoundingBoxes.shrink_to_fit();
-// #pragma omp critical
-//          {
-             cellIndicesForBoundingBoxes.insert( cellIndicesForBoundingBoxes.end(),
-                                                 threadIndicesForBoundingBoxes.begin(),
-                                                 threadIndicesForBoundingBoxes.end() );
-
-             cellBoundingBoxes.insert( cellBoundingBoxes.end(), threadBoundingBoxes.begin(), threadBoundingBoxes.end() );
-        //  }
-    // } #pragma omp parallel
-         m_cellSearchTree = new cvf::BoundingBoxTree;
-         m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
+        m_cellSearchTree = new cvf::BoundingBoxTree;
+        m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
     }
 }
 
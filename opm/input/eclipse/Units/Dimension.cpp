@@ -72,6 +72,11 @@ namespace Opm {
     }
 
 
+    bool Dimension::isContextDependent() const
+    {
+        return !std::isfinite(m_SIfactor);
+    }
+
     // only dimensions with zero offset are compositable...
     bool Dimension::isCompositable() const
     { return m_SIoffset == 0.0; }
@@ -40,6 +40,8 @@ namespace Opm {
 
         bool equal(const Dimension& other) const;
         bool isCompositable() const;
+        // true for context dependent units, which have no SI factor
+        bool isContextDependent() const;
 
         bool operator==( const Dimension& ) const;
         bool operator!=( const Dimension& ) const;
@@ -1622,18 +1622,40 @@ namespace {
     }
 
     void UnitSystem::from_si( measure m, std::vector<double>& data ) const {
-        double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return (x - offset) * factor; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->from_si( m, data.data(), data.data(), data.size() );
     }
 
 
     void UnitSystem::to_si( measure m, std::vector<double>& data) const {
-        double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return x * factor + offset; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->to_si( m, data.data(), data.data(), data.size() );
+    }
+
+
+    void UnitSystem::from_si( measure m, const double* src, double* dst, std::size_t n ) const {
+        const double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+
+        for (std::size_t i = 0; i < n; ++i)
+            dst[i] = (src[i] - offset) * factor;
+    }
+
+
+    void UnitSystem::to_si( measure m, const double* src, double* dst, std::size_t n ) const {
+        const double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+
+        for (std::size_t i = 0; i < n; ++i)
+            dst[i] = src[i] * factor + offset;
+    }
+
+
+    void UnitSystem::from_si( measure m, const std::vector<double>& src, std::vector<float>& dst ) const {
+        const double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+
+        dst.resize(src.size());
+        for (std::size_t i = 0; i < src.size(); ++i)
+            dst[i] = static_cast<float>((src[i] - offset) * factor);
     }
 
     const char* UnitSystem::name( measure m ) const {
@@ -24,6 +24,9 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
+#include <opm/common/utility/ConcurrentCounter.hpp>
+
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -123,6 +126,16 @@ namespace Opm {
         double to_si( measure, double ) const;
         void from_si( measure, std::vector<double>& ) const;
         void to_si( measure, std::vector<double>& ) const;
+
+        // Convert the n values at src into dst, which may be the same
+        // array as src.  The factor and offset of the measure are looked
+        // up once and the loop is free to vectorize.
+        void from_si( measure, const double* src, double* dst, std::size_t n ) const;
+        void to_si( measure, const double* src, double* dst, std::size_t n ) const;
+
+        // Convert from SI and round to single precision in one pass, for
+        // REAL output arrays.  Resizes dst to the size of src.
+        void from_si( measure, const std::vector<double>& src, std::vector<float>& dst ) const;
         const char* name( measure ) const;
         std::string deck_name() const;
         std::size_t use_count() const;
@@ -175,7 +188,7 @@ namespace Opm {
 
 
         */
-        mutable std::size_t m_use_count = 0;
+        mutable ConcurrentCounter m_use_count{};
     };
 
 } // namespace Opm
@@ -0,0 +1,313 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Utility/InputProfile.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    struct Entry
+    {
+        std::size_t count{0};
+        double seconds{0.0};
+        std::size_t bytes{0};
+    };
+
+    using Category = std::map<std::string, Entry, std::less<>>;
+
+    struct State
+    {
+        std::atomic<bool> enabled{false};
+        std::atomic<int> format{static_cast<int>(Opm::InputProfile::Format::CSV)};
+        std::atomic<int> phase_depth{0};
+        std::atomic<bool> auto_report{true};
+
+        std::mutex lock{};
+        std::map<std::string, Category, std::less<>> entries{};
+
+        State()
+        {
+            const char* env = std::getenv("OPM_INPUT_PROFILE");
+            if (env == nullptr)
+                return;
+
+            const std::string_view value { env };
+            if ((value == "csv") || (value == "CSV")) {
+                this->enabled = true;
+            }
+            else if ((value == "json") || (value == "JSON")) {
+                this->format = static_cast<int>(Opm::InputProfile::Format::JSON);
+                this->enabled = true;
+            }
+            else if ((value == "folded") || (value == "FOLDED")) {
+                this->format = static_cast<int>(Opm::InputProfile::Format::Folded);
+                this->enabled = true;
+            }
+        }
+    };
+
+    State& state()
+    {
+        static State s;
+        return s;
+    }
+
+    std::string csvField(const std::string& s)
+    {
+        if (s.find_first_of(",\"\n") == std::string::npos)
+            return s;
+
+        std::string quoted = "\"";
+        for (const auto c : s) {
+            if (c == '"')
+                quoted += '"';
+            quoted += c;
+        }
+        return quoted + '"';
+    }
+
+    std::string jsonString(const std::string& s)
+    {
+        std::string quoted = "\"";
+        for (const auto c : s) {
+            switch (c) {
+            case '"':  quoted += "\\\""; break;
+            case '\\': quoted += "\\\\"; break;
+            case '\n': quoted += "\\n"; break;
+            case '\t': quoted += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    quoted += fmt::format("\\u{:04x}", static_cast<int>(c));
+                else
+                    quoted += c;
+            }
+        }
+        return quoted + '"';
+    }
+
+    // Semicolons separate the frames of a folded stack.
+    std::string foldedFrame(std::string s)
+    {
+        std::replace(s.begin(), s.end(), ';', ':');
+        std::replace(s.begin(), s.end(), '\n', ' ');
+        return s;
+    }
+
+    const char* formatName(const Opm::InputProfile::Format format)
+    {
+        switch (format) {
+        case Opm::InputProfile::Format::CSV: return "csv";
+        case Opm::InputProfile::Format::JSON: return "json";
+        case Opm::InputProfile::Format::Folded: return "folded";
+        }
+        return "";
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+bool InputProfile::enabled()
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+void InputProfile::enable(const Format format)
+{
+    state().format = static_cast<int>(format);
+    state().enabled = true;
+}
+
+void InputProfile::disable()
+{
+    state().enabled = false;
+}
+
+void InputProfile::record(std::string_view category,
+                          std::string_view name,
+                          const double seconds,
+                          const std::size_t bytes)
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+
+    auto cat = s.entries.find(category);
+    if (cat == s.entries.end())
+        cat = s.entries.emplace(std::string { category }, Category{}).first;
+
+    auto pos = cat->second.find(name);
+    if (pos == cat->second.end())
+        pos = cat->second.emplace(std::string { name }, Entry{}).first;
+
+    pos->second.count += 1;
+    pos->second.seconds += seconds;
+    pos->second.bytes += bytes;
+}
+
+std::vector<InputProfile::Record> InputProfile::records()
+{
+    std::vector<Record> entries;
+    {
+        auto& s = state();
+        std::lock_guard<std::mutex> guard { s.lock };
+        for (const auto& [category, names] : s.entries) {
+            for (const auto& [name, entry] : names)
+                entries.push_back({ category, name, entry.count, entry.seconds, entry.bytes });
+        }
+    }
+
+    // Most expensive first within each category.
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const auto& e1, const auto& e2)
+                     {
+                         if (e1.category != e2.category)
+                             return e1.category < e2.category;
+                         return e1.seconds > e2.seconds;
+                     });
+
+    return entries;
+}
+
+std::string InputProfile::report(const Format format)
+{
+    const auto entries = InputProfile::records();
+
+    std::ostringstream os;
+    if (format == Format::CSV) {
+        os << "category,name,count,seconds,bytes\n";
+        for (const auto& entry : entries) {
+            os << csvField(entry.category) << ',' << csvField(entry.name) << ','
+               << entry.count << ',' << fmt::format("{:.6f}", entry.seconds)
+               << ',' << entry.bytes << '\n';
+        }
+    }
+    else if (format == Format::JSON) {
+        os << "[";
+        const char* sep = "\n";
+        for (const auto& entry : entries) {
+            os << sep << fmt::format(R"(  {{"category": {}, "name": {}, "count": {}, "seconds": {:.6f}, "bytes": {}}})",
+                                     jsonString(entry.category), jsonString(entry.name),
+                                     entry.count, entry.seconds, entry.bytes);
+            sep = ",\n";
+        }
+        os << "\n]\n";
+    }
+    else {
+        for (const auto& entry : entries) {
+            os << foldedFrame(entry.category) << ';' << foldedFrame(entry.name) << ' '
+               << static_cast<long long>(entry.seconds * 1.0e6 + 0.5) << '\n';
+        }
+    }
+
+    return os.str();
+}
+
+void InputProfile::clear()
+{
+    auto& s = state();
+    std::lock_guard<std::mutex> guard { s.lock };
+    s.entries.clear();
+}
+
+void InputProfile::setAutoReport(const bool autoReport)
+{
+    state().auto_report = autoReport;
+}
+
+// ---------------------------------------------------------------------------
+
+InputProfile::Scope::Scope(const char* category,
+                           std::string_view name,
+                           const std::size_t bytes)
+    : active_ { InputProfile::enabled() }
+{
+    if (! this->active_)
+        return;
+
+    this->category_ = category;
+    this->name_ = name;
+    this->bytes_ = bytes;
+    this->start_ = std::chrono::steady_clock::now();
+}
+
+InputProfile::Scope::~Scope()
+{
+    if (! this->active_)
+        return;
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - this->start_;
+
+    InputProfile::record(this->category_, this->name_, elapsed.count(), this->bytes_);
+}
+
+void InputProfile::Scope::addBytes(const std::size_t bytes)
+{
+    this->bytes_ += bytes;
+}
+
+// ---------------------------------------------------------------------------
+
+InputProfile::Phase::Phase(const char* name)
+    : active_ { InputProfile::enabled() }
+{
+    if (! this->active_)
+        return;
+
+    this->name_ = name;
+    this->outermost_ = state().phase_depth++ == 0;
+    this->start_ = std::chrono::steady_clock::now();
+}
+
+InputProfile::Phase::~Phase()
+{
+    if (! this->active_)
+        return;
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - this->start_;
+
+    InputProfile::record("phase", this->name_, elapsed.count());
+    --state().phase_depth;
+
+    if (! this->outermost_ || ! state().auto_report)
+        return;
+
+    const auto format = static_cast<Format>(state().format.load());
+    OpmLog::info(fmt::format("Input profile ({}):\n{}",
+                             formatName(format),
+                             InputProfile::report(format)));
+    InputProfile::clear();
+}
+
+} // namespace Opm
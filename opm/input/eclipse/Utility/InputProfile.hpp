@@ -0,0 +1,127 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_INPUT_PROFILE_HPP
+#define OPM_INPUT_PROFILE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm {
+
+/// Run time instrumentation of the input processing.
+///
+/// Unlike OPM_TIMEBLOCK, which requires a build with Tracy, the profile
+/// is always compiled in and switched on at run time, either with
+/// enable() or by setting the environment variable OPM_INPUT_PROFILE to
+/// "csv", "json" or "folded".  When disabled a Scope costs a single atomic load.
+///
+/// Entries are aggregated by category and name, e.g. the category
+/// "include" with one entry per input file, or "keyword" with one entry
+/// per deck keyword, and hold the number of calls, the accumulated wall
+/// time and the accumulated number of input bytes.  When the outermost
+/// Phase, such as the Parser or Schedule construction, ends, the entries
+/// collected so far are written as a report through OpmLog::info() and
+/// cleared, unless setAutoReport(false) leaves that to the application.
+class InputProfile
+{
+public:
+    enum class Format {
+        CSV,
+        JSON,
+        /// One "category;name microseconds" line per entry, the folded
+        /// stack format of flamegraph.pl and speedscope.
+        Folded,
+    };
+
+    struct Record
+    {
+        std::string category{};
+        std::string name{};
+        std::size_t count{0};
+        double seconds{0.0};
+        std::size_t bytes{0};
+    };
+
+    static bool enabled();
+    static void enable(Format format);
+    static void disable();
+
+    static void record(std::string_view category,
+                       std::string_view name,
+                       double seconds,
+                       std::size_t bytes = 0);
+
+    /// All entries, by category and with the most expensive first
+    /// within each category.
+    static std::vector<Record> records();
+
+    static std::string report(Format format);
+    static void clear();
+
+    /// Whether the outermost Phase writes and clears the report.
+    /// Default true.  Applications which collect the records
+    /// themselves, e.g. per stage, switch it off.
+    static void setAutoReport(bool autoReport);
+
+    /// Time the lifetime of the object as one call of category/name.
+    class Scope
+    {
+    public:
+        Scope(const char* category, std::string_view name, std::size_t bytes = 0);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        void addBytes(std::size_t bytes);
+
+    private:
+        bool active_{false};
+        const char* category_{nullptr};
+        std::string name_{};
+        std::size_t bytes_{0};
+        std::chrono::steady_clock::time_point start_{};
+    };
+
+    /// Time the lifetime of the object in the category "phase".  The
+    /// outermost Phase additionally writes and clears the report.
+    class Phase
+    {
+    public:
+        explicit Phase(const char* name);
+        ~Phase();
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+    private:
+        bool active_{false};
+        bool outermost_{false};
+        const char* name_{nullptr};
+        std::chrono::steady_clock::time_point start_{};
+    };
+};
+
+} // namespace Opm
+
+#endif // OPM_INPUT_PROFILE_HPP
@@ -21,6 +21,7 @@
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/numeric/calculateCellVol.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -360,11 +361,154 @@ void EGrid::mapaxes_init()
     unit_y[1] *= norm_y;
 }
 
+void EGrid::memoryMapGeometry()
+{
+    if (formatted)
+        throw std::invalid_argument("memory mapped grid geometry not possible when using formatted input");
+
+    m_coord_view = this->getView<float>(coord_array_index);
+    m_zcorn_view = this->getView<float>(zcorn_array_index);
+
+    m_mapped_geometry = true;
+}
+
+int EGrid::column_key(const std::array<int, 3>& ijk) const
+{
+    return (res.at(ijk[2]) * nijk[1] + ijk[1]) * nijk[0] + ijk[0];
+}
+
+EGrid::ColumnPillars EGrid::column_pillars(const std::array<int, 3>& ijk) const
+{
+    const auto coord = [this](const int ix) -> double
+    {
+        return m_mapped_geometry ? m_coord_view[ix] : coord_array[ix];
+    };
+
+    const int res_shift = res.at(ijk[2])*(nijk[0]+1)*(nijk[1]+1)*6;
+    const int p0 = res_shift + ijk[1]*(nijk[0]+1)*6 + ijk[0]*6;
+
+    const std::array<int, 4> pind = { p0, p0 + 6, p0 + (nijk[0]+1)*6, p0 + (nijk[0]+1)*6 + 6 };
+
+    ColumnPillars pillars;
+
+    for (int n = 0; n < 4; n++) {
+        double xt;
+        double yt;
+        double xb;
+        double yb;
+
+        const double zt = coord(pind[n] + 2);
+        const double zb = coord(pind[n] + 5);
+
+        if (m_radial) {
+            xt = coord(pind[n]) * cos(coord(pind[n] + 1) / 180.0 * M_PI);
+            yt = coord(pind[n]) * sin(coord(pind[n] + 1) / 180.0 * M_PI);
+            xb = coord(pind[n] + 3) * cos(coord(pind[n] + 4) / 180.0 * M_PI);
+            yb = coord(pind[n] + 3) * sin(coord(pind[n] + 4) / 180.0 * M_PI);
+        } else {
+            xt = coord(pind[n]);
+            yt = coord(pind[n] + 1);
+            xb = coord(pind[n] + 3);
+            yb = coord(pind[n] + 4);
+        }
+
+        if (zt == zb)
+            pillars[n] = { xt, yt, zt, 0.0, 0.0 };
+        else
+            pillars[n] = { xt, yt, zt, (xb-xt) / (zt-zb), (yb-yt) / (zt-zb) };
+    }
+
+    return pillars;
+}
+
+const EGrid::ColumnPillars& EGrid::cached_column_pillars(const std::array<int, 3>& ijk)
+{
+    const auto key = column_key(ijk);
+
+    auto pos = m_column_pillars.find(key);
+    if (pos == m_column_pillars.end())
+        pos = m_column_pillars.emplace(key, column_pillars(ijk)).first;
+
+    return pos->second;
+}
+
+void EGrid::column_cell_corners(const ColumnPillars& pillars, const std::array<int, 3>& ijk,
+                                std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z) const
+{
+    const int z0 = ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2;
+    const int z2 = z0 + nijk[0]*2;
+    const int layer = nijk[0]*nijk[1]*4;
+
+    const std::array<int, 8> zind = { z0, z0 + 1, z2, z2 + 1,
+                                      z0 + layer, z0 + 1 + layer, z2 + layer, z2 + 1 + layer };
+
+    for (int n = 0; n < 8; n++)
+        Z[n] = m_mapped_geometry ? m_zcorn_view[zind[n]] : zcorn_array[zind[n]];
+
+    for (int n = 0; n < 8; n++) {
+        const auto& p = pillars[n % 4];
+        X[n] = p.xt + p.dx * (p.zt - Z[n]);
+        Y[n] = p.yt + p.dy * (p.zt - Z[n]);
+    }
+}
+
+EGrid::CellGeometry EGrid::cellGeometry(const std::vector<int>& globalIndex)
+{
+    const auto num = globalIndex.size();
+
+    std::vector<std::array<int, 3>> ijk;
+    ijk.reserve(num);
+
+    for (const auto& ind : globalIndex)
+        ijk.push_back(ijk_from_global_index(ind));
+
+    // Pillars of the requested columns are cached up front such that the
+    // cells can be evaluated concurrently.
+
+    std::vector<const ColumnPillars*> pillars(num, nullptr);
+
+    if (m_mapped_geometry) {
+        for (std::size_t n = 0; n < num; n++)
+            pillars[n] = &cached_column_pillars(ijk[n]);
+    } else if (coord_array.empty()) {
+        load_grid_data();
+    }
+
+    CellGeometry geometry;
+    geometry.x.resize(num);
+    geometry.y.resize(num);
+    geometry.z.resize(num);
+    geometry.volume.resize(num);
+
+#pragma omp parallel for
+    for (std::ptrdiff_t n = 0; n < static_cast<std::ptrdiff_t>(num); n++) {
+        std::array<double, 8> X, Y, Z;
+
+        if (pillars[n] != nullptr)
+            column_cell_corners(*pillars[n], ijk[n], X, Y, Z);
+        else
+            column_cell_corners(column_pillars(ijk[n]), ijk[n], X, Y, Z);
+
+        geometry.x[n] = std::accumulate(X.begin(), X.end(), 0.0) / 8.0;
+        geometry.y[n] = std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0;
+        geometry.z[n] = std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0;
+        geometry.volume[n] = calculateCellVol(X, Y, Z);
+    }
+
+    return geometry;
+}
+
 void EGrid::getCellCorners(const std::array<int, 3>& ijk,
                            std::array<double, 8>& X,
                            std::array<double, 8>& Y,
                            std::array<double, 8>& Z)
 {
+    if (m_mapped_geometry && coord_array.empty()) {
+        global_index(ijk[0], ijk[1], ijk[2]);  // range check
+        column_cell_corners(cached_column_pillars(ijk), ijk, X, Y, Z);
+        return;
+    }
+
     if (coord_array.empty())
         load_grid_data();
 
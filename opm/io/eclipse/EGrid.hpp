@@ -24,6 +24,7 @@
 #include <array>
 #include <filesystem>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <map>
 
@@ -53,6 +54,30 @@ public:
 
     void load_grid_data();
     void load_nnc_data();
+
+    /// Evaluate cell geometry directly from the memory mapped grid file.
+    ///
+    /// COORD and ZCORN are then never loaded into memory.  Cell corners
+    /// are computed on request, and the pillar interpolation of each I-J
+    /// column is evaluated once and reused for all cells in that column.
+    /// Intended for tools that need the geometry of a small subset of
+    /// cells in very large grids.  Only supported for binary files.
+    void memoryMapGeometry();
+    bool mappedGeometry() const { return m_mapped_geometry; }
+
+    /// Centres and bulk volumes of a list of cells, in structure of
+    /// arrays form.  Element n of each vector belongs to the n-th cell of
+    /// the request.  Cell centres are the average of the eight corners.
+    struct CellGeometry
+    {
+        std::vector<double> x{};
+        std::vector<double> y{};
+        std::vector<double> z{};
+        std::vector<double> volume{};
+    };
+
+    CellGeometry cellGeometry(const std::vector<int>& globalIndex);
+
     bool with_mapaxes() const { return m_mapaxes_loaded; }
     void mapaxes_transform(double& x, double& y) const;
     bool is_radial() const { return m_radial; }
@@ -93,6 +118,20 @@ private:
     std::vector<float> coord_array;
     std::vector<float> zcorn_array;
 
+    // Straight pillar through (xt, yt, zt), with X = xt + dx * (zt - z)
+    // and Y = yt + dy * (zt - z).
+    struct PillarLine
+    {
+        double xt, yt, zt, dx, dy;
+    };
+
+    using ColumnPillars = std::array<PillarLine, 4>;
+
+    bool m_mapped_geometry = false;
+    EclArrayView<float> m_coord_view;
+    EclArrayView<float> m_zcorn_view;
+    std::unordered_map<int, ColumnPillars> m_column_pillars;
+
     std::vector<int> nnc1_array;
     std::vector<int> nnc2_array;
     std::vector<float> transnnc_array;
@@ -116,7 +155,13 @@ private:
                         std::array<double, 4>& X, std::array<double, 4>& Y, std::array<double, 4>& Z);
 
     void mapaxes_init();
-    
+
+    int column_key(const std::array<int, 3>& ijk) const;
+    ColumnPillars column_pillars(const std::array<int, 3>& ijk) const;
+    const ColumnPillars& cached_column_pillars(const std::array<int, 3>& ijk);
+    void column_cell_corners(const ColumnPillars& pillars, const std::array<int, 3>& ijk,
+                             std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z) const;
+
 };
 
 }} // namespace Opm::EclIO
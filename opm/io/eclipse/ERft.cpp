@@ -18,18 +18,40 @@
 
 #include <opm/io/eclipse/ERft.hpp>
 
+#include <opm/io/eclipse/EclOutput.hpp>
+
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <cstring>
+#include <exception>
+#include <filesystem>
 #include <iterator>
 #include <string>
+#include <system_error>
+
+namespace {
+    // Version of the index file layout.  Index files with a different
+    // version are ignored.
+    constexpr int indexFileVersion = 1;
+}
 
 namespace Opm { namespace EclIO {
 
-ERft::ERft(const std::string &filename) : EclFile(filename)
+ERft::ERft(const std::string &filename)
+    : EclFile(filename, EclFile::DeferredLoad{})
+{
+    if (this->loadIndexFile()) {
+        return;
+    }
+
+    this->load(false);
+    this->scanReports();
+}
+
+
+void ERft::scanReports()
 {
-    loadData();
     std::vector<int> first;
 
     std::vector<std::string> wellName;
@@ -37,6 +59,22 @@ ERft::ERft(const std::string &filename) : EclFile(filename)
 
     auto listOfArrays = getList();
 
+    // Only the report headers are needed to index the file.  All other
+    // arrays are read on first access.
+    {
+        std::vector<int> headerArrays;
+
+        for (size_t i = 0; i < listOfArrays.size(); i++) {
+            const auto& name = std::get<0>(listOfArrays[i]);
+
+            if ((name == "TIME") || (name == "DATE") || (name == "WELLETC")) {
+                headerArrays.push_back(i);
+            }
+        }
+
+        loadData(headerArrays);
+    }
+
     for (size_t i = 0; i < listOfArrays.size(); i++) {
         std::string name = std::get<0>(listOfArrays[i]);
 
@@ -48,22 +86,27 @@ ERft::ERft(const std::string &filename) : EclFile(filename)
 
         if (name == "DATE") {
             auto vect1 = get<int>(i);
-            RftDate date(vect1[2],vect1[1],vect1[0]);
-            dateList.insert(date);
-            dates.push_back(date);
+            dates.emplace_back(vect1[2],vect1[1],vect1[0]);
         }
 
         if (name == "WELLETC"){
             auto vect1 = get<std::string>(i);
-            wellList.insert(vect1[1]);
             wellName.push_back(vect1[1]);
         }
     }
 
+    this->initReports(first, wellName, dates);
+}
+
+
+void ERft::initReports(const std::vector<int>& first,
+                       const std::vector<std::string>& wellName,
+                       const std::vector<RftDate>& dates)
+{
     for (size_t i = 0; i < first.size(); i++) {
         std::tuple<int,int> range;
         if (i == first.size() - 1) {
-            range = std::make_tuple(first[i], listOfArrays.size());
+            range = std::make_tuple(first[i], array_name.size());
         } else {
             range = std::make_tuple(first[i], first[i+1]);
         }
@@ -73,12 +116,179 @@ ERft::ERft(const std::string &filename) : EclFile(filename)
 
     numReports = first.size();
 
+    wellList.insert(wellName.begin(), wellName.end());
+    dateList.insert(dates.begin(), dates.end());
+
     for (size_t i = 0; i < wellName.size(); i++) {
         std::tuple<std::string, RftDate> wellDateTuple = std::make_tuple(wellName[i], dates[i]);
         std::tuple<std::string, RftDate, float> wellDateTimeTuple = std::make_tuple(wellName[i], dates[i], timeList[i]);
         reportIndices[wellDateTuple] = i;
         rftReportList.push_back(wellDateTimeTuple);
     }
+
+    reportWells = wellName;
+    reportDates = dates;
+}
+
+
+std::string ERft::indexFileName(const std::string& filename)
+{
+    return filename + ".INDEX";
+}
+
+
+bool ERft::loadIndexFile()
+{
+    const auto indexFile = indexFileName(this->inputFilename);
+
+    auto ec = std::error_code{};
+    if (! std::filesystem::is_regular_file(indexFile, ec)) {
+        return false;
+    }
+
+    try {
+        EclFile index(indexFile, EclFile::Formatted{ false });
+
+        if (! this->readArrayDirectory(index, indexFileVersion)) {
+            return false;
+        }
+
+        const auto n = static_cast<int>(this->array_name.size());
+
+        const auto& first = index.get<int>("FIRSTIND");
+        const auto& times = index.get<float>("RFTTIME");
+        const auto& dateValues = index.get<int>("RFTDATE");
+        const auto wells = index.hasKey("WELLS")
+            ? index.get<std::string>("WELLS")
+            : std::vector<std::string>{};
+
+        const auto numRep = first.size();
+        if ((times.size() != numRep) || (dateValues.size() != 3*numRep) ||
+            (wells.size() != numRep) ||
+            ! std::is_sorted(first.begin(), first.end()) ||
+            std::any_of(first.begin(), first.end(),
+                        [n](const int i) { return (i < 0) || (i >= n); }))
+        {
+            this->clearArrayList();
+            return false;
+        }
+
+        auto dates = std::vector<RftDate>{};
+        dates.reserve(numRep);
+        for (std::size_t i = 0; i < numRep; ++i) {
+            dates.emplace_back(dateValues[3*i + 0], dateValues[3*i + 1], dateValues[3*i + 2]);
+        }
+
+        this->timeList = times;
+        this->initReports(first, wells, dates);
+    }
+    catch (const std::exception&) {
+        // Unreadable or incomplete index.  Fall back to scanning.
+        this->clearArrayList();
+        this->timeList.clear();
+
+        return false;
+    }
+
+    this->fromIndexFile = true;
+
+    return true;
+}
+
+
+void ERft::writeIndexFile() const
+{
+    auto first = std::vector<int>{};
+    auto dates = std::vector<int>{};
+
+    for (int i = 0; i < numReports; ++i) {
+        first.push_back(std::get<0>(arrIndexRange.at(i)));
+
+        const auto& [year, month, day] = reportDates[i];
+        dates.insert(dates.end(), { year, month, day });
+    }
+
+    const auto indexFile = indexFileName(this->inputFilename);
+    const auto tmpFile = indexFile + ".tmp";
+
+    {
+        EclOutput outFile(tmpFile, false, std::ios::out);
+
+        this->writeArrayDirectory(outFile, indexFileVersion);
+
+        outFile.write<int>("FIRSTIND", first);
+        outFile.write<float>("RFTTIME", timeList);
+        outFile.write<int>("RFTDATE", dates);
+        if (! reportWells.empty()) {
+            outFile.write<std::string>("WELLS", reportWells);
+        }
+    }
+
+    std::filesystem::rename(tmpFile, indexFile);
+}
+
+
+bool ERft::isLoaded(const int arrInd) const
+{
+    switch (array_type[arrInd]) {
+    case INTE: return inte_array.count(arrInd) > 0;
+    case REAL: return real_array.count(arrInd) > 0;
+    case DOUB: return doub_array.count(arrInd) > 0;
+    case LOGI: return logi_array.count(arrInd) > 0;
+    case CHAR:
+    case C0NN: return char_array.count(arrInd) > 0;
+    default:   return true;
+    }
+}
+
+
+void ERft::loadRft(const std::vector<std::string>& names,
+                   const std::vector<RftKey>& reports) const
+{
+    std::vector<int> arrIndex;
+
+    for (const auto& [wellName, date] : reports) {
+        const auto& range = arrIndexRange.at(getReportIndex(wellName, date));
+
+        for (int i = std::get<0>(range); i < std::get<1>(range); ++i) {
+            if (! this->isLoaded(i) &&
+                (std::find(names.begin(), names.end(), array_name[i]) != names.end()))
+            {
+                arrIndex.push_back(i);
+            }
+        }
+    }
+
+    if (arrIndex.empty()) {
+        return;
+    }
+
+    // Reading in file order turns scattered per-report lookups into
+    // a single forward pass.
+    std::sort(arrIndex.begin(), arrIndex.end());
+    arrIndex.erase(std::unique(arrIndex.begin(), arrIndex.end()), arrIndex.end());
+
+    // Reading arrays does not change the logical state of the file
+    // object.
+    const_cast<ERft*>(this)->loadData(arrIndex);
+}
+
+
+template <typename T>
+const std::vector<T>&
+ERft::loadedArray(const int arrInd,
+                  const std::unordered_map<int, std::vector<T>>& arrays) const
+{
+    auto pos = arrays.find(arrInd);
+
+    if (pos == arrays.end()) {
+        // Reading an array does not change the logical state of the
+        // file object.
+        const_cast<ERft*>(this)->loadData(arrInd);
+        pos = arrays.find(arrInd);
+    }
+
+    return pos->second;
 }
 
 
@@ -202,8 +412,7 @@ ERft::getRft<float>(const std::string& name, const std::string &wellName,
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = real_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, real_array);
 }
 
 
@@ -218,8 +427,7 @@ ERft::getRft<double>(const std::string& name, const std::string& wellName,
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = doub_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, doub_array);
 }
 
 
@@ -234,8 +442,7 @@ ERft::getRft<int>(const std::string& name, const std::string& wellName,
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = inte_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, inte_array);
 }
 
 
@@ -250,8 +457,7 @@ ERft::getRft<bool>(const std::string& name, const std::string& wellName,
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = logi_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, logi_array);
 }
 
 
@@ -266,8 +472,7 @@ ERft::getRft<std::string>(const std::string& name, const std::string& wellName,
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = char_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, char_array);
 }
 
 
@@ -321,8 +526,7 @@ ERft::getRft<float>(const std::string& name, int reportIndex) const
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = real_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, real_array);
 }
 
 
@@ -336,8 +540,7 @@ ERft::getRft<double>(const std::string& name, int reportIndex) const
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = doub_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, doub_array);
 }
 
 
@@ -351,8 +554,7 @@ ERft::getRft<int>(const std::string& name, int reportIndex) const
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = inte_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, inte_array);
 }
 
 
@@ -366,8 +568,7 @@ ERft::getRft<bool>(const std::string& name, int reportIndex) const
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = logi_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, logi_array);
 }
 
 
@@ -381,8 +582,7 @@ ERft::getRft<std::string>(const std::string& name, int reportIndex) const
         OPM_THROW(std::runtime_error, message);
     }
 
-    auto search_array = char_array.find(arrInd);
-    return search_array->second;
+    return this->loadedArray(arrInd, char_array);
 }
 
 
@@ -436,4 +636,36 @@ std::vector<ERft::RftDate> ERft::listOfdates() const
     return { this->dateList.begin(), this->dateList.end() };
 }
 
+
+template <typename T>
+std::vector<std::reference_wrapper<const std::vector<T>>>
+ERft::getRft(const std::string& name, const std::vector<RftKey>& reports) const
+{
+    this->loadRft({ name }, reports);
+
+    std::vector<std::reference_wrapper<const std::vector<T>>> arrays;
+    arrays.reserve(reports.size());
+
+    for (const auto& [wellName, date] : reports) {
+        arrays.emplace_back(this->getRft<T>(name, wellName, date));
+    }
+
+    return arrays;
+}
+
+template std::vector<std::reference_wrapper<const std::vector<int>>>
+ERft::getRft<int>(const std::string&, const std::vector<RftKey>&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<float>>>
+ERft::getRft<float>(const std::string&, const std::vector<RftKey>&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<double>>>
+ERft::getRft<double>(const std::string&, const std::vector<RftKey>&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<bool>>>
+ERft::getRft<bool>(const std::string&, const std::vector<RftKey>&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<std::string>>>
+ERft::getRft<std::string>(const std::string&, const std::vector<RftKey>&) const;
+
 }} // namespace Opm::ecl
@@ -22,10 +22,12 @@
 #include <opm/io/eclipse/EclFile.hpp>
 
 #include <ctime>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -34,9 +36,41 @@ namespace Opm { namespace EclIO {
 class ERft : public EclFile
 {
 public:
+    /// Constructor.
+    ///
+    /// Uses the array directory and report list stored in
+    /// indexFileName(filename) if that file exists and matches the size
+    /// and modification time of the RFT file.  Otherwise scans all array
+    /// headers and reads the TIME, DATE and WELLETC arrays of every
+    /// report.
     explicit ERft(const std::string &filename);
 
+    /// Name of index file associated with RFT file \p filename.
+    static std::string indexFileName(const std::string& filename);
+
+    /// Persist array directory and report list to indexFileName().  The
+    /// index is written to a temporary file and atomically renamed into
+    /// place.
+    void writeIndexFile() const;
+
+    /// Whether or not this object was initialised from an index file.
+    bool loadedFromIndexFile() const { return fromIndexFile; }
+
     using RftDate = std::tuple<int,int,int>;
+    using RftKey = std::pair<std::string, RftDate>;
+
+    /// Read arrays \p names of all \p reports in a single pass, in file
+    /// order.  Arrays not present in a report are skipped.  Throws
+    /// std::invalid_argument if a report does not exist.
+    void loadRft(const std::vector<std::string>& names,
+                 const std::vector<RftKey>& reports) const;
+
+    /// Array \p name of each of \p reports, in the order of \p reports.
+    /// Reads all arrays not already loaded through loadRft().
+    template <typename T>
+    std::vector<std::reference_wrapper<const std::vector<T>>>
+    getRft(const std::string& name, const std::vector<RftKey>& reports) const;
+
     template <typename T>
     const std::vector<T>& getRft(const std::string& name, const std::string& wellName,
                                  const RftDate& date) const;
@@ -81,9 +115,27 @@ private:
     RftReportList rftReportList;
 
     std::map<std::tuple<std::string,RftDate>,int> reportIndices;  //  mapping report index to wellName and date (tupe)
+    std::vector<std::string> reportWells;
+    std::vector<RftDate> reportDates;
+    bool fromIndexFile = false;
+
+    void initReports(const std::vector<int>& first,
+                     const std::vector<std::string>& wellName,
+                     const std::vector<RftDate>& dates);
+
+    void scanReports();
+    bool loadIndexFile();
 
     int getReportIndex(const std::string& wellName, const RftDate& date) const;
 
+    // Array data, read from file on first access.  Not safe for
+    // concurrent first access to the same array.
+    template <typename T>
+    const std::vector<T>& loadedArray(int arrInd,
+                                      const std::unordered_map<int, std::vector<T>>& arrays) const;
+
+    bool isLoaded(int arrInd) const;
+
     int getArrayIndex(const std::string& name, int reportIndex) const;
     int getArrayIndex(const std::string& name, const std::string& wellName,
                       const RftDate& date) const;
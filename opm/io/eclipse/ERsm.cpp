@@ -25,10 +25,17 @@
 #include <opm/output/eclipse/WStat.hpp>
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
 #include <fstream>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 #include <fmt/format.h>
 
@@ -40,36 +47,85 @@ namespace {
 constexpr std::size_t num_columns  = 10;
 constexpr std::size_t column_width = 13;
 
+using Lines = std::vector<std::string_view>;
 
-std::deque<std::string> load(const std::string& fname) {
-    std::deque<std::string> lines;
-    std::ifstream is(fname.c_str());
+// One block of the RSM file, vectors in column order.
+struct Block {
+    std::vector<SummaryNode> headers;
+    std::vector<std::vector<double>> data;
+    std::variant<std::vector<double>, std::vector<TimeStampUTC>> time;
+    std::size_t size = 0;
+};
+
+
+std::string load(const std::string& fname) {
+    std::ifstream is(fname.c_str(), std::ios::binary);
     if (!is.good())
         throw std::invalid_argument("Can not open: " + fname + " for reading");
 
-    std::string line;
-    while(std::getline(is, line)) {
-        if (line.back() == '\r')
-            lines.push_back(line.substr(0, line.size() - 1));
-        else
-            lines.push_back(line);
+    return { std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+}
+
+Lines split_lines(std::string_view text) {
+    Lines lines;
+    while (!text.empty()) {
+        auto end = text.find('\n');
+        auto line = text.substr(0, end);
+        if (!line.empty() && (line.back() == '\r'))
+            line.remove_suffix(1);
+
+        lines.push_back(line);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
     }
 
     return lines;
 }
 
-std::vector<std::string> split_line(const std::string& line) {
-    std::vector<std::string> tokens;
+std::string_view trim(std::string_view token) {
+    const auto first = token.find_first_not_of(" \t");
+    if (first == std::string_view::npos)
+        return {};
+
+    const auto last = token.find_last_not_of(" \t");
+    return token.substr(first, last - first + 1);
+}
+
+std::vector<std::string_view> split_line(std::string_view line) {
+    std::vector<std::string_view> tokens;
     for (std::size_t column = 0; column < num_columns; column++) {
         if (column * column_width >= line.size())
             break;
-        tokens.push_back( trim_copy(line.substr(column*column_width, column_width) ));
+        tokens.push_back( trim(line.substr(column*column_width, column_width) ));
     }
     return tokens;
 }
 
+std::vector<std::string> split_line_copy(std::string_view line) {
+    const auto tokens = split_line(line);
+    return { tokens.begin(), tokens.end() };
+}
+
+std::string_view token(const std::vector<std::string_view>& tokens, std::size_t index) {
+    return index < tokens.size() ? tokens[index] : std::string_view{};
+}
+
+bool parse_double(std::string_view token, double& value) {
+    if (!token.empty() && (token.front() == '+'))
+        token.remove_prefix(1);
+
+#if defined(__cpp_lib_to_chars)
+    const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+    return (ec == std::errc{}) && (ptr != token.data());
+#else
+    const std::string text { token };
+    char* end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return end != text.c_str();
+#endif
+}
+
 
-bool block_start(const std::string& line) {
+bool block_start(std::string_view line) {
     if (line.empty())
         return false;
 
@@ -82,16 +138,6 @@ bool block_start(const std::string& line) {
     return true;
 }
 
-std::string pop_return(std::deque<std::string>& lines) {
-    auto front = lines.front();
-    lines.pop_front();
-    return front;
-}
-
-void pop_separator(std::deque<std::string>& lines) {
-    lines.pop_front();
-}
-
 int make_num(const std::string& nums_string) {
     if (nums_string.empty())
         return 0;
@@ -99,13 +145,13 @@ int make_num(const std::string& nums_string) {
     return std::stoi(nums_string);
 }
 
-TimeStampUTC make_timestamp(const std::string& date_string) {
+TimeStampUTC make_timestamp(std::string_view date_string) {
     const auto& month_index = TimeService ::eclipseMonthIndices();
     auto dash_pos1 = date_string.find('-');
     auto dash_pos2 = date_string.rfind('-');
-    auto day = std::stoi( date_string.substr(0, dash_pos1 ) );
-    auto year = std::stoi( date_string.substr(dash_pos2 + 1) );
-    auto month_name = date_string.substr( dash_pos1 + 1, 3);
+    auto day = std::stoi( std::string(date_string.substr(0, dash_pos1 )) );
+    auto year = std::stoi( std::string(date_string.substr(dash_pos2 + 1)) );
+    auto month_name = std::string(date_string.substr( dash_pos1 + 1, 3));
 
     return TimeStampUTC(year, month_index.at(month_name), day);
 }
@@ -116,15 +162,15 @@ TimeStampUTC make_timestamp(const std::string& date_string) {
   the text we must make sure that line we are looking at is not the WGNAMES line
   - including the possibility of a totally empty WGNAMES line.
 */
-std::vector<double> make_multiplier(std::deque<std::string>& lines) {
+std::vector<double> make_multiplier(const Lines& lines, std::size_t& pos) {
     std::vector<double> multiplier = {1,1,1,1,1,1,1,1,1,1};
-    if (lines.front().find_first_not_of("-0123456789* ") != std::string::npos)
+    if (lines[pos].find_first_not_of("-0123456789* ") != std::string::npos)
         return multiplier;
 
-    if (lines.front().find_first_not_of(" ") == std::string::npos)
+    if (lines[pos].find_first_not_of(" ") == std::string::npos)
         return multiplier;
 
-    auto mult_list = split_line(pop_return(lines));
+    auto mult_list = split_line_copy(lines[pos++]);
     for (std::size_t index=0; index < mult_list.size(); index++) {
         const auto& mult_string = mult_list[index];
         if (mult_string.empty())
@@ -154,97 +200,95 @@ double convert_wstat(const std::string& symbolic_wstat) {
     return static_cast<double>(wstat_map.at(symbolic_wstat));
 }
 
-}
+// Lines [begin, end) of the file, the block starting at line begin.
+Block load_block(const Lines& lines, const std::size_t begin, const std::size_t end, const bool first_block) {
+    // header and separator lines
+    if (end - begin < 7)
+        throw std::invalid_argument("Incomplete block header in RSM file");
 
-void ERsm::load_block(std::deque<std::string>& lines, std::size_t& vector_length) {
-    if (!block_start(lines.front()))
-        throw std::invalid_argument("Block should start with '1' in first column");
+    std::size_t pos = begin + 4;
 
-    lines.pop_front();
-    pop_separator(lines);
-    lines.pop_front();
-    pop_separator(lines);
-
-    auto kw_list = split_line(pop_return(lines));
-    auto unit_list = split_line(pop_return(lines));
-    auto mult_list = make_multiplier(lines);
-    auto wgnames = split_line(pop_return(lines));
-    auto nums_list = split_line(pop_return(lines));
-    pop_separator(lines);
+    auto kw_list = split_line_copy(lines[pos++]);
+    auto unit_list = split_line_copy(lines[pos++]);
+    auto mult_list = make_multiplier(lines, pos);
+
+    if (end - pos < 3)
+        throw std::invalid_argument("Incomplete block header in RSM file");
+
+    auto wgnames = split_line_copy(lines[pos++]);
+    auto nums_list = split_line_copy(lines[pos++]);
+    pos++;
     std::size_t num_rows = std::count_if(kw_list.begin(), kw_list.end(), [](const std::string& kw) { return !kw.empty();}) - 1;
 
-    if (vector_length == 0) {
+    wgnames.resize(std::max(wgnames.size(), kw_list.size()));
+    nums_list.resize(std::max(nums_list.size(), kw_list.size()));
+
+    Block block;
+
+    if (first_block) {
         if (kw_list[0] == "DATE")
-            this->time = std::vector<TimeStampUTC>();
+            block.time = std::vector<TimeStampUTC>();
         else if (kw_list[0] == "TIME") {
             if (unit_list[0] != "DAYS")
                 throw std::invalid_argument("Only days is supported as time unit");
-            this->time = std::vector<double>();
+            block.time = std::vector<double>();
         }
         else
             throw std::invalid_argument("The first column must be DATE or TIME");
     }
 
-    std::vector<ERsm::Vector> block_data;
     for (std::size_t kw_index = 1; kw_index < kw_list.size(); kw_index++) {
-        auto node = SummaryNode{ kw_list[kw_index],
-                                 SummaryNode::category_from_keyword(kw_list[kw_index]),
-                                 SummaryNode::Type::Undefined,
-                                 wgnames[kw_index],
-                                 make_num(nums_list[kw_index]),
-                                 "",
-                                 {}
-        };
-        block_data.emplace_back( node, vector_length );
+        block.headers.push_back( SummaryNode{ kw_list[kw_index],
+                                              SummaryNode::category_from_keyword(kw_list[kw_index]),
+                                              SummaryNode::Type::Undefined,
+                                              wgnames[kw_index],
+                                              make_num(nums_list[kw_index]),
+                                              "",
+                                              {}
+        });
     }
 
-    std::size_t block_size = 0;
-    while (true) {
-        if (lines.empty())
-            break;
-
-        if (block_start(lines.front()))
-            break;
+    block.size = end - pos;
+    block.data.resize(block.headers.size());
+    for (auto& data : block.data)
+        data.reserve(block.size);
 
-        auto data_row = split_line(pop_return(lines));
+    for (; pos < end; pos++) {
+        const auto data_row = split_line(lines[pos]);
         for (std::size_t data_index = 0; data_index < num_rows; data_index++) {
             const auto& keyword = kw_list[data_index + 1];
+            const auto item = token(data_row, data_index + 1);
             double value;
             if (keyword == "WSTAT")
-                value = convert_wstat(data_row[data_index + 1]);
+                value = convert_wstat(std::string(item));
+            else if (parse_double(item, value))
+                value *= mult_list[data_index + 1];
             else {
-
-                try {
-                    value = std::stod(data_row[data_index + 1]) * mult_list[data_index + 1];
-                } catch (...) {
-                    std::string message = "Error loading RSM file. Not able to convert '";
-                    message = message +  data_row[data_index + 1] + "' to a float value";
-                    throw std::runtime_error(message);
-                }
+                std::string message = "Error loading RSM file. Not able to convert '";
+                message = message + std::string(item) + "' to a float value";
+                throw std::runtime_error(message);
             }
 
-            block_data[data_index].data.push_back(value);
+            block.data[data_index].push_back(value);
         }
 
-        if (vector_length == 0) {
-            if (std::holds_alternative<std::vector<double>>(this->time)) {
-                double d = std::stod(data_row[0]) * mult_list[0];
-                std::get<std::vector<double>>( this->time ).push_back( d );
+        if (first_block) {
+            if (std::holds_alternative<std::vector<double>>(block.time)) {
+                double d;
+                if (!parse_double(token(data_row, 0), d))
+                    throw std::invalid_argument("Error loading RSM file. Invalid time value");
+
+                std::get<std::vector<double>>( block.time ).push_back( d * mult_list[0] );
             } else {
-                TimeStampUTC ts = make_timestamp(data_row[0]);
-                std::get<std::vector<TimeStampUTC>>( this->time ).push_back( ts );
+                TimeStampUTC ts = make_timestamp(token(data_row, 0));
+                std::get<std::vector<TimeStampUTC>>( block.time ).push_back( ts );
             }
         }
-        block_size += 1;
     }
-    if (vector_length == 0)
-        vector_length = block_size;
 
-    if (vector_length != block_size)
-        throw std::invalid_argument("Block size error");
+    return block;
+}
 
-    for (auto& v : block_data)
-        this->vectors.insert(std::make_pair<std::string, ERsm::Vector>( v.header.unique_key(), std::move(v)));
 }
 
 
@@ -276,10 +320,52 @@ bool ERsm::has(const std::string& key) const {
 }
 
 ERsm::ERsm(const std::string& fname) {
-    auto lines = load(fname);
-    std::size_t vector_length = 0;
-    while (!lines.empty())
-        load_block(lines, vector_length);
+    const auto text = load(fname);
+    const auto lines = split_lines(text);
+
+    std::vector<std::size_t> block_begin;
+    for (std::size_t pos = 0; pos < lines.size(); pos++)
+        if (block_start(lines[pos]))
+            block_begin.push_back(pos);
+
+    if (!lines.empty() && (block_begin.empty() || (block_begin.front() != 0)))
+        throw std::invalid_argument("Block should start with '1' in first column");
+
+    block_begin.push_back(lines.size());
+
+    // Blocks are independent and parsed concurrently.
+    const std::size_t num_blocks = block_begin.size() - 1;
+    std::vector<Block> blocks(num_blocks);
+    std::vector<std::exception_ptr> failure(num_blocks);
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::int64_t b = 0; b < static_cast<std::int64_t>(num_blocks); b++) {
+        try {
+            blocks[b] = load_block(lines, block_begin[b], block_begin[b + 1], b == 0);
+        }
+        catch (...) {
+            failure[b] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : failure)
+        if (error)
+            std::rethrow_exception(error);
+
+    for (auto& block : blocks) {
+        if (&block == &blocks.front())
+            this->time = std::move(block.time);
+        else if (block.size != blocks.front().size)
+            throw std::invalid_argument("Block size error");
+
+        for (std::size_t index = 0; index < block.headers.size(); index++) {
+            ERsm::Vector vector(std::move(block.headers[index]), 0);
+            vector.data = std::move(block.data[index]);
+
+            auto key = vector.header.unique_key();
+            this->vectors.insert(std::make_pair(std::move(key), std::move(vector)));
+        }
+    }
 }
 
 
@@ -19,7 +19,6 @@
 #ifndef OPM_IO_ERSM_HPP
 #define OPM_IO_ERSM_HPP
 
-#include <deque>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -65,8 +64,6 @@ public:
     const std::vector<double>& get(const std::string& key) const;
     bool has(const std::string& key) const;
 private:
-    void load_block(std::deque<std::string>& lines , std::size_t& vector_length);
-
     std::unordered_map<std::string, Vector> vectors;
     std::variant<std::vector<double>, std::vector<TimeStampUTC>> time;
 };
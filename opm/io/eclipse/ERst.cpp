@@ -18,15 +18,21 @@
 
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <opm/io/eclipse/EclOutput.hpp>
+
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <filesystem>
 #include <iterator>
+#include <numeric>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 
 
 namespace {
@@ -46,14 +52,24 @@ namespace {
             "From Restart Filename \"" + filename + '"'
         };
     }
+
+    // Version of the index file layout.  Index files with a different
+    // version are ignored.
+    constexpr int indexFileVersion = 1;
 }
 
 
 namespace Opm { namespace EclIO {
 
 ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+    : EclFile(filename, EclFile::DeferredLoad{})
 {
+    if (this->loadIndexFile()) {
+        return;
+    }
+
+    this->load(false);
+
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
     }
@@ -188,6 +204,11 @@ void ERst::initUnified()
         }
     }
 
+    this->initReportRanges(firstIndex);
+}
+
+void ERst::initReportRanges(const std::vector<int>& firstIndex)
+{
     for (size_t i = 0; i < seqnum.size(); i++) {
         std::pair<int,int> range;
         range.first = firstIndex[i];
@@ -242,6 +263,107 @@ void ERst::initSeparate(const int number)
     }
 }
 
+std::string ERst::indexFileName(const std::string& filename)
+{
+    return filename + ".INDEX";
+}
+
+bool ERst::loadIndexFile()
+{
+    const auto indexFile = indexFileName(this->inputFilename);
+
+    auto ec = std::error_code{};
+    if (! std::filesystem::is_regular_file(indexFile, ec)) {
+        return false;
+    }
+
+    try {
+        EclFile index(indexFile, EclFile::Formatted{ false });
+
+        if (! this->readArrayDirectory(index, indexFileVersion)) {
+            return false;
+        }
+
+        const auto n = this->array_name.size();
+
+        const auto& steps = index.get<int>("SEQNUM");
+        const auto& firstIndex = index.get<int>("FIRSTIND");
+        const auto& numLgrs = index.get<int>("NUMLGRS");
+
+        if ((firstIndex.size() != steps.size()) || (numLgrs.size() != steps.size()) ||
+            std::any_of(firstIndex.begin(), firstIndex.end(),
+                        [n](const int i) { return (i < 0) || (static_cast<std::size_t>(i) >= n); }))
+        {
+            this->clearArrayList();
+            return false;
+        }
+
+        const auto totLgrs = std::accumulate(numLgrs.begin(), numLgrs.end(), std::size_t{0});
+        const auto lgrs = index.hasKey("LGRNAMES")
+            ? index.get<std::string>("LGRNAMES")
+            : std::vector<std::string>{};
+
+        if (lgrs.size() != totLgrs) {
+            this->clearArrayList();
+            return false;
+        }
+
+        this->seqnum = steps;
+
+        auto lgr = lgrs.begin();
+        for (const auto& count : numLgrs) {
+            this->lgr_names.emplace_back(lgr, lgr + count);
+            lgr += count;
+        }
+        this->initReportRanges(firstIndex);
+    }
+    catch (const std::exception&) {
+        // Unreadable or incomplete index.  Fall back to scanning.
+        this->clearArrayList();
+        this->seqnum.clear();
+        this->lgr_names.clear();
+        this->arrIndexRange.clear();
+        this->reportLoaded.clear();
+
+        return false;
+    }
+
+    this->fromIndexFile = true;
+
+    return true;
+}
+
+void ERst::writeIndexFile() const
+{
+    auto firstIndex = std::vector<int>{};
+    auto numLgrs = std::vector<int>{};
+    auto lgrs = std::vector<std::string>{};
+
+    for (std::size_t i = 0; i < this->seqnum.size(); ++i) {
+        firstIndex.push_back(this->arrIndexRange.at(this->seqnum[i]).first);
+        numLgrs.push_back(static_cast<int>(this->lgr_names[i].size()));
+        lgrs.insert(lgrs.end(), this->lgr_names[i].begin(), this->lgr_names[i].end());
+    }
+
+    const auto indexFile = indexFileName(this->inputFilename);
+    const auto tmpFile = indexFile + ".tmp";
+
+    {
+        EclOutput outFile(tmpFile, false, std::ios::out);
+
+        this->writeArrayDirectory(outFile, indexFileVersion);
+
+        outFile.write<int>("SEQNUM", this->seqnum);
+        outFile.write<int>("FIRSTIND", firstIndex);
+        outFile.write<int>("NUMLGRS", numLgrs);
+        if (! lgrs.empty()) {
+            outFile.write<std::string>("LGRNAMES", lgrs);
+        }
+    }
+
+    std::filesystem::rename(tmpFile, indexFile);
+}
+
 int ERst::get_start_index_lgrname(int number, const std::string& lgr_name)
 {
     if (!hasReportStepNumber(number)) {
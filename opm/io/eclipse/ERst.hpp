@@ -37,8 +37,25 @@ namespace Opm { namespace EclIO {
 class ERst : public EclFile
 {
 public:
+    /// Constructor.
+    ///
+    /// Uses the array directory stored in indexFileName(filename) if
+    /// that file exists and matches the size and modification time of
+    /// the restart file.  Otherwise scans all array headers.
     explicit ERst(const std::string& filename);
 
+    /// Name of index file associated with restart file \p filename.
+    static std::string indexFileName(const std::string& filename);
+
+    /// Persist array directory and report step layout to
+    /// indexFileName(), allowing subsequent ERst objects to skip the
+    /// initial scan of the restart file.  The index is written to a
+    /// temporary file and atomically renamed into place.
+    void writeIndexFile() const;
+
+    /// Whether or not this object was initialised from an index file.
+    bool loadedFromIndexFile() const { return fromIndexFile; }
+
     bool hasReportStepNumber(int number) const;
     bool hasArray(const std::string& name, int number) const;
     bool hasLGR(const std::string& gridname, int reportStepNumber) const;
@@ -64,6 +81,13 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber, const std::string& lgr_name);
 
+    /// Zero-copy view of a numeric restart array, see EclFile::getView().
+    template <typename T>
+    EclArrayView<T> getRestartView(const std::string& name, int reportStepNumber, int occurrence)
+    {
+        return this->getView<T>(this->getArrayIndex(name, reportStepNumber, occurrence));
+    }
+
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
@@ -83,9 +107,13 @@ private:
     mutable std::unordered_map<int,bool> reportLoaded;
     std::map<int, std::pair<int,int>> arrIndexRange;   // mapping report step number to array indeces (start and end)
     std::vector<std::vector<std::string>> lgr_names;                           // report step numbers, from SEQNUM array in restart file
+    bool fromIndexFile = false;
 
     void initUnified();
     void initSeparate(const int number);
+    void initReportRanges(const std::vector<int>& firstIndex);
+
+    bool loadIndexFile();
 
     int get_start_index_lgrname(int number, const std::string& lgr_name);
 
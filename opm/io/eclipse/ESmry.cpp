@@ -21,20 +21,23 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
-#include <opm/common/utility/shmatch.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
 
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <iterator>
 #include <limits>
 #include <regex>
@@ -43,8 +46,13 @@
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <fmt/format.h>
 
 /*
@@ -113,6 +121,87 @@ bool is_well_completion(const std::string& keyword)
     return std::regex_match(keyword, well_compl_kw);
 }
 
+// Size of the vector data held in memory by each batch of
+// make_esmry_file(), unless a batch size is given.
+constexpr std::size_t defaultBatchBytes = std::size_t{64} << 20;
+
+// Byte offset, relative to the start of the PARAMS data, of the value at
+// position paramPos.
+std::uint64_t paramsValueOffset(const int paramPos, const bool formatted)
+{
+    using namespace Opm::EclIO;
+
+    if (formatted) {
+        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
+        const auto blockSize = static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
+
+        const int nBlocks = paramPos / MaxBlockSizeReal;
+        const int sizeOfLastBlock = paramPos % MaxBlockSizeReal;
+        const int nLines = sizeOfLastBlock / numColumnsReal;
+
+        return nBlocks * blockSize + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+    }
+
+    const auto nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
+
+    return ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte)
+        + static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal);
+}
+
+// Requested values of one summary file's PARAMS arrays, grouped into byte
+// ranges which are each read with a single call.
+struct ParamsLayout
+{
+    struct Range
+    {
+        std::uint64_t begin;
+        std::uint64_t end;
+
+        // offset in range and index of requested vector
+        std::vector<std::pair<std::uint64_t, std::size_t>> values;
+    };
+
+    std::vector<Range> ranges;
+
+    // requested vectors not defined in the summary file
+    std::vector<std::size_t> missing;
+};
+
+ParamsLayout paramsLayout(const std::map<int, int>& arrayPos,
+                          const std::vector<int>& keywIndVect,
+                          const bool formatted)
+{
+    // Values closer than this are read together rather than seeking.
+    constexpr std::uint64_t maxGap = 4096;
+
+    const std::uint64_t width = formatted ? Opm::EclIO::columnWidthReal : Opm::EclIO::sizeOfReal;
+
+    ParamsLayout layout;
+    std::vector<std::pair<std::uint64_t, std::size_t>> offsets;
+
+    for (std::size_t i = 0; i < keywIndVect.size(); i++) {
+        auto it = arrayPos.find(keywIndVect[i]);
+
+        if (it == arrayPos.end())
+            layout.missing.push_back(i);
+        else
+            offsets.emplace_back(paramsValueOffset(it->second, formatted), i);
+    }
+
+    std::sort(offsets.begin(), offsets.end());
+
+    for (const auto& [offset, i] : offsets) {
+        if (layout.ranges.empty() || (offset > layout.ranges.back().end + maxGap))
+            layout.ranges.push_back({offset, offset, {}});
+
+        auto& range = layout.ranges.back();
+        range.values.emplace_back(offset - range.begin, i);
+        range.end = std::max(range.end, offset + width);
+    }
+
+    return layout;
+}
+
 }
 
 
@@ -125,6 +214,10 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     m_io_opening = 0.0;
     m_io_loading = 0.0;
 
+    tail_offset = 0;
+    tail_step_open = false;
+    tail_unified = true;
+
     auto start = std::chrono::system_clock::now();
 
     fromSingleRun = !loadBaseRunData;
@@ -486,15 +579,23 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     int step = 0;
     specInd = nSpecFiles - 1;
 
-    int index = 0;
-    for (const auto& keyw : keywList) {
-        if (!keyw.empty()) {
-            keyword.push_back(keyw);
-            keyword_index[keyw] = index++;
+    {
+        std::vector<std::string> keys;
+        keys.reserve(keywList.size());
+
+        for (const auto& keyw : keywList) {
+            if (!keyw.empty())
+                keys.push_back(keyw);
         }
+
+        keyword_index = SummaryKeyIndex(keys);
     }
 
-    nVect = keyword.size();
+    nVect = keyword_index.size();
+
+    summaryNodeKey.reserve(summaryNodes.size());
+    for (const auto& node : summaryNodes)
+        summaryNodeKey.push_back(lookupKey(node));
 
     vectorData.reserve(nVect);
     vectorLoaded.reserve(nVect);
@@ -505,35 +606,37 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     }
 
 
-    int dataFileIndex = -1;
-
-    while (specInd >= 0) {
+    // The data files of the runs in a restart chain are scanned
+    // concurrently.  A base run is only scanned up to the report step at
+    // which the next run restarts.
+    struct ChainMember
+    {
+        std::vector<std::string> resultsFileList;
+        bool unified = false;
+        std::vector<ArrSourceEntry> arraySourceList;
+        std::vector<std::uint64_t> arrayEndList;
+    };
 
-        int reportStepNumber = fromReportStepNumber;
+    std::vector<ChainMember> chain(nSpecFiles);
 
-        if (specInd > 0) {
-            auto rstFrom = smryArray[specInd-1];
-            toReportStepNumber = std::get<1>(rstFrom);
-        } else {
-            toReportStepNumber = std::numeric_limits<int>::max();
-        }
+    auto scanChainMember = [this, &smryArray](const int memberInd, ChainMember& member)
+    {
+        const bool memberFormatted = formattedFiles[memberInd];
 
-        std::filesystem::path smspecFile(std::get<0>(smryArray[specInd]));
-        rootName = smspecFile.parent_path() / smspecFile.stem();
+        std::filesystem::path smspecFile(std::get<0>(smryArray[memberInd]));
+        const std::filesystem::path memberRoot = smspecFile.parent_path() / smspecFile.stem();
 
         // check if multiple or unified result files should be used
         // to import data, no information in smspec file regarding this
         // if both unified and non-unified files exists, will use most recent based on
         // time stamp
 
-        std::filesystem::path unsmryFile = rootName;
+        std::filesystem::path unsmryFile = memberRoot;
 
-        unsmryFile += formattedFiles[specInd] ? ".FUNSMRY" : ".UNSMRY";
+        unsmryFile += memberFormatted ? ".FUNSMRY" : ".UNSMRY";
         const bool use_unified = std::filesystem::exists(unsmryFile.string());
 
-        const std::vector<std::string> multFileList = checkForMultipleResultFiles(rootName, formattedFiles[specInd]);
-
-        std::vector<std::string> resultsFileList;
+        const std::vector<std::string> multFileList = checkForMultipleResultFiles(memberRoot, memberFormatted);
 
         if ((!use_unified) && (multFileList.size()==0)) {
             throw std::runtime_error("neigther unified or non-unified result files found");
@@ -542,30 +645,86 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
             auto time_unified = std::filesystem::last_write_time(unsmryFile);
 
             if (time_multiple > time_unified) {
-                resultsFileList=multFileList;
+                member.resultsFileList=multFileList;
             } else {
-                resultsFileList.push_back(unsmryFile.string());
+                member.resultsFileList.push_back(unsmryFile.string());
+                member.unified = true;
             }
 
         } else if (use_unified) {
-            resultsFileList.push_back(unsmryFile.string());
+            member.resultsFileList.push_back(unsmryFile.string());
+            member.unified = true;
         } else {
-            resultsFileList=multFileList;
+            member.resultsFileList=multFileList;
         }
 
-        std::vector<ArrSourceEntry> arraySourceList;
+        // Report steps used from this run, see the loop below.  One more
+        // SEQHDR array is needed for the one at the start of the data.
+        auto maxSeqhdr = std::numeric_limits<std::size_t>::max();
 
-        for (std::string fileName : resultsFileList)
+        if (memberInd > 0) {
+            const int fromStep = (memberInd < nSpecFiles - 1) ? std::get<1>(smryArray[memberInd]) : 0;
+            const int toStep = std::get<1>(smryArray[memberInd - 1]);
+
+            maxSeqhdr = static_cast<std::size_t>(std::max(toStep - fromStep, 1)) + 1;
+        }
+
+        for (const std::string& fileName : member.resultsFileList)
         {
-            std::vector<std::tuple <std::string, std::uint64_t>> arrayList;
-            arrayList = this->getListOfArrays(fileName, formattedFiles[specInd]);
+            if (maxSeqhdr == 0)
+                break;
+
+            const auto arrayList = this->getListOfArrays(fileName, memberFormatted, 0, maxSeqhdr);
 
             for (size_t n = 0; n < arrayList.size(); n++) {
                 ArrSourceEntry  t1 = std::make_tuple(std::get<0>(arrayList[n]), fileName, n, std::get<1>(arrayList[n]));
-                arraySourceList.push_back(t1);
+                member.arraySourceList.push_back(t1);
+                member.arrayEndList.push_back(std::get<2>(arrayList[n]));
+
+                if ((std::get<0>(arrayList[n]) == "SEQHDR") &&
+                    (maxSeqhdr != std::numeric_limits<std::size_t>::max()))
+                {
+                    maxSeqhdr--;
+                }
+            }
+        }
+    };
+
+    {
+        std::vector<std::exception_ptr> failure(nSpecFiles);
+
+#pragma omp parallel for schedule(dynamic)
+        for (int ind = 0; ind < nSpecFiles; ind++) {
+            try {
+                scanChainMember(ind, chain[ind]);
+            }
+            catch (...) {
+                failure[ind] = std::current_exception();
             }
         }
 
+        // Oldest run first, as the runs are spliced below
+        for (auto error = failure.rbegin(); error != failure.rend(); ++error)
+            if (*error)
+                std::rethrow_exception(*error);
+    }
+
+    int dataFileIndex = -1;
+
+    while (specInd >= 0) {
+
+        int reportStepNumber = fromReportStepNumber;
+
+        if (specInd > 0) {
+            auto rstFrom = smryArray[specInd-1];
+            toReportStepNumber = std::get<1>(rstFrom);
+        } else {
+            toReportStepNumber = std::numeric_limits<int>::max();
+        }
+
+        const auto& arraySourceList = chain[specInd].arraySourceList;
+        const auto& arrayEndList = chain[specInd].arrayEndList;
+
         // loop through arrays and for each ministep, store data file, location of params table
         //
         //    2 or 3 arrays pr time step.
@@ -573,7 +732,7 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         //       else : MINISTEP and PARAMS
 
 
-        size_t i = std::get<0>(arraySourceList[0]) == "SEQHDR" ? 1 : 0 ;
+        size_t i = (!arraySourceList.empty() && (std::get<0>(arraySourceList[0]) == "SEQHDR")) ? 1 : 0 ;
 
         while  (i < arraySourceList.size()) {
 
@@ -621,6 +780,20 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
             step++;
         }
 
+        // the current run is always read to the end, remember where
+        // refresh() should continue
+        if (specInd == 0) {
+            tail_unified = chain[specInd].unified;
+
+            if (arraySourceList.empty()) {
+                tail_file = chain[specInd].resultsFileList.front();
+            } else {
+                tail_file = std::get<1>(arraySourceList.back());
+                tail_offset = arrayEndList.back();
+                tail_step_open = std::get<0>(arraySourceList.back()) == "PARAMS";
+            }
+        }
+
         fromReportStepNumber = toReportStepNumber;
 
         specInd--;
@@ -628,14 +801,52 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         nTstep = timeStepList.size();
     }
 
+    if (fromSingleRun)
+        this->attach_esmry_file();
+
     std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
     m_io_opening += elapsed_seconds.count();
 }
 
+void ESmry::attach_esmry_file()
+{
+    std::filesystem::path esmryFile = inputFileName.parent_path() / inputFileName.stem();
+    esmryFile += ".ESMRY";
+
+    if (!std::filesystem::exists(esmryFile))
+        return;
+
+    // Only use the ESMRY file if it was created after all the summary
+    // files it was derived from, and if it covers the same vectors and
+    // time steps.
+
+    const auto esmryTime = std::filesystem::last_write_time(esmryFile);
+
+    if (std::filesystem::last_write_time(inputFileName) > esmryTime)
+        return;
+
+    for (const auto& dataFile : dataFileList)
+        if (std::filesystem::last_write_time(dataFile) > esmryTime)
+            return;
+
+    try {
+        auto ext = std::make_shared<ExtESmry>(esmryFile.string());
+
+        if ((ext->keywordList() == keyword_index.keys()) && (ext->numberOfTimeSteps() == nTstep))
+            esmry_sidecar = std::move(ext);
+    }
+    catch (const std::exception&) {
+        // Unusable ESMRY file.  Fall back to reading the UNSMRY data.
+    }
+}
+
 void ESmry::read_ministeps_from_disk()
 {
-    auto specInd = std::get<0>(miniStepList[0]);
-    auto dataFileIndex = std::get<1>(miniStepList[0]);
+    if (mini_steps.size() >= miniStepList.size())
+        return;
+
+    auto specInd = std::get<0>(miniStepList[mini_steps.size()]);
+    auto dataFileIndex = std::get<1>(miniStepList[mini_steps.size()]);
 
     std::fstream fileH;
 
@@ -646,7 +857,7 @@ void ESmry::read_ministeps_from_disk()
 
     int ministep_value;
 
-    for (size_t n = 0; n < miniStepList.size(); n++) {
+    for (size_t n = mini_steps.size(); n < miniStepList.size(); n++) {
 
         if (dataFileIndex != std::get<1>(miniStepList[n])) {
             fileH.close();
@@ -666,8 +877,7 @@ void ESmry::read_ministeps_from_disk()
         if (formattedFiles[specInd]) {
             ministep_value = read_ministep_formatted(fileH);
         } else {
-            std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-            auto ministep_vect = readBinaryArray<int,int>(fileH, 1, Opm::EclIO::INTE, f, sizeOfInte);
+            auto ministep_vect = readBinaryInteArray(fileH, 1);
             ministep_value = ministep_vect[0];
         }
 
@@ -714,6 +924,15 @@ std::string ESmry::read_string_from_disk(std::fstream& fileH, uint64_t size) con
 
 void ESmry::loadData(const std::vector<std::string>& vectList) const
 {
+    if (esmry_sidecar) {
+        for (const auto& key : vectList)
+            if (!hasKey(key))
+                OPM_THROW(std::invalid_argument, "error loading key " + key );
+
+        esmry_sidecar->loadData(vectList);
+        return;
+    }
+
     auto start = std::chrono::system_clock::now();
     size_t nvect = vectList.size();
 
@@ -724,116 +943,147 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
         if (!hasKey(key))
             OPM_THROW(std::invalid_argument, "error loading key " + key );
 
-        auto it = keyword_index.find(key);
+        const auto ind = keyword_index.find(key);
 
-        if (!vectorLoaded[it->second])
-            keywIndVect.push_back(it->second);
+        if (!vectorLoaded[ind])
+            keywIndVect.push_back(static_cast<int>(ind));
     }
 
     for (auto ind : keywIndVect)
         vectorData[ind].reserve(nTstep);
 
-    std::fstream fileH;
+    this->appendVectorData(keywIndVect, 0);
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
-    std::uint64_t blockSize_f;
+    for (const auto& ind : keywIndVect)
+        vectorLoaded[ind] = true;
 
-    {
-        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal;
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
+
+void ESmry::appendVectorData(const std::vector<int>& keywIndVect, std::size_t fromStep) const
+{
+    std::vector<std::vector<float>> values;
+    this->readVectorData(keywIndVect, fromStep, values);
+
+    for (std::size_t i = 0; i < values.size(); i++) {
+        auto& data = vectorData[keywIndVect[i]];
 
-        blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
+        if (data.empty())
+            data = std::move(values[i]);
+        else
+            data.insert(data.end(), values[i].begin(), values[i].end());
     }
+}
 
-    if (formattedFiles[specInd])
-        fileH.open(dataFileList[dataFileIndex], std::ios::in);
-    else
-        fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+void ESmry::readVectorData(const std::vector<int>& keywIndVect, std::size_t fromStep,
+                           std::vector<std::vector<float>>& values) const
+{
+    values.assign(keywIndVect.size(), {});
 
-    for (const auto& ministep : timeStepList) {
-        if (dataFileIndex != std::get<1>(ministep)) {
-            fileH.close();
-            specInd = std::get<0>(ministep);
-            dataFileIndex = std::get<1>(ministep);
+    if (keywIndVect.empty() || (fromStep >= timeStepList.size()))
+        return;
 
-            if (formattedFiles[specInd])
-                fileH.open(dataFileList[dataFileIndex], std::ios::in );
-            else
-                fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+    for (auto& vect : values)
+        vect.resize(timeStepList.size() - fromStep);
+
+    // Time steps of each run in a restart chain are consecutive in
+    // timeStepList.  The runs are read concurrently, straight into their
+    // part of the output vectors.
+    std::vector<std::size_t> segments { fromStep };
+    for (std::size_t step = fromStep + 1; step < timeStepList.size(); step++)
+        if (std::get<0>(timeStepList[step]) != std::get<0>(timeStepList[step - 1]))
+            segments.push_back(step);
+
+    segments.push_back(timeStepList.size());
+
+    const auto numSegments = static_cast<std::int64_t>(segments.size() - 1);
+    std::vector<std::exception_ptr> failure(numSegments);
+
+#pragma omp parallel for schedule(dynamic) if (numSegments > 1)
+    for (std::int64_t s = 0; s < numSegments; s++) {
+        try {
+            this->readVectorSegment(keywIndVect, segments[s], segments[s + 1], fromStep, values);
+        }
+        catch (...) {
+            failure[s] = std::current_exception();
         }
+    }
 
-        const auto stepFilePos = std::get<2>(ministep);;
+    for (const auto& error : failure)
+        if (error)
+            std::rethrow_exception(error);
+}
 
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
-            if (it == arrayPos[specInd].end()) {
-                // undefined vector in current summary file. Typically when loading
-                // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
-            }
-            else {
-                int paramPos = it->second;
+void ESmry::readVectorSegment(const std::vector<int>& keywIndVect, std::size_t first,
+                              std::size_t last, std::size_t fromStep,
+                              std::vector<std::vector<float>>& values) const
+{
+    const int specInd = std::get<0>(timeStepList[first]);
+    const bool formatted = formattedFiles[specInd];
 
-                if (formattedFiles[specInd]) {
-                    std::uint64_t elementPos = 0;
-                    int nBlocks = paramPos / MaxBlockSizeReal;
-                    int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
+    const ParamsLayout layout = paramsLayout(arrayPos[specInd], keywIndVect, formatted);
 
-                    if (nBlocks > 0)
-                        elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
+    std::fstream fileH;
+    int dataFileIndex = -1;
+    std::vector<char> buffer;
 
-                    int nLines = sizeOfLastBlock / numColumnsReal;
-                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+    for (std::size_t step = first; step < last; step++) {
+        const auto& [stepSpecInd, stepFileIndex, stepFilePos] = timeStepList[step];
+        const std::size_t pos = step - fromStep;
 
-                    fileH.seekg (elementPos, fileH.beg);
+        if (dataFileIndex != stepFileIndex) {
+            fileH.close();
+            dataFileIndex = stepFileIndex;
 
-                    const std::size_t size = columnWidthReal;
-                    std::vector<char> buffer(size);
-                    fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
-                }
-                else {
-                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
-                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
-                    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+            if (formatted)
+                fileH.open(dataFileList[dataFileIndex], std::ios::in);
+            else
+                fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+        }
 
-                    fileH.seekg (elementPos, fileH.beg);
+        // undefined vector in current summary file. Typically when loading
+        // base restart run and including base run data. Vectors can be added to restart runs
+        for (auto i : layout.missing)
+            values[i][pos] = std::nanf("");
 
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+        for (const auto& range : layout.ranges) {
+            const auto size = range.end - range.begin;
+
+            buffer.resize(size + 1);
+            fileH.seekg(stepFilePos + range.begin, fileH.beg);
+            fileH.read(buffer.data(), size);
+            buffer[size] = '\0';
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
+            for (const auto& [offset, i] : range.values) {
+                if (formatted) {
+                    values[i][pos] = std::strtof(buffer.data() + offset, nullptr);
+                } else {
+                    float value;
+                    std::memcpy(&value, buffer.data() + offset, sizeof value);
+                    values[i][pos] = Opm::EclIO::flipEndianFloat(value);
                 }
             }
         }
     }
 
     fileH.close();
-
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
-
-    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-    m_io_loading += elapsed_seconds.count();
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
 {
     std::vector<int> keywpos(nParamsSpecFile[specInd], -1);
-
-    auto has_index = [&keywpos](const int ix)
-    {
-        return std::find(keywpos.begin(), keywpos.end(), ix) != keywpos.end();
-    };
+    std::vector<bool> used(nVect, false);
 
     const auto& kwList = keywordListSpecFile[specInd];
     for (int n = 0; n < nParamsSpecFile[specInd]; ++n) {
-        auto it = keyword_index.find(kwList[n]);
-        if ((it == keyword_index.end()) || has_index(it->second)) {
+        const auto ind = keyword_index.find(kwList[n]);
+        if ((ind == SummaryKeyIndex::npos) || used[ind]) {
             continue;
         }
 
-        keywpos[n] = it->second;
+        used[ind] = true;
+        keywpos[n] = static_cast<int>(ind);
     }
 
     return keywpos;
@@ -841,6 +1091,11 @@ std::vector<int> ESmry::makeKeywPosVector(int specInd) const
 
 void ESmry::loadData() const
 {
+    if (esmry_sidecar) {
+        esmry_sidecar->loadData();
+        return;
+    }
+
     std::fstream fileH;
 
     auto specInd = std::get<0>(timeStepList[0]);
@@ -949,10 +1204,11 @@ void ESmry::loadData() const
 }
 
 
-std::vector<std::tuple <std::string, uint64_t>>
-ESmry::getListOfArrays(const std::string& filename, bool formatted)
+std::vector<std::tuple <std::string, uint64_t, uint64_t>>
+ESmry::getListOfArrays(const std::string& filename, bool formatted, uint64_t fromPos,
+                       std::size_t maxSeqhdr) const
 {
-    std::vector<std::tuple <std::string, uint64_t>> resultVect;
+    std::vector<std::tuple <std::string, uint64_t, uint64_t>> resultVect;
 
     FILE *ptr;
     char arrName[9];
@@ -960,14 +1216,24 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
 
     int64_t num;
 
+    // Files may still be written by a running simulation. Only arrays
+    // which are completely present on disk are included in the list.
+
+    const uint64_t fileSize = static_cast<uint64_t>(std::filesystem::file_size(filename));
+    const uint64_t headerSize = formatted ? 31 : 24;
+
     if (formatted)
         ptr = fopen(filename.c_str(),"r");  // r for read, files opened as text files
     else
         ptr = fopen(filename.c_str(),"rb");  // r for read, b for binary
 
-    bool endOfFile = false;
+    if (ptr == nullptr)
+        throw std::runtime_error("unable to open summary data file " + filename);
+
+    uint64_t arrStart = fromPos;
+    fseek(ptr, static_cast<long int>(arrStart), SEEK_SET);
 
-    while (!endOfFile)
+    while (arrStart + headerSize <= fileSize)
     {
         Opm::EclIO::eclArrType arrType;
 
@@ -1026,42 +1292,131 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
             }
         }
 
-        uint64_t filePos = static_cast<uint64_t>(ftell(ptr));
-
-        std::tuple <std::string, uint64_t> t1;
-        t1 = std::make_tuple(Opm::EclIO::trimr(arrName), filePos);
-        resultVect.push_back(t1);
+        uint64_t filePos = arrStart + headerSize;
+        uint64_t arrEnd = filePos;
 
         if (num > 0) {
-            if (formatted) {
-                uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, 4);
-                fseek(ptr, static_cast<long int>(sizeOfNextArray), SEEK_CUR);
-            } else {
-                uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, 4);
-                fseek(ptr, static_cast<long int>(sizeOfNextArray), SEEK_CUR);
-            }
+            if (formatted)
+                arrEnd += sizeOnDiskFormatted(num, arrType, 4);
+            else
+                arrEnd += sizeOnDiskBinary(num, arrType, 4);
         }
 
-        if (fgetc(ptr) == EOF)
-            endOfFile = true;
-        else
-            fseek(ptr, -1, SEEK_CUR);
+        if (arrEnd > fileSize)
+            break;
+
+        resultVect.push_back(std::make_tuple(Opm::EclIO::trimr(arrName), filePos, arrEnd));
+
+        if ((std::get<0>(resultVect.back()) == "SEQHDR") && (--maxSeqhdr == 0))
+            break;
+
+        arrStart = arrEnd;
+        fseek(ptr, static_cast<long int>(arrStart), SEEK_SET);
     }
 
     fclose(ptr);
 
+    // a MINISTEP is always followed by the corresponding PARAMS array
+    if (!resultVect.empty() && (std::get<0>(resultVect.back()) == "MINISTEP"))
+        resultVect.pop_back();
+
     return resultVect;
 }
 
-bool ESmry::make_esmry_file()
+bool ESmry::refresh()
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<std::string> fileList { tail_file };
+
+    if (!tail_unified) {
+        std::filesystem::path rootN = std::filesystem::path(tail_file).replace_extension();
+
+        for (const auto& fileName : checkForMultipleResultFiles(rootN, formattedFiles[0]))
+            if (fileName > tail_file)
+                fileList.push_back(fileName);
+    }
+
+    const std::size_t fromStep = timeStepList.size();
+
+    for (const auto& fileName : fileList) {
+        const uint64_t fromPos = fileName == tail_file ? tail_offset : 0;
+        const auto arrayList = this->getListOfArrays(fileName, formattedFiles[0], fromPos);
+
+        if (arrayList.empty())
+            break;
+
+        int dataFileIndex = std::distance(dataFileList.begin(),
+                                          std::find(dataFileList.begin(), dataFileList.end(), fileName));
+
+        size_t i = 0;
+
+        while (i < arrayList.size()) {
+            const auto& name = std::get<0>(arrayList[i]);
+
+            if (name == "SEQHDR") {
+                // last time step confirmed as end of report step
+                tail_step_open = false;
+                i++;
+                continue;
+            }
+
+            if ((name != "MINISTEP") || (std::get<0>(arrayList[i+1]) != "PARAMS")) {
+                std::string message="Reading summary file, expecting keywords MINISTEP and PARAMS, found '" + name + "'";
+                throw std::invalid_argument(message);
+            }
+
+            if (dataFileIndex == static_cast<int>(dataFileList.size()))
+                dataFileList.push_back(fileName);
+
+            // previous time step is not the last one of its report step
+            if (tail_step_open)
+                seqIndex.pop_back();
+
+            miniStepList.push_back(std::make_tuple(0, dataFileIndex, std::get<1>(arrayList[i])));
+            timeStepList.push_back(std::make_tuple(0, dataFileIndex, std::get<1>(arrayList[i+1])));
+
+            seqIndex.push_back(static_cast<int>(timeStepList.size()) - 1);
+            tail_step_open = true;
+
+            i += 2;
+        }
+
+        tail_file = fileName;
+        tail_offset = std::get<2>(arrayList.back());
+    }
+
+    if (timeStepList.size() == fromStep)
+        return false;
+
+    nTstep = timeStepList.size();
+
+    // vectors served by the ESMRY file do not include the new time steps
+    if (esmry_sidecar)
+        esmry_sidecar.reset();
+
+    if (!mini_steps.empty())
+        this->read_ministeps_from_disk();
+
+    std::vector<int> keywIndVect;
+
+    for (size_t ind = 0; ind < nVect; ind++)
+        if (vectorLoaded[ind])
+            keywIndVect.push_back(static_cast<int>(ind));
+
+    this->appendVectorData(keywIndVect, fromStep);
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return true;
+}
+
+bool ESmry::make_esmry_file(const int chunk_size, const std::size_t batch_size)
 {
-    // check that loadBaseRunData is not set, this function only works for single smspec files
     // function will not replace existing lodsmry files (since this is already loaded by this class)
     // if lodsmry file exist, this function will return false and do nothing.
 
-    if (!fromSingleRun)
-        OPM_THROW(std::invalid_argument, "creating esmry file only possible when loadBaseRunData=false");
-
     if (mini_steps.size() == 0)
         this->read_ministeps_from_disk();
 
@@ -1071,63 +1426,132 @@ bool ESmry::make_esmry_file()
     smryDataFile.replace_extension(".ESMRY");
 
     if (Opm::EclIO::fileExists(smryDataFile))
-    {
         return false;
 
-    } else {
+    // Time steps and vectors of the current run.  With loadBaseRunData,
+    // the base runs come first and are only referred to through RESTART.
+    std::size_t fromStep = 0;
+    while ((fromStep < timeStepList.size()) && (std::get<0>(timeStepList[fromStep]) != 0))
+        fromStep++;
 
-        std::vector<int> is_rstep;
-        is_rstep.reserve(timeStepList.size());
+    std::vector<int> keywIndVect;
+    std::vector<std::string> keys;
+    std::vector<std::string> units;
+
+    for (std::size_t ind = 0; ind < nVect; ind++) {
+        if (arrayPos[0].count(static_cast<int>(ind)) > 0) {
+            keywIndVect.push_back(static_cast<int>(ind));
+            keys.push_back(keyword_index.keys()[ind]);
+            units.push_back(kwunits.at(keys.back()));
+        }
+    }
 
-        for (size_t i = 0; i < timeStepList.size(); i++)
-            if(std::find(seqIndex.begin(), seqIndex.end(), i) != seqIndex.end())
-                is_rstep.push_back(1);
-            else
-                is_rstep.push_back(0);
+    const std::size_t numSteps = timeStepList.size() - fromStep;
 
-        this->loadData();
+    std::vector<int> is_rstep(numSteps, 0);
+    for (const auto& ind : seqIndex)
+        if (static_cast<std::size_t>(ind) >= fromStep)
+            is_rstep[ind - fromStep] = 1;
 
-        {
-            std::vector<int> start_date_vect = start_vect;
-            if (start_date_vect.size() < 6) {
-                start_date_vect.resize(6);
-            }
+    const std::vector<int> tstep(mini_steps.begin() + fromStep, mini_steps.end());
+
+    std::vector<int> start_date_vect = start_vect;
+    if (start_date_vect.size() < 6) {
+        start_date_vect.resize(6);
+    }
 
-            int sec = start_date_vect[5] / 1000000;
-            int millisec = (start_date_vect[5] % 1000000) / 1000;
+    int sec = start_date_vect[5] / 1000000;
+    int millisec = (start_date_vect[5] % 1000000) / 1000;
 
-            start_date_vect[5] = sec;
-            start_date_vect.push_back(millisec);
+    start_date_vect[5] = sec;
+    start_date_vect.push_back(millisec);
 
-            std::vector<std::string> units;
-            units.reserve(keyword.size());
+    const std::size_t batchSize = (batch_size > 0) ? batch_size
+        : std::max<std::size_t>(1, defaultBatchBytes / (sizeof(float) * std::max<std::size_t>(numSteps, 1)));
 
-            std::transform(keyword.begin(), keyword.end(), std::back_inserter(units),
-                           [this](const auto& key) { return kwunits.at(key); });
+    const std::size_t numBatches = (keywIndVect.size() + batchSize - 1) / batchSize;
 
-            Opm::EclIO::EclOutput outFile(smryDataFile, false, std::ios::out);
+#ifdef _OPENMP
+    const std::size_t numConcurrent = std::max(omp_get_max_threads(), 1);
+#else
+    const std::size_t numConcurrent = 1;
+#endif
+
+    try {
+        Opm::EclIO::EclOutput outFile(smryDataFile, false, std::ios::out);
+
+        outFile.write<int>("START", start_date_vect);
+
+        if (std::get<0>(restart_info) != ""){
+            auto rst_file = std::get<0>(restart_info);
+            outFile.write<std::string>("RESTART", {rst_file});
+            outFile.write<int>("RSTNUM", {std::get<1>(restart_info)});
+        }
 
-            outFile.write<int>("START", start_date_vect);
+        outFile.write("KEYCHECK", keys);
+        outFile.write("UNITS", units);
+        outFile.write<int>("RSTEP", is_rstep);
+        outFile.write<int>("TSTEP", tstep);
 
-            if (std::get<0>(restart_info) != ""){
-                auto rst_file = std::get<0>(restart_info);
-                outFile.write<std::string>("RESTART", {rst_file});
-                outFile.write<int>("RSTNUM", {std::get<1>(restart_info)});
+        // Compressed arrays are kept until all are known, since ZOFFSET
+        // precedes them in the file.  Plain arrays are written and
+        // released batch by batch.
+        std::vector<std::vector<int>> zArrays(chunk_size > 0 ? keys.size() : 0);
+
+        for (std::size_t first = 0; first < numBatches; first += numConcurrent) {
+            const std::size_t last = std::min(first + numConcurrent, numBatches);
+
+            std::vector<std::vector<std::vector<float>>> batchData(last - first);
+            std::vector<std::exception_ptr> failure(last - first);
+
+#pragma omp parallel for schedule(dynamic)
+            for (std::int64_t b = first; b < static_cast<std::int64_t>(last); b++) {
+                const std::size_t begin = b * batchSize;
+                const std::size_t end = std::min(begin + batchSize, keywIndVect.size());
+
+                try {
+                    auto& values = batchData[b - first];
+
+                    this->readVectorData({keywIndVect.begin() + begin, keywIndVect.begin() + end},
+                                         fromStep, values);
+
+                    if (chunk_size > 0) {
+                        for (std::size_t i = 0; i < values.size(); i++) {
+                            zArrays[begin + i] = encodeChunkedVector(values[i], chunk_size);
+                            std::vector<float>().swap(values[i]);
+                        }
+                    }
+                }
+                catch (...) {
+                    failure[b - first] = std::current_exception();
+                }
             }
 
-            outFile.write("KEYCHECK", keyword);
-            outFile.write("UNITS", units);
-            outFile.write<int>("RSTEP", is_rstep);
-            outFile.write<int>("TSTEP", mini_steps);
+            for (const auto& error : failure)
+                if (error)
+                    std::rethrow_exception(error);
 
-            for (size_t n = 0; n < vectorData.size(); n++ ) {
-                const std::string vect_name = fmt::format("V{}", n);
-                outFile.write<float>(vect_name, vectorData[n]);
+            if (chunk_size <= 0) {
+                for (std::size_t b = first; b < last; b++) {
+                    const auto& values = batchData[b - first];
+
+                    for (std::size_t i = 0; i < values.size(); i++) {
+                        const std::string vect_name = fmt::format("V{}", b * batchSize + i);
+                        outFile.write<float>(vect_name, values[i]);
+                    }
+                }
             }
         }
 
-        return true;
+        if (chunk_size > 0)
+            writeChunkedArrays(outFile, zArrays, chunk_size);
+    }
+    catch (...) {
+        std::filesystem::remove(smryDataFile);
+        throw;
     }
+
+    return true;
 }
 
 std::vector<std::string> ESmry::checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const {
@@ -1180,7 +1604,7 @@ void ESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem::p
 
 bool ESmry::hasKey(const std::string &key) const
 {
-    return std::find(keyword.begin(), keyword.end(), key) != keyword.end();
+    return keyword_index.contains(key);
 }
 
 
@@ -1339,28 +1763,42 @@ std::string ESmry::lookupKey(const SummaryNode& node) const {
     return node.unique_key([this](const auto& num) { return this->unpackNumber(num); });
 }
 
+std::string ESmry::nodeKey(const SummaryNode& node) const {
+    // Nodes of summaryNodeList() have their keys precomputed
+    const auto less = std::less<const SummaryNode*>{};
+    if (!summaryNodes.empty() &&
+        !less(&node, summaryNodes.data()) &&
+        less(&node, summaryNodes.data() + summaryNodes.size()))
+    {
+        return summaryNodeKey[&node - summaryNodes.data()];
+    }
+
+    return lookupKey(node);
+}
+
 const std::vector<float>& ESmry::get(const SummaryNode& node) const {
-    return get(lookupKey(node));
+    return get(nodeKey(node));
 }
 
 std::vector<float> ESmry::get_at_rstep(const SummaryNode& node) const {
-    return get_at_rstep(lookupKey(node));
+    return get_at_rstep(nodeKey(node));
 }
 
 const std::string& ESmry::get_unit(const SummaryNode& node) const {
-    return get_unit(lookupKey(node));
+    return get_unit(nodeKey(node));
 }
 
 const std::vector<float>& ESmry::get(const std::string& name) const
 {
-    auto it = std::find(keyword.begin(), keyword.end(), name);
+    const auto ind = keyword_index.find(name);
 
-    if (it == keyword.end()) {
+    if (ind == SummaryKeyIndex::npos) {
         const std::string message="keyword " + name + " not found ";
         OPM_THROW(std::invalid_argument, message);
     }
 
-    int ind = std::distance(keyword.begin(), it);
+    if (esmry_sidecar)
+        return esmry_sidecar->get(name);
 
     if (!vectorLoaded[ind]){
         loadData({name});
@@ -1370,6 +1808,24 @@ const std::vector<float>& ESmry::get(const std::string& name) const
     return vectorData[ind];
 }
 
+std::vector<float> ESmry::get(const std::string& name, time_point from, time_point to) const
+{
+    if (!hasKey(name))
+        OPM_THROW(std::invalid_argument, "keyword " + name + " not found ");
+
+    if (esmry_sidecar)
+        return esmry_sidecar->get(name, from, to);
+
+    const auto d = this->dates();
+
+    const auto first = std::distance(d.begin(), std::lower_bound(d.begin(), d.end(), from));
+    const auto last = std::distance(d.begin(), std::upper_bound(d.begin() + first, d.end(), to));
+
+    const auto& full = this->get(name);
+
+    return { full.begin() + first, full.begin() + last };
+}
+
 std::vector<float> ESmry::get_at_rstep(const std::string& name) const
 {
     return this->rstep_vector( this->get(name) );
@@ -1396,16 +1852,22 @@ const std::string& ESmry::get_unit(const std::string& name) const {
 
 const std::vector<std::string>& ESmry::keywordList() const
 {
-    return keyword;
+    return keyword_index.keys();
 }
 
 std::vector<std::string> ESmry::keywordList(const std::string& pattern) const
 {
-    std::vector<std::string> list;
+    return keyword_index.keysAt(keyword_index.match(pattern));
+}
+
+std::vector<std::string> ESmry::keywordsWithName(const std::string& keywordArg) const
+{
+    return keyword_index.keysAt(keyword_index.withKeyword(keywordArg));
+}
 
-    std::copy_if(keyword.begin(), keyword.end(), std::back_inserter(list),
-                 [&pattern](const auto& key) { return shmatch(pattern, key); });
-    return list;
+std::vector<std::string> ESmry::keywordsForEntity(const std::string& entity) const
+{
+    return keyword_index.keysAt(keyword_index.withEntity(entity));
 }
 
 
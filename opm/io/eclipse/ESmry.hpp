@@ -23,6 +23,8 @@
 #include <chrono>
 #include <filesystem>
 #include <iosfwd>
+#include <limits>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -30,10 +32,13 @@
 #include <stdint.h>
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/SummaryKeyIndex.hpp>
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 namespace Opm { namespace EclIO {
 
+class ExtESmry;
+
 using ArrSourceEntry = std::tuple<std::string, std::string, int, uint64_t>;
 using TimeStepEntry = std::tuple<int, int, uint64_t>;
 using RstEntry = std::tuple<std::string, int>;
@@ -55,12 +60,31 @@ public:
 
     std::vector<float> get_at_rstep(const std::string& name) const;
     std::vector<float> get_at_rstep(const SummaryNode& node) const;
+
+    // values at time steps with dates in the closed interval [from, to]
+    std::vector<float> get(const std::string& name, time_point from, time_point to) const;
     std::vector<time_point> dates_at_rstep() const;
 
     void loadData(const std::vector<std::string>& vectList) const;
     void loadData() const;
 
-    bool make_esmry_file();
+    // Pick up ministeps written to the summary data files of the current
+    // run since the object was created or last refreshed.  Scanning resumes
+    // at the last consumed file position and vectors already loaded are
+    // extended with the new values only.  Returns true if new time steps
+    // were found.  Intended for monitoring simulations while they run.
+    bool refresh();
+
+    // Write vectors to a columnar ESMRY file next to the SMSPEC file.
+    // chunk_size > 0 selects the chunked, compressed layout with
+    // chunk_size time steps per chunk.
+    //
+    // Vectors are read from the summary files in batches of batch_size
+    // vectors, in parallel across batches, and released once written, so
+    // the full summary is never held in memory.  batch_size = 0 selects
+    // batches of about 64 MiB.  For a restarted run, only the time steps
+    // of the run itself are written, with a reference to the base run.
+    bool make_esmry_file(int chunk_size = 0, std::size_t batch_size = 0);
 
     time_point startdate() const { return tp_startdat; }
     const std::vector<int>& start_v() const { return start_vect; }
@@ -69,6 +93,14 @@ public:
     std::vector<std::string> keywordList(const std::string& pattern) const;
     const std::vector<SummaryNode>& summaryNodeList() const;
 
+    // Lookup keys of summaryNodeList(), element by element
+    const std::vector<std::string>& summaryNodeKeys() const { return summaryNodeKey; }
+
+    // Keys of all vectors of one keyword, e.g. all WOPR vectors, or of one
+    // well, group or other entity named by the last component of the key.
+    std::vector<std::string> keywordsWithName(const std::string& keyword) const;
+    std::vector<std::string> keywordsForEntity(const std::string& entity) const;
+
     int timestepIdxAtReportstepStart(const int reportStep) const;
 
     size_t numberOfTimeSteps() const { return nTstep; }
@@ -81,6 +113,10 @@ public:
 
     bool all_steps_available();
     std::string rootname() { return inputFileName.stem(); }
+
+    // true if vectors are served from an up to date columnar ESMRY file
+    // rather than by scanning the UNSMRY ministeps
+    bool uses_esmry_file() const { return esmry_sidecar != nullptr; }
     std::tuple<double, double> get_io_elapsed() const;
 
 private:
@@ -98,8 +134,7 @@ private:
     std::vector<TimeStepEntry> timeStepList;
     std::vector<TimeStepEntry> miniStepList;
     std::vector<std::map<int, int>> arrayPos;
-    std::vector<std::string> keyword;
-    std::map<std::string, int> keyword_index;
+    SummaryKeyIndex keyword_index;
     std::vector<int> nParamsSpecFile;
 
     std::vector<std::vector<std::string>> keywordListSpecFile;
@@ -110,6 +145,7 @@ private:
     void ijk_from_global_index(int glob, int &i, int &j, int &k) const;
 
     std::vector<SummaryNode> summaryNodes;
+    std::vector<std::string> summaryNodeKey;
     std::unordered_map<std::string, std::string> kwunits;
 
     time_point tp_startdat;
@@ -118,6 +154,22 @@ private:
     mutable double m_io_opening;
     mutable double m_io_loading;
 
+    // Resume position for refresh(): data file of the current run and
+    // byte offset following the last complete array consumed from it.
+    // tail_step_open is true if the last time step is registered as a
+    // report step only because it was the last one available.
+    std::string tail_file;
+    uint64_t tail_offset;
+    bool tail_step_open;
+    bool tail_unified;
+
+    // ESMRY file written by make_esmry_file(), single run only.  Vectors
+    // are stored contiguously in that file whence any vector, or a time
+    // window of it, is available through a single read.
+    mutable std::shared_ptr<ExtESmry> esmry_sidecar;
+
+    void attach_esmry_file();
+
     std::vector<std::string> checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const;
 
     void getRstString(const std::vector<std::string>& restartArray,
@@ -132,10 +184,9 @@ private:
 
     std::string unpackNumber(const SummaryNode&) const;
     std::string lookupKey(const SummaryNode&) const;
+    std::string nodeKey(const SummaryNode&) const;
 
 
-    void write_block(std::ostream &, bool write_dates, const std::vector<std::string>& time_column, const std::vector<SummaryNode>&) const;
-
     template <typename T>
     std::vector<T> rstep_vector(const std::vector<T>& full_vector) const {
         std::vector<T> result;
@@ -151,8 +202,25 @@ private:
         return result;
     }
 
-    std::vector<std::tuple <std::string, uint64_t>>
-    getListOfArrays(const std::string& filename, bool formatted);
+    // name, position of data and end position of all complete arrays
+    // starting at file position 'fromPos', up to and including SEQHDR
+    // array number 'maxSeqhdr'
+    std::vector<std::tuple <std::string, uint64_t, uint64_t>>
+    getListOfArrays(const std::string& filename, bool formatted, uint64_t fromPos = 0,
+                    std::size_t maxSeqhdr = std::numeric_limits<std::size_t>::max()) const;
+
+    void appendVectorData(const std::vector<int>& keywIndVect, std::size_t fromStep) const;
+
+    // values of vectors keywIndVect from time step fromStep onwards, not
+    // touching the loaded vectors.  Safe to call concurrently.
+    void readVectorData(const std::vector<int>& keywIndVect, std::size_t fromStep,
+                        std::vector<std::vector<float>>& values) const;
+
+    // values of time steps [first, last) from a single summary file,
+    // stored at position step - fromStep of the presized 'values'
+    void readVectorSegment(const std::vector<int>& keywIndVect, std::size_t first,
+                           std::size_t last, std::size_t fromStep,
+                           std::vector<std::vector<float>>& values) const;
 
     std::vector<int> makeKeywPosVector(int speInd) const;
     std::string read_string_from_disk(std::fstream& fileH, uint64_t size) const;
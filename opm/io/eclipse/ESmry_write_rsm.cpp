@@ -28,20 +28,23 @@
 #include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
+#include <exception>
 #include <filesystem>
 #include <fstream>
-#include <functional>
-#include <iomanip>
-#include <list>
+#include <iterator>
 #include <optional>
 #include <ostream>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <fmt/format.h>
 
 namespace {
@@ -54,6 +57,9 @@ namespace {
     constexpr std::size_t total_column { column_width + column_space } ;
     constexpr std::size_t total_width  { total_column * column_count } ;
 
+    // Number of blocks formatted, per thread, before they are written.
+    constexpr std::size_t blocks_per_thread { 4 } ;
+
     const std::string block_separator_line { } ;
 
     // the fact that the dashed header line has 127 rather than 130 dashes has no provenance
@@ -61,11 +67,17 @@ namespace {
 
     const std::vector<std::string> month_names = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
 
+    using Buffer = fmt::memory_buffer;
+
+    struct Column {
+        const Opm::EclIO::SummaryNode* node;
+        const std::vector<float>* data;
+        const std::string* unit;
+    };
+
     std::string format_date(const Opm::time_point& tp) {
         auto ts = Opm::TimeStampUTC( Opm::TimeService::to_time_t(tp) );
-        char buffer[12];
-        std::snprintf(buffer, 12, "%2d-%3s-%4d", ts.day(), month_names[ts.month() - 1].c_str(), ts.year());
-        return std::string(buffer, 11);
+        return fmt::format("{:2d}-{:3s}-{:4d}", ts.day(), month_names[ts.month() - 1], ts.year());
     }
 
     std::string block_header_line(const std::string& run_name) {
@@ -73,52 +85,62 @@ namespace {
         return "SUMMARY OF RUN " + run_name + " at: " + date_string;
     }
 
-    void write_line(std::ostream& os, const std::string& line, char prefix = ' ') {
-        os << prefix << std::setw(total_width) << std::left << line << '\n';
+    void write_line(Buffer& buf, const std::string& line, char prefix = ' ') {
+        fmt::format_to(std::back_inserter(buf), "{}{:<{}}\n", prefix, line, total_width);
     }
 
-    void write_padding(std::ostream& os, std::size_t columns) {
+    void write_padding(Buffer& buf, std::size_t columns) {
         for (std::size_t icol = columns + 1; icol < column_count; icol++)
-            os << std::setw(column_width + column_space) << " ";
+            fmt::format_to(std::back_inserter(buf), "{:{}}", "", total_column);
     }
 
-    void print_text_element(std::ostream& os, const std::string& element) {
-        os << std::setw(8) << std::left << element << std::setw(5) << "";
+    void print_text_element(Buffer& buf, const std::string& element) {
+        fmt::format_to(std::back_inserter(buf), "{:<{}}{:{}}", element, column_width, "", column_space);
     }
 
-    void print_time_element(std::ostream& os, const std::string& element) {
-        os << std::setw(11) << element << std::setw(2) << "";
+    void print_time_element(Buffer& buf, const std::string& element) {
+        fmt::format_to(std::back_inserter(buf), "{:<11}{:2}", element, "");
+    }
+
+    // std::to_string(element) cut at eight characters, without a trailing
+    // decimal point and zeros, right aligned in a field of eight.
+    void append_float_element(Buffer& buf, float element) {
+        char text[column_width];
+        const auto result = fmt::format_to_n(text, column_width, "{:f}", static_cast<double>(element));
+        auto size = std::min<std::size_t>(result.size, column_width);
+
+        const auto dot = std::find(text, text + size, '.');
+        if ((dot != text + size) && std::all_of(dot + 1, text + size, [](const char c) { return c == '0'; }))
+            size = dot - text;
+
+        fmt::format_to(std::back_inserter(buf), "{:>{}}", fmt::string_view(text, size), column_width);
     }
 
     std::string format_float_element(float element) {
-        std::stringstream ss;
-        static const std::regex integer_regex { "\\.0*$" };
-        auto element_string = std::to_string(element);
-        if (element_string.size() > 8) {
-            element_string = element_string.substr(0, 8);
-        }
-        element_string = std::regex_replace(element_string, integer_regex, "");
-        ss << std::setw(8) << std::right << element_string;
-        return ss.str();
+        Buffer buf;
+        append_float_element(buf, element);
+        return fmt::to_string(buf);
     }
 
-    void print_float_element(std::ostream& os, float element) {
-        os << format_float_element(element) << std::setw(5) << "";
+    void print_float_element(Buffer& buf, float element) {
+        append_float_element(buf, element);
+        fmt::format_to(std::back_inserter(buf), "{:{}}", "", column_space);
     }
 
-    void write_header_columns(std::ostream& os, const std::string& time_column, const std::vector<Opm::EclIO::SummaryNode>& vectors, std::function<void(std::ostream&, const Opm::EclIO::SummaryNode&)> print_element, char prefix = ' ') {
-        os << prefix;
+    template <typename PrintElement>
+    void write_header_columns(Buffer& buf, const std::string& time_column, const std::vector<Column>& columns, PrintElement&& print_element, char prefix = ' ') {
+        buf.push_back(prefix);
 
-        print_text_element(os, time_column);
-        for (const auto& vector : vectors) {
-            print_element(os, vector);
+        print_text_element(buf, time_column);
+        for (const auto& column : columns) {
+            print_element(buf, column);
         }
-        write_padding(os, vectors.size());
+        write_padding(buf, columns.size());
 
-        os << '\n';
+        buf.push_back('\n');
     }
 
-    std::string convert_wstat(double numeric_wstat) {
+    const std::string& convert_wstat(double numeric_wstat) {
         static const std::unordered_map<int, std::string> wstat_map = {
             {Opm::WStat::numeric::UNKNOWN, Opm::WStat::symbolic::UNKNOWN},
             {Opm::WStat::numeric::PROD,    Opm::WStat::symbolic::PROD},
@@ -131,107 +153,102 @@ namespace {
         return wstat_map.at(static_cast<int>(numeric_wstat));
     }
 
-    void write_data_row(std::ostream& os, const std::vector<std::string>& time_column, const std::vector<Opm::EclIO::SummaryNode>& summary_nodes, const std::vector<std::pair<std::vector<float>, int>>& data, std::size_t time_index, char prefix = ' ') {
-        os << prefix;
-
-        print_time_element( os, time_column[time_index] );
-        for (std::size_t row_index = 0; row_index < data.size(); row_index++) {
-            const auto& [time_series, scale_factor] = data[row_index];
-            const auto& summary_node = summary_nodes[row_index];
-
-            if (summary_node.keyword == "WSTAT")
-                print_text_element(os, convert_wstat(time_series[time_index]));
-            else
-                print_float_element(os, time_series[time_index] * std::pow(10.0, -scale_factor));
-        }
-        write_padding(os, data.size());
-
-        os << '\n';
-    }
-
-    void write_scale_columns(std::ostream& os,
-                             const std::vector<std::pair<std::vector<float>, int>>& data,
-                             char prefix = ' ')
+    void write_scale_columns(Buffer& buf, const std::vector<int>& scale_factors, char prefix = ' ')
     {
-        os << prefix;
+        buf.push_back(prefix);
 
-        print_text_element(os, "");
-        for (const auto& [_ , scale_factor] : data) {
-            (void)_;
+        print_text_element(buf, "");
+        for (const auto& scale_factor : scale_factors) {
             if (scale_factor) {
-                print_text_element(os, "*10**" + std::to_string(scale_factor));
+                print_text_element(buf, "*10**" + std::to_string(scale_factor));
             } else {
-                print_text_element(os, "");
+                print_text_element(buf, "");
             }
         }
 
-        os << '\n';
+        buf.push_back('\n');
     }
 
-}
-
-namespace Opm { namespace EclIO {
+    void write_block(Buffer& buf,
+                     const std::string& header_line,
+                     bool write_dates,
+                     const std::vector<std::string>& time_column,
+                     const std::vector<Column>& columns)
+    {
+        write_line(buf, block_separator_line, '1');
+        write_line(buf, divider_line);
+        write_line(buf, header_line);
+        write_line(buf, divider_line);
 
-void ESmry::write_block(std::ostream& os,
-                        bool write_dates,
-                        const std::vector<std::string>& time_column,
-                        const std::vector<SummaryNode>& vectors) const
-{
-    write_line(os, block_separator_line, '1');
-    write_line(os, divider_line);
-    write_line(os, block_header_line(inputFileName.stem()));
-    write_line(os, divider_line);
+        std::vector<int> scale_factors;
+        std::vector<double> multipliers;
 
-    std::vector<std::pair<std::vector<float>, int>> data;
+        bool has_scale_factors { false } ;
+        for (const auto& column : columns) {
+            const auto& vector_data = *column.data;
 
-    bool has_scale_factors { false } ;
-    for (const auto& vector : vectors) {
-        const auto& vector_data { this->get(vector) } ;
+            auto max = vector_data.empty() ? 0.0f : *std::max_element(vector_data.begin(), vector_data.end());
+            // log10 for 0 is undefined and log10 for negative values yields nan.
+            // We skip the scale factor in these cases to prevent undefined behavior
+            int scale_factor {
+                max <= 0 ? 0 :
+                std::max(0, 3 * static_cast<int>(std::floor(( std::log10(max) - 4 ) / 3 ))) } ;
 
-        auto max = *std::max_element(vector_data.begin(), vector_data.end());
-        // log10 for 0 is undefined and log10 for negative values yields nan.
-        // We skip the scale factor in these cases to prevent undefined behavior
-        int scale_factor {
-            max <= 0 ? 0 :
-            std::max(0, 3 * static_cast<int>(std::floor(( std::log10(max) - 4 ) / 3 ))) } ;
+            // Make sure that 10**scale_factor is less than 13 character
+            scale_factor = std::min(99999999, scale_factor);
 
-        // Make sure that 10**scale_factor is less than 13 character
-        scale_factor = std::min(99999999, scale_factor);
+            if (scale_factor) {
+                has_scale_factors = true;
+            }
 
-        if (scale_factor) {
-            has_scale_factors = true;
+            scale_factors.push_back(scale_factor);
+            multipliers.push_back(std::pow(10.0, -scale_factor));
         }
 
-        data.emplace_back(vector_data, scale_factor);
-    }
+        {
+            const std::size_t rows { time_column.size() };
+            std::string time_header = "TIME";
+            std::string time_unit = "DAYS";
 
-    {
-        std::size_t rows { data[0].first.size() };
-        std::string time_header = "TIME";
-        std::string time_unit = "DAYS";
+            if (write_dates) {
+                time_header = "DATE";
+                time_unit = "";
+            }
+            write_header_columns(buf, time_header, columns, [](Buffer& b, const Column& column) { print_text_element(b, column.node->keyword); });
+            write_header_columns(buf, time_unit, columns, [](Buffer& b, const Column& column) { print_text_element(b, *column.unit); });
+            if (has_scale_factors) {
+                write_scale_columns(buf, scale_factors);
+            }
+            write_header_columns(buf, "", columns, [](Buffer& b, const Column& column) { print_text_element(b, column.node->display_name().value_or("")); });
+            write_header_columns(buf, "", columns, [](Buffer& b, const Column& column) { print_text_element(b, column.node->display_number().value_or("")); });
 
-        if (write_dates) {
-            time_header = "DATE";
-            time_unit = "";
-        }
-        write_header_columns(os, time_header, vectors, [](std::ostream& oss, const SummaryNode& node) { print_text_element(oss, node.keyword); });
-        write_header_columns(os, time_unit, vectors, [this](std::ostream& oss, const SummaryNode& node) { print_text_element(oss, this->get_unit(node)); });
-        if (has_scale_factors) {
-            write_scale_columns(os, data);
-        }
-        write_header_columns(os, "", vectors, [](std::ostream& oss, const SummaryNode& node) { print_text_element(oss, node.display_name().value_or("")); });
-        write_header_columns(os, "", vectors, [](std::ostream& oss, const SummaryNode& node) { print_text_element(oss, node.display_number().value_or("")); });
+            write_line(buf, divider_line);
+
+            buf.reserve(buf.size() + rows * (total_width + 2));
+
+            for (std::size_t i { 0 } ; i < rows; i++) {
+                buf.push_back(' ');
 
-        write_line(os, divider_line);
+                print_time_element(buf, time_column[i]);
+                for (std::size_t c = 0; c < columns.size(); c++) {
+                    const auto value = (*columns[c].data)[i];
 
-        for (std::size_t i { 0 } ; i < rows; i++) {
-            write_data_row(os, time_column, vectors, data, i);
+                    if (columns[c].node->keyword == "WSTAT")
+                        print_text_element(buf, convert_wstat(value));
+                    else
+                        print_float_element(buf, value * multipliers[c]);
+                }
+                write_padding(buf, columns.size());
+
+                buf.push_back('\n');
+            }
         }
     }
 
-    os << std::flush;
 }
 
+namespace Opm { namespace EclIO {
+
 void ESmry::write_rsm(std::ostream& os) const
 {
     bool write_dates = false;
@@ -248,19 +265,12 @@ void ESmry::write_rsm(std::ostream& os) const
       Ensure that the YEARS vector is the first in the data_vectors; could in
       principle embark on a more general sorting here.
     */
-    if (data_vectors[0].keyword != "YEARS") {
+    if (!data_vectors.empty() && (data_vectors[0].keyword != "YEARS")) {
         auto years_iter = std::find_if(data_vectors.begin(), data_vectors.end(), [](const SummaryNode& node) { return (node.keyword == "YEARS"); });
         if (years_iter != data_vectors.end())
             std::swap(data_vectors[0], *years_iter);
     }
 
-    std::vector<std::list<SummaryNode>> data_vector_blocks;
-    constexpr std::size_t data_column_count { column_count - 1 } ;
-    for (std::size_t i { 0 } ; i < data_vectors.size(); i += data_column_count) {
-        auto last = std::min(data_vectors.size(), i + data_column_count);
-        data_vector_blocks.emplace_back(data_vectors.begin() + i, data_vectors.begin() + last);
-    }
-
     this->loadData();
     std::vector<std::string> time_column;
     if (this->hasKey("DAY") && this->hasKey("MONTH") && this->hasKey("YEAR")) {
@@ -282,9 +292,55 @@ void ESmry::write_rsm(std::ostream& os) const
                        });
     }
 
-    for (const auto& data_vector_block : data_vector_blocks) {
-        write_block(os, write_dates, time_column, {data_vector_block.begin(), data_vector_block.end() });
+    // Vectors are looked up here, once.  Blocks are then formatted
+    // concurrently, a window at a time, and written in order.
+    std::vector<std::vector<Column>> blocks;
+    constexpr std::size_t data_column_count { column_count - 1 } ;
+    for (std::size_t i { 0 } ; i < data_vectors.size(); i += data_column_count) {
+        auto last = std::min(data_vectors.size(), i + data_column_count);
+
+        auto& block = blocks.emplace_back();
+        for (auto v = i; v < last; v++) {
+            const auto& node = data_vectors[v];
+            block.push_back({ &node, &this->get(node), &this->get_unit(node) });
+        }
     }
+
+    const auto header_line = block_header_line(inputFileName.stem());
+
+#ifdef _OPENMP
+    const std::size_t window = blocks_per_thread * std::max(omp_get_max_threads(), 1);
+#else
+    const std::size_t window = blocks_per_thread;
+#endif
+
+    std::vector<Buffer> text(std::min(window, blocks.size()));
+
+    for (std::size_t first = 0; first < blocks.size(); first += window) {
+        const auto last = std::min(first + window, blocks.size());
+        std::vector<std::exception_ptr> failure(last - first);
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::int64_t b = first; b < static_cast<std::int64_t>(last); b++) {
+            try {
+                auto& buf = text[b - first];
+                buf.clear();
+                write_block(buf, header_line, write_dates, time_column, blocks[b]);
+            }
+            catch (...) {
+                failure[b - first] = std::current_exception();
+            }
+        }
+
+        for (std::size_t b = first; b < last; b++) {
+            if (failure[b - first])
+                std::rethrow_exception(failure[b - first]);
+
+            os.write(text[b - first].data(), text[b - first].size());
+        }
+    }
+
+    os << std::flush;
 }
 
 void ESmry::write_rsm_file(std::optional<std::filesystem::path> filename) const
@@ -0,0 +1,276 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLARRAYVIEW_HPP
+#define OPM_IO_ECLARRAYVIEW_HPP
+
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Non-owning, read-only view of a numeric array stored in a memory
+/// mapped binary ECLIPSE file.
+///
+/// Array elements remain in their on-disk, big-endian representation
+/// inside Fortran record blocks.  Individual elements are decoded on
+/// access while copy() and toVector() decode entire blocks at a time
+/// using the bulk endian conversion kernels.
+///
+/// A view shares ownership of the underlying mapping and therefore
+/// remains valid even if the EclFile object that created it is
+/// destroyed.
+///
+/// Supported element types are int (INTE), float (REAL), double (DOUB)
+/// and bool (LOGI).
+template <typename T>
+class EclArrayView
+{
+public:
+    static_assert(std::is_same_v<T, int>   || std::is_same_v<T, float> ||
+                  std::is_same_v<T, double> || std::is_same_v<T, bool>,
+                  "EclArrayView supports int, float, double and bool only");
+
+    /// Number of bytes occupied by a single element on disk.
+    static constexpr int elementSize = std::is_same_v<T, double> ? sizeOfDoub : sizeOfInte;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator() = default;
+        const_iterator(const EclArrayView* view, std::int64_t ix)
+            : view_(view), ix_(ix)
+        {}
+
+        T operator*() const { return (*this->view_)[this->ix_]; }
+        T operator[](difference_type n) const { return (*this->view_)[this->ix_ + n]; }
+
+        const_iterator& operator++() { ++this->ix_; return *this; }
+        const_iterator operator++(int) { auto tmp = *this; ++this->ix_; return tmp; }
+        const_iterator& operator--() { --this->ix_; return *this; }
+        const_iterator operator--(int) { auto tmp = *this; --this->ix_; return tmp; }
+
+        const_iterator& operator+=(difference_type n) { this->ix_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { this->ix_ -= n; return *this; }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b)
+        {
+            return static_cast<difference_type>(a.ix_ - b.ix_);
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.ix_ == b.ix_; }
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.ix_ != b.ix_; }
+        friend bool operator< (const const_iterator& a, const const_iterator& b) { return a.ix_ <  b.ix_; }
+        friend bool operator> (const const_iterator& a, const const_iterator& b) { return a.ix_ >  b.ix_; }
+        friend bool operator<=(const const_iterator& a, const const_iterator& b) { return a.ix_ <= b.ix_; }
+        friend bool operator>=(const const_iterator& a, const const_iterator& b) { return a.ix_ >= b.ix_; }
+
+    private:
+        const EclArrayView* view_{nullptr};
+        std::int64_t ix_{0};
+    };
+
+    EclArrayView() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] file Mapping containing the array.
+    ///
+    /// \param[in] start Address of the first record marker of the
+    ///   array's data blocks.  Must be inside \p file.
+    ///
+    /// \param[in] size Number of array elements.
+    ///
+    /// \param[in] blockElements Maximum number of elements in each
+    ///   Fortran record block.
+    EclArrayView(std::shared_ptr<const MappedFile> file,
+                 const char* start,
+                 const std::int64_t size,
+                 const int blockElements)
+        : file_(std::move(file))
+        , start_(start)
+        , size_(size)
+        , blockElements_(blockElements)
+    {}
+
+    std::int64_t size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    T operator[](const std::int64_t i) const
+    {
+        return decode(this->address(i));
+    }
+
+    T at(const std::int64_t i) const
+    {
+        if ((i < 0) || (i >= this->size_)) {
+            throw std::out_of_range {
+                "Index " + std::to_string(i) + " outside array of size " +
+                std::to_string(this->size_)
+            };
+        }
+
+        return (*this)[i];
+    }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, this->size_ }; }
+
+    /// Decode elements [first, first + count) into contiguous storage
+    /// starting at \p dest.
+    void copy(std::int64_t first, std::int64_t count, T* dest) const
+    {
+        while (count > 0) {
+            const auto inBlock = first % this->blockElements_;
+            const auto n = std::min<std::int64_t>(count, this->blockElements_ - inBlock);
+
+            decodeBlock(this->address(first), n, dest);
+
+            first += n;
+            count -= n;
+            dest  += n;
+        }
+    }
+
+    /// Decode entire array into owning storage.
+    std::vector<T> toVector() const
+    {
+        auto result = std::vector<T>(this->size_);
+
+        if constexpr (std::is_same_v<T, bool>) {
+            for (std::int64_t i = 0; i < this->size_; ++i) {
+                result[i] = (*this)[i];
+            }
+        }
+        else {
+            this->copy(0, this->size_, result.data());
+        }
+
+        return result;
+    }
+
+    /// Decode entire array into owning storage of a different element
+    /// type, e.g., REAL data into double precision values.  The elements
+    /// are converted block by block, so no intermediate array of T is
+    /// created.
+    template <typename U>
+    std::vector<U> toVectorAs() const
+    {
+        if constexpr (std::is_same_v<T, U> || std::is_same_v<T, bool>) {
+            auto values = this->toVector();
+            return { values.begin(), values.end() };
+        }
+        else {
+            auto result = std::vector<U>(this->size_);
+
+            constexpr std::int64_t chunkSize = 4096;
+            T chunk[chunkSize];
+            for (std::int64_t first = 0; first < this->size_; first += chunkSize) {
+                const auto n = std::min(chunkSize, this->size_ - first);
+                this->copy(first, n, chunk);
+                std::copy(chunk, chunk + n, result.begin() + first);
+            }
+
+            return result;
+        }
+    }
+
+private:
+    using Raw = std::conditional_t<elementSize == 8, std::uint64_t, std::uint32_t>;
+
+    std::shared_ptr<const MappedFile> file_{};
+    const char* start_{nullptr};
+    std::int64_t size_{0};
+    int blockElements_{1};
+
+    const char* address(const std::int64_t i) const
+    {
+        // Every block is framed by a leading and a trailing 4 byte
+        // record marker.
+        const auto block = i / this->blockElements_;
+        const auto inBlock = i % this->blockElements_;
+        const auto blockBytes = static_cast<std::int64_t>(this->blockElements_) * elementSize
+            + 2 * sizeOfInte;
+
+        return this->start_ + block*blockBytes + sizeOfInte + inBlock*elementSize;
+    }
+
+    static Raw swap(const Raw raw)
+    {
+        if constexpr (elementSize == 8) {
+            return __builtin_bswap64(raw);
+        }
+        else {
+            return __builtin_bswap32(raw);
+        }
+    }
+
+    static T decode(const char* p)
+    {
+        Raw raw;
+        std::memcpy(&raw, p, sizeof raw);
+        raw = swap(raw);
+
+        if constexpr (std::is_same_v<T, bool>) {
+            return raw != false_value;
+        }
+        else {
+            T value;
+            std::memcpy(&value, &raw, sizeof value);
+            return value;
+        }
+    }
+
+    static void decodeBlock(const char* p, const std::int64_t n, T* dest)
+    {
+        static_assert(sizeof(T) == sizeof(Raw));
+
+        if constexpr (elementSize == 8) {
+            swapEndian64(p, dest, n);
+        }
+        else {
+            swapEndian32(p, dest, n);
+        }
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLARRAYVIEW_HPP
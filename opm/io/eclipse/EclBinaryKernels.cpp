@@ -0,0 +1,276 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OPM_ECLIO_X86_KERNELS 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define OPM_ECLIO_NEON_KERNELS 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using SwapKernel = void (*)(const char*, char*, std::size_t);
+
+// ---------------------------------------------------------------------
+// Portable implementation.  Also used for the tail of the vectorised
+// kernels.
+
+void swap32Scalar(const char* src, char* dst, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint32_t v;
+        std::memcpy(&v, src + 4*i, sizeof v);
+        v = __builtin_bswap32(v);
+        std::memcpy(dst + 4*i, &v, sizeof v);
+    }
+}
+
+void swap64Scalar(const char* src, char* dst, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint64_t v;
+        std::memcpy(&v, src + 8*i, sizeof v);
+        v = __builtin_bswap64(v);
+        std::memcpy(dst + 8*i, &v, sizeof v);
+    }
+}
+
+#if defined(OPM_ECLIO_X86_KERNELS)
+
+// Compiled for the respective instruction set through the target
+// attribute, so no special compiler flags are needed for the library as
+// a whole.  Only called if the host CPU supports the instructions.
+
+__attribute__((target("ssse3")))
+void swap32SSSE3(const char* src, char* dst, std::size_t n)
+{
+    const __m128i mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                       11, 10, 9, 8, 15, 14, 13, 12);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4*i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4*i), _mm_shuffle_epi8(v, mask));
+    }
+
+    swap32Scalar(src + 4*i, dst + 4*i, n - i);
+}
+
+__attribute__((target("ssse3")))
+void swap64SSSE3(const char* src, char* dst, std::size_t n)
+{
+    const __m128i mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0,
+                                       15, 14, 13, 12, 11, 10, 9, 8);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8*i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8*i), _mm_shuffle_epi8(v, mask));
+    }
+
+    swap64Scalar(src + 8*i, dst + 8*i, n - i);
+}
+
+__attribute__((target("avx2")))
+void swap32AVX2(const char* src, char* dst, std::size_t n)
+{
+    const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                          11, 10, 9, 8, 15, 14, 13, 12,
+                                          3, 2, 1, 0, 7, 6, 5, 4,
+                                          11, 10, 9, 8, 15, 14, 13, 12);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4*i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4*i), _mm256_shuffle_epi8(v, mask));
+    }
+
+    swap32Scalar(src + 4*i, dst + 4*i, n - i);
+}
+
+__attribute__((target("avx2")))
+void swap64AVX2(const char* src, char* dst, std::size_t n)
+{
+    const __m256i mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8,
+                                          7, 6, 5, 4, 3, 2, 1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 8*i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 8*i), _mm256_shuffle_epi8(v, mask));
+    }
+
+    swap64Scalar(src + 8*i, dst + 8*i, n - i);
+}
+
+#elif defined(OPM_ECLIO_NEON_KERNELS)
+
+// Advanced SIMD is mandatory on AArch64.
+
+void swap32NEON(const char* src, char* dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src + 4*i));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + 4*i), vrev32q_u8(v));
+    }
+
+    swap32Scalar(src + 4*i, dst + 4*i, n - i);
+}
+
+void swap64NEON(const char* src, char* dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src + 8*i));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + 8*i), vrev64q_u8(v));
+    }
+
+    swap64Scalar(src + 8*i, dst + 8*i, n - i);
+}
+
+#endif
+
+struct Kernels
+{
+    SwapKernel swap32;
+    SwapKernel swap64;
+    const char* isa;
+};
+
+Kernels selectKernels()
+{
+#if defined(OPM_ECLIO_X86_KERNELS)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return { &swap32AVX2, &swap64AVX2, "avx2" };
+    }
+
+    if (__builtin_cpu_supports("ssse3")) {
+        return { &swap32SSSE3, &swap64SSSE3, "ssse3" };
+    }
+#elif defined(OPM_ECLIO_NEON_KERNELS)
+    return { &swap32NEON, &swap64NEON, "neon" };
+#endif
+
+    return { &swap32Scalar, &swap64Scalar, "scalar" };
+}
+
+const Kernels& kernels()
+{
+    static const Kernels k = selectKernels();
+    return k;
+}
+
+std::uint32_t recordMarker(const std::int64_t numBytes)
+{
+    return __builtin_bswap32(static_cast<std::uint32_t>(numBytes));
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+void swapEndian32(const void* src, void* dst, const std::size_t n)
+{
+    kernels().swap32(static_cast<const char*>(src), static_cast<char*>(dst), n);
+}
+
+void swapEndian64(const void* src, void* dst, const std::size_t n)
+{
+    kernels().swap64(static_cast<const char*>(src), static_cast<char*>(dst), n);
+}
+
+const char* endianKernelISA()
+{
+    return kernels().isa;
+}
+
+std::size_t encodeBinaryRecords(const void*        src,
+                                const std::int64_t num,
+                                const int          elementSize,
+                                const int          blockElements,
+                                char*              dst)
+{
+    const auto swap = (elementSize == 8) ? kernels().swap64 : kernels().swap32;
+    const auto* in = static_cast<const char*>(src);
+    char* out = dst;
+
+    for (std::int64_t done = 0; done < num; ) {
+        const auto count = std::min<std::int64_t>(num - done, blockElements);
+        const auto marker = recordMarker(count * elementSize);
+
+        std::memcpy(out, &marker, sizeof marker);
+        out += sizeof marker;
+
+        swap(in + done*elementSize, out, static_cast<std::size_t>(count));
+        out += count * elementSize;
+
+        std::memcpy(out, &marker, sizeof marker);
+        out += sizeof marker;
+
+        done += count;
+    }
+
+    return static_cast<std::size_t>(out - dst);
+}
+
+std::size_t decodeBinaryRecords(const char*        src,
+                                const std::int64_t num,
+                                const int          elementSize,
+                                const int          blockElements,
+                                void*              dst)
+{
+    const auto swap = (elementSize == 8) ? kernels().swap64 : kernels().swap32;
+    const char* in = src;
+    auto* out = static_cast<char*>(dst);
+
+    for (std::int64_t done = 0; done < num; ) {
+        const auto count = std::min<std::int64_t>(num - done, blockElements);
+        const auto expected = recordMarker(count * elementSize);
+
+        std::uint32_t head, tail;
+        std::memcpy(&head, in, sizeof head);
+        std::memcpy(&tail, in + sizeof head + count*elementSize, sizeof tail);
+
+        if ((head != expected) || (tail != expected)) {
+            throw std::runtime_error {
+                fmt::format("Inconsistent record markers in binary array "
+                            "data at element {} of {}", done, num)
+            };
+        }
+
+        swap(in + sizeof head, out + done*elementSize, static_cast<std::size_t>(count));
+
+        in += count*elementSize + 2*sizeof head;
+        done += count;
+    }
+
+    return static_cast<std::size_t>(in - src);
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,92 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLBINARYKERNELS_HPP
+#define OPM_IO_ECLBINARYKERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Opm { namespace EclIO {
+
+/// Bulk conversion kernels for binary ECLIPSE arrays.
+///
+/// Numeric array data is stored big-endian on disk and split into
+/// Fortran records of at most 1000 elements (MaxBlockSizeInte and
+/// friends), each record framed by a leading and trailing 4 byte length
+/// marker.  The kernels below reverse byte order of whole buffers using
+/// the widest vector instructions available on the host (AVX2, SSSE3 or
+/// NEON), selected once at runtime, with a portable scalar fallback.
+
+/// Reverse byte order of \p n consecutive 4 byte elements.
+///
+/// \p src and \p dst may be identical (in-place conversion) but must
+/// not otherwise overlap.
+void swapEndian32(const void* src, void* dst, std::size_t n);
+
+/// Reverse byte order of \p n consecutive 8 byte elements.
+///
+/// \p src and \p dst may be identical (in-place conversion) but must
+/// not otherwise overlap.
+void swapEndian64(const void* src, void* dst, std::size_t n);
+
+/// Name of instruction set used by swapEndian32/64 on this host.  One of
+/// "avx2", "ssse3", "neon" or "scalar".
+const char* endianKernelISA();
+
+/// Encode native-endian array into framed, big-endian on-disk format.
+///
+/// \param[in] src Contiguous array of \p num elements.
+///
+/// \param[in] num Number of array elements.
+///
+/// \param[in] elementSize Element size in bytes (4 or 8).
+///
+/// \param[in] blockElements Maximum number of elements per record.
+///
+/// \param[out] dst Output buffer.  Must hold at least
+///    sizeOnDiskBinary(num, type, elementSize) bytes.
+///
+/// \return Number of bytes written to \p dst.
+std::size_t encodeBinaryRecords(const void* src, std::int64_t num,
+                                int elementSize, int blockElements,
+                                char* dst);
+
+/// Decode framed, big-endian on-disk array into native-endian storage.
+///
+/// Throws std::runtime_error if record markers are inconsistent with
+/// the expected sizes.
+///
+/// \param[in] src Start of first record (leading marker of first block).
+///
+/// \param[in] num Number of array elements.
+///
+/// \param[in] elementSize Element size in bytes (4 or 8).
+///
+/// \param[in] blockElements Maximum number of elements per record.
+///
+/// \param[out] dst Contiguous storage for \p num elements.
+///
+/// \return Number of bytes consumed from \p src.
+std::size_t decodeBinaryRecords(const char* src, std::int64_t num,
+                                int elementSize, int blockElements,
+                                void* dst);
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLBINARYKERNELS_HPP
@@ -17,21 +17,156 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
+#include <exception>
+#include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include <fmt/format.h>
 
+namespace {
+
+int readRecordMarker(const char* p)
+{
+    int marker;
+    std::memcpy(&marker, p, sizeof marker);
+    return Opm::EclIO::flipEndianInt(marker);
+}
+
+// Verify Fortran record framing of a binary array's data blocks inside a
+// memory mapped file.  Mirrors the checks in readBinaryArray<>().
+void checkMappedRecords(const Opm::EclIO::MappedFile& file,
+                        const std::uint64_t dataPos,
+                        const std::int64_t size,
+                        const int elementSize,
+                        const int blockElements)
+{
+    const char* p = file.data() + dataPos;
+    const char* end = file.data() + file.size();
+
+    std::int64_t rest = size;
+
+    while (rest > 0) {
+        const auto num = std::min<std::int64_t>(rest, blockElements);
+        const auto blockBytes = static_cast<int>(num * elementSize);
+
+        if (end - p < blockBytes + 2*Opm::EclIO::sizeOfInte) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Array data extends beyond end of mapped file {}", file.filename()));
+        }
+
+        const auto head = readRecordMarker(p);
+        const auto tail = readRecordMarker(p + Opm::EclIO::sizeOfInte + blockBytes);
+
+        if ((head != blockBytes) || (tail != blockBytes)) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Error reading binary data from {}, "
+                                  "inconsistent record markers", file.filename()));
+        }
+
+        p    += blockBytes + 2*Opm::EclIO::sizeOfInte;
+        rest -= num;
+    }
+}
+
+// Identifies the version of a file an index was generated from: Size
+// in bytes and last modification time.  Any change, e.g., due to a
+// running simulation appending more data, invalidates the index.
+bool fileStamp(const std::string& filename,
+               std::int64_t& size,
+               std::int64_t& mtime)
+{
+    auto ec = std::error_code{};
+
+    const auto fsize = std::filesystem::file_size(filename, ec);
+    if (ec) {
+        return false;
+    }
+
+    const auto ftime = std::filesystem::last_write_time(filename, ec);
+    if (ec) {
+        return false;
+    }
+
+    size = static_cast<std::int64_t>(fsize);
+    mtime = static_cast<std::int64_t>(ftime.time_since_epoch().count());
+
+    return true;
+}
+
+// 64-bit quantities are stored as pairs of INTE elements.
+void appendSplit(const std::uint64_t value, std::vector<int>& dest)
+{
+    dest.push_back(static_cast<int>(static_cast<std::uint32_t>(value >> 32)));
+    dest.push_back(static_cast<int>(static_cast<std::uint32_t>(value & 0xFFFFFFFFu)));
+}
+
+std::uint64_t joinSplit(const std::vector<int>& src, const std::size_t pos)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(src[pos + 0])) << 32)
+        |   static_cast<std::uint64_t>(static_cast<std::uint32_t>(src[pos + 1]));
+}
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
+EclFile::LoadState::LoadState(const std::size_t numArrays)
+    : latches_   { std::make_unique<std::mutex[]>(NumLatches) }
+    , cacheLock_ { std::make_unique<std::shared_mutex>() }
+{
+    this->reset(numArrays);
+}
+
+EclFile::LoadState::LoadState(const LoadState& rhs)
+    : LoadState(rhs.size_)
+{
+    for (std::size_t i = 0; i < this->size_; ++i) {
+        if (rhs.isLoaded(i)) {
+            this->setLoaded(i);
+        }
+    }
+}
+
+EclFile::LoadState& EclFile::LoadState::operator=(const LoadState& rhs)
+{
+    if (this != &rhs) {
+        *this = LoadState { rhs };
+    }
+
+    return *this;
+}
+
+void EclFile::LoadState::reset(const std::size_t numArrays)
+{
+    this->size_ = numArrays;
+    this->loaded_ = std::make_unique<std::atomic<bool>[]>(numArrays);
+
+    for (std::size_t i = 0; i < numArrays; ++i) {
+        this->loaded_[i].store(false, std::memory_order_relaxed);
+    }
+}
+
+
 void EclFile::load(bool preload) {
     std::fstream fileH;
 
@@ -44,6 +179,10 @@ void EclFile::load(bool preload) {
     if (!fileH)
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", this->inputFilename));
 
+    // Data offset to array index, for resolving references to earlier
+    // arrays in binary files.
+    std::unordered_map<std::uint64_t, int> positionIndex;
+
     int n = 0;
     while (!isEOF(&fileH)) {
         std::string arrName(8,' ');
@@ -62,6 +201,47 @@ void EclFile::load(bool preload) {
                 fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", this->inputFilename, e.what()));
         }
 
+        if (!formatted && (arrType == MESS) && (trimr(arrName) == referenceMessage)) {
+            // Substitute the referenced array for the reference.
+            const auto ref = this->readReference(fileH, positionIndex);
+
+            array_size.push_back(array_size[ref]);
+            array_type.push_back(array_type[ref]);
+            array_name.push_back(array_name[ref]);
+            array_element_size.push_back(array_element_size[ref]);
+
+            array_index[array_name[n]] = n;
+            ifStreamPos.push_back(ifStreamPos[ref]);
+
+            if (auto words = this->compressed_words.find(ref); words != this->compressed_words.end()) {
+                this->compressed_words.emplace(n, words->second);
+            }
+
+            n++;
+            continue;
+        }
+
+        if (!formatted && (arrType == MESS) && (trimr(arrName) == compressedMessage)) {
+            // Substitute the original array for the compressed one.
+            const auto [origType, origSize] = this->readCompressedHeader(fileH, arrName, num);
+            const std::uint64_t pos = fileH.tellg();
+
+            array_size.push_back(origSize);
+            array_type.push_back(origType);
+            array_name.push_back(trimr(arrName));
+            array_element_size.push_back(origType == DOUB ? sizeOfDoub : sizeOfReal);
+
+            array_index[array_name[n]] = n;
+            ifStreamPos.push_back(pos);
+            positionIndex.emplace(pos, n);
+            this->compressed_words.emplace(n, num);
+
+            fileH.seekg(static_cast<std::streamoff>(pos + sizeOnDiskBinary(num, INTE, sizeOfInte)), std::ios_base::beg);
+
+            n++;
+            continue;
+        }
+
         array_size.push_back(num);
         array_type.push_back(arrType);
         array_name.push_back(trimr(arrName));
@@ -72,7 +252,9 @@ void EclFile::load(bool preload) {
         std::uint64_t pos = fileH.tellg();
         ifStreamPos.push_back(pos);
 
-        arrayLoaded.push_back(false);
+        if (!formatted) {
+            positionIndex.emplace(pos, n);
+        }
 
         if (num > 0){
             if (formatted) {
@@ -91,11 +273,138 @@ void EclFile::load(bool preload) {
     this->ifStreamPos.push_back(static_cast<std::uint64_t>(fileH.tellg()));
     fileH.close();
 
+    this->loadState_.reset(this->array_name.size());
+
     if (preload)
         this->loadData();
 }
 
 
+std::pair<eclArrType, std::int64_t>
+EclFile::readCompressedHeader(std::fstream& fileH, std::string& arrName, std::int64_t& numWords) const
+{
+    eclArrType arrType;
+    int sizeOfElement;
+
+    readBinaryHeader(fileH, arrName, numWords, arrType, sizeOfElement);
+    const auto pos = fileH.tellg();
+
+    // Record marker and the four element prefix described at
+    // compressedMessage.
+    int record[5];
+    if ((arrType != INTE) || (numWords < 4) ||
+        !fileH.read(reinterpret_cast<char*>(record), sizeof(record)))
+    {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Invalid compressed array {} in {}", trimr(arrName), this->inputFilename));
+    }
+
+    fileH.seekg(pos);
+
+    const auto version = flipEndianInt(record[1]);
+    const auto type = static_cast<eclArrType>(flipEndianInt(record[2]));
+    const auto size =
+        (static_cast<std::uint64_t>(static_cast<std::uint32_t>(flipEndianInt(record[3]))) << 32)
+        | static_cast<std::uint64_t>(static_cast<std::uint32_t>(flipEndianInt(record[4])));
+
+    if ((version != compressedVersion) || ((type != REAL) && (type != DOUB)) ||
+        (size > static_cast<std::uint64_t>(std::numeric_limits<int>::max())))
+    {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Unsupported compressed array {} in {}", trimr(arrName), this->inputFilename));
+    }
+
+    return { type, static_cast<std::int64_t>(size) };
+}
+
+
+template <typename T>
+std::vector<T> EclFile::decompress(const std::size_t arrIndex, const std::vector<int>& packed) const
+{
+    constexpr std::size_t prefixSize = 4;
+
+    auto values = std::vector<T>(this->array_size[arrIndex]);
+
+    try {
+        if constexpr (std::is_same_v<T, float>) {
+            decodeFloatChunk(packed.data() + prefixSize, packed.size() - prefixSize,
+                             values.size(), values.data());
+        }
+        else {
+            decodeDoubleChunk(packed.data() + prefixSize, packed.size() - prefixSize,
+                              values.size(), values.data());
+        }
+    }
+    catch (const std::exception& e) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Unable to decode array {} in {}: {}",
+                              this->array_name[arrIndex], this->inputFilename, e.what()));
+    }
+
+    return values;
+}
+
+
+template <typename T>
+std::vector<T> EclFile::mappedArray(const std::size_t arrIndex,
+                                    const eclArrType type,
+                                    const std::string& typeStr)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        const auto words = this->compressed_words.find(static_cast<int>(arrIndex));
+        if ((words != this->compressed_words.end()) && (array_type[arrIndex] == type)) {
+            const auto [elementSize, maxBlockSize] = block_size_data_binary(INTE);
+            const int blockElements = maxBlockSize / elementSize;
+
+            checkMappedRecords(*this->mapping_, ifStreamPos[arrIndex],
+                               words->second, elementSize, blockElements);
+
+            const auto packed = EclArrayView<int> {
+                this->mapping_, this->mapping_->data() + ifStreamPos[arrIndex],
+                words->second, blockElements
+            }.toVector();
+
+            return this->decompress<T>(arrIndex, packed);
+        }
+    }
+
+    return this->makeView<T>(arrIndex, type, typeStr).toVector();
+}
+
+
+int EclFile::readReference(std::fstream& fileH,
+                           const std::unordered_map<std::uint64_t, int>& positionIndex) const
+{
+    std::string arrName(8,' ');
+    eclArrType arrType;
+    std::int64_t num;
+    int sizeOfElement;
+
+    readBinaryHeader(fileH, arrName, num, arrType, sizeOfElement);
+
+    // Record of two integers between 4 byte markers.
+    int record[4];
+    if ((arrType != INTE) || (num != 2) ||
+        !fileH.read(reinterpret_cast<char*>(record), sizeof(record)))
+    {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Invalid reference to array {} in {}", trimr(arrName), this->inputFilename));
+    }
+
+    const auto offset =
+        (static_cast<std::uint64_t>(static_cast<std::uint32_t>(flipEndianInt(record[1]))) << 32)
+        | static_cast<std::uint64_t>(static_cast<std::uint32_t>(flipEndianInt(record[2])));
+
+    const auto pos = positionIndex.find(offset);
+    if ((pos == positionIndex.end()) || (this->array_name[pos->second] != trimr(arrName))) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Reference to array {} in {} does not match an earlier array",
+                              trimr(arrName), this->inputFilename));
+    }
+
+    return pos->second;
+}
+
 EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool preload) :
     formatted(fmt.value),
     inputFilename(filename)
@@ -115,37 +424,121 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 }
 
 
+EclFile::EclFile(const std::string& filename, DeferredLoad) :
+    inputFilename(filename)
+{
+    if (!fileExists(filename))
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    formatted = isFormatted(filename);
+}
+
+
+void EclFile::setArrayList(std::vector<std::string> names,
+                           std::vector<eclArrType> types,
+                           std::vector<std::int64_t> sizes,
+                           std::vector<int> elementSizes,
+                           std::vector<std::uint64_t> positions)
+{
+    const auto n = names.size();
+    if ((types.size() != n) || (sizes.size() != n) ||
+        (elementSizes.size() != n) || (positions.size() != n + 1))
+    {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Inconsistent array list for {}", this->inputFilename));
+    }
+
+    this->array_name = std::move(names);
+    this->array_type = std::move(types);
+    this->array_size = std::move(sizes);
+    this->array_element_size = std::move(elementSizes);
+    this->ifStreamPos = std::move(positions);
+    this->compressed_words.clear();
+
+    this->array_index.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+        this->array_index[this->array_name[i]] = static_cast<int>(i);
+    }
+
+    this->loadState_.reset(n);
+}
+
+
+void EclFile::clearArrayList()
+{
+    this->array_name.clear();
+    this->array_type.clear();
+    this->array_size.clear();
+    this->array_element_size.clear();
+    this->ifStreamPos.clear();
+    this->array_index.clear();
+    this->compressed_words.clear();
+    this->loadState_.reset(0);
+}
+
+
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
+    if (this->mapping_ != nullptr) {
+        switch (array_type[arrIndex]) {
+        case INTE:
+            this->storeArray(inte_array, arrIndex, this->mappedArray<int>(arrIndex, INTE, "integer"));
+            return;
+        case REAL:
+            this->storeArray(real_array, arrIndex, this->mappedArray<float>(arrIndex, REAL, "float"));
+            return;
+        case DOUB:
+            this->storeArray(doub_array, arrIndex, this->mappedArray<double>(arrIndex, DOUB, "double"));
+            return;
+        default:
+            // LOGI values are validated, and string arrays trimmed, by
+            // the stream readers.
+            break;
+        }
+    }
+
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
+    if (const auto words = this->compressed_words.find(static_cast<int>(arrIndex));
+        words != this->compressed_words.end())
+    {
+        const auto packed = readBinaryInteArray(fileH, words->second);
+        if (array_type[arrIndex] == REAL) {
+            this->storeArray(real_array, arrIndex, this->decompress<float>(arrIndex, packed));
+        }
+        else {
+            this->storeArray(doub_array, arrIndex, this->decompress<double>(arrIndex, packed));
+        }
+
+        return;
+    }
+
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
+        this->storeArray(inte_array, arrIndex, readBinaryInteArray(fileH, array_size[arrIndex]));
         break;
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
+        this->storeArray(real_array, arrIndex, readBinaryRealArray(fileH, array_size[arrIndex]));
         break;
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
+        this->storeArray(doub_array, arrIndex, readBinaryDoubArray(fileH, array_size[arrIndex]));
         break;
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
+        this->storeArray(logi_array, arrIndex, readBinaryLogiArray(fileH, array_size[arrIndex]));
         break;
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
+        this->storeArray(char_array, arrIndex, readBinaryCharArray(fileH, array_size[arrIndex]));
         break;
     case C0NN:
-        char_array[arrIndex] = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
+        this->storeArray(char_array, arrIndex, readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]));
         break;
     case MESS:
+        this->loadState_.setLoaded(arrIndex);
         break;
     default:
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
         break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
@@ -153,31 +546,30 @@ void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrInde
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readFormattedInteArray(fileStr, array_size[arrIndex], fromPos);
+        this->storeArray(inte_array, arrIndex, readFormattedInteArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case REAL:
-        real_array[arrIndex] = readFormattedRealArray(fileStr, array_size[arrIndex], fromPos);
+        this->storeArray(real_array, arrIndex, readFormattedRealArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case DOUB:
-        doub_array[arrIndex] = readFormattedDoubArray(fileStr, array_size[arrIndex], fromPos);
+        this->storeArray(doub_array, arrIndex, readFormattedDoubArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case LOGI:
-        logi_array[arrIndex] = readFormattedLogiArray(fileStr, array_size[arrIndex], fromPos);
+        this->storeArray(logi_array, arrIndex, readFormattedLogiArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case CHAR:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, sizeOfChar);
+        this->storeArray(char_array, arrIndex, readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, sizeOfChar));
         break;
     case C0NN:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, array_element_size[arrIndex]);
+        this->storeArray(char_array, arrIndex, readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, array_element_size[arrIndex]));
         break;
     case MESS:
+        this->loadState_.setLoaded(arrIndex);
         break;
     default:
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
         break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
 
@@ -193,19 +585,10 @@ void EclFile::loadData()
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
+        std::vector<int> arrIndices(array_name.size());
+        std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-        fileH.close();
+        this->loadData(arrIndices);
     }
 }
 
@@ -219,7 +602,7 @@ void EclFile::loadData(const std::string& name)
 
         for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
 
-            if (array_name[arrIndex] == name) {
+            if ((array_name[arrIndex] == name) && !this->loadState_.isLoaded(arrIndex)) {
 
                 inFile.seekg(ifStreamPos[arrIndex]);
 
@@ -246,7 +629,7 @@ void EclFile::loadData(const std::string& name)
         }
 
         for (size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
+            if ((array_name[i] == name) && !this->loadState_.isLoaded(i)) {
                 loadBinaryArray(fileH, i);
             }
         }
@@ -256,8 +639,12 @@ void EclFile::loadData(const std::string& name)
 }
 
 
-void EclFile::loadData(const std::vector<int>& arrIndex)
+void EclFile::loadData(const std::vector<int>& requested)
 {
+    const auto arrIndex = this->pendingArrays(requested);
+    if (arrIndex.empty()) {
+        return;
+    }
 
     if (formatted) {
 
@@ -279,6 +666,14 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
     } else {
+        const auto remaining = (arrIndex.size() > 1)
+            ? this->loadNumericArraysParallel(arrIndex)
+            : arrIndex;
+
+        if (remaining.empty()) {
+            return;
+        }
+
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
@@ -287,7 +682,7 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
             OPM_THROW(std::runtime_error, message);
         }
 
-        for (int ind : arrIndex) {
+        for (int ind : remaining) {
             loadBinaryArray(fileH, ind);
         }
 
@@ -296,8 +691,91 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
 }
 
 
+std::vector<int> EclFile::loadNumericArraysParallel(const std::vector<int>& arrIndex)
+{
+    // INTE, REAL and DOUB arrays are decoded concurrently from a memory
+    // mapping of the file.  Each task touches a disjoint region of the
+    // mapping, so there is no shared stream position.  Results are
+    // inserted into the array caches serially afterwards since neither
+    // the unordered_maps support concurrent updates.
+
+    std::vector<int> numeric, remaining;
+    for (const int ind : arrIndex) {
+        const auto type = array_type[ind];
+        if ((type == INTE) || (type == REAL) || (type == DOUB)) {
+            numeric.push_back(ind);
+        } else {
+            remaining.push_back(ind);
+        }
+    }
+
+    if (numeric.empty()) {
+        return remaining;
+    }
+
+    this->memoryMap();
+
+    const auto numTasks = static_cast<int>(numeric.size());
+
+    std::vector<std::vector<int>>    inte(numTasks);
+    std::vector<std::vector<float>>  real(numTasks);
+    std::vector<std::vector<double>> doub(numTasks);
+    std::vector<std::exception_ptr>  failure(numTasks);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int task = 0; task < numTasks; ++task) {
+        const auto ind = static_cast<std::size_t>(numeric[task]);
+
+        try {
+            switch (array_type[ind]) {
+            case INTE:
+                inte[task] = this->mappedArray<int>(ind, INTE, "integer");
+                break;
+            case REAL:
+                real[task] = this->mappedArray<float>(ind, REAL, "float");
+                break;
+            default:
+                doub[task] = this->mappedArray<double>(ind, DOUB, "double");
+                break;
+            }
+        }
+        catch (...) {
+            failure[task] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : failure) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (int task = 0; task < numTasks; ++task) {
+        const auto ind = numeric[task];
+
+        switch (array_type[ind]) {
+        case INTE:
+            this->storeArray(inte_array, ind, std::move(inte[task]));
+            break;
+        case REAL:
+            this->storeArray(real_array, ind, std::move(real[task]));
+            break;
+        default:
+            this->storeArray(doub_array, ind, std::move(doub[task]));
+            break;
+        }
+    }
+
+    return remaining;
+}
+
+
 void EclFile::loadData(int arrIndex)
 {
+    if (this->loadState_.isLoaded(arrIndex)) {
+        return;
+    }
+
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
@@ -636,17 +1114,248 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
         OPM_THROW(std::runtime_error, message);
     }
 
-    if (!arrayLoaded[arrIndex]) {
+    if (!this->loadState_.isLoaded(arrIndex)) {
+        // Binary arrays are read through the memory mapping, formatted
+        // arrays through a stream local to loadData().  Neither shares a
+        // file position with concurrent loads of other arrays.
+        if (!this->formatted) {
+            this->memoryMap();
+        }
+
+        std::lock_guard<std::mutex> latch { this->loadState_.latch(arrIndex) };
         loadData(arrIndex);
     }
 
+    std::shared_lock<std::shared_mutex> lock { this->loadState_.cacheLock() };
     return array.at(arrIndex);
 }
 
 
+template <typename T>
+void EclFile::storeArray(std::unordered_map<int, std::vector<T>>& cache,
+                         const std::size_t arrIndex,
+                         std::vector<T>&& data)
+{
+    {
+        std::unique_lock<std::shared_mutex> lock { this->loadState_.cacheLock() };
+        cache.try_emplace(static_cast<int>(arrIndex), std::move(data));
+    }
+
+    this->loadState_.setLoaded(arrIndex);
+}
+
+
+std::vector<int> EclFile::pendingArrays(const std::vector<int>& arrIndex) const
+{
+    std::vector<int> pending;
+    pending.reserve(arrIndex.size());
+
+    std::copy_if(arrIndex.begin(), arrIndex.end(), std::back_inserter(pending),
+                 [this](const int ind) { return !this->loadState_.isLoaded(ind); });
+
+    return pending;
+}
+
+
+void EclFile::memoryMap()
+{
+    if (this->formatted) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Memory mapping not supported for formatted file {}", this->inputFilename));
+    }
+
+    std::unique_lock<std::shared_mutex> lock { this->loadState_.cacheLock() };
+    if (this->mapping_ == nullptr) {
+        this->mapping_ = std::make_shared<const MappedFile>(this->inputFilename);
+    }
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::makeView(const std::size_t arrIndex,
+                                  const eclArrType type,
+                                  const std::string& typeStr)
+{
+    if (arrIndex >= this->array_name.size()) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array index {} out of range for file {}", arrIndex, this->inputFilename));
+    }
+
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if (this->compressed_words.count(static_cast<int>(arrIndex)) > 0) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array {} in {} is compressed and has no view",
+                              this->array_name[arrIndex], this->inputFilename));
+    }
+
+    this->memoryMap();
+
+    const auto [elementSize, maxBlockSize] = block_size_data_binary(type);
+    const int blockElements = maxBlockSize / elementSize;
+
+    checkMappedRecords(*this->mapping_, ifStreamPos[arrIndex],
+                       array_size[arrIndex], elementSize, blockElements);
+
+    return { this->mapping_, this->mapping_->data() + ifStreamPos[arrIndex],
+             array_size[arrIndex], blockElements };
+}
+
+
+template<>
+EclArrayView<int> EclFile::getView<int>(int arrIndex)
+{
+    return this->makeView<int>(arrIndex, INTE, "integer");
+}
+
+template<>
+EclArrayView<float> EclFile::getView<float>(int arrIndex)
+{
+    return this->makeView<float>(arrIndex, REAL, "float");
+}
+
+template<>
+EclArrayView<double> EclFile::getView<double>(int arrIndex)
+{
+    return this->makeView<double>(arrIndex, DOUB, "double");
+}
+
+template<>
+EclArrayView<bool> EclFile::getView<bool>(int arrIndex)
+{
+    return this->makeView<bool>(arrIndex, LOGI, "bool");
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::getView(const std::string& name)
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return this->getView<T>(search->second);
+}
+
+template EclArrayView<int>    EclFile::getView<int>(const std::string&);
+template EclArrayView<float>  EclFile::getView<float>(const std::string&);
+template EclArrayView<double> EclFile::getView<double>(const std::string&);
+template EclArrayView<bool>   EclFile::getView<bool>(const std::string&);
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
 
 
+void EclFile::writeArrayDirectory(EclOutput& outFile, const int version) const
+{
+    std::int64_t size = 0, mtime = 0;
+    if (! fileStamp(this->inputFilename, size, mtime)) {
+        OPM_THROW(std::runtime_error,
+                  "Unable to determine size and modification time of " + this->inputFilename);
+    }
+
+    auto info = std::vector<int>{ version };
+    appendSplit(static_cast<std::uint64_t>(size), info);
+    appendSplit(static_cast<std::uint64_t>(mtime), info);
+
+    auto types = std::vector<int>{};
+    auto sizes = std::vector<int>{};
+    auto positions = std::vector<int>{};
+    types.reserve(this->array_type.size());
+
+    for (std::size_t i = 0; i < this->array_name.size(); ++i) {
+        types.push_back(static_cast<int>(this->array_type[i]));
+        appendSplit(static_cast<std::uint64_t>(this->array_size[i]), sizes);
+    }
+
+    for (const auto& pos : this->ifStreamPos) {
+        appendSplit(pos, positions);
+    }
+
+    outFile.write<int>("FILEINFO", info);
+
+    outFile.write<std::string>("ARRNAMES", this->array_name);
+    outFile.write<int>("ARRTYPES", types);
+    outFile.write<int>("ELMSIZES", this->array_element_size);
+    outFile.write<int>("ARRSIZES", sizes);
+    outFile.write<int>("ARRPOS", positions);
+
+    if (! this->compressed_words.empty()) {
+        // Array index followed by number of code words.
+        auto compressed = std::vector<int>{};
+        for (const auto& [arrIndex, numWords] : this->compressed_words) {
+            compressed.push_back(arrIndex);
+            appendSplit(static_cast<std::uint64_t>(numWords), compressed);
+        }
+
+        outFile.write<int>("ARRZWRDS", compressed);
+    }
+}
+
+
+bool EclFile::readArrayDirectory(EclFile& index, const int version)
+{
+    std::int64_t size = 0, mtime = 0;
+    if (! fileStamp(this->inputFilename, size, mtime)) {
+        return false;
+    }
+
+    const auto& info = index.get<int>("FILEINFO");
+    if ((info.size() != 5) || (info[0] != version) ||
+        (static_cast<std::int64_t>(joinSplit(info, 1)) != size) ||
+        (static_cast<std::int64_t>(joinSplit(info, 3)) != mtime))
+    {
+        return false;
+    }
+
+    const auto& names = index.get<std::string>("ARRNAMES");
+    const auto& types = index.get<int>("ARRTYPES");
+    const auto& elmSizes = index.get<int>("ELMSIZES");
+    const auto& sizes = index.get<int>("ARRSIZES");
+    const auto& positions = index.get<int>("ARRPOS");
+
+    const auto n = names.size();
+    if ((sizes.size() != 2*n) || (positions.size() != 2*(n + 1))) {
+        return false;
+    }
+
+    auto arrTypes = std::vector<eclArrType>{};
+    auto arrSizes = std::vector<std::int64_t>{};
+    auto arrPos = std::vector<std::uint64_t>{};
+    arrTypes.reserve(n);
+    arrSizes.reserve(n);
+    arrPos.reserve(n + 1);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        arrTypes.push_back(static_cast<eclArrType>(types.at(i)));
+        arrSizes.push_back(static_cast<std::int64_t>(joinSplit(sizes, 2*i)));
+    }
+
+    for (std::size_t i = 0; i < n + 1; ++i) {
+        arrPos.push_back(joinSplit(positions, 2*i));
+    }
+
+    this->setArrayList(names, std::move(arrTypes), std::move(arrSizes),
+                       elmSizes, std::move(arrPos));
+
+    if (index.hasKey("ARRZWRDS")) {
+        const auto& compressed = index.get<int>("ARRZWRDS");
+        for (std::size_t i = 0; i + 2 < compressed.size(); i += 3) {
+            this->compressed_words.emplace(compressed[i],
+                                           static_cast<std::int64_t>(joinSplit(compressed, i + 1)));
+        }
+    }
+
+    return true;
+}
+
+
 }} // namespace Opm::ecl
@@ -19,19 +19,35 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclArrayView.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <atomic>
 #include <ios>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 
 namespace Opm { namespace EclIO {
 
+class EclOutput;
+
+/// Directory of, and on-demand access to, the arrays of an ECL file.
+///
+/// The get<T>() and getView<T>() member functions may be called from
+/// several threads at once on the same object.  Each array is loaded at
+/// most once, binary files through a shared memory mapping of the file and
+/// formatted files through a stream private to the load, and references
+/// returned by get<T>() remain valid until clearData() is called.  All
+/// other non-const member functions require exclusive access.
 class EclFile
 {
 public:
@@ -43,10 +59,12 @@ public:
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
     bool formattedInput() const { return formatted; }
 
+    // Arrays which are already loaded are not read again.
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
     void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
+                                                       // numeric arrays in binary files are decoded in parallel
 
     void clearData()
     {
@@ -55,6 +73,7 @@ public:
       doub_array.clear();
       logi_array.clear();
       char_array.clear();
+      loadState_.reset(array_name.size());
     }
 
     using EclEntry = std::tuple<std::string, eclArrType, std::int64_t>;
@@ -68,6 +87,26 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    /// Memory map the input file.
+    ///
+    /// Subsequent calls to get<T>() for numeric arrays decode the data
+    /// directly from the mapping rather than through file streams, and
+    /// getView<T>() becomes available without further setup.  Only
+    /// supported for binary files.  No-op if the file is already mapped.
+    void memoryMap();
+    bool isMapped() const { return this->mapping_ != nullptr; }
+
+    /// Zero-copy view of a numeric array (INTE, REAL, DOUB or LOGI).
+    ///
+    /// Maps the file on first use.  Elements are byte-swapped on access,
+    /// so the view does not populate the get<T>() cache.  Throws
+    /// std::runtime_error for formatted files or array type mismatch.
+    template <typename T>
+    EclArrayView<T> getView(int arrIndex);
+
+    template <typename T>
+    EclArrayView<T> getView(const std::string& name);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -94,6 +133,12 @@ protected:
 
     std::map<std::string, int> array_index;
 
+    // Number of INTE code words of each compressed array, see
+    // compressedMessage.  Compressed arrays are decoded on load, and
+    // have no zero-copy view.
+    std::unordered_map<int, std::int64_t> compressed_words;
+
+    // Loads the array on first access.  Safe to call concurrently.
     template<class T>
     const std::vector<T>& getImpl(int arrIndex, eclArrType type,
                                   const std::unordered_map<int, std::vector<T>>& array,
@@ -102,12 +147,125 @@ protected:
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
+    // Tag for derived classes that populate the array directory
+    // themselves, either through load() or setArrayList().
+    struct DeferredLoad {};
+    EclFile(const std::string& filename, DeferredLoad);
+
+    void load(bool preload);
+
+    // Install a previously scanned array directory.  The \p positions
+    // vector holds the data offset of each array followed by the file
+    // size, i.e., the layout of ifStreamPos.
+    void setArrayList(std::vector<std::string> names,
+                      std::vector<eclArrType> types,
+                      std::vector<std::int64_t> sizes,
+                      std::vector<int> elementSizes,
+                      std::vector<std::uint64_t> positions);
+
+    // Forget the array directory, e.g., to rescan the file after
+    // failing to use an index file.
+    void clearArrayList();
+
+    // Array directory as stored in index files of derived classes:
+    // FILEINFO (index layout version, size and modification time of
+    // the file), ARRNAMES, ARRTYPES, ELMSIZES, ARRSIZES and ARRPOS.
+    void writeArrayDirectory(EclOutput& outFile, int version) const;
+
+    // Install the array directory stored in \p index.  Returns false if
+    // the index has a different layout version or was not generated
+    // from the current contents of the file.
+    bool readArrayDirectory(EclFile& index, int version);
+
 private:
-    std::vector<bool> arrayLoaded;
+    /// Synchronisation of on-demand loading.
+    ///
+    /// One load flag per array, a latch which serialises loads of the
+    /// same array and a lock guarding the array caches.  Latches are
+    /// shared by arrays with the same index modulo the number of latches.
+    /// Copies take over the load flags but have locks of their own.
+    class LoadState
+    {
+    public:
+        explicit LoadState(std::size_t numArrays = 0);
+
+        LoadState(const LoadState& rhs);
+        LoadState(LoadState&& rhs) noexcept = default;
+
+        LoadState& operator=(const LoadState& rhs);
+        LoadState& operator=(LoadState&& rhs) noexcept = default;
+
+        // Resize to numArrays arrays, none of which are loaded.
+        void reset(std::size_t numArrays);
+
+        bool isLoaded(const std::size_t arrIndex) const
+        {
+            return this->loaded_[arrIndex].load(std::memory_order_acquire);
+        }
+
+        void setLoaded(const std::size_t arrIndex)
+        {
+            this->loaded_[arrIndex].store(true, std::memory_order_release);
+        }
+
+        std::mutex& latch(const std::size_t arrIndex)
+        {
+            return this->latches_[arrIndex % NumLatches];
+        }
+
+        std::shared_mutex& cacheLock() { return *this->cacheLock_; }
+
+    private:
+        static constexpr std::size_t NumLatches = 64;
+
+        std::size_t size_{0};
+        std::unique_ptr<std::atomic<bool>[]> loaded_{};
+        std::unique_ptr<std::mutex[]> latches_{};
+        std::unique_ptr<std::shared_mutex> cacheLock_{};
+    };
+
+    LoadState loadState_{};
+    std::shared_ptr<const MappedFile> mapping_{};
+
+    // Insert a decoded array into its cache unless already present, so
+    // that references handed out by get<T>() are never invalidated.
+    template <typename T>
+    void storeArray(std::unordered_map<int, std::vector<T>>& cache,
+                    std::size_t arrIndex, std::vector<T>&& data);
+
+    // Indices in arrIndex of arrays not yet loaded.
+    std::vector<int> pendingArrays(const std::vector<int>& arrIndex) const;
+
+    template <typename T>
+    EclArrayView<T> makeView(std::size_t arrIndex, eclArrType type, const std::string& typeStr);
+
+    // Numeric array decoded from the memory mapping, whether compressed
+    // or not.
+    template <typename T>
+    std::vector<T> mappedArray(std::size_t arrIndex, eclArrType type, const std::string& typeStr);
+
+    // Decode compressed array from its code words.
+    template <typename T>
+    std::vector<T> decompress(std::size_t arrIndex, const std::vector<int>& packed) const;
+
+    // Read the header of the array following a compressedMessage record
+    // into \p arrName and \p numWords, and validate its prefix.  Returns
+    // the original type and size.  Leaves \p fileH at the start of the
+    // array data.
+    std::pair<eclArrType, std::int64_t>
+    readCompressedHeader(std::fstream& fileH, std::string& arrName, std::int64_t& numWords) const;
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+
+    // Read the reference following a referenceMessage record.  Returns
+    // the index of the referenced array.
+    int readReference(std::fstream& fileH,
+                      const std::unordered_map<std::uint64_t, int>& positionIndex) const;
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
-    void load(bool preload);
+
+    // Returns those indices that are not numeric and must be loaded
+    // through the stream readers.
+    std::vector<int> loadNumericArraysParallel(const std::vector<int>& arrIndex);
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
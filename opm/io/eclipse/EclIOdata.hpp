@@ -34,6 +34,20 @@ namespace Opm { namespace EclIO {
     const unsigned int true_value_ix = 0x1000000;
     const unsigned int false_value = 0x00000000;
 
+    // OPM extension.  Message preceding an INTE array of two elements
+    // which holds the file offset, high and low 32 bits, of the data of
+    // an identical array earlier in the same binary file.  Readers
+    // substitute that array for the pair.
+    const char referenceMessage[] = "OPMREF";
+
+    // OPM extension.  Message preceding an INTE array which holds a
+    // losslessly compressed REAL or DOUB array of the same name: format
+    // version, type of the original array, number of elements (high and
+    // low 32 bits) and the code words of encodeFloatChunk() or
+    // encodeDoubleChunk().  Readers decode the array transparently.
+    const char compressedMessage[] = "OPMZIP";
+    const int compressedVersion = 1;
+
 
     const int sizeOfInte =  4;    // number of bytes pr integer (inte) element
     const int sizeOfReal =  4;    // number of bytes pr float (real) element
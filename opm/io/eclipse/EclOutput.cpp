@@ -17,28 +17,408 @@
    */
 
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <charconv>
+#include <cerrno>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <ios>
+#include <limits>
+#include <mutex>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <typeinfo>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+    // Two independent 64 bit hashes of an array's contents.
+    std::pair<std::uint64_t, std::uint64_t> contentHash(std::string_view content)
+    {
+        // FNV-1a
+        auto fnv = std::uint64_t{14695981039346656037ull};
+        for (const auto c : content) {
+            fnv ^= static_cast<unsigned char>(c);
+            fnv *= 1099511628211ull;
+        }
+
+        return { fnv, static_cast<std::uint64_t>(std::hash<std::string_view>{}(content)) };
+    }
+
+    // Arrays smaller than a reference are written in full.
+    constexpr std::size_t minReferencedBytes = 64;
+
+    // Size of a binary array header without X231 prefix.
+    constexpr std::uint64_t binaryHeaderSize = 24;
+
+    // Arrays with fewer elements are not compressed.
+    constexpr std::size_t minCompressedSize = 64;
+
+    // Prefix the code words with the compressedMessage array description,
+    // unless that is no smaller than the original array.
+    std::vector<int> compressedPayload(const Opm::EclIO::eclArrType type,
+                                       const std::size_t size,
+                                       const std::size_t wordsPerElement,
+                                       const std::vector<int>& words)
+    {
+        constexpr std::size_t prefixSize = 4;
+
+        if ((size > static_cast<std::size_t>(std::numeric_limits<int>::max())) ||
+            (words.size() + prefixSize >= size * wordsPerElement))
+        {
+            return {};
+        }
+
+        auto packed = std::vector<int> {
+            Opm::EclIO::compressedVersion,
+            static_cast<int>(type),
+            static_cast<int>(static_cast<std::uint32_t>(std::uint64_t{size} >> 32)),
+            static_cast<int>(static_cast<std::uint32_t>(std::uint64_t{size} & 0xFFFFFFFFu)),
+        };
+
+        packed.insert(packed.end(), words.begin(), words.end());
+
+        return packed;
+    }
+
+    template <typename Strings>
+    std::string stringContent(const Strings& data)
+    {
+        auto content = std::string{};
+        for (const auto& str : data) {
+            content.append(str.c_str());
+            content.push_back('\0');
+        }
+
+        return content;
+    }
+
+    // Rounds |value| to precision + 1 significant digits like printf's
+    // "%.<precision>E".  Stores the digits, without the decimal point, in
+    // 'digits' and returns the decimal exponent.
+    int scientificDigits(const double value, const int precision, char* digits)
+    {
+        char buffer[32];
+
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+        const char* end = std::to_chars(buffer, buffer + sizeof buffer, std::abs(value),
+                                        std::chars_format::scientific, precision).ptr;
+#else
+        const char* end = buffer + std::snprintf(buffer, sizeof buffer, "%.*e",
+                                                 precision, std::abs(value));
+#endif
+
+        digits[0] = buffer[0];
+        std::copy_n(buffer + 2, precision, digits + 1);
+
+        // Exponent follows 'e' and its sign.
+        const char* p = buffer + precision + 3;
+        const bool negative = (*p++ == '-');
+
+        int exponent = 0;
+        for (; p != end; ++p)
+            exponent = 10*exponent + (*p - '0');
+
+        return negative ? -exponent : exponent;
+    }
+
+    // Exponent as printf's "%+03i".
+    char* writeExponent(const int exponent, char* out)
+    {
+        *out++ = (exponent < 0) ? '-' : '+';
+
+        const auto magnitude = std::abs(exponent);
+        if (magnitude < 10)
+            *out++ = '0';
+
+        return std::to_chars(out, out + 4, magnitude).ptr;
+    }
+
+    char* writeString(std::string_view str, char* out)
+    {
+        return std::copy(str.begin(), str.end(), out);
+    }
+
+    // Formatted REAL element.  Eclipse style is 0.dddddddd with an
+    // exponent one larger than in IX style, d.dddddddE+xx.
+    char* formatReal(const float value, const bool ix_standard, char* out)
+    {
+        if (value == 0.0f)
+            return writeString(ix_standard ? " 0.0000000E+00" : "0.00000000E+00", out);
+
+        if (std::isnan(value))
+            return writeString("NAN", out);
+
+        if (std::isinf(value))
+            return writeString((value > 0) ? "INF" : "-INF", out);
+
+        char digits[8];
+        const int exponent = scientificDigits(value, 7, digits);
+
+        if (value < 0)
+            *out++ = '-';
+
+        if (ix_standard) {
+            *out++ = digits[0];
+            *out++ = '.';
+            out = std::copy_n(digits + 1, 7, out);
+            *out++ = 'E';
+            return writeExponent(exponent, out);
+        }
+
+        *out++ = '0';
+        *out++ = '.';
+        out = std::copy_n(digits, 8, out);
+        *out++ = 'E';
+        return writeExponent(exponent + 1, out);
+    }
+
+    // Formatted DOUB element.  Eclipse style drops the 'D' for three
+    // digit exponents.
+    char* formatDoub(const double value, const bool ix_standard, char* out)
+    {
+        if (value == 0.0)
+            return writeString(ix_standard ? " 0.0000000000000E+00" : "0.00000000000000D+00", out);
+
+        if (std::isnan(value))
+            return writeString("NAN", out);
+
+        if (std::isinf(value))
+            return writeString((value > 0) ? "INF" : "-INF", out);
+
+        char digits[14];
+        const int exponent = scientificDigits(value, 13, digits);
+
+        if (value < 0)
+            *out++ = '-';
+
+        if (ix_standard) {
+            *out++ = digits[0];
+            *out++ = '.';
+            out = std::copy_n(digits + 1, 13, out);
+            *out++ = 'E';
+            return writeExponent(exponent, out);
+        }
+
+        *out++ = '0';
+        *out++ = '.';
+        out = std::copy_n(digits, 14, out);
+        if ((exponent >= -100) && (exponent < 99))
+            *out++ = 'D';
+
+        return writeExponent(exponent + 1, out);
+    }
+
+    // Appends elements [begin, end) of a formatted numeric or logical
+    // array to 'out', right aligned in columns and with line breaks at
+    // the end of each row and each block.
+    template <typename T>
+    void formatElements(const std::vector<T>& data,
+                        const std::size_t begin, const std::size_t end,
+                        const bool ix_standard,
+                        const int maxBlockSize, const int nColumns, const int columnWidth,
+                        std::string& out)
+    {
+        char buffer[32];
+
+        for (auto i = begin; i < end; ++i) {
+            char* last = buffer;
+
+            if constexpr (std::is_same_v<T, int>) {
+                last = std::to_chars(buffer, buffer + sizeof buffer, data[i]).ptr;
+            }
+            else if constexpr (std::is_same_v<T, float>) {
+                last = formatReal(data[i], ix_standard, buffer);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                last = formatDoub(data[i], ix_standard, buffer);
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                last = writeString(data[i] ? "  T" : "  F", buffer);
+            }
+
+            if constexpr (! std::is_same_v<T, bool>) {
+                const auto length = static_cast<int>(last - buffer);
+                if (length < columnWidth)
+                    out.append(columnWidth - length, ' ');
+            }
+
+            out.append(buffer, last);
+
+            const auto n = static_cast<int>(i % maxBlockSize) + 1;
+            if (((n % nColumns) == 0) || (n == maxBlockSize))
+                out.push_back('\n');
+        }
+    }
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
+void ArrayCatalog::restrict(const std::string& filename, const std::uint64_t end)
+{
+    if (filename != this->filename_) {
+        this->filename_ = filename;
+        this->offsets_.clear();
+        return;
+    }
+
+    for (auto it = this->offsets_.begin(); it != this->offsets_.end(); ) {
+        it = (it->second >= end) ? this->offsets_.erase(it) : std::next(it);
+    }
+}
+
+std::optional<std::uint64_t> ArrayCatalog::find(const Key& key) const
+{
+    auto pos = this->offsets_.find(key);
+    if (pos == this->offsets_.end())
+        return std::nullopt;
+
+    return pos->second;
+}
+
+void ArrayCatalog::insert(const Key& key, const std::uint64_t offset)
+{
+    this->offsets_.emplace(key, offset);
+}
+
+// Bounded FIFO of output jobs processed in order by a single background
+// thread.  The first exception raised by a job is kept and rethrown on
+// the producer side, remaining jobs are then discarded.
+class EclOutput::AsyncQueue
+{
+public:
+    explicit AsyncQueue(const std::size_t maxPending)
+        : maxPending_{std::max(maxPending, std::size_t{1})}
+        , worker_{[this]() { this->run(); }}
+    {}
+
+    ~AsyncQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex_};
+            this->stop_ = true;
+        }
+
+        this->cv_.notify_all();
+        this->worker_.join();
+    }
+
+    void push(std::function<void()> job)
+    {
+        std::unique_lock<std::mutex> lock{this->mutex_};
+
+        this->cv_.wait(lock, [this]() {
+            return (this->jobs_.size() < this->maxPending_) || this->error_;
+        });
+
+        this->rethrowError();
+
+        this->jobs_.push_back(std::move(job));
+        this->cv_.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock{this->mutex_};
+
+        this->cv_.wait(lock, [this]() {
+            return (this->jobs_.empty() && !this->busy_) || this->error_;
+        });
+
+        this->rethrowError();
+    }
+
+private:
+    std::size_t maxPending_;
+    std::deque<std::function<void()>> jobs_{};
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::thread worker_;
+
+    void rethrowError()
+    {
+        if (this->error_) {
+            auto error = this->error_;
+            this->error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock{this->mutex_};
+
+        while (true) {
+            this->cv_.wait(lock, [this]() {
+                return !this->jobs_.empty() || this->stop_;
+            });
+
+            if (this->jobs_.empty())
+                return;
+
+            auto job = std::move(this->jobs_.front());
+            this->jobs_.pop_front();
+            this->busy_ = true;
+
+            lock.unlock();
+
+            std::exception_ptr error{};
+            try {
+                job();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+
+            this->busy_ = false;
+
+            if (error) {
+                this->error_ = error;
+                this->jobs_.clear();
+            }
+
+            this->cv_.notify_all();
+        }
+    }
+};
+
 EclOutput::EclOutput(const std::string&            filename,
                      const bool                    formatted,
                      const std::ios_base::openmode mode)
     : isFormatted{formatted}
+    , fileName{filename}
 {
     const auto binmode = mode | std::ios_base::binary;
     ix_standard = false;
@@ -46,10 +426,132 @@ EclOutput::EclOutput(const std::string&            filename,
     this->ofileH.open(filename, this->isFormatted ? mode : binmode);
 }
 
+EclOutput::~EclOutput()
+{
+    // Destroying the queue completes all pending output.  Errors at this
+    // point can no longer be reported to the caller.
+    this->async_.reset();
+}
+
+void EclOutput::enableAsync(const std::size_t maxPending)
+{
+    if (this->async_ == nullptr)
+        this->async_ = std::make_unique<AsyncQueue>(maxPending);
+}
+
+void EclOutput::enableDeduplication(ArrayCatalog& catalog)
+{
+    if (this->isFormatted)
+        return;
+
+    this->waitForPendingWrites();
+
+    // Output always continues at the end of the file, but the position
+    // of a stream opened in append mode is not known until it is
+    // repositioned.
+    this->ofileH.seekp(0, std::ios_base::end);
+
+    const auto pos = static_cast<std::streamoff>(this->ofileH.tellp());
+    catalog.restrict(this->fileName, static_cast<std::uint64_t>(pos));
+
+    this->catalog_ = &catalog;
+}
+
+void EclOutput::enableCompression()
+{
+    if (this->isFormatted)
+        return;
+
+    this->waitForPendingWrites();
+    this->compress_ = true;
+}
+
+bool EclOutput::writeReference(const std::string& name, const eclArrType arrType, const int element_size,
+                               const std::int64_t size, std::string_view content, const bool compressed)
+{
+    if ((this->catalog_ == nullptr) || (content.size() < minReferencedBytes) ||
+        (size > std::numeric_limits<int>::max()))
+        return false;
+
+    const auto hash = contentHash(content);
+    const auto key = ArrayCatalog::Key { name, arrType, element_size, size, hash.first, hash.second };
+
+    if (const auto offset = this->catalog_->find(key); offset.has_value()) {
+        writeBinaryHeader(referenceMessage, 0, MESS, sizeOfInte);
+        writeBinaryHeader(name, 2, INTE, sizeOfInte);
+        writeBinaryArray(std::vector<int> {
+            static_cast<int>(static_cast<std::uint32_t>(*offset >> 32)),
+            static_cast<int>(static_cast<std::uint32_t>(*offset & 0xFFFFFFFFu))
+        });
+
+        return true;
+    }
+
+    // A compressed array is preceded by the compressedMessage header.
+    const auto pos = static_cast<std::streamoff>(this->ofileH.tellp());
+    this->catalog_->insert(key, static_cast<std::uint64_t>(pos) + (compressed ? 2 : 1)*binaryHeaderSize);
+
+    return false;
+}
+
+std::vector<int> EclOutput::compressArray(const std::vector<float>& data)
+{
+    if (data.size() < minCompressedSize)
+        return {};
+
+    return compressedPayload(REAL, data.size(), 1, encodeFloatChunk(data.data(), data.size()));
+}
+
+std::vector<int> EclOutput::compressArray(const std::vector<double>& data)
+{
+    if (data.size() < minCompressedSize)
+        return {};
+
+    return compressedPayload(DOUB, data.size(), 2, encodeDoubleChunk(data.data(), data.size()));
+}
+
+void EclOutput::writeCompressed(const std::string& name, const std::vector<int>& packed)
+{
+    writeBinaryHeader(compressedMessage, 0, MESS, sizeOfInte);
+    writeBinaryHeader(name, packed.size(), INTE, sizeOfInte);
+    writeBinaryArray(packed);
+}
+
+void EclOutput::enqueue(std::function<void()> job)
+{
+    this->async_->push(std::move(job));
+}
+
+void EclOutput::waitForPendingWrites()
+{
+    if (this->async_ != nullptr)
+        this->async_->wait();
+}
+
+void EclOutput::syncToDisk()
+{
+    this->ofileH.flush();
+
+    if (! this->ofileH)
+        OPM_THROW(std::runtime_error, "Failed writing to file '" + this->fileName + "'");
+
+    // Any descriptor referring to the file commits its data.
+    const int fd = ::open(this->fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+
+    const auto status = ::fsync(fd);
+    const auto err = errno;
+    ::close(fd);
+
+    if ((status != 0) && (err != EINVAL))
+        OPM_THROW(std::runtime_error, "Unable to synchronise file '" + this->fileName +
+                  "' to disk: " + std::strerror(err));
+}
 
 template<>
-void EclOutput::write<std::string>(const std::string& name,
-                                   const std::vector<std::string>& data)
+void EclOutput::writeImmediate<std::string>(const std::string& name,
+                                            const std::vector<std::string>& data)
 {
     // array type will be assumed CHAR if maximum string length is 8 or less
     // If maximum string length is > 8, C0nn will be used with element size equal to
@@ -80,6 +582,11 @@ void EclOutput::write<std::string>(const std::string& name,
     }
     else
     {
+        const auto type = (maximum_length > sizeOfChar) ? C0NN : CHAR;
+        const auto size = std::max(maximum_length, sizeOfChar);
+        if ((this->catalog_ != nullptr) && writeReference(name, type, size, data.size(), stringContent(data)))
+            return;
+
         if (maximum_length > sizeOfChar){
             writeBinaryHeader(name, data.size(), C0NN, maximum_length);
             writeBinaryCharArray(data, maximum_length);
@@ -105,6 +612,14 @@ void EclOutput::write(const std::string& name, const std::vector<std::string>& d
             OPM_THROW(std::runtime_error, "specified element size for type C0NN less than maximum string length in output data");
     }
 
+    if (this->async_ != nullptr)
+        this->enqueue([this, name, data, element_size]() { this->writeC0nnImmediate(name, data, element_size); });
+    else
+        this->writeC0nnImmediate(name, data, element_size);
+}
+
+void EclOutput::writeC0nnImmediate(const std::string& name, const std::vector<std::string>& data, int element_size)
+{
     if (isFormatted)
     {
         if (element_size > sizeOfChar){
@@ -117,6 +632,10 @@ void EclOutput::write(const std::string& name, const std::vector<std::string>& d
     }
     else
     {
+        const auto size = std::max(element_size, sizeOfChar);
+        if ((this->catalog_ != nullptr) && writeReference(name, C0NN, size, data.size(), stringContent(data)))
+            return;
+
         if (element_size > sizeOfChar){
             writeBinaryHeader(name, data.size(), C0NN, element_size);
             writeBinaryCharArray(data, element_size);
@@ -128,7 +647,7 @@ void EclOutput::write(const std::string& name, const std::vector<std::string>& d
 }
 
 template <>
-void EclOutput::write<PaddedOutputString<8>>
+void EclOutput::writeImmediate<PaddedOutputString<8>>
     (const std::string&                        name,
      const std::vector<PaddedOutputString<8>>& data)
 {
@@ -137,6 +656,9 @@ void EclOutput::write<PaddedOutputString<8>>
         writeFormattedCharArray(data);
     }
     else {
+        if ((this->catalog_ != nullptr) && writeReference(name, CHAR, sizeOfChar, data.size(), stringContent(data)))
+            return;
+
         writeBinaryHeader(name, data.size(), CHAR, sizeOfChar);
         writeBinaryCharArray(data);
     }
@@ -153,7 +675,12 @@ void EclOutput::message(const std::string& msg)
 
 void EclOutput::flushStream()
 {
-    this->ofileH.flush();
+    if (this->async_ != nullptr) {
+        this->enqueue([this]() { this->syncToDisk(); });
+        this->async_->wait();
+    }
+    else
+        this->ofileH.flush();
 }
 
 void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclArrType arrType, int element_size)
@@ -219,6 +746,41 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclAr
     ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
 }
 
+std::uint64_t EclOutput::reserveBinaryArray(const std::string& arrName, int64_t size, eclArrType arrType)
+{
+    if (this->isFormatted)
+        OPM_THROW(std::invalid_argument, "Cannot reserve array '" + arrName + "' in formatted file");
+
+    if ((arrType != INTE) && (arrType != REAL) && (arrType != DOUB))
+        OPM_THROW(std::invalid_argument, "Cannot reserve array '" + arrName + "' of non-numeric type");
+
+    // Reserved space is written through other file descriptors, so all
+    // queued arrays must be in the file first.
+    this->waitForPendingWrites();
+
+    const auto sizeData = block_size_data_binary(arrType);
+    const int64_t sizeOfElement = std::get<0>(sizeData);
+    const int64_t maxNumberOfElements = std::get<1>(sizeData) / sizeOfElement;
+
+    writeBinaryHeader(arrName, size, arrType, sizeOfElement);
+
+    const auto offset = static_cast<std::uint64_t>(static_cast<std::streamoff>(ofileH.tellp()));
+
+    for (int64_t first = 0; first < size; first += maxNumberOfElements) {
+        const auto num = std::min(size - first, maxNumberOfElements);
+        int dhead = flipEndianInt(static_cast<int>(num * sizeOfElement));
+
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.seekp(num * sizeOfElement, std::ios_base::cur);
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    }
+
+    if (! ofileH)
+        OPM_THROW(std::runtime_error, "Failed reserving array '" + arrName + "' in file '" + this->fileName + "'");
+
+    return offset;
+}
+
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
@@ -249,6 +811,26 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
+    if constexpr (std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>) {
+        // Frame and convert a batch of records at a time with the bulk
+        // endian kernels, then write the batch in one go.
+        const int64_t maxBatchSize = 64 * static_cast<int64_t>(maxNumberOfElements);
+        std::vector<char> buffer;
+
+        for (int64_t first = 0; first < size; first += maxBatchSize) {
+            const auto count = std::min(size - first, maxBatchSize);
+
+            buffer.resize(sizeOnDiskBinary(count, arrType, sizeOfElement));
+
+            const auto nbytes = encodeBinaryRecords(data.data() + first, count, sizeOfElement,
+                                                    maxNumberOfElements, buffer.data());
+
+            ofileH.write(buffer.data(), nbytes);
+        }
+
+        return;
+    }
+
     int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
     rest = size * static_cast<int64_t>(sizeOfElement);
@@ -430,165 +1012,33 @@ void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclAr
 
     switch (arrType) {
     case INTE:
-        ofileH << " 'INTE'" <<  std::endl;
+        ofileH << " 'INTE'" << '\n';
         break;
     case REAL:
-        ofileH << " 'REAL'" <<  std::endl;
+        ofileH << " 'REAL'" << '\n';
         break;
     case DOUB:
-        ofileH << " 'DOUB'" <<  std::endl;
+        ofileH << " 'DOUB'" << '\n';
         break;
     case LOGI:
-        ofileH << " 'LOGI'" <<  std::endl;
+        ofileH << " 'LOGI'" << '\n';
         break;
     case CHAR:
-        ofileH << " 'CHAR'" <<  std::endl;
+        ofileH << " 'CHAR'" << '\n';
         break;
     case C0NN:
-        ofileH << " '" << c0nn_str << "'" <<  std::endl;
+        ofileH << " '" << c0nn_str << "'" << '\n';
         break;
     case MESS:
-        ofileH << " 'MESS'" <<  std::endl;
+        ofileH << " 'MESS'" << '\n';
         break;
     }
 }
 
 
-std::string EclOutput::make_real_string_ecl(float value) const
-{
-    constexpr std::size_t buf_size = 15;
-    char buffer [buf_size];
-    std::snprintf (buffer, sizeof buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return "0.00000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        int exp =  value < 0.0 ? std::stoi(tmpstr.substr(11, 3)) :  std::stoi(tmpstr.substr(10, 3));
-
-        if (value < 0.0) {
-            tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 7) + "E";
-        } else {
-            tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 7) +"E";
-        }
-
-        std::snprintf (buffer, sizeof buffer, "%+03i", exp+1);
-        tmpstr = tmpstr+buffer;
-
-        return tmpstr;
-    }
-}
-
-std::string EclOutput::make_real_string_ix(float value) const
-{
-    constexpr std::size_t buf_size = 15;
-    char buffer [buf_size];
-    std::snprintf (buffer, sizeof buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return " 0.0000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        return tmpstr;
-    }
-}
-
-
-std::string EclOutput::make_doub_string_ecl(double value) const
-{
-    char buffer [21 + 1];
-    std::snprintf (buffer, sizeof buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return "0.00000000000000D+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-        int exp = value < 0.0 ? std::stoi(tmpstr.substr(17, 4)) : std::stoi(tmpstr.substr(16, 4));
-        const bool use_exp_char = (exp >= -100) && (exp < 99);
-
-        if (value < 0.0) {
-            if (use_exp_char) {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13) + "D";
-            } else {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13);
-            }
-        } else {
-            if (use_exp_char) {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13) + "D";
-            } else {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13);
-            }
-        }
-
-        std::snprintf(buffer, sizeof buffer, "%+03i", exp + 1);
-        tmpstr = tmpstr + buffer;
-        return tmpstr;
-    }
-}
-
-std::string EclOutput::make_doub_string_ix(double value) const
-{
-    char buffer [21];
-    std::snprintf (buffer, sizeof buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return " 0.0000000000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        return tmpstr;
-    }
-}
-
-
 template <typename T>
 void EclOutput::writeFormattedArray(const std::vector<T>& data)
 {
-    int size = data.size();
-    int n = 0;
-
     eclArrType arrType = MESS;
     if (typeid(T) == typeid(int)) {
         arrType = INTE;
@@ -603,51 +1053,55 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
 
     auto sizeData = block_size_data_formatted(arrType);
 
-    int maxBlockSize = std::get<0>(sizeData);
-    int nColumns = std::get<1>(sizeData);
-    int columnWidth = std::get<2>(sizeData);
-
-    for (int i = 0; i < size; i++) {
-        n++;
-
-        switch (arrType) {
-        case INTE:
-            ofileH << std::setw(columnWidth) << data[i];
-            break;
-        case REAL:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_real_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_real_string_ecl(data[i]);
-            break;
-        case DOUB:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_doub_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_doub_string_ecl(data[i]);
-            break;
-        case LOGI:
-            if (data[i]) {
-                ofileH << "  T";
-            } else {
-                ofileH << "  F";
+    const int maxBlockSize = std::get<0>(sizeData);
+    const int nColumns = std::get<1>(sizeData);
+    const int columnWidth = std::get<2>(sizeData);
+
+    // Elements are formatted in chunks, concurrently when there is more
+    // than one, and the chunks written in order.  At most maxChunks
+    // chunks are held in memory at a time.
+    constexpr std::size_t chunkSize = 16384;
+    constexpr std::size_t maxChunks = 64;
+
+    const auto size = data.size();
+
+    std::vector<std::string> chunks;
+    std::vector<std::exception_ptr> failure;
+
+    for (std::size_t first = 0; first < size; first += chunkSize * maxChunks) {
+        const auto last = std::min(size, first + chunkSize * maxChunks);
+        const auto numChunks = (last - first + chunkSize - 1) / chunkSize;
+
+        chunks.assign(numChunks, std::string{});
+        failure.assign(numChunks, nullptr);
+
+#pragma omp parallel for schedule(dynamic) if (numChunks > 1)
+        for (std::int64_t c = 0; c < static_cast<std::int64_t>(numChunks); ++c) {
+            try {
+                const auto begin = first + c*chunkSize;
+                const auto end = std::min(last, begin + chunkSize);
+
+                chunks[c].reserve((end - begin) * (columnWidth + 1));
+                formatElements(data, begin, end, this->ix_standard,
+                               maxBlockSize, nColumns, columnWidth, chunks[c]);
+            }
+            catch (...) {
+                failure[c] = std::current_exception();
             }
-            break;
-        default:
-            break;
         }
 
-        if ((n % nColumns) == 0 || (n % maxBlockSize) == 0) {
-            ofileH << std::endl;
+        for (const auto& e : failure) {
+            if (e != nullptr)
+                std::rethrow_exception(e);
         }
 
-        if ((n % maxBlockSize) == 0) {
-            n=0;
-        }
+        for (const auto& chunk : chunks)
+            ofileH.write(chunk.data(), chunk.size());
     }
 
+    const int n = size % maxBlockSize;
     if ((n % nColumns) != 0 && (n % maxBlockSize) != 0) {
-        ofileH << std::endl;
+        ofileH << '\n';
     }
 }
 
@@ -690,16 +1144,18 @@ void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data, in
             ofileH << " '" << str1 << "'";
 
             if ((i+1) % nColumns == 0) {
-                ofileH  << std::endl;
+                ofileH  << '\n';
             }
         }
 
         if ((size % nColumns) != 0) {
-            ofileH  << std::endl;
+            ofileH  << '\n';
         }
 
         rest = (rest > maxBlockSize) ? rest - maxBlockSize : 0;
     }
+
+    ofileH.flush();
 }
 
 
@@ -722,6 +1178,8 @@ void EclOutput::writeFormattedCharArray(const std::vector<PaddedOutputString<8>>
     if ((size % nColumns) != 0) {
         ofileH << '\n';
     }
+
+    ofileH.flush();
 }
 
 }} // namespace Opm::EclIO
@@ -18,10 +18,20 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <functional>
 #include <ios>
+#include <map>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include <opm/io/eclipse/EclIOdata.hpp>
@@ -34,6 +44,35 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
 namespace Opm { namespace EclIO {
 
+// Arrays written to a binary file, identified by name, type, size and a
+// hash of their contents.  Lets repeated arrays, e.g., static well data
+// in consecutive report steps of a unified restart file, be written as
+// references to their first occurrence.  Must outlive the EclOutput
+// objects using it, and persists between them for a sequence of output
+// streams to the same file.
+class ArrayCatalog
+{
+public:
+    using Key = std::tuple<std::string, eclArrType, int, std::int64_t,
+                           std::uint64_t, std::uint64_t>;
+
+    // Forget arrays which are not in file 'filename', or which are
+    // located at or after file offset 'end', e.g., because that part of
+    // the file has been overwritten.
+    void restrict(const std::string& filename, std::uint64_t end);
+
+    // File offset of the data of an earlier array with the same key.
+    std::optional<std::uint64_t> find(const Key& key) const;
+
+    void insert(const Key& key, std::uint64_t offset);
+
+    std::size_t size() const { return this->offsets_.size(); }
+
+private:
+    std::string filename_{};
+    std::map<Key, std::uint64_t> offsets_{};
+};
+
 class EclOutput
 {
 public:
@@ -41,9 +80,77 @@ public:
               const bool                    formatted,
               const std::ios_base::openmode mode = std::ios::out);
 
+    ~EclOutput();
+
+    EclOutput(const EclOutput&) = delete;
+    EclOutput& operator=(const EclOutput&) = delete;
+
     template<typename T>
     void write(const std::string& name,
                const std::vector<T>& data)
+    {
+        if (this->async_ != nullptr)
+            this->enqueue([this, name, data]() { this->writeImmediate(name, data); });
+        else
+            this->writeImmediate(name, data);
+    }
+
+    // In asynchronous mode the array is moved to the output queue rather
+    // than copied.
+    template<typename T>
+    void write(const std::string& name,
+               std::vector<T>&& data)
+    {
+        if (this->async_ != nullptr)
+            this->enqueue([this, name, data = std::move(data)]() { this->writeImmediate(name, data); });
+        else
+            this->writeImmediate(name, data);
+    }
+
+    // when this function is used array type will be assumed C0NN (not CHAR).
+    // Also in cases where element size is 8 or less, element size will be 8.
+
+    void write(const std::string& name, const std::vector<std::string>& data, int element_size);
+
+    void message(const std::string& msg);
+
+    // Write buffered data to file.  In asynchronous mode this is a barrier
+    // which returns once all previously queued arrays have been written
+    // and the file contents have been committed to disk (fsync).
+    void flushStream();
+
+    // Hand header generation, Fortran record framing, endian conversion
+    // and stream output over to a background thread.  write() returns as
+    // soon as the array is queued, blocking only if 'maxPending' arrays
+    // are already waiting.  Errors raised by the background thread are
+    // rethrown from the next call to write(), message() or flushStream().
+    void enableAsync(std::size_t maxPending = 8);
+    bool isAsync() const { return this->async_ != nullptr; }
+
+    // Write subsequent arrays identical to an array in 'catalog' as
+    // references to that array (OPM extension, see referenceMessage) and
+    // add all other arrays to the catalog.  Entries for this file at or
+    // after the end of the file are discarded first.  Ignored for
+    // formatted output.
+    void enableDeduplication(ArrayCatalog& catalog);
+
+    // Write subsequent REAL and DOUB arrays losslessly compressed (OPM
+    // extension, see compressedMessage) if that makes them smaller.
+    // Each array is compressed on its own, so arrays are still read
+    // individually.  Ignored for formatted output.
+    void enableCompression();
+
+    void set_ix() { ix_standard = true; }
+
+    friend class OutputStream::Restart;
+    friend class OutputStream::SummarySpecification;
+
+private:
+    class AsyncQueue;
+
+    template<typename T>
+    void writeImmediate(const std::string& name,
+                        const std::vector<T>& data)
     {
         eclArrType arrType = MESS;
         int element_size = 4;
@@ -65,31 +172,81 @@ public:
             writeFormattedHeader(name, data.size(), arrType, element_size);
             if (arrType != MESS)
                 writeFormattedArray(data);
+
+            // Lines are no longer flushed individually, but each array
+            // is on disk once written.
+            ofileH.flush();
         }
         else
         {
+            std::vector<int> packed;
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+                if (this->compress_)
+                    packed = compressArray(data);
+            }
+
+            if ((arrType != MESS) && writeReference(name, arrType, element_size, data, !packed.empty()))
+                return;
+
+            if (!packed.empty()) {
+                writeCompressed(name, packed);
+                return;
+            }
+
             writeBinaryHeader(name, data.size(), arrType, element_size);
             if (arrType != MESS)
                 writeBinaryArray(data);
         }
     }
 
-    // when this function is used array type will be assumed C0NN (not CHAR).
-    // Also in cases where element size is 8 or less, element size will be 8.
+    template <typename T>
+    bool writeReference(const std::string& name, eclArrType arrType,
+                        int element_size, const std::vector<T>& data,
+                        bool compressed)
+    {
+        if (this->catalog_ == nullptr)
+            return false;
 
-    void write(const std::string& name, const std::vector<std::string>& data, int element_size);
+        if constexpr (std::is_same_v<T, bool>) {
+            const auto content = std::string(data.begin(), data.end());
+            return writeReference(name, arrType, element_size, data.size(), content, compressed);
+        }
+        else {
+            const auto content = std::string_view {
+                reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T)
+            };
 
-    void message(const std::string& msg);
-    void flushStream();
+            return writeReference(name, arrType, element_size, data.size(), content, compressed);
+        }
+    }
 
-    void set_ix() { ix_standard = true; }
+    // Write reference to an identical array in catalog_, if any.
+    // Otherwise record the array whose header is written next, or whose
+    // compressed form follows next if 'compressed'.
+    bool writeReference(const std::string& name, eclArrType arrType, int element_size,
+                        std::int64_t size, std::string_view content, bool compressed = false);
 
-    friend class OutputStream::Restart;
-    friend class OutputStream::SummarySpecification;
+    // Contents of the INTE array following compressedMessage, or an empty
+    // vector if compression does not make the array smaller.
+    static std::vector<int> compressArray(const std::vector<float>& data);
+    static std::vector<int> compressArray(const std::vector<double>& data);
+
+    void writeCompressed(const std::string& name, const std::vector<int>& packed);
+
+    void writeC0nnImmediate(const std::string& name, const std::vector<std::string>& data, int element_size);
+
+    void enqueue(std::function<void()> job);
+
+    // wait for all queued output to complete, no-op in synchronous mode
+    void waitForPendingWrites();
+    void syncToDisk();
 
-private:
     void writeBinaryHeader(const std::string& arrName, int64_t size, eclArrType arrType, int element_size);
 
+    // Write header and record markers of a binary array, skipping over
+    // the space of its values.  Returns file offset of the first record.
+    std::uint64_t reserveBinaryArray(const std::string& arrName, int64_t size, eclArrType arrType);
+
     template <typename T>
     void writeBinaryArray(const std::vector<T>& data);
 
@@ -105,22 +262,24 @@ private:
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
     void writeArrayType(const eclArrType arrType);
-    std::string make_real_string_ecl(float value) const;
-    std::string make_real_string_ix(float value) const;
-    std::string make_doub_string_ecl(double value) const;
-    std::string make_doub_string_ix(double value) const;
 
     bool isFormatted, ix_standard;
+    std::string fileName;
     std::ofstream ofileH;
+    ArrayCatalog* catalog_{nullptr};
+    bool compress_{false};
+
+    // Must be last, the background thread references the members above.
+    std::unique_ptr<AsyncQueue> async_;
 };
 
 
 template<>
-void EclOutput::write<std::string>(const std::string& name,
-                                   const std::vector<std::string>& data);
+void EclOutput::writeImmediate<std::string>(const std::string& name,
+                                            const std::vector<std::string>& data);
 
 template <>
-void EclOutput::write<PaddedOutputString<8>>
+void EclOutput::writeImmediate<PaddedOutputString<8>>
     (const std::string&                        name,
      const std::vector<PaddedOutputString<8>>& data);
 
@@ -18,16 +18,22 @@
 */
 
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <numeric>
 #include <stdexcept>
+#include <system_error>
 #include <string>
 #include <vector>
 
@@ -491,24 +497,75 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64
 }
 
 
+namespace {
+
+// Numeric arrays are read block by block straight into the result and
+// converted in place by the bulk endian kernels.
+template <typename T>
+std::vector<T> readBinaryNumericArray(std::fstream& fileH, const std::int64_t size,
+                                      Opm::EclIO::eclArrType type)
+{
+    const auto maxNumberOfElements = std::get<1>(Opm::EclIO::block_size_data_binary(type)) /
+        static_cast<int>(sizeof(T));
+
+    std::vector<T> arr(size);
+    std::int64_t rest = size;
+    T* dest = arr.data();
+
+    while (rest > 0) {
+        int dhead;
+        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dhead = Opm::EclIO::flipEndianInt(dhead);
+        const int num = dhead / static_cast<int>(sizeof(T));
+
+        if ((num > maxNumberOfElements) || (num < 0) || (num > rest)) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        }
+
+        fileH.read(reinterpret_cast<char*>(dest), num * sizeof(T));
+
+        if constexpr (sizeof(T) == 8)
+            Opm::EclIO::swapEndian64(dest, dest, num);
+        else
+            Opm::EclIO::swapEndian32(dest, dest, num);
+
+        rest -= num;
+        dest += num;
+
+        if ((num < maxNumberOfElements) && (rest != 0)) {
+            std::string message = "Error reading binary data, incorrect number of elements";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        int dtail;
+        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+        dtail = Opm::EclIO::flipEndianInt(dtail);
+
+        if (dhead != dtail) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+        }
+    }
+
+    return arr;
+}
+
+} // Anonymous namespace
+
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
@@ -564,6 +621,214 @@ std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::fstream& fileH, co
 }
 
 
+namespace {
+
+    bool isBlank(const char c)
+    {
+        return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+    }
+
+    [[noreturn]] void invalidNumber(const char* first, const char* last)
+    {
+        std::string message="Could not convert '" + std::string(first, last) + "' to a number";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    int parseFormattedInte(const char* first, const char* last)
+    {
+        if ((first != last) && (*first == '+')) {
+            ++first;
+        }
+
+        int value = 0;
+        const auto [ptr, ec] = std::from_chars(first, last, value);
+        if ((ec != std::errc{}) || (ptr != last)) {
+            invalidNumber(first, last);
+        }
+
+        return value;
+    }
+
+    // Fortran style floating point value.  The exponent may be introduced
+    // by 'D' rather than 'E', or by the sign alone for three-digit
+    // exponents, e.g., "0.12345678901234-100".
+    double parseFormattedDoub(const char* first, const char* last)
+    {
+        std::array<char, 64> buffer;
+        if (last - first > static_cast<std::ptrdiff_t>(buffer.size()) - 2) {
+            invalidNumber(first, last);
+        }
+
+        if (*first == '+') {
+            ++first;
+        }
+
+        std::size_t len = 0;
+        bool exponent = false;
+        for (const char* p = first; p != last; ++p) {
+            auto c = *p;
+            if ((c == 'D') || (c == 'd')) {
+                c = 'E';
+            }
+
+            if ((c == 'E') || (c == 'e')) {
+                exponent = true;
+            }
+            else if (((c == '+') || (c == '-')) && (len > 0) && !exponent) {
+                buffer[len++] = 'E';
+                exponent = true;
+            }
+
+            buffer[len++] = c;
+        }
+
+        buffer[len] = '\0';
+
+        double value = 0.0;
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+        const auto [ptr, ec] = std::from_chars(buffer.data(), buffer.data() + len, value);
+        if (ec == std::errc::result_out_of_range) {
+            // Overflow or underflow.  Let strtod() decide on inf or zero.
+            value = std::strtod(buffer.data(), nullptr);
+        }
+        else if ((ec != std::errc{}) || (ptr != buffer.data() + len)) {
+            invalidNumber(first, last);
+        }
+#else
+        char* end = nullptr;
+        value = std::strtod(buffer.data(), &end);
+        if ((len == 0) || (end != buffer.data() + len)) {
+            invalidNumber(first, last);
+        }
+#endif
+
+        return value;
+    }
+
+    // Invoke store(i, first, last) for the first 'count' blank separated
+    // tokens of [p, end).  Returns the position after the last token.
+    template <typename Store>
+    const char* parseTokens(const char* p, const char* end, const std::int64_t count, Store&& store)
+    {
+        for (std::int64_t i = 0; i < count; ++i) {
+            while ((p != end) && isBlank(*p)) {
+                ++p;
+            }
+
+            if (p == end) {
+                OPM_THROW(std::runtime_error, "Unexpected end of formatted array data");
+            }
+
+            const char* first = p;
+            while ((p != end) && !isBlank(*p)) {
+                ++p;
+            }
+
+            store(i, first, p);
+        }
+
+        return p;
+    }
+
+    std::int64_t countTokens(const char* p, const char* end)
+    {
+        std::int64_t count = 0;
+        bool blank = true;
+
+        for (; p != end; ++p) {
+            const bool b = isBlank(*p);
+            count += blank && !b;
+            blank = b;
+        }
+
+        return count;
+    }
+
+    // Numeric arrays of at least this many values are parsed in parallel.
+    constexpr std::int64_t minValuesPerChunk = std::int64_t{1} << 15;
+    constexpr std::int64_t maxNumChunks = 256;
+
+    // The text is split into chunks at blanks.  The number of tokens in
+    // each chunk, counted in parallel, yields the array index of its
+    // first value, after which the chunks are parsed independently.
+    template <typename T, typename Parse>
+    std::vector<T> readFormattedNumbers(const std::string& file_str,
+                                        const std::int64_t size,
+                                        const std::int64_t fromPos,
+                                        Parse&&            parse)
+    {
+        std::vector<T> arr(size);
+
+        const char* begin = file_str.data() + fromPos;
+        const char* end = file_str.data() + file_str.size();
+
+        auto store = [&arr, &parse](const std::int64_t i, const char* first, const char* last)
+        {
+            arr[i] = parse(first, last);
+        };
+
+        const auto numChunks = std::min(size / minValuesPerChunk, maxNumChunks);
+        if (numChunks < 2) {
+            parseTokens(begin, end, size, store);
+            return arr;
+        }
+
+        std::vector<const char*> bound(numChunks + 1, end);
+        bound[0] = begin;
+        for (std::int64_t chunk = 1; chunk < numChunks; ++chunk) {
+            const char* p = std::max(begin + (end - begin) * chunk / numChunks, bound[chunk - 1]);
+            while ((p != end) && !isBlank(*p)) {
+                ++p;
+            }
+
+            bound[chunk] = p;
+        }
+
+        std::vector<std::int64_t> start(numChunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t chunk = 0; chunk < numChunks; ++chunk) {
+            start[chunk + 1] = countTokens(bound[chunk], bound[chunk + 1]);
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+        if (start.back() < size) {
+            OPM_THROW(std::runtime_error, "Unexpected end of formatted array data");
+        }
+
+        std::vector<std::exception_ptr> failure(numChunks);
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::int64_t chunk = 0; chunk < numChunks; ++chunk) {
+            if (start[chunk] >= size) {
+                // Trailing text after the last value.
+                continue;
+            }
+
+            const auto offset = start[chunk];
+            try {
+                parseTokens(bound[chunk], bound[chunk + 1],
+                            std::min(start[chunk + 1], size) - offset,
+                            [&store, offset](const std::int64_t i, const char* first, const char* last)
+                            { store(offset + i, first, last); });
+            }
+            catch (...) {
+                failure[chunk] = std::current_exception();
+            }
+        }
+
+        for (const auto& error : failure) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        return arr;
+    }
+
+} // Anonymous namespace
+
+
 template<typename T>
 std::vector<T> Opm::EclIO::readFormattedArray(const std::string& file_str, const int size, std::int64_t fromPos,
                                  std::function<T(const std::string&)>& process)
@@ -589,13 +854,7 @@ std::vector<T> Opm::EclIO::readFormattedArray(const std::string& file_str, const
 
 std::vector<int> Opm::EclIO::readFormattedInteArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<int(const std::string&)> f = [](const std::string& val)
-                                               {
-                                                   return std::stoi(val);
-                                               };
-
-    return readFormattedArray(file_str, size, fromPos, f);
+    return readFormattedNumbers<int>(file_str, size, fromPos, &parseFormattedInte);
 }
 
 
@@ -626,16 +885,13 @@ std::vector<std::string> Opm::EclIO::readFormattedCharArray(const std::string& f
 
 std::vector<float> Opm::EclIO::readFormattedRealArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<float(const std::string&)> f = [](const std::string& val)
-                                                 {
-                                                     // tskille: temporary fix, need to be discussed. OPM flow writes numbers
-                                                     // that are outside valid range for float, and function stof will fail
-                                                     double dtmpv = std::stod(val);
-                                                     return dtmpv;
-                                                 };
-
-    return readFormattedArray<float>(file_str, size, fromPos, f);
+    // OPM flow writes numbers that are outside the valid range for float.
+    // Parse as double, like the double precision arrays, and narrow.
+    return readFormattedNumbers<float>(file_str, size, fromPos,
+                                       [](const char* first, const char* last)
+                                       {
+                                           return static_cast<float>(parseFormattedDoub(first, last));
+                                       });
 }
 
 std::vector<std::string> Opm::EclIO::readFormattedRealRawStrings(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
@@ -653,44 +909,27 @@ std::vector<std::string> Opm::EclIO::readFormattedRealRawStrings(const std::stri
 
 std::vector<bool> Opm::EclIO::readFormattedLogiArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
+    std::vector<bool> arr(size);
+
+    const char* first = file_str.data() + fromPos;
+    const char* end = file_str.data() + file_str.size();
 
-    std::function<bool(const std::string&)> f = [](const std::string& val)
-                                                {
-                                                    if (val[0] == 'T') {
-                                                        return true;
-                                                    } else if (val[0] == 'F') {
-                                                        return false;
-                                                    } else {
-                                                        std::string message="Could not convert '" + val + "' to a bool value ";
-                                                        OPM_THROW(std::invalid_argument, message);
-                                                    }
-                                                };
+    parseTokens(first, end, size, [&arr](const std::int64_t i, const char* token, const char* last)
+    {
+        if (*token == 'T') {
+            arr[i] = true;
+        } else if (*token == 'F') {
+            arr[i] = false;
+        } else {
+            std::string message="Could not convert '" + std::string(token, last) + "' to a bool value ";
+            OPM_THROW(std::invalid_argument, message);
+        }
+    });
 
-    return readFormattedArray<bool>(file_str, size, fromPos, f);
+    return arr;
 }
 
 std::vector<double> Opm::EclIO::readFormattedDoubArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<double(const std::string&)> f = [](std::string val)
-                                                  {
-                                                      auto p1 = val.find_first_of("D");
-
-                                                      if (p1 != std::string::npos) {
-                                                          val.replace(p1,1,"E");
-                                                      }
-
-                                                      p1 = val.find_first_of("E");
-
-                                                      if (p1 == std::string::npos) {
-                                                          auto p2 = val.find_first_of("-+", 1);
-
-                                                          if (p2 != std::string::npos)
-                                                              val = val.insert(p2,"E");
-                                                      }
-                                                      return std::stod(val);
-                                                  };
-
-    return readFormattedArray<double>(file_str, size, fromPos, f);
+    return readFormattedNumbers<double>(file_str, size, fromPos, &parseFormattedDoub);
 }
-
@@ -20,9 +20,9 @@
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/TimeService.hpp>
-#include <opm/common/utility/shmatch.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
 
 #include <algorithm>
 #include <chrono>
@@ -57,6 +57,45 @@ Opm::time_point make_date(const std::vector<int>& datetime) {
     return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
 }
 
+// Read elements [first, first + count) of a binary array with 4 byte
+// elements whose first data block starts at data_start.  Elements are
+// returned in on-disk (big-endian) byte order.  Each full block holds
+// MaxBlockSizeReal bytes of data framed by a leading and a trailing
+// record marker.
+void read_array_window(std::fstream& fileH, uint64_t data_start,
+                       std::size_t first, std::size_t count, char* dest)
+{
+    const std::size_t block_elements = Opm::EclIO::MaxBlockSizeReal / Opm::EclIO::sizeOfReal;
+    const uint64_t block_bytes = Opm::EclIO::MaxBlockSizeReal + 2 * Opm::EclIO::sizeOfInte;
+
+    const std::size_t last = first + count;
+
+    std::size_t n = first;
+    while (n < last) {
+        const auto block = n / block_elements;
+        const auto in_block = n % block_elements;
+        const auto num = std::min(last - n, block_elements - in_block);
+
+        const uint64_t pos = data_start + block * block_bytes + Opm::EclIO::sizeOfInte + in_block * Opm::EclIO::sizeOfReal;
+
+        fileH.seekg (pos, fileH.beg);
+        fileH.read(dest + (n - first) * Opm::EclIO::sizeOfReal, num * Opm::EclIO::sizeOfReal);
+
+        n += num;
+    }
+}
+
+std::vector<int> read_inte_window(std::fstream& fileH, uint64_t data_start,
+                                  std::size_t first, std::size_t count)
+{
+    std::vector<int> result(count);
+    read_array_window(fileH, data_start, first, count, reinterpret_cast<char*>(result.data()));
+
+    std::transform(result.begin(), result.end(), result.begin(), Opm::EclIO::flipEndianInt);
+
+    return result;
+}
+
 
 }
 
@@ -111,13 +150,14 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
     ExtSmryHeadType ext_esmry_head;
 
     uint64_t rstep_offset;
+    ChunkLayout layout;
 
-    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, layout);
     int n_attempts = 1;
 
     while ((!res) && (n_attempts < 10)){
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, layout);
         n_attempts ++;
     }
 
@@ -126,21 +166,15 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     m_startdat = std::get<0>(ext_esmry_head);
     m_rstep_offset.push_back(rstep_offset);
-
-    std::map<std::string, int> key_index;
+    m_chunk_layout.push_back(layout);
 
     auto keyword = std::get<2>(ext_esmry_head);
     auto units = std::get<3>(ext_esmry_head);
 
-    for (size_t n = 0; n < keyword.size(); n++){
-        key_index[keyword[n]] = n;
-        m_keyword.push_back(keyword[n]);
-    }
-
-    m_keyword_index.push_back(key_index);
+    m_keyword_index.emplace_back(keyword);
 
-    for (size_t n = 0; n < m_keyword.size(); n++)
-        kwunits[m_keyword[n]] = units[n];
+    for (size_t n = 0; n < keyword.size(); n++)
+        kwunits[keyword[n]] = units[n];
 
     RstEntry rst_entry = std::get<1>(ext_esmry_head);
 
@@ -169,10 +203,11 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
             m_esmry_files.push_back(rstESmryFile);
 
-            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset))
+            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset, layout))
                 OPM_THROW( std::runtime_error, "when opening ESMRY file" + rstESmryFile.string() );
 
             m_rstep_offset.push_back(rstep_offset);
+            m_chunk_layout.push_back(layout);
 
             m_rstep_v.push_back(std::get<4>(ext_esmry_head));
             m_tstep_v.push_back(std::get<5>(ext_esmry_head));
@@ -194,13 +229,7 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
             m_tstep_range.push_back(std::make_tuple(0, ind));
 
-            key_index.clear();
-            keyword = std::get<2>(ext_esmry_head);
-
-            for (size_t n = 0; n < keyword.size(); n++)
-                key_index[keyword[n]] = n;
-
-            m_keyword_index.push_back(key_index);
+            m_keyword_index.emplace_back(std::get<2>(ext_esmry_head));
 
             rst_entry = std::get<1>(ext_esmry_head);
             restart = std::get<0>(rst_entry);
@@ -208,7 +237,7 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
         }
     }
 
-    m_nVect = m_keyword.size();
+    m_nVect = m_keyword_index[0].size();
 
     m_vectorData.resize(m_nVect, {});
     m_vectorLoaded.resize(m_nVect, false);
@@ -252,7 +281,7 @@ std::vector<float> ExtESmry::get_at_rstep(const std::string& name)
 
 std::string& ExtESmry::get_unit(const std::string& name)
 {
-    if ( m_keyword_index[0].find(name) == m_keyword_index[0].end() )
+    if (!m_keyword_index[0].contains(name))
         throw std::invalid_argument("summary key '" + name + "' not found");
 
     return kwunits.at(name);
@@ -267,7 +296,8 @@ bool ExtESmry::all_steps_available()
     return true;
 }
 
-bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset)
+bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head,
+                          uint64_t& rstep_offset, ChunkLayout& layout)
 {
     std::fstream fileH;
 
@@ -404,6 +434,47 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
         return false;
     }
 
+    // Vector arrays of a chunked file are preceded by ZCHUNKS and ZOFFSET
+
+    layout = ChunkLayout{};
+
+    if (fileH.peek() != std::char_traits<char>::eof()) {
+        const auto vector_start = fileH.tellg();
+
+        try {
+            Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+            if (arrName == "ZCHUNKS ") {
+                const auto chunks = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+                if ((chunks.size() < 2) || (chunks[0] != extSmryChunkedVersion) || (chunks[1] < 1))
+                    OPM_THROW(std::invalid_argument, "unsupported chunked layout in esmry file " + inputFileName.string() );
+
+                Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+                if ((arrName != "ZOFFSET ") or (static_cast<std::size_t>(arr_size) != 2 * keywords.size()))
+                    OPM_THROW(std::invalid_argument, "reading ZOFFSET, invalid esmry file " + inputFileName.string() );
+
+                const auto offsets = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+                layout.chunk_size = chunks[1];
+                layout.data_offset = static_cast<uint64_t>(fileH.tellg());
+                layout.vector_offset.reserve(keywords.size());
+
+                for (std::size_t n = 0; n < keywords.size(); n++) {
+                    const auto hi = static_cast<uint64_t>(static_cast<uint32_t>(offsets[2*n]));
+                    const auto lo = static_cast<uint64_t>(static_cast<uint32_t>(offsets[2*n + 1]));
+                    layout.vector_offset.push_back((hi << 32) | lo);
+                }
+            }
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+
+        fileH.seekg(vector_start);
+    }
+
     ext_smry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
 
     fileH.close();
@@ -424,6 +495,135 @@ void ExtESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem
 }
 
 
+uint64_t ExtESmry::vector_header_offset(int ind, int key_ind, int64_t num_tstep) const
+{
+    const auto smry_arr_size = sizeOnDiskBinary(num_tstep, Opm::EclIO::REAL, sizeOfReal);
+
+    uint64_t pos = m_rstep_offset[ind] + smry_arr_size*static_cast<uint64_t>(key_ind);
+
+    // adding size of TSTEP and RSTEP INTE data
+    pos = pos + 2 * sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
+
+    pos = pos + static_cast<uint64_t>(2 * 24);  // adding size of binary headers (TSTEP and RSTEP)
+    pos = pos + static_cast<uint64_t>(key_ind) * 24;  // adding size of binary headers
+
+    return pos;
+}
+
+
+std::vector<float> ExtESmry::read_vector_window(int key_ind, std::size_t first, std::size_t last)
+{
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[0], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        OPM_THROW( std::runtime_error, "when opening ESMRY file " + m_esmry_files[0].string() );
+
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    int64_t num_tstep;
+    int sizeOfElement;
+
+    fileH.seekg (m_rstep_offset[0], fileH.beg);
+    Opm::EclIO::readBinaryHeader(fileH, arrName, num_tstep, arrType, sizeOfElement);
+
+    if (m_chunk_layout[0].chunk_size > 0)
+        return this->read_chunked_window(fileH, 0, key_ind, num_tstep, first, last);
+
+    fileH.seekg (vector_header_offset(0, key_ind, num_tstep), fileH.beg);
+
+    int64_t size;
+    readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+
+    if ((Opm::EclIO::trimr(arrName) != "V" + std::to_string(key_ind)) || (static_cast<int64_t>(last) > size))
+        OPM_THROW( std::runtime_error, "inconsistent vector data in ESMRY file " + m_esmry_files[0].string() );
+
+    const auto data_start = static_cast<uint64_t>(fileH.tellg());
+
+    std::vector<float> result(last - first);
+
+    read_array_window(fileH, data_start, first, last - first, reinterpret_cast<char*>(result.data()));
+
+    if (!fileH)
+        OPM_THROW( std::runtime_error, "when reading vector data from ESMRY file " + m_esmry_files[0].string() );
+
+    std::transform(result.begin(), result.end(), result.begin(), Opm::EclIO::flipEndianFloat);
+
+    return result;
+}
+
+
+std::vector<float> ExtESmry::read_chunked_window(std::fstream& fileH, int ind, int key_ind, int64_t num_tstep,
+                                                 std::size_t first, std::size_t last) const
+{
+    const auto& layout = m_chunk_layout[ind];
+    const auto& fileName = m_esmry_files[ind].string();
+
+    if (first >= last)
+        return {};
+
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    int64_t size;
+    int sizeOfElement;
+
+    fileH.seekg (layout.data_offset + layout.vector_offset[key_ind], fileH.beg);
+    readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+
+    const std::size_t chunk_size = layout.chunk_size;
+    const std::size_t num_chunks = (num_tstep + chunk_size - 1) / chunk_size;
+
+    if ((Opm::EclIO::trimr(arrName) != "Z" + std::to_string(key_ind)) || (arrType != Opm::EclIO::INTE) ||
+        (static_cast<int64_t>(last) > num_tstep) || (static_cast<std::size_t>(size) < num_chunks + 1))
+        OPM_THROW( std::runtime_error, "inconsistent vector data in ESMRY file " + fileName );
+
+    const auto data_start = static_cast<uint64_t>(fileH.tellg());
+
+    // Only the chunks covering [first, last) are read and decoded.
+
+    const std::size_t first_chunk = first / chunk_size;
+    const std::size_t last_chunk = (last + chunk_size - 1) / chunk_size;
+
+    const auto chunk_offsets = read_inte_window(fileH, data_start, first_chunk, last_chunk - first_chunk + 1);
+
+    const auto words_begin = static_cast<std::size_t>(chunk_offsets.front());
+    const auto words_end = static_cast<std::size_t>(chunk_offsets.back());
+
+    if ((words_end < words_begin) || (num_chunks + 1 + words_end > static_cast<std::size_t>(size)))
+        OPM_THROW( std::runtime_error, "inconsistent chunk offsets in ESMRY file " + fileName );
+
+    const auto words = read_inte_window(fileH, data_start, num_chunks + 1 + words_begin, words_end - words_begin);
+
+    if (!fileH)
+        OPM_THROW( std::runtime_error, "when reading vector data from ESMRY file " + fileName );
+
+    std::vector<float> result(last - first);
+    std::vector<float> chunk(chunk_size);
+
+    for (std::size_t c = first_chunk; c < last_chunk; c++) {
+        const auto chunk_first = c * chunk_size;
+        const auto count = std::min<std::size_t>(chunk_size, num_tstep - chunk_first);
+
+        const auto w0 = static_cast<std::size_t>(chunk_offsets[c - first_chunk]) - words_begin;
+        const auto w1 = static_cast<std::size_t>(chunk_offsets[c - first_chunk + 1]) - words_begin;
+
+        if ((w1 < w0) || (w1 > words.size()))
+            OPM_THROW( std::runtime_error, "inconsistent chunk offsets in ESMRY file " + fileName );
+
+        decodeFloatChunk(words.data() + w0, w1 - w0, count, chunk.data());
+
+        const auto from = std::max(first, chunk_first);
+        const auto to = std::min(last, chunk_first + count);
+
+        std::copy(chunk.begin() + (from - chunk_first), chunk.begin() + (to - chunk_first),
+                  result.begin() + (from - first));
+    }
+
+    return result;
+}
+
+
 bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind )
 {
@@ -453,8 +653,6 @@ bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std:
         return false;
     }
 
-    auto smry_arr_size = sizeOnDiskBinary(num_tstep, Opm::EclIO::REAL, sizeOfReal);
-
     std::vector<std::vector<float>> smry_data;
     smry_data.resize(loadKeyIndex.size(), {});
 
@@ -462,23 +660,28 @@ bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std:
 
         const auto& key = stringVect[loadKeyIndex[n]];
 
-        if ( m_keyword_index[ind].find(key) == m_keyword_index[ind].end() ) {
+        const auto key_pos = m_keyword_index[ind].find(key);
+
+        if (key_pos == SummaryKeyIndex::npos) {
 
             smry_data[n].resize(to_ind + 1, 0.0 );
 
         } else {
 
-            int key_ind = m_keyword_index[ind].at(key);
+            int key_ind = static_cast<int>(key_pos);
 
-            uint64_t pos = m_rstep_offset[ind] + smry_arr_size*static_cast<uint64_t>(key_ind);
+            if (m_chunk_layout[ind].chunk_size > 0) {
+                try {
+                    smry_data[n] = read_chunked_window(fileH, ind, key_ind, num_tstep, 0, num_tstep);
+                } catch (const std::runtime_error& error)
+                {
+                    return false;
+                }
 
-            // adding size of TSTEP and RSTEP INTE data
-            pos = pos + 2 * sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
-
-            pos = pos + static_cast<uint64_t>(2 * 24);  // adding size of binary headers (TSTEP and RSTEP)
-            pos = pos + static_cast<uint64_t>(key_ind * 24);  // adding size of binary headers
+                continue;
+            }
 
-            fileH.seekg (pos, fileH.beg);
+            fileH.seekg (vector_header_offset(ind, key_ind, num_tstep), fileH.beg);
 
             int64_t size;
 
@@ -526,11 +729,16 @@ void ExtESmry::loadData(const std::vector<std::string>& stringVect)
     loadKeyIndex.reserve(num_keys);
 
     int keyCounter = 0;
+    std::vector<bool> queued(m_nVect, false);
 
     for (const auto& key: stringVect){
-        auto key_ind = m_keyword_index[0].at(key);
-        if ((!m_vectorLoaded[key_ind]) && (std::find(keyIndexVect.begin(), keyIndexVect.end(), key_ind) == keyIndexVect.end() )){
-            keyIndexVect.push_back(key_ind);
+        const auto key_ind = m_keyword_index[0].find(key);
+        if (key_ind == SummaryKeyIndex::npos)
+            throw std::out_of_range("summary key '" + key + "' not found");
+
+        if ((!m_vectorLoaded[key_ind]) && (!queued[key_ind])){
+            queued[key_ind] = true;
+            keyIndexVect.push_back(static_cast<int>(key_ind));
             loadKeyIndex.push_back(keyCounter);
         }
         ++keyCounter;
@@ -569,15 +777,73 @@ void ExtESmry::loadData(const std::vector<std::string>& stringVect)
 
 void ExtESmry::loadData()
 {
-    this->loadData(m_keyword);
+    this->loadData(this->keywordList());
+}
+
+bool ExtESmry::refresh()
+{
+    auto start = std::chrono::system_clock::now();
+
+    // The ESMRY file is replaced atomically on every write, hence the
+    // header is either the old or the new one, never a partial update.
+
+    ExtSmryHeadType ext_esmry_head;
+    uint64_t rstep_offset;
+    ChunkLayout layout;
+
+    if (!open_esmry(m_esmry_files[0], ext_esmry_head, rstep_offset, layout))
+        return false;
+
+    if (std::get<2>(ext_esmry_head) != this->keywordList())
+        OPM_THROW( std::runtime_error, "list of vectors changed in ESMRY file " + m_esmry_files[0].string() );
+
+    const auto& rstep = std::get<4>(ext_esmry_head);
+    const auto& tstep = std::get<5>(ext_esmry_head);
+
+    const std::size_t from = m_nTstep_v[0];
+    const std::size_t to = tstep.size();
+
+    if (to <= from)
+        return false;
+
+    m_rstep_offset[0] = rstep_offset;
+    m_chunk_layout[0] = std::move(layout);
+    m_rstep_v[0] = rstep;
+    m_tstep_v[0] = tstep;
+    m_nTstep_v[0] = to;
+    m_tstep_range[0] = std::make_tuple(0, to - 1);
+
+    // Time steps of the current run are last in the combined vectors.
+
+    for (std::size_t n = from; n < to; n++) {
+        if (rstep[n] == 1)
+            m_seqIndex.push_back(m_rstep.size());
+
+        m_rstep.push_back(rstep[n]);
+        m_tstep.push_back(tstep[n]);
+    }
+
+    m_nTstep = m_rstep.size();
+
+    for (std::size_t ind = 0; ind < m_nVect; ind++) {
+        if (m_vectorLoaded[ind]) {
+            const auto values = this->read_vector_window(ind, from, to);
+            m_vectorData[ind].insert(m_vectorData[ind].end(), values.begin(), values.end());
+        }
+    }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return true;
 }
 
 const std::vector<float>& ExtESmry::get(const std::string& name)
 {
-    if ( m_keyword_index[0].find(name) == m_keyword_index[0].end() )
-        throw std::invalid_argument("summary key '" + name + "' not found");
+    const auto index = m_keyword_index[0].find(name);
 
-    int index = m_keyword_index[0].at(name);
+    if (index == SummaryKeyIndex::npos)
+        throw std::invalid_argument("summary key '" + name + "' not found");
 
     if (!m_vectorLoaded[index]){
         loadData({name});
@@ -586,6 +852,48 @@ const std::vector<float>& ExtESmry::get(const std::string& name)
     return m_vectorData[index];
 }
 
+std::tuple<std::size_t, std::size_t> ExtESmry::timestep_window(time_point from, time_point to)
+{
+    const auto d = this->dates();
+
+    const auto first = std::lower_bound(d.begin(), d.end(), from);
+    const auto last = std::upper_bound(first, d.end(), to);
+
+    return std::make_tuple(static_cast<std::size_t>(std::distance(d.begin(), first)),
+                           static_cast<std::size_t>(std::distance(d.begin(), last)));
+}
+
+std::vector<float> ExtESmry::get(const std::string& name, time_point from, time_point to)
+{
+    const auto pos = m_keyword_index[0].find(name);
+
+    if (pos == SummaryKeyIndex::npos)
+        throw std::invalid_argument("summary key '" + name + "' not found");
+
+    const auto [first, last] = this->timestep_window(from, to);
+
+    if (first >= last)
+        return {};
+
+    const int index = static_cast<int>(pos);
+
+    // Vectors spanning restart chains are assembled from several files,
+    // load those in full.
+    if (m_vectorLoaded[index] || (m_esmry_files.size() > 1)) {
+        const auto& full = this->get(name);
+        return { full.begin() + first, full.begin() + last };
+    }
+
+    auto start = std::chrono::system_clock::now();
+
+    auto result = this->read_vector_window(index, first, last);
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return result;
+}
+
 std::vector<Opm::time_point> ExtESmry::dates()
 {
     double time_unit = 24 * 3600;
@@ -604,19 +912,22 @@ std::vector<Opm::time_point> ExtESmry::dates()
 
 std::vector<std::string> ExtESmry::keywordList(const std::string& pattern) const
 {
-    std::vector<std::string> list;
-    std::copy_if(m_keyword.begin(), m_keyword.end(), std::back_inserter(list),
-                 [&pattern](const auto& key)
-                 {
-                     return shmatch(pattern, key);
-                 });
-
-    return list;
+    return m_keyword_index[0].keysAt(m_keyword_index[0].match(pattern));
+}
+
+std::vector<std::string> ExtESmry::keywordsWithName(const std::string& keyword) const
+{
+    return m_keyword_index[0].keysAt(m_keyword_index[0].withKeyword(keyword));
+}
+
+std::vector<std::string> ExtESmry::keywordsForEntity(const std::string& entity) const
+{
+    return m_keyword_index[0].keysAt(m_keyword_index[0].withEntity(entity));
 }
 
 bool ExtESmry::hasKey(const std::string &key) const
 {
-    return std::find(m_keyword.begin(), m_keyword.end(), key) != m_keyword.end();
+    return m_keyword_index[0].contains(key);
 }
 
 std::tuple<double, double> ExtESmry::get_io_elapsed() const
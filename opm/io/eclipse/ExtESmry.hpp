@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <filesystem>
+#include <iosfwd>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -28,6 +29,7 @@
 #include <stdint.h>
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/SummaryKeyIndex.hpp>
 
 namespace Opm { namespace EclIO {
 
@@ -43,16 +45,31 @@ class ExtESmry
 {
 public:
 
-    // input is esmry, only binary supported.
+    // input is esmry, only binary supported.  Both the plain layout and
+    // the chunked, compressed layout (see ExtSmryCodec.hpp) are read.
     explicit ExtESmry(const std::string& filename, bool loadBaseRunData=false);
 
     const std::vector<float>& get(const std::string& name);
     std::vector<float> get_at_rstep(const std::string& name);
+
+    // values of vector 'name' at time steps with dates in the closed
+    // interval [from, to].  If the vector is not already loaded, only the
+    // blocks covering the requested time steps are read from disk.
+    std::vector<float> get(const std::string& name, time_point from, time_point to);
+
+    // half open range [first, last) of time step indices with dates in
+    // the closed interval [from, to]
+    std::tuple<std::size_t, std::size_t> timestep_window(time_point from, time_point to);
     std::string& get_unit(const std::string& name);
 
     void loadData();
     void loadData(const std::vector<std::string>& stringVect);
 
+    // Pick up time steps appended to the ESMRY file since it was opened
+    // or last refreshed.  Already loaded vectors are extended with the
+    // new values only.  Returns true if new time steps were found.
+    bool refresh();
+
     time_point startdate() const { return m_startdat; }
     const std::vector<int>& start_v() const { return m_start_vect; }
 
@@ -61,9 +78,14 @@ public:
     size_t numberOfTimeSteps() const { return m_nTstep; }
     size_t numberOfVectors() const { return m_nVect; }
 
-    const std::vector<std::string>& keywordList() const { return m_keyword;}
+    const std::vector<std::string>& keywordList() const { return m_keyword_index[0].keys(); }
     std::vector<std::string> keywordList(const std::string& pattern) const;
 
+    // Keys of all vectors of one keyword, e.g. all WOPR vectors, or of one
+    // well, group or other entity named by the last component of the key.
+    std::vector<std::string> keywordsWithName(const std::string& keyword) const;
+    std::vector<std::string> keywordsForEntity(const std::string& entity) const;
+
     std::vector<time_point> dates();
 
     bool all_steps_available();
@@ -75,9 +97,9 @@ private:
     std::vector<std::filesystem::path> m_esmry_files;
 
     bool m_loadBaseRun;
-    std::vector<std::map<std::string, int>> m_keyword_index;
+    // Keys of each file in the restart chain, this run first
+    std::vector<SummaryKeyIndex> m_keyword_index;
     std::vector<std::tuple<int,int>> m_tstep_range;
-    std::vector<std::string> m_keyword;
     std::vector<int> m_rstep;
     std::vector<int> m_tstep;
     std::vector<std::vector<int>> m_rstep_v;
@@ -96,15 +118,32 @@ private:
     time_point m_startdat;
     std::vector<int> m_start_vect;
 
+    // Vector data layout of a chunked (compressed) ESMRY file, chunk_size
+    // is zero for plain files with V<n> arrays.
+    struct ChunkLayout
+    {
+        int chunk_size = 0;
+        uint64_t data_offset = 0;
+        std::vector<uint64_t> vector_offset{};
+    };
+
+    std::vector<ChunkLayout> m_chunk_layout;
+
     double m_io_opening;
     double m_io_loading;
 
-    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset);
+    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head,
+                    uint64_t& rstep_offset, ChunkLayout& layout);
 
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
 
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
+
+    uint64_t vector_header_offset(int ind, int key_ind, int64_t num_tstep) const;
+    std::vector<float> read_vector_window(int key_ind, std::size_t first, std::size_t last);
+    std::vector<float> read_chunked_window(std::fstream& fileH, int ind, int key_ind, int64_t num_tstep,
+                                           std::size_t first, std::size_t last) const;
 };
 
 }} // namespace Opm::EclIO
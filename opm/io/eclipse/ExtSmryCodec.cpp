@@ -0,0 +1,408 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
+
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+namespace {
+
+// Code words are filled from the most significant bit.
+
+class BitWriter
+{
+public:
+    void put(const std::uint32_t value, const int nbits)
+    {
+        this->acc_ = (this->acc_ << nbits) | (static_cast<std::uint64_t>(value) & mask(nbits));
+        this->nacc_ += nbits;
+
+        if (this->nacc_ >= 32) {
+            this->nacc_ -= 32;
+            this->words_.push_back(static_cast<int>(static_cast<std::uint32_t>(this->acc_ >> this->nacc_)));
+        }
+    }
+
+    std::vector<int> finish()
+    {
+        if (this->nacc_ > 0) {
+            this->words_.push_back(static_cast<int>(static_cast<std::uint32_t>(this->acc_ << (32 - this->nacc_))));
+            this->nacc_ = 0;
+        }
+
+        return std::move(this->words_);
+    }
+
+    void put64(const std::uint64_t value, const int nbits)
+    {
+        if (nbits > 32) {
+            this->put(static_cast<std::uint32_t>(value >> 32), nbits - 32);
+            this->put(static_cast<std::uint32_t>(value), 32);
+        }
+        else {
+            this->put(static_cast<std::uint32_t>(value), nbits);
+        }
+    }
+
+private:
+    std::vector<int> words_{};
+    std::uint64_t acc_{0};
+    int nacc_{0};
+
+    static std::uint64_t mask(const int nbits)
+    {
+        return (std::uint64_t{1} << nbits) - 1;
+    }
+};
+
+class BitReader
+{
+public:
+    BitReader(const int* words, const std::size_t numWords)
+        : words_(words), numWords_(numWords)
+    {}
+
+    std::uint32_t get(const int nbits)
+    {
+        while (this->nacc_ < nbits) {
+            if (this->next_ == this->numWords_) {
+                throw std::runtime_error {
+                    "Compressed array data ends prematurely"
+                };
+            }
+
+            this->acc_ = (this->acc_ << 32) | static_cast<std::uint32_t>(this->words_[this->next_++]);
+            this->nacc_ += 32;
+        }
+
+        this->nacc_ -= nbits;
+
+        return static_cast<std::uint32_t>((this->acc_ >> this->nacc_) & ((std::uint64_t{1} << nbits) - 1));
+    }
+
+    std::uint64_t get64(const int nbits)
+    {
+        if (nbits > 32) {
+            const std::uint64_t high = this->get(nbits - 32);
+            return (high << 32) | this->get(32);
+        }
+
+        return this->get(nbits);
+    }
+
+private:
+    const int* words_;
+    std::size_t numWords_;
+    std::size_t next_{0};
+    std::uint64_t acc_{0};
+    int nacc_{0};
+};
+
+std::uint32_t floatBits(const float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+float bitsFloat(const std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+std::uint64_t doubleBits(const double value)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+double bitsDouble(const std::uint64_t bits)
+{
+    double value;
+    std::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+std::uint64_t arraySizeOnDisk(const std::size_t num)
+{
+    return 24 + Opm::EclIO::sizeOnDiskBinary(num, Opm::EclIO::INTE, Opm::EclIO::sizeOfInte);
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+// The first value is stored verbatim.  Each subsequent value is XORed
+// with its predecessor.  Identical values are coded as a single '0' bit.
+// Otherwise, the meaningful bits of the XOR are coded as '10' followed
+// by the bits inside the previous window of meaningful bits if they fit
+// and the window is not much wider than needed, or as '11' followed by
+// 5 bits leading zero count, 5 bits meaningful bit count minus one and
+// the meaningful bits.  Slowly varying summary
+// vectors share sign and exponent between consecutive time steps and
+// typically compress to a fraction of their original size.
+
+std::vector<int> encodeFloatChunk(const float* values, const std::size_t num)
+{
+    BitWriter out;
+
+    if (num == 0)
+        return out.finish();
+
+    auto prev = floatBits(values[0]);
+    out.put(prev, 32);
+
+    int prevLead = -1;
+    int prevTrail = 0;
+
+    for (std::size_t i = 1; i < num; i++) {
+        const auto curr = floatBits(values[i]);
+        const auto diff = curr ^ prev;
+
+        if (diff == 0) {
+            out.put(0, 1);
+        }
+        else {
+            const int lead = __builtin_clz(diff);
+            const int trail = __builtin_ctz(diff);
+            const int len = 32 - lead - trail;
+
+            // Reuse the previous window unless a new, narrower window
+            // is cheaper including the 10 bits needed to describe it.
+            const bool reuse = (prevLead >= 0) && (lead >= prevLead) && (trail >= prevTrail)
+                && (32 - prevLead - prevTrail <= len + 10);
+
+            if (reuse) {
+                out.put(0b10, 2);
+                out.put(diff >> prevTrail, 32 - prevLead - prevTrail);
+            }
+            else {
+                out.put(0b11, 2);
+                out.put(static_cast<std::uint32_t>(lead), 5);
+                out.put(static_cast<std::uint32_t>(len - 1), 5);
+                out.put(diff >> trail, len);
+
+                prevLead = lead;
+                prevTrail = trail;
+            }
+        }
+
+        prev = curr;
+    }
+
+    return out.finish();
+}
+
+void decodeFloatChunk(const int* words, const std::size_t numWords,
+                      const std::size_t num, float* values)
+{
+    if (num == 0)
+        return;
+
+    BitReader in(words, numWords);
+
+    auto prev = in.get(32);
+    values[0] = bitsFloat(prev);
+
+    int prevLead = -1;
+    int prevTrail = 0;
+
+    for (std::size_t i = 1; i < num; i++) {
+        if (in.get(1) != 0) {
+            if (in.get(1) != 0) {
+                prevLead = static_cast<int>(in.get(5));
+                const int len = static_cast<int>(in.get(5)) + 1;
+                prevTrail = 32 - prevLead - len;
+
+                if (prevTrail < 0)
+                    throw std::runtime_error("Invalid code word in compressed ESMRY vector data");
+            }
+            else if (prevLead < 0) {
+                throw std::runtime_error("Invalid code word in compressed ESMRY vector data");
+            }
+
+            prev ^= in.get(32 - prevLead - prevTrail) << prevTrail;
+        }
+
+        values[i] = bitsFloat(prev);
+    }
+}
+
+std::vector<int> encodeDoubleChunk(const double* values, const std::size_t num)
+{
+    BitWriter out;
+
+    if (num == 0)
+        return out.finish();
+
+    auto prev = doubleBits(values[0]);
+    out.put64(prev, 64);
+
+    int prevLead = -1;
+    int prevTrail = 0;
+
+    for (std::size_t i = 1; i < num; i++) {
+        const auto curr = doubleBits(values[i]);
+        const auto diff = curr ^ prev;
+
+        if (diff == 0) {
+            out.put(0, 1);
+        }
+        else {
+            const int lead = __builtin_clzll(diff);
+            const int trail = __builtin_ctzll(diff);
+            const int len = 64 - lead - trail;
+
+            const bool reuse = (prevLead >= 0) && (lead >= prevLead) && (trail >= prevTrail)
+                && (64 - prevLead - prevTrail <= len + 12);
+
+            if (reuse) {
+                out.put(0b10, 2);
+                out.put64(diff >> prevTrail, 64 - prevLead - prevTrail);
+            }
+            else {
+                out.put(0b11, 2);
+                out.put(static_cast<std::uint32_t>(lead), 6);
+                out.put(static_cast<std::uint32_t>(len - 1), 6);
+                out.put64(diff >> trail, len);
+
+                prevLead = lead;
+                prevTrail = trail;
+            }
+        }
+
+        prev = curr;
+    }
+
+    return out.finish();
+}
+
+void decodeDoubleChunk(const int* words, const std::size_t numWords,
+                       const std::size_t num, double* values)
+{
+    if (num == 0)
+        return;
+
+    BitReader in(words, numWords);
+
+    auto prev = in.get64(64);
+    values[0] = bitsDouble(prev);
+
+    int prevLead = -1;
+    int prevTrail = 0;
+
+    for (std::size_t i = 1; i < num; i++) {
+        if (in.get(1) != 0) {
+            if (in.get(1) != 0) {
+                prevLead = static_cast<int>(in.get(6));
+                const int len = static_cast<int>(in.get(6)) + 1;
+                prevTrail = 64 - prevLead - len;
+
+                if (prevTrail < 0)
+                    throw std::runtime_error("Invalid code word in compressed array data");
+            }
+            else if (prevLead < 0) {
+                throw std::runtime_error("Invalid code word in compressed array data");
+            }
+
+            prev ^= in.get64(64 - prevLead - prevTrail) << prevTrail;
+        }
+
+        values[i] = bitsDouble(prev);
+    }
+}
+
+std::vector<int> encodeChunkedVector(const std::vector<float>& values, const int chunkSize)
+{
+    if (chunkSize < 1)
+        throw std::invalid_argument("chunk size of compressed ESMRY vectors must be positive");
+
+    const std::size_t numTstep = values.size();
+    const std::size_t numChunks = (numTstep + chunkSize - 1) / chunkSize;
+
+    std::vector<int> arr(numChunks + 1, 0);
+
+    for (std::size_t c = 0; c < numChunks; c++) {
+        const auto first = c * chunkSize;
+        const auto count = std::min<std::size_t>(chunkSize, numTstep - first);
+
+        const auto words = encodeFloatChunk(values.data() + first, count);
+
+        arr.insert(arr.end(), words.begin(), words.end());
+        arr[c + 1] = static_cast<int>(arr.size() - (numChunks + 1));
+    }
+
+    return arr;
+}
+
+void writeChunkedArrays(EclOutput& outFile,
+                        const std::vector<std::vector<int>>& arrays,
+                        const int chunkSize)
+{
+    if (chunkSize < 1)
+        throw std::invalid_argument("chunk size of compressed ESMRY vectors must be positive");
+
+    std::vector<int> offsets;
+    offsets.reserve(2 * arrays.size());
+
+    std::uint64_t pos = 0;
+    for (const auto& arr : arrays) {
+        offsets.push_back(static_cast<int>(pos >> 32));
+        offsets.push_back(static_cast<int>(pos & 0xFFFFFFFF));
+        pos += arraySizeOnDisk(arr.size());
+    }
+
+    outFile.write<int>("ZCHUNKS", {extSmryChunkedVersion, chunkSize});
+    outFile.write<int>("ZOFFSET", offsets);
+
+    for (std::size_t n = 0; n < arrays.size(); n++)
+        outFile.write<int>(fmt::format("Z{}", n), arrays[n]);
+}
+
+void writeChunkedVectors(EclOutput& outFile,
+                         const std::vector<std::vector<float>>& vectors,
+                         const int chunkSize)
+{
+    const std::size_t numTstep = vectors.empty() ? 0 : vectors.front().size();
+
+    std::vector<std::vector<int>> arrays;
+    arrays.reserve(vectors.size());
+
+    for (const auto& vect : vectors) {
+        if (vect.size() != numTstep)
+            throw std::invalid_argument("compressed ESMRY vectors must have equal size");
+
+        arrays.push_back(encodeChunkedVector(vect, chunkSize));
+    }
+
+    writeChunkedArrays(outFile, arrays, chunkSize);
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,93 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ExtSmryCodec_HPP
+#define OPM_IO_ExtSmryCodec_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class EclOutput;
+
+/// Chunked, compressed vector layout of ESMRY files.
+///
+/// In the plain layout every summary vector is stored as a REAL array
+/// V<n> following the TSTEP array.  In the chunked layout, TSTEP is
+/// instead followed by
+///
+///   ZCHUNKS  INTE [version, chunk size]
+///   ZOFFSET  INTE [hi, lo] pairs, one per vector, holding the byte
+///                 offset of the vector's array header relative to the
+///                 end of ZOFFSET.
+///   Z<n>     INTE [chunk offsets (number of chunks + 1), code words]
+///
+/// Time steps are split into chunks of fixed size.  Each chunk of a
+/// vector is compressed independently by XOR coding consecutive values
+/// (lossless), and the chunk offsets give the start of each chunk's code
+/// words relative to the first code word.  A reader can therefore fetch
+/// any range of time steps of a single vector without reading any other
+/// vector or any chunk outside that range.
+
+constexpr int extSmryChunkedVersion = 1;
+
+/// Default number of time steps in each chunk.
+constexpr int extSmryDefaultChunkSize = 1024;
+
+/// Compress \p num consecutive values into a sequence of 32 bit code
+/// words.
+std::vector<int> encodeFloatChunk(const float* values, std::size_t num);
+
+/// Decompress \p num values from code words created by
+/// encodeFloatChunk().  Throws std::runtime_error if \p numWords code
+/// words do not hold \p num values.
+void decodeFloatChunk(const int* words, std::size_t numWords,
+                      std::size_t num, float* values);
+
+/// Same coding as encodeFloatChunk() for 64 bit values, with 6 bit
+/// leading zero and meaningful bit counts.  Also used for compressed DOUB
+/// arrays of binary files, see compressedMessage.
+std::vector<int> encodeDoubleChunk(const double* values, std::size_t num);
+
+/// Decompress \p num values from code words created by
+/// encodeDoubleChunk().  Throws std::runtime_error if \p numWords code
+/// words do not hold \p num values.
+void decodeDoubleChunk(const int* words, std::size_t numWords,
+                       std::size_t num, double* values);
+
+/// Write summary vectors in the chunked layout (ZCHUNKS, ZOFFSET and
+/// Z<n> arrays) to a binary output file.  All vectors must have the
+/// same number of elements.
+void writeChunkedVectors(EclOutput& outFile,
+                         const std::vector<std::vector<float>>& vectors,
+                         int chunkSize);
+
+/// Contents of the Z<n> array of a single summary vector.
+std::vector<int> encodeChunkedVector(const std::vector<float>& values, int chunkSize);
+
+/// Write Z<n> arrays created by encodeChunkedVector(), preceded by
+/// ZCHUNKS and ZOFFSET, to a binary output file.  All arrays must be
+/// encoded from vectors of the same number of elements.
+void writeChunkedArrays(EclOutput& outFile,
+                        const std::vector<std::vector<int>>& arrays,
+                        int chunkSize);
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ExtSmryCodec_HPP
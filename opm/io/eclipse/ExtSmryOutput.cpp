@@ -19,6 +19,7 @@
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ExtSmryOutput.hpp>
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
@@ -34,9 +35,13 @@ namespace Opm { namespace EclIO {
 
 
 ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const std::vector<std::string>& valueUnits,
-                 const EclipseState& es, const time_t start_time)
+                 const EclipseState& es, const time_t start_time, const int chunk_size)
 {
+    if (chunk_size < 0)
+        throw std::invalid_argument("chunk size of ESMRY output can not be negative");
+
     m_nVect = valueKeys.size();
+    m_chunk_size = chunk_size;
     m_nTimeSteps = 0;
     m_last_write = std::chrono::system_clock::now();
 
@@ -121,9 +126,13 @@ void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step, bo
             outFile.write<int>("RSTEP", m_rstep);
             outFile.write<int>("TSTEP", m_tstep);
 
-            for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++ ) {
-                std::string vect_name="V" + std::to_string(n);
-                outFile.write<float>(vect_name, m_smrydata[n]);
+            if (m_chunk_size > 0) {
+                writeChunkedVectors(outFile, m_smrydata, m_chunk_size);
+            } else {
+                for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++ ) {
+                    std::string vect_name="V" + std::to_string(n);
+                    outFile.write<float>(vect_name, m_smrydata[n]);
+                }
             }
         }
 
@@ -34,10 +34,13 @@ namespace EclIO {
 class ExtSmryOutput
 {
 public:
+    // chunk_size > 0 selects the chunked, compressed layout with
+    // chunk_size time steps per chunk (see ExtSmryCodec.hpp).
     ExtSmryOutput(const std::vector<std::string>& valueKeys,
                   const std::vector<std::string>& valueUnits,
                   const EclipseState& es,
-                  const time_t start_time);
+                  const time_t start_time,
+                  const int chunk_size = 0);
 
     void write(const std::vector<float>& ts_data,
                int report_step,
@@ -51,6 +54,7 @@ private:
     int m_nTimeSteps;
     int m_nVect;
     bool m_fmt;
+    int m_chunk_size;
 
     std::vector<int> m_start_date_vect;
     std::string m_restart_rootn;
@@ -0,0 +1,84 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+namespace Opm { namespace EclIO {
+
+MappedFile::MappedFile(const std::string& filename)
+    : filename_(filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error {
+            fmt::format("Can not open file '{}' for memory mapping: {}",
+                        filename, std::strerror(errno))
+        };
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        const auto err = errno;
+        ::close(fd);
+
+        throw std::runtime_error {
+            fmt::format("Unable to determine size of file '{}': {}",
+                        filename, std::strerror(err))
+        };
+    }
+
+    this->size_ = static_cast<std::size_t>(st.st_size);
+
+    if (this->size_ > 0) {
+        void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            const auto err = errno;
+            ::close(fd);
+
+            throw std::runtime_error {
+                fmt::format("Unable to memory map file '{}': {}",
+                            filename, std::strerror(err))
+            };
+        }
+
+        this->data_ = static_cast<const char*>(addr);
+    }
+
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->data_ != nullptr) {
+        ::munmap(const_cast<char*>(this->data_), this->size_);
+    }
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,61 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_MAPPEDFILE_HPP
+#define OPM_IO_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace Opm { namespace EclIO {
+
+/// Read-only memory mapping of an entire file.
+///
+/// The mapping is established on construction and released on
+/// destruction.  Objects are neither copyable nor movable since views
+/// into the mapped region hold raw pointers into it.  Share ownership
+/// through std::shared_ptr<> if the mapping must outlive its creator.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /// Start of mapped region.  Null if the file is empty.
+    const char* data() const { return this->data_; }
+
+    /// Size of mapped region in bytes.
+    std::size_t size() const { return this->size_; }
+
+    const std::string& filename() const { return this->filename_; }
+
+private:
+    std::string filename_{};
+    const char* data_{nullptr};
+    std::size_t size_{0};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_MAPPEDFILE_HPP
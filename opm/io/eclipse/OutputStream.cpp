@@ -21,11 +21,15 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
+#include <cstring>
 #include <ctime>
 #include <exception>
 #include <filesystem>
@@ -36,9 +40,13 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <unistd.h>
+
 namespace {
     namespace FileExtension
     {
@@ -288,10 +296,34 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Restart::
-Restart(const ResultSet& rset,
-        const int        seqnum,
-        const Formatted& fmt,
-        const Unified&   unif)
+Restart(const ResultSet&    rset,
+        const int           seqnum,
+        const Formatted&    fmt,
+        const Unified&      unif,
+        const Asynchronous& async)
+{
+    this->open(rset, seqnum, fmt, unif, async, nullptr);
+}
+
+Opm::EclIO::OutputStream::Restart::
+Restart(const ResultSet&    rset,
+        const int           seqnum,
+        const Formatted&    fmt,
+        const Unified&      unif,
+        const Asynchronous& async,
+        ArrayCatalog&       catalog)
+{
+    this->open(rset, seqnum, fmt, unif, async, &catalog);
+}
+
+void
+Opm::EclIO::OutputStream::Restart::
+open(const ResultSet&    rset,
+     const int           seqnum,
+     const Formatted&    fmt,
+     const Unified&      unif,
+     const Asynchronous& async,
+     ArrayCatalog*       catalog)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
@@ -301,15 +333,26 @@ Restart(const ResultSet& rset,
     if (unif.set) {
         // Run uses unified restart files.
         this->openUnified(fname, fmt.set, seqnum);
-
-        // Write SEQNUM value to stream to start new output sequence.
-        this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
     }
     else {
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
         this->openNew(fname, fmt.set);
     }
+
+    // Drops catalog entries for any part of the file being overwritten.
+    if (catalog != nullptr) {
+        this->stream_->enableDeduplication(*catalog);
+    }
+
+    if (unif.set) {
+        // Write SEQNUM value to stream to start new output sequence.
+        this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
+    }
+
+    if (async.set) {
+        this->stream_->enableAsync();
+    }
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
@@ -327,6 +370,11 @@ Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
     return *this;
 }
 
+void Opm::EclIO::OutputStream::Restart::enableCompression()
+{
+    this->stream().enableCompression();
+}
+
 void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
 {
     this->stream().message(msg);
@@ -375,6 +423,54 @@ write(const std::string&                        kw,
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Restart::
+write(const std::string& kw, std::vector<int>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void
+Opm::EclIO::OutputStream::Restart::
+write(const std::string& kw, std::vector<bool>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void
+Opm::EclIO::OutputStream::Restart::
+write(const std::string& kw, std::vector<float>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void
+Opm::EclIO::OutputStream::Restart::
+write(const std::string& kw, std::vector<double>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void Opm::EclIO::OutputStream::Restart::flush()
+{
+    this->stream().flushStream();
+}
+
+Opm::EclIO::OutputStream::ReservedArray
+Opm::EclIO::OutputStream::Restart::
+reserve(const std::string& kw, const eclArrType type, const std::size_t size)
+{
+    auto& stream = this->stream();
+
+    auto array = ReservedArray{};
+    array.filename = stream.fileName;
+    array.offset = stream.reserveBinaryArray(kw, static_cast<std::int64_t>(size), type);
+    array.size = size;
+    array.type = type;
+
+    return array;
+}
+
 void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
@@ -469,6 +565,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         this->stream().write(kw, data);
     }
 
+    template <typename T>
+    void Restart::writeImpl(const std::string& kw,
+                            std::vector<T>&&   data)
+    {
+        this->stream().write(kw, std::move(data));
+    }
+
 }}}
 
 // =====================================================================
@@ -476,11 +579,16 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 Opm::EclIO::OutputStream::RFT::
 RFT(const ResultSet&    rset,
     const Formatted&    fmt,
-    const OpenExisting& existing)
+    const OpenExisting& existing,
+    const Asynchronous& async)
 {
     const auto fname = outputFileName(rset, FileExtension::rft(fmt.set));
 
     this->open(fname, fmt.set, existing.set);
+
+    if (async.set) {
+        this->stream_->enableAsync();
+    }
 }
 
 Opm::EclIO::OutputStream::RFT::~RFT()
@@ -520,6 +628,33 @@ write(const std::string&                        kw,
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, std::vector<int>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, std::vector<float>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string&                   kw,
+      std::vector<PaddedOutputString<8>>&& data)
+{
+    this->writeImpl(kw, std::move(data));
+}
+
+void Opm::EclIO::OutputStream::RFT::flush()
+{
+    this->stream().flushStream();
+}
+
 void
 Opm::EclIO::OutputStream::RFT::
 open(const std::string& fname,
@@ -546,6 +681,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         this->stream().write(kw, data);
     }
 
+    template <typename T>
+    void RFT::writeImpl(const std::string& kw,
+                        std::vector<T>&&   data)
+    {
+        this->stream().write(kw, std::move(data));
+    }
+
 }}} // namespace Opm::EclIO::OutputStream
 
 // =====================================================================
@@ -700,7 +842,8 @@ SummarySpecification(const ResultSet&            rset,
                      const UnitConvention        uconv,
                      const std::array<int,3>&    cartDims,
                      const RestartSpecification& restart,
-                     const StartTime             start)
+                     const StartTime             start,
+                     const Asynchronous&         async)
     : unit_       (unitConvention(uconv))
     , restartStep_(makeRestartStep(restart))
     , cartDims_   (cartDims)
@@ -710,6 +853,10 @@ SummarySpecification(const ResultSet&            rset,
     const auto fname = outputFileName(rset, FileExtension::smspec(fmt.set));
 
     this->stream_ = Open::Smspec::write(fname, fmt.set);
+
+    if (async.set) {
+        this->stream_->enableAsync();
+    }
 }
 
 Opm::EclIO::OutputStream::SummarySpecification::~SummarySpecification()
@@ -765,6 +912,13 @@ SummarySpecification::write(const Parameters& params)
 
     smspec.write("STARTDAT", makeStartDate(this->startDate_));
 
+    if (! smspec.isAsync()) {
+        this->flushStream();
+    }
+}
+
+void Opm::EclIO::OutputStream::SummarySpecification::flush()
+{
     this->flushStream();
 }
 
@@ -773,6 +927,7 @@ void Opm::EclIO::OutputStream::SummarySpecification::rewindStream()
     // Benefits from EclOutput friendship
     const auto position = std::ofstream::pos_type{0};
 
+    this->stream().waitForPendingWrites();
     this->stream().ofileH.seekp(position, std::ios_base::beg);
 }
 
@@ -807,6 +962,116 @@ Opm::EclIO::OutputStream::createSummaryFile(const ResultSet& rset,
 
 // =====================================================================
 
+namespace {
+
+    template <typename T>
+    void writeReservedSlice(const Opm::EclIO::OutputStream::ReservedArray& array,
+                            const Opm::EclIO::eclArrType                   type,
+                            const std::size_t                              first,
+                            const std::vector<T>&                          values)
+    {
+        if (array.type != type) {
+            throw std::invalid_argument {
+                "Element type does not match reserved array in '"
+                + array.filename + '\''
+            };
+        }
+
+        if ((first > array.size) || (values.size() > array.size - first)) {
+            throw std::out_of_range {
+                "Slice exceeds size of reserved array in '"
+                + array.filename + '\''
+            };
+        }
+
+        const auto sizeData = Opm::EclIO::block_size_data_binary(type);
+        const auto sizeOfElement = static_cast<std::size_t>(std::get<0>(sizeData));
+        const auto maxNumberOfElements = std::get<1>(sizeData) / sizeOfElement;
+
+        // Each record is framed by a leading and trailing 4 byte marker.
+        const auto recordSize = maxNumberOfElements*sizeOfElement + 2*sizeof(int);
+
+        const int fd = ::open(array.filename.c_str(), O_WRONLY);
+        if (fd < 0) {
+            throw std::runtime_error {
+                "Unable to open '" + array.filename
+                + "' for writing: " + std::strerror(errno)
+            };
+        }
+
+        auto buffer = std::vector<T>{};
+        auto i = std::size_t{0};
+        while (i < values.size()) {
+            const auto elem = first + i;
+            const auto record = elem / maxNumberOfElements;
+            const auto pos = elem % maxNumberOfElements;
+            const auto count = std::min(values.size() - i, maxNumberOfElements - pos);
+
+            buffer.resize(count);
+            if constexpr (sizeof(T) == 8) {
+                Opm::EclIO::swapEndian64(values.data() + i, buffer.data(), count);
+            }
+            else {
+                Opm::EclIO::swapEndian32(values.data() + i, buffer.data(), count);
+            }
+
+            auto offset = static_cast<off_t>(array.offset + record*recordSize
+                                             + sizeof(int) + pos*sizeOfElement);
+
+            const auto* data = reinterpret_cast<const char*>(buffer.data());
+            auto nbytes = count * sizeOfElement;
+            while (nbytes > 0) {
+                const auto nwritten = ::pwrite(fd, data, nbytes, offset);
+                if (nwritten < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+
+                    const auto err = errno;
+                    ::close(fd);
+
+                    throw std::runtime_error {
+                        "Failed writing to '" + array.filename
+                        + "': " + std::strerror(err)
+                    };
+                }
+
+                data += nwritten;
+                offset += nwritten;
+                nbytes -= static_cast<std::size_t>(nwritten);
+            }
+
+            i += count;
+        }
+
+        ::close(fd);
+    }
+
+} // Anonymous namespace
+
+void Opm::EclIO::OutputStream::writeSlice(const ReservedArray&    array,
+                                          const std::size_t       first,
+                                          const std::vector<int>& values)
+{
+    writeReservedSlice(array, eclArrType::INTE, first, values);
+}
+
+void Opm::EclIO::OutputStream::writeSlice(const ReservedArray&      array,
+                                          const std::size_t         first,
+                                          const std::vector<float>& values)
+{
+    writeReservedSlice(array, eclArrType::REAL, first, values);
+}
+
+void Opm::EclIO::OutputStream::writeSlice(const ReservedArray&       array,
+                                          const std::size_t          first,
+                                          const std::vector<double>& values)
+{
+    writeReservedSlice(array, eclArrType::DOUB, first, values);
+}
+
+// =====================================================================
+
 std::string
 Opm::EclIO::OutputStream::outputFileName(const ResultSet&   rsetDescriptor,
                                          const std::string& ext)
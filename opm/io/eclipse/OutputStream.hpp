@@ -20,11 +20,14 @@
 #ifndef OPM_IO_OUTPUTSTREAM_HPP_INCLUDED
 #define OPM_IO_OUTPUTSTREAM_HPP_INCLUDED
 
+#include <opm/io/eclipse/EclIOdata.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <ios>
 #include <memory>
 #include <string>
@@ -32,14 +35,34 @@
 
 namespace Opm { namespace EclIO {
 
+    class ArrayCatalog;
     class EclOutput;
 
 }} // namespace Opm::EclIO
 
 namespace Opm { namespace EclIO { namespace OutputStream {
 
-    struct Formatted { bool set; };
-    struct Unified   { bool set; };
+    struct Formatted    { bool set; };
+    struct Unified      { bool set; };
+    struct Asynchronous { bool set; };
+
+    /// Location of an array in an unformatted output file whose values
+    /// are written separately through writeSlice(), e.g., by several
+    /// processes each holding a part of the array.
+    struct ReservedArray
+    {
+        /// Name of file containing the array.
+        std::string filename;
+
+        /// File offset of the array's first data record.
+        std::uint64_t offset{0};
+
+        /// Number of array elements.
+        std::size_t size{0};
+
+        /// Element type.  INTE, REAL or DOUB.
+        eclArrType type{REAL};
+    };
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -152,10 +175,30 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
-        explicit Restart(const ResultSet& rset,
-                         const int        seqnum,
-                         const Formatted& fmt,
-                         const Unified&   unif);
+        ///
+        /// \param[in] async Whether or not to encode and write arrays on
+        ///    a background thread.  Array data passed as rvalues is then
+        ///    moved rather than copied.  Call flush() to ensure that all
+        ///    data has reached the file, e.g., at the end of a report step.
+        explicit Restart(const ResultSet&    rset,
+                         const int           seqnum,
+                         const Formatted&    fmt,
+                         const Unified&      unif,
+                         const Asynchronous& async = Asynchronous{ false });
+
+        /// Constructor.
+        ///
+        /// Same as above, but writes arrays identical to an array in \p
+        /// catalog as references to that array, see ArrayCatalog.  ERst
+        /// resolves the references transparently.  The catalog should be
+        /// kept from one report step to the next.  Unformatted output
+        /// only.  Note that the resulting files can only be read by OPM.
+        explicit Restart(const ResultSet&    rset,
+                         const int           seqnum,
+                         const Formatted&    fmt,
+                         const Unified&      unif,
+                         const Asynchronous& async,
+                         ArrayCatalog&       catalog);
 
         ~Restart();
 
@@ -165,6 +208,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         Restart& operator=(const Restart& rhs) = delete;
         Restart& operator=(Restart&& rhs);
 
+        /// Write subsequent REAL and DOUB arrays losslessly compressed,
+        /// see EclOutput::enableCompression().  ERst decodes such arrays
+        /// transparently.  Unformatted output only.  Note that the
+        /// resulting files can only be read by OPM.
+        void enableCompression();
+
         /// Generate a message string (keyword type 'MESS') in underlying
         /// output stream.
         ///
@@ -222,10 +271,81 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&                        kw,
                    const std::vector<PaddedOutputString<8>>& data);
 
+        /// Write integer data to underlying output stream.  Data is
+        /// moved to the output queue in asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string& kw,
+                   std::vector<int>&& data);
+
+        /// Write boolean data to underlying output stream.  Data is
+        /// moved to the output queue in asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&  kw,
+                   std::vector<bool>&& data);
+
+        /// Write single precision floating point data to underlying
+        /// output stream.  Data is moved to the output queue in
+        /// asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&   kw,
+                   std::vector<float>&& data);
+
+        /// Write double precision floating point data to underlying
+        /// output stream.  Data is moved to the output queue in
+        /// asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&    kw,
+                   std::vector<double>&& data);
+
+        /// Wait until all data written so far has been committed to the
+        /// output file.  No-op beyond flushing the stream in synchronous
+        /// mode.
+        void flush();
+
+        /// Reserve space for an array whose values are written later
+        /// through writeSlice() rather than through this stream.
+        ///
+        /// Lets the owners of separate parts of a solution array write
+        /// their parts directly into the restart file, without first
+        /// gathering the array on a single process.  The file keeps the
+        /// standard layout.  Values must not be written before flush().
+        /// Unformatted output only.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] type Element type.  INTE, REAL or DOUB.
+        ///
+        /// \param[in] size Number of array elements.
+        ///
+        /// \return Location of the array's values.
+        ReservedArray reserve(const std::string& kw,
+                              eclArrType         type,
+                              std::size_t        size);
+
     private:
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Open output stream and write the SEQNUM record.
+        void open(const ResultSet&    rset,
+                  const int           seqnum,
+                  const Formatted&    fmt,
+                  const Unified&      unif,
+                  const Asynchronous& async,
+                  ArrayCatalog*       catalog);
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -277,6 +397,11 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         template <typename T>
         void writeImpl(const std::string&    kw,
                        const std::vector<T>& data);
+
+        /// Implementation function for rvalue \c write overload set.
+        template <typename T>
+        void writeImpl(const std::string& kw,
+                       std::vector<T>&&   data);
     };
 
     /// File manager for RFT output streams
@@ -294,9 +419,15 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] existing Whether or not to open an existing output file.
+        ///
+        /// \param[in] async Whether or not to encode and write arrays on
+        ///    a background thread.  Array data passed as rvalues is then
+        ///    moved rather than copied.  Call flush() to ensure that all
+        ///    data has reached the file.
         explicit RFT(const ResultSet&    rset,
                      const Formatted&    fmt,
-                     const OpenExisting& existing);
+                     const OpenExisting& existing,
+                     const Asynchronous& async = Asynchronous{ false });
 
         ~RFT();
 
@@ -332,6 +463,40 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&                        kw,
                    const std::vector<PaddedOutputString<8>>& data);
 
+        /// Write integer data to underlying output stream.  Data is
+        /// moved to the output queue in asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string& kw,
+                   std::vector<int>&& data);
+
+        /// Write single precision floating point data to underlying
+        /// output stream.  Data is moved to the output queue in
+        /// asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&   kw,
+                   std::vector<float>&& data);
+
+        /// Write padded character data (8 characters per string)
+        /// to underlying output stream.  Data is moved to the output
+        /// queue in asynchronous mode.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&                   kw,
+                   std::vector<PaddedOutputString<8>>&& data);
+
+        /// Wait until all data written so far has been committed to the
+        /// output file.  No-op beyond flushing the stream in synchronous
+        /// mode.
+        void flush();
+
     private:
         /// Init file output stream.
         std::unique_ptr<EclOutput> stream_;
@@ -358,6 +523,11 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         template <typename T>
         void writeImpl(const std::string&    kw,
                        const std::vector<T>& data);
+
+        /// Implementation function for public \c write overload set.
+        template <typename T>
+        void writeImpl(const std::string& kw,
+                       std::vector<T>&&   data);
     };
 
     class SummarySpecification
@@ -401,7 +571,8 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                                       const UnitConvention        uconv,
                                       const std::array<int,3>&    cartDims,
                                       const RestartSpecification& restart,
-                                      const StartTime             start);
+                                      const StartTime             start,
+                                      const Asynchronous&         async = Asynchronous{ false });
 
         ~SummarySpecification();
 
@@ -411,8 +582,15 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         SummarySpecification& operator=(const SummarySpecification& rhs) = delete;
         SummarySpecification& operator=(SummarySpecification&& rhs);
 
+        /// Write summary specification.  In asynchronous mode the
+        /// function returns without waiting for the data to reach the
+        /// file, use flush() for that.
         void write(const Parameters& params);
 
+        /// Wait until the summary specification has been committed to
+        /// the output file.
+        void flush();
+
     private:
         int unit_;
         int restartStep_;
@@ -435,6 +613,30 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                       const Formatted& fmt,
                       const Unified&   unif);
 
+    /// Write a contiguous part of a reserved array.
+    ///
+    /// Disjoint parts of the same array may be written concurrently, from
+    /// separate threads or processes.
+    ///
+    /// \param[in] array Reserved array, from Restart::reserve().
+    ///
+    /// \param[in] first Index of the first array element to write.
+    ///
+    /// \param[in] values Values of elements [first, first + values.size()).
+    void writeSlice(const ReservedArray&    array,
+                    std::size_t             first,
+                    const std::vector<int>& values);
+
+    /// Write a contiguous part of a reserved single precision array.
+    void writeSlice(const ReservedArray&      array,
+                    std::size_t               first,
+                    const std::vector<float>& values);
+
+    /// Write a contiguous part of a reserved double precision array.
+    void writeSlice(const ReservedArray&       array,
+                    std::size_t                first,
+                    const std::vector<double>& values);
+
     /// Derive filename corresponding to output stream of particular result
     /// set, with user-specified file extension.
     ///
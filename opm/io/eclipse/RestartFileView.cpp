@@ -22,6 +22,7 @@
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <stdexcept>
@@ -76,7 +77,8 @@ class Opm::EclIO::RestartFileView::Implementation
 {
 public:
     explicit Implementation(std::shared_ptr<ERst> restart_file,
-                            const int             report_step);
+                            const int             report_step,
+                            const bool            preload);
 
     ~Implementation() = default;
 
@@ -119,6 +121,48 @@ public:
             getRestartData<ElmType>(vector, this->report_step_, occurrence);
     }
 
+    template <typename ElmType>
+    std::size_t keywordSize(const std::string& vector, const int occurrence)
+    {
+        if (this->rst_file_->formattedInput()) {
+            return this->getKeyword<ElmType>(vector, occurrence).size();
+        }
+
+        return this->rst_file_->
+            getRestartView<ElmType>(vector, this->report_step_, occurrence).size();
+    }
+
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordRange(const std::string& vector,
+                    const std::size_t  first,
+                    const std::size_t  count,
+                    const int          occurrence)
+    {
+        const auto size = this->keywordSize<ElmType>(vector, occurrence);
+        if ((first > size) || (count > size - first)) {
+            throw std::out_of_range {
+                "Range [" + std::to_string(first) + ", " +
+                std::to_string(first + count) + ") outside restart vector '" +
+                vector + "' of size " + std::to_string(size)
+            };
+        }
+
+        auto range = std::vector<ElmType>(count);
+
+        if (this->rst_file_->formattedInput()) {
+            const auto& data = this->getKeyword<ElmType>(vector, occurrence);
+            std::copy_n(data.begin() + first, count, range.begin());
+        }
+        else {
+            this->rst_file_->
+                getRestartView<ElmType>(vector, this->report_step_, occurrence)
+                .copy(first, count, range.data());
+        }
+
+        return range;
+    }
+
     const std::vector<int>& intehead()
     {
         const auto ihkw = std::string { "INTEHEAD" };
@@ -180,7 +224,8 @@ private:
 
 Opm::EclIO::RestartFileView::Implementation::
 Implementation(std::shared_ptr<ERst> restart_file,
-               const int             report_step)
+               const int             report_step,
+               const bool            preload)
     : rst_file_   { std::move(restart_file) }
     , report_step_(report_step)
     , sim_step_   (std::max(report_step - 1, 0))
@@ -190,7 +235,9 @@ Implementation(std::shared_ptr<ERst> restart_file,
         return;
     }
 
-    this->rst_file_->loadReportStepNumber(this->report_step_);
+    if (preload) {
+        this->rst_file_->loadReportStepNumber(this->report_step_);
+    }
 
     for (const auto& vector : this->rst_file_->listOfRstArrays(this->report_step_)) {
         const auto& type = std::get<1>(vector);
@@ -227,8 +274,9 @@ Opm::EclIO::RestartFileView::Implementation::operator=(Implementation&& rhs)
 }
 
 Opm::EclIO::RestartFileView::RestartFileView(std::shared_ptr<ERst> restart_file,
-                                             const int             report_step)
-    : pImpl_{ new Implementation{ std::move(restart_file), report_step } }
+                                             const int             report_step,
+                                             const bool            preload)
+    : pImpl_{ new Implementation{ std::move(restart_file), report_step, preload } }
 {}
 
 Opm::EclIO::RestartFileView::~RestartFileView()
@@ -289,6 +337,24 @@ Opm::EclIO::RestartFileView::getKeyword(const std::string& vector,
     return this->pImpl_->template getKeyword<ElmType>(vector, occurrence);
 }
 
+template <typename ElmType>
+std::size_t
+Opm::EclIO::RestartFileView::keywordSize(const std::string& vector,
+                                         const int          occurrence) const
+{
+    return this->pImpl_->template keywordSize<ElmType>(vector, occurrence);
+}
+
+template <typename ElmType>
+std::vector<ElmType>
+Opm::EclIO::RestartFileView::getKeywordRange(const std::string& vector,
+                                             const std::size_t  first,
+                                             const std::size_t  count,
+                                             const int          occurrence) const
+{
+    return this->pImpl_->template getKeywordRange<ElmType>(vector, first, count, occurrence);
+}
+
 // =====================================================================
 
 namespace Opm { namespace EclIO {
@@ -314,4 +380,17 @@ RestartFileView::getKeyword<double>(const std::string&, const int) const;
 template const std::vector<std::string>&
 RestartFileView::getKeyword<std::string>(const std::string&, const int) const;
 
+template std::size_t RestartFileView::keywordSize<int>   (const std::string&, const int) const;
+template std::size_t RestartFileView::keywordSize<float> (const std::string&, const int) const;
+template std::size_t RestartFileView::keywordSize<double>(const std::string&, const int) const;
+
+template std::vector<int>
+RestartFileView::getKeywordRange<int>(const std::string&, const std::size_t, const std::size_t, const int) const;
+
+template std::vector<float>
+RestartFileView::getKeywordRange<float>(const std::string&, const std::size_t, const std::size_t, const int) const;
+
+template std::vector<double>
+RestartFileView::getKeywordRange<double>(const std::string&, const std::size_t, const std::size_t, const int) const;
+
 }} // Opm::EclIO
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -33,8 +34,16 @@ namespace Opm { namespace EclIO {
 class RestartFileView
 {
 public:
+    /// Constructor.
+    ///
+    /// \param[in] restart_file Restart file.
+    /// \param[in] report_step Report step of restart file.
+    /// \param[in] preload Whether or not to read all arrays of \p
+    ///   report_step up front.  Otherwise, arrays are read on first
+    ///   access.
     explicit RestartFileView(std::shared_ptr<ERst> restart_file,
-                             const int             report_step);
+                             const int             report_step,
+                             const bool            preload = true);
 
     ~RestartFileView();
 
@@ -56,6 +65,23 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector, const int occurrence = 0) const;
 
+    /// Number of elements of a numeric (int, float or double) restart
+    /// vector.  Does not read the vector from binary files.
+    template <typename ElmType>
+    std::size_t
+    keywordSize(const std::string& vector, const int occurrence = 0) const;
+
+    /// Elements [first, first + count) of a numeric (int, float or
+    /// double) restart vector.  Only reads those elements from binary
+    /// files.  Throws std::out_of_range if the range is not inside the
+    /// vector.
+    template <typename ElmType>
+    std::vector<ElmType>
+    getKeywordRange(const std::string& vector,
+                    const std::size_t  first,
+                    const std::size_t  count,
+                    const int          occurrence = 0) const;
+
     const std::vector<int>& intehead() const;
     const std::vector<bool>& logihead() const;
     const std::vector<double>& doubhead() const;
@@ -0,0 +1,180 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/SummaryKeyIndex.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
+
+#include <functional>
+#include <stdexcept>
+
+namespace {
+
+std::uint64_t keyHash(std::string_view key)
+{
+    return std::hash<std::string_view>{}(key);
+}
+
+// Upper hash bits stored in each slot, to skip most string comparisons
+// on collisions.
+std::uint32_t tag(std::uint64_t hash)
+{
+    return static_cast<std::uint32_t>(hash >> 32) | 1u;
+}
+
+const std::vector<std::size_t>& bucket(const std::unordered_map<std::string, std::vector<std::size_t>>& groups,
+                                       const std::string& name)
+{
+    static const std::vector<std::size_t> empty{};
+
+    auto it = groups.find(name);
+    return (it == groups.end()) ? empty : it->second;
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+SummaryKeyIndex::SummaryKeyIndex(const std::vector<std::string>& keys)
+    : keys_(keys)
+{
+    if (keys.size() >= std::size_t{0xffffffff})
+        throw std::invalid_argument("too many summary keys to index");
+
+    // Table at most half full
+    std::size_t capacity = 8;
+    while (capacity < 2 * keys.size())
+        capacity *= 2;
+
+    this->slots_.resize(capacity);
+    this->mask_ = capacity - 1;
+
+    for (std::size_t n = 0; n < keys.size(); n++) {
+        const auto& key = keys[n];
+        const auto hash = keyHash(key);
+        const auto key_tag = tag(hash);
+
+        auto slot = static_cast<std::size_t>(hash) & this->mask_;
+        while (this->slots_[slot].pos != 0) {
+            const auto& other = this->slots_[slot];
+            if ((other.hash == key_tag) && (keys[other.pos - 1] == key))
+                break;
+
+            slot = (slot + 1) & this->mask_;
+        }
+
+        this->slots_[slot] = { key_tag, static_cast<std::uint32_t>(n + 1) };
+
+        const auto first = key.find(':');
+        this->by_keyword_[key.substr(0, first)].push_back(n);
+
+        if (first != std::string::npos)
+            this->by_entity_[key.substr(key.rfind(':') + 1)].push_back(n);
+    }
+}
+
+std::size_t SummaryKeyIndex::find(std::string_view key) const
+{
+    if (this->slots_.empty())
+        return npos;
+
+    const auto hash = keyHash(key);
+    const auto key_tag = tag(hash);
+
+    auto slot = static_cast<std::size_t>(hash) & this->mask_;
+    while (this->slots_[slot].pos != 0) {
+        const auto& entry = this->slots_[slot];
+        if ((entry.hash == key_tag) && (this->keys_[entry.pos - 1] == key))
+            return entry.pos - 1;
+
+        slot = (slot + 1) & this->mask_;
+    }
+
+    return npos;
+}
+
+const std::vector<std::size_t>& SummaryKeyIndex::withKeyword(const std::string& keyword) const
+{
+    return bucket(this->by_keyword_, keyword);
+}
+
+const std::vector<std::size_t>& SummaryKeyIndex::withEntity(const std::string& entity) const
+{
+    return bucket(this->by_entity_, entity);
+}
+
+std::vector<std::size_t> SummaryKeyIndex::match(const std::string& pattern) const
+{
+    std::vector<std::size_t> result;
+
+    const auto special = pattern.find_first_of("*?[\\");
+    if (special == std::string::npos) {
+        if (const auto pos = this->find(pattern); pos != npos)
+            result.push_back(pos);
+
+        return result;
+    }
+
+    // A literal keyword, or a literal last component, restricts the keys
+    // which can possibly match.  Bracket expressions and escapes may hide
+    // a ':', so the entity is only used for plain wildcard patterns.
+    const std::vector<std::size_t>* candidates = nullptr;
+
+    const auto first_colon = pattern.find(':');
+    if ((first_colon != std::string::npos) && (first_colon < special)) {
+        candidates = &this->withKeyword(pattern.substr(0, first_colon));
+    }
+    else if (pattern.find_first_of("[\\") == std::string::npos) {
+        const auto last_colon = pattern.rfind(':');
+        if ((last_colon != std::string::npos) &&
+            (pattern.find_first_of("*?", last_colon + 1) == std::string::npos))
+        {
+            candidates = &this->withEntity(pattern.substr(last_colon + 1));
+        }
+    }
+
+    const auto compiled = ShellPattern { pattern };
+
+    if (candidates != nullptr) {
+        for (const auto& pos : *candidates) {
+            if (compiled.match(this->keys_[pos]))
+                result.push_back(pos);
+        }
+    }
+    else {
+        for (std::size_t pos = 0; pos < this->keys_.size(); pos++) {
+            if (compiled.match(this->keys_[pos]))
+                result.push_back(pos);
+        }
+    }
+
+    return result;
+}
+
+std::vector<std::string> SummaryKeyIndex::keysAt(const std::vector<std::size_t>& positions) const
+{
+    std::vector<std::string> result;
+    result.reserve(positions.size());
+
+    for (const auto& pos : positions)
+        result.push_back(this->keys_[pos]);
+
+    return result;
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,98 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_SUMMARYKEYINDEX_HPP
+#define OPM_IO_SUMMARYKEYINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Hashed index of the summary keys of a summary file.
+///
+/// Keys, e.g. "WOPR:PROD" or "CWIT:INJ:1,2,3", are looked up in an open
+/// addressing table built once for the whole key list, so that a lookup
+/// costs a single hash and normally a single string comparison.
+///
+/// Keys are in addition grouped by keyword (the part before the first
+/// ':') and by entity (the part after the last ':', e.g. a well or group
+/// name).  Shell patterns with a literal keyword, such as "WOPR:*", or a
+/// literal entity, such as "*:PROD", are matched against the keys of
+/// that group only instead of against every key.
+class SummaryKeyIndex
+{
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    SummaryKeyIndex() = default;
+
+    /// Index \p keys.  If a key occurs more than once, lookups return the
+    /// position of its last occurrence.
+    explicit SummaryKeyIndex(const std::vector<std::string>& keys);
+
+    std::size_t size() const { return this->keys_.size(); }
+
+    const std::vector<std::string>& keys() const { return this->keys_; }
+
+    /// Position of \p key in the key list, or npos.
+    std::size_t find(std::string_view key) const;
+
+    bool contains(std::string_view key) const
+    {
+        return this->find(key) != npos;
+    }
+
+    /// Positions, in increasing order, of all keys with keyword
+    /// \p keyword.
+    const std::vector<std::size_t>& withKeyword(const std::string& keyword) const;
+
+    /// Positions, in increasing order, of all keys whose last component
+    /// is \p entity.  Keys without a ':' have no entity.
+    const std::vector<std::size_t>& withEntity(const std::string& entity) const;
+
+    /// Positions, in increasing order, of all keys matching the shell
+    /// pattern \p pattern.  Same result as testing every key with
+    /// shmatch().
+    std::vector<std::size_t> match(const std::string& pattern) const;
+
+    /// Keys at \p positions.
+    std::vector<std::string> keysAt(const std::vector<std::size_t>& positions) const;
+
+private:
+    struct Slot
+    {
+        std::uint32_t hash{0};
+        std::uint32_t pos{0};   // Position + 1, zero for an empty slot
+    };
+
+    std::vector<std::string> keys_{};
+    std::vector<Slot> slots_{};
+    std::size_t mask_{0};
+
+    std::unordered_map<std::string, std::vector<std::size_t>> by_keyword_{};
+    std::unordered_map<std::string, std::vector<std::size_t>> by_entity_{};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_SUMMARYKEYINDEX_HPP
@@ -19,7 +19,6 @@
 
 #include <opm/io/eclipse/SummaryNode.hpp>
 
-#include <numeric>
 #include <regex>
 #include <string>
 #include <unordered_set>
@@ -143,20 +142,24 @@ std::string normalise_well_completion_keyword(const std::string& keyword)
 
 std::string Opm::EclIO::SummaryNode::unique_key(number_renderer render_number) const
 {
-    auto key_parts = std::vector<std::string> { normalise_keyword(this->category, this->keyword) };
+    auto key = normalise_keyword(this->category, this->keyword);
 
-    if (auto opt = display_name())
-        key_parts.emplace_back(opt.value());
-
-    if (auto opt = display_number(render_number))
-        key_parts.emplace_back(opt.value());
-
-    auto compose_key = [](const std::string& key, const std::string& key_part) -> std::string {
+    // Appended in place rather than through temporary key parts.
+    auto append = [&key](const std::string& key_part) {
         constexpr auto delimiter { ':' } ;
-        return key.empty() ? key_part : key + delimiter + key_part;
+        if (! key.empty())
+            key += delimiter;
+
+        key += key_part;
     };
 
-    return std::accumulate(std::begin(key_parts), std::end(key_parts), std::string(), compose_key);
+    if (use_name(this->category))
+        append(this->wgname);
+
+    if (use_number(this->category))
+        append(render_number(*this));
+
+    return key;
 }
 
 std::string Opm::EclIO::SummaryNode::unique_key() const {
@@ -0,0 +1,202 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::DenseMatrixBatch
+ */
+#ifndef OPM_DENSE_MATRIX_BATCH_HH
+#define OPM_DENSE_MATRIX_BATCH_HH
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief A set of dense n x n matrices which are solved together.
+ *
+ * Entry (rowIdx, colIdx) of system sysIdx is stored at
+ * (rowIdx*n + colIdx)*numSystems() + sysIdx, i.e., the systems are
+ * interleaved like in TridiagonalMatrixBatch. The elimination steps of the LU
+ * decomposition thus run over contiguous memory for all systems at once, and
+ * since n is a compile time constant, the loops over the rows and columns can
+ * be unrolled. This pays off when many small systems, e.g. the Newton systems
+ * of the flash calculations of all cells, need to be solved.
+ *
+ * Partial pivoting is done separately for each system.
+ *
+ * \tparam Scalar The type of the entries, may be an automatic differentiation type
+ * \tparam n The number of rows and columns of each matrix
+ */
+template <class Scalar, int n>
+class DenseMatrixBatch
+{
+public:
+    explicit DenseMatrixBatch(std::size_t numSystems = 0)
+    {
+        resize(numSystems);
+    }
+
+    /*!
+     * \brief Return the number of matrices.
+     */
+    std::size_t numSystems() const
+    { return numSystems_; }
+
+    /*!
+     * \brief Return the number of rows/columns of each matrix.
+     */
+    static constexpr int size()
+    { return n; }
+
+    /*!
+     * \brief Change the number of matrices.
+     *
+     * All entries are set to zero.
+     */
+    void resize(std::size_t numSystems)
+    {
+        numSystems_ = numSystems;
+        entries_.assign(n*n*numSystems, Scalar{0.0});
+    }
+
+    Scalar& operator()(int rowIdx, int colIdx, std::size_t sysIdx)
+    { return entries_[index_(rowIdx, colIdx, sysIdx)]; }
+
+    const Scalar& operator()(int rowIdx, int colIdx, std::size_t sysIdx) const
+    { return entries_[index_(rowIdx, colIdx, sysIdx)]; }
+
+    /*!
+     * \brief Set all entries of one matrix from a matrix with operator[][] access,
+     *        e.g. a Dune::FieldMatrix.
+     */
+    template <class Matrix>
+    void setMatrix(std::size_t sysIdx, const Matrix& A)
+    {
+        for (int rowIdx = 0; rowIdx < n; ++rowIdx)
+            for (int colIdx = 0; colIdx < n; ++colIdx)
+                (*this)(rowIdx, colIdx, sysIdx) = A[rowIdx][colIdx];
+    }
+
+    /*!
+     * \brief Solve A_s x_s = b_s for all systems s.
+     *
+     * Both b and x are stored interleaved like the matrix entries, i.e., the
+     * entry of row i of system s is at i*numSystems() + s. The matrices are
+     * overwritten by their LU factors.
+     *
+     * \param singular Receives for each system whether its matrix is
+     *                 singular. The solution of such systems is undefined, but
+     *                 it does not affect the solution of the other systems.
+     */
+    template <class XVector, class BVector>
+    void solve(XVector& x, const BVector& b, std::vector<unsigned char>& singular)
+    {
+        const std::size_t m = numSystems_;
+        if (static_cast<std::size_t>(b.size()) != n*m)
+            throw std::invalid_argument("Right hand side does not match the size of the matrix batch");
+
+        x.resize(n*m);
+        for (std::size_t i = 0; i < n*m; ++i)
+            x[i] = b[i];
+        singular.assign(m, 0);
+
+        Scalar* a = entries_.data();
+        const auto entry = [a, m](int rowIdx, int colIdx) -> Scalar*
+        { return a + (rowIdx*n + colIdx)*m; };
+
+        for (int k = 0; k < n; ++k) {
+            // partial pivoting, for each system separately
+            for (std::size_t s = 0; s < m; ++s) {
+                int pivotRow = k;
+                auto pivotAbs = std::abs(scalarValue(entry(k, k)[s]));
+                for (int i = k + 1; i < n; ++i) {
+                    const auto candidate = std::abs(scalarValue(entry(i, k)[s]));
+                    if (candidate > pivotAbs) {
+                        pivotRow = i;
+                        pivotAbs = candidate;
+                    }
+                }
+
+                if (pivotAbs == 0) {
+                    // keep the arithmetic finite for this system
+                    singular[s] = 1;
+                    entry(k, k)[s] = 1.0;
+                    continue;
+                }
+
+                if (pivotRow != k) {
+                    for (int j = k; j < n; ++j)
+                        std::swap(entry(k, j)[s], entry(pivotRow, j)[s]);
+                    std::swap(x[k*m + s], x[pivotRow*m + s]);
+                }
+            }
+
+            // elimination, all systems at once
+            const Scalar* pivot = entry(k, k);
+            for (int i = k + 1; i < n; ++i) {
+                Scalar* factor = entry(i, k);
+                for (std::size_t s = 0; s < m; ++s)
+                    factor[s] /= pivot[s];
+
+                for (int j = k + 1; j < n; ++j) {
+                    Scalar* aij = entry(i, j);
+                    const Scalar* akj = entry(k, j);
+                    for (std::size_t s = 0; s < m; ++s)
+                        aij[s] -= factor[s]*akj[s];
+                }
+
+                for (std::size_t s = 0; s < m; ++s)
+                    x[i*m + s] -= factor[s]*x[k*m + s];
+            }
+        }
+
+        // backward substitution
+        for (int i = n - 1; i >= 0; --i) {
+            for (int j = i + 1; j < n; ++j) {
+                const Scalar* aij = entry(i, j);
+                for (std::size_t s = 0; s < m; ++s)
+                    x[i*m + s] -= aij[s]*x[j*m + s];
+            }
+            const Scalar* aii = entry(i, i);
+            for (std::size_t s = 0; s < m; ++s)
+                x[i*m + s] /= aii[s];
+        }
+    }
+
+private:
+    std::size_t index_(int rowIdx, int colIdx, std::size_t sysIdx) const
+    { return (rowIdx*n + colIdx)*numSystems_ + sysIdx; }
+
+    std::size_t numSystems_{0};
+    std::vector<Scalar> entries_;
+};
+
+} // namespace Opm
+
+#endif
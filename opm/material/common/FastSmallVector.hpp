@@ -33,19 +33,146 @@
 
 #include <array>
 #include <algorithm>
-#include <vector>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
 
 namespace Opm {
 
+namespace detail {
+
+/*!
+ * \brief Per-thread cache of the heap buffers of FastSmallVector.
+ *
+ * Buffers are allocated with capacities which are powers of two. A released
+ * buffer is kept in a free list of the releasing thread and handed out again
+ * by the next allocation of the same capacity class, so temporaries with the
+ * same number of elements only reach the system allocator once per thread.
+ * The number of cached buffers per class is bounded, and the cache of a
+ * thread is freed when the thread exits. A buffer may be released by a
+ * different thread than the one which allocated it.
+ */
+template <typename ValueType>
+class FastSmallVectorPool
+{
+public:
+    /*!
+     * \brief Allocate an uninitialized buffer for at least numElem elements.
+     *
+     * \param capacity Receives the number of elements which fit into the buffer
+     */
+    static ValueType* allocate(std::size_t numElem, std::size_t& capacity)
+    {
+        const unsigned cls = sizeClass_(numElem);
+        capacity = std::size_t{1} << cls;
+
+        if (!destroyed_()) {
+            auto& cache = cache_();
+            if (FreeBlock* block = cache.head[cls]) {
+                cache.head[cls] = block->next;
+                --cache.count[cls];
+                return reinterpret_cast<ValueType*>(block);
+            }
+        }
+
+        return static_cast<ValueType*>(::operator new(numBytes_(capacity)));
+    }
+
+    /*!
+     * \brief Release a buffer obtained from allocate().
+     *
+     * The elements must already be destroyed.
+     */
+    static void deallocate(ValueType* ptr, std::size_t capacity)
+    {
+        const unsigned cls = sizeClass_(capacity);
+        if (!destroyed_()) {
+            auto& cache = cache_();
+            if (cache.count[cls] < maxCachedBuffers_) {
+                FreeBlock* block = ::new (static_cast<void*>(ptr)) FreeBlock{cache.head[cls]};
+                cache.head[cls] = block;
+                ++cache.count[cls];
+                return;
+            }
+        }
+
+        ::operator delete(static_cast<void*>(ptr));
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static constexpr unsigned numClasses_ = 8*sizeof(std::size_t);
+    static constexpr unsigned maxCachedBuffers_ = 64;
+
+    static_assert(alignof(ValueType) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                  "FastSmallVector does not support over-aligned types");
+
+    struct Cache
+    {
+        std::array<FreeBlock*, numClasses_> head{};
+        std::array<unsigned, numClasses_> count{};
+
+        ~Cache()
+        {
+            for (FreeBlock* block : head) {
+                while (block) {
+                    FreeBlock* next = block->next;
+                    ::operator delete(static_cast<void*>(block));
+                    block = next;
+                }
+            }
+            // buffers released after this point, e.g. by objects with
+            // static storage duration, go directly to the system allocator
+            destroyed_() = true;
+        }
+    };
+
+    static Cache& cache_()
+    {
+        thread_local Cache cache;
+        return cache;
+    }
+
+    static bool& destroyed_()
+    {
+        thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    static unsigned sizeClass_(std::size_t numElem)
+    {
+        unsigned cls = 0;
+        while ((std::size_t{1} << cls) < numElem)
+            ++cls;
+        return cls;
+    }
+
+    static std::size_t numBytes_(std::size_t capacity)
+    { return std::max(capacity*sizeof(ValueType), sizeof(FreeBlock)); }
+};
+
+} // namespace detail
+
 /*!
  * \brief An implementation of vector/array based on small object optimization. It is intended
  *        to be used by the DynamicEvaluation for better efficiency.
+ *
+ * Vectors with more than N elements store them in a buffer from the
+ * FastSmallVectorPool of the thread, so creating temporaries of the same
+ * size does not call the system allocator once the pool is warm.
  */
 //! ValueType is the type of the data
 //! N is the size of the buffer that willl be allocated during compilation time
 template <typename ValueType, unsigned N>
 class FastSmallVector
 {
+    using Pool = detail::FastSmallVectorPool<ValueType>;
+
 public:
     //! default constructor
     FastSmallVector()
@@ -90,20 +217,26 @@ public:
     //! destructor
     ~FastSmallVector()
     {
+        releaseHeap_();
     }
 
 
     //! move assignment
     FastSmallVector& operator=(FastSmallVector&& other)
     {
+        if (this == &other)
+            return (*this);
+
         size_ = other.size_;
         if (size_ <= N) {
             smallBuf_ = std::move(other.smallBuf_);
             dataPtr_ = smallBuf_.data();
         }
         else {
-            data_ = std::move(other.data_);
-            dataPtr_ = data_.data();
+            releaseHeap_();
+            heap_ = std::exchange(other.heap_, nullptr);
+            heapCapacity_ = std::exchange(other.heapCapacity_, 0);
+            dataPtr_ = heap_;
         }
 
         other.dataPtr_ = nullptr;
@@ -115,15 +248,19 @@ public:
     //! copy assignment
     FastSmallVector& operator=(const FastSmallVector& other)
     {
+        if (this == &other)
+            return (*this);
+
         size_ = other.size_;
 
         if (size_ <= N) {
             smallBuf_ = other.smallBuf_;
             dataPtr_ = smallBuf_.data();
         }
-        else if (dataPtr_ != other.dataPtr_) {
-            data_ = other.data_;
-            dataPtr_ = data_.data();
+        else {
+            reserveHeap_(size_);
+            std::copy(other.dataPtr_, other.dataPtr_ + size_, heap_);
+            dataPtr_ = heap_;
         }
 
         return (*this);
@@ -147,14 +284,37 @@ private:
         size_ = numElem;
 
         if (size_ > N) {
-            data_.resize(size_);
-            dataPtr_ = data_.data();
+            reserveHeap_(size_);
+            dataPtr_ = heap_;
         } else
             dataPtr_ = smallBuf_.data();
     }
 
+    // make the heap buffer hold at least numElem value-initialized elements
+    void reserveHeap_(size_t numElem)
+    {
+        if (heapCapacity_ >= numElem)
+            return;
+
+        releaseHeap_();
+        heap_ = Pool::allocate(numElem, heapCapacity_);
+        std::uninitialized_value_construct_n(heap_, heapCapacity_);
+    }
+
+    void releaseHeap_()
+    {
+        if (!heap_)
+            return;
+
+        std::destroy_n(heap_, heapCapacity_);
+        Pool::deallocate(heap_, heapCapacity_);
+        heap_ = nullptr;
+        heapCapacity_ = 0;
+    }
+
     std::array<ValueType, N> smallBuf_;
-    std::vector<ValueType> data_;
+    ValueType* heap_{nullptr};
+    std::size_t heapCapacity_{0};
     std::size_t size_;
     ValueType* dataPtr_;
 };
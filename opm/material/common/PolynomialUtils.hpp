@@ -27,7 +27,9 @@
 #ifndef OPM_POLYNOMIAL_UTILS_HH
 #define OPM_POLYNOMIAL_UTILS_HH
 
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <algorithm>
 
 #include <opm/material/common/MathToolbox.hpp>
@@ -292,7 +294,7 @@ unsigned invertCubicPolynomial(SolContainer* sol,
         return 1;
     }
 
-    assert(std::abs(scalarValue(p)) > 1e-30 && std::abs(scalarValue(q)) > 1e-30);
+    assert(std::abs(scalarValue(p)) > 1e-30 && std::abs(scalarValue(q)) <= 1e-30);
 
     // t^3 + p*t = 0 = t*(t^2 + p),
     //
@@ -408,6 +410,113 @@ unsigned cubicRoots(SolContainer* sol,
         return 3;
     }
 }
+
+//! \cond SKIP_THIS
+template <class Scalar>
+Scalar signedCubicRoot_(const Scalar& x)
+{
+    if (x < 0)
+        return - pow(-x, 1.0/3.0);
+    return pow(x, 1.0/3.0);
+}
+//! \endcond
+
+/*!
+ * \ingroup Math
+ * \brief Compute the smallest and the largest real root of a cubic polynomial
+ *
+ * The polynomial is defined as
+ * \f[ p(x) = a\; x^3 + + b\;x^3 + c\;x + d \f]
+ *
+ * Cubic equations of state only need the smallest (liquid) and the largest
+ * (vapor) root. This method computes them directly: with three real roots the
+ * trigonometric method yields the extreme roots without sorting, and with a
+ * single real root Cardano's formula is evaluated in a form which is free of
+ * cancellation. If the polynomial has three real roots, the result is identical
+ * to the one of cubicRoots(). The method returns the number of real roots (1 or
+ * 3), in the former case xMin and xMax are equal.
+ *
+ * \param xMin The smallest real root
+ * \param xMax The largest real root
+ * \param a The coefficient for the cubic term, must be non-zero
+ * \param b The coefficient for the quadratic term
+ * \param c The coefficient for the linear term
+ * \param d The coefficient for the constant term
+ */
+template <class Scalar>
+unsigned cubicExtremeRoots(Scalar& xMin,
+                           Scalar& xMax,
+                           const Scalar& a,
+                           const Scalar& b,
+                           const Scalar& c,
+                           const Scalar& d)
+{
+    // depressed cubic t^3 + p*t + q with x = t - b/(3*a), see cubicRoots()
+    const Scalar p = (3.0 * a * c - b * b) / (3.0 * a * a);
+    const Scalar q = (2.0 * b * b * b - 9.0 * a * b * c + 27.0 * d * a * a) / (27.0 * a * a * a);
+    const Scalar shift = b / (3.0 * a);
+
+    const Scalar discr = 4.0 * p * p * p + 27.0 * q * q;
+    if (discr < 0.0) {
+        // three real roots, p < 0. the root for k = 0 of
+        // 2*sqrt(-p/3)*cos(theta - 2*k*pi/3) is the largest and the one for k = 2
+        // the smallest since theta is in [0, pi/3]
+        const Scalar theta = (1.0 / 3.0) * acos( ((3.0 * q) / (2.0 * p)) * sqrt(-3.0 / p) );
+        xMax = 2.0 * sqrt(-p / 3.0) * cos( theta ) - shift;
+        xMin = 2.0 * sqrt(-p / 3.0) * cos( theta - ((4.0 * M_PI) / 3.0) ) - shift;
+        return 3;
+    }
+
+    if (discr == 0.0) {
+        // multiple roots: t = 2*u and the double root t = -u with u^3 = -q/2
+        const Scalar u = signedCubicRoot_(Scalar(-q / 2.0));
+        if (u > 0.0) {
+            xMin = -u - shift;
+            xMax = 2.0 * u - shift;
+        }
+        else {
+            xMin = 2.0 * u - shift;
+            xMax = -u - shift;
+        }
+        return 3;
+    }
+
+    // a single real root t = u - p/(3*u) where u^3 = -q/2 - sign(q)*sqrt(discr/108).
+    // choosing the sign like this avoids the cancellation of the two terms, and
+    // |u| > 0 holds because discr > 0.
+    const Scalar sqrtD = sqrt(discr / 108.0);
+    const Scalar u = signedCubicRoot_(Scalar(q < 0.0 ? sqrtD - q / 2.0 : -sqrtD - q / 2.0));
+    xMin = u - p / (3.0 * u) - shift;
+    xMax = xMin;
+    return 1;
+}
+
+/*!
+ * \ingroup Math
+ * \brief Compute the smallest and the largest real root for a batch of cubic
+ *        polynomials
+ *
+ * The coefficients of polynomial i are a[i], b[i], c[i] and d[i], see the
+ * single polynomial version of cubicExtremeRoots(). If numRoots is not null,
+ * the number of real roots of each polynomial is written to it.
+ */
+template <class Scalar>
+void cubicExtremeRoots(std::size_t n,
+                       const Scalar* a,
+                       const Scalar* b,
+                       const Scalar* c,
+                       const Scalar* d,
+                       Scalar* xMin,
+                       Scalar* xMax,
+                       unsigned* numRoots = nullptr)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const unsigned num = cubicExtremeRoots(xMin[i], xMax[i], a[i], b[i], c[i], d[i]);
+        if (numRoots)
+            numRoots[i] = num;
+    }
+}
+
 } // end Opm
 
 #endif
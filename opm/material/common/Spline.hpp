@@ -32,6 +32,8 @@
 #include <opm/material/common/TridiagonalMatrix.hpp>
 #include <opm/material/common/PolynomialUtils.hpp>
 
+#include <array>
+#include <cstddef>
 #include <iosfwd>
 #include <vector>
 
@@ -85,6 +87,13 @@ namespace Opm
  s \in \mathcal{C}^1
  * \f]
  * is true.
+ *
+ * Once the curve is specified, the polynomial coefficients of each
+ * segment are stored together with a lookup table which maps
+ * equidistant buckets of the abscissa to segments. Evaluating the
+ * spline thus costs a table lookup and one Horner scheme. For many
+ * positions at once, eval() and evalDerivative() provide batched
+ * variants which reuse the segment of the previous position.
  */
 template<class Scalar>
 class Spline
@@ -296,6 +305,7 @@ public:
         M.solve(moments, d);
 
         this->setSlopesFromMoments_(slopeVec_, moments);
+        this->updateCoefficients_();
     }
 
 
@@ -812,6 +822,55 @@ public:
         return evalDerivative_(x, segmentIdx_(scalarValue(x)));
     }
 
+    /*!
+     * \brief Evaluate the spline at a number of positions.
+     *
+     * Consecutive positions in the same segment are cheap, so sorting
+     * the positions pays off for long arrays.
+     *
+     * \param n The number of positions
+     * \param x The positions on the abscissa
+     * \param y The array which receives the values of the spline
+     * \param extrapolate See eval(x, extrapolate)
+     */
+    template <class Evaluation>
+    void eval(std::size_t n, const Evaluation* x, Evaluation* y, bool extrapolate = false) const
+    {
+        std::size_t segIdx = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            if (!applies(x[k])) {
+                y[k] = eval(x[k], extrapolate);
+                continue;
+            }
+
+            segIdx = segmentIdx_(scalarValue(x[k]), segIdx);
+            y[k] = eval_(x[k], segIdx);
+        }
+    }
+
+    /*!
+     * \brief Evaluate the spline's derivative at a number of positions.
+     *
+     * \param n The number of positions
+     * \param x The positions on the abscissa
+     * \param dy The array which receives the derivatives of the spline
+     * \param extrapolate See evalDerivative(x, extrapolate)
+     */
+    template <class Evaluation>
+    void evalDerivative(std::size_t n, const Evaluation* x, Evaluation* dy, bool extrapolate = false) const
+    {
+        std::size_t segIdx = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            if (!applies(x[k])) {
+                dy[k] = evalDerivative(x[k], extrapolate);
+                continue;
+            }
+
+            segIdx = segmentIdx_(scalarValue(x[k]), segIdx);
+            dy[k] = evalDerivative_(x[k], segIdx);
+        }
+    }
+
     /*!
      * \brief Evaluate the spline's second derivative at a given position.
      *
@@ -1074,6 +1133,7 @@ protected:
 
         // convert the moments to slopes at the sample points
         this->setSlopesFromMoments_(slopeVec_, moments);
+        this->updateCoefficients_();
     }
 
     /*!
@@ -1095,6 +1155,7 @@ protected:
 
         // convert the moments to slopes at the sample points
         this->setSlopesFromMoments_(slopeVec_, moments);
+        this->updateCoefficients_();
     }
 
     /*!
@@ -1126,6 +1187,7 @@ protected:
 
         // convert the moments to slopes at the sample points
         this->setSlopesFromMoments_(slopeVec_, moments);
+        this->updateCoefficients_();
     }
 
     /*!
@@ -1394,6 +1456,44 @@ protected:
                 }
             }
         }
+
+        this->updateCoefficients_();
+    }
+
+    /*!
+     * \brief Compute the polynomial coefficients of the segments and the
+     *        segment lookup table from the sampling points and slopes.
+     *
+     * Within segment \f$i\f$ the spline is represented as
+     * \f$ c_0 + c_1 s + c_2 s^2 + c_3 s^3 \f$ with \f$ s = x - x_i \f$.
+     */
+    void updateCoefficients_()
+    {
+        const size_t n = numSamples();
+        const size_t nSeg = n - 1;
+        coeffs_.resize(nSeg);
+        for (size_t i = 0; i < nSeg; ++i) {
+            // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
+            const Scalar h = h_(i + 1);
+            const Scalar secant = (y_(i + 1) - y_(i))/h;
+            coeffs_[i][0] = y_(i);
+            coeffs_[i][1] = slope_(i);
+            coeffs_[i][2] = (3*secant - 2*slope_(i) - slope_(i + 1))/h;
+            coeffs_[i][3] = (slope_(i) + slope_(i + 1) - 2*secant)/(h*h);
+        }
+
+        // two buckets per segment keep the linear search short even for
+        // moderately non-uniform sampling points
+        const size_t nBuckets = 2*nSeg;
+        segmentLut_.resize(nBuckets);
+        lutScale_ = nBuckets/(x_(n - 1) - x_(0));
+        size_t segIdx = 0;
+        for (size_t b = 0; b < nBuckets; ++b) {
+            const Scalar xb = x_(0) + b/lutScale_;
+            while (segIdx + 1 < nSeg && x_(segIdx + 1) <= xb)
+                ++segIdx;
+            segmentLut_[b] = static_cast<unsigned>(segIdx);
+        }
     }
 
     /*!
@@ -1461,15 +1561,9 @@ protected:
     template <class Evaluation>
     Evaluation eval_(const Evaluation& x, size_t i) const
     {
-        // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
-        Scalar delta = h_(i + 1);
-        Evaluation t = (x - x_(i))/delta;
-
-        return
-            h00_(t) * y_(i)
-            + h10_(t) * slope_(i)*delta
-            + h01_(t) * y_(i + 1)
-            + h11_(t) * slope_(i + 1)*delta;
+        const auto& c = coeffs_[i];
+        const Evaluation s = x - x_(i);
+        return ((c[3]*s + c[2])*s + c[1])*s + c[0];
     }
 
     // evaluate the derivative of a spline given the actual position
@@ -1477,17 +1571,9 @@ protected:
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, size_t i) const
     {
-        // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
-        Scalar delta = h_(i + 1);
-        Evaluation t = (x - x_(i))/delta;
-        Evaluation alpha = 1 / delta;
-
-        return
-            alpha *
-            (h00_prime_(t) * y_(i)
-             + h10_prime_(t) * slope_(i)*delta
-             + h01_prime_(t) * y_(i + 1)
-             + h11_prime_(t) * slope_(i + 1)*delta);
+        const auto& c = coeffs_[i];
+        const Evaluation s = x - x_(i);
+        return (3*c[3]*s + 2*c[2])*s + c[1];
     }
 
     // evaluate the second derivative of a spline given the actual
@@ -1495,104 +1581,16 @@ protected:
     template <class Evaluation>
     Evaluation evalDerivative2_(const Evaluation& x, size_t i) const
     {
-        // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
-        Scalar delta = h_(i + 1);
-        Evaluation t = (x - x_(i))/delta;
-        Evaluation alpha = 1 / delta;
-
-        return
-            alpha*alpha
-            *(h00_prime2_(t) * y_(i)
-              + h10_prime2_(t) * slope_(i)*delta
-              + h01_prime2_(t) * y_(i + 1)
-              + h11_prime2_(t) * slope_(i + 1)*delta);
+        const auto& c = coeffs_[i];
+        const Evaluation s = x - x_(i);
+        return 6*c[3]*s + 2*c[2];
     }
 
     // evaluate the third derivative of a spline given the actual
     // position and the segment index
     template <class Evaluation>
-    Evaluation evalDerivative3_(const Evaluation& x, size_t i) const
-    {
-        // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
-        Scalar delta = h_(i + 1);
-        Evaluation t = (x - x_(i))/delta;
-        Evaluation alpha = 1 / delta;
-
-        return
-            alpha*alpha*alpha
-            *(h00_prime3_(t)*y_(i)
-              + h10_prime3_(t)*slope_(i)*delta
-              + h01_prime3_(t)*y_(i + 1)
-              + h11_prime3_(t)*slope_(i + 1)*delta);
-    }
-
-    // hermite basis functions
-    template <class Evaluation>
-    Evaluation h00_(const Evaluation& t) const
-    { return (2*t - 3)*t*t + 1; }
-
-    template <class Evaluation>
-    Evaluation h10_(const Evaluation& t) const
-    { return ((t - 2)*t + 1)*t; }
-
-    template <class Evaluation>
-    Evaluation h01_(const Evaluation& t) const
-    { return (-2*t + 3)*t*t; }
-
-    template <class Evaluation>
-    Evaluation h11_(const Evaluation& t) const
-    { return (t - 1)*t*t; }
-
-    // first derivative of the hermite basis functions
-    template <class Evaluation>
-    Evaluation h00_prime_(const Evaluation& t) const
-    { return (3*2*t - 2*3)*t; }
-
-    template <class Evaluation>
-    Evaluation h10_prime_(const Evaluation& t) const
-    { return (3*t - 2*2)*t + 1; }
-
-    template <class Evaluation>
-    Evaluation h01_prime_(const Evaluation& t) const
-    { return (-3*2*t + 2*3)*t; }
-
-    template <class Evaluation>
-    Evaluation h11_prime_(const Evaluation& t) const
-    { return (3*t - 2)*t; }
-
-    // second derivative of the hermite basis functions
-    template <class Evaluation>
-    Evaluation h00_prime2_(const Evaluation& t) const
-    { return 2*3*2*t - 2*3; }
-
-    template <class Evaluation>
-    Evaluation h10_prime2_(const Evaluation& t) const
-    { return 2*3*t - 2*2; }
-
-    template <class Evaluation>
-    Evaluation h01_prime2_(const Evaluation& t) const
-    { return -2*3*2*t + 2*3; }
-
-    template <class Evaluation>
-    Evaluation h11_prime2_(const Evaluation& t) const
-    { return 2*3*t - 2; }
-
-    // third derivative of the hermite basis functions
-    template <class Evaluation>
-    Scalar h00_prime3_(const Evaluation&) const
-    { return 2*3*2; }
-
-    template <class Evaluation>
-    Scalar h10_prime3_(const Evaluation&) const
-    { return 2*3; }
-
-    template <class Evaluation>
-    Scalar h01_prime3_(const Evaluation&) const
-    { return -2*3*2; }
-
-    template <class Evaluation>
-    Scalar h11_prime3_(const Evaluation&) const
-    { return 2*3; }
+    Evaluation evalDerivative3_(const Evaluation&, size_t i) const
+    { return 6*coeffs_[i][3]; }
 
     // returns the monotonicality of an interval of a spline segment
     //
@@ -1604,10 +1602,13 @@ protected:
     // -1: spline is monotonously decreasing in the specified interval
     int monotonic_(size_t i, Scalar x0, Scalar x1, int& r) const
     {
-        // coefficients of derivative in monomial basis
-        Scalar a = 3*a_(i);
-        Scalar b = 2*b_(i);
-        Scalar c = c_(i);
+        // coefficients of derivative in monomial basis, relative to the
+        // start of the segment
+        Scalar a = 3*coeffs_[i][3];
+        Scalar b = 2*coeffs_[i][2];
+        Scalar c = coeffs_[i][1];
+        x0 -= x_(i);
+        x1 -= x_(i);
 
         if (std::abs(a) < 1e-20 && std::abs(b) < 1e-20 && std::abs(c) < 1e-20)
             return 3; // constant in interval, r stays unchanged!
@@ -1701,18 +1702,30 @@ protected:
     // find the segment index for a given x coordinate
     size_t segmentIdx_(Scalar x) const
     {
-        // bisection
-        size_t iLow = 0;
-        size_t iHigh = numSamples() - 1;
-
-        while (iLow + 1 < iHigh) {
-            size_t i = (iLow + iHigh) / 2;
-            if (x_(i) > x)
-                iHigh = i;
-            else
-                iLow = i;
-        };
-        return iLow;
+        const size_t nSeg = numSamples() - 1;
+        const Scalar pos = (x - x_(0))*lutScale_;
+        size_t i = 0;
+        if (pos >= segmentLut_.size())
+            i = segmentLut_.back();
+        else if (pos > 0)
+            i = segmentLut_[static_cast<size_t>(pos)];
+
+        // the bucket only gives a lower bound, and rounding may put x
+        // just below the start of the bucket
+        while (i + 1 < nSeg && x_(i + 1) <= x)
+            ++i;
+        while (i > 0 && x_(i) > x)
+            --i;
+        return i;
+    }
+
+    // find the segment index for a given x coordinate, trying the
+    // segment of a previous lookup first
+    size_t segmentIdx_(Scalar x, size_t hint) const
+    {
+        if (x_(hint) <= x && x < x_(hint + 1))
+            return hint;
+        return segmentIdx_(x);
     }
 
     /*!
@@ -1767,6 +1780,13 @@ protected:
     Vector xPos_;
     Vector yPos_;
     Vector slopeVec_;
+
+    // polynomial coefficients of the segments, see updateCoefficients_()
+    std::vector<std::array<Scalar, 4>> coeffs_;
+
+    // first segment of each of the equidistant buckets in [x_0, x_n]
+    std::vector<unsigned> segmentLut_;
+    Scalar lutScale_{0};
 };
 }
 
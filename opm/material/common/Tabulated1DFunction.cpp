@@ -24,12 +24,17 @@
 #include <config.h>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <cstddef>
 #include <ostream>
+#include <stdexcept>
+#include <string>
 
 namespace Opm {
 
-template<class Scalar>
-void Tabulated1DFunction<Scalar>::
+template<class Scalar, class ContainerT>
+void Tabulated1DFunction<Scalar, ContainerT>::
 printCSV(Scalar xi0, Scalar xi1, unsigned k, std::ostream& os) const
 {
     Scalar x0 = std::min(xi0, xi1);
@@ -62,6 +67,66 @@ printCSV(Scalar xi0, Scalar xi1, unsigned k, std::ostream& os) const
     }
 }
 
+namespace detail {
+
+template <class Scalar>
+void throwTabulated1DNonFinite(Scalar x)
+{
+    throw std::runtime_error("We can not search for extrapolation/interpolation "
+                             "segment in an 1D table for non-finite value " +
+                             std::to_string(x) + " .");
+}
+
+void throwTabulated1DTooFewSamples(std::size_t numSamples)
+{
+    throw std::logic_error("We need at least two sampling points to "
+                           "do interpolation/extrapolation, "
+                           "and the table only contains " +
+                           std::to_string(numSamples) +
+                           " sampling points");
+}
+
+template <class Scalar>
+void throwTabulated1DBadSegment(Scalar x,
+                                std::size_t lowerIdx,
+                                const Scalar* xValues,
+                                std::size_t numSamples)
+{
+    std::string msg = "Problematic interpolation/extrapolation "
+                      "segment is found for the input value " +
+                      std::to_string(x) +
+                      "\nthe lower index of the found segment is " +
+                      std::to_string(lowerIdx) +
+                      ", the size of the table is " +
+                      std::to_string(numSamples) +
+                      ",\nand the end values of the found segment are " +
+                      std::to_string(xValues[lowerIdx]) +
+                      " and " +
+                      std::to_string(xValues[lowerIdx + 1]) +
+                      ", respectively.\n";
+    msg += "Outputting the problematic table for more information "
+           "(with *** marking the found segment):";
+    for (std::size_t i = 0; i < numSamples; ++i) {
+        if (i % 10 == 0)
+            msg += "\n";
+        if (i == lowerIdx)
+            msg += " ***";
+        msg += " " + std::to_string(xValues[i]);
+        if (i == lowerIdx + 1)
+            msg += " ***";
+    }
+    msg += "\n";
+    OpmLog::debug(msg);
+    throw std::runtime_error(msg);
+}
+
+template void throwTabulated1DNonFinite(double);
+template void throwTabulated1DNonFinite(float);
+template void throwTabulated1DBadSegment(double, std::size_t, const double*, std::size_t);
+template void throwTabulated1DBadSegment(float, std::size_t, const float*, std::size_t);
+
+} // namespace detail
+
 template void
 Tabulated1DFunction<double>::printCSV(double,double,
                                       unsigned,std::ostream&) const;
@@ -28,12 +28,16 @@
 #define OPM_TABULATED_1D_FUNCTION_HPP
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/gpuDecorators.hpp>
 #include <opm/material/densead/Math.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace Opm {
@@ -42,11 +46,31 @@ struct SegmentIndex {
     size_t value;
 };
 
+namespace detail {
+
+// Error reporting of Tabulated1DFunction, independent of the container type.
+template <class Scalar>
+[[noreturn]] void throwTabulated1DNonFinite(Scalar x);
+
+[[noreturn]] void throwTabulated1DTooFewSamples(std::size_t numSamples);
+
+template <class Scalar>
+[[noreturn]] void throwTabulated1DBadSegment(Scalar x,
+                                             std::size_t lowerIdx,
+                                             const Scalar* xValues,
+                                             std::size_t numSamples);
+
+} // namespace detail
+
 /*!
  * \brief Implements a linearly interpolated scalar function that depends on one
  *        variable.
+ *
+ * The container type of the sampling points may be replaced by a GPU buffer or
+ * view, see Opm::gpuistl::move_to_gpu() and Opm::gpuistl::make_view() below. Such
+ * objects can only be evaluated, their sampling points can not be modified.
  */
-template <class Scalar>
+template <class Scalar, class ContainerT = std::vector<Scalar>>
 class Tabulated1DFunction
 {
 public:
@@ -55,9 +79,22 @@ public:
      *
      * To specfiy the acutal curve, use one of the set() methods.
      */
-    Tabulated1DFunction()
+    OPM_HOST_DEVICE Tabulated1DFunction()
     {}
 
+    /*!
+     * \brief Create a function from sampling points which are already sorted in
+     *        ascending order of their x values.
+     *
+     * Intended for construction of Tabulated1DFunction<Scalar, GPUBuffer> and of
+     * views of such objects. The inverse spacing is that of the function the
+     * sampling points are copied from, see inverseSpacing().
+     */
+    static Tabulated1DFunction fromSortedSamples(const ContainerT& x,
+                                                 const ContainerT& y,
+                                                 Scalar inverseSpacing)
+    { return Tabulated1DFunction(x, y, inverseSpacing); }
+
     /*!
      * \brief Convenience constructor for a piecewise linear function.
      *
@@ -120,6 +157,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateSpacing_();
     }
 
     /*!
@@ -144,6 +183,8 @@ public:
             else if (xValues_[0] > xValues_[numSamples() - 1])
                 reverseSamplingPoints_();
         }
+
+        updateSpacing_();
     }
 
     /*!
@@ -168,6 +209,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateSpacing_();
     }
 
     /*!
@@ -204,51 +247,69 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateSpacing_();
     }
 
     /*!
      * \brief Returns the number of sampling points.
      */
-    size_t numSamples() const
+    OPM_HOST_DEVICE size_t numSamples() const
     { return xValues_.size(); }
 
     /*!
      * \brief Return the x value of the leftmost sampling point.
      */
-    Scalar xMin() const
+    OPM_HOST_DEVICE Scalar xMin() const
     { return xValues_[0]; }
 
     /*!
      * \brief Return the x value of the rightmost sampling point.
      */
-    Scalar xMax() const
+    OPM_HOST_DEVICE Scalar xMax() const
     { return xValues_[numSamples() - 1]; }
 
     /*!
      * \brief Return the x value of the a sample point with a given index.
      */
-    Scalar xAt(size_t i) const
+    OPM_HOST_DEVICE Scalar xAt(size_t i) const
     { return xValues_[i]; }
 
-    const std::vector<Scalar>& xValues() const
+    OPM_HOST_DEVICE const ContainerT& xValues() const
     { return xValues_; }
 
-    const std::vector<Scalar>& yValues() const
+    OPM_HOST_DEVICE const ContainerT& yValues() const
     { return yValues_; }
 
     /*!
      * \brief Return the value of the a sample point with a given index.
      */
-    Scalar valueAt(size_t i) const
+    OPM_HOST_DEVICE Scalar valueAt(size_t i) const
     { return yValues_[i]; }
 
     /*!
      * \brief Return true iff the given x is in range [x1, xn].
      */
     template <class Evaluation>
-    bool applies(const Evaluation& x) const
+    OPM_HOST_DEVICE bool applies(const Evaluation& x) const
     { return xValues_[0] <= x && x <= xValues_[numSamples() - 1]; }
 
+    /*!
+     * \brief Return true iff the sampling points are equally spaced.
+     *
+     * The segment containing a given x value is then computed directly
+     * instead of by bisection.
+     */
+    OPM_HOST_DEVICE bool uniformSpacing() const
+    { return invDx_ > 0; }
+
+    /*!
+     * \brief Return the inverse distance of the sampling points if they are
+     *        equally spaced, zero otherwise.
+     */
+    OPM_HOST_DEVICE Scalar inverseSpacing() const
+    { return invDx_; }
+
     /*!
      * \brief Evaluate the spline at a given position.
      *
@@ -259,14 +320,14 @@ public:
      *                    failed assertation.
      */
     template <class Evaluation>
-    Evaluation eval(const Evaluation& x, bool extrapolate = false) const
+    OPM_HOST_DEVICE Evaluation eval(const Evaluation& x, bool extrapolate = false) const
     {
         SegmentIndex segIdx = findSegmentIndex(x, extrapolate);
         return eval(x, segIdx);
     }
 
     template <class Evaluation>
-    Evaluation eval(const Evaluation& x, SegmentIndex segIdxIn) const
+    OPM_HOST_DEVICE Evaluation eval(const Evaluation& x, SegmentIndex segIdxIn) const
     {
         size_t segIdx = segIdxIn.value;
         Scalar x0 = xValues_[segIdx];
@@ -278,6 +339,47 @@ public:
         return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
     }
 
+    /*!
+     * \brief Evaluate the function at a given position, starting the segment
+     *        search at a hint.
+     *
+     * Meant for callers which evaluate the function repeatedly at nearby
+     * positions, e.g. in consecutive Newton iterations. The hint is
+     * updated to the segment containing x, and the result is the same as
+     * that of eval(x, extrapolate).
+     */
+    template <class Evaluation>
+    OPM_HOST_DEVICE Evaluation evalWithHint(const Evaluation& x,
+                                            SegmentIndex& hint,
+                                            bool extrapolate = false) const
+    {
+        hint = findSegmentIndex(x, hint, extrapolate);
+        return eval(x, hint);
+    }
+
+    /*!
+     * \brief Evaluate the function at an array of positions.
+     *
+     * Each segment search starts at the segment of the previous position,
+     * so sorted or clustered positions are cheap to look up.
+     *
+     * \param numPoints The number of positions
+     * \param x The positions, numPoints elements
+     * \param result The function values, numPoints elements
+     * \param extrapolate See eval()
+     */
+    template <class Evaluation>
+    OPM_HOST_DEVICE void eval(std::size_t numPoints,
+                              const Evaluation* x,
+                              Evaluation* result,
+                              bool extrapolate = false) const
+    {
+        SegmentIndex hint{0};
+        for (std::size_t i = 0; i < numPoints; ++i) {
+            result[i] = evalWithHint(x[i], hint, extrapolate);
+        }
+    }
+
     /*!
      * \brief Evaluate the spline's derivative at a given position.
      *
@@ -290,7 +392,7 @@ public:
      *                    cause a failed assertation.
      */
     template <class Evaluation>
-    Evaluation evalDerivative(const Evaluation& x, bool extrapolate = false) const
+    OPM_HOST_DEVICE Evaluation evalDerivative(const Evaluation& x, bool extrapolate = false) const
     {
         size_t segIdx = findSegmentIndex(x, extrapolate).value;
         return evalDerivative_(x, segIdx);
@@ -311,7 +413,7 @@ public:
      *                    cause a failed assertation.
      */
     template <class Evaluation>
-    Evaluation evalSecondDerivative(const Evaluation&, bool = false) const
+    OPM_HOST_DEVICE Evaluation evalSecondDerivative(const Evaluation&, bool = false) const
     { return 0.0; }
 
     /*!
@@ -329,7 +431,7 @@ public:
      *                    cause a failed assertation.
      */
     template <class Evaluation>
-    Evaluation evalThirdDerivative(const Evaluation&, bool = false) const
+    OPM_HOST_DEVICE Evaluation evalThirdDerivative(const Evaluation&, bool = false) const
     { return 0.0; }
 
     /*!
@@ -426,83 +528,153 @@ public:
     */
     void printCSV(Scalar xi0, Scalar xi1, unsigned k, std::ostream& os) const;
 
-    bool operator==(const Tabulated1DFunction<Scalar>& data) const {
+    bool operator==(const Tabulated1DFunction& data) const {
         return xValues_ == data.xValues_ &&
                yValues_ == data.yValues_;
     }
 
     template <class Evaluation>
-    SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate = false) const
+    OPM_HOST_DEVICE SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate = false) const
     {
-        if (!isfinite(x)) {
-            throw std::runtime_error("We can not search for extrapolation/interpolation "
-                                     "segment in an 1D table for non-finite value " +
-                                     std::to_string(getValue(x)) + " .");
+        checkArgument_(x, extrapolate);
+
+        if (x <= xValues_[1])
+            return SegmentIndex{0};
+        else if (x >= xValues_[xValues_.size() - 2])
+            return SegmentIndex{xValues_.size() - 2};
+        else
+            return SegmentIndex{interiorSegment_(getValue(x))};
+    }
+
+    /*!
+     * \brief Find the segment containing x, starting the search at a hint.
+     *
+     * The hint's segment and its neighbours are tried before falling back
+     * to a full search. The result is the same as that of
+     * findSegmentIndex(x, extrapolate).
+     */
+    template <class Evaluation>
+    OPM_HOST_DEVICE SegmentIndex findSegmentIndex(const Evaluation& x,
+                                                  SegmentIndex hint,
+                                                  bool extrapolate = false) const
+    {
+        checkArgument_(x, extrapolate);
+
+        const size_t n = xValues_.size();
+        if (x <= xValues_[1])
+            return SegmentIndex{0};
+        else if (x >= xValues_[n - 2])
+            return SegmentIndex{n - 2};
+        else if (uniformSpacing())
+            return SegmentIndex{interiorSegment_(getValue(x))};
+
+        // Here x lies within (x_1, x_{n-2}), hence n >= 4.
+        const size_t idx = std::clamp(hint.value, size_t{1}, n - 3);
+        if (x < xValues_[idx]) {
+            if (x >= xValues_[idx - 1])
+                return SegmentIndex{idx - 1};
         }
+        else if (x < xValues_[idx + 1])
+            return SegmentIndex{idx};
+        else if (x < xValues_[idx + 2])
+            return SegmentIndex{idx + 1};
+
+        return SegmentIndex{interiorSegment_(getValue(x))};
+    }
+
+private:
+    Tabulated1DFunction(const ContainerT& x, const ContainerT& y, Scalar inverseSpacing)
+        : xValues_(x)
+        , yValues_(y)
+        , invDx_(inverseSpacing)
+    {}
+
+    // The error reporting is kept out of line to leave the segment lookup
+    // small enough for inlining.  Exceptions are not available in device
+    // code, where the checks are assertions.
+    template <class Evaluation>
+    OPM_HOST_DEVICE void checkArgument_(const Evaluation& x,
+                                        [[maybe_unused]] bool extrapolate) const
+    {
+#if OPM_IS_INSIDE_DEVICE_FUNCTION
+        assert(isfinite(x));
+        assert(extrapolate || applies(x));
+        assert(numSamples() >= 2);
+#else
+        if (!isfinite(x))
+            detail::throwTabulated1DNonFinite<Scalar>(getValue(x));
 
         if (!extrapolate && !applies(x))
             throw std::logic_error("Trying to evaluate a tabulated function outside of its range");
 
         // we need at least two sampling points!
-        if (numSamples() < 2) {
-            throw std::logic_error("We need at least two sampling points to "
-                                   "do interpolation/extrapolation, "
-                                   "and the table only contains " +
-                                   std::to_string(numSamples()) +
-                                   " sampling points");
+        if (numSamples() < 2)
+            detail::throwTabulated1DTooFewSamples(numSamples());
+#endif
+    }
+
+    // Segment containing x, for x within (x_1, x_{n-2}).  The segment is
+    // [x_i, x_{i+1}) for both the direct computation and the bisection.
+    template <class ValueType>
+    OPM_HOST_DEVICE size_t interiorSegment_(const ValueType& x) const
+    {
+        if (uniformSpacing()) {
+            size_t idx = static_cast<size_t>((x - xValues_[0])*invDx_);
+            idx = std::clamp(idx, size_t{1}, xValues_.size() - 3);
+
+            // correct for rounding in the index computation
+            if (x < xValues_[idx])
+                --idx;
+            else if (x >= xValues_[idx + 1])
+                ++idx;
+
+            return idx;
         }
 
-        if (x <= xValues_[1])
-            return SegmentIndex{0};
-        else if (x >= xValues_[xValues_.size() - 2])
-            return SegmentIndex{xValues_.size() - 2};
-        else {
-            // bisection
-            size_t lowerIdx = 1;
-            size_t upperIdx = xValues_.size() - 2;
-            while (lowerIdx + 1 < upperIdx) {
-                size_t pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (x < xValues_[pivotIdx])
-                    upperIdx = pivotIdx;
-                else
-                    lowerIdx = pivotIdx;
-            }
-
-            if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
-                std::string msg = "Problematic interpolation/extrapolation "
-                                  "segment is found for the input value " +
-                                  std::to_string(Opm::getValue(x)) +
-                                  "\nthe lower index of the found segment is " +
-                                  std::to_string(lowerIdx) +
-                                  ", the size of the table is " +
-                                  std::to_string(numSamples()) +
-                                  ",\nand the end values of the found segment are " +
-                                  std::to_string(xValues_[lowerIdx]) +
-                                  " and " +
-                                  std::to_string(xValues_[lowerIdx + 1]) +
-                                  ", respectively.\n";
-                msg += "Outputting the problematic table for more information "
-                       "(with *** marking the found segment):";
-                for (size_t i = 0; i < numSamples(); ++i) {
-                    if (i % 10 == 0)
-                        msg += "\n";
-                    if (i == lowerIdx)
-                        msg += " ***";
-                    msg += " " + std::to_string(xValues_[i]);
-                    if (i == lowerIdx + 1)
-                        msg += " ***";
-                }
-                msg += "\n";
-                OpmLog::debug(msg);
-                throw std::runtime_error(msg);
-            }
-            return SegmentIndex{lowerIdx};
+        // bisection
+        size_t lowerIdx = 1;
+        size_t upperIdx = xValues_.size() - 2;
+        while (lowerIdx + 1 < upperIdx) {
+            size_t pivotIdx = (lowerIdx + upperIdx) / 2;
+            if (x < xValues_[pivotIdx])
+                upperIdx = pivotIdx;
+            else
+                lowerIdx = pivotIdx;
         }
+
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1])
+            detail::throwTabulated1DBadSegment<Scalar>(x, lowerIdx, &xValues_[0], numSamples());
+#endif
+
+        return lowerIdx;
+    }
+
+    // Detect equally spaced sampling points.  The tolerance only decides
+    // whether the direct segment computation is used; its result is
+    // corrected against the sampling points either way.
+    void updateSpacing_()
+    {
+        invDx_ = 0;
+
+        const size_t n = numSamples();
+        if (n < 4)
+            return;
+
+        const Scalar dx = (xValues_[n - 1] - xValues_[0])/(n - 1);
+        if (!(dx > 0))
+            return;
+
+        for (size_t i = 1; i < n - 1; ++i) {
+            if (std::abs(xValues_[i] - (xValues_[0] + i*dx)) > 1e-6*dx)
+                return;
+        }
+
+        invDx_ = 1/dx;
     }
 
-private:
     template <class Evaluation>
-    Evaluation evalDerivative_(const Evaluation& x, size_t segIdx) const
+    OPM_HOST_DEVICE Evaluation evalDerivative_(const Evaluation& x, size_t segIdx) const
     {
 
         Scalar x0 = xValues_[segIdx];
@@ -551,14 +723,14 @@ private:
      */
     struct ComparatorX_
     {
-        explicit ComparatorX_(const std::vector<Scalar>& x)
+        explicit ComparatorX_(const ContainerT& x)
             : x_(x)
         {}
 
         bool operator ()(size_t idxA, size_t idxB) const
         { return x_.at(idxA) < x_.at(idxB); }
 
-        const std::vector<Scalar>& x_;
+        const ContainerT& x_;
     };
 
     /*!
@@ -611,10 +783,44 @@ private:
         yValues_.resize(nSamples);
     }
 
-    std::vector<Scalar> xValues_;
-    std::vector<Scalar> yValues_;
+    ContainerT xValues_;
+    ContainerT yValues_;
+
+    // inverse sampling interval if the sampling points are equally
+    // spaced, zero otherwise
+    Scalar invDx_{0};
 };
 
 } // namespace Opm
 
+namespace Opm::gpuistl {
+
+    template <class Scalar, class GPUContainer>
+    Tabulated1DFunction<Scalar, GPUContainer>
+    move_to_gpu(const Tabulated1DFunction<Scalar>& tab)
+    {
+        return Tabulated1DFunction<Scalar, GPUContainer>::
+            fromSortedSamples(GPUContainer(tab.xValues()),
+                              GPUContainer(tab.yValues()),
+                              tab.inverseSpacing());
+    }
+
+    template <class ViewType, class Scalar, class ContainerType>
+    Tabulated1DFunction<Scalar, ViewType>
+    make_view(const Tabulated1DFunction<Scalar, ContainerType>& tab)
+    {
+        using containedType = typename ContainerType::value_type;
+        using viewedTypeNoConst = typename std::remove_const_t<typename ViewType::value_type>;
+
+        static_assert(std::is_same_v<containedType, viewedTypeNoConst>);
+
+        ViewType xValues = make_view<viewedTypeNoConst>(tab.xValues());
+        ViewType yValues = make_view<viewedTypeNoConst>(tab.yValues());
+
+        return Tabulated1DFunction<Scalar, ViewType>::
+            fromSortedSamples(xValues, yValues, tab.inverseSpacing());
+    }
+
+} // namespace Opm::gpuistl
+
 #endif
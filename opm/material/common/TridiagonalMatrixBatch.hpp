@@ -0,0 +1,182 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::TridiagonalMatrixBatch
+ */
+#ifndef OPM_TRIDIAGONAL_MATRIX_BATCH_HH
+#define OPM_TRIDIAGONAL_MATRIX_BATCH_HH
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief A set of tridiagonal matrices of equal size which are solved
+ *        together.
+ *
+ * Entry (rowIdx, sysIdx) of each diagonal is stored at
+ * rowIdx*numSystems() + sysIdx, i.e., the systems are interleaved. The
+ * forward and backward sweeps of the Thomas algorithm thus run over
+ * contiguous memory for all systems at once, which lets the compiler
+ * vectorize them. This pays off when many small systems need to be solved,
+ * e.g., when setting up the coefficients of a large number of splines.
+ *
+ * Unlike TridiagonalMatrix, the entries in the upper right and lower left
+ * corners are not supported, and no pivoting is done, so the matrices should
+ * be diagonally dominant.
+ */
+template <class Scalar>
+class TridiagonalMatrixBatch
+{
+public:
+    explicit TridiagonalMatrixBatch(std::size_t numSystems = 0, std::size_t numRows = 0)
+    {
+        resize(numSystems, numRows);
+    }
+
+    /*!
+     * \brief Return the number of matrices.
+     */
+    std::size_t numSystems() const
+    { return numSystems_; }
+
+    /*!
+     * \brief Return the number of rows/columns of each matrix.
+     */
+    std::size_t size() const
+    { return numRows_; }
+
+    /*!
+     * \brief Change the number and the size of the matrices.
+     *
+     * All entries are set to zero.
+     */
+    void resize(std::size_t numSystems, std::size_t numRows)
+    {
+        numSystems_ = numSystems;
+        numRows_ = numRows;
+        for (auto& diag : diag_)
+            diag.assign(numSystems*numRows, 0.0);
+    }
+
+    /*!
+     * \brief The entry left of the diagonal, i.e., (rowIdx, rowIdx - 1).
+     *
+     * The entry of the first row is ignored.
+     */
+    Scalar& lower(std::size_t rowIdx, std::size_t sysIdx)
+    { return diag_[0][index_(rowIdx, sysIdx)]; }
+
+    Scalar lower(std::size_t rowIdx, std::size_t sysIdx) const
+    { return diag_[0][index_(rowIdx, sysIdx)]; }
+
+    /*!
+     * \brief The entry on the diagonal, i.e., (rowIdx, rowIdx).
+     */
+    Scalar& diagonal(std::size_t rowIdx, std::size_t sysIdx)
+    { return diag_[1][index_(rowIdx, sysIdx)]; }
+
+    Scalar diagonal(std::size_t rowIdx, std::size_t sysIdx) const
+    { return diag_[1][index_(rowIdx, sysIdx)]; }
+
+    /*!
+     * \brief The entry right of the diagonal, i.e., (rowIdx, rowIdx + 1).
+     *
+     * The entry of the last row is ignored.
+     */
+    Scalar& upper(std::size_t rowIdx, std::size_t sysIdx)
+    { return diag_[2][index_(rowIdx, sysIdx)]; }
+
+    Scalar upper(std::size_t rowIdx, std::size_t sysIdx) const
+    { return diag_[2][index_(rowIdx, sysIdx)]; }
+
+    /*!
+     * \brief Solve A_s x_s = b_s for all systems s.
+     *
+     * Both b and x are stored interleaved like the matrix entries, i.e., the
+     * entry of row i of system s is at i*numSystems() + s. x may be the same
+     * object as b.
+     */
+    template <class XVector, class BVector>
+    void solve(XVector& x, const BVector& b) const
+    {
+        const std::size_t m = numSystems_;
+        const std::size_t n = numRows_;
+        if (static_cast<std::size_t>(b.size()) != n*m)
+            throw std::invalid_argument("Right hand side does not match the size of the matrix batch");
+        if (n == 0)
+            return;
+
+        std::vector<Scalar> upperStar(n*m);
+        std::vector<Scalar> bStar(n*m);
+
+        const Scalar* lowerDiag = diag_[0].data();
+        const Scalar* mainDiag = diag_[1].data();
+        const Scalar* upperDiag = diag_[2].data();
+        Scalar* cp = upperStar.data();
+        Scalar* dp = bStar.data();
+
+        // forward elimination
+        for (std::size_t s = 0; s < m; ++s) {
+            const Scalar inv = 1.0/mainDiag[s];
+            cp[s] = upperDiag[s]*inv;
+            dp[s] = b[s]*inv;
+        }
+        for (std::size_t i = 1; i < n; ++i) {
+            const std::size_t row = i*m;
+            const std::size_t prev = row - m;
+            for (std::size_t s = 0; s < m; ++s) {
+                const Scalar inv = 1.0/(mainDiag[row + s] - lowerDiag[row + s]*cp[prev + s]);
+                cp[row + s] = upperDiag[row + s]*inv;
+                dp[row + s] = (b[row + s] - lowerDiag[row + s]*dp[prev + s])*inv;
+            }
+        }
+
+        // backward substitution
+        x.resize(n*m);
+        const std::size_t last = (n - 1)*m;
+        for (std::size_t s = 0; s < m; ++s)
+            x[last + s] = dp[last + s];
+        for (std::size_t i = n - 1; i-- > 0; ) {
+            const std::size_t row = i*m;
+            const std::size_t next = row + m;
+            for (std::size_t s = 0; s < m; ++s)
+                x[row + s] = dp[row + s] - cp[row + s]*x[next + s];
+        }
+    }
+
+private:
+    std::size_t index_(std::size_t rowIdx, std::size_t sysIdx) const
+    { return rowIdx*numSystems_ + sysIdx; }
+
+    std::size_t numSystems_{0};
+    std::size_t numRows_{0};
+    std::vector<Scalar> diag_[3];
+};
+
+} // namespace Opm
+
+#endif
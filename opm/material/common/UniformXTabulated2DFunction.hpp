@@ -35,6 +35,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <tuple>
@@ -49,6 +50,10 @@ namespace Opm {
  * "Uniform on the X-axis" means that all Y sampling points must be located along a line
  * for this value. This class can be used when the sampling points are calculated at run
  * time.
+ *
+ * Besides the sampling points given by samples(), the Y coordinates and values of all
+ * columns are kept in two contiguous arrays, one column after the other, which are used
+ * for the evaluation.
  */
 template <class Scalar>
 class UniformXTabulated2DFunction
@@ -84,7 +89,15 @@ public:
         , xPos_(xPos)
         , yPos_(yPos)
         , interpolationGuide_(interpolationGuide)
-    { }
+    {
+        for (const auto& col : samples_) {
+            for (const auto& point : col) {
+                yValues_.push_back(std::get<1>(point));
+                values_.push_back(std::get<2>(point));
+            }
+            colStart_.push_back(yValues_.size());
+        }
+    }
 
     /*!
      * \brief Returns the minimum of the X coordinate of the sampling points.
@@ -108,13 +121,13 @@ public:
      * \brief Returns the value of the Y coordinate of a sampling point.
      */
     Scalar yAt(size_t i, size_t j) const
-    { return std::get<1>(samples_[i][j]); }
+    { return yValues_[colStart_[i] + j]; }
 
     /*!
      * \brief Returns the value of a sampling point.
      */
     Scalar valueAt(size_t i, size_t j) const
-    { return std::get<2>(samples_[i][j]); }
+    { return values_[colStart_[i] + j]; }
 
     /*!
      * \brief Returns the number of sampling points in X direction.
@@ -237,24 +250,25 @@ public:
                            [[maybe_unused]] bool extrapolate = false) const
     {
         assert(xSampleIdx < numX());
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
+        const Scalar* colY = yValues_.data() + colStart_[xSampleIdx];
+        const unsigned colSize = colStart_[xSampleIdx + 1] - colStart_[xSampleIdx];
 
-        assert(colSamplePoints.size() >= 2);
+        assert(colSize >= 2);
         assert(extrapolate || (yMin(xSampleIdx) <= y && y <= yMax(xSampleIdx)));
 
-        if (y <= std::get<1>(colSamplePoints[1]))
+        if (y <= colY[1])
             return 0;
-        else if (y >= std::get<1>(colSamplePoints[colSamplePoints.size() - 2]))
-            return colSamplePoints.size() - 2;
+        else if (y >= colY[colSize - 2])
+            return colSize - 2;
         else {
-            assert(colSamplePoints.size() >= 3);
+            assert(colSize >= 3);
 
             // bisection
             unsigned lowerIdx = 1;
-            unsigned upperIdx = colSamplePoints.size() - 2;
+            unsigned upperIdx = colSize - 2;
             while (lowerIdx + 1 < upperIdx) {
                 unsigned pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (y < std::get<1>(colSamplePoints[pivotIdx]))
+                if (y < colY[pivotIdx])
                     upperIdx = pivotIdx;
                 else
                     lowerIdx = pivotIdx;
@@ -276,10 +290,8 @@ public:
         assert(xSampleIdx < numX());
         assert(ySegmentIdx < numY(xSampleIdx) - 1);
 
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
-
-        Scalar y1 = std::get<1>(colSamplePoints[ySegmentIdx]);
-        Scalar y2 = std::get<1>(colSamplePoints[ySegmentIdx + 1]);
+        Scalar y1 = yAt(xSampleIdx, ySegmentIdx);
+        Scalar y2 = yAt(xSampleIdx, ySegmentIdx + 1);
 
         return (y - y1)/(y2 - y1);
     }
@@ -324,6 +336,29 @@ public:
         return eval(i, j1, j2, alpha, beta1, beta2);
     }
 
+    /*!
+     * \brief Evaluate the function at an array of (x,y) positions.
+     *
+     * The results are the same as those of eval(x[k], y[k], extrapolate).
+     *
+     * \param numPoints The number of positions
+     * \param x The x coordinates, numPoints elements
+     * \param y The y coordinates, numPoints elements
+     * \param result The function values, numPoints elements
+     * \param extrapolate See eval()
+     */
+    template <class Evaluation>
+    void eval(std::size_t numPoints,
+              const Evaluation* x,
+              const Evaluation* y,
+              Evaluation* result,
+              bool extrapolate = false) const
+    {
+        for (std::size_t k = 0; k < numPoints; ++k) {
+            result[k] = eval(x[k], y[k], extrapolate);
+        }
+    }
+
     template <class Evaluation>
     void findPoints(unsigned& i,
                     unsigned& j1,
@@ -420,6 +455,7 @@ public:
             xPos_.push_back(nextX);
             yPos_.push_back(std::numeric_limits<Scalar>::lowest() / 2);
             samples_.push_back({});
+            colStart_.push_back(colStart_.back());
             return xPos_.size() - 1;
         }
         else if (xPos_.front() > nextX) {
@@ -427,6 +463,7 @@ public:
             xPos_.insert(xPos_.begin(), nextX);
             yPos_.insert(yPos_.begin(), std::numeric_limits<Scalar>::lowest() / 2);
             samples_.insert(samples_.begin(), std::vector<SamplePoint>());
+            colStart_.insert(colStart_.begin(), 0);
             return 0;
         }
         throw std::invalid_argument("Sampling points should be specified either monotonically "
@@ -444,6 +481,7 @@ public:
         Scalar x = iToX(i);
         if (samples_[i].empty() || std::get<1>(samples_[i].back()) < y) {
             samples_[i].push_back(SamplePoint(x, y, value));
+            insertFlatPoint_(i, colStart_[i + 1], y, value);
             if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
                 yPos_[i] = y;
             }
@@ -452,6 +490,7 @@ public:
         else if (std::get<1>(samples_[i].front()) > y) {
             // slow, but we still don't care...
             samples_[i].insert(samples_[i].begin(), SamplePoint(x, y, value));
+            insertFlatPoint_(i, colStart_[i], y, value);
             if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
                 yPos_[i] = y;
             }
@@ -478,11 +517,27 @@ public:
     }
 
 private:
+    // insert a point into column i of the contiguous arrays at position pos
+    void insertFlatPoint_(size_t i, size_t pos, Scalar y, Scalar value)
+    {
+        yValues_.insert(yValues_.begin() + pos, y);
+        values_.insert(values_.begin() + pos, value);
+        for (size_t k = i + 1; k < colStart_.size(); ++k) {
+            ++colStart_[k];
+        }
+    }
+
     // the vector which contains the values of the sample points
     // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
     // instead!
     std::vector<std::vector<SamplePoint> > samples_;
 
+    // the Y coordinates and values of the sample points, column by column;
+    // column i occupies the range [colStart_[i], colStart_[i + 1])
+    std::vector<Scalar> yValues_;
+    std::vector<Scalar> values_;
+    std::vector<size_t> colStart_ = std::vector<size_t>(1, 0);
+
     // the position of each vertical line on the x-axis
     std::vector<Scalar> xPos_;
     // the position on the y-axis of the guide point
@@ -44,6 +44,7 @@
 
 #include <cmath>
 #include <cassert>
+#include <cstddef>
 
 namespace Opm {
 
@@ -829,6 +830,76 @@ public:
         return Common::viscosity(temperature, rho);
     }
 
+    /*!
+     * \brief The density \f$\mathrm{[kg/m^3]}\f$, the specific enthalpy
+     *        \f$\mathrm{[J/kg]}\f$ and the dynamic viscosity \f$\mathrm{[Pa*s]}\f$
+     *        of liquid water at the same pressure and temperature.
+     *
+     * The results are the same as the ones of liquidDensity(), liquidEnthalpy() and
+     * liquidViscosity() up to round-off, but the vapor pressure and the derivatives
+     * of the Gibbs free energy are only evaluated once for all three quantities.
+     *
+     * \param temperature Absolute temperature of the fluid in \f$\mathrm{[K]}\f$
+     * \param pressure Phase pressure in \f$\mathrm{[Pa]}\f$
+     * \param density Receives the density of the liquid
+     * \param enthalpy Receives the specific enthalpy of the liquid
+     * \param viscosity Receives the dynamic viscosity of the liquid
+     */
+    template <class Evaluation>
+    static void liquidProperties(const Evaluation& temperature,
+                                 const Evaluation& pressure,
+                                 Evaluation& density,
+                                 Evaluation& enthalpy,
+                                 Evaluation& viscosity)
+    {
+        if (!Region1::isValid(temperature, pressure))
+        {
+            throw NumericalProblem(domainError("Properties of water",
+                                               temperature,
+                                               pressure));
+        }
+
+        const Evaluation pv = vaporPressure(temperature);
+        if (pressure < pv) {
+            // the regularized quantities are rarely needed, so simply defer
+            // to the individual methods
+            density = liquidDensity(temperature, pressure);
+            enthalpy = liquidEnthalpy(temperature, pressure);
+        }
+        else {
+            Evaluation dgamma_dtau;
+            Evaluation dgamma_dpi;
+            Region1::dgamma(temperature, pressure, dgamma_dtau, dgamma_dpi);
+
+            const Evaluation RT = Rs*temperature;
+            density = pressure/(Region1::pi(pressure)*dgamma_dpi*RT);
+            enthalpy = Region1::tau(temperature)*dgamma_dtau*RT;
+        }
+
+        viscosity = Common::viscosity(temperature, density);
+    }
+
+    /*!
+     * \brief The density, specific enthalpy and dynamic viscosity of liquid water
+     *        for a batch of pressure and temperature pairs.
+     *
+     * \copydetails liquidProperties()
+     *
+     * \param n The number of pressure and temperature pairs
+     */
+    template <class Evaluation>
+    static void liquidProperties(std::size_t n,
+                                 const Evaluation* temperature,
+                                 const Evaluation* pressure,
+                                 Evaluation* density,
+                                 Evaluation* enthalpy,
+                                 Evaluation* viscosity)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            liquidProperties(temperature[i], pressure[i],
+                             density[i], enthalpy[i], viscosity[i]);
+    }
+
     /*!
      * \brief Thermal conductivity \f$\mathrm{[[W/(m K)]}\f$ of water (IAPWS) .
      *
@@ -28,11 +28,23 @@
 #ifndef OPM_TABULATED_COMPONENT_HPP
 #define OPM_TABULATED_COMPONENT_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include <unistd.h>
+
+#include <opm/io/eclipse/MappedFile.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 
 namespace Opm {
@@ -72,38 +84,19 @@ public:
     static void init(Scalar tempMin, Scalar tempMax, unsigned nTemp,
                      Scalar pressMin, Scalar pressMax, unsigned nPress)
     {
-        tempMin_ = tempMin;
-        tempMax_ = tempMax;
-        nTemp_ = nTemp;
-        pressMin_ = pressMin;
-        pressMax_ = pressMax;
-        nPress_ = nPress;
-        nDensity_ = nPress_;
+        setRanges_(tempMin, tempMax, nTemp, pressMin, pressMax, nPress);
 
         // allocate the arrays
-        vaporPressure_ = new Scalar[nTemp_];
-        minGasDensity__ = new Scalar[nTemp_];
-        maxGasDensity__ = new Scalar[nTemp_];
-        minLiquidDensity__ = new Scalar[nTemp_];
-        maxLiquidDensity__ = new Scalar[nTemp_];
-
-        gasEnthalpy_ = new Scalar[nTemp_*nPress_];
-        liquidEnthalpy_ = new Scalar[nTemp_*nPress_];
-        gasHeatCapacity_ = new Scalar[nTemp_*nPress_];
-        liquidHeatCapacity_ = new Scalar[nTemp_*nPress_];
-        gasDensity_ = new Scalar[nTemp_*nPress_];
-        liquidDensity_ = new Scalar[nTemp_*nPress_];
-        gasViscosity_ = new Scalar[nTemp_*nPress_];
-        liquidViscosity_ = new Scalar[nTemp_*nPress_];
-        gasThermalConductivity_ = new Scalar[nTemp_*nPress_];
-        liquidThermalConductivity_ = new Scalar[nTemp_*nPress_];
-        gasPressure_ = new Scalar[nTemp_*nDensity_];
-        liquidPressure_ = new Scalar[nTemp_*nDensity_];
+        mappedTables_.reset();
+        storage_.assign(tableSize_(nTemp_, nPress_), Scalar{0});
+        setTables_(storage_.data());
 
         assert(std::numeric_limits<Scalar>::has_quiet_NaN);
         Scalar NaN = std::numeric_limits<Scalar>::quiet_NaN();
 
-        // fill the temperature-pressure arrays
+        // fill the temperature-pressure arrays. the temperatures are
+        // independent of each other, so they can be tabulated concurrently
+#pragma omp parallel for schedule(dynamic)
         for (unsigned iT = 0; iT < nTemp_; ++ iT) {
             Scalar temperature = iT * (tempMax_ - tempMin_)/(nTemp_ - 1) + tempMin_;
 
@@ -159,56 +152,107 @@ public:
             }
         }
 
-        // fill the temperature-density arrays
+        // fill the temperature-density arrays. exceptions must not escape
+        // the parallel region, so the first one is passed on afterwards
+        std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic)
         for (unsigned iT = 0; iT < nTemp_; ++ iT) {
-            Scalar temperature = iT * (tempMax_ - tempMin_)/(nTemp_ - 1) + tempMin_;
+            try {
+                Scalar temperature = iT * (tempMax_ - tempMin_)/(nTemp_ - 1) + tempMin_;
+
+                // calculate the minimum and maximum values for the gas
+                // densities
+                minGasDensity__[iT] = RawComponent::gasDensity(temperature, minGasPressure_(iT));
+                if (iT < nTemp_ - 1)
+                    maxGasDensity__[iT] = RawComponent::gasDensity(temperature, maxGasPressure_(iT + 1));
+                else
+                    maxGasDensity__[iT] = RawComponent::gasDensity(temperature, maxGasPressure_(iT));
+
+                // fill the temperature, density gas arrays
+                for (unsigned iRho = 0; iRho < nDensity_; ++ iRho) {
+                    Scalar density =
+                        Scalar(iRho)/(nDensity_ - 1) *
+                        (maxGasDensity__[iT] - minGasDensity__[iT])
+                        +
+                        minGasDensity__[iT];
+
+                    unsigned i = iT + iRho*nTemp_;
+
+                    try { gasPressure_[i] = RawComponent::gasPressure(temperature, density); }
+                    catch (const std::exception&) { gasPressure_[i] = NaN; };
+                };
+
+                // calculate the minimum and maximum values for the liquid
+                // densities
+                minLiquidDensity__[iT] = RawComponent::liquidDensity(temperature, minLiquidPressure_(iT));
+                if (iT < nTemp_ - 1)
+                    maxLiquidDensity__[iT] = RawComponent::liquidDensity(temperature, maxLiquidPressure_(iT + 1));
+                else
+                    maxLiquidDensity__[iT] = RawComponent::liquidDensity(temperature, maxLiquidPressure_(iT));
+
+                // fill the temperature, density liquid arrays
+                for (unsigned iRho = 0; iRho < nDensity_; ++ iRho) {
+                    Scalar density =
+                        Scalar(iRho)/(nDensity_ - 1) *
+                        (maxLiquidDensity__[iT] - minLiquidDensity__[iT])
+                        +
+                        minLiquidDensity__[iT];
+
+                    unsigned i = iT + iRho*nTemp_;
+
+                    try { liquidPressure_[i] = RawComponent::liquidPressure(temperature, density); }
+                    catch (const std::exception&) { liquidPressure_[i] = NaN; };
+                };
+            }
+            catch (...) {
+#pragma omp critical
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
 
-            // calculate the minimum and maximum values for the gas
-            // densities
-            minGasDensity__[iT] = RawComponent::gasDensity(temperature, minGasPressure_(iT));
-            if (iT < nTemp_ - 1)
-                maxGasDensity__[iT] = RawComponent::gasDensity(temperature, maxGasPressure_(iT + 1));
-            else
-                maxGasDensity__[iT] = RawComponent::gasDensity(temperature, maxGasPressure_(iT));
-
-            // fill the temperature, density gas arrays
-            for (unsigned iRho = 0; iRho < nDensity_; ++ iRho) {
-                Scalar density =
-                    Scalar(iRho)/(nDensity_ - 1) *
-                    (maxGasDensity__[iT] - minGasDensity__[iT])
-                    +
-                    minGasDensity__[iT];
-
-                unsigned i = iT + iRho*nTemp_;
-
-                try { gasPressure_[i] = RawComponent::gasPressure(temperature, density); }
-                catch (const std::exception&) { gasPressure_[i] = NaN; };
-            };
+        if (error)
+            std::rethrow_exception(error);
+    }
 
-            // calculate the minimum and maximum values for the liquid
-            // densities
-            minLiquidDensity__[iT] = RawComponent::liquidDensity(temperature, minLiquidPressure_(iT));
-            if (iT < nTemp_ - 1)
-                maxLiquidDensity__[iT] = RawComponent::liquidDensity(temperature, maxLiquidPressure_(iT + 1));
-            else
-                maxLiquidDensity__[iT] = RawComponent::liquidDensity(temperature, maxLiquidPressure_(iT));
-
-            // fill the temperature, density liquid arrays
-            for (unsigned iRho = 0; iRho < nDensity_; ++ iRho) {
-                Scalar density =
-                    Scalar(iRho)/(nDensity_ - 1) *
-                    (maxLiquidDensity__[iT] - minLiquidDensity__[iT])
-                    +
-                    minLiquidDensity__[iT];
-
-                unsigned i = iT + iRho*nTemp_;
-
-                try { liquidPressure_[i] = RawComponent::liquidPressure(temperature, density); }
-                catch (const std::exception&) { liquidPressure_[i] = NaN; };
-            };
+    /*!
+     * \brief Initialize the tables from a file which is shared between processes.
+     *
+     * If \c fileName holds tables for the same component and ranges, it is
+     * memory mapped read-only instead of recomputing the tables, so all
+     * processes using the same file share a single copy in memory.
+     * Otherwise the tables are computed by init() and written to the file
+     * first. The file is replaced atomically, so concurrent callers at worst
+     * compute the tables more than once. To build the tables only once in a
+     * parallel run, let one process call this method before the others.
+     *
+     * \param fileName The path of the table file
+     * \param tempMin The minimum of the temperature range in \f$\mathrm{[K]}\f$
+     * \param tempMax The maximum of the temperature range in \f$\mathrm{[K]}\f$
+     * \param nTemp The number of entries/steps within the temperature range
+     * \param pressMin The minimum of the pressure range in \f$\mathrm{[Pa]}\f$
+     * \param pressMax The maximum of the pressure range in \f$\mathrm{[Pa]}\f$
+     * \param nPress The number of entries/steps within the pressure range
+     */
+    static void initFromFile(const std::string& fileName,
+                             Scalar tempMin, Scalar tempMax, unsigned nTemp,
+                             Scalar pressMin, Scalar pressMax, unsigned nPress)
+    {
+        const auto header = makeHeader_(tempMin, tempMax, nTemp, pressMin, pressMax, nPress);
+        if (!attachTables_(fileName, header)) {
+            init(tempMin, tempMax, nTemp, pressMin, pressMax, nPress);
+            writeTables_(fileName, header);
+            if (!attachTables_(fileName, header))
+                throw std::runtime_error("Unable to use the tabulated component file " + fileName);
         }
     }
 
+    /*!
+     * \brief Returns true iff the tables are memory mapped from a file.
+     */
+    static bool usesMappedTables()
+    { return mappedTables_ != nullptr; }
+
     /*!
      * \brief A human readable name for the component.
      */
@@ -520,6 +564,126 @@ public:
     }
 
 private:
+    // leading record of a table file, followed by the tables in the order
+    // of setTables_()
+    struct TableFileHeader_
+    {
+        char magic[8];
+        std::uint64_t scalarSize;
+        std::uint64_t vaporPressureRange;
+        std::uint64_t nTemp;
+        std::uint64_t nPress;
+        double tempMin;
+        double tempMax;
+        double pressMin;
+        double pressMax;
+        char name[64];
+    };
+
+    static TableFileHeader_ makeHeader_(Scalar tempMin, Scalar tempMax, unsigned nTemp,
+                                        Scalar pressMin, Scalar pressMax, unsigned nPress)
+    {
+        TableFileHeader_ header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, "OPMTABC1", sizeof(header.magic));
+        header.scalarSize = sizeof(Scalar);
+        header.vaporPressureRange = useVaporPressure;
+        header.nTemp = nTemp;
+        header.nPress = nPress;
+        header.tempMin = tempMin;
+        header.tempMax = tempMax;
+        header.pressMin = pressMin;
+        header.pressMax = pressMax;
+
+        const auto componentName = RawComponent::name();
+        std::memcpy(header.name, componentName.data(),
+                    std::min(componentName.size(), sizeof(header.name) - 1));
+        return header;
+    }
+
+    static void setRanges_(Scalar tempMin, Scalar tempMax, unsigned nTemp,
+                           Scalar pressMin, Scalar pressMax, unsigned nPress)
+    {
+        tempMin_ = tempMin;
+        tempMax_ = tempMax;
+        nTemp_ = nTemp;
+        pressMin_ = pressMin;
+        pressMax_ = pressMax;
+        nPress_ = nPress;
+        nDensity_ = nPress_;
+    }
+
+    // number of values in all tables together
+    static std::size_t tableSize_(std::size_t nTemp, std::size_t nPress)
+    { return 5*nTemp + 12*nTemp*nPress; }
+
+    // points the individual tables into one contiguous block of tableSize_() values
+    static void setTables_(Scalar* data)
+    {
+        const auto take = [&data](std::size_t n) { Scalar* t = data; data += n; return t; };
+
+        vaporPressure_ = take(nTemp_);
+        minGasDensity__ = take(nTemp_);
+        maxGasDensity__ = take(nTemp_);
+        minLiquidDensity__ = take(nTemp_);
+        maxLiquidDensity__ = take(nTemp_);
+
+        gasEnthalpy_ = take(nTemp_*nPress_);
+        liquidEnthalpy_ = take(nTemp_*nPress_);
+        gasHeatCapacity_ = take(nTemp_*nPress_);
+        liquidHeatCapacity_ = take(nTemp_*nPress_);
+        gasDensity_ = take(nTemp_*nPress_);
+        liquidDensity_ = take(nTemp_*nPress_);
+        gasViscosity_ = take(nTemp_*nPress_);
+        liquidViscosity_ = take(nTemp_*nPress_);
+        gasThermalConductivity_ = take(nTemp_*nPress_);
+        liquidThermalConductivity_ = take(nTemp_*nPress_);
+        gasPressure_ = take(nTemp_*nDensity_);
+        liquidPressure_ = take(nTemp_*nDensity_);
+    }
+
+    // maps the tables of a file if it matches the header. returns false if
+    // the file does not exist or was written for something else.
+    static bool attachTables_(const std::string& fileName, const TableFileHeader_& header)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(fileName, ec))
+            return false;
+
+        auto mapped = std::make_shared<EclIO::MappedFile>(fileName);
+        if (mapped->size() < sizeof(header) ||
+            std::memcmp(mapped->data(), &header, sizeof(header)) != 0)
+            return false;
+
+        if (mapped->size() != sizeof(header) + tableSize_(header.nTemp, header.nPress)*sizeof(Scalar))
+            return false;
+
+        // the mapping is read-only, the tables are never written after init()
+        setRanges_(static_cast<Scalar>(header.tempMin), static_cast<Scalar>(header.tempMax),
+                   static_cast<unsigned>(header.nTemp),
+                   static_cast<Scalar>(header.pressMin), static_cast<Scalar>(header.pressMax),
+                   static_cast<unsigned>(header.nPress));
+        mappedTables_ = std::move(mapped);
+        storage_.clear();
+        storage_.shrink_to_fit();
+        setTables_(const_cast<Scalar*>(reinterpret_cast<const Scalar*>(mappedTables_->data() + sizeof(header))));
+        return true;
+    }
+
+    static void writeTables_(const std::string& fileName, const TableFileHeader_& header)
+    {
+        const std::string tmpName = fileName + ".tmp" + std::to_string(::getpid());
+        {
+            std::ofstream os(tmpName, std::ios::binary);
+            os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            os.write(reinterpret_cast<const char*>(storage_.data()),
+                     storage_.size()*sizeof(Scalar));
+            if (!os)
+                throw std::runtime_error("Unable to write tabulated component file " + tmpName);
+        }
+        std::filesystem::rename(tmpName, fileName);
+    }
+
     // returns an interpolated value depending on temperature
     template <class Evaluation>
     static Evaluation interpolateT_(const Scalar* values, const Evaluation& T)
@@ -808,6 +972,10 @@ private:
     static Scalar densityMin_;
     static Scalar densityMax_;
     static unsigned nDensity_;
+
+    // owner of the tables, either computed by this process or mapped from a file
+    static std::vector<Scalar> storage_;
+    static std::shared_ptr<EclIO::MappedFile> mappedTables_;
 };
 
 template <class Scalar, class RawComponent, bool useVaporPressure>
@@ -862,6 +1030,10 @@ template <class Scalar, class RawComponent, bool useVaporPressure>
 Scalar TabulatedComponent<Scalar, RawComponent, useVaporPressure>::densityMax_;
 template <class Scalar, class RawComponent, bool useVaporPressure>
 unsigned TabulatedComponent<Scalar, RawComponent, useVaporPressure>::nDensity_;
+template <class Scalar, class RawComponent, bool useVaporPressure>
+std::vector<Scalar> TabulatedComponent<Scalar, RawComponent, useVaporPressure>::storage_;
+template <class Scalar, class RawComponent, bool useVaporPressure>
+std::shared_ptr<EclIO::MappedFile> TabulatedComponent<Scalar, RawComponent, useVaporPressure>::mappedTables_;
 
 
 } // namespace Opm
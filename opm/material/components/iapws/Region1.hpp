@@ -29,6 +29,7 @@
 
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <array>
 #include <cmath>
 
 namespace Opm {
@@ -205,6 +206,55 @@ public:
         return result;
     }
 
+    /*!
+     * \brief The partial derivatives of the Gibbs free energy to the
+     *        normalized temperature and to the normalized pressure for
+     *        IAPWS region 1 (i.e. liquid) (dimensionless).
+     *
+     * This yields the same values as dgamma_dtau() and dgamma_dpi(), but
+     * both sums are evaluated in a single pass. The integer powers of the
+     * reduced quantities are shared between the terms and computed by
+     * repeated multiplication instead of calling pow() for each term.
+     *
+     * \param temperature temperature of component in \f$\mathrm{[K]}\f$
+     * \param pressure pressure of component in \f$\mathrm{[Pa]}\f$
+     * \param dgammaDtau receives the derivative to the normalized temperature
+     * \param dgammaDpi receives the derivative to the normalized pressure
+     */
+    template <class Evaluation>
+    static void dgamma(const Evaluation& temperature, const Evaluation& pressure,
+                       Evaluation& dgammaDtau, Evaluation& dgammaDpi)
+    {
+        const Evaluation x = 7.1 - pi(pressure);
+        const Evaluation y = tau(temperature) - 1.222;
+
+        // xPow[k + 1] = x^k for k in [-1, 32], yPow[k + 42] = y^k for k in [-42, 17]
+        std::array<Evaluation, 34> xPow;
+        std::array<Evaluation, 60> yPow;
+        xPow[0] = 1.0/x;
+        xPow[1] = 1.0;
+        for (int k = 2; k < 34; ++k)
+            xPow[k] = xPow[k - 1]*x;
+
+        const Evaluation yInv = 1.0/y;
+        yPow[42] = 1.0;
+        for (int k = 41; k >= 0; --k)
+            yPow[k] = yPow[k + 1]*yInv;
+        for (int k = 43; k < 60; ++k)
+            yPow[k] = yPow[k - 1]*y;
+
+        dgammaDtau = 0.0;
+        dgammaDpi = 0.0;
+        for (int i = 0; i < 34; ++i) {
+            const int Ii = static_cast<int>(I(i));
+            const int Ji = static_cast<int>(J(i));
+            if (Ji != 0)
+                dgammaDtau += (n(i)*Ji)*xPow[Ii + 1]*yPow[Ji - 1 + 42];
+            if (Ii != 0)
+                dgammaDpi -= (n(i)*Ii)*xPow[Ii]*yPow[Ji + 42];
+        }
+    }
+
     /*!
      * \brief The partial derivative of the Gibbs free energy to the
      *        normalized pressure and to the normalized temperature
@@ -29,6 +29,7 @@
 
 #include <opm/common/Exceptions.hpp>
 
+#include <opm/material/common/DenseMatrixBatch.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 #include <opm/material/common/Valgrind.hpp>
 
@@ -36,8 +37,12 @@
 #include <dune/common/fmatrix.hh>
 
 #include <cassert>
+#include <cstddef>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace Opm {
 
@@ -170,6 +175,131 @@ public:
             }
         }
 
+        throw NumericalProblem(failureMessage_(fluidState, phaseIdx, xInit, targetFug));
+    }
+
+    /*!
+     * \brief Calculates the chemical equilibrium from the component
+     *        fugacities in a phase for a batch of cells.
+     *
+     * The Newton iterations are the same as those of solve(), but the cells
+     * which have not converged yet are iterated in lock-step, and their linear
+     * systems are solved together by a DenseMatrixBatch. Like for solve(), the
+     * iterations start from the composition which is stored in the fluid
+     * states, so passing the result of the previous time step or Newton
+     * iteration of the caller warm-starts the solver.
+     *
+     * \param fluidStates The fluid states of the cells
+     * \param paramCaches The parameter caches of the cells
+     * \param phaseIdx The phase whose composition is calculated
+     * \param targetFugs The target fugacities of the components in each cell
+     */
+    template <class FluidState>
+    static void solveBatch(std::vector<FluidState>& fluidStates,
+                           std::vector<typename FluidSystem::template ParameterCache<typename FluidState::Scalar>>& paramCaches,
+                           unsigned phaseIdx,
+                           const std::vector<ComponentVector>& targetFugs)
+    {
+        assert (phaseIdx < static_cast<unsigned int>(FluidSystem::numPhases));
+
+        const std::size_t numCells = fluidStates.size();
+        if (paramCaches.size() != numCells || targetFugs.size() != numCells)
+            throw std::invalid_argument("CompositionFromFugacities: the number of fluid states, "
+                                        "parameter caches and target fugacities differ");
+
+        if (FluidSystem::isIdealMixture(phaseIdx)) {
+            for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx)
+                solveIdealMix_(fluidStates[cellIdx], paramCaches[cellIdx], phaseIdx, targetFugs[cellIdx]);
+            return;
+        }
+
+        // save initial compositions in case something goes wrong
+        std::vector<ComponentVector> xInit(numCells);
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            for (unsigned i = 0; i < numComponents; ++i)
+                xInit[cellIdx][i] = fluidStates[cellIdx].moleFraction(phaseIdx, i);
+            paramCaches[cellIdx].updatePhase(fluidStates[cellIdx], phaseIdx);
+        }
+
+        // the cells which have not converged yet
+        std::vector<std::size_t> active(numCells);
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx)
+            active[cellIdx] = cellIdx;
+
+        DenseMatrixBatch<Evaluation, numComponents> J;
+        std::vector<Evaluation> x;
+        std::vector<Evaluation> b;
+        std::vector<unsigned char> singular;
+        Dune::FieldMatrix<Evaluation, numComponents, numComponents> cellJ;
+        Dune::FieldVector<Evaluation, numComponents> cellX;
+        Dune::FieldVector<Evaluation, numComponents> cellB;
+
+        // maximum number of iterations
+        const int nMax = 25;
+        for (int nIdx = 0; nIdx < nMax && !active.empty(); ++nIdx) {
+            const std::size_t numActive = active.size();
+
+            // calculate the Jacobian matrices and right hand sides
+            J.resize(numActive);
+            b.resize(numComponents*numActive);
+            for (std::size_t k = 0; k < numActive; ++k) {
+                const std::size_t cellIdx = active[k];
+                linearize_(cellJ, cellB, fluidStates[cellIdx], paramCaches[cellIdx],
+                           phaseIdx, targetFugs[cellIdx]);
+                Valgrind::CheckDefined(cellJ);
+                Valgrind::CheckDefined(cellB);
+
+                J.setMatrix(k, cellJ);
+                for (unsigned i = 0; i < numComponents; ++i)
+                    b[i*numActive + k] = cellB[i];
+            }
+
+            // Solve J*x = b for all cells
+            J.solve(x, b, singular);
+
+            // update the fluid compositions and drop the converged cells
+            std::size_t numStillActive = 0;
+            for (std::size_t k = 0; k < numActive; ++k) {
+                const std::size_t cellIdx = active[k];
+                if (singular[k])
+                    throw NumericalProblem("Singular Jacobian while calculating the "
+                                           + std::string(FluidSystem::phaseName(phaseIdx))
+                                           + "Phase composition of cell " + std::to_string(cellIdx));
+
+                for (unsigned i = 0; i < numComponents; ++i)
+                    cellX[i] = x[i*numActive + k];
+                Valgrind::CheckDefined(cellX);
+
+                Scalar relError = update_(fluidStates[cellIdx], paramCaches[cellIdx], cellX, cellB,
+                                          phaseIdx, targetFugs[cellIdx]);
+
+                if (relError < 1e-9) {
+                    auto& fluidState = fluidStates[cellIdx];
+                    const Evaluation& rho = FluidSystem::density(fluidState, paramCaches[cellIdx], phaseIdx);
+                    fluidState.setDensity(phaseIdx, rho);
+                }
+                else
+                    active[numStillActive++] = cellIdx;
+            }
+            active.resize(numStillActive);
+        }
+
+        if (!active.empty()) {
+            const std::size_t cellIdx = active.front();
+            throw NumericalProblem("Cell " + std::to_string(cellIdx) + ": "
+                                   + failureMessage_(fluidStates[cellIdx], phaseIdx,
+                                                     xInit[cellIdx], targetFugs[cellIdx]));
+        }
+    }
+
+
+protected:
+    template <class FluidState>
+    static std::string failureMessage_(const FluidState& fluidState,
+                                       unsigned phaseIdx,
+                                       const ComponentVector& xInit,
+                                       const ComponentVector& targetFug)
+    {
         auto cast = [](const auto d)
         {
 #if HAVE_QUAD
@@ -191,11 +321,9 @@ public:
             msg += " " + std::to_string(cast(getValue(v)));
         msg += " }, p = " + std::to_string(cast(getValue(fluidState.pressure(phaseIdx))))
              + ", T = " + std::to_string(cast(getValue(fluidState.temperature(phaseIdx))));
-        throw NumericalProblem(msg);
+        return msg;
     }
 
-
-protected:
     // update the phase composition in case the phase is an ideal
     // mixture, i.e. the component's fugacity coefficients are
     // independent of the phase's composition.
@@ -43,11 +43,15 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <algorithm>
+#include <cassert>
 #include <limits>
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -69,6 +73,9 @@ class PTFlash
     static constexpr int numMisciblePhases = FluidSystem::numMisciblePhases; //oil, gas
     static constexpr int numEq = numMisciblePhases + numMisciblePhases * numMiscibleComponents;
 
+    using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
+    using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+
 public:
     /*!
      * \brief Calculates the fluid state from the global mole fractions of the components and the phase pressures
@@ -82,53 +89,22 @@ public:
                       int verbosity = 0)
     {
 
-        using InputEval = typename FluidState::Scalar;
-        using ComponentVector = Dune::FieldVector<typename FluidState::Scalar, numComponents>;
-
         // K and L from previous timestep (wilson and -1 initially)
-        ComponentVector K;
-        for(int compIdx = 0; compIdx < numComponents; ++compIdx) {
-            K[compIdx] = fluid_state.K(compIdx);
-        }
-        InputEval L;
-        // TODO: L has all the derivatives to be all ZEROs here.
-        L = fluid_state.L();
-
-        // Print header
-        if (verbosity >= 1) {
-            std::cout << "********" << std::endl;
-            std::cout << "Inputs are K = [" << K << "], L = [" << L << "], z = [" << z << "], P = " << fluid_state.pressure(0) << ", and T = " << fluid_state.temperature(0) << std::endl;
-        }
-
-        using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
-        Scalar L_scalar = Opm::getValue(L);
         ScalarVector z_scalar;
         ScalarVector K_scalar;
-        for (unsigned i = 0; i < numComponents; ++i) {
-            z_scalar[i] = Opm::getValue(z[i]);
-            K_scalar[i] = Opm::getValue(K[i]);
-        }
-        using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+        Scalar L_scalar;
         ScalarFluidState fluid_state_scalar;
+        prepareScalarFlash_(fluid_state, z, z_scalar, K_scalar, L_scalar, fluid_state_scalar);
 
-        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            fluid_state_scalar.setMoleFraction(oilPhaseIdx, compIdx, Opm::getValue(fluid_state.moleFraction(oilPhaseIdx, compIdx)));
-            fluid_state_scalar.setMoleFraction(gasPhaseIdx, compIdx, Opm::getValue(fluid_state.moleFraction(gasPhaseIdx, compIdx)));
-            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx)));
+        // Print header
+        if (verbosity >= 1) {
+            std::cout << "********" << std::endl;
+            std::cout << "Inputs are K = [" << K_scalar << "], L = [" << L_scalar << "], z = [" << z << "], P = " << fluid_state.pressure(0) << ", and T = " << fluid_state.temperature(0) << std::endl;
         }
 
-        fluid_state_scalar.setLvalue(L_scalar);
-        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
-        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
-        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
-
-        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
-
         // Do a stability test to check if cell is is_single_phase-phase (do for all cells the first time).
         bool is_stable = false;
-        if ( L <= 0 || L == 1 ) {
+        if ( L_scalar <= 0 || L_scalar == 1 ) {
              if (verbosity >= 1) {
                  std::cout << "Perform stability test (L <= 0 or L == 1)!" << std::endl;
              }
@@ -150,30 +126,88 @@ public:
             // Cell is one-phase. Use Li's phase labeling method to see if it's liquid or vapor
             L_scalar = li_single_phase_label_(fluid_state_scalar, z_scalar, verbosity);
         }
-        fluid_state_scalar.setLvalue(L_scalar);
 
         // Print footer
         if (verbosity >= 1) {
             std::cout << "********" << std::endl;
         }
 
-        // the flash solution process were performed in scalar form, after the flash calculation finishes,
-        // ensure that things in fluid_state_scalar is transformed to fluid_state
-        for (int compIdx=0; compIdx<numComponents; ++compIdx){
-                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
-                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        finishScalarFlash_(fluid_state_scalar, z, K_scalar, L_scalar, is_single_phase, fluid_state);
+    }//end solve
+
+    /*!
+     * \brief Calculates the fluid states of a block of cells from their global mole
+     *        fractions and phase pressures.
+     *
+     * The result is the same as calling the single cell version of solve() for each
+     * cell, but the Rachford-Rice equations of all two-phase cells are solved in
+     * lock-step on component-major arrays. Like the single cell version, the K-values
+     * and L stored in the fluid states (i.e., the ones of the previous time step) are
+     * used as the initial guess.
+     */
+    template <class FluidState>
+    static void solve(std::vector<FluidState>& fluid_states,
+                      const std::vector<Dune::FieldVector<typename FluidState::Scalar, numComponents>>& z,
+                      const std::string& twoPhaseMethod,
+                      Scalar /*tolerance = -1.*/,
+                      int verbosity = 0)
+    {
+        const std::size_t numCells = fluid_states.size();
+        if (z.size() != numCells) {
+            throw std::invalid_argument(fmt::format("PTFlash: got {} global compositions for {} cells",
+                                                    z.size(), numCells));
         }
 
-        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            fluid_state.setKvalue(compIdx, K_scalar[compIdx]);
-            fluid_state_scalar.setKvalue(compIdx, K_scalar[compIdx]);
+        std::vector<ScalarVector> z_scalar(numCells);
+        std::vector<ScalarVector> K_scalar(numCells);
+        std::vector<Scalar> L_scalar(numCells);
+        std::vector<ScalarFluidState> fluid_state_scalar(numCells);
+        std::vector<char> is_single_phase(numCells, false);
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            prepareScalarFlash_(fluid_states[cellIdx], z[cellIdx], z_scalar[cellIdx],
+                                K_scalar[cellIdx], L_scalar[cellIdx], fluid_state_scalar[cellIdx]);
+            if (L_scalar[cellIdx] <= 0 || L_scalar[cellIdx] == 1) {
+                bool is_stable = false;
+                phaseStabilityTest_(is_stable, K_scalar[cellIdx], fluid_state_scalar[cellIdx],
+                                    z_scalar[cellIdx], verbosity);
+                is_single_phase[cellIdx] = is_stable;
+            }
         }
-        fluid_state.setLvalue(L_scalar);
-        // we update the derivatives in fluid_state
-        updateDerivatives_(fluid_state_scalar, z, fluid_state, is_single_phase);
-    }//end solve
+
+        // Rachford Rice equation to get initial L for composition solver of all
+        // two-phase cells
+        std::vector<std::size_t> twoPhaseCells;
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            if (!is_single_phase[cellIdx])
+                twoPhaseCells.push_back(cellIdx);
+        }
+        const std::size_t numTwoPhase = twoPhaseCells.size();
+        std::vector<Scalar> K_soa(numComponents * numTwoPhase);
+        std::vector<Scalar> z_soa(numComponents * numTwoPhase);
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            for (std::size_t i = 0; i < numTwoPhase; ++i) {
+                K_soa[compIdx * numTwoPhase + i] = K_scalar[twoPhaseCells[i]][compIdx];
+                z_soa[compIdx * numTwoPhase + i] = z_scalar[twoPhaseCells[i]][compIdx];
+            }
+        }
+        std::vector<Scalar> L_twoPhase(numTwoPhase);
+        solveRachfordRiceBatch_(K_soa, z_soa, L_twoPhase, verbosity);
+        for (std::size_t i = 0; i < numTwoPhase; ++i) {
+            L_scalar[twoPhaseCells[i]] = L_twoPhase[i];
+        }
+
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            if (!is_single_phase[cellIdx]) {
+                flash_2ph(z_scalar[cellIdx], twoPhaseMethod, K_scalar[cellIdx], L_scalar[cellIdx],
+                          fluid_state_scalar[cellIdx], verbosity);
+            } else {
+                // Cell is one-phase. Use Li's phase labeling method to see if it's liquid or vapor
+                L_scalar[cellIdx] = li_single_phase_label_(fluid_state_scalar[cellIdx], z_scalar[cellIdx], verbosity);
+            }
+            finishScalarFlash_(fluid_state_scalar[cellIdx], z[cellIdx], K_scalar[cellIdx], L_scalar[cellIdx],
+                               is_single_phase[cellIdx], fluid_states[cellIdx]);
+        }
+    }
 
     /*!
      * \brief Calculates the chemical equilibrium from the component
@@ -331,6 +365,106 @@ public:
         throw std::runtime_error(" Rachford-Rice bisection failed with " + std::to_string(max_it) + " iterations!");
     }
 
+    /*!
+     * \brief Solves the Rachford-Rice equation for a batch of cells in lock-step.
+     *
+     * K and z are stored component-major, i.e., the value of component compIdx in
+     * cell cellIdx is found at compIdx*numCells + cellIdx, so that the innermost
+     * loops run over the cells. The Newton iterations are identical to the ones of
+     * solveRachfordRice_g_(). Cells for which an update leaves the admissible
+     * interval are solved by bisection afterwards.
+     */
+    static void solveRachfordRiceBatch_(const std::vector<Scalar>& K,
+                                        const std::vector<Scalar>& z,
+                                        std::vector<Scalar>& L,
+                                        int verbosity)
+    {
+        constexpr Scalar tol = 1e-12;
+        constexpr int itmax = 10000;
+        const std::size_t numCells = L.size();
+        assert(K.size() == numComponents * numCells);
+        assert(z.size() == numComponents * numCells);
+
+        std::vector<Scalar> Vmin(numCells);
+        std::vector<Scalar> Vmax(numCells);
+        std::vector<Scalar> V(numCells);
+        std::vector<Scalar> r(numCells);
+        std::vector<Scalar> denum(numCells);
+        // 0: iterating, 1: converged, 2: needs bisection
+        std::vector<unsigned char> status(numCells, 0);
+
+        // Lower and upper bound for solution from the minimum and maximum K-values
+        {
+            std::vector<Scalar> Kmin(K.begin(), K.begin() + numCells);
+            std::vector<Scalar> Kmax(Kmin);
+            for (int compIdx = 1; compIdx < numComponents; ++compIdx) {
+                const Scalar* Kc = K.data() + compIdx * numCells;
+                for (std::size_t i = 0; i < numCells; ++i) {
+                    if (Kc[i] < Kmin[i])
+                        Kmin[i] = Kc[i];
+                    else if (Kc[i] >= Kmax[i])
+                        Kmax[i] = Kc[i];
+                }
+            }
+            for (std::size_t i = 0; i < numCells; ++i) {
+                Vmin[i] = 1 / (1 - Kmax[i]);
+                Vmax[i] = 1 / (1 - Kmin[i]);
+                V[i] = (Vmin[i] + Vmax[i])/2;
+            }
+        }
+
+        // Newton-Raphson loop
+        std::size_t numIterating = numCells;
+        for (int iteration = 1; iteration < itmax && numIterating > 0; ++iteration) {
+            std::fill(r.begin(), r.end(), 0.0);
+            std::fill(denum.begin(), denum.end(), 0.0);
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const Scalar* Kc = K.data() + compIdx * numCells;
+                const Scalar* zc = z.data() + compIdx * numCells;
+                for (std::size_t i = 0; i < numCells; ++i) {
+                    const Scalar dK = Kc[i] - 1.0;
+                    const Scalar a = zc[i] * dK;
+                    const Scalar b = (1 + V[i] * dK);
+                    r[i] += a/b;
+                    denum[i] += zc[i] * (dK*dK) / (b*b);
+                }
+            }
+
+            for (std::size_t i = 0; i < numCells; ++i) {
+                if (status[i] != 0)
+                    continue;
+
+                V[i] += r[i] / denum[i];
+                if (V[i] < Vmin[i] || V[i] > Vmax[i]) {
+                    status[i] = 2;
+                    --numIterating;
+                }
+                else if (Opm::abs(r[i]) < tol) {
+                    L[i] = 1 - V[i];
+                    status[i] = 1;
+                    --numIterating;
+                }
+            }
+        }
+
+        if (numIterating > 0) {
+            throw std::runtime_error(" Rachford-Rice did not converge within maximum number of iterations" );
+        }
+
+        for (std::size_t i = 0; i < numCells; ++i) {
+            if (status[i] != 2)
+                continue;
+
+            ScalarVector Kcell;
+            ScalarVector zcell;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                Kcell[compIdx] = K[compIdx * numCells + i];
+                zcell[compIdx] = z[compIdx * numCells + i];
+            }
+            L[i] = bisection_g_(Kcell, Scalar{1.0}, Scalar{0.0}, zcell, verbosity);
+        }
+    }
+
     template <class Vector, class FlashFluidState>
     static typename Vector::field_type li_single_phase_label_(const FlashFluidState& fluid_state, const Vector& z, int verbosity)
     {
@@ -426,6 +560,65 @@ public:
     }
 
 protected:
+    template <class FluidState, class ComponentVector>
+    static void prepareScalarFlash_(const FluidState& fluid_state,
+                                    const ComponentVector& z,
+                                    ScalarVector& z_scalar,
+                                    ScalarVector& K_scalar,
+                                    Scalar& L_scalar,
+                                    ScalarFluidState& fluid_state_scalar)
+    {
+        // TODO: L has all the derivatives to be all ZEROs here.
+        L_scalar = Opm::getValue(fluid_state.L());
+        for (unsigned i = 0; i < numComponents; ++i) {
+            z_scalar[i] = Opm::getValue(z[i]);
+            K_scalar[i] = Opm::getValue(fluid_state.K(i));
+        }
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state_scalar.setMoleFraction(oilPhaseIdx, compIdx, Opm::getValue(fluid_state.moleFraction(oilPhaseIdx, compIdx)));
+            fluid_state_scalar.setMoleFraction(gasPhaseIdx, compIdx, Opm::getValue(fluid_state.moleFraction(gasPhaseIdx, compIdx)));
+            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx)));
+        }
+
+        fluid_state_scalar.setLvalue(L_scalar);
+        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
+        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
+        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+
+        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+    }
+
+    template <class FluidState, class ComponentVector>
+    static void finishScalarFlash_(ScalarFluidState& fluid_state_scalar,
+                                   const ComponentVector& z,
+                                   const ScalarVector& K_scalar,
+                                   const Scalar L_scalar,
+                                   const bool is_single_phase,
+                                   FluidState& fluid_state)
+    {
+        fluid_state_scalar.setLvalue(L_scalar);
+
+        // the flash solution process were performed in scalar form, after the flash calculation finishes,
+        // ensure that things in fluid_state_scalar is transformed to fluid_state
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
+                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        }
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state.setKvalue(compIdx, K_scalar[compIdx]);
+            fluid_state_scalar.setKvalue(compIdx, K_scalar[compIdx]);
+        }
+        fluid_state.setLvalue(L_scalar);
+        // we update the derivatives in fluid_state
+        updateDerivatives_(fluid_state_scalar, z, fluid_state, is_single_phase);
+    }
+
 
     template <class FlashFluidState>
     static typename FlashFluidState::Scalar wilsonK_(const FlashFluidState& fluid_state, int compIdx)
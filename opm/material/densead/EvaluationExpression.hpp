@@ -0,0 +1,342 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Opt-in expression templates for the localized OPM automatic
+ *        differentiation (AD) framework.
+ *
+ * The operators of DenseAd::Evaluation return by value, so a chained expression like
+ * a*b + c/d creates one temporary Evaluation per operator and passes over the
+ * derivatives once for each of them. Wrapping the Evaluation operands with lazy()
+ * instead builds a light-weight expression object which only computes the values of
+ * its sub-expressions. evaluate() then computes all derivatives of the whole
+ * expression in a single pass:
+ *
+ * \code
+ * using Opm::DenseAd::lazy;
+ * const Eval r = evaluate(lazy(invB) * (1.0 - lazy(Rs)*lazy(Bg)));
+ * \endcode
+ *
+ * The operands of an expression are held by reference, so an expression must be
+ * evaluated within the full-expression which creates it, and all Evaluation operands
+ * must be wrapped with lazy().
+ * The result is a regular Evaluation, i.e., it works with MathToolbox and all
+ * specializations of the Evaluation class. Up to rounding, it is the same as that of
+ * the corresponding eager expression.
+ */
+#ifndef OPM_LOCAL_AD_EVALUATION_EXPRESSION_HPP
+#define OPM_LOCAL_AD_EVALUATION_EXPRESSION_HPP
+
+#include "Evaluation.hpp"
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <opm/common/utility/gpuDecorators.hpp>
+
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief Base class of all expression templates.
+ */
+template <class Implementation>
+struct Expression
+{
+    OPM_HOST_DEVICE const Implementation& asImp_() const
+    { return *static_cast<const Implementation*>(this); }
+};
+
+/*!
+ * \brief An Evaluation used as the operand of an expression.
+ */
+template <class Eval>
+class ExpressionLeaf : public Expression<ExpressionLeaf<Eval>>
+{
+public:
+    typedef Eval EvalType;
+    typedef typename Eval::ValueType ValueType;
+
+    OPM_HOST_DEVICE explicit ExpressionLeaf(const Eval& eval)
+        : eval_(&eval)
+    {}
+
+    OPM_HOST_DEVICE const Eval& leaf() const
+    { return *eval_; }
+
+    OPM_HOST_DEVICE const ValueType& value() const
+    { return eval_->value(); }
+
+    OPM_HOST_DEVICE const ValueType& derivative(int varIdx) const
+    { return eval_->derivative(varIdx); }
+
+private:
+    const Eval* eval_;
+};
+
+/*!
+ * \brief A function of one sub-expression, i.e., f(a)' = factor*a'.
+ *
+ * This also covers the operators which have a scalar operand.
+ */
+template <class Arg>
+class UnaryExpression : public Expression<UnaryExpression<Arg>>
+{
+public:
+    typedef typename Arg::EvalType EvalType;
+    typedef typename Arg::ValueType ValueType;
+
+    OPM_HOST_DEVICE UnaryExpression(const Arg& arg, const ValueType& value, const ValueType& factor)
+        : arg_(arg)
+        , value_(value)
+        , factor_(factor)
+    {}
+
+    OPM_HOST_DEVICE const EvalType& leaf() const
+    { return arg_.leaf(); }
+
+    OPM_HOST_DEVICE const ValueType& value() const
+    { return value_; }
+
+    OPM_HOST_DEVICE ValueType derivative(int varIdx) const
+    { return factor_*arg_.derivative(varIdx); }
+
+private:
+    Arg arg_;
+    ValueType value_;
+    ValueType factor_;
+};
+
+/*!
+ * \brief A function of two sub-expressions, i.e., f(a, b)' = factorA*a' + factorB*b'.
+ */
+template <class Arg1, class Arg2>
+class BinaryExpression : public Expression<BinaryExpression<Arg1, Arg2>>
+{
+    static_assert(std::is_same_v<typename Arg1::EvalType, typename Arg2::EvalType>,
+                  "The operands of an expression must be of the same Evaluation type");
+
+public:
+    typedef typename Arg1::EvalType EvalType;
+    typedef typename Arg1::ValueType ValueType;
+
+    OPM_HOST_DEVICE BinaryExpression(const Arg1& arg1, const Arg2& arg2,
+                                     const ValueType& value,
+                                     const ValueType& factor1, const ValueType& factor2)
+        : arg1_(arg1)
+        , arg2_(arg2)
+        , value_(value)
+        , factor1_(factor1)
+        , factor2_(factor2)
+    {}
+
+    OPM_HOST_DEVICE const EvalType& leaf() const
+    { return arg1_.leaf(); }
+
+    OPM_HOST_DEVICE const ValueType& value() const
+    { return value_; }
+
+    OPM_HOST_DEVICE ValueType derivative(int varIdx) const
+    { return factor1_*arg1_.derivative(varIdx) + factor2_*arg2_.derivative(varIdx); }
+
+private:
+    Arg1 arg1_;
+    Arg2 arg2_;
+    ValueType value_;
+    ValueType factor1_;
+    ValueType factor2_;
+};
+
+//! \brief Use an Evaluation as the operand of an expression.
+template <class ValueType, int numVars, unsigned staticSize>
+OPM_HOST_DEVICE ExpressionLeaf<Evaluation<ValueType, numVars, staticSize>>
+lazy(const Evaluation<ValueType, numVars, staticSize>& eval)
+{ return ExpressionLeaf<Evaluation<ValueType, numVars, staticSize>>(eval); }
+
+//! \brief Compute the value and all derivatives of an expression in a single pass.
+template <class Implementation>
+OPM_HOST_DEVICE typename Implementation::EvalType evaluate(const Expression<Implementation>& expr)
+{
+    const Implementation& e = expr.asImp_();
+
+    auto result = Implementation::EvalType::createBlank(e.leaf());
+    result.setValue(e.value());
+    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+        result.setDerivative(curVarIdx, e.derivative(curVarIdx));
+
+    return result;
+}
+
+namespace detail {
+
+template <class T>
+using EnableIfScalar = std::enable_if_t<std::is_arithmetic_v<T>, int>;
+
+} // namespace detail
+
+// operators of two expressions
+template <class Arg1, class Arg2>
+OPM_HOST_DEVICE BinaryExpression<Arg1, Arg2> operator+(const Expression<Arg1>& a, const Expression<Arg2>& b)
+{
+    const Arg1& u = a.asImp_();
+    const Arg2& v = b.asImp_();
+    return BinaryExpression<Arg1, Arg2>(u, v, u.value() + v.value(), 1.0, 1.0);
+}
+
+template <class Arg1, class Arg2>
+OPM_HOST_DEVICE BinaryExpression<Arg1, Arg2> operator-(const Expression<Arg1>& a, const Expression<Arg2>& b)
+{
+    const Arg1& u = a.asImp_();
+    const Arg2& v = b.asImp_();
+    return BinaryExpression<Arg1, Arg2>(u, v, u.value() - v.value(), 1.0, -1.0);
+}
+
+template <class Arg1, class Arg2>
+OPM_HOST_DEVICE BinaryExpression<Arg1, Arg2> operator*(const Expression<Arg1>& a, const Expression<Arg2>& b)
+{
+    // (u*v)' = v*u' + u*v'
+    const Arg1& u = a.asImp_();
+    const Arg2& v = b.asImp_();
+    return BinaryExpression<Arg1, Arg2>(u, v, u.value()*v.value(), v.value(), u.value());
+}
+
+template <class Arg1, class Arg2>
+OPM_HOST_DEVICE BinaryExpression<Arg1, Arg2> operator/(const Expression<Arg1>& a, const Expression<Arg2>& b)
+{
+    // (u/v)' = u'/v - (u/v)/v*v'
+    const Arg1& u = a.asImp_();
+    const Arg2& v = b.asImp_();
+    const auto& quotient = u.value()/v.value();
+    return BinaryExpression<Arg1, Arg2>(u, v, quotient, 1.0/v.value(), -quotient/v.value());
+}
+
+// operators of an expression and a scalar
+template <class Arg>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator-(const Expression<Arg>& a)
+{ return UnaryExpression<Arg>(a.asImp_(), -a.asImp_().value(), -1.0); }
+
+template <class Arg, class Scalar, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator+(const Expression<Arg>& a, const Scalar& b)
+{ return UnaryExpression<Arg>(a.asImp_(), a.asImp_().value() + b, 1.0); }
+
+template <class Scalar, class Arg, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator+(const Scalar& a, const Expression<Arg>& b)
+{ return UnaryExpression<Arg>(b.asImp_(), a + b.asImp_().value(), 1.0); }
+
+template <class Arg, class Scalar, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator-(const Expression<Arg>& a, const Scalar& b)
+{ return UnaryExpression<Arg>(a.asImp_(), a.asImp_().value() - b, 1.0); }
+
+template <class Scalar, class Arg, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator-(const Scalar& a, const Expression<Arg>& b)
+{ return UnaryExpression<Arg>(b.asImp_(), a - b.asImp_().value(), -1.0); }
+
+template <class Arg, class Scalar, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator*(const Expression<Arg>& a, const Scalar& b)
+{ return UnaryExpression<Arg>(a.asImp_(), a.asImp_().value()*b, b); }
+
+template <class Scalar, class Arg, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator*(const Scalar& a, const Expression<Arg>& b)
+{ return UnaryExpression<Arg>(b.asImp_(), a*b.asImp_().value(), a); }
+
+template <class Arg, class Scalar, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator/(const Expression<Arg>& a, const Scalar& b)
+{ return UnaryExpression<Arg>(a.asImp_(), a.asImp_().value()/b, 1.0/b); }
+
+template <class Scalar, class Arg, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> operator/(const Scalar& a, const Expression<Arg>& b)
+{
+    // (c/v)' = -(c/v)/v*v'
+    const auto& v = b.asImp_().value();
+    const auto& quotient = a/v;
+    return UnaryExpression<Arg>(b.asImp_(), quotient, -quotient/v);
+}
+
+// algebraic functions, see Math.hpp for the corresponding functions of Evaluations
+template <class Arg>
+OPM_HOST_DEVICE UnaryExpression<Arg> sqrt(const Expression<Arg>& x)
+{
+    typedef MathToolbox<typename Arg::ValueType> ValueTypeToolbox;
+
+    const auto& sqrt_x = ValueTypeToolbox::sqrt(x.asImp_().value());
+    return UnaryExpression<Arg>(x.asImp_(), sqrt_x, 0.5/sqrt_x);
+}
+
+template <class Arg>
+OPM_HOST_DEVICE UnaryExpression<Arg> exp(const Expression<Arg>& x)
+{
+    typedef MathToolbox<typename Arg::ValueType> ValueTypeToolbox;
+
+    const auto& exp_x = ValueTypeToolbox::exp(x.asImp_().value());
+    return UnaryExpression<Arg>(x.asImp_(), exp_x, exp_x);
+}
+
+template <class Arg>
+OPM_HOST_DEVICE UnaryExpression<Arg> log(const Expression<Arg>& x)
+{
+    typedef MathToolbox<typename Arg::ValueType> ValueTypeToolbox;
+
+    const auto& x_ = x.asImp_().value();
+    return UnaryExpression<Arg>(x.asImp_(), ValueTypeToolbox::log(x_), 1.0/x_);
+}
+
+// exponentiation of an expression with a fixed constant
+template <class Arg, class Scalar, detail::EnableIfScalar<Scalar> = 0>
+OPM_HOST_DEVICE UnaryExpression<Arg> pow(const Expression<Arg>& base, const Scalar& exp)
+{
+    typedef MathToolbox<typename Arg::ValueType> ValueTypeToolbox;
+
+    const auto& x = base.asImp_().value();
+    if (x == 0.0) {
+        // same special case as for Evaluations
+        return UnaryExpression<Arg>(base.asImp_(), 0.0, 0.0);
+    }
+
+    const auto& pow_x = ValueTypeToolbox::pow(x, exp);
+    return UnaryExpression<Arg>(base.asImp_(), pow_x, pow_x/x*exp);
+}
+
+// exponentiation of two expressions
+template <class Arg1, class Arg2>
+OPM_HOST_DEVICE BinaryExpression<Arg1, Arg2> pow(const Expression<Arg1>& base, const Expression<Arg2>& exp)
+{
+    typedef MathToolbox<typename Arg1::ValueType> ValueTypeToolbox;
+
+    const auto& f = base.asImp_().value();
+    if (f == 0.0) {
+        // same special case as for Evaluations
+        return BinaryExpression<Arg1, Arg2>(base.asImp_(), exp.asImp_(), 0.0, 0.0, 0.0);
+    }
+
+    const auto& g = exp.asImp_().value();
+    const auto& valuePow = ValueTypeToolbox::pow(f, g);
+    return BinaryExpression<Arg1, Arg2>(base.asImp_(), exp.asImp_(), valuePow,
+                                        g/f*valuePow, ValueTypeToolbox::log(f)*valuePow);
+}
+
+} // namespace DenseAd
+} // namespace Opm
+
+#endif // OPM_LOCAL_AD_EVALUATION_EXPRESSION_HPP
@@ -438,13 +438,17 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
 
         // use the chain rule for the derivatives. since both, the base and the exponent can
         // potentially depend on the variable set, calculating these is quite elaborate...
+        //
+        // the factors are computed once so that the loop over the derivatives only
+        // consists of multiplications and additions.
         const ValueType& f = base.value();
         const ValueType& g = exp.value();
-        const ValueType& logF = ValueTypeToolbox::log(f);
+        const ValueType& dfFactor = g/f*valuePow;
+        const ValueType& dgFactor = ValueTypeToolbox::log(f)*valuePow;
         for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
             const ValueType& fPrime = base.derivative(curVarIdx);
             const ValueType& gPrime = exp.derivative(curVarIdx);
-            result.setDerivative(curVarIdx, (g*fPrime/f + logF*gPrime) * valuePow);
+            result.setDerivative(curVarIdx, dfFactor*fPrime + dgFactor*gPrime);
         }
     }
 
@@ -183,27 +183,29 @@ public:
         // compressibility factor is <= 0.0. (this means that if we
         // would get negative molar volumes for the liquid phase, we
         // consider the liquid phase non-existant.)
-        Evaluation Z[3] = {0.0,0.0,0.0};
+        Evaluation Zmin = 0.0;
+        Evaluation Zmax = 0.0;
         Valgrind::CheckDefined(a1);
         Valgrind::CheckDefined(a2);
         Valgrind::CheckDefined(a3);
         Valgrind::CheckDefined(a4);
 
-        int numSol = cubicRoots(Z, a1, a2, a3, a4);
+        // only the liquid and the vapor root are required
+        int numSol = cubicExtremeRoots(Zmin, Zmax, a1, a2, a3, a4);
         if (numSol == 3) {
             // the EOS has three intersections with the pressure,
             // i.e. the molar volume of gas is the largest one and the
             // molar volume of liquid is the smallest one
             if (isGasPhase)
-                Vm = max(1e-7, Z[2]*RT/p);
+                Vm = max(1e-7, Zmax*RT/p);
             else
-                Vm = max(1e-7, Z[0]*RT/p);
+                Vm = max(1e-7, Zmin*RT/p);
         }
         else if (numSol == 1) {
             // the EOS only has one intersection with the pressure,
             // for the other phase, we take the extremum of the EOS
             // with the largest distance from the intersection.
-            Evaluation VmCubic = max(1e-7, Z[0]*RT/p);
+            Evaluation VmCubic = max(1e-7, Zmin*RT/p);
             Vm = VmCubic;
 
             if (UseLegacy) {
@@ -24,44 +24,95 @@
 #ifndef OPM_DIRECTIONAL_MATERIAL_LAW_PARAMS_HH
 #define OPM_DIRECTIONAL_MATERIAL_LAW_PARAMS_HH
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 
 namespace Opm {
 
+/// Material law parameters of the cells in the X, Y and Z directions.
+///
+/// Without hysteresis most cells use the unscaled end points of their
+/// KRNUMX/Y/Z region, so the parameter objects are held in a pool and each
+/// cell and direction stores the index of its object.  Cells which need
+/// their own parameters, e.g. because of end point scaling or hysteresis,
+/// get a separate pool entry.  References to pool entries stay valid when
+/// entries are added.
 template <class MaterialLawParams>
-struct DirectionalMaterialLawParams {
-    using vector_type = std::vector<MaterialLawParams>;
-    DirectionalMaterialLawParams()
-        : materialLawParamsX_{}
-        , materialLawParamsY_{}
-        , materialLawParamsZ_{}
-    {}
+class DirectionalMaterialLawParams
+{
+public:
+    DirectionalMaterialLawParams() = default;
 
     explicit DirectionalMaterialLawParams(std::size_t size)
-        : materialLawParamsX_(size)
-        , materialLawParamsY_(size)
-        , materialLawParamsZ_(size)
+        : index_{ std::vector<std::uint32_t>(size),
+                  std::vector<std::uint32_t>(size),
+                  std::vector<std::uint32_t>(size) }
     {}
 
-    vector_type& getArray(int index)
+    /// Parameters of a cell, dirIdx being 0, 1, 2 for X, Y and Z.
+    const MaterialLawParams& get(int dirIdx, std::size_t elemIdx) const
+    {
+        return pool_[this->indices(dirIdx)[elemIdx]];
+    }
+
+    MaterialLawParams& get(int dirIdx, std::size_t elemIdx)
+    {
+        return pool_[this->indices(dirIdx)[elemIdx]];
+    }
+
+    /// Add a default constructed parameter object to the pool and return
+    /// its index.
+    std::size_t add()
+    {
+        if (pool_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("Too many directional material law parameter objects");
+        }
+        pool_.emplace_back();
+        return pool_.size() - 1;
+    }
+
+    /// Parameter object with index poolIdx as returned by add().
+    MaterialLawParams& pooled(std::size_t poolIdx)
+    {
+        return pool_[poolIdx];
+    }
+
+    /// Let a cell use the parameter object with index poolIdx.
+    void assign(int dirIdx, std::size_t elemIdx, std::size_t poolIdx)
+    {
+        this->indices(dirIdx)[elemIdx] = static_cast<std::uint32_t>(poolIdx);
+    }
+
+    /// Number of distinct parameter objects.
+    std::size_t numParams() const
+    {
+        return pool_.size();
+    }
+
+private:
+    std::deque<MaterialLawParams> pool_{};
+    std::array<std::vector<std::uint32_t>, 3> index_{};
+
+    const std::vector<std::uint32_t>& indices(int dirIdx) const
     {
-        switch(index) {
-            case 0:
-                return materialLawParamsX_;
-            case 1:
-                return materialLawParamsY_;
-            case 2:
-                return materialLawParamsZ_;
-            default:
-                throw std::runtime_error("Unexpected mobility array index");
+        if (dirIdx < 0 || dirIdx > 2) {
+            throw std::runtime_error("Unexpected mobility array index");
         }
+        return index_[dirIdx];
     }
 
-    vector_type materialLawParamsX_;
-    vector_type materialLawParamsY_;
-    vector_type materialLawParamsZ_;
+    std::vector<std::uint32_t>& indices(int dirIdx)
+    {
+        if (dirIdx < 0 || dirIdx > 2) {
+            throw std::runtime_error("Unexpected mobility array index");
+        }
+        return index_[dirIdx];
+    }
 };
 
 } // namespace Opm
@@ -24,8 +24,70 @@
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.hpp>
+#include <opm/input/eclipse/EclipseState/Runspec.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/JFunc.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <opm/material/common/Means.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    // Unscaled end point of each saturation region which a cell uses if
+    // the keyword does not apply to it.  Must match the values assigned in
+    // EclEpsScalingPointsInfo<>::extractUnscaled().
+    const std::vector<double>&
+    regionValues(const std::string&                      keyword,
+                 const Opm::satfunc::RawTableEndPoints&  rtep,
+                 const Opm::satfunc::RawFunctionValues&  rfunc)
+    {
+        using Values = std::pair<const char*, const std::vector<double>*>;
+        const auto values = std::array {
+            Values { "SWL",   &rtep.connate.water },
+            Values { "SGL",   &rtep.connate.gas },
+            Values { "SWCR",  &rtep.critical.water },
+            Values { "SGCR",  &rtep.critical.gas },
+            Values { "SOWCR", &rtep.critical.oil_in_water },
+            Values { "SOGCR", &rtep.critical.oil_in_gas },
+            Values { "SWU",   &rtep.maximum.water },
+            Values { "SGU",   &rtep.maximum.gas },
+            Values { "PCW",   &rfunc.pc.w },
+            Values { "PCG",   &rfunc.pc.g },
+            Values { "KRW",   &rfunc.krw.max },
+            Values { "KRWR",  &rfunc.krw.r },
+            Values { "KRO",   &rfunc.kro.max },
+            Values { "KRORG", &rfunc.kro.rg },
+            Values { "KRORW", &rfunc.kro.rw },
+            Values { "KRG",   &rfunc.krg.max },
+            Values { "KRGR",  &rfunc.krg.r },
+        };
+
+        for (const auto& [name, regionVals] : values) {
+            if (keyword == name) {
+                return *regionVals;
+            }
+        }
+
+        throw std::invalid_argument {
+            "Keyword " + keyword + " is not an end point scaling keyword"
+        };
+    }
+
+} // Anonymous namespace
 
 Opm::EclEpsGridProperties::
 EclEpsGridProperties(const EclipseState& eclState,
@@ -33,18 +95,74 @@ EclEpsGridProperties(const EclipseState& eclState,
 {
     const auto& fp = eclState.fieldProps();
 
-    auto try_get = [&fp, kwPrefix = useImbibition ? "I" : ""]
-        (const std::string& keyword)
-    {
-        return fp.has_double(kwPrefix + keyword)
-            ? &fp.get_double(kwPrefix + keyword)
-            : nullptr;
-    };
-
     this->satnum_ = useImbibition
         ? &fp.get_int("IMBNUM")
         : &fp.get_int("SATNUM");
 
+    // The unscaled end points are only needed if at least one keyword is
+    // present, so they are computed on first use.
+    struct RegionEndPoints
+    {
+        satfunc::RawTableEndPoints rtep;
+        satfunc::RawFunctionValues rfunc;
+    };
+
+    auto endPoints = std::optional<RegionEndPoints>{};
+    auto regionEndPoints = [&eclState, &endPoints]() -> const RegionEndPoints&
+    {
+        if (! endPoints.has_value()) {
+            const auto& runspec = eclState.runspec();
+            const auto tolcrit = runspec.saturationFunctionControls()
+                .minimumRelpermMobilityThreshold();
+
+            auto rtep = satfunc::getRawTableEndpoints(eclState.getTableManager(),
+                                                      runspec.phases(), tolcrit);
+            auto rfunc = satfunc::getRawFunctionValues(eclState.getTableManager(),
+                                                       runspec.phases(), rtep);
+
+            endPoints.emplace(RegionEndPoints { std::move(rtep), std::move(rfunc) });
+        }
+
+        return *endPoints;
+    };
+
+    // Most cells typically use the end points of their saturation region,
+    // which FieldProps fills in for all cells not explicitly assigned.
+    // Only refer to the cells whose values differ from those so that the
+    // caller can keep the region's unscaled values for all others.
+    auto try_get = [&fp, &regionEndPoints, satnum = this->satnum_,
+                    kwPrefix = std::string { useImbibition ? "I" : "" }]
+        (const std::string& keyword)
+    {
+        auto array = SatfuncArray{};
+        if (! fp.has_double(kwPrefix + keyword)) {
+            return array;
+        }
+
+        const auto& values = fp.get_double(kwPrefix + keyword);
+        const auto& [rtep, rfunc] = regionEndPoints();
+        const auto& regionVals = regionValues(keyword, rtep, rfunc);
+
+        auto overridden = std::vector<bool>(values.size(), true);
+        auto numOverridden = values.size();
+        for (auto cell = 0*values.size(); cell < values.size(); ++cell) {
+            const auto region = static_cast<std::size_t>((*satnum)[cell] - 1);
+            if ((region < regionVals.size()) && (values[cell] == regionVals[region])) {
+                overridden[cell] = false;
+                --numOverridden;
+            }
+        }
+
+        if (numOverridden > 0) {
+            array.values = &values;
+            if (numOverridden < values.size()) {
+                array.overridden = std::move(overridden);
+            }
+        }
+
+        return array;
+    };
+
     this->swl_   = try_get("SWL");
     this->sgl_   = try_get("SGL");
 
@@ -83,4 +201,86 @@ EclEpsGridProperties(const EclipseState& eclState,
     this->permz_ = fp.has_double("PERMZ")
         ? &fp.get_double("PERMZ")
         : this->permx_;
+
+    if (eclState.getTableManager().useJFunc()) {
+        this->initLeverettFactors(eclState.getTableManager().getJFunc());
+    }
+}
+
+void Opm::EclEpsGridProperties::initLeverettFactors(const JFunc& jfunc)
+{
+    // Note that the factors need to be computed using non-SI units to make
+    // them correspond to the documentation.
+
+    const auto jfuncDir = jfunc.direction();
+    if ((jfuncDir != JFunc::Direction::X) &&
+        (jfuncDir != JFunc::Direction::Y) &&
+        (jfuncDir != JFunc::Direction::Z) &&
+        (jfuncDir != JFunc::Direction::XY))
+    {
+        throw std::runtime_error {
+            "Illegal direction indicator for the JFUNC "
+            "keyword (" + std::to_string(int(jfuncDir)) + ")"
+        };
+    }
+
+    if (this->poro_ == nullptr) {
+        throw std::runtime_error {
+            "The JFUNC keyword requires porosity (PORO) in all cells"
+        };
+    }
+
+    const auto jfuncFlag = jfunc.flag();
+    const auto water = (jfuncFlag == JFunc::Flag::WATER) || (jfuncFlag == JFunc::Flag::BOTH);
+    const auto gas   = (jfuncFlag == JFunc::Flag::GAS)   || (jfuncFlag == JFunc::Flag::BOTH);
+
+    // TODO: verify that the "average" permeability of the XY direction
+    // really is the arithmetic mean.  The harmonic mean would arguably be
+    // more appropriate because that's what's usually applied when
+    // calculating the fluxes.
+    const auto* perm = (jfuncDir == JFunc::Direction::Y) ? this->permy_
+        : (jfuncDir == JFunc::Direction::Z) ? this->permz_
+        : this->permx_;
+    const auto* permAvg = (jfuncDir == JFunc::Direction::XY) ? this->permy_ : nullptr;
+
+    const auto alpha = jfunc.alphaFactor();
+    const auto beta  = jfunc.betaFactor();
+
+    // Multiply the documented constant by 10^5 because we want the
+    // pressures in [Pa], not in [bar].  Surface tensions are in [dyn/cm].
+    const auto Uconst = 0.318316 * 1e5;
+    const auto owFactor = water ? jfunc.owSurfaceTension() * Uconst : 0.0;
+    const auto goFactor = gas   ? jfunc.goSurfaceTension() * Uconst : 0.0;
+
+    const auto numCells = this->poro_->size();
+    if (water) {
+        this->pcowLeverett_.resize(numCells);
+    }
+    if (gas) {
+        this->pcgoLeverett_.resize(numCells);
+    }
+
+#pragma omp parallel for
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(numCells); ++i) {
+        const auto cell = static_cast<std::size_t>(i);
+
+        auto k = this->perm(perm, cell);
+        if (permAvg != nullptr) {
+            k = arithmeticMean(k, this->perm(permAvg, cell));
+        }
+
+        // convert permeability from m^2 to mD
+        k *= 1.01325e15;
+
+        // the part of the Leverett capillary pressure which does not
+        // depend on surface tension.
+        const auto commonFactor = std::pow((*this->poro_)[cell], alpha) / std::pow(k, beta);
+
+        if (water) {
+            this->pcowLeverett_[cell] = commonFactor * owFactor;
+        }
+        if (gas) {
+            this->pcgoLeverett_[cell] = commonFactor * goFactor;
+        }
+    }
 }
@@ -34,6 +34,7 @@ namespace Opm {
 
 #if HAVE_ECL_INPUT
 class EclipseState;
+class JFunc;
 #endif
 
 /*!
@@ -41,6 +42,14 @@ class EclipseState;
  *
  * This class is used for both, the drainage and the imbibition variants of the ECL
  * keywords.
+ *
+ * The saturation function keywords (SWL, KRW, PCW, ...) only refer to the cells in
+ * which they differ from the unscaled end points of the cell's saturation region.
+ * For all other cells, and for keywords which do not differ in any cell, the
+ * accessors return a null pointer, so the caller keeps the region's values.
+ *
+ * If the deck uses the JFUNC keyword, the Leverett capillary pressure scaling
+ * factors of all cells are computed once on construction.
  */
 
 class EclEpsGridProperties
@@ -69,7 +78,7 @@ public:
 
     double permz(const std::size_t active_index) const
     {
-        return this->perm(this->permy_, active_index);
+        return this->perm(this->permz_, active_index);
     }
 
     double poro(const std::size_t active_index) const
@@ -162,41 +171,78 @@ public:
         return this->satfunc(this->krorw_, active_index);
     }
 
+    /// Leverett scaling factor of the oil-water capillary pressure, 1.0
+    /// unless JFUNC applies to the oil-water system.
+    double pcowLeverettFactor(const std::size_t active_index) const
+    {
+        return this->leverett(this->pcowLeverett_, active_index);
+    }
+
+    /// Leverett scaling factor of the gas-oil capillary pressure, 1.0
+    /// unless JFUNC applies to the gas-oil system.
+    double pcgoLeverettFactor(const std::size_t active_index) const
+    {
+        return this->leverett(this->pcgoLeverett_, active_index);
+    }
+
 private:
+    /// Cell values of one saturation function keyword.
+    struct SatfuncArray
+    {
+        /// Keyword values of all active cells, null if no cell differs
+        /// from its region's unscaled value.
+        const std::vector<double>* values { nullptr };
+
+        /// Cells whose value differs from the region's unscaled value.
+        /// Empty if all cells do.
+        std::vector<bool> overridden {};
+    };
+
     const std::vector<int>* satnum_ { nullptr };
 
-    const std::vector<double>* swl_ { nullptr };
-    const std::vector<double>* sgl_ { nullptr };
-    const std::vector<double>* swcr_ { nullptr };
-    const std::vector<double>* sgcr_ { nullptr };
-    const std::vector<double>* sowcr_ { nullptr };
-    const std::vector<double>* sogcr_ { nullptr };
-    const std::vector<double>* swu_ { nullptr };
-    const std::vector<double>* sgu_ { nullptr };
-
-    const std::vector<double>* pcw_ { nullptr };
-    const std::vector<double>* pcg_ { nullptr };
-
-    const std::vector<double>* krw_ { nullptr };
-    const std::vector<double>* krwr_ { nullptr };
-    const std::vector<double>* kro_ { nullptr };
-    const std::vector<double>* krorg_ { nullptr };
-    const std::vector<double>* krorw_ { nullptr };
-    const std::vector<double>* krg_ { nullptr };
-    const std::vector<double>* krgr_ { nullptr };
+    SatfuncArray swl_ {};
+    SatfuncArray sgl_ {};
+    SatfuncArray swcr_ {};
+    SatfuncArray sgcr_ {};
+    SatfuncArray sowcr_ {};
+    SatfuncArray sogcr_ {};
+    SatfuncArray swu_ {};
+    SatfuncArray sgu_ {};
+
+    SatfuncArray pcw_ {};
+    SatfuncArray pcg_ {};
+
+    SatfuncArray krw_ {};
+    SatfuncArray krwr_ {};
+    SatfuncArray kro_ {};
+    SatfuncArray krorg_ {};
+    SatfuncArray krorw_ {};
+    SatfuncArray krg_ {};
+    SatfuncArray krgr_ {};
 
     const std::vector<double>* permx_ { nullptr };
     const std::vector<double>* permy_ { nullptr };
     const std::vector<double>* permz_ { nullptr };
     const std::vector<double>* poro_ { nullptr };
 
+    std::vector<double> pcowLeverett_ {};
+    std::vector<double> pcgoLeverett_ {};
+
+#if HAVE_ECL_INPUT
+    void initLeverettFactors(const JFunc& jfunc);
+#endif
+
     const double*
-    satfunc(const std::vector<double>* data,
-            const std::size_t          active_index) const
+    satfunc(const SatfuncArray& data,
+            const std::size_t   active_index) const
     {
-        return ((data == nullptr) || data->empty())
-            ? nullptr
-            : &(*data)[active_index];
+        if ((data.values == nullptr) ||
+            (!data.overridden.empty() && !data.overridden[active_index]))
+        {
+            return nullptr;
+        }
+
+        return &(*data.values)[active_index];
     }
 
     double perm(const std::vector<double>* data,
@@ -206,6 +252,12 @@ private:
             ? 0.0
             : (*data)[active_index];
     }
+
+    double leverett(const std::vector<double>& data,
+                    const std::size_t          active_index) const
+    {
+        return data.empty() ? 1.0 : data[active_index];
+    }
 };
 
 } // namespace Opm
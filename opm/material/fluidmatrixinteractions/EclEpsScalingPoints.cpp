@@ -28,16 +28,10 @@
 #include <opm/material/fluidmatrixinteractions/EclEpsConfig.hpp>
 
 #if HAVE_ECL_INPUT
-#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.hpp>
-#include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
-
-#include <opm/material/common/Means.hpp>
 
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 
-#include <cmath>
-#include <stdexcept>
 #include <vector>
 #endif // HAVE_ECL_INPUT
 
@@ -120,8 +114,7 @@ extractUnscaled(const satfunc::RawTableEndPoints&    rtep,
 
 template<class Scalar>
 void Opm::EclEpsScalingPointsInfo<Scalar>::
-extractScaled(const EclipseState&         eclState,
-              const EclEpsGridProperties& epsProperties,
+extractScaled(const EclEpsGridProperties& epsProperties,
               unsigned                    activeIndex)
 {
     // overwrite the unscaled values with the values for the cell if it is
@@ -148,88 +141,9 @@ extractScaled(const EclipseState&         eclState,
     updateIfNonNull(this->maxKrow, epsProperties.kro(activeIndex));
     updateIfNonNull(this->maxKrog, epsProperties.kro(activeIndex));
 
-    this->pcowLeverettFactor = 1.0;
-    this->pcgoLeverettFactor = 1.0;
-
-    if (eclState.getTableManager().useJFunc()) {
-        this->calculateLeverettFactors(eclState, epsProperties, activeIndex);
-    }
-}
-
-template <typename Scalar>
-void Opm::EclEpsScalingPointsInfo<Scalar>::
-calculateLeverettFactors(const EclipseState&         eclState,
-                         const EclEpsGridProperties& epsProperties,
-                         const unsigned              activeIndex)
-{
-    // compute the Leverett capillary pressure scaling factors if
-    // applicable.  note that this needs to be done using non-SI units to
-    // make it correspond to the documentation.
-
-    const auto& jfunc = eclState.getTableManager().getJFunc();
-    const auto jfuncDir = jfunc.direction();
-
-    Scalar perm;
-    if (jfuncDir == JFunc::Direction::X) {
-        perm = epsProperties.permx(activeIndex);
-    }
-    else if (jfuncDir == JFunc::Direction::Y) {
-        perm = epsProperties.permy(activeIndex);
-    }
-    else if (jfuncDir == JFunc::Direction::Z) {
-        perm = epsProperties.permz(activeIndex);
-    }
-    else if (jfuncDir == JFunc::Direction::XY) {
-        // TODO: verify that this really is the arithmetic mean.
-        //
-        // The documentation just says that the "average" should be
-        // used,  IMO the harmonic mean would be more appropriate because
-        // that's what's usually applied when calculating the fluxes.
-
-        double permx = epsProperties.permx(activeIndex);
-        double permy = epsProperties.permy(activeIndex);
-        perm = arithmeticMean(permx, permy);
-    }
-    else {
-        throw std::runtime_error {
-            "Illegal direction indicator for the JFUNC "
-            "keyword (" + std::to_string(int(jfuncDir)) + ")"
-        };
-    }
-
-    // convert permeability from m^2 to mD
-    perm *= 1.01325e15;
-
-    const Scalar poro  = epsProperties.poro(activeIndex);
-    const Scalar alpha = jfunc.alphaFactor();
-    const Scalar beta  = jfunc.betaFactor();
-
-    // the part of the Leverett capillary pressure which does not depend
-    // on surface tension.
-    const Scalar commonFactor = std::pow(poro, alpha) / std::pow(perm, beta);
-
-    // multiply the documented constant by 10^5 because we want the
-    // pressures in [Pa], not in [bar]
-    const Scalar Uconst = 0.318316 * 1e5;
-
-    // compute the oil-water Leverett factor.
-    const auto& jfuncFlag = jfunc.flag();
-    if ((jfuncFlag == JFunc::Flag::WATER) ||
-        (jfuncFlag == JFunc::Flag::BOTH))
-    {
-        // note that we use the surface tension in terms of [dyn/cm]
-        const Scalar gamma = jfunc.owSurfaceTension();
-        this->pcowLeverettFactor = commonFactor * gamma * Uconst;
-    }
-
-    // compute the gas-oil Leverett factor.
-    if ((jfuncFlag == JFunc::Flag::GAS) ||
-        (jfuncFlag == JFunc::Flag::BOTH))
-    {
-        // note that we use the surface tension in terms of [dyn/cm]
-        const Scalar gamma = jfunc.goSurfaceTension();
-        this->pcgoLeverettFactor = commonFactor * gamma * Uconst;
-    }
+    // Leverett factors are 1.0 unless JFUNC applies to the two-phase system.
+    this->pcowLeverettFactor = static_cast<Scalar>(epsProperties.pcowLeverettFactor(activeIndex));
+    this->pcgoLeverettFactor = static_cast<Scalar>(epsProperties.pcgoLeverettFactor(activeIndex));
 }
 #endif  // HAVE_ECL_INPUT
 
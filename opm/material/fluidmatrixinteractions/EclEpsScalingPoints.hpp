@@ -36,7 +36,6 @@ class EclEpsConfig;
 enum class EclTwoPhaseSystemType;
 
 #if HAVE_ECL_INPUT
-class EclipseState;
 class EclEpsGridProperties;
 
 namespace satfunc {
@@ -133,14 +132,8 @@ struct EclEpsScalingPointsInfo
      *
      * I.e., the values which are "seen" by the physical model.
      */
-    void extractScaled(const EclipseState& eclState,
-                       const EclEpsGridProperties& epsProperties,
+    void extractScaled(const EclEpsGridProperties& epsProperties,
                        unsigned activeIndex);
-
-private:
-    void calculateLeverettFactors(const EclipseState& eclState,
-                                  const EclEpsGridProperties& epsProperties,
-                                  unsigned activeIndex);
 #endif  // HAVE_ECL_INPUT
 };
 
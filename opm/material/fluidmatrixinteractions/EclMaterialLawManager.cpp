@@ -34,6 +34,8 @@
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
 #include <algorithm>
+#include <numeric>
+#include <utility>
 
 namespace Opm {
 
@@ -142,6 +144,7 @@ initParamsForElements(const EclipseState& eclState, size_t numCompressedElems,
 {
     InitParams initParams {*this, eclState, numCompressedElems};
     initParams.run(fieldPropIntOnLeafAssigner, lookupIdxOnLevelZeroAssigner);
+    updateCellBatches_();
 }
 
 // TODO: Better (proper?) handling of mixed wettability systems - see ecl kw OPTIONS switch 74
@@ -243,6 +246,9 @@ const typename EclMaterialLawManager<TraitsT>::MaterialLawParams&
 EclMaterialLawManager<TraitsT>::
 connectionMaterialLawParams(unsigned satRegionIdx, unsigned elemIdx) const
 {
+    // the saturation tables are changed in place, so the cell must not use the
+    // parameters shared with the other cells of its region
+    const_cast<EclMaterialLawManager&>(*this).unshareMaterialLawParams_(elemIdx);
     MaterialLawParams& mlp = const_cast<MaterialLawParams&>(materialLawParams_[elemIdx]);
 
     if (enableHysteresis())
@@ -416,6 +422,7 @@ EclEpsScalingPoints<typename TraitsT::Scalar>&
 EclMaterialLawManager<TraitsT>::
 oilWaterScaledEpsPointsDrainage(unsigned elemIdx)
 {
+    unshareMaterialLawParams_(elemIdx);
     auto& materialParams = materialLawParams_[elemIdx];
     switch (materialParams.approach()) {
     case EclMultiplexerApproach::Stone1: {
@@ -451,13 +458,13 @@ materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const
         switch(facedir) {
             case Dir::XMinus:
             case Dir::XPlus:
-                return dirMaterialLawParams_->materialLawParamsX_[elemIdx];
+                return dirMaterialLawParams_->get(0, elemIdx);
             case Dir::YMinus:
             case Dir::YPlus:
-                return dirMaterialLawParams_->materialLawParamsY_[elemIdx];
+                return dirMaterialLawParams_->get(1, elemIdx);
             case Dir::ZMinus:
             case Dir::ZPlus:
-                return dirMaterialLawParams_->materialLawParamsZ_[elemIdx];
+                return dirMaterialLawParams_->get(2, elemIdx);
             default:
                 throw std::runtime_error("Unexpected face direction");
         }
@@ -523,6 +530,75 @@ readGlobalThreePhaseOptions_(const Runspec& runspec)
     }
 }
 
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+unshareMaterialLawParams_(unsigned elemIdx)
+{
+    if (sharedMaterialLawParams_.empty() || !sharedMaterialLawParams_[elemIdx])
+        return;
+
+    auto& materialParams = materialLawParams_[elemIdx];
+    switch (materialParams.approach()) {
+    case EclMultiplexerApproach::Stone1: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone1>();
+        realParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(realParams.gasOilParams()));
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::Stone2: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone2>();
+        realParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(realParams.gasOilParams()));
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::TwoPhase: {
+        auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        realParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(realParams.gasOilParams()));
+        realParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(realParams.oilWaterParams()));
+        realParams.setGasWaterParams(std::make_shared<GasWaterTwoPhaseHystParams>(realParams.gasWaterParams()));
+        break;
+    }
+
+    default:
+        // the default approach and the single phase case store their parameters by value
+        break;
+    }
+
+    sharedMaterialLawParams_[elemIdx] = false;
+}
+
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+updateCellBatches_()
+{
+    cellBatches_.clear();
+
+    // group the cells by approach and saturation region, keeping the cells of each
+    // group in ascending order
+    std::vector<unsigned> order(materialLawParams_.size());
+    std::iota(order.begin(), order.end(), 0u);
+    const auto key = [this](const unsigned elemIdx)
+    {
+        return std::make_pair(static_cast<int>(materialLawParams_[elemIdx].approach()),
+                              satnumRegionArray_.empty() ? 0 : satnumRegionArray_[elemIdx]);
+    };
+    std::stable_sort(order.begin(), order.end(),
+                     [&key](const unsigned a, const unsigned b) { return key(a) < key(b); });
+
+    for (const unsigned elemIdx : order) {
+        const auto approach = materialLawParams_[elemIdx].approach();
+        const int satRegionIdx = key(elemIdx).second;
+        if (cellBatches_.empty() ||
+            cellBatches_.back().approach != approach ||
+            cellBatches_.back().satRegionIdx != satRegionIdx)
+        {
+            cellBatches_.push_back({approach, satRegionIdx, {}});
+        }
+        cellBatches_.back().cells.push_back(elemIdx);
+    }
+}
 
 template class EclMaterialLawManager<ThreePhaseMaterialTraits<double,0,1,2>>;
 template class EclMaterialLawManager<ThreePhaseMaterialTraits<float,0,1,2>>;
@@ -42,6 +42,7 @@
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
 #include <cassert>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <tuple>
@@ -159,8 +160,7 @@ private:
         unsigned imbRegion_(std::vector<int>& array, unsigned elemIdx);
         void initArrays_(
                          std::vector<std::vector<int>*>& satnumArray,
-                         std::vector<std::vector<int>*>& imbnumArray,
-                         std::vector<std::vector<MaterialLawParams>*>& mlpArray);
+                         std::vector<std::vector<int>*>& imbnumArray);
         void initMaterialLawParamVectors_();
         void initOilWaterScaledEpsInfo_();
         // \brief Function argument 'fieldProptOnLeadAssigner' needed to lookup
@@ -202,6 +202,10 @@ private:
                                              const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner);
             void setImbibitionParamsGasWater(unsigned elemIdx, unsigned satRegionIdx,
                                              const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner);
+            // true if none of the drainage scaling points set so far differ from
+            // the unscaled points of the saturation region they were set for
+            bool usesUnscaledPoints() const
+            { return usesUnscaledPoints_; }
         private:
             bool hasGasWater_();
             bool hasGasOil_();
@@ -218,6 +222,7 @@ private:
             std::tuple<EclEpsScalingPointsInfo<Scalar>, EclEpsScalingPoints<Scalar>>
             readScaledEpsPointsImbibition_(unsigned elemIdx, EclTwoPhaseSystemType type,
                                            const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner);
+            void updateUsesUnscaledPoints_(const EclEpsScalingPointsInfo<Scalar>& scaledInfo, unsigned satRegionIdx);
 
             EclMaterialLawManager<TraitsT>::InitParams& init_params_;
             EclMaterialLawManager<TraitsT>& parent_;
@@ -225,6 +230,7 @@ private:
             std::shared_ptr<GasOilTwoPhaseHystParams> gasOilParams_;
             std::shared_ptr<OilWaterTwoPhaseHystParams> oilWaterParams_;
             std::shared_ptr<GasWaterTwoPhaseHystParams> gasWaterParams_;
+            bool usesUnscaledPoints_{true};
         };
 
         // This class' implementation is defined in "EclMaterialLawManagerReadEffectiveParams.cpp"
@@ -393,6 +399,92 @@ public:
         return changed;
     }
 
+    /*!
+     * \brief Update the hysteresis state of all cells in one call.
+     *
+     * This is equivalent to calling updateHysteresis(fluidStates[elemIdx], elemIdx) for
+     * every cell, but the material law is selected once per group of cells which share
+     * the three-phase approach and the saturation region, and the cells of each group are
+     * updated in parallel. This relies on every cell having its own hysteresis
+     * parameters, which is the case whenever hysteresis is enabled.
+     *
+     * \param fluidStates Container of per-cell fluid states, indexed by the cell index
+     * \param changed Container of per-cell flags, indexed by the cell index, which is set
+     *                to whether the hysteresis state of the cell changed. Must allow
+     *                concurrent writes to different cells, i.e., not std::vector<bool>.
+     * \return Whether the hysteresis state of any cell changed
+     */
+    template <class FluidStateVector, class ChangedVector>
+    bool updateHysteresis(const FluidStateVector& fluidStates, ChangedVector& changed)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        if (!enableHysteresis())
+            return false;
+
+        using Approach = EclMultiplexerApproach;
+        bool anyChanged = false;
+        for (const auto& batch : cellBatches_) {
+            bool batchChanged = false;
+            switch (batch.approach) {
+            case Approach::Stone1:
+                batchChanged = updateHysteresisBatch_<typename MaterialLaw::Stone1Material,
+                                                      Approach::Stone1>(batch, fluidStates, changed);
+                break;
+
+            case Approach::Stone2:
+                batchChanged = updateHysteresisBatch_<typename MaterialLaw::Stone2Material,
+                                                      Approach::Stone2>(batch, fluidStates, changed);
+                break;
+
+            case Approach::Default:
+                batchChanged = updateHysteresisBatch_<typename MaterialLaw::DefaultMaterial,
+                                                      Approach::Default>(batch, fluidStates, changed);
+                break;
+
+            case Approach::TwoPhase:
+                batchChanged = updateHysteresisBatch_<typename MaterialLaw::TwoPhaseMaterial,
+                                                      Approach::TwoPhase>(batch, fluidStates, changed);
+                break;
+
+            case Approach::OnePhase:
+                batchChanged = updateHysteresisBatch_<void, Approach::OnePhase>(batch, fluidStates, changed);
+                break;
+            }
+            anyChanged = anyChanged || batchChanged;
+        }
+        return anyChanged;
+    }
+
+    /*!
+     * \brief Compute the relative permeabilities of all cells in one call.
+     *
+     * The cells are visited in groups which share the three-phase approach and the
+     * saturation region, so that the material law is selected once per group instead of
+     * once per cell and consecutive cells use the same saturation function tables. Only
+     * the cell centered (i.e., non-directional) parameters are used.
+     *
+     * \param values Container of per-cell result arrays, indexed by the cell index
+     * \param fluidStates Container of per-cell fluid states, indexed by the cell index
+     */
+    template <class ValueVector, class FluidStateVector>
+    void relativePermeabilities(ValueVector& values, const FluidStateVector& fluidStates) const
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        evaluateCellBatches_</*relperm=*/true>(values, fluidStates);
+    }
+
+    /*!
+     * \brief Compute the capillary pressures of all cells in one call.
+     *
+     * \copydetails relativePermeabilities()
+     */
+    template <class ValueVector, class FluidStateVector>
+    void capillaryPressures(ValueVector& values, const FluidStateVector& fluidStates) const
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        evaluateCellBatches_</*relperm=*/false>(values, fluidStates);
+    }
+
     void oilWaterHysteresisParams(Scalar& soMax,
                                   Scalar& swMax,
                                   Scalar& swMin,
@@ -431,6 +523,107 @@ public:
     }
 
 private:
+    // cells which use the same three-phase approach and saturation region
+    struct CellBatch
+    {
+        EclMultiplexerApproach approach;
+        int satRegionIdx;
+        std::vector<unsigned> cells;
+    };
+
+    template <bool relperm, class ValueVector, class FluidStateVector>
+    void evaluateCellBatches_(ValueVector& values, const FluidStateVector& fluidStates) const
+    {
+        using Approach = EclMultiplexerApproach;
+        for (const auto& batch : cellBatches_) {
+            switch (batch.approach) {
+            case Approach::Stone1:
+                evaluateCellBatch_<relperm, typename MaterialLaw::Stone1Material,
+                                   Approach::Stone1>(batch, values, fluidStates);
+                break;
+
+            case Approach::Stone2:
+                evaluateCellBatch_<relperm, typename MaterialLaw::Stone2Material,
+                                   Approach::Stone2>(batch, values, fluidStates);
+                break;
+
+            case Approach::Default:
+                evaluateCellBatch_<relperm, typename MaterialLaw::DefaultMaterial,
+                                   Approach::Default>(batch, values, fluidStates);
+                break;
+
+            case Approach::TwoPhase:
+                evaluateCellBatch_<relperm, typename MaterialLaw::TwoPhaseMaterial,
+                                   Approach::TwoPhase>(batch, values, fluidStates);
+                break;
+
+            case Approach::OnePhase:
+                for (const unsigned elemIdx : batch.cells) {
+                    values[elemIdx][0] = relperm ? 1.0 : 0.0;
+                }
+                break;
+            }
+        }
+    }
+
+    template <bool relperm, class Law, EclMultiplexerApproach approach,
+              class ValueVector, class FluidStateVector>
+    void evaluateCellBatch_(const CellBatch& batch,
+                            ValueVector& values,
+                            const FluidStateVector& fluidStates) const
+    {
+        for (const unsigned elemIdx : batch.cells) {
+            const auto& params = materialLawParams_[elemIdx].template getRealParams<approach>();
+            if constexpr (relperm) {
+                Law::relativePermeabilities(values[elemIdx], params, fluidStates[elemIdx]);
+            }
+            else {
+                Law::capillaryPressures(values[elemIdx], params, fluidStates[elemIdx]);
+            }
+        }
+    }
+
+    template <class Law, EclMultiplexerApproach approach,
+              class FluidStateVector, class ChangedVector>
+    bool updateHysteresisBatch_(const CellBatch& batch,
+                                const FluidStateVector& fluidStates,
+                                ChangedVector& changed)
+    {
+        using Dir = FaceDir::DirEnum;
+        const bool directional = hasDirectionalRelperms() || hasDirectionalImbnum();
+        const auto numCells = static_cast<std::int64_t>(batch.cells.size());
+
+        bool anyChanged = false;
+#pragma omp parallel for reduction(||:anyChanged)
+        for (std::int64_t i = 0; i < numCells; ++i) {
+            const unsigned elemIdx = batch.cells[i];
+            const auto& fluidState = fluidStates[elemIdx];
+
+            bool cellChanged = false;
+            if constexpr (approach != EclMultiplexerApproach::OnePhase) {
+                auto& params = materialLawParams_[elemIdx].template getRealParams<approach>();
+                cellChanged = Law::updateHysteresis(params, fluidState);
+            }
+            if (directional) {
+                for (const Dir facedir : {Dir::XPlus, Dir::YPlus, Dir::ZPlus}) {
+                    const bool dirChanged =
+                        MaterialLaw::updateHysteresis(materialLawParams(elemIdx, facedir), fluidState);
+                    cellChanged = cellChanged || dirChanged;
+                }
+            }
+
+            changed[elemIdx] = cellChanged;
+            anyChanged = anyChanged || cellChanged;
+        }
+        return anyChanged;
+    }
+
+    void updateCellBatches_();
+
+    // Give the cell its own copy of the two-phase parameter objects if it currently
+    // uses the ones shared by all unscaled cells of its saturation region.
+    void unshareMaterialLawParams_(unsigned elemIdx);
+
     const MaterialLawParams& materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const;
 
     void readGlobalEpsOptions_(const EclipseState& eclState);
@@ -464,6 +657,9 @@ private:
 
     std::vector<MaterialLawParams> materialLawParams_;
     DirectionalMaterialLawParamsPtr dirMaterialLawParams_;
+    std::vector<CellBatch> cellBatches_;
+    // cells of materialLawParams_ which point to the shared parameters of their region
+    std::vector<bool> sharedMaterialLawParams_;
 
     std::vector<int> satnumRegionArray_;
     std::vector<int> krnumXArray_;
@@ -102,6 +102,7 @@ setDrainageParamsGasWater(unsigned elemIdx, unsigned satRegionIdx,
     if (hasGasWater_()) {
         auto [gasWaterScaledInfo, gasWaterScaledPoints]
             = readScaledEpsPointsDrainage_(elemIdx, EclTwoPhaseSystemType::GasWater, lookupIdxOnLevelZeroAssigner);
+        updateUsesUnscaledPoints_(gasWaterScaledInfo, satRegionIdx);
         GasWaterEpsTwoPhaseParams gasWaterDrainParams;
         gasWaterDrainParams.setConfig(this->parent_.gasWaterConfig_);
         gasWaterDrainParams.setUnscaledPoints(this->parent_.gasWaterUnscaledPointsVector_[satRegionIdx]);
@@ -121,6 +122,7 @@ setDrainageParamsOilGas(unsigned elemIdx, unsigned satRegionIdx,
     if (hasGasOil_()) {
         auto [gasOilScaledInfo, gasOilScaledPoints]
             = readScaledEpsPointsDrainage_(elemIdx, EclTwoPhaseSystemType::GasOil, lookupIdxOnLevelZeroAssigner);
+        updateUsesUnscaledPoints_(gasOilScaledInfo, satRegionIdx);
         GasOilEpsTwoPhaseParams gasOilDrainParams;
         gasOilDrainParams.setConfig(this->parent_.gasOilConfig_);
         gasOilDrainParams.setUnscaledPoints(this->parent_.gasOilUnscaledPointsVector_[satRegionIdx]);
@@ -143,6 +145,7 @@ setDrainageParamsOilWater(unsigned elemIdx, unsigned satRegionIdx,
     // Therefore, the below 7 lines should not be put inside the if(hasOilWater_){} below.
     auto [oilWaterScaledInfo, oilWaterScaledPoints]
         = readScaledEpsPointsDrainage_(elemIdx, EclTwoPhaseSystemType::OilWater, lookupIdxOnLevelZeroAssigner);
+    updateUsesUnscaledPoints_(oilWaterScaledInfo, satRegionIdx);
     // TODO: This will reassign the same EclEpsScalingPointsInfo for each facedir
     //  since we currently does not support facedir for the scaling points info
     //  When such support is added, we need to extend the below vector which has info for each cell
@@ -270,7 +273,7 @@ readScaledEpsPoints_(const EclEpsGridProperties& epsGridProperties, unsigned ele
     EclEpsScalingPointsInfo<Scalar> destInfo(this->parent_.unscaledEpsInfo_[satRegionIdx]);
     // TODO: currently epsGridProperties does not implement a face direction, e.g. SWLX, SWLY,...
     //  when these keywords get implemented, we need to use include facedir in the lookup
-    destInfo.extractScaled(this->eclState_, epsGridProperties, lookupIdx /* coincides with elemIdx when no LGRs */);
+    destInfo.extractScaled(epsGridProperties, lookupIdx /* coincides with elemIdx when no LGRs */);
 
     EclEpsScalingPoints<Scalar> destPoint;
     destPoint.init(destInfo, config, type);
@@ -303,6 +306,15 @@ readScaledEpsPointsImbibition_(unsigned elemIdx, EclTwoPhaseSystemType type,
     return readScaledEpsPoints_(*epsGridProperties, elemIdx, type, fieldPropIdxOnLevelZero);
 }
 
+template <class Traits>
+void
+EclMaterialLawManager<Traits>::InitParams::HystParams::
+updateUsesUnscaledPoints_(const EclEpsScalingPointsInfo<Scalar>& scaledInfo, unsigned satRegionIdx)
+{
+    if (!(scaledInfo == this->parent_.unscaledEpsInfo_[satRegionIdx]))
+        this->usesUnscaledPoints_ = false;
+}
+
 // Make some actual code, by realizing the previously defined templated class
 template class EclMaterialLawManager<ThreePhaseMaterialTraits<double,0,1,2>>::InitParams::HystParams;
 template class EclMaterialLawManager<ThreePhaseMaterialTraits<float,0,1,2>>::InitParams::HystParams;
@@ -26,6 +26,8 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 
+#include <optional>
+
 
 namespace Opm {
 
@@ -64,9 +66,17 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
     initMaterialLawParamVectors_();
     std::vector<std::vector<int>*> satnumArray;
     std::vector<std::vector<int>*> imbnumArray;
-    std::vector<std::vector<MaterialLawParams>*> mlpArray;
-    initArrays_(satnumArray, imbnumArray, mlpArray);
-    auto num_arrays = mlpArray.size();
+    initArrays_(satnumArray, imbnumArray);
+    // Without hysteresis the two-phase parameters of a cell never change after
+    // initialization, so all cells whose scaled end points coincide with the unscaled
+    // ones of their saturation region can share a single set of parameter objects.
+    // Cells which later need individual values are detached again by the manager, see
+    // unshareMaterialLawParams_().  The directional parameters of such cells are
+    // never modified, so they refer to a single parameter object per region.
+    std::vector<std::optional<HystParams>> regionDefaultParams(this->parent_.unscaledEpsInfo_.size());
+    std::vector<std::optional<std::size_t>> regionDirectionalParams(this->parent_.unscaledEpsInfo_.size());
+    this->parent_.sharedMaterialLawParams_.assign(this->numCompressedElems_, false);
+    auto num_arrays = this->parent_.dirMaterialLawParams_ ? 4u : 1u;
     for (unsigned i=0; i<num_arrays; i++) {
         for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
             unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
@@ -83,7 +93,35 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
                 hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
             }
             hystParams.finalize();
-            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+            const bool regionDefault = !this->parent_.enableHysteresis() && hystParams.usesUnscaledPoints();
+            if (i > 0) {
+                auto& dirParams = *this->parent_.dirMaterialLawParams_;
+                if (regionDefault) {
+                    auto& poolIdx = regionDirectionalParams[satRegionIdx];
+                    if (!poolIdx) {
+                        auto& regionParams = regionDefaultParams[satRegionIdx];
+                        if (!regionParams)
+                            regionParams.emplace(hystParams);
+                        poolIdx = dirParams.add();
+                        initThreePhaseParams_(*regionParams, dirParams.pooled(*poolIdx), satRegionIdx, elemIdx);
+                    }
+                    dirParams.assign(i - 1, elemIdx, *poolIdx);
+                    continue;
+                }
+                const auto poolIdx = dirParams.add();
+                initThreePhaseParams_(hystParams, dirParams.pooled(poolIdx), satRegionIdx, elemIdx);
+                dirParams.assign(i - 1, elemIdx, poolIdx);
+                continue;
+            }
+            if (regionDefault) {
+                auto& regionParams = regionDefaultParams[satRegionIdx];
+                if (!regionParams)
+                    regionParams.emplace(hystParams);
+                this->parent_.sharedMaterialLawParams_[elemIdx] = true;
+                initThreePhaseParams_(*regionParams, this->parent_.materialLawParams_[elemIdx], satRegionIdx, elemIdx);
+                continue;
+            }
+            initThreePhaseParams_(hystParams, this->parent_.materialLawParams_[elemIdx], satRegionIdx, elemIdx);
         }
     }
 }
@@ -134,26 +172,27 @@ void
 EclMaterialLawManager<Traits>::InitParams::
 initArrays_(
         std::vector<std::vector<int>*>& satnumArray,
-        std::vector<std::vector<int>*>& imbnumArray,
-        std::vector<std::vector<MaterialLawParams>*>& mlpArray)
+        std::vector<std::vector<int>*>& imbnumArray)
 {
     satnumArray.push_back(&this->parent_.satnumRegionArray_);
     imbnumArray.push_back(&this->parent_.imbnumRegionArray_);
-    mlpArray.push_back(&this->parent_.materialLawParams_);
     if (this->parent_.dirMaterialLawParams_) {
         if (this->parent_.hasDirectionalRelperms()) {
             satnumArray.push_back(&this->parent_.krnumXArray_);
             satnumArray.push_back(&this->parent_.krnumYArray_);
             satnumArray.push_back(&this->parent_.krnumZArray_);
         }
+        else {
+            satnumArray.insert(satnumArray.end(), 3, &this->parent_.satnumRegionArray_);
+        }
         if (this->parent_.hasDirectionalImbnum()) {
             imbnumArray.push_back(&this->parent_.imbnumXArray_);
             imbnumArray.push_back(&this->parent_.imbnumYArray_);
             imbnumArray.push_back(&this->parent_.imbnumZArray_);
         }
-        mlpArray.push_back(&(this->parent_.dirMaterialLawParams_->materialLawParamsX_));
-        mlpArray.push_back(&(this->parent_.dirMaterialLawParams_->materialLawParamsY_));
-        mlpArray.push_back(&(this->parent_.dirMaterialLawParams_->materialLawParamsZ_));
+        else {
+            imbnumArray.insert(imbnumArray.end(), 3, &this->parent_.imbnumRegionArray_);
+        }
     }
 }
 
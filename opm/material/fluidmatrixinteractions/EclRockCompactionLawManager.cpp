@@ -0,0 +1,203 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/material/fluidmatrixinteractions/EclRockCompactionLawManager.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/SimulationConfig/RockConfig.hpp>
+#include <opm/input/eclipse/EclipseState/SimulationConfig/SimulationConfig.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/OverburdTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/Rock2dTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/Rock2dtrTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/RocktabTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/RockwnodTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Opm {
+
+template<class Scalar>
+void EclRockCompactionLawManager<Scalar>::
+initParamsForElements(const EclipseState& eclState, std::size_t numElems,
+                      const std::vector<Scalar>& cellDepth,
+                      const std::function<std::vector<unsigned int>(const FieldPropsManager&, const std::string&, bool)>&
+                      fieldPropIntOnLeafAssigner)
+{
+    const auto& rockConfig = eclState.getSimulationConfig().rock_config();
+    const auto& tableManager = eclState.getTableManager();
+
+    poroMult_.clear();
+    transMult_.clear();
+    poroMultWc_.clear();
+    transMultWc_.clear();
+
+    if (!rockConfig.active())
+        return;
+
+    switch (rockConfig.hysteresis_mode()) {
+    case RockConfig::Hysteresis::REVERS:
+    case RockConfig::Hysteresis::NONE:
+        irreversible_ = false;
+        break;
+
+    case RockConfig::Hysteresis::IRREVERS:
+        irreversible_ = true;
+        break;
+
+    default:
+        OPM_THROW(std::runtime_error,
+                  "Unsupported ROCKCOMP hysteresis option. "
+                  "Only REVERS and IRREVERS are supported.");
+    }
+
+    std::size_t numTables = 0;
+    if (rockConfig.water_compaction()) {
+        const auto& rock2dTables = tableManager.getRock2dTables();
+        const auto& rock2dtrTables = tableManager.getRock2dtrTables();
+        const auto& rockwnodTables = tableManager.getRockwnodTables();
+
+        numTables = rock2dTables.size();
+        poroMultWc_.assign(numTables, TabulatedTwoDFunction(TabulatedTwoDFunction::Vertical));
+        if (!rock2dtrTables.empty())
+            transMultWc_.assign(numTables, TabulatedTwoDFunction(TabulatedTwoDFunction::Vertical));
+
+        for (std::size_t rockIdx = 0; rockIdx < numTables; ++rockIdx) {
+            const auto& saturation = rockwnodTables.getTable<RockwnodTable>(rockIdx).getSaturationColumn();
+            const auto& rock2dTable = rock2dTables[rockIdx];
+            if (saturation.size() != rock2dTable.sizeMultValues())
+                OPM_THROW(std::runtime_error,
+                          "Number of entries in ROCKWNOD and ROCK2D needs to match.");
+
+            for (std::size_t xIdx = 0; xIdx < rock2dTable.size(); ++xIdx) {
+                poroMultWc_[rockIdx].appendXPos(rock2dTable.getPressureValue(xIdx));
+                for (std::size_t yIdx = 0; yIdx < rock2dTable.sizeMultValues(); ++yIdx)
+                    poroMultWc_[rockIdx].appendSamplePoint(xIdx, saturation[yIdx],
+                                                           rock2dTable.getPvmultValue(xIdx, yIdx));
+            }
+
+            if (rock2dtrTables.empty())
+                continue;
+
+            const auto& rock2dtrTable = rock2dtrTables[rockIdx];
+            if (saturation.size() != rock2dtrTable.sizeMultValues())
+                OPM_THROW(std::runtime_error,
+                          "Number of entries in ROCKWNOD and ROCK2DTR needs to match.");
+
+            for (std::size_t xIdx = 0; xIdx < rock2dtrTable.size(); ++xIdx) {
+                transMultWc_[rockIdx].appendXPos(rock2dtrTable.getPressureValue(xIdx));
+                for (std::size_t yIdx = 0; yIdx < rock2dtrTable.sizeMultValues(); ++yIdx)
+                    transMultWc_[rockIdx].appendSamplePoint(xIdx, saturation[yIdx],
+                                                            rock2dtrTable.getTransMultValue(xIdx, yIdx));
+            }
+        }
+    }
+    else {
+        const auto& rocktabTables = tableManager.getRocktabTables();
+
+        numTables = rocktabTables.size();
+        poroMult_.resize(numTables);
+        transMult_.resize(numTables);
+        for (std::size_t rockIdx = 0; rockIdx < numTables; ++rockIdx) {
+            const auto& rocktabTable = rocktabTables.getTable<RocktabTable>(rockIdx);
+            const auto& pressure = rocktabTable.getPressureColumn();
+            poroMult_[rockIdx].setXYContainers(pressure, rocktabTable.getPoreVolumeMultiplierColumn());
+            transMult_[rockIdx].setXYContainers(pressure, rocktabTable.getTransmissibilityMultiplierColumn());
+        }
+    }
+
+    if (numTables == 0)
+        return;
+
+    // initialize the element index -> rock table index mapping
+    if (numTables == 1)
+        elemToRockIdx_.assign(numElems, 0);
+    else
+        elemToRockIdx_ = fieldPropIntOnLeafAssigner(eclState.fieldProps(),
+                                                    rockConfig.rocknum_property(),
+                                                    true /*needs translation*/);
+
+    // group the elements by region for the batched evaluation
+    rockRegionElems_.assign(numTables, {});
+    for (unsigned elemIdx = 0; elemIdx < elemToRockIdx_.size(); ++elemIdx) {
+        if (elemToRockIdx_[elemIdx] >= numTables)
+            OPM_THROW(std::runtime_error,
+                      "Rock table region number exceeds the number of rock compaction tables.");
+
+        rockRegionElems_[elemToRockIdx_[elemIdx]].push_back(elemIdx);
+    }
+
+    // the overburden pressure does not depend on the solution
+    overburdenPressure_.clear();
+    const auto& overburdTables = tableManager.getOverburdTables();
+    if (!overburdTables.empty()) {
+        std::vector<TabulatedFunction> overburden(numTables);
+        for (std::size_t rockIdx = 0; rockIdx < numTables; ++rockIdx) {
+            const auto& table = overburdTables.getTable<OverburdTable>(rockIdx);
+            overburden[rockIdx].setXYContainers(table.getDepthColumn(),
+                                                table.getOverburdenPressureColumn());
+        }
+
+        overburdenPressure_.resize(numElems);
+        for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx)
+            overburdenPressure_[elemIdx] = overburden[elemToRockIdx_[elemIdx]]
+                .eval(cellDepth[elemIdx], /*extrapolate=*/true);
+    }
+
+    minPressure_.assign(irreversible_ ? numElems : 0,
+                        std::numeric_limits<Scalar>::max());
+    initialWaterSaturation_.assign(waterCompaction() ? numElems : 0, Scalar{0});
+    maxWaterSaturation_ = initialWaterSaturation_;
+}
+
+template<class Scalar>
+void EclRockCompactionLawManager<Scalar>::
+setInitialWaterSaturation(const std::vector<Scalar>& sw)
+{
+    if (!waterCompaction())
+        return;
+
+    initialWaterSaturation_.assign(sw.begin(), sw.begin() + initialWaterSaturation_.size());
+    maxWaterSaturation_ = initialWaterSaturation_;
+}
+
+template<class Scalar>
+void EclRockCompactionLawManager<Scalar>::
+updateHysteresis(const std::vector<Scalar>& pressure,
+                 const std::vector<Scalar>& sw)
+{
+    for (std::size_t elemIdx = 0; elemIdx < minPressure_.size(); ++elemIdx)
+        minPressure_[elemIdx] = std::min(minPressure_[elemIdx], pressure[elemIdx]);
+
+    for (std::size_t elemIdx = 0; elemIdx < maxWaterSaturation_.size(); ++elemIdx)
+        maxWaterSaturation_[elemIdx] = std::max(maxWaterSaturation_[elemIdx], sw[elemIdx]);
+}
+
+template class EclRockCompactionLawManager<double>;
+
+} // namespace Opm
@@ -0,0 +1,295 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::EclRockCompactionLawManager
+ */
+#ifndef OPM_ECL_ROCK_COMPACTION_LAW_MANAGER_HPP
+#define OPM_ECL_ROCK_COMPACTION_LAW_MANAGER_HPP
+
+#if ! HAVE_ECL_INPUT
+#error "Eclipse input support in opm-common is required to use the ECL rock compaction law manager!"
+#endif
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class EclipseState;
+class FieldPropsManager;
+
+/*!
+ * \ingroup fluidmatrixinteractions
+ *
+ * \brief Pore volume and transmissibility multipliers of rock compaction
+ *        (ROCKCOMP) for a complete ECL deck.
+ *
+ * The multipliers are tabulated functions of the effective pressure, i.e.,
+ * the cell pressure less the OVERBURD overburden pressure, from ROCKTAB.
+ * With water induced compaction they are two-dimensional functions of the
+ * effective pressure and of the increase of the maximum water saturation
+ * over its initial value, from ROCK2D, ROCK2DTR and ROCKWNOD.  For the
+ * IRREVERS hysteresis option the effective pressure is taken at the lowest
+ * pressure seen so far by the cell, so compaction is not reversed when the
+ * pressure rises again.
+ *
+ * The overburden pressure of each cell is evaluated once, and the cells of
+ * each rock table region are grouped, such that the batched evaluation only
+ * interpolates the table of the region.  The caller records the pressure
+ * and water saturation history using updateHysteresis() at the end of each
+ * time step.
+ */
+template <class Scalar>
+class EclRockCompactionLawManager
+{
+public:
+    using TabulatedFunction = Tabulated1DFunction<Scalar>;
+    using TabulatedTwoDFunction = UniformXTabulated2DFunction<Scalar>;
+
+    /*!
+     * \brief Read the rock compaction tables and the per-cell parameters.
+     *
+     * \param cellDepth Depth of the cell centres, used for OVERBURD.
+     */
+    void initParamsForElements(const EclipseState& eclState, std::size_t numElems,
+                               const std::vector<Scalar>& cellDepth,
+                               const std::function<std::vector<unsigned int>(const FieldPropsManager&, const std::string&,
+                               bool)>& fieldPropIntOnLeafAssigner);
+
+    /*!
+     * \brief Whether the deck has rock compaction tables.  If not, all
+     *        multipliers are one.
+     */
+    bool active() const
+    { return !poroMult_.empty() || !poroMultWc_.empty(); }
+
+    bool waterCompaction() const
+    { return !poroMultWc_.empty(); }
+
+    bool irreversible() const
+    { return irreversible_; }
+
+    unsigned rockTableIdx(unsigned elemIdx) const
+    { return elemToRockIdx_[elemIdx]; }
+
+    Scalar overburdenPressure(unsigned elemIdx) const
+    { return overburdenPressure_.empty() ? Scalar{0} : overburdenPressure_[elemIdx]; }
+
+    /*!
+     * \brief Lowest pressure recorded for a cell.  Only tracked for the
+     *        IRREVERS hysteresis option.
+     */
+    Scalar minPressure(unsigned elemIdx) const
+    { return minPressure_.empty() ? std::numeric_limits<Scalar>::max() : minPressure_[elemIdx]; }
+
+    /*!
+     * \brief Highest water saturation recorded for a cell.  Only tracked
+     *        for water induced compaction.
+     */
+    Scalar maxWaterSaturation(unsigned elemIdx) const
+    { return maxWaterSaturation_.empty() ? Scalar{0} : maxWaterSaturation_[elemIdx]; }
+
+    /*!
+     * \brief Set the initial water saturation of all cells.  Required for
+     *        water induced compaction.
+     */
+    void setInitialWaterSaturation(const std::vector<Scalar>& sw);
+
+    /*!
+     * \brief Record the pressures and water saturations of all cells at the
+     *        end of a time step.
+     */
+    void updateHysteresis(const std::vector<Scalar>& pressure,
+                          const std::vector<Scalar>& sw);
+
+    /*!
+     * \brief Pore volume multiplier of a cell.
+     */
+    template <class Evaluation>
+    Evaluation poreVolumeMultiplier(unsigned elemIdx,
+                                    const Evaluation& pressure,
+                                    const Evaluation& sw) const
+    {
+        if (!active())
+            return Evaluation{1.0};
+
+        return multiplier_(elemIdx, pressure, sw, poroMult_, poroMultWc_);
+    }
+
+    /*!
+     * \brief Transmissibility multiplier of a cell.
+     */
+    template <class Evaluation>
+    Evaluation transmissibilityMultiplier(unsigned elemIdx,
+                                          const Evaluation& pressure,
+                                          const Evaluation& sw) const
+    {
+        if (!active())
+            return Evaluation{1.0};
+
+        if (waterCompaction() && transMultWc_.empty())
+            return Evaluation{1.0};
+
+        return multiplier_(elemIdx, pressure, sw, transMult_, transMultWc_);
+    }
+
+    /*!
+     * \brief Compute the pore volume multipliers of all cells in one call.
+     *
+     * The results are the same as those of poreVolumeMultiplier() for each
+     * cell.  The saturations are only read for water induced compaction.
+     *
+     * \param values Container of per-cell results, indexed by the cell index
+     * \param pressures Container of per-cell pressures
+     * \param sws Container of per-cell water saturations
+     */
+    template <class ValueVector, class PressureVector, class SaturationVector>
+    void poreVolumeMultipliers(ValueVector& values,
+                               const PressureVector& pressures,
+                               const SaturationVector& sws) const
+    {
+        multipliers_(values, pressures, sws, poroMult_, poroMultWc_);
+    }
+
+    /*!
+     * \brief Compute the transmissibility multipliers of all cells in one
+     *        call.  See poreVolumeMultipliers().
+     */
+    template <class ValueVector, class PressureVector, class SaturationVector>
+    void transmissibilityMultipliers(ValueVector& values,
+                                     const PressureVector& pressures,
+                                     const SaturationVector& sws) const
+    {
+        if (waterCompaction() && transMultWc_.empty()) {
+            for (auto& value : values)
+                value = 1.0;
+            return;
+        }
+
+        multipliers_(values, pressures, sws, transMult_, transMultWc_);
+    }
+
+private:
+    template <class Evaluation>
+    Evaluation effectivePressure_(unsigned elemIdx, const Evaluation& pressure) const
+    {
+        Evaluation effectivePressure = irreversible_
+            ? Opm::min(pressure, minPressure_[elemIdx])
+            : pressure;
+
+        if (!overburdenPressure_.empty())
+            effectivePressure -= overburdenPressure_[elemIdx];
+
+        return effectivePressure;
+    }
+
+    template <class Evaluation>
+    Evaluation swDeltaMax_(unsigned elemIdx, const Evaluation& sw) const
+    {
+        return Opm::max(sw, maxWaterSaturation_[elemIdx]) - initialWaterSaturation_[elemIdx];
+    }
+
+    template <class Evaluation>
+    Evaluation multiplier_(unsigned elemIdx,
+                           const Evaluation& pressure,
+                           const Evaluation& sw,
+                           const std::vector<TabulatedFunction>& table,
+                           const std::vector<TabulatedTwoDFunction>& tableWc) const
+    {
+        const unsigned rockIdx = elemToRockIdx_[elemIdx];
+        const Evaluation effectivePressure = effectivePressure_(elemIdx, pressure);
+
+        if (!tableWc.empty())
+            return tableWc[rockIdx].eval(effectivePressure, swDeltaMax_(elemIdx, sw),
+                                         /*extrapolate=*/true);
+
+        return table[rockIdx].eval(effectivePressure, /*extrapolate=*/true);
+    }
+
+    template <class ValueVector, class PressureVector, class SaturationVector>
+    void multipliers_(ValueVector& values,
+                      const PressureVector& pressures,
+                      const SaturationVector& sws,
+                      const std::vector<TabulatedFunction>& table,
+                      const std::vector<TabulatedTwoDFunction>& tableWc) const
+    {
+        using Evaluation = typename ValueVector::value_type;
+
+        if (!active()) {
+            for (auto& value : values)
+                value = 1.0;
+            return;
+        }
+
+        for (std::size_t rockIdx = 0; rockIdx < rockRegionElems_.size(); ++rockIdx) {
+            if (!tableWc.empty()) {
+                const auto& function = tableWc[rockIdx];
+                for (const unsigned elemIdx : rockRegionElems_[rockIdx]) {
+                    const Evaluation pressure = pressures[elemIdx];
+                    const Evaluation sw = sws[elemIdx];
+                    values[elemIdx] = function.eval(effectivePressure_(elemIdx, pressure),
+                                                    swDeltaMax_(elemIdx, sw),
+                                                    /*extrapolate=*/true);
+                }
+            }
+            else {
+                // the cells of a region are typically close, so each segment
+                // search starts at the segment of the previous cell
+                const auto& function = table[rockIdx];
+                SegmentIndex hint{0};
+                for (const unsigned elemIdx : rockRegionElems_[rockIdx]) {
+                    const Evaluation pressure = pressures[elemIdx];
+                    values[elemIdx] = function.evalWithHint(effectivePressure_(elemIdx, pressure),
+                                                            hint, /*extrapolate=*/true);
+                }
+            }
+        }
+    }
+
+    bool irreversible_ = false;
+
+    std::vector<unsigned> elemToRockIdx_;
+    std::vector<std::vector<unsigned>> rockRegionElems_;
+
+    std::vector<Scalar> overburdenPressure_;
+    std::vector<Scalar> minPressure_;
+    std::vector<Scalar> initialWaterSaturation_;
+    std::vector<Scalar> maxWaterSaturation_;
+
+    std::vector<TabulatedFunction> poroMult_;
+    std::vector<TabulatedFunction> transMult_;
+    std::vector<TabulatedTwoDFunction> poroMultWc_;
+    std::vector<TabulatedTwoDFunction> transMultWc_;
+};
+
+} // namespace Opm
+
+#endif
@@ -0,0 +1,276 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::TwoPhaseLawTabulation
+ */
+#ifndef OPM_TWO_PHASE_LAW_TABULATION_HPP
+#define OPM_TWO_PHASE_LAW_TABULATION_HPP
+
+#include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterial.hpp>
+#include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterialParams.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \ingroup FluidMatrixInteractions
+ *
+ * \brief Result of comparing a tabulated two-phase law against the law it was
+ *        sampled from.
+ */
+template <class Scalar>
+struct TwoPhaseTabulationReport
+{
+    //! Largest absolute deviation of the capillary pressure
+    Scalar maxPcnwError{0};
+    //! Largest absolute deviation of the wetting phase relative permeability
+    Scalar maxKrwError{0};
+    //! Largest absolute deviation of the non-wetting phase relative permeability
+    Scalar maxKrnError{0};
+
+    //! Wetting phase saturations at which the largest deviations occur
+    Scalar SwMaxPcnwError{0};
+    Scalar SwMaxKrwError{0};
+    Scalar SwMaxKrnError{0};
+
+    //! Number of sampling points of each table
+    std::size_t numPcnwSamples{0};
+    std::size_t numKrwSamples{0};
+    std::size_t numKrnSamples{0};
+
+    //! Number of saturations at which the table and the law were compared
+    std::size_t numCheckPoints{0};
+
+    bool withinTolerance(Scalar pcnwTolerance, Scalar krTolerance) const
+    {
+        return maxPcnwError <= pcnwTolerance
+            && maxKrwError <= krTolerance
+            && maxKrnError <= krTolerance;
+    }
+};
+
+/*!
+ * \ingroup FluidMatrixInteractions
+ *
+ * \brief Samples an analytic two-phase material law into the parameters of a
+ *        PiecewiseLinearTwoPhaseMaterial.
+ *
+ * Laws such as BrooksCorey, VanGenuchten or TwoPhaseLETCurves evaluate powers
+ * and exponentials on every call. Sampling them once per saturation region and
+ * using PiecewiseLinearTwoPhaseMaterial instead turns each evaluation into a
+ * table lookup.
+ *
+ * The sampling points are placed adaptively: a segment is bisected until the
+ * linear interpolant deviates from the law by at most half the requested
+ * tolerance at the quarter, half and three-quarter points of the segment, or
+ * until the maximum refinement depth is reached. The factor of one half keeps
+ * the error between the probes within the tolerance also for curves with kinks,
+ * e.g., at the end points of LET curves. Use accuracy() to verify the result on
+ * an independent set of saturations.
+ *
+ * The law must implement the two-phase saturation API and its curves must not
+ * depend on any state besides the saturation, i.e., hysteretic laws such as
+ * ParkerLenhard can not be tabulated. Outside of [SwMin, SwMax] the table is
+ * constant, so the range should cover all saturations which can occur. Laws
+ * which are singular at the end points, like the Brooks-Corey capillary
+ * pressure at Sw = 0, must be sampled on a range which excludes the singularity.
+ *
+ * \tparam Law The two-phase material law to be tabulated
+ * \tparam TableParams The parameter object of the tabulated law
+ */
+template <class Law,
+          class TableParams = PiecewiseLinearTwoPhaseMaterialParams<typename Law::Traits>>
+class TwoPhaseLawTabulation
+{
+    using Scalar = typename Law::Traits::Scalar;
+    using LawParams = typename Law::Params;
+    using TableLaw = PiecewiseLinearTwoPhaseMaterial<typename Law::Traits, TableParams>;
+
+public:
+    using Report = TwoPhaseTabulationReport<Scalar>;
+
+    /*!
+     * \brief Sample all curves of the law into a table.
+     *
+     * \param params The parameters of the law
+     * \param pcnwTolerance Largest admissible absolute error of the capillary pressure
+     * \param krTolerance Largest admissible absolute error of the relative permeabilities
+     * \param SwMin Smallest wetting phase saturation of the table
+     * \param SwMax Largest wetting phase saturation of the table
+     * \param maxDepth Largest number of bisections of the initial segments
+     */
+    static TableParams tabulate(const LawParams& params,
+                                Scalar pcnwTolerance,
+                                Scalar krTolerance,
+                                Scalar SwMin = 0.0,
+                                Scalar SwMax = 1.0,
+                                unsigned maxDepth = 16)
+    {
+        if (!(SwMin < SwMax))
+            throw std::invalid_argument("The saturation range of a tabulated law must not be empty");
+
+        std::vector<Scalar> SwValues;
+        std::vector<Scalar> values;
+        TableParams table;
+
+        sample_([&params](Scalar Sw) { return Law::twoPhaseSatPcnw(params, Sw); },
+                "capillary pressure", pcnwTolerance, SwMin, SwMax, maxDepth, SwValues, values);
+        table.setPcnwSamples(SwValues, values);
+
+        sample_([&params](Scalar Sw) { return Law::twoPhaseSatKrw(params, Sw); },
+                "wetting phase relative permeability", krTolerance, SwMin, SwMax, maxDepth,
+                SwValues, values);
+        table.setKrwSamples(SwValues, values);
+
+        sample_([&params](Scalar Sw) { return Law::twoPhaseSatKrn(params, Sw); },
+                "non-wetting phase relative permeability", krTolerance, SwMin, SwMax, maxDepth,
+                SwValues, values);
+        table.setKrnSamples(SwValues, values);
+
+        table.finalize();
+        return table;
+    }
+
+    /*!
+     * \brief Compare a table against the law at evenly spaced saturations.
+     *
+     * \param params The parameters of the law
+     * \param table The table created from params by tabulate()
+     * \param SwMin Smallest wetting phase saturation to compare
+     * \param SwMax Largest wetting phase saturation to compare
+     * \param numCheckPoints Number of saturations to compare
+     */
+    static Report accuracy(const LawParams& params,
+                           const TableParams& table,
+                           Scalar SwMin = 0.0,
+                           Scalar SwMax = 1.0,
+                           std::size_t numCheckPoints = 10001)
+    {
+        Report report;
+        report.numPcnwSamples = table.SwPcwnSamples().size();
+        report.numKrwSamples = table.SwKrwSamples().size();
+        report.numKrnSamples = table.SwKrnSamples().size();
+        report.numCheckPoints = std::max(numCheckPoints, std::size_t{2});
+
+        const auto update = [](Scalar exact, Scalar tabulated, Scalar Sw,
+                               Scalar& maxError, Scalar& SwMaxError)
+        {
+            const Scalar error = std::abs(exact - tabulated);
+            if (error > maxError) {
+                maxError = error;
+                SwMaxError = Sw;
+            }
+        };
+
+        for (std::size_t i = 0; i < report.numCheckPoints; ++i) {
+            const Scalar Sw = SwMin + (SwMax - SwMin)*i/(report.numCheckPoints - 1);
+            update(Law::twoPhaseSatPcnw(params, Sw), TableLaw::twoPhaseSatPcnw(table, Sw),
+                   Sw, report.maxPcnwError, report.SwMaxPcnwError);
+            update(Law::twoPhaseSatKrw(params, Sw), TableLaw::twoPhaseSatKrw(table, Sw),
+                   Sw, report.maxKrwError, report.SwMaxKrwError);
+            update(Law::twoPhaseSatKrn(params, Sw), TableLaw::twoPhaseSatKrn(table, Sw),
+                   Sw, report.maxKrnError, report.SwMaxKrnError);
+        }
+
+        return report;
+    }
+
+private:
+    // number of segments the saturation range is split into before refining
+    static constexpr unsigned numInitialSegments_ = 8;
+
+    template <class Function>
+    static void sample_(const Function& f,
+                        const std::string& curveName,
+                        Scalar tolerance,
+                        Scalar SwMin,
+                        Scalar SwMax,
+                        unsigned maxDepth,
+                        std::vector<Scalar>& SwValues,
+                        std::vector<Scalar>& values)
+    {
+        const auto eval = [&f, &curveName](Scalar Sw)
+        {
+            const Scalar value = f(Sw);
+            if (!std::isfinite(value))
+                throw std::invalid_argument("The " + curveName + " is not finite at Sw = "
+                                            + std::to_string(Sw) + ", restrict the saturation"
+                                            " range of the tabulated law");
+            return value;
+        };
+
+        SwValues.assign(1, SwMin);
+        values.assign(1, eval(SwMin));
+        for (unsigned segIdx = 0; segIdx < numInitialSegments_; ++segIdx) {
+            const Scalar a = SwValues.back();
+            const Scalar fa = values.back();
+            const Scalar b = (segIdx + 1 == numInitialSegments_)
+                ? SwMax
+                : SwMin + (SwMax - SwMin)*(segIdx + 1)/numInitialSegments_;
+            refine_(eval, tolerance, a, fa, b, eval(b), maxDepth, SwValues, values);
+        }
+    }
+
+    // append the sampling points of the segment (a, b] to SwValues and values
+    template <class Function>
+    static void refine_(const Function& f,
+                        Scalar tolerance,
+                        Scalar a, Scalar fa,
+                        Scalar b, Scalar fb,
+                        unsigned depth,
+                        std::vector<Scalar>& SwValues,
+                        std::vector<Scalar>& values)
+    {
+        const Scalar m = (a + b)/2;
+        const Scalar fm = f(m);
+        const Scalar probeTolerance = tolerance/2;
+
+        bool accurate = std::abs(fm - (fa + fb)/2) <= probeTolerance;
+        if (accurate && depth > 0) {
+            const Scalar q1 = (a + m)/2;
+            const Scalar q3 = (m + b)/2;
+            accurate = std::abs(f(q1) - (3*fa + fb)/4) <= probeTolerance
+                && std::abs(f(q3) - (fa + 3*fb)/4) <= probeTolerance;
+        }
+
+        if (accurate || depth == 0) {
+            SwValues.push_back(b);
+            values.push_back(fb);
+            return;
+        }
+
+        refine_(f, tolerance, a, fa, m, fm, depth - 1, SwValues, values);
+        refine_(f, tolerance, m, fm, b, fb, depth - 1, SwValues, values);
+    }
+};
+
+} // namespace Opm
+
+#endif
@@ -0,0 +1,571 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::BlackOilFluidStateArray
+ */
+#ifndef OPM_BLACK_OIL_FLUID_STATE_ARRAY_HH
+#define OPM_BLACK_OIL_FLUID_STATE_ARRAY_HH
+
+#include <opm/material/fluidstates/BlackOilFluidState.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Stores the black-oil fluid states of many cells as a structure of arrays.
+ *
+ * Each quantity of BlackOilFluidState is kept in a contiguous array over all
+ * cells, and per phase for the phase properties. Passes over the whole grid
+ * which compute one property, e.g. the batched PVT evaluations of the
+ * multiplexers, can thus work directly on the arrays instead of striding over
+ * a large object per cell. Quantities which are disabled by the template
+ * arguments do not allocate any memory.
+ *
+ * operator[] returns a lightweight proxy for a single cell which satisfies the
+ * fluid state API, so the array can also be used with code which is written
+ * for a single fluid state. Like for BlackOilFluidState, the quantities which
+ * are not stored, e.g. the mole fractions, are computed on the fly and are
+ * thus relatively slow.
+ *
+ * The template arguments have the same meaning as those of BlackOilFluidState.
+ */
+template <class ScalarT,
+          class FluidSystem,
+          bool enableTemperature = false,
+          bool enableEnergy = false,
+          bool enableDissolution = true,
+          bool enableVapwat = false,
+          bool enableBrine = false,
+          bool enableSaltPrecipitation = false,
+          bool enableDissolutionInWater = false,
+          unsigned numStoragePhases = FluidSystem::numPhases>
+class BlackOilFluidStateArray
+{
+public:
+    using Scalar = ScalarT;
+    enum { numPhases = FluidSystem::numPhases };
+    enum { numComponents = FluidSystem::numComponents };
+
+    //! The fluid state of a single cell which stores the same quantities
+    using FluidState = BlackOilFluidState<Scalar,
+                                          FluidSystem,
+                                          enableTemperature,
+                                          enableEnergy,
+                                          enableDissolution,
+                                          enableVapwat,
+                                          enableBrine,
+                                          enableSaltPrecipitation,
+                                          enableDissolutionInWater,
+                                          numStoragePhases>;
+
+private:
+    static constexpr bool storeTemperature_ = enableTemperature || enableEnergy;
+
+    /*!
+     * \brief Read access to a single cell of the array.
+     *
+     * \tparam ArrayT The array type, possibly const qualified
+     */
+    template <class ArrayT>
+    class CellBase
+    {
+    public:
+        using Scalar = ScalarT;
+        enum { numPhases = FluidSystem::numPhases };
+        enum { numComponents = FluidSystem::numComponents };
+
+        CellBase(ArrayT& array, std::size_t cellIdx)
+            : array_(&array)
+            , cellIdx_(cellIdx)
+        {}
+
+        /*!
+         * \brief Return the index of the cell in the array.
+         */
+        std::size_t cellIndex() const
+        { return cellIdx_; }
+
+        void checkDefined() const
+        { toFluidState().checkDefined(); }
+
+        const Scalar& pressure(unsigned phaseIdx) const
+        { return array_->pressure_[storageIdx_(phaseIdx)][cellIdx_]; }
+
+        const Scalar& saturation(unsigned phaseIdx) const
+        { return array_->saturation_[storageIdx_(phaseIdx)][cellIdx_]; }
+
+        const Scalar& pc(unsigned phaseIdx) const
+        { return array_->pc_[storageIdx_(phaseIdx)][cellIdx_]; }
+
+        const Scalar& totalSaturation() const
+        { return array_->totalSaturation_[cellIdx_]; }
+
+        Scalar temperature(unsigned) const
+        {
+            if constexpr (storeTemperature_)
+                return array_->temperature_[cellIdx_];
+            else
+                return FluidSystem::reservoirTemperature(pvtRegionIndex());
+        }
+
+        const Scalar& invB(unsigned phaseIdx) const
+        { return array_->invB_[storageIdx_(phaseIdx)][cellIdx_]; }
+
+        Scalar density(unsigned phaseIdx) const
+        { return array_->density_[storageIdx_(phaseIdx)][cellIdx_]; }
+
+        const Scalar& enthalpy(unsigned phaseIdx) const
+        {
+            assert(enableEnergy);
+            return array_->enthalpy_[storageIdx_(phaseIdx)][cellIdx_];
+        }
+
+        Scalar internalEnergy(unsigned phaseIdx) const
+        {
+            auto energy = enthalpy(phaseIdx);
+            if (!FluidSystem::enthalpyEqualEnergy())
+                energy -= pressure(phaseIdx)/density(phaseIdx);
+            return energy;
+        }
+
+        Scalar Rs() const
+        { return optional_(array_->Rs_); }
+
+        Scalar Rv() const
+        { return optional_(array_->Rv_); }
+
+        Scalar Rvw() const
+        { return optional_(array_->Rvw_); }
+
+        Scalar Rsw() const
+        { return optional_(array_->Rsw_); }
+
+        Scalar saltConcentration() const
+        { return optional_(array_->saltConcentration_); }
+
+        Scalar saltSaturation() const
+        { return optional_(array_->saltSaturation_); }
+
+        unsigned short pvtRegionIndex() const
+        { return static_cast<unsigned short>(array_->pvtRegionIdx_[cellIdx_]); }
+
+        Scalar viscosity(unsigned phaseIdx) const
+        { return FluidSystem::viscosity(*this, phaseIdx, pvtRegionIndex()); }
+
+        Scalar fugacityCoefficient(unsigned phaseIdx, unsigned compIdx) const
+        { return FluidSystem::fugacityCoefficient(*this, phaseIdx, compIdx, pvtRegionIndex()); }
+
+        //////
+        // slow methods, evaluated by BlackOilFluidState
+        //////
+
+        Scalar massFraction(unsigned phaseIdx, unsigned compIdx) const
+        { return toFluidState().massFraction(phaseIdx, compIdx); }
+
+        Scalar moleFraction(unsigned phaseIdx, unsigned compIdx) const
+        { return toFluidState().moleFraction(phaseIdx, compIdx); }
+
+        Scalar molarDensity(unsigned phaseIdx) const
+        { return toFluidState().molarDensity(phaseIdx); }
+
+        Scalar molarVolume(unsigned phaseIdx) const
+        { return 1.0/molarDensity(phaseIdx); }
+
+        Scalar molarity(unsigned phaseIdx, unsigned compIdx) const
+        { return toFluidState().molarity(phaseIdx, compIdx); }
+
+        Scalar averageMolarMass(unsigned phaseIdx) const
+        { return toFluidState().averageMolarMass(phaseIdx); }
+
+        Scalar fugacity(unsigned phaseIdx, unsigned compIdx) const
+        {
+            return
+                fugacityCoefficient(phaseIdx, compIdx)
+                *moleFraction(phaseIdx, compIdx)
+                *pressure(phaseIdx);
+        }
+
+        /*!
+         * \brief Copy the quantities of the cell into a stand-alone fluid state.
+         */
+        FluidState toFluidState() const
+        {
+            FluidState fs;
+            fs.setPvtRegionIndex(pvtRegionIndex());
+            fs.setTotalSaturation(totalSaturation());
+            if constexpr (storeTemperature_)
+                fs.setTemperature(array_->temperature_[cellIdx_]);
+            if constexpr (enableDissolution) {
+                fs.setRs(Rs());
+                fs.setRv(Rv());
+            }
+            if constexpr (enableVapwat)
+                fs.setRvw(Rvw());
+            if constexpr (enableDissolutionInWater)
+                fs.setRsw(Rsw());
+            if constexpr (enableBrine)
+                fs.setSaltConcentration(saltConcentration());
+            if constexpr (enableSaltPrecipitation)
+                fs.setSaltSaturation(saltSaturation());
+            for (unsigned storagePhaseIdx = 0; storagePhaseIdx < numStoragePhases; ++storagePhaseIdx) {
+                const unsigned phaseIdx = BlackOilFluidStateArray::storageToCanonicalPhaseIndex_(storagePhaseIdx);
+                fs.setPressure(phaseIdx, pressure(phaseIdx));
+                fs.setSaturation(phaseIdx, saturation(phaseIdx));
+                fs.setPc(phaseIdx, pc(phaseIdx));
+                fs.setInvB(phaseIdx, invB(phaseIdx));
+                fs.setDensity(phaseIdx, density(phaseIdx));
+                if constexpr (enableEnergy)
+                    fs.setEnthalpy(phaseIdx, enthalpy(phaseIdx));
+            }
+            return fs;
+        }
+
+    protected:
+        static unsigned storageIdx_(unsigned phaseIdx)
+        { return BlackOilFluidStateArray::canonicalToStoragePhaseIndex_(phaseIdx); }
+
+        Scalar optional_(const std::vector<Scalar>& values) const
+        { return values.empty() ? Scalar{0.0} : values[cellIdx_]; }
+
+        ArrayT* array_;
+        std::size_t cellIdx_;
+    };
+
+public:
+    //! Read-only proxy for the fluid state of a single cell
+    using ConstCell = CellBase<const BlackOilFluidStateArray>;
+
+    //! Proxy for the fluid state of a single cell
+    class Cell : public CellBase<BlackOilFluidStateArray>
+    {
+        using Base = CellBase<BlackOilFluidStateArray>;
+        using Base::array_;
+        using Base::cellIdx_;
+        using Base::storageIdx_;
+
+    public:
+        using Base::Base;
+
+        operator ConstCell() const
+        { return ConstCell(*array_, cellIdx_); }
+
+        /*!
+         * \brief Retrieve all parameters from an arbitrary fluid state.
+         */
+        template <class FluidStateT>
+        void assign(const FluidStateT& fs)
+        {
+            if constexpr (storeTemperature_)
+                setTemperature(fs.temperature(/*phaseIdx=*/0));
+
+            const unsigned pvtRegionIdx = getPvtRegionIndex_<FluidStateT>(fs);
+            setPvtRegionIndex(pvtRegionIdx);
+
+            if constexpr (enableDissolution) {
+                setRs(BlackOil::getRs_<FluidSystem, FluidStateT, Scalar>(fs, pvtRegionIdx));
+                setRv(BlackOil::getRv_<FluidSystem, FluidStateT, Scalar>(fs, pvtRegionIdx));
+            }
+            if constexpr (enableVapwat)
+                setRvw(BlackOil::getRvw_<FluidSystem, FluidStateT, Scalar>(fs, pvtRegionIdx));
+            if constexpr (enableDissolutionInWater)
+                setRsw(BlackOil::getRsw_<FluidSystem, FluidStateT, Scalar>(fs, pvtRegionIdx));
+            if constexpr (enableBrine)
+                setSaltConcentration(BlackOil::getSaltConcentration_<FluidSystem, FluidStateT, Scalar>(fs, pvtRegionIdx));
+            if constexpr (enableSaltPrecipitation)
+                setSaltSaturation(BlackOil::getSaltSaturation_<FluidSystem, FluidStateT, Scalar>(fs, pvtRegionIdx));
+
+            for (unsigned storagePhaseIdx = 0; storagePhaseIdx < numStoragePhases; ++storagePhaseIdx) {
+                const unsigned phaseIdx = BlackOilFluidStateArray::storageToCanonicalPhaseIndex_(storagePhaseIdx);
+                setSaturation(phaseIdx, fs.saturation(phaseIdx));
+                setPressure(phaseIdx, fs.pressure(phaseIdx));
+                setDensity(phaseIdx, fs.density(phaseIdx));
+
+                if constexpr (enableEnergy)
+                    setEnthalpy(phaseIdx, fs.enthalpy(phaseIdx));
+
+                setInvB(phaseIdx, getInvB_<FluidSystem, FluidStateT, Scalar>(fs, phaseIdx, pvtRegionIdx));
+            }
+        }
+
+        void setPvtRegionIndex(unsigned newPvtRegionIdx)
+        { array_->pvtRegionIdx_[cellIdx_] = newPvtRegionIdx; }
+
+        void setPressure(unsigned phaseIdx, const Scalar& p)
+        { array_->pressure_[storageIdx_(phaseIdx)][cellIdx_] = p; }
+
+        void setSaturation(unsigned phaseIdx, const Scalar& S)
+        { array_->saturation_[storageIdx_(phaseIdx)][cellIdx_] = S; }
+
+        void setPc(unsigned phaseIdx, const Scalar& pc)
+        { array_->pc_[storageIdx_(phaseIdx)][cellIdx_] = pc; }
+
+        void setTotalSaturation(const Scalar& value)
+        { array_->totalSaturation_[cellIdx_] = value; }
+
+        void setTemperature(const Scalar& value)
+        {
+            assert(storeTemperature_);
+            array_->temperature_[cellIdx_] = value;
+        }
+
+        void setEnthalpy(unsigned phaseIdx, const Scalar& value)
+        {
+            assert(enableEnergy);
+            array_->enthalpy_[storageIdx_(phaseIdx)][cellIdx_] = value;
+        }
+
+        void setInvB(unsigned phaseIdx, const Scalar& b)
+        { array_->invB_[storageIdx_(phaseIdx)][cellIdx_] = b; }
+
+        void setDensity(unsigned phaseIdx, const Scalar& rho)
+        { array_->density_[storageIdx_(phaseIdx)][cellIdx_] = rho; }
+
+        void setRs(const Scalar& newRs)
+        { array_->Rs_[cellIdx_] = newRs; }
+
+        void setRv(const Scalar& newRv)
+        { array_->Rv_[cellIdx_] = newRv; }
+
+        void setRvw(const Scalar& newRvw)
+        { array_->Rvw_[cellIdx_] = newRvw; }
+
+        void setRsw(const Scalar& newRsw)
+        { array_->Rsw_[cellIdx_] = newRsw; }
+
+        void setSaltConcentration(const Scalar& newSaltConcentration)
+        { array_->saltConcentration_[cellIdx_] = newSaltConcentration; }
+
+        void setSaltSaturation(const Scalar& newSaltSaturation)
+        { array_->saltSaturation_[cellIdx_] = newSaltSaturation; }
+    };
+
+    explicit BlackOilFluidStateArray(std::size_t numCells = 0)
+    { resize(numCells); }
+
+    /*!
+     * \brief Return the number of cells.
+     */
+    std::size_t size() const
+    { return pvtRegionIdx_.size(); }
+
+    /*!
+     * \brief Change the number of cells.
+     *
+     * The quantities of the retained cells are kept, those of new cells are
+     * zero and their PVT region index is 0.
+     */
+    void resize(std::size_t numCells)
+    {
+        pvtRegionIdx_.resize(numCells);
+        totalSaturation_.resize(numCells);
+        for (unsigned storagePhaseIdx = 0; storagePhaseIdx < numStoragePhases; ++storagePhaseIdx) {
+            pressure_[storagePhaseIdx].resize(numCells);
+            pc_[storagePhaseIdx].resize(numCells);
+            saturation_[storagePhaseIdx].resize(numCells);
+            invB_[storagePhaseIdx].resize(numCells);
+            density_[storagePhaseIdx].resize(numCells);
+            if constexpr (enableEnergy)
+                enthalpy_[storagePhaseIdx].resize(numCells);
+        }
+        if constexpr (storeTemperature_)
+            temperature_.resize(numCells);
+        if constexpr (enableDissolution) {
+            Rs_.resize(numCells);
+            Rv_.resize(numCells);
+        }
+        if constexpr (enableVapwat)
+            Rvw_.resize(numCells);
+        if constexpr (enableDissolutionInWater)
+            Rsw_.resize(numCells);
+        if constexpr (enableBrine)
+            saltConcentration_.resize(numCells);
+        if constexpr (enableSaltPrecipitation)
+            saltSaturation_.resize(numCells);
+    }
+
+    Cell operator[](std::size_t cellIdx)
+    {
+        assert(cellIdx < size());
+        return Cell(*this, cellIdx);
+    }
+
+    ConstCell operator[](std::size_t cellIdx) const
+    {
+        assert(cellIdx < size());
+        return ConstCell(*this, cellIdx);
+    }
+
+    //////
+    // contiguous arrays over all cells, for the batched PVT and material APIs
+    //////
+
+    /*!
+     * \brief The PVT region indices of all cells.
+     */
+    const unsigned* pvtRegionIndexArray() const
+    { return pvtRegionIdx_.data(); }
+
+    Scalar* pressureArray(unsigned phaseIdx)
+    { return pressure_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    const Scalar* pressureArray(unsigned phaseIdx) const
+    { return pressure_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    Scalar* saturationArray(unsigned phaseIdx)
+    { return saturation_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    const Scalar* saturationArray(unsigned phaseIdx) const
+    { return saturation_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    Scalar* pcArray(unsigned phaseIdx)
+    { return pc_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    const Scalar* pcArray(unsigned phaseIdx) const
+    { return pc_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    Scalar* invBArray(unsigned phaseIdx)
+    { return invB_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    const Scalar* invBArray(unsigned phaseIdx) const
+    { return invB_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    Scalar* densityArray(unsigned phaseIdx)
+    { return density_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    const Scalar* densityArray(unsigned phaseIdx) const
+    { return density_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    /*!
+     * \brief The specific enthalpies of a phase, nullptr unless enableEnergy is set.
+     */
+    Scalar* enthalpyArray(unsigned phaseIdx)
+    { return enthalpy_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    const Scalar* enthalpyArray(unsigned phaseIdx) const
+    { return enthalpy_[canonicalToStoragePhaseIndex_(phaseIdx)].data(); }
+
+    Scalar* totalSaturationArray()
+    { return totalSaturation_.data(); }
+
+    const Scalar* totalSaturationArray() const
+    { return totalSaturation_.data(); }
+
+    /*!
+     * \brief The temperatures, nullptr unless enableTemperature or enableEnergy is set.
+     *
+     * Without a temperature of their own, the cells are at the reservoir
+     * temperature of their PVT region.
+     */
+    Scalar* temperatureArray()
+    { return temperature_.data(); }
+
+    const Scalar* temperatureArray() const
+    { return temperature_.data(); }
+
+    /*!
+     * \brief The gas dissolution factors, nullptr unless enableDissolution is set.
+     *
+     * The same holds for the other optional quantities below and the template
+     * argument which enables them.
+     */
+    Scalar* RsArray()
+    { return Rs_.data(); }
+
+    const Scalar* RsArray() const
+    { return Rs_.data(); }
+
+    Scalar* RvArray()
+    { return Rv_.data(); }
+
+    const Scalar* RvArray() const
+    { return Rv_.data(); }
+
+    Scalar* RvwArray()
+    { return Rvw_.data(); }
+
+    const Scalar* RvwArray() const
+    { return Rvw_.data(); }
+
+    Scalar* RswArray()
+    { return Rsw_.data(); }
+
+    const Scalar* RswArray() const
+    { return Rsw_.data(); }
+
+    Scalar* saltConcentrationArray()
+    { return saltConcentration_.data(); }
+
+    const Scalar* saltConcentrationArray() const
+    { return saltConcentration_.data(); }
+
+    Scalar* saltSaturationArray()
+    { return saltSaturation_.data(); }
+
+    const Scalar* saltSaturationArray() const
+    { return saltSaturation_.data(); }
+
+private:
+    static unsigned storageToCanonicalPhaseIndex_(unsigned storagePhaseIdx)
+    {
+        if constexpr (numStoragePhases == 3)
+            return storagePhaseIdx;
+        else
+            return FluidSystem::activeToCanonicalPhaseIdx(storagePhaseIdx);
+    }
+
+    static unsigned canonicalToStoragePhaseIndex_(unsigned canonicalPhaseIdx)
+    {
+        if constexpr (numStoragePhases == 3)
+            return canonicalPhaseIdx;
+        else
+            return FluidSystem::canonicalToActivePhaseIdx(canonicalPhaseIdx);
+    }
+
+    std::vector<unsigned> pvtRegionIdx_{};
+    std::vector<Scalar> totalSaturation_{};
+    std::array<std::vector<Scalar>, numStoragePhases> pressure_{};
+    std::array<std::vector<Scalar>, numStoragePhases> pc_{};
+    std::array<std::vector<Scalar>, numStoragePhases> saturation_{};
+    std::array<std::vector<Scalar>, numStoragePhases> invB_{};
+    std::array<std::vector<Scalar>, numStoragePhases> density_{};
+
+    // empty unless enabled by the template arguments
+    std::array<std::vector<Scalar>, numStoragePhases> enthalpy_{};
+    std::vector<Scalar> temperature_{};
+    std::vector<Scalar> Rs_{};
+    std::vector<Scalar> Rv_{};
+    std::vector<Scalar> Rvw_{};
+    std::vector<Scalar> Rsw_{};
+    std::vector<Scalar> saltConcentration_{};
+    std::vector<Scalar> saltSaturation_{};
+};
+
+} // namespace Opm
+
+#endif
@@ -22,7 +22,7 @@
 */
 
 #include <config.h>
-#include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+#include <opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -40,7 +40,7 @@ namespace Opm {
 
 #if HAVE_ECL_INPUT
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 initFromState(const EclipseState& eclState, const Schedule& schedule)
 {
     if (eclState.getSimulationConfig().useEnthalpy()) {
@@ -225,7 +225,7 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
 #endif
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 initBegin(std::size_t numPvtRegions)
 {
     isInitialized_ = false;
@@ -252,7 +252,7 @@ initBegin(std::size_t numPvtRegions)
 }
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 setReferenceDensities(Scalar rhoOil,
                       Scalar rhoWater,
                       Scalar rhoGas,
@@ -264,7 +264,7 @@ setReferenceDensities(Scalar rhoOil,
 }
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::initEnd()
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::initEnd()
 {
     // calculate the final 2D functions which are used for interpolation.
     const std::size_t num_regions = molarMass_.size();
@@ -302,7 +302,7 @@ void BlackOilFluidSystem<Scalar,IndexTraits>::initEnd()
 }
 
 template <class Scalar, class IndexTraits>
-std::string_view BlackOilFluidSystem<Scalar,IndexTraits>::
+std::string_view BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 phaseName(unsigned phaseIdx)
 {
     switch (phaseIdx) {
@@ -319,7 +319,7 @@ phaseName(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-unsigned BlackOilFluidSystem<Scalar,IndexTraits>::
+unsigned BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 solventComponentIndex(unsigned phaseIdx)
 {
     switch (phaseIdx) {
@@ -336,8 +336,8 @@ solventComponentIndex(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-unsigned BlackOilFluidSystem<Scalar,IndexTraits>::
-soluteComponentIndex(unsigned phaseIdx)
+unsigned BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
+soluteComponentIndex(unsigned phaseIdx) const
 {
     switch (phaseIdx) {
     case waterPhaseIdx:
@@ -358,7 +358,7 @@ soluteComponentIndex(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-std::string_view BlackOilFluidSystem<Scalar,IndexTraits>::
+std::string_view BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 componentName(unsigned compIdx)
 {
     switch (compIdx) {
@@ -375,16 +375,16 @@ componentName(unsigned compIdx)
 }
 
 template <class Scalar, class IndexTraits>
-short BlackOilFluidSystem<Scalar,IndexTraits>::
-activeToCanonicalPhaseIdx(unsigned activePhaseIdx)
+short BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
+activeToCanonicalPhaseIdx(unsigned activePhaseIdx) const
 {
     assert(activePhaseIdx<numActivePhases());
     return activeToCanonicalPhaseIdx_[activePhaseIdx];
 }
 
 template <class Scalar, class IndexTraits>
-short BlackOilFluidSystem<Scalar,IndexTraits>::
-canonicalToActivePhaseIdx(unsigned phaseIdx)
+short BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
+canonicalToActivePhaseIdx(unsigned phaseIdx) const
 {
     assert(phaseIdx<numPhases);
     assert(phaseIsActive(phaseIdx));
@@ -392,80 +392,14 @@ canonicalToActivePhaseIdx(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 resizeArrays_(std::size_t numRegions)
 {
     molarMass_.resize(numRegions);
     referenceDensity_.resize(numRegions);
 }
 
-template<> unsigned char BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numActivePhases_ = 0;
-template<> std::array<bool, BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numPhases>
-BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::phaseIsActive_ = {false, false, false};
-
-template<> unsigned char BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numActivePhases_ = 0;
-template<> std::array<bool, BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numPhases>
-BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::phaseIsActive_ = {false, false, false};
-
-template<> std::array<short, BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::activeToCanonicalPhaseIdx_ = {0, 1, 2};
-
-template<> std::array<short, BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::activeToCanonicalPhaseIdx_ = {0, 1, 2};
-
-template<> std::array<short, BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::canonicalToActivePhaseIdx_ = {0, 1, 2};
-
-template<> std::array<short, BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::canonicalToActivePhaseIdx_ = {0, 1, 2};
-
-template<> double BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::surfaceTemperature = 0.0;
-template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::surfaceTemperature = 0.0;
-
-template<> double BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::surfacePressure = 0.0;
-template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::surfacePressure = 0.0;
-
-template<> double BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::reservoirTemperature_ = 0.0;
-template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::reservoirTemperature_ = 0.0;
-
-template<> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableDissolvedGas_ = true;
-template<> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableDissolvedGas_ = true;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableDissolvedGasInWater_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableDissolvedGasInWater_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableVaporizedOil_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableVaporizedOil_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableVaporizedWater_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableVaporizedWater_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableDiffusion_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableDiffusion_ = false;
-
-template <> std::shared_ptr<OilPvtMultiplexer<double>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::oilPvt_ = nullptr;
-template <> std::shared_ptr<OilPvtMultiplexer<float>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::oilPvt_ = nullptr;
-
-template <> std::shared_ptr<GasPvtMultiplexer<double>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::gasPvt_ = nullptr;
-template <> std::shared_ptr<GasPvtMultiplexer<float>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::gasPvt_ = nullptr;
-
-template <> std::shared_ptr<WaterPvtMultiplexer<double>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::waterPvt_ = nullptr;
-template <> std::shared_ptr<WaterPvtMultiplexer<float>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::waterPvt_ = nullptr;
-
-template <> std::vector<std::array<double, 3>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::referenceDensity_ = {};
-template <> std::vector<std::array<float, 3>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::referenceDensity_ = {};
-
-template <> std::vector<std::array<double, 3>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::molarMass_ = {};
-template <> std::vector<std::array<float, 3>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::molarMass_ = {};
-
-template <> std::vector<std::array<double, 9>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::diffusionCoefficients_ = {};
-template <> std::vector<std::array<float, 9>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::diffusionCoefficients_ = {};
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::isInitialized_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::isInitialized_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::useSaturatedTables_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::useSaturatedTables_ = false;
-
-// IMPORTANT: The following two lines must come after the template specializations above
-//    or else the static variable above will appear as undefined in the generated object file.
-template class BlackOilFluidSystem<double,BlackOilDefaultIndexTraits>;
-template class BlackOilFluidSystem<float,BlackOilDefaultIndexTraits>;
+template class BlackOilFluidSystemNonStatic<double,BlackOilDefaultIndexTraits>;
+template class BlackOilFluidSystemNonStatic<float,BlackOilDefaultIndexTraits>;
 
 } // namespace Opm
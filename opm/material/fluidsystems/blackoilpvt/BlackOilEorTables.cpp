@@ -0,0 +1,104 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/material/fluidsystems/blackoilpvt/BlackOilEorTables.hpp>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/FoamadsTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/FoammobTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/MiscTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/PlyadsTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/PlyshlogTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/PlyviscTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/PmiscTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/SsfnTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TableContainer.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TlpmixpaTable.hpp>
+#endif
+
+namespace Opm {
+
+#if HAVE_ECL_INPUT
+namespace {
+
+template <class Table, class Scalar, class XColumn, class YColumn>
+void setFunctions(BlackOilEorTables<Scalar>& tables,
+                  typename BlackOilEorTables<Scalar>::Function f,
+                  const TableContainer& container,
+                  XColumn xColumn,
+                  YColumn yColumn)
+{
+    for (std::size_t regionIdx = 0; regionIdx < container.size(); ++regionIdx) {
+        const auto& table = container.getTable<Table>(regionIdx);
+        tables.setFunction(f, regionIdx, (table.*xColumn)(), (table.*yColumn)());
+    }
+}
+
+} // Anonymous namespace
+
+template <class Scalar>
+void BlackOilEorTables<Scalar>::
+initFromState(const EclipseState& eclState)
+{
+    const auto& tm = eclState.getTableManager();
+
+    setFunctions<PlyviscTable>(*this, Function::PolymerViscosityMultiplier, tm.getPlyviscTables(),
+                               &PlyviscTable::getPolymerConcentrationColumn,
+                               &PlyviscTable::getViscosityMultiplierColumn);
+    setFunctions<PlyadsTable>(*this, Function::PolymerAdsorption, tm.getPlyadsTables(),
+                              &PlyadsTable::getPolymerConcentrationColumn,
+                              &PlyadsTable::getAdsorbedPolymerColumn);
+    setFunctions<PlyshlogTable>(*this, Function::PolymerShearMultiplier, tm.getPlyshlogTables(),
+                                &PlyshlogTable::getWaterVelocityColumn,
+                                &PlyshlogTable::getShearMultiplierColumn);
+    setFunctions<SsfnTable>(*this, Function::SolventGasKrMultiplier, tm.getSsfnTables(),
+                            &SsfnTable::getSolventFractionColumn,
+                            &SsfnTable::getGasRelPermMultiplierColumn);
+    setFunctions<SsfnTable>(*this, Function::SolventKrMultiplier, tm.getSsfnTables(),
+                            &SsfnTable::getSolventFractionColumn,
+                            &SsfnTable::getSolventRelPermMultiplierColumn);
+    setFunctions<MiscTable>(*this, Function::Miscibility, tm.getMiscTables(),
+                            &MiscTable::getSolventFractionColumn,
+                            &MiscTable::getMiscibilityColumn);
+    setFunctions<PmiscTable>(*this, Function::PressureMiscibility, tm.getPmiscTables(),
+                             &PmiscTable::getOilPhasePressureColumn,
+                             &PmiscTable::getMiscibilityColumn);
+    setFunctions<TlpmixpaTable>(*this, Function::MixingPressureMiscibility, tm.getTlpmixpaTables(),
+                                &TlpmixpaTable::getOilPhasePressureColumn,
+                                &TlpmixpaTable::getMiscibilityColumn);
+    setFunctions<FoamadsTable>(*this, Function::FoamAdsorption, tm.getFoamadsTables(),
+                               &FoamadsTable::getFoamConcentrationColumn,
+                               &FoamadsTable::getAdsorbedFoamColumn);
+    setFunctions<FoammobTable>(*this, Function::FoamMobilityMultiplier, tm.getFoammobTables(),
+                               &FoammobTable::getFoamConcentrationColumn,
+                               &FoammobTable::getMobilityMultiplierColumn);
+}
+#endif
+
+template class BlackOilEorTables<double>;
+template class BlackOilEorTables<float>;
+
+} // namespace Opm
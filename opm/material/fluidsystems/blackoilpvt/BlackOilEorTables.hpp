@@ -0,0 +1,183 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::BlackOilEorTables
+ */
+#ifndef OPM_BLACK_OIL_EOR_TABLES_HPP
+#define OPM_BLACK_OIL_EOR_TABLES_HPP
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+#if HAVE_ECL_INPUT
+class EclipseState;
+#endif
+
+/*!
+ * \brief Single-valued functions of the polymer, solvent and foam models,
+ *        converted from the ECL tables once.
+ *
+ * Each function is stored as one Tabulated1DFunction per table region, so
+ * the simulator does not need to re-interpret the raw tables for every cell.
+ * The functions are evaluated with linear extrapolation beyond their tables,
+ * and the evaluation propagates derivatives if Evaluation is an automatic
+ * differentiation type.
+ */
+template <class Scalar>
+class BlackOilEorTables
+{
+public:
+    using TabulatedFunction = Tabulated1DFunction<Scalar>;
+
+    enum class Function {
+        //! PLYVISC: water viscosity multiplier vs. polymer concentration
+        PolymerViscosityMultiplier,
+        //! PLYADS: adsorbed polymer vs. polymer concentration
+        PolymerAdsorption,
+        //! PLYSHLOG: shear multiplier vs. water velocity
+        PolymerShearMultiplier,
+        //! SSFN: gas relative permeability multiplier vs. solvent fraction
+        SolventGasKrMultiplier,
+        //! SSFN: solvent relative permeability multiplier vs. solvent fraction
+        SolventKrMultiplier,
+        //! MISC: miscibility vs. solvent fraction
+        Miscibility,
+        //! PMISC: miscibility vs. oil pressure
+        PressureMiscibility,
+        //! TLPMIXPA: miscibility for the mixing parameter vs. oil pressure
+        MixingPressureMiscibility,
+        //! FOAMADS: adsorbed foam vs. foam concentration
+        FoamAdsorption,
+        //! FOAMMOB: gas mobility multiplier vs. foam concentration
+        FoamMobilityMultiplier,
+    };
+
+    static constexpr std::size_t numFunctions = 10;
+
+#if HAVE_ECL_INPUT
+    /*!
+     * \brief Convert all tables of the deck which belong to a function.
+     *
+     * Functions whose keyword is not in the deck are left empty.
+     */
+    void initFromState(const EclipseState& eclState);
+#endif
+
+    /*!
+     * \brief Set the sampling points of a function in one region.
+     */
+    template <class XContainer, class YContainer>
+    void setFunction(Function f, unsigned regionIdx,
+                     const XContainer& x, const YContainer& y)
+    {
+        auto& regions = functions_[index_(f)];
+        if (regions.size() <= regionIdx)
+            regions.resize(regionIdx + 1);
+        regions[regionIdx].setXYContainers(x, y);
+    }
+
+    /*!
+     * \brief Whether a function is available, i.e., its keyword was given.
+     */
+    bool has(Function f) const
+    { return !functions_[index_(f)].empty(); }
+
+    /*!
+     * \brief Number of table regions of a function.
+     */
+    std::size_t numRegions(Function f) const
+    { return functions_[index_(f)].size(); }
+
+    const TabulatedFunction& function(Function f, unsigned regionIdx) const
+    {
+        const auto& regions = functions_[index_(f)];
+        if (regionIdx >= regions.size())
+            throw std::out_of_range("No EOR table for region " + std::to_string(regionIdx));
+        return regions[regionIdx];
+    }
+
+    /*!
+     * \brief Evaluate a function for one cell.
+     */
+    template <class Evaluation>
+    Evaluation eval(Function f, unsigned regionIdx, const Evaluation& x) const
+    { return function(f, regionIdx).eval(x, /*extrapolate=*/true); }
+
+    /*!
+     * \brief Evaluate the derivative of a function w.r.t. its argument.
+     */
+    template <class Evaluation>
+    Evaluation evalDerivative(Function f, unsigned regionIdx, const Evaluation& x) const
+    { return function(f, regionIdx).evalDerivative(x, /*extrapolate=*/true); }
+
+    /*!
+     * \brief Evaluate a function for many cells.
+     *
+     * \param regionIdx The table region of each cell
+     * \param x The argument of the function for each cell
+     * \param result Receives the function value of each cell
+     *
+     * The table of a region is looked up once for each run of consecutive
+     * cells of that region.
+     */
+    template <class Evaluation>
+    void evalBatch(Function f,
+                   const std::vector<unsigned>& regionIdx,
+                   const std::vector<Evaluation>& x,
+                   std::vector<Evaluation>& result) const
+    {
+        if (regionIdx.size() != x.size())
+            throw std::invalid_argument("Number of regions and arguments differ");
+
+        result.resize(x.size());
+        std::size_t begin = 0;
+        while (begin < x.size()) {
+            const unsigned region = regionIdx[begin];
+            const auto& table = function(f, region);
+            std::size_t end = begin + 1;
+            while (end < x.size() && regionIdx[end] == region)
+                ++end;
+            for (std::size_t i = begin; i < end; ++i)
+                result[i] = table.eval(x[i], /*extrapolate=*/true);
+            begin = end;
+        }
+    }
+
+private:
+    static std::size_t index_(Function f)
+    { return static_cast<std::size_t>(f); }
+
+    std::array<std::vector<TabulatedFunction>, numFunctions> functions_{};
+};
+
+} // namespace Opm
+
+#endif
@@ -149,6 +149,24 @@ public:
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
 
+    /*!
+     * \brief Tabulate the CO2 solubility of each region on a uniform
+     *        temperature-pressure grid.
+     *
+     * Afterwards, the saturated gas dissolution factor is interpolated in these
+     * tables for the fixed salinity of each region instead of solving the mutual
+     * solubility equations. Outside of the tabulated range, and if the salt
+     * concentration is taken from the fluid state, the equations are solved as
+     * before. The tables must be recomputed if the salinity or the activity model
+     * changes.
+     *
+     * \return The largest absolute deviation of the interpolated dissolution
+     *         factor from the solution of the equations, sampled at the centres of
+     *         the grid cells.
+     */
+    Scalar tabulateSolubility(Scalar minTemperature, Scalar maxTemperature, unsigned numTemperatures,
+                              Scalar minPressure, Scalar maxPressure, unsigned numPressures);
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -471,6 +489,15 @@ public:
             return 0.0;
         }
 
+        if (!rsSatTables_.empty() && !enableSaltConcentration_ &&
+            scalarValue(salinity) == salinity_[regionIdx])
+        {
+            const auto& table = rsSatTables_[regionIdx];
+            if (table.applies(temperature, pressure)) {
+                return table.eval(temperature, pressure, /*extrapolate=*/true);
+            }
+        }
+
         // calulate the equilibrium composition for the given
         // temperature and pressure.
         Evaluation xgH2O;
@@ -734,6 +761,10 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+
+    // saturated dissolution factor of each region for its fixed salinity,
+    // empty unless tabulateSolubility() has been called
+    std::vector<UniformTabulated2DFunction<Scalar>> rsSatTables_{};
 };
 
 } // namespace Opm
@@ -24,11 +24,17 @@
 #include <config.h>
 #include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
 
+#include <opm/common/ErrorMacros.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
 namespace Opm {
 
 template<class Scalar>
@@ -120,6 +126,52 @@ setReferenceDensities(unsigned regionIdx,
     h2ReferenceDensity_[regionIdx] = rhoRefH2;
 }
 
+template<class Scalar>
+Scalar BrineH2Pvt<Scalar>::
+tabulateSolubility(Scalar minTemperature, Scalar maxTemperature, unsigned numTemperatures,
+                   Scalar minPressure, Scalar maxPressure, unsigned numPressures)
+{
+    if (numTemperatures < 2 || numPressures < 2 ||
+        !(minTemperature < maxTemperature) || !(minPressure < maxPressure))
+    {
+        OPM_THROW(std::invalid_argument,
+                  "The H2 solubility table needs at least two sampling points "
+                  "along increasing temperature and pressure ranges");
+    }
+
+    // solve the equations while building the new tables
+    rsSatTables_.clear();
+
+    std::vector<UniformTabulated2DFunction<Scalar>> tables;
+    tables.reserve(numRegions());
+
+    Scalar maxError = 0.0;
+    for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+        const Scalar salinity = salinity_[regionIdx];
+        auto& table = tables.emplace_back(minTemperature, maxTemperature, numTemperatures,
+                                          minPressure, maxPressure, numPressures);
+        for (unsigned i = 0; i < numTemperatures; ++i) {
+            for (unsigned j = 0; j < numPressures; ++j) {
+                table.setSamplePoint(i, j, rsSat_(regionIdx, table.iToX(i),
+                                                         table.jToY(j), salinity));
+            }
+        }
+
+        for (unsigned i = 0; i + 1 < numTemperatures; ++i) {
+            const Scalar T = (table.iToX(i) + table.iToX(i + 1)) / 2;
+            for (unsigned j = 0; j + 1 < numPressures; ++j) {
+                const Scalar p = (table.jToY(j) + table.jToY(j + 1)) / 2;
+                const Scalar exact = rsSat_(regionIdx, T, p, salinity);
+                maxError = std::max(maxError, std::abs(table.eval(T, p, false) - exact));
+            }
+        }
+    }
+
+    rsSatTables_ = std::move(tables);
+
+    return maxError;
+}
+
 template class BrineH2Pvt<double>;
 template class BrineH2Pvt<float>;
 
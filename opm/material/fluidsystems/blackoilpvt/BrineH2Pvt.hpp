@@ -114,6 +114,24 @@ public:
     void setEnableSaltConcentration(bool yesno)
     { enableSaltConcentration_ = yesno; }
 
+    /*!
+     * \brief Tabulate the H2 solubility of each region on a uniform
+     *        temperature-pressure grid.
+     *
+     * Afterwards, the saturated gas dissolution factor is interpolated in these
+     * tables for the fixed salinity of each region instead of solving the mutual
+     * solubility equations. Outside of the tabulated range, and if the salt
+     * concentration is taken from the fluid state, the equations are solved as
+     * before. The tables must be recomputed if the salinity or the activity model
+     * changes.
+     *
+     * \return The largest absolute deviation of the interpolated dissolution
+     *         factor from the solution of the equations, sampled at the centres of
+     *         the grid cells.
+     */
+    Scalar tabulateSolubility(Scalar minTemperature, Scalar maxTemperature, unsigned numTemperatures,
+                              Scalar minPressure, Scalar maxPressure, unsigned numPressures);
+
     /*!
     * \brief Return the number of PVT regions which are considered by this PVT-object.
     */
@@ -582,6 +600,15 @@ private:
         if (!enableDissolution_)
             return 0.0;
 
+        if (!rsSatTables_.empty() && !enableSaltConcentration_ &&
+            scalarValue(salinity) == salinity_[regionIdx])
+        {
+            const auto& table = rsSatTables_[regionIdx];
+            if (table.applies(temperature, pressure)) {
+                return table.eval(temperature, pressure, /*extrapolate=*/true);
+            }
+        }
+
         // calulate the equilibrium composition for the given temperature and pressure
         LhsEval xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure,
                                                                   salinity, extrapolate);
@@ -676,6 +703,10 @@ private:
     std::vector<Scalar> salinity_{};
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
+
+    // saturated dissolution factor of each region for its fixed salinity,
+    // empty unless tabulateSolubility() has been called
+    std::vector<UniformTabulated2DFunction<Scalar>> rsSatTables_{};
 };  // end class BrineH2Pvt
 
 }  // end namespace Opm
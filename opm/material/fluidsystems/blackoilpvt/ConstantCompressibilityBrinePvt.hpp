@@ -110,44 +110,26 @@ public:
      */
     template <class Evaluation>
     Evaluation viscosity(unsigned regionIdx,
-                         const Evaluation& temperature,
+                         const Evaluation& /*temperature*/,
                          const Evaluation& pressure,
-                         const Evaluation& Rsw,
+                         const Evaluation& /*Rsw*/,
                          const Evaluation& saltconcentration) const
     {
-        // cf. ECLiPSE 2013.2 technical description, p. 114
-        Scalar pRef = referencePressure_[regionIdx];
-        const Evaluation C = compressibilityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation Cv = viscosibilityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation BwRef = formationVolumeTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation Y = (C-Cv)* (pressure - pRef);
-        Evaluation MuwRef = viscosityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-
-        const Evaluation& bw = inverseFormationVolumeFactor(regionIdx, temperature, pressure, Rsw, saltconcentration);
-
-        return MuwRef * BwRef * bw / (1 + Y * (1 + Y/2));
+        const SegmentIndex segIdx = saltSegment_(regionIdx, saltconcentration);
+        return viscosity_(regionIdx, pressure, saltconcentration, segIdx);
     }
 
-
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of the fluid phase given a set of parameters.
      */
     template <class Evaluation>
     Evaluation saturatedViscosity(unsigned regionIdx,
-                                  const Evaluation& temperature,
+                                  const Evaluation& /*temperature*/,
                                   const Evaluation& pressure,
                                   const Evaluation& saltconcentration) const
     {
-        Scalar pRef = referencePressure_[regionIdx];
-        const Evaluation C = compressibilityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation Cv = viscosibilityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation BwRef = formationVolumeTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation Y = (C-Cv)* (pressure - pRef);
-        Evaluation MuwRef = viscosityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-
-        const Evaluation& bw = saturatedInverseFormationVolumeFactor(regionIdx, temperature, pressure, saltconcentration);
-
-        return MuwRef * BwRef * bw / (1 + Y * (1 + Y/2));
+        const SegmentIndex segIdx = saltSegment_(regionIdx, saltconcentration);
+        return viscosity_(regionIdx, pressure, saltconcentration, segIdx);
     }
 
     /*!
@@ -173,14 +155,54 @@ public:
                                             const Evaluation& /*Rsw*/,
                                             const Evaluation& saltconcentration) const
     {
-        Scalar pRef = referencePressure_[regionIdx];
-
-        const Evaluation BwRef = formationVolumeTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation C = compressibilityTables_[regionIdx].eval(saltconcentration, /*extrapolate=*/true);
-        const Evaluation X = C * (pressure - pRef);
+        const SegmentIndex segIdx = saltSegment_(regionIdx, saltconcentration);
+        return inverseFormationVolumeFactor_(regionIdx, pressure, saltconcentration, segIdx);
+    }
 
-        return (1.0 + X * (1.0 + X / 2.0)) / BwRef;
+    /*!
+     * \brief Returns the dynamic viscosity [Pa s] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The search for the salt concentration
+     * in the PVTWSALT table of a cell starts at the segment of the previous
+     * cell, so cells with similar salt concentrations are cheap to look up.
+     */
+    template <class Evaluation>
+    void viscosity(std::size_t numCells,
+                   const unsigned* regionIdx,
+                   const Evaluation* /*temperature*/,
+                   const Evaluation* pressure,
+                   const Evaluation* /*Rsw*/,
+                   const Evaluation* saltconcentration,
+                   Evaluation* result) const
+    {
+        SegmentIndex hint{0};
+        for (std::size_t i = 0; i < numCells; ++i) {
+            hint = saltSegment_(regionIdx[i], saltconcentration[i], hint);
+            result[i] = viscosity_(regionIdx[i], pressure[i], saltconcentration[i], hint);
+        }
+    }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] of the fluid phase for a
+     *        batch of cells.
+     *
+     * \copydetails viscosity(std::size_t, const unsigned*, const Evaluation*, const Evaluation*, const Evaluation*, const Evaluation*, Evaluation*) const
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(std::size_t numCells,
+                                      const unsigned* regionIdx,
+                                      const Evaluation* /*temperature*/,
+                                      const Evaluation* pressure,
+                                      const Evaluation* /*Rsw*/,
+                                      const Evaluation* saltconcentration,
+                                      Evaluation* result) const
+    {
+        SegmentIndex hint{0};
+        for (std::size_t i = 0; i < numCells; ++i) {
+            hint = saltSegment_(regionIdx[i], saltconcentration[i], hint);
+            result[i] = inverseFormationVolumeFactor_(regionIdx[i], pressure[i],
+                                                      saltconcentration[i], hint);
+        }
     }
 
     /*!
@@ -234,6 +256,58 @@ public:
     { return viscosibilityTables_; }
 
 private:
+    // All tables of a region are sampled at the salt concentrations of the
+    // PVTWSALT keyword, so a single segment search serves all of them.
+    template <class Evaluation>
+    SegmentIndex saltSegment_(unsigned regionIdx, const Evaluation& saltconcentration) const
+    {
+        return formationVolumeTables_[regionIdx].findSegmentIndex(saltconcentration,
+                                                                  /*extrapolate=*/true);
+    }
+
+    template <class Evaluation>
+    SegmentIndex saltSegment_(unsigned regionIdx,
+                              const Evaluation& saltconcentration,
+                              SegmentIndex hint) const
+    {
+        return formationVolumeTables_[regionIdx].findSegmentIndex(saltconcentration, hint,
+                                                                  /*extrapolate=*/true);
+    }
+
+    template <class Evaluation>
+    Evaluation inverseFormationVolumeFactor_(unsigned regionIdx,
+                                             const Evaluation& pressure,
+                                             const Evaluation& saltconcentration,
+                                             SegmentIndex segIdx) const
+    {
+        Scalar pRef = referencePressure_[regionIdx];
+
+        const Evaluation BwRef = formationVolumeTables_[regionIdx].eval(saltconcentration, segIdx);
+        const Evaluation C = compressibilityTables_[regionIdx].eval(saltconcentration, segIdx);
+        const Evaluation X = C * (pressure - pRef);
+
+        return (1.0 + X * (1.0 + X / 2.0)) / BwRef;
+    }
+
+    template <class Evaluation>
+    Evaluation viscosity_(unsigned regionIdx,
+                          const Evaluation& pressure,
+                          const Evaluation& saltconcentration,
+                          SegmentIndex segIdx) const
+    {
+        // cf. ECLiPSE 2013.2 technical description, p. 114
+        Scalar pRef = referencePressure_[regionIdx];
+        const Evaluation C = compressibilityTables_[regionIdx].eval(saltconcentration, segIdx);
+        const Evaluation Cv = viscosibilityTables_[regionIdx].eval(saltconcentration, segIdx);
+        const Evaluation BwRef = formationVolumeTables_[regionIdx].eval(saltconcentration, segIdx);
+        const Evaluation Y = (C-Cv)* (pressure - pRef);
+        const Evaluation MuwRef = viscosityTables_[regionIdx].eval(saltconcentration, segIdx);
+
+        const Evaluation bw = inverseFormationVolumeFactor_(regionIdx, pressure, saltconcentration, segIdx);
+
+        return MuwRef * BwRef * bw / (1 + Y * (1 + Y/2));
+    }
+
     std::vector<Scalar> waterReferenceDensity_{};
     std::vector<Scalar> referencePressure_{};
     std::vector<TabulatedFunction> formationVolumeTables_{};
@@ -35,6 +35,8 @@
 #include <opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetHumidGasPvt.hpp>
 
+#include <cstddef>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -261,6 +263,46 @@ public:
                                   const Evaluation& Rv) const
     { OPM_GAS_PVT_MULTIPLEXER_CALL(return pvtImpl.saturationPressure(regionIdx, temperature, Rv)); }
 
+    /*!
+     * \brief Evaluates the dynamic viscosity [Pa s] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell.
+     */
+    template <class Evaluation>
+    void viscosity(std::size_t numCells,
+                   const unsigned* regionIdx,
+                   const Evaluation* temperature,
+                   const Evaluation* pressure,
+                   const Evaluation* Rv,
+                   const Evaluation* Rvw,
+                   Evaluation* result) const
+    {
+        OPM_GAS_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.viscosity(regionIdx[i], temperature[i], pressure[i], Rv[i], Rvw[i]);
+            }, break);
+    }
+
+    /*!
+     * \brief Evaluates the inverse formation volume factor [-] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(std::size_t numCells,
+                                      const unsigned* regionIdx,
+                                      const Evaluation* temperature,
+                                      const Evaluation* pressure,
+                                      const Evaluation* Rv,
+                                      const Evaluation* Rvw,
+                                      Evaluation* result) const
+    {
+        OPM_GAS_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i], Rv[i], Rvw[i]);
+            }, break);
+    }
+
     /*!
      * \copydoc BaseFluidSystem::diffusionCoefficient
      */
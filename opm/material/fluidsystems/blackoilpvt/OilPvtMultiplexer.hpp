@@ -34,6 +34,8 @@
 #include <opm/material/fluidsystems/blackoilpvt/LiveOilPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp>
 
+#include <cstddef>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -244,6 +246,62 @@ public:
       OPM_OIL_PVT_MULTIPLEXER_CALL(return pvtImpl.diffusionCoefficient(temperature, pressure, compIdx));
     }
 
+    /*!
+     * \brief Evaluates the dynamic viscosity [Pa s] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell.
+     */
+    template <class Evaluation>
+    void viscosity(std::size_t numCells,
+                   const unsigned* regionIdx,
+                   const Evaluation* temperature,
+                   const Evaluation* pressure,
+                   const Evaluation* Rs,
+                   Evaluation* result) const
+    {
+        OPM_OIL_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.viscosity(regionIdx[i], temperature[i], pressure[i], Rs[i]);
+            }, break);
+    }
+
+    /*!
+     * \brief Evaluates the inverse formation volume factor [-] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(std::size_t numCells,
+                                      const unsigned* regionIdx,
+                                      const Evaluation* temperature,
+                                      const Evaluation* pressure,
+                                      const Evaluation* Rs,
+                                      Evaluation* result) const
+    {
+        OPM_OIL_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i], Rs[i]);
+            }, break);
+    }
+
+    /*!
+     * \brief Evaluates the gas dissolution factor \f$R_s\f$ [m^3/m^3] of saturated oil for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell.
+     */
+    template <class Evaluation>
+    void saturatedGasDissolutionFactor(std::size_t numCells,
+                                       const unsigned* regionIdx,
+                                       const Evaluation* temperature,
+                                       const Evaluation* pressure,
+                                       Evaluation* result) const
+    {
+        OPM_OIL_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.saturatedGasDissolutionFactor(regionIdx[i], temperature[i], pressure[i]);
+            }, break);
+    }
+
     void setApproach(OilPvtApproach appr);
 
     /*!
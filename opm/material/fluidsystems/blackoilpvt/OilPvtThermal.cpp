@@ -80,8 +80,8 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
         }
 
         for (unsigned regionIdx = 0; regionIdx < regions; ++regionIdx) {
-            const auto& TCol = oilvisctTables[regionIdx].getColumn("Temperature").vectorCopy();
-            const auto& muCol = oilvisctTables[regionIdx].getColumn("Viscosity").vectorCopy();
+            const auto& TCol = oilvisctTables[regionIdx].getColumn("Temperature");
+            const auto& muCol = oilvisctTables[regionIdx].getColumn("Viscosity");
             oilvisctCurves_[regionIdx].setXYContainers(TCol, muCol);
 
             viscrefPress_[regionIdx] = viscrefTable[regionIdx].reference_pressure;
@@ -172,7 +172,7 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
                 u += 0.5*(c_v0 + c_v1)*(T1 - T0);
             }
 
-            internalEnergyCurves_[regionIdx].setXYContainers(temperatureColumn.vectorCopy(), uSamples);
+            internalEnergyCurves_[regionIdx].setXYContainers(temperatureColumn, uSamples);
         }
     }
 }
@@ -33,6 +33,8 @@
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp>
 
+#include <cstddef>
+
 #define OPM_WATER_PVT_MULTIPLEXER_CALL(codeToCall, ...)                                \
     switch (approach_) {                                                               \
     case WaterPvtApproach::ConstantCompressibilityWater: {                             \
@@ -235,6 +237,60 @@ public:
       OPM_WATER_PVT_MULTIPLEXER_CALL(return pvtImpl.diffusionCoefficient(temperature, pressure, compIdx));
     }
 
+    /*!
+     * \brief Evaluates the dynamic viscosity [Pa s] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell. Brine PVT keeps the segment of the salt
+     * concentration table from one cell to the next.
+     */
+    template <class Evaluation>
+    void viscosity(std::size_t numCells,
+                   const unsigned* regionIdx,
+                   const Evaluation* temperature,
+                   const Evaluation* pressure,
+                   const Evaluation* Rsw,
+                   const Evaluation* saltconcentration,
+                   Evaluation* result) const
+    {
+        if (approach_ == WaterPvtApproach::ConstantCompressibilityBrine) {
+            getRealPvt<WaterPvtApproach::ConstantCompressibilityBrine>()
+                .viscosity(numCells, regionIdx, temperature, pressure, Rsw, saltconcentration, result);
+            return;
+        }
+
+        OPM_WATER_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.viscosity(regionIdx[i], temperature[i], pressure[i], Rsw[i], saltconcentration[i]);
+            }, break);
+    }
+
+    /*!
+     * \brief Evaluates the inverse formation volume factor [-] of the fluid phase for a batch of cells.
+     *
+     * All arrays hold numCells elements. The PVT approach is dispatched once for the
+     * whole batch rather than once per cell. Brine PVT keeps the segment of the salt
+     * concentration table from one cell to the next.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactor(std::size_t numCells,
+                                      const unsigned* regionIdx,
+                                      const Evaluation* temperature,
+                                      const Evaluation* pressure,
+                                      const Evaluation* Rsw,
+                                      const Evaluation* saltconcentration,
+                                      Evaluation* result) const
+    {
+        if (approach_ == WaterPvtApproach::ConstantCompressibilityBrine) {
+            getRealPvt<WaterPvtApproach::ConstantCompressibilityBrine>()
+                .inverseFormationVolumeFactor(numCells, regionIdx, temperature, pressure, Rsw, saltconcentration, result);
+            return;
+        }
+
+        OPM_WATER_PVT_MULTIPLEXER_CALL(for (std::size_t i = 0; i < numCells; ++i) {
+                result[i] = pvtImpl.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i], Rsw[i], saltconcentration[i]);
+            }, break);
+    }
+
     void setApproach(WaterPvtApproach appr);
 
     /*!
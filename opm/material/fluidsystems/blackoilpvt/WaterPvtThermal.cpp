@@ -134,8 +134,8 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
         }
 
         for (unsigned regionIdx = 0; regionIdx < regions; ++ regionIdx) {
-            const auto& T = watvisctTables[regionIdx].getColumn("Temperature").vectorCopy();
-            const auto& mu = watvisctTables[regionIdx].getColumn("Viscosity").vectorCopy();
+            const auto& T = watvisctTables[regionIdx].getColumn("Temperature");
+            const auto& mu = watvisctTables[regionIdx].getColumn("Viscosity");
             watvisctCurves_[regionIdx].setXYContainers(T, mu);
 
             viscrefPress_[regionIdx] = viscrefTables[regionIdx].reference_pressure;
@@ -174,7 +174,7 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
                 u += 0.5*(c_v0 + c_v1)*(T1 - T0);
             }
 
-            internalEnergyCurves_[regionIdx].setXYContainers(temperatureColumn.vectorCopy(), uSamples);
+            internalEnergyCurves_[regionIdx].setXYContainers(temperatureColumn, uSamples);
         }
     }
 }
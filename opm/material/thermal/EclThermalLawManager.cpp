@@ -130,6 +130,8 @@ initHeatcr_(const EclipseState& eclState, size_t numElems,
     const std::vector<double>& heatcrData = fieldPropsDoubleOnLeafAssigner(eclState.fieldProps(), "HEATCR");
     const std::vector<double>& heatcrtData = fieldPropsDoubleOnLeafAssigner(eclState.fieldProps(), "HEATCRT");
     solidEnergyLawParams_.resize(numElems);
+    rockHeatCapacity_.assign(heatcrData.begin(), heatcrData.begin() + numElems);
+    dRockHeatCapacity_dT_.assign(heatcrtData.begin(), heatcrtData.begin() + numElems);
     for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParam = solidEnergyLawParams_[elemIdx];
         elemParam.setSolidEnergyApproach(EclSolidEnergyApproach::Heatcr);
@@ -172,6 +174,11 @@ initSpecrock_(const EclipseState& eclState,
 
         multiplexerParams.finalize();
     }
+
+    // group the elements by region for the batched evaluation
+    satnumRegionElems_.assign(numSatRegions, {});
+    for (unsigned elemIdx = 0; elemIdx < elemToSatnumIdx_.size(); ++elemIdx)
+        satnumRegionElems_[elemToSatnumIdx_[elemIdx]].push_back(elemIdx);
 }
 
 template<class Scalar, class FluidSystem>
@@ -201,6 +208,8 @@ initThconr_(const EclipseState& eclState, size_t numElems,
         thconsfData =  fieldPropsDoubleOnLeafAssigner(fp, "THCONSF");
 
     thermalConductionLawParams_.resize(numElems);
+    thermalConductivity_.resize(numElems);
+    dThermalConductivity_dSg_.resize(numElems);
     for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParams = thermalConductionLawParams_[elemIdx];
         elemParams.setThermalConductionApproach(EclThermalConductionApproach::Thconr);
@@ -210,6 +219,8 @@ initThconr_(const EclipseState& eclState, size_t numElems,
         double thconsf = thconsfData.empty() ? 0.0 : thconsfData[elemIdx];
         thconrElemParams.setReferenceTotalThermalConductivity(thconr);
         thconrElemParams.setDTotalThermalConductivity_dSg(thconsf);
+        thermalConductivity_[elemIdx] = thconr;
+        dThermalConductivity_dSg_[elemIdx] = thconsf;
 
         thconrElemParams.finalize();
         elemParams.finalize();
@@ -244,6 +255,7 @@ initThc_(const EclipseState& eclState, size_t numElems,
     const std::vector<double>& poroData = fieldPropsDoubleOnLeafAssigner(fp, "PORO");
 
     thermalConductionLawParams_.resize(numElems);
+    thermalConductivity_.resize(numElems);
     for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParams = thermalConductionLawParams_[elemIdx];
         elemParams.setThermalConductionApproach(EclThermalConductionApproach::Thc);
@@ -259,6 +271,11 @@ initThc_(const EclipseState& eclState, size_t numElems,
         thcElemParams.setThcgas(thcgas);
         thcElemParams.setThcwater(thcwater);
 
+        // the THC* conductivity does not depend on the solution, see EclThcLaw
+        const double poro = poroData[elemIdx];
+        thermalConductivity_[elemIdx] =
+            poro*(thcoil + thcgas + thcwater) / 3.0 + (1.0 - poro)*thcrock;
+
         thcElemParams.finalize();
         elemParams.finalize();
     }
@@ -37,7 +37,9 @@
 #include "EclThermalConductionLawMultiplexer.hpp"
 #include "EclThermalConductionLawMultiplexerParams.hpp"
 
+#include <cstddef>
 #include <functional>
+#include <stdexcept>
 #include <vector>
 
 namespace Opm {
@@ -73,6 +75,95 @@ public:
 
     const ThermalConductionLawParams& thermalConductionLawParams(unsigned elemIdx) const;
 
+    /*!
+     * \brief Compute the volumetric internal energy of the rock of all cells in one call.
+     *
+     * The solid energy approach is selected once for all cells instead of once per
+     * cell, and the parameters are read from contiguous per-cell (HEATCR) or
+     * per-region (SPECROCK) storage.
+     *
+     * \param values Container of per-cell results, indexed by the cell index
+     * \param fluidStates Container of per-cell fluid states, indexed by the cell index
+     */
+    template <class ValueVector, class FluidStateVector>
+    void solidInternalEnergies(ValueVector& values, const FluidStateVector& fluidStates) const
+    {
+        using Evaluation = typename ValueVector::value_type;
+
+        switch (solidEnergyApproach_) {
+        case EclSolidEnergyApproach::Heatcr: {
+            // see EclHeatcrLaw
+            const Scalar refTemperature = HeatcrLawParams::referenceTemperature();
+            for (std::size_t elemIdx = 0; elemIdx < fluidStates.size(); ++elemIdx) {
+                const Evaluation deltaT = fluidStates[elemIdx].temperature(/*phaseIdx=*/0) - refTemperature;
+                values[elemIdx] = deltaT*(rockHeatCapacity_[elemIdx]
+                                          + deltaT*dRockHeatCapacity_dT_[elemIdx] / 2.0);
+            }
+            break;
+        }
+
+        case EclSolidEnergyApproach::Specrock:
+            for (std::size_t satnumIdx = 0; satnumIdx < satnumRegionElems_.size(); ++satnumIdx) {
+                const auto& internalEnergy = solidEnergyLawParams_[satnumIdx]
+                    .template getRealParams<EclSolidEnergyApproach::Specrock>().internalEnergyFunction();
+                for (const unsigned elemIdx : satnumRegionElems_[satnumIdx]) {
+                    values[elemIdx] = internalEnergy.eval(fluidStates[elemIdx].temperature(/*phaseIdx=*/0),
+                                                          /*extrapolate=*/true);
+                }
+            }
+            break;
+
+        case EclSolidEnergyApproach::Null:
+            for (std::size_t elemIdx = 0; elemIdx < fluidStates.size(); ++elemIdx)
+                values[elemIdx] = 0.0;
+            break;
+
+        default:
+            throw std::runtime_error("Attempting to evaluate the solid energy law "
+                                     "without a known approach being defined by the deck.");
+        }
+    }
+
+    /*!
+     * \brief Compute the total thermal conductivity of all cells in one call.
+     *
+     * \copydetails solidInternalEnergies()
+     */
+    template <class ValueVector, class FluidStateVector>
+    void thermalConductivities(ValueVector& values, const FluidStateVector& fluidStates) const
+    {
+        using Evaluation = typename ValueVector::value_type;
+        static constexpr int gasPhaseIdx = FluidSystem::gasPhaseIdx;
+
+        switch (thermalConductivityApproach_) {
+        case EclThermalConductionApproach::Thconr:
+            // see EclThconrLaw
+            if (FluidSystem::phaseIsActive(gasPhaseIdx)) {
+                for (std::size_t elemIdx = 0; elemIdx < fluidStates.size(); ++elemIdx) {
+                    const Evaluation& Sg = decay<Evaluation>(fluidStates[elemIdx].saturation(gasPhaseIdx));
+                    values[elemIdx] = thermalConductivity_[elemIdx]
+                        * (1.0 - dThermalConductivity_dSg_[elemIdx]*Sg);
+                }
+                break;
+            }
+            [[fallthrough]];
+
+        case EclThermalConductionApproach::Thc:
+            for (std::size_t elemIdx = 0; elemIdx < fluidStates.size(); ++elemIdx)
+                values[elemIdx] = thermalConductivity_[elemIdx];
+            break;
+
+        case EclThermalConductionApproach::Null:
+            for (std::size_t elemIdx = 0; elemIdx < fluidStates.size(); ++elemIdx)
+                values[elemIdx] = 0.0;
+            break;
+
+        default:
+            throw std::runtime_error("Attempting to evaluate the thermal conduction law "
+                                     "without a known approach being defined by the deck.");
+        }
+    }
+
 private:
     /*!
      * \brief Initialize the parameters for the solid energy law using using HEATCR and friends.
@@ -120,6 +211,13 @@ private:
 
     std::vector<SolidEnergyLawParams> solidEnergyLawParams_;
     std::vector<ThermalConductionLawParams> thermalConductionLawParams_;
+
+    // structure-of-arrays copies of the parameters for the batched evaluation
+    std::vector<Scalar> rockHeatCapacity_;
+    std::vector<Scalar> dRockHeatCapacity_dT_;
+    std::vector<std::vector<unsigned>> satnumRegionElems_;
+    std::vector<Scalar> thermalConductivity_; // THCONR, or the THC* average
+    std::vector<Scalar> dThermalConductivity_dSg_;
 };
 } // namespace Opm
 
@@ -31,6 +31,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <exception>
 #include <iterator>
 #include <optional>
@@ -39,45 +41,86 @@
 #include <utility>
 #include <vector>
 
-void
-Opm::data::InterRegFlowMap::
-addConnection(const int        r1,
-              const int        r2,
-              const FlowRates& rates)
-{
-    if ((r1 < 0) || (r2 < 0)) {
-        throw std::invalid_argument {
-            "Region indices must be non-negative.  Got (r1,r2) = ("
-            + std::to_string(r1) + ", " + std::to_string(r2)
-            + ')'
-        };
+namespace {
+
+    void checkRegionIndices(const int r1, const int r2)
+    {
+        if ((r1 < 0) || (r2 < 0)) {
+            throw std::invalid_argument {
+                "Region indices must be non-negative.  Got (r1,r2) = ("
+                + std::to_string(r1) + ", " + std::to_string(r2)
+                + ')'
+            };
+        }
     }
 
-    if (r1 == r2) {
-        // Internal to a region.  Skip.
-        return;
+    /// Store connection rates in the direction from low to high region
+    /// index.  Returns false for connections internal to a region.
+    template <class Window, class RateBuffer, class FlowRates>
+    bool orientConnection(int& r1, int& r2, RateBuffer& rates, const FlowRates& flow)
+    {
+        checkRegionIndices(r1, r2);
+
+        if (r1 == r2) {
+            // Internal to a region.  Skip.
+            return false;
+        }
+
+        using ElmT = typename Window::ElmT;
+
+        const auto one   = ElmT{1};
+        const auto sign  = (r1 < r2) ? one : -one;
+        const auto start = rates.size();
+
+        if (std::signbit(sign)) {
+            std::swap(r1, r2);
+        }
+
+        rates.insert(rates.end(), Window::bufferSize(), ElmT{0});
+        Window { rates.begin() + start, rates.end() }.addFlow(sign, flow);
+
+        return true;
     }
 
-    const auto one   = Window::ElmT{1};
-    const auto sign  = (r1 < r2) ? one : -one;
-    const auto start = this->rates_.size();
+} // Anonymous namespace
 
-    auto low = r1, high = r2;
-    if (std::signbit(sign)) {
-        std::swap(low, high);
+void
+Opm::data::InterRegFlowMap::
+addConnection(int              r1,
+              int              r2,
+              const FlowRates& rates)
+{
+    if (orientConnection<Window>(r1, r2, this->rates_, rates)) {
+        this->connections_.addConnection(r1, r2);
     }
+}
 
-    this->connections_.addConnection(low, high);
+void
+Opm::data::InterRegFlowMap::Contributions::
+addConnection(int              r1,
+              int              r2,
+              const FlowRates& rates)
+{
+    if (orientConnection<Window>(r1, r2, this->rates_, rates)) {
+        this->low_.push_back(r1);
+        this->high_.push_back(r2);
+    }
+}
 
-    this->rates_.insert(this->rates_.end(), Window::bufferSize(), Window::ElmT{0});
-    Window { this->rates_.begin() + start, this->rates_.end() }.addFlow(sign, rates);
+void Opm::data::InterRegFlowMap::prepareThreadBuffers(const std::size_t numThreads)
+{
+    this->mergeThreadBuffers();
+    this->threadBuffers_.resize(numThreads);
 }
 
 void Opm::data::InterRegFlowMap::compress(const std::size_t numRegions)
 {
+    this->mergeThreadBuffers();
     this->connections_.compress(numRegions);
 
-    const auto v = this->rates_;
+    auto v = RateBuffer{};
+    v.swap(this->rates_);
+
     constexpr auto sz = Window::bufferSize();
     const auto& dstIx = this->connections_.compressedIndexMap();
 
@@ -121,13 +164,7 @@ std::optional<std::pair<
 >>
 Opm::data::InterRegFlowMap::getInterRegFlows(const int r1, const int r2) const
 {
-    if ((r1 < 0) || (r2 < 0)) {
-        throw std::invalid_argument {
-            "Region indices must be non-negative.  Got (r1,r2) = ("
-            + std::to_string(r1) + ", " + std::to_string(r2)
-            + ')'
-        };
-    }
+    checkRegionIndices(r1, r2);
 
     if (r1 == r2) {
         // Internal to a region.  Skip.
@@ -171,4 +208,26 @@ void Opm::data::InterRegFlowMap::clear()
 {
     this->connections_.clear();
     this->rates_.clear();
+
+    for (auto& buffer : this->threadBuffers_) {
+        buffer.low_.clear();
+        buffer.high_.clear();
+        buffer.rates_.clear();
+    }
+}
+
+void Opm::data::InterRegFlowMap::mergeThreadBuffers()
+{
+    for (auto& buffer : this->threadBuffers_) {
+        const auto numConn = buffer.low_.size();
+        for (auto conn = 0*numConn; conn < numConn; ++conn) {
+            this->connections_.addConnection(buffer.low_[conn], buffer.high_[conn]);
+        }
+
+        this->rates_.insert(this->rates_.end(), buffer.rates_.begin(), buffer.rates_.end());
+
+        buffer.low_.clear();
+        buffer.high_.clear();
+        buffer.rates_.clear();
+    }
 }
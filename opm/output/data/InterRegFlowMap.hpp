@@ -85,6 +85,41 @@ namespace Opm { namespace data {
         /// If both region IDs are the same then this function does nothing.
         void addConnection(const int r1, const int r2, const FlowRates& rates);
 
+        /// Connections collected by a single thread.  Merged into the
+        /// owning map by the next call to compress().
+        class Contributions
+        {
+        public:
+            /// Add flow rate connection between regions.  Same semantics
+            /// as InterRegFlowMap::addConnection().
+            void addConnection(const int r1, const int r2, const FlowRates& rates);
+
+        private:
+            friend class InterRegFlowMap;
+
+            Neighbours low_{};
+            Neighbours high_{};
+            RateBuffer rates_{};
+        };
+
+        /// Prepare independent connection buffers for concurrent calls to
+        /// addConnection() from multiple threads, typically one per
+        /// OpenMP thread.  Buffers are merged in order of increasing
+        /// thread index, so the accumulated rates do not depend on thread
+        /// scheduling for a fixed work distribution.
+        ///
+        /// \param[in] numThreads Number of thread buffers.
+        void prepareThreadBuffers(const std::size_t numThreads);
+
+        /// Connection buffer of a single thread.
+        ///
+        /// \param[in] thread Zero-based thread index.  Must be less than
+        ///   the number of buffers passed to prepareThreadBuffers().
+        Contributions& threadBuffer(const std::size_t thread)
+        {
+            return this->threadBuffers_[thread];
+        }
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -115,6 +150,49 @@ namespace Opm { namespace data {
         std::optional<std::pair<ReadOnlyWindow, ReadOnlyWindow::ElmT>>
         getInterRegFlows(const int r1, const int r2) const;
 
+        /// Sum the maps of all ranks onto rank zero along a binomial tree.
+        ///
+        /// Each rank compresses its own map, then receives and merges the
+        /// maps of its children before sending the merged result to its
+        /// parent.  Only compressed CSR data and accumulated rates are
+        /// ever sent, and no rank receives more than log2(size) messages.
+        /// The map is valid on rank zero only when the function returns.
+        ///
+        /// \param[in] rank Rank of this process.
+        ///
+        /// \param[in] size Number of processes.
+        ///
+        /// \param[in] numRegions Number of rows in the CSR matrix.
+        ///
+        /// \param[in] send Point-to-point send operation.  Called as \code
+        ///   send(destRank, map) \endcode and expected to pack the map
+        ///   through write().
+        ///
+        /// \param[in] receive Point-to-point receive operation.  Called as
+        ///   \code receive(srcRank, map) \endcode and expected to unpack
+        ///   the incoming message into the map through read().
+        template <class Send, class Receive>
+        void reduce(const int         rank,
+                    const int         size,
+                    const std::size_t numRegions,
+                    Send&&            send,
+                    Receive&&         receive)
+        {
+            this->compress(numRegions);
+
+            for (auto step = 1; step < size; step *= 2) {
+                if (rank % (2 * step) != 0) {
+                    send(rank - step, std::as_const(*this));
+                    return;
+                }
+
+                if (rank + step < size) {
+                    receive(rank + step, *this);
+                    this->compress(numRegions);
+                }
+            }
+        }
+
         // MessageBufferType API should be similar to Dune::MessageBufferIF
         template <class MessageBufferType>
         void write(MessageBufferType& buffer) const
@@ -144,6 +222,12 @@ namespace Opm { namespace data {
         Graph connections_{};
         RateBuffer rates_{};
 
+        /// Connections added concurrently, not yet merged.
+        std::vector<Contributions> threadBuffers_{};
+
+        /// Move contents of all thread buffers into the main buffers.
+        void mergeThreadBuffers();
+
         template <typename T, class A, class MessageBufferType>
         void writeVector(const std::vector<T,A>& vec,
                          MessageBufferType&      buffer) const
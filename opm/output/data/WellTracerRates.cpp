@@ -0,0 +1,65 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <opm/output/data/WellTracerRates.hpp>
+
+#include <opm/output/data/Wells.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm { namespace data {
+
+WellTracerRates::WellTracerRates(const Wells&                    wellSol,
+                                 const std::vector<std::string>& wells,
+                                 const std::vector<std::string>& tracers)
+    : numWells_  (wells.size())
+    , numTracers_(tracers.size())
+    , rates_     (wells.size() * tracers.size(), 0.0)
+{
+    if (this->rates_.empty()) {
+        return;
+    }
+
+    auto column = std::unordered_map<std::string, std::size_t>{};
+    for (auto i = 0*tracers.size(); i < tracers.size(); ++i) {
+        column.emplace(tracers[i], i);
+    }
+
+    for (auto w = 0*wells.size(); w < wells.size(); ++w) {
+        const auto xwPos = wellSol.find(wells[w]);
+        if ((xwPos == wellSol.end()) ||
+            ! xwPos->second.rates.has(Rates::opt::tracer))
+        {
+            continue;
+        }
+
+        auto* row = this->rates_.data() + w*this->numTracers_;
+        for (const auto& [tracer, rate] : xwPos->second.rates.tracer) {
+            if (const auto colPos = column.find(tracer); colPos != column.end()) {
+                row[colPos->second] = rate;
+            }
+        }
+    }
+}
+
+}} // namespace Opm::data
@@ -0,0 +1,82 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef OPM_OUTPUT_DATA_WELLTRACERRATES_HPP
+#define OPM_OUTPUT_DATA_WELLTRACERRATES_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace data {
+
+    class Wells;
+
+    /// Tracer rates of a collection of wells as a dense well by tracer
+    /// matrix.
+    ///
+    /// Well solutions store their tracer rates in a map keyed by tracer
+    /// name.  The matrix is filled in a single pass over each well's map,
+    /// after which the rate of any well and tracer is a plain array access.
+    class WellTracerRates
+    {
+    public:
+        WellTracerRates() = default;
+
+        /// Tracer rates of \p wells, one row per well, and of \p tracers,
+        /// one column per tracer.  Tracers are identified by their keys in
+        /// the well solution, e.g., "T1", "FT1" or "ST1", and must be
+        /// distinct.  Rates of wells without a solution, and of tracers
+        /// without a rate, are zero.
+        WellTracerRates(const Wells&                    wellSol,
+                        const std::vector<std::string>& wells,
+                        const std::vector<std::string>& tracers);
+
+        std::size_t numWells() const
+        {
+            return this->numWells_;
+        }
+
+        std::size_t numTracers() const
+        {
+            return this->numTracers_;
+        }
+
+        /// Rate of tracer number \p tracer in well number \p well.
+        double rate(const std::size_t well, const std::size_t tracer) const
+        {
+            return this->rates_[well*this->numTracers_ + tracer];
+        }
+
+        /// Rates of all tracers in well number \p well.
+        const double* wellRates(const std::size_t well) const
+        {
+            return this->rates_.data() + well*this->numTracers_;
+        }
+
+    private:
+        std::size_t numWells_{0};
+        std::size_t numTracers_{0};
+        std::vector<double> rates_{};
+    };
+
+}} // namespace Opm::data
+
+#endif // OPM_OUTPUT_DATA_WELLTRACERRATES_HPP
@@ -0,0 +1,374 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/data/WellsTable.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    constexpr auto tracerBit = static_cast<std::uint32_t>(Opm::data::Rates::opt::tracer);
+
+    Opm::data::Rates::opt rateOption(const std::size_t slot)
+    {
+        return static_cast<Opm::data::Rates::opt>(std::uint32_t{1} << slot);
+    }
+
+    template <typename T>
+    void appendVector(std::vector<T>& dest, const std::vector<T>& src)
+    {
+        dest.insert(dest.end(), src.begin(), src.end());
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace data {
+
+WellsTable::WellsTable(const Wells& wells)
+{
+    this->names_.reserve(wells.size());
+
+    auto numConn = std::size_t{0};
+    for (const auto& well : wells) {
+        numConn += well.second.connections.size();
+    }
+
+    this->connIndex_.reserve(numConn);
+    this->connMask_.reserve(numConn);
+    this->connRates_.reserve(numConn * NumRates);
+    this->connItems_.reserve(numConn * numConnItems());
+
+    for (const auto& [name, well] : wells) {
+        this->addWell(name, well);
+    }
+
+    this->buildIndex();
+}
+
+Wells WellsTable::toWells() const
+{
+    auto restoreRates = [](const std::uint32_t  mask,
+                           const double*        values,
+                           const Tracers&       tracers,
+                           const std::size_t    entity,
+                           Rates&               rates)
+    {
+        rates.mask = static_cast<Rates::opt>(mask);
+        for (auto s = 0*NumRates; s < NumRates; ++s) {
+            if ((std::uint32_t{1} << s) != tracerBit) {
+                rates.get_ref(rateOption(s)) = values[s];
+            }
+        }
+
+        const auto pos = std::lower_bound(tracers.begin(), tracers.end(), entity,
+                                          [](const auto& elem, const std::size_t e)
+                                          { return elem.first < e; });
+        if ((pos != tracers.end()) && (pos->first == entity)) {
+            rates.tracer = pos->second;
+        }
+    };
+
+    auto wells = Wells{};
+    for (auto h = 0*this->numWells(); h < this->numWells(); ++h) {
+        auto& well = wells[this->names_[h]];
+
+        restoreRates(this->rateMask_[h], &this->rates_[h*NumRates],
+                     this->wellTracers_, h, well.rates);
+
+        well.bhp = this->bhp_[h];
+        well.thp = this->thp_[h];
+        well.temperature = this->temperature_[h];
+        well.control = this->control_[h];
+        well.dynamicStatus = this->dynamicStatus(h);
+
+        const auto& details = this->details_[h];
+        well.filtrate = details.filtrate;
+        well.segments = details.segments;
+        well.current_control = details.current_control;
+        well.guide_rates = details.guide_rates;
+        well.limits = details.limits;
+
+        const auto [begin, end] = this->connections(h);
+        well.connections.resize(end - begin);
+        for (auto c = begin; c < end; ++c) {
+            auto& conn = well.connections[c - begin];
+            conn.index = this->connIndex_[c];
+
+            restoreRates(this->connMask_[c], &this->connRates_[c*NumRates],
+                         this->connTracers_, c, conn.rates);
+
+            const auto* item = &this->connItems_[c*numConnItems()];
+            conn.pressure = item[0];
+            conn.reservoir_rate = item[1];
+            conn.cell_pressure = item[2];
+            conn.cell_saturation_water = item[3];
+            conn.cell_saturation_gas = item[4];
+            conn.effective_Kh = item[5];
+            conn.trans_factor = item[6];
+            conn.d_factor = item[7];
+            conn.compact_mult = item[8];
+            conn.filtrate = ConnectionFiltrate {
+                item[9], item[10], item[11], item[12],
+                item[13], item[14], item[15], item[16],
+            };
+        }
+    }
+
+    return wells;
+}
+
+void WellsTable::append(const WellsTable& other)
+{
+    for (const auto& name : other.names_) {
+        if (this->index_.find(name) != this->index_.end()) {
+            throw std::invalid_argument {
+                fmt::format("Well {} already exists in well table", name)
+            };
+        }
+    }
+
+    const auto wellOffset = this->numWells();
+    const auto connOffset = this->numConnections();
+
+    appendVector(this->names_, other.names_);
+    appendVector(this->rateMask_, other.rateMask_);
+    appendVector(this->rates_, other.rates_);
+    appendVector(this->bhp_, other.bhp_);
+    appendVector(this->thp_, other.thp_);
+    appendVector(this->temperature_, other.temperature_);
+    appendVector(this->control_, other.control_);
+    appendVector(this->status_, other.status_);
+    appendVector(this->details_, other.details_);
+
+    for (auto h = 0*other.numWells(); h < other.numWells(); ++h) {
+        this->connStart_.push_back(connOffset + other.connStart_[h + 1]);
+    }
+
+    appendVector(this->connIndex_, other.connIndex_);
+    appendVector(this->connMask_, other.connMask_);
+    appendVector(this->connRates_, other.connRates_);
+    appendVector(this->connItems_, other.connItems_);
+
+    for (const auto& [well, rates] : other.wellTracers_) {
+        this->wellTracers_.emplace_back(wellOffset + well, rates);
+    }
+
+    for (const auto& [conn, rates] : other.connTracers_) {
+        this->connTracers_.emplace_back(connOffset + conn, rates);
+    }
+
+    this->buildIndex();
+}
+
+void WellsTable::clear()
+{
+    this->names_.clear();
+    this->index_.clear();
+    this->rateMask_.clear();
+    this->rates_.clear();
+    this->bhp_.clear();
+    this->thp_.clear();
+    this->temperature_.clear();
+    this->control_.clear();
+    this->status_.clear();
+    this->connStart_.assign(1, 0);
+    this->connIndex_.clear();
+    this->connMask_.clear();
+    this->connRates_.clear();
+    this->connItems_.clear();
+    this->wellTracers_.clear();
+    this->connTracers_.clear();
+    this->details_.clear();
+}
+
+std::optional<WellsTable::Handle>
+WellsTable::handle(const std::string& well) const
+{
+    const auto pos = this->index_.find(well);
+    if (pos == this->index_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+double WellsTable::tracerRate(const Handle       h,
+                              const std::string& tracer,
+                              const double       defaultValue) const
+{
+    if (! this->hasRate(h, Rates::opt::tracer)) {
+        return defaultValue;
+    }
+
+    const auto pos = std::lower_bound(this->wellTracers_.begin(), this->wellTracers_.end(), h,
+                                      [](const auto& elem, const Handle e)
+                                      { return elem.first < e; });
+    if ((pos == this->wellTracers_.end()) || (pos->first != h)) {
+        return defaultValue;
+    }
+
+    const auto rate = pos->second.find(tracer);
+    return (rate == pos->second.end()) ? defaultValue : rate->second;
+}
+
+std::optional<std::size_t>
+WellsTable::findConnection(const Handle h, const Connection::global_index index) const
+{
+    const auto [begin, end] = this->connections(h);
+    for (auto c = begin; c < end; ++c) {
+        if (this->connIndex_[c] == index) {
+            return c;
+        }
+    }
+
+    return std::nullopt;
+}
+
+double WellsTable::get(const std::string& well, const Rates::opt m) const
+{
+    const auto h = this->handle(well);
+    if (! h.has_value()) {
+        return 0.0;
+    }
+
+    return this->rate(*h, m, 0.0);
+}
+
+double WellsTable::get(const std::string&             well,
+                       const Connection::global_index connection_grid_index,
+                       const Rates::opt               m) const
+{
+    const auto h = this->handle(well);
+    if (! h.has_value()) {
+        return 0.0;
+    }
+
+    const auto conn = this->findConnection(*h, connection_grid_index);
+    if (! conn.has_value()) {
+        return 0.0;
+    }
+
+    return this->connectionRate(*conn, m, 0.0);
+}
+
+bool WellsTable::operator==(const WellsTable& that) const
+{
+    return (this->names_ == that.names_)
+        && (this->rateMask_ == that.rateMask_)
+        && (this->rates_ == that.rates_)
+        && (this->bhp_ == that.bhp_)
+        && (this->thp_ == that.thp_)
+        && (this->temperature_ == that.temperature_)
+        && (this->control_ == that.control_)
+        && (this->status_ == that.status_)
+        && (this->connStart_ == that.connStart_)
+        && (this->connIndex_ == that.connIndex_)
+        && (this->connMask_ == that.connMask_)
+        && (this->connRates_ == that.connRates_)
+        && (this->connItems_ == that.connItems_)
+        && (this->wellTracers_ == that.wellTracers_)
+        && (this->connTracers_ == that.connTracers_)
+        && (this->details_ == that.details_)
+        ;
+}
+
+WellsTable WellsTable::serializationTestObject()
+{
+    return WellsTable { Wells::serializationTestObject() };
+}
+
+// ---------------------------------------------------------------------------
+// Private member functions below this separator
+// ---------------------------------------------------------------------------
+
+void WellsTable::addWell(const std::string& name, const Well& well)
+{
+    const auto h = this->names_.size();
+
+    this->names_.push_back(name);
+    this->addRates(well.rates, h, this->rateMask_, this->rates_, this->wellTracers_);
+
+    this->bhp_.push_back(well.bhp);
+    this->thp_.push_back(well.thp);
+    this->temperature_.push_back(well.temperature);
+    this->control_.push_back(well.control);
+    this->status_.push_back(static_cast<int>(well.dynamicStatus));
+
+    this->details_.push_back(Details {
+        well.filtrate, well.segments, well.current_control,
+        well.guide_rates, well.limits
+    });
+
+    for (const auto& conn : well.connections) {
+        const auto c = this->connIndex_.size();
+
+        this->connIndex_.push_back(conn.index);
+        this->addRates(conn.rates, c, this->connMask_, this->connRates_, this->connTracers_);
+
+        const auto& f = conn.filtrate;
+        this->connItems_.insert(this->connItems_.end(), {
+            conn.pressure, conn.reservoir_rate, conn.cell_pressure,
+            conn.cell_saturation_water, conn.cell_saturation_gas,
+            conn.effective_Kh, conn.trans_factor, conn.d_factor, conn.compact_mult,
+            f.rate, f.total, f.skin_factor, f.thickness,
+            f.perm, f.poro, f.radius, f.area_of_flow,
+        });
+    }
+
+    this->connStart_.push_back(this->connIndex_.size());
+}
+
+void WellsTable::addRates(const Rates&                rates,
+                          const std::size_t           entity,
+                          std::vector<std::uint32_t>& mask,
+                          std::vector<double>&        values,
+                          Tracers&                    tracers)
+{
+    mask.push_back(static_cast<std::uint32_t>(rates.mask));
+
+    for (auto s = 0*NumRates; s < NumRates; ++s) {
+        values.push_back(((std::uint32_t{1} << s) == tracerBit)
+                         ? 0.0 : rates.get_ref(rateOption(s)));
+    }
+
+    if (! rates.tracer.empty()) {
+        tracers.emplace_back(entity, rates.tracer);
+    }
+}
+
+void WellsTable::buildIndex()
+{
+    this->index_.clear();
+    this->index_.reserve(this->names_.size());
+
+    for (auto h = 0*this->names_.size(); h < this->names_.size(); ++h) {
+        this->index_.emplace(this->names_[h], h);
+    }
+}
+
+}} // namespace Opm::data
@@ -0,0 +1,446 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_DATA_WELLSTABLE_HPP
+#define OPM_OUTPUT_DATA_WELLSTABLE_HPP
+
+#include <opm/output/data/Wells.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// \file
+///
+/// Flat, structure-of-arrays representation of a collection of well
+/// solutions.  Wells are identified by a dense handle, and the connections
+/// of all wells are stored in a single CSR structure.  This keeps the
+/// numeric data in a small number of contiguous arrays which are cheap to
+/// pack for MPI and to index from the summary evaluation.
+
+namespace Opm { namespace data {
+
+    /// Handle-indexed, flat copy of a data::Wells collection.
+    class WellsTable
+    {
+    public:
+        /// Dense well index in the range [0, numWells()).
+        using Handle = std::size_t;
+
+        /// Range of connection indices [begin, end) of a single well.
+        using ConnectionRange = std::pair<std::size_t, std::size_t>;
+
+        /// Number of rate slots per well or connection.  One slot per
+        /// Rates::opt bit.
+        static constexpr std::size_t NumRates = 23;
+
+        /// Per connection floating-point quantities other than rates.
+        enum class ConnItem : std::size_t {
+            Pressure, ReservoirRate, CellPressure,
+            SaturationWater, SaturationGas,
+            EffectiveKh, TransFactor, DFactor, CompactMult,
+
+            FiltrateRate, FiltrateTotal, FiltrateSkinFactor,
+            FiltrateThickness, FiltratePerm, FiltratePoro,
+            FiltrateRadius, FiltrateAreaOfFlow,
+
+            // -- Must be last enumerator --
+            NumItems,
+        };
+
+        WellsTable() = default;
+
+        /// Flatten a map-based well collection.  Wells are numbered in
+        /// the iteration order of \p wells.
+        explicit WellsTable(const Wells& wells);
+
+        /// Map-based copy of the table.
+        Wells toWells() const;
+
+        /// Add all wells of \p other after those of \c *this, for
+        /// instance when gathering the wells of several processes.
+        ///
+        /// Throws std::invalid_argument if a well occurs in both tables.
+        void append(const WellsTable& other);
+
+        /// Remove all wells, but preserve allocated capacity.
+        void clear();
+
+        std::size_t numWells() const
+        {
+            return this->names_.size();
+        }
+
+        std::size_t numConnections() const
+        {
+            return this->connIndex_.size();
+        }
+
+        /// Handle of named well.  Nullopt if no such well.
+        std::optional<Handle> handle(const std::string& well) const;
+
+        const std::string& name(const Handle h) const
+        {
+            return this->names_[h];
+        }
+
+        bool hasRate(const Handle h, const Rates::opt m) const
+        {
+            return isSet(this->rateMask_[h], m);
+        }
+
+        /// Well rate \p m, or \p defaultValue if the rate is unset.
+        double rate(const Handle h, const Rates::opt m, const double defaultValue = 0.0) const
+        {
+            return this->hasRate(h, m)
+                ? this->rates_[h*NumRates + slot(m)]
+                : defaultValue;
+        }
+
+        /// Well tracer rate, or \p defaultValue if unset.
+        double tracerRate(const Handle h, const std::string& tracer, const double defaultValue = 0.0) const;
+
+        double bhp(const Handle h) const { return this->bhp_[h]; }
+        double thp(const Handle h) const { return this->thp_[h]; }
+        double temperature(const Handle h) const { return this->temperature_[h]; }
+        int control(const Handle h) const { return this->control_[h]; }
+        ::Opm::WellStatus dynamicStatus(const Handle h) const
+        {
+            return static_cast<::Opm::WellStatus>(this->status_[h]);
+        }
+
+        /// Connections of well \p h.
+        ConnectionRange connections(const Handle h) const
+        {
+            return { this->connStart_[h], this->connStart_[h + 1] };
+        }
+
+        /// Connection of well \p h in global cell \p index.  Nullopt if
+        /// no such connection.
+        std::optional<std::size_t>
+        findConnection(const Handle h, const Connection::global_index index) const;
+
+        Connection::global_index connectionIndex(const std::size_t conn) const
+        {
+            return this->connIndex_[conn];
+        }
+
+        double connectionRate(const std::size_t conn,
+                              const Rates::opt  m,
+                              const double      defaultValue = 0.0) const
+        {
+            return isSet(this->connMask_[conn], m)
+                ? this->connRates_[conn*NumRates + slot(m)]
+                : defaultValue;
+        }
+
+        double connectionItem(const std::size_t conn, const ConnItem item) const
+        {
+            return this->connItems_[conn*numConnItems() + static_cast<std::size_t>(item)];
+        }
+
+        /// Same semantics as Wells::get().
+        double get(const std::string& well, const Rates::opt m) const;
+
+        /// Same semantics as Wells::get().
+        double get(const std::string&             well,
+                   const Connection::global_index connection_grid_index,
+                   const Rates::opt               m) const;
+
+        bool operator==(const WellsTable& that) const;
+
+        static WellsTable serializationTestObject();
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->names_);
+            serializer(this->rateMask_);
+            serializer(this->rates_);
+            serializer(this->bhp_);
+            serializer(this->thp_);
+            serializer(this->temperature_);
+            serializer(this->control_);
+            serializer(this->status_);
+            serializer(this->connStart_);
+            serializer(this->connIndex_);
+            serializer(this->connMask_);
+            serializer(this->connRates_);
+            serializer(this->connItems_);
+            serializer(this->wellTracers_);
+            serializer(this->connTracers_);
+            serializer(this->details_);
+
+            if (! serializer.isSerializing()) {
+                this->buildIndex();
+            }
+        }
+
+        // MessageBufferType API should be similar to Dune::MessageBufferIF
+        template <class MessageBufferType>
+        void write(MessageBufferType& buffer) const
+        {
+            writeVector(this->names_, buffer);
+            writeVector(this->rateMask_, buffer);
+            writeVector(this->rates_, buffer);
+            writeVector(this->bhp_, buffer);
+            writeVector(this->thp_, buffer);
+            writeVector(this->temperature_, buffer);
+            writeVector(this->control_, buffer);
+            writeVector(this->status_, buffer);
+            writeVector(this->connStart_, buffer);
+            writeVector(this->connIndex_, buffer);
+            writeVector(this->connMask_, buffer);
+            writeVector(this->connRates_, buffer);
+            writeVector(this->connItems_, buffer);
+            writeTracers(this->wellTracers_, buffer);
+            writeTracers(this->connTracers_, buffer);
+
+            for (const auto& details : this->details_) {
+                details.write(buffer);
+            }
+        }
+
+        // MessageBufferType API should be similar to Dune::MessageBufferIF
+        template <class MessageBufferType>
+        void read(MessageBufferType& buffer)
+        {
+            readVector(buffer, this->names_);
+            readVector(buffer, this->rateMask_);
+            readVector(buffer, this->rates_);
+            readVector(buffer, this->bhp_);
+            readVector(buffer, this->thp_);
+            readVector(buffer, this->temperature_);
+            readVector(buffer, this->control_);
+            readVector(buffer, this->status_);
+            readVector(buffer, this->connStart_);
+            readVector(buffer, this->connIndex_);
+            readVector(buffer, this->connMask_);
+            readVector(buffer, this->connRates_);
+            readVector(buffer, this->connItems_);
+            readTracers(buffer, this->wellTracers_);
+            readTracers(buffer, this->connTracers_);
+
+            this->details_.resize(this->names_.size());
+            for (auto& details : this->details_) {
+                details.read(buffer);
+            }
+
+            this->buildIndex();
+        }
+
+    private:
+        /// Sparse tracer rates keyed by well or connection index.
+        using Tracers = std::vector<std::pair<std::size_t, std::map<std::string, double>>>;
+
+        /// Per-well quantities without a flat representation.
+        struct Details
+        {
+            WellFiltrate filtrate{};
+            std::unordered_map<std::size_t, Segment> segments{};
+            CurrentControl current_control{};
+            GuideRateValue guide_rates{};
+            WellControlLimits limits{};
+
+            bool operator==(const Details& that) const
+            {
+                return (this->filtrate == that.filtrate)
+                    && (this->segments == that.segments)
+                    && (this->current_control == that.current_control)
+                    && (this->guide_rates == that.guide_rates)
+                    && (this->limits == that.limits)
+                    ;
+            }
+
+            template <class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                serializer(this->filtrate);
+                serializer(this->segments);
+                serializer(this->current_control);
+                serializer(this->guide_rates);
+                serializer(this->limits);
+            }
+
+            template <class MessageBufferType>
+            void write(MessageBufferType& buffer) const
+            {
+                this->filtrate.write(buffer);
+
+                const auto nSeg = static_cast<unsigned int>(this->segments.size());
+                buffer.write(nSeg);
+                for (const auto& seg : this->segments) {
+                    seg.second.write(buffer);
+                }
+
+                this->current_control.write(buffer);
+                this->guide_rates.write(buffer);
+                this->limits.write(buffer);
+            }
+
+            template <class MessageBufferType>
+            void read(MessageBufferType& buffer)
+            {
+                this->filtrate.read(buffer);
+
+                auto nSeg = 0u;
+                buffer.read(nSeg);
+                this->segments.clear();
+                for (auto segID = 0*nSeg; segID < nSeg; ++segID) {
+                    auto seg = Segment{};
+                    seg.read(buffer);
+
+                    const auto segNumber = seg.segNumber;
+                    this->segments.emplace(segNumber, std::move(seg));
+                }
+
+                this->current_control.read(buffer);
+                this->guide_rates.read(buffer);
+                this->limits.read(buffer);
+            }
+        };
+
+        std::vector<std::string> names_{};
+        std::unordered_map<std::string, Handle> index_{};
+
+        std::vector<std::uint32_t> rateMask_{};
+        std::vector<double> rates_{};
+        std::vector<double> bhp_{};
+        std::vector<double> thp_{};
+        std::vector<double> temperature_{};
+        std::vector<int> control_{};
+        std::vector<int> status_{};
+
+        std::vector<std::size_t> connStart_{ 0 };
+        std::vector<std::size_t> connIndex_{};
+        std::vector<std::uint32_t> connMask_{};
+        std::vector<double> connRates_{};
+        std::vector<double> connItems_{};
+
+        Tracers wellTracers_{};
+        Tracers connTracers_{};
+
+        std::vector<Details> details_{};
+
+        static constexpr std::size_t numConnItems()
+        {
+            return static_cast<std::size_t>(ConnItem::NumItems);
+        }
+
+        static bool isSet(const std::uint32_t mask, const Rates::opt m)
+        {
+            const auto bit = static_cast<std::uint32_t>(m);
+            return (mask & bit) == bit;
+        }
+
+        /// Rate slot of single-bit option \p m.
+        static std::size_t slot(const Rates::opt m)
+        {
+            auto bit = static_cast<std::uint32_t>(m);
+            auto s = std::size_t{0};
+            while (bit > 1) {
+                bit >>= 1;
+                ++s;
+            }
+
+            return s;
+        }
+
+        void addWell(const std::string& name, const Well& well);
+        void addRates(const Rates& rates, const std::size_t entity,
+                      std::vector<std::uint32_t>& mask,
+                      std::vector<double>& values,
+                      Tracers& tracers);
+        void buildIndex();
+
+        template <typename T, class A, class MessageBufferType>
+        static void writeVector(const std::vector<T,A>& vec,
+                                MessageBufferType&      buffer)
+        {
+            const auto n = vec.size();
+            buffer.write(n);
+
+            for (const auto& x : vec) {
+                buffer.write(x);
+            }
+        }
+
+        template <typename T, class A, class MessageBufferType>
+        static void readVector(MessageBufferType& buffer,
+                               std::vector<T,A>&  vec)
+        {
+            auto n = 0 * vec.size();
+            buffer.read(n);
+
+            vec.resize(n);
+
+            for (auto& x : vec) {
+                buffer.read(x);
+            }
+        }
+
+        template <class MessageBufferType>
+        static void writeTracers(const Tracers& tracers, MessageBufferType& buffer)
+        {
+            buffer.write(tracers.size());
+
+            for (const auto& [entity, rates] : tracers) {
+                buffer.write(entity);
+
+                const auto size = static_cast<unsigned int>(rates.size());
+                buffer.write(size);
+                for (const auto& [name, rate] : rates) {
+                    buffer.write(name);
+                    buffer.write(rate);
+                }
+            }
+        }
+
+        template <class MessageBufferType>
+        static void readTracers(MessageBufferType& buffer, Tracers& tracers)
+        {
+            auto n = 0 * tracers.size();
+            buffer.read(n);
+
+            tracers.resize(n);
+            for (auto& [entity, rates] : tracers) {
+                buffer.read(entity);
+
+                auto size = 0u;
+                buffer.read(size);
+                rates.clear();
+                for (auto i = 0*size; i < size; ++i) {
+                    auto name = std::string{};
+                    auto rate = 0.0;
+                    buffer.read(name);
+                    buffer.read(rate);
+                    rates.emplace(std::move(name), rate);
+                }
+            }
+        }
+    };
+
+}} // namespace Opm::data
+
+#endif // OPM_OUTPUT_DATA_WELLSTABLE_HPP
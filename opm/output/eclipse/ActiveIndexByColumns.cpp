@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <numeric>
 #include <utility>
@@ -119,6 +120,79 @@ namespace {
 
         return natural2columnar;
     }
+
+    std::vector<int>
+    buildMappingTables(const std::vector<int>&   activeToGlobal,
+                       const std::array<int, 3>& cartDims)
+    {
+        const auto numActive = static_cast<std::int64_t>(activeToGlobal.size());
+
+        const auto& [outer, middle] = inferOuterLoopOrdering(cartDims);
+
+        const auto nx  = static_cast<std::size_t>(cartDims[0]);
+        const auto nxy = nx * static_cast<std::size_t>(cartDims[1]);
+        const auto nmiddle = static_cast<std::size_t>(cartDims[middle]);
+
+        // Column of each active cell and number of active cells per
+        // column.  Columns are numbered in the order of the outer and
+        // middle loops of columnarGlobalIdx().
+        auto column = std::vector<std::size_t>(activeToGlobal.size());
+        auto start = std::vector<std::size_t>(nxy + 1, std::size_t{0});
+
+#pragma omp parallel for
+        for (std::int64_t cell = 0; cell < numActive; ++cell) {
+            const auto glob = static_cast<std::size_t>(activeToGlobal[cell]);
+            const auto ij = std::array<std::size_t, 2> {
+                glob % nx, (glob % nxy) / nx
+            };
+
+            const auto col = ij[middle] + nmiddle*ij[outer];
+            column[cell] = col;
+
+#pragma omp atomic
+            ++start[col + 1];
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+
+        // Distribute active cells to their columns.  The order within a
+        // column depends on the thread schedule and is restored below.
+        auto cursor = std::vector<std::size_t>(start.begin(), start.end() - 1);
+        auto columnarCells = std::vector<std::size_t>(activeToGlobal.size());
+
+#pragma omp parallel for
+        for (std::int64_t cell = 0; cell < numActive; ++cell) {
+            std::size_t pos;
+
+#pragma omp atomic capture
+            pos = cursor[column[cell]]++;
+
+            columnarCells[pos] = cell;
+        }
+
+        // Cells in the same column differ only in K, so ordering them by
+        // global index orders them by layer.
+        const auto numColumns = static_cast<std::int64_t>(nxy);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (std::int64_t col = 0; col < numColumns; ++col) {
+            std::sort(columnarCells.begin() + start[col],
+                      columnarCells.begin() + start[col + 1],
+                      [&activeToGlobal](const std::size_t cell1, const std::size_t cell2)
+            {
+                return activeToGlobal[cell1] < activeToGlobal[cell2];
+            });
+        }
+
+        auto natural2columnar = std::vector<int>(activeToGlobal.size(), 0);
+
+#pragma omp parallel for
+        for (std::int64_t pos = 0; pos < numActive; ++pos) {
+            natural2columnar[columnarCells[pos]] = static_cast<int>(pos);
+        }
+
+        return natural2columnar;
+    }
 }
 
 bool Opm::ActiveIndexByColumns::operator==(const ActiveIndexByColumns& rhs) const
@@ -133,12 +207,14 @@ ActiveIndexByColumns(const std::size_t
     : natural2columnar_{ buildMappingTables(numActive, cartDims, getIJK) }
 {}
 
+Opm::ActiveIndexByColumns::
+ActiveIndexByColumns(const std::vector<int>&   activeToGlobal,
+                     const std::array<int, 3>& cartDims)
+    : natural2columnar_{ buildMappingTables(activeToGlobal, cartDims) }
+{}
+
 Opm::ActiveIndexByColumns
 Opm::buildColumnarActiveIndexMappingTables(const EclipseGrid& grid)
 {
-    return ActiveIndexByColumns { grid.getNumActive(), grid.getNXYZ(),
-        [&grid](const std::size_t activeCell)
-    {
-        return grid.getIJK(grid.getGlobalIndex(activeCell));
-    }};
+    return ActiveIndexByColumns { grid.getActiveMap(), grid.getNXYZ() };
 }
@@ -50,6 +50,18 @@ public:
                                   const std::array<int, 3>&                                   cartDims,
                                   const std::function<std::array<int, 3>(const std::size_t)>& getIJK);
 
+    /// Create natural->columnar active cell index mapping from the
+    /// global (Cartesian) cell index of each active cell.
+    ///
+    /// Avoids the per-cell call-back of the (I,J,K)-based constructor and
+    /// orders the active cells by a parallel counting sort on columns.
+    ///
+    /// \param[in] activeToGlobal Global cell index of each active cell,
+    ///    e.g., EclipseGrid::getActiveMap().
+    /// \param[in] cartDims Model's Cartesian dimensions.
+    explicit ActiveIndexByColumns(const std::vector<int>&   activeToGlobal,
+                                  const std::array<int, 3>& cartDims);
+
     /// Map active index in natural order to active index in columnar order.
     ///
     /// The output code needs return type \c int here, so use that instead
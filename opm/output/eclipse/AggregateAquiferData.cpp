@@ -603,6 +603,32 @@ Opm::RestartIO::Helpers::AggregateAquiferData::
 AggregateAquiferData(const InteHEAD::AquiferDims& aqDims,
                      const AquiferConfig&         aqConfig,
                      const EclipseGrid&           grid)
+    : AggregateAquiferData { aqDims }
+{
+    if (! aqConfig.connections().active()) {
+        return;
+    }
+
+    this->captureStaticConnectionData(aqConfig, grid,
+                                      buildColumnarActiveIndexMappingTables(grid));
+}
+
+Opm::RestartIO::Helpers::AggregateAquiferData::
+AggregateAquiferData(const InteHEAD::AquiferDims& aqDims,
+                     const AquiferConfig&         aqConfig,
+                     const EclipseGrid&           grid,
+                     const ActiveIndexByColumns&  map)
+    : AggregateAquiferData { aqDims }
+{
+    if (! aqConfig.connections().active()) {
+        return;
+    }
+
+    this->captureStaticConnectionData(aqConfig, grid, map);
+}
+
+Opm::RestartIO::Helpers::AggregateAquiferData::
+AggregateAquiferData(const InteHEAD::AquiferDims& aqDims)
     : maxActiveAnalyticAquiferID_   { aqDims.maxAquiferID }
     , numActiveConn_                ( maxNumberOfAquifers(aqDims), 0 )
     , totalInflux_                  ( maxNumberOfAquifers(aqDims), 0.0 )
@@ -614,13 +640,14 @@ AggregateAquiferData(const InteHEAD::AquiferDims& aqDims,
     , integerAnalyticAquiferConn_   { IntegerAnalyticAquiferConn::   allocate(aqDims) }
     , singleprecAnalyticAquiferConn_{ SinglePrecAnalyticAquiferConn::allocate(aqDims) }
     , doubleprecAnalyticAquiferConn_{ DoublePrecAnalyticAquiferConn::allocate(aqDims) }
-{
-    if (! aqConfig.connections().active()) {
-        return;
-    }
-
-    const auto map = buildColumnarActiveIndexMappingTables(grid);
+{}
 
+void
+Opm::RestartIO::Helpers::AggregateAquiferData::
+captureStaticConnectionData(const AquiferConfig&        aqConfig,
+                            const EclipseGrid&          grid,
+                            const ActiveIndexByColumns& map)
+{
     // Aquifer connections do not change in SCHEDULE.  Leverage that
     // property to compute static connection information exactly once.
     analyticAquiferConnectionLoop(aqConfig, [this, &grid, &map]
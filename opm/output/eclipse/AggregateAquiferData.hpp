@@ -28,6 +28,7 @@
 #include <vector>
 
 namespace Opm {
+    class ActiveIndexByColumns;
     class AquiferConfig;
     class EclipseGrid;
     class ScheduleState;
@@ -58,6 +59,18 @@ namespace Opm { namespace RestartIO { namespace Helpers {
                                       const AquiferConfig&         aqConfig,
                                       const EclipseGrid&           grid);
 
+        /// Constructor.
+        ///
+        /// Like the three-argument constructor, but uses the caller's
+        /// natural->columnar active cell index mapping instead of
+        /// building a new one from \p grid.
+        ///
+        /// \param[in] map Columnar active cell index mapping of \p grid.
+        explicit AggregateAquiferData(const InteHEAD::AquiferDims& aqDims,
+                                      const AquiferConfig&         aqConfig,
+                                      const EclipseGrid&           grid,
+                                      const ActiveIndexByColumns&  map);
+
         /// Linearise dynamic information pertinent to analytic aquifers
         /// into internal arrays.
         ///
@@ -166,6 +179,14 @@ namespace Opm { namespace RestartIO { namespace Helpers {
         }
 
     private:
+        /// Allocate backing storage for all output arrays.
+        explicit AggregateAquiferData(const InteHEAD::AquiferDims& aqDims);
+
+        /// Compute static information of analytic aquifer connections.
+        void captureStaticConnectionData(const AquiferConfig&        aqConfig,
+                                         const EclipseGrid&          grid,
+                                         const ActiveIndexByColumns& map);
+
         int maxActiveAnalyticAquiferID_{0};
 
         std::vector<int> numActiveConn_{};
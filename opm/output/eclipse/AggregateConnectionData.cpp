@@ -115,6 +115,16 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedMatrix<int>& array)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+            array.reset(WM::NumRows   { numWells(inteHead) },
+                        WM::NumCols   { maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
+        }
+
         template <class IConnArray>
         void staticContrib(const Opm::Connection& conn,
                            const std::size_t      connID,
@@ -167,6 +177,16 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedMatrix<float>& array)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<float>;
+
+            array.reset(WM::NumRows   { numWells(inteHead) },
+                        WM::NumCols   { maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
+        }
+
         double staticDFacCorrCoeff(const Opm::Connection::CTFProperties& ctf_props,
                                    const Opm::UnitSystem&                units)
         {
@@ -264,6 +284,16 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedMatrix<double>& array)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<double>;
+
+            array.reset(WM::NumRows   { numWells(inteHead) },
+                        WM::NumCols   { maxNumConn(inteHead) },
+                        WM::WindowSize{ entriesPerConn(inteHead) });
+        }
+
         template <class XConnArray>
         void dynamicContrib(const std::string&       well_name,
                             const bool               is_producer,
@@ -335,6 +365,17 @@ AggregateConnectionData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateConnectionData::
+reset(const std::vector<int>& inteHead)
+{
+    IConn::reset(inteHead, this->iConn_);
+    SConn::reset(inteHead, this->sConn_);
+    XConn::reset(inteHead, this->xConn_);
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateConnectionData::
 captureDeclaredConnData(const Schedule&     sched,
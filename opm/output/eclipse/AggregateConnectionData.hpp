@@ -43,6 +43,11 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateConnectionData(const std::vector<int>& inteHead);
 
+        /// Resize all arrays to the dimensions in \p inteHead and reset
+        /// their elements to the initial values, reusing existing storage.
+        /// Equivalent to constructing a new object from \p inteHead.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredConnData(const Opm::Schedule&        sched,
                                      const Opm::EclipseGrid&     grid,
                                      const Opm::UnitSystem&      units,
@@ -317,6 +317,15 @@ allocate(const std::vector<int>& inteHead)
     };
 }
 
+void reset(const std::vector<int>& inteHead,
+           Opm::RestartIO::Helpers::WindowedArray<int>& array)
+{
+    using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
+}
+
 
 
 template <class IGrpArray>
@@ -777,6 +786,15 @@ allocate(const std::vector<int>& inteHead)
     };
 }
 
+void reset(const std::vector<int>& inteHead,
+           Opm::RestartIO::Helpers::WindowedArray<float>& array)
+{
+    using WV = Opm::RestartIO::Helpers::WindowedArray<float>;
+
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
+}
+
 template <typename SGProp, class SGrpArray>
 void assignGroupGasInjectionTargets(const Opm::Group&        group,
                                     const Opm::SummaryState& sumState,
@@ -1090,6 +1108,15 @@ allocate(const std::vector<int>& inteHead)
     };
 }
 
+void reset(const std::vector<int>& inteHead,
+           Opm::RestartIO::Helpers::WindowedArray<double>& array)
+{
+    using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
+
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
+}
+
 // here define the dynamic group quantities to be written to the restart file
 template <class XGrpArray>
 void dynamicContrib(const std::vector<std::string>&      restart_group_keys,
@@ -1151,6 +1178,19 @@ allocate(const std::vector<int>& inteHead)
     };
 }
 
+void reset(const std::vector<int>& inteHead,
+           Opm::RestartIO::Helpers::WindowedArray<
+               Opm::EclIO::PaddedOutputString<8>
+           >& array)
+{
+    using WV = Opm::RestartIO::Helpers::WindowedArray<
+               Opm::EclIO::PaddedOutputString<8>
+               >;
+
+    array.reset(WV::NumWindows{ ngmaxz(inteHead) },
+                WV::WindowSize{ entriesPerGroup(inteHead) });
+}
+
 template <class ZGroupArray>
 void staticContrib(const Opm::Group& group, ZGroupArray& zGroup)
 {
@@ -1175,6 +1215,21 @@ AggregateGroupData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateGroupData::
+reset(const std::vector<int>& inteHead)
+{
+    IGrp::reset(inteHead, this->iGroup_);
+    SGrp::reset(inteHead, this->sGroup_);
+    XGrp::reset(inteHead, this->xGroup_);
+    ZGrp::reset(inteHead, this->zGroup_);
+
+    this->nWGMax_ = nwgmax(inteHead);
+    this->nGMaxz_ = ngmaxz(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateGroupData::
 captureDeclaredGroupData(const Opm::Schedule&                 sched,
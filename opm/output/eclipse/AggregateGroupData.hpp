@@ -42,6 +42,11 @@ class AggregateGroupData
 public:
     explicit AggregateGroupData(const std::vector<int>& inteHead);
 
+    /// Resize all arrays to the dimensions in \p inteHead and reset
+    /// their elements to the initial values, reusing existing storage.
+    /// Equivalent to constructing a new object from \p inteHead.
+    void reset(const std::vector<int>& inteHead);
+
     void captureDeclaredGroupData(const Opm::Schedule&        sched,
                          const Opm::UnitSystem&               units,
                          const std::size_t                    simStep,
@@ -98,24 +98,6 @@ namespace {
         return inteHead[180];
     }
 
-    std::vector<std::size_t>
-    inflowSegmentsIndex(const Opm::WellSegments& segSet,
-                        const std::size_t        segIndex)
-    {
-        std::vector<std::size_t> inFlowSegInd;
-
-        const auto segNumber = segSet[segIndex].segmentNumber();
-
-        for (std::size_t ind = 0; ind < segSet.size(); ind++) {
-            const auto& i_outletSeg = segSet[ind].outletSegment();
-            if (segNumber == i_outletSeg) {
-                inFlowSegInd.push_back(ind);
-            }
-        }
-
-        return inFlowSegInd;
-    }
-
     std::vector<std::size_t>
     segmentIndFromOrderedSegmentInd(const Opm::WellSegments&        segSet,
                                     const std::vector<std::size_t>& ordSegNo)
@@ -127,67 +109,6 @@ namespace {
         return sNFOSN;
     }
 
-    std::vector<std::size_t>
-    segmentOrder(const Opm::WellSegments& segSet,
-                 const std::size_t        segIndex)
-    {
-        std::vector<std::size_t> ordSegNumber;
-        std::vector<std::size_t> segIndCB;
-        // Store "heel" segment since that will not always be at the end of the list
-        segIndCB.push_back(segIndex);
-        std::size_t newSInd = segIndex;
-        const auto& origBranchNo = segSet[segIndex].branchNumber();
-        // loop down branch to find all segments in branch and number from "toe" to "heel"
-        while (newSInd < segSet.size()) {
-            bool endOrigBranch = true;
-            const auto& iSInd = inflowSegmentsIndex(segSet, newSInd);
-            for (const auto& isi : iSInd )  {
-                const auto& inflowBranch = segSet[isi].branchNumber();
-                if (origBranchNo == inflowBranch) {
-                    endOrigBranch = false;
-                }
-            }
-            if (iSInd.size() > 0) {
-                for (const auto& ind : iSInd) {
-                    auto inflowBranch = segSet[ind].branchNumber();
-                    if (origBranchNo == inflowBranch) {
-                        // if inflow segment belongs to same branch add contribution
-                        segIndCB.insert(segIndCB.begin(), ind);
-                        // search recursively down this branch to find more inflow branches
-                        newSInd = ind;
-                    }
-                    else {
-                        // if inflow segment belongs to different branch, start new search
-                        const auto& nSOrd = segmentOrder(segSet, ind);
-                        // copy the segments already found and indexed into the total ordered segment vector
-                        for (std::size_t indOS = 0; indOS < nSOrd.size(); indOS++) {
-                            ordSegNumber.push_back(nSOrd[indOS]);
-                        }
-                        if (endOrigBranch) {
-                            newSInd = segSet.size();
-                        }
-                        // increment the local branch sequence number counter
-                    }
-                }
-            }
-            if (endOrigBranch || (iSInd.size()==0)) {
-                // have come to toe of current branch - store segment indicies of current branch
-                for (std::size_t indOS = 0; indOS < segIndCB.size(); indOS++) {
-                    ordSegNumber.push_back(segIndCB[indOS]);
-                }
-                // set new index to exit while loop
-                newSInd = segSet.size();
-            }
-        }
-        return ordSegNumber;
-    }
-
-    std::vector<std::size_t>
-    segmentOrder(const Opm::WellSegments& segSet)
-    {
-        return segmentOrder(segSet, 0);
-    }
-
     /// Accumulate connection flow rates (surface conditions) to their connecting segment.
     SegmentSetSourceSinkTerms
     getSegmentSetSSTerms(const Opm::WellSegments&                  segSet,
@@ -253,7 +174,7 @@ namespace {
         auto segmentSources = getSegmentSetSSTerms(segSet, rateConns, welConns, units);
 
         // find an ordered list of segments
-        auto orderedSegmentInd = segmentOrder(segSet);
+        const auto& orderedSegmentInd = segSet.topology().inflowOrder();
         auto sNFOSN = segmentIndFromOrderedSegmentInd(segSet, orderedSegmentInd);
         // loop over segments according to the ordered segments sequence which ensures that the segments alway are traversed in the from
         // inflow to outflow direction (a branch toe is the innermost inflow end)
@@ -280,83 +201,6 @@ namespace {
         };
     }
 
-    int noConnectionsSegment(const Opm::WellConnections& compSet,
-                             const Opm::WellSegments&    segSet,
-                             const std::size_t           segIndex)
-    {
-        const auto& segNumber  = segSet[segIndex].segmentNumber();
-        int noConnections = 0;
-        for (const auto& it : compSet) {
-            auto cSegment = it.segment();
-            if (segNumber == cSegment) {
-                noConnections+=1;
-            }
-        }
-
-        return noConnections;
-    }
-
-    int sumConnectionsSegment(const Opm::WellConnections& compSet,
-                              const Opm::WellSegments&    segSet,
-                              const std::size_t           segIndex)
-    {
-        // This function returns (for a given segment) the sum of number of connections for each segment
-        // with lower segment index than the currnet segment
-        // If the segment contains no connections, the number returned is zero.
-        int sumConn = 0;
-        if (noConnectionsSegment(compSet, segSet, segIndex) > 0) {
-            // add up the number of connections for å segments with lower segment index than current segment
-            for (size_t ind = 0; ind <= segIndex; ind++) {
-                size_t addCon = (ind == segIndex) ? 1 : noConnectionsSegment(compSet, segSet, ind);
-                sumConn += addCon;
-            }
-        }
-        return sumConn;
-    }
-
-    int noInFlowBranches(const Opm::WellSegments& segSet,
-                         const std::size_t        segIndex)
-    {
-        const auto segNumber = segSet[segIndex].segmentNumber();
-        const auto branch    = segSet[segIndex].branchNumber();
-
-        int noIFBr = 0;
-        for (std::size_t ind = 0; ind < segSet.size(); ind++) {
-            const auto& o_segNum = segSet[ind].outletSegment();
-            const auto& i_branch = segSet[ind].branchNumber();
-            if ((segNumber == o_segNum) && (branch != i_branch)){
-                noIFBr+=1;
-            }
-        }
-
-        return noIFBr;
-    }
-
-    //find the number of inflow branch-segments (segments that has a branch) from the
-    // first segment to the current segment for segments that has at least one inflow branch
-    // Segments with no inflow branches get the value zero
-    int sumNoInFlowBranches(const Opm::WellSegments& segSet,
-                            const std::size_t        segIndex)
-    {
-        int sumIFB = 0;
-        //auto segInd = segIndex;
-        for (int segInd = static_cast<int>(segIndex); segInd >= 0; segInd--) {
-            const auto& curBranch = segSet[segInd].branchNumber();
-            const auto& iSInd = inflowSegmentsIndex(segSet, segInd);
-            for (auto inFlowInd : iSInd) {
-                const auto& inFlowBranch = segSet[inFlowInd].branchNumber();
-                // if inflow segment belongs to different branch add contribution
-                if (curBranch != inFlowBranch) {
-                    sumIFB+=1;
-                }
-            }
-        }
-
-        // check if the segment has inflow branches - if yes return sumIFB else return zero
-        return (noInFlowBranches(segSet, segIndex) >= 1)
-            ? sumIFB : 0;
-    }
-
     int inflowSegmentCurBranch(const std::string&       wname,
                                const Opm::WellSegments& segSet,
                                const std::size_t        segIndex)
@@ -365,22 +209,21 @@ namespace {
         const auto segNumber = segSet[segIndex].segmentNumber();
 
         int inFlowSegInd = -1;
-        for (std::size_t ind = 0; ind < segSet.size(); ind++) {
-            const auto& i_segNum = segSet[ind].segmentNumber();
-            const auto& i_branch = segSet[ind].branchNumber();
-            const auto& i_outFlowSeg = segSet[ind].outletSegment();
-            if ((branch == i_branch) && (segNumber == i_outFlowSeg)) {
-                if (inFlowSegInd == -1) {
-                    inFlowSegInd = segSet.segmentNumberToIndex(i_segNum);
-                }
-                else {
-                    std::cout << "Non-unique inflow segment in same branch, Well: " << wname << std::endl;
-                    std::cout <<  "Segment number: " << segNumber << std::endl;
-                    std::cout <<  "Branch number: " << branch << std::endl;
-                    std::cout <<  "Inflow segment number 1: " << segSet[inFlowSegInd].segmentNumber() << std::endl;
-                    std::cout <<  "Inflow segment number 2: " << segSet[ind].segmentNumber() << std::endl;
-                    throw std::invalid_argument("Non-unique inflow segment in same branch, Well " + wname);
-                }
+        for (const auto ind : segSet.topology().inlets(segIndex)) {
+            if (branch != segSet[ind].branchNumber()) {
+                continue;
+            }
+
+            if (inFlowSegInd == -1) {
+                inFlowSegInd = static_cast<int>(ind);
+            }
+            else {
+                std::cout << "Non-unique inflow segment in same branch, Well: " << wname << std::endl;
+                std::cout <<  "Segment number: " << segNumber << std::endl;
+                std::cout <<  "Branch number: " << branch << std::endl;
+                std::cout <<  "Inflow segment number 1: " << segSet[inFlowSegInd].segmentNumber() << std::endl;
+                std::cout <<  "Inflow segment number 2: " << segSet[ind].segmentNumber() << std::endl;
+                throw std::invalid_argument("Non-unique inflow segment in same branch, Well " + wname);
             }
         }
 
@@ -420,6 +263,15 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<int>& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
+        }
+
         template <class ISegArray>
         void assignSpiralICDCharacteristics(const Opm::Segment& segment,
                                             const std::size_t   baseIndex,
@@ -486,27 +338,36 @@ namespace {
             if (well.isMultiSegment()) {
                 //loop over segment set and print out information
                 const auto& welSegSet     = well.getSegments();
-                const auto& completionSet = well.getConnections();
+                const auto& topology      = welSegSet.topology();
+                const auto  segConns      = topology.connections(well.getConnections());
                 const auto& noElmSeg      = nisegz(inteHead);
-                auto orderedSegmentNo = segmentOrder(welSegSet);
+                const auto& orderedSegmentNo = topology.inflowOrder();
                 std::vector<int> seg_reorder (welSegSet.size(),0);
                 for (std::size_t ind = 0; ind < welSegSet.size(); ind++ ){
-                    const auto s_no = welSegSet[orderedSegmentNo[ind]].segmentNumber();
-                    const auto s_ind = welSegSet.segmentNumberToIndex(s_no);
-                    seg_reorder[s_ind] = ind+1;
+                    seg_reorder[orderedSegmentNo[ind]] = ind+1;
                 }
+
+                // Number of inflow branches into segments up to and
+                // including the current segment.
+                int sumIFB = 0;
                 for (std::size_t ind = 0; ind < welSegSet.size(); ind++) {
                     const auto& segment = welSegSet[ind];
                     auto segNumber = segment.segmentNumber();
                     auto iS = (segNumber-1)*noElmSeg;
+                    const auto inFlowSegInd = inflowSegmentCurBranch(well.name(), welSegSet, ind);
+                    const auto noIFBr = static_cast<int>(topology.numInletBranches(ind));
+                    const auto noConn = static_cast<int>(segConns.connections(ind).size());
+                    sumIFB += noIFBr;
+
                     iSeg[ind*noElmSeg + Ix::SegNo] = welSegSet[orderedSegmentNo[ind]].segmentNumber();
                     iSeg[iS + Ix::OutSeg]         = segment.outletSegment();
-                    iSeg[iS + Ix::InSegCurBranch] = (inflowSegmentCurBranch(well.name(), welSegSet, ind) == 0) ? 0 : welSegSet[inflowSegmentCurBranch(well.name(), welSegSet, ind)].segmentNumber();
+                    iSeg[iS + Ix::InSegCurBranch] = (inFlowSegInd == 0) ? 0 : welSegSet[inFlowSegInd].segmentNumber();
                     iSeg[iS + Ix::BranchNo]       = segment.branchNumber();
-                    iSeg[iS + 4] = noInFlowBranches(welSegSet, ind);
-                    iSeg[iS + 5] = sumNoInFlowBranches(welSegSet, ind);
-                    iSeg[iS + 6] = noConnectionsSegment(completionSet, welSegSet, ind);
-                    iSeg[iS + 7] = sumConnectionsSegment(completionSet, welSegSet, ind);
+                    iSeg[iS + 4] = noIFBr;
+                    iSeg[iS + 5] = (noIFBr >= 1) ? sumIFB : 0;
+                    iSeg[iS + 6] = noConn;
+                    iSeg[iS + 7] = (noConn > 0)
+                        ? static_cast<int>(segConns.connectionsBefore(ind)) + 1 : 0;
                     iSeg[iS + 8] = seg_reorder[ind];
 
                     iSeg[iS + Ix::SegmentType] = segment.ecl_type_id();
@@ -540,6 +401,15 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<double>& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
+
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
+        }
+
         float valveFlowUnitCoefficient(const Opm::UnitSystem::UnitType uType)
         {
             using UType = Opm::UnitSystem::UnitType;
@@ -1263,6 +1133,15 @@ namespace {
                 WV::WindowSize{ entriesPerMSW(inteHead) }
             };
         }
+
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<int>& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+            array.reset(WV::NumWindows{ nswlmx(inteHead) },
+                        WV::WindowSize{ entriesPerMSW(inteHead) });
+        }
     } // ILBS
 
     namespace ILBR {
@@ -1303,6 +1182,16 @@ namespace {
                 WM::WindowSize{ nilbrz(inteHead) }
             };
         }
+
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedMatrix<int>& array)
+        {
+            using WM = Opm::RestartIO::Helpers::WindowedMatrix<int>;
+
+            array.reset(WM::NumRows   { nswlmx(inteHead) },
+                        WM::NumCols   { maxBranchesPerMSWell(inteHead) },
+                        WM::WindowSize{ nilbrz(inteHead) });
+        }
     } // ILBR
 
 } // Anonymous
@@ -1319,6 +1208,18 @@ AggregateMSWData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateMSWData::
+reset(const std::vector<int>& inteHead)
+{
+    ISeg::reset(inteHead, this->iSeg_);
+    RSeg::reset(inteHead, this->rSeg_);
+    ILBS::reset(inteHead, this->iLBS_);
+    ILBR::reset(inteHead, this->iLBR_);
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateMSWData::
 captureDeclaredMSWData(const Schedule&          sched,
@@ -1329,12 +1230,11 @@ captureDeclaredMSWData(const Schedule&          sched,
                        const Opm::SummaryState& smry,
                        const Opm::data::Wells&  wr)
 {
-    const auto& wells = sched.getWells(rptStep);
     auto msw = std::vector<const Opm::Well*>{};
 
-    for (const auto& well : wells) {
-        if (well.isMultiSegment()) {
-            msw.push_back(&well);
+    for (const auto* well : sched.getWellPtrs(rptStep)) {
+        if (well->isMultiSegment()) {
+            msw.push_back(well);
         }
     }
 
@@ -40,6 +40,11 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateMSWData(const std::vector<int>& inteHead);
 
+        /// Resize all arrays to the dimensions in \p inteHead and reset
+        /// their elements to the initial values, reusing existing storage.
+        /// Equivalent to constructing a new object from \p inteHead.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredMSWData(const Opm::Schedule&     sched,
                                     const std::size_t        rptStep,
                                     const Opm::UnitSystem&   units,
@@ -202,11 +202,12 @@ double nodePressure(const Opm::Schedule&               sched,
     using M = ::Opm::UnitSystem::measure;
     double node_pres = 1.;
     bool node_wgroup = false;
-    const auto& wells = sched.getWells(lookup_step);
+    const auto wells = sched.getWellPtrs(lookup_step);
     auto& network = sched[lookup_step].network();
 
     // If a node is a well group, set the node pressure to the well's thp-limit if this is larger than the default value (1.)
-    for (const auto& well : wells) {
+    for (const auto* wellPtr : wells) {
+        const auto& well = *wellPtr;
         const auto& wgroup_name = well.groupName();
         if (wgroup_name == nodeName) {
             if (well.isProducer()) {
@@ -47,6 +47,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -752,22 +753,36 @@ namespace {
             return dudg;
         }
 
-        template <class DUDGArray>
-        void staticContrib(const Opm::UDQState&                  udq_state,
-                           const std::vector<const Opm::Group*>& groups,
-                           const std::string&                    udq,
-                           const std::size_t                     ngmaxz,
-                           DUDGArray&                            dUdg)
+        // Group names in restart order, empty for unused slots.
+        std::vector<std::string>
+        groupNames(const std::vector<const Opm::Group*>& groups)
         {
+            auto names = std::vector<std::string>(groups.size());
             for (std::size_t ind = 0; ind < groups.size(); ++ind) {
-                const auto* group = groups[ind];
+                if (groups[ind] != nullptr) {
+                    names[ind] = groups[ind]->name();
+                }
+            }
+
+            return names;
+        }
+
+        template <class DUDGArray>
+        void staticContrib(const Opm::UDQState&            udq_state,
+                           const std::vector<std::string>& groups,
+                           const std::string&              udq,
+                           const std::size_t               ngmaxz,
+                           std::vector<double>&            values,
+                           DUDGArray&                      dUdg)
+        {
+            // NaN for groups without a value, including unused slots.
+            udq_state.get_group_vars(udq, groups, values);
 
-                const auto useDflt = (group == nullptr)
-                    || (ind == ngmaxz - 1)
-                    || ! udq_state.has_group_var(group->name(), udq);
+            for (std::size_t ind = 0; ind < groups.size(); ++ind) {
+                const auto useDflt = (ind == ngmaxz - 1)
+                    || std::isnan(values[ind]);
 
-                dUdg[ind] = useDflt ? Opm::UDQ::restart_default
-                    : udq_state.get_group_var(group->name(), udq);
+                dUdg[ind] = useDflt ? Opm::UDQ::restart_default : values[ind];
             }
         }
 
@@ -842,16 +857,18 @@ namespace {
                            const std::vector<std::string>& wells,
                            const std::string&              udq,
                            const std::size_t               nwmaxz,
+                           std::vector<double>&            values,
                            DUDWArray&                      dUdw)
         {
             // Initialize array to the default value for the array
             std::fill_n(dUdw.begin(), nwmaxz, Opm::UDQ::restart_default);
 
-            for (std::size_t ind = 0; ind < wells.size(); ++ind) {
-                const auto& wname = wells[ind];
+            // NaN for wells without a value.
+            udq_state.get_well_vars(udq, wells, values);
 
-                if (udq_state.has_well_var(wname, udq)) {
-                    dUdw[ind] = udq_state.get_well_var(wname, udq);
+            for (std::size_t ind = 0; ind < wells.size(); ++ind) {
+                if (! std::isnan(values[ind])) {
+                    dUdw[ind] = values[ind];
                 }
             }
         }
@@ -1020,6 +1037,9 @@ collectGroupUDQValues(const std::vector<UDQInput>&     udqInput,
                       const std::vector<const Group*>& groups,
                       const int                        expectedNumGroupUDQs)
 {
+    const auto groupNames = dUdg::groupNames(groups);
+    auto values = std::vector<double>{};
+
     auto ix = std::size_t{0};
 
     int cnt = 0;
@@ -1027,9 +1047,9 @@ collectGroupUDQValues(const std::vector<UDQInput>&     udqInput,
         if (udq_input.var_type() == UDQVarType::GROUP_VAR) {
             auto dudg = (*this->dUDG_)[ix];
 
-            dUdg::staticContrib(udqState, groups,
+            dUdg::staticContrib(udqState, groupNames,
                                 udq_input.keyword(),
-                                ngmax, dudg);
+                                ngmax, values, dudg);
 
             ++ix;
             ++cnt;
@@ -1086,6 +1106,8 @@ collectWellUDQValues(const std::vector<UDQInput>&    udqInput,
                      const std::vector<std::string>& wells,
                      const int                       expectedNumWellUDQs)
 {
+    auto values = std::vector<double>{};
+
     auto ix = std::size_t {0};
 
     int cnt = 0;
@@ -1095,7 +1117,7 @@ collectWellUDQValues(const std::vector<UDQInput>&    udqInput,
 
             dUdw::staticContrib(udqState, wells,
                                 udq_input.keyword(),
-                                nwmax, dudw);
+                                nwmax, values, dudw);
 
             ++ix;
             ++cnt;
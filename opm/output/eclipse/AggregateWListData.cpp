@@ -54,16 +54,6 @@ std::size_t maxNoOfWellListsPrWell(const std::vector<int>& inteHead)
     return inteHead[VI::intehead::MXWLSTPRWELL];
 }
 
-template <typename T>
-std::optional<int> findInVector(const std::vector<T>  & vecOfElements, const T  & element)
-{
-    // Find given element in vector
-    auto it = std::find(vecOfElements.begin(), vecOfElements.end(), element);
-
-    return (it != vecOfElements.end()) ? std::optional<int> {std::distance(vecOfElements.begin(), it)} :
-           std::nullopt;
-}
-
 std::vector<std::vector<std::size_t>> wellOrderInWList(const Opm::Schedule&   sched,
                                                                 const std::size_t sim_step,
                                                                 const std::vector<int>& inteHead ) {
@@ -72,7 +62,6 @@ std::vector<std::vector<std::size_t>> wellOrderInWList(const Opm::Schedule&   sc
 
     std::vector<std::vector<std::size_t>> curWelOrd;
     std::size_t iwlst;
-    Opm::WList wlist;
     std::vector<std::size_t> well_order;
     well_order.resize(maxNoOfWellListsPrWell(inteHead), 0);
 
@@ -86,8 +75,7 @@ std::vector<std::vector<std::size_t>> wellOrderInWList(const Opm::Schedule&   sc
             iwlst = 0;
             for ( const auto& wlst_name : wListNames) {
                 if (wlmngr.hasList(wlst_name)) {
-                    wlist = wlmngr.getList(wlst_name);
-                    auto well_no = findInVector<std::string>(wlist.wells(), wname);
+                    const auto well_no = wlmngr.getList(wlst_name).position(wname);
                     if (well_no) well_order[iwlst] = well_no.value() + 1;
                     iwlst += 1;
                 } else {
@@ -215,7 +203,7 @@ captureDeclaredWListData(const Schedule&   sched,
 
         {
             // Static contributions to ZWLS array.
-            wellLoop(wells, sched, sim_step, [&welOrdLst, wlmngr, this]
+            wellLoop(wells, sched, sim_step, [&welOrdLst, &wlmngr, this]
                     (const Well& well, const std::size_t wellID) -> void
             {
                 auto zw = this->zWls_[wellID];
@@ -113,6 +113,31 @@ namespace {
         }
     }
 
+    /// Names of the well level tracer summary vectors, e.g., WTPRSEA, in
+    /// tracer index order.  Formatted once per restart step rather than
+    /// once per well and tracer.
+    struct TracerSummaryKeys
+    {
+        explicit TracerSummaryKeys(const Opm::TracerConfig& tracers)
+        {
+            for (const auto& tracer : tracers) {
+                this->wtir.push_back("WTIR" + tracer.name);
+                this->wtpr.push_back("WTPR" + tracer.name);
+                this->wtit.push_back("WTIT" + tracer.name);
+                this->wtpt.push_back("WTPT" + tracer.name);
+                this->wtic.push_back("WTIC" + tracer.name);
+                this->wtpc.push_back("WTPC" + tracer.name);
+            }
+        }
+
+        std::vector<std::string> wtir{};
+        std::vector<std::string> wtpr{};
+        std::vector<std::string> wtit{};
+        std::vector<std::string> wtpt{};
+        std::vector<std::string> wtic{};
+        std::vector<std::string> wtpc{};
+    };
+
     namespace IWell {
         std::size_t entriesPerWell(const std::vector<int>& inteHead)
         {
@@ -130,6 +155,15 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<int>& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<int>;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         std::map <const std::string, size_t>  currentGroupMapNameIndex(const Opm::Schedule& sched, const size_t simStep, const std::vector<int>& inteHead)
         {
             // make group name to index map for the current time step
@@ -637,6 +671,15 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<float>& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<float>;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         std::vector<float> defaultSWell()
         {
             const auto dflt  = -1.0e+20f;
@@ -1077,17 +1120,18 @@ namespace {
         }
 
         template <class SWellArray>
-        void assignTracerData(const Opm::TracerConfig& tracers,
-                              const Opm::SummaryState& smry,
-                              const std::string&       wname,
-                              SWellArray&              sWell)
+        void assignTracerData(const Opm::TracerConfig&  tracers,
+                              const TracerSummaryKeys&  tracerKeys,
+                              const Opm::SummaryState&  smry,
+                              const std::string&        wname,
+                              SWellArray&               sWell)
         {
             auto output_index = static_cast<std::size_t>(VI::SWell::index::TracerOffset);
 
-            for (const auto& tracer : tracers) {
-                if (tracer.phase == Opm::Phase::WATER) {
+            for (std::size_t tracer_index = 0; tracer_index < tracers.size(); ++tracer_index) {
+                if (tracers[tracer_index].phase == Opm::Phase::WATER) {
                     sWell[output_index++] =
-                        smry.get_well_var(wname, fmt::format("WTIC{}", tracer.name), 0.0);
+                        smry.get_well_var(wname, tracerKeys.wtic[tracer_index], 0.0);
                 }
             }
         }
@@ -1098,6 +1142,7 @@ namespace {
                            const std::size_t          sim_step,
                            const Opm::Schedule&       sched,
                            const Opm::TracerConfig&   tracers,
+                           const TracerSummaryKeys&   tracerKeys,
                            const Opm::WellTestState&  wtest_state,
                            const ::Opm::SummaryState& smry,
                            SWellArray&                sWell)
@@ -1133,7 +1178,7 @@ namespace {
             assignDFactorCorrelation(well, units, sWell);
             assignEconomicLimits(well, swprop, sWell);
             assignWellTest(well.name(), sched, wtest_state, sim_step, swprop, sWell);
-            assignTracerData(tracers, smry, well.name(), sWell);
+            assignTracerData(tracers, tracerKeys, smry, well.name(), sWell);
             assignBhpVfpAdjustment(well, swprop, sWell);
         }
     } // SWell
@@ -1158,6 +1203,15 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<double>& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<double>;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         template <class XWellArray>
         void staticContrib(const ::Opm::Well&    well,
                            const Opm::SummaryState& st,
@@ -1336,11 +1390,12 @@ namespace {
         }
 
         template <class XWellArray>
-        void assignTracerData(const Opm::TracerConfig& tracers,
-                              const Opm::Tracers& tracer_dims,
-                              const Opm::SummaryState& smry,
-                              const Opm::Well& well,
-                              XWellArray& xWell)
+        void assignTracerData(const Opm::TracerConfig&   tracers,
+                              const TracerSummaryKeys&   tracerKeys,
+                              const Opm::Tracers&        tracer_dims,
+                              const Opm::SummaryState&   smry,
+                              const Opm::Well&           well,
+                              XWellArray&                xWell)
         {
             if (tracers.empty() || tracer_dims.water_tracers() == 0)
                 return;
@@ -1348,49 +1403,57 @@ namespace {
             using Ix = ::Opm::RestartIO::Helpers::VectorItems::XWell::index;
             std::fill(xWell.begin() + Ix::TracerOffset, xWell.end(), 0);
 
+            // Look up the summary values of each tracer once, in one pass
+            // over the tracers.
+            struct TracerValues
+            {
+                double rate{0.0};
+                double total{0.0};
+                double concentration{0.0};
+            };
 
+            auto values = std::vector<TracerValues>(tracers.size());
             for (std::size_t tracer_index=0; tracer_index < tracers.size(); tracer_index++) {
-                const auto& tracer = tracers[tracer_index];
-                std::size_t output_index = Ix::TracerOffset + tracer_index;
+                auto& v = values[tracer_index];
                 if (well.isInjector()) {
-                    const auto& wtir = smry.get_well_var(well.name(), fmt::format("WTIR{}", tracer.name), 0);
-                    xWell[output_index] = -wtir;
+                    v.rate = -smry.get_well_var(well.name(), tracerKeys.wtir[tracer_index], 0);
+                    v.total = smry.get_well_var(well.name(), tracerKeys.wtit[tracer_index], 0);
                 } else {
-                    const auto& wtpr = smry.get_well_var(well.name(), fmt::format("WTPR{}", tracer.name), 0);
-                    xWell[output_index] = wtpr;
+                    v.rate = smry.get_well_var(well.name(), tracerKeys.wtpr[tracer_index], 0);
+                    if (well.isProducer())
+                        v.total = smry.get_well_var(well.name(), tracerKeys.wtpt[tracer_index], 0);
                 }
+
+                const auto wtic = smry.get_well_var(well.name(), tracerKeys.wtic[tracer_index], 0);
+                v.concentration = (std::abs(wtic) > 0)
+                    ? wtic
+                    : smry.get_well_var(well.name(), tracerKeys.wtpc[tracer_index], 0);
             }
 
+            // Sections in the order of the array.  A later section
+            // overwrites an earlier one if there are more tracers than
+            // water tracers.
+            for (std::size_t tracer_index=0; tracer_index < tracers.size(); tracer_index++) {
+                std::size_t output_index = Ix::TracerOffset + tracer_index;
+                xWell[output_index] = values[tracer_index].rate;
+            }
 
             for (std::size_t tracer_index=0; tracer_index < tracers.size(); tracer_index++) {
-                const auto& tracer = tracers[tracer_index];
                 std::size_t output_index = Ix::TracerOffset + tracer_dims.water_tracers() + tracer_index;
-                if (well.isProducer()) {
-                    const auto& wtpr = smry.get_well_var(well.name(), fmt::format("WTPT{}", tracer.name), 0);
-                    xWell[output_index] = wtpr;
-                }
+                if (well.isProducer())
+                    xWell[output_index] = values[tracer_index].total;
             }
 
             for (std::size_t tracer_index=0; tracer_index < tracers.size(); tracer_index++) {
-                const auto& tracer = tracers[tracer_index];
                 std::size_t output_index = Ix::TracerOffset + 2*tracer_dims.water_tracers() + tracer_index;
-                if (well.isInjector()) {
-                    const auto& wtir = smry.get_well_var(well.name(), fmt::format("WTIT{}", tracer.name), 0);
-                    xWell[output_index] = wtir;
-                }
+                if (well.isInjector())
+                    xWell[output_index] = values[tracer_index].total;
             }
 
             for (std::size_t n=0; n < 2; n++) {
                 for (std::size_t tracer_index=0; tracer_index < tracers.size(); tracer_index++) {
-                    const auto& tracer = tracers[tracer_index];
                     std::size_t output_index = Ix::TracerOffset + (3 + n)*tracer_dims.water_tracers() + tracer_index;
-                    const auto& wtic = smry.get_well_var(well.name(), fmt::format("WTIC{}", tracer.name), 0);
-                    const auto& wtpc = smry.get_well_var(well.name(), fmt::format("WTPC{}", tracer.name), 0);
-
-                    if (std::abs(wtic) > 0)
-                        xWell[output_index] = wtic;
-                    else
-                        xWell[output_index] = wtpc;
+                    xWell[output_index] = values[tracer_index].concentration;
                 }
             }
 
@@ -1402,6 +1465,7 @@ namespace {
         template <class XWellArray>
         void dynamicContrib(const ::Opm::Well&         well,
                             const Opm::TracerConfig&   tracers,
+                            const TracerSummaryKeys&   tracerKeys,
                             const Opm::Tracers&        tracer_dims,
                             const ::Opm::SummaryState& smry,
                             XWellArray&                xWell)
@@ -1433,7 +1497,7 @@ namespace {
                 }
             }
             assignCumulatives(well.name(), smry, xWell);
-            assignTracerData(tracers, tracer_dims, smry, well, xWell);
+            assignTracerData(tracers, tracerKeys, tracer_dims, smry, well, xWell);
         }
     } // XWell
 
@@ -1461,6 +1525,19 @@ namespace {
             };
         }
 
+        void reset(const std::vector<int>& inteHead,
+                   Opm::RestartIO::Helpers::WindowedArray<
+                       Opm::EclIO::PaddedOutputString<8>
+                   >& array)
+        {
+            using WV = Opm::RestartIO::Helpers::WindowedArray<
+                Opm::EclIO::PaddedOutputString<8>
+            >;
+
+            array.reset(WV::NumWindows{ numWells(inteHead) },
+                        WV::WindowSize{ entriesPerWell(inteHead) });
+        }
+
         template <class ZWellArray>
         void staticContrib(const Opm::Well&            well,
                            const Opm::Action::Actions& actions,
@@ -1496,6 +1573,20 @@ AggregateWellData(const std::vector<int>& inteHead)
 
 // ---------------------------------------------------------------------
 
+void
+Opm::RestartIO::Helpers::AggregateWellData::
+reset(const std::vector<int>& inteHead)
+{
+    IWell::reset(inteHead, this->iWell_);
+    SWell::reset(inteHead, this->sWell_);
+    XWell::reset(inteHead, this->xWell_);
+    ZWell::reset(inteHead, this->zWell_);
+
+    this->nWGMax_ = maxNumGroups(inteHead);
+}
+
+// ---------------------------------------------------------------------
+
 void
 Opm::RestartIO::Helpers::AggregateWellData::
 captureDeclaredWellData(const Schedule&             sched,
@@ -1533,14 +1624,15 @@ captureDeclaredWellData(const Schedule&             sched,
     }
 
     // Static contributions to SWEL array.
+    const auto tracerKeys = TracerSummaryKeys { tracers };
     wellLoop(wells, sched, sim_step, [&step_glo, &sim_step, &sched,
-                                      &tracers, &wtest_state, &smry, this]
+                                      &tracers, &tracerKeys, &wtest_state, &smry, this]
              (const Well& well, const std::size_t wellID) -> void
     {
         auto sw = this->sWell_[wellID];
 
         SWell::staticContrib(well, step_glo, sim_step, sched,
-                             tracers, wtest_state, smry, sw);
+                             tracers, tracerKeys, wtest_state, smry, sw);
     });
 
     // Static contributions to XWEL array.
@@ -1593,11 +1685,13 @@ captureDynamicWellData(const Opm::Schedule&       sched,
     });
 
     // Dynamic contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [this, &sched, &tracers, &smry]
+    const auto tracerKeys = TracerSummaryKeys { tracers };
+    wellLoop(wells, sched, sim_step, [this, &sched, &tracers, &tracerKeys, &smry]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xwell = this->xWell_[wellID];
 
-        XWell::dynamicContrib(well, tracers, sched.runspec().tracers(), smry, xwell);
+        XWell::dynamicContrib(well, tracers, tracerKeys,
+                              sched.runspec().tracers(), smry, xwell);
     });
 }
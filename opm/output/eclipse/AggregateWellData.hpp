@@ -49,6 +49,11 @@ namespace Opm { namespace RestartIO { namespace Helpers {
     public:
         explicit AggregateWellData(const std::vector<int>& inteHead);
 
+        /// Resize all arrays to the dimensions in \p inteHead and reset
+        /// their elements to the initial values, reusing existing storage.
+        /// Equivalent to constructing a new object from \p inteHead.
+        void reset(const std::vector<int>& inteHead);
+
         void captureDeclaredWellData(const Schedule&   	       sched,
                                      const TracerConfig&       tracer,
                                      const std::size_t 		     sim_step,
@@ -87,8 +87,8 @@ namespace {
         }
 
         auto ncwmax = 0;
-        for (const auto& well : sched.getWells(lookup_step)) {
-            const auto ncw = well.getConnections().size();
+        for (const auto* well : sched.getWellPtrs(lookup_step)) {
+            const auto ncw = well->getConnections().size();
 
             ncwmax = std::max(ncwmax, static_cast<int>(ncw));
         }
@@ -31,14 +31,19 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/output/eclipse/ActiveIndexByColumns.hpp>
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
 #include <opm/output/eclipse/RestartIO.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
@@ -47,21 +52,30 @@
 #include <opm/output/eclipse/WriteRFT.hpp>
 #include <opm/output/eclipse/WriteRPT.hpp>
 
+#include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <opm/common/utility/String.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <cctype>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <limits>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>    // move
 #include <vector>
@@ -95,6 +109,124 @@ void ensure_directory_exists(const std::filesystem::path& odir)
     }
 }
 
+// Bounded FIFO of time step output jobs processed by background threads.
+// A single thread processes the jobs in order, several threads process
+// them concurrently.  The first exception raised by a job is kept and
+// rethrown on the producer side, remaining jobs are then discarded.
+class OutputQueue
+{
+public:
+    explicit OutputQueue(const std::size_t maxPending,
+                         const std::size_t numWorkers = 1)
+        : maxPending_{std::max(maxPending, std::size_t{1})}
+    {
+        const auto n = std::max(numWorkers, std::size_t{1});
+
+        this->workers_.reserve(n);
+        for (auto i = 0*n; i < n; ++i) {
+            this->workers_.emplace_back([this]() { this->run(); });
+        }
+    }
+
+    ~OutputQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock{this->mutex_};
+            this->stop_ = true;
+        }
+
+        this->cv_.notify_all();
+
+        for (auto& worker : this->workers_) {
+            worker.join();
+        }
+    }
+
+    void push(std::function<void()> job)
+    {
+        std::unique_lock<std::mutex> lock{this->mutex_};
+
+        this->cv_.wait(lock, [this]() {
+            return (this->jobs_.size() < this->maxPending_) || this->error_;
+        });
+
+        this->rethrowError();
+
+        this->jobs_.push_back(std::move(job));
+        this->cv_.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock{this->mutex_};
+
+        this->cv_.wait(lock, [this]() {
+            return (this->jobs_.empty() && (this->busy_ == 0)) || this->error_;
+        });
+
+        this->rethrowError();
+    }
+
+private:
+    std::size_t maxPending_;
+    std::deque<std::function<void()>> jobs_{};
+    std::size_t busy_{0};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::vector<std::thread> workers_{};
+
+    void rethrowError()
+    {
+        if (this->error_) {
+            auto error = this->error_;
+            this->error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock{this->mutex_};
+
+        while (true) {
+            this->cv_.wait(lock, [this]() {
+                return !this->jobs_.empty() || this->stop_;
+            });
+
+            if (this->jobs_.empty())
+                return;
+
+            auto job = std::move(this->jobs_.front());
+            this->jobs_.pop_front();
+            ++this->busy_;
+
+            lock.unlock();
+
+            std::exception_ptr error{};
+            try {
+                job();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+
+            --this->busy_;
+
+            if (error && !this->error_) {
+                this->error_ = error;
+                this->jobs_.clear();
+            }
+
+            this->cv_.notify_all();
+        }
+    }
+};
+
 } // Anonymous namespace
 
 class Opm::EclipseIO::Impl
@@ -107,6 +239,42 @@ public:
          const std::string& baseName,
          const bool writeEsmry);
 
+    ~Impl();
+
+    /// Files to write for a single time step.  Decided by the calling
+    /// thread, written by writeTimeStepFiles().
+    struct TimeStepFiles
+    {
+        int report_step{0};
+        int report_index{0};
+        double secs_elapsed{0.0};
+        bool write_double{false};
+
+        bool summary{false};
+        bool summary_report_step{false};
+        bool final_summary{false};
+        bool run_summary{false};
+        bool restart{false};
+        bool rft{false};
+        bool existing_rft{false};
+    };
+
+    void writeTimeStepFiles(const TimeStepFiles& files,
+                            const Action::State& action_state,
+                            const WellTestState& wtest_state,
+                            const SummaryState&  st,
+                            const UDQState&      udq_state,
+                            RestartValue         value);
+
+    void writeRestartFile(const TimeStepFiles& files,
+                          const Action::State& action_state,
+                          const WellTestState& wtest_state,
+                          const SummaryState&  st,
+                          const UDQState&      udq_state,
+                          RestartValue         value,
+                          std::optional<RestartIO::Helpers::AggregateAquiferData>& aquData,
+                          RestartIO::RestartBuffers& buffers);
+
     void writeINITFile(const data::Solution&                   simProps,
                        std::map<std::string, std::vector<int>> int_data,
                        const std::vector<NNCdata>&             nnc) const;
@@ -131,7 +299,28 @@ public:
     out::Summary summary;
     bool output_enabled;
 
+    // Columnar active cell ordering of 'grid', built on first use.
+    std::optional<ActiveIndexByColumns> activeIndexByColumns{std::nullopt};
+
     std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
+    RestartIO::RestartBuffers restartBuffers{};
+
+    // Arrays already in the unified restart file, if writing unchanged
+    // arrays as references is enabled.
+    std::optional<EclIO::ArrayCatalog> restartCatalog{};
+
+    // Whether to write REAL and DOUB restart arrays compressed.
+    bool restartCompression{false};
+
+    // Background writer, asynchronous mode only.
+    std::unique_ptr<OutputQueue> outputQueue{};
+
+    // Concurrent writers of separate restart files, asynchronous mode
+    // with non-unified restart output only.
+    std::unique_ptr<OutputQueue> restartWriters{};
+    std::mutex restartTimeMutex{};
+
+    OutputTimes outputTimes{};
 
 private:
     mutable bool sumthin_active_{false};
@@ -141,6 +330,8 @@ private:
     bool checkAndRecordIfSumthinTriggered(const int report_step,
                                           const double secs_elapsed) const;
     bool summaryAtRptOnly(const int report_step) const;
+
+    const ActiveIndexByColumns& columnarActiveIndex();
 };
 
 Opm::EclipseIO::Impl::Impl(const EclipseState& eclipseState,
@@ -159,14 +350,145 @@ Opm::EclipseIO::Impl::Impl(const EclipseState& eclipseState,
     , output_enabled(eclipseState.getIOConfig().getOutputEnabled())
 {
     if (const auto& aqConfig = this->es.aquifer();
-        aqConfig.connections().active() || aqConfig.hasNumericalAquifer())
+        aqConfig.connections().active())
     {
+        this->aquiferData
+            .emplace(RestartIO::inferAquiferDimensions(this->es),
+                     aqConfig, this->grid, this->columnarActiveIndex());
+    }
+    else if (aqConfig.hasNumericalAquifer()) {
         this->aquiferData
             .emplace(RestartIO::inferAquiferDimensions(this->es),
                      aqConfig, this->grid);
     }
 }
 
+const Opm::ActiveIndexByColumns&
+Opm::EclipseIO::Impl::columnarActiveIndex()
+{
+    if (! this->activeIndexByColumns.has_value()) {
+        this->activeIndexByColumns
+            .emplace(buildColumnarActiveIndexMappingTables(this->grid));
+    }
+
+    return *this->activeIndexByColumns;
+}
+
+Opm::EclipseIO::Impl::~Impl()
+{
+    // Destroying the queue completes all pending output, which refers to
+    // the other members.  Errors at this point can no longer be reported
+    // to the caller.
+    this->restartWriters.reset();
+    this->outputQueue.reset();
+}
+
+void Opm::EclipseIO::Impl::writeTimeStepFiles(const TimeStepFiles& files,
+                                              const Action::State& action_state,
+                                              const WellTestState& wtest_state,
+                                              const SummaryState&  st,
+                                              const UDQState&      udq_state,
+                                              RestartValue         value)
+{
+    const auto& ioConfig = this->es.cfg().io();
+
+    auto start = std::chrono::steady_clock::now();
+    auto record = [&start](double& total)
+    {
+        const auto stop = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double>(stop - start).count();
+        start = stop;
+    };
+
+    if (files.summary) {
+        this->summary.add_timestep(st, files.report_index, files.summary_report_step);
+        this->summary.write(files.final_summary);
+    }
+
+    if (files.run_summary) {
+        std::filesystem::path outputDir { this->outputDir } ;
+        std::filesystem::path outputFile { outputDir / this->baseName } ;
+        EclIO::ESmry(outputFile).write_rsm_file();
+    }
+
+    record(this->outputTimes.summary);
+
+    // The RFT output only needs the well data.  Keep those apart, such
+    // that the solution arrays are moved into the restart writer rather
+    // than copied.
+    auto rftWells = data::Wells{};
+    if (files.rft) {
+        rftWells = files.restart ? value.wells : std::move(value.wells);
+    }
+
+    if (files.restart) {
+        this->writeRestartFile(files, action_state, wtest_state,
+                               st, udq_state, std::move(value),
+                               this->aquiferData, this->restartBuffers);
+
+        record(this->outputTimes.restart);
+    }
+
+    if (files.rft) {
+        // Open existing RFT file if report step is after first RFT event.
+        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
+            files.existing_rft
+        };
+
+        EclIO::OutputStream::RFT rftFile {
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
+            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+            openExisting
+        };
+
+        RftIO::write(files.report_step, files.secs_elapsed, this->es.getUnits(),
+                     this->grid, this->schedule, rftWells, rftFile);
+
+        record(this->outputTimes.rft);
+    }
+}
+
+void Opm::EclipseIO::Impl::
+writeRestartFile(const TimeStepFiles& files,
+                 const Action::State& action_state,
+                 const WellTestState& wtest_state,
+                 const SummaryState&  st,
+                 const UDQState&      udq_state,
+                 RestartValue         value,
+                 std::optional<RestartIO::Helpers::AggregateAquiferData>& aquData,
+                 RestartIO::RestartBuffers& buffers)
+{
+    const auto& ioConfig = this->es.cfg().io();
+
+    const auto rset = EclIO::OutputStream::ResultSet {
+        this->outputDir, this->baseName
+    };
+
+    const auto fmt  = EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() };
+    const auto unif = EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() };
+
+    auto rstFile = this->restartCatalog.has_value()
+        ? EclIO::OutputStream::Restart {
+            rset, files.report_index, fmt, unif,
+            EclIO::OutputStream::Asynchronous { false },
+            *this->restartCatalog
+        }
+        : EclIO::OutputStream::Restart {
+            rset, files.report_index, fmt, unif
+        };
+
+    if (this->restartCompression) {
+        rstFile.enableCompression();
+    }
+
+    RestartIO::save(rstFile, files.report_step, files.secs_elapsed,
+                    std::move(value),
+                    this->es, this->grid, this->schedule,
+                    action_state, wtest_state, st, udq_state,
+                    aquData, buffers, files.write_double);
+}
+
 void Opm::EclipseIO::Impl::writeINITFile(const data::Solution&                   simProps,
                                          std::map<std::string, std::vector<int>> int_data,
                                          const std::vector<NNCdata>&             nnc) const
@@ -310,78 +632,163 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    const auto& es = this->impl->es;
-    const auto& grid = this->impl->grid;
     const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
 
     const bool final_step { report_step == static_cast<int>(schedule.size()) - 1 };
-    const bool is_final_summary = final_step && !isSubstep;
+
+    auto files = Impl::TimeStepFiles{};
+    files.report_step = report_step;
+    files.secs_elapsed = secs_elapsed;
+    files.write_double = write_double;
 
     // If --enable-write-all-solutions=true we will output every timestep
-    int report_index = time_step ? (*time_step+1) : report_step;
+    files.report_index = time_step ? (*time_step+1) : report_step;
     if (((report_step > 0) &&
         this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed)) || time_step)
     {
-        this->impl->summary.add_timestep(st, report_index, !time_step || isSubstep);
-        this->impl->summary.write(is_final_summary);
+        files.summary = true;
+        files.summary_report_step = !time_step || isSubstep;
+        files.final_summary = final_step && !isSubstep;
         this->impl->recordSummaryOutput(secs_elapsed);
     }
 
-    if (final_step && !isSubstep && this->impl->summaryConfig.createRunSummary()) {
-        std::filesystem::path outputDir { this->impl->outputDir } ;
-        std::filesystem::path outputFile { outputDir / this->impl->baseName } ;
-        EclIO::ESmry(outputFile).write_rsm_file();
-    }
-
-    if ( (time_step && *time_step > 0 ) || (!isSubstep && schedule.write_rst_file(report_step))) {
-        EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            report_index,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
-        };
+    files.run_summary = final_step && !isSubstep
+        && this->impl->summaryConfig.createRunSummary();
 
-        RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
-    }
+    files.restart = (time_step && *time_step > 0)
+        || (!isSubstep && schedule.write_rst_file(report_step));
 
     // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
+    std::tie(files.rft, files.existing_rft) =
         this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
-    {
-        // Open existing RFT file if report step is after first RFT event.
-        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
-            haveExistingRFT
+
+    if (this->impl->outputQueue == nullptr) {
+        this->impl->writeTimeStepFiles(files, action_state, wtest_state,
+                                       st, udq_state, std::move(value));
+    }
+    else if (files.restart && (this->impl->restartWriters != nullptr)) {
+        // Separate restart file, written concurrently with the files of
+        // other time steps.  The job gets its own aquifer data and
+        // restart buffers since those are updated while writing.
+        auto rftValue = RestartValue{};
+        if (files.rft) {
+            rftValue.wells = value.wells;
+        }
+
+        auto restartJob = [impl = this->impl.get(), files,
+                           action_state, wtest_state, st, udq_state,
+                           value = std::move(value),
+                           aquData = this->impl->aquiferData]() mutable
+        {
+            const auto start = std::chrono::steady_clock::now();
+
+            auto buffers = RestartIO::RestartBuffers{};
+            impl->writeRestartFile(files, action_state, wtest_state,
+                                   st, udq_state, std::move(value),
+                                   aquData, buffers);
+
+            const auto elapsed = std::chrono::duration<double>
+                (std::chrono::steady_clock::now() - start).count();
+
+            std::lock_guard<std::mutex> lock{impl->restartTimeMutex};
+            impl->outputTimes.restart += elapsed;
         };
 
-        EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            openExisting
+        // Summary and RFT output append to existing files and are
+        // written in order.
+        auto orderedFiles = files;
+        orderedFiles.restart = false;
+
+        auto job = [impl = this->impl.get(), files = orderedFiles,
+                    action_state, wtest_state, st, udq_state,
+                    value = std::move(rftValue)]() mutable
+        {
+            impl->writeTimeStepFiles(files, action_state, wtest_state,
+                                     st, udq_state, std::move(value));
+        };
+
+        this->impl->restartWriters->push(std::move(restartJob));
+        this->impl->outputQueue->push(std::move(job));
+    }
+    else {
+        // Snapshot of the dynamic state, owned by the output job.
+        auto job = [impl = this->impl.get(), files,
+                    action_state, wtest_state, st, udq_state,
+                    value = std::move(value)]() mutable
+        {
+            impl->writeTimeStepFiles(files, action_state, wtest_state,
+                                     st, udq_state, std::move(value));
         };
 
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+        this->impl->outputQueue->push(std::move(job));
     }
 
     if (!isSubstep) {
+        const auto start = std::chrono::steady_clock::now();
+
         for (const auto& report : schedule[report_step].rpt_config.get()) {
             std::stringstream ss;
             const auto& unit_system = this->impl->es.getUnits();
 
             RptIO::write_report(ss, report.first, report.second,
-                                schedule, grid, unit_system, report_step);
+                                schedule, this->impl->grid, unit_system, report_step);
 
             auto log_string = ss.str();
             if (!log_string.empty()) {
                 OpmLog::note(log_string);
             }
         }
+
+        this->impl->outputTimes.rpt += std::chrono::duration<double>
+            (std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+void Opm::EclipseIO::enableAsyncOutput(const std::size_t max_pending,
+                                       const std::size_t restart_writers)
+{
+    if (this->impl->outputQueue != nullptr) {
+        return;
+    }
+
+    this->impl->outputQueue = std::make_unique<OutputQueue>(max_pending);
+
+    // Separate restart files are independent of each other unless arrays
+    // are written as references to earlier files.
+    if ((restart_writers > 1) &&
+        ! this->impl->es.cfg().io().getUNIFOUT() &&
+        ! this->impl->restartCatalog.has_value())
+    {
+        this->impl->restartWriters = std::make_unique<OutputQueue>
+            (std::max(max_pending, restart_writers), restart_writers);
+    }
+}
+
+void Opm::EclipseIO::enableRestartDeduplication()
+{
+    if (this->impl->restartWriters != nullptr) {
+        // Restart files already written concurrently.
+        return;
+    }
+
+    if (! this->impl->restartCatalog.has_value()) {
+        this->impl->restartCatalog.emplace();
+    }
+}
+
+void Opm::EclipseIO::enableRestartCompression()
+{
+    this->impl->restartCompression = true;
+}
+
+void Opm::EclipseIO::flush()
+{
+    if (this->impl->restartWriters != nullptr) {
+        this->impl->restartWriters->wait();
+    }
+
+    if (this->impl->outputQueue != nullptr) {
+        this->impl->outputQueue->wait();
     }
 }
 
@@ -390,6 +797,17 @@ Opm::EclipseIO::loadRestart(Action::State&                 action_state,
                             SummaryState&                  summary_state,
                             const std::vector<RestartKey>& solution_keys,
                             const std::vector<RestartKey>& extra_keys) const
+{
+    return this->loadRestart(action_state, summary_state, solution_keys,
+                             extra_keys, RestartIO::LoadRequest{});
+}
+
+Opm::RestartValue
+Opm::EclipseIO::loadRestart(Action::State&                 action_state,
+                            SummaryState&                  summary_state,
+                            const std::vector<RestartKey>& solution_keys,
+                            const std::vector<RestartKey>& extra_keys,
+                            const RestartIO::LoadRequest&  request) const
 {
     const auto& initConfig  = this->impl->es.getInitConfig();
     const auto  report_step = initConfig.getRestartStep();
@@ -397,7 +815,13 @@ Opm::EclipseIO::loadRestart(Action::State&                 action_state,
         .getRestartFileName(initConfig.getRestartRootName(), report_step, false);
 
     return RestartIO::load(filename, report_step, action_state, summary_state, solution_keys,
-                           this->impl->es, this->impl->grid, this->impl->schedule, extra_keys);
+                           this->impl->es, this->impl->grid, this->impl->schedule,
+                           extra_keys, request);
+}
+
+const Opm::EclipseIO::OutputTimes& Opm::EclipseIO::outputTimes() const
+{
+    return this->impl->outputTimes;
 }
 
 const Opm::out::Summary& Opm::EclipseIO::summary() const
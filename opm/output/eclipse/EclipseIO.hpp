@@ -27,6 +27,7 @@
 #include <opm/output/data/Solution.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -54,6 +55,10 @@ namespace Opm { namespace out {
     class Summary;
 }} // namespace Opm::out
 
+namespace Opm { namespace RestartIO {
+    struct LoadRequest;
+}} // namespace Opm::RestartIO
+
 namespace Opm {
 /// \brief A class to write reservoir and well states of a blackoil
 ///        simulation to disk.
@@ -140,6 +145,12 @@ public:
     /// can load and restart from files with double precision keywords, but
     /// this is non-standard, and other third party applications might choke
     /// on those.
+    ///
+    /// In asynchronous mode, see enableAsyncOutput(), the dynamic states
+    /// are copied, the RestartValue is taken over, and the summary,
+    /// restart and RFT files are written by a background thread.  Errors
+    /// from that thread are rethrown by the next call to writeTimeStep()
+    /// or flush().
     void writeTimeStep(const Action::State& action_state,
                        const WellTestState& wtest_state,
                        const SummaryState&  st,
@@ -151,6 +162,56 @@ public:
                        const bool write_double = false,
                        std::optional<int>   time_step = std::nullopt);
 
+    /// \brief Write time step output on a background thread.
+    ///
+    /// Summary, restart and RFT output of subsequent writeTimeStep()
+    /// calls is queued and written in order by a dedicated I/O thread,
+    /// while the PRT reports are still written by the calling thread.
+    /// writeTimeStep() blocks while \p max_pending time steps are already
+    /// waiting to be written.
+    ///
+    /// With separate (non-unified) restart files, the restart files of up
+    /// to \p restart_writers time steps are in addition written
+    /// concurrently by a pool of threads, while summary and RFT output,
+    /// which update existing files, is still written in order.  Restart
+    /// files written concurrently can not refer to each other's arrays,
+    /// so this is not combined with enableRestartDeduplication().  The
+    /// mode enabled first applies.
+    ///
+    /// \param[in] max_pending Maximum number of queued time steps.
+    ///
+    /// \param[in] restart_writers Number of threads writing separate
+    ///    restart files.  One writes restart files on the I/O thread.
+    void enableAsyncOutput(std::size_t max_pending = 2,
+                           std::size_t restart_writers = 1);
+
+    /// \brief Write restart arrays which repeat an array of an earlier
+    /// report step as references to that array.
+    ///
+    /// OPM extension which shrinks unified restart files with many report
+    /// steps, e.g., by storing static well and connection data, well and
+    /// group names, and UDQ and ACTIONX definitions once.  Such files
+    /// are read transparently by ERst, but not by other applications.
+    /// Has no effect on formatted output.
+    void enableRestartDeduplication();
+
+    /// \brief Write REAL and DOUB restart arrays, e.g., the solution
+    /// arrays PRESSURE, SWAT, SGAS, RS and RV, losslessly compressed.
+    ///
+    /// OPM extension which shrinks restart files.  Each array is
+    /// compressed on its own, so single arrays of a report step are still
+    /// read without decoding any others.  Such files are read
+    /// transparently by ERst and EclFile, and "convertECL -u" rewrites
+    /// them in the standard format.  Has no effect on formatted output.
+    void enableRestartCompression();
+
+    /// \brief Wait until all queued time step output has been written.
+    ///
+    /// Rethrows the first error raised by the background thread.  The
+    /// summary() object must not be used in asynchronous mode without a
+    /// preceding flush().  No-op in synchronous mode.
+    void flush();
+
     /// Will load solution data and wellstate from the restart file.  This
     /// method will consult the IOConfig object to get filename and report
     /// step to restart from.
@@ -186,6 +247,32 @@ public:
                              const std::vector<RestartKey>& solution_keys,
                              const std::vector<RestartKey>& extra_keys = {}) const;
 
+    /// Same as above, but only reconstructs the parts of the dynamic
+    /// state named in \p request, e.g., to skip groups, aquifers and UDQs
+    /// when only the solution and the well state are needed.
+    RestartValue loadRestart(Action::State&                 action_state,
+                             SummaryState&                  summary_state,
+                             const std::vector<RestartKey>& solution_keys,
+                             const std::vector<RestartKey>& extra_keys,
+                             const RestartIO::LoadRequest&  request) const;
+
+    /// Accumulated wall-clock time, in seconds, spent writing each kind
+    /// of time step output since construction.
+    struct OutputTimes
+    {
+        double summary{0.0};
+        double restart{0.0};
+        double rft{0.0};
+        double rpt{0.0};
+    };
+
+    /// \brief Time spent in each output stage of writeTimeStep().
+    ///
+    /// In asynchronous mode the summary, restart and RFT times are
+    /// recorded by the background thread and are only consistent after a
+    /// flush().
+    const OutputTimes& outputTimes() const;
+
     const out::Summary& summary() const;
     const SummaryConfig& finalSummaryConfig() const;
 
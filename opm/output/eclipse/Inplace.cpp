@@ -34,27 +34,6 @@ namespace {
 static const std::string FIELD_NAME = std::string{"FIELD"};
 static const std::size_t FIELD_ID   = 0;
 
-std::size_t region_max(const std::unordered_map<std::size_t, double>& region_map)
-{
-    return std::accumulate(region_map.begin(), region_map.end(), std::size_t{0},
-                           [](const std::size_t max, const auto& elm)
-                           {
-                               return std::max(max, elm.first);
-                           });
-}
-
-std::size_t
-phase_region_max(const std::unordered_map<Opm::Inplace::Phase, std::unordered_map<std::size_t, double>>& phase_map)
-{
-    return std::accumulate(phase_map.begin(),
-                           phase_map.end(),
-                           std::size_t{0},
-        [](const std::size_t max, const auto& region_map)
-    {
-        return std::max(max, region_max(region_map.second));
-    });
-}
-
 template <typename Vector>
 Vector append(Vector first, const Vector& second)
 {
@@ -79,7 +58,18 @@ void Inplace::add(const std::string&   region,
                   const std::size_t    region_id,
                   const double         value)
 {
-    this->phase_values[region][phase][region_id] = value;
+    auto& region_set = this->region_sets[region];
+    auto& phase_values = region_set.phases[static_cast<std::size_t>(phase)];
+
+    if (region_id >= phase_values.values.size()) {
+        phase_values.values.resize(region_id + 1, 0.0);
+        phase_values.defined.resize(region_id + 1, false);
+    }
+
+    phase_values.values[region_id] = value;
+    phase_values.defined[region_id] = true;
+
+    region_set.max_region = std::max(region_set.max_region, region_id);
 }
 
 void Inplace::add(Inplace::Phase phase, double value)
@@ -91,30 +81,31 @@ double Inplace::get(const std::string&   region,
                     const Inplace::Phase phase,
                     const std::size_t    region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+    auto region_iter = this->region_sets.find(region);
+    if (region_iter == this->region_sets.end()) {
         throw std::logic_error {
             fmt::format("No such region: {}", region)
         };
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto& phase_values = region_iter->second.phases[static_cast<std::size_t>(phase)];
+    if (phase_values.values.empty()) {
         throw std::logic_error {
             fmt::format("No such phase: {}:{}",
                         region, static_cast<int>(phase))
         };
     }
 
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end()) {
+    if ((region_id >= phase_values.defined.size()) ||
+        ! phase_values.defined[region_id])
+    {
         throw std::logic_error {
             fmt::format("No such region id: {}:{}:{}",
                         region, static_cast<int>(phase), region_id)
         };
     }
 
-    return value_iter->second;
+    return phase_values.values[region_id];
 }
 
 double Inplace::get(Inplace::Phase phase) const
@@ -126,18 +117,14 @@ bool Inplace::has(const std::string& region,
                   const Phase        phase,
                   const std::size_t  region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+    auto region_iter = this->region_sets.find(region);
+    if (region_iter == this->region_sets.end()) {
         return false;
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
-        return false;
-    }
+    const auto& defined = region_iter->second.phases[static_cast<std::size_t>(phase)].defined;
 
-    return phase_iter->second.find(region_id)
-        != phase_iter->second.end();
+    return (region_id < defined.size()) && defined[region_id];
 }
 
 bool Inplace::has(Phase phase) const
@@ -147,53 +134,78 @@ bool Inplace::has(Phase phase) const
 
 std::size_t Inplace::max_region() const
 {
-    return std::accumulate(this->phase_values.begin(),
-                           this->phase_values.end(),
+    return std::accumulate(this->region_sets.begin(),
+                           this->region_sets.end(),
                            std::size_t{0},
-        [](const std::size_t max, const auto& phase_map)
+        [](const std::size_t max, const auto& region_set)
     {
-        return std::max(max, phase_region_max(phase_map.second));
+        return std::max(max, region_set.second.max_region);
     });
 }
 
 std::size_t Inplace::max_region(const std::string& region_name) const
 {
-    auto region_iter = this->phase_values.find(region_name);
-    if (region_iter == this->phase_values.end()) {
+    auto region_iter = this->region_sets.find(region_name);
+    if (region_iter == this->region_sets.end()) {
         throw std::logic_error {
             fmt::format("No such region: {}", region_name)
         };
     }
 
-    return phase_region_max(region_iter->second);
+    return region_iter->second.max_region;
 }
 
 std::vector<double>
 Inplace::get_vector(const std::string& region,
                     const Phase        phase) const
 {
-    std::vector<double> v(this->max_region(region), 0.0);
+    auto v = std::vector<double>{};
+    this->get_vector(region, phase, v);
+
+    return v;
+}
+
+void Inplace::get_vector(const std::string&   region,
+                         const Phase          phase,
+                         std::vector<double>& v) const
+{
+    const auto& values = this->phase_values(region, phase).values;
+
+    // Region IDs are one-based.  Entries beyond the largest region ID of
+    // this particular phase are zero.
+    v.assign(this->max_region(region), 0.0);
+    if (values.size() > 1) {
+        std::copy(values.begin() + 1, values.end(), v.begin());
+    }
+}
+
+Inplace::ValueSpan
+Inplace::values(const std::string& region, const Phase phase) const
+{
+    const auto& values = this->phase_values(region, phase).values;
 
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+    return { values.data(), values.size() };
+}
+
+const Inplace::PhaseValues&
+Inplace::phase_values(const std::string& region, const Phase phase) const
+{
+    auto region_iter = this->region_sets.find(region);
+    if (region_iter == this->region_sets.end()) {
         throw std::logic_error {
             fmt::format("No such region: {}", region)
         };
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto& phase_values = region_iter->second.phases[static_cast<std::size_t>(phase)];
+    if (phase_values.values.empty()) {
         throw std::logic_error {
             fmt::format("Phase {} does not exist in region {}",
                         static_cast<int>(phase), region)
         };
     }
 
-    for (const auto& [region_id, value] : phase_iter->second) {
-        v[region_id - 1] = value;
-    }
-
-    return v;
+    return phase_values;
 }
 
 const std::vector<Inplace::Phase>& Inplace::phases()
@@ -242,9 +254,21 @@ const std::vector<Inplace::Phase>& Inplace::mixingPhases()
     return mixingPhases_;
 }
 
+bool Inplace::PhaseValues::operator==(const PhaseValues& that) const
+{
+    return (this->values == that.values)
+        && (this->defined == that.defined);
+}
+
+bool Inplace::RegionSet::operator==(const RegionSet& that) const
+{
+    return (this->max_region == that.max_region)
+        && (this->phases == that.phases);
+}
+
 bool Inplace::operator==(const Inplace& rhs) const
 {
-    return this->phase_values == rhs.phase_values;
+    return this->region_sets == rhs.region_sets;
 }
 
 } // namespace Opm
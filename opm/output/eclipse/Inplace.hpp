@@ -20,6 +20,7 @@
 #ifndef ORIGINAL_OIP
 #define ORIGINAL_OIP
 
+#include <array>
 #include <cstddef>
 #include <string>
 #include <unordered_map>
@@ -77,6 +78,37 @@ public:
         CO2MassInGasPhaseMaximumUnTrapped = 33,
     };
 
+    /// Number of distinct in-place quantities.
+    static constexpr std::size_t NumPhases =
+        static_cast<std::size_t>(Phase::CO2MassInGasPhaseMaximumUnTrapped) + 1;
+
+    /// Read-only view of the values of a single quantity in all regions
+    /// of a region set, indexed by region ID.  Regions for which no value
+    /// has been assigned hold zero.
+    class ValueSpan
+    {
+    public:
+        ValueSpan() = default;
+        ValueSpan(const double* begin, const std::size_t size)
+            : begin_ { begin }, size_ { size }
+        {}
+
+        const double* begin() const { return this->begin_; }
+        const double* end() const { return this->begin_ + this->size_; }
+
+        std::size_t size() const { return this->size_; }
+        bool empty() const { return this->size_ == 0; }
+
+        double operator[](const std::size_t region_number) const
+        {
+            return this->begin_[region_number];
+        }
+
+    private:
+        const double* begin_{nullptr};
+        std::size_t size_{0};
+    };
+
     /// Create non-defaulted object suitable for testing the serialisation
     /// operation.
     static Inplace serializationTestObject();
@@ -186,6 +218,36 @@ public:
     std::vector<double>
     get_vector(const std::string& region, Phase phase) const;
 
+    /// Linearised per-region values for a given phase in a specific region
+    /// set, into an existing buffer.
+    ///
+    /// Same as the value returning get_vector(), but reuses the storage of
+    /// \p values, e.g., when extracting many quantities in sequence.
+    ///
+    /// \param[in] region Region set name, e.g., "FIPNUM" or "FIPABC".
+    ///
+    /// \param[in] Phase In-place quantity.
+    ///
+    /// \param[out] values Per-region values of requested quantity,
+    ///   resized to max_region(region) and indexed by (region_number - 1).
+    void get_vector(const std::string& region,
+                    Phase phase,
+                    std::vector<double>& values) const;
+
+    /// Direct access to the per-region values of a given phase in a
+    /// specific region set.
+    ///
+    /// Throws the same exceptions as get_vector().  The view is valid
+    /// until the next call to add().
+    ///
+    /// \param[in] region Region set name, e.g., "FIPNUM" or "FIPABC".
+    ///
+    /// \param[in] Phase In-place quantity.
+    ///
+    /// \return Values of requested quantity, indexed by region ID.  Size
+    ///   is one more than the largest region ID assigned for \p phase.
+    ValueSpan values(const std::string& region, Phase phase) const;
+
     /// Get iterable list of all quantities which can be handled/updated in
     /// a generic way.
     static const std::vector<Phase>& phases();
@@ -202,7 +264,7 @@ public:
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
-        serializer(phase_values);
+        serializer(region_sets);
     }
 
     /// Equality predicate.
@@ -214,13 +276,43 @@ public:
     bool operator==(const Inplace& rhs) const;
 
 private:
-    using ValueMap = std::unordered_map<std::size_t, double>;
-    using PhaseMap = std::unordered_map<Phase, ValueMap>;
-    using RegionMap = std::unordered_map<std::string, PhaseMap>;
+    /// Values of a single quantity in a region set, indexed by region ID.
+    struct PhaseValues
+    {
+        std::vector<double> values{};
+        std::vector<bool> defined{};
+
+        bool operator==(const PhaseValues& that) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(values);
+            serializer(defined);
+        }
+    };
+
+    /// Values of all quantities in a region set, indexed by phase.
+    struct RegionSet
+    {
+        std::size_t max_region{0};
+        std::array<PhaseValues, NumPhases> phases{};
+
+        bool operator==(const RegionSet& that) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(max_region);
+            serializer(phases);
+        }
+    };
 
     /// Numerical values of all registered quantities in all registered
     /// region sets.
-    RegionMap phase_values{};
+    std::unordered_map<std::string, RegionSet> region_sets{};
+
+    const PhaseValues& phase_values(const std::string& region, Phase phase) const;
 };
 
 } // namespace Opm
@@ -674,6 +674,58 @@ namespace {
         return sol;
     }
 
+    template <typename ElmType>
+    std::vector<double>
+    partitionVector(const std::string&                           key,
+                    const std::vector<Opm::RestartIO::CellRange>& partition,
+                    const Opm::EclIO::RestartFileView&            rst_view)
+    {
+        auto values = std::vector<double>{};
+
+        for (const auto& range : partition) {
+            const auto data = rst_view.getKeywordRange<ElmType>
+                (key, range.begin, range.end - range.begin);
+
+            values.insert(values.end(), data.begin(), data.end());
+        }
+
+        return values;
+    }
+
+    // Like loadIfAvailable(), but only reads the cells in 'partition'.
+    void loadPartitionIfAvailable(const Opm::RestartKey&                        value,
+                                  const std::size_t                             numcells,
+                                  const std::vector<Opm::RestartIO::CellRange>& partition,
+                                  const Opm::EclIO::RestartFileView&            rst_view,
+                                  Opm::data::Solution&                          sol)
+    {
+        const auto isDouble = rst_view.hasKeyword<double>(value.key);
+
+        if (! isDouble && ! rst_view.hasKeyword<float>(value.key)) {
+            throwIfMissingRequired(value);
+            return;
+        }
+
+        const auto size = isDouble
+            ? rst_view.keywordSize<double>(value.key)
+            : rst_view.keywordSize<float>(value.key);
+
+        if (size != numcells) {
+            throw std::runtime_error {
+                "Restart file: Could not restore '"
+                + value.key
+                + "', mismatched number of cells"
+            };
+        }
+
+        auto kwdata = isDouble
+            ? partitionVector<double>(value.key, partition, rst_view)
+            : partitionVector<float>(value.key, partition, rst_view);
+
+        sol.insert(value.key, value.dim, std::move(kwdata),
+                   Opm::data::TargetType::RESTART_SOLUTION);
+    }
+
     void restoreExtra(const std::vector<Opm::RestartKey>& extra_keys,
                       const Opm::UnitSystem&              usys,
                       const Opm::EclIO::RestartFileView&  rst_view,
@@ -1099,11 +1151,11 @@ namespace {
         const auto& units  = es.getUnits();
         const auto& phases = es.runspec().phases();
 
-        const auto& wells = schedule.getWells(rst_view->simStep());
+        const auto wells = schedule.getWellPtrs(rst_view->simStep());
         for (auto nWells = wells.size(), wellID = 0*nWells;
                   wellID < nWells; ++wellID)
         {
-            const auto& well = wells[wellID];
+            const auto& well = *wells[wellID];
 
             soln[well.name()] =
                 restore_well(well, wellID, grid, units,
@@ -1602,7 +1654,7 @@ namespace Opm { namespace RestartIO  {
     RestartValue
     load(const std::string&             filename,
          int                            report_step,
-         Action::State&                 /*  action_state  */,
+         Action::State&                 action_state,
          SummaryState&                  summary_state,
          const std::vector<RestartKey>& solution_keys,
          const EclipseState&            es,
@@ -1610,16 +1662,44 @@ namespace Opm { namespace RestartIO  {
          const Schedule&                schedule,
          const std::vector<RestartKey>& extra_keys)
     {
+        return load(filename, report_step, action_state, summary_state,
+                    solution_keys, es, grid, schedule, extra_keys,
+                    LoadRequest{});
+    }
+
+    RestartValue
+    load(const std::string&             filename,
+         int                            report_step,
+         Action::State&                 /*  action_state  */,
+         SummaryState&                  summary_state,
+         const std::vector<RestartKey>& solution_keys,
+         const EclipseState&            es,
+         const EclipseGrid&             grid,
+         const Schedule&                schedule,
+         const std::vector<RestartKey>& extra_keys,
+         const LoadRequest&             request)
+    {
+        // Read all arrays of the report step up front only if the full
+        // state is requested.  Otherwise arrays are read on first access,
+        // so components which are not requested cost nothing.
+        const auto preload = request.wells && request.groups &&
+            request.aquifers && request.udq && request.cumulatives;
+
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::make_shared<Opm::EclIO::ERst>(filename), report_step);
+            (std::make_shared<Opm::EclIO::ERst>(filename), report_step, preload);
 
         auto xr = restoreSOLUTION(solution_keys, grid.getNumActive(), *rst_view);
         xr.convertToSI(es.getUnits());
 
-        auto xw = restore_wells(es, grid, schedule, summary_state, rst_view);
-        auto xgrp_nwrk = restore_grp_nwrk(schedule, es.getUnits(), rst_view);
+        auto xw = request.wells
+            ? restore_wells(es, grid, schedule, summary_state, rst_view)
+            : data::Wells{};
+
+        auto xgrp_nwrk = request.groups
+            ? restore_grp_nwrk(schedule, es.getUnits(), rst_view)
+            : data::GroupAndNetworkValues{};
 
-        auto aquifers = hasAquifers(*rst_view)
+        auto aquifers = (request.aquifers && hasAquifers(*rst_view))
             ? restore_aquifers(es, rst_view) : data::Aquifers{};
 
         auto rst_value = RestartValue {
@@ -1630,13 +1710,50 @@ namespace Opm { namespace RestartIO  {
             restoreExtra(extra_keys, es.getUnits(), *rst_view, rst_value);
         }
 
-        if (rst_view->hasKeyword<std::string>("ZUDN")) {
+        if (request.udq && rst_view->hasKeyword<std::string>("ZUDN")) {
             restoreUDQValues(schedule, rst_view, summary_state);
         }
 
-        restore_cumulative(summary_state, schedule, es.tracer(), std::move(rst_view));
+        if (request.cumulatives) {
+            restore_cumulative(summary_state, schedule, es.tracer(), std::move(rst_view));
+        }
 
         return rst_value;
     }
 
+    data::Solution
+    loadSolution(const std::string&             filename,
+                 int                            report_step,
+                 const std::vector<RestartKey>& solution_keys,
+                 const EclipseState&            es,
+                 const EclipseGrid&             grid,
+                 const std::vector<CellRange>&  partition)
+    {
+        const auto numcells = static_cast<std::size_t>(grid.getNumActive());
+
+        for (const auto& range : partition) {
+            if ((range.begin > range.end) || (range.end > numcells)) {
+                throw std::invalid_argument {
+                    fmt::format("Cell range [{}, {}) is not inside "
+                                "the {} active cells of the model",
+                                range.begin, range.end, numcells)
+                };
+            }
+        }
+
+        const auto rst_view = Opm::EclIO::RestartFileView {
+            std::make_shared<Opm::EclIO::ERst>(filename), report_step,
+            /* preload = */ false
+        };
+
+        auto sol = data::Solution { /* init_si = */ false };
+        for (const auto& value : solution_keys) {
+            loadPartitionIfAvailable(value, numcells, partition, rst_view, sol);
+        }
+
+        sol.convertToSI(es.getUnits());
+
+        return sol;
+    }
+
 }} // Opm::RestartIO
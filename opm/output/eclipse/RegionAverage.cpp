@@ -0,0 +1,219 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/RegionAverage.hpp>
+
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+
+#include <opm/input/eclipse/Schedule/Group/GPMaint.hpp>
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+Opm::out::RegionAverage::RegionAverage(const std::vector<Region>& regions,
+                                       const FieldPropsManager&   fp)
+    : numActive_ { fp.active_size() }
+{
+    // Positions in regions_ of the requested IDs of each region set.
+    auto regionSets = std::map<std::string, std::map<int, std::size_t>>{};
+
+    for (const auto& region : regions) {
+        if (this->index_.count(region) > 0) {
+            continue;
+        }
+
+        const auto index = this->regions_.size();
+        this->regions_.push_back(region);
+        this->index_.emplace(region, index);
+        regionSets[region.first].emplace(region.second, index);
+    }
+
+    // Counting sort of the active cells by region.  Each region set is
+    // scanned twice, and cells are stored in increasing order.
+    auto count = std::vector<std::size_t>(this->regions_.size(), 0);
+    auto lookup = std::map<std::string, std::vector<int>>{};
+
+    for (const auto& [setName, ids] : regionSets) {
+        const auto& regionArray = fp.get_int(setName);
+
+        // Position in regions_ of each region ID, -1 for IDs which are
+        // not requested.
+        auto& position = lookup[setName];
+        position.assign(std::max(ids.rbegin()->first + 1, 0), -1);
+        for (const auto& [id, index] : ids) {
+            if (id >= 0) {
+                position[id] = static_cast<int>(index);
+            }
+        }
+
+        for (const auto& id : regionArray) {
+            if ((id >= 0) && (static_cast<std::size_t>(id) < position.size()) && (position[id] >= 0)) {
+                ++count[position[id]];
+            }
+        }
+    }
+
+    this->start_.assign(this->regions_.size() + 1, 0);
+    for (std::size_t i = 0; i < count.size(); ++i) {
+        this->start_[i + 1] = this->start_[i] + count[i];
+    }
+
+    this->cells_.resize(this->start_.back());
+    auto next = std::vector<std::size_t>(this->start_.begin(), this->start_.end() - 1);
+
+    for (const auto& [setName, position] : lookup) {
+        const auto& regionArray = fp.get_int(setName);
+
+        for (std::size_t cell = 0; cell < regionArray.size(); ++cell) {
+            const auto id = regionArray[cell];
+            if ((id >= 0) && (static_cast<std::size_t>(id) < position.size()) && (position[id] >= 0)) {
+                this->cells_[next[position[id]]++] = cell;
+            }
+        }
+    }
+}
+
+std::vector<Opm::out::RegionAverage::Region>
+Opm::out::RegionAverage::gpmaintRegions(const Schedule& schedule)
+{
+    auto regions = std::set<Region>{};
+
+    for (const auto& state : schedule) {
+        for (const auto& [_, group] : state.groups) {
+            (void)_;
+            const auto& gpm = group->gpmaint();
+            if (! gpm.has_value()) {
+                continue;
+            }
+
+            if (auto region = gpm->region(); region.has_value()) {
+                regions.insert(*region);
+            }
+        }
+    }
+
+    return { regions.begin(), regions.end() };
+}
+
+std::optional<std::size_t>
+Opm::out::RegionAverage::index(const std::string& region_set,
+                               const int          region_id) const
+{
+    auto pos = this->index_.find(Region { region_set, region_id });
+    if (pos == this->index_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+void Opm::out::RegionAverage::sums(const std::vector<double>& values,
+                                   const std::vector<double>& weights,
+                                   std::vector<double>&       weighted_sum,
+                                   std::vector<double>&       weight_sum) const
+{
+    this->checkSize(values, weights);
+
+    weighted_sum.assign(this->size(), 0.0);
+    weight_sum.assign(this->size(), 0.0);
+
+    for (std::size_t i = 0; i < this->size(); ++i) {
+        weighted_sum[i] = this->weightedSum(i, values, weights, weight_sum[i]);
+    }
+}
+
+std::vector<double>
+Opm::out::RegionAverage::average(const std::vector<double>& values,
+                                 const std::vector<double>& weights) const
+{
+    auto result = std::vector<double>{};
+    auto weight_sum = std::vector<double>{};
+
+    this->sums(values, weights, result, weight_sum);
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = (weight_sum[i] != 0.0) ? result[i] / weight_sum[i] : 0.0;
+    }
+
+    return result;
+}
+
+double Opm::out::RegionAverage::average(const std::string&         region_set,
+                                        const int                  region_id,
+                                        const std::vector<double>& values,
+                                        const std::vector<double>& weights) const
+{
+    const auto index = this->index(region_set, region_id);
+    if (! index.has_value()) {
+        throw std::invalid_argument {
+            fmt::format("Region {} of region set {} is not averaged",
+                        region_id, region_set)
+        };
+    }
+
+    this->checkSize(values, weights);
+
+    auto weight_sum = 0.0;
+    const auto weighted_sum = this->weightedSum(*index, values, weights, weight_sum);
+
+    return (weight_sum != 0.0) ? weighted_sum / weight_sum : 0.0;
+}
+
+double Opm::out::RegionAverage::weightedSum(const std::size_t          index,
+                                            const std::vector<double>& values,
+                                            const std::vector<double>& weights,
+                                            double&                    weight_sum) const
+{
+    const auto* cell = this->cells_.data() + this->start_[index];
+    const auto n = this->numCells(index);
+
+    auto sum = 0.0;
+    auto wsum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto w = weights[cell[i]];
+        sum += w * values[cell[i]];
+        wsum += w;
+    }
+
+    weight_sum = wsum;
+    return sum;
+}
+
+void Opm::out::RegionAverage::checkSize(const std::vector<double>& values,
+                                        const std::vector<double>& weights) const
+{
+    if ((values.size() != this->numActive_) || (weights.size() != this->numActive_)) {
+        throw std::invalid_argument {
+            fmt::format("Region average: {} values and {} weights, expected {}",
+                        values.size(), weights.size(), this->numActive_)
+        };
+    }
+}
@@ -0,0 +1,130 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_REGION_AVERAGE_HPP
+#define OPM_REGION_AVERAGE_HPP
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+    class FieldPropsManager;
+    class Schedule;
+} // namespace Opm
+
+namespace Opm { namespace out {
+
+    /// Weighted averages of cell values over a fixed set of regions.
+    ///
+    /// Intended for the hydrocarbon pore volume weighted pressure of the
+    /// regions controlled by GPMAINT, which is needed at every time step.
+    /// The active cells of each region are collected once, so computing
+    /// the averages costs time proportional to the number of cells in
+    /// the selected regions rather than to the size of the grid.
+    ///
+    /// Cell values and weights are indexed by active cell, like the
+    /// arrays of the FieldPropsManager used to build the object.
+    class RegionAverage
+    {
+    public:
+        /// Region set, e.g., "FIPNUM", and region ID.
+        using Region = std::pair<std::string, int>;
+
+        RegionAverage() = default;
+
+        /// Collect the cells of \p regions.  Duplicate regions are
+        /// ignored.
+        RegionAverage(const std::vector<Region>& regions,
+                      const FieldPropsManager&   fp);
+
+        /// Regions referenced by GPMAINT at any report step, in
+        /// increasing order.
+        static std::vector<Region> gpmaintRegions(const Schedule& schedule);
+
+        /// Number of regions.
+        std::size_t size() const
+        {
+            return this->regions_.size();
+        }
+
+        /// Regions in the order of the averages.
+        const std::vector<Region>& regions() const
+        {
+            return this->regions_;
+        }
+
+        /// Position of a region in regions(), or nullopt.
+        std::optional<std::size_t> index(const std::string& region_set,
+                                         int                region_id) const;
+
+        /// Number of active cells in region \p index.
+        std::size_t numCells(const std::size_t index) const
+        {
+            return this->start_[index + 1] - this->start_[index];
+        }
+
+        /// Sum of weights[c] * values[c] and of weights[c] over the cells
+        /// of each region.  For a distributed grid the sums of all
+        /// processes are added before dividing.
+        ///
+        /// Throws std::invalid_argument unless \p values and \p weights
+        /// have one element per active cell.
+        void sums(const std::vector<double>& values,
+                  const std::vector<double>& weights,
+                  std::vector<double>&       weighted_sum,
+                  std::vector<double>&       weight_sum) const;
+
+        /// Weighted average of \p values for each region, zero for
+        /// regions with zero total weight.
+        std::vector<double> average(const std::vector<double>& values,
+                                    const std::vector<double>& weights) const;
+
+        /// Weighted average of \p values for a single region.  Throws
+        /// std::invalid_argument if the region is not one of regions().
+        double average(const std::string&         region_set,
+                       int                        region_id,
+                       const std::vector<double>& values,
+                       const std::vector<double>& weights) const;
+
+    private:
+        std::vector<Region> regions_{};
+        std::map<Region, std::size_t> index_{};
+
+        // Active cells of region i are cells_[start_[i] .. start_[i+1]).
+        std::vector<std::size_t> start_{0};
+        std::vector<std::size_t> cells_{};
+
+        std::size_t numActive_{0};
+
+        double weightedSum(std::size_t                index,
+                           const std::vector<double>& values,
+                           const std::vector<double>& weights,
+                           double&                    weight_sum) const;
+
+        void checkSize(const std::vector<double>& values,
+                       const std::vector<double>& weights) const;
+    };
+
+}} // namespace Opm::out
+
+#endif // OPM_REGION_AVERAGE_HPP
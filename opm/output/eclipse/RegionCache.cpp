@@ -30,10 +30,11 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <functional>
+#include <exception>
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 Opm::out::RegionCache::RegionCache(const std::set<std::string>& fip_regions,
@@ -53,66 +54,152 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
         return;
     }
 
-    auto regions = std::vector<std::reference_wrapper<const std::vector<int>>>{};
-    std::transform(fip_regions.begin(), fip_regions.end(),
-                   std::back_inserter(regions),
-                   [&fp](const auto& fipReg)
-                   {
-                       return std::cref(fp.get_int(fipReg));
-                   });
+    // Active connections of wells which are not yet in the cache.
+    const auto firstNewConnection = this->connections_.size();
 
     for (const auto& wname : schedule.back().well_order()) {
+        if (this->wellIndex_.find(wname) != this->wellIndex_.end()) {
+            continue;
+        }
+
         const auto& conns = schedule.back().wells(wname).getConnections();
         if (conns.empty()) { continue; }
 
-        auto regID = regions.begin();
-        for (const auto& fipReg : fip_regions) {
-            auto first = true;
+        const auto well = static_cast<int>(this->wellNames_.size());
+        this->wellNames_.push_back(wname);
+        this->wellIndex_.emplace(wname, well);
 
-            for (const auto& conn : conns) {
-                if (! grid.cellActive(conn.global_index())) {
-                    continue;
-                }
+        for (const auto& conn : conns) {
+            if (! grid.cellActive(conn.global_index())) {
+                continue;
+            }
 
-                const auto region = regID->get()[grid.activeIndex(conn.global_index())];
-                const auto reg_pair = std::make_pair(fipReg, region);
+            this->connections_.push_back({
+                well, conn.global_index(), grid.activeIndex(conn.global_index())
+            });
+        }
+    }
 
-                this->connection_map[reg_pair]
-                    .emplace_back(wname, conn.global_index());
+    // Region sets are independent and are built concurrently.  New region
+    // sets need all connections while existing ones need only the new
+    // connections.
+    auto regionSets = std::vector<RegionSet*>{};
+    auto regions = std::vector<const std::vector<int>*>{};
+    auto firstConnection = std::vector<std::size_t>{};
 
-                if (first) {
-                    this->well_map[reg_pair].push_back(wname);
+    for (const auto& fipReg : fip_regions) {
+        auto [pos, inserted] = this->regionSets_.try_emplace(fipReg);
 
-                    first = false;
-                }
-            }
+        regionSets.push_back(&pos->second);
+        regions.push_back(&fp.get_int(fipReg));
+        firstConnection.push_back(inserted ? 0 : firstNewConnection);
+    }
+
+    const auto numSets = static_cast<int>(regionSets.size());
+    auto failure = std::vector<std::exception_ptr>(numSets);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < numSets; ++i) {
+        try {
+            this->buildRegionSet(*regions[i], firstConnection[i], *regionSets[i]);
+        }
+        catch (...) {
+            failure[i] = std::current_exception();
+        }
+    }
 
-            ++regID;
+    for (const auto& e : failure) {
+        if (e) {
+            std::rethrow_exception(e);
         }
     }
 }
 
-
-const std::vector<std::pair<std::string, std::size_t>>&
+Opm::out::RegionCache::ConnectionRange
 Opm::out::RegionCache::connections(const std::string& region_name,
                                    const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->connection_map.find(key);
+    auto pos = this->regionSets_.find(region_name);
+    if ((pos == this->regionSets_.end()) || (region_id < 0) ||
+        (static_cast<std::size_t>(region_id) >= pos->second.connections.numVertices()))
+    {
+        return {};
+    }
 
-    return (iter == this->connection_map.end())
-        ? this->connections_empty
-        : iter->second;
+    const auto& graph = pos->second.connections;
+    const auto& ia = graph.startPointers();
+    const auto* ja = graph.columnIndices().data();
+
+    return { this, ja + ia[region_id], ja + ia[region_id + 1] };
 }
 
 std::vector<std::string>
 Opm::out::RegionCache::wells(const std::string& region_name,
                              const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->well_map.find(key);
+    auto wells = std::vector<std::string>{};
+
+    auto pos = this->regionSets_.find(region_name);
+    if ((pos == this->regionSets_.end()) || (region_id < 0) ||
+        (static_cast<std::size_t>(region_id) >= pos->second.wells.numVertices()))
+    {
+        return wells;
+    }
+
+    const auto& graph = pos->second.wells;
+    const auto& ia = graph.startPointers();
+    const auto& ja = graph.columnIndices();
+
+    for (auto i = ia[region_id]; i < ia[region_id + 1]; ++i) {
+        wells.push_back(this->wellNames_[ja[i]]);
+    }
+
+    return wells;
+}
+
+Opm::out::RegionCache::ConnectionRange::value_type
+Opm::out::RegionCache::connection(const int handle) const
+{
+    const auto& conn = this->connections_[handle];
+
+    return { this->wellNames_[conn.well], conn.cell };
+}
+
+void Opm::out::RegionCache::buildRegionSet(const std::vector<int>& regions,
+                                           const std::size_t       firstConnection,
+                                           RegionSet&              regionSet) const
+{
+    auto maxRegion = -1;
+
+    for (auto c = firstConnection; c < this->connections_.size(); ++c) {
+        const auto& conn = this->connections_[c];
+        const auto region = regions[conn.active];
+
+        if (region < 0) {
+            // Not representable in the CSR structure, and not a valid
+            // region ID in any case.
+            continue;
+        }
+
+        maxRegion = std::max(maxRegion, region);
+
+        regionSet.connections.addConnection(region, static_cast<int>(c));
+
+        // A well is assigned to the region of its first connection.
+        if ((c == firstConnection) || (this->connections_[c - 1].well != conn.well)) {
+            regionSet.wells.addConnection(region, conn.well);
+        }
+    }
 
-    return (iter == this->well_map.end())
-        ? std::vector<std::string> {}
-        : iter->second;
+    // Columns are sorted on compression.  Connection and well indices
+    // follow the well order, and so therefore do the compressed rows.
+    const auto numVertices = std::max({
+        regionSet.connections.numVertices(),
+        regionSet.wells.numVertices(),
+        static_cast<Graph::Offset>(maxRegion + 1),
+        Graph::Offset{1}
+    });
+
+    regionSet.connections.compress(numVertices);
+    regionSet.wells.compress(numVertices);
 }
@@ -20,10 +20,15 @@
 #ifndef OPM_REGION_CACHE_HPP
 #define OPM_REGION_CACHE_HPP
 
+#include <opm/common/utility/CSRGraphFromCoordinates.hpp>
+
 #include <cstddef>
+#include <iterator>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -34,31 +39,113 @@ namespace Opm {
 
 namespace Opm { namespace out {
     class RegionCache {
+    private:
+        // Active well connection.  Well is an index into wellNames_.
+        struct Connection
+        {
+            int well{};
+            std::size_t cell{};
+            std::size_t active{};
+        };
+
     public:
+        /// Well connections of a single region.  Elements are pairs of
+        /// well name and global cell index, in well order.
+        class ConnectionRange
+        {
+        public:
+            using value_type = std::pair<const std::string&, std::size_t>;
+
+            class const_iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = ConnectionRange::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = value_type;
+
+                const_iterator(const RegionCache* cache, const int* pos)
+                    : cache_ { cache }, pos_ { pos }
+                {}
+
+                value_type operator*() const { return this->cache_->connection(*this->pos_); }
+
+                const_iterator& operator++() { ++this->pos_; return *this; }
+                const_iterator operator++(int) { auto i = *this; ++this->pos_; return i; }
+
+                bool operator==(const const_iterator& that) const { return this->pos_ == that.pos_; }
+                bool operator!=(const const_iterator& that) const { return ! (*this == that); }
+
+            private:
+                const RegionCache* cache_{nullptr};
+                const int* pos_{nullptr};
+            };
+
+            ConnectionRange() = default;
+            ConnectionRange(const RegionCache* cache, const int* begin, const int* end)
+                : cache_ { cache }, begin_ { begin }, end_ { end }
+            {}
+
+            const_iterator begin() const { return { this->cache_, this->begin_ }; }
+            const_iterator end() const { return { this->cache_, this->end_ }; }
+
+            std::size_t size() const { return this->end_ - this->begin_; }
+            bool empty() const { return this->begin_ == this->end_; }
+
+            value_type operator[](const std::size_t i) const
+            {
+                return this->cache_->connection(this->begin_[i]);
+            }
+
+            value_type front() const { return (*this)[0]; }
+
+        private:
+            const RegionCache* cache_{nullptr};
+            const int* begin_{nullptr};
+            const int* end_{nullptr};
+        };
+
         RegionCache() = default;
         RegionCache(const std::set<std::string>& fip_regions,
                     const FieldPropsManager&     fp,
                     const EclipseGrid&           grid,
                     const Schedule&              schedule);
 
+        // May be called repeatedly, e.g., when wells are introduced at
+        // later report steps.  Wells which are already in the cache are
+        // not revisited, while new region sets are built for all wells.
         void buildCache(const std::set<std::string>& fip_regions,
                         const FieldPropsManager&     fp,
                         const EclipseGrid&           grid,
                         const Schedule&              schedule);
 
-        const std::vector<std::pair<std::string, std::size_t>>&
-        connections(const std::string& region_name, int region_id) const;
+        ConnectionRange connections(const std::string& region_name, int region_id) const;
 
         // A well is assigned to the region_id of its first connection.
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
     private:
-        using RegID = std::pair<std::string, int>;            // { Region set, region ID }
-        using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
+        // Rows are region IDs.  Columns are indices into connections_ and
+        // wellNames_ respectively.
+        using Graph = utility::CSRGraphFromCoordinates<int, false, true>;
+
+        struct RegionSet
+        {
+            Graph connections{};
+            Graph wells{};
+        };
+
+        std::vector<std::string> wellNames_{};
+        std::unordered_map<std::string, int> wellIndex_{};
+        std::vector<Connection> connections_{};
+        std::map<std::string, RegionSet> regionSets_{};
+
+        ConnectionRange::value_type connection(int handle) const;
 
-        std::vector<WellConn> connections_empty{};
-        std::map<RegID, std::vector<WellConn>> connection_map{};
-        std::map<RegID, std::vector<std::string>> well_map{};
+        void buildRegionSet(const std::vector<int>& regions,
+                            std::size_t             firstConnection,
+                            RegionSet&              regionSet) const;
     };
 }} // namespace Opm::out
 
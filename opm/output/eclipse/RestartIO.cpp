@@ -64,7 +64,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <exception>
+#include <functional>
 #include <iterator>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -185,41 +188,36 @@ namespace {
         return ih;
     }
 
-    void writeGroup(int                           sim_step,
-                    const UnitSystem&             units,
-                    const Schedule&               schedule,
-                    const Opm::SummaryState&      sumState,
-                    const std::vector<int>&       ih,
-                    EclIO::OutputStream::Restart& rstFile)
+    // Restart arrays which are independent of each other until they are
+    // written.  These are created concurrently, by captureSections(), and
+    // then written in file order.  The largest arrays live in a
+    // RestartBuffers object, to reuse their storage across calls to
+    // save(), and are referenced from here when active at this step.
+    struct RestartSections
+    {
+        Helpers::AggregateGroupData* group{nullptr};
+        std::optional<Helpers::AggregateNetworkData> network{};
+        Helpers::AggregateMSWData* msw{nullptr};
+        Helpers::AggregateWellData* well{nullptr};
+        std::optional<Helpers::AggregateWListData> wlist{};
+        Helpers::AggregateConnectionData* connection{nullptr};
+        std::optional<Helpers::AggregateActionxData> actionx{};
+        std::optional<Helpers::AggregateUDQData> udq{};
+        bool aquifer{false};
+    };
+
+    void writeGroup(const Helpers::AggregateGroupData& groupData,
+                    EclIO::OutputStream::Restart&      rstFile)
     {
-        // write IGRP to restart file
-        const size_t simStep = static_cast<size_t> (sim_step);
-
-        auto  groupData = Helpers::AggregateGroupData(ih);
-
-        groupData.captureDeclaredGroupData(schedule, units, simStep, sumState, ih);
-
         rstFile.write("IGRP", groupData.getIGroup());
         rstFile.write("SGRP", groupData.getSGroup());
         rstFile.write("XGRP", groupData.getXGroup());
         rstFile.write("ZGRP", groupData.getZGroup());
     }
 
-    void writeNetwork(const Opm::EclipseState&      es,
-                      int                           sim_step,
-                      const UnitSystem&             units,
-                      const Schedule&               schedule,
-                      const Opm::SummaryState&      sumState,
-                      const std::vector<int>&       ih,
-                      EclIO::OutputStream::Restart& rstFile)
+    void writeNetwork(const Helpers::AggregateNetworkData& networkData,
+                      EclIO::OutputStream::Restart&        rstFile)
     {
-        // write network data to restart file
-        const size_t simStep = static_cast<size_t> (sim_step);
-
-        auto  networkData = Helpers::AggregateNetworkData(ih);
-
-        networkData.captureDeclaredNetworkData(es, schedule, units, simStep, sumState, ih);
-
         rstFile.write("INODE", networkData.getINode());
         rstFile.write("IBRAN", networkData.getIBran());
         rstFile.write("INOBR", networkData.getINobr());
@@ -228,49 +226,18 @@ namespace {
         rstFile.write("ZNODE", networkData.getZNode());
     }
 
-    void writeMSWData(int                           sim_step,
-                      const UnitSystem&             units,
-                      const Schedule&               schedule,
-                      const EclipseGrid&            grid,
-                      const Opm::SummaryState&      sumState,
-                      const Opm::data::Wells&       wells,
-                      const std::vector<int>&       ih,
-                      EclIO::OutputStream::Restart& rstFile)
+    void writeMSWData(const Helpers::AggregateMSWData& MSWData,
+                      EclIO::OutputStream::Restart&    rstFile)
     {
-        // write ISEG, RSEG, ILBS and ILBR to restart file
-        const auto simStep = static_cast<std::size_t> (sim_step);
-
-        auto  MSWData = Helpers::AggregateMSWData(ih);
-        MSWData.captureDeclaredMSWData(schedule, simStep, units,
-                                       ih, grid, sumState, wells);
-
         rstFile.write("ISEG", MSWData.getISeg());
         rstFile.write("ILBS", MSWData.getILBs());
         rstFile.write("ILBR", MSWData.getILBr());
         rstFile.write("RSEG", MSWData.getRSeg());
     }
 
-    void writeUDQ(const int                     report_step,
-                  const int                     sim_step,
-                  const Schedule&               schedule,
-                  const UDQState&               udq_state,
-                  const std::vector<int>&       ih,
-                  EclIO::OutputStream::Restart& rstFile)
+    void writeUDQ(const Helpers::AggregateUDQData& udqData,
+                  EclIO::OutputStream::Restart&    rstFile)
     {
-        const auto& udqConfig = schedule[sim_step].udq();
-
-        if ((report_step == 0) || (udqConfig.size() == 0)) {
-            // Initial condition or no UDQs in run.
-            return;
-        }
-
-        const auto simStep = static_cast<std::size_t>(sim_step);
-        const auto udqDims = UDQDims { udqConfig, ih };
-
-        // UDQs are active in run.  Write UDQ related data to restart file.
-        auto udqData = Helpers::AggregateUDQData(udqDims);
-        udqData.captureDeclaredUDQData(schedule, simStep, udq_state, ih);
-        
         rstFile.write("ZUDN", udqData.getZUDN());
         rstFile.write("ZUDL", udqData.getZUDL());
         rstFile.write("IUDQ", udqData.getIUDQ());
@@ -304,23 +271,9 @@ namespace {
         }
     }
 
-    void writeActionx(const int                     report_step,
-                      const int                     sim_step,
-                      const Schedule&               schedule,
-                      const Action::State&          action_state,
-                      const SummaryState&           sum_state,
-                      EclIO::OutputStream::Restart& rstFile)
+    void writeActionx(const Helpers::AggregateActionxData& actionxData,
+                      EclIO::OutputStream::Restart&        rstFile)
     {
-        if ((report_step == 0) || (schedule[sim_step].actions().ecl_size() == 0)) {
-            return;
-        }
-
-        const auto simStep = static_cast<std::size_t>(sim_step);
-
-        const auto actionxData = RestartIO::Helpers::AggregateActionxData {
-            schedule, action_state, sum_state, simStep
-        };
-
         rstFile.write("IACT", actionxData.getIACT());
         rstFile.write("SACT", actionxData.getSACT());
         rstFile.write("ZACT", actionxData.getZACT());
@@ -330,35 +283,22 @@ namespace {
         rstFile.write("SACN", actionxData.getSACN());
     }
 
-    void writeWell(int                           sim_step,
-                   const EclipseGrid&            grid,
-                   const Schedule&               schedule,
-                   const TracerConfig&           tracers,
-                   const data::Wells&            wells,
-                   const Opm::Action::State&     action_state,
-                   const Opm::WellTestState&     wtest_state,
-                   const Opm::SummaryState&      sumState,
-                   const std::vector<int>&       ih,
+    void writeWell(const RestartSections&        sections,
                    EclIO::OutputStream::Restart& rstFile)
     {
-        auto wellData = Helpers::AggregateWellData(ih);
-        wellData.captureDeclaredWellData(schedule, tracers, sim_step, action_state, wtest_state, sumState, ih);
-        wellData.captureDynamicWellData(schedule, tracers, sim_step, wells, sumState);
+        const auto& wellData = *sections.well;
 
         rstFile.write("IWEL", wellData.getIWell());
         rstFile.write("SWEL", wellData.getSWell());
         rstFile.write("XWEL", wellData.getXWell());
         rstFile.write("ZWEL", wellData.getZWell());
 
-        auto wListData = Helpers::AggregateWListData(ih);
-        wListData.captureDeclaredWListData(schedule, sim_step, ih);
+        const auto& wListData = *sections.wlist;
 
         rstFile.write("ZWLS", wListData.getZWls());
         rstFile.write("IWLS", wListData.getIWls());
 
-        auto connectionData = Helpers::AggregateConnectionData(ih);
-        connectionData.captureDeclaredConnData(schedule, grid, schedule.getUnits(),
-                                               wells, sumState, sim_step);
+        const auto& connectionData = *sections.connection;
 
         rstFile.write("ICON", connectionData.getIConn());
         rstFile.write("SCON", connectionData.getSConn());
@@ -395,23 +335,13 @@ namespace {
         rstFile.write("RAQN", aquiferData.getNumericAquiferDoublePrecData());
     }
 
-    void updateAndWriteAquiferData(const EclipseState&            es,
-                                   const ScheduleState&           sched,
-                                   const data::Aquifers&          aquData,
-                                   const SummaryState&            summaryState,
-                                   const UnitSystem&              usys,
-                                   Helpers::AggregateAquiferData& aquiferData,
-                                   EclIO::OutputStream::Restart&  rstFile)
+    void writeAquiferData(const EclipseState&                  es,
+                          const ScheduleState&                 sched,
+                          const Helpers::AggregateAquiferData& aquiferData,
+                          EclIO::OutputStream::Restart&        rstFile)
     {
         const auto& aqConfig = es.aquifer();
 
-        aquiferData.captureDynamicAquiferData(inferAquiferDimensions(es, sched),
-                                              aqConfig,
-                                              sched,
-                                              aquData,
-                                              summaryState,
-                                              usys);
-
         if (aqConfig.hasAnalyticalAquifer() || sched.hasAnalyticalAquifers()) {
             writeAnalyticAquiferData(aquiferData, rstFile);
         }
@@ -421,58 +351,188 @@ namespace {
         }
     }
 
-    void writeDynamicData(const int                                     sim_step,
-                          const EclipseGrid&                            grid,
-                          const EclipseState&                           es,
-                          const Schedule&                               schedule,
-                          const data::Wells&                            wellSol,
-                          const Opm::Action::State&                     action_state,
-                          const Opm::WellTestState&                     wtest_state,
-                          const Opm::SummaryState&                      sumState,
-                          const std::vector<int>&                       inteHD,
-                          const data::Aquifers&                         aquDynData,
-                          std::optional<Helpers::AggregateAquiferData>& aquiferData,
-                          EclIO::OutputStream::Restart&                 rstFile)
+    // Prepare a reusable aggregate for the restart arrays of the current
+    // step, dimensioned by INTEHEAD.
+    template <class Aggregate>
+    Aggregate* resetBuffer(std::optional<Aggregate>& buffer,
+                           const std::vector<int>&   ih)
     {
-        writeGroup(sim_step, schedule.getUnits(), schedule, sumState, inteHD, rstFile);
-
-        // Write network data if the network option is used and network defined
-        const auto& network = schedule[sim_step].network();
-        if (network.active())
-        {
-            writeNetwork(es, sim_step, schedule.getUnits(), schedule, sumState, inteHD, rstFile);
+        if (buffer.has_value()) {
+            buffer->reset(ih);
+        }
+        else {
+            buffer.emplace(ih);
         }
 
-        // Write well and MSW data only when applicable (i.e., when present)
-        if (const auto& wells = schedule.wellNames(sim_step);
-            ! wells.empty())
-        {
-            const auto haveMSW =
-                std::any_of(std::begin(wells), std::end(wells),
-                    [&schedule, sim_step](const std::string& well)
+        return &*buffer;
+    }
+
+    // Create the aggregate arrays of all restart sections which apply at
+    // this step.  Each aggregate is an independent task, and the tasks
+    // are run concurrently.
+    RestartSections
+    captureSections(const int                                     report_step,
+                    const int                                     sim_step,
+                    const EclipseGrid&                            grid,
+                    const EclipseState&                           es,
+                    const Schedule&                               schedule,
+                    const data::Wells&                            wellSol,
+                    const Opm::Action::State&                     action_state,
+                    const Opm::WellTestState&                     wtest_state,
+                    const Opm::SummaryState&                      sumState,
+                    const UDQState&                               udq_state,
+                    const std::vector<int>&                       ih,
+                    const data::Aquifers&                         aquDynData,
+                    std::optional<Helpers::AggregateAquiferData>& aquiferData,
+                    RestartBuffers&                               buffers)
+    {
+        const auto& units = schedule.getUnits();
+        const auto simStep = static_cast<std::size_t>(sim_step);
+
+        auto sections = RestartSections{};
+        auto tasks = std::vector<std::function<void()>>{};
+
+        if (report_step > 0) {
+            tasks.emplace_back([&]()
+            {
+                sections.group = resetBuffer(buffers.group, ih);
+                sections.group->captureDeclaredGroupData(schedule, units, simStep, sumState, ih);
+            });
+
+            // Network data if the network option is used and network defined
+            if (schedule[sim_step].network().active()) {
+                tasks.emplace_back([&]()
                 {
-                    return schedule.getWell(well, sim_step).isMultiSegment();
+                    sections.network.emplace(ih);
+                    sections.network->captureDeclaredNetworkData(es, schedule, units, simStep, sumState, ih);
                 });
+            }
+
+            // Well and MSW data only when applicable (i.e., when present)
+            if (const auto& wells = schedule.wellNames(sim_step);
+                ! wells.empty())
+            {
+                const auto haveMSW =
+                    std::any_of(std::begin(wells), std::end(wells),
+                        [&schedule, sim_step](const std::string& well)
+                    {
+                        return schedule.getWell(well, sim_step).isMultiSegment();
+                    });
+
+                if (haveMSW) {
+                    tasks.emplace_back([&]()
+                    {
+                        sections.msw = resetBuffer(buffers.msw, ih);
+                        sections.msw->captureDeclaredMSWData(schedule, simStep, units,
+                                                             ih, grid, sumState, wellSol);
+                    });
+                }
 
-            if (haveMSW) {
-                writeMSWData(sim_step, schedule.getUnits(), schedule, grid,
-                             sumState, wellSol, inteHD, rstFile);
+                tasks.emplace_back([&]()
+                {
+                    sections.well = resetBuffer(buffers.well, ih);
+                    sections.well->captureDeclaredWellData(schedule, es.tracer(), sim_step,
+                                                           action_state, wtest_state, sumState, ih);
+                    sections.well->captureDynamicWellData(schedule, es.tracer(), sim_step,
+                                                          wellSol, sumState);
+                });
+
+                tasks.emplace_back([&]()
+                {
+                    sections.wlist.emplace(ih);
+                    sections.wlist->captureDeclaredWListData(schedule, sim_step, ih);
+                });
+
+                tasks.emplace_back([&]()
+                {
+                    sections.connection = resetBuffer(buffers.connection, ih);
+                    sections.connection->captureDeclaredConnData(schedule, grid, units,
+                                                                 wellSol, sumState, sim_step);
+                });
             }
 
-            writeWell(sim_step, grid, schedule, es.tracer(), wellSol,
-                      action_state, wtest_state, sumState, inteHD, rstFile);
+            if (es.aquifer().active() && aquiferData.has_value()) {
+                sections.aquifer = true;
+
+                tasks.emplace_back([&]()
+                {
+                    aquiferData->captureDynamicAquiferData(inferAquiferDimensions(es, schedule[sim_step]),
+                                                           es.aquifer(),
+                                                           schedule[sim_step],
+                                                           aquDynData,
+                                                           sumState,
+                                                           units);
+                });
+            }
+
+            if (schedule[sim_step].actions().ecl_size() > 0) {
+                tasks.emplace_back([&]()
+                {
+                    sections.actionx.emplace(schedule, action_state, sumState, simStep);
+                });
+            }
+
+            // UDQs are active in run.
+            if (schedule[sim_step].udq().size() > 0) {
+                tasks.emplace_back([&]()
+                {
+                    const auto udqDims = UDQDims { schedule[sim_step].udq(), ih };
+
+                    sections.udq.emplace(udqDims);
+                    sections.udq->captureDeclaredUDQData(schedule, simStep, udq_state, ih);
+                });
+            }
         }
 
-        if (const auto& aqCfg = es.aquifer();
-            aqCfg.active() && aquiferData.has_value())
-        {
-            updateAndWriteAquiferData(es,
-                                      schedule[sim_step],
-                                      aquDynData,
-                                      sumState,
-                                      schedule.getUnits(),
-                                      aquiferData.value(),
-                                      rstFile);
+        // Lists of well and group names are built on first use.
+        sumState.wells();
+        sumState.groups();
+
+        const auto numTasks = static_cast<int>(tasks.size());
+        auto failure = std::vector<std::exception_ptr>(numTasks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+        for (int i = 0; i < numTasks; ++i) {
+            try {
+                tasks[i]();
+            }
+            catch (...) {
+                failure[i] = std::current_exception();
+            }
+        }
+
+        for (const auto& e : failure) {
+            if (e) {
+                std::rethrow_exception(e);
+            }
+        }
+
+        return sections;
+    }
+
+    void writeDynamicData(const int                                           sim_step,
+                          const EclipseState&                                 es,
+                          const Schedule&                                     schedule,
+                          const RestartSections&                              sections,
+                          const std::optional<Helpers::AggregateAquiferData>& aquiferData,
+                          EclIO::OutputStream::Restart&                       rstFile)
+    {
+        writeGroup(*sections.group, rstFile);
+
+        if (sections.network.has_value()) {
+            writeNetwork(*sections.network, rstFile);
+        }
+
+        if (sections.msw != nullptr) {
+            writeMSWData(*sections.msw, rstFile);
+        }
+
+        if (sections.well != nullptr) {
+            writeWell(sections, rstFile);
+        }
+
+        if (sections.aquifer) {
+            writeAquiferData(es, schedule[sim_step], aquiferData.value(), rstFile);
         }
     }
 
@@ -527,6 +587,54 @@ namespace {
         return vectors;
     }
 
+    /// Writes floating-point solution vectors in output units, as double
+    /// or single precision.  Vectors held in SI units are converted while
+    /// being copied into the output buffer rather than in place up front,
+    /// saving a pass over the data.
+    class SolutionVectorWriter
+    {
+    public:
+        SolutionVectorWriter(const UnitSystem&             units,
+                             const bool                    convert,
+                             const bool                    writeDouble,
+                             EclIO::OutputStream::Restart& rstFile)
+            : units_       { units }
+            , convert_     { convert }
+            , writeDouble_ { writeDouble }
+            , rstFile_     { rstFile }
+        {}
+
+        void operator()(const std::string&         key,
+                        const UnitSystem::measure  dim,
+                        const std::vector<double>& data)
+        {
+            const auto m = this->convert_ ? dim : UnitSystem::measure::identity;
+
+            if (! this->writeDouble_) {
+                this->units_.from_si(m, data, this->floatBuffer_);
+                this->rstFile_.write(key, this->floatBuffer_);
+            }
+            else if (m == UnitSystem::measure::identity) {
+                this->rstFile_.write(key, data);
+            }
+            else {
+                this->doubleBuffer_.resize(data.size());
+                this->units_.from_si(m, data.data(), this->doubleBuffer_.data(), data.size());
+                this->rstFile_.write(key, this->doubleBuffer_);
+            }
+        }
+
+    private:
+        const UnitSystem& units_;
+        bool convert_;
+        bool writeDouble_;
+        EclIO::OutputStream::Restart& rstFile_;
+
+        // Shared by all vectors.
+        std::vector<float> floatBuffer_{};
+        std::vector<double> doubleBuffer_{};
+    };
+
     template <class OutputVector, class OutputVectorInt>
     void writeSolutionVectors(const RestartValue&             value,
                               const std::vector<std::string>& vectors,
@@ -534,11 +642,12 @@ namespace {
                               OutputVectorInt                 writeVectorI)
     {
         for (const auto& vector : vectors) {
-            value.solution.at(vector).visit(VisitorOverloadSet{
+            const auto& cellData = value.solution.at(vector);
+            cellData.visit(VisitorOverloadSet{
                 MonoThrowHandler<std::logic_error>(fmt::format("{} does not have an associate value", vector)),
-                [&vector,&writeVectorF](const std::vector<double>& v)
+                [&vector,&writeVectorF,&cellData](const std::vector<double>& v)
                 {
-                    writeVectorF(vector, v);
+                    writeVectorF(vector, cellData.dim, v);
                 },
                 [&vector,&writeVectorI](const std::vector<int>& v)
                 {
@@ -560,7 +669,7 @@ namespace {
 
     void writeFluidInPlace(const RestartValue&           value,
                            const EclipseState&           es,
-                           const bool                    writeDouble,
+                           SolutionVectorWriter&         writeVector,
                            EclIO::OutputStream::Restart& rstFile)
     {
         const auto vectors = fluidInPlaceVectorNames(value);
@@ -575,23 +684,10 @@ namespace {
             rstFile.write("FIPFAMNA", regSets);
         }
 
-        auto writeVector =
-            [writeDouble, &rstFile](const std::string&         arrayName,
-                                    const std::vector<double>& fipArray)
-        {
-            if (writeDouble) {
-                rstFile.write(arrayName, fipArray);
-            }
-            else {
-                rstFile.write(arrayName, std::vector<float> {
-                    fipArray.begin(), fipArray.end()
-                });
-            }
-        };
-
         auto anyRSFip = false;
         for (const auto& vector : vectors) {
-            writeVector(vector, value.solution.at(vector).data<double>());
+            const auto& fip = value.solution.at(vector);
+            writeVector(vector, fip.dim, fip.data<double>());
 
             if ((vector.front() == 'R') || (vector.front() == 'S')) {
                 // The vector name is RFIP* or SFIP*.  These refer to
@@ -612,7 +708,8 @@ namespace {
         // represent surface condition volumes.  Output the same vectors
         // using the corresponding SFIP name as well.
         for (const auto& vector : vectors) {
-            writeVector('S' + vector, value.solution.at(vector).data<double>());
+            const auto& fip = value.solution.at(vector);
+            writeVector('S' + vector, fip.dim, fip.data<double>());
         }
     }
 
@@ -643,9 +740,17 @@ namespace {
     void writeTracerVectors(const UnitSystem&             unit_system,
                             const TracerConfig&           tracer_config,
                             const RestartValue&           value,
-                            const bool                    write_double,
+                            SolutionVectorWriter&         writeVector,
                             EclIO::OutputStream::Restart& rstFile)
     {
+        // Unit strings of all tracers, by dense tracer index, formatted once.
+        const auto& volume = unit_system.name(UnitSystem::measure::volume);
+        std::vector<std::string> units;
+        units.reserve(tracer_config.size());
+        for (const auto& tracer : tracer_config)
+            units.push_back(fmt::format("{}/{}", tracer.unit_string, volume));
+
+        std::vector<std::string> ztracer(2);
         for (const auto& [tracer_rst_name, vector] : value.solution) {
             if (vector.target != data::TargetType::RESTART_TRACER_SOLUTION)
                 continue;
@@ -656,46 +761,28 @@ namespace {
               look up in the tracer configuration.
             */
             const auto& tracer_input_name = tracer_rst_name.substr(0, tracer_rst_name.size() - 1);
-            const auto& tracer = tracer_config[tracer_input_name];
-            std::vector<std::string> ztracer;
-            ztracer.push_back(tracer_rst_name);
-            ztracer.push_back(fmt::format("{}/{}", tracer.unit_string, unit_system.name( UnitSystem::measure::volume )));
+            const auto tracer_index = tracer_config.index(tracer_input_name);
+            if (! tracer_index.has_value())
+                throw std::logic_error(fmt::format("No such tracer: {}", tracer_input_name));
+
+            ztracer[0] = tracer_rst_name;
+            ztracer[1] = units[*tracer_index];
             rstFile.write("ZTRACER", ztracer);
 
-            const auto& data = vector.data<double>();
-            if (write_double) {
-                rstFile.write(tracer_rst_name, data);
-            }
-            else {
-                rstFile.write(tracer_rst_name, std::vector<float> {
-                        data.begin(), data.end()
-                    });
-            }
+            writeVector(tracer_rst_name, vector.dim, vector.data<double>());
         }
     }
 
     void writeSolution(const RestartValue&           value,
                        const EclipseState&           es,
                        const Schedule&               schedule,
-                       const UDQState&               udq_state,
-                       int                           report_step,
-                       int                           sim_step,
+                       const RestartSections&        sections,
                        const bool                    ecl_compatible_rst,
                        const bool                    write_double_arg,
-                       const std::vector<int>&       inteHD,
                        EclIO::OutputStream::Restart& rstFile)
     {
-        auto writeDorF = [&rstFile, write_double = write_double_arg]
-            (const std::string& key, const std::vector<double>& data)
-        {
-            if (write_double) {
-                rstFile.write(key, data);
-            }
-            else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
-            }
+        auto writeDorF = SolutionVectorWriter {
+            es.getUnits(), value.solution.isSI(), write_double_arg, rstFile
         };
 
         auto writeInt = [&rstFile](const std::string& key,
@@ -712,16 +799,18 @@ namespace {
 
         rstFile.message("STARTSOL");
 
-        writeRegularSolutionVectors(value, writeDorF, writeInt);
-        writeFluidInPlace(value, es, write_double_arg, rstFile);
+        writeRegularSolutionVectors(value, std::ref(writeDorF), writeInt);
+        writeFluidInPlace(value, es, writeDorF, rstFile);
         writeTracerVectors(schedule.getUnits(), es.tracer(), value,
-                           write_double_arg, rstFile);
-        writeUDQ(report_step, sim_step, schedule, udq_state, inteHD, rstFile);
+                           writeDorF, rstFile);
+        if (sections.udq.has_value()) {
+            writeUDQ(*sections.udq, rstFile);
+        }
 
         writeExtraVectors(value, writeDouble);
 
         if (! ecl_compatible_rst) {
-            writeExtendedSolutionVectors(value, writeDorF, writeInt);
+            writeExtendedSolutionVectors(value, std::ref(writeDorF), writeInt);
         }
 
         rstFile.message("ENDSOL");
@@ -782,6 +871,28 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
           const UDQState&                               udqState,
           std::optional<Helpers::AggregateAquiferData>& aquiferData,
           bool                                          write_double)
+{
+    auto buffers = RestartBuffers{};
+
+    save(rstFile, report_step, seconds_elapsed, std::move(value),
+         es, grid, schedule, action_state, wtest_state, sumState,
+         udqState, aquiferData, buffers, write_double);
+}
+
+void save(EclIO::OutputStream::Restart&                 rstFile,
+          int                                           report_step,
+          double                                        seconds_elapsed,
+          RestartValue                                  value,
+          const EclipseState&                           es,
+          const EclipseGrid&                            grid,
+          const Schedule&                               schedule,
+          const Action::State&                          action_state,
+          const WellTestState&                          wtest_state,
+          const SummaryState&                           sumState,
+          const UDQState&                               udqState,
+          std::optional<Helpers::AggregateAquiferData>& aquiferData,
+          RestartBuffers&                               buffers,
+          bool                                          write_double)
 {
     ::Opm::RestartIO::checkSaveArguments(es, value, grid);
 
@@ -795,23 +906,31 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
         write_double = false;
     }
 
-    // Convert solution fields and extra values from SI to user units.
-    value.convertFromSI(units);
+    // Convert extra values from SI to user units.  The solution fields
+    // are converted by writeSolution() as they are written.
+    for (auto& [key, data] : value.extra) {
+        units.from_si(key.dim, data);
+    }
 
     const auto inteHD =
         writeHeader(report_step, sim_step, nextStepSize(value),
                     seconds_elapsed, schedule, grid, es, rstFile);
 
+    const auto sections =
+        captureSections(report_step, sim_step, grid, es, schedule, value.wells,
+                        action_state, wtest_state, sumState, udqState, inteHD,
+                        value.aquifer, aquiferData, buffers);
+
     if (report_step > 0) {
-        writeDynamicData(sim_step, grid, es, schedule, value.wells,
-                         action_state, wtest_state, sumState, inteHD,
-                         value.aquifer, aquiferData, rstFile);
+        writeDynamicData(sim_step, es, schedule, sections, aquiferData, rstFile);
     }
 
-    writeActionx(report_step, sim_step, schedule, action_state, sumState, rstFile);
+    if (sections.actionx.has_value()) {
+        writeActionx(*sections.actionx, rstFile);
+    }
 
-    writeSolution(value, es, schedule, udqState, report_step, sim_step,
-                  ecl_compatible_rst, write_double, inteHD, rstFile);
+    writeSolution(value, es, schedule, sections,
+                  ecl_compatible_rst, write_double, rstFile);
 
     if (! ecl_compatible_rst) {
         writeExtraData(value.extra, rstFile);
@@ -25,8 +25,13 @@
 #define RESTART_IO_HPP
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
+#include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/AggregateGroupData.hpp>
+#include <opm/output/eclipse/AggregateMSWData.hpp>
+#include <opm/output/eclipse/AggregateWellData.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -77,6 +82,33 @@ namespace Opm { namespace Action {
 */
 namespace Opm { namespace RestartIO {
 
+    /// Aggregate restart arrays whose storage is reused between calls to
+    /// save().  Each array is resized and refilled in place at every
+    /// restart output step.  Unused arrays are created on first use.
+    struct RestartBuffers
+    {
+        std::optional<Helpers::AggregateGroupData> group{};
+        std::optional<Helpers::AggregateMSWData> msw{};
+        std::optional<Helpers::AggregateWellData> well{};
+        std::optional<Helpers::AggregateConnectionData> connection{};
+    };
+
+    void save(EclIO::OutputStream::Restart&                 rstFile,
+              int                                           report_step,
+              double                                        seconds_elapsed,
+              RestartValue                                  value,
+              const EclipseState&                           es,
+              const EclipseGrid&                            grid,
+              const Schedule&                               schedule,
+              const Action::State&                          action_state,
+              const WellTestState&                          wtest_state,
+              const SummaryState&                           sumState,
+              const UDQState&                               udqState,
+              std::optional<Helpers::AggregateAquiferData>& aquiferData,
+              bool                                          write_double = false);
+
+    /// Same as above, but reuses the aggregate restart arrays in
+    /// \p buffers from previous calls.
     void save(EclIO::OutputStream::Restart&                 rstFile,
               int                                           report_step,
               double                                        seconds_elapsed,
@@ -89,6 +121,7 @@ namespace Opm { namespace RestartIO {
               const SummaryState&                           sumState,
               const UDQState&                               udqState,
               std::optional<Helpers::AggregateAquiferData>& aquiferData,
+              RestartBuffers&                               buffers,
               bool                                          write_double = false);
 
 
@@ -102,6 +135,65 @@ namespace Opm { namespace RestartIO {
                       const Schedule&                schedule,
                       const std::vector<RestartKey>& extra_keys = {});
 
+    /// Parts of the dynamic state reconstructed by load(), in addition to
+    /// the requested solution and extra vectors.  Restart arrays which
+    /// are only needed by parts that are not requested are not read.
+    struct LoadRequest
+    {
+        /// Well, connection and segment results.
+        bool wells{true};
+
+        /// Group and network results.
+        bool groups{true};
+
+        /// Analytic and numerical aquifer results.
+        bool aquifers{true};
+
+        /// UDQ values, restored into the summary state.
+        bool udq{true};
+
+        /// Well and group cumulative totals, restored into the summary
+        /// state.
+        bool cumulatives{true};
+    };
+
+    /// Same as above, but only reconstructs the parts named in \p request.
+    /// Skipped parts are empty in the return value, or not restored into
+    /// \p summary_state.
+    RestartValue load(const std::string&             filename,
+                      int                            report_step,
+                      Action::State&                 action_state,
+                      SummaryState&                  summary_state,
+                      const std::vector<RestartKey>& solution_keys,
+                      const EclipseState&            es,
+                      const EclipseGrid&             grid,
+                      const Schedule&                schedule,
+                      const std::vector<RestartKey>& extra_keys,
+                      const LoadRequest&             request);
+
+    /// Contiguous range [begin, end) of active cells, in the global
+    /// ordering of active cells.
+    struct CellRange
+    {
+        std::size_t begin{0};
+        std::size_t end{0};
+    };
+
+    /// Load solution vectors for a subset of the model's cells, e.g., the
+    /// cells owned by one process of a distributed run.
+    ///
+    /// The values of all ranges in \p partition are concatenated in
+    /// order.  Only those parts of the solution vectors are read from
+    /// binary restart files, so no process needs to hold the global
+    /// arrays.  Use load() with a LoadRequest for the well, group and
+    /// aquifer states.
+    data::Solution loadSolution(const std::string&             filename,
+                                int                            report_step,
+                                const std::vector<RestartKey>& solution_keys,
+                                const EclipseState&            es,
+                                const EclipseGrid&             grid,
+                                const std::vector<CellRange>&  partition);
+
 }} // namespace Opm::RestartIO
 
 #endif  // RESTART_IO_HPP
@@ -62,6 +62,7 @@
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/output/data/Groups.hpp>
 #include <opm/output/data/GuideRateValue.hpp>
+#include <opm/output/data/WellTracerRates.hpp>
 #include <opm/output/data/Wells.hpp>
 #include <opm/output/eclipse/Inplace.hpp>
 #include <opm/output/eclipse/RegionCache.hpp>
@@ -82,10 +83,12 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -415,10 +418,6 @@ namespace {
         return entities;
     }
 
-Opm::TimeStampUTC make_sim_time(const Opm::Schedule& sched, const Opm::SummaryState& st, double sim_step) {
-    auto elapsed = st.get_elapsed() + sim_step;
-    return Opm::TimeStampUTC( sched.getStartTime() )  + std::chrono::duration<double>(elapsed);
-}
 
 
 
@@ -2104,6 +2103,84 @@ auto sub( F f, G g ) -> bin_op< F, G, std::minus< quantity > >
 { return { f, g }; }
 
 using ofun = std::function<quantity(const fn_args&)>;
+
+// Functions which read summary vectors computed by other functions in the
+// same evaluation, and must therefore run after them.
+static const auto summary_vector_readers = std::unordered_set<std::string> {
+    "ROEW",
+};
+
+// Single phase well level rates and cumulatives.  Same values as the
+// corresponding rate<>() based functions, but evaluated for all wells in
+// one pass, see Evaluator::WellPhaseRates.
+struct WellPhaseRateKind
+{
+    rt      phase;
+    bool    injection;
+    bool    cumulative;
+    measure unit;
+};
+
+static const auto well_phase_rates = std::unordered_map<std::string, WellPhaseRateKind> {
+    { "WOPR", { rt::oil, producer, false, rate_unit< rt::oil >() } },
+    { "WWPR", { rt::wat, producer, false, rate_unit< rt::wat >() } },
+    { "WGPR", { rt::gas, producer, false, rate_unit< rt::gas >() } },
+    { "WOIR", { rt::oil, injector, false, rate_unit< rt::oil >() } },
+    { "WWIR", { rt::wat, injector, false, rate_unit< rt::wat >() } },
+    { "WGIR", { rt::gas, injector, false, rate_unit< rt::gas >() } },
+    { "WOPT", { rt::oil, producer, true , rate_unit< rt::oil >() } },
+    { "WWPT", { rt::wat, producer, true , rate_unit< rt::wat >() } },
+    { "WGPT", { rt::gas, producer, true , rate_unit< rt::gas >() } },
+    { "WOIT", { rt::oil, injector, true , rate_unit< rt::oil >() } },
+    { "WWIT", { rt::wat, injector, true , rate_unit< rt::wat >() } },
+    { "WGIT", { rt::gas, injector, true , rate_unit< rt::gas >() } },
+};
+
+// Well level tracer rates, cumulatives and concentrations, keyed by the
+// phase specific tags of the tracer functions, e.g., "WTPRF#W".  Same
+// values as the corresponding ratetracer<>() based functions, but
+// evaluated for all tracers and wells in one pass, see
+// Evaluator::WellTracerRates.
+struct WellTracerRateKind
+{
+    rt      phase;
+    bool    injection;
+    bool    cumulative;
+    bool    concentration;
+    measure unit;
+};
+
+static const auto well_tracer_rates = []()
+{
+    struct TracerPhase
+    {
+        char    tag;
+        rt      phase;
+        measure unit;
+    };
+
+    const auto phases = std::array {
+        TracerPhase { 'W', rt::wat, rate_unit< rt::wat >() },
+        TracerPhase { 'O', rt::oil, rate_unit< rt::oil >() },
+        TracerPhase { 'G', rt::gas, rate_unit< rt::gas >() },
+    };
+
+    auto kinds = std::unordered_map<std::string, WellTracerRateKind>{};
+    for (const std::string prefix : { "WTPR", "WTPT", "WTPC", "WTIR", "WTIT", "WTIC" }) {
+        for (const auto* variant : { "", "F", "S" }) {
+            for (const auto& phase : phases) {
+                kinds.emplace(fmt::format("{}{}#{}", prefix, variant, phase.tag),
+                              WellTracerRateKind {
+                                  phase.phase, prefix[2] == 'I',
+                                  prefix[3] == 'T', prefix[3] == 'C',
+                                  phase.unit
+                              });
+            }
+        }
+    }
+
+    return kinds;
+}();
 using UnitTable = std::unordered_map<std::string, Opm::UnitSystem::measure>;
 
 static const auto funs = std::unordered_map<std::string, ofun> {
@@ -3251,6 +3328,60 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
 }
 
 namespace Evaluator {
+    /// Wells of the grouped evaluators, resolved once per evaluation.
+    struct WellTable
+    {
+        /// Dynamic results of the wells.  Nullptr for wells which are
+        /// shut, not defined at the current report step, or without
+        /// results.
+        std::vector<const Opm::data::Well*> solution{};
+
+        /// Efficiency factors of the wells' cumulatives, i.e., the
+        /// product of the well's and its groups' efficiency factors.
+        std::vector<double> efficiency{};
+
+        void build(const std::vector<std::string>& wells,
+                   const Opm::Schedule&            sched,
+                   const int                       sim_step,
+                   const Opm::data::Wells&         wellSol);
+    };
+
+    void WellTable::build(const std::vector<std::string>& wells,
+                          const Opm::Schedule&            sched,
+                          const int                       sim_step,
+                          const Opm::data::Wells&         wellSol)
+    {
+        this->solution.assign(wells.size(), nullptr);
+        this->efficiency.assign(wells.size(), 1.0);
+
+        auto node = Opm::EclIO::SummaryNode {
+            "", Opm::EclIO::SummaryNode::Category::Well,
+            Opm::EclIO::SummaryNode::Type::Total
+        };
+
+        for (auto i = 0*wells.size(); i < wells.size(); ++i) {
+            const auto schedWells = find_single_well(sched, wells[i], sim_step);
+            if (schedWells.empty()) {
+                continue;
+            }
+
+            auto xwPos = wellSol.find(wells[i]);
+            if ((xwPos == wellSol.end()) ||
+                (xwPos->second.dynamicStatus == Opm::Well::Status::SHUT))
+            {
+                continue;
+            }
+
+            this->solution[i] = &xwPos->second;
+
+            node.wgname = wells[i];
+
+            auto eFac = EfficiencyFactor{};
+            eFac.setFactors(node, sched, schedWells, sim_step);
+            this->efficiency[i] = efac(eFac.factors, wells[i]);
+        }
+    }
+
     struct InputData
     {
         const Opm::EclipseState& es;
@@ -3271,6 +3402,8 @@ namespace Evaluator {
         const std::map<std::pair<std::string, int>, double>& block;
         const Opm::data::Aquifers& aquifers;
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
+        const WellTable& wellTable;
+        const Opm::data::WellTracerRates& wellTracerRates;
     };
 
     class Base
@@ -3283,25 +3416,86 @@ namespace Evaluator {
                             const InputData&        input,
                             const SimulatorResults& simRes,
                             Opm::SummaryState&      st) const = 0;
+
+        /// Summary vector of an evaluator whose value depends only on the
+        /// simulator results and on summary state values which no
+        /// evaluator writes.  Nullptr for evaluators which must run
+        /// through update() in evaluator order.
+        virtual const Opm::EclIO::SummaryNode* independentNode() const
+        {
+            return nullptr;
+        }
+
+        /// Value, in output units, of the vector of an independent
+        /// evaluator.  Nullopt if there is no value at this time.  Does not
+        /// modify any state and may therefore run concurrently with the
+        /// value() of other evaluators.
+        virtual std::optional<double>
+        value(const std::size_t       /* sim_step */,
+              const double            /* stepSize */,
+              const InputData&        /* input */,
+              const SimulatorResults& /* simRes */,
+              const Opm::SummaryState& /* st */) const
+        {
+            return std::nullopt;
+        }
     };
 
-    class FunctionRelation : public Base
+    class NodeValue : public Base
     {
     public:
-        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
+        void update(const std::size_t       sim_step,
+                    const double            stepSize,
+                    const InputData&        input,
+                    const SimulatorResults& simRes,
+                    Opm::SummaryState&      st) const override
+        {
+            const auto val = this->value(sim_step, stepSize, input, simRes, st);
+            if (val.has_value()) {
+                updateValue(this->node_, *val, st);
+            }
+        }
+
+        const Opm::EclIO::SummaryNode* independentNode() const override
+        {
+            return &this->node_;
+        }
+
+    protected:
+        explicit NodeValue(Opm::EclIO::SummaryNode node)
             : node_(std::move(node))
+        {}
+
+        Opm::EclIO::SummaryNode node_;
+    };
+
+    class FunctionRelation : public NodeValue
+    {
+    public:
+        explicit FunctionRelation(Opm::EclIO::SummaryNode node,
+                                  ofun                    fcn,
+                                  const bool              readsSummaryVectors)
+            : NodeValue(std::move(node))
             , fcn_ (std::move(fcn))
+            , readsSummaryVectors_(readsSummaryVectors)
         {
             if (this->use_number()) {
                 this->number_ = std::max(0, this->node_.number);
             }
         }
 
-        void update(const std::size_t       sim_step,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        const Opm::EclIO::SummaryNode* independentNode() const override
+        {
+            return this->readsSummaryVectors_
+                ? nullptr : &this->node_;
+        }
+
+        std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const override
         {
             const auto wells = need_wells(this->node_)
                 ? find_wells(input.sched, this->node_,
@@ -3326,13 +3520,13 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return usys.from_si(prm.unit, prm.value);
         }
 
     private:
-        Opm::EclIO::SummaryNode node_;
-        ofun                    fcn_;
-        int                     number_{0};
+        ofun fcn_;
+        int  number_{0};
+        bool readsSummaryVectors_{false};
 
         std::string group_name() const
         {
@@ -3361,32 +3555,311 @@ namespace Evaluator {
         }
     };
 
-    class BlockValue : public Base
+    /// Single phase rate or cumulative, e.g., WOPR or WWIT, of a single
+    /// well.  Normally evaluated through WellPhaseRates.
+    class WellPhaseRate : public NodeValue
     {
     public:
-        explicit BlockValue(Opm::EclIO::SummaryNode node,
-                            const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+        explicit WellPhaseRate(Opm::EclIO::SummaryNode node,
+                               const WellPhaseRateKind kind)
+            : NodeValue(std::move(node))
+            , kind_    (kind)
         {}
 
+        std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
+        {
+            const auto wells = find_single_well(input.sched, this->node_.wgname,
+                                                static_cast<int>(sim_step));
+
+            const Opm::data::Well* xw = nullptr;
+            auto eff_fac = 1.0;
+
+            if (! wells.empty()) {
+                auto xwPos = simRes.wellSol.find(this->node_.wgname);
+                if ((xwPos != simRes.wellSol.end()) &&
+                    (xwPos->second.dynamicStatus != Opm::Well::Status::SHUT))
+                {
+                    xw = &xwPos->second;
+
+                    EfficiencyFactor eFac{};
+                    eFac.setFactors(this->node_, input.sched, wells, sim_step);
+                    eff_fac = efac(eFac.factors, this->node_.wgname);
+                }
+            }
+
+            return this->convert(this->rate(xw, eff_fac), stepSize, input.es.getUnits());
+        }
+
+        const WellPhaseRateKind& kind() const
+        {
+            return this->kind_;
+        }
+
+        bool isTotal() const
+        {
+            return this->node_.type == Opm::EclIO::SummaryNode::Type::Total;
+        }
+
+        /// Same as rate<phase, injection>() for a single well.
+        double rate(const Opm::data::Well* xw, const double eff_fac) const
+        {
+            auto sum = 0.0;
+
+            if (xw != nullptr) {
+                const auto v = xw->rates.get(this->kind_.phase, 0.0) * eff_fac;
+
+                if ((v > 0.0) == this->kind_.injection) {
+                    sum += v;
+                }
+            }
+
+            if (! this->kind_.injection) {
+                sum *= -1.0;
+            }
+
+            return sum;
+        }
+
+        double convert(const double            rate,
+                       const double            stepSize,
+                       const Opm::UnitSystem&  usys) const
+        {
+            const auto q = quantity { rate, this->kind_.unit };
+
+            return this->kind_.cumulative
+                ? usys.from_si(mul_unit(q.unit, measure::time), q.value * stepSize)
+                : usys.from_si(q.unit, q.value);
+        }
+
+    private:
+        WellPhaseRateKind kind_;
+    };
+
+    /// All WellPhaseRate evaluators of one keyword.  Evaluates the
+    /// members in one pass over the evaluation's WellTable, rather than
+    /// looking up each well's results and efficiency factors separately.
+    class WellPhaseRates : public Base
+    {
+    public:
+        void add(const WellPhaseRate* member, const std::size_t well)
+        {
+            this->members_.push_back(member);
+            this->wells_.push_back(well);
+        }
+
         void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
+                    const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
                     Opm::SummaryState&      st) const override
+        {
+            const auto& usys = input.es.getUnits();
+            const auto& table = simRes.wellTable;
+
+            for (auto i = 0*this->members_.size(); i < this->members_.size(); ++i) {
+                const auto* member = this->members_[i];
+                const auto  well = this->wells_[i];
+
+                const auto eff_fac = member->isTotal()
+                    ? table.efficiency[well] : 1.0;
+
+                const auto rate = member->rate(table.solution[well], eff_fac);
+
+                updateValue(*member->independentNode(),
+                            member->convert(rate, stepSize, usys), st);
+            }
+        }
+
+    private:
+        std::vector<const WellPhaseRate*> members_{};
+        std::vector<std::size_t> wells_{};
+    };
+
+    /// Tracer rate, cumulative or concentration, e.g., WTPRT1 or WTICFT1,
+    /// of a single well.  Normally evaluated through WellTracerRates.
+    class WellTracerRate : public NodeValue
+    {
+    public:
+        explicit WellTracerRate(Opm::EclIO::SummaryNode  node,
+                                const WellTracerRateKind kind,
+                                std::string              tracer)
+            : NodeValue(std::move(node))
+            , kind_    (kind)
+            , tracer_  (std::move(tracer))
+        {}
+
+        std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
+        {
+            const auto wells = find_single_well(input.sched, this->node_.wgname,
+                                                static_cast<int>(sim_step));
+
+            const Opm::data::Well* xw = nullptr;
+            auto tracerRate = 0.0;
+            auto eff_fac = 1.0;
+
+            if (! wells.empty()) {
+                auto xwPos = simRes.wellSol.find(this->node_.wgname);
+                if ((xwPos != simRes.wellSol.end()) &&
+                    (xwPos->second.dynamicStatus != Opm::Well::Status::SHUT))
+                {
+                    xw = &xwPos->second;
+                    tracerRate = xw->rates.get(rt::tracer, 0.0, this->tracer_);
+
+                    EfficiencyFactor eFac{};
+                    eFac.setFactors(this->node_, input.sched, wells, sim_step);
+                    eff_fac = efac(eFac.factors, this->node_.wgname);
+                }
+            }
+
+            return this->evaluate(xw, tracerRate, eff_fac, stepSize, input.es.getUnits());
+        }
+
+        /// Tracer key of the well solution's tracer rates, e.g., "T1" or
+        /// "FT1".
+        const std::string& tracer() const
+        {
+            return this->tracer_;
+        }
+
+        bool isTotal() const
+        {
+            return this->node_.type == Opm::EclIO::SummaryNode::Type::Total;
+        }
+
+        /// Value, in output units, of the vector for a single well whose
+        /// rate of this vector's tracer is \p tracerRate.  Same as the
+        /// ratetracer<>() based function.
+        double evaluate(const Opm::data::Well*  xw,
+                        const double            tracerRate,
+                        const double            eff_fac,
+                        const double            stepSize,
+                        const Opm::UnitSystem&  usys) const
+        {
+            auto q = quantity {
+                this->directional((xw != nullptr) ? tracerRate * eff_fac : 0.0),
+                this->kind_.unit
+            };
+
+            if (this->kind_.concentration) {
+                const auto phaseRate = (xw != nullptr)
+                    ? xw->rates.get(this->kind_.phase, 0.0) * eff_fac
+                    : 0.0;
+
+                q = q / quantity { this->directional(phaseRate), this->kind_.unit };
+            }
+            else if (this->kind_.cumulative) {
+                q = q * quantity { stepSize, measure::time };
+            }
+
+            return usys.from_si(q.unit, q.value);
+        }
+
+    private:
+        WellTracerRateKind kind_;
+        std::string tracer_;
+
+        /// Injection rate or production rate, the latter reported as a
+        /// positive value, of a single well.
+        double directional(const double v) const
+        {
+            auto sum = 0.0;
+
+            if ((v > 0.0) == this->kind_.injection) {
+                sum += v;
+            }
+
+            if (! this->kind_.injection) {
+                sum *= -1.0;
+            }
+
+            return sum;
+        }
+    };
+
+    /// All WellTracerRate evaluators.  Evaluates the members, for all
+    /// tracers and wells, in one pass over the evaluation's WellTable and
+    /// tracer rate matrix, rather than looking up each well's results and
+    /// each tracer's rate by name.
+    class WellTracerRates : public Base
+    {
+    public:
+        void add(const WellTracerRate* member,
+                 const std::size_t     well,
+                 const std::size_t     tracer)
+        {
+            this->members_.push_back(member);
+            this->wells_.push_back(well);
+            this->tracers_.push_back(tracer);
+        }
+
+        void update(const std::size_t    /* sim_step */,
+                    const double            stepSize,
+                    const InputData&        input,
+                    const SimulatorResults& simRes,
+                    Opm::SummaryState&      st) const override
+        {
+            const auto& usys = input.es.getUnits();
+            const auto& table = simRes.wellTable;
+            const auto& rates = simRes.wellTracerRates;
+
+            for (auto i = 0*this->members_.size(); i < this->members_.size(); ++i) {
+                const auto* member = this->members_[i];
+                const auto  well = this->wells_[i];
+                const auto* xw = table.solution[well];
+
+                const auto eff_fac = member->isTotal()
+                    ? table.efficiency[well] : 1.0;
+
+                const auto tracerRate = (xw != nullptr)
+                    ? rates.rate(well, this->tracers_[i]) : 0.0;
+
+                updateValue(*member->independentNode(),
+                            member->evaluate(xw, tracerRate, eff_fac, stepSize, usys), st);
+            }
+        }
+
+    private:
+        std::vector<const WellTracerRate*> members_{};
+        std::vector<std::size_t> wells_{};
+        std::vector<std::size_t> tracers_{};
+    };
+
+    class BlockValue : public NodeValue
+    {
+    public:
+        explicit BlockValue(Opm::EclIO::SummaryNode node,
+                            const Opm::UnitSystem::measure m)
+            : NodeValue(std::move(node))
+            , m_       (m)
+        {}
+
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            return usys.from_si(this->m_, xPos->second);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
 
         Opm::out::Summary::BlockValues::key_type lookupKey() const
@@ -3395,75 +3868,75 @@ namespace Evaluator {
         }
     };
 
-    class AquiferValue: public Base
+    class AquiferValue : public NodeValue
     {
     public:
         explicit AquiferValue(Opm::EclIO::SummaryNode node,
                               const Opm::UnitSystem::measure m)
-        : node_(std::move(node))
-        , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            return usys.from_si(this->m_, xPos->second.get(this->node_.keyword));
         }
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
-    class RegionValue : public Base
+    class RegionValue : public NodeValue
     {
     public:
         explicit RegionValue(Opm::EclIO::SummaryNode node,
                              const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->node_.number < 0) {
-                return;
+                return std::nullopt;
             }
 
             auto xPos = simRes.region.find(this->node_.keyword);
             if (xPos == simRes.region.end()) {
                 // Vector (e.g., RPR) not available from simulator.
                 // Typically at time zero.
-                return;
+                return std::nullopt;
             }
 
             const auto ix = this->index();
             if (ix >= xPos->second.size()) {
                 // Region ID outside active set (e.g., the node specifies
                 // region ID 12 when max(FIPNUM) == 10)
-                return;
+                return std::nullopt;
             }
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
 
         std::vector<double>::size_type index() const
@@ -3472,12 +3945,12 @@ namespace Evaluator {
         }
     };
 
-    class InterRegionValue : public Base
+    class InterRegionValue : public NodeValue
     {
     public:
         explicit InterRegionValue(const Opm::EclIO::SummaryNode& node,
                                   const Opm::UnitSystem::measure m)
-            : node_   (node)
+            : NodeValue(node)
             , m_      (m)
             , regname_(node_.fip_region.has_value()
                        ? node_.fip_region.value()
@@ -3486,30 +3959,31 @@ namespace Evaluator {
             this->analyzeKeyword();
         }
 
-        void update(const std::size_t    /* sim_step */,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->component_ == Component::NumComponents) {
-                return;
+                return std::nullopt;
             }
 
             auto flows = simRes.ireg.find(this->regname_);
             if (flows == simRes.ireg.end()) {
-                return;
+                return std::nullopt;
             }
 
             auto flow = flows->second.getInterRegFlows(this->r1_, this->r2_);
             if (! flow.has_value()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
@@ -3517,7 +3991,6 @@ namespace Evaluator {
         using Component  = RateWindow::Component;
         using Direction  = RateWindow::Direction;
 
-        Opm::EclIO::SummaryNode node_;
         Opm::UnitSystem::measure m_;
         std::string regname_{};
 
@@ -3665,33 +4138,33 @@ namespace Evaluator {
         }
     };
 
-    class GlobalProcessValue : public Base
+    class GlobalProcessValue : public NodeValue
     {
     public:
         explicit GlobalProcessValue(Opm::EclIO::SummaryNode node,
                                     const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        value(const std::size_t     /* sim_step */,
+              const double          /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
@@ -3747,12 +4220,14 @@ namespace Evaluator {
                     const SimulatorResults& /* simRes */,
                     Opm::SummaryState&         st) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
+            const auto& sim_time = this->calendar_
+                .moveTo(input.sched.getStartTime(), st.get_elapsed() + stepSize);
             st.update(this->saveKey_, sim_time.day());
         }
 
     private:
         std::string saveKey_;
+        mutable Opm::CalendarCursor calendar_{};
     };
 
     class Month : public Base
@@ -3768,12 +4243,14 @@ namespace Evaluator {
                     const SimulatorResults& /* simRes */,
                     Opm::SummaryState&         st) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
+            const auto& sim_time = this->calendar_
+                .moveTo(input.sched.getStartTime(), st.get_elapsed() + stepSize);
             st.update(this->saveKey_, sim_time.month());
         }
 
     private:
         std::string saveKey_;
+        mutable Opm::CalendarCursor calendar_{};
     };
 
     class Year : public Base
@@ -3789,12 +4266,14 @@ namespace Evaluator {
                     const SimulatorResults& /* simRes */,
                     Opm::SummaryState&         st) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
+            const auto& sim_time = this->calendar_
+                .moveTo(input.sched.getStartTime(), st.get_elapsed() + stepSize);
             st.update(this->saveKey_, sim_time.year());
         }
 
     private:
         std::string saveKey_;
+        mutable Opm::CalendarCursor calendar_{};
     };
 
     class Years : public Base
@@ -3859,6 +4338,9 @@ namespace Evaluator {
 
         Opm::UnitSystem::measure paramUnit_{Opm::UnitSystem::measure::_count};
         ofun paramFunction_{};
+        bool paramReadsSummaryVectors_{false};
+        std::optional<WellPhaseRateKind> paramWellPhaseRate_{};
+        std::optional<WellTracerRateKind> paramWellTracerRate_{};
 
         Descriptor functionRelation();
         Descriptor blockValue();
@@ -3915,8 +4397,28 @@ namespace Evaluator {
         auto desc = this->unknownParameter();
 
         desc.unit = this->functionUnitString();
+
+        if (this->paramWellPhaseRate_.has_value()) {
+            desc.evaluator.reset(new WellPhaseRate {
+                *this->node_, *this->paramWellPhaseRate_
+            });
+
+            return desc;
+        }
+
+        if (this->paramWellTracerRate_.has_value()) {
+            // All well level tracer keywords have a 4-letter prefix.
+            desc.evaluator.reset(new WellTracerRate {
+                *this->node_, *this->paramWellTracerRate_,
+                this->node_->keyword.substr(4)
+            });
+
+            return desc;
+        }
+
         desc.evaluator.reset(new FunctionRelation {
-            *this->node_, std::move(this->paramFunction_)
+            *this->node_, std::move(this->paramFunction_),
+            this->paramReadsSummaryVectors_
         });
 
         return desc;
@@ -4091,6 +4593,19 @@ namespace Evaluator {
             ? Opm::EclIO::SummaryNode::normalise_region_keyword(this->node_->keyword)
             : Opm::EclIO::SummaryNode::normalise_keyword(this->node_->category, this->node_->keyword);
 
+        this->paramReadsSummaryVectors_ =
+            summary_vector_readers.find(normKw) != summary_vector_readers.end();
+
+        this->paramWellPhaseRate_.reset();
+        this->paramWellTracerRate_.reset();
+        if (this->node_->category == Opm::EclIO::SummaryNode::Category::Well) {
+            if (auto kindPos = well_phase_rates.find(normKw);
+                kindPos != well_phase_rates.end())
+            {
+                this->paramWellPhaseRate_ = kindPos->second;
+            }
+        }
+
         auto pos = funs.find(normKw);
         if (pos != funs.end()) {
             // 'node_' represents a functional relation.
@@ -4107,31 +4622,21 @@ namespace Evaluator {
 
         // Check for tracer names twice to allow for tracers starting with S or F
         auto istart = 4;
-        auto tracer_name = normKw.substr(istart);
-        auto trPos = std::find_if(tracers.begin(), tracers.end(),
-                                  [&tracer_name](const auto& tracer)
-                                  {
-                                      return tracer.name == tracer_name;
-                                  });
-
-        if (trPos == tracers.end()) {
+        auto trIndex = tracers.index(normKw.substr(istart));
+
+        if (! trIndex.has_value()) {
             if ((normKw[4] == 'F') || (normKw[4] == 'S'))
                 istart = 5;
             else
                 return false;
-            tracer_name = normKw.substr(istart);
-            trPos = std::find_if(tracers.begin(), tracers.end(),
-                                    [&tracer_name](const auto& tracer)
-                                    {
-                                        return tracer.name == tracer_name;
-                                    });
-
-            if (trPos == tracers.end())
+
+            trIndex = tracers.index(normKw.substr(istart));
+            if (! trIndex.has_value())
                 return false;
         }
 
         auto tracer_tag = normKw.substr(0, istart);
-        switch (trPos->phase) {
+        switch (tracers[*trIndex].phase) {
         case Opm::Phase::WATER:
             tracer_tag += "#W";
             break;
@@ -4151,6 +4656,15 @@ namespace Evaluator {
         pos = funs.find(tracer_tag);
         if (pos != funs.end()) {
             this->paramFunction_ = pos->second;
+
+            if (this->node_->category == Opm::EclIO::SummaryNode::Category::Well) {
+                if (auto kindPos = well_tracer_rates.find(tracer_tag);
+                    kindPos != well_tracer_rates.end())
+                {
+                    this->paramWellTracerRate_ = kindPos->second;
+                }
+            }
+
             return true;
         }
 
@@ -4389,6 +4903,9 @@ makeResultSet(const Opm::IOConfig& iocfg, const std::string& basenm)
     return { iocfg.getOutputDir(), base };
 }
 
+// Minimum number of summary vectors for concurrent evaluation.
+constexpr int min_parallel_evaluators = 1024;
+
 void validateElapsedTime(const double             secs_elapsed,
                          const Opm::EclipseState& es,
                          const Opm::SummaryState& st)
@@ -4443,6 +4960,11 @@ public:
     void internal_store(const SummaryState& st, const int report_step, bool isSubstep);
     void write(const bool is_final_summary);
 
+    void setFlushInterval(const std::chrono::duration<double> interval)
+    {
+        this->flushInterval_ = interval;
+    }
+
 private:
     struct MiniStep
     {
@@ -4472,8 +4994,19 @@ private:
     int prevReportStepID_{-1};
     std::vector<MiniStep>::size_type numUnwritten_{0};
 
+    std::chrono::duration<double> flushInterval_{0.0};
+    std::chrono::steady_clock::time_point prevFlush_{std::chrono::steady_clock::now()};
+
     SummaryOutputParameters                  outputParameters_{};
     std::unordered_map<std::string, EvalPtr> extra_parameters{};
+
+    // All evaluators, in evaluation order.  The members of the grouped
+    // evaluators are replaced by their groups.
+    std::vector<const Evaluator::Base*> evaluationOrder_{};
+    std::vector<std::unique_ptr<Evaluator::WellPhaseRates>> wellPhaseRates_{};
+    std::unique_ptr<Evaluator::WellTracerRates> wellTracerRates_{};
+    std::vector<std::string> wellTableNames_{};
+    std::vector<std::string> wellTracerKeys_{};
     std::vector<std::string> valueKeys_{};
     std::vector<std::string> valueUnits_{};
     std::vector<MiniStep>    unwritten_{};
@@ -4499,8 +5032,11 @@ private:
                       Evaluator::Factory& evaluatorFactory,
                       SummaryConfig&      summary_config);
 
+    void configureEvaluationOrder();
+
     MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
     const MiniStep& lastUnwritten() const;
+    bool deferWrite() const;
 
     void write(const MiniStep& ms);
 
@@ -4538,6 +5074,7 @@ SummaryImplementation(SummaryConfig&      sumcfg,
                                              sched, evaluatorFactory);
 
     this->configureUDQ(es, sched, evaluatorFactory, sumcfg);
+    this->configureEvaluationOrder();
 
     this->regCache_.buildCache(sumcfg.fip_regions(),
                                es.globalFieldProps(),
@@ -4604,18 +5141,64 @@ eval(const int                              sim_step,
         this->es_, this->sched_, this->grid_, this->regCache_, initial_inplace
     };
 
+    auto wellTable = Evaluator::WellTable{};
+    if (! this->wellPhaseRates_.empty() || (this->wellTracerRates_ != nullptr)) {
+        wellTable.build(this->wellTableNames_, this->sched_, sim_step, well_solution);
+    }
+
+    auto wellTracerRates = Opm::data::WellTracerRates{};
+    if (this->wellTracerRates_ != nullptr) {
+        wellTracerRates = Opm::data::WellTracerRates {
+            well_solution, this->wellTableNames_, this->wellTracerKeys_
+        };
+    }
+
     const Evaluator::SimulatorResults simRes {
         well_solution, wbp, grp_nwrk_solution, single_values, inplace,
-        region_values, block_values, aquifer_values, interreg_flows
+        region_values, block_values, aquifer_values, interreg_flows,
+        wellTable, wellTracerRates
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    const auto& evaluators = this->evaluationOrder_;
+
+    // Independent evaluators compute their values concurrently, into a
+    // slot per evaluator.  The values are then applied to the summary
+    // state in evaluator order, interleaved with the updates of the other
+    // evaluators, so the result is the same as that of evaluating
+    // sequentially.
+    const auto numEval = static_cast<int>(evaluators.size());
+    auto values = std::vector<std::optional<double>>(numEval);
+    auto failure = std::vector<std::exception_ptr>(numEval);
+
+    // Lists of well and group names are built on first use.
+    st.wells();
+    st.groups();
+
+#pragma omp parallel for schedule(dynamic, 64) if(numEval >= min_parallel_evaluators)
+    for (int i = 0; i < numEval; ++i) {
+        if (evaluators[i]->independentNode() == nullptr) {
+            continue;
+        }
+
+        try {
+            values[i] = evaluators[i]->value(sim_step, duration, input, simRes, st);
+        }
+        catch (...) {
+            failure[i] = std::current_exception();
+        }
     }
 
-    for (auto& [_, evalPtr] : this->extra_parameters) {
-        (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    for (int i = 0; i < numEval; ++i) {
+        if (failure[i]) {
+            std::rethrow_exception(failure[i]);
+        }
+
+        if (const auto* node = evaluators[i]->independentNode(); node == nullptr) {
+            evaluators[i]->update(sim_step, duration, input, simRes, st);
+        }
+        else if (values[i].has_value()) {
+            updateValue(*node, *values[i], st);
+        }
     }
 
     st.update_elapsed(duration);
@@ -4634,6 +5217,12 @@ void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary
         return;
     }
 
+    if (! is_final_summary && this->deferWrite()) {
+        // Keep substep data in memory until the next report step or
+        // until the flush interval has passed.
+        return;
+    }
+
     this->createSMSpecIfNecessary();
 
     if (this->prevReportStepID_ < this->lastUnwritten().seq) {
@@ -4658,6 +5247,7 @@ void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary
     // Reset "unwritten" counter to reflect the fact that we've
     // output all stored ministeps.
     this->numUnwritten_ = zero;
+    this->prevFlush_ = std::chrono::steady_clock::now();
 }
 
 void Opm::out::Summary::SummaryImplementation::write(const MiniStep& ms)
@@ -4875,6 +5465,88 @@ namespace {
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::configureEvaluationOrder()
+{
+    // Single phase well rates and totals are evaluated one keyword at a
+    // time, in the position of the keyword's first vector, so that the
+    // well lookups and efficiency factors are shared between keywords.
+    // Well tracer vectors are all evaluated in the position of the first
+    // such vector, using one matrix of the tracer rates of all wells.
+    auto batches = std::unordered_map<std::string, Evaluator::WellPhaseRates*>{};
+    auto wellIndex = std::unordered_map<std::string, std::size_t>{};
+    auto tracerIndex = std::unordered_map<std::string, std::size_t>{};
+
+    auto wellTableIndex = [&wellIndex, this](const std::string& well)
+    {
+        auto wellPos = wellIndex.find(well);
+        if (wellPos == wellIndex.end()) {
+            wellPos = wellIndex.emplace(well, this->wellTableNames_.size()).first;
+            this->wellTableNames_.push_back(well);
+        }
+
+        return wellPos->second;
+    };
+
+    auto addTracerEvaluator = [&tracerIndex, &wellTableIndex, this]
+        (const Evaluator::WellTracerRate* member)
+    {
+        if (this->wellTracerRates_ == nullptr) {
+            this->wellTracerRates_ = std::make_unique<Evaluator::WellTracerRates>();
+            this->evaluationOrder_.push_back(this->wellTracerRates_.get());
+        }
+
+        auto tracerPos = tracerIndex.find(member->tracer());
+        if (tracerPos == tracerIndex.end()) {
+            tracerPos = tracerIndex.emplace(member->tracer(), this->wellTracerKeys_.size()).first;
+            this->wellTracerKeys_.push_back(member->tracer());
+        }
+
+        this->wellTracerRates_->add(member,
+                                    wellTableIndex(member->independentNode()->wgname),
+                                    tracerPos->second);
+    };
+
+    auto addEvaluator = [&batches, &wellTableIndex, &addTracerEvaluator, this]
+        (const Evaluator::Base* evaluator)
+    {
+        if (const auto* tracerMember = dynamic_cast<const Evaluator::WellTracerRate*>(evaluator);
+            tracerMember != nullptr)
+        {
+            addTracerEvaluator(tracerMember);
+            return;
+        }
+
+        const auto* member = dynamic_cast<const Evaluator::WellPhaseRate*>(evaluator);
+        if (member == nullptr) {
+            this->evaluationOrder_.push_back(evaluator);
+            return;
+        }
+
+        const auto& node = *member->independentNode();
+
+        auto batchPos = batches.find(node.keyword);
+        if (batchPos == batches.end()) {
+            auto* batch = this->wellPhaseRates_
+                .emplace_back(std::make_unique<Evaluator::WellPhaseRates>()).get();
+
+            batchPos = batches.emplace(node.keyword, batch).first;
+            this->evaluationOrder_.push_back(batch);
+        }
+
+        batchPos->second->add(member, wellTableIndex(node.wgname));
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        addEvaluator(evalPtr.get());
+    }
+
+    for (const auto& [_, evalPtr] : this->extra_parameters) {
+        (void)_;
+        addEvaluator(evalPtr.get());
+    }
+}
+
 void
 Opm::out::Summary::SummaryImplementation::
 configureUDQ(const EclipseState& es,
@@ -5010,6 +5682,13 @@ Opm::out::Summary::SummaryImplementation::lastUnwritten() const
     return this->unwritten_[this->numUnwritten_ - 1];
 }
 
+bool Opm::out::Summary::SummaryImplementation::deferWrite() const
+{
+    return (this->flushInterval_.count() > 0.0)
+        && this->lastUnwritten().isSubstep
+        && (std::chrono::steady_clock::now() - this->prevFlush_ < this->flushInterval_);
+}
+
 void Opm::out::Summary::SummaryImplementation::createSMSpecIfNecessary()
 {
     if (this->deferredSMSpec_) {
@@ -5099,6 +5778,11 @@ void Summary::write(const bool is_final_summary) const
     this->pImpl_->write(is_final_summary);
 }
 
+void Summary::setFlushInterval(const std::chrono::duration<double> interval)
+{
+    this->pImpl_->setFlushInterval(interval);
+}
+
 Summary::~Summary() {}
 
 }} // namespace Opm::out
@@ -23,6 +23,7 @@
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/output/data/InterRegFlowMap.hpp>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -83,6 +84,16 @@ public:
 
     void write(const bool is_final_summary = false) const;
 
+    /// Defer output of substep (ministep) data.
+    ///
+    /// Calls to write() made while the most recently added timestep is a
+    /// substep are deferred until at least 'interval' of wall clock time
+    /// has passed since the previous output, so that the data of many
+    /// small timesteps are written and flushed as one block.  Report steps
+    /// and the final summary are always written immediately.  A zero
+    /// interval, the default, writes at every call to write().
+    void setFlushInterval(std::chrono::duration<double> interval);
+
 private:
     class SummaryImplementation;
     std::unique_ptr<SummaryImplementation> pImpl_;
@@ -50,6 +50,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -114,25 +115,27 @@ namespace {
     {
         const auto numCols = 1 + 2*numDep;
 
-        auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
-
         auto linTable = ::Opm::LinearisedOutputTable {
             numTab, numPrim, numRows, numCols, fillVal
         };
 
-        // Note unusual loop counters here.  Specifically, we mutate the
-        // members of 'descr' rather than using separate counters, which is
-        // the custom construction.  The reason for this is that these
-        // members are also used in calcSlopes() to indicate which table
-        // subsection to analyse and compute derivatives for.  With separate
-        // loop counters, we would need to form a new table descriptor for
-        // each call to calcSlopes().
-        for (descr.tableID = 0*numTab;
-             descr.tableID < 1*numTab; ++descr.tableID)
-        {
-            for (descr.primID = 0*numPrim;
-                 descr.primID < 1*numPrim; ++descr.primID)
-            {
+        // Each sub-table occupies its own, preallocated, window of every
+        // column of 'linTable' so the sub-tables are filled and
+        // differentiated concurrently.  Exceptions cannot leave the
+        // parallel region.  Keep the first one in table order and rethrow
+        // it afterwards as a serial loop would have done.
+        constexpr auto min_parallel_size = std::size_t{64};
+
+        const auto numSubTables = numTab * numPrim;
+        auto failures = std::vector<std::exception_ptr>(numSubTables);
+
+#pragma omp parallel for schedule(static) if(numSubTables >= min_parallel_size)
+        for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(numSubTables); ++i) {
+            auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
+            descr.tableID = static_cast<std::size_t>(i) / numPrim;
+            descr.primID  = static_cast<std::size_t>(i) % numPrim;
+
+            try {
                 descr.numActRows =
                     buildDeps(descr.tableID, descr.primID, linTable);
 
@@ -145,6 +148,15 @@ namespace {
                 //    from namespace ::Opm::DifferentiateOutputTable.
                 calcSlopes(numDep, descr, linTable);
             }
+            catch (...) {
+                failures[i] = std::current_exception();
+            }
+        }
+
+        for (const auto& failure : failures) {
+            if (failure != nullptr) {
+                std::rethrow_exception(failure);
+            }
         }
 
         return linTable.getDataDestructively();
@@ -76,6 +76,7 @@ namespace Opm { namespace RestartIO { namespace Helpers {
                                const T          initial = T{})
             : x_         (n.value * sz.value, initial)
             , windowSize_(sz.value)
+            , initial_   (initial)
         {
             if (sz.value == 0) {
                 throw std::invalid_argument {
@@ -101,6 +102,25 @@ namespace Opm { namespace RestartIO { namespace Helpers {
             return this->windowSize_;
         }
 
+        /// Reshape array and reset all data items to their initial
+        /// value.
+        ///
+        /// Reuses the existing allocation if it is large enough.
+        ///
+        /// \param[in] n Number of windows.
+        /// \param[in] sz Number of data items per window.
+        void reset(const NumWindows n, const WindowSize sz)
+        {
+            if (sz.value == 0) {
+                throw std::invalid_argument {
+                    "Zero-sized windows are not permitted"
+                };
+            }
+
+            this->x_.assign(n.value * sz.value, this->initial_);
+            this->windowSize_ = sz.value;
+        }
+
         /// Request read/write access to individual window.
         ///
         /// \param[in] window Numeric ID of particular read/write window.
@@ -150,6 +170,9 @@ namespace Opm { namespace RestartIO { namespace Helpers {
         std::vector<T> x_;
 
         Idx windowSize_;
+
+        /// Initial value of data items.
+        T initial_;
     };
 
 
@@ -221,6 +244,28 @@ namespace Opm { namespace RestartIO { namespace Helpers {
             return this->data_.windowSize();
         }
 
+        /// Reshape matrix and reset all data items to their initial
+        /// value.
+        ///
+        /// Reuses the existing allocation if it is large enough.
+        ///
+        /// \param[in] nRows Number of rows.
+        /// \param[in] nCols Number of columns.
+        /// \param[in] sz Number of data items per (row,column) window.
+        void reset(const NumRows&    nRows,
+                   const NumCols&    nCols,
+                   const WindowSize& sz)
+        {
+            if (nCols.value == 0) {
+                throw std::invalid_argument {
+                    "Zero-columned windowed matrices are not permitted"
+                };
+            }
+
+            this->data_.reset(NumWindows{ nRows.value * nCols.value }, sz);
+            this->numCols_ = nCols.value;
+        }
+
         /// Request read/write access to individual window.
         ///
         /// \param[in] row Numeric ID of particular row in matrix.
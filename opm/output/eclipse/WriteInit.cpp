@@ -236,9 +236,23 @@ namespace {
 
     // =================================================================
 
-    std::vector<float> singlePrecision(const std::vector<double>& x)
+    // The floating-point vectors are converted to single precision, and
+    // to output units, one vector at a time in a scratch buffer which is
+    // reused for all vectors.  This avoids holding a full double precision
+    // copy next to the single precision copy of every vector.
+    template <typename Value>
+    void writeSinglePrecision(const std::string&                name,
+                              const std::size_t                 size,
+                              Value&&                           value,
+                              std::vector<float>&               scratch,
+                              ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        return { x.begin(), x.end() };
+        scratch.resize(size);
+        for (auto i = 0*size; i < size; ++i) {
+            scratch[i] = static_cast<float>(value(i));
+        }
+
+        initFile.write(name, scratch);
     }
 
     ::Opm::RestartIO::LogiHEAD::PVTModel
@@ -319,11 +333,14 @@ namespace {
 
     void writePoreVolume(const ::Opm::EclipseState&        es,
                          const ::Opm::UnitSystem&          units,
+                         std::vector<float>&               scratch,
                          ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        auto porv = es.globalFieldProps().porv(true);
-        units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        const auto porv = es.globalFieldProps().porv(true);
+        writeSinglePrecision("PORV", porv.size(),
+            [&porv, &units](const std::size_t i)
+            { return units.from_si(::Opm::UnitSystem::measure::volume, porv[i]); },
+            scratch, initFile);
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
@@ -349,105 +366,77 @@ namespace {
 
     void writeGridGeometry(const ::Opm::EclipseGrid&         grid,
                            const ::Opm::UnitSystem&          units,
+                           std::vector<float>&               scratch,
                            ::Opm::EclIO::OutputStream::Init& initFile)
     {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
-
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
-            const auto  globCell = grid.getGlobalIndex(cell);
-            const auto& dims     = grid.getCellDims(globCell);
-
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
-        }
-
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
-    }
-
-    template <class WriteVector>
-    void writeCellDoublePropertiesWithDefaultFlag(const Properties&               propList,
-                                                  const ::Opm::FieldPropsManager& fp,
-                                                  WriteVector&&                   write)
-    {
-        for (const auto& prop : propList) {
-            if (! fp.has_double(prop.name)) {
-                continue;
-            }
+        // Evaluate the geometry of all active cells in parallel, the
+        // per-cell calls below read the cached values.
+        grid.activeGeometry();
 
-            auto data = fp.get_double(prop.name);
-            auto defaulted = fp.defaulted<double>(prop.name);
+        const auto writeLength = [&](const std::string& name, auto&& value)
+        {
+            writeSinglePrecision(name, nAct,
+                [&grid, &units, &value, length](const std::size_t cell)
+                { return units.from_si(length, value(grid.getGlobalIndex(cell))); },
+                scratch, initFile);
+        };
 
-            write(prop, std::move(defaulted), std::move(data));
-        }
+        writeLength("DEPTH", [&grid](const std::size_t globCell) { return grid.getCellDepth(globCell); });
+        writeLength("DX"   , [&grid](const std::size_t globCell) { return grid.getCellDims(globCell)[0]; });
+        writeLength("DY"   , [&grid](const std::size_t globCell) { return grid.getCellDims(globCell)[1]; });
+        writeLength("DZ"   , [&grid](const std::size_t globCell) { return grid.getCellDims(globCell)[2]; });
     }
 
-    template <class WriteVector>
-    void writeCellPropertiesValuesOnly(const Properties&               propList,
-                                       const ::Opm::FieldPropsManager& fp,
-                                       WriteVector&&                   write)
+    void writeCellProperty(const CellProperty&               prop,
+                           const std::vector<double>&        value,
+                           const std::vector<bool>*          dflt,
+                           const ::Opm::UnitSystem&          units,
+                           std::vector<float>&               scratch,
+                           ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        for (const auto& prop : propList) {
-            if (!fp.has_double(prop.name)) {
-                continue;
+        writeSinglePrecision(prop.name, value.size(),
+            [&prop, &value, dflt, &units](const std::size_t i)
+        {
+            if ((dflt != nullptr) && (*dflt)[i]) {
+                // Element defaulted.  Output sentinel value (-1.0e+20) to
+                // signify defaulted element.
+                return -1.0e+20f;
             }
 
-            auto data = fp.get_double(prop.name);
-            write(prop, std::move(data));
-        }
+            return static_cast<float>(units.from_si(prop.unit, value[i]));
+        }, scratch, initFile);
     }
 
     void writeDoubleCellProperties(const Properties&                    propList,
                                    const ::Opm::FieldPropsManager&      fp,
                                    const ::Opm::UnitSystem&             units,
                                    const bool                           needDflt,
+                                   std::vector<float>&                  scratch,
                                    ::Opm::EclIO::OutputStream::Init&    initFile)
     {
-        if (needDflt) {
-            writeCellDoublePropertiesWithDefaultFlag(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<bool>&&   dflt,
-                                    std::vector<double>&& value)
-            {
-                units.from_si(prop.unit, value);
-
-                for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
-                    if (dflt[i]) {
-                        // Element defaulted.  Output sentinel value
-                        // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
-                    }
-                }
-
-                initFile.write(prop.name, singlePrecision(value));
-            });
-        }
-        else {
-            writeCellPropertiesValuesOnly(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<double>&& value)
-            {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
-            });
+        for (const auto& prop : propList) {
+            if (! fp.has_double(prop.name)) {
+                continue;
+            }
+
+            const auto& value = fp.get_double(prop.name);
+
+            if (needDflt) {
+                const auto dflt = fp.defaulted<double>(prop.name);
+                writeCellProperty(prop, value, &dflt, units, scratch, initFile);
+            }
+            else {
+                writeCellProperty(prop, value, nullptr, units, scratch, initFile);
+            }
         }
     }
 
     void writeDoubleCellProperties(const ::Opm::EclipseState&        es,
                                    const ::Opm::UnitSystem&          units,
+                                   std::vector<float>&               scratch,
                                    ::Opm::EclIO::OutputStream::Init& initFile)
     {
         const auto doubleKeywords = Properties {
@@ -473,17 +462,36 @@ namespace {
         const auto& fp = es.globalFieldProps();
         fp.get_double("NTG");
 
-        writeDoubleCellProperties(doubleKeywords, fp, units, false, initFile);
+        writeDoubleCellProperties(doubleKeywords, fp, units, false, scratch, initFile);
     }
 
     void writeSimulatorProperties(const ::Opm::EclipseGrid&         grid,
                                   const ::Opm::data::Solution&      simProps,
+                                  std::vector<float>&               scratch,
                                   ::Opm::EclIO::OutputStream::Init& initFile)
     {
+        const auto nAct = grid.getNumActive();
+
         for (const auto& prop : simProps) {
-            const auto& value = grid.compressedVector(prop.second.data<double>());
+            const auto& value = prop.second.data<double>();
 
-            initFile.write(prop.first, singlePrecision(value));
+            if (value.size() == nAct) {
+                writeSinglePrecision(prop.first, nAct,
+                    [&value](const std::size_t cell) { return value[cell]; },
+                    scratch, initFile);
+
+                continue;
+            }
+
+            if (value.size() != grid.getCartesianSize()) {
+                throw std::invalid_argument("Input vector must have full size");
+            }
+
+            const auto& active_map = grid.getActiveMap();
+            writeSinglePrecision(prop.first, nAct,
+                [&value, &active_map](const std::size_t cell)
+                { return value[active_map[cell]]; },
+                scratch, initFile);
         }
     }
 
@@ -518,22 +526,28 @@ namespace {
     }
 
     void writeFilledSatFuncScaling(const Properties&                 propList,
-                                   ::Opm::FieldPropsManager&&        fp,
+                                   const ::Opm::FieldPropsManager&   fp,
                                    const ::Opm::UnitSystem&          units,
+                                   std::vector<float>&               scratch,
                                    ::Opm::EclIO::OutputStream::Init& initFile)
     {
         for (const auto& prop : propList) {
             if (prop.supports_auto_create) {
-                fp.get_double(prop.name);
+                // get_copy() creates the array without installing it in
+                // the properties container, one array at a time.
+                const auto value = fp.get_copy<double>(prop.name);
+                writeCellProperty(prop, value, nullptr, units, scratch, initFile);
+            }
+            else if (fp.has_double(prop.name)) {
+                writeCellProperty(prop, fp.get_double(prop.name), nullptr,
+                                  units, scratch, initFile);
             }
         }
-
-        // Don't write sentinel value if input defaulted.
-        writeDoubleCellProperties(propList, fp, units, false, initFile);
     }
 
     void writeSatFuncScaling(const ::Opm::EclipseState&        es,
                              const ::Opm::UnitSystem&          units,
+                             std::vector<float>&               scratch,
                              ::Opm::EclIO::OutputStream::Init& initFile)
     {
         const auto epsVectors = ScalingVectors{}
@@ -548,36 +562,30 @@ namespace {
             // Output only those endpoint arrays that exist in the input
             // deck.  Write sentinel value if input defaulted.
             writeDoubleCellProperties(epsVectors.getVectors(), fp,
-                                      units, true, initFile);
+                                      units, true, scratch, initFile);
         }
         else {
             // Input deck specified FILLEPS so we should output all endpoint
             // arrays, whether explicitly defined in the input deck or not.
             // However, downstream clients of FieldPropsManager should not
-            // see scaling arrays created for output purposes only, so make
-            // a copy of the properties object and modify that copy in order
-            // to leave the original intact.  Don't write sentinel value if
+            // see scaling arrays created for output purposes only, so the
+            // missing arrays are created as copies which are not installed
+            // in the properties object.  Don't write sentinel value if
             // input defaulted.
-            auto fp_copy = fp;
-            writeFilledSatFuncScaling(epsVectors.getVectors(),
-                                      std::move(fp_copy),
-                                      units, initFile);
+            writeFilledSatFuncScaling(epsVectors.getVectors(), fp,
+                                      units, scratch, initFile);
         }
     }
 
     void writeNonNeighbourConnections(const std::vector<::Opm::NNCdata>& nnc,
                                       const ::Opm::UnitSystem&           units,
+                                      std::vector<float>&                scratch,
                                       ::Opm::EclIO::OutputStream::Init&  initFile)
     {
-        auto tran = std::vector<double>{};
-        tran.reserve(nnc.size());
-
-        std::transform(nnc.begin(), nnc.end(), std::back_inserter(tran),
-                       [](const auto& nd) { return nd.trans; });
-
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
-
-        initFile.write("TRANNNC", singlePrecision(tran));
+        writeSinglePrecision("TRANNNC", nnc.size(),
+            [&nnc, &units](const std::size_t i)
+            { return units.from_si(::Opm::UnitSystem::measure::transmissibility, nnc[i].trans); },
+            scratch, initFile);
     }
 
     // output aquifer cell and aquifer connection information for numerical aquifers
@@ -648,6 +656,9 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
 {
     const auto& units = es.getUnits();
 
+    // Single precision buffer shared by all floating-point vectors.
+    auto scratch = std::vector<float>{};
+
     writeInitFileHeader(es, grid, schedule, initFile);
 
     // The PORV vector is a special case.  This particular vector always
@@ -655,12 +666,12 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
     // set to zero for inactive cells.  This treatment implies that the
     // active/inactive cell mapping can be inferred by reading the PORV
     // vector from the result set.
-    writePoreVolume(es, units, initFile);
+    writePoreVolume(es, units, scratch, initFile);
 
-    writeGridGeometry(grid, units, initFile);
+    writeGridGeometry(grid, units, scratch, initFile);
 
-    writeDoubleCellProperties(es, units, initFile);
-    writeSimulatorProperties(grid, simProps, initFile);
+    writeDoubleCellProperties(es, units, scratch, initFile);
+    writeSimulatorProperties(grid, simProps, scratch, initFile);
 
     // Size defaulted MULT* arrays according to the number of active cells
     // in the processed simulation grid--i.e., grid.getNumActive().
@@ -675,7 +686,7 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
                         data::TargetType::INIT);
         }
 
-        writeSimulatorProperties(grid, multipliers, initFile);
+        writeSimulatorProperties(grid, multipliers, scratch, initFile);
     }
 
     writeTableData(es, units, initFile);
@@ -683,10 +694,10 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
     writeIntegerCellProperties(es, initFile);
     writeIntegerMaps(std::move(int_data), initFile);
 
-    writeSatFuncScaling(es, units, initFile);
+    writeSatFuncScaling(es, units, scratch, initFile);
 
     if (!nnc.empty()) {
-        writeNonNeighbourConnections(nnc, units, initFile);
+        writeNonNeighbourConnections(nnc, units, scratch, initFile);
     }
 
     if (es.aquifer().active()) {
@@ -41,7 +41,7 @@ namespace {
 
     void left_align(std::string& string, std::size_t width, std::size_t = 0) {
         if (string.size() < width) {
-            string.append(std::string(width - string.size(), field_padding));
+            string.append(width - string.size(), field_padding);
         }
     }
 
@@ -55,7 +55,7 @@ namespace {
 
     void right_align(std::string& string, std::size_t width, std::size_t = 0) {
         if (string.size() < width) {
-            string = std::string(width - string.size(), field_padding) + string;
+            string.insert(0, width - string.size(), field_padding);
         }
     }
 
@@ -70,7 +70,8 @@ namespace {
 
             std::size_t left { shift_one + extra_space / 2 }, right { extra_space / 2 } ;
 
-            string = std::string(left, field_padding) + string + std::string(right, field_padding);
+            string.insert(0, left, field_padding);
+            string.append(right, field_padding);
         }
     }
 
@@ -108,11 +109,11 @@ namespace {
 
         std::optional<Opm::UnitSystem::measure> dimension { std::nullopt } ;
 
-        void print(std::ostream& os, const T& data, const context& ctx, std::size_t sub_report, std::size_t line_number) const {
+        void print(std::string& buffer, const T& data, const context& ctx, std::size_t sub_report, std::size_t line_number) const {
             std::string string_data { fetch(data, ctx, sub_report, line_number) } ;
             format(string_data, internal_width, line_number);
             centre_align(string_data, total_width());
-            os << string_data;
+            buffer.append(string_data);
         }
 
         std::string header_line(std::size_t row, const context& ctx) const
@@ -167,19 +168,27 @@ namespace {
             print_divider(os);
         }
 
+        // The whole table is rendered into a single buffer, sized up front
+        // from the column widths, and handed to the stream in one write.
         void print_data(std::ostream& os, const std::vector<T>& lines, const context& ctx, std::size_t sub_report) const {
+            std::string buffer;
+            buffer.reserve(lines.size() * (total_width() + 1));
+
             std::size_t line_number { 0 } ;
             for (const auto& line : lines) {
 
                 for (const auto& column : *this) {
-                    os << field_separator;
-                    column.print(os, line, ctx, sub_report, line_number);
+                    buffer.push_back(field_separator);
+                    column.print(buffer, line, ctx, sub_report, line_number);
                 }
 
-                os << field_separator << record_separator;
+                buffer.push_back(field_separator);
+                buffer.push_back(record_separator);
 
                 ++line_number;
             }
+
+            os.write(buffer.data(), buffer.size());
         }
     };
 
@@ -22,14 +22,23 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <filesystem>
 #include <iterator>
+#include <limits>
 #include <string>
 
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, long int>;
 using ParamEntry = std::tuple<std::string, Opm::EclIO::eclArrType>;
 
+namespace {
+
+// Smallest number of cells worth splitting over several threads.
+constexpr std::size_t min_parallel_size = 65536;
+
+}
+
 
 EModel::EModel(const std::string& filename) :
     initfile(filename)
@@ -69,7 +78,7 @@ EModel::EModel(const std::string& filename) :
     J.reserve(nActive);
     K.reserve(nActive);
 
-    ActFilter.resize(nActive, true);
+    ActFilter.resize(nActive, 1);
 
     std::vector<float> porv_all = initfile.get<float>("PORV");
 
@@ -195,10 +204,21 @@ void EModel::get_cell_volumes_from_grid()
         throw std::runtime_error(message);
     }
 
-    CELLVOL.clear();
+    // The volumes of the active cells of the grid are computed once, in
+    // parallel.  Cells with a pore volume but inactive in the grid are rare
+    // and evaluated one by one.
+    const auto& activeVolume = grid->activeVolume();
 
-    for (size_t n = 0;n < nActive; n++)
-        CELLVOL.push_back(grid->getCellVolume(I[n]-1, J[n]-1, K[n]-1));
+    CELLVOL.resize(nActive);
+
+#pragma omp parallel for schedule(static) if(nActive >= min_parallel_size)
+    for (size_t n = 0; n < nActive; n++) {
+        const auto globalIndex = grid->getGlobalIndex(I[n]-1, J[n]-1, K[n]-1);
+
+        CELLVOL[n] = grid->cellActive(globalIndex)
+            ? activeVolume[grid->activeIndex(globalIndex)]
+            : grid->getCellVolume(globalIndex);
+    }
 
     celVolCalculated = true;
 }
@@ -222,7 +242,7 @@ std::vector<ParamEntry> EModel::getListOfParameters() const
 
 int EModel::getNumberOfActiveCells()
 {
-    return std::count(ActFilter.begin(), ActFilter.end(), true);
+    return std::count(ActFilter.begin(), ActFilter.end(), std::uint8_t{1});
 }
 
 bool EModel::hasInitParameter(const std::string &name) const
@@ -255,27 +275,32 @@ bool EModel::hasReportStep(int rstep)
 void EModel::resetFilter()
 {
     activeFilter=false;
-    std::fill(ActFilter.begin(), ActFilter.end(), true);
+    std::fill(ActFilter.begin(), ActFilter.end(), std::uint8_t{1});
 }
 
 
+template <typename T, typename Predicate>
+void EModel::applyFilter(const std::vector<T>& paramVect, Predicate&& pass)
+{
+    const size_t size = paramVect.size();
+
+    // Branch free, so the loop vectorizes.
+#pragma omp parallel for schedule(static) if(size >= min_parallel_size)
+    for (size_t i = 0; i < size; i++)
+        ActFilter[i] &= static_cast<std::uint8_t>(pass(paramVect[i]));
+}
+
 template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
 {
     if ((opperator == "eq") || (opperator == "==")){
-       for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] != value))
-                ActFilter[i] = false;
+        applyFilter(paramVect, [value](const T x) { return x == value; });
 
     } else if ((opperator=="lt") || (opperator=="<")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] >= value))
-                ActFilter[i] = false;
+        applyFilter(paramVect, [value](const T x) { return x < value; });
 
     } else if ((opperator == "gt") || (opperator == ">")){
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] <= value))
-                ActFilter[i] = false;
+        applyFilter(paramVect, [value](const T x) { return x > value; });
 
     } else {
         const std::string message =
@@ -290,9 +315,7 @@ template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2)
 {
     if ((opperator == "in") || (opperator == "between")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && ((paramVect[i] <= value1) || (paramVect[i] >= value2)))
-                ActFilter[i] = false;
+        applyFilter(paramVect, [value1, value2](const T x) { return (x > value1) && (x < value2); });
 
     } else {
         const std::string message =
@@ -347,21 +370,21 @@ const std::vector<T>& EModel::get_filter_param(const std::string& param)
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num1, int num2)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);;
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
@@ -369,7 +392,7 @@ void EModel::addFilter<float>(const std::string& param1, const std::string& oppe
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num1, float num2)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
@@ -381,17 +404,15 @@ void EModel::addHCvolFilter()
                                  "function setDepthfwl before using "
                                  "filter HC filter");
 
-    auto eqlnum = initfile.get<int>("EQLNUM");
-    auto depth = initfile.get<float>("DEPTH");
+    const auto& eqlnum = initfile.get<int>("EQLNUM");
+    const auto& depth = initfile.get<float>("DEPTH");
     activeFilter = true;
 
-    for (size_t n = 0; n < eqlnum.size();n++){
-        int eql = eqlnum[n];
-        float fwl = FreeWaterlevel[eql-1];
+    const size_t size = eqlnum.size();
 
-        if ((ActFilter[n]) && (depth[n] > fwl))
-            ActFilter[n] = false;
-    }
+#pragma omp parallel for schedule(static) if(size >= min_parallel_size)
+    for (size_t n = 0; n < size; n++)
+        ActFilter[n] &= static_cast<std::uint8_t>(depth[n] <= FreeWaterlevel[eqlnum[n]-1]);
 }
 
 
@@ -399,7 +420,7 @@ template <>
 const std::vector<float>& EModel::getParam<float>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<float> param = get_filter_param<float>(name);
+        const auto& param = get_filter_param<float>(name);
         filteredFloatVect.clear();
 
         for (size_t i = 0; i < param.size(); i++)
@@ -419,7 +440,7 @@ template <>
 const std::vector<int>& EModel::getParam<int>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<int> param = get_filter_param<int>(name);
+        const auto& param = get_filter_param<int>(name);
         filteredIntVect.clear();
 
         for (size_t i = 0; i < param.size(); i++)
@@ -478,3 +499,131 @@ void EModel::setDepthfwl(const std::vector<float>& fwl)
         throw std::invalid_argument(message);
     }
 }
+
+
+bool EModel::isIntParameter(const std::string& name) const
+{
+    if ((name == "I") || (name == "J") || (name == "K") ||
+        (name == "ROW") || (name == "COLUMN") || (name == "LAYER"))
+        return true;
+
+    auto search = initParam.find(name);
+    return (search != initParam.end()) && (initParamType[search->second] == Opm::EclIO::INTE);
+}
+
+
+template <typename Function>
+auto EModel::visitParam(const std::string& name, Function&& function)
+{
+    if (isIntParameter(name))
+        return function(get_filter_param<int>(name));
+    else
+        return function(get_filter_param<float>(name));
+}
+
+
+void EModel::regionSumCount(const std::string& name, const std::string& region,
+                            std::vector<double>& sum, std::vector<std::size_t>& count)
+{
+    const auto& regions = get_filter_param<int>(region);
+    const int numRegions = regions.empty() ? 0 : *std::max_element(regions.begin(), regions.end());
+
+    sum.assign(std::max(numRegions, 0), 0.0);
+    count.assign(sum.size(), 0);
+
+    visitParam(name, [&](const auto& values)
+    {
+        const size_t size = values.size();
+
+#pragma omp parallel if(size >= min_parallel_size)
+        {
+            std::vector<double> localSum(sum.size(), 0.0);
+            std::vector<std::size_t> localCount(sum.size(), 0);
+
+#pragma omp for schedule(static) nowait
+            for (size_t n = 0; n < size; n++) {
+                if (ActFilter[n] && (regions[n] > 0)) {
+                    localSum[regions[n]-1] += values[n];
+                    localCount[regions[n]-1] += 1;
+                }
+            }
+
+#pragma omp critical
+            for (size_t r = 0; r < sum.size(); r++) {
+                sum[r] += localSum[r];
+                count[r] += localCount[r];
+            }
+        }
+    });
+}
+
+
+std::vector<double> EModel::getRegionSum(const std::string& name, const std::string& region)
+{
+    std::vector<double> sum;
+    std::vector<std::size_t> count;
+    regionSumCount(name, region, sum, count);
+
+    return sum;
+}
+
+
+std::vector<double> EModel::getRegionMean(const std::string& name, const std::string& region)
+{
+    std::vector<double> sum;
+    std::vector<std::size_t> count;
+    regionSumCount(name, region, sum, count);
+
+    for (size_t r = 0; r < sum.size(); r++)
+        sum[r] = (count[r] > 0) ? sum[r] / count[r] : std::numeric_limits<double>::quiet_NaN();
+
+    return sum;
+}
+
+
+std::vector<double> EModel::getRegionPercentile(const std::string& name, const std::string& region,
+                                                double percentile)
+{
+    if ((percentile < 0.0) || (percentile > 100.0)) {
+        const std::string message =
+            fmt::format("Percentile {} outside of range [0, 100]", percentile);
+        throw std::invalid_argument(message);
+    }
+
+    const auto& regions = get_filter_param<int>(region);
+    const int numRegions = regions.empty() ? 0 : *std::max_element(regions.begin(), regions.end());
+
+    std::vector<std::vector<double>> values(std::max(numRegions, 0));
+
+    visitParam(name, [&](const auto& param)
+    {
+        for (size_t n = 0; n < param.size(); n++)
+            if (ActFilter[n] && (regions[n] > 0))
+                values[regions[n]-1].push_back(param[n]);
+    });
+
+    std::vector<double> result(values.size(), std::numeric_limits<double>::quiet_NaN());
+    const int size = static_cast<int>(values.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (int r = 0; r < size; r++) {
+        auto& v = values[r];
+        if (v.empty())
+            continue;
+
+        const double pos = percentile / 100.0 * (v.size() - 1);
+        const auto lower = static_cast<size_t>(std::floor(pos));
+
+        std::nth_element(v.begin(), v.begin() + lower, v.end());
+        const double lowerValue = v[lower];
+
+        if (lower + 1 < v.size()) {
+            const double upperValue = *std::min_element(v.begin() + lower + 1, v.end());
+            result[r] = lowerValue + (upperValue - lowerValue) * (pos - lower);
+        } else {
+            result[r] = lowerValue;
+        }
+    }
+
+    return result;
+}
@@ -25,6 +25,7 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <ctime>
@@ -64,6 +65,16 @@ public:
 
     int getNumberOfActiveCells();
 
+    // Reductions of the filtered cells of a parameter for each value of
+    // the integer region parameter 'region', e.g. FIPNUM or EQLNUM.
+    // Element r-1 of the result holds region r.  Empty regions give a
+    // zero sum and NaN mean and percentiles.  Percentiles are in the
+    // range [0, 100] and interpolate linearly between cell values.
+    std::vector<double> getRegionSum(const std::string& name, const std::string& region);
+    std::vector<double> getRegionMean(const std::string& name, const std::string& region);
+    std::vector<double> getRegionPercentile(const std::string& name, const std::string& region,
+                                            double percentile);
+
 
     std::tuple<int, int, int> gridDims(){ return std::make_tuple(nI, nJ, nK); };
 
@@ -83,7 +94,9 @@ private:
     std::vector<float> PORV;
     std::vector<float> CELLVOL;
     std::vector<int> I, J, K;
-    std::vector<bool> ActFilter;
+    // One byte per active cell, 1 if the cell passes all filters.
+    // Filters are and'ed into the mask as they are added.
+    std::vector<std::uint8_t> ActFilter;
 
     Opm::EclIO::EclFile initfile;
     std::optional<Opm::EclipseGrid> grid;
@@ -122,6 +135,20 @@ private:
     template <typename T>
     void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2);
 
+    template <typename T, typename Predicate>
+    void applyFilter(const std::vector<T>& paramVect, Predicate&& pass);
+
+    bool isIntParameter(const std::string& name) const;
+
+    template <typename Function>
+    auto visitParam(const std::string& name, Function&& function);
+
+    void regionSumCount(const std::string& name, const std::string& region,
+                        std::vector<double>& sum, std::vector<std::size_t>& count);
+
+    std::vector<std::vector<double>> filteredValuesByRegion(const std::string& name,
+                                                            const std::string& region);
+
 };
 
 #endif
@@ -2,6 +2,9 @@
 #define SUNBEAM_CONVERTERS_HPP
 
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -48,6 +51,38 @@ py::array_t<T> numpy_array(const std::vector<T>& input) {
     return output;
 }
 
+
+/*
+  Take ownership of a temporary vector instead of copying it; the array
+  frees the vector when it is garbage collected.
+*/
+template <class T, std::enable_if_t<!std::is_same_v<T, bool>, int> = 0>
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    auto * owned = new std::vector<T>(std::move(input));
+    py::capsule base(owned, [](void * ptr) { delete static_cast<std::vector<T>*>(ptr); });
+
+    return py::array_t<T>(owned->size(), owned->data(), base);
+}
+
+
+/*
+  Read-only array pointing directly into input, without copying.  The
+  array holds a reference to owner, the Python object owning input, so
+  input must stay unchanged for as long as owner is alive.
+*/
+template <class T>
+py::array_t<T> numpy_view(const std::vector<T>& input, py::handle owner) {
+    auto output = py::array_t<T>(input.size(), input.data(), owner);
+    py::detail::array_proxy(output.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+    return output;
+}
+
+// std::vector<bool> has no contiguous storage to point into.
+inline py::array_t<bool> numpy_view(const std::vector<bool>& input, py::handle) {
+    return numpy_array(input);
+}
+
 }
 
 #endif //SUNBEAM_CONVERTERS_HPP
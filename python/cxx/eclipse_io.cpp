@@ -2,7 +2,9 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 #include <pybind11/chrono.h>
+#include <algorithm>
 #include <filesystem>
+#include <mutex>
 #include <stdexcept>
 
 #include <opm/io/eclipse/EclFile.hpp>
@@ -28,6 +30,16 @@ namespace {
 using npArray = std::tuple<py::array, Opm::EclIO::eclArrType>;
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, int64_t>;
 
+/*
+  The Python object wrapping obj.  Arrays returned as views into data
+  owned by obj hold a reference to it, so obj outlives the arrays.
+*/
+template <class T>
+py::object owner(T * obj)
+{
+    return py::cast(obj, py::return_value_policy::reference);
+}
+
 class ESmryBind {
 
 public:
@@ -57,6 +69,8 @@ public:
         if (m_esmry == nullptr)
             throw std::invalid_argument("make_esmry_file only available for SMSPEC input files");
 
+        py::gil_scoped_release release;
+        std::lock_guard<std::mutex> guard(m_lock);
         m_esmry->make_esmry_file();
     }
 
@@ -68,20 +82,73 @@ public:
             return m_ext_esmry->numberOfTimeSteps();
     }
 
-    py::array get_smry_vector(const std::string& key)
+    // Vectors are loaded on first access.  The load runs without the GIL,
+    // serialized by m_lock as Python threads may share the object.
+    const std::vector<float>& get(const std::string& key)
     {
+        py::gil_scoped_release release;
+        std::lock_guard<std::mutex> guard(m_lock);
+
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return m_esmry->get(key);
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return m_ext_esmry->get(key);
+    }
+
+    py::array get_smry_vector(const std::string& key)
+    {
+        return convert::numpy_view( this->get(key), owner(this) );
+    }
+
+    // All vectors in keys as the rows of one array, loaded in a single
+    // pass over the summary files.
+    py::array get_smry_vectors(const std::vector<std::string>& keys)
+    {
+        for (const auto& key : keys)
+            if (!this->hasKey(key))
+                throw std::invalid_argument("summary key '" + key + "' not found");
+
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> guard(m_lock);
+
+            if (m_esmry != nullptr)
+                m_esmry->loadData(keys);
+            else
+                m_ext_esmry->loadData(keys);
+        }
+
+        const std::size_t nstep = this->numberOfTimeSteps();
+        const std::vector<py::ssize_t> shape = { static_cast<py::ssize_t>(keys.size()),
+                                                 static_cast<py::ssize_t>(nstep) };
+        py::array_t<float> output(shape);
+        float * output_ptr = output.mutable_data();
+
+        for (const auto& key : keys) {
+            const auto& data = this->get(key);
+            if (data.size() != nstep)
+                throw std::logic_error("summary vector '" + key + "' has unexpected length");
+
+            output_ptr = std::copy(data.begin(), data.end(), output_ptr);
+        }
+
+        return output;
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
     {
-        if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get_at_rstep(key) );
-        else
-            return convert::numpy_array( m_ext_esmry->get_at_rstep(key) );
+        std::vector<float> data;
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> guard(m_lock);
+
+            if (m_esmry != nullptr)
+                data = m_esmry->get_at_rstep(key);
+            else
+                data = m_ext_esmry->get_at_rstep(key);
+        }
+
+        return convert::numpy_array( std::move(data) );
     }
 
     time_point smry_start_date()
@@ -148,6 +215,7 @@ public:
 private:
     std::unique_ptr<Opm::EclIO::ESmry> m_esmry;
     std::unique_ptr<Opm::EclIO::ExtESmry> m_ext_esmry;
+    std::mutex m_lock;
 };
 
 
@@ -191,16 +259,16 @@ npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<bool>(array_index), owner(file_ptr)), array_type);
 
     if ((array_type == Opm::EclIO::CHAR) || (array_type == Opm::EclIO::C0NN))
         return std::make_tuple (convert::numpy_string_array( file_ptr->get<std::string>(array_index)), array_type);
@@ -262,16 +330,16 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
     auto array_type = std::get<1>(arrList[index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<bool>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRestartData<std::string>(index, rstep)), array_type);
@@ -358,7 +426,7 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
         }
     }
 
-    return convert::numpy_array( celvol );
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
@@ -377,19 +445,19 @@ npArray get_rft_vector_WellDate(Opm::EclIO::ERft * file_ptr,const std::string& n
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, well, y, m, d) ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<bool>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<bool>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     throw std::logic_error("Data type not supported");
 }
@@ -401,19 +469,19 @@ npArray get_rft_vector_Index(Opm::EclIO::ERft * file_ptr,const std::string& name
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, reportIndex), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, reportIndex), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, reportIndex), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, reportIndex) ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<bool>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<bool>(name, reportIndex), owner(file_ptr) ), array_type);
 
     throw std::logic_error("Data type not supported");
 }
@@ -448,7 +516,8 @@ void python::common::export_IO(py::module& m) {
         .export_values();
 
     py::class_<Opm::EclIO::EclFile>(m, "EclFile")
-        .def(py::init<const std::string &, bool>(), py::arg("filename"), py::arg("preload") = false)
+        .def(py::init<const std::string &, bool>(), py::arg("filename"), py::arg("preload") = false,
+             py::call_guard<py::gil_scoped_release>())
         .def_property_readonly("arrays", &Opm::EclIO::EclFile::getList)
         .def("__contains__", &Opm::EclIO::EclFile::hasKey)
         .def("__len__", &Opm::EclIO::EclFile::size)
@@ -458,7 +527,7 @@ void python::common::export_IO(py::module& m) {
         .def("__get_data", &get_vector_occurrence);
 
     py::class_<Opm::EclIO::ERst>(m, "ERst")
-        .def(py::init<const std::string &>())
+        .def(py::init<const std::string &>(), py::call_guard<py::gil_scoped_release>())
         .def("__has_report_step", &Opm::EclIO::ERst::hasReportStepNumber)
         .def("load_report_step", &Opm::EclIO::ERst::loadReportStepNumber)
         .def_property_readonly("report_steps", &Opm::EclIO::ERst::listOfReportStepNumbers)
@@ -473,12 +542,14 @@ void python::common::export_IO(py::module& m) {
         .def("__get_data", &get_erst_vector);
 
    py::class_<ESmryBind>(m, "ESmry")
-        .def(py::init<const std::string &, const bool>(), py::arg("filename"), py::arg("load_base_run") = false)
+        .def(py::init<const std::string &, const bool>(), py::arg("filename"), py::arg("load_base_run") = false,
+             py::call_guard<py::gil_scoped_release>())
         .def("__contains__", &ESmryBind::hasKey)
         .def("make_esmry_file", &ESmryBind::make_esmry_file)
         .def("__len__", &ESmryBind::numberOfTimeSteps)
         .def("__get_all", &ESmryBind::get_smry_vector)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps)
+        .def("get_many", &ESmryBind::get_smry_vectors, py::arg("keys"))
         .def_property_readonly("start_date", &ESmryBind::smry_start_date)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
             &ESmryBind::keywordList)
@@ -489,7 +560,7 @@ void python::common::export_IO(py::module& m) {
 
    py::class_<Opm::EclIO::EGrid>(m, "EGrid")
         .def(py::init<const std::string &, const std::string &>(), py::arg("filename"),
-             py::arg("grid_name") = "global")
+             py::arg("grid_name") = "global", py::call_guard<py::gil_scoped_release>())
         .def_property_readonly("active_cells", &Opm::EclIO::EGrid::activeCells)
         .def_property_readonly("dimension", &Opm::EclIO::EGrid::dimension)
         .def("ijk_from_global_index", &Opm::EclIO::EGrid::ijk_from_global_index)
@@ -505,7 +576,7 @@ void python::common::export_IO(py::module& m) {
         .def("cellvolumes", &get_cellvolumes_mask);
 
    py::class_<Opm::EclIO::ERft>(m, "ERft")
-        .def(py::init<const std::string &>())
+        .def(py::init<const std::string &>(), py::call_guard<py::gil_scoped_release>())
         .def_property_readonly("list_of_rfts", &Opm::EclIO::ERft::listOfRftReports)
 
         .def("__get_list_of_arrays", (std::vector< std::tuple<std::string, Opm::EclIO::eclArrType, int64_t> >
@@ -107,7 +107,7 @@ void python::common::export_EclipseState(py::module& module) {
     //   opm.simulators.BlackOilSimulator Python object
     //
     py::class_< EclipseState, std::shared_ptr<EclipseState> >( module, "EclipseState", EclipseStateClass_docstring)
-        .def(py::init<const Deck&>())
+        .def(py::init<const Deck&>(), py::call_guard<py::gil_scoped_release>())
         .def_property_readonly( "title", &EclipseState::getTitle )
         .def( "field_props",    &get_field_props, ref_internal)
         .def( "grid",           &EclipseState::getInputGrid, ref_internal)
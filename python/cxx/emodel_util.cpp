@@ -98,6 +98,15 @@ void python::common::export_EModel(py::module& m) {
         .def("set_report_step", &EModel::setReportStep)
         .def("reset_filter", &EModel::resetFilter)
         .def("get", &get_param)
+        .def("region_sum", [](EModel& self, const std::string& key, const std::string& region)
+             { return convert::numpy_array( self.getRegionSum(key, region) ); },
+             py::arg("key"), py::arg("region") = "FIPNUM")
+        .def("region_mean", [](EModel& self, const std::string& key, const std::string& region)
+             { return convert::numpy_array( self.getRegionMean(key, region) ); },
+             py::arg("key"), py::arg("region") = "FIPNUM")
+        .def("region_percentile", [](EModel& self, const std::string& key, double percentile, const std::string& region)
+             { return convert::numpy_array( self.getRegionPercentile(key, region, percentile) ); },
+             py::arg("key"), py::arg("percentile"), py::arg("region") = "FIPNUM")
         .def("__add_filter", &add_int_filter_1value)
         .def("__add_filter", &add_float_filter_1value)
         .def("__add_filter", &add_int_filter_2values)
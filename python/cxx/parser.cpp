@@ -44,8 +44,10 @@ namespace {
 
 void python::common::export_Parser(py::module& module) {
 
-    module.def( "create_deck", &create_deck );
-    module.def( "create_deck_string", &create_deck_string);
+    // Parsing only touches C++ objects; releasing the GIL lets Python
+    // threads parse several decks concurrently.
+    module.def( "create_deck", &create_deck, py::call_guard<py::gil_scoped_release>() );
+    module.def( "create_deck_string", &create_deck_string, py::call_guard<py::gil_scoped_release>() );
 
 
     py::class_<ParserKeyword>(module, "ParserKeyword")
@@ -63,12 +65,12 @@ void python::common::export_Parser(py::module& module) {
         .export_values();
 
     py::class_<Parser>(module, "Parser")
-        .def(py::init<bool>(), py::arg("add_default") = true)
-        .def("parse", py::overload_cast<const std::string&>(&Parser::parseFile, py::const_))
-        .def("parse"       , py::overload_cast<const std::string&, const ParseContext&>(&Parser::parseFile, py::const_))
-        .def("parse"       , py::overload_cast<const std::string&, const ParseContext&, const std::vector<Opm::Ecl::SectionType>&>(&Parser::parseFile, py::const_))
-        .def("parse_string", py::overload_cast<const std::string&>(&Parser::parseString, py::const_))
-        .def("parse_string", py::overload_cast<const std::string&, const ParseContext&>(&Parser::parseString, py::const_))
+        .def(py::init<bool>(), py::arg("add_default") = true, py::call_guard<py::gil_scoped_release>())
+        .def("parse", py::overload_cast<const std::string&>(&Parser::parseFile, py::const_), py::call_guard<py::gil_scoped_release>())
+        .def("parse"       , py::overload_cast<const std::string&, const ParseContext&>(&Parser::parseFile, py::const_), py::call_guard<py::gil_scoped_release>())
+        .def("parse"       , py::overload_cast<const std::string&, const ParseContext&, const std::vector<Opm::Ecl::SectionType>&>(&Parser::parseFile, py::const_), py::call_guard<py::gil_scoped_release>())
+        .def("parse_string", py::overload_cast<const std::string&>(&Parser::parseString, py::const_), py::call_guard<py::gil_scoped_release>())
+        .def("parse_string", py::overload_cast<const std::string&, const ParseContext&>(&Parser::parseString, py::const_), py::call_guard<py::gil_scoped_release>())
         .def("add_keyword",  py::overload_cast<ParserKeyword>(&Parser::addParserKeyword))
         .def("add_keyword", add_keyword)
         .def("__getitem__", &Parser::getKeyword, ref_internal);
@@ -207,7 +207,7 @@ void python::common::export_Schedule(py::module& module) {
     //   opm.simulators.BlackOilSimulator Python object
     //
     py::class_< Schedule, std::shared_ptr<Schedule> >( module, "Schedule", ScheduleClass_docstring)
-    .def(py::init<const Deck&, const EclipseState& >(), py::arg("deck"), py::arg("eclipse_state"))
+    .def(py::init<const Deck&, const EclipseState& >(), py::arg("deck"), py::arg("eclipse_state"), py::call_guard<py::gil_scoped_release>())
     .def("_groups", &get_groups, py::arg("report_step"), Schedule_groups_docstring)
     .def_property_readonly( "start",  &get_start_time )
     .def_property_readonly( "end",    &get_end_time )
@@ -46,9 +46,15 @@ void python::common::export_SummaryState(py::module& module) {
 
     using namespace Opm::Common::DocStrings;
 
-    py::class_<SummaryState, std::shared_ptr<SummaryState>>(module, "SummaryState", SummaryStateClass_docstring)
+    py::class_<SummaryState, std::shared_ptr<SummaryState>> summary_state(module, "SummaryState", SummaryStateClass_docstring);
+
+    py::class_<SummaryState::Slot>(summary_state, "Slot", SummaryState_Slot_docstring)
+        .def("__eq__", &SummaryState::Slot::operator==)
+        ;
+
+    summary_state
         .def(py::init<std::time_t>())
-        .def("update", &SummaryState::update)
+        .def("update", py::overload_cast<const std::string&, double>(&SummaryState::update))
         .def("update_well_var", &SummaryState::update_well_var, py::arg("well_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_well_var_docstring)
         .def("update_group_var", &SummaryState::update_group_var, py::arg("group_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_group_var_docstring)
         .def("well_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::get_well_var, py::const_), py::arg("well_name"), py::arg("variable_name"), SummaryState_well_var_docstring)
@@ -61,5 +67,10 @@ void python::common::export_SummaryState(py::module& module) {
         .def("has_group_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::has_group_var, py::const_), py::arg("group_name"), py::arg("variable_name"), SummaryState_has_group_var_docstring)
         .def("__setitem__", &SummaryState::set)
         .def("__getitem__", py::overload_cast<const std::string&>(&SummaryState::get, py::const_))
+        .def("slot", &SummaryState::slot, py::arg("key"), SummaryState_slot_docstring)
+        .def("well_slot", &SummaryState::well_slot, py::arg("well_name"), py::arg("variable_name"), SummaryState_well_slot_docstring)
+        .def("group_slot", &SummaryState::group_slot, py::arg("group_name"), py::arg("variable_name"), SummaryState_group_slot_docstring)
+        .def("get_slot", py::overload_cast<SummaryState::Slot>(&SummaryState::get, py::const_), py::arg("slot"), SummaryState_get_slot_docstring)
+        .def("update_slot", py::overload_cast<SummaryState::Slot, double>(&SummaryState::update), py::arg("slot"), py::arg("new_value"), SummaryState_update_slot_docstring)
         ;
 }
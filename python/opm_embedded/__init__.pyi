@@ -2742,14 +2742,21 @@ class SummaryConfig:
     def __contains__(self, arg0: str) -> bool: ...
 
 class SummaryState:
+    class Slot:
+        def __eq__(self, arg0: SummaryState.Slot) -> bool: ...
     def __init__(self, arg0: int) -> None: ...
     def elapsed(self) -> float: ...
+    def get_slot(self, slot: SummaryState.Slot) -> float: ...
+    def group_slot(self, group_name: str, variable_name: str) -> SummaryState.Slot: ...
     def group_var(self, group_name: str, variable_name: str) -> float: ...
     def has_group_var(self, group_name: str, variable_name: str) -> bool: ...
     def has_well_var(self, well_name: str, variable_name: str) -> bool: ...
+    def slot(self, key: str) -> SummaryState.Slot: ...
     def update(self, arg0: str, arg1: float) -> None: ...
     def update_group_var(self, group_name: str, variable_name: str, new_value: float) -> None: ...
+    def update_slot(self, slot: SummaryState.Slot, new_value: float) -> None: ...
     def update_well_var(self, well_name: str, variable_name: str, new_value: float) -> None: ...
+    def well_slot(self, well_name: str, variable_name: str) -> SummaryState.Slot: ...
     def well_var(self, well_name: str, variable_name: str) -> float: ...
     def __contains__(self, arg0: str) -> bool: ...
     def __getitem__(self, arg0: str) -> float: ...
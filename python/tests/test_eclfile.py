@@ -122,6 +122,25 @@ class TestEclFile(unittest.TestCase):
             self.assertEqual(refTabdims[i], tabdims[i])
 
 
+    def test_get_function_view(self):
+
+        file1 = EclFile(test_path("data/SPE9.INIT"))
+        porv_index = array_index(file1, "PORV")[0]
+
+        porv1 = file1[porv_index]
+        porv2 = file1[porv_index]
+
+        self.assertFalse(porv1.flags.writeable)
+        self.assertTrue(np.shares_memory(porv1, porv2))
+
+        with self.assertRaises(ValueError):
+            porv1[0] = 0.0
+
+        ref = porv1.copy()
+        del file1
+        self.assertTrue(np.array_equal(porv2, ref))
+
+
     def test_get_function_logi(self):
 
         file1 = EclFile(test_path("data/9_EDITNNC.INIT"))
@@ -177,6 +177,34 @@ class TestEModel(unittest.TestCase):
 
         ivect = mod1.get("I")
 
+    def test_region_reductions(self):
+
+        mod1 = EModel(test_path("data/9_EDITNNC.INIT"))
+        mod1.add_filter("DEPTH","lt", 2665.0);
+
+        porv = mod1.get("PORV")
+        eqlnum = mod1.get("EQLNUM")
+
+        porv_sum = mod1.region_sum("PORV", "EQLNUM")
+        porv_mean = mod1.region_mean("PORV", "EQLNUM")
+        porv_p90 = mod1.region_percentile("PORV", 90, "EQLNUM")
+
+        self.assertEqual(len(porv_sum), max(eqlnum))
+
+        for r in range(len(porv_sum)):
+            region_porv = porv[eqlnum == r + 1].astype(np.float64)
+            self.assertAlmostEqual(porv_sum[r] / region_porv.sum(), 1.0, places = 10)
+            self.assertAlmostEqual(porv_mean[r] / region_porv.mean(), 1.0, places = 10)
+            self.assertAlmostEqual(porv_p90[r] / np.percentile(region_porv, 90), 1.0, places = 10)
+
+        k_median = mod1.region_percentile("K", 50, "EQLNUM")
+        k = mod1.get("K")
+        self.assertEqual(k_median[0], np.percentile(k[eqlnum == 1], 50))
+
+        with self.assertRaises(ValueError):
+            mod1.region_percentile("PORV", 101, "EQLNUM")
+
+
 
 if __name__ == "__main__":
 
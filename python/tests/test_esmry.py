@@ -214,6 +214,34 @@ class TestEclFile(unittest.TestCase):
             self.assertEqual(key, ref)
 
 
+    def test_views(self):
+
+        smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+        smry1.make_esmry_file()
+
+        for smry in [smry1, ESmry(test_path("data/SPE1CASE1.ESMRY"))]:
+            fopr = smry["FOPR"]
+            self.assertFalse(fopr.flags.writeable)
+            with self.assertRaises(ValueError):
+                fopr[0] = 0.0
+
+            keys = ["TIME", "FOPR", "WBHP:PROD"]
+            data = smry.get_many(keys)
+            self.assertEqual(data.shape, (len(keys), len(smry)))
+            self.assertEqual(data.dtype, "float32")
+
+            for row, key in zip(data, keys):
+                self.assertTrue(np.array_equal(row, smry[key]))
+
+            with self.assertRaises(ValueError):
+                smry.get_many(["TIME", "XXX"])
+
+        # The view keeps the summary data alive.
+        time = smry1["TIME"]
+        del smry1
+        self.assertEqual(time[0], 1.0)
+
+
 
 if __name__ == "__main__":
 
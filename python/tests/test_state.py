@@ -1,4 +1,5 @@
 import unittest
+from concurrent.futures import ThreadPoolExecutor
 
 from opm.io.parser import Parser
 
@@ -78,6 +79,21 @@ SATNUM
         self.assertFalse(init.restartRequested())
         self.assertEqual(0, init.getRestartStep())
 
+    def test_concurrent_load(self):
+        # The GIL is released while parsing and building the states, so
+        # several decks can be loaded by a thread pool at once.
+        def load(fname):
+            deck = Parser().parse(test_path(fname))
+            state = EclipseState(deck)
+            schedule = Schedule(deck, state)
+            return state.grid().nactive, len(schedule)
+
+        files = ['spe3/SPE3CASE1.DATA'] * 8
+        with ThreadPoolExecutor(max_workers = 4) as executor:
+            results = list(executor.map(load, files))
+
+        self.assertEqual(results, [load(files[0])] * len(files))
+
     def test_repr_title(self):
         self.assertEqual('SPE 3 - CASE 1', self.state.title)
 
@@ -44,3 +44,18 @@ class TestSummaryState(unittest.TestCase):
         self.assertTrue( "OP3" in wells )
 
         el = st.elapsed()
+
+    def test_slots(self):
+        st = opm.io.sim.SummaryState(int(datetime.datetime.now().timestamp()))
+        st.update_well_var("OP1", "WOPR", 100)
+
+        wopr = st.well_slot("OP1", "WOPR")
+        self.assertEqual(st.get_slot(wopr), 100)
+        self.assertEqual(wopr, st.slot("WOPR:OP1"))
+
+        st.update_slot(wopr, 50)
+        self.assertEqual(st.well_var("OP1", "WOPR"), 50)
+
+        gopr = st.group_slot("G1", "GOPR")
+        self.assertTrue(st.has_group_var("G1", "GOPR"))
+        self.assertEqual(st.get_slot(gopr), 0)
@@ -0,0 +1,376 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EclFileConverter.hpp"
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+    using Array = std::variant<std::monostate,
+                               std::vector<int>,
+                               std::vector<float>,
+                               std::vector<double>,
+                               std::vector<bool>,
+                               std::vector<std::string>>;
+
+    /// Consecutive arrays [begin, end) of the input file.
+    struct Chunk
+    {
+        int begin{0};
+        int end{0};
+    };
+
+    template <typename T>
+    std::vector<T> take(std::unordered_map<int, std::vector<T>>& cache, const int arrIndex)
+    {
+        auto pos = cache.find(arrIndex);
+        if (pos == cache.end()) {
+            return {};
+        }
+
+        auto data = std::move(pos->second);
+        cache.erase(pos);
+
+        return data;
+    }
+
+} // Anonymous namespace
+
+/// EclFile which hands over its decoded arrays rather than caching them.
+class EclFileConverter::Reader : public Opm::EclIO::EclFile
+{
+public:
+    explicit Reader(const std::string& filename)
+        : EclFile(filename)
+    {}
+
+    /// Reader of the same file sharing the already scanned directory.
+    static std::unique_ptr<Reader> clone(const Reader& directory)
+    {
+        auto reader = std::unique_ptr<Reader>(new Reader(directory.inputFilename, DeferredLoad{}));
+
+        reader->setArrayList(directory.array_name, directory.array_type,
+                             directory.array_size, directory.array_element_size,
+                             directory.ifStreamPos);
+
+        reader->compressed_words = directory.compressed_words;
+
+        return reader;
+    }
+
+    int numArrays() const
+    {
+        return static_cast<int>(this->array_name.size());
+    }
+
+    const std::string& name(const int arrIndex) const
+    {
+        return this->array_name[arrIndex];
+    }
+
+    Opm::EclIO::eclArrType type(const int arrIndex) const
+    {
+        return this->array_type[arrIndex];
+    }
+
+    int elementSize(const int arrIndex) const
+    {
+        return this->array_element_size[arrIndex];
+    }
+
+    /// Size, in bytes of input, of arrays [begin, end).
+    std::uint64_t bytes(const int begin, const int end) const
+    {
+        return this->ifStreamPos[end] - this->ifStreamPos[begin];
+    }
+
+    std::vector<Array> read(const Chunk& chunk)
+    {
+        if (this->formatted) {
+            // Single pass through the file for the entire chunk.
+            auto arrIndex = std::vector<int>(chunk.end - chunk.begin);
+            std::iota(arrIndex.begin(), arrIndex.end(), chunk.begin);
+            this->loadData(arrIndex);
+        }
+
+        auto arrays = std::vector<Array>{};
+        arrays.reserve(chunk.end - chunk.begin);
+        for (auto arrIndex = chunk.begin; arrIndex < chunk.end; ++arrIndex) {
+            arrays.push_back(this->read(arrIndex));
+        }
+
+        return arrays;
+    }
+
+private:
+    Reader(const std::string& filename, DeferredLoad tag)
+        : EclFile(filename, tag)
+    {}
+
+    Array read(const int arrIndex)
+    {
+        using namespace Opm::EclIO;
+
+        // Numeric arrays of binary files are decoded straight from a
+        // memory mapping of the file, everything else through the cache.
+        const auto binary = !this->formatted;
+
+        // Compressed arrays (OPM extension) are decoded through the cache.
+        if (binary && (this->compressed_words.count(arrIndex) > 0)) {
+            this->loadData(arrIndex);
+            if (this->array_type[arrIndex] == REAL) {
+                return take(this->real_array, arrIndex);
+            }
+
+            return take(this->doub_array, arrIndex);
+        }
+
+        switch (this->array_type[arrIndex]) {
+        case INTE:
+            return binary ? this->getView<int>(arrIndex).toVector()
+                          : take(this->inte_array, arrIndex);
+        case REAL:
+            return binary ? this->getView<float>(arrIndex).toVector()
+                          : take(this->real_array, arrIndex);
+        case DOUB:
+            return binary ? this->getView<double>(arrIndex).toVector()
+                          : take(this->doub_array, arrIndex);
+        case LOGI:
+            return binary ? this->getView<bool>(arrIndex).toVector()
+                          : take(this->logi_array, arrIndex);
+        case CHAR:
+        case C0NN:
+            if (binary) {
+                this->loadData(arrIndex);
+            }
+            return take(this->char_array, arrIndex);
+        default:
+            return std::monostate{};
+        }
+    }
+};
+
+EclFileConverter::EclFileConverter(const std::string& inputFile)
+    : EclFileConverter(inputFile, Options{})
+{}
+
+EclFileConverter::EclFileConverter(const std::string& inputFile, const Options& options)
+    : directory_{ std::make_unique<Reader>(inputFile) }
+    , options_  { options }
+{
+    if (this->options_.numWorkers == 0) {
+        this->options_.numWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    if (this->options_.maxPending == 0) {
+        this->options_.maxPending = 2 * this->options_.numWorkers;
+    }
+}
+
+EclFileConverter::~EclFileConverter() = default;
+
+bool EclFileConverter::formattedInput() const
+{
+    return this->directory_->formattedInput();
+}
+
+bool EclFileConverter::is_ix() const
+{
+    return this->directory_->is_ix();
+}
+
+void EclFileConverter::write(const std::string& outputFile, const bool formattedOutput) const
+{
+    const auto& dir = *this->directory_;
+
+    auto chunks = std::vector<Chunk>{};
+    for (auto begin = 0; begin < dir.numArrays(); ) {
+        auto end = begin + 1;
+        while ((end < dir.numArrays()) && (dir.bytes(begin, end) < this->options_.chunkSize)) {
+            ++end;
+        }
+
+        chunks.push_back({ begin, end });
+        begin = end;
+    }
+
+    const auto numChunks = chunks.size();
+
+    // Decoded chunks not yet written, keyed by chunk index.  Workers claim
+    // chunks in order but never more than maxPending ahead of the writer.
+    std::mutex mutex;
+    std::condition_variable decoded;
+    std::condition_variable written;
+    std::map<std::size_t, std::vector<Array>> ready;
+    std::size_t nextClaim = 0;
+    std::size_t nextWrite = 0;
+    std::exception_ptr failure;
+
+    auto work = [&]()
+    {
+        try {
+            auto reader = Reader::clone(dir);
+
+            while (true) {
+                auto chunkIx = std::size_t{0};
+                {
+                    std::unique_lock lock { mutex };
+                    written.wait(lock, [&]() {
+                        return failure || (nextClaim >= numChunks) ||
+                            (nextClaim < nextWrite + this->options_.maxPending);
+                    });
+
+                    if (failure || (nextClaim >= numChunks)) {
+                        return;
+                    }
+
+                    chunkIx = nextClaim++;
+                }
+
+                auto arrays = reader->read(chunks[chunkIx]);
+
+                {
+                    std::lock_guard lock { mutex };
+                    ready.emplace(chunkIx, std::move(arrays));
+                }
+
+                decoded.notify_all();
+            }
+        }
+        catch (...) {
+            {
+                std::lock_guard lock { mutex };
+                if (! failure) {
+                    failure = std::current_exception();
+                }
+            }
+
+            decoded.notify_all();
+            written.notify_all();
+        }
+    };
+
+    const auto numWorkers = std::min(this->options_.numWorkers, std::max(numChunks, std::size_t{1}));
+
+    auto workers = std::vector<std::thread>{};
+    workers.reserve(numWorkers);
+    for (auto i = 0*numWorkers; i < numWorkers; ++i) {
+        workers.emplace_back(work);
+    }
+
+    auto stop = [&]()
+    {
+        {
+            std::lock_guard lock { mutex };
+            if (! failure) {
+                failure = std::make_exception_ptr(std::runtime_error { "Conversion aborted" });
+            }
+        }
+
+        written.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+
+    try {
+        Opm::EclIO::EclOutput outFile(outputFile, formattedOutput);
+        if (this->options_.ix || dir.is_ix()) {
+            outFile.set_ix();
+        }
+
+        // Formatting and stream output on a dedicated thread.
+        outFile.enableAsync();
+
+        for (; nextWrite < numChunks; ) {
+            auto arrays = std::vector<Array>{};
+            {
+                std::unique_lock lock { mutex };
+                decoded.wait(lock, [&]() {
+                    return failure || (ready.count(nextWrite) > 0);
+                });
+
+                if (failure) {
+                    std::rethrow_exception(failure);
+                }
+
+                auto pos = ready.find(nextWrite);
+                arrays = std::move(pos->second);
+                ready.erase(pos);
+            }
+
+            const auto& chunk = chunks[nextWrite];
+            for (auto arrIndex = chunk.begin; arrIndex < chunk.end; ++arrIndex) {
+                const auto& name = dir.name(arrIndex);
+                auto& data = arrays[arrIndex - chunk.begin];
+
+                if (dir.type(arrIndex) == Opm::EclIO::C0NN) {
+                    outFile.write(name, std::get<std::vector<std::string>>(data),
+                                  dir.elementSize(arrIndex));
+                }
+                else if (dir.type(arrIndex) == Opm::EclIO::MESS) {
+                    outFile.message(name);
+                }
+                else {
+                    std::visit([&outFile, &name](auto& values)
+                    {
+                        if constexpr (! std::is_same_v<std::decay_t<decltype(values)>, std::monostate>) {
+                            outFile.write(name, std::move(values));
+                        }
+                    }, data);
+                }
+            }
+
+            {
+                std::lock_guard lock { mutex };
+                ++nextWrite;
+            }
+
+            written.notify_all();
+        }
+
+        outFile.flushStream();
+    }
+    catch (...) {
+        stop();
+        throw;
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
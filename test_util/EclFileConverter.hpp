@@ -0,0 +1,77 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ECLFILECONVERTER_HPP
+#define ECLFILECONVERTER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/// Copy all arrays of an ECL file to a new file, optionally switching
+/// between formatted and binary representation.
+///
+/// The input is split into chunks of consecutive arrays.  A pool of
+/// worker threads reads and decodes the chunks, each through its own
+/// stream, while the calling thread hands the decoded arrays to the output
+/// file in their original order.  At most a fixed number of chunks are
+/// decoded ahead of the writer, so the memory use is bounded by the chunk
+/// size rather than by the size of the file.
+class EclFileConverter
+{
+public:
+    struct Options
+    {
+        /// Number of decoding threads.  Zero selects the number of
+        /// hardware threads.
+        std::size_t numWorkers{0};
+
+        /// Target size, in bytes of input, of each chunk.  A chunk holds
+        /// at least one array.
+        std::size_t chunkSize{std::size_t{64} << 20};
+
+        /// Maximum number of decoded chunks waiting to be written.  Zero
+        /// selects twice the number of workers.
+        std::size_t maxPending{0};
+
+        /// Enforce IX standard on the output file.
+        bool ix{false};
+    };
+
+    /// Scan the array directory of \p inputFile.
+    explicit EclFileConverter(const std::string& inputFile);
+    EclFileConverter(const std::string& inputFile, const Options& options);
+
+    ~EclFileConverter();
+
+    bool formattedInput() const;
+    bool is_ix() const;
+
+    /// Write all arrays to \p outputFile.  Rethrows the first error
+    /// raised by a worker thread.
+    void write(const std::string& outputFile, bool formattedOutput) const;
+
+private:
+    class Reader;
+
+    std::unique_ptr<Reader> directory_;
+    Options options_{};
+};
+
+#endif // ECLFILECONVERTER_HPP
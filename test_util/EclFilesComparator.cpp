@@ -43,6 +43,58 @@
 
 using Opm::EclIO::EGrid;
 
+thread_local ECLFilesComparator::TaskReport* ECLFilesComparator::activeReport = nullptr;
+
+std::ostream& ECLFilesComparator::TaskReport::select(const int stream)
+{
+    if (stream != this->current) {
+        this->segments.emplace_back(this->current, this->buffer.str());
+        this->buffer.str("");
+        this->current = stream;
+    }
+
+    return this->buffer;
+}
+
+void ECLFilesComparator::TaskReport::replay(std::ostream& os_out, std::ostream& os_err)
+{
+    this->segments.emplace_back(this->current, this->buffer.str());
+    this->buffer.str("");
+
+    for (const auto& [stream, text] : this->segments) {
+        (stream == 0 ? os_out : os_err) << text << std::flush;
+    }
+
+    this->segments.clear();
+}
+
+void ECLFilesComparator::TaskReport::replay(TaskReport& dest)
+{
+    this->segments.emplace_back(this->current, this->buffer.str());
+    this->buffer.str("");
+
+    for (const auto& [stream, text] : this->segments) {
+        dest.select(stream) << text;
+    }
+
+    this->segments.clear();
+}
+
+std::ostream& ECLFilesComparator::out() const
+{
+    return (activeReport != nullptr) ? activeReport->out() : std::cout;
+}
+
+std::ostream& ECLFilesComparator::err() const
+{
+    return (activeReport != nullptr) ? activeReport->err() : std::cerr;
+}
+
+size_t& ECLFilesComparator::errorCount() const
+{
+    return (activeReport != nullptr) ? activeReport->num_errors : num_errors;
+}
+
 template <typename T>
 void ECLFilesComparator::
 printValuesForCell(const std::string& keyword,
@@ -61,11 +113,11 @@ printValuesForCell(const std::string& keyword,
 
             ijk[0]++, ijk[1]++, ijk[2]++;
 
-            std::cout << std::endl
-                      << "\nKeyword: " << keyword << ", origin "  << reference << "\n"
-                      << "Global index (zero based)   = "  << cell << "\n"
-                      << "Grid coordinate             = (" << ijk[0] << ", " << ijk[1] << ", " << ijk[2] << ")" << "\n"
-                      << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
+            out() << std::endl
+                  << "\nKeyword: " << keyword << ", origin "  << reference << "\n"
+                  << "Global index (zero based)   = "  << cell << "\n"
+                  << "Grid coordinate             = (" << ijk[0] << ", " << ijk[1] << ", " << ijk[2] << ")" << "\n"
+                  << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
             return;
         }
 
@@ -75,19 +127,19 @@ printValuesForCell(const std::string& keyword,
 
             ijk[0]++, ijk[1]++, ijk[2]++;
 
-            std::cout << std::endl
-                      << "\nKeyword: " << keyword << ", origin "  << reference << "\n\n"
-                      << "Global index (zero based)   = "  << cell << "\n"
-                      << "Grid coordinate             = (" << ijk[0] << ", " << ijk[1] << ", " << ijk[2] << ")" << "\n"
-                      << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
+            out() << std::endl
+                  << "\nKeyword: " << keyword << ", origin "  << reference << "\n\n"
+                  << "Global index (zero based)   = "  << cell << "\n"
+                  << "Grid coordinate             = (" << ijk[0] << ", " << ijk[1] << ", " << ijk[2] << ")" << "\n"
+                  << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
             return;
         }
     }
 
-    std::cout << std::endl
-              << "\nKeyword: " << keyword << ", origin "  << reference << "\n\n"
-              << "Value index                 = "  << cell << "\n"
-              << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
+    out() << std::endl
+          << "\nKeyword: " << keyword << ", origin "  << reference << "\n\n"
+          << "Value index                 = "  << cell << "\n"
+          << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
 }
 
 #define INSTANTIATE_PRINTCELL(T) \
@@ -22,9 +22,13 @@
 
 #include "Deviation.hpp"
 
+#include <atomic>
+#include <exception>
 #include <map>
+#include <sstream>
 #include <stddef.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -69,6 +73,48 @@ public:
     static double average(const std::vector<double>& vec);
 
 protected:
+    //! \brief Report output, deviations and error count of a single comparison task.
+    //! \details Used when keywords are compared concurrently.  Text written through
+    //!          out() and err() while a task report is active on the calling thread is
+    //!          buffered, and replayed in task order once the task is complete, so the
+    //!          final report is identical to that of a sequential comparison.
+    class TaskReport {
+    public:
+        std::ostream& out() { return select(0); }
+        std::ostream& err() { return select(1); }
+
+        //! \brief Write buffered text to \p os_out and \p os_err, preserving the order of output.
+        void replay(std::ostream& os_out, std::ostream& os_err);
+
+        //! \brief Write buffered text to another task report.
+        void replay(TaskReport& dest);
+
+        //! \brief Whether the task's result will be discarded, e.g., due to an earlier failure.
+        bool stopped() const { return (stop != nullptr) && stop->load(); }
+
+        std::map<std::string, std::vector<Deviation>> deviations;
+        size_t num_errors = 0;
+        std::exception_ptr error{};
+        const std::atomic<bool>* stop = nullptr;
+
+    private:
+        std::ostream& select(int stream);
+
+        std::ostringstream buffer;
+        int current = 0;
+        std::vector<std::pair<int, std::string>> segments;
+    };
+
+    //! \brief Task report receiving output on the calling thread, nullptr if none.
+    static thread_local TaskReport* activeReport;
+
+    //! \brief Stream for comparison reports, std::cout unless a task report is active.
+    std::ostream& out() const;
+    //! \brief Stream for error messages, std::cerr unless a task report is active.
+    std::ostream& err() const;
+    //! \brief Error counter, that of the task report if one is active.
+    size_t& errorCount() const;
+
     bool throwOnError = true; //!< Throw on first error
     bool analysis = false; //!< Perform full error analysis
     std::map<std::string, std::vector<Deviation>> deviations;
@@ -20,6 +20,7 @@
 
 #include <fmt/format.h>
 
+#include <opm/io/eclipse/EclArrayView.hpp>
 #include <opm/io/eclipse/EGrid.hpp>
 #include <opm/io/eclipse/ERft.hpp>
 #include <opm/io/eclipse/ERst.hpp>
@@ -34,12 +35,15 @@
 #include <opm/common/utility/numeric/cmp.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <set>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_set>
 #include <vector>
@@ -50,8 +54,8 @@
     if (throwOnError) \
       OPM_THROW(type, message); \
     else { \
-      std::cerr << message << std::endl; \
-      ++num_errors; \
+      err() << message << std::endl; \
+      ++errorCount(); \
     } \
   }
 
@@ -63,6 +67,19 @@ std::vector<T> sorted(std::vector<T> v) {
     return v;
 }
 
+// Copy of array data.  Serialised as the array caches of EclFile and
+// ERst do not support concurrent updates.
+template <typename Fetch>
+auto loadSerialised(Fetch&& fetch)
+{
+    std::decay_t<decltype(fetch())> data;
+
+#pragma omp critical(compare_ecl_load)
+    data = fetch();
+
+    return data;
+}
+
 }
 
 using namespace Opm::EclIO;
@@ -203,12 +220,13 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
     if (dev.abs > absToleranceLoc && (dev.rel > relToleranceLoc || dev.rel == -1)) {
         if (analysis) {
             std::string keywref = keyword + ": " + reference;
-            deviations[keywref].push_back(dev);
+            auto& devs = (activeReport != nullptr) ? activeReport->deviations : deviations;
+            devs[keywref].push_back(dev);
         } else {
             printValuesForCell(keyword, reference, kw_size, cell, grid1, val1, val2);
 
             if (useStrictTol) {
-                std::cout << "Keyword: " << keyword << " requires strict tolerances.\n" << std::endl;
+                out() << "Keyword: " << keyword << " requires strict tolerances.\n" << std::endl;
             }
 
             HANDLE_ERROR(std::runtime_error,
@@ -222,6 +240,12 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
         }
     }
 
+    // Not collected in streaming mode, where they would otherwise hold
+    // a value for every array element compared.
+    if (activeReport != nullptr) {
+        return;
+    }
+
     if (dev.abs != -1) {
         absDeviation.push_back(dev.abs);
     }
@@ -232,15 +256,105 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
 }
 
 
-void ECLRegressionTest::printDeviationReport()
+template <typename T>
+void ECLRegressionTest::compareFloatingPointViews(const EclArrayView<T>& view1,
+                                                  const EclArrayView<T>& view2,
+                                                  const std::string& keyword,
+                                                  const std::string& reference)
+{
+    if (view1.size() != view2.size()) {
+        HANDLE_ERROR(std::runtime_error,
+                     fmt::format("\nError trying to compare two vectors "
+                                 "with different size {} - {}"
+                                 "\n > size of first vector : {}"
+                                 "\n > size of second vector: {}",
+                                 keyword, reference, view1.size(), view2.size()));
+    }
+
+    auto it = std::find(keywordDisallowNegatives.begin(), keywordDisallowNegatives.end(), keyword);
+    bool allowNegatives = it == keywordDisallowNegatives.end() ? true : false;
+
+    it = std::find(keywordsStrictTol.begin(), keywordsStrictTol.end(), keyword);
+    bool strictTol = it != keywordsStrictTol.end() ? true : false;
+
+    const auto size = std::min(view1.size(), view2.size());
+
+    std::vector<T> chunk1, chunk2;
+
+    for (std::int64_t first = 0; first < size; first += streamChunkSize) {
+        if ((activeReport != nullptr) && activeReport->stopped()) {
+            return;
+        }
+
+        const auto count = std::min(streamChunkSize, size - first);
+
+        chunk1.resize(count);
+        chunk2.resize(count);
+        view1.copy(first, count, chunk1.data());
+        view2.copy(first, count, chunk2.data());
+
+        for (std::int64_t i = 0; i < count; i++) {
+            deviationsForCell(static_cast<double>(chunk1[i]),
+                              static_cast<double>(chunk2[i]),
+                              keyword, reference, view1.size(),
+                              first + i, allowNegatives, strictTol);
+        }
+    }
+}
+
+
+template <typename T>
+void ECLRegressionTest::compareViews(const EclArrayView<T>& view1,
+                                     const EclArrayView<T>& view2,
+                                     const std::string& keyword,
+                                     const std::string& reference)
+{
+    if (view1.size() != view2.size()) {
+        HANDLE_ERROR(std::runtime_error,
+                     fmt::format("\nError trying to compare two vectors "
+                                 "with different size {} - {}"
+                                 "\n > size of first vector : {}"
+                                 "\n > size of second vector: {}",
+                                 keyword, reference, view1.size(), view2.size()));
+    }
+
+    const auto size = std::min(view1.size(), view2.size());
+
+    std::vector<T> chunk1, chunk2;
+
+    for (std::int64_t first = 0; first < size; first += streamChunkSize) {
+        if ((activeReport != nullptr) && activeReport->stopped()) {
+            return;
+        }
+
+        const auto count = std::min(streamChunkSize, size - first);
+
+        chunk1.resize(count);
+        chunk2.resize(count);
+        view1.copy(first, count, chunk1.data());
+        view2.copy(first, count, chunk2.data());
+
+        if (chunk1 == chunk2) {
+            continue;
+        }
+
+        for (std::int64_t i = 0; i < count; i++) {
+            deviationsForNonFloatingPoints(chunk1[i], chunk2[i], keyword, reference,
+                                           view1.size(), first + i);
+        }
+    }
+}
+
+
+void ECLRegressionTest::printDeviationReport() const
 {
     if (analysis) {
-        std::cout << " \n" << deviations.size() << " keyword"
-                  << (deviations.size() > 1 ? "s":"") << " exhibit failures" << std::endl;
+        out() << " \n" << deviations.size() << " keyword"
+              << (deviations.size() > 1 ? "s":"") << " exhibit failures" << std::endl;
         for (const auto& iter : deviations) {
-            std::cout << "\t" << iter.first << std::endl;
-            std::cout << "\t\tFails for " << iter.second.size() << " entries" << std::endl;
-            std::cout.precision(7);
+            out() << "\t" << iter.first << std::endl;
+            out() << "\t\tFails for " << iter.second.size() << " entries" << std::endl;
+            out().precision(7);
             double absErr = std::max_element(iter.second.begin(), iter.second.end(),
                                              [](const Deviation& a, const Deviation& b)
             {
@@ -251,10 +365,10 @@ void ECLRegressionTest::printDeviationReport()
             {
                 return a.rel < b.rel;
             })->rel;
-            std::cout << "\t\tLargest absolute error: "
-                      <<  std::scientific << absErr << std::endl;
-            std::cout << "\t\tLargest relative error: "
-                      <<  std::scientific << relErr << std::endl;
+            out() << "\t\tLargest absolute error: "
+                  <<  std::scientific << absErr << std::endl;
+            out() << "\t\tLargest relative error: "
+                  <<  std::scientific << relErr << std::endl;
         }
     }
 }
@@ -264,7 +378,7 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
 
     if (!(acceptExtraKeywords or acceptExtraKeywordsBoth)) {
         if (keywords1 != keywords2) {
-            std::cout << "not same keywords in " << reference << std::endl;
+            out() << "not same keywords in " << reference << std::endl;
 
             if (keywords1.size() > 50) {
                 printMissingKeywords(keywords1,keywords2);
@@ -280,7 +394,7 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
             auto it1 = std::find(keywords2.begin(), keywords2.end(), keyword);
             if (it1 == keywords2.end()) {
                 extraKeywordsFirstFile++;
-                std::cout << "Keyword " << keyword << " missing in second file " << std::endl;
+                out() << "Keyword " << keyword << " missing in second file " << std::endl;
 
                 if (keywords1.size() > 50) {
                     printMissingKeywords(keywords1, keywords2);
@@ -295,14 +409,14 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
         }
 
         if (keywords2.size() > keywords1.size() - extraKeywordsFirstFile) {
-            std::cout << "\nExtra keywords ("
-                      << std::to_string(keywords2.size() - keywords1.size() + extraKeywordsFirstFile)
-                      << ") accepted in second file " << std::endl;
+            out() << "\nExtra keywords ("
+                  << std::to_string(keywords2.size() - keywords1.size() + extraKeywordsFirstFile)
+                  << ") accepted in second file " << std::endl;
         }
         if (extraKeywordsFirstFile > 0) {
-            std::cout << "\nExtra keywords ("
-                      << extraKeywordsFirstFile
-                      << ") accepted in first file " << std::endl;
+            out() << "\nExtra keywords ("
+                  << extraKeywordsFirstFile
+                  << ") accepted in first file " << std::endl;
         }
     }
 }
@@ -322,7 +436,7 @@ void ECLRegressionTest::checkSpecificKeyword(std::vector<std::string>& keywords1
             fmt::format("Testing specific keyword \"{}\" in {}. "
                         "Keyword not found in any of the cases.",
                         specificKeyword, reference);
-        std::cout << msg << std::endl;
+        out() << msg << std::endl;
         OPM_THROW(std::runtime_error, "\n" + msg);
     }
 
@@ -335,7 +449,7 @@ void ECLRegressionTest::checkSpecificKeyword(std::vector<std::string>& keywords1
                 fmt::format("Testing specific keyword in {}. "
                             "Keyword found in first case but "
                             "not in second case.", reference);
-            std::cout << msg << std::endl;
+            out() << msg << std::endl;
             OPM_THROW(std::runtime_error, "\n" + msg);
         }
 
@@ -354,7 +468,7 @@ void ECLRegressionTest::checkSpecificKeyword(std::vector<std::string>& keywords1
                 fmt::format("Testing specific keyword in {}. "
                             "Keyword not found in first case but "
                             "found in second case.", reference);
-            std::cout << msg << std::endl;
+            out() << msg << std::endl;
             OPM_THROW(std::runtime_error, "\n "+ msg);
         }
 
@@ -376,20 +490,20 @@ void ECLRegressionTest::loadGrids()
     foundEGrid2 = checkFileName(rootName2, "EGRID", fileName2);
 
     if (foundEGrid1) {
-        std::cout << "\nLoading EGrid " << fileName1 << "  .... ";
+        out() << "\nLoading EGrid " << fileName1 << "  .... ";
         grid1 = new EGrid(fileName1);
-        std::cout << " done." << std::endl;
+        out() << " done." << std::endl;
     }
 
     if (foundEGrid2) {
-        std::cout << "Loading EGrid " << fileName2 << "  .... ";
+        out() << "Loading EGrid " << fileName2 << "  .... ";
         grid2 = new EGrid(fileName2);
-        std::cout << " done." << std::endl;
+        out() << " done." << std::endl;
     }
 
     if ((not foundEGrid1) || (not foundEGrid2)) {
-        std::cout << "\nWarning! Both grids could not be loaded. Not possible to reference cell values to grid indices." << std::endl;
-        std::cout << "Grid compare may also fail. SMRY, RFT, UNRST and INIT files can be checked \n" << std::endl;
+        out() << "\nWarning! Both grids could not be loaded. Not possible to reference cell values to grid indices." << std::endl;
+        out() << "Grid compare may also fail. SMRY, RFT, UNRST and INIT files can be checked \n" << std::endl;
     }
 }
 
@@ -400,13 +514,13 @@ void ECLRegressionTest::gridCompare()
 
     if ((grid1) && (not grid2)){
         std::string message ="test case egrid file " + rootName2 + ".EGRID could not be loaded";
-	std::cout << message << std::endl;
+	out() << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (grid1 && grid2) {
 
-        std::cout << "comparing grids " << std::endl;
+        out() << "comparing grids " << std::endl;
 
         const auto& dim1 = grid1->dimension();
         const auto& dim2 = grid2->dimension();
@@ -436,9 +550,9 @@ void ECLRegressionTest::gridCompare()
             return;
         }
 
-        std::cout << "\nComparing egrid files \n" << std::endl;
+        out() << "\nComparing egrid files \n" << std::endl;
 
-        std::cout << "Dimensions             " << " ... ";
+        out() << "Dimensions             " << " ... ";
 
         if (dim1[0] != dim2[0]  || dim1[1] != dim2[1] || dim1[2] != dim2[2]) {
             OPM_THROW(std::runtime_error,
@@ -449,9 +563,9 @@ void ECLRegressionTest::gridCompare()
                                   dim2[0], dim2[1], dim2[2]));
         }
 
-        std::cout << " done." << std::endl;
+        out() << " done." << std::endl;
 
-        std::cout << "Active cells           " << " ... ";
+        out() << "Active cells           " << " ... ";
 
         for (int k = 0; k < dim1[2]; k++) {
             for (int j=0; j < dim1[1]; j++) {
@@ -466,9 +580,9 @@ void ECLRegressionTest::gridCompare()
             }
         }
 
-        std::cout << " done." << std::endl;
+        out() << " done." << std::endl;
 
-        std::cout << "X, Y and Z coordinates " << " ... ";
+        out() << "X, Y and Z coordinates " << " ... ";
 
         std::array<double,8> X1 = {0.0};
         std::array<double,8> Y1 = {0.0};
@@ -528,9 +642,9 @@ void ECLRegressionTest::gridCompare()
             }
         }
 
-        std::cout << " done." << std::endl;
+        out() << " done." << std::endl;
 
-        std::cout << "NNC indices            " << " ... ";
+        out() << "NNC indices            " << " ... ";
 
         // check / compare NNC definitions
 
@@ -554,32 +668,32 @@ void ECLRegressionTest::gridCompare()
 
             for (size_t n = 0; n < NNC11.size(); n++) {
                 if (NNC11[n] != NNC12[n] || NNC21[n] != NNC22[n]) {
-                    std::cout << "Differences in NNCs. First found for " << NNC11[n] << " -> " <<  NNC21[n];
-                    std::cout << " not same as " << NNC12[n] << " -> " <<  NNC22[n] << std::endl;
+                    out() << "Differences in NNCs. First found for " << NNC11[n] << " -> " <<  NNC21[n];
+                    out() << " not same as " << NNC12[n] << " -> " <<  NNC22[n] << std::endl;
 
                     auto ijk1 = grid1->ijk_from_global_index(NNC11[n]-1);
                     auto ijk2  = grid1->ijk_from_global_index(NNC21[n]-1);
 
-                    std::cout << "In grid1 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
+                    out() << "In grid1 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
 
                     ijk1 = grid2->ijk_from_global_index(NNC12[n]-1);
                     ijk2 = grid2->ijk_from_global_index(NNC22[n]-1);
 
-                    std::cout << "In grid2 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
+                    out() << "In grid2 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
 
                     OPM_THROW(std::runtime_error, "\n Grid1 and grid2 have different definitions of NNCs. ");
                 }
             }
         }
 
-        std::cout << " done." << std::endl;
+        out() << " done." << std::endl;
 
         if (!deviations.empty()) {
             printDeviationReport();
         }
 
     } else {
-        std::cout << "\n!Warning, grid files not found, hence not compared. \n" << std::endl;
+        out() << "\n!Warning, grid files not found, hence not compared. \n" << std::endl;
     }
 
 }
@@ -594,36 +708,41 @@ void ECLRegressionTest::results_init()
 
     if ((foundInit1) && (not foundInit2)){
         std::string message ="test case init file " + rootName2 + ".INIT not found";
-	std::cout << message << std::endl;
+	out() << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundInit1 && foundInit2) {
         EclFile init1(fileName1);
-        std::cout << "\nLoading INIT file " << fileName1 << "  .... done" << std::endl;
+        out() << "\nLoading INIT file " << fileName1 << "  .... done" << std::endl;
 
         EclFile init2(fileName2);
-        std::cout << "Loading INIT file " << fileName2 << "  .... done\n" << std::endl;
+        out() << "Loading INIT file " << fileName2 << "  .... done\n" << std::endl;
 
         deviations.clear();
 
-        init1.loadData();
-        init2.loadData();
+        if (streaming && !init1.formattedInput() && !init2.formattedInput()) {
+            init1.memoryMap();
+            init2.memoryMap();
+        } else {
+            init1.loadData();
+            init2.loadData();
+        }
 
         auto arrayList1 = init1.getList();
         auto arrayList2 = init2.getList();
 
-        std::vector<std::string> keywords1;
-        std::vector<eclArrType> arrayType1;
+        KeywordLists lists;
+        auto& keywords1 = lists.keywords1;
+        auto& keywords2 = lists.keywords2;
+        auto& arrayType1 = lists.arrayType1;
+        auto& arrayType2 = lists.arrayType2;
 
         for (const auto& array : arrayList1) {
             keywords1.push_back(std::get<0>(array));
             arrayType1.push_back(std::get<1>(array));
         }
 
-        std::vector<std::string> keywords2;
-        std::vector<eclArrType> arrayType2;
-
         for (const auto& array : arrayList2) {
             keywords2.push_back(std::get<0>(array));
             arrayType2.push_back(std::get<1>(array));
@@ -632,7 +751,7 @@ void ECLRegressionTest::results_init()
         if (printKeywordOnly) {
             printComparisonForKeywordLists(keywords1,keywords2, arrayType1, arrayType2);
         } else {
-            std::cout << "\nComparing init files \n" << std::endl;
+            out() << "\nComparing init files \n" << std::endl;
             std::string reference = "Init file";
 
             if (specificKeyword.empty()) {
@@ -646,7 +765,7 @@ void ECLRegressionTest::results_init()
                     auto kw1 = sorted(keywords1);
                     auto kw2 = sorted(keywords2);
                     compareKeywords(kw1,kw2,reference);
-                    std::cerr << "Keyword reordering detected in INIT file" << std::endl;
+                    err() << "Keyword reordering detected in INIT file" << std::endl;
                     /*
                       The keyword reordering should eventually be marked as a an
                       error, but temporarily during the refactoring of 3D
@@ -661,56 +780,21 @@ void ECLRegressionTest::results_init()
                 checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
             }
 
-            for (size_t i = 0; i < keywords1.size(); i++) {
-                auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
-                    continue;
-                }
-                int ind2 = std::distance(keywords2.begin(),it1);
+            if (streaming) {
+                std::vector<std::function<void()>> tasks;
 
-                if (arrayType1[i] != arrayType2[ind2]) {
-                    printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-                    OPM_THROW(std::runtime_error,
-                              fmt::format("\nArray with same name '{}', "
-                                          "but of different type. Init file",
-                                          keywords1[i]));
+                for (size_t i = 0; i < keywords1.size(); i++) {
+                    tasks.emplace_back([this, &init1, &init2, &lists, i, &reference]()
+                    {
+                        this->compareInitKeyword(init1, init2, lists, i, reference);
+                    });
                 }
 
-                auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
-
-                if (it != keywordsBlackList.end()){
-                    std::cout << "Skipping  " << keywords1[i] << std::endl;
-                } else {
-                    std::cout << "Comparing " << keywords1[i] << " ... ";
-
-                    if (arrayType1[i] == INTE) {
-                        auto vect1 = init1.get<int>(keywords1[i]);
-                        auto vect2 = init2.get<int>(keywords2[ind2]);
-                        compareVectors(vect1, vect2, keywords1[i],reference);
-                    } else if (arrayType1[i] == REAL) {
-                        auto vect1 = init1.get<float>(keywords1[i]);
-                        auto vect2 = init2.get<float>(keywords2[ind2]);
-                        compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == DOUB) {
-                        auto vect1 = init1.get<double>(keywords1[i]);
-                        auto vect2 = init2.get<double>(keywords2[ind2]);
-                        compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == LOGI) {
-                        auto vect1 = init1.get<bool>(keywords1[i]);
-                        auto vect2 = init2.get<bool>(keywords2[ind2]);
-                        compareVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == CHAR) {
-                        auto vect1 = init1.get<std::string>(keywords1[i]);
-                        auto vect2 = init2.get<std::string>(keywords2[ind2]);
-                        compareVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == MESS) {
-                        // shold not be any associated data
-                    } else {
-                        std::cout << "unknown array type " << std::endl;
-                        exit(1);
-                    }
-
-                    std::cout << " done." << std::endl;
+                runComparisonTasks(tasks);
+            } else {
+                for (size_t i = 0; i < keywords1.size(); i++) {
+                    compareInitKeyword(init1, init2, lists, i, reference);
+                    checkFailureLimit();
                 }
             }
 
@@ -719,12 +803,89 @@ void ECLRegressionTest::results_init()
             }
         }
     } else {
-        std::cout << "\n!Warning, init files not found, hence not compared. \n" << std::endl;
+        out() << "\n!Warning, init files not found, hence not compared. \n" << std::endl;
     }
 
 }
 
 
+void ECLRegressionTest::compareInitKeyword(EclFile& init1, EclFile& init2,
+                                           const KeywordLists& lists, const size_t i,
+                                           const std::string& reference)
+{
+    const auto& keywords1 = lists.keywords1;
+    const auto& keywords2 = lists.keywords2;
+    const auto& arrayType1 = lists.arrayType1;
+    const auto& arrayType2 = lists.arrayType2;
+
+    auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
+    if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
+        return;
+    }
+    int ind2 = std::distance(keywords2.begin(),it1);
+
+    if (arrayType1[i] != arrayType2[ind2]) {
+        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+        OPM_THROW(std::runtime_error,
+                  fmt::format("\nArray with same name '{}', "
+                              "but of different type. Init file",
+                              keywords1[i]));
+    }
+
+    auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
+
+    if (it != keywordsBlackList.end()){
+        out() << "Skipping  " << keywords1[i] << std::endl;
+        return;
+    }
+
+    out() << "Comparing " << keywords1[i] << " ... ";
+
+    const bool views = init1.isMapped() && init2.isMapped();
+
+    if (arrayType1[i] == INTE) {
+        if (views) {
+            compareViews(init1.getView<int>(keywords1[i]), init2.getView<int>(keywords2[ind2]), keywords1[i], reference);
+        } else {
+            auto vect1 = loadSerialised([&]() { return init1.get<int>(keywords1[i]); });
+            auto vect2 = loadSerialised([&]() { return init2.get<int>(keywords2[ind2]); });
+            compareVectors(vect1, vect2, keywords1[i],reference);
+        }
+    } else if (arrayType1[i] == REAL) {
+        if (views) {
+            compareFloatingPointViews(init1.getView<float>(keywords1[i]), init2.getView<float>(keywords2[ind2]), keywords1[i], reference);
+        } else {
+            auto vect1 = loadSerialised([&]() { return init1.get<float>(keywords1[i]); });
+            auto vect2 = loadSerialised([&]() { return init2.get<float>(keywords2[ind2]); });
+            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+        }
+    } else if (arrayType1[i] == DOUB) {
+        if (views) {
+            compareFloatingPointViews(init1.getView<double>(keywords1[i]), init2.getView<double>(keywords2[ind2]), keywords1[i], reference);
+        } else {
+            auto vect1 = loadSerialised([&]() { return init1.get<double>(keywords1[i]); });
+            auto vect2 = loadSerialised([&]() { return init2.get<double>(keywords2[ind2]); });
+            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+        }
+    } else if (arrayType1[i] == LOGI) {
+        auto vect1 = loadSerialised([&]() { return init1.get<bool>(keywords1[i]); });
+        auto vect2 = loadSerialised([&]() { return init2.get<bool>(keywords2[ind2]); });
+        compareVectors(vect1, vect2, keywords1[i], reference);
+    } else if (arrayType1[i] == CHAR) {
+        auto vect1 = loadSerialised([&]() { return init1.get<std::string>(keywords1[i]); });
+        auto vect2 = loadSerialised([&]() { return init2.get<std::string>(keywords2[ind2]); });
+        compareVectors(vect1, vect2, keywords1[i], reference);
+    } else if (arrayType1[i] == MESS) {
+        // shold not be any associated data
+    } else {
+        out() << "unknown array type " << std::endl;
+        exit(1);
+    }
+
+    out() << " done." << std::endl;
+}
+
+
 void ECLRegressionTest::results_rst()
 {
     std::string fileName1, fileName2;
@@ -733,16 +894,16 @@ void ECLRegressionTest::results_rst()
 
     if ((foundRst1) && (not foundRst2)){
         std::string message ="test case restart file " + rootName2 + ".UNRST not found";
-	std::cout << message << std::endl;
+	out() << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundRst1 && foundRst2) {
         auto rst1 = std::make_shared<ERst>(fileName1);
-        std::cout << "\nLoading restart file " << fileName1 << "  .... done" << std::endl;
+        out() << "\nLoading restart file " << fileName1 << "  .... done" << std::endl;
 
         auto rst2 = std::make_shared<ERst>(fileName2);
-        std::cout << "Loading restart file " << fileName2 << "  .... done\n" << std::endl;
+        out() << "Loading restart file " << fileName2 << "  .... done\n" << std::endl;
 
         std::vector<int> seqnums1 = rst1->listOfReportStepNumbers();
         std::vector<int> seqnums2 = rst2->listOfReportStepNumbers();
@@ -798,142 +959,334 @@ void ECLRegressionTest::results_rst()
                            std::back_inserter(seqnStrList2),
                            [](const auto& val) { return std::to_string(val); });
 
-            std::cout << "\nrestart sequences " << std::endl;
+            out() << "\nrestart sequences " << std::endl;
             printComparisonForKeywordLists(seqnStrList1, seqnStrList2);
             OPM_THROW(std::runtime_error, "\nRestart files not having the same report steps: ");
         }
 
-        for (int& seqn : seqnums1) {
-            std::cout << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
+        if (streaming) {
+            if (!rst1->formattedInput() && !rst2->formattedInput()) {
+                rst1->memoryMap();
+                rst2->memoryMap();
+            }
 
-            std::string reference = "Restart, sequence "+std::to_string(seqn);
+            // The keyword lists of each report step are established up
+            // front, with the associated output buffered, so that
+            // keywords from all report steps may be compared concurrently.
 
-            rst1->loadReportStepNumber(seqn);
-            rst2->loadReportStepNumber(seqn);
+            std::vector<std::function<void()>> tasks;
 
-            auto arrays1 = rst1->listOfRstArrays(seqn);
-            auto arrays2 = rst2->listOfRstArrays(seqn);
+            for (const int seqn : seqnums1) {
+                auto reference = std::make_shared<const std::string>("Restart, sequence " + std::to_string(seqn));
+                auto lists = std::make_shared<KeywordLists>();
+                auto prologue = std::make_shared<TaskReport>();
 
-            std::vector<std::string> keywords1;
-            std::vector<eclArrType> arrayType1;
-            for (const auto& array : arrays1) {
-                keywords1.push_back(std::get<0>(array));
-                arrayType1.push_back(std::get<1>(array));
-            }
+                bool compare = false;
 
-            std::vector<std::string> keywords2;
-            std::vector<eclArrType> arrayType2;
-
-            for (const auto& array : arrays2) {
-                keywords2.push_back(std::get<0>(array));
-                arrayType2.push_back(std::get<1>(array));
-            }
+                activeReport = prologue.get();
+                try {
+                    out() << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
+                    compare = rstReportStepKeywords(*rst1, *rst2, seqn, *reference, *lists);
+                } catch (...) {
+                    prologue->error = std::current_exception();
+                }
+                activeReport = nullptr;
 
-            if (integrationTest) {
-                std::vector<std::string> keywords;
+                tasks.emplace_back([prologue]()
+                {
+                    prologue->replay(*activeReport);
 
-                for (size_t i = 0; i < keywords1.size(); i++) {
-                    if (keywords1[i] == "PRESSURE" ||
-                        keywords1[i] == "SWAT" ||
-                        keywords1[i] =="SGAS") {
-                        auto search2 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                        if (search2 != keywords2.end()) {
-                            keywords.push_back(keywords1[i]);
-                        } else if (acceptExtraKeywordsBoth) {
-                            continue;
-                        }
+                    if (prologue->error) {
+                        std::rethrow_exception(prologue->error);
                     }
+                });
+
+                if (prologue->error) {
+                    break;
                 }
 
-                keywords1 = keywords2 = keywords;
+                for (size_t i = 0; compare && (i < lists->keywords1.size()); i++) {
+                    tasks.emplace_back([this, rst1, rst2, seqn, lists, i, reference]()
+                    {
+                        this->compareRstKeyword(*rst1, *rst2, seqn, *lists, i, *reference);
+                    });
+                }
+            }
+
+            runComparisonTasks(tasks);
+        } else {
+            for (int& seqn : seqnums1) {
+                out() << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
+
+                std::string reference = "Restart, sequence "+std::to_string(seqn);
+
+                rst1->loadReportStepNumber(seqn);
+                rst2->loadReportStepNumber(seqn);
+
+                KeywordLists lists;
+                if (! rstReportStepKeywords(*rst1, *rst2, seqn, reference, lists)) {
+                    continue;
+                }
 
-                int nKeys = keywords.size();
-                arrayType1.assign(nKeys, REAL);
-                arrayType2.assign(nKeys, REAL);
+                for (size_t i = 0; i < lists.keywords1.size(); i++) {
+                    compareRstKeyword(*rst1, *rst2, seqn, lists, i, reference);
+                    checkFailureLimit();
+                }
             }
+        }
 
-            if (printKeywordOnly) {
-                printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-            } else {
-                if (specificKeyword.empty()) {
-                    compareKeywords(keywords1, keywords2, reference);
-                } else {
-                    checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
+        if (!deviations.empty()) {
+            printDeviationReport();
+        }
+    } else {
+        out() << "\n!Warning, restart files not found, hence not compared. \n" << std::endl;
+    }
+
+}
+
+
+bool ECLRegressionTest::rstReportStepKeywords(ERst& rst1, ERst& rst2, const int seqn,
+                                              const std::string& reference, KeywordLists& lists)
+{
+    auto arrays1 = rst1.listOfRstArrays(seqn);
+    auto arrays2 = rst2.listOfRstArrays(seqn);
+
+    auto& keywords1 = lists.keywords1;
+    auto& keywords2 = lists.keywords2;
+    auto& arrayType1 = lists.arrayType1;
+    auto& arrayType2 = lists.arrayType2;
+
+    for (const auto& array : arrays1) {
+        keywords1.push_back(std::get<0>(array));
+        arrayType1.push_back(std::get<1>(array));
+    }
+
+    for (const auto& array : arrays2) {
+        keywords2.push_back(std::get<0>(array));
+        arrayType2.push_back(std::get<1>(array));
+    }
+
+    if (integrationTest) {
+        std::vector<std::string> keywords;
+
+        for (size_t i = 0; i < keywords1.size(); i++) {
+            if (keywords1[i] == "PRESSURE" ||
+                keywords1[i] == "SWAT" ||
+                keywords1[i] =="SGAS") {
+                auto search2 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
+                if (search2 != keywords2.end()) {
+                    keywords.push_back(keywords1[i]);
+                } else if (acceptExtraKeywordsBoth) {
+                    continue;
                 }
+            }
+        }
 
-                for (size_t i = 0; i < keywords1.size(); i++) {
-                    //if (keywords.count(keywords1[i]) == 0)
-                    //    continue;
+        keywords1 = keywords2 = keywords;
 
-                    auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                    if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
-                        continue;
-                    }
-                    int ind2 = std::distance(keywords2.begin(), it1);
+        int nKeys = keywords.size();
+        arrayType1.assign(nKeys, REAL);
+        arrayType2.assign(nKeys, REAL);
+    }
 
-                    if (arrayType1[i] != arrayType2[ind2]) {
-                        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-                        OPM_THROW(std::runtime_error,
-                                  fmt::format("\nArray with same name '{}', "
-                                              "but of different type. "
-                                              "Restart file sequence {}",
-                                              keywords1[i], seqn));
-                    }
+    if (printKeywordOnly) {
+        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+        return false;
+    }
 
-                    auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
+    if (specificKeyword.empty()) {
+        compareKeywords(keywords1, keywords2, reference);
+    } else {
+        checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
+    }
 
-                    if (it != keywordsBlackList.end()){
-                        std::cout << "Skipping  " << keywords1[i] << std::endl;
-                    } else {
+    return true;
+}
 
-                        std::cout << "Comparing " << keywords1[i] << " ... ";
-
-                        if (arrayType1[i] == INTE) {
-                            auto vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == REAL) {
-                            auto vect1 = rst1->getRestartData<float>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<float>(keywords2[ind2], seqn, 0);
-                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == DOUB) {
-                            auto vect1 = rst1->getRestartData<double>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<double>(keywords2[ind2], seqn, 0);
-
-                            // hack in order to not test doubhead[1], dependent on simulation results
-                            // All ohter items in DOUBHEAD are tested with strict tolerances
-                            if (keywords1[i]=="DOUBHEAD"){
-                                vect2[1] = vect1[1];
-                            }
-                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == LOGI) {
-                            auto vect1 = rst1->getRestartData<bool>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<bool>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == CHAR) {
-                            auto vect1 = rst1->getRestartData<std::string>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<std::string>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == MESS) {
-                            // shold not be any associated data
-                        } else {
-                            std::cout << "unknown array type " << std::endl;
-                            exit(1);
-                        }
 
-                        std::cout << " done." << std::endl;
+void ECLRegressionTest::compareRstKeyword(ERst& rst1, ERst& rst2, const int seqn,
+                                          const KeywordLists& lists, const size_t i,
+                                          const std::string& reference)
+{
+    const auto& keywords1 = lists.keywords1;
+    const auto& keywords2 = lists.keywords2;
+    const auto& arrayType1 = lists.arrayType1;
+    const auto& arrayType2 = lists.arrayType2;
+
+    auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
+    if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
+        return;
+    }
+    int ind2 = std::distance(keywords2.begin(), it1);
+
+    if (arrayType1[i] != arrayType2[ind2]) {
+        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+        OPM_THROW(std::runtime_error,
+                  fmt::format("\nArray with same name '{}', "
+                              "but of different type. "
+                              "Restart file sequence {}",
+                              keywords1[i], seqn));
+    }
+
+    auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
+
+    if (it != keywordsBlackList.end()){
+        out() << "Skipping  " << keywords1[i] << std::endl;
+        return;
+    }
+
+    out() << "Comparing " << keywords1[i] << " ... ";
+
+    const bool views = rst1.isMapped() && rst2.isMapped();
+
+    if (arrayType1[i] == INTE) {
+        if (views) {
+            compareViews(rst1.getRestartView<int>(keywords1[i], seqn, 0),
+                         rst2.getRestartView<int>(keywords2[ind2], seqn, 0),
+                         keywords1[i], reference);
+        } else {
+            auto vect1 = loadSerialised([&]() { return rst1.getRestartData<int>(keywords1[i], seqn, 0); });
+            auto vect2 = loadSerialised([&]() { return rst2.getRestartData<int>(keywords2[ind2], seqn, 0); });
+            compareVectors(vect1, vect2, keywords1[i], reference);
+        }
+    } else if (arrayType1[i] == REAL) {
+        if (views) {
+            compareFloatingPointViews(rst1.getRestartView<float>(keywords1[i], seqn, 0),
+                                      rst2.getRestartView<float>(keywords2[ind2], seqn, 0),
+                                      keywords1[i], reference);
+        } else {
+            auto vect1 = loadSerialised([&]() { return rst1.getRestartData<float>(keywords1[i], seqn, 0); });
+            auto vect2 = loadSerialised([&]() { return rst2.getRestartData<float>(keywords2[ind2], seqn, 0); });
+            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+        }
+    } else if (arrayType1[i] == DOUB) {
+        if (views && (keywords1[i] != "DOUBHEAD")) {
+            compareFloatingPointViews(rst1.getRestartView<double>(keywords1[i], seqn, 0),
+                                      rst2.getRestartView<double>(keywords2[ind2], seqn, 0),
+                                      keywords1[i], reference);
+        } else {
+            auto vect1 = loadSerialised([&]() { return rst1.getRestartData<double>(keywords1[i], seqn, 0); });
+            auto vect2 = loadSerialised([&]() { return rst2.getRestartData<double>(keywords2[ind2], seqn, 0); });
+
+            // hack in order to not test doubhead[1], dependent on simulation results
+            // All ohter items in DOUBHEAD are tested with strict tolerances
+            if (keywords1[i]=="DOUBHEAD"){
+                vect2[1] = vect1[1];
+            }
+            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+        }
+    } else if (arrayType1[i] == LOGI) {
+        auto vect1 = loadSerialised([&]() { return rst1.getRestartData<bool>(keywords1[i], seqn, 0); });
+        auto vect2 = loadSerialised([&]() { return rst2.getRestartData<bool>(keywords2[ind2], seqn, 0); });
+        compareVectors(vect1, vect2, keywords1[i], reference);
+    } else if (arrayType1[i] == CHAR) {
+        auto vect1 = loadSerialised([&]() { return rst1.getRestartData<std::string>(keywords1[i], seqn, 0); });
+        auto vect2 = loadSerialised([&]() { return rst2.getRestartData<std::string>(keywords2[ind2], seqn, 0); });
+        compareVectors(vect1, vect2, keywords1[i], reference);
+    } else if (arrayType1[i] == MESS) {
+        // shold not be any associated data
+    } else {
+        out() << "unknown array type " << std::endl;
+        exit(1);
+    }
+
+    out() << " done." << std::endl;
+}
+
+
+void ECLRegressionTest::runComparisonTasks(const std::vector<std::function<void()>>& tasks)
+{
+    const int numTasks = static_cast<int>(tasks.size());
+
+    std::atomic<bool> stop{false};
+    std::exception_ptr failure{};
+
+#pragma omp parallel for ordered schedule(dynamic) num_threads(numThreads)
+    for (int task = 0; task < numTasks; ++task) {
+        TaskReport report;
+        report.stop = &stop;
+
+        if (! stop.load()) {
+            activeReport = &report;
+            try {
+                tasks[task]();
+            } catch (...) {
+                report.error = std::current_exception();
+            }
+            activeReport = nullptr;
+        }
+
+#pragma omp ordered
+        {
+            // Tasks following a failure are discarded, as they would not
+            // have been run in a sequential comparison.
+            if (! stop.load()) {
+                mergeTaskReport(report);
+
+                if (report.error) {
+                    failure = report.error;
+                    stop = true;
+                } else if (failureLimitReached()) {
+                    try {
+                        checkFailureLimit();
+                    } catch (...) {
+                        failure = std::current_exception();
                     }
+                    stop = true;
                 }
             }
         }
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+
+void ECLRegressionTest::mergeTaskReport(TaskReport& report)
+{
+    report.replay(std::cout, std::cerr);
+
+    for (auto& [keyword, devs] : report.deviations) {
+        auto& dest = deviations[keyword];
+        dest.insert(dest.end(), devs.begin(), devs.end());
+    }
+
+    num_errors += report.num_errors;
+}
+
+
+size_t ECLRegressionTest::failureCount() const
+{
+    size_t count = num_errors;
 
+    for (const auto& devs : deviations) {
+        count += devs.second.size();
+    }
+
+    return count;
+}
+
+
+bool ECLRegressionTest::failureLimitReached() const
+{
+    return (maxFailures > 0) && (failureCount() >= maxFailures);
+}
+
+
+void ECLRegressionTest::checkFailureLimit() const
+{
+    if (failureLimitReached()) {
         if (!deviations.empty()) {
             printDeviationReport();
         }
-    } else {
-        std::cout << "\n!Warning, restart files not found, hence not compared. \n" << std::endl;
-    }
 
+        OPM_THROW(std::runtime_error,
+                  fmt::format("\nComparison stopped after {} failures, "
+                              "the maximum number of failures is {}",
+                              failureCount(), maxFailures));
+    }
 }
 
 
@@ -945,27 +1298,27 @@ void ECLRegressionTest::results_smry()
 
     if ((foundSmspec1) && (not foundSmspec2)){
         std::string message ="test case summary file " + rootName2 + ".SMSPEC not found";
-	std::cout << message << std::endl;
+	out() << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundSmspec1 && foundSmspec2) {
         ESmry smry1(fileName1, loadBaseRunData);
         smry1.loadData();
-        std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
+        out() << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
 
         ESmry smry2(fileName2, loadBaseRunData);
         smry2.loadData();
-        std::cout << "Loading summary file " << fileName2 << "  .... done" << std::endl;
+        out() << "Loading summary file " << fileName2 << "  .... done" << std::endl;
 
         deviations.clear();
 
         std::string reference = "Summary file";
 
-        std::cout << "\nComparing summary files " << std::endl;
+        out() << "\nComparing summary files " << std::endl;
 
         if (reportStepOnly){
-            std::cout << " -- Values at report steps will be compared. Time steps in between reports are ignored " << std::endl;
+            out() << " -- Values at report steps will be compared. Time steps in between reports are ignored " << std::endl;
         }
 
         std::vector<std::string> keywords1 = smry1.keywordList();
@@ -1039,12 +1392,12 @@ void ECLRegressionTest::results_smry()
                 keywords1.erase(std::remove_if(keywords1.begin(), keywords1.end(), make_remover(keywordsBlackListExtraRestart)), keywords1.end());
             }
 
-            std::cout << "\nChecking " << keywords1.size() << "  vectors  ... ";
+            out() << "\nChecking " << keywords1.size() << "  vectors  ... ";
 
             for (size_t i = 0; i < keywords1.size(); i++) {
                 auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
                 if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
-                    std::cout << "\nSkipping comparison for kw " << keywords1[i];
+                    out() << "\nSkipping comparison for kw " << keywords1[i];
                     continue;
                 }
 
@@ -1069,10 +1422,10 @@ void ECLRegressionTest::results_smry()
                 compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
             }
 
-            std::cout << " done." << std::endl;
+            out() << " done." << std::endl;
 
             if (blackListed.size()>0){
-                std::cout << "Number of black listed vectors " << blackListed.size() << " (not compared) " << std::endl;
+                out() << "Number of black listed vectors " << blackListed.size() << " (not compared) " << std::endl;
             }
 
             if (!deviations.empty()) {
@@ -1081,7 +1434,7 @@ void ECLRegressionTest::results_smry()
         }
 
     } else {
-        std::cout << "\n!Warning, summary files not found, hence not compared. \n" << std::endl;
+        out() << "\n!Warning, summary files not found, hence not compared. \n" << std::endl;
     }
 
 }
@@ -1096,25 +1449,25 @@ void ECLRegressionTest::results_rsm()
 
         ESmry smry2(fileName1, loadBaseRunData);
         smry2.loadData();
-        std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
+        out() << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
 
         namespace fs = std::filesystem;
         std::string rsm_file = rootName2 + ".RSM";
         if (fs::is_regular_file(fs::path(rsm_file))) {
-            std::cout << "\nLoading RSM file " << rsm_file << "  .... " << std::flush;
+            out() << "\nLoading RSM file " << rsm_file << "  .... " << std::flush;
             auto rsm = ERsm(rsm_file);
-            std::cout << " done " << std::endl << std::flush;;
+            out() << " done " << std::endl << std::flush;;
 
-            std::cout << "\nComparing RSM file against SMRY file  .... " << std::flush;
+            out() << "\nComparing RSM file against SMRY file  .... " << std::flush;
 
             if (!cmp(smry2, rsm))
                 HANDLE_ERROR(std::runtime_error, "The RSM file did not compare equal to the summary file");
 
-            std::cout << " done " << std::endl << std::flush;;
+            out() << " done " << std::endl << std::flush;;
         }
 
     } else {
-        std::cout << "\n!Warning, summary and/or RSM - file not found, hence not compared. \n" << std::endl;
+        out() << "\n!Warning, summary and/or RSM - file not found, hence not compared. \n" << std::endl;
     }
 }
 
@@ -1127,16 +1480,16 @@ void ECLRegressionTest::results_rft()
 
     if ((!foundRft1 && foundRft2) || (foundRft1 && !foundRft2)) {
         std::string message ="test case rft file " + (foundRft1 ? rootName1 : rootName2) + ".RFT not found";
-        std::cout << message << std::endl;
+        out() << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundRft1 && foundRft2) {
         ERft rft1(fileName1);
-        std::cout << "\nLoading rft file " << fileName1 << "  .... done" << std::endl;
+        out() << "\nLoading rft file " << fileName1 << "  .... done" << std::endl;
 
         ERft rft2(fileName2);
-        std::cout << "Loading rft file " << fileName2 << "  .... done\n" << std::endl;
+        out() << "Loading rft file " << fileName2 << "  .... done\n" << std::endl;
 
         auto rftReportList1 = rft1.listOfRftReports();
         auto rftReportList2 = rft2.listOfRftReports();
@@ -1171,7 +1524,7 @@ void ECLRegressionTest::results_rft()
 
             std::string dateStr = std::to_string(std::get<0>(date)) + "/" + std::to_string(std::get<1>(date)) + "/" + std::to_string(std::get<2>(date));
 
-            std::cout << "Well: " << well << " date: " << dateStr << std::endl;
+            out() << "Well: " << well << " date: " << dateStr << std::endl;
 
             std::string reference = "RFT: " + well + ", " + dateStr;
 
@@ -1208,9 +1561,9 @@ void ECLRegressionTest::results_rft()
                     auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keyword);
 
                     if (it != keywordsBlackList.end()){
-                        std::cout << "Skipping  " << keyword << std::endl;
+                        out() << "Skipping  " << keyword << std::endl;
                     } else {
-                        std::cout << "Comparing: " << keyword << " ... ";
+                        out() << "Comparing: " << keyword << " ... ";
 
                         if (arrayType == INTE) {
                             auto vect1 = rft1.getRft<int>(keyword, well, date);
@@ -1235,22 +1588,22 @@ void ECLRegressionTest::results_rft()
                         } else if (arrayType == MESS) {
                             // shold not be any associated data
                         } else {
-                            std::cout << "unknown array type " << std::endl;
+                            out() << "unknown array type " << std::endl;
                             exit(1);
                         }
 
-                        std::cout << " done." << std::endl;
+                        out() << " done." << std::endl;
                     }
                 }
             }
-            std::cout << std::endl;
+            out() << std::endl;
         }
 
         if (!deviations.empty()) {
             printDeviationReport();
         }
     } else {
-        std::cout << "\n!Warning, rft files not found, hence not compared. \n" << std::endl;
+        out() << "\n!Warning, rft files not found, hence not compared. \n" << std::endl;
     }
 }
 
@@ -1282,7 +1635,7 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
 
     maxLen += 4;
 
-    std::cout << std::endl;
+    out() << std::endl;
 
     for (auto& it : commonList) {
         auto it1 = std::find(arrayList1.begin(), arrayList1.end(), it);
@@ -1292,29 +1645,29 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
         int ind2 = std::distance(arrayList2.begin(),it2);
 
         if (arrayType1[ind1] != arrayType2[ind2]) {
-            std::cout << "\033[1;31m";
+            out() << "\033[1;31m";
         }
 
         if (std::find(arrayList1.begin(), arrayList1.end(), it) != arrayList1.end()) {
-            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType1[ind1]] << ") | ";
+            out() <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType1[ind1]] << ") | ";
         } else {
-            std::cout <<  std::setw(maxLen) << "" << "        | ";
+            out() <<  std::setw(maxLen) << "" << "        | ";
         }
 
         if (std::find(arrayList2.begin(), arrayList2.end(), it) != arrayList2.end()) {
-            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType2[ind2]] << ") ";
+            out() <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType2[ind2]] << ") ";
         } else {
-            std::cout <<  std::setw(maxLen) << "";
+            out() <<  std::setw(maxLen) << "";
         }
 
         if (arrayType1[ind1] != arrayType2[ind2]) {
-            std::cout << " !" << "\033[0m";
+            out() << " !" << "\033[0m";
         }
 
-        std::cout << std::endl;
+        out() << std::endl;
     }
 
-    std::cout << std::endl << std::endl;
+    out() << std::endl << std::endl;
 }
 
 
@@ -1331,19 +1684,19 @@ void ECLRegressionTest::printMissingKeywords(const std::vector<std::string>& arr
         commonList.insert(key);
     }
 
-    std::cout << "\nKeywords found in second case, but missing in first case: \n" << std::endl;
+    out() << "\nKeywords found in second case, but missing in first case: \n" << std::endl;
 
     for (auto& it : commonList) {
         if (std::find(arrayList1.begin(), arrayList1.end(), it) == arrayList1.end()) {
-            std::cout << "  > '" << it  << "'" << std::endl;
+            out() << "  > '" << it  << "'" << std::endl;
         }
     }
 
-    std::cout << "\nKeywords found in first case, but missing in second case: \n" << std::endl;
+    out() << "\nKeywords found in first case, but missing in second case: \n" << std::endl;
 
     for (auto& it : commonList) {
         if (std::find(arrayList2.begin(), arrayList2.end(), it) == arrayList2.end()) {
-            std::cout << "  > '" << it  << "'" << std::endl;
+            out() << "  > '" << it  << "'" << std::endl;
         }
     }
 }
@@ -1371,23 +1724,23 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
 
     maxLen += 2;
 
-    std::cout << std::endl;
+    out() << std::endl;
 
     for (auto& it : commonList) {
         if (std::find(arrayList1.begin(), arrayList1.end(), it) != arrayList1.end()) {
-            std::cout <<  std::setw(maxLen) << it  << " | ";
+            out() <<  std::setw(maxLen) << it  << " | ";
         } else {
-            std::cout <<  std::setw(maxLen) << "" << " | ";
+            out() <<  std::setw(maxLen) << "" << " | ";
         }
 
         if (std::find(arrayList2.begin(), arrayList2.end(), it) != arrayList2.end()) {
-            std::cout <<  std::setw(maxLen) << it << "";
+            out() <<  std::setw(maxLen) << it << "";
         } else {
-            std::cout <<  std::setw(maxLen) << "" ;
+            out() <<  std::setw(maxLen) << "" ;
         }
 
-        std::cout << std::endl;
+        out() << std::endl;
     }
 
-    std::cout << std::endl;
+    out() << std::endl;
 }
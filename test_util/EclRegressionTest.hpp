@@ -24,8 +24,18 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
 namespace Opm { namespace EclIO {
+    class EclFile;
     class EGrid;
+    class ERst;
+    template <typename T> class EclArrayView;
 }}
 
 namespace EIOD = Opm::EclIO;
@@ -95,8 +105,27 @@ public:
         this->loadBaseRunData = loadArg;
     }
 
+    //! \brief Compare INIT and restart arrays in chunks, using up to numThreadsArg threads.
+    //! \details Numeric arrays in binary files are read in chunks from memory mapped
+    //!          files rather than loading entire report steps.  Keywords from all
+    //!          report steps are compared concurrently, and the report is written
+    //!          in the same order and with the same content as when comparing
+    //!          sequentially.
+    void setStreamingComparison(int numThreadsArg) {
+        this->streaming = true;
+        this->numThreads = std::max(numThreadsArg, 1);
+    }
+
+    //! \brief Stop comparing once this many failures have been found (0: no limit).
+    //! \details Failures are the errors counted when not throwing on errors and
+    //!          the deviations collected in analysis mode.  The limit is checked
+    //!          after each keyword.
+    void setMaxFailures(size_t maxFailuresArg) {
+        this->maxFailures = maxFailuresArg;
+    }
+
     void loadGrids();
-    void printDeviationReport();
+    void printDeviationReport() const;
 
     void gridCompare();
 
@@ -107,6 +136,11 @@ public:
     void results_rft();
 
 private:
+    struct KeywordLists {
+        std::vector<std::string> keywords1, keywords2;
+        std::vector<EIOD::eclArrType> arrayType1, arrayType2;
+    };
+
     bool checkFileName(const std::string& rootName, const std::string& extension, std::string& filename);
 
     // Prints results stored in absDeviation and relDeviation.
@@ -132,10 +166,42 @@ private:
                               std::vector<EIOD::eclArrType>& arrayType2,
                               const std::string& reference);
 
+    // Returns false if there are no arrays to compare for this report step.
+    bool rstReportStepKeywords(EIOD::ERst& rst1, EIOD::ERst& rst2, int seqn,
+                               const std::string& reference, KeywordLists& lists);
+
+    void compareRstKeyword(EIOD::ERst& rst1, EIOD::ERst& rst2, int seqn,
+                           const KeywordLists& lists, size_t i,
+                           const std::string& reference);
+
+    void compareInitKeyword(EIOD::EclFile& init1, EIOD::EclFile& init2,
+                            const KeywordLists& lists, size_t i,
+                            const std::string& reference);
+
+    // Runs tasks concurrently, with output, deviations and errors merged in
+    // task order.  Remaining tasks are abandoned after the first exception
+    // or once the failure limit is reached.
+    void runComparisonTasks(const std::vector<std::function<void()>>& tasks);
+
+    void mergeTaskReport(TaskReport& report);
+
+    size_t failureCount() const;
+    bool failureLimitReached() const;
+    void checkFailureLimit() const;
+
     template <typename T>
     void compareVectors(const std::vector<T>& t1, const std::vector<T>& t2,
                         const std::string& keyword, const std::string& reference);
 
+    template <typename T>
+    void compareViews(const EIOD::EclArrayView<T>& view1, const EIOD::EclArrayView<T>& view2,
+                      const std::string& keyword, const std::string& reference);
+
+    template <typename T>
+    void compareFloatingPointViews(const EIOD::EclArrayView<T>& view1,
+                                   const EIOD::EclArrayView<T>& view2,
+                                   const std::string& keyword, const std::string& reference);
+
     template <typename T>
     void compareFloatingPointVectors(const std::vector<T>& t1, const std::vector<T> &t2,
                                      const std::string& keyword, const std::string& reference);
@@ -183,6 +249,14 @@ private:
 
     bool loadBaseRunData = false;
 
+    // Chunked, concurrent comparison of INIT and restart arrays
+    bool streaming = false;
+    int numThreads = 1;
+    size_t maxFailures = 0;
+
+    // Number of array elements decoded at a time in streaming mode
+    static constexpr std::int64_t streamChunkSize = 1 << 20;
+
     // specific keyword to be compared
     std::string specificKeyword;
 
@@ -21,6 +21,7 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <cstdlib>
 #include <filesystem>
 #include <getopt.h>
 #include <iostream>
@@ -38,8 +39,11 @@ static void printHelp() {
               << "-a Run a full analysis of errors.\n"
               << "-h Print help and exit.\n"
               << "-d Use report steps only when comparing results from summary files.\n"
+              << "-e Stop after the given number of failures (errors with -n, deviations with -a). Checked after each keyword.\n"
               << "-i Execute integration test (regression test is default).\n"
               << "   The integration test compares SGAS, SWAT and PRESSURE in unified restart files, and WOPR, WGPR, WWPR and WBHP (all wells) in summary file. \n"
+              << "-j Compare INIT and restart arrays in chunks using the given number of threads. Keywords and report steps\n"
+              << "   are compared concurrently, the report is the same as with sequential comparison.\n"
               << "-k Specify specific keyword to compare (capitalized), for examples -k PRESSURE or -k WOPR:A-1H \n"
               << "-l Only do comparison for the last Report Step. This option is only valid for restart files.\n"
               << "-n Do not throw on errors.\n"
@@ -96,9 +100,11 @@ int main(int argc, char** argv) {
     char* keyword                  = nullptr;
     int c                          = 0;
     int reportStepNumber           = -1;
+    int numThreads                 = 0;
+    size_t maxFailures             = 0;
     std::string fileTypeString;
 
-    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xdy")) != -1) {
+    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xdye:j:")) != -1) {
         switch (c) {
         case 'a':
             analysis = true;
@@ -110,9 +116,15 @@ int main(int argc, char** argv) {
         case 'd':
             reportStepOnly = true;
             break;
+        case 'e':
+            maxFailures = std::strtoul(optarg, nullptr, 10);
+            break;
         case 'i':
             integrationTest = true;
             break;
+        case 'j':
+            numThreads = atoi(optarg);
+            break;
         case 'k':
             specificKeyword = true;
             keyword = optarg;
@@ -144,7 +156,11 @@ int main(int argc, char** argv) {
             acceptExtraKeywordsBoth = true;
             break;
         case '?':
-            if (optopt == 'k' || optopt == 'm' || optopt == 's') {
+            if (optopt == 'e' || optopt == 'j') {
+                std::cerr << "Option " << static_cast<char>(optopt) << " requires a number as argument, see manual (-h) for more information." << std::endl;
+                return EXIT_FAILURE;
+            }
+            else if (optopt == 'k' || optopt == 'm' || optopt == 's') {
                 std::cerr << "Option " << optopt << " requires a keyword as argument, see manual (-h) for more information." << std::endl;
                 return EXIT_FAILURE;
             }
@@ -188,6 +204,11 @@ int main(int argc, char** argv) {
         comparator.doAnalysis(analysis);
         comparator.setAcceptExtraKeywords(acceptExtraKeywords);
         comparator.setAcceptExtraKeywordsBoth(acceptExtraKeywordsBoth);
+        comparator.setMaxFailures(maxFailures);
+
+        if (numThreads > 0) {
+            comparator.setStreamingComparison(numThreads);
+        }
 
         if (integrationTest) {
             comparator.setIntegrationTest(true);
@@ -1,14 +1,20 @@
+#include <atomic>
 #include <chrono>
+#include <exception>
 #include <filesystem>
 #include <getopt.h>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 #include <cctype>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 
+#include "EclFileConverter.hpp"
+
 using namespace Opm::EclIO;
 using EclEntry = EclFile::EclEntry;
 
@@ -123,9 +129,121 @@ static void printHelp() {
               << "-h Print help and exit.\n"
               << "-l List report step numbers in the selected restart file.\n"
               << "-g Convert file to grdecl format.\n"
-              << "-o Specify output file name (only valid with grdecl option).\n"
+              << "-o Specify output file name (only valid with grdecl or -u option).\n"
+              << "-u Rewrite a binary file using OPM extensions (compressed or referenced arrays) in the standard\n"
+              << "   binary format.  The output file name must be given with option -o.\n"
               << "-i Enforce IX standard on output file.\n"
-              << "-r Extract and convert a specific report time step number from a unified restart file. \n\n";
+              << "-r Extract and convert a specific report time step number from a unified restart file. \n"
+              << "-p Pipelined conversion with the given number of decoding threads (0: one per core).\n"
+              << "   Memory use is bounded independently of the file size.  Accepts multiple input files.\n"
+              << "-j Number of files converted concurrently in pipelined mode (default 1).\n\n";
+}
+
+
+std::string outputFileName(const std::string& filename, bool formattedOutput)
+{
+    static const std::map<std::string, std::string> to_formatted {
+        {".GRID"  , ".FGRID"  },
+        {".EGRID" , ".FEGRID" },
+        {".INIT"  , ".FINIT"  },
+        {".SMSPEC", ".FSMSPEC"},
+        {".UNSMRY", ".FUNSMRY"},
+        {".UNRST" , ".FUNRST" },
+        {".RFT"   , ".FRFT"   },
+        {".ESMRY" , ".FESMRY" },
+        {".LGR"  , ".FLGR"},
+    };
+
+    static const std::map<std::string, std::string> to_binary {
+        {".FGRID"  , ".GRID"  },
+        {".FEGRID" , ".EGRID" },
+        {".FINIT"  , ".INIT"  },
+        {".FSMSPEC", ".SMSPEC"},
+        {".FUNSMRY", ".UNSMRY"},
+        {".FUNRST" , ".UNRST" },
+        {".FRFT"   , ".RFT"   },
+        {".FESMRY" , ".ESMRY" },
+        {".FLGR"  , ".LGR"},
+    };
+
+    int p = filename.find_last_of(".");
+    int l = filename.length();
+
+    std::string rootN = filename.substr(0,p);
+    std::string extension = filename.substr(p,l-p);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                 [](unsigned char ckey){ return std::toupper(ckey);});
+
+    if (formattedOutput) {
+        auto search = to_formatted.find(extension);
+        if (search != to_formatted.end())
+            return rootN + search->second;
+        else if (extension.substr(1,1) == "X")
+            return rootN + ".F" + extension.substr(2);
+        else if (extension.substr(1,1) == "S")
+            return rootN + ".A" + extension.substr(2);
+    }
+    else {
+        auto search = to_binary.find(extension);
+        if (search != to_binary.end())
+            return rootN + search->second;
+        else if (extension.substr(1,1) == "F")
+            return rootN + ".X" + extension.substr(2);
+        else if (extension.substr(1,1) == "A")
+            return rootN + ".S" + extension.substr(2);
+    }
+
+    return {};
+}
+
+
+int convertPipelined(const std::vector<std::string>& files,
+                     const EclFileConverter::Options& options,
+                     const std::size_t numConcurrent)
+{
+    std::mutex output_mutex;
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+
+    auto convert = [&]()
+    {
+        for (auto i = next++; i < files.size(); i = next++) {
+            const auto& filename = files[i];
+            try {
+                const auto start = std::chrono::system_clock::now();
+
+                EclFileConverter converter(filename, options);
+                const auto resFile = outputFileName(filename, !converter.formattedInput());
+                if (resFile.empty())
+                    throw std::runtime_error("unknown file type for input file '" + filename + "'");
+
+                converter.write(resFile, !converter.formattedInput());
+
+                std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+
+                std::lock_guard<std::mutex> lock(output_mutex);
+                std::cout << "converted " << filename << " -> " << resFile << ": "
+                          << elapsed_seconds.count() << " seconds" << std::endl;
+            }
+            catch (const std::exception& e) {
+                failed = true;
+
+                std::lock_guard<std::mutex> lock(output_mutex);
+                std::cout << "\n!ERROR, converting " << filename << ": " << e.what() << "\n" << std::endl;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t n = 1; n < std::min(numConcurrent, files.size()); n++)
+        threads.emplace_back(convert);
+
+    convert();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 
@@ -222,33 +340,13 @@ int main(int argc, char **argv)
     bool listProperties            = false;
     bool enforce_ix_output         = false;
     bool to_grdecl                 = false;
-
-    const std::map<std::string, std::string> to_formatted {
-        {".GRID"  , ".FGRID"  },
-        {".EGRID" , ".FEGRID" },
-        {".INIT"  , ".FINIT"  },
-        {".SMSPEC", ".FSMSPEC"},
-        {".UNSMRY", ".FUNSMRY"},
-        {".UNRST" , ".FUNRST" },
-        {".RFT"   , ".FRFT"   },
-        {".ESMRY" , ".FESMRY" },
-        {".LGR"  , ".FLGR"},
-    };
-
-    const std::map<std::string, std::string> to_binary {
-        {".FGRID"  , ".GRID"  },
-        {".FEGRID" , ".EGRID" },
-        {".FINIT"  , ".INIT"  },
-        {".FSMSPEC", ".SMSPEC"},
-        {".FUNSMRY", ".UNSMRY"},
-        {".FUNRST" , ".UNRST" },
-        {".FRFT"   , ".RFT"   },
-        {".FESMRY" , ".ESMRY" },
-        {".FLGR"  , ".LGR"},
-    };
+    bool to_standard               = false;
+    bool pipelined                 = false;
+    std::size_t numConcurrent      = 1;
+    EclFileConverter::Options pipelineOptions;
 
     std::string output_fname{};
-    while ((c = getopt(argc, argv, "hr:ligo:")) != -1) {
+    while ((c = getopt(argc, argv, "hr:liguo:p:j:")) != -1) {
         switch (c) {
         case 'h':
             printHelp();
@@ -259,6 +357,9 @@ int main(int argc, char **argv)
         case 'g':
             to_grdecl = true;
             break;
+        case 'u':
+            to_standard = true;
+            break;
         case 'i':
             enforce_ix_output = true;
             break;
@@ -269,6 +370,13 @@ int main(int argc, char **argv)
         case 'o':
             output_fname = optarg;
             break;
+        case 'p':
+            pipelined = true;
+            pipelineOptions.numWorkers = atoi(optarg);
+            break;
+        case 'j':
+            numConcurrent = std::max(atoi(optarg), 1);
+            break;
         default:
             return EXIT_FAILURE;
         }
@@ -276,11 +384,33 @@ int main(int argc, char **argv)
 
     int argOffset = optind;
 
-    if (!output_fname.empty() && !to_grdecl) {
-        std::cout << "\n!Error, option -o only valid whit option -g \n\n";
+    if (!output_fname.empty() && !to_grdecl && !to_standard) {
+        std::cout << "\n!Error, option -o only valid whit option -g or -u \n\n";
         exit(1);
     }
 
+    if (to_standard && (to_grdecl || output_fname.empty())) {
+        std::cout << "\n!Error, option -u requires option -o and can not be combined with option -g \n\n";
+        exit(1);
+    }
+
+    if (argOffset >= argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    if (pipelined) {
+        if (to_grdecl || to_standard || listProperties || specificReportStepNumber) {
+            std::cout << "\n!Error, option -p can not be combined with options -g, -u, -l or -r \n\n";
+            exit(1);
+        }
+
+        pipelineOptions.ix = enforce_ix_output;
+
+        return convertPipelined(std::vector<std::string>(argv + argOffset, argv + argc),
+                                pipelineOptions, numConcurrent);
+    }
+
     // start reading
     auto start = std::chrono::system_clock::now();
     std::string filename = argv[argOffset];
@@ -368,37 +498,24 @@ int main(int argc, char **argv)
         return 0;
     }
 
-    if (formattedOutput) {
-        auto search = to_formatted.find(extension);
-        if (search != to_formatted.end()){
-            resFile = rootN + search->second;
-        }
-        else if (extension.substr(1,1) == "X") {
-            resFile = rootN + ".F" + extension.substr(2);
-        }
-        else if (extension.substr(1,1) == "S") {
-            resFile = rootN + ".A" + extension.substr(2);
-        }
-        else {
-            std::cout << "\n!ERROR, unknown file type for input file '" << rootN + extension << "'\n" << std::endl;
+    if (to_standard) {
+        if (file1.formattedInput()) {
+            std::cout << "\n!ERROR, option -u requires a binary input file \n" << std::endl;
             exit(1);
         }
+
+        // Compressed and referenced arrays are decoded by EclFile and
+        // written in full.
+        formattedOutput = false;
+        resFile = output_fname;
     }
     else {
-        auto search = to_binary.find(extension);
-        if (search != to_binary.end()){
-            resFile = rootN + search->second;
-        }
-        else if (extension.substr(1,1) == "F") {
-            resFile = rootN + ".X" + extension.substr(2);
-        }
-        else if (extension.substr(1,1) == "A") {
-            resFile = rootN + ".S" + extension.substr(2);
-        }
-        else {
-            std::cout << "\n!ERROR, unknown file type for input file '" << rootN + extension << "'\n" << std::endl;
-            exit(1);
-        }
+        resFile = outputFileName(filename, formattedOutput);
+    }
+
+    if (resFile.empty()) {
+        std::cout << "\n!ERROR, unknown file type for input file '" << rootN + extension << "'\n" << std::endl;
+        exit(1);
     }
 
     std::cout << "\033[1;31m" << "\nconverting  " << argv[argOffset] << " -> " << resFile << "\033[0m\n" << std::endl;
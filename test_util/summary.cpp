@@ -18,13 +18,21 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <getopt.h>
+#include <limits>
+#include <memory>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
+#include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/ExtESmry.hpp>
 
@@ -40,7 +48,238 @@ static void printHelp() {
               << "-h Print help and exit.\n"
               << "-l list all summary vectors.\n"
               << "-n print summary vectors without headers.\n"
-              << "-r extract data only for report steps. \n\n";
+              << "-r extract data only for report steps. \n"
+              << "\nMulti-case mode, all arguments are summary files:\n\n"
+              << "-c comma separated list of vectors or patterns to extract from every case.\n"
+              << "-j number of cases loaded concurrently (default: one per core).\n"
+              << "-o output file (default: CSV on standard output).\n"
+              << "-b write binary output file with the arrays KEYS (column names, TIME first), and\n"
+              << "   for each case CASE (file name) and DATA (columns of REAL values, one after another).\n\n";
+}
+
+
+std::filesystem::path summaryFileName(const std::string& filename)
+{
+    std::filesystem::path inputFileName(filename);
+
+    if (inputFileName.extension()=="")
+        inputFileName+=".SMSPEC";
+
+    return inputFileName;
+}
+
+
+// Requested vectors of a single case, TIME first.
+struct CaseData
+{
+    std::string name;
+    std::vector<std::string> keys;
+    std::vector<std::vector<float>> data;
+    std::string error;
+};
+
+
+template <typename Summary>
+void extractCase(Summary& smry, const std::vector<std::string>& patterns,
+                 bool reportStepsOnly, CaseData& result)
+{
+    std::vector<std::string> keys { "TIME" };
+    for (const auto& pattern : patterns) {
+        if (smry.hasKey(pattern)) {
+            keys.push_back(pattern);
+        } else {
+            const auto list = smry.keywordList(pattern);
+            keys.insert(keys.end(), list.begin(), list.end());
+        }
+    }
+
+    // Duplicates from overlapping patterns.
+    std::vector<std::string> unique;
+    for (const auto& key : keys)
+        if (std::find(unique.begin(), unique.end(), key) == unique.end())
+            unique.push_back(key);
+
+    smry.loadData(unique);
+
+    for (const auto& key : unique) {
+        result.data.push_back(reportStepsOnly ? smry.get_at_rstep(key) : smry.get(key));
+    }
+
+    result.keys = std::move(unique);
+}
+
+
+std::vector<CaseData> extractCases(const std::vector<std::string>& cases,
+                                   const std::vector<std::string>& patterns,
+                                   bool reportStepsOnly, std::size_t numThreads)
+{
+    std::vector<CaseData> result(cases.size());
+    std::atomic<std::size_t> next{0};
+
+    auto work = [&]()
+    {
+        for (auto i = next++; i < cases.size(); i = next++) {
+            auto& caseData = result[i];
+            caseData.name = cases[i];
+
+            try {
+                const auto inputFileName = summaryFileName(cases[i]);
+                const auto ext = inputFileName.extension();
+
+                if ((ext == ".SMSPEC") || (ext == ".FSMSPEC")) {
+                    Opm::EclIO::ESmry esmry(inputFileName);
+                    extractCase(esmry, patterns, reportStepsOnly, caseData);
+                } else if (ext == ".ESMRY") {
+                    Opm::EclIO::ExtESmry ext_esmry(inputFileName);
+                    extractCase(ext_esmry, patterns, reportStepsOnly, caseData);
+                } else {
+                    throw std::runtime_error("invalid input file for summary");
+                }
+            }
+            catch (const std::exception& e) {
+                caseData.keys.clear();
+                caseData.data.clear();
+                caseData.error = e.what();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t n = 1; n < std::min(numThreads, cases.size()); n++)
+        threads.emplace_back(work);
+
+    work();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    return result;
+}
+
+
+// Union of the keys of all cases, in order of first appearance.
+std::vector<std::string> combinedKeys(const std::vector<CaseData>& cases)
+{
+    std::vector<std::string> keys;
+    std::unordered_map<std::string, std::size_t> index;
+
+    for (const auto& caseData : cases)
+        for (const auto& key : caseData.keys)
+            if (index.emplace(key, keys.size()).second)
+                keys.push_back(key);
+
+    return keys;
+}
+
+
+void writeCSV(std::ostream& os, const std::vector<CaseData>& cases,
+              const std::vector<std::string>& keys)
+{
+    os << "CASE";
+    for (const auto& key : keys)
+        os << "," << key;
+    os << "\n";
+
+    os << std::setprecision(std::numeric_limits<float>::max_digits10);
+
+    for (const auto& caseData : cases) {
+        std::vector<const std::vector<float>*> columns;
+        for (const auto& key : keys) {
+            auto pos = std::find(caseData.keys.begin(), caseData.keys.end(), key);
+            columns.push_back(pos == caseData.keys.end()
+                              ? nullptr : &caseData.data[pos - caseData.keys.begin()]);
+        }
+
+        const auto numSteps = caseData.data.empty() ? 0 : caseData.data.front().size();
+        for (std::size_t s = 0; s < numSteps; s++) {
+            os << caseData.name;
+            for (const auto* column : columns) {
+                os << ",";
+                if (column != nullptr)
+                    os << (*column)[s];
+            }
+            os << "\n";
+        }
+    }
+}
+
+
+void writeBinary(const std::string& filename, const std::vector<CaseData>& cases,
+                 const std::vector<std::string>& keys)
+{
+    Opm::EclIO::EclOutput outFile(filename, false);
+
+    outFile.write("KEYS", keys, 72);
+
+    for (const auto& caseData : cases) {
+        const auto numSteps = caseData.data.empty() ? 0 : caseData.data.front().size();
+
+        std::vector<float> data;
+        data.reserve(numSteps * keys.size());
+
+        for (const auto& key : keys) {
+            auto pos = std::find(caseData.keys.begin(), caseData.keys.end(), key);
+            if (pos == caseData.keys.end()) {
+                data.insert(data.end(), numSteps, std::nanf(""));
+            } else {
+                const auto& column = caseData.data[pos - caseData.keys.begin()];
+                data.insert(data.end(), column.begin(), column.end());
+            }
+        }
+
+        outFile.write("CASE", std::vector<std::string>{ caseData.name },
+                      std::max<int>(8, caseData.name.size()));
+        outFile.write("DATA", data);
+    }
+}
+
+
+int runMultiCase(const std::vector<std::string>& cases, const std::string& vectors,
+                 bool reportStepsOnly, std::size_t numThreads,
+                 const std::string& outputFile, bool binary)
+{
+    std::vector<std::string> patterns;
+    std::stringstream ss(vectors);
+    for (std::string item; std::getline(ss, item, ',');)
+        if (!item.empty())
+            patterns.push_back(item);
+
+    if (patterns.empty()) {
+        std::cout << "\n!Runtime Error \n >> No summary keys specified with option -c\n\n";
+        return EXIT_FAILURE;
+    }
+
+    if (binary && outputFile.empty()) {
+        std::cout << "\n!Runtime Error \n >> Binary output requires an output file (-o)\n\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto result = extractCases(cases, patterns, reportStepsOnly, numThreads);
+
+    bool failed = false;
+    for (const auto& caseData : result) {
+        if (!caseData.error.empty()) {
+            std::cerr << "\n!Runtime Error \n >> " << caseData.name << ": " << caseData.error << "\n";
+            failed = true;
+        }
+    }
+
+    const auto keys = combinedKeys(result);
+    if (keys.size() < 2) {
+        std::cout << "\n!Runtime Error \n >> None of the requested keys found in any case\n\n";
+        return EXIT_FAILURE;
+    }
+
+    if (binary) {
+        writeBinary(outputFile, result, keys);
+    } else if (!outputFile.empty()) {
+        std::ofstream os(outputFile);
+        writeCSV(os, result, keys);
+    } else {
+        writeCSV(std::cout, result, keys);
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 void printHeader(const std::vector<std::string>& keyList, const std::vector<int>& width){
@@ -79,8 +318,12 @@ int main(int argc, char **argv) {
     bool reportStepsOnly           = false;
     bool listKeys                  = false;
     bool headers                   = true;
+    bool binaryOutput              = false;
+    std::string multiCaseVectors   {};
+    std::string outputFile         {};
+    std::size_t numThreads         = std::max(std::thread::hardware_concurrency(), 1u);
 
-    while ((c = getopt(argc, argv, "hrnl")) != -1) {
+    while ((c = getopt(argc, argv, "hrnlc:j:o:b")) != -1) {
         switch (c) {
         case 'h':
             printHelp();
@@ -94,6 +337,18 @@ int main(int argc, char **argv) {
         case 'l':
             listKeys=true;
             break;
+        case 'c':
+            multiCaseVectors = optarg;
+            break;
+        case 'j':
+            numThreads = std::max(atoi(optarg), 1);
+            break;
+        case 'o':
+            outputFile = optarg;
+            break;
+        case 'b':
+            binaryOutput = true;
+            break;
         default:
             return EXIT_FAILURE;
         }
@@ -107,14 +362,17 @@ int main(int argc, char **argv) {
         return EXIT_FAILURE;
     }
 
+    if (!multiCaseVectors.empty()) {
+        return runMultiCase(std::vector<std::string>(argv + argOffset, argv + argc),
+                            multiCaseVectors, reportStepsOnly, numThreads,
+                            outputFile, binaryOutput);
+    }
+
     std::unique_ptr<Opm::EclIO::ESmry> esmry;
     std::unique_ptr<Opm::EclIO::ExtESmry> ext_esmry;
 
     std::string filename = argv[argOffset];
-    std::filesystem::path inputFileName(filename);
-
-    if (inputFileName.extension()=="")
-        inputFileName+=".SMSPEC";
+    const std::filesystem::path inputFileName = summaryFileName(filename);
 
     smryFileType filetype;
 
@@ -40,7 +40,9 @@
 
 #include <memory>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <vector>
 
 template <class ScalarT>
 struct Test
@@ -335,6 +337,44 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunction2, Scalar, Types)
                                     1e-2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionLayout, Scalar, Types)
+{
+    using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+
+    Test<Scalar> test;
+    const auto ascending = test.createUniformXTabulatedFunction2(test.testFn3);
+
+    // the same sampling points, appended in descending order
+    Table descending(Table::InterpolationPolicy::Vertical);
+    for (unsigned i = ascending.numX(); i-- > 0; ) {
+        descending.appendXPos(ascending.xAt(i));
+        for (unsigned j = ascending.numY(i); j-- > 0; ) {
+            descending.appendSamplePoint(0, ascending.yAt(i, j), ascending.valueAt(i, j));
+        }
+    }
+
+    const Table copy(ascending.xPos(), ascending.yPos(),
+                     ascending.samples(), ascending.interpolationGuide());
+
+    std::vector<Scalar> x, y;
+    for (unsigned i = 0; i <= 40; ++i) {
+        for (unsigned j = 0; j <= 40; ++j) {
+            x.push_back(-2.0 + i*5.0/40);
+            y.push_back(-4.0 + j*9.0/40);
+        }
+    }
+
+    std::vector<Scalar> result(x.size());
+    ascending.eval(x.size(), x.data(), y.data(), result.data());
+
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        const Scalar expected = ascending.eval(x[k], y[k]);
+        BOOST_CHECK_EQUAL(result[k], expected);
+        BOOST_CHECK_EQUAL(descending.eval(x[k], y[k]), expected);
+        BOOST_CHECK_EQUAL(copy.eval(x[k], y[k]), expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction1, Scalar, Types)
 {
     Test<Scalar> test;
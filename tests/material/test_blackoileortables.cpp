@@ -0,0 +1,110 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Test for the tabulated functions of the polymer, solvent and foam models.
+ */
+#include "config.h"
+
+#define BOOST_TEST_MODULE BlackOilEorTables
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/fluidsystems/blackoilpvt/BlackOilEorTables.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using Tables = Opm::BlackOilEorTables<double>;
+using Function = Tables::Function;
+
+Tables makeTables()
+{
+    Tables tables;
+    // two PLYVISC regions
+    tables.setFunction(Function::PolymerViscosityMultiplier, 0,
+                       std::vector<double>{0.0, 1.0, 2.0},
+                       std::vector<double>{1.0, 3.0, 7.0});
+    tables.setFunction(Function::PolymerViscosityMultiplier, 1,
+                       std::vector<double>{0.0, 2.0},
+                       std::vector<double>{1.0, 2.0});
+    return tables;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Lookup)
+{
+    const auto tables = makeTables();
+
+    BOOST_CHECK(tables.has(Function::PolymerViscosityMultiplier));
+    BOOST_CHECK(!tables.has(Function::FoamMobilityMultiplier));
+    BOOST_CHECK_EQUAL(tables.numRegions(Function::PolymerViscosityMultiplier), 2u);
+
+    BOOST_CHECK_CLOSE(tables.eval(Function::PolymerViscosityMultiplier, 0, 0.5), 2.0, 1e-12);
+    BOOST_CHECK_CLOSE(tables.eval(Function::PolymerViscosityMultiplier, 1, 0.5), 1.25, 1e-12);
+
+    // linear extrapolation beyond the table
+    BOOST_CHECK_CLOSE(tables.eval(Function::PolymerViscosityMultiplier, 0, 3.0), 11.0, 1e-12);
+
+    BOOST_CHECK_THROW(tables.eval(Function::PolymerViscosityMultiplier, 2, 0.5), std::out_of_range);
+    BOOST_CHECK_THROW(tables.eval(Function::FoamAdsorption, 0, 0.5), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Derivatives)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 1>;
+    const auto tables = makeTables();
+
+    const auto c = Evaluation::createVariable(1.5, 0);
+    const auto mult = tables.eval(Function::PolymerViscosityMultiplier, 0, c);
+    BOOST_CHECK_CLOSE(mult.value(), 5.0, 1e-12);
+    BOOST_CHECK_CLOSE(mult.derivative(0), 4.0, 1e-12);
+
+    BOOST_CHECK_CLOSE(tables.evalDerivative(Function::PolymerViscosityMultiplier, 0, 1.5), 4.0, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(Batch)
+{
+    const auto tables = makeTables();
+
+    const std::vector<unsigned> regions {0, 0, 1, 1, 0};
+    const std::vector<double> c {0.5, 1.5, 0.5, 1.0, 2.0};
+
+    std::vector<double> result;
+    tables.evalBatch(Function::PolymerViscosityMultiplier, regions, c, result);
+    BOOST_REQUIRE_EQUAL(result.size(), c.size());
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        BOOST_CHECK_CLOSE(result[i],
+                          tables.eval(Function::PolymerViscosityMultiplier, regions[i], c[i]),
+                          1e-12);
+    }
+
+    BOOST_CHECK_THROW(tables.evalBatch(Function::PolymerViscosityMultiplier,
+                                       std::vector<unsigned>{0}, c, result),
+                      std::invalid_argument);
+}
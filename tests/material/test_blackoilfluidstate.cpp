@@ -36,9 +36,12 @@
 #include <opm/material/densead/Evaluation.hpp>
 #include <opm/material/densead/Math.hpp>
 #include <opm/material/fluidstates/BlackOilFluidState.hpp>
+#include <opm/material/fluidstates/BlackOilFluidStateArray.hpp>
 #include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
 #include <opm/material/checkFluidSystem.hpp>
 
+#include <utility>
+
 using Types = boost::mpl::list<float,double>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(ApiConformance, Scalar, Types)
@@ -53,3 +56,76 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ApiConformance, Scalar, Types)
     FluidState fs{};
     checkFluidState<Evaluation>(fs);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(FluidStateArray, Scalar, Types)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<Scalar>;
+    using Evaluation = Opm::DenseAd::Evaluation<Scalar, 2>;
+    using FluidState = Opm::BlackOilFluidState<Evaluation, FluidSystem,
+                                               /*enableTemperature=*/true,
+                                               /*enableEnergy=*/false,
+                                               /*enableDissolution=*/true,
+                                               /*enableVapwat=*/false,
+                                               /*enableBrine=*/true>;
+    using FluidStateArray = Opm::BlackOilFluidStateArray<Evaluation, FluidSystem,
+                                                         /*enableTemperature=*/true,
+                                                         /*enableEnergy=*/false,
+                                                         /*enableDissolution=*/true,
+                                                         /*enableVapwat=*/false,
+                                                         /*enableBrine=*/true>;
+
+    FluidStateArray states(4);
+    BOOST_CHECK_EQUAL(states.size(), 4u);
+    checkFluidState<Evaluation>(states[0]);
+    checkFluidState<Evaluation>(std::as_const(states)[0]);
+
+    // disabled quantities do not allocate memory
+    BOOST_CHECK(states.RvwArray() == nullptr);
+    BOOST_CHECK(states.enthalpyArray(FluidSystem::oilPhaseIdx) == nullptr);
+
+    for (unsigned cellIdx = 0; cellIdx < states.size(); ++cellIdx) {
+        FluidState fs;
+        fs.setPvtRegionIndex(cellIdx % 2);
+        fs.setTemperature(300.0 + cellIdx);
+        fs.setRs(Evaluation::createVariable(10.0*cellIdx, 1));
+        fs.setRv(1e-4*cellIdx);
+        fs.setSaltConcentration(0.5*cellIdx);
+        for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+            fs.setPressure(phaseIdx, Evaluation::createVariable(1e5*(cellIdx + 1) + phaseIdx, 0));
+            fs.setSaturation(phaseIdx, 0.1*(phaseIdx + 1));
+            fs.setDensity(phaseIdx, 100.0*(phaseIdx + 1) + cellIdx);
+            fs.setInvB(phaseIdx, 1.0 + 0.01*cellIdx);
+        }
+        states[cellIdx].assign(fs);
+    }
+
+    // the arrays hold the values of the cells contiguously
+    const auto* p = states.pressureArray(FluidSystem::gasPhaseIdx);
+    const auto* Rs = states.RsArray();
+    for (unsigned cellIdx = 0; cellIdx < states.size(); ++cellIdx) {
+        BOOST_CHECK_EQUAL(p[cellIdx], states[cellIdx].pressure(FluidSystem::gasPhaseIdx));
+        BOOST_CHECK_EQUAL(Rs[cellIdx].derivative(1), 1.0);
+        BOOST_CHECK_EQUAL(states.pvtRegionIndexArray()[cellIdx], cellIdx % 2);
+        BOOST_CHECK_EQUAL(states.saltConcentrationArray()[cellIdx].value(), 0.5*cellIdx);
+    }
+
+    // writing through a proxy changes the arrays
+    states[2].setSaturation(FluidSystem::waterPhaseIdx, 0.75);
+    BOOST_CHECK_EQUAL(states.saturationArray(FluidSystem::waterPhaseIdx)[2].value(), 0.75);
+
+    // and the copy of a cell agrees with the proxy
+    const auto fs = states[3].toFluidState();
+    BOOST_CHECK_EQUAL(fs.pvtRegionIndex(), 1u);
+    BOOST_CHECK_EQUAL(fs.temperature(0).value(), 303.0);
+    BOOST_CHECK_EQUAL(fs.Rs().value(), 30.0);
+    for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+        BOOST_CHECK_EQUAL(fs.pressure(phaseIdx), states[3].pressure(phaseIdx));
+        BOOST_CHECK_EQUAL(fs.density(phaseIdx), states[3].density(phaseIdx));
+        BOOST_CHECK_EQUAL(fs.invB(phaseIdx), states[3].invB(phaseIdx));
+    }
+
+    // resizing keeps the existing cells
+    states.resize(6);
+    BOOST_CHECK_EQUAL(states[2].saturation(FluidSystem::waterPhaseIdx).value(), 0.75);
+    BOOST_CHECK_EQUAL(states[5].pvtRegionIndex(), 0u);
+}
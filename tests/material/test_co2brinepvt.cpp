@@ -39,7 +39,7 @@
 #endif
 
 //#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
-//#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
 
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
@@ -55,6 +55,8 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -282,3 +284,34 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types)
     ensurePvtApiGas<Scalar>(co2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(TabulatedSolubility, Scalar, Types)
+{
+    const std::vector<Scalar> salinity { 0.05 };
+    const Opm::BrineCo2Pvt<Scalar> exact(salinity);
+    Opm::BrineCo2Pvt<Scalar> tabulated(salinity);
+
+    // supercritical CO2 only, where the solubility is smooth
+    const Scalar maxError = tabulated.tabulateSolubility(310.0, 400.0, 46, 1e6, 4e7, 196);
+    BOOST_CHECK_GE(maxError, 0.0);
+    BOOST_CHECK_LT(maxError, 0.1);
+
+    for (Scalar T = 311.0; T < 400.0; T += 7.3) {
+        for (Scalar p = 1.1e6; p < 4e7; p += 1.37e6) {
+            BOOST_CHECK_SMALL(tabulated.saturatedGasDissolutionFactor(0u, T, p) -
+                              exact.saturatedGasDissolutionFactor(0u, T, p), Scalar(0.1));
+        }
+    }
+
+    // outside of the tables the equations are solved
+    BOOST_CHECK_EQUAL(tabulated.saturatedGasDissolutionFactor(0u, Scalar(450.0), Scalar(1e7)),
+                      exact.saturatedGasDissolutionFactor(0u, Scalar(450.0), Scalar(1e7)));
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar,1>;
+    const auto rs = tabulated.saturatedGasDissolutionFactor(0u, Eval(330.0),
+                                                            Eval::createVariable(1e7, 0));
+    BOOST_CHECK_GT(rs.derivative(0), 0.0);
+
+    BOOST_CHECK_THROW(tabulated.tabulateSolubility(400.0, 310.0, 46, 1e6, 4e7, 196),
+                      std::invalid_argument);
+}
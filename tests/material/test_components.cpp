@@ -75,6 +75,9 @@
 
 #include <opm/json/JsonObject.hpp>
 
+#include <type_traits>
+#include <vector>
+
 template <class Scalar, class Evaluation>
 void testAllComponents()
 {
@@ -548,6 +551,45 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2OClass, Scalar, Types)
     }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(H2OLiquidProperties, Scalar, Types)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<Scalar, 2>;
+    using H2O = Opm::H2O<Scalar>;
+
+    // the fused method must agree with the individual ones up to round-off. In
+    // single precision, the pressure derivative of the liquid density is dominated
+    // by cancellation, so the tolerance is much looser there.
+    const Scalar tol = std::is_same_v<Scalar, float> ? 1e-2 : 1e-10;
+
+    std::vector<Evaluation> T, p;
+    for (Scalar Tval = 280.0; Tval < 620.0; Tval += 20.0) {
+        // the lowest pressure is below the vapor pressure for the hotter states
+        for (Scalar pval = 1e5; pval < 90e6; pval *= 3.0) {
+            T.push_back(Evaluation::createVariable(Tval, 0));
+            p.push_back(Evaluation::createVariable(pval, 1));
+        }
+    }
+
+    const std::size_t n = T.size();
+    std::vector<Evaluation> rho(n), h(n), mu(n);
+    H2O::liquidProperties(n, T.data(), p.data(), rho.data(), h.data(), mu.data());
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const Evaluation rhoRef = H2O::liquidDensity(T[i], p[i]);
+        const Evaluation hRef = H2O::liquidEnthalpy(T[i], p[i]);
+        const Evaluation muRef = H2O::liquidViscosity(T[i], p[i]);
+
+        for (int dvIdx = -1; dvIdx < 2; ++dvIdx) {
+            const auto get = [dvIdx](const Evaluation& x)
+            { return dvIdx < 0 ? x.value() : x.derivative(dvIdx); };
+
+            BOOST_CHECK(close_at_tolerance(get(rho[i]), get(rhoRef), tol));
+            BOOST_CHECK(close_at_tolerance(get(h[i]), get(hRef), tol));
+            BOOST_CHECK(close_at_tolerance(get(mu[i]), get(muRef), tol));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(BrineWithH2OClass, Scalar, Types)
 {
     using Evaluation = Opm::DenseAd::Evaluation<Scalar, 3>;
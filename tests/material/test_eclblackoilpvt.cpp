@@ -44,6 +44,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/DryGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp>
 
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
@@ -58,7 +59,9 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
+#include <cstddef>
 #include <tuple>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -138,6 +141,52 @@ static constexpr const char* deckString1 =
     "/\n"
     "\n";
 
+// two PVTWSALT regions for the brine PVT.
+static constexpr const char* deckStringBrine =
+    "RUNSPEC\n"
+    "\n"
+    "DIMENS\n"
+    "   10 10 3 /\n"
+    "\n"
+    "TABDIMS\n"
+    " * 2 /\n"
+    "\n"
+    "WATER\n"
+    "BRINE\n"
+    "\n"
+    "METRIC\n"
+    "\n"
+    "GRID\n"
+    "\n"
+    "DX\n"
+    "   300*1000 /\n"
+    "DY\n"
+    "   300*1000 /\n"
+    "DZ\n"
+    "   300*20 /\n"
+    "\n"
+    "TOPS\n"
+    "   100*1234 /\n"
+    "\n"
+    "PORO\n"
+    "  300*0.15 /\n"
+    "PROPS\n"
+    "\n"
+    "DENSITY\n"
+    "      859.5  1033.0    0.854  /\n"
+    "      860.04 1033.0    0.853  /\n"
+    "\n"
+    "PVTWSALT\n"
+    " 200.0 0.0 /\n"
+    "  0.0  1.00 4.0e-5 0.50 1.0e-5\n"
+    " 50.0  1.01 4.2e-5 0.55 1.1e-5\n"
+    "100.0  1.03 4.5e-5 0.62 1.3e-5\n"
+    "200.0  1.06 4.9e-5 0.75 1.6e-5 /\n"
+    " 250.0 0.0 /\n"
+    "  0.0  1.02 4.1e-5 0.52 1.2e-5\n"
+    "150.0  1.05 4.6e-5 0.66 1.4e-5 /\n"
+    "\n";
+
 template <class Evaluation, class OilPvt, class GasPvt, class WaterPvt>
 void ensurePvtApi(const OilPvt& oilPvt, const GasPvt& gasPvt, const WaterPvt& waterPvt)
 {
@@ -263,6 +312,81 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ApiConformance, Scalar, Types)
     ensurePvtApi<FooEval>(oilPvt, gasPvt, waterPvt);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, Types)
+{
+    Opm::GasPvtMultiplexer<Scalar> gasPvt;
+    Opm::OilPvtMultiplexer<Scalar> oilPvt;
+    Opm::WaterPvtMultiplexer<Scalar> waterPvt;
+
+    gasPvt.initFromState(eclState, schedule);
+    oilPvt.initFromState(eclState, schedule);
+    waterPvt.initFromState(eclState, schedule);
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    const std::vector<unsigned> regionIdx { 0, 1, 1, 0, 1 };
+    const std::size_t numCells = regionIdx.size();
+
+    std::vector<Eval> temperature, pressure, ratio, zero;
+    for (std::size_t i = 0; i < numCells; ++i) {
+        temperature.emplace_back(273.15 + 20.0 + i);
+        pressure.emplace_back(Eval::createVariable(1e5 + 4e6*i, 0));
+        ratio.emplace_back(Eval::createVariable(10.0*i, 1));
+        zero.emplace_back(0.0);
+    }
+
+    std::vector<Eval> result(numCells);
+    const auto check = [&result](std::size_t i, const Eval& expected)
+    {
+        BOOST_CHECK_EQUAL(result[i].value(), expected.value());
+        for (int d = 0; d < Eval::numVars; ++d) {
+            BOOST_CHECK_EQUAL(result[i].derivative(d), expected.derivative(d));
+        }
+    };
+
+    oilPvt.inverseFormationVolumeFactor(numCells, regionIdx.data(), temperature.data(),
+                                        pressure.data(), ratio.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, oilPvt.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i], ratio[i]));
+    }
+
+    oilPvt.viscosity(numCells, regionIdx.data(), temperature.data(),
+                     pressure.data(), ratio.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, oilPvt.viscosity(regionIdx[i], temperature[i], pressure[i], ratio[i]));
+    }
+
+    oilPvt.saturatedGasDissolutionFactor(numCells, regionIdx.data(), temperature.data(),
+                                         pressure.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, oilPvt.saturatedGasDissolutionFactor(regionIdx[i], temperature[i], pressure[i]));
+    }
+
+    gasPvt.inverseFormationVolumeFactor(numCells, regionIdx.data(), temperature.data(),
+                                        pressure.data(), zero.data(), zero.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, gasPvt.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i], zero[i], zero[i]));
+    }
+
+    gasPvt.viscosity(numCells, regionIdx.data(), temperature.data(),
+                     pressure.data(), zero.data(), zero.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, gasPvt.viscosity(regionIdx[i], temperature[i], pressure[i], zero[i], zero[i]));
+    }
+
+    waterPvt.inverseFormationVolumeFactor(numCells, regionIdx.data(), temperature.data(),
+                                          pressure.data(), zero.data(), zero.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, waterPvt.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i], zero[i], zero[i]));
+    }
+
+    waterPvt.viscosity(numCells, regionIdx.data(), temperature.data(),
+                       pressure.data(), zero.data(), zero.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, waterPvt.viscosity(regionIdx[i], temperature[i], pressure[i], zero[i], zero[i]));
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
 {
     constexpr Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e3;
@@ -295,4 +419,76 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
                         refTmp << ". (is " << tmp << ")");
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityBrine, Scalar, Types)
+{
+    const auto brineDeck = Opm::Parser().parseString(deckStringBrine);
+    const Opm::EclipseState brineState(brineDeck);
+    const Opm::Schedule brineSchedule(brineDeck, brineState, python);
+
+    Opm::ConstantCompressibilityBrinePvt<Scalar> brinePvt;
+    brinePvt.initFromState(brineState, brineSchedule);
+
+    constexpr Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e3;
+
+    // at the reference pressure, the PVTWSALT values are reproduced, in SI units.
+    const Scalar muRef = brinePvt.viscosity(/*regionIdx=*/0,
+                                            /*temperature=*/Scalar{273.15 + 20.0},
+                                            /*pressure=*/Scalar{200e5},
+                                            /*Rsw=*/Scalar{0.0},
+                                            /*saltconcentration=*/Scalar{75.0});
+    BOOST_CHECK_CLOSE(muRef, Scalar{0.585e-3}, 100*tolerance);
+
+    const Scalar bRef = brinePvt.inverseFormationVolumeFactor(/*regionIdx=*/1,
+                                                              Scalar{273.15 + 20.0},
+                                                              Scalar{250e5},
+                                                              Scalar{0.0},
+                                                              Scalar{150.0});
+    BOOST_CHECK_CLOSE(bRef, Scalar{1.0/1.05}, 100*tolerance);
+
+    // the batched evaluation carries the segment of the salt table from one
+    // cell to the next and must agree with the single-cell evaluation.
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    const std::vector<unsigned> regionIdx { 0, 0, 0, 1, 1, 0, 0 };
+    const std::vector<Scalar> salt { 10.0, 60.0, 250.0, 10.0, 200.0, 120.0, -5.0 };
+    const std::size_t numCells = regionIdx.size();
+
+    std::vector<Eval> temperature, pressure, saltconcentration, zero;
+    for (std::size_t i = 0; i < numCells; ++i) {
+        temperature.emplace_back(273.15 + 20.0);
+        pressure.emplace_back(Eval::createVariable(100e5 + 50e5*i, 0));
+        saltconcentration.emplace_back(Eval::createVariable(salt[i], 1));
+        zero.emplace_back(0.0);
+    }
+
+    Opm::WaterPvtMultiplexer<Scalar, /*enableThermal=*/false, /*enableBrine=*/true> waterPvt;
+    waterPvt.initFromState(brineState, brineSchedule);
+    BOOST_REQUIRE(waterPvt.approach() == Opm::WaterPvtApproach::ConstantCompressibilityBrine);
+
+    std::vector<Eval> result(numCells);
+    const auto check = [&result](std::size_t i, const Eval& expected)
+    {
+        BOOST_CHECK_EQUAL(result[i].value(), expected.value());
+        for (int d = 0; d < Eval::numVars; ++d) {
+            BOOST_CHECK_EQUAL(result[i].derivative(d), expected.derivative(d));
+        }
+    };
+
+    waterPvt.inverseFormationVolumeFactor(numCells, regionIdx.data(), temperature.data(),
+                                          pressure.data(), zero.data(),
+                                          saltconcentration.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, brinePvt.inverseFormationVolumeFactor(regionIdx[i], temperature[i], pressure[i],
+                                                       zero[i], saltconcentration[i]));
+    }
+
+    waterPvt.viscosity(numCells, regionIdx.data(), temperature.data(),
+                       pressure.data(), zero.data(),
+                       saltconcentration.data(), result.data());
+    for (std::size_t i = 0; i < numCells; ++i) {
+        check(i, brinePvt.viscosity(regionIdx[i], temperature[i], pressure[i],
+                                    zero[i], saltconcentration[i]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
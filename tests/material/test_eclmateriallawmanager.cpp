@@ -47,6 +47,7 @@
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Units/Units.hpp>
 
 // values of strings taken from the SPE1 test case1 of opm-data
 static constexpr const char* fam1DeckString =
@@ -964,3 +965,255 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    using FluidState = typename Fixture<Scalar>::FluidState;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(fam1DeckString);
+    const Opm::EclipseState eclState(deck);
+
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    std::vector<FluidState> fluidStates(n);
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        const Scalar Sw = 0.2 + Scalar(elemIdx % 7) / 20;
+        const Scalar Sg = Scalar(elemIdx % 5) / 20;
+        fluidStates[elemIdx].setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+        fluidStates[elemIdx].setSaturation(Fixture<Scalar>::oilPhaseIdx, 1 - Sw - Sg);
+        fluidStates[elemIdx].setSaturation(Fixture<Scalar>::gasPhaseIdx, Sg);
+    }
+
+    std::vector<std::array<Scalar, numPhases>> kr(n);
+    std::vector<std::array<Scalar, numPhases>> pc(n);
+    materialLawManager.relativePermeabilities(kr, fluidStates);
+    materialLawManager.capillaryPressures(pc, fluidStates);
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        std::array<Scalar, numPhases> krCell = {0.0, 0.0, 0.0};
+        std::array<Scalar, numPhases> pcCell = {0.0, 0.0, 0.0};
+        MaterialLaw::relativePermeabilities(krCell,
+                                            materialLawManager.materialLawParams(elemIdx),
+                                            fluidStates[elemIdx]);
+        MaterialLaw::capillaryPressures(pcCell,
+                                        materialLawManager.materialLawParams(elemIdx),
+                                        fluidStates[elemIdx]);
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            BOOST_CHECK_EQUAL(kr[elemIdx][phaseIdx], krCell[phaseIdx]);
+            BOOST_CHECK_EQUAL(pc[elemIdx][phaseIdx], pcCell[phaseIdx]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedHysteresisUpdate, Scalar, Types)
+{
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    using FluidState = typename Fixture<Scalar>::FluidState;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(hysterDeckString);
+    const Opm::EclipseState eclState(deck);
+
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager cellwiseManager;
+    cellwiseManager.initFromState(eclState);
+    cellwiseManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager batchedManager;
+    batchedManager.initFromState(eclState);
+    batchedManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    BOOST_REQUIRE(batchedManager.enableHysteresis());
+
+    // drain and then imbibe, so that the batched update must both change the
+    // stored extremes and leave them alone
+    std::vector<FluidState> fluidStates(n);
+    std::vector<char> changed(n, 0);
+    for (int step = 0; step < 8; ++step) {
+        const int k = (step < 4) ? step : 7 - step;
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            const Scalar Sw = 0.2 + Scalar((elemIdx + k) % 7) / 20;
+            const Scalar Sg = Scalar(k) / 20;
+            fluidStates[elemIdx].setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+            fluidStates[elemIdx].setSaturation(Fixture<Scalar>::oilPhaseIdx, 1 - Sw - Sg);
+            fluidStates[elemIdx].setSaturation(Fixture<Scalar>::gasPhaseIdx, Sg);
+        }
+
+        bool anyChanged = false;
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            const bool cellChanged = cellwiseManager.updateHysteresis(fluidStates[elemIdx], elemIdx);
+            anyChanged = anyChanged || cellChanged;
+            changed[elemIdx] = cellChanged;
+        }
+
+        std::vector<char> batchedChanged(n, 0);
+        BOOST_CHECK_EQUAL(batchedManager.updateHysteresis(fluidStates, batchedChanged), anyChanged);
+
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            BOOST_CHECK_EQUAL(batchedChanged[elemIdx] != 0, changed[elemIdx] != 0);
+
+            std::array<Scalar,3> cellwise = {0.0, 0.0, 0.0};
+            std::array<Scalar,3> batched = {0.0, 0.0, 0.0};
+            cellwiseManager.oilWaterHysteresisParams(cellwise[0], cellwise[1], cellwise[2], elemIdx);
+            batchedManager.oilWaterHysteresisParams(batched[0], batched[1], batched[2], elemIdx);
+            for (unsigned i = 0; i < 3; ++i) {
+                BOOST_CHECK_EQUAL(cellwise[i], batched[i]);
+            }
+
+            cellwiseManager.gasOilHysteresisParams(cellwise[0], cellwise[1], cellwise[2], elemIdx);
+            batchedManager.gasOilHysteresisParams(batched[0], batched[1], batched[2], elemIdx);
+            for (unsigned i = 0; i < 3; ++i) {
+                BOOST_CHECK_EQUAL(cellwise[i], batched[i]);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SharedRegionParams, Scalar, Types)
+{
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+
+    // use STONE1 so that the two-phase parameters are held by pointer
+    std::string deckString = fam1DeckString;
+    deckString.insert(deckString.find("PROPS\n") + 6, "\nSTONE1\n");
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    const auto maxPcow = [&materialLawManager](unsigned elemIdx)
+    {
+        const auto& params = materialLawManager.materialLawParams(elemIdx);
+        BOOST_REQUIRE(params.approach() == Opm::EclMultiplexerApproach::Stone1);
+        return params.template getRealParams<Opm::EclMultiplexerApproach::Stone1>()
+            .oilWaterParams().drainageParams().scaledPoints().maxPcnw();
+    };
+
+    // modifying the end points of one cell must not affect the other cells of its
+    // saturation region, even if they initially share their parameters
+    const Scalar origMaxPcow = maxPcow(1);
+    const Scalar newMaxPcow = origMaxPcow + 123;
+    materialLawManager.applyRestartSwatInit(0, newMaxPcow);
+    BOOST_CHECK_EQUAL(maxPcow(0), newMaxPcow);
+    for (unsigned elemIdx = 1; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK_EQUAL(maxPcow(elemIdx), origMaxPcow);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(EpsGridPropertiesOverriddenCells)
+{
+    // SWL equals the connate water saturation of the SWOF table in all but
+    // the first ten cells
+    std::string deckString = fam1DeckString;
+    deckString.insert(deckString.find("FIELD\n"), "ENDSCALE\n/\n\n");
+    deckString += "\nSWL\n  10*0.2 290*0.12 /\n"
+                  "\nSGU\n  300*0.88 /\n";
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    const Opm::EclEpsGridProperties epsProps(eclState, /*useImbibition=*/false);
+    for (unsigned cell = 0; cell < 300; ++cell) {
+        if (cell < 10) {
+            BOOST_REQUIRE(epsProps.swl(cell) != nullptr);
+            BOOST_CHECK_CLOSE(*epsProps.swl(cell), 0.2, 1e-10);
+        }
+        else {
+            BOOST_CHECK(epsProps.swl(cell) == nullptr);
+        }
+
+        // keywords which are absent or do not differ in any cell
+        BOOST_CHECK(epsProps.sgl(cell) == nullptr);
+        BOOST_CHECK(epsProps.sgu(cell) == nullptr);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(EpsGridPropertiesLeverettFactors)
+{
+    std::string deckString = fam1DeckString;
+    deckString.insert(deckString.find("FIELD\n"), "ENDSCALE\n/\n\n");
+    deckString.insert(deckString.find("PROPS\n"),
+                      "PERMX\n  300*100 /\n"
+                      "PERMZ\n  150*10 150*40 /\n"
+                      "JFUNC\n  WATER 22.0 1* 0.5 0.5 Z /\n");
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    const Opm::EclEpsGridProperties epsProps(eclState, /*useImbibition=*/false);
+    for (unsigned cell = 0; cell < 300; ++cell) {
+        // Z direction permeability in mD (the input is converted to m^2 using
+        // the darcy, the documented formula uses 1.01325e15 mD/m^2)
+        const double permz = ((cell < 150) ? 10.0 : 40.0)
+            * Opm::prefix::milli * Opm::unit::darcy * 1.01325e15;
+        const double expected = std::sqrt(0.15) / std::sqrt(permz) * 22.0 * 0.318316e5;
+
+        BOOST_CHECK_CLOSE(epsProps.pcowLeverettFactor(cell), expected, 1e-10);
+        BOOST_CHECK_EQUAL(epsProps.pcgoLeverettFactor(cell), 1.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(DirectionalParamsPool, Scalar, Types)
+{
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using FluidState = typename Fixture<Scalar>::FluidState;
+    using Dir = Opm::FaceDir::DirEnum;
+
+    std::string deckString = fam1DeckString;
+    deckString += "\nREGIONS\n"
+                  "\nKRNUMX\n  300*1 /\n"
+                  "\nKRNUMY\n  300*1 /\n"
+                  "\nKRNUMZ\n  300*1 /\n";
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+    BOOST_REQUIRE(materialLawManager.hasDirectionalRelperms());
+
+    FluidState fs;
+    fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, 0.4);
+    fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, 0.4);
+    fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, 0.2);
+
+    std::array<Scalar, 3> kr{};
+    std::array<Scalar, 3> krDir{};
+    MaterialLaw::relativePermeabilities(kr, materialLawManager.materialLawParams(0), fs);
+
+    // all cells use the unscaled end points of region 1, so they share the
+    // parameter object of each direction
+    for (const Dir dir : {Dir::XPlus, Dir::YPlus, Dir::ZPlus}) {
+        const auto& params = materialLawManager.materialLawParams(0, dir);
+        for (unsigned elemIdx = 1; elemIdx < n; ++elemIdx) {
+            BOOST_CHECK(&materialLawManager.materialLawParams(elemIdx, dir) == &params);
+        }
+
+        MaterialLaw::relativePermeabilities(krDir, params, fs);
+        for (unsigned phaseIdx = 0; phaseIdx < 3; ++phaseIdx) {
+            BOOST_CHECK_CLOSE(krDir[phaseIdx], kr[phaseIdx], 1e-5);
+        }
+    }
+}
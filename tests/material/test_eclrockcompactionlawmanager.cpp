@@ -0,0 +1,240 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief This is the unit test for the class which evaluates the ECL rock
+ *        compaction multipliers.
+ */
+#include "config.h"
+
+#if !HAVE_ECL_INPUT
+#error "The test for EclRockCompactionLawManager requires eclipse input support in opm-common"
+#endif
+
+#define BOOST_TEST_MODULE EclRockCompactionLawManager
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/fluidmatrixinteractions/EclRockCompactionLawManager.hpp>
+
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr const char* rocktabDeckString = R"(
+RUNSPEC
+DIMENS
+   4 1 1 /
+OIL
+WATER
+ROCKCOMP
+   'IRREVERS' 2 /
+GRID
+DX
+   4*1 /
+DY
+   4*1 /
+DZ
+   4*1 /
+TOPS
+   4*0 /
+PORO
+   4*0.2 /
+PROPS
+ROCKTAB
+   100 0.9 0.8
+   300 1.1 1.2 /
+   100 1.0 1.0
+   200 2.0 3.0 /
+OVERBURD
+   0   10
+   100 20 /
+   0   0
+   100 1 /
+REGIONS
+ROCKNUM
+   1 2 2 1 /
+)";
+
+constexpr const char* rock2dDeckString = R"(
+RUNSPEC
+DIMENS
+   4 1 1 /
+OIL
+WATER
+ROCKCOMP
+   'REVERS' 1 'YES' /
+GRID
+DX
+   4*1 /
+DY
+   4*1 /
+DZ
+   4*1 /
+TOPS
+   4*0 /
+PORO
+   4*0.2 /
+PROPS
+ROCK2D
+   100  1.0  1.2 /
+   300  0.8  1.0 /
+/
+ROCKWNOD
+   0.0
+   0.5 /
+)";
+
+constexpr double bar = 1.0e5;
+
+using RockCompactionLawManager = Opm::EclRockCompactionLawManager<double>;
+using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+
+std::vector<unsigned> intLookup(const Opm::FieldPropsManager& fp, const std::string& name,
+                                bool needsTranslation)
+{
+    const auto& raw = fp.get_int(name);
+    std::vector<unsigned> dest(raw.size());
+    for (std::size_t i = 0; i < raw.size(); ++i)
+        dest[i] = raw[i] - needsTranslation;
+    return dest;
+}
+
+RockCompactionLawManager makeManager(const std::string& deckString)
+{
+    const auto deck = Opm::Parser{}.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+    const std::size_t n = eclState.getInputGrid().getCartesianSize();
+
+    RockCompactionLawManager manager;
+    manager.initParamsForElements(eclState, n, {0.0, 50.0, 50.0, 100.0}, intLookup);
+    return manager;
+}
+
+// The batched evaluation must reproduce the per cell one.
+void checkBatched(const RockCompactionLawManager& manager,
+                  const std::vector<Evaluation>& pressures,
+                  const std::vector<Evaluation>& sws)
+{
+    std::vector<Evaluation> poro(pressures.size());
+    std::vector<Evaluation> trans(pressures.size());
+    manager.poreVolumeMultipliers(poro, pressures, sws);
+    manager.transmissibilityMultipliers(trans, pressures, sws);
+
+    for (unsigned elemIdx = 0; elemIdx < pressures.size(); ++elemIdx) {
+        const auto p = manager.poreVolumeMultiplier(elemIdx, pressures[elemIdx], sws[elemIdx]);
+        const auto t = manager.transmissibilityMultiplier(elemIdx, pressures[elemIdx], sws[elemIdx]);
+        BOOST_CHECK_EQUAL(poro[elemIdx].value(), p.value());
+        BOOST_CHECK_EQUAL(poro[elemIdx].derivative(0), p.derivative(0));
+        BOOST_CHECK_EQUAL(poro[elemIdx].derivative(1), p.derivative(1));
+        BOOST_CHECK_EQUAL(trans[elemIdx].value(), t.value());
+        BOOST_CHECK_EQUAL(trans[elemIdx].derivative(0), t.derivative(0));
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Rocktab)
+{
+    auto manager = makeManager(rocktabDeckString);
+
+    BOOST_CHECK(manager.active());
+    BOOST_CHECK(manager.irreversible());
+    BOOST_CHECK(!manager.waterCompaction());
+    BOOST_CHECK_EQUAL(manager.rockTableIdx(0), 0U);
+    BOOST_CHECK_EQUAL(manager.rockTableIdx(1), 1U);
+    BOOST_CHECK_CLOSE(manager.overburdenPressure(0), 10*bar, 1e-12);
+    BOOST_CHECK_CLOSE(manager.overburdenPressure(3), 20*bar, 1e-12);
+    BOOST_CHECK_CLOSE(manager.overburdenPressure(1), 0.5*bar, 1e-12);
+
+    std::vector<Evaluation> pressures;
+    std::vector<Evaluation> sws;
+    for (unsigned elemIdx = 0; elemIdx < 4; ++elemIdx) {
+        pressures.push_back(Evaluation::createVariable((210.0 + 10*elemIdx)*bar, 0));
+        sws.push_back(Evaluation::createVariable(0.2, 1));
+    }
+
+    // effective pressure 200 bar in the first table
+    const auto mult = manager.poreVolumeMultiplier(0, pressures[0], sws[0]);
+    BOOST_CHECK_CLOSE(mult.value(), 1.0, 1e-10);
+    BOOST_CHECK_CLOSE(mult.derivative(0), 0.2/(200*bar), 1e-10);
+    BOOST_CHECK_EQUAL(mult.derivative(1), 0.0);
+    BOOST_CHECK_CLOSE(manager.transmissibilityMultiplier(0, pressures[0], sws[0]).value(), 1.0, 1e-10);
+
+    checkBatched(manager, pressures, sws);
+
+    // the compaction is not reversed when the pressure rises again
+    manager.updateHysteresis(std::vector<double>(4, 150*bar), std::vector<double>(4, 0.2));
+    BOOST_CHECK_EQUAL(manager.minPressure(0), 150*bar);
+
+    const auto compacted = manager.poreVolumeMultiplier(0, pressures[0], sws[0]);
+    BOOST_CHECK_CLOSE(compacted.value(), 0.9 + 0.2*40/200, 1e-10);
+    BOOST_CHECK_EQUAL(compacted.derivative(0), 0.0);
+
+    checkBatched(manager, pressures, sws);
+}
+
+BOOST_AUTO_TEST_CASE(Rock2d)
+{
+    auto manager = makeManager(rock2dDeckString);
+
+    BOOST_CHECK(manager.active());
+    BOOST_CHECK(!manager.irreversible());
+    BOOST_CHECK(manager.waterCompaction());
+
+    manager.setInitialWaterSaturation({0.1, 0.2, 0.3, 0.4});
+
+    std::vector<Evaluation> pressures;
+    std::vector<Evaluation> sws;
+    for (unsigned elemIdx = 0; elemIdx < 4; ++elemIdx) {
+        pressures.push_back(Evaluation::createVariable(200.0*bar, 0));
+        sws.push_back(Evaluation::createVariable(0.35, 1));
+    }
+
+    // saturation increase 0.25 at 200 bar
+    const auto mult = manager.poreVolumeMultiplier(0, pressures[0], sws[0]);
+    BOOST_CHECK_CLOSE(mult.value(), 1.0, 1e-10);
+    BOOST_CHECK_CLOSE(mult.derivative(1), 0.2/0.5, 1e-10);
+
+    // no ROCK2DTR
+    BOOST_CHECK_EQUAL(manager.transmissibilityMultiplier(0, pressures[0], sws[0]).value(), 1.0);
+
+    checkBatched(manager, pressures, sws);
+
+    // the maximum water saturation is used once it exceeds the current one
+    manager.updateHysteresis(std::vector<double>(4, 200*bar), std::vector<double>(4, 0.6));
+    BOOST_CHECK_EQUAL(manager.maxWaterSaturation(0), 0.6);
+
+    const auto swollen = manager.poreVolumeMultiplier(0, pressures[0], sws[0]);
+    BOOST_CHECK_CLOSE(swollen.value(), 1.1, 1e-10);
+    BOOST_CHECK_EQUAL(swollen.derivative(1), 0.0);
+
+    checkBatched(manager, pressures, sws);
+}
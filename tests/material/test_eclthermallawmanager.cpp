@@ -0,0 +1,200 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief This is the unit test for the class which manages the parameters for the ECL
+ *        thermal laws.
+ */
+#include "config.h"
+
+#if !HAVE_ECL_INPUT
+#error "The test for EclThermalLawManager requires eclipse input support in opm-common"
+#endif
+
+#define BOOST_TEST_MODULE EclThermalLawManager
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+#include <opm/material/fluidsystems/BlackOilDefaultIndexTraits.hpp>
+#include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+#include <opm/material/thermal/EclThermalLawManager.hpp>
+
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr const char* heatcrDeckString = R"(
+RUNSPEC
+DIMENS
+   4 1 1 /
+OIL
+GAS
+WATER
+THERMAL
+GRID
+DX
+   4*1 /
+DY
+   4*1 /
+DZ
+   4*1 /
+TOPS
+   4*0 /
+PORO
+   0.1 0.2 0.3 0.4 /
+HEATCR
+   1000 2000 3000 4000 /
+HEATCRT
+   1 2 3 4 /
+THCONR
+   10 20 30 40 /
+THCONSF
+   0.1 0.2 0.3 0.4 /
+)";
+
+constexpr const char* specrockDeckString = R"(
+RUNSPEC
+DIMENS
+   4 1 1 /
+OIL
+GAS
+WATER
+THERMAL
+TABDIMS
+   2 /
+GRID
+DX
+   4*1 /
+DY
+   4*1 /
+DZ
+   4*1 /
+TOPS
+   4*0 /
+PORO
+   0.1 0.2 0.3 0.4 /
+THCROCK
+   1 2 3 4 /
+THCOIL
+   4*0.5 /
+THCGAS
+   4*0.1 /
+THCWATER
+   4*0.6 /
+PROPS
+SPECROCK
+   10  1000
+   100 1500 /
+   10  2000
+   100 2500 /
+REGIONS
+SATNUM
+   1 2 2 1 /
+)";
+
+using FluidSystem = Opm::BlackOilFluidSystem<double, Opm::BlackOilDefaultIndexTraits>;
+using ThermalLawManager = Opm::EclThermalLawManager<double, FluidSystem>;
+using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+using FluidState = Opm::SimpleModularFluidState<Evaluation,
+                                                /*numPhases=*/3,
+                                                /*numComponents=*/3,
+                                                FluidSystem,
+                                                /*storePressure=*/false,
+                                                /*storeTemperature=*/true,
+                                                /*storeComposition=*/false,
+                                                /*storeFugacity=*/false,
+                                                /*storeSaturation=*/true,
+                                                /*storeDensity=*/false,
+                                                /*storeViscosity=*/false,
+                                                /*storeEnthalpy=*/false>;
+
+std::vector<double> doubleLookup(const Opm::FieldPropsManager& fp, const std::string& name)
+{ return fp.get_double(name); }
+
+std::vector<unsigned> intLookup(const Opm::FieldPropsManager& fp, const std::string& name,
+                                bool needsTranslation)
+{
+    const auto& raw = fp.get_int(name);
+    std::vector<unsigned> dest(raw.size());
+    for (std::size_t i = 0; i < raw.size(); ++i)
+        dest[i] = raw[i] - needsTranslation;
+    return dest;
+}
+
+void checkBatchedEvaluation(const std::string& deckString)
+{
+    FluidSystem::initBegin(/*numPvtRegions=*/1);
+
+    const auto deck = Opm::Parser{}.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+    const std::size_t n = eclState.getInputGrid().getCartesianSize();
+
+    ThermalLawManager manager;
+    manager.initParamsForElements(eclState, n, doubleLookup, intLookup);
+
+    std::vector<FluidState> fluidStates(n);
+    for (std::size_t elemIdx = 0; elemIdx < n; ++elemIdx) {
+        const auto temperature = Evaluation::createVariable(300.0 + 20.0*elemIdx, 0);
+        for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx)
+            fluidStates[elemIdx].setTemperature(phaseIdx, temperature);
+        fluidStates[elemIdx].setSaturation(FluidSystem::gasPhaseIdx,
+                                           Evaluation::createVariable(0.1*elemIdx, 1));
+    }
+
+    std::vector<Evaluation> energies(n);
+    std::vector<Evaluation> conductivities(n);
+    manager.solidInternalEnergies(energies, fluidStates);
+    manager.thermalConductivities(conductivities, fluidStates);
+
+    for (std::size_t elemIdx = 0; elemIdx < n; ++elemIdx) {
+        const auto energy = ThermalLawManager::SolidEnergyLaw::solidInternalEnergy(
+            manager.solidEnergyLawParams(elemIdx), fluidStates[elemIdx]);
+        const auto conductivity = ThermalLawManager::ThermalConductionLaw::thermalConductivity(
+            manager.thermalConductionLawParams(elemIdx), fluidStates[elemIdx]);
+
+        BOOST_CHECK_CLOSE(energies[elemIdx].value(), energy.value(), 1e-12);
+        BOOST_CHECK_CLOSE(energies[elemIdx].derivative(0), energy.derivative(0), 1e-12);
+        BOOST_CHECK_CLOSE(conductivities[elemIdx].value(), conductivity.value(), 1e-12);
+        BOOST_CHECK_EQUAL(conductivities[elemIdx].derivative(1), conductivity.derivative(1));
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(BatchedHeatcrThconr)
+{
+    checkBatchedEvaluation(heatcrDeckString);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedSpecrockThc)
+{
+    checkBatchedEvaluation(specrockDeckString);
+}
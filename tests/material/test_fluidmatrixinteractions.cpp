@@ -50,6 +50,7 @@
 #include <opm/material/fluidmatrixinteractions/EffToAbsLaw.hpp>
 #include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterial.hpp>
 #include <opm/material/fluidmatrixinteractions/TwoPhaseLETCurves.hpp>
+#include <opm/material/fluidmatrixinteractions/TwoPhaseLawTabulation.hpp>
 #include <opm/material/fluidmatrixinteractions/SplineTwoPhaseMaterial.hpp>
 #include <opm/material/fluidmatrixinteractions/ThreePhaseParkerVanGenuchten.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLaw.hpp>
@@ -424,3 +425,74 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ApiConformance, Scalar, Types)
         testTwoPhaseSatApi<MaterialLaw, TwoPhaseFluidState>();
     }
 }
+
+BOOST_AUTO_TEST_CASE(TwoPhaseTabulation)
+{
+    using Scalar = double;
+    using Traits = Opm::TwoPhaseMaterialTraits<Scalar, /*wettingPhaseIdx=*/0, /*nonWettingPhaseIdx=*/1>;
+
+    const Scalar pcTol = 1.0;
+    const Scalar krTol = 1e-4;
+
+    {
+        using Law = Opm::BrooksCorey<Traits>;
+        using Tabulation = Opm::TwoPhaseLawTabulation<Law>;
+
+        Law::Params params;
+        params.setEntryPressure(1e4);
+        params.setLambda(2.0);
+        params.finalize();
+
+        // the capillary pressure is singular at Sw = 0
+        BOOST_CHECK_THROW(Tabulation::tabulate(params, pcTol, krTol), std::invalid_argument);
+
+        const auto table = Tabulation::tabulate(params, pcTol, krTol, 0.2, 1.0);
+        const auto report = Tabulation::accuracy(params, table, 0.2, 1.0);
+        BOOST_CHECK(report.withinTolerance(pcTol, krTol));
+        BOOST_CHECK_EQUAL(report.numCheckPoints, 10001u);
+        BOOST_CHECK(report.numPcnwSamples > 9u);
+        BOOST_CHECK_EQUAL(table.SwPcwnSamples().front(), 0.2);
+        BOOST_CHECK_EQUAL(table.SwPcwnSamples().back(), 1.0);
+
+        // values outside of the table are those of the end points
+        using TableLaw = Opm::PiecewiseLinearTwoPhaseMaterial<Traits>;
+        BOOST_CHECK_CLOSE(TableLaw::twoPhaseSatPcnw(table, 0.1),
+                          Law::twoPhaseSatPcnw(params, 0.2), 1e-10);
+    }
+
+    {
+        using Law = Opm::VanGenuchten<Traits>;
+        using Tabulation = Opm::TwoPhaseLawTabulation<Law>;
+
+        Law::Params params;
+        params.setVgAlpha(1e-4);
+        params.setVgN(2.5);
+        params.finalize();
+
+        const auto table = Tabulation::tabulate(params, pcTol, krTol, 0.05, 0.95);
+        const auto report = Tabulation::accuracy(params, table, 0.05, 0.95);
+        BOOST_CHECK(report.withinTolerance(pcTol, krTol));
+
+        // a coarser tolerance needs fewer samples
+        const auto coarse = Tabulation::tabulate(params, 100*pcTol, 100*krTol, 0.05, 0.95);
+        const auto coarseReport = Tabulation::accuracy(params, coarse, 0.05, 0.95);
+        BOOST_CHECK(coarseReport.withinTolerance(100*pcTol, 100*krTol));
+        BOOST_CHECK(coarseReport.numKrwSamples < report.numKrwSamples);
+    }
+
+    {
+        using Law = Opm::TwoPhaseLETCurves<Traits>;
+        using Tabulation = Opm::TwoPhaseLawTabulation<Law>;
+
+        Law::Params params;
+        const std::vector<Scalar> dummy;
+        params.setKrwSamples(std::vector<Scalar>{0.1, 0.8, 2.0, 1.5, 1.2, 0.9}, dummy);
+        params.setKrnSamples(std::vector<Scalar>{0.2, 0.9, 2.5, 1.0, 1.4, 1.0}, dummy);
+        params.setPcnwSamples(std::vector<Scalar>{0.1, 0.2, 1.5, 3.0, 1.2, 2e4, 0.0}, dummy);
+        params.finalize();
+
+        const auto table = Tabulation::tabulate(params, pcTol, krTol);
+        const auto report = Tabulation::accuracy(params, table);
+BOOST_CHECK(report.withinTolerance(pcTol, krTol));
+    }
+}
@@ -273,6 +273,50 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(BlackoilFluidSystem, Scalar, ScalarTypes)
     ensureBlackoilApi<BlackoilDummyEval, FluidSystem>();
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(BlackoilFluidSystemNonStatic, Scalar, ScalarTypes)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<Scalar>;
+    using NonStatic = Opm::BlackOilFluidSystemNonStatic<Scalar>;
+
+    NonStatic fs1;
+    NonStatic fs2;
+
+    fs1.initBegin(1);
+    fs1.setReferenceDensities(800.0, 1000.0, 1.0, 0);
+    fs1.initEnd();
+
+    fs2.initBegin(2);
+    fs2.setEnableDissolvedGas(false);
+    fs2.setReferenceDensities(700.0, 1020.0, 2.0, 0);
+    fs2.setReferenceDensities(750.0, 1030.0, 2.5, 1);
+    fs2.initEnd();
+
+    // the two instances do not share any state
+    BOOST_CHECK(fs1.isInitialized() && fs2.isInitialized());
+    BOOST_CHECK_EQUAL(fs1.numRegions(), 1u);
+    BOOST_CHECK_EQUAL(fs2.numRegions(), 2u);
+    BOOST_CHECK(fs1.enableDissolvedGas());
+    BOOST_CHECK(!fs2.enableDissolvedGas());
+    BOOST_CHECK_EQUAL(fs1.referenceDensity(NonStatic::oilPhaseIdx, 0), Scalar{800.0});
+    BOOST_CHECK_EQUAL(fs2.referenceDensity(NonStatic::oilPhaseIdx, 0), Scalar{700.0});
+    BOOST_CHECK_CLOSE(fs1.molarMass(NonStatic::gasCompIdx) * 2,
+                      fs2.molarMass(NonStatic::gasCompIdx), 1e-3);
+    BOOST_CHECK_CLOSE(fs1.convertXoGToRs(Scalar{0.5}, 0), Scalar{800.0}, 1e-3);
+    BOOST_CHECK_CLOSE(fs2.convertXoGToRs(Scalar{0.5}, 1), Scalar{300.0}, 1e-3);
+
+    // the static interface forwards to its own instance
+    FluidSystem::initBegin(1);
+    FluidSystem::setReferenceDensities(900.0, 1000.0, 1.5, 0);
+    FluidSystem::initEnd();
+    BOOST_CHECK_EQUAL(FluidSystem::referenceDensity(FluidSystem::oilPhaseIdx, 0), Scalar{900.0});
+    BOOST_CHECK_EQUAL(FluidSystem::getNonStaticInstance().referenceDensity(FluidSystem::oilPhaseIdx, 0),
+                      Scalar{900.0});
+    BOOST_CHECK_EQUAL(fs1.referenceDensity(NonStatic::oilPhaseIdx, 0), Scalar{800.0});
+
+    FluidSystem::surfaceTemperature = 300.0;
+    BOOST_CHECK_EQUAL(FluidSystem::getNonStaticInstance().surfaceTemperature, Scalar{300.0});
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(BrineCO2FluidSystem, Scalar, ScalarTypes)
 {
     using Evaluation = Opm::DenseAd::Evaluation<Scalar,3>;
@@ -29,6 +29,7 @@
 #include "config.h"
 
 #include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/constraintsolvers/CompositionFromFugacities.hpp>
 #include <opm/material/constraintsolvers/ComputeFromReferencePhase.hpp>
 #include <opm/material/constraintsolvers/NcpFlash.hpp>
 #include <opm/material/fluidstates/CompositionalFluidState.hpp>
@@ -36,6 +37,11 @@
 #include <opm/material/fluidmatrixinteractions/LinearMaterial.hpp>
 #include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
 
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 template <class FluidSystem, class FluidState>
 void createSurfaceGasFluidSystem(FluidState& gasFluidState)
 {
@@ -475,9 +481,73 @@ inline void testAll()
                 /*hiresThreshold=*/hiresThresholdPressure);
 }
 
+// the batched composition solver must give the same gas compositions as
+// solving the cells one by one.
+template <class Scalar>
+inline void testCompositionBatch()
+{
+    typedef Opm::Spe5FluidSystem<Scalar> FluidSystem;
+    typedef Opm::CompositionalFluidState<Scalar, FluidSystem> FluidState;
+    typedef typename FluidSystem::template ParameterCache<Scalar> ParameterCache;
+    typedef Opm::CompositionFromFugacities<Scalar, FluidSystem> CompositionFromFugacities;
+    typedef typename CompositionFromFugacities::ComponentVector ComponentVector;
+
+    enum {
+        numPhases = FluidSystem::numPhases,
+        numComponents = FluidSystem::numComponents,
+        gasPhaseIdx = FluidSystem::gasPhaseIdx,
+        oilPhaseIdx = FluidSystem::oilPhaseIdx
+    };
+
+    const std::size_t numCells = 7;
+    std::vector<FluidState> fluidStates(numCells);
+    std::vector<ParameterCache> paramCaches(numCells);
+    std::vector<ComponentVector> targetFugs(numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        auto& fs = fluidStates[cellIdx];
+        fs.setTemperature(273.15 + 20);
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            fs.setPressure(phaseIdx, (2000.0 + 500.0*cellIdx) * 6894.7573);
+            guessInitial<FluidSystem>(fs, phaseIdx);
+        }
+
+        // the gas is in equilibrium with the SPE-5 reservoir oil
+        paramCaches[cellIdx].updatePhase(fs, oilPhaseIdx);
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const Scalar phi = FluidSystem::fugacityCoefficient(fs, paramCaches[cellIdx], oilPhaseIdx, compIdx);
+            targetFugs[cellIdx][compIdx] = phi*fs.pressure(oilPhaseIdx)*fs.moleFraction(oilPhaseIdx, compIdx);
+        }
+    }
+
+    std::vector<FluidState> refFluidStates(fluidStates);
+    std::vector<ParameterCache> refParamCaches(paramCaches);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx)
+        CompositionFromFugacities::solve(refFluidStates[cellIdx], refParamCaches[cellIdx],
+                                         gasPhaseIdx, targetFugs[cellIdx]);
+
+    CompositionFromFugacities::solveBatch(fluidStates, paramCaches, gasPhaseIdx, targetFugs);
+
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const Scalar x = fluidStates[cellIdx].moleFraction(gasPhaseIdx, compIdx);
+            const Scalar xRef = refFluidStates[cellIdx].moleFraction(gasPhaseIdx, compIdx);
+            if (std::abs(x - xRef) > 1e-8)
+                throw std::logic_error("Batched and single-cell gas compositions differ in cell "
+                                       + std::to_string(cellIdx) + ": " + std::to_string(x)
+                                       + " vs " + std::to_string(xRef));
+        }
+        const Scalar rho = fluidStates[cellIdx].density(gasPhaseIdx);
+        const Scalar rhoRef = refFluidStates[cellIdx].density(gasPhaseIdx);
+        if (std::abs(rho - rhoRef) > 1e-8*rhoRef)
+            throw std::logic_error("Batched and single-cell gas densities differ in cell "
+                                   + std::to_string(cellIdx));
+    }
+}
+
 int main()
 {
     testAll<double>();
+    testCompositionBatch<double>();
 
     // the Peng-Robinson test currently does not work with single-precision floating
     // point scalars because of precision issues. (these are caused by the fact that the
@@ -0,0 +1,173 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Test for the cubic root solvers of PolynomialUtils.
+ */
+#include "config.h"
+
+#define BOOST_TEST_MODULE PolynomialUtils
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+
+#include <opm/material/common/PolynomialUtils.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace {
+
+// coefficients of (x - r0)*(x^2 + s*x + t)
+std::array<double, 4> coefficients(double r0, double s, double t)
+{
+    return {1.0, s - r0, t - r0*s, -r0*t};
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ThreeRealRoots)
+{
+    // (x - r0)*(x - r1)*(x - r2) for roots typical of compressibility factors
+    const std::vector<std::array<double, 3>> roots {
+        {0.05, 0.3, 0.9}, {0.9, 0.05, 0.3}, {1e-3, 2e-3, 0.95}, {-0.2, 0.1, 1.5}
+    };
+
+    for (const auto& r : roots) {
+        const auto coeff = coefficients(r[0], -(r[1] + r[2]), r[1]*r[2]);
+
+        double xMin = 0.0, xMax = 0.0;
+        BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMin, xMax, coeff[0], coeff[1], coeff[2], coeff[3]), 3u);
+        BOOST_CHECK_CLOSE(xMin, *std::min_element(r.begin(), r.end()), 1e-8);
+        BOOST_CHECK_CLOSE(xMax, *std::max_element(r.begin(), r.end()), 1e-8);
+
+        // identical to the general solver
+        double sol[3];
+        BOOST_CHECK_EQUAL(Opm::cubicRoots(sol, coeff[0], coeff[1], coeff[2], coeff[3]), 3u);
+        BOOST_CHECK_EQUAL(xMin, sol[0]);
+        BOOST_CHECK_EQUAL(xMax, sol[2]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SingleRealRoot)
+{
+    // (x - r0)*(x^2 + s*x + t) with s^2 < 4*t
+    const std::vector<std::array<double, 3>> cases {
+        {0.8, 0.1, 0.5}, {0.02, -0.5, 0.1}, {-1.0, 0.0, 2.0}, {3.0, 1.0, 1.0}, {1e-4, -1e-2, 1e-3}
+    };
+
+    for (const auto& c : cases) {
+        const auto coeff = coefficients(c[0], c[1], c[2]);
+
+        double xMin = 0.0, xMax = 0.0;
+        BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMin, xMax, coeff[0], coeff[1], coeff[2], coeff[3]), 1u);
+        BOOST_CHECK_CLOSE(xMin, c[0], 1e-8);
+        BOOST_CHECK_EQUAL(xMin, xMax);
+
+        double sol[3];
+        BOOST_CHECK_EQUAL(Opm::cubicRoots(sol, coeff[0], coeff[1], coeff[2], coeff[3]), 1u);
+        BOOST_CHECK_CLOSE(xMin, sol[0], 1e-8);
+    }
+
+    // scaling of the polynomial does not change the roots
+    double xMin = 0.0, xMax = 0.0;
+    BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMin, xMax, 2.0, -2.0, 2.0, -2.0), 1u);
+    BOOST_CHECK_CLOSE(xMin, 1.0, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(MultipleRoots)
+{
+    double xMin = 0.0, xMax = 0.0;
+
+    // (x - 1)^2*(x - 4)
+    BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMin, xMax, 1.0, -6.0, 9.0, -4.0), 3u);
+    BOOST_CHECK_CLOSE(xMin, 1.0, 1e-10);
+    BOOST_CHECK_CLOSE(xMax, 4.0, 1e-10);
+
+    // (x + 1)^3
+    BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMin, xMax, 1.0, 3.0, 3.0, 1.0), 3u);
+    BOOST_CHECK_CLOSE(xMin, -1.0, 1e-10);
+    BOOST_CHECK_CLOSE(xMax, -1.0, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(Evaluation)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 1>;
+
+    // the derivatives of the roots w.r.t. the constant coefficient are
+    // -1/p'(x) at the root
+    const auto check = [](const std::array<double, 4>& coeff)
+    {
+        const Eval d = Eval::createVariable(coeff[3], 0);
+        Eval xMin = 0.0, xMax = 0.0;
+        const unsigned num = Opm::cubicExtremeRoots(xMin, xMax, Eval(coeff[0]), Eval(coeff[1]), Eval(coeff[2]), d);
+
+        double xMinScalar = 0.0, xMaxScalar = 0.0;
+        BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMinScalar, xMaxScalar, coeff[0], coeff[1], coeff[2], coeff[3]), num);
+        BOOST_CHECK_EQUAL(xMin.value(), xMinScalar);
+        BOOST_CHECK_EQUAL(xMax.value(), xMaxScalar);
+
+        for (const auto& x : {xMin, xMax}) {
+            const double v = x.value();
+            const double dpdx = coeff[2] + v*(2*coeff[1] + v*3*coeff[0]);
+            BOOST_CHECK_CLOSE(x.derivative(0), -1.0/dpdx, 1e-6);
+        }
+    };
+
+    check(coefficients(0.05, -1.2, 0.27));  // roots 0.05, 0.3 and 0.9
+    check(coefficients(0.8, 0.1, 0.5));     // single root 0.8
+}
+
+BOOST_AUTO_TEST_CASE(Batched)
+{
+    const std::vector<std::array<double, 4>> coeffs {
+        coefficients(0.05, -1.2, 0.27),
+        coefficients(0.8, 0.1, 0.5),
+        {1.0, -6.0, 9.0, -4.0},
+        coefficients(0.02, -0.5, 0.1),
+    };
+
+    const std::size_t n = coeffs.size();
+    std::vector<double> a(n), b(n), c(n), d(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = coeffs[i][0];
+        b[i] = coeffs[i][1];
+        c[i] = coeffs[i][2];
+        d[i] = coeffs[i][3];
+    }
+
+    std::vector<double> xMin(n), xMax(n);
+    std::vector<unsigned> numRoots(n);
+    Opm::cubicExtremeRoots(n, a.data(), b.data(), c.data(), d.data(),
+                           xMin.data(), xMax.data(), numRoots.data());
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double xMinRef = 0.0, xMaxRef = 0.0;
+        BOOST_CHECK_EQUAL(Opm::cubicExtremeRoots(xMinRef, xMaxRef, a[i], b[i], c[i], d[i]), numRoots[i]);
+        BOOST_CHECK_EQUAL(xMin[i], xMinRef);
+        BOOST_CHECK_EQUAL(xMax[i], xMaxRef);
+    }
+}
@@ -42,9 +42,15 @@ gnuplot> plot "spline.csv" using 1:2 w l ti "Curve", \
 #include <boost/test/unit_test.hpp>
 
 #include <opm/material/common/Spline.hpp>
+#include <opm/material/common/TridiagonalMatrix.hpp>
+#include <opm/material/common/TridiagonalMatrixBatch.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
 
 #include <array>
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 template <class Spline, class Array>
 void testCommon(const Spline& sp,
@@ -357,3 +363,92 @@ BOOST_AUTO_TEST_CASE(Monotonic)
                          1000, std::cout);
     std::cout << "\n";
 }
+
+BOOST_AUTO_TEST_CASE(Batched)
+{
+    // non-uniform sampling points, so that several segments share a
+    // bucket of the segment lookup table
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 20; ++i) {
+        x.push_back(std::pow(i/19.0, 3.0));
+        y.push_back(std::sqrt(x.back()) + 0.1*std::sin(10*x.back()));
+    }
+    Opm::Spline<double> sp(x, y, /*type=*/Opm::Spline<double>::Monotonic);
+
+    // unsorted positions including the sampling points and the
+    // extrapolated range
+    std::vector<double> xEval;
+    for (int i = 0; i < 200; ++i)
+        xEval.push_back(-0.1 + 1.2*((i*37) % 200)/199.0);
+    xEval.insert(xEval.end(), x.begin(), x.end());
+
+    std::vector<double> yEval(xEval.size());
+    std::vector<double> dyEval(xEval.size());
+    sp.eval(xEval.size(), xEval.data(), yEval.data(), /*extrapolate=*/true);
+    sp.evalDerivative(xEval.size(), xEval.data(), dyEval.data(), /*extrapolate=*/true);
+    for (std::size_t k = 0; k < xEval.size(); ++k) {
+        BOOST_CHECK_EQUAL(yEval[k], sp.eval(xEval[k], /*extrapolate=*/true));
+        BOOST_CHECK_EQUAL(dyEval[k], sp.evalDerivative(xEval[k], /*extrapolate=*/true));
+    }
+
+    using Eval = Opm::DenseAd::Evaluation<double, 2>;
+    std::vector<Eval> xAd;
+    for (double xv : xEval)
+        xAd.push_back(Eval::createVariable(xv, 0));
+    std::vector<Eval> yAd(xAd.size());
+    sp.eval(xAd.size(), xAd.data(), yAd.data(), /*extrapolate=*/true);
+    for (std::size_t k = 0; k < xAd.size(); ++k) {
+        BOOST_CHECK_EQUAL(yAd[k].value(), yEval[k]);
+        BOOST_CHECK_CLOSE(yAd[k].derivative(0), dyEval[k], 1e-10);
+    }
+
+    BOOST_CHECK_THROW(sp.eval(xEval.size(), xEval.data(), yEval.data()), Opm::NumericalProblem);
+}
+
+BOOST_AUTO_TEST_CASE(TridiagonalBatch)
+{
+    const std::size_t numSystems = 37;
+    const std::size_t n = 9;
+
+    Opm::TridiagonalMatrixBatch<double> batch(numSystems, n);
+    std::vector<double> b(numSystems*n);
+    for (std::size_t s = 0; s < numSystems; ++s) {
+        for (std::size_t i = 0; i < n; ++i) {
+            batch.lower(i, s) = (i > 0) ? 1.0 + 0.1*s - 0.2*i : 0.0;
+            batch.diagonal(i, s) = 6.0 + 0.01*s*i;
+            batch.upper(i, s) = (i + 1 < n) ? -1.5 + 0.03*i : 0.0;
+            b[i*numSystems + s] = std::sin(0.3*i + 0.7*s);
+        }
+    }
+
+    std::vector<double> x;
+    batch.solve(x, b);
+    BOOST_REQUIRE_EQUAL(x.size(), numSystems*n);
+
+    // compare with solving each system on its own
+    for (std::size_t s = 0; s < numSystems; ++s) {
+        Opm::TridiagonalMatrix<double> M(n);
+        std::vector<double> bs(n), xs(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (i > 0)
+                M[i][i - 1] = batch.lower(i, s);
+            M[i][i] = batch.diagonal(i, s);
+            if (i + 1 < n)
+                M[i][i + 1] = batch.upper(i, s);
+            bs[i] = b[i*numSystems + s];
+        }
+        M.solve(xs, bs);
+
+        for (std::size_t i = 0; i < n; ++i)
+            BOOST_CHECK_CLOSE(x[i*numSystems + s], xs[i], 1e-9);
+    }
+
+    // the solution may overwrite the right hand side
+    batch.solve(b, b);
+    for (std::size_t k = 0; k < b.size(); ++k)
+        BOOST_CHECK_EQUAL(b[k], x[k]);
+
+    std::vector<double> wrongSize(n);
+    BOOST_CHECK_THROW(batch.solve(x, wrongSize), std::invalid_argument);
+}
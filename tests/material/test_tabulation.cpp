@@ -36,9 +36,15 @@
 
 #include <opm/material/components/H2O.hpp>
 #include <opm/material/components/TabulatedComponent.hpp>
+#include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <cstddef>
+#include <filesystem>
 #include <iostream>
+#include <limits>
+#include <string>
 #include <tuple>
+#include <vector>
 
 using Types = boost::mpl::list<float,double>;
 
@@ -108,3 +114,173 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2O, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(H2OTableFile, Scalar, Types)
+{
+    using IapwsH2O = Opm::H2O<Scalar>;
+    using TabulatedH2O = Opm::TabulatedComponent<Scalar, IapwsH2O>;
+
+    const Scalar tempMin = 274.15;
+    const Scalar tempMax = 622.15;
+    const unsigned nTemp = 100;
+    const Scalar pMin = 10.00;
+    const Scalar pMax = IapwsH2O::vaporPressure(tempMax*1.1);
+    const unsigned nPress = 50;
+
+    const auto sample = []() {
+        std::vector<Scalar> values;
+        for (unsigned i = 0; i < 20; ++i) {
+            const Scalar T = 280.0 + 16.5*i;
+            const Scalar p = 1.0e5 + 5.0e5*i;
+            values.push_back(TabulatedH2O::vaporPressure(T));
+            values.push_back(TabulatedH2O::gasDensity(T, p));
+            values.push_back(TabulatedH2O::liquidDensity(T, p));
+            values.push_back(TabulatedH2O::liquidEnthalpy(T, p));
+            values.push_back(TabulatedH2O::liquidViscosity(T, p));
+            values.push_back(TabulatedH2O::liquidPressure(T, Scalar{990.0}));
+        }
+        return values;
+    };
+
+    TabulatedH2O::init(tempMin, tempMax, nTemp, pMin, pMax, nPress);
+    BOOST_CHECK(!TabulatedH2O::usesMappedTables());
+    const auto reference = sample();
+
+    const auto fileName = (std::filesystem::temp_directory_path() /
+                           ("test_tabulation_h2o_" + std::to_string(sizeof(Scalar)))).string();
+    std::filesystem::remove(fileName);
+
+    // the first call computes and writes the tables
+    TabulatedH2O::initFromFile(fileName, tempMin, tempMax, nTemp, pMin, pMax, nPress);
+    BOOST_CHECK(std::filesystem::exists(fileName));
+    BOOST_CHECK(TabulatedH2O::usesMappedTables());
+    const auto fromFile = sample();
+    BOOST_CHECK_EQUAL_COLLECTIONS(fromFile.begin(), fromFile.end(),
+                                  reference.begin(), reference.end());
+
+    // the second call only maps the existing file
+    const auto written = std::filesystem::last_write_time(fileName);
+    TabulatedH2O::initFromFile(fileName, tempMin, tempMax, nTemp, pMin, pMax, nPress);
+    BOOST_CHECK(written == std::filesystem::last_write_time(fileName));
+    const auto attached = sample();
+    BOOST_CHECK_EQUAL_COLLECTIONS(attached.begin(), attached.end(),
+                                  reference.begin(), reference.end());
+
+    // a file for other ranges is replaced
+    TabulatedH2O::initFromFile(fileName, tempMin, tempMax, nTemp, pMin, pMax, 2*nPress);
+    BOOST_CHECK(TabulatedH2O::usesMappedTables());
+    BOOST_CHECK_EQUAL(std::filesystem::file_size(fileName),
+                      (5*nTemp + 12*nTemp*2*nPress)*sizeof(Scalar) + 136);
+    BOOST_CHECK_CLOSE_FRACTION(TabulatedH2O::liquidDensity(Scalar{300.0}, Scalar{1.0e6}),
+                               IapwsH2O::liquidDensity(Scalar{300.0}, Scalar{1.0e6}),
+                               Scalar{1e-3});
+
+    std::filesystem::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Tabulated1DSegmentLookup, Scalar, Types)
+{
+    // sampling points 0, 0.5, ..., 10 and a non-uniform perturbation
+    std::vector<Scalar> xu, xn, y;
+    for (int i = 0; i <= 20; ++i) {
+        xu.push_back(Scalar(0.5)*i);
+        xn.push_back(Scalar(0.5)*i + ((i % 3 == 1) ? Scalar(0.1) : Scalar(0)));
+        y.push_back(Scalar(0.25)*i*i);
+    }
+
+    const Opm::Tabulated1DFunction<Scalar> uniform(xu, y);
+    const Opm::Tabulated1DFunction<Scalar> nonUniform(xn, y);
+    BOOST_CHECK(uniform.uniformSpacing());
+    BOOST_CHECK(!nonUniform.uniformSpacing());
+
+    for (const auto* table : { &uniform, &nonUniform }) {
+        const auto& xs = table->xValues();
+        const std::size_t n = xs.size();
+
+        // Reference: the segment [x_i, x_{i+1}) containing x, with the
+        // end segments extending to the ends of the table.
+        const auto reference = [&xs, n](Scalar x)
+        {
+            std::size_t i = 0;
+            while (i + 2 < n && x >= xs[i + 1])
+                ++i;
+            return (x <= xs[1]) ? std::size_t{0} : i;
+        };
+
+        std::vector<Scalar> points;
+        for (std::size_t i = 0; i < n; ++i)
+            points.push_back(xs[i]);
+        for (int i = -10; i <= 110; ++i)
+            points.push_back(Scalar(0.1)*i);
+
+        Opm::SegmentIndex hint{0};
+        for (const auto x : points) {
+            BOOST_CHECK_EQUAL(table->findSegmentIndex(x, true).value, reference(x));
+            BOOST_CHECK_EQUAL(table->findSegmentIndex(x, Opm::SegmentIndex{7}, true).value, reference(x));
+
+            const Scalar expected = table->eval(x, Opm::SegmentIndex{reference(x)});
+            BOOST_CHECK_EQUAL(table->evalWithHint(x, hint, true), expected);
+            BOOST_CHECK_EQUAL(hint.value, reference(x));
+        }
+
+        std::vector<Scalar> values(points.size());
+        table->eval(points.size(), points.data(), values.data(), true);
+        for (std::size_t i = 0; i < points.size(); ++i)
+            BOOST_CHECK_EQUAL(values[i], table->eval(points[i], true));
+
+        BOOST_CHECK_THROW(table->eval(Scalar(11)), std::logic_error);
+        BOOST_CHECK_THROW(table->eval(std::numeric_limits<Scalar>::quiet_NaN(), true),
+                          std::runtime_error);
+    }
+}
+
+namespace {
+
+// Non-owning view of host memory, standing in for the GPU buffers and
+// views used with Opm::gpuistl::move_to_gpu() and make_view().
+template <class T>
+class HostView
+{
+public:
+    using value_type = T;
+
+    template <class Container>
+    explicit HostView(const Container& c)
+        : data_(c.data()), size_(c.size())
+    {}
+
+    std::size_t size() const { return size_; }
+    T& operator[](std::size_t i) const { return data_[i]; }
+
+private:
+    T* data_;
+    std::size_t size_;
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Tabulated1DOtherContainer, Scalar, Types)
+{
+    std::vector<Scalar> xu, xn, y;
+    for (int i = 0; i <= 20; ++i) {
+        xu.push_back(Scalar(0.5)*i);
+        xn.push_back(Scalar(0.5)*i + ((i % 3 == 1) ? Scalar(0.1) : Scalar(0)));
+        y.push_back(Scalar(0.25)*i*i);
+    }
+
+    for (const auto& x : { xu, xn }) {
+        const Opm::Tabulated1DFunction<Scalar> table(x, y);
+        const auto view = Opm::gpuistl::move_to_gpu<Scalar, HostView<const Scalar>>(table);
+
+        BOOST_CHECK_EQUAL(view.numSamples(), table.numSamples());
+        BOOST_CHECK_EQUAL(view.uniformSpacing(), table.uniformSpacing());
+
+        for (int i = -10; i <= 110; ++i) {
+            const Scalar p = Scalar(0.1)*i;
+            BOOST_CHECK_EQUAL(view.eval(p, true), table.eval(p, true));
+            BOOST_CHECK_EQUAL(view.evalDerivative(p, true), table.evalDerivative(p, true));
+        }
+
+        BOOST_CHECK_THROW(view.eval(Scalar(11)), std::logic_error);
+    }
+}
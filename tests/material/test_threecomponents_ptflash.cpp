@@ -220,3 +220,97 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+namespace {
+
+void initCell(const Scalar comp0, const Scalar comp1, FluidState& fluid_state, ComponentVector& z)
+{
+    Evaluation p_init = Evaluation::createVariable(10e5, 0); // 10 bar
+    ComponentVector comp;
+    comp[0] = Evaluation::createVariable(comp0, 1);
+    comp[1] = Evaluation::createVariable(comp1, 2);
+    comp[2] = 1. - comp[0] - comp[1];
+
+    fluid_state.setPressure(FluidSystem::oilPhaseIdx, p_init);
+    fluid_state.setPressure(FluidSystem::gasPhaseIdx, p_init);
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        fluid_state.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, comp[compIdx]);
+        fluid_state.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, comp[compIdx]);
+    }
+    fluid_state.setSaturation(FluidSystem::oilPhaseIdx, 1.0);
+    fluid_state.setSaturation(FluidSystem::gasPhaseIdx, 0.0);
+    fluid_state.setTemperature(300.0);
+
+    typename FluidSystem::template ParameterCache<Evaluation> paramCache;
+    paramCache.updatePhase(fluid_state, FluidSystem::oilPhaseIdx);
+    paramCache.updatePhase(fluid_state, FluidSystem::gasPhaseIdx);
+    fluid_state.setDensity(FluidSystem::oilPhaseIdx, FluidSystem::density(fluid_state, paramCache, FluidSystem::oilPhaseIdx));
+    fluid_state.setDensity(FluidSystem::gasPhaseIdx, FluidSystem::density(fluid_state, paramCache, FluidSystem::gasPhaseIdx));
+
+    z = 0.;
+    Scalar sumMoles = 0.0;
+    for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            Scalar tmp = Opm::getValue(fluid_state.molarity(phaseIdx, compIdx) * fluid_state.saturation(phaseIdx));
+            z[compIdx] += Opm::max(tmp, 1e-8);
+            sumMoles += tmp;
+        }
+    }
+    z /= sumMoles;
+    Evaluation z_last = 1.;
+    for (unsigned compIdx = 0; compIdx < numComponents - 1; ++compIdx) {
+        z[compIdx] = Evaluation::createVariable(Opm::getValue(z[compIdx]), int(compIdx) + 1);
+        z_last -= z[compIdx];
+    }
+    z[numComponents - 1] = z_last;
+
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+    }
+    fluid_state.setLvalue(1.);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    const std::vector<std::pair<Scalar, Scalar>> compositions {
+        {0.5, 0.3}, {0.4, 0.3}, {0.6, 0.2}, {0.3, 0.5}, {0.5, 0.3}
+    };
+
+    std::vector<FluidState> fluid_states(compositions.size());
+    std::vector<ComponentVector> z(compositions.size());
+    for (std::size_t cellIdx = 0; cellIdx < compositions.size(); ++cellIdx) {
+        initCell(compositions[cellIdx].first, compositions[cellIdx].second, fluid_states[cellIdx], z[cellIdx]);
+    }
+
+    for (const auto& method : test_methods) {
+        // the batched flash must give the same result as flashing the cells one by one
+        auto batch_states = fluid_states;
+        Flash::solve(batch_states, z, method, 1.e-12, 0);
+
+        for (std::size_t cellIdx = 0; cellIdx < compositions.size(); ++cellIdx) {
+            auto single_state = fluid_states[cellIdx];
+            Flash::solve(single_state, z[cellIdx], method, 1.e-12, 0);
+
+            BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch_states[cellIdx].L(),
+                                                                     single_state.L(), 1e-14),
+                                "L of cell " << cellIdx << " does not match");
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                for (const auto phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+                    BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch_states[cellIdx].moleFraction(phaseIdx, compIdx),
+                                                                             single_state.moleFraction(phaseIdx, compIdx), 1e-14),
+                                        "mole fraction of component " << compIdx << " in phase " << phaseIdx
+                                        << " of cell " << cellIdx << " does not match");
+                }
+                BOOST_CHECK_EQUAL(Opm::getValue(batch_states[cellIdx].K(compIdx)),
+                                  Opm::getValue(single_state.K(compIdx)));
+            }
+        }
+    }
+
+    std::vector<ComponentVector> tooFew(1);
+    BOOST_CHECK_THROW(Flash::solve(fluid_states, tooFew, "newton", 1.e-12, 0), std::invalid_argument);
+}
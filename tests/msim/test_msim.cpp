@@ -319,3 +319,52 @@ BOOST_AUTO_TEST_CASE(RUN_RPTONLY) {
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(RUN_STRESS) {
+    Parser parser;
+    auto python = std::make_shared<Python>();
+    Deck deck = parser.parseFile("SPE1CASE1.DATA");
+    EclipseState state(deck);
+    Schedule schedule(deck, state, python);
+    SummaryConfig summary_config(deck, schedule, state.fieldProps(), state.aquifer());
+    msim msim(state, schedule);
+
+    // Registered callbacks take precedence over the synthetic data.
+    msim.well_rate("PROD", data::Rates::opt::oil, prod_opr);
+    msim.stress(true);
+    {
+        const WorkArea work_area("test_msim");
+        EclipseIO io(state, state.getInputGrid(), schedule, summary_config);
+
+        msim.run(io, false);
+
+        {
+            const auto  smry = EclIO::ESmry("SPE1CASE1");
+            const auto& time = smry.get("TIME");
+            const auto& wopr = smry.get("WOPR:PROD");
+            const auto& wgir = smry.get("WGIR:INJ");
+
+            for (auto nstep = time.size(), time_index=0*nstep; time_index < nstep; time_index++) {
+                BOOST_CHECK_CLOSE(time[time_index] * 86400, wopr[time_index], 1e-3);
+            }
+
+            BOOST_CHECK_GT(wgir.back(), 0.0f);
+        }
+
+        {
+            auto rst = EclIO::ERst("SPE1CASE1.UNRST");
+            const auto step = rst.listOfReportStepNumbers().back();
+            const auto& swat = rst.getRestartData<float>("SWAT", step, 0);
+
+            BOOST_CHECK_EQUAL(swat.size(), state.getInputGrid().getNumActive());
+            BOOST_CHECK(std::all_of(swat.begin(), swat.end(),
+                                    [](const float s) { return (s > 0.0f) && (s < 1.0f); }));
+        }
+
+        const auto& stages = msim.stage_times();
+        BOOST_CHECK_GT(stages.summary_eval, 0.0);
+        BOOST_CHECK_GT(stages.output, 0.0);
+        BOOST_CHECK_GT(io.outputTimes().restart, 0.0);
+        BOOST_CHECK_GE(stages.output, io.outputTimes().restart);
+    }
+}
@@ -818,6 +818,61 @@ BOOST_AUTO_TEST_CASE(TestWLIST)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestCompiledConditionReuse)
+{
+    const auto deck = Parser{}.parseString(R"(
+ACTIONX
+   'ACTION' /
+   WWCT 'OP*' > 0.5 AND /
+   FOPR < 100 /
+/
+)");
+
+    const auto& [action, errors] = Action::parseActionX(deck["ACTIONX"].back(), {}, 0);
+    BOOST_REQUIRE(errors.empty());
+
+    SummaryState st(TimeService::now(), 0.0);
+    st.update("FOPR", 50.0);
+    st.update_well_var("OP1", "WWCT", 0.8);
+    st.update_well_var("OP2", "WWCT", 0.2);
+    st.update_well_var("IN1", "WWCT", 0.9);
+
+    WListManager wlm;
+    Action::State state;
+
+    {
+        const auto context = Action::Context { st, wlm };
+        const auto res = action.eval(context, state);
+        BOOST_CHECK(res.conditionSatisfied());
+        BOOST_CHECK(res == action.eval(context));
+
+        const auto wells = res.matches().wells().asVector();
+        BOOST_REQUIRE_EQUAL(wells.size(), 1U);
+        BOOST_CHECK_EQUAL(wells[0], "OP1");
+    }
+
+    // Unchanged inputs reuse the previous result.
+    st.update_well_var("IN1", "WWCT", 0.1);
+    {
+        const auto context = Action::Context { st, wlm };
+        BOOST_CHECK(action.eval(context, state) == action.eval(context));
+    }
+
+    st.update_well_var("OP2", "WWCT", 0.7);
+    {
+        const auto context = Action::Context { st, wlm };
+        const auto res = action.eval(context, state);
+        BOOST_CHECK(res == action.eval(context));
+        BOOST_CHECK_EQUAL(res.matches().wells().size(), 2);
+    }
+
+    st.update("FOPR", 150.0);
+    {
+        const auto context = Action::Context { st, wlm };
+        BOOST_CHECK(! action.eval(context, state).conditionSatisfied());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestFieldAND)
 {
     Action::AST ast({"FMWPR", ">=", "4", "AND", "WUPR3", "OP*", "=", "1"});
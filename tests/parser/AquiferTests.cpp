@@ -299,6 +299,41 @@ BOOST_AUTO_TEST_CASE(AquanconTest_DEFAULT_INFLUX)
 }
 
 
+BOOST_AUTO_TEST_CASE(AquanconTest_LARGE_BOX)
+{
+    const auto deck = Parser{}.parseString(R"(DIMENS
+40 40 4 /
+
+GRID
+
+SOLUTION
+AQUANCON
+   1      1 40  1 40  1  4  I-  2* NO /
+   2     40 40  1 40  1  4  I+  2* NO /
+   2     40 40  1 40  4  4  I+  2* NO /
+/
+)");
+
+    const auto grid = EclipseGrid { 40, 40, 4 };
+    const auto aqcon = Aquancon { grid, deck };
+
+    // Only the cells on the I- face of the box are connected to aquifer 1.
+    const auto& cells_aq1 = aqcon.getConnections(1);
+    BOOST_REQUIRE_EQUAL(cells_aq1.size(), std::size_t{40 * 4});
+    for (std::size_t c = 0; c < cells_aq1.size(); ++c) {
+        BOOST_CHECK_EQUAL(cells_aq1[c].global_index, grid.getGlobalIndex(0, c % 40, c / 40));
+        BOOST_CHECK_CLOSE(cells_aq1[c].effective_facearea, 1.0, 1.0e-8);
+    }
+
+    // Cells connected twice to aquifer 2 accumulate their face areas.
+    const auto& cells_aq2 = aqcon.getConnections(2);
+    BOOST_REQUIRE_EQUAL(cells_aq2.size(), std::size_t{40 * 4});
+    for (std::size_t c = 0; c < cells_aq2.size(); ++c) {
+        BOOST_CHECK_EQUAL(cells_aq2[c].global_index, grid.getGlobalIndex(39, c % 40, c / 40));
+        BOOST_CHECK_CLOSE(cells_aq2[c].effective_facearea, (c / 40 == 3) ? 2.0 : 1.0, 1.0e-8);
+    }
+}
+
 // allowing aquifer exists inside the reservoir
 
 namespace {
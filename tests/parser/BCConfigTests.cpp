@@ -24,6 +24,7 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Schedule/BCProp.hpp>
 
+#include <cmath>
 #include <string>
 
 namespace {
@@ -307,3 +308,70 @@ BCPROP
     BOOST_CHECK_EQUAL(deck.getActiveUnitSystem().to_si(measure::length, 5.0),
                       prop[3].mechbcvalue->disp[2]);
 }
+
+BOOST_AUTO_TEST_CASE(FaceTable)
+{
+    const std::string input = R"(
+RUNSPEC
+
+DIMENS
+  3 2 1 /
+OIL
+WATER
+START
+  1 'JAN' 2015 /
+GRID
+DX
+  6*100 /
+DY
+  6*100 /
+DZ
+  6*10 /
+TOPS
+  6*1000 /
+BCCON
+  1 3 3 1 2 1 1 X /
+  2 1 3 1 1 1 1 Y- /
+  3 1 1 1 1 1 1 Z- /
+/
+SCHEDULE
+BCPROP
+ 1 DIRICHLET WATER 1* 250 /
+ 2 RATE WATER 0.5 /
+/
+)";
+
+    auto deck = createDeck(input);
+    const Opm::GridDims grid(deck);
+    const Opm::BCConfig config(deck);
+    const auto& kw = deck.get<Opm::ParserKeywords::BCPROP>();
+    Opm::BCProp prop;
+    for (const auto& record : kw.back()) {
+        prop.updateBCProp(record);
+    }
+
+    // Region 3 has no BCPROP record
+    const auto table = prop.faceTable(config, grid);
+    BOOST_REQUIRE_EQUAL(table.size(), 5U);
+
+    const std::vector<std::size_t> cells { 0, 1, 2, 2, 5 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(table.cells.begin(), table.cells.end(),
+                                  cells.begin(), cells.end());
+
+    BOOST_CHECK_EQUAL(table.dirs[2], Opm::FaceDir::XPlus);
+    BOOST_CHECK_EQUAL(table.dirs[3], Opm::FaceDir::YMinus);
+    BOOST_CHECK(table.bctypes[2] == Opm::BCType::DIRICHLET);
+    BOOST_CHECK(table.bctypes[3] == Opm::BCType::RATE);
+    BOOST_CHECK(table.components[0] == Opm::BCComponent::WATER);
+    BOOST_CHECK_EQUAL(table.rates[0], prop[2].rate);
+    BOOST_CHECK(std::isnan(table.pressures[0]));
+    BOOST_CHECK_EQUAL(table.pressures[4], prop[1].pressure.value());
+    BOOST_CHECK(std::isnan(table.temperatures[4]));
+
+    const auto range = table.range(2);
+    BOOST_CHECK_EQUAL(range[0], 2U);
+    BOOST_CHECK_EQUAL(range[1], 4U);
+
+    const auto none = table.range(3);
+    BOOST_CHECK_EQUAL(none[0], none[1]);
+}
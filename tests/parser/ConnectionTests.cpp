@@ -47,9 +47,11 @@
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+#include <array>
 #include <cstddef>
 #include <stdexcept>
 #include <ostream>
+#include <vector>
 
 namespace {
     double cp_rm3_per_db()
@@ -312,6 +314,115 @@ COMPDAT
 }
 
 
+BOOST_AUTO_TEST_CASE(loadCOMPDAT_Lookup)
+{
+    const std::string deck = R"(GRID
+
+PERMX
+  1000*0.10 /
+
+COPY
+  'PERMX' 'PERMZ' /
+  'PERMX' 'PERMY' /
+/
+
+PORO
+  1000*0.3 /
+
+SCHEDULE
+
+COMPDAT
+--                                    CF      Diam    Kh      Skin   Df
+    'WELL'  1  1   1   3 'OPEN' 1*    1.0     0.311   10.0    1*     1*  'Z'  21.925 /
+    'WELL'  1  1   2   2 'SHUT' 1*    2.0     0.311   20.0    1*     1*  'Z'  21.925 /
+/)";
+
+    const Opm::WellConnections connections = loadCOMPDAT(deck);
+    BOOST_REQUIRE_EQUAL(connections.size(), 3U);
+
+    const auto& conn = connections.getFromIJK(0, 0, 1);
+    BOOST_CHECK_EQUAL(conn.complnum(), 2);
+    BOOST_CHECK_EQUAL(conn.global_index(), 100U);
+    BOOST_CHECK(conn.state() == Opm::Connection::State::SHUT);
+    BOOST_CHECK_EQUAL(&connections.getFromGlobalIndex(100), &conn);
+
+    BOOST_CHECK(connections.hasGlobalIndex(200));
+    BOOST_CHECK(!connections.hasGlobalIndex(300));
+    BOOST_CHECK_THROW(connections.getFromIJK(0, 0, 3), std::runtime_error);
+    BOOST_CHECK_THROW(connections.getFromGlobalIndex(300), std::logic_error);
+
+    // Appending to a copy must not affect the lookup of the original.
+    auto copy = connections;
+    auto ctf_props = Opm::Connection::CTFProperties{};
+    ctf_props.CF = 1.0;
+    copy.add(Opm::Connection { 0, 0, 3, 300, 4, Opm::Connection::State::OPEN,
+                               Opm::Connection::Direction::Z,
+                               Opm::Connection::CTFKind::DeckValue,
+                               1, 0.0, ctf_props, 3, true });
+
+    BOOST_CHECK(copy.hasGlobalIndex(300));
+    BOOST_CHECK_EQUAL(copy.getFromIJK(0, 0, 3).complnum(), 4);
+    BOOST_CHECK(!connections.hasGlobalIndex(300));
+
+    const auto arrays = connections.propertyArrays();
+    BOOST_REQUIRE_EQUAL(arrays.global_index.size(), 3U);
+    BOOST_REQUIRE_EQUAL(arrays.CF.size(), 3U);
+    BOOST_REQUIRE_EQUAL(arrays.Kh.size(), 3U);
+    BOOST_REQUIRE_EQUAL(arrays.depth.size(), 3U);
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+        BOOST_CHECK_EQUAL(arrays.global_index[i], connections[i].global_index());
+        BOOST_CHECK_EQUAL(arrays.CF[i], connections[i].CF());
+        BOOST_CHECK_EQUAL(arrays.Kh[i], connections[i].Kh());
+        BOOST_CHECK_EQUAL(arrays.depth[i], connections[i].depth());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleGrid_GetCells)
+{
+    const auto deck = Opm::Parser{}.parseString(R"(GRID
+
+PERMX
+  1000*0.10 /
+
+COPY
+  'PERMX' 'PERMZ' /
+  'PERMX' 'PERMY' /
+/
+
+PORO
+  1000*0.3 /
+)");
+
+    Opm::EclipseGrid grid { 10, 10, 10 };
+    const Opm::FieldPropsManager field_props {
+        deck, Opm::Phases{true, true, true}, grid, Opm::TableManager{}
+    };
+
+    Opm::CompletedCells batch_cells(grid);
+    Opm::CompletedCells single_cells(grid);
+    const auto batch = Opm::ScheduleGrid { grid, field_props, batch_cells };
+    const auto single = Opm::ScheduleGrid { grid, field_props, single_cells };
+
+    std::vector<std::array<std::size_t, 3>> ijk;
+    for (std::size_t k = 0; k < 10; ++k) {
+        for (std::size_t i = 0; i < 10; ++i) {
+            ijk.push_back({ i, 9 - i, k });
+        }
+    }
+    ijk.push_back({ 3, 6, 2 });
+
+    const auto cells = batch.get_cells(ijk);
+    BOOST_REQUIRE_EQUAL(cells.size(), ijk.size());
+    for (std::size_t c = 0; c < ijk.size(); ++c) {
+        const auto& [i, j, k] = ijk[c];
+        BOOST_CHECK(*cells[c] == single.get_cell(i, j, k));
+        BOOST_CHECK_EQUAL(cells[c], &batch.get_cell(i, j, k));
+    }
+    BOOST_CHECK(batch_cells == single_cells);
+
+    BOOST_CHECK_THROW(batch.get_cells({{ 0, 0, 10 }}), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(loadCOMPDATTESTSPE1) {
     Opm::Parser parser;
 
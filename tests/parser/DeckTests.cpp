@@ -18,6 +18,7 @@
  */
 
 
+#include <limits>
 #include <stdexcept>
 #include <sstream>
 
@@ -325,6 +326,28 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(ConvertToSI) {
+    Dimension dim{ 100, 1 };
+    Dimension defaultDim{ 10 };
+    DeckItem item( "HEI", double(), { dim }, { defaultDim } );
+    item.push_back( 2.0, 8 );
+    item.push_backDefault( 3.0 );
+
+    DeckItem lazy = item;
+    item.convertToSI();
+    BOOST_CHECK( item.getSIDoubleData() == lazy.getSIDoubleData() );
+    BOOST_CHECK_EQUAL( 201, item.getSIDouble(0) );
+    BOOST_CHECK_EQUAL( 30, item.getSIDouble(8) );
+    BOOST_CHECK_EQUAL( 2.0, item.getData< double >()[0] );
+
+    Dimension contextDim{ std::numeric_limits<double>::quiet_NaN() };
+    DeckItem context( "CONTEXT", double(), { contextDim }, { contextDim } );
+    context.push_back( 2.0 );
+    context.convertToSI();
+    BOOST_CHECK_EQUAL( 2.0, context.get< double >(0) );
+    BOOST_CHECK_THROW( context.getSIDoubleData(), std::logic_error );
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
@@ -418,6 +441,15 @@ BOOST_AUTO_TEST_CASE(PushBackMultipleInt) {
         BOOST_CHECK_EQUAL(10 , item.get< int >(i));
 }
 
+BOOST_AUTO_TEST_CASE(GetDataWrongType_throws) {
+    DeckItem item( "HEI", int() );
+    item.push_back( 10 );
+    BOOST_CHECK_EQUAL( 1U, item.getData< int >().size() );
+    BOOST_CHECK_THROW( item.getData< double >(), std::invalid_argument );
+    BOOST_CHECK_THROW( item.getData< std::string >(), std::invalid_argument );
+    BOOST_CHECK_THROW( item.getData< UDAValue >(), std::invalid_argument );
+}
+
 BOOST_AUTO_TEST_CASE(size_defaultConstructor_sizezero) {
     DeckRecord deckRecord;
     BOOST_CHECK_EQUAL(0U, deckRecord.size());
@@ -597,6 +629,59 @@ BOOST_AUTO_TEST_CASE(DeckItemWriteDefault) {
 }
 
 
+BOOST_AUTO_TEST_CASE(DeckOutputNumbers) {
+    std::stringstream s;
+    {
+        DeckOutput out(s);
+        out.write<double>(0.1);
+        out.write<double>(1.0e20);
+        out.write<double>(-2.5e-7);
+        out.write<double>(1.0/3.0);
+        out.write<int>(-17);
+    }
+    BOOST_CHECK_EQUAL( s.str() , "0.1 1e+20 -2.5e-07 0.3333333333 -17");
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckOutputBuffered) {
+    std::stringstream s;
+    {
+        DeckOutput out(s, 10, 1024);
+        out.start_keyword("PORO", false);
+        out.start_record();
+        out.write<double>(0.25);
+        out.end_record();
+        out.end_keyword(true);
+
+        // Nothing is written before the buffer is full or flushed.
+        BOOST_CHECK_EQUAL( s.str() , "");
+        out.flush();
+        BOOST_CHECK_EQUAL( s.str() , "PORO\n 0.25 /\n/\n");
+
+        out.write_string("--");
+    }
+    BOOST_CHECK_EQUAL( s.str() , "PORO\n 0.25 /\n/\n--");
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckOutputRepeat) {
+    std::stringstream s;
+    DeckOutput out(s);
+    out.fmt.min_repeat = 3;
+    out.start_record();
+    for (int i = 0; i < 5; i++)
+        out.write<double>(0.3);
+    out.write<double>(0.2);
+    out.write<double>(0.2);
+    out.stash_default();
+    out.write<int>(7);
+    out.write<int>(7);
+    out.write<int>(7);
+    out.end_record();
+    BOOST_CHECK_EQUAL( s.str() , " 5*0.3 0.2 0.2 1* 3*7 /\n");
+}
+
+
 BOOST_AUTO_TEST_CASE(DeckItemWriteString) {
     DeckItem item("TEST", std::string());
     item.push_back("NO");
@@ -786,6 +786,103 @@ BOOST_AUTO_TEST_CASE(TestCP_example) {
     BOOST_CHECK_EQUAL( 3U , grid.getNumActive() );
 }
 
+BOOST_AUTO_TEST_CASE(ActiveGeometryCache) {
+    const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 4 3 2 /
+GRID
+DX
+ 24*100 /
+DY
+ 24*50 /
+DZ
+ 12*10 12*20 /
+TOPS
+ 12*1000 /
+)");
+
+    const Opm::EclipseGrid reference(deck);
+    Opm::EclipseGrid grid(deck);
+
+    std::vector<int> actnum(24, 1);
+    actnum[5] = 0;
+    actnum[17] = 0;
+    grid.resetACTNUM(actnum);
+
+    const auto& geometry = grid.activeGeometry();
+    BOOST_CHECK_EQUAL(geometry.volume.size(), 22U);
+    BOOST_CHECK_EQUAL(geometry.depth.size(), 22U);
+    BOOST_CHECK(&grid.activeVolume() == &geometry.volume);
+
+    for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+        BOOST_CHECK_EQUAL(grid.getCellVolume(g), reference.getCellVolume(g));
+        BOOST_CHECK_EQUAL(grid.getCellDepth(g), reference.getCellDepth(g));
+        BOOST_CHECK_EQUAL(grid.getCellThickness(g), reference.getCellThickness(g));
+
+        const auto center = grid.getCellCenter(g);
+        const auto ref_center = reference.getCellCenter(g);
+        const auto dims = grid.getCellDims(g);
+        const auto ref_dims = reference.getCellDims(g);
+        for (std::size_t d = 0; d < 3; ++d) {
+            BOOST_CHECK_EQUAL(center[d], ref_center[d]);
+            BOOST_CHECK_EQUAL(dims[d], ref_dims[d]);
+        }
+    }
+
+    const auto a = grid.activeIndex(13);
+    BOOST_CHECK_CLOSE(geometry.dz[a], 20.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(geometry.depth[a], 1020.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(geometry.volume[a], 100.0*50.0*20.0, 1.0e-8);
+
+    // Changing ACTNUM drops the cached geometry.
+    grid.resetACTNUM();
+    BOOST_CHECK_EQUAL(grid.activeGeometry().volume.size(), 24U);
+}
+
+BOOST_AUTO_TEST_CASE(PartitionGrid) {
+    const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 4 3 2 /
+GRID
+DXV
+ 10 20 30 40 /
+DYV
+ 5 15 25 /
+DZ
+ 12*10 12*20 /
+TOPS
+ 12*1000 /
+)");
+
+    std::vector<int> actnum(24, 1);
+    actnum[17] = 0;
+    const Opm::EclipseGrid grid(deck, actnum.data());
+
+    const auto part = grid.partition({1, 1, 1}, {4, 3, 2});
+    BOOST_CHECK_EQUAL(part.getNX(), 3U);
+    BOOST_CHECK_EQUAL(part.getNY(), 2U);
+    BOOST_CHECK_EQUAL(part.getNZ(), 1U);
+    BOOST_CHECK_EQUAL(part.getCOORD().size(), 4U*3U*6U);
+    BOOST_CHECK_EQUAL(part.getZCORN().size(), 6U*8U);
+    BOOST_CHECK_EQUAL(part.getNumActive(), 5U);
+
+    for (std::size_t k = 0; k < part.getNZ(); ++k)
+        for (std::size_t j = 0; j < part.getNY(); ++j)
+            for (std::size_t i = 0; i < part.getNX(); ++i) {
+                BOOST_CHECK_EQUAL(part.cellActive(i, j, k), grid.cellActive(i + 1, j + 1, k + 1));
+                BOOST_CHECK_CLOSE(part.getCellVolume(i, j, k), grid.getCellVolume(i + 1, j + 1, k + 1), 1.0e-8);
+                BOOST_CHECK_CLOSE(part.getCellDepth(i, j, k), grid.getCellDepth(i + 1, j + 1, k + 1), 1.0e-8);
+
+                const auto center = part.getCellCenter(i, j, k);
+                const auto ref_center = grid.getCellCenter(i + 1, j + 1, k + 1);
+                for (std::size_t d = 0; d < 3; ++d)
+                    BOOST_CHECK_CLOSE(center[d], ref_center[d], 1.0e-8);
+            }
+
+    BOOST_CHECK_THROW(grid.partition({0, 0, 0}, {5, 3, 2}), std::invalid_argument);
+    BOOST_CHECK_THROW(grid.partition({2, 0, 0}, {2, 3, 2}), std::invalid_argument);
+}
+
 
 
 BOOST_AUTO_TEST_CASE(ConstructorNORUNSPEC) {
@@ -1884,6 +1981,17 @@ BOOST_AUTO_TEST_CASE(SpiderDetails) {
 
         BOOST_CHECK_THROW( grid.getCornerPos( 0,0,0 , 8 ) , std::invalid_argument);
     }
+
+    for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+        const auto [i, j, k] = grid.getIJK(g);
+        const auto corners = grid.getCornerPositions(g);
+        for (std::size_t l = 0; l < 8; ++l) {
+            const auto pos = grid.getCornerPos(i, j, k, l);
+            BOOST_CHECK_EQUAL(corners[l][0], pos[0]);
+            BOOST_CHECK_EQUAL(corners[l][1], pos[1]);
+            BOOST_CHECK_EQUAL(corners[l][2], pos[2]);
+        }
+    }
 }
 
 static Opm::Deck spider_details_dz() {
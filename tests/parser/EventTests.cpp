@@ -61,3 +61,54 @@ BOOST_AUTO_TEST_CASE(CreateEmpty) {
     BOOST_CHECK_THROW(wg_events.at("NO_SUCH_WELL"), std::exception);
 }
 
+
+BOOST_AUTO_TEST_CASE(WellGroupEventQueries) {
+    using namespace Opm::ScheduleEvents;
+
+    Opm::WellGroupEvents wg_events;
+    wg_events.addWell("W1");
+    wg_events.addWell("W2");
+    wg_events.addGroup("G1");
+    wg_events.addWell("W1");
+
+    BOOST_CHECK_EQUAL(wg_events.size(), 3U);
+    BOOST_CHECK_EQUAL(wg_events.index("W2").value(), 1U);
+    BOOST_CHECK(!wg_events.index("NO_SUCH_WELL").has_value());
+    BOOST_CHECK(wg_events.hasEvent(2, NEW_GROUP));
+
+    wg_events.reset();
+    BOOST_CHECK(!wg_events.anyHasEvent(NEW_WELL | NEW_GROUP));
+
+    wg_events.addEvent("W2", WELL_STATUS_CHANGE);
+    wg_events.addEvent("G1", WELL_STATUS_CHANGE);
+    BOOST_CHECK(wg_events.anyHasEvent(WELL_STATUS_CHANGE | PRODUCTION_UPDATE));
+    BOOST_CHECK(!wg_events.anyHasEvent(PRODUCTION_UPDATE));
+
+    const auto wells = wg_events.wellsWithEvent(WELL_STATUS_CHANGE);
+    BOOST_REQUIRE_EQUAL(wells.size(), 1U);
+    BOOST_CHECK_EQUAL(wells[0], "W2");
+
+    const auto groups = wg_events.groupsWithEvent(WELL_STATUS_CHANGE);
+    BOOST_REQUIRE_EQUAL(groups.size(), 1U);
+    BOOST_CHECK_EQUAL(groups[0], "G1");
+
+    // Copies share the names, and adding to one copy leaves the other
+    // unchanged.
+    auto next = wg_events;
+    next.addWell("W3");
+    BOOST_CHECK(next.has("W3"));
+    BOOST_CHECK(!wg_events.has("W3"));
+    BOOST_CHECK_EQUAL(next.index("W2").value(), 1U);
+    BOOST_CHECK(next.hasEvent("W3", NEW_WELL));
+    BOOST_CHECK(!(next == wg_events));
+
+    // Equality does not depend on the order the wells were added.
+    Opm::WellGroupEvents a, b;
+    a.addWell("W1");
+    a.addWell("W2");
+    b.addWell("W2");
+    b.addWell("W1");
+    BOOST_CHECK(a == b);
+    b.addEvent("W1", PRODUCTION_UPDATE);
+    BOOST_CHECK(!(a == b));
+}
@@ -448,6 +448,57 @@ BOOST_AUTO_TEST_CASE(ASSIGN) {
     BOOST_CHECK(data.data == ext_data);
 }
 
+BOOST_AUTO_TEST_CASE(CompactUniform) {
+    Fieldprops::FieldData<double> data({}, 6, 0);
+    data.default_assign(1.0);
+    const auto dense = data;
+
+    BOOST_CHECK(data.compact());
+    BOOST_CHECK(data.is_compact());
+    BOOST_CHECK(data.data.empty());
+    BOOST_CHECK_EQUAL(data.dataSize(), 6U);
+    BOOST_CHECK(data.valid());
+    BOOST_CHECK(data.valid_default());
+    BOOST_CHECK(data == dense);
+
+    data.compress({true, false, true, true, false, true});
+    BOOST_CHECK_EQUAL(data.numCells(), 4U);
+
+    data.update(2, 0.5, value::status::deck_value);
+    BOOST_CHECK(!data.is_compact());
+    BOOST_CHECK(data.data == std::vector<double>({1.0, 1.0, 0.5, 1.0}));
+    BOOST_CHECK(!data.compact());
+
+    Fieldprops::FieldData<double> global_data({}, 6, 6);
+    global_data.default_assign(1.0);
+    BOOST_CHECK(!global_data.compact());
+}
+
+BOOST_AUTO_TEST_CASE(CompactUniformKeywords) {
+    std::string deck_string = R"(
+GRID
+
+NTG
+  200*1 /
+
+MULTX
+  100*2 100*3 /
+
+)";
+
+    EclipseGrid grid(EclipseGrid(10,10, 2));
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+
+    const auto& ntg = fpm.get_double("NTG");
+    BOOST_CHECK_EQUAL(ntg.size(), 200U);
+    BOOST_CHECK(std::all_of(ntg.begin(), ntg.end(), [](const double v) { return v == 1.0; }));
+
+    const auto& multx = fpm.get_double("MULTX");
+    BOOST_CHECK_EQUAL(multx[99], 2.0);
+    BOOST_CHECK_EQUAL(multx[100], 3.0);
+}
+
 BOOST_AUTO_TEST_CASE(Defaulted1) {
     std::string deck_string = R"(
 GRID
@@ -914,6 +965,45 @@ OPERATE
     BOOST_CHECK_EQUAL(multz[3], 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(OPERATE_LARGE_BOX) {
+    // Large enough for the box operations to run in parallel.
+    std::string deck_string = R"(
+GRID
+
+PORO
+   40000*0.25 /
+
+PERMX
+   40000*100 /
+
+MULTIPLY
+    PORO  0.5  1 100 1 100 1 2 /
+/
+
+ADD
+    PORO  0.125  1 100 1 100 1 4 /
+/
+
+OPERATE
+    PERMX   1 100   1 100   1 4  'MULTA'   PORO 2 10 /
+/
+)";
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+    EclipseGrid grid(100,100,4);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+
+    const auto& poro = fpm.get_double("PORO");
+    const auto& permx = fpm.get_double("PERMX");
+    for (std::size_t i = 0; i < 40000; i++) {
+        const double expected_poro = (i < 20000) ? 0.25*0.5 + 0.125 : 0.25 + 0.125;
+        BOOST_CHECK_EQUAL(poro[i], expected_poro);
+        BOOST_CHECK_EQUAL(permx[i], 2*poro[i] + to_si(10));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(EPS_Props_Inconsistent) {
     BOOST_CHECK_THROW(const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
 DIMENS
@@ -2102,6 +2192,32 @@ BOOST_AUTO_TEST_CASE(SatFunc_EndPts_Family_II_TolCrit_Large) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(SatFunc_EndPts_Depth_Table) {
+    const auto enptvd = std::string { R"(
+ENPTVD
+2000.0 0.071004 0.10 1.0 0.0 0.03 0.928996 0.20 0.07
+2015.0 0.071004 0.25 1.0 0.0 0.03 0.928996 0.20 0.07 /
+)" };
+
+    const auto es = ::Opm::EclipseState {
+        ::Opm::Parser{}.parseString(satfunc_model_setup() + tolCrit(0.0) + satfunc_family_I() + enptvd + end())
+    };
+
+    auto fp = es.fieldProps();
+
+    // Cell centres at depths 2002.5, 2007.5 and 2012.5 m.
+    const auto swcr = fp.get_double("SWCR");
+    BOOST_CHECK_CLOSE(swcr[0 * 36], 0.125, 1.0e-10);
+    BOOST_CHECK_CLOSE(swcr[1 * 36], 0.175, 1.0e-10);
+    BOOST_CHECK_CLOSE(swcr[2 * 36], 0.225, 1.0e-10);
+
+    // Function values are not depth dependent.
+    const auto krorw = fp.get_double("KRORW");
+    const auto pcw   = fp.get_double("PCW");
+    BOOST_CHECK_CLOSE(krorw[2 * 36], 1.0, 1.0e-10);
+    BOOST_CHECK_CLOSE(pcw  [2 * 36], 7.847999*unit::barsa, 1.0e-10);
+}
+
 // =====================================================================
 
 BOOST_AUTO_TEST_CASE(Equivalent_FIP_Keys) {
@@ -3145,7 +3261,10 @@ MULTZ
     // Observe that the MULTZ multiplier is reset to 1.0 for every timestep
 
     const auto& sched1 = sched[1];
-    fp.apply_schedule_keywords(sched1.geo_keywords());
+    const auto updated1 = fp.apply_schedule_keywords(sched1.geo_keywords());
+    BOOST_CHECK_EQUAL(updated1.size(), 100U);
+    BOOST_CHECK_EQUAL(updated1.front(), 0U);
+    BOOST_CHECK_EQUAL(updated1.back(), 99U);
     const auto& multz1 = fp.get_double("MULTZ");
     for (std::size_t ij=0; ij < 100; ij++) {
         BOOST_CHECK_EQUAL(multz1[ij]      , 2.0);
@@ -3154,7 +3273,10 @@ MULTZ
 
 
     const auto& sched2 = sched[2];
-    fp.apply_schedule_keywords(sched2.geo_keywords());
+    const auto updated2 = fp.apply_schedule_keywords(sched2.geo_keywords());
+    BOOST_CHECK_EQUAL(updated2.size(), 100U);
+    BOOST_CHECK_EQUAL(updated2.front(), 100U);
+    BOOST_CHECK_EQUAL(updated2.back(), 199U);
     const auto& multz2 = fp.get_double("MULTZ");
     for (std::size_t ij=0; ij < 100; ij++) {
         BOOST_CHECK_EQUAL(multz2[ij]      , 1.0);
@@ -3163,7 +3285,8 @@ MULTZ
 
 
     const auto& sched3 = sched[3];
-    fp.apply_schedule_keywords(sched3.geo_keywords());
+    const auto updated3 = fp.apply_schedule_keywords(sched3.geo_keywords());
+    BOOST_CHECK_EQUAL(updated3.size(), 200U);
     for (std::size_t ij=0; ij < 100; ij++) {
         BOOST_CHECK_EQUAL(multz2[ij]      , 20.0);
         BOOST_CHECK_EQUAL(multz2[ij + 100], 40.0);
@@ -33,10 +33,12 @@
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
 #include <opm/input/eclipse/Schedule/Group/Group.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateModel.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRate.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 
@@ -818,3 +820,87 @@ GCONPROD
     BOOST_CHECK(sched[0].has_gpmaint());
 }
 
+
+BOOST_AUTO_TEST_CASE(GroupHierarchyOrders)
+{
+    const auto input = std::string { R"(
+START             -- 0
+19 JUN 2007 /
+GRID
+PORO
+1000*0.1  /
+PERMX
+1000*1 /
+PERMY
+1000*0.1 /
+PERMZ
+1000*0.01 /
+SCHEDULE
+GRUPTREE
+ 'G1'  'FIELD' /
+ 'G2'  'FIELD' /
+ 'G11' 'G1' /
+ 'G12' 'G1' /
+/
+TSTEP
+ 10 /
+TSTEP
+ 10 /
+GRUPTREE
+ 'G12' 'G2' /
+/
+TSTEP
+ 10 /
+)" };
+
+    const auto schedule = create_schedule(input);
+
+    auto names = [](const GroupHierarchy& h, const std::vector<std::size_t>& order)
+    {
+        auto result = std::vector<std::string>{};
+        for (const auto index : order) {
+            result.push_back(h.name(index));
+        }
+        return result;
+    };
+
+    const auto& h0 = schedule[0].group_hierarchy();
+    {
+        const auto pre = names(h0, h0.preOrder());
+        const auto post = names(h0, h0.postOrder());
+
+        const auto expect_pre = std::vector<std::string> { "FIELD", "G1", "G11", "G12", "G2" };
+        const auto expect_post = std::vector<std::string> { "G11", "G12", "G1", "G2", "FIELD" };
+        BOOST_CHECK_EQUAL_COLLECTIONS(pre.begin(), pre.end(), expect_pre.begin(), expect_pre.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(post.begin(), post.end(), expect_post.begin(), expect_post.end());
+
+        const auto field = h0.preOrder().front();
+        const auto g12 = h0.preOrder()[3];
+        BOOST_CHECK_EQUAL(field, schedule.getGroup("FIELD", 0).insert_index());
+        BOOST_CHECK_EQUAL(g12, schedule.getGroup("G12", 0).insert_index());
+        BOOST_CHECK_EQUAL(h0.parent(field), GroupHierarchy::npos);
+        BOOST_CHECK_EQUAL(h0.name(h0.parent(g12)), "G1");
+        BOOST_CHECK_EQUAL(h0.level(field), std::size_t{0});
+        BOOST_CHECK_EQUAL(h0.level(g12), std::size_t{2});
+
+        auto values = std::vector<double>(h0.size(), 1.0);
+        h0.sumToParents(values);
+        BOOST_CHECK_EQUAL(values[field], 5.0);
+        BOOST_CHECK_EQUAL(values[h0.parent(g12)], 3.0);
+    }
+
+    // Unchanged group structure, same version.
+    BOOST_CHECK_EQUAL(schedule[1].group_hierarchy().version(), h0.version());
+    BOOST_CHECK_EQUAL(&schedule[1].group_hierarchy(), &schedule[1].group_hierarchy());
+
+    const auto& h2 = schedule[2].group_hierarchy();
+    BOOST_CHECK_NE(h2.version(), h0.version());
+    {
+        const auto pre = names(h2, h2.preOrder());
+        const auto expect_pre = std::vector<std::string> { "FIELD", "G1", "G11", "G2", "G12" };
+        BOOST_CHECK_EQUAL_COLLECTIONS(pre.begin(), pre.end(), expect_pre.begin(), expect_pre.end());
+
+        const auto g12 = schedule.getGroup("G12", 2).insert_index();
+        BOOST_CHECK_EQUAL(h2.name(h2.parent(g12)), "G2");
+    }
+}
@@ -40,6 +40,7 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/M.hpp>
 
 #include <array>
+#include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
 #include <vector>
@@ -267,6 +268,42 @@ BOOST_AUTO_TEST_CASE(DefaultedRegions) {
   BOOST_CHECK_EQUAL( scanner1.getRegionMultiplier(grid.getGlobalIndex(2,0,0), grid.getGlobalIndex(2,0,1), Opm::FaceDir::ZPlus), 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(BatchLookup) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+  std::vector<const Opm::DeckKeyword*> keywords;
+  for (const auto& multregt : deck["MULTREGT"]) {
+      keywords.push_back( &multregt );
+  }
+  const Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+  const Opm::MULTREGTScanner copy = scanner;
+
+  std::vector<std::size_t> cells1, cells2;
+  std::vector<Opm::FaceDir::DirEnum> dirs;
+  for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+      const auto [i, j, k] = grid.getIJK(g);
+      if (i + 1 < 3) { cells1.push_back(g); cells2.push_back(grid.getGlobalIndex(i+1, j, k)); dirs.push_back(Opm::FaceDir::XPlus); }
+      if (j + 1 < 3) { cells1.push_back(g); cells2.push_back(grid.getGlobalIndex(i, j+1, k)); dirs.push_back(Opm::FaceDir::YPlus); }
+      if (k + 1 < 2) { cells1.push_back(g); cells2.push_back(grid.getGlobalIndex(i, j, k+1)); dirs.push_back(Opm::FaceDir::ZPlus); }
+  }
+
+  const auto mults = scanner.getRegionMultipliers(cells1, cells2, dirs);
+  BOOST_REQUIRE_EQUAL( mults.size(), cells1.size() );
+  for (std::size_t c = 0; c < mults.size(); ++c) {
+      BOOST_CHECK_EQUAL( mults[c], scanner.getRegionMultiplier(cells1[c], cells2[c], dirs[c]) );
+      BOOST_CHECK_EQUAL( mults[c], copy.getRegionMultiplier(cells1[c], cells2[c], dirs[c]) );
+  }
+
+  // FLUXNUM 3 and 4 meet between (0,0,1) and (1,0,1).
+  const auto mult34 = scanner.getRegionMultipliers({grid.getGlobalIndex(0,0,1)}, {grid.getGlobalIndex(1,0,1)}, {Opm::FaceDir::XPlus});
+  BOOST_CHECK_EQUAL( mult34[0], 1.25 );
+
+  BOOST_CHECK_THROW( scanner.getRegionMultipliers(cells1, {}, dirs), std::invalid_argument );
+}
+
 namespace {
     Opm::Deck createCopyMULTNUMDeck()
     {
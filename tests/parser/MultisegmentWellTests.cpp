@@ -785,6 +785,64 @@ BOOST_AUTO_TEST_CASE(Branches) {
     BOOST_CHECK( expected == segments.branches() );
 }
 
+BOOST_AUTO_TEST_CASE(MSW_SEGMENT_TOPOLOGY) {
+    const auto& sched = make_schedule("MSW.DATA");
+    const auto& well = sched.getWell("PROD01", 0);
+    const auto& segments = well.getSegments();
+    const auto& topology = segments.topology();
+
+    BOOST_CHECK_EQUAL(topology.size(), segments.size());
+    for (std::size_t segIx = 0; segIx < segments.size(); ++segIx) {
+        const auto& segment = segments[segIx];
+        BOOST_CHECK_EQUAL(topology.index(segment.segmentNumber()), static_cast<int>(segIx));
+        BOOST_CHECK_EQUAL(topology.outlet(segIx), segments.segmentNumberToIndex(segment.outletSegment()));
+
+        std::set<int> inlets;
+        std::size_t numInletBranches = 0;
+        for (const auto inlet : topology.inlets(segIx)) {
+            inlets.insert(segments[inlet].segmentNumber());
+            numInletBranches += segments[inlet].branchNumber() != segment.branchNumber();
+        }
+        BOOST_CHECK(inlets == std::set<int>(segment.inletSegments().begin(), segment.inletSegments().end()));
+        BOOST_CHECK_EQUAL(topology.numInletBranches(segIx), numInletBranches);
+    }
+
+    {
+        const auto branch = topology.branch(5);
+        const std::vector<int> expected = {22,23,24,25,26};
+        BOOST_CHECK_EQUAL(branch.size(), expected.size());
+        for (std::size_t index = 0; index < branch.size(); index++)
+            BOOST_CHECK_EQUAL(expected[index], segments[branch[index]].segmentNumber());
+    }
+    BOOST_CHECK(topology.branch(100).empty());
+
+    // Every segment once, after all of its inlets, and the top segment last.
+    const auto& order = topology.inflowOrder();
+    BOOST_CHECK_EQUAL(order.size(), segments.size());
+    BOOST_CHECK_EQUAL(order.back(), 0U);
+    std::vector<bool> seen(segments.size(), false);
+    for (const auto segIx : order) {
+        BOOST_CHECK(!seen[segIx]);
+        for (const auto inlet : topology.inlets(segIx))
+            BOOST_CHECK(seen[inlet]);
+        seen[segIx] = true;
+    }
+
+    const auto& connections = well.getConnections();
+    const auto connMap = topology.connections(connections);
+    std::size_t numConn = 0;
+    for (std::size_t segIx = 0; segIx < segments.size(); ++segIx) {
+        BOOST_CHECK_EQUAL(connMap.connectionsBefore(segIx), numConn);
+        for (const auto connIx : connMap.connections(segIx))
+            BOOST_CHECK_EQUAL(connections[connIx].segment(), segments[segIx].segmentNumber());
+        numConn += connMap.connections(segIx).size();
+    }
+
+    // Copies share the topology.
+    const auto copy = segments;
+    BOOST_CHECK(&copy.topology() == &topology);
+}
+
 BOOST_AUTO_TEST_CASE(MULTIPLE_WELSEGS) {
     const auto& sched1 = make_schedule("MSW.DATA");
     const auto& sched2 = make_schedule("MSW_2WELSEGS.DATA");
@@ -73,6 +73,61 @@ BOOST_AUTO_TEST_CASE(Branch) {
 }
 
 
+BOOST_AUTO_TEST_CASE(NetworkGraph) {
+    // PLAT <- B1 <- {C1, C2},  PLAT <- C3
+    Network::ExtNetwork network;
+    network.add_branch(Network::Branch("B1", "PLAT", 1, 0.0));
+    network.add_branch(Network::Branch("C1", "B1", 2, 0.0));
+    network.add_branch(Network::Branch("C2", "B1", 9999, 0.0));
+    network.add_branch(Network::Branch("C3", "PLAT", 3, 0.0));
+
+    const auto& graph = network.graph();
+    BOOST_CHECK_EQUAL(graph.numNodes(), 5U);
+    BOOST_CHECK_EQUAL(graph.numBranches(), 4U);
+
+    const auto names = network.node_names();
+    for (std::size_t node = 0; node < names.size(); ++node) {
+        BOOST_CHECK_EQUAL(graph.nodeName(node), names[node]);
+        BOOST_CHECK_EQUAL(*graph.nodeIndex(names[node]), node);
+    }
+    BOOST_CHECK(!graph.nodeIndex("NO_SUCH_NODE").has_value());
+
+    const auto b1 = *graph.nodeIndex("B1");
+    const auto plat = *graph.nodeIndex("PLAT");
+    BOOST_CHECK_EQUAL(graph.downtreeBranches(b1).size(), 2U);
+    BOOST_CHECK_EQUAL(graph.downtreeBranches(plat).size(), 2U);
+    BOOST_CHECK(graph.uptreeBranches(plat).empty());
+    BOOST_CHECK_EQUAL(graph.uptreeNode(graph.uptreeBranches(b1)[0]), plat);
+
+    BOOST_CHECK_EQUAL(graph.vfpTable(1).value(), 2);
+    BOOST_CHECK(!graph.vfpTable(2).has_value());
+
+    // Leaves to root
+    const auto& order = graph.topologicalOrder();
+    BOOST_CHECK_EQUAL(order.size(), 5U);
+    BOOST_CHECK_EQUAL(order.back(), plat);
+    std::vector<bool> seen(graph.numNodes(), false);
+    for (const auto node : order) {
+        for (const auto branch : graph.downtreeBranches(node))
+            BOOST_CHECK(seen[graph.downtreeNode(branch)]);
+        seen[node] = true;
+    }
+
+    BOOST_CHECK_EQUAL(network.downtree_branches("B1").size(), 2U);
+    BOOST_CHECK_EQUAL(network.uptree_branch("C1").value().uptree_node(), "B1");
+
+    // Graph follows changes to the network
+    network.add_or_replace_branch(Network::Branch("C1", "PLAT", 2, 0.0));
+    BOOST_CHECK_EQUAL(network.graph().downtreeBranches(b1).size(), 1U);
+    BOOST_CHECK_EQUAL(network.graph().downtreeBranches(plat).size(), 3U);
+    BOOST_CHECK_EQUAL(network.uptree_branch("C1").value().uptree_node(), "PLAT");
+
+    network.drop_branch("PLAT", "C3");
+    BOOST_CHECK(!network.uptree_branch("C3").has_value());
+    BOOST_CHECK_EQUAL(network.graph().numBranches(), 3U);
+}
+
+
 BOOST_AUTO_TEST_CASE(INVALID_DOWNTREE_NODE) {
     std::string deck_string = R"(
 RUNSPEC
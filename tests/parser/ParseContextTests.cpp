@@ -820,3 +820,33 @@ BOOST_AUTO_TEST_CASE(OPM_ERROR) {
 }
 
 
+
+BOOST_AUTO_TEST_CASE(ParserCheckActions) {
+    ParseContext context(InputErrorAction::WARN);
+    BOOST_CHECK( context.get(ParseContext::Check::RandomSlash) == InputErrorAction::WARN );
+    BOOST_CHECK( context.get(ParseContext::Check::UnknownKeyword) == InputErrorAction::WARN );
+
+    context.update("PARSE_RANDOM_*", InputErrorAction::IGNORE);
+    BOOST_CHECK( context.get(ParseContext::Check::RandomSlash) == InputErrorAction::IGNORE );
+    BOOST_CHECK( context.get(ParseContext::Check::RandomText) == InputErrorAction::IGNORE );
+    BOOST_CHECK( context.get(ParseContext::Check::ExtraData) == InputErrorAction::WARN );
+
+    context.updateKey(ParseContext::PARSE_EXTRA_DATA, InputErrorAction::THROW_EXCEPTION);
+    BOOST_CHECK( context.get(ParseContext::Check::ExtraData) == InputErrorAction::THROW_EXCEPTION );
+    BOOST_CHECK( context.get(ParseContext::Check::ExtraData) == context.get(ParseContext::PARSE_EXTRA_DATA) );
+
+    const ParseContext copy = context.withKey("NEW_KEY", InputErrorAction::WARN);
+    BOOST_CHECK( copy.get(ParseContext::Check::RandomText) == InputErrorAction::IGNORE );
+
+    KeywordLocation location("KW", "file", 100);
+    ErrorGuard errors;
+
+    // Ignored errors are recorded, but the message is not formatted, so a
+    // malformed format string does not throw.
+    context.handleError(ParseContext::Check::RandomText, "String { not formatted in {file}", location, errors);
+    BOOST_CHECK( errors.hasWarnings() );
+    BOOST_CHECK( !errors );
+
+    BOOST_CHECK_THROW( context.handleError(ParseContext::Check::ExtraData, "Extra data in {keyword}", location, errors), OpmInputError );
+    errors.clear();
+}
@@ -33,9 +33,12 @@
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Deck/DeckSection.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Parser/InputFileManifest.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
@@ -49,8 +52,11 @@
 #include "../../opm/input/eclipse/Parser/raw/RawKeyword.hpp"
 #include "../../opm/input/eclipse/Parser/raw/RawRecord.hpp"
 
+#include "tests/WorkArea.hpp"
+
 #include <cstddef>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -130,6 +136,34 @@ BOOST_AUTO_TEST_CASE(getKeyword_hasnotkeyword_getKeywordThrowsException) {
     BOOST_CHECK_THROW(parser.getParserKeywordFromDeckName("FJASS"), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(LazyKeyword_createdOnFirstLookup) {
+    static int created = 0;
+    created = 0;
+
+    Parser parser( false );
+    parser.addParserKeyword( createDynamicSized( "FJAS" ) );
+    parser.addLazyParserKeyword( { "LAZY", "FJAS" }, []() -> ParserKeyword
+    {
+        ++created;
+        return createDynamicSized( "LAZY" );
+    });
+
+    BOOST_CHECK( parser.isRecognizedKeyword( "LAZY" ) );
+    BOOST_CHECK( parser.hasKeyword( "FJAS" ) );
+    BOOST_CHECK_EQUAL( 2U, parser.size() );
+    BOOST_CHECK_EQUAL( 2U, parser.getAllDeckNames().size() );
+    BOOST_CHECK_EQUAL( 0, created );
+
+    const auto& lazy = parser.getParserKeywordFromDeckName( "LAZY" );
+    BOOST_CHECK_EQUAL( "LAZY", lazy.getName() );
+    BOOST_CHECK_EQUAL( "LAZY", parser.getParserKeywordFromDeckName( "FJAS" ).getName() );
+    BOOST_CHECK_EQUAL( &lazy, &parser.getKeyword( "LAZY" ) );
+    BOOST_CHECK_EQUAL( 1, created );
+
+    parser.addParserKeyword( createDynamicSized( "LAZY" ) );
+    BOOST_CHECK( &lazy != &parser.getKeyword( "LAZY" ) );
+}
+
 BOOST_AUTO_TEST_CASE(getAllDeckNames_hasTwoKeywords_returnsCompleteList) {
     Parser parser( false );
     std::cout << parser.getAllDeckNames().size() << std::endl;
@@ -1401,6 +1435,43 @@ BOOST_AUTO_TEST_CASE(ParserKeywordMatches) {
     BOOST_CHECK_EQUAL( false , parserKeyword.matches("WORLD#BC"));
 }
 
+BOOST_AUTO_TEST_CASE(ParserKeywordLeadingCharacters) {
+    auto parserKeyword = createFixedSized("HELLO", (size_t) 1);
+    parserKeyword.clearDeckNames();
+    parserKeyword.setMatchRegex("(WOR[LK]D?|ABC)(_?[A-Z]{3})?|XY.+");
+    BOOST_CHECK_EQUAL( parserKeyword.deckNameLeadingCharacters().value(), "WAX" );
+
+    parserKeyword.addDeckName("HELLO");
+    BOOST_CHECK_EQUAL( parserKeyword.deckNameLeadingCharacters().value(), "HWAX" );
+
+    auto optionalStart = createFixedSized("WORLD", (size_t) 1);
+    optionalStart.clearDeckNames();
+    optionalStart.setMatchRegex("(AB)?C.+");
+    BOOST_CHECK( !optionalStart.deckNameLeadingCharacters().has_value() );
+
+    optionalStart.setMatchRegex("[AB]C.+");
+    BOOST_CHECK( !optionalStart.deckNameLeadingCharacters().has_value() );
+}
+
+BOOST_AUTO_TEST_CASE(WildCardKeywordPrecedence) {
+    Parser parser( false );
+
+    auto indexed = createFixedSized("BBB", (size_t) 1);
+    indexed.clearDeckNames();
+    indexed.setMatchRegex("XY.+");
+    parser.addParserKeyword( indexed );
+
+    auto unindexed = createFixedSized("AAA", (size_t) 1);
+    unindexed.clearDeckNames();
+    unindexed.setMatchRegex("[XZ]Y.+");
+    parser.addParserKeyword( unindexed );
+
+    BOOST_CHECK_EQUAL( parser.getParserKeywordFromDeckName("XYZ").getName(), "AAA" );
+    BOOST_CHECK_EQUAL( parser.getParserKeywordFromDeckName("ZYZ").getName(), "AAA" );
+    BOOST_CHECK( !parser.isRecognizedKeyword("ZY") );
+    BOOST_CHECK( !parser.isRecognizedKeyword("WXYZ") );
+}
+
 BOOST_AUTO_TEST_CASE(AddDataKeyword_correctlyConfigured) {
     auto parserKeyword = createFixedSized("PORO", (size_t) 1);
     ParserItem item( "ACTNUM", INT);
@@ -2989,3 +3060,432 @@ END
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Parse_ROCK
+
+// ===========================================================================
+
+namespace {
+
+void writeFile(const std::string& fname, const std::string& content)
+{
+    std::ofstream os(fname);
+    os << content;
+}
+
+void writeIncludeDeck(const std::string& poro)
+{
+    std::filesystem::create_directories("props");
+
+    writeFile("CASE.DATA", R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+METRIC
+GRID
+INCLUDE
+  'grid.inc' /
+INCLUDE
+  'props/poro.inc' /
+EDIT
+PROPS
+SOLUTION
+SCHEDULE
+)");
+
+    writeFile("grid.inc", R"(-- Cartesian grid
+DX
+ 4*100 /
+DY
+ 4*100 /
+DZ
+ 4*10 /
+TOPS
+ 4*1000 /
+INCLUDE
+  'perm.inc' /
+)");
+
+    writeFile("perm.inc", R"(PERMX
+ 100 200 300 400 /
+PERMY
+ 4*100 /
+PERMZ
+ 4*10 /
+)");
+
+    writeFile("props/poro.inc", poro);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Parallel_Parsing)
+
+BOOST_AUTO_TEST_CASE(Parallel_Deck_Equals_Serial)
+{
+    WorkArea work_area("parallel_parse");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 0.3 0.4 /
+/
+NTG
+ 4*1 /
+)");
+
+    ParseContext parseContext;
+    parseContext.update(ParseContext::PARSE_RANDOM_SLASH, InputErrorAction::DELAYED_EXIT1);
+
+    Parser parser;
+    BOOST_CHECK_EQUAL(parser.numThreads(), 1);
+
+    ErrorGuard serial_errors;
+    const auto serial = parser.parseFile("CASE.DATA", parseContext, serial_errors);
+    const auto serial_msg = serial_errors.formattedErrors();
+    serial_errors.clear();
+
+    parser.setNumThreads(4);
+
+    ErrorGuard parallel_errors;
+    const auto parallel = parser.parseFile("CASE.DATA", parseContext, parallel_errors);
+    const auto parallel_msg = parallel_errors.formattedErrors();
+    parallel_errors.clear();
+
+    BOOST_CHECK(serial == parallel);
+    BOOST_CHECK_EQUAL(serial.size(), parallel.size());
+    BOOST_CHECK(serial_msg.find("Extra '/'") != std::string::npos);
+    BOOST_CHECK_EQUAL(serial_msg, parallel_msg);
+
+    const auto& permx = parallel["PERMX"].back().getRawDoubleData();
+    BOOST_CHECK_EQUAL(permx[3], 400.0);
+    BOOST_CHECK(parallel.hasKeyword("NTG"));
+}
+
+BOOST_AUTO_TEST_CASE(Parallel_Error_Equals_Serial)
+{
+    WorkArea work_area("parallel_parse_error");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 abc 0.4 /
+NTG
+ 4*1 /
+)");
+
+    const auto parse = [](const int numThreads) -> std::string
+    {
+        Parser parser;
+        parser.setNumThreads(numThreads);
+
+        try {
+            parser.parseFile("CASE.DATA");
+        }
+        catch (const OpmInputError& e) {
+            return e.what();
+        }
+
+        return "";
+    };
+
+    const auto serial_msg = parse(1);
+    BOOST_CHECK(serial_msg.find("PORO") != std::string::npos);
+    BOOST_CHECK_EQUAL(serial_msg, parse(4));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Parallel_Parsing
+
+BOOST_AUTO_TEST_SUITE(Deck_Snapshots)
+
+namespace {
+
+std::size_t numSnapshots(const std::filesystem::path& directory)
+{
+    if (!std::filesystem::exists(directory))
+        return 0;
+
+    std::size_t n = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+        n += entry.path().extension() == ".deck";
+
+    return n;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Snapshot_Equals_Parsed)
+{
+    WorkArea work_area("deck_snapshot");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 0.3 0.4 /
+)");
+
+    const auto parsed = Parser{}.parseFile("CASE.DATA");
+
+    Parser parser;
+    parser.setDeckCacheDirectory("cache");
+    BOOST_CHECK(parser.deckCacheDirectory() == std::filesystem::path("cache"));
+
+    const auto first = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(first == parsed);
+    BOOST_CHECK_EQUAL(numSnapshots("cache"), 1U);
+
+    Parser other;
+    other.setDeckCacheDirectory("cache");
+    const auto second = other.parseFile("CASE.DATA");
+    BOOST_CHECK(second == parsed);
+    BOOST_CHECK_EQUAL(second["PERMX"].back().getRawDoubleData()[3], 400.0);
+
+    // Changing an INCLUDE file invalidates the snapshot.
+    writeFile("perm.inc", R"(PERMX
+ 100 200 300 500 /
+PERMY
+ 4*100 /
+PERMZ
+ 4*10 /
+)");
+
+    const auto changed = other.parseFile("CASE.DATA");
+    BOOST_CHECK(!(changed == parsed));
+    BOOST_CHECK_EQUAL(changed["PERMX"].back().getRawDoubleData()[3], 500.0);
+    BOOST_CHECK_EQUAL(numSnapshots("cache"), 1U);
+
+    // Only the requested sections are part of the snapshot.
+    const auto runspec = other.parseFile("CASE.DATA", ParseContext{}, {Ecl::RUNSPEC});
+    BOOST_CHECK(!runspec.hasKeyword("PERMX"));
+    BOOST_CHECK_EQUAL(numSnapshots("cache"), 2U);
+}
+
+BOOST_AUTO_TEST_CASE(Snapshot_Not_Stored_With_Diagnostics)
+{
+    WorkArea work_area("deck_snapshot_warning");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 0.3 0.4 /
+/
+)");
+
+    ParseContext parseContext;
+    parseContext.update(ParseContext::PARSE_RANDOM_SLASH, InputErrorAction::IGNORE);
+
+    Parser parser;
+    parser.setDeckCacheDirectory("cache");
+
+    ErrorGuard errors;
+    parser.parseFile("CASE.DATA", parseContext, errors);
+    BOOST_CHECK(errors.hasWarnings());
+    BOOST_CHECK_EQUAL(numSnapshots("cache"), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(DeckCache_Store_Load)
+{
+    WorkArea work_area("deck_cache");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 0.3 0.4 /
+)");
+
+    const auto deck = Parser{}.parseFile("CASE.DATA");
+    const auto inputFiles = std::vector<std::filesystem::path> {
+        "CASE.DATA", "grid.inc", "perm.inc", "props/poro.inc",
+    };
+
+    const DeckCache cache("cache");
+    BOOST_CHECK(!cache.load("CASE.DATA", "key").has_value());
+    BOOST_CHECK(cache.store("CASE.DATA", "key", deck, inputFiles));
+
+    const auto loaded = cache.load("CASE.DATA", "key");
+    BOOST_REQUIRE(loaded.has_value());
+    BOOST_CHECK(*loaded == deck);
+
+    BOOST_CHECK(!cache.load("CASE.DATA", "other key").has_value());
+    BOOST_CHECK(!cache.load("OTHER.DATA", "key").has_value());
+
+    writeFile("props/poro.inc", R"(PORO
+ 0.1 0.2 0.3 0.5 /
+)");
+    BOOST_CHECK(!cache.load("CASE.DATA", "key").has_value());
+
+    // Corrupt snapshots are ignored.
+    writeFile(cache.snapshotPath("CASE.DATA", "key").string(), "garbage");
+    BOOST_CHECK(!cache.load("CASE.DATA", "key").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(Input_File_Hash)
+{
+    // Reference values of XXH64 with seed zero.
+    BOOST_CHECK_EQUAL(InputFileManifest::hash(""), 0xEF46DB3751D8E999ULL);
+    BOOST_CHECK_EQUAL(InputFileManifest::hash("a"), 0xD24EC4F1A98C6E5BULL);
+    BOOST_CHECK_EQUAL(InputFileManifest::hash("abc"), 0x44BC2CF5AD770999ULL);
+    BOOST_CHECK_EQUAL(InputFileManifest::hash("0123456789abcdefghijklmnopqrstuvwxyz"
+                                              "0123456789ABCDEF-INCLUDE 'x' /\n"),
+                      0xEFA74C9E470DCB6FULL);
+}
+
+BOOST_AUTO_TEST_CASE(Input_File_Manifest)
+{
+    WorkArea work_area("input_file_manifest");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 0.3 0.4 /
+-- INCLUDE
+--   'commented.inc' /
+)");
+
+    const auto manifest = InputFileManifest::create("CASE.DATA", 2);
+    const auto& files = manifest.files();
+    BOOST_REQUIRE_EQUAL(files.size(), 4U);
+    BOOST_CHECK(files[0].path == std::filesystem::canonical("CASE.DATA"));
+    BOOST_CHECK(files[1].path == std::filesystem::canonical("grid.inc"));
+    BOOST_CHECK(files[2].path == std::filesystem::canonical("props/poro.inc"));
+    BOOST_CHECK(files[3].path == std::filesystem::canonical("perm.inc"));
+    for (const auto& file : files) {
+        BOOST_CHECK(file.found);
+        BOOST_CHECK_EQUAL(file.size, std::filesystem::file_size(file.path));
+    }
+
+    const auto poro = manifest.find("props/poro.inc");
+    BOOST_REQUIRE(poro.has_value());
+    BOOST_CHECK(poro->path == files[2].path);
+    BOOST_CHECK(!manifest.find("other.inc").has_value());
+
+    // The total hash follows the content, not the location.
+    const auto total = manifest.hash();
+    BOOST_CHECK_EQUAL(InputFileManifest::create("CASE.DATA").hash(), total);
+
+    writeFile("perm.inc", "PERMX\n 4*1 /\n");
+    BOOST_CHECK(InputFileManifest::create("CASE.DATA").hash() != total);
+
+    std::ostringstream os;
+    manifest.write(os);
+    BOOST_CHECK(os.str().find("props/poro.inc") != std::string::npos);
+
+    BOOST_CHECK_THROW(InputFileManifest::create("MISSING.DATA"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Input_File_Manifest_Paths)
+{
+    WorkArea work_area("input_file_manifest_paths");
+    std::filesystem::create_directories("include");
+
+    writeFile("CASE.DATA", R"(RUNSPEC
+PATHS
+  'INC' 'include' /
+/
+GRID
+INCLUDE
+  '$INC/grid.inc' /
+IMPORT
+  'grid.bin' /
+INCLUDE
+  missing.inc /
+)");
+    writeFile("include/grid.inc", "INCLUDE\n 'include/perm.inc' /\n");
+    writeFile("include/perm.inc", "PERMX\n 4*1 /\n");
+    writeFile("grid.bin", "binary");
+
+    const auto manifest = InputFileManifest::create("CASE.DATA");
+    const auto& files = manifest.files();
+    BOOST_REQUIRE_EQUAL(files.size(), 5U);
+    BOOST_CHECK(files[1].path == std::filesystem::path("missing.inc"));
+    BOOST_CHECK(!files[1].found);
+    BOOST_CHECK(files[2].path == std::filesystem::canonical("include/grid.inc"));
+    BOOST_CHECK(files[3].path == std::filesystem::canonical("grid.bin"));
+    BOOST_CHECK_EQUAL(files[3].hash, InputFileManifest::hash("binary"));
+    BOOST_CHECK(files[4].path == std::filesystem::canonical("include/perm.inc"));
+}
+
+BOOST_AUTO_TEST_CASE(DeckCache_Load_Manifest)
+{
+    WorkArea work_area("deck_cache_manifest");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 0.3 0.4 /
+)");
+
+    const auto deck = Parser{}.parseFile("CASE.DATA");
+    const auto inputFiles = std::vector<std::filesystem::path> {
+        "CASE.DATA", "grid.inc", "perm.inc", "props/poro.inc",
+    };
+
+    const DeckCache cache("cache");
+    BOOST_CHECK(cache.store("CASE.DATA", "key", deck, inputFiles));
+
+    const auto loaded = cache.load("CASE.DATA", "key", InputFileManifest::create("CASE.DATA"));
+    BOOST_REQUIRE(loaded.has_value());
+    BOOST_CHECK(*loaded == deck);
+
+    writeFile("perm.inc", R"(PERMX
+ 100 200 300 500 /
+)");
+    BOOST_CHECK(!cache.load("CASE.DATA", "key", InputFileManifest::create("CASE.DATA")).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Deck_Snapshots
+
+BOOST_AUTO_TEST_SUITE(Lazy_Keywords)
+
+BOOST_AUTO_TEST_CASE(Lazy_Deck_Equals_Eager)
+{
+    WorkArea work_area("lazy_keywords");
+    writeIncludeDeck(R"(PORO
+ 0.1 0.2 2*0.3 /
+)");
+
+    const auto eager = Parser{}.parseFile("CASE.DATA");
+
+    Parser parser;
+    parser.setLazyKeywords(true);
+    BOOST_CHECK(parser.lazyKeywords());
+
+    const auto lazy = parser.parseFile("CASE.DATA");
+    BOOST_CHECK_EQUAL(lazy.size(), eager.size());
+    BOOST_CHECK(!lazy["DIMENS"].back().hasPendingRecords());
+
+    const auto& poro = lazy["PORO"].back();
+    BOOST_CHECK(poro.hasPendingRecords());
+    BOOST_CHECK(poro.isDataKeyword());
+    BOOST_CHECK_EQUAL(poro.location().lineno, 1);
+
+    const GRIDSection grid(lazy);
+    const GRIDSection eager_grid(eager);
+    const auto& permx = grid["PERMX"].back();
+    BOOST_CHECK(permx.hasPendingRecords());
+    BOOST_CHECK_EQUAL(permx.getRawDoubleData()[3], 400.0);
+    BOOST_CHECK_EQUAL(permx.getSIDoubleData()[3], eager_grid["PERMX"].back().getSIDoubleData()[3]);
+    BOOST_CHECK(!permx.hasPendingRecords());
+    BOOST_CHECK(poro.hasPendingRecords());
+
+    BOOST_CHECK(lazy == eager);
+    BOOST_CHECK(!poro.hasPendingRecords());
+}
+
+BOOST_AUTO_TEST_CASE(Lazy_Field_Units)
+{
+    const std::string deck_string = R"(RUNSPEC
+FIELD
+GRID
+PERMX
+ 2*100 /
+TOPS
+ 1000 2000 /
+)";
+
+    Parser parser;
+    parser.setLazyKeywords(true);
+    const auto eager = Parser{}.parseString(deck_string);
+    const auto lazy = parser.parseString(deck_string);
+
+    BOOST_CHECK(lazy["TOPS"].back().hasPendingRecords());
+    BOOST_CHECK(lazy["TOPS"].back().getSIDoubleData() == eager["TOPS"].back().getSIDoubleData());
+    BOOST_CHECK(lazy["PERMX"].back().getSIDoubleData() == eager["PERMX"].back().getSIDoubleData());
+    BOOST_CHECK(lazy == eager);
+}
+
+BOOST_AUTO_TEST_CASE(Lazy_Error_On_Access)
+{
+    const std::string deck_string = R"(GRID
+PORO
+ 0.1 abc 0.3 /
+)";
+
+    BOOST_CHECK_THROW(Parser{}.parseString(deck_string), OpmInputError);
+
+    Parser parser;
+    parser.setLazyKeywords(true);
+    const auto deck = parser.parseString(deck_string);
+
+    const auto& poro = deck["PORO"].back();
+    BOOST_CHECK(poro.hasPendingRecords());
+    BOOST_CHECK_THROW(poro.getRawDoubleData(), OpmInputError);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Lazy_Keywords
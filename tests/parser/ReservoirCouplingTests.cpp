@@ -24,6 +24,7 @@
 #include <opm/input/eclipse/Schedule/ResCoup/GrupSlav.hpp>
 #include <opm/input/eclipse/Schedule/ResCoup/MasterGroup.hpp>
 #include <opm/input/eclipse/Schedule/ResCoup/Slaves.hpp>
+#include <opm/input/eclipse/Schedule/ResCoup/SharedMemoryExchange.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
@@ -36,8 +37,10 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 
+#include <cstdlib>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace Opm;
 namespace {
@@ -395,3 +398,112 @@ GRUPSLAV
     BOOST_CHECK_EQUAL(grup_slav.name(), "MANI-D");
     BOOST_CHECK_EQUAL(grup_slav.masterGroupName(), "MANI-D");
 }
+
+BOOST_AUTO_TEST_CASE(SHARED_MEMORY_GROUP_INDEX) {
+    using namespace Opm::ReservoirCoupling;
+    using Flag = GrupSlav::FilterFlag;
+
+    CouplingInfo master;
+    master.masterGroups().emplace("D1-M", MasterGroup{"D1-M", "RES-1", "MANI-D", 1.0});
+    master.masterGroups().emplace("B1-M", MasterGroup{"B1-M", "RES-1", "MANI-B", 1.0});
+    master.masterGroups().emplace("C1-M", MasterGroup{"C1-M", "RES-2", "MANI-C", 1.0});
+
+    CouplingInfo slave;
+    slave.grupSlavs().emplace("MANI-D", GrupSlav{"MANI-D", "D1-M", Flag::BOTH, Flag::BOTH, Flag::BOTH,
+                                                 Flag::BOTH, Flag::BOTH, Flag::BOTH, Flag::BOTH});
+    slave.grupSlavs().emplace("MANI-B", GrupSlav{"MANI-B", "B1-M", Flag::BOTH, Flag::BOTH, Flag::BOTH,
+                                                 Flag::BOTH, Flag::BOTH, Flag::BOTH, Flag::BOTH});
+
+    const auto master_map = GroupIndexMap::fromMaster(master, "RES-1");
+    const auto slave_map = GroupIndexMap::fromSlave(slave);
+    BOOST_CHECK_EQUAL(master_map.size(), 2U);
+    BOOST_CHECK_EQUAL(slave_map.size(), 2U);
+    BOOST_CHECK_EQUAL(master_map.index("B1-M"), slave_map.index("MANI-B"));
+    BOOST_CHECK_EQUAL(master_map.index("D1-M"), slave_map.index("MANI-D"));
+    BOOST_CHECK_EQUAL(slave_map.name(master_map.index("D1-M")), "MANI-D");
+    BOOST_CHECK_THROW(master_map.index("C1-M"), std::out_of_range);
+    BOOST_CHECK_THROW(slave_map.name(2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(SHARED_MEMORY_RING) {
+    using namespace Opm::ReservoirCoupling;
+
+    std::vector<std::max_align_t> memory(GroupRecordRing::ringBytes(5) / sizeof(std::max_align_t) + 8);
+    auto* base = reinterpret_cast<char*>(memory.data());
+    base += (64 - reinterpret_cast<std::uintptr_t>(base) % 64) % 64;
+
+    auto writer = GroupRecordRing::create(base, 5);
+    auto reader = GroupRecordRing::attach(base);
+    BOOST_CHECK_EQUAL(writer.capacity(), 8U);
+    BOOST_CHECK(reader.empty());
+    BOOST_CHECK(!reader.pop().has_value());
+
+    // Push and pop past the end of the buffer to exercise wrap-around.
+    const auto make_record = [](const int i)
+    {
+        GroupRecord record;
+        record.time = i;
+        record.group_index = i % 3;
+        record.kind = GroupRecord::Kind::ProductionTarget;
+        record.values = {1.0*i, 2.0*i, 3.0*i, 4.0*i};
+        return record;
+    };
+
+    int next_read = 0;
+    for (int i = 0; i < 14; ++i) {
+        BOOST_CHECK(writer.push(make_record(i)));
+
+        if (i % 2 == 1) {
+            const auto popped = reader.pop();
+            BOOST_REQUIRE(popped.has_value());
+            BOOST_CHECK_EQUAL(popped->time, next_read);
+            BOOST_CHECK_EQUAL(popped->group_index, next_read % 3);
+            BOOST_CHECK_EQUAL(popped->values[3], 4.0*next_read);
+            ++next_read;
+        }
+    }
+
+    BOOST_CHECK(writer.push(make_record(14)));
+    BOOST_CHECK_EQUAL(reader.size(), 8U);
+    BOOST_CHECK(!writer.push(make_record(15)));
+
+    const auto count = reader.drain([&next_read](const GroupRecord& record)
+    {
+        BOOST_CHECK_EQUAL(record.time, next_read);
+        ++next_read;
+    });
+    BOOST_CHECK_EQUAL(count, 8U);
+    BOOST_CHECK_EQUAL(next_read, 15);
+    BOOST_CHECK(reader.empty());
+}
+
+BOOST_AUTO_TEST_CASE(SHARED_MEMORY_CHANNEL) {
+    using namespace Opm::ReservoirCoupling;
+
+    const std::string slave_name = "TEST-" + std::to_string(std::rand());
+    auto master = SharedMemoryChannel::create(slave_name, 16);
+    auto slave = SharedMemoryChannel::open(slave_name);
+
+    GroupRecord potentials;
+    potentials.group_index = 1;
+    potentials.values = {100.0, 2000.0, 50.0, 180.0};
+    BOOST_CHECK(slave.slaveToMaster().push(potentials));
+
+    GroupRecord target;
+    target.group_index = 0;
+    target.kind = GroupRecord::Kind::InjectionTarget;
+    target.values[2] = 500.0;
+    BOOST_CHECK(master.masterToSlave().push(target));
+
+    const auto received_potentials = master.slaveToMaster().pop();
+    BOOST_REQUIRE(received_potentials.has_value());
+    BOOST_CHECK_EQUAL(received_potentials->group_index, 1);
+    BOOST_CHECK_EQUAL(received_potentials->values[1], 2000.0);
+
+    const auto received_target = slave.masterToSlave().pop();
+    BOOST_REQUIRE(received_target.has_value());
+    BOOST_CHECK(received_target->kind == GroupRecord::Kind::InjectionTarget);
+    BOOST_CHECK_EQUAL(received_target->values[2], 500.0);
+
+    BOOST_CHECK_THROW(SharedMemoryChannel::open(slave_name + "-MISSING"), std::runtime_error);
+}
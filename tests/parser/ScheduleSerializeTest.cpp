@@ -470,3 +470,34 @@ BOOST_AUTO_TEST_CASE(SerializeGROUPS)
     BOOST_CHECK( groups2 == sched0[4].groups);
     BOOST_CHECK( groups2 == sched0[5].groups);
 }
+
+BOOST_AUTO_TEST_CASE(SerializeSharedWells)
+{
+    auto sched = make_schedule(WTEST_deck);
+    Opm::Schedule sched0;
+
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(sched);
+        ser.unpack(sched0);
+    }
+
+    BOOST_REQUIRE_EQUAL(sched.size(), sched0.size());
+    for (std::size_t step = 0; step < sched.size(); ++step) {
+        BOOST_CHECK( sched[step].wells == sched0[step].wells );
+        BOOST_CHECK( sched[step].groups == sched0[step].groups );
+        if (step == 0)
+            continue;
+
+        // Objects shared between report steps are shared after unpacking,
+        // and unchanged maps keep sharing their version.
+        for (const auto& well : sched[step].wells.keys()) {
+            const bool shared = sched[step].wells.get_ptr(well) == sched[step - 1].wells.get_ptr(well);
+            BOOST_CHECK_EQUAL( shared, sched0[step].wells.get_ptr(well) == sched0[step - 1].wells.get_ptr(well) );
+        }
+
+        const bool unchanged = sched[step].wells.version() == sched[step - 1].wells.version();
+        BOOST_CHECK_EQUAL( unchanged, sched0[step].wells.version() == sched0[step - 1].wells.version() );
+    }
+}
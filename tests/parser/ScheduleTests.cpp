@@ -31,6 +31,7 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <opm/common/utility/ActiveGridCells.hpp>
+#include <opm/common/utility/MemoryUsage.hpp>
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
@@ -49,6 +50,7 @@
 
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
+#include <opm/input/eclipse/Schedule/GasLiftPlan.hpp>
 #include <opm/input/eclipse/Schedule/Group/GTNode.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRate.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
@@ -510,6 +512,28 @@ BOOST_AUTO_TEST_CASE(CreateScheduleDeckWellsOrderedGRUPTREE) {
         BOOST_CHECK( has_well( parent_wells2, "BW_2" ));
         BOOST_CHECK( has_well( parent_wells2, "AW_3" ));
     }
+
+    // The pointer views hold the same wells, in the same order, as the copies.
+    for (const auto* group_name : { "FIELD", "PLATFORM", "CG1", "PG2" }) {
+        const auto copies = schedule.getChildWells2(group_name, 0);
+        const auto views = schedule.getChildWellPtrs(group_name, 0);
+        BOOST_REQUIRE_EQUAL(views.size(), copies.size());
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            BOOST_CHECK_EQUAL(views[i]->name(), copies[i].name());
+            BOOST_CHECK_EQUAL(views[i], &schedule.getWell(copies[i].name(), 0));
+        }
+    }
+
+    {
+        const auto copies = schedule.getWells(0);
+        const auto views = schedule.getWellPtrs(0);
+        BOOST_REQUIRE_EQUAL(views.size(), copies.size());
+        for (std::size_t i = 0; i < views.size(); ++i)
+            BOOST_CHECK(*views[i] == copies[i]);
+
+        BOOST_CHECK_EQUAL(schedule.getWellPtrsAtEnd().size(), schedule.getWellsatEnd().size());
+        BOOST_CHECK_EQUAL(schedule.getActiveWellPtrsAtEnd().size(), schedule.getActiveWellsAtEnd().size());
+    }
     auto group_names = schedule.groupNames("P*", 0);
     BOOST_CHECK( std::find(group_names.begin(), group_names.end(), "PG1") != group_names.end() );
     BOOST_CHECK( std::find(group_names.begin(), group_names.end(), "PG2") != group_names.end() );
@@ -4639,6 +4663,96 @@ WLIFTOPT
     BOOST_CHECK(!glo.has_well("NO-WELL"));
 }
 
+BOOST_AUTO_TEST_CASE(GASLIFT_PLAN) {
+    const auto input = R"(
+SCHEDULE
+
+GRUPTREE
+ 'M5S'    'PLAT-A'  /
+ 'M5N'    'PLAT-A'  /
+ 'C1'     'M5N'  /
+ 'B1'     'M5S'  /
+ /
+
+LIFTOPT
+ 12500 5E-3 0.0 YES /
+
+GLIFTOPT
+ 'PLAT-A'  200000 /
+ 'M5N'     1*  300000 /
+/
+
+WELSPECS
+ 'B-1H'  'B1'   11    3      1*   OIL     1*   1*   SHUT 1* 1* 1* /
+ 'C-1H'  'C1'   13   20      1*   OIL     1*   1*   SHUT 1* 1* 1* /
+ 'C-2H'  'C1'   12   27      1*   OIL     1*   1*   SHUT 1* 1* 1* /
+ 'D-1H'  'B1'   12   27      1*   OIL     1*   1*   SHUT 1* 1* 1* /
+/
+
+WLIFTOPT
+ 'C-1H'   YES   150000   1.01   -1.0  1.0 YES/
+ 'B-1H'   YES   1*       1.25   /
+ 'C-2H'   NO    /
+/
+)";
+    Opm::UnitSystem unitSystem = UnitSystem( UnitSystem::UnitType::UNIT_TYPE_METRIC );
+    double siFactorG = unitSystem.parse("GasSurfaceVolume/Time").getSIScaling();
+    const auto sched = make_schedule(input);
+    const auto plan = sched.glo_plan(0);
+
+    BOOST_CHECK(plan.active());
+    BOOST_CHECK_CLOSE(plan.increment(), 12500 * siFactorG, 1.0e-10);
+    BOOST_CHECK(plan.allNewton());
+
+    // Well insertion order, wells without WLIFTOPT excluded.
+    BOOST_CHECK(plan.wellNames() == std::vector<std::string>({"B-1H", "C-1H", "C-2H"}));
+    BOOST_CHECK(!plan.wellIndex("D-1H").has_value());
+
+    const auto c1 = *plan.wellIndex("C-1H");
+    BOOST_CHECK(plan.useGlo(c1));
+    BOOST_CHECK_EQUAL(*plan.maxRate(c1), 150000 * siFactorG);
+    BOOST_CHECK_EQUAL(plan.weightFactor(c1), 1.01);
+    BOOST_CHECK_EQUAL(plan.incWeightFactor(c1), 1.0);
+    BOOST_CHECK(plan.allocExtraGas(c1));
+
+    const auto b1 = *plan.wellIndex("B-1H");
+    BOOST_CHECK(!plan.maxRate(b1).has_value());
+    BOOST_CHECK_EQUAL(plan.weightFactor(b1), 1.25);
+    BOOST_CHECK(!plan.useGlo(*plan.wellIndex("C-2H")));
+
+    // Group insertion order: PLAT-A is created by the M5S record.
+    BOOST_CHECK(plan.groupNames() == std::vector<std::string>({"PLAT-A", "M5N"}));
+    const auto plat = *plan.groupIndex("PLAT-A");
+    const auto m5n = *plan.groupIndex("M5N");
+    BOOST_CHECK(!plan.groupIndex("M5S").has_value());
+    BOOST_CHECK_EQUAL(*plan.maxLiftGas(plat), 200000 * siFactorG);
+    BOOST_CHECK(!plan.maxTotalGas(plat).has_value());
+    BOOST_CHECK(!plan.maxLiftGas(m5n).has_value());
+    BOOST_CHECK_EQUAL(*plan.maxTotalGas(m5n), 300000 * siFactorG);
+
+    const auto chain = [&plan](const std::size_t well)
+    {
+        const auto range = plan.groupChain(well);
+        return std::vector<std::size_t>(range.begin(), range.end());
+    };
+
+    BOOST_CHECK(chain(b1) == std::vector<std::size_t>({plat}));
+    BOOST_CHECK(chain(c1) == std::vector<std::size_t>({m5n, plat}));
+
+    const auto wells = [&plan](const std::size_t group)
+    {
+        const auto range = plan.groupWells(group);
+        return std::vector<std::size_t>(range.begin(), range.end());
+    };
+
+    BOOST_CHECK(wells(plat) == std::vector<std::size_t>({0, 1, 2}));
+    BOOST_CHECK(wells(m5n) == std::vector<std::size_t>({1, 2}));
+
+    const auto empty = GasLiftPlan{};
+    BOOST_CHECK(!empty.active());
+    BOOST_CHECK_EQUAL(empty.numWells(), 0U);
+}
+
 BOOST_AUTO_TEST_CASE(WellPI) {
     const auto deck = Parser{}.parseString(R"(RUNSPEC
 START
@@ -5438,6 +5552,32 @@ BOOST_AUTO_TEST_CASE(ScheduleDeckTest) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(ScheduleDeckStreamTest) {
+    Parser parser;
+    auto deck = parser.parseString( createDeckWTEST() );
+    Runspec runspec{deck};
+    const auto start_time = TimeService::from_time_t(runspec.start_time());
+    const ScheduleDeck full_deck( start_time, deck, {} );
+
+    auto stream = std::make_shared<ScheduleKeywordStream>(deck, /* release_keywords = */ true);
+    ScheduleDeck sched_deck( start_time, stream, {} );
+    BOOST_CHECK_EQUAL( sched_deck.size(), full_deck.size() );
+    for (std::size_t block_index = 0; block_index < sched_deck.size(); block_index++)
+        BOOST_CHECK_EQUAL( sched_deck[block_index].size(), 0 );
+
+    sched_deck.load_keywords(1);
+    BOOST_CHECK( sched_deck[1] == full_deck[1] );
+    BOOST_CHECK_EQUAL( sched_deck[2].size(), 0 );
+
+    // The records of the pulled keywords are released from the deck.
+    const auto& wconhist = deck["WCONHIST"][1];
+    BOOST_CHECK_EQUAL( wconhist.size(), 0 );
+    BOOST_CHECK_EQUAL( deck["WCONHIST"][0].size(), 1 );
+
+    sched_deck.finish_loading();
+    BOOST_CHECK( sched_deck == full_deck );
+}
+
 
 
 BOOST_AUTO_TEST_CASE(WCONPROD_UDA) {
@@ -6305,3 +6445,101 @@ DATES             -- 1
     schedule.clear_event(ScheduleEvents::TUNING_CHANGE, 1);
     BOOST_CHECK(!schedule[1].events().hasEvent(ScheduleEvents::TUNING_CHANGE));
 }
+
+BOOST_AUTO_TEST_CASE(MemoryUsageSharedConnections) {
+    const auto schedule = make_schedule(R"(
+START
+10 MAI 2007 /
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+SCHEDULE
+WELSPECS
+     'P'    'OP'   1   1  1*   'OIL' /
+/
+
+COMPDAT
+ 'P'  1  1   1   3 'OPEN' 1*    1.168   0.311   107.872 1*  1*  'Z'  21.925 /
+/
+
+WCONHIST
+     'P'      'OPEN'      'ORAT'      100.000  /
+/
+
+DATES             -- 1
+ 10  JUN 2007 /
+/
+
+WCONHIST
+     'P'      'OPEN'      'ORAT'      200.000  /
+/
+
+DATES             -- 2
+ 10  JUL 2007 /
+/
+)");
+
+    const auto usage = schedule.memoryUsage();
+    BOOST_REQUIRE_EQUAL(usage.size(), schedule.size());
+
+    BOOST_CHECK_EQUAL(usage[0].wells, std::size_t{1});
+    BOOST_CHECK_EQUAL(usage[0].connections, std::size_t{1});
+    BOOST_CHECK(usage[0].bytes > 0);
+
+    // A rate update creates a new well, but shares its connections.
+    BOOST_CHECK_EQUAL(usage[1].wells, std::size_t{1});
+    BOOST_CHECK_EQUAL(usage[1].connections, std::size_t{0});
+    BOOST_CHECK(usage[1].bytes < usage[0].bytes);
+    BOOST_CHECK(&schedule[0].wells("P").getConnections() == &schedule[1].wells("P").getConnections());
+
+    auto visitor = Opm::MemoryUsage{};
+    const auto tree = schedule.memoryUsage(visitor);
+    BOOST_CHECK_EQUAL(tree.name, "Schedule");
+    BOOST_CHECK(tree.child("ScheduleState").bytes > schedule.size() * sizeof(ScheduleState));
+    BOOST_CHECK(tree.bytes > tree.child("ScheduleState").bytes + tree.child("ScheduleDeck").bytes);
+}
+
+BOOST_AUTO_TEST_CASE(WellAndGroupIndexLookup) {
+    const auto schedule = make_schedule(createDeckWithWells());
+
+    BOOST_CHECK_EQUAL(schedule.wellIndex("W_1").value(), std::size_t{0});
+    BOOST_CHECK_EQUAL(schedule.wellIndex("WX2").value(), std::size_t{1});
+    BOOST_CHECK_EQUAL(schedule.wellIndex("W_3").value(), std::size_t{2});
+    BOOST_CHECK(!schedule.wellIndex("NO_SUCH_WELL").has_value());
+
+    BOOST_CHECK( schedule.hasWell(0, 1));
+    BOOST_CHECK(!schedule.hasWell(1, 1));
+    BOOST_CHECK( schedule.hasWell(1, 3));
+    BOOST_CHECK_EQUAL(schedule.getWell(2, 3).name(), "W_3");
+    BOOST_CHECK_THROW(schedule.getWell(2, 1), std::invalid_argument);
+
+    const auto op = schedule.groupIndex("OP");
+    BOOST_REQUIRE(op.has_value());
+    BOOST_CHECK_EQUAL(schedule.getGroup(*op, 3).name(), "OP");
+    BOOST_CHECK(!schedule.groupIndex("NO_SUCH_GROUP").has_value());
+
+    const auto indices = schedule.wellMatcher(3).wellIndices("W_*");
+    BOOST_CHECK((indices == std::vector<std::size_t>{0, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(NameOrderPatternMatch) {
+    auto order = NameOrder { "PROD2", "INJ1", "PROD10", "PROD1", "OBS" };
+
+    BOOST_CHECK((order.match("PROD*") == std::vector<std::string>{"PROD2", "PROD10", "PROD1"}));
+    BOOST_CHECK((order.match("PROD?") == std::vector<std::string>{"PROD2", "PROD1"}));
+    BOOST_CHECK((order.match("*1") == std::vector<std::string>{"INJ1", "PROD1"}));
+    BOOST_CHECK((order.match("*1*") == std::vector<std::string>{"INJ1", "PROD10", "PROD1"}));
+    BOOST_CHECK(order.match("X*").empty());
+
+    // Memoized results must follow changes to the name set.
+    const auto copy = order;
+    order.add("PROD3");
+    BOOST_CHECK((order.match("PROD?") == std::vector<std::string>{"PROD2", "PROD1", "PROD3"}));
+    BOOST_CHECK((copy.match("PROD?") == std::vector<std::string>{"PROD2", "PROD1"}));
+}
@@ -18,11 +18,13 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/GridDims.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/S.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Schedule/Source.hpp>
 
+#include <cmath>
 #include <string>
 
 namespace {
@@ -230,4 +232,69 @@ SOURCE
     BOOST_CHECK_EQUAL(temp1, 50 + 273.15);
     double temp2 = prop.temperature({{0,0,0}, Opm::SourceComponent::WATER});
     BOOST_CHECK_EQUAL(temp2, 273.15 + 100);   
+}
+
+BOOST_AUTO_TEST_CASE(SourceCellTable)
+{
+    const std::string input = R"(
+RUNSPEC
+
+DIMENS
+  10 10 3 /
+OIL
+GAS
+WATER
+START
+  1 'JAN' 2015 /
+GRID
+DX
+  300*1000 /
+DY
+  300*1000 /
+DZ
+  300*1000 /
+TOPS
+  100*8325 /
+
+SCHEDULE
+
+SOURCE
+ 1 1 2 WATER 0.02 /
+ 1 1 1 GAS 0.01 1.0 /
+ 2 1 1 OIL 0.03 /
+ 1 1 1 WATER 0.04 /
+/
+)";
+
+    auto deck = createDeck(input);
+    const auto& kw = deck.get<Opm::ParserKeywords::SOURCE>();
+    const Opm::GridDims grid(deck);
+    Opm::Source prop;
+    for (const auto& record : kw[0]) {
+        prop.updateSource(record);
+    }
+
+    const auto table = prop.cellTable(grid);
+    BOOST_REQUIRE_EQUAL(table.numCells(), 3U);
+    BOOST_REQUIRE_EQUAL(table.numTerms(), 4U);
+
+    const std::vector<std::size_t> cells { 0, 1, 100 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(table.cells.begin(), table.cells.end(),
+                                  cells.begin(), cells.end());
+
+    const std::vector<std::size_t> start { 0, 2, 3, 4 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(table.start.begin(), table.start.end(),
+                                  start.begin(), start.end());
+
+    // Terms of a cell in input order
+    BOOST_CHECK(table.components[0] == Opm::SourceComponent::GAS);
+    BOOST_CHECK(table.components[1] == Opm::SourceComponent::WATER);
+    BOOST_CHECK_EQUAL(table.rates[1], prop.rate({{0,0,0}, Opm::SourceComponent::WATER}));
+    BOOST_CHECK_EQUAL(table.hrates[0], prop.hrate({{0,0,0}, Opm::SourceComponent::GAS}));
+    BOOST_CHECK(std::isnan(table.hrates[1]));
+    BOOST_CHECK(std::isnan(table.temperatures[0]));
+    BOOST_CHECK(table.components[3] == Opm::SourceComponent::WATER);
+
+    BOOST_CHECK_EQUAL(table.find(100), 2);
+    BOOST_CHECK_EQUAL(table.find(2), -1);
 }
\ No newline at end of file
@@ -18,7 +18,11 @@
  */
 
 #define BOOST_TEST_MODULE ParserTests
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 
 #include "../../opm/input/eclipse/Parser/raw/StarToken.hpp"
@@ -125,3 +129,87 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "'123*456'" ) ) );
 }
+
+namespace {
+
+template <typename T>
+void scanTokens(const std::string& record, const std::optional<T>& defaultValue,
+                std::vector<T>& values, std::vector<Opm::value::status>& status)
+{
+    std::istringstream stream(record);
+    std::string token;
+    while (stream >> token) {
+        std::string countString;
+        std::string valueString;
+        if (!Opm::isStarToken(token, countString, valueString)) {
+            values.push_back(Opm::readValueToken<T>(token));
+            status.push_back(Opm::value::status::deck_value);
+            continue;
+        }
+
+        Opm::StarToken st(token, countString, valueString);
+        if (st.hasValue()) {
+            values.insert(values.end(), st.count(), Opm::readValueToken<T>(st.valueString()));
+            status.insert(status.end(), st.count(), Opm::value::status::deck_value);
+        } else if (defaultValue.has_value()) {
+            values.insert(values.end(), st.count(), *defaultValue);
+            status.insert(status.end(), st.count(), Opm::value::status::valid_default);
+        } else {
+            values.insert(values.end(), st.count(), T());
+            status.insert(status.end(), st.count(), Opm::value::status::empty_default);
+        }
+    }
+}
+
+template <typename T>
+void checkScanNumericArray(const std::string& record, const std::optional<T>& defaultValue)
+{
+    std::vector<T> expected;
+    std::vector<Opm::value::status> expected_status;
+    scanTokens(record, defaultValue, expected, expected_status);
+
+    std::vector<T> values;
+    std::vector<Opm::value::status> status;
+    BOOST_REQUIRE(Opm::scanNumericArray(record, defaultValue, values, status));
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+    BOOST_CHECK(status == expected_status);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE( scanNumericArray_double ) {
+    const auto record = std::string {
+        "0.25 .5 5. -1.5 +2.75 1e5 1E-5 3.3d0 2.5D+3 -0.0 0.1 0.7 123456.789\n"
+        "  3*0.15\t2* * 10*1.0e-3 0.30000000000000004 123456789012345678901234 1e300\n"
+        " 4.9406564584124654e-324 2*1e-30 17 2*-4 "
+    };
+
+    checkScanNumericArray<double>(record, std::nullopt);
+    checkScanNumericArray<double>(record, 7.5);
+}
+
+BOOST_AUTO_TEST_CASE( scanNumericArray_int ) {
+    const auto record = std::string { "1 +2 -3 007 2147483647 -2147483648 4*5 3* * 1000000000 2*-1 " };
+
+    checkScanNumericArray<int>(record, std::nullopt);
+    checkScanNumericArray<int>(record, 42);
+}
+
+BOOST_AUTO_TEST_CASE( scanNumericArray_malformed ) {
+    std::vector<double> dvalues;
+    std::vector<int> ivalues;
+    std::vector<Opm::value::status> status;
+
+    BOOST_CHECK_THROW( Opm::scanNumericArray<double>("1 2 truls 3", std::nullopt, dvalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<double>("1 1.0.0", std::nullopt, dvalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<double>("3*1.5h", std::nullopt, dvalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<double>("0*1.5", std::nullopt, dvalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<double>("*1.5", std::nullopt, dvalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<int>("1 3.3", std::nullopt, ivalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<int>("2147483648", std::nullopt, ivalues, status), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::scanNumericArray<int>("99999999999*1", std::nullopt, ivalues, status), std::out_of_range );
+
+    // Quoted tokens are left to the RawRecord splitting.
+    BOOST_CHECK( !Opm::scanNumericArray<double>("1 '2 3'", std::nullopt, dvalues, status) );
+}
@@ -123,6 +123,48 @@ BOOST_AUTO_TEST_CASE(split) {
 }
 
 
+BOOST_AUTO_TEST_CASE(split_views) {
+    const std::string s1 = "a,,b,";
+
+    const auto split1 = split_string_view(s1, ',');
+    BOOST_REQUIRE_EQUAL(split1.size(), 3U);
+    BOOST_CHECK_EQUAL(split1[0], "a");
+    BOOST_CHECK_EQUAL(split1[1], "");
+    BOOST_CHECK_EQUAL(split1[2], "b");
+    BOOST_CHECK(split1[2].data() == s1.data() + 3);
+
+    const auto split_copy = split_string(s1, ',');
+    BOOST_CHECK_EQUAL(split_copy.size(), split1.size());
+    BOOST_CHECK(split_string_view("", ',').empty());
+
+    const auto split2 = split_string_view("lorem ipsum", "r ");
+    BOOST_REQUIRE_EQUAL(split2.size(), 3U);
+    BOOST_CHECK_EQUAL(split2[0], "lo");
+    BOOST_CHECK_EQUAL(split2[1], "em");
+    BOOST_CHECK_EQUAL(split2[2], "ipsum");
+}
+
+BOOST_AUTO_TEST_CASE(trim_views) {
+    const std::string s = " \t lorem ipsum \n";
+
+    BOOST_CHECK_EQUAL(trim_view(s), "lorem ipsum");
+    BOOST_CHECK_EQUAL(ltrim_view(s), "lorem ipsum \n");
+    BOOST_CHECK_EQUAL(rtrim_view(s), " \t lorem ipsum");
+    BOOST_CHECK(trim_view(s).data() == s.data() + 3);
+    BOOST_CHECK(trim_view("   ").empty());
+
+    auto t = s;
+    trim_in_place(t);
+    BOOST_CHECK_EQUAL(t, "lorem ipsum");
+
+    uppercase_in_place(t);
+    BOOST_CHECK_EQUAL(t, "LOREM IPSUM");
+
+    auto blank = std::string(" \t ");
+    trim_in_place(blank);
+    BOOST_CHECK(blank.empty());
+}
+
 BOOST_AUTO_TEST_CASE(parse_double) {
     auto d1 = try_parse_double("NOT_NUMERIC");
     BOOST_CHECK( !d1.has_value() );
@@ -149,4 +191,28 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
 }
 
+BOOST_AUTO_TEST_CASE(compiled_match_test) {
+    const auto patterns = std::vector<std::string> {
+        "NAME*", "NAME", "NAME?ABC", "NAME[0-9][0-9]", "NAME.*", "NAME.?",
+        "*", "*A*B*", "P*1", "?AME*", "N\\AME*", "**ME", "",
+    };
+
+    const auto symbols = std::vector<std::string> {
+        "NAME", "NAMEABC", "NONAMEABC", "NAMEXABC", "NAME13", "NAME13X",
+        "NAME.EXT", "NAME.", "P1", "P11", "PROD1", "PROD12", "AB", "XAXBX", "",
+    };
+
+    for (const auto& pattern : patterns) {
+        const auto compiled = ShellPattern { pattern };
+        for (const auto& symbol : symbols) {
+            BOOST_TEST_CONTEXT("pattern '" << pattern << "', symbol '" << symbol << "'") {
+                BOOST_CHECK_EQUAL(compiled.match(symbol), shmatch(pattern, symbol));
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL(ShellPattern { "PROD*1" }.prefix(), "PROD");
+    BOOST_CHECK_EQUAL(ShellPattern { "*PROD" }.prefix(), "");
+}
+
 
@@ -774,6 +774,32 @@ BOOST_AUTO_TEST_CASE( REMOVE_DUPLICATED_ENTRIES ) {
             uniq_keys.begin(), uniq_keys.end() );
 }
 
+BOOST_AUTO_TEST_CASE( REMOVE_DUPLICATED_CONNECTIONS ) {
+    const auto input = "CGIR\n"
+                       " '*' /\n"
+                       "/\n"
+                       "CGIR\n"
+                       " '*' /\n"
+                       "'WX2' 1 1 1 /\n"
+                       "/\n"
+                       "CPRL\n"
+                       " '*' /\n"
+                       " '*' /\n"
+                       "/\n";
+
+    const auto summary = createSummary( input );
+    const auto keywords = { "CGIR", "CGIR", "CGIR", "CGIR", "CGIR",
+                            "CPRL", "CPRL", "CPRL", "CPRL", "CPRL" };
+    const auto names = sorted_keywords( summary );
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+            keywords.begin(), keywords.end(),
+            names.begin(), names.end() );
+
+    BOOST_CHECK( std::is_sorted( summary.begin(), summary.end() ) );
+    BOOST_CHECK_EQUAL( summary.begin()->location().keyword, "CGIR" );
+}
+
 BOOST_AUTO_TEST_CASE( ANALYTICAL_AQUIFERS ) {
     {
         const auto faulty_input = std::string {R"(
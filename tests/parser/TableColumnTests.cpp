@@ -285,6 +285,33 @@ BOOST_AUTO_TEST_CASE( Test_EVAL_DECREASING ) {
 }
 
 
+BOOST_AUTO_TEST_CASE( Test_LOOKUP_REPEATED_END_POINTS ) {
+    {
+        ColumnSchema schema("COLUMN" , Table::INCREASING , Table::DEFAULT_LINEAR);
+        TableColumn column( schema );
+        for (const double value : { 0.0, 0.0, 1.0, 2.0, 2.0, 2.0 })
+            column.addValue( value, "TableTested" );
+
+        BOOST_CHECK_EQUAL( column.lookup( -1 ).getIndex1() , 0U );
+        BOOST_CHECK_EQUAL( column.lookup(  2 ).getIndex1() , 3U );
+        BOOST_CHECK_EQUAL( column.lookup(  5 ).getIndex1() , 3U );
+        BOOST_CHECK_EQUAL( column.eval( column.lookup( 1.5 )) , 1.5 );
+    }
+
+    {
+        ColumnSchema schema("COLUMN" , Table::DECREASING , Table::DEFAULT_LINEAR);
+        TableColumn column( schema );
+        for (const double value : { 2.0, 2.0, 1.0, 0.0, 0.0 })
+            column.addValue( value, "TableTested" );
+
+        BOOST_CHECK_EQUAL( column.lookup(  5 ).getIndex1() , 0U );
+        BOOST_CHECK_EQUAL( column.lookup(  0 ).getIndex1() , 3U );
+        BOOST_CHECK_EQUAL( column.lookup( -1 ).getIndex1() , 3U );
+        BOOST_CHECK_EQUAL( column.eval( column.lookup( 0.5 )) , 0.5 );
+    }
+}
+
+
 
 
 BOOST_AUTO_TEST_CASE( Test_CONST_DEFAULT ) {
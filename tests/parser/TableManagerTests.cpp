@@ -21,6 +21,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <fmt/format.h>
+
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
@@ -54,13 +56,22 @@
 
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPTableCache.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TLMixpar.hpp>
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <string>
 #include <tuple>
+#include <vector>
+
+#include <tests/WorkArea.hpp>
 
 using namespace Opm;
 
@@ -217,6 +228,45 @@ BOOST_AUTO_TEST_CASE( CreateTablesWithVd ) {
     BOOST_CHECK( tables.useEnptvd() );
 }
 
+BOOST_AUTO_TEST_CASE( CreateManySimpleTables ) {
+    const auto input = std::string { R"(
+RUNSPEC
+OIL
+WATER
+TABDIMS
+8 /
+PROPS
+SWOF
+)" };
+
+    auto swof = std::string{};
+    for (int tab = 0; tab < 8; ++tab) {
+        if (tab == 3) {
+            swof += "/\n";
+            continue;
+        }
+
+        swof += fmt::format("0.{} 0.0 1.0 0.0\n1.0 1.0 0.0 0.0 /\n", tab + 1);
+    }
+
+    const auto tables = Opm::TableManager { Opm::Parser{}.parseString(input + swof) };
+    const auto& swofTables = tables.getSwofTables();
+    BOOST_REQUIRE_EQUAL(swofTables.size(), 8U);
+
+    for (std::size_t tab = 0; tab < 8; ++tab) {
+        const auto expect = (tab == 3) ? 0.3 : 0.1*(tab + 1);
+        const auto& swofTable = swofTables.getTable<Opm::SwofTable>(tab);
+        BOOST_CHECK_CLOSE(swofTable.getSwColumn().front(), expect, 1.0e-8);
+        BOOST_CHECK_CLOSE(swofTable.getSwColumn().back(), 1.0, 1.0e-8);
+    }
+
+    // Malformed table among several others built concurrently
+    auto broken = swof;
+    broken.replace(broken.rfind("1.0 1.0 0.0 0.0 /"), 17, "1.0 1.0 0.0 /");
+    BOOST_CHECK_THROW(Opm::TableManager { Opm::Parser{}.parseString(input + broken) },
+                      Opm::OpmInputError);
+}
+
 BOOST_AUTO_TEST_CASE( CreateTablesWithJFunc ) {
     auto deck = createSingleRecordDeckWithJFunc();
     Opm::TableManager tables(deck);
@@ -1984,6 +2034,95 @@ VFPINJ \n\
     }
 }
 
+BOOST_AUTO_TEST_CASE(VFPTableCache_Test) {
+    WorkArea work_area("test_vfp_table_cache");
+
+    {
+        std::ofstream os("VFP.DATA");
+        os << R"(VFPPROD
+      5  32.9  'LIQ' 'WCT' 'GOR' 'THP' ' ' 'METRIC' 'BHP'  /
+1 3 5 /
+7 11 /
+13 /
+19 /
+29 /
+1 1 1 1 1.5 2.5 3.5 /
+2 1 1 1 4.5 5.5 6.5 /
+
+VFPINJ
+       6  32.9   WAT   THP METRIC   BHP /
+1 3 5 /
+7 11 /
+1 1.5 2.5 3.5 /
+2 4.5 5.5 6.5 /
+)";
+    }
+
+    const auto deck = Opm::Parser{}.parseFile("VFP.DATA");
+    const auto units = Opm::UnitSystem::newMETRIC();
+
+    const auto& prodKeyword = deck["VFPPROD"].back();
+    const auto& injKeyword = deck["VFPINJ"].back();
+    const auto keywords = std::vector<const Opm::DeckKeyword*> { &prodKeyword, &injKeyword };
+
+    const auto expectProd = Opm::VFPProdTable(prodKeyword, false, units);
+    const auto expectInj = Opm::VFPInjTable(injKeyword, units);
+
+    auto countSnapshots = []()
+    {
+        return std::distance(std::filesystem::directory_iterator{"cache"},
+                             std::filesystem::directory_iterator{});
+    };
+
+    {
+        Opm::VFPTableCache cache;
+        cache.prepare(keywords, false, units);
+
+        BOOST_CHECK_MESSAGE(!cache.takeProd(injKeyword).has_value(),
+                            "VFPINJ keyword must not have a VFPPROD table");
+
+        const auto prod = cache.takeProd(prodKeyword);
+        BOOST_REQUIRE_MESSAGE(prod.has_value(), "VFPPROD table must be prepared");
+        BOOST_CHECK(*prod == expectProd);
+        BOOST_CHECK_MESSAGE(!cache.takeProd(prodKeyword).has_value(),
+                            "VFPPROD table must only be taken once");
+
+        const auto inj = cache.takeInj(injKeyword);
+        BOOST_REQUIRE_MESSAGE(inj.has_value(), "VFPINJ table must be prepared");
+        BOOST_CHECK(*inj == expectInj);
+
+        BOOST_CHECK(!std::filesystem::exists("cache"));
+    }
+
+    // Tables are stored as snapshots and loaded from there by later runs.
+    for (int run = 0; run < 2; ++run) {
+        Opm::VFPTableCache cache { "cache" };
+        cache.prepare(keywords, false, units);
+
+        BOOST_CHECK_EQUAL(countSnapshots(), 2);
+
+        const auto prod = cache.takeProd(prodKeyword);
+        BOOST_REQUIRE_MESSAGE(prod.has_value(), "VFPPROD table must be prepared");
+        BOOST_CHECK(*prod == expectProd);
+
+        const auto inj = cache.takeInj(injKeyword);
+        BOOST_REQUIRE_MESSAGE(inj.has_value(), "VFPINJ table must be prepared");
+        BOOST_CHECK(*inj == expectInj);
+    }
+
+    // The VFPPROD table depends on whether gas lift optimisation is active.
+    {
+        Opm::VFPTableCache cache { "cache" };
+        cache.prepare(keywords, true, units);
+
+        BOOST_CHECK_EQUAL(countSnapshots(), 3);
+
+        const auto prod = cache.takeProd(prodKeyword);
+        BOOST_REQUIRE_MESSAGE(prod.has_value(), "VFPPROD table must be prepared");
+        BOOST_CHECK(prod->getALQType() == Opm::VFPProdTable::ALQ_TYPE::ALQ_GRAT);
+    }
+}
+
 
 BOOST_AUTO_TEST_CASE( TestPLYMWINJ ) {
     const char *inputstring =
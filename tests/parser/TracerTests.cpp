@@ -89,3 +89,16 @@ BOOST_AUTO_TEST_CASE(TracerConfigTest) {
     BOOST_CHECK_EQUAL(it->free_concentration.value().size(), 3U);
     BOOST_CHECK(!it->free_tvdp.has_value());
 }
+
+BOOST_AUTO_TEST_CASE(TracerConfigIndex) {
+    auto deck = createDeck();
+    EclipseState state(deck);
+    const TracerConfig& tc = state.tracer();
+
+    BOOST_CHECK(tc.index("SEA") == std::optional<std::size_t>{0});
+    BOOST_CHECK(tc.index("OCE") == std::optional<std::size_t>{1});
+    BOOST_CHECK(!tc.index("NOT").has_value());
+
+    BOOST_CHECK_EQUAL(tc["OCE"].name, "OCE");
+    BOOST_CHECK_THROW(tc["NOT"], std::logic_error);
+}
@@ -32,18 +32,22 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Schedule/ControlSnapshot.hpp>
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQAssign.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDependencyGraph.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -64,6 +68,7 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <random>
 #include <limits>
 #include <stdexcept>
 #include <string>
@@ -772,6 +777,51 @@ BOOST_AUTO_TEST_CASE(UDQ_SET) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_SET_INDEX_ACCESS) {
+    const auto wells = std::vector<std::string> { "P1", "P2", "P3" };
+
+    auto s1 = UDQSet::wells("WU1", wells);
+    s1.assign("P1", 1.0);
+    s1.assign("P3", 3.0);
+
+    BOOST_CHECK( s1.defined(0));
+    BOOST_CHECK(!s1.defined(1));
+    BOOST_CHECK( s1.defined(2));
+
+    BOOST_CHECK_EQUAL(s1.wgname(1), "P2");
+    BOOST_CHECK_EQUAL(s1.number(1), 0U);
+    BOOST_CHECK(!s1.value(1).has_value());
+    BOOST_CHECK_EQUAL(*s1.value(2), 3.0);
+    BOOST_CHECK(std::isnan(s1.values()[1]));
+
+    // Non-finite values are undefined.
+    s1.assign(0, std::numeric_limits<double>::infinity());
+    BOOST_CHECK(!s1.defined(0));
+    s1.assign(0, 1.0);
+
+    // Scalars are promoted to the wells of the other operand.
+    const auto s2 = s1 + UDQSet::scalar("SCALAR", 10.0);
+    BOOST_CHECK(s2.var_type() == UDQVarType::WELL_VAR);
+    BOOST_CHECK(s2.wgnames() == wells);
+    BOOST_CHECK_EQUAL(s2["P1"].get(), 11.0);
+    BOOST_CHECK(!s2["P2"].defined());
+    BOOST_CHECK_EQUAL(s2["P3"].get(), 13.0);
+
+    // Sets formed separately for the same wells compare equal.
+    auto s3 = UDQSet::wells("WU1", wells);
+    BOOST_CHECK(!(s1 == s3));
+    s3.assign(0, 1.0);
+    s3.assign(2, 3.0);
+    BOOST_CHECK(s1 == s3);
+
+    auto i = 0;
+    for (const auto& v : s3) {
+        BOOST_CHECK_EQUAL(v.wgname(), wells[i]);
+        BOOST_CHECK_EQUAL(v.defined(), s3.defined(i));
+        ++i;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_FUNCTION_TABLE) {
     UDQFunctionTable udqft;
     BOOST_CHECK(udqft.has_function("SUM"));
@@ -1036,6 +1086,73 @@ BOOST_AUTO_TEST_CASE(ELEMENTAL_UNARY_FUNCTIONS) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_FUNCTIONS_LARGE_SET) {
+    UDQFunctionTable udqft;
+    const auto& sorta = dynamic_cast<const UDQUnaryElementalFunction&>(udqft.get("SORTA"));
+    const auto& sortd = dynamic_cast<const UDQUnaryElementalFunction&>(udqft.get("SORTD"));
+
+    // Large enough for the parallel sort, with many ties and undefined
+    // elements.
+    const std::size_t n = 100'000;
+    UDQSet arg("NAME", n);
+
+    std::mt19937 rng(1729);
+    std::uniform_int_distribution<int> dist(-500, 500);
+
+    auto sum = 0.0;
+    auto min = std::numeric_limits<double>::max();
+    auto max = std::numeric_limits<double>::lowest();
+    auto defined = std::size_t{0};
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i % 7 == 3) {
+            continue;
+        }
+
+        const double value = dist(rng);
+        arg.assign(i, value);
+
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+        ++defined;
+    }
+
+    auto check_order = [&arg, n, defined](const UDQSet& result, const bool ascending)
+    {
+        std::vector<std::size_t> order(defined, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_REQUIRE_EQUAL(result.defined(i), arg.defined(i));
+            if (result.defined(i)) {
+                order.at(static_cast<std::size_t>(result[i].get()) - 1) = i;
+            }
+        }
+
+        for (std::size_t k = 1; k < defined; ++k) {
+            const auto v0 = arg[order[k - 1]].get();
+            const auto v1 = arg[order[k]].get();
+
+            BOOST_REQUIRE(ascending ? (v0 <= v1) : (v0 >= v1));
+            if (v0 == v1) {
+                BOOST_REQUIRE(order[k - 1] < order[k]);
+            }
+        }
+    };
+
+    check_order(sorta.eval(arg), true);
+    check_order(sortd.eval(arg), false);
+
+    auto eval = [&udqft, &arg](const std::string& name)
+    {
+        return dynamic_cast<const UDQScalarFunction&>(udqft.get(name)).eval(arg)[0].get();
+    };
+
+    BOOST_CHECK_EQUAL(eval("SUM"), sum);
+    BOOST_CHECK_EQUAL(eval("MIN"), min);
+    BOOST_CHECK_EQUAL(eval("MAX"), max);
+    BOOST_CHECK_CLOSE(eval("AVEA"), sum / defined, 1.0e-10);
+    BOOST_CHECK_EQUAL(eval("NORMI"), std::max(-min, max));
+}
+
 BOOST_AUTO_TEST_CASE(UNION_FUNCTIONS) {
     UDQFunctionTable udqft;
     UDQSet arg1("NAME", 5);
@@ -1417,6 +1534,95 @@ BOOST_AUTO_TEST_CASE(UDQ_BASIC_MATH_TEST) {
     BOOST_CHECK_EQUAL( res_wuwct["P4"].get(),0.50);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_COMPILED_WELL_EXPRESSION) {
+    UDQParams udqp;
+    UDQFunctionTable udqft;
+    KeywordLocation location;
+    UDQDefine def_mix(udqp, "WUMIX", 0, location, {"2", "*", "WOPR", "-", "WWPR", "/", "FOPR"});
+    UDQDefine def_neg(udqp, "WUNEG", 0, location, {"-", "(", "WOPR", "+", "WOPR", "'P1'", ")"});
+    UDQDefine def_div(udqp, "WUDIV", 0, location, {"WOPR", "/", "WWPR"});
+    UDQDefine def_udq(udqp, "WUREF", 0, location, {"WUDIV", "*", "10"});
+    UDQDefine def_scalar(udqp, "WUSCL", 0, location, {"FOPR", "+", "WOPR", "'P2'"});
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "P3", "P4"}));
+    UDQContext context(udqft, wm, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 1);
+    st.update_well_var("P2", "WOPR", 2);
+    st.update_well_var("P3", "WOPR", 3);
+
+    st.update_well_var("P1", "WWPR", 4);
+    st.update_well_var("P2", "WWPR", 0);
+    st.update_well_var("P3", "WWPR", 2);
+    st.update_well_var("P4", "WWPR", 8);
+
+    st.update("FOPR", 2);
+
+    auto res_mix = def_mix.eval(context);
+    BOOST_CHECK_EQUAL( res_mix.size(), 4U);
+    BOOST_CHECK_EQUAL( res_mix["P1"].get(), 2*1 - 4/2.0);
+    BOOST_CHECK_EQUAL( res_mix["P2"].get(), 2*2 - 0/2.0);
+    BOOST_CHECK_EQUAL( res_mix["P3"].get(), 2*3 - 2/2.0);
+    BOOST_CHECK( !res_mix["P4"] );
+
+    auto res_neg = def_neg.eval(context);
+    BOOST_CHECK_EQUAL( res_neg["P1"].get(), -(1 + 1));
+    BOOST_CHECK_EQUAL( res_neg["P3"].get(), -(3 + 1));
+    BOOST_CHECK( !res_neg["P4"] );
+
+    // Division by zero is undefined.
+    auto res_div = def_div.eval(context);
+    BOOST_CHECK_EQUAL( res_div["P1"].get(), 0.25);
+    BOOST_CHECK( !res_div["P2"] );
+    BOOST_CHECK_EQUAL( res_div["P3"].get(), 1.5);
+    BOOST_CHECK( !res_div["P4"] );
+
+    udq_state.add_define(0, "WUDIV", res_div);
+    auto res_udq = def_udq.eval(context);
+    BOOST_CHECK_EQUAL( res_udq["P1"].get(), 2.5);
+    BOOST_CHECK( !res_udq["P2"] );
+    BOOST_CHECK_EQUAL( res_udq["P3"].get(), 15);
+
+    // Scalar expressions are distributed to all wells.
+    auto res_scalar = def_scalar.eval(context);
+    BOOST_CHECK_EQUAL( res_scalar.size(), 4U);
+    for (const auto* well : { "P1", "P2", "P3", "P4" }) {
+        BOOST_CHECK_EQUAL( res_scalar[well].get(), 4);
+    }
+
+    // An undefined scalar combined with a well vector is still an error.
+    context.add("FOPR", std::numeric_limits<double>::quiet_NaN());
+    BOOST_CHECK_THROW( def_mix.eval(context), std::exception );
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_PROGRAM_COMPILE) {
+    const auto wopr = UDQASTNode(UDQTokenType::ecl_expr, std::string{"WOPR"}, std::vector<std::string>{});
+    const auto wwpr = UDQASTNode(UDQTokenType::ecl_expr, std::string{"WWPR"}, std::vector<std::string>{});
+    const auto pattern = UDQASTNode(UDQTokenType::ecl_expr, std::string{"WOPR"}, std::vector<std::string>{"P*"});
+
+    const auto sum = UDQASTNode(UDQTokenType::binary_op_add, std::string{"+"}, wopr, wwpr);
+    const auto program = UDQProgram::compile(sum, UDQVarType::WELL_VAR);
+    BOOST_REQUIRE( program != nullptr );
+    BOOST_CHECK_EQUAL( program->size(), 3U );
+
+    BOOST_CHECK( UDQProgram::compile(sum, UDQVarType::GROUP_VAR) == nullptr );
+    BOOST_CHECK( UDQProgram::compile(UDQASTNode(UDQTokenType::binary_op_pow, std::string{"^"}, wopr, wwpr),
+                                     UDQVarType::WELL_VAR) == nullptr );
+    BOOST_CHECK( UDQProgram::compile(UDQASTNode(UDQTokenType::binary_op_add, std::string{"+"}, wopr, pattern),
+                                     UDQVarType::WELL_VAR) == nullptr );
+
+    // Table lookups of well vectors load the vector and apply the table.
+    const auto lookup = UDQASTNode(UDQTokenType::ecl_expr, std::string{"TU_FBHP"}, std::vector<std::string>{"WOPR"});
+    const auto scaled = UDQASTNode(UDQTokenType::binary_op_mul, std::string{"*"}, lookup, wwpr);
+    const auto lookup_program = UDQProgram::compile(scaled, UDQVarType::WELL_VAR);
+    BOOST_REQUIRE( lookup_program != nullptr );
+    BOOST_CHECK_EQUAL( lookup_program->size(), 4U );
+
+    const auto field_lookup = UDQASTNode(UDQTokenType::ecl_expr, std::string{"TU_FBHP"}, std::vector<std::string>{"FOPR"});
+    BOOST_CHECK( UDQProgram::compile(field_lookup, UDQVarType::WELL_VAR) == nullptr );
+}
+
 BOOST_AUTO_TEST_CASE(DECK_TEST) {
     KeywordLocation location;
     UDQParams udqp;
@@ -1696,6 +1902,68 @@ BOOST_AUTO_TEST_CASE(UDQ_USAGE) {
 
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_USAGE_INDEXED) {
+    UDQActive usage;
+    UDQParams params;
+    UDQConfig conf(params);
+
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    conf.add_assign("WUX", segmentMatcherFactory, std::vector<std::string>{}, 100, 0);
+    conf.add_assign("WUY", segmentMatcherFactory, std::vector<std::string>{}, 100, 0);
+
+    const UDAValue wux("WUX");
+    const UDAValue wuy("WUY");
+
+    BOOST_CHECK_EQUAL(usage.update(conf, wux, "W1", UDAControl::WCONPROD_ORAT), 1);
+    BOOST_CHECK_EQUAL(usage.update(conf, wuy, "W1", UDAControl::WCONPROD_GRAT), 1);
+    BOOST_CHECK_EQUAL(usage.update(conf, wux, "W2", UDAControl::WCONPROD_ORAT), 1);
+    BOOST_CHECK_EQUAL(usage.update(conf, wux, "W3", UDAControl::WCONPROD_ORAT), 1);
+
+    // Same UDQ for same well and control is no change.
+    BOOST_CHECK_EQUAL(usage.update(conf, wux, "W2", UDAControl::WCONPROD_ORAT), 0);
+
+    {
+        const auto& iuad = usage.iuad();
+        BOOST_REQUIRE_EQUAL(iuad.size(), 2U);
+        BOOST_CHECK_EQUAL(iuad[0].udq, "WUX");
+        BOOST_CHECK_EQUAL(iuad[0].use_count, 3U);
+        BOOST_CHECK_EQUAL(iuad[0].use_index, 0U);
+        BOOST_CHECK_EQUAL(iuad[1].udq, "WUY");
+        BOOST_CHECK_EQUAL(iuad[1].use_count, 1U);
+        BOOST_CHECK_EQUAL(iuad[1].use_index, 3U);
+
+        const auto iuap = usage.iuap();
+        BOOST_REQUIRE_EQUAL(iuap.size(), 4U);
+        BOOST_CHECK_EQUAL(iuap[0].wgname, "W1");
+        BOOST_CHECK_EQUAL(iuap[1].wgname, "W2");
+        BOOST_CHECK_EQUAL(iuap[2].wgname, "W3");
+        BOOST_CHECK_EQUAL(iuap[3].wgname, "W1");
+        BOOST_CHECK(iuap[3].control == UDAControl::WCONPROD_GRAT);
+    }
+
+    // Replace the UDQ of W2, then make W1's oil rate numeric.
+    BOOST_CHECK_EQUAL(usage.update(conf, wuy, "W2", UDAControl::WCONPROD_ORAT), 1);
+    BOOST_CHECK_EQUAL(usage.update(conf, UDAValue(100), "W1", UDAControl::WCONPROD_ORAT), 1);
+    BOOST_CHECK_EQUAL(usage.update(conf, UDAValue(100), "W1", UDAControl::WCONPROD_ORAT), 0);
+
+    {
+        const auto& iuad = usage.iuad();
+        BOOST_REQUIRE_EQUAL(iuad.size(), 3U);
+        BOOST_CHECK_EQUAL(iuad[0].udq, "WUY");
+        BOOST_CHECK(iuad[0].control == UDAControl::WCONPROD_GRAT);
+        BOOST_CHECK_EQUAL(iuad[1].udq, "WUX");
+        BOOST_CHECK_EQUAL(iuad[1].use_count, 1U);
+        BOOST_CHECK_EQUAL(iuad[2].udq, "WUY");
+        BOOST_CHECK(iuad[2].control == UDAControl::WCONPROD_ORAT);
+
+        const auto iuap = usage.iuap();
+        BOOST_REQUIRE_EQUAL(iuap.size(), 3U);
+        BOOST_CHECK_EQUAL(iuap[0].wgname, "W1");
+        BOOST_CHECK_EQUAL(iuap[1].wgname, "W3");
+        BOOST_CHECK_EQUAL(iuap[2].wgname, "W2");
+    }
+}
+
 BOOST_AUTO_TEST_CASE(UDQControl_Keyword)
 {
     BOOST_CHECK_MESSAGE(UDQ::keyword(UDAControl::WCONPROD_ORAT) == UDAKeyword::WCONPROD, "WCONPROD_ORAT control keyword must be WCONPROD");
@@ -1810,6 +2078,59 @@ BOOST_AUTO_TEST_CASE(IntegrationTest) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(ControlSnapshot_UDA) {
+#include "data/integration_tests/udq.data"
+    auto schedule = make_schedule(deck_string);
+    const auto& sched_state = schedule[0];
+
+    SummaryState st(TimeService::now(), 0.0);
+    st.update_well_var("OPL02", "WUOPRL", 123.0);
+    st.update_well_var("OPL02", "WULPRL", 234.0);
+    st.update_well_var("OPL02", "WOPR", 10.0);
+    st.update_group_var("TEST", "GULPR1", 345.0);
+
+    ControlSnapshot snapshot;
+    BOOST_CHECK(!snapshot.isCurrent(sched_state, st));
+
+    snapshot.update(sched_state, st);
+    BOOST_CHECK(snapshot.isCurrent(sched_state, st));
+
+    const auto& well = sched_state.wells("OPL02");
+    const auto& group = sched_state.groups("TEST");
+    {
+        const auto& ctrl = snapshot.productionControls(well);
+        const auto expect = well.productionControls(st);
+        BOOST_CHECK_EQUAL(ctrl.oil_rate, expect.oil_rate);
+        BOOST_CHECK_EQUAL(ctrl.liquid_rate, expect.liquid_rate);
+        BOOST_CHECK_EQUAL(snapshot.productionControls(group).liquid_target,
+                          group.productionControls(st).liquid_target);
+    }
+
+    const auto& injector = sched_state.wells("WIU01");
+    BOOST_CHECK_THROW(snapshot.productionControls(injector), std::logic_error);
+    BOOST_CHECK_THROW(snapshot.injectionControls(well), std::logic_error);
+    BOOST_CHECK_EQUAL(snapshot.injectionControls(injector).surface_rate,
+                      injector.injectionControls(st).surface_rate);
+
+    // Values which are not UDQs do not invalidate the snapshot.
+    st.update_well_var("OPL02", "WOPR", 20.0);
+    BOOST_CHECK(snapshot.isCurrent(sched_state, st));
+
+    const auto oil_rate = snapshot.productionControls(well).oil_rate;
+    st.update_well_var("OPL02", "WUOPRL", 50.0);
+    BOOST_CHECK(!snapshot.isCurrent(sched_state, st));
+
+    snapshot.update(sched_state, st);
+    BOOST_CHECK(snapshot.isCurrent(sched_state, st));
+    BOOST_CHECK_EQUAL(snapshot.productionControls(well).oil_rate,
+                      well.productionControls(st).oil_rate);
+    BOOST_CHECK(snapshot.productionControls(well).oil_rate < oil_rate);
+
+    // Copies share the version of the state they were copied from.
+    const auto copy = st;
+    BOOST_CHECK(snapshot.isCurrent(sched_state, copy));
+}
+
 namespace {
     Schedule make_udq_schedule(const std::string& schedule_string)
     {
@@ -3017,3 +3338,103 @@ DEFINE WU_WBHP TU_FBHP[WOPR] UMIN WU_WBHP0 /
     BOOST_CHECK_EQUAL(wu_wbhp1, 100.0 + (180.0 - 100.0) * (120.0 - 100.0) / (500.0 - 100.0));
     BOOST_CHECK_EQUAL(wu_wbhp2, 100.0 + (180.0 - 100.0) * (450.0 - 100.0) / (500.0 - 100.0));
 }
+
+BOOST_AUTO_TEST_CASE(UDQ_DEPENDENCY_GRAPH)
+{
+    const auto schedule = make_schedule(R"(
+SCHEDULE
+UDQ
+DEFINE WUA WOPR * 2 /
+DEFINE WUB WUA + 1 /
+DEFINE WUD WUE + 1 /
+DEFINE WUE WOPR /
+DEFINE WUR RANDN(WOPR) /
+DEFINE WUC WWPR * 3 /
+/
+)");
+
+    const auto defines = schedule.getUDQConfig(0).definitions();
+    auto def_ptrs = std::vector<const UDQDefine*>{};
+    for (const auto& def : defines) {
+        def_ptrs.push_back(&def);
+    }
+
+    const auto graph = UDQDependencyGraph { def_ptrs };
+    const auto& nodes = graph.nodes();
+    BOOST_REQUIRE_EQUAL(nodes.size(), 6U);
+
+    // WUB reads the new value of WUA, WUD the old value of WUE.  WUR uses
+    // random numbers and separates the DEFINEs before it from those after.
+    const auto expected_level = std::vector<std::size_t> { 0, 1, 0, 1, 2, 3 };
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        BOOST_CHECK_MESSAGE(nodes[i].level == expected_level[i],
+                            "Level of " << nodes[i].keyword << " is " << nodes[i].level
+                            << ", expected " << expected_level[i]);
+    }
+
+    BOOST_CHECK(nodes[0].cacheable);
+    BOOST_CHECK(! nodes[4].cacheable);
+
+    BOOST_REQUIRE_EQUAL(graph.levels().size(), 4U);
+    BOOST_CHECK_EQUAL(graph.levels()[0].size(), 2U);
+    BOOST_CHECK_EQUAL(graph.levels()[2].size(), 1U);
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_INCREMENTAL_EVAL)
+{
+    const auto schedule = make_schedule(R"(
+SCHEDULE
+UDQ
+ASSIGN WUOFF 5 /
+DEFINE WUD  WUE + 1 /
+DEFINE WUE  WOPR * 2 /
+DEFINE WUF  WUE + FOPR /
+DEFINE WUOFF WOPR /
+/
+)");
+
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto undefined_value = udq.params().undefinedValue();
+    UDQState udq_state(undefined_value);
+    SummaryState st(TimeService::now(), undefined_value);
+    WellMatcher wm(NameOrder({"W1", "W2"}));
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+    st.update_well_var("W1", "WOPR", 1);
+    st.update_well_var("W2", "WOPR", 2);
+    st.update("FOPR", 10);
+
+    udq.eval(0, wm, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+
+    // WUD sees the value of WUE from before this evaluation.
+    BOOST_CHECK(! udq_state.has_well_var("W1", "WUD"));
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W1", "WUE"), 2);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUF"), 14);
+    BOOST_CHECK_EQUAL(st.get_well_var("W2", "WUF"), 14);
+
+    // Unchanged inputs.  Same results, with WUD now seeing WUE.
+    udq.eval(1, wm, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W1", "WUD"), 3);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUF"), 14);
+
+    // Changed inputs propagate to all dependent DEFINEs.
+    st.update_well_var("W2", "WOPR", 3);
+    udq.eval(2, wm, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUE"), 6);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUF"), 16);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUD"), 5);
+    BOOST_CHECK_EQUAL(st.get_well_var("W2", "WUF"), 16);
+
+    st.update("FOPR", 20);
+    udq.eval(3, wm, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUF"), 26);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W2", "WUD"), 7);
+
+    // Values assigned to a DEFINEd UDQ are overwritten at the next
+    // evaluation, even if its inputs are unchanged.
+    auto assigned = UDQSet::wells("WUOFF", wm.wells(), 100.0);
+    udq_state.add_assign("WUOFF", assigned);
+    udq.eval(4, wm, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(udq_state.get_well_var("W1", "WUOFF"), 1);
+}
@@ -33,6 +33,11 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
 using namespace Opm;
 
 BOOST_AUTO_TEST_CASE(UDT_NV)
@@ -68,6 +73,51 @@ BOOST_AUTO_TEST_CASE(UDT_LL)
     BOOST_CHECK_EQUAL(udt(5.2), 10.0 + (11.0 - 10.0) * (5.2 - 4.0) / (5.0 - 4.0));
 }
 
+BOOST_AUTO_TEST_CASE(UDT_Uniform)
+{
+    const auto xvals = std::vector<double>{0.1, 0.2, 0.3, 0.4, 0.5};
+    const auto yvals = std::vector<double>{1.0, 3.0, 2.0, 5.0, 4.0};
+
+    // Same data points with one moved, forcing the searching lookup.
+    auto xvals_irregular = xvals;
+    xvals_irregular.back() = 0.5000001;
+
+    for (const auto type : { UDT::InterpolationType::NearestNeighbour,
+                             UDT::InterpolationType::LinearClamp,
+                             UDT::InterpolationType::LinearExtrapolate })
+    {
+        const UDT udt(xvals, yvals, type);
+        const UDT reference(xvals_irregular, yvals, type);
+        BOOST_CHECK(udt.uniform());
+        BOOST_CHECK(!reference.uniform());
+
+        for (int i = -5; i <= 65; ++i) {
+            const double x = i*0.01 + 0.003;
+            BOOST_CHECK_SMALL(udt(x) - reference(x), 1.0e-5);
+        }
+
+        // Exactly at the data points.
+        for (std::size_t i = 0; i < xvals.size(); ++i) {
+            BOOST_CHECK_CLOSE(udt(xvals[i]), yvals[i], 1.0e-10);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UDT_Batch)
+{
+    UDT udt({1.0, 4.0, 5.0}, {5.0, 10.0, 11.0}, UDT::InterpolationType::LinearClamp);
+
+    const auto undefined = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> values{0.0, 4.7, undefined, 5.2};
+    udt(values, values);
+
+    BOOST_REQUIRE_EQUAL(values.size(), 4U);
+    BOOST_CHECK_EQUAL(values[0], udt(0.0));
+    BOOST_CHECK_EQUAL(values[1], udt(4.7));
+    BOOST_CHECK(std::isnan(values[2]));
+    BOOST_CHECK_EQUAL(values[3], udt(5.2));
+}
+
 BOOST_AUTO_TEST_CASE(ParseUDT_NV)
 {
     const std::string input = R"(
@@ -232,6 +232,29 @@ BOOST_AUTO_TEST_CASE( VectorConvert ) {
         BOOST_CHECK_EQUAL( units.from_si( UnitSystem::measure::pressure , d1[i] ) , d0[i]);
 }
 
+BOOST_AUTO_TEST_CASE( VectorConvertOutOfPlace ) {
+    const std::vector<double> si = {1.0e5, 2.5e5, 3.0e7, 273.15, 300.0};
+    const auto field = UnitSystem::newFIELD();
+
+    for (const auto m : { UnitSystem::measure::pressure, UnitSystem::measure::temperature }) {
+        std::vector<double> raw(si.size());
+        field.from_si( m, si.data(), raw.data(), si.size() );
+
+        std::vector<float> rawFloat;
+        field.from_si( m, si, rawFloat );
+        BOOST_REQUIRE_EQUAL( rawFloat.size(), si.size() );
+
+        std::vector<double> back = raw;
+        field.to_si( m, back.data(), back.data(), back.size() );
+
+        for (size_t i = 0; i < si.size(); i++) {
+            BOOST_CHECK_EQUAL( raw[i], field.from_si( m, si[i] ) );
+            BOOST_CHECK_EQUAL( rawFloat[i], static_cast<float>(field.from_si( m, si[i] )) );
+            BOOST_CHECK_CLOSE( back[i], field.to_si( m, raw[i] ), 1.0e-12 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( GasOilRatioNotIdentityForField ) {
     const double gas = 14233.4;
     const double oil = 4223;
@@ -87,6 +87,45 @@ BOOST_AUTO_TEST_CASE(WLISTManager) {
 }
 
 
+BOOST_AUTO_TEST_CASE(WLISTMembership) {
+    Opm::WList wlist({"W1", "W2", "W3", "W2"}, "*LIST");
+    BOOST_CHECK_EQUAL(wlist.size(), 3U);
+    BOOST_CHECK_EQUAL(wlist.position("W3").value(), 2U);
+    BOOST_CHECK(!wlist.position("W4").has_value());
+
+    // Wells after a deleted well keep their relative order
+    wlist.del("W1");
+    BOOST_CHECK(!wlist.has("W1"));
+    BOOST_CHECK_EQUAL(wlist.position("W2").value(), 0U);
+    BOOST_CHECK_EQUAL(wlist.position("W3").value(), 1U);
+
+    wlist.add("W1");
+    const std::vector<std::string> expect { "W2", "W3", "W1" };
+    BOOST_CHECK(wlist.wells() == expect);
+    BOOST_CHECK_EQUAL(wlist.position("W1").value(), 2U);
+
+    Opm::WListManager wlm;
+    wlm.newList("*A", {"W1", "W2"});
+    wlm.newList("*B", {"W2", "W3"});
+    wlm.newList("*C", {"W3"});
+    wlm.delWListWell("W3", "*B");
+
+    // Moving a well only touches the lists it is a member of
+    wlm.delWell("W2");
+    BOOST_CHECK(!wlm.getList("*A").has("W2"));
+    BOOST_CHECK(!wlm.getList("*B").has("W2"));
+    BOOST_CHECK_EQUAL(wlm.getList("*B").size(), 0U);
+
+    wlm.delWell("W3");
+    BOOST_CHECK_EQUAL(wlm.getList("*C").size(), 0U);
+
+    wlm.addWListWell("W3", "*A");
+    const std::vector<std::string> listA { "W1", "W3" };
+    BOOST_CHECK(wlm.wells("*A") == listA);
+    BOOST_CHECK(wlm.wells("*?") == listA);
+}
+
+
 static std::string WELSPECS() {
     return
         "WELSPECS\n"
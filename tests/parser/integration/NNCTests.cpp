@@ -447,3 +447,24 @@ BOOST_AUTO_TEST_CASE(ACTNUM)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(AddNNCBulk)
+{
+    const std::vector<NNCdata> existing = {{1, 5, 1.0}, {2, 3, 2.0}, {7, 9, 3.0}};
+    const std::vector<NNCdata> added = {{5, 1, 4.0}, {0, 8, 5.0}, {1, 5, 6.0}, {9, 7, 7.0}, {2, 3, 8.0}};
+
+    NNC single;
+    NNC bulk;
+    for (const auto& nnc : existing) {
+        single.addNNC(nnc.cell1, nnc.cell2, nnc.trans);
+        bulk.addNNC(nnc.cell1, nnc.cell2, nnc.trans);
+    }
+
+    for (const auto& nnc : added)
+        single.addNNC(nnc.cell1, nnc.cell2, nnc.trans);
+    bulk.addNNC(added);
+
+    BOOST_CHECK_EQUAL(bulk.input().size(), existing.size() + added.size());
+    BOOST_CHECK(bulk.input() == single.input());
+    check_order(bulk);
+}
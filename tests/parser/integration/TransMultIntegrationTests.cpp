@@ -27,6 +27,8 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <algorithm>
+
 using namespace Opm;
 
 inline std::string pathprefix() {
@@ -52,7 +54,9 @@ BOOST_AUTO_TEST_CASE(MULTFLT_IN_SCHEDULE) {
     BOOST_CHECK( schedule[3].events().hasEvent( ScheduleEvents::GEO_MODIFIER) );
     {
         const auto& keywords = schedule[3].geo_keywords();
-        state.apply_schedule_keywords( keywords );
+        const auto updated = state.apply_schedule_keywords( keywords );
+        const auto g = state.getInputGrid().getGlobalIndex(2,2,0);
+        BOOST_CHECK( std::binary_search(updated.begin(), updated.end(), g) );
     }
     BOOST_CHECK_EQUAL( 2.00 , trans.getMultiplier( 2,2,0,FaceDir::XPlus ));
     BOOST_CHECK_EQUAL( 0.10 , trans.getMultiplier( 3,2,0,FaceDir::XPlus ));
@@ -888,3 +888,64 @@ BOOST_AUTO_TEST_CASE(Cube_2x3x4_Exclude_Diagonals)
 }
 
 BOOST_AUTO_TEST_SUITE_END()     // Grid_Based_NY_Larger_Than_NX
+
+// =====================================================================
+
+BOOST_AUTO_TEST_SUITE(Global_Index_Based)
+
+namespace {
+    Opm::ActiveIndexByColumns
+    mapFromIJK(const std::array<int,3>& cartDims,
+               const std::vector<int>&  activeToGlobal)
+    {
+        return Opm::ActiveIndexByColumns { activeToGlobal.size(), cartDims,
+            [&cartDims, &activeToGlobal](const std::size_t i)
+        {
+            const auto glob = activeToGlobal[i];
+
+            return std::array<int,3> {
+                glob % cartDims[0],
+                (glob / cartDims[0]) % cartDims[1],
+                glob / (cartDims[0] * cartDims[1])
+            };
+        }};
+    }
+
+    std::vector<int> activeToGlobal(const std::array<int,3>& cartDims)
+    {
+        auto active = std::vector<int>{};
+
+        const auto numCells = cartDims[0] * cartDims[1] * cartDims[2];
+        for (auto glob = 0; glob < numCells; ++glob) {
+            if ((glob % 7 != 3) && (glob % 11 != 5)) {
+                active.push_back(glob);
+            }
+        }
+
+        return active;
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(NX_Larger_Than_NY)
+{
+    const auto cartDims = std::array<int,3>{ { 17, 9, 13 } };
+    const auto active = activeToGlobal(cartDims);
+
+    const auto map = Opm::ActiveIndexByColumns { active, cartDims };
+
+    BOOST_CHECK_MESSAGE(map == mapFromIJK(cartDims, active),
+                        "Global index based mapping must match (I,J,K) based mapping");
+}
+
+BOOST_AUTO_TEST_CASE(NY_Larger_Than_NX)
+{
+    const auto cartDims = std::array<int,3>{ { 9, 17, 13 } };
+    const auto active = activeToGlobal(cartDims);
+
+    const auto map = Opm::ActiveIndexByColumns { active, cartDims };
+
+    BOOST_CHECK_MESSAGE(map == mapFromIJK(cartDims, active),
+                        "Global index based mapping must match (I,J,K) based mapping");
+}
+
+BOOST_AUTO_TEST_SUITE_END()     // Global_Index_Based
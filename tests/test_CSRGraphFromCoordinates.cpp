@@ -23,8 +23,13 @@
 
 #include <opm/common/utility/CSRGraphFromCoordinates.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <random>
+#include <set>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(No_Self_Connections)
 
@@ -1447,6 +1452,69 @@ BOOST_AUTO_TEST_CASE(Linear_4x1x1_Symmetric_Multiple_Repeated_Add_3x1x1_Expand_N
     }
 }
 
+BOOST_AUTO_TEST_CASE(Large_Random_Matches_Reference)
+{
+    // Sufficiently many contributions to exercise the multi-threaded
+    // implementation of compress().
+    const auto numVertices = 300;
+    const auto numContrib = std::size_t{150'000};
+
+    auto rng = std::mt19937{ 1729 };
+    auto vertex = std::uniform_int_distribution<int>{ 0, numVertices - 1 };
+
+    auto graph = CSRGraph{};
+    auto rows = std::vector<std::set<int>>(numVertices);
+    auto contrib = std::vector<std::pair<int, int>>{};
+
+    auto addConnections = [&]()
+    {
+        for (auto n = 0*numContrib; n < numContrib; ++n) {
+            const auto v1 = vertex(rng);
+            const auto v2 = vertex(rng);
+
+            graph.addConnection(v1, v2);
+            if (v1 != v2) {
+                rows[v1].insert(v2);
+                contrib.emplace_back(v1, v2);
+            }
+        }
+    };
+
+    auto checkGraph = [&]()
+    {
+        auto expectIA = std::vector<std::size_t>{ 0 };
+        auto expectJA = std::vector<int>{};
+        for (const auto& row : rows) {
+            expectJA.insert(expectJA.end(), row.begin(), row.end());
+            expectIA.push_back(expectJA.size());
+        }
+
+        const auto& ia = graph.startPointers();
+        const auto& ja = graph.columnIndices();
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(ia.begin(), ia.end(), expectIA.begin(), expectIA.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(ja.begin(), ja.end(), expectJA.begin(), expectJA.end());
+
+        auto expectMap = std::vector<std::size_t>{};
+        for (const auto& [v1, v2] : contrib) {
+            const auto& row = rows[v1];
+            expectMap.push_back(expectIA[v1] + std::distance(row.begin(), row.find(v2)));
+        }
+
+        const auto& nzMap = graph.compressedIndexMap();
+        BOOST_CHECK_EQUAL_COLLECTIONS(nzMap.begin(), nzMap.end(), expectMap.begin(), expectMap.end());
+    };
+
+    addConnections();
+    graph.compress(numVertices);
+    checkGraph();
+
+    // Add further contributions to compressed graph.
+    addConnections();
+    graph.compress(numVertices, true);
+    checkGraph();
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // Tracked
 
 BOOST_AUTO_TEST_SUITE_END()     // No_Self_Connections
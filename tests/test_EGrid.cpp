@@ -33,6 +33,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <iomanip>
+#include <numeric>
 #include <math.h>
 #include <stdio.h>
 #include <tuple>
@@ -190,6 +191,63 @@ BOOST_AUTO_TEST_CASE(getCellCorners) {
 }
 
 
+BOOST_AUTO_TEST_CASE(MappedGeometry) {
+
+    for (const auto& [file, grid_name] : std::vector<std::pair<std::string, std::string>> {
+            {"SPE1CASE1.EGRID", "global"}, {"LGR_TESTMOD.EGRID", "global"},
+            {"LGR_TESTMOD.EGRID", "LGR1"}, {"LGR_TESTMOD.EGRID", "LGR2"} })
+    {
+        EGrid loaded(file, grid_name);
+        EGrid mapped(file, grid_name);
+
+        mapped.memoryMapGeometry();
+        BOOST_CHECK(mapped.mappedGeometry());
+        BOOST_CHECK(!loaded.mappedGeometry());
+
+        const int nCells = loaded.totalNumberOfCells();
+
+        std::vector<int> cells;
+        for (int n = nCells - 1; n >= 0; n -= 3)
+            cells.push_back(n);
+
+        const auto geom = mapped.cellGeometry(cells);
+        const auto ref_geom = loaded.cellGeometry(cells);
+
+        BOOST_CHECK_EQUAL(geom.x.size(), cells.size());
+        BOOST_CHECK(geom.x == ref_geom.x);
+        BOOST_CHECK(geom.y == ref_geom.y);
+        BOOST_CHECK(geom.z == ref_geom.z);
+        BOOST_CHECK(geom.volume == ref_geom.volume);
+
+        for (std::size_t c = 0; c < cells.size(); c++) {
+            std::array<double,8> X, Y, Z;
+            loaded.getCellCorners(cells[c], X, Y, Z);
+
+            BOOST_CHECK_EQUAL(geom.volume[c], calculateCellVol(X, Y, Z));
+            BOOST_CHECK_CLOSE(geom.z[c], std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0, 1.0e-12);
+        }
+
+        for (int n = 0; n < nCells; n++) {
+            std::array<double,8> X1, Y1, Z1, X2, Y2, Z2;
+
+            loaded.getCellCorners(n, X1, Y1, Z1);
+            mapped.getCellCorners(n, X2, Y2, Z2);
+
+            BOOST_REQUIRE(X1 == X2);
+            BOOST_REQUIRE(Y1 == Y2);
+            BOOST_REQUIRE(Z1 == Z2);
+        }
+    }
+
+    EGrid grid1("SPE1CASE1.EGRID");
+    grid1.memoryMapGeometry();
+
+    std::array<double,8> X, Y, Z;
+    BOOST_CHECK_THROW(grid1.getCellCorners({10, 0, 0}, X, Y, Z), std::invalid_argument);
+    BOOST_CHECK_THROW(grid1.cellGeometry({0, grid1.totalNumberOfCells()}), std::invalid_argument);
+}
+
+
 BOOST_AUTO_TEST_CASE(lgr_1) {
 
     std::string testEgridFile = "LGR_TESTMOD.EGRID";
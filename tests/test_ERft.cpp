@@ -222,3 +222,66 @@ BOOST_AUTO_TEST_CASE(TestERft_2)
         BOOST_CHECK_EQUAL(compare_files("SPE1CASE1.RFT", "TEST.RFT"), true);
     }
 }
+
+
+BOOST_AUTO_TEST_CASE(TestERft_IndexFile)
+{
+    using Date = std::tuple<int, int, int>;
+
+    const std::string testFile = "SPE1CASE1.RFT";
+
+    WorkArea work;
+    work.copyIn(testFile);
+
+    ERft rft1(testFile);
+
+    BOOST_CHECK_EQUAL(rft1.loadedFromIndexFile(), false);
+    rft1.writeIndexFile();
+
+    ERft rft2(testFile);
+
+    BOOST_CHECK_EQUAL(rft2.loadedFromIndexFile(), true);
+    BOOST_CHECK_EQUAL(rft2.numberOfReports(), rft1.numberOfReports());
+    BOOST_CHECK_EQUAL(rft2.listOfWells() == rft1.listOfWells(), true);
+    BOOST_CHECK_EQUAL(rft2.listOfdates() == rft1.listOfdates(), true);
+    BOOST_CHECK_EQUAL(rft2.listOfRftReports() == rft1.listOfRftReports(), true);
+    BOOST_CHECK_EQUAL(rft2.getList() == rft1.getList(), true);
+
+    const auto reports = std::vector<ERft::RftKey> {
+        { "B-2H", Date{2016,5,31} },
+        { "A-1H", Date{2015,9, 1} },
+        { "PROD", Date{2015,1, 1} },
+    };
+
+    rft2.loadRft({ "PRESSURE", "SGAS", "CONIPOS" }, reports);
+
+    const auto pressure = rft2.getRft<float>("PRESSURE", reports);
+    const auto conipos = rft2.getRft<int>("CONIPOS", reports);
+
+    BOOST_REQUIRE_EQUAL(pressure.size(), reports.size());
+    BOOST_REQUIRE_EQUAL(conipos.size(), reports.size());
+
+    for (std::size_t i = 0; i < reports.size(); ++i) {
+        const auto& [well, date] = reports[i];
+
+        BOOST_CHECK_EQUAL(pressure[i].get() == rft1.getRft<float>("PRESSURE", well, date), true);
+        BOOST_CHECK_EQUAL(conipos[i].get() == rft1.getRft<int>("CONIPOS", well, date), true);
+    }
+
+    BOOST_CHECK_THROW(rft2.getRft<float>("PRESSURE", { { "XXXX", Date{2017,7,31} } }),
+                      std::invalid_argument);
+
+    // Modifying the RFT file invalidates the index.
+    {
+        EclOutput eclTest(testFile, false, std::ios::app);
+        eclTest.write<float>("TIME", { 1000.0f });
+        eclTest.write<int>("DATE", { 1, 8, 2017 });
+        eclTest.write<std::string>("WELLETC", { "  DAYS", "PROD" });
+    }
+
+    ERft rft3(testFile);
+
+    BOOST_CHECK_EQUAL(rft3.loadedFromIndexFile(), false);
+    BOOST_CHECK_EQUAL(rft3.numberOfReports(), rft1.numberOfReports() + 1);
+    BOOST_CHECK_EQUAL(rft3.hasRft("PROD", Date{2017,8,1}), true);
+}
@@ -28,6 +28,7 @@
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -527,6 +528,62 @@ BOOST_AUTO_TEST_CASE(TestERst_5b) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestERst_IndexFile) {
+
+    std::string testFile = "LGR_TESTMOD.UNRST";
+
+    WorkArea work;
+    work.copyIn(testFile);
+
+    ERst rst1(testFile);
+
+    BOOST_CHECK_EQUAL(rst1.loadedFromIndexFile(), false);
+    rst1.writeIndexFile();
+
+    BOOST_CHECK(std::filesystem::exists(ERst::indexFileName(testFile)));
+
+    EclFile scanned(testFile);
+    ERst rst2(testFile);
+
+    BOOST_CHECK_EQUAL(rst2.loadedFromIndexFile(), true);
+    BOOST_CHECK_EQUAL(rst2.listOfReportStepNumbers() == std::vector<int>({0, 1, 2, 3}), true);
+    BOOST_CHECK_EQUAL(rst2.arrayNames() == scanned.arrayNames(), true);
+    BOOST_CHECK_EQUAL(rst2.getElementSizeList() == scanned.getElementSizeList(), true);
+
+    const auto list1 = scanned.getList();
+    const auto list2 = rst2.getList();
+    BOOST_CHECK_EQUAL(list1.size(), list2.size());
+
+    for (std::size_t n = 0; n < list1.size(); n++) {
+        BOOST_CHECK_EQUAL(std::get<0>(list1[n]), std::get<0>(list2[n]));
+        BOOST_CHECK_EQUAL(std::get<1>(list1[n]), std::get<1>(list2[n]));
+        BOOST_CHECK_EQUAL(std::get<2>(list1[n]), std::get<2>(list2[n]));
+    }
+
+    BOOST_CHECK_EQUAL(rst2.hasLGR("LGR1", 2), true);
+    BOOST_CHECK_EQUAL(rst2.hasLGR("XXXX", 2), false);
+
+    for (int rstep : rst2.listOfReportStepNumbers()) {
+        const auto& pres = rst2.getRestartData<float>("PRESSURE", rstep, "LGR2");
+        BOOST_CHECK_EQUAL(pres == rst1.getRestartData<float>("PRESSURE", rstep, "LGR2"), true);
+
+        const auto& swat = rst2.getRestartData<float>("SWAT", rstep);
+        BOOST_CHECK_EQUAL(swat == rst1.getRestartData<float>("SWAT", rstep), true);
+    }
+
+    // Modifying the restart file invalidates the index.
+    {
+        EclOutput eclTest(testFile, false, std::ios::app);
+        eclTest.write<int>("SEQNUM", { 4 });
+    }
+
+    ERst rst3(testFile);
+
+    BOOST_CHECK_EQUAL(rst3.loadedFromIndexFile(), false);
+    BOOST_CHECK_EQUAL(rst3.listOfReportStepNumbers() == std::vector<int>({0, 1, 2, 3, 4}), true);
+}
+
+
 // ====================================================================
 class RSet
 {
@@ -19,7 +19,10 @@
 #include "config.h"
 
 #include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/ERsm.hpp>
+#include <opm/io/eclipse/SummaryKeyIndex.hpp>
 #include <opm/common/utility/FileSystem.hpp>
+#include <opm/common/utility/shmatch.hpp>
 
 #define BOOST_TEST_MODULE Test EclIO
 #include <boost/test/unit_test.hpp>
@@ -373,6 +376,34 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (unsigned int i=0;i< smryVect.size();i++){
         BOOST_REQUIRE_CLOSE (smryVect[i], bpr_10103_ref[i], 0.01);
     }
+
+    // Vectors read from both runs of the chain are the base run values up
+    // to the restart followed by the values of the restarted run, and
+    // undefined for vectors missing in the base run.
+
+    ESmry chain("SPE1CASE1_RST60.SMSPEC", true);
+    ESmry base("SPE1CASE1.SMSPEC");
+    ESmry rst("SPE1CASE1_RST60.SMSPEC");
+
+    BOOST_CHECK(chain.start_v() == rst.start_v());
+    BOOST_CHECK_EQUAL(chain.numberOfTimeSteps(), 63 + rst.numberOfTimeSteps());
+
+    chain.loadData({"TIME", "WBHP:PROD", "FGPR"});
+
+    for (const auto* key : { "TIME", "WBHP:PROD" }) {
+        const auto& chainVect = chain.get(key);
+        const auto& baseVect = base.get(key);
+        const auto& rstVect = rst.get(key);
+
+        BOOST_REQUIRE_EQUAL(chainVect.size(), 63 + rstVect.size());
+        BOOST_CHECK(std::equal(baseVect.begin(), baseVect.begin() + 63, chainVect.begin()));
+        BOOST_CHECK(std::equal(rstVect.begin(), rstVect.end(), chainVect.begin() + 63));
+    }
+
+    const auto& fgpr = chain.get("FGPR");
+    BOOST_REQUIRE_EQUAL(fgpr.size(), chain.numberOfTimeSteps());
+    BOOST_CHECK(std::all_of(fgpr.begin(), fgpr.begin() + 63, [](const float v) { return std::isnan(v); }));
+    BOOST_CHECK(std::equal(fgpr.begin() + 63, fgpr.end(), rst.get("FGPR").begin()));
 }
 
 BOOST_AUTO_TEST_CASE(TestESmry_4) {
@@ -419,6 +450,74 @@ BOOST_AUTO_TEST_CASE(TestESmry_5) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestESmry_KeyIndex) {
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+
+    const auto& keys = smry1.keywordList();
+
+    auto brute_force = [&keys](const std::string& pattern) {
+        std::vector<std::string> list;
+        std::copy_if(keys.begin(), keys.end(), std::back_inserter(list),
+                     [&pattern](const auto& key) { return Opm::shmatch(pattern, key); });
+        return list;
+    };
+
+    for (const auto* pattern : { "WBHP:*", "*:PROD", "*:INJ", "W*:PROD", "BPR:*", "BPR:1,1,1",
+                                 "F*", "FGOR", "NOSUCH", "*:1,1,1", "W?HP:*", "[WF]*", "*" })
+    {
+        BOOST_CHECK_MESSAGE(smry1.keywordList(pattern) == brute_force(pattern),
+                            "keywordList(" << pattern << ") must match shmatch()");
+    }
+
+    BOOST_CHECK(smry1.keywordsWithName("WBHP") == smry1.keywordList("WBHP:*"));
+    BOOST_CHECK(smry1.keywordsForEntity("PROD") == smry1.keywordList("*:PROD"));
+    BOOST_CHECK(smry1.keywordsWithName("FGOR") == std::vector<std::string>{ "FGOR" });
+    BOOST_CHECK(smry1.keywordsForEntity("NOSUCH").empty());
+
+    const auto& nodes = smry1.summaryNodeList();
+    const auto& nodeKeys = smry1.summaryNodeKeys();
+
+    BOOST_REQUIRE_EQUAL(nodes.size(), nodeKeys.size());
+
+    for (std::size_t n = 0; n < nodes.size(); n++) {
+        BOOST_CHECK(smry1.hasKey(nodeKeys[n]));
+
+        const auto copy = nodes[n];
+        BOOST_CHECK(smry1.get(nodes[n]) == smry1.get(copy));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestSummaryKeyIndex) {
+
+    const std::vector<std::string> keys = {
+        "TIME", "WOPR:P1", "WOPR:P2", "CWIT:P1:1,2,3", "WWCT:P1", "GOPR:P1", "FOPR"
+    };
+
+    const Opm::EclIO::SummaryKeyIndex index(keys);
+
+    BOOST_CHECK_EQUAL(index.size(), keys.size());
+
+    for (std::size_t n = 0; n < keys.size(); n++)
+        BOOST_CHECK_EQUAL(index.find(keys[n]), n);
+
+    BOOST_CHECK_EQUAL(index.find("WOPR"), Opm::EclIO::SummaryKeyIndex::npos);
+    BOOST_CHECK(!index.contains("WOPR:P3"));
+    BOOST_CHECK(!Opm::EclIO::SummaryKeyIndex{}.contains("TIME"));
+
+    BOOST_CHECK(index.withKeyword("WOPR") == (std::vector<std::size_t>{ 1, 2 }));
+    BOOST_CHECK(index.withKeyword("FOPR") == (std::vector<std::size_t>{ 6 }));
+    BOOST_CHECK(index.withEntity("P1") == (std::vector<std::size_t>{ 1, 4, 5 }));
+    BOOST_CHECK(index.withEntity("1,2,3") == (std::vector<std::size_t>{ 3 }));
+
+    BOOST_CHECK(index.match("*:P1") == (std::vector<std::size_t>{ 1, 4, 5 }));
+    BOOST_CHECK(index.match("*P1*") == (std::vector<std::size_t>{ 1, 3, 4, 5 }));
+    BOOST_CHECK(index.match("?OPR:*") == (std::vector<std::size_t>{ 1, 2, 5 }));
+    BOOST_CHECK(index.match("C*:P1:*") == (std::vector<std::size_t>{ 3 }));
+    BOOST_CHECK(index.match("[WG]OPR:P1") == (std::vector<std::size_t>{ 1, 5 }));
+    BOOST_CHECK(index.keysAt(index.match("WOPR:*")) == (std::vector<std::string>{ "WOPR:P1", "WOPR:P2" }));
+}
+
 
 namespace fs = std::filesystem;
 BOOST_AUTO_TEST_CASE(TestCreateRSM) {
@@ -432,6 +531,12 @@ BOOST_AUTO_TEST_CASE(TestCreateRSM) {
 
         smry1.write_rsm_file("TEST.RSM");
         BOOST_CHECK(fs::exists("TEST.RSM"));
+
+        // read back
+        Opm::EclIO::ERsm rsm("TEST.RSM");
+        BOOST_CHECK(Opm::EclIO::cmp(smry1, rsm));
+        BOOST_CHECK(!rsm.has_dates());
+        BOOST_CHECK_EQUAL(rsm.days().size(), smry1.numberOfTimeSteps());
     }
 }
 
@@ -672,3 +777,63 @@ BOOST_AUTO_TEST_CASE(Test_all_available_w_restart) {
 }
 
 
+
+BOOST_AUTO_TEST_CASE(TestESmry_Refresh) {
+
+    ESmry ref("SPE1CASE1.SMSPEC");
+
+    std::string unsmry;
+    {
+        std::ifstream in("SPE1CASE1.UNSMRY", std::ios::binary);
+        unsmry.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+
+    auto write_unsmry = [&unsmry](std::size_t size)
+    {
+        std::ofstream out("SPE1CASE1.UNSMRY", std::ios::binary | std::ios::trunc);
+        out.write(unsmry.data(), size);
+    };
+
+    // simulation still running, last array partly written
+    write_unsmry(unsmry.size() / 3 + 17);
+
+    ESmry smry("SPE1CASE1.SMSPEC");
+
+    const auto nStep0 = smry.numberOfTimeSteps();
+    BOOST_CHECK(nStep0 > 0);
+    BOOST_CHECK(nStep0 < ref.numberOfTimeSteps());
+
+    const auto fopr0 = smry.get("FOPR");
+    BOOST_CHECK_EQUAL(fopr0.size(), nStep0);
+
+    BOOST_CHECK_EQUAL(smry.refresh(), false);
+
+    write_unsmry(2 * unsmry.size() / 3 + 5);
+    BOOST_CHECK_EQUAL(smry.refresh(), true);
+
+    const auto nStep1 = smry.numberOfTimeSteps();
+    BOOST_CHECK(nStep1 > nStep0);
+    BOOST_CHECK_EQUAL(smry.get("FOPR").size(), nStep1);
+
+    write_unsmry(unsmry.size());
+    BOOST_CHECK_EQUAL(smry.refresh(), true);
+    BOOST_CHECK_EQUAL(smry.refresh(), false);
+
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), ref.numberOfTimeSteps());
+
+    for (const auto& key : {"FOPR", "TIME", "WBHP:PROD"}) {
+        const auto& ref_vect = ref.get(key);
+        const auto& vect = smry.get(key);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(vect.begin(), vect.end(), ref_vect.begin(), ref_vect.end());
+    }
+
+    const auto rstep_ref = ref.get_at_rstep("FOPR");
+    const auto rstep = smry.get_at_rstep("FOPR");
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(rstep.begin(), rstep.end(), rstep_ref.begin(), rstep_ref.end());
+    BOOST_CHECK_EQUAL(smry.all_steps_available(), ref.all_steps_available());
+}
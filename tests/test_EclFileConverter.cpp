@@ -0,0 +1,150 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE EclFileConverterTest
+
+#include <boost/test/unit_test.hpp>
+
+#include <test_util/EclFileConverter.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+
+#include <tests/WorkArea.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace Opm::EclIO;
+
+namespace {
+
+void writeInput(const std::string& filename)
+{
+    EclOutput out(filename, false);
+
+    for (int step = 0; step < 20; ++step) {
+        auto inte = std::vector<int>(1000 + step);
+        for (auto i = 0*inte.size(); i < inte.size(); ++i) {
+            inte[i] = static_cast<int>(i) * step;
+        }
+
+        auto real = std::vector<float>(5000);
+        for (auto i = 0*real.size(); i < real.size(); ++i) {
+            real[i] = 0.5f*i + step;
+        }
+
+        auto logi = std::vector<bool>(77);
+        for (auto i = 0*logi.size(); i < logi.size(); ++i) {
+            logi[i] = (i + step) % 3 == 0;
+        }
+
+        out.write("SEQNUM", std::vector<int>{ step });
+        out.write("INTEHEAD", inte);
+        out.write("PRESSURE", real);
+        out.write("DOUBHEAD", std::vector<double>{ 0.25, 1.5*step });
+        out.write("LOGIHEAD", logi);
+        out.write("ZWEL", std::vector<std::string>{ "PROD", "INJ", std::to_string(step) });
+        out.write("ZLONG", std::vector<std::string>{ "a long well name" }, 20);
+        out.message("STARTSOL");
+    }
+}
+
+void checkEqual(EclFile& expect, EclFile& actual)
+{
+    const auto list = expect.getList();
+    BOOST_REQUIRE(list == actual.getList());
+    BOOST_CHECK(expect.getElementSizeList() == actual.getElementSizeList());
+
+    for (auto n = 0*list.size(); n < list.size(); ++n) {
+        const auto i = static_cast<int>(n);
+
+        switch (std::get<1>(list[n])) {
+        case INTE:
+            BOOST_CHECK(expect.get<int>(i) == actual.get<int>(i));
+            break;
+        case REAL:
+            BOOST_CHECK(expect.get<float>(i) == actual.get<float>(i));
+            break;
+        case DOUB:
+            BOOST_CHECK(expect.get<double>(i) == actual.get<double>(i));
+            break;
+        case LOGI:
+            BOOST_CHECK(expect.get<bool>(i) == actual.get<bool>(i));
+            break;
+        case CHAR:
+        case C0NN:
+            BOOST_CHECK(expect.get<std::string>(i) == actual.get<std::string>(i));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    WorkArea work("test_EclFileConverter");
+    writeInput("INPUT.UNRST");
+
+    // Small chunks and a short queue to exercise the ordering.
+    EclFileConverter::Options options;
+    options.numWorkers = 4;
+    options.chunkSize = 10000;
+    options.maxPending = 3;
+
+    {
+        EclFileConverter converter("INPUT.UNRST", options);
+        BOOST_CHECK(! converter.formattedInput());
+        converter.write("OUTPUT.FUNRST", true);
+    }
+
+    {
+        EclFileConverter converter("OUTPUT.FUNRST", options);
+        BOOST_CHECK(converter.formattedInput());
+        converter.write("OUTPUT.UNRST", false);
+    }
+
+    EclFile input("INPUT.UNRST");
+    EclFile formatted("OUTPUT.FUNRST");
+    EclFile binary("OUTPUT.UNRST");
+
+    BOOST_CHECK(formatted.formattedInput());
+    checkEqual(input, formatted);
+    checkEqual(input, binary);
+}
+
+BOOST_AUTO_TEST_CASE(SingleWorker)
+{
+    WorkArea work("test_EclFileConverter");
+    writeInput("INPUT.UNRST");
+
+    EclFileConverter::Options options;
+    options.numWorkers = 1;
+
+    EclFileConverter("INPUT.UNRST", options).write("COPY.UNRST", false);
+
+    EclFile input("INPUT.UNRST");
+    EclFile copy("COPY.UNRST");
+    checkEqual(input, copy);
+}
@@ -28,7 +28,9 @@
 #include <tuple>
 #include <cmath>
 #include <numeric>
+#include <thread>
 
+#include <opm/io/eclipse/EclBinaryKernels.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include "WorkArea.hpp"
@@ -197,6 +199,151 @@ BOOST_AUTO_TEST_CASE(TestEclFile_BINARY) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped) {
+
+    EclFile file1("ECLFILE.INIT");
+    EclFile file2("ECLFILE.INIT");
+
+    BOOST_CHECK(!file2.isMapped());
+
+    // views are only available for numeric arrays of the requested type
+
+    BOOST_CHECK_THROW(file2.getView<int>("PORV"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<double>("KEYWORDS"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<float>("XPORV"), std::invalid_argument);
+
+    BOOST_CHECK(!file2.isMapped());
+
+    const auto icon = file2.getView<int>("ICON");
+    BOOST_CHECK(file2.isMapped());
+
+    const auto logih = file2.getView<bool>("LOGIHEAD");
+    const auto porv = file2.getView<float>("PORV");
+    const auto xcon = file2.getView<double>("XCON");
+
+    BOOST_CHECK_EQUAL(icon.size(), 1875);
+    BOOST_CHECK_EQUAL(logih.size(), 121);
+    BOOST_CHECK_EQUAL(porv.size(), 3146);
+    BOOST_CHECK_EQUAL(xcon.size(), 1740);
+
+    BOOST_CHECK(icon.toVector() == file1.get<int>("ICON"));
+    BOOST_CHECK(logih.toVector() == file1.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(porv.toVector() == file1.get<float>("PORV"));
+    BOOST_CHECK(xcon.toVector() == file1.get<double>("XCON"));
+
+    // element access across block boundaries and partial copies
+
+    const auto& ref = file1.get<float>("PORV");
+    BOOST_CHECK_EQUAL(porv[999], ref[999]);
+    BOOST_CHECK_EQUAL(porv[1000], ref[1000]);
+    BOOST_CHECK_EQUAL(porv.at(3145), ref[3145]);
+    BOOST_CHECK_THROW(porv.at(3146), std::out_of_range);
+
+    std::vector<float> part(1500);
+    porv.copy(900, part.size(), part.data());
+    BOOST_CHECK(std::equal(part.begin(), part.end(), ref.begin() + 900));
+
+    BOOST_CHECK(std::equal(porv.begin(), porv.end(), ref.begin(), ref.end()));
+
+    const auto porv_d = porv.toVectorAs<double>();
+    BOOST_CHECK(porv_d == std::vector<double>(ref.begin(), ref.end()));
+
+    // owning interface decodes from the mapping once mapped
+
+    BOOST_CHECK(file2.get<double>("XCON") == file1.get<double>("XCON"));
+    BOOST_CHECK(file2.get<std::string>("KEYWORDS") == file1.get<std::string>("KEYWORDS"));
+
+    EclFile file3("ECLFILE.FINIT");
+    BOOST_CHECK_THROW(file3.memoryMap(), std::runtime_error);
+    BOOST_CHECK_THROW(file3.getView<int>("ICON"), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadMultipleArrays) {
+
+    EclFile ref("ECLFILE.INIT");
+    EclFile file1("ECLFILE.INIT");
+
+    // ICON, LOGIHEAD, PORV, XCON, KEYWORDS
+    file1.loadData(std::vector<int>{ 4, 3, 2, 1, 0 });
+
+    BOOST_CHECK(file1.isMapped());
+
+    BOOST_CHECK(file1.get<int>(0) == ref.get<int>(0));
+    BOOST_CHECK(file1.get<bool>(1) == ref.get<bool>(1));
+    BOOST_CHECK(file1.get<float>(2) == ref.get<float>(2));
+    BOOST_CHECK(file1.get<double>(3) == ref.get<double>(3));
+    BOOST_CHECK(file1.get<std::string>(4) == ref.get<std::string>(4));
+
+    EclFile file2("ECLFILE.INIT", true);
+
+    for (std::size_t i = 0; i < file2.size(); ++i) {
+        BOOST_CHECK_EQUAL(std::get<0>(file2.getList()[i]), std::get<0>(ref.getList()[i]));
+    }
+
+    BOOST_CHECK(file2.get<float>("PORV") == ref.get<float>("PORV"));
+}
+
+
+BOOST_AUTO_TEST_CASE(TestEclFile_ConcurrentReaders) {
+
+    for (const auto* fileName : { "ECLFILE.INIT", "ECLFILE.FINIT" }) {
+        EclFile ref(fileName, true);
+        EclFile shared(fileName);
+
+        const auto list = ref.getList();
+        const auto numArrays = static_cast<int>(list.size());
+        const auto numThreads = 8;
+
+        // Each thread visits all arrays, starting at a different one.
+        std::vector<int> mismatch(numThreads, 0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&, t]()
+            {
+                for (int i = 0; i < numArrays; ++i) {
+                    const auto arrIndex = (t + i) % numArrays;
+
+                    bool same = true;
+                    switch (std::get<1>(list[arrIndex])) {
+                    case INTE:
+                        same = shared.get<int>(arrIndex) == ref.get<int>(arrIndex);
+                        break;
+                    case REAL:
+                        same = shared.get<float>(arrIndex) == ref.get<float>(arrIndex);
+                        break;
+                    case DOUB:
+                        same = shared.get<double>(arrIndex) == ref.get<double>(arrIndex);
+                        break;
+                    case LOGI:
+                        same = shared.get<bool>(arrIndex) == ref.get<bool>(arrIndex);
+                        break;
+                    case CHAR:
+                        same = shared.get<std::string>(arrIndex) == ref.get<std::string>(arrIndex);
+                        break;
+                    default:
+                        break;
+                    }
+
+                    mismatch[t] += !same;
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        BOOST_CHECK_EQUAL(std::accumulate(mismatch.begin(), mismatch.end(), 0), 0);
+
+        // References handed out remain valid after repeated loads.
+        const auto& porv = shared.get<float>("PORV");
+        shared.loadData();
+        BOOST_CHECK(&porv == &shared.get<float>("PORV"));
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 
     std::string testFile1="ECLFILE.INIT";
@@ -360,6 +507,83 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_not_finite) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_exponents) {
+    WorkArea wa;
+    const std::vector<float>  float_vector{-1.5e-20f, 0.0f};
+    const std::vector<double> double_vector{-1.5e-200, 2.5e150, 1.0e-5};
+
+    const auto content = [](const std::string& fname)
+    {
+        std::ifstream is(fname);
+        return std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    };
+
+    {
+        EclOutput ecl("TEST.FINIT", true);
+        ecl.write("FLOAT", float_vector);
+        ecl.write("DOUBLE", double_vector);
+
+        EclOutput ix("TEST_IX.FINIT", true);
+        ix.set_ix();
+        ix.write("FLOAT", float_vector);
+        ix.write("DOUBLE", double_vector);
+    }
+
+    const auto ecl = content("TEST.FINIT");
+    BOOST_CHECK(ecl.find("  -0.15000000E-19   0.00000000E+00\n") != std::string::npos);
+    BOOST_CHECK(ecl.find("  -0.15000000000000-199   0.25000000000000+151   0.10000000000000D-04\n") != std::string::npos);
+
+    // Three digit negative exponents are written in full.
+    const auto ix = content("TEST_IX.FINIT");
+    BOOST_CHECK(ix.find("   -1.5000000E-20    0.0000000E+00\n") != std::string::npos);
+    BOOST_CHECK(ix.find("  -1.5000000000000E-200   2.5000000000000E+150    1.0000000000000E-05\n") != std::string::npos);
+
+    for (const auto* fname : {"TEST.FINIT", "TEST_IX.FINIT"}) {
+        EclFile file1(fname);
+        const auto d = file1.get<double>("DOUBLE");
+        BOOST_CHECK_CLOSE(d[0], double_vector[0], 1.0e-10);
+        BOOST_CHECK_CLOSE(d[1], double_vector[1], 1.0e-10);
+        BOOST_CHECK_CLOSE(d[2], double_vector[2], 1.0e-10);
+        BOOST_CHECK_CLOSE(file1.get<float>("FLOAT")[0], float_vector[0], 1.0e-4);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(TestEcl_ParseFormattedNumbers) {
+    // Fortran exponent forms, explicit signs and line breaks.
+    const auto doub = readFormattedDoubArray(" 0.12345678901234-100  0.1D+01 -0.5E+00\n +3.0 INF 'NEXT", 5, 0);
+    BOOST_CHECK_CLOSE(doub[0], 0.12345678901234e-100, 1.0e-10);
+    BOOST_CHECK_EQUAL(doub[1], 1.0);
+    BOOST_CHECK_EQUAL(doub[2], -0.5);
+    BOOST_CHECK_EQUAL(doub[3], 3.0);
+    BOOST_CHECK(std::isinf(doub[4]));
+
+    const auto inte = readFormattedInteArray("     1    -2\n    +3", 3, 0);
+    BOOST_CHECK(inte == std::vector<int>({1, -2, 3}));
+
+    BOOST_CHECK_THROW(readFormattedInteArray(" 1 X", 2, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(readFormattedRealArray(" 1.0 ", 2, 0), std::runtime_error);
+
+    // Large arrays are parsed in parallel chunks.
+    std::vector<float> real(200000);
+    std::vector<int> ints(200000);
+    for (std::size_t i = 0; i < real.size(); ++i) {
+        real[i] = 0.25f * static_cast<float>(i) - 1000.0f;
+        ints[i] = static_cast<int>(i) * 3 - 7;
+    }
+
+    WorkArea work;
+    {
+        EclOutput output("LARGE.FINIT", true);
+        output.write("REAL", real);
+        output.write("INTE", ints);
+    }
+
+    EclFile file1("LARGE.FINIT");
+    BOOST_CHECK(file1.get<float>("REAL") == real);
+    BOOST_CHECK(file1.get<int>("INTE") == ints);
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_getList) {
 
     std::string inputFile="ECLFILE.INIT";
@@ -533,6 +757,80 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_CHAR) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestEcl_BinaryKernels) {
+
+    // sizes around vector widths and record boundaries
+    for (const std::int64_t num : {0, 1, 3, 7, 8, 17, 999, 1000, 1001, 2500}) {
+        std::vector<int> inte(num);
+        std::iota(inte.begin(), inte.end(), -3);
+
+        std::vector<double> doub(num);
+        std::transform(inte.begin(), inte.end(), doub.begin(), [](int i) { return 0.5 * i + 1.0e-3; });
+
+        std::vector<int> inte_swapped(num);
+        swapEndian32(inte.data(), inte_swapped.data(), num);
+
+        std::vector<double> doub_swapped(num);
+        swapEndian64(doub.data(), doub_swapped.data(), num);
+
+        for (std::int64_t i = 0; i < num; i++) {
+            BOOST_CHECK_EQUAL(inte_swapped[i], flipEndianInt(inte[i]));
+            BOOST_CHECK_EQUAL(doub_swapped[i], flipEndianDouble(doub[i]));
+        }
+
+        // in place
+        swapEndian64(doub_swapped.data(), doub_swapped.data(), num);
+        BOOST_CHECK(doub_swapped == doub);
+
+        std::vector<char> disk(sizeOnDiskBinary(num, DOUB, sizeOfDoub));
+        const auto nbytes = encodeBinaryRecords(doub.data(), num, sizeOfDoub, MaxBlockSizeDoub / sizeOfDoub, disk.data());
+        BOOST_CHECK_EQUAL(nbytes, disk.size());
+
+        std::vector<double> decoded(num);
+        BOOST_CHECK_EQUAL(decodeBinaryRecords(disk.data(), num, sizeOfDoub, MaxBlockSizeDoub / sizeOfDoub, decoded.data()), nbytes);
+        BOOST_CHECK(decoded == doub);
+
+        if (num > 0) {
+            disk[0] ^= 1;
+            BOOST_CHECK_THROW(decodeBinaryRecords(disk.data(), num, sizeOfDoub, MaxBlockSizeDoub / sizeOfDoub, decoded.data()),
+                              std::runtime_error);
+        }
+    }
+
+    const std::string isa = endianKernelISA();
+    BOOST_CHECK(isa == "avx2" || isa == "ssse3" || isa == "neon" || isa == "scalar");
+
+    // output written with the kernels reads back through both the stream
+    // and the memory mapped paths
+    WorkArea work;
+
+    std::vector<float> real(2345);
+    std::iota(real.begin(), real.end(), 0.25f);
+
+    std::vector<int> large(10'000);
+    std::iota(large.begin(), large.end(), -17);
+
+    {
+        EclOutput out("KERNELS.DAT", false);
+        out.write("REAL", real);
+        out.write("LARGE", large);
+    }
+
+    {
+        EclFile file("KERNELS.DAT");
+        BOOST_CHECK(file.get<float>("REAL") == real);
+    }
+
+    {
+        EclFile file("KERNELS.DAT");
+        file.memoryMap();
+        BOOST_CHECK(file.getView<float>("REAL").toVector() == real);
+
+        const auto converted = file.getView<int>("LARGE").toVectorAs<double>();
+        BOOST_CHECK(converted == std::vector<double>(large.begin(), large.end()));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(CombinedVectorID) {
     BOOST_CHECK_EQUAL(combineSummaryNumbers(1, 2), 393'217);
     BOOST_CHECK_EQUAL(combineSummaryNumbers(10, 1), 360'458);
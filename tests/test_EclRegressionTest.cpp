@@ -32,6 +32,10 @@
 
 #include "tests/WorkArea.hpp"
 
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
 using Opm::EclIO::EGrid;
 using Opm::EclIO::ESmry;
 using Opm::EclIO::EclOutput;
@@ -935,6 +939,140 @@ BOOST_AUTO_TEST_CASE(results_unrst_3) {
 }
 
 
+namespace {
+
+// Output written to std::cout and std::cerr by a comparison, in the
+// order in which it appears.
+template <typename Comparison>
+std::string captureOutput(Comparison&& comparison, bool& threw)
+{
+    std::ostringstream buffer;
+
+    auto* coutBuf = std::cout.rdbuf(buffer.rdbuf());
+    auto* cerrBuf = std::cerr.rdbuf(buffer.rdbuf());
+
+    threw = false;
+    try {
+        comparison();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+
+    std::cout.rdbuf(coutBuf);
+    std::cerr.rdbuf(cerrBuf);
+
+    return buffer.str();
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(results_unrst_streaming) {
+    WorkArea work;
+    using Date = std::tuple<int, int, int>;
+
+    std::vector<int> seqnum = {0,1,4,7};
+    std::vector<Date> dates = {
+        Date{2000,1, 1},
+        Date{2000,1,10},
+        Date{2000,2, 1},
+        Date{2000,3, 1},
+    };
+    std::vector<bool> logihead(121, false);
+    logihead[3] = logihead[8] = true;
+    std::vector<double> doubhead = {0.0,1,0, 365, 0.10000000149012E+00,0.15000000596046E+00,0.30000000000000E+01};
+    doubhead.resize(229, 0.0);
+    std::vector<double> time = {0, 9, 31,60};
+
+    std::vector<std::vector<float>> pressure1 = {{210,210.1,210.2,210.05,210.15,210.25},{200,200.1,200.2,200.05,200.15,200.25},
+                                                 {190,190.1,190.2,190.05,190.15,190.25},{185,185.1,185.2,185.05,185.15,185.25}};
+
+    std::vector<std::vector<float>> rs = {{150,150.1,150.2,150.05,150.15,150.25},{160,160.1,160.2,160.05,160.15,160.25},
+                                          {165,165.1,165.2,165.05,165.15,165.25},{168,168.1,168.2,168.05,168.15,168.25}};
+
+    std::vector<std::string> zgrp = {"GRP1", "GRP2"};
+    std::vector<int> iwel = {1,4,6,8};
+
+    std::vector<std::string> solutionNames = {"PRESSURE","RS"};
+
+    makeUnrstFile("TMP1.UNRST", seqnum, dates, time, logihead, doubhead, zgrp, iwel, solutionNames, {pressure1, rs});
+    makeUnrstFile("TMP2.UNRST", seqnum, dates, time, logihead, doubhead, zgrp, iwel, solutionNames, {pressure1, rs});
+
+    ECLRegressionTest test1("TMP1", "TMP2", 1e-3, 1e-3);
+    test1.setStreamingComparison(2);
+    test1.results_rst();
+
+    // different pressure in sequence 4 cell 4 and sequence 7, cell 3
+
+    auto pressure2 = pressure1;
+    pressure2[2][3] = 191.05;
+    pressure2[3][2] = 185.82;
+
+    makeUnrstFile("TMP2.UNRST", seqnum, dates, time, logihead, doubhead, zgrp, iwel, solutionNames, {pressure2, rs});
+
+    // Same report, and same error, as sequential comparison
+
+    auto compare = [](const bool streaming, const bool throwOnError, const size_t maxFailures,
+                      bool& threw, size_t& numErrors)
+    {
+        ECLRegressionTest test("TMP1", "TMP2", 1e-3, 1e-3);
+        test.throwOnErrors(throwOnError);
+        test.setMaxFailures(maxFailures);
+
+        if (streaming) {
+            test.setStreamingComparison(3);
+        }
+
+        auto output = captureOutput([&test]() { test.results_rst(); }, threw);
+        numErrors = test.getNoErrors();
+
+        return output;
+    };
+
+    bool threw1, threw2;
+    size_t errors1, errors2;
+
+    auto report1 = compare(false, true, 0, threw1, errors1);
+    auto report2 = compare(true, true, 0, threw2, errors2);
+
+    BOOST_CHECK(threw1);
+    BOOST_CHECK(threw2);
+    BOOST_CHECK_EQUAL(report1, report2);
+
+    // Not throwing on errors
+
+    report1 = compare(false, false, 0, threw1, errors1);
+    report2 = compare(true, false, 0, threw2, errors2);
+
+    BOOST_CHECK(!threw1);
+    BOOST_CHECK(!threw2);
+    BOOST_CHECK_EQUAL(errors1, 2);
+    BOOST_CHECK_EQUAL(errors2, 2);
+    BOOST_CHECK_EQUAL(report1, report2);
+
+    // Stop after first failure, the sequence 7 is not compared
+
+    report1 = compare(false, false, 1, threw1, errors1);
+    report2 = compare(true, false, 1, threw2, errors2);
+
+    BOOST_CHECK(threw1);
+    BOOST_CHECK(threw2);
+    BOOST_CHECK_EQUAL(errors1, 1);
+    BOOST_CHECK_EQUAL(errors2, 1);
+    BOOST_CHECK_EQUAL(report1, report2);
+    BOOST_CHECK(report2.find("sequence  7") == std::string::npos);
+
+    // run full analysis, will not throw on first error
+
+    ECLRegressionTest test2("TMP1", "TMP2", 1e-3, 1e-3);
+    test2.setStreamingComparison(2);
+    test2.doAnalysis(true);
+    test2.results_rst();
+
+    // should get deviations for two keywords
+    BOOST_CHECK_EQUAL(test2.countDev(),2);
+}
+
+
 BOOST_AUTO_TEST_CASE(results_unsmry_1) {
     WorkArea work;
     std::vector<std::string> keywords1 = {"TIME", "YEARS", "FOPR", "FOPT", "WOPR", "WOPR", "WBHP", "WBHP", "ROIP"};
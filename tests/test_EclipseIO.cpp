@@ -54,6 +54,7 @@
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <ios>
 #include <map>
@@ -67,6 +68,8 @@
 
 #include <time.h>
 
+#include <fmt/format.h>
+
 #include <tests/WorkArea.hpp>
 
 using namespace Opm;
@@ -303,7 +306,7 @@ WELSPECS
 /
 )" };
 
-    auto write_and_check = [&deckString]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&deckString]( int first = 1, int last = 5, bool async = false ) {
         const auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         const auto& eclGrid = es.getInputGrid();
@@ -313,6 +316,9 @@ WELSPECS
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        if (async) {
+            eclWriter.enableAsyncOutput();
+        }
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -360,6 +366,7 @@ WELSPECS
                                     first_step - start_time,
                                     std::move(restart_value));
 
+            eclWriter.flush();
             checkRestartFile(i);
         }
 
@@ -435,6 +442,88 @@ WELSPECS
     // Verify that restarting a simulation, then writing fewer steps truncates
     // the file
     BOOST_CHECK_EQUAL(file_size, write_and_check(3, 5));
+
+    // Asynchronous output produces the same file.
+    BOOST_CHECK_EQUAL(file_size, write_and_check(1, 5, true));
+}
+
+BOOST_AUTO_TEST_CASE(EclipseIOConcurrentSeparateRestartFiles)
+{
+    const auto deckString = std::string { R"(RUNSPEC
+OIL
+GAS
+WATER
+METRIC
+DIMENS
+3 3 3/
+GRID
+DXV
+1.0 2.0 3.0 /
+DYV
+4.0 5.0 6.0 /
+DZV
+7.0 8.0 9.0 /
+TOPS
+9*100 /
+PORO
+  27*0.15 /
+PERMX
+27*1 /
+SOLUTION
+RPTRST
+BASIC=1
+/
+SCHEDULE
+TSTEP
+1.0 2.0 3.0 4.0 5.0 6.0 7.0 /
+)" };
+
+    WorkArea work_area("test_ecl_writer_separate");
+
+    const auto deck = Parser().parseString(deckString);
+    auto es = EclipseState(deck);
+    const auto& eclGrid = es.getInputGrid();
+    const Schedule schedule(deck, es, std::make_shared<Python>());
+    const SummaryConfig summary_config(deck, schedule, es.fieldProps(), es.aquifer());
+    const SummaryState st(TimeService::now(), 0.0);
+    es.getIOConfig().setBaseName("FOO");
+
+    {
+        EclipseIO eclWriter(es, eclGrid, schedule, summary_config);
+        eclWriter.enableAsyncOutput(4, 3);
+
+        const auto start_time = ecl_util_make_date(10, 10, 2008);
+
+        for (int i = 1; i < 7; ++i) {
+            Action::State action_state;
+            WellTestState wtest_state;
+            UDQState udq_state(1);
+            RestartValue restart_value(createBlackoilState(i, 3 * 3 * 3),
+                                       data::Wells{}, data::GroupAndNetworkValues{}, {});
+
+            eclWriter.writeTimeStep(action_state, wtest_state, st, udq_state,
+                                    i, false,
+                                    ecl_util_make_date(10 + i, 11, 2008) - start_time,
+                                    std::move(restart_value));
+        }
+
+        eclWriter.flush();
+    }
+
+    for (int i = 1; i < 7; ++i) {
+        const auto fname = fmt::format("FOO.X{:04d}", i);
+        BOOST_REQUIRE_MESSAGE(std::filesystem::exists(fname),
+                              "Restart file " << fname << " must exist");
+
+        EclIO::EclFile rstFile(fname);
+
+        auto sol = createBlackoilState(i, 3 * 3 * 3);
+        auto& expect = sol.data<double>("PRESSURE");
+        std::transform(expect.begin(), expect.end(), expect.begin(),
+                       [](const auto& x) { return x / Metric::Pressure; });
+
+        compareErtData(expect, rstFile.get<float>("PRESSURE"), 1e-4);
+    }
 }
 
 namespace {
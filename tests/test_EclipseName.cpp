@@ -0,0 +1,91 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE EclipseName
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/EclipseName.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(Construct)
+{
+    const Opm::EclipseName empty;
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK_EQUAL(empty.size(), 0U);
+    BOOST_CHECK_EQUAL(empty.str(), "");
+
+    const Opm::EclipseName op1 { "OP_1" };
+    BOOST_CHECK_EQUAL(op1.size(), 4U);
+    BOOST_CHECK_EQUAL(op1.str(), "OP_1");
+    BOOST_CHECK_EQUAL(op1.padded(), "OP_1    ");
+    BOOST_CHECK_EQUAL(fmt::format("<{}>", op1), "<OP_1>");
+
+    BOOST_CHECK(op1 == Opm::EclipseName { "OP_1    " });
+    BOOST_CHECK(op1 == Opm::EclipseName { std::string { "OP_1  " } });
+    BOOST_CHECK(op1 != Opm::EclipseName { "OP_2" });
+
+    const Opm::EclipseName full { "ABCDEFGH" };
+    BOOST_CHECK_EQUAL(full.size(), 8U);
+    BOOST_CHECK_EQUAL(full.str(), "ABCDEFGH");
+
+    BOOST_CHECK(Opm::EclipseName::fits("ABCDEFGH  "));
+    BOOST_CHECK(!Opm::EclipseName::fits("ABCDEFGHI"));
+    BOOST_CHECK_THROW(Opm::EclipseName { "ABCDEFGHI" }, std::invalid_argument);
+
+    // Embedded blanks are part of the name.
+    BOOST_CHECK_EQUAL(Opm::EclipseName { "A B" }.str(), "A B");
+
+    constexpr Opm::EclipseName compile_time { "FIELD" };
+    static_assert(compile_time.size() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(Order)
+{
+    const std::vector<std::string> names {
+        "PROD", "P", "PROD1", "INJ", "FIELD", "PROD10", "A", "ZZZZZZZZ", "PRO",
+    };
+
+    auto packed = std::vector<Opm::EclipseName>(names.begin(), names.end());
+    std::sort(packed.begin(), packed.end());
+
+    auto sorted = names;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        BOOST_CHECK_EQUAL(packed[i].str(), sorted[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Hash)
+{
+    std::unordered_set<Opm::EclipseName> set;
+    for (int i = 0; i < 1000; ++i) {
+        set.insert(Opm::EclipseName { "W" + std::to_string(i) });
+    }
+
+    BOOST_CHECK_EQUAL(set.size(), 1000U);
+    BOOST_CHECK_EQUAL(set.count(Opm::EclipseName { "W17  " }), 1U);
+    BOOST_CHECK_EQUAL(set.count(Opm::EclipseName { "W1000" }), 0U);
+}
@@ -20,6 +20,7 @@
 
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/ExtESmry.hpp>
+#include <opm/io/eclipse/ExtSmryCodec.hpp>
 #include <opm/common/utility/FileSystem.hpp>
 
 #define BOOST_TEST_MODULE Test EclIO
@@ -30,9 +31,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <math.h>
 #include <stdio.h>
 #include <tuple>
@@ -236,6 +240,264 @@ BOOST_AUTO_TEST_CASE(TestExtESmry_1) {
     BOOST_CHECK_EQUAL(fopr4a.size(), fgor4a.size());
 }
 
+BOOST_AUTO_TEST_CASE(TestESmry_ColumnarFile_TimeWindow) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    ESmry ref("SPE1CASE1.SMSPEC");
+    BOOST_CHECK(!ref.uses_esmry_file());
+
+    ref.make_esmry_file();
+
+    // vectors served from the ESMRY file once it exists
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    BOOST_CHECK(smry1.uses_esmry_file());
+
+    BOOST_CHECK(smry1.get("WGPR:PROD") == ref.get("WGPR:PROD"));
+    BOOST_CHECK(smry1.get("BPR:10,10,3") == ref.get("BPR:10,10,3"));
+    BOOST_CHECK(smry1.get_at_rstep("FGOR") == ref.get_at_rstep("FGOR"));
+    BOOST_CHECK_THROW(smry1.get("NO_SUCH_KEY"), std::invalid_argument);
+
+    // time window [dates[10], dates[20]] -> 11 time steps
+
+    const auto dates = ref.dates();
+    const auto& wbhp = ref.get("WBHP:PROD");
+    const auto wbhp_window = std::vector<float>(wbhp.begin() + 10, wbhp.begin() + 21);
+
+    BOOST_CHECK(ref.get("WBHP:PROD", dates[10], dates[20]) == wbhp_window);
+    BOOST_CHECK(smry1.get("WBHP:PROD", dates[10], dates[20]) == wbhp_window);
+
+    ExtESmry esmry1("SPE1CASE1.ESMRY");
+
+    const auto [first, last] = esmry1.timestep_window(dates[10], dates[20]);
+    BOOST_CHECK_EQUAL(first, 10);
+    BOOST_CHECK_EQUAL(last, 21);
+
+    BOOST_CHECK(esmry1.get("WBHP:PROD", dates[10], dates[20]) == wbhp_window);
+    BOOST_CHECK(esmry1.get("WBHP:PROD", dates[20], dates[10]).empty());
+
+    const auto& wgpr = ref.get("WGPR:PROD");
+    BOOST_CHECK(esmry1.get("WGPR:PROD", dates.front(), dates.back()) == wgpr);
+
+    // already loaded vectors are sliced in memory
+    esmry1.loadData({"WBHP:PROD"});
+    BOOST_CHECK(esmry1.get("WBHP:PROD", dates[10], dates[20]) == wbhp_window);
+}
+
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_FloatChunkCodec) {
+    std::vector<float> values { 0.0f, 0.0f, 0.0f, 1.0f, 1.5f, 1.25f, -0.0f, -1.0e30f,
+                                std::numeric_limits<float>::infinity(),
+                                std::numeric_limits<float>::denorm_min(),
+                                123.456f, 123.457f, 123.457f, 7.0e-12f };
+
+    for (int i = 0; i < 500; i++)
+        values.push_back(1000.0f + 0.37f * i);
+
+    values.push_back(std::numeric_limits<float>::quiet_NaN());
+
+    const auto words = Opm::EclIO::encodeFloatChunk(values.data(), values.size());
+    BOOST_CHECK(words.size() < values.size());
+
+    std::vector<float> decoded(values.size());
+    Opm::EclIO::decodeFloatChunk(words.data(), words.size(), values.size(), decoded.data());
+
+    // lossless, compare bit patterns to cover NaN and signed zero
+    BOOST_CHECK(std::memcmp(values.data(), decoded.data(), values.size() * sizeof(float)) == 0);
+
+    BOOST_CHECK_THROW(Opm::EclIO::decodeFloatChunk(words.data(), words.size() / 2, values.size(), decoded.data()),
+                      std::runtime_error);
+
+    const std::vector<float> constant(1000, 42.0f);
+    const auto constWords = Opm::EclIO::encodeFloatChunk(constant.data(), constant.size());
+    BOOST_CHECK_EQUAL(constWords.size(), 33U);
+}
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_DoubleChunkCodec) {
+    std::vector<double> values { 0.0, 0.0, 1.0, 1.5, -0.0, -1.0e300,
+                                 std::numeric_limits<double>::infinity(),
+                                 std::numeric_limits<double>::denorm_min(),
+                                 123.456, 123.457, 123.457, 7.0e-12 };
+
+    for (int i = 0; i < 500; i++)
+        values.push_back(250.0 + 0.125 * (i % 17));
+
+    values.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    const auto words = Opm::EclIO::encodeDoubleChunk(values.data(), values.size());
+    BOOST_CHECK(words.size() < values.size());
+
+    std::vector<double> decoded(values.size());
+    Opm::EclIO::decodeDoubleChunk(words.data(), words.size(), values.size(), decoded.data());
+
+    BOOST_CHECK(std::memcmp(values.data(), decoded.data(), values.size() * sizeof(double)) == 0);
+
+    BOOST_CHECK_THROW(Opm::EclIO::decodeDoubleChunk(words.data(), words.size() / 2, values.size(), decoded.data()),
+                      std::runtime_error);
+
+    const std::vector<double> constant(1000, 42.0);
+    const auto constWords = Opm::EclIO::encodeDoubleChunk(constant.data(), constant.size());
+    BOOST_CHECK_EQUAL(constWords.size(), 34U);
+}
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_Chunked) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    ESmry ref("SPE1CASE1.SMSPEC");
+
+    // 123 time steps, 7 full chunks and one partial
+    BOOST_CHECK(ref.make_esmry_file(16));
+
+    ExtESmry esmry1("SPE1CASE1.ESMRY");
+
+    BOOST_CHECK_EQUAL(esmry1.numberOfTimeSteps(), ref.numberOfTimeSteps());
+    BOOST_CHECK(esmry1.keywordList() == ref.keywordList());
+
+    for (const auto& key : ref.keywordList()) {
+        BOOST_CHECK_MESSAGE(esmry1.get(key) == ref.get(key), "vector " + key);
+        BOOST_CHECK(esmry1.get_at_rstep(key) == ref.get_at_rstep(key));
+    }
+
+    BOOST_CHECK(esmry1.dates() == ref.dates());
+
+    // time windows read only the chunks needed, here inside a single
+    // chunk and spanning chunk boundaries
+
+    const auto dates = ref.dates();
+
+    ExtESmry esmry2("SPE1CASE1.ESMRY");
+
+    for (const auto& [first, last] : std::vector<std::pair<int,int>>{ {17, 20}, {10, 50}, {0, 122}, {112, 122} }) {
+        const auto& wbhp = ref.get("WBHP:PROD");
+        const auto expected = std::vector<float>(wbhp.begin() + first, wbhp.begin() + last + 1);
+
+        BOOST_CHECK(esmry2.get("WBHP:PROD", dates[first], dates[last]) == expected);
+    }
+
+    // served transparently as vector source of ESmry
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    BOOST_CHECK(smry1.uses_esmry_file());
+    BOOST_CHECK(smry1.get("FOPR") == ref.get("FOPR"));
+    BOOST_CHECK(smry1.get("BPR:10,10,3") == ref.get("BPR:10,10,3"));
+
+    const auto chunkedSize = std::filesystem::file_size("SPE1CASE1.ESMRY");
+
+    std::filesystem::remove("SPE1CASE1.ESMRY");
+    BOOST_CHECK(ESmry("SPE1CASE1.SMSPEC").make_esmry_file());
+
+    BOOST_CHECK(chunkedSize < std::filesystem::file_size("SPE1CASE1.ESMRY"));
+}
+
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_Batches) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+    work.copyIn("SPE1CASE1_RST60.SMSPEC");
+    work.copyIn("SPE1CASE1_RST60.UNSMRY");
+
+    ESmry ref("SPE1CASE1.SMSPEC");
+
+    // one vector per batch, and batches not aligned with the chunks
+    for (const auto& [chunk_size, batch_size] : std::vector<std::pair<int, std::size_t>>{ {0, 1}, {16, 7} }) {
+        BOOST_CHECK(ESmry("SPE1CASE1.SMSPEC").make_esmry_file(chunk_size, batch_size));
+
+        ExtESmry esmry("SPE1CASE1.ESMRY");
+
+        BOOST_CHECK(esmry.keywordList() == ref.keywordList());
+
+        for (const auto& key : ref.keywordList())
+            BOOST_CHECK_MESSAGE(esmry.get(key) == ref.get(key), "vector " + key);
+
+        BOOST_CHECK(esmry.get_at_rstep("FOPR") == ref.get_at_rstep("FOPR"));
+
+        std::filesystem::remove("SPE1CASE1.ESMRY");
+    }
+
+    // restart chain, only the restarted run's own time steps are written
+
+    {
+        ESmry chain("SPE1CASE1_RST60.SMSPEC", true);
+        BOOST_CHECK(chain.make_esmry_file(0, 5));
+    }
+
+    ESmry rst("SPE1CASE1_RST60.SMSPEC");
+    ExtESmry esmry1("SPE1CASE1_RST60.ESMRY");
+
+    BOOST_CHECK_EQUAL(esmry1.numberOfTimeSteps(), rst.numberOfTimeSteps());
+    BOOST_CHECK(esmry1.keywordList() == rst.keywordList());
+
+    for (const auto& key : rst.keywordList())
+        BOOST_CHECK_MESSAGE(esmry1.get(key) == rst.get(key), "vector " + key);
+
+    BOOST_CHECK(esmry1.get_at_rstep("FOPR") == rst.get_at_rstep("FOPR"));
+
+    BOOST_CHECK(ref.make_esmry_file());
+
+    ExtESmry esmry2("SPE1CASE1_RST60.ESMRY", true);
+    ESmry chain("SPE1CASE1_RST60.SMSPEC", true);
+
+    BOOST_CHECK_EQUAL(esmry2.numberOfTimeSteps(), chain.numberOfTimeSteps());
+    BOOST_CHECK(esmry2.get("TIME") == chain.get("TIME"));
+    BOOST_CHECK(esmry2.get("WGPR:PROD") == chain.get("WGPR:PROD"));
+}
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_Refresh) {
+    ESmry ref("SPE1CASE1.SMSPEC");
+
+    std::string unsmry;
+    {
+        std::ifstream in("SPE1CASE1.UNSMRY", std::ios::binary);
+        unsmry.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+
+    {
+        std::ofstream out("SPE1CASE1.UNSMRY", std::ios::binary | std::ios::trunc);
+        out.write(unsmry.data(), unsmry.size() / 2);
+    }
+
+    {
+        ESmry smry("SPE1CASE1.SMSPEC");
+        smry.make_esmry_file();
+    }
+
+    ExtESmry esmry("SPE1CASE1.ESMRY");
+
+    const auto nStep0 = esmry.numberOfTimeSteps();
+    BOOST_CHECK(nStep0 < ref.numberOfTimeSteps());
+
+    esmry.loadData({"TIME", "FOPR"});
+    BOOST_CHECK_EQUAL(esmry.refresh(), false);
+
+    {
+        std::ofstream out("SPE1CASE1.UNSMRY", std::ios::binary | std::ios::trunc);
+        out.write(unsmry.data(), unsmry.size());
+    }
+
+    std::filesystem::remove("SPE1CASE1.ESMRY");
+
+    {
+        ESmry smry("SPE1CASE1.SMSPEC");
+        smry.make_esmry_file();
+    }
+
+    BOOST_CHECK_EQUAL(esmry.refresh(), true);
+    BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), ref.numberOfTimeSteps());
+
+    BOOST_CHECK(esmry.get("FOPR") == ref.get("FOPR"));
+    BOOST_CHECK(esmry.get("WGPR:PROD") == ref.get("WGPR:PROD"));
+    BOOST_CHECK(esmry.get_at_rstep("FOPR") == ref.get_at_rstep("FOPR"));
+    BOOST_CHECK(esmry.dates() == ref.dates());
+}
+
 BOOST_AUTO_TEST_CASE(TestExtESmry_2) {
 
     // using a syntetic restart file.
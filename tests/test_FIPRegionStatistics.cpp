@@ -170,6 +170,38 @@ FIPRE2
     BOOST_CHECK_EQUAL(fipStats.maximumRegionID("FIPRE2"), 2);
 }
 
+BOOST_AUTO_TEST_CASE(Many_Cells)
+{
+    // Several blocks of cells, with the maximum region IDs in the first
+    // and last cells.
+    const auto fipStats = Opm::FIPRegionStatistics {
+        3, fieldProps(R"(RUNSPEC
+DIMENS
+100 100 2 /
+GRID
+DX
+20000*100 /
+DY
+20000*100 /
+DZ
+20000*5 /
+TOPS
+10000*2000 /
+PORO
+20000*0.3 /
+REGIONS
+FIPABC
+6 9999*1 10000*2 /
+FIPRE2
+19999*1 5 /
+)"), [](std::vector<int>&) {}
+    };
+
+    BOOST_CHECK_EQUAL(fipStats.maximumRegionID("ABC"), 6);
+    BOOST_CHECK_EQUAL(fipStats.maximumRegionID("NUM"), 1);
+    BOOST_CHECK_EQUAL(fipStats.maximumRegionID("RE2"), 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Sequential
 
 // ---------------------------------------------------------------------------
@@ -32,14 +32,17 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <opm/input/eclipse/Units/Units.hpp>
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <stddef.h>
 
@@ -544,4 +547,64 @@ BOOST_AUTO_TEST_CASE(P_Third_df09)
     BOOST_CHECK( wi.getGuideRatePhase() == Opm::Well::GuideRateTarget::GAS );
 }
 
+BOOST_AUTO_TEST_CASE(Batch_Compute_And_Index_Lookup)
+{
+    auto single = case_10x10x10_model4();
+    auto batch = case_10x10x10_model4();
+
+    const auto wells = std::vector<std::string> { "P1", "P2", "I1" };
+    const auto pots = std::vector<Opm::GuideRate::RateVector> {
+        { 1.0, 5.0, 0.1 }, { 10.0, 50.0, 1.0 }, { 0.0, 20.0, 0.0 },
+    };
+
+    const auto rpt = size_t{1};
+    for (const auto stm : { 0.0, 10.0*Opm::unit::day }) {
+        single.gr.updateGuideRateExpiration(stm, rpt);
+        for (auto i = 0*wells.size(); i < wells.size(); ++i) {
+            single.gr.compute(wells[i], rpt, stm, pots[i].oil_rat, pots[i].gas_rat, pots[i].wat_rat);
+        }
+
+        batch.gr.updateGuideRateExpiration(stm, rpt);
+        batch.gr.compute(wells, rpt, stm, pots);
+    }
+
+    const auto rates = Opm::GuideRate::RateVector { 2.0, 4.0, 1.0 };
+    for (const auto& well : wells) {
+        BOOST_CHECK_EQUAL(batch.gr.has(well), single.gr.has(well));
+
+        const auto well_index = batch.sched.wellIndex(well);
+        BOOST_REQUIRE(well_index.has_value());
+
+        for (const auto target : { Opm::GuideRateModel::Target::OIL,
+                                   Opm::GuideRateModel::Target::GAS,
+                                   Opm::GuideRateModel::Target::WAT })
+        {
+            const auto expect = single.gr.get(well, target, rates);
+            BOOST_CHECK_EQUAL(batch.gr.get(well, target, rates), expect);
+            BOOST_CHECK_EQUAL(batch.gr.getWell(*well_index, target, rates), expect);
+        }
+    }
+
+    BOOST_CHECK_THROW(batch.gr.getWell(1000, Opm::GuideRateModel::Target::OIL, rates), std::out_of_range);
+    BOOST_CHECK_THROW(batch.gr.compute(wells, rpt, 0.0, {}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Batch_Formula_Evaluation)
+{
+    const auto cse = case_10x10x10_model4();
+    const auto& model = cse.sched[1].guide_rate().model();
+
+    const auto oil = std::vector<double> { 1.0, 10.0, 0.0, 3.5 };
+    const auto gas = std::vector<double> { 5.0, 50.0, 1.0, 0.2 };
+    const auto wat = std::vector<double> { 0.1, 1.0, 0.0, 7.0 };
+
+    auto guide_rates = std::vector<double>{};
+    model.eval(oil, gas, wat, guide_rates);
+
+    BOOST_REQUIRE_EQUAL(guide_rates.size(), oil.size());
+    for (auto i = 0*oil.size(); i < oil.size(); ++i) {
+        BOOST_CHECK_EQUAL(guide_rates[i], model.eval(oil[i], gas[i], wat[i]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // GuideRate_Calculations
@@ -0,0 +1,192 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE test_ICDEvaluator
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Schedule/MSW/ICDEvaluator.hpp>
+
+#include <opm/input/eclipse/Schedule/MSW/AICD.hpp>
+#include <opm/input/eclipse/Schedule/MSW/SICD.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Valve.hpp>
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    Opm::Segment makeSegment(const int number)
+    {
+        return { number, 1, number - 1, 10.0 * number, 1000.0 + number,
+                 0.1, 1.0e-5, 0.00785, 0.0785, true, 0.0, 0.0 };
+    }
+
+    // Top segment, a spiral ICD, an autonomous ICD and a valve.
+    Opm::WellSegments makeSegments()
+    {
+        auto sicd = makeSegment(2);
+        sicd.updateSpiralICD(Opm::SICD { 0.5, 10.0, 1000.0, 1.0e-3, 0.5, 0.1, 5.0,
+                                         0, std::nullopt, Opm::ICDStatus::OPEN, 1.5 });
+
+        auto aicd = makeSegment(3);
+        aicd.updateAutoICD(Opm::AutoICD::serializationTestObject());
+
+        auto valve = makeSegment(4);
+        valve.updateValve(Opm::Valve { 0.7, 1.0e-4, 2.0e-4, 5.0, 0.05, 1.0e-5, 0.002,
+                                       Opm::ICDStatus::OPEN });
+
+        return { Opm::WellSegments::CompPressureDrop::HFA,
+                 { makeSegment(1), sicd, aicd, valve } };
+    }
+
+    template <class Evaluation>
+    Opm::ICDFlow<Evaluation> makeFlow(const Evaluation& rate, const double water_fraction)
+    {
+        using E = Opm::ICDEvaluator;
+
+        auto flow = Opm::ICDFlow<Evaluation>{};
+        flow.mass_rate = { rate, 2.0 * rate, 0.1 * rate };
+        flow.density = std::vector<Evaluation>(3, Evaluation{900.0});
+        flow.viscosity = std::vector<Evaluation>(3, Evaluation{2.0e-3});
+
+        flow.fraction[E::Water] = std::vector<Evaluation>(3, Evaluation{water_fraction});
+        flow.fraction[E::Oil] = std::vector<Evaluation>(3, Evaluation{0.8 - water_fraction});
+        flow.fraction[E::Gas] = std::vector<Evaluation>(3, Evaluation{0.2});
+
+        flow.phase_density[E::Water] = std::vector<Evaluation>(3, Evaluation{1000.0});
+        flow.phase_density[E::Oil] = std::vector<Evaluation>(3, Evaluation{800.0});
+        flow.phase_density[E::Gas] = std::vector<Evaluation>(3, Evaluation{100.0});
+
+        flow.phase_viscosity[E::Water] = std::vector<Evaluation>(3, Evaluation{0.5e-3});
+        flow.phase_viscosity[E::Oil] = std::vector<Evaluation>(3, Evaluation{3.0e-3});
+        flow.phase_viscosity[E::Gas] = std::vector<Evaluation>(3, Evaluation{0.02e-3});
+
+        return flow;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(GatherDevices)
+{
+    const auto evaluator = Opm::ICDEvaluator { makeSegments(), Opm::UnitSystem::newMETRIC() };
+
+    BOOST_CHECK_EQUAL(evaluator.size(), std::size_t{3});
+    BOOST_CHECK(evaluator.segments() == std::vector<int>({ 2, 3, 4 }));
+
+    BOOST_CHECK_EQUAL(Opm::ICDEvaluator{}.size(), std::size_t{0});
+}
+
+BOOST_AUTO_TEST_CASE(ReferenceValues)
+{
+    const auto evaluator = Opm::ICDEvaluator { makeSegments(), Opm::UnitSystem::newMETRIC() };
+
+    auto dp = std::vector<double>{};
+    evaluator.pressureDrop(makeFlow(-0.5, 0.2), dp);
+    BOOST_REQUIRE_EQUAL(dp.size(), std::size_t{3});
+
+    // Spiral ICD.  Water liquid fraction 0.25, below the transition
+    // region, i.e., a water-in-oil emulsion.
+    {
+        const double ratio = std::pow(1.0 / (1.0 - 0.8415 / 0.7480 * 0.25), 2.5);
+        const double mu = 0.8 * 3.0e-3 * ratio + 0.2 * 0.02e-3;
+        const double q = -0.5 / 900.0 * 1.5;
+        const double expected = 0.5 * q * q * std::pow(900.0 / 1000.0, 0.75)
+            * std::pow(mu / 1.0e-3, 0.25);
+
+        BOOST_CHECK_CLOSE(dp[0], expected, 1.0e-10);
+    }
+
+    // Valve, laminar friction in the additional pipe length.
+    {
+        const double w = -0.05;
+        const double re = std::abs(0.05 * w / (0.002 * 2.0e-3));
+        BOOST_REQUIRE(re < 2000.0);
+
+        const double friction = 2.0 * (16.0 / re) * 5.0 * w * w / (0.002 * 0.002 * 0.05 * 900.0);
+        const double constriction = w * w / (2.0 * 900.0 * 0.7 * 0.7 * 1.0e-4 * 1.0e-4);
+
+        BOOST_CHECK_CLOSE(dp[2], friction + constriction, 1.0e-10);
+    }
+
+    // Flow reversal changes the sign.
+    auto reversed = std::vector<double>{};
+    evaluator.pressureDrop(makeFlow(0.5, 0.2), reversed);
+    for (std::size_t i = 0; i < dp.size(); ++i) {
+        BOOST_CHECK(dp[i] > 0.0);
+        BOOST_CHECK(reversed[i] < 0.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Derivatives)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 1>;
+
+    const auto evaluator = Opm::ICDEvaluator { makeSegments(), Opm::UnitSystem::newMETRIC() };
+
+    // Below, inside and above the spiral ICD's transition region.
+    for (const double water_fraction : { 0.2, 0.4, 0.6 }) {
+        const double rate = -0.5;
+        const double h = 1.0e-6;
+
+        auto dp = std::vector<Eval>{};
+        evaluator.pressureDrop(makeFlow(Eval::createVariable(rate, 0), water_fraction), dp);
+
+        auto lower = std::vector<double>{};
+        auto upper = std::vector<double>{};
+        auto value = std::vector<double>{};
+        evaluator.pressureDrop(makeFlow(rate - h, water_fraction), lower);
+        evaluator.pressureDrop(makeFlow(rate + h, water_fraction), upper);
+        evaluator.pressureDrop(makeFlow(rate, water_fraction), value);
+
+        for (std::size_t i = 0; i < dp.size(); ++i) {
+            BOOST_CHECK_CLOSE(dp[i].value(), value[i], 1.0e-12);
+            BOOST_CHECK_CLOSE(dp[i].derivative(0), (upper[i] - lower[i]) / (2.0 * h), 1.0e-4);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(InvalidSizes)
+{
+    const auto evaluator = Opm::ICDEvaluator { makeSegments(), Opm::UnitSystem::newMETRIC() };
+
+    auto dp = std::vector<double>{};
+
+    auto flow = makeFlow(-0.5, 0.2);
+    flow.mass_rate.pop_back();
+    BOOST_CHECK_THROW(evaluator.pressureDrop(flow, dp), std::invalid_argument);
+
+    flow = makeFlow(-0.5, 0.2);
+    flow.phase_viscosity[Opm::ICDEvaluator::Gas].resize(1);
+    BOOST_CHECK_THROW(evaluator.pressureDrop(flow, dp), std::invalid_argument);
+
+    // Inactive phases are left empty.
+    flow = makeFlow(-0.5, 0.2);
+    flow.fraction[Opm::ICDEvaluator::Gas].clear();
+    flow.phase_density[Opm::ICDEvaluator::Gas].clear();
+    flow.phase_viscosity[Opm::ICDEvaluator::Gas].clear();
+    BOOST_CHECK_NO_THROW(evaluator.pressureDrop(flow, dp));
+}
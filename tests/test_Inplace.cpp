@@ -64,6 +64,35 @@ BOOST_AUTO_TEST_CASE(TESTInplace)
         const std::vector<double> e1 = {0,0,100,0,0,50};
         BOOST_CHECK_MESSAGE(v1 == e1, "In-place oil content must match expected");
     }
+
+    {
+        auto v2 = std::vector<double>(10, 1.0);
+        oip.get_vector("FIPNUM", Inplace::Phase::OIL, v2);
+        const std::vector<double> e2 = {0,0,100,0,0,50};
+        BOOST_CHECK_MESSAGE(v2 == e2, "In-place oil content must match expected");
+    }
+
+    {
+        const auto values = oip.values("FIPNUM", Inplace::Phase::OIL);
+        BOOST_CHECK_EQUAL(values.size(), 7);
+        BOOST_CHECK_EQUAL(values[3], 100);
+        BOOST_CHECK_EQUAL(values[4], 0);
+        BOOST_CHECK_EQUAL(values[6], 50);
+
+        BOOST_CHECK_THROW(oip.values("FIPNUM", Inplace::Phase::GAS), std::exception);
+        BOOST_CHECK_THROW(oip.values("FIPX", Inplace::Phase::OIL), std::exception);
+    }
+
+    {
+        auto other = Inplace{};
+        other.add("FIPNUM", Inplace::Phase::OIL, 6, 50);
+        other.add(Inplace::Phase::GAS, 100);
+        other.add("FIPNUM", Inplace::Phase::OIL, 3, 100);
+        BOOST_CHECK_MESSAGE(other == oip, "Insertion order must not affect equality");
+
+        other.add("FIPNUM", Inplace::Phase::OIL, 4, 0.0);
+        BOOST_CHECK_MESSAGE(!(other == oip), "Assigned zero value must affect equality");
+    }
 }
 
 BOOST_AUTO_TEST_CASE(InPlace_Phases)
@@ -0,0 +1,139 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE InputProfileTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Utility/InputProfile.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <string>
+
+using Opm::InputProfile;
+
+BOOST_AUTO_TEST_CASE(DisabledRecordsNothing)
+{
+    InputProfile::disable();
+    InputProfile::clear();
+    {
+        InputProfile::Scope scope { "include", "CASE.DATA", 100 };
+    }
+
+    BOOST_CHECK_EQUAL(InputProfile::report(InputProfile::Format::CSV),
+                      "category,name,count,seconds,bytes\n");
+}
+
+BOOST_AUTO_TEST_CASE(AggregateEntries)
+{
+    InputProfile::enable(InputProfile::Format::CSV);
+    InputProfile::clear();
+
+    InputProfile::record("include", "CASE.DATA", 0.5, 100);
+    InputProfile::record("include", "CASE.DATA", 0.25, 50);
+    InputProfile::record("parse", "PORO", 1.0);
+    InputProfile::record("include", "a,b.inc", 1.0, 10);
+
+    BOOST_CHECK_EQUAL(InputProfile::report(InputProfile::Format::CSV),
+                      "category,name,count,seconds,bytes\n"
+                      "include,\"a,b.inc\",1,1.000000,10\n"
+                      "include,CASE.DATA,2,0.750000,150\n"
+                      "parse,PORO,1,1.000000,0\n");
+
+    BOOST_CHECK_EQUAL(InputProfile::report(InputProfile::Format::JSON),
+                      "[\n"
+                      R"(  {"category": "include", "name": "a,b.inc", "count": 1, "seconds": 1.000000, "bytes": 10},)" "\n"
+                      R"(  {"category": "include", "name": "CASE.DATA", "count": 2, "seconds": 0.750000, "bytes": 150},)" "\n"
+                      R"(  {"category": "parse", "name": "PORO", "count": 1, "seconds": 1.000000, "bytes": 0})" "\n"
+                      "]\n");
+
+    InputProfile::clear();
+    InputProfile::disable();
+}
+
+BOOST_AUTO_TEST_CASE(FoldedRecords)
+{
+    InputProfile::enable(InputProfile::Format::Folded);
+    InputProfile::clear();
+
+    InputProfile::record("include", "a;b.inc", 0.25, 10);
+    InputProfile::record("parse", "PORO", 1.5);
+    InputProfile::record("parse", "PERMX", 2.0);
+
+    const auto records = InputProfile::records();
+    BOOST_REQUIRE_EQUAL(records.size(), 3U);
+    BOOST_CHECK_EQUAL(records[1].category, "parse");
+    BOOST_CHECK_EQUAL(records[1].name, "PERMX");
+    BOOST_CHECK_EQUAL(records[1].count, 1U);
+    BOOST_CHECK_EQUAL(records[0].bytes, 10U);
+
+    BOOST_CHECK_EQUAL(InputProfile::report(InputProfile::Format::Folded),
+                      "include;a:b.inc 250000\n"
+                      "parse;PERMX 2000000\n"
+                      "parse;PORO 1500000\n");
+
+    InputProfile::clear();
+    InputProfile::disable();
+}
+
+BOOST_AUTO_TEST_CASE(ParserPhase)
+{
+    const auto deck_string = std::string { R"(RUNSPEC
+DIMENS
+ 10 10 10 /
+GRID
+PORO
+ 1000*0.25 /
+)" };
+
+    InputProfile::enable(InputProfile::Format::CSV);
+    InputProfile::clear();
+
+    const auto deck = Opm::Parser{}.parseString(deck_string);
+    BOOST_CHECK_EQUAL(deck.size(), 4U);
+
+    // The outermost phase writes and clears the report.
+    BOOST_CHECK_EQUAL(InputProfile::report(InputProfile::Format::CSV),
+                      "category,name,count,seconds,bytes\n");
+
+    {
+        InputProfile::Phase outer { "outer" };
+        const auto nested = Opm::Parser{}.parseString(deck_string);
+
+        const auto report = InputProfile::report(InputProfile::Format::CSV);
+        BOOST_CHECK(report.find("parse,PORO,1,") != std::string::npos);
+        BOOST_CHECK(report.find("phase,Parser::parseString,1,") != std::string::npos);
+    }
+
+    // Without the automatic report the entries are kept.
+    InputProfile::setAutoReport(false);
+    InputProfile::clear();
+    {
+        const auto kept = Opm::Parser{}.parseString(deck_string);
+        static_cast<void>(kept);
+    }
+    BOOST_CHECK(InputProfile::report(InputProfile::Format::CSV).find("parse,PORO,1,") != std::string::npos);
+    InputProfile::setAutoReport(true);
+    InputProfile::clear();
+
+    InputProfile::disable();
+}
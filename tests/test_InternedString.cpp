@@ -0,0 +1,95 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE InternedString
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/OpmLog/KeywordLocation.hpp>
+#include <opm/common/utility/InternedString.hpp>
+
+#include <fmt/format.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(SharedStorage)
+{
+    const auto a = Opm::InternedString { std::string { "CASE.DATA" } };
+    const auto b = Opm::InternedString { "CASE.DATA" };
+    const auto c = Opm::InternedString { "OTHER.INC" };
+
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != c);
+    BOOST_CHECK_EQUAL(&a.str(), &b.str());
+
+    BOOST_CHECK(a == "CASE.DATA");
+    BOOST_CHECK(std::string { "OTHER.INC" } == c);
+    BOOST_CHECK_EQUAL(a + ":" + c, "CASE.DATA:OTHER.INC");
+    BOOST_CHECK_EQUAL(fmt::format("{}", c), "OTHER.INC");
+
+    BOOST_CHECK(Opm::InternedString{}.empty());
+    BOOST_CHECK(Opm::InternedString{} == Opm::InternedString{ "" });
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentInterning)
+{
+    const auto before = Opm::InternedString::poolSize();
+
+    auto results = std::vector<std::vector<Opm::InternedString>>(4);
+    auto threads = std::vector<std::thread>{};
+    for (auto& result : results) {
+        threads.emplace_back([&result]()
+        {
+            for (int i = 0; i < 1000; ++i) {
+                result.emplace_back(fmt::format("INCLUDE_{}.INC", i % 100));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL(Opm::InternedString::poolSize(), before + 100);
+
+    for (const auto& result : results) {
+        for (int i = 0; i < 1000; ++i) {
+            BOOST_CHECK(result[i] == results.front()[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Location)
+{
+    auto loc = Opm::KeywordLocation { "WCONPROD", "CASE.DATA", 42 };
+    const auto copy = loc;
+
+    BOOST_CHECK(copy == loc);
+    BOOST_CHECK_EQUAL(&copy.filename.str(), &loc.filename.str());
+    BOOST_CHECK_EQUAL(loc.format("{keyword} in {file} line {line}"),
+                      "WCONPROD in CASE.DATA line 42");
+
+    loc.keyword = fmt::format("{}/{}", "ALL", "FOPR");
+    BOOST_CHECK_EQUAL(loc.keyword, "ALL/FOPR");
+    BOOST_CHECK_EQUAL(Opm::KeywordLocation{}.filename, "<memory string>");
+}
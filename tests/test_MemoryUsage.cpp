@@ -0,0 +1,141 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE MemoryUsage
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/MemoryUsage.hpp>
+
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Payload
+    {
+        std::vector<double> values{};
+        std::optional<std::string> name{};
+        int scalar{0};
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(values);
+            serializer(name);
+            serializer(scalar);
+        }
+    };
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Containers)
+{
+    auto usage = Opm::MemoryUsage{};
+
+    auto values = std::vector<double>(100);
+    BOOST_CHECK_EQUAL(usage.measure(values), sizeof(values) + 100 * sizeof(double));
+
+    auto nested = std::vector<std::vector<int>>(2, std::vector<int>(10));
+    BOOST_CHECK_EQUAL(usage.measure(nested),
+                      sizeof(nested) + 2 * sizeof(std::vector<int>) + 20 * sizeof(int));
+
+    const auto shortString = std::string { "WOPR" };
+    BOOST_CHECK_EQUAL(usage.measure(shortString), sizeof(std::string));
+
+    const auto longString = std::string(100, 'x');
+    BOOST_CHECK(usage.measure(longString) > sizeof(std::string) + 100);
+
+    const auto table = std::map<int, double> { {1, 1.0}, {2, 2.0} };
+    BOOST_CHECK(usage.measure(table) > sizeof(table) + 2 * sizeof(std::pair<const int, double>));
+}
+
+BOOST_AUTO_TEST_CASE(SerializeOp)
+{
+    auto payload = Payload{};
+    payload.values.resize(10);
+
+    auto usage = Opm::MemoryUsage{};
+    BOOST_CHECK_EQUAL(usage.measure(payload), sizeof(Payload) + 10 * sizeof(double));
+
+    payload.name = std::string(100, 'x');
+    BOOST_CHECK(usage.measure(payload) > sizeof(Payload) + 10 * sizeof(double) + 100);
+}
+
+BOOST_AUTO_TEST_CASE(SharedObjectsCountedOnce)
+{
+    auto shared = std::make_shared<Payload>();
+    shared->values.resize(1000);
+
+    const auto owners = std::vector<std::shared_ptr<Payload>>(3, shared);
+
+    auto usage = Opm::MemoryUsage{};
+    const auto first = usage.measure(owners);
+    BOOST_CHECK(first > 1000 * sizeof(double));
+    BOOST_CHECK(first < 2000 * sizeof(double));
+
+    // Already accounted for by the same visitor.
+    BOOST_CHECK_EQUAL(usage.measure(shared), sizeof(shared));
+
+    auto other = Opm::MemoryUsage{};
+    BOOST_CHECK(other.measure(shared) > 1000 * sizeof(double));
+}
+
+BOOST_AUTO_TEST_CASE(NodeTree)
+{
+    auto usage = Opm::MemoryUsage{};
+
+    auto root = Opm::MemoryUsage::Node { "Root", 0, {} };
+    root.children.push_back(usage.node("Values", std::vector<double>(10)));
+    root.children.push_back(usage.node("Scalar", 1.0));
+    root.bytes = root.children[0].bytes + root.children[1].bytes;
+
+    BOOST_CHECK_EQUAL(root.child("Scalar").bytes, sizeof(double));
+    BOOST_CHECK_THROW(root.child("Missing"), std::out_of_range);
+
+    auto os = std::ostringstream{};
+    os << root;
+
+    const auto listing = os.str();
+    BOOST_CHECK(listing.find("Root") < listing.find("  Values"));
+    BOOST_CHECK(listing.find("  Scalar") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(SummaryStateGrows)
+{
+    auto st = Opm::SummaryState { std::time_t{0} };
+
+    const auto empty = Opm::MemoryUsage{}.measure(st);
+
+    for (int i = 0; i < 100; ++i) {
+        st.update_well_var("WELL_" + std::to_string(i), "WOPR", 1.0 * i);
+    }
+
+    BOOST_CHECK(Opm::MemoryUsage{}.measure(st) > empty + 100 * sizeof(double));
+}
@@ -28,6 +28,9 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -424,3 +427,76 @@ BOOST_AUTO_TEST_CASE(TestFormat)
     BOOST_CHECK_EQUAL(log_stream2.str(), expected2);
     BOOST_CHECK_EQUAL(log_stream3.str(), expected3);
 }
+
+
+BOOST_AUTO_TEST_CASE(AsynchronousLogger) {
+    Logger logger;
+    std::ostringstream log_stream;
+    auto counter = std::make_shared<CounterLog>();
+    auto streamLog = std::make_shared<StreamLog>( log_stream , Log::DefaultMessageTypes );
+    logger.addBackend("COUNTER" , counter);
+    logger.addBackend("STREAM" , streamLog);
+
+    logger.setAsynchronous(true);
+    BOOST_CHECK( logger.isAsynchronous() );
+    BOOST_CHECK_THROW( logger.addMessage( 4096 , "Not enabled") , std::invalid_argument );
+
+    const int numThreads = 4;
+    const int numMessages = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&logger, t]() {
+            for (int i = 0; i < numMessages; ++i)
+                logger.addMessage( Log::MessageType::Info , std::to_string(t) + ":" + std::to_string(i) );
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Errors are written before addMessage() returns.
+    logger.addMessage( Log::MessageType::Error , "Error" );
+    BOOST_CHECK_EQUAL( 1U , counter->numMessages(Log::MessageType::Error) );
+    BOOST_CHECK_EQUAL( numThreads*numMessages , counter->numMessages(Log::MessageType::Info) );
+
+    // The messages of each thread keep their order.
+    std::istringstream lines( log_stream.str() );
+    std::vector<int> last(numThreads, -1);
+    std::string line;
+    while (std::getline(lines, line)) {
+        const auto sep = line.find(':');
+        if (sep == std::string::npos)
+            continue;
+
+        const int t = std::stoi(line.substr(0, sep));
+        const int i = std::stoi(line.substr(sep + 1));
+        BOOST_CHECK_EQUAL( last[t] + 1 , i );
+        last[t] = i;
+    }
+
+    logger.addMessage( Log::MessageType::Warning , "Warning" );
+    logger.flush();
+    BOOST_CHECK_EQUAL( 1U , logger.getBackend<CounterLog>("COUNTER")->numMessages(Log::MessageType::Warning) );
+
+    logger.addMessage( Log::MessageType::Warning , "Warning" );
+    logger.setAsynchronous(false);
+    BOOST_CHECK( !logger.isAsynchronous() );
+    BOOST_CHECK_EQUAL( 2U , counter->numMessages(Log::MessageType::Warning) );
+}
+
+BOOST_AUTO_TEST_CASE(AsynchronousOpmLogWithLimits) {
+    OpmLog::removeAllBackends();
+    std::ostringstream log_stream;
+    auto streamLog = std::make_shared<StreamLog>(log_stream, Log::DefaultMessageTypes);
+    streamLog->setMessageLimiter(std::make_shared<MessageLimiter>(2));
+    OpmLog::addBackend("STREAM", streamLog);
+    OpmLog::setAsynchronous(true);
+
+    for (int i = 0; i < 5; ++i)
+        OpmLog::warning("tag", "Warning");
+    OpmLog::flush();
+
+    OpmLog::setAsynchronous(false);
+    OpmLog::removeAllBackends();
+
+    BOOST_CHECK_EQUAL(log_stream.str(), "Warning\nWarning\nMessage limit reached for message tag: tag\n");
+}
@@ -33,10 +33,15 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <ctime>
+#include <filesystem>
 #include <iterator>
+#include <limits>
+#include <numeric>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -1087,6 +1092,348 @@ BOOST_AUTO_TEST_CASE(Formatted_Separate)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Async)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted   { false };
+    const auto unif  = ::Opm::EclIO::OutputStream::Unified     { true };
+    const auto async = ::Opm::EclIO::OutputStream::Asynchronous{ true };
+
+    // Spans several Fortran record blocks
+    auto pressure = std::vector<double>(2500);
+    std::iota(pressure.begin(), pressure.end(), 100.0);
+
+    const auto swat = std::vector<float>(1234, 0.25f);
+
+    for (const auto seqnum : {1, 2, 3}) {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, async
+        };
+
+        rst.write("I", std::vector<int>{seqnum, 2*seqnum});
+        rst.message("STARTSOL");
+        rst.write("PRESSURE", std::vector<double>(pressure));
+        rst.write("SWAT", swat);
+        rst.write("Z", std::vector<std::string>{"W1", "W2"});
+        rst.message("ENDSOL");
+
+        rst.flush();
+    }
+
+    {
+        const auto fname = ::Opm::EclIO::OutputStream::
+            outputFileName(rset, "UNRST");
+
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2, 3};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        rst.loadReportStepNumber(2);
+
+        {
+            const auto& I = rst.getRestartData<int>("I", 2, 0);
+            const auto  expect_I = std::vector<int>{ 2, 4 };
+            BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                          expect_I.begin(),
+                                          expect_I.end());
+        }
+
+        {
+            const auto& P = rst.getRestartData<double>("PRESSURE", 2, 0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(),
+                                          pressure.begin(),
+                                          pressure.end());
+        }
+
+        {
+            const auto& S = rst.getRestartData<float>("SWAT", 2, 0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(S.begin(), S.end(),
+                                          swat.begin(),
+                                          swat.end());
+        }
+
+        BOOST_CHECK(rst.hasArray("ENDSOL", 3));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Deduplicated)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted   { false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified     { true };
+    const auto sync = ::Opm::EclIO::OutputStream::Asynchronous{ false };
+
+    auto icon = std::vector<int>(3000);
+    std::iota(icon.begin(), icon.end(), 1);
+
+    const auto zwel = std::vector<std::string>(50, "PROD");
+    const auto logi = std::vector<bool>(100, true);
+
+    const auto pressure = [](const int seqnum)
+    {
+        return std::vector<double>(2500, 100.0 * seqnum);
+    };
+
+    auto catalog = ::Opm::EclIO::ArrayCatalog{};
+
+    const auto write = [&](const int seqnum)
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, sync, catalog
+        };
+
+        rst.write("ICON", icon);
+        rst.write("ZWEL", zwel);
+        rst.write("LOGIHEAD", logi);
+        rst.message("STARTSOL");
+        rst.write("PRESSURE", pressure(seqnum));
+        rst.message("ENDSOL");
+    };
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    write(1);
+    const auto size1 = std::filesystem::file_size(fname);
+
+    write(2);
+    write(3);
+
+    // Later steps do not repeat ICON.
+    BOOST_CHECK_LT(std::filesystem::file_size(fname) - size1,
+                   2*(size1 - icon.size()*sizeof(int)));
+
+    // Overwrite the last two steps.  References to the overwritten part
+    // of the file must not be reused.
+    write(2);
+    icon.back() = -1;
+    write(3);
+
+    auto rst = ::Opm::EclIO::ERst{fname};
+
+    const auto seqnum        = rst.listOfReportStepNumbers();
+    const auto expect_seqnum = std::vector<int>{1, 2, 3};
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                  expect_seqnum.begin(),
+                                  expect_seqnum.end());
+
+    for (const auto step : seqnum) {
+        rst.loadReportStepNumber(step);
+
+        auto expect_icon = icon;
+        if (step < 3) {
+            expect_icon.back() = 3000;
+        }
+
+        const auto& I = rst.getRestartData<int>("ICON", step, 0);
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_icon.begin(),
+                                      expect_icon.end());
+
+        const auto& Z = rst.getRestartData<std::string>("ZWEL", step, 0);
+        BOOST_CHECK_EQUAL_COLLECTIONS(Z.begin(), Z.end(),
+                                      zwel.begin(),
+                                      zwel.end());
+
+        const auto& L = rst.getRestartData<bool>("LOGIHEAD", step, 0);
+        BOOST_CHECK_EQUAL_COLLECTIONS(L.begin(), L.end(),
+                                      logi.begin(),
+                                      logi.end());
+
+        const auto& P = rst.getRestartData<double>("PRESSURE", step, 0);
+        const auto expect_P = pressure(step);
+        BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(),
+                                      expect_P.begin(),
+                                      expect_P.end());
+
+        BOOST_CHECK(!rst.hasArray(::Opm::EclIO::referenceMessage, step));
+        BOOST_CHECK(rst.hasArray("ENDSOL", step));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Compressed)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted   { false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified     { true };
+    const auto sync = ::Opm::EclIO::OutputStream::Asynchronous{ false };
+
+    const auto ihead = std::vector<int>(411, 7);
+
+    // Span several Fortran record blocks.
+    const auto pressure = [](const int seqnum)
+    {
+        auto p = std::vector<double>(2500);
+        for (std::size_t i = 0; i < p.size(); ++i) {
+            p[i] = 200.0 + 0.5*(i % 10) + seqnum;
+        }
+        return p;
+    };
+
+    auto swat = std::vector<float>(3000, 0.25f);
+    swat[1234] = std::numeric_limits<float>::quiet_NaN();
+
+    const auto small = std::vector<float>{ 1.0f, 2.0f };
+
+    auto catalog = ::Opm::EclIO::ArrayCatalog{};
+
+    const auto write = [&](const int seqnum)
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, sync, catalog
+        };
+
+        rst.enableCompression();
+
+        rst.write("INTEHEAD", ihead);
+        rst.write("SMALL", small);
+        rst.message("STARTSOL");
+        rst.write("PRESSURE", pressure(seqnum));
+        rst.write("SWAT", swat);
+        rst.message("ENDSOL");
+    };
+
+    write(1);
+    write(2);
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    // SWAT of step 2 is a reference to the compressed SWAT of step 1.
+    BOOST_CHECK_LT(std::filesystem::file_size(fname),
+                   2*pressure(1).size()*sizeof(double));
+
+    for (const auto mapped : { false, true }) {
+        auto rst = ::Opm::EclIO::ERst{fname};
+        if (mapped) {
+            rst.memoryMap();
+        }
+
+        for (const auto step : { 1, 2 }) {
+            rst.loadReportStepNumber(step);
+
+            const auto& I = rst.getRestartData<int>("INTEHEAD", step, 0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(), ihead.begin(), ihead.end());
+
+            const auto& s = rst.getRestartData<float>("SMALL", step, 0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(s.begin(), s.end(), small.begin(), small.end());
+
+            const auto& P = rst.getRestartData<double>("PRESSURE", step, 0);
+            const auto expect_P = pressure(step);
+            BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(), expect_P.begin(), expect_P.end());
+
+            const auto& S = rst.getRestartData<float>("SWAT", step, 0);
+            BOOST_REQUIRE_EQUAL(S.size(), swat.size());
+            BOOST_CHECK(std::memcmp(S.data(), swat.data(), swat.size() * sizeof(float)) == 0);
+
+            BOOST_CHECK(!rst.hasArray(::Opm::EclIO::compressedMessage, step));
+        }
+    }
+
+    // Decoded through a file stream rather than the memory mapping.
+    auto file = ::Opm::EclIO::EclFile{fname};
+    file.loadData("PRESSURE");
+    BOOST_CHECK(!file.isMapped());
+
+    const auto& P = file.get<double>("PRESSURE");
+    const auto expect_P = pressure(2);
+    BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(), expect_P.begin(), expect_P.end());
+
+    // Compressed arrays have no zero-copy view.
+    BOOST_CHECK_THROW(file.getView<double>("PRESSURE"), std::runtime_error);
+    BOOST_CHECK_NO_THROW(file.getView<int>("INTEHEAD"));
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Separate_Reserved)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified  { false };
+
+    // Spans several Fortran record blocks
+    auto pressure = std::vector<double>(2500);
+    std::iota(pressure.begin(), pressure.end(), 100.0);
+
+    auto swat = std::vector<float>(1234);
+    std::iota(swat.begin(), swat.end(), 0.5f);
+
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 5, fmt, unif
+        };
+
+        rst.write("I", std::vector<int>{1, 2, 3});
+        rst.message("STARTSOL");
+
+        const auto P = rst.reserve("PRESSURE", ::Opm::EclIO::DOUB, pressure.size());
+        const auto S = rst.reserve("SWAT", ::Opm::EclIO::REAL, swat.size());
+
+        rst.message("ENDSOL");
+        rst.flush();
+
+        // Slices not aligned with the record blocks, written concurrently
+        // and out of order.
+        const auto bounds = std::vector<std::size_t>{0, 777, 1500, 2001, 2500};
+
+        auto writers = std::vector<std::thread>{};
+        for (auto part = bounds.size() - 1; part > 0; --part) {
+            writers.emplace_back([&, part]()
+            {
+                const auto begin = bounds[part - 1];
+                const auto end = bounds[part];
+
+                ::Opm::EclIO::OutputStream::writeSlice
+                    (P, begin, std::vector<double>(pressure.begin() + begin,
+                                                   pressure.begin() + end));
+            });
+        }
+
+        for (auto& writer : writers) {
+            writer.join();
+        }
+
+        ::Opm::EclIO::OutputStream::writeSlice
+            (S, 1000, std::vector<float>(swat.begin() + 1000, swat.end()));
+        ::Opm::EclIO::OutputStream::writeSlice
+            (S, 0, std::vector<float>(swat.begin(), swat.begin() + 1000));
+
+        BOOST_CHECK_THROW(::Opm::EclIO::OutputStream::writeSlice
+                          (S, 1000, std::vector<float>(235)), std::out_of_range);
+        BOOST_CHECK_THROW(::Opm::EclIO::OutputStream::writeSlice
+                          (S, 0, std::vector<double>(1)), std::invalid_argument);
+    }
+
+    {
+        const auto fname = ::Opm::EclIO::OutputStream::
+            outputFileName(rset, "X0005");
+
+        auto rst = ::Opm::EclIO::ERst{fname};
+        rst.loadReportStepNumber(5);
+
+        {
+            const auto& P = rst.getRestartData<double>("PRESSURE", 5, 0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(),
+                                          pressure.begin(),
+                                          pressure.end());
+        }
+
+        {
+            const auto& S = rst.getRestartData<float>("SWAT", 5, 0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(S.begin(), S.end(),
+                                          swat.begin(),
+                                          swat.end());
+        }
+
+        BOOST_CHECK(rst.hasArray("ENDSOL", 5));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Class_Restart
 
 // ==========================================================================
@@ -1237,6 +1584,72 @@ BOOST_AUTO_TEST_CASE(Unformatted_New)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Async)
+{
+    using Char8 = ::Opm::EclIO::PaddedOutputString<8>;
+
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted   { false };
+    const auto async = ::Opm::EclIO::OutputStream::Asynchronous{ true };
+
+    // Spans several Fortran record blocks
+    auto pressure = std::vector<float>(2500);
+    std::iota(pressure.begin(), pressure.end(), 100.0f);
+
+    for (const auto existing : { false, true }) {
+        auto rft = ::Opm::EclIO::OutputStream::RFT {
+            rset, fmt, ::Opm::EclIO::OutputStream::RFT::OpenExisting{ existing }, async
+        };
+
+        const auto conipos = std::vector<int>{1, 7, 2, 9};
+
+        rft.write("CONIPOS", conipos);
+        rft.write("PRESSURE", std::vector<float>(pressure));
+        rft.write("WELLETC", std::vector<Char8> {
+            Char8{"  Hello "}, Char8{" World "}
+        });
+
+        rft.flush();
+    }
+
+    {
+        const auto fname = ::Opm::EclIO::OutputStream::
+            outputFileName(rset, "RFT");
+
+        auto rft = ::Opm::EclIO::EclFile{fname};
+
+        BOOST_CHECK_EQUAL(rft.count("CONIPOS"), std::size_t{2});
+        BOOST_CHECK_EQUAL(rft.count("PRESSURE"), std::size_t{2});
+
+        rft.loadData();
+
+        {
+            const auto& I = rft.get<int>(3);
+            const auto  expect_I = std::vector<int>{ 1, 7, 2, 9 };
+            BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                          expect_I.begin(),
+                                          expect_I.end());
+        }
+
+        {
+            const auto& P = rft.get<float>(4);
+            BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(),
+                                          pressure.begin(),
+                                          pressure.end());
+        }
+
+        {
+            const auto& Z = rft.get<std::string>(5);
+            const auto  expect_Z = std::vector<std::string>{
+                "  Hello", " World" // Trailing blanks trimmed
+            };
+
+            BOOST_CHECK_EQUAL_COLLECTIONS(Z.begin(), Z.end(),
+                                          expect_Z.begin(), expect_Z.end());
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(Unformatted_Existing)
 {
     using Char8 = ::Opm::EclIO::PaddedOutputString<8>;
@@ -22,6 +22,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
@@ -35,6 +36,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <memory>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -1732,3 +1735,73 @@ BOOST_AUTO_TEST_CASE(All_Specified)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Integration
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Collection)
+
+namespace {
+    void assignPressure(CalculatorSetup& cse, const double offset)
+    {
+        using Span = std::remove_cv_t<
+            std::remove_reference_t<decltype(cse.blockSource[0])>>;
+        using Item = typename Span::Item;
+
+        for (auto block = 0*cse.wbpCells.size(); block < cse.wbpCells.size(); ++block) {
+            cse.blockSource[cse.wbpCells[block]]
+                .set(Item::Pressure, offset + 7.0*((5*block) % 11))
+                .set(Item::PoreVol, 1.0 + 0.25*(block % 3))
+                .set(Item::MixtureDensity, 0.1);
+        }
+
+        for (auto conn = 0*cse.wbpConns.size(); conn < cse.wbpConns.size(); ++conn) {
+            cse.connSource[conn]
+                .set(Item::Pressure, offset - 10.0)
+                .set(Item::PoreVol, 0.5)
+                .set(Item::MixtureDensity, 0.2);
+        }
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Batched_Wells_Match_Individual)
+{
+    const auto grid = shoeBox({5, 5, 10});
+
+    auto cse1 = CalculatorSetup { grid, centreProducer(10, 2, 6) };
+    auto cse2 = CalculatorSetup { grid, centreProducer(10, 0, 4) };
+    assignPressure(cse1, 1234.0);
+    assignPressure(cse2, 2345.0);
+
+    const auto controls1 = AveragingControls::defaults();
+    const auto controls2 = Opm::PAvg { -1.0, 0.25, Opm::PAvg::DepthCorrection::RES, false };
+    const auto gravity = standardGravity();
+
+    cse1.calc.inferBlockAveragePressures(cse1.sources, controls1, gravity, 2001.0);
+    cse2.calc.inferBlockAveragePressures(cse2.sources, controls2, gravity, 2003.5);
+
+    auto collection = Opm::PAvgCalculatorCollection<double>{};
+    const auto ix1 = collection.setCalculator(17, std::make_unique<Opm::PAvgCalculator<double>>
+                                              (grid, centreProducer(10, 2, 6)));
+    const auto ix2 = collection.setCalculator(4, std::make_unique<Opm::PAvgCalculator<double>>
+                                              (grid, centreProducer(10, 0, 4)));
+
+    auto inputs = std::vector<Opm::PAvgCalculatorCollection<double>::WellInputs>(2);
+    inputs[ix1] = { cse1.sources, controls1, 2001.0 };
+    inputs[ix2] = { cse2.sources, controls2, 2003.5 };
+
+    collection.inferBlockAveragePressures(inputs, gravity);
+
+    using WBPMode = Opm::PAvgCalculatorResult<double>::WBPMode;
+    for (const auto mode : { WBPMode::WBP, WBPMode::WBP4, WBPMode::WBP5, WBPMode::WBP9 }) {
+        BOOST_CHECK_EQUAL(collection[ix1].averagePressures().value(mode),
+                          cse1.calc.averagePressures().value(mode));
+        BOOST_CHECK_EQUAL(collection[ix2].averagePressures().value(mode),
+                          cse2.calc.averagePressures().value(mode));
+    }
+
+    inputs.pop_back();
+    BOOST_CHECK_THROW(collection.inferBlockAveragePressures(inputs, gravity),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Collection
@@ -0,0 +1,143 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE ProfilerTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/Profiler.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using Opm::Profiler;
+
+namespace {
+
+std::size_t countOf(const std::string& s, const std::string& pattern)
+{
+    std::size_t count = 0;
+    for (auto pos = s.find(pattern); pos != std::string::npos; pos = s.find(pattern, pos + 1))
+        ++count;
+    return count;
+}
+
+void inner(const Profiler::BlockId block)
+{
+    Profiler::Scope scope { block };
+}
+
+void outer(const Profiler::BlockId outerBlock, const Profiler::BlockId innerBlock)
+{
+    Profiler::Scope scope { outerBlock };
+    for (int i = 0; i < 3; ++i)
+        inner(innerBlock);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(DisabledRecordsNothing)
+{
+    Profiler::disable();
+    Profiler::clear();
+
+    const auto block = Profiler::registerBlock("disabled");
+    {
+        Profiler::Scope scope { block };
+    }
+
+    BOOST_CHECK_EQUAL(countOf(Profiler::report(), "disabled"), 0);
+    BOOST_CHECK_EQUAL(countOf(Profiler::chromeTrace(), "disabled"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RegisterBlockIsIdempotent)
+{
+    BOOST_CHECK_EQUAL(Profiler::registerBlock("same"), Profiler::registerBlock("same"));
+    BOOST_CHECK(Profiler::registerBlock("same") != Profiler::registerBlock("other"));
+}
+
+BOOST_AUTO_TEST_CASE(CallTree)
+{
+    Profiler::enable();
+    Profiler::clear();
+
+    const auto outerBlock = Profiler::registerBlock("outer");
+    const auto innerBlock = Profiler::registerBlock("inner");
+    outer(outerBlock, innerBlock);
+    outer(outerBlock, innerBlock);
+    inner(innerBlock);
+
+    const auto report = Profiler::report();
+    Profiler::disable();
+
+    // "inner" appears once below "outer" and once at the top level.
+    BOOST_CHECK_EQUAL(countOf(report, "\nouter "), 1);
+    BOOST_CHECK_EQUAL(countOf(report, "\n  inner "), 1);
+    BOOST_CHECK_EQUAL(countOf(report, "\ninner "), 1);
+    BOOST_CHECK(report.find("\nouter ") < report.find("\n  inner "));
+
+    const auto trace = Profiler::chromeTrace();
+    BOOST_CHECK_EQUAL(countOf(trace, R"("name": "outer")"), 2);
+    BOOST_CHECK_EQUAL(countOf(trace, R"("name": "inner")"), 7);
+    BOOST_CHECK_EQUAL(countOf(trace, R"("ph": "X")"), 9);
+}
+
+BOOST_AUTO_TEST_CASE(RingBufferKeepsMostRecentEvents)
+{
+    Profiler::enable(4);
+    Profiler::clear();
+
+    const auto block = Profiler::registerBlock("ring");
+    for (int i = 0; i < 10; ++i)
+        inner(block);
+
+    const auto trace = Profiler::chromeTrace();
+    const auto report = Profiler::report();
+    Profiler::disable();
+
+    BOOST_CHECK_EQUAL(countOf(trace, R"("name": "ring")"), 4);
+    BOOST_CHECK(report.find("ring") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(MultipleThreads)
+{
+    Profiler::enable();
+    Profiler::clear();
+
+    const auto block = Profiler::registerBlock("threaded");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([block]() {
+            for (int i = 0; i < 100; ++i)
+                inner(block);
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto report = Profiler::report();
+    const auto trace = Profiler::chromeTrace();
+    Profiler::disable();
+
+    // The call trees of all threads are merged into one line.
+    BOOST_CHECK_EQUAL(countOf(report, "\nthreaded "), 1);
+    BOOST_CHECK(report.find(" 400 ") != std::string::npos);
+    BOOST_CHECK_EQUAL(countOf(trace, R"("name": "threaded")"), 400);
+}
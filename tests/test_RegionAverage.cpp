@@ -0,0 +1,154 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE RegionAverage
+#include <boost/test/unit_test.hpp>
+
+#include <opm/output/eclipse/RegionAverage.hpp>
+
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+
+#include <opm/input/eclipse/Python/Python.hpp>
+
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 3x2x1 grid with the first cell inactive.  Active cells have FIPNUM
+// 1 2 2 | 3 3 and FIPABC 1 1 | 2 2 2.
+Opm::Deck regionDeck()
+{
+    return Opm::Parser{}.parseString(R"(
+RUNSPEC
+DIMENS
+ 3 2 1 /
+OIL
+WATER
+GAS
+START
+ 1 JAN 2020 /
+GRID
+DX
+ 6*100 /
+DY
+ 6*100 /
+DZ
+ 6*10 /
+TOPS
+ 6*2000 /
+ACTNUM
+ 0 1 1 1 1 1 /
+PORO
+ 6*0.2 /
+PERMX
+ 6*100 /
+PERMY
+ 6*100 /
+PERMZ
+ 6*10 /
+REGIONS
+FIPNUM
+ 1 1 2 2 3 3 /
+FIPABC
+ 1 1 1 2 2 2 /
+SCHEDULE
+GRUPTREE
+ 'PROD' 'FIELD' /
+ 'INJ'  'FIELD' /
+/
+GPMAINT
+ 'PROD' 'WINJ' 2 1* 100 0.25 1.0 /
+/
+TSTEP
+ 10 /
+GPMAINT
+ 'INJ' 'WINJ' 2 'FIPABC' 100 0.25 1.0 /
+/
+TSTEP
+ 10 /
+)");
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(GpmaintRegions)
+{
+    const auto deck = regionDeck();
+    const auto es = Opm::EclipseState { deck };
+    const auto schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+
+    const auto regions = Opm::out::RegionAverage::gpmaintRegions(schedule);
+    BOOST_REQUIRE_EQUAL(regions.size(), std::size_t{2});
+    BOOST_CHECK(regions[0] == Opm::out::RegionAverage::Region("FIPABC", 2));
+    BOOST_CHECK(regions[1] == Opm::out::RegionAverage::Region("FIPNUM", 2));
+
+    const auto avg = Opm::out::RegionAverage { regions, es.fieldProps() };
+    BOOST_CHECK_EQUAL(avg.size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(avg.numCells(0), std::size_t{3});
+    BOOST_CHECK_EQUAL(avg.numCells(1), std::size_t{2});
+}
+
+BOOST_AUTO_TEST_CASE(WeightedAverage)
+{
+    const auto es = Opm::EclipseState { regionDeck() };
+
+    const auto avg = Opm::out::RegionAverage {
+        { {"FIPNUM", 2}, {"FIPNUM", 1}, {"FIPABC", 2}, {"FIPNUM", 2}, {"FIPNUM", 7} },
+        es.fieldProps()
+    };
+
+    // The duplicate is ignored.
+    BOOST_REQUIRE_EQUAL(avg.size(), std::size_t{4});
+    BOOST_CHECK_EQUAL(*avg.index("FIPNUM", 2), std::size_t{0});
+    BOOST_CHECK_EQUAL(*avg.index("FIPABC", 2), std::size_t{2});
+    BOOST_CHECK(! avg.index("FIPABC", 1).has_value());
+
+    const auto pressure = std::vector<double> { 100.0, 200.0, 300.0, 400.0, 500.0 };
+    const auto hcpv = std::vector<double> { 1.0, 3.0, 0.0, 1.0, 1.0 };
+
+    const auto result = avg.average(pressure, hcpv);
+    BOOST_REQUIRE_EQUAL(result.size(), std::size_t{4});
+    BOOST_CHECK_CLOSE(result[0], 200.0, 1.0e-12);  // Zero weight for 300
+    BOOST_CHECK_CLOSE(result[1], 100.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(result[2], (400.0 + 500.0) / 2.0, 1.0e-12);
+    BOOST_CHECK_EQUAL(result[3], 0.0);  // No cells
+
+    BOOST_CHECK_CLOSE(avg.average("FIPABC", 2, pressure, hcpv), 450.0, 1.0e-12);
+    BOOST_CHECK_THROW(avg.average("FIPABC", 1, pressure, hcpv), std::invalid_argument);
+
+    auto weighted = std::vector<double>{};
+    auto weights = std::vector<double>{};
+    avg.sums(pressure, hcpv, weighted, weights);
+    BOOST_CHECK_CLOSE(weighted[2], 900.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(weights[2], 2.0, 1.0e-12);
+
+    BOOST_CHECK_THROW(avg.average(std::vector<double>(6), hcpv), std::invalid_argument);
+}
@@ -798,6 +798,68 @@ BOOST_AUTO_TEST_CASE(ExtraData_content)
                 for (size_t i=0; i < expected.size(); i++)
                     BOOST_CHECK_CLOSE(extraval[i], expected[i], 1e-5);
             }
+
+            {
+                auto request = RestartIO::LoadRequest{};
+                request.groups = false;
+                request.aquifers = false;
+                request.udq = false;
+                request.cumulatives = false;
+
+                const auto full = RestartIO::load(rstFile, 1, action_state, st,
+                                                  { RestartKey("SWAT", UnitSystem::measure::identity) },
+                                                  setup.es, setup.grid, setup.schedule);
+
+                const auto wellsOnly = RestartIO::load(rstFile, 1, action_state, st,
+                                                       { RestartKey("SWAT", UnitSystem::measure::identity) },
+                                                       setup.es, setup.grid, setup.schedule,
+                                                       {}, request);
+
+                BOOST_CHECK( wellsOnly.solution.has("SWAT") );
+                BOOST_CHECK_EQUAL( wellsOnly.wells.size(), full.wells.size() );
+                BOOST_CHECK( wellsOnly.grp_nwrk.groupData.empty() );
+
+                request.wells = false;
+                const auto solutionOnly = RestartIO::load(rstFile, 1, action_state, st,
+                                                          { RestartKey("SWAT", UnitSystem::measure::identity) },
+                                                          setup.es, setup.grid, setup.schedule,
+                                                          {}, request);
+
+                BOOST_CHECK( solutionOnly.solution.has("SWAT") );
+                BOOST_CHECK( solutionOnly.wells.empty() );
+            }
+
+            {
+                const auto keys = std::vector<RestartKey> {
+                    RestartKey("SWAT", UnitSystem::measure::identity),
+                    RestartKey("NO"  , UnitSystem::measure::identity, false),
+                };
+
+                const auto full = RestartIO::load(rstFile, 1, action_state, st, keys,
+                                                  setup.es, setup.grid, setup.schedule);
+
+                const auto numCells = static_cast<std::size_t>(setup.grid.getNumActive());
+                const auto partition = std::vector<RestartIO::CellRange> {
+                    { numCells / 2, numCells }, { 1, 3 },
+                };
+
+                const auto part = RestartIO::loadSolution(rstFile, 1, keys, setup.es,
+                                                          setup.grid, partition);
+
+                BOOST_CHECK( ! part.has("NO") );
+
+                const auto& swat = full.solution.data<double>("SWAT");
+                auto expect = std::vector<double>(swat.begin() + numCells / 2, swat.end());
+                expect.insert(expect.end(), swat.begin() + 1, swat.begin() + 3);
+
+                const auto& actual = part.data<double>("SWAT");
+                BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(),
+                                              expect.begin(), expect.end());
+
+                BOOST_CHECK_THROW( RestartIO::loadSolution(rstFile, 1, keys, setup.es, setup.grid,
+                                                           { { 0, numCells + 1 } }),
+                                   std::invalid_argument );
+            }
         }
     }
 }
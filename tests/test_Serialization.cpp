@@ -27,6 +27,7 @@
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 
 #include <opm/output/data/Aquifer.hpp>
+#include <opm/output/data/WellsTable.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -151,9 +152,12 @@
 #include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/MemPacker.hpp>
 
+#include <map>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace {
     template<class T>
@@ -226,6 +230,7 @@ TEST_FOR_TYPE_NAMED(data::SegmentPhaseQuantity, SegmentPhaseQuantity)
 TEST_FOR_TYPE_NAMED(data::Solution, Solution)
 TEST_FOR_TYPE_NAMED(data::Well, dataWell)
 TEST_FOR_TYPE_NAMED(data::Wells, Wells)
+TEST_FOR_TYPE_NAMED(data::WellsTable, WellsTable)
 TEST_FOR_TYPE_NAMED(data::WellBlockAvgPress, dataWBPObject)
 TEST_FOR_TYPE_NAMED(data::WellBlockAveragePressures, dataWBPCollection)
 TEST_FOR_TYPE_NAMED_OBJ(DatumDepth, DatumDepth_Zero, serializationTestObjectZero)
@@ -354,6 +359,60 @@ TEST_FOR_TYPE(EzrokhiTable)
 
 namespace {
 
+class SegmentSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+{
+public:
+    using Opm::Serializer<Opm::Serialization::MemPacker>::Serializer;
+
+    std::vector<char>& buffer()
+    {
+        return m_buffer;
+    }
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(PackSegments)
+{
+    const std::vector<double> large(10000, 1.5);
+    const std::map<std::string, std::vector<int>> small {
+        {"a", {1, 2, 3}}, {"b", std::vector<int>(2000, 7)}
+    };
+    const auto ptr = std::make_shared<std::string>("shared");
+
+    Opm::Serialization::MemPacker packer;
+    SegmentSerializer ser(packer);
+    ser.pack(large, small, ptr, ptr);
+    const auto reference = ser.buffer();
+    BOOST_CHECK_EQUAL(ser.packSize(), reference.size());
+
+    // The vector of doubles and the large vector of ints are referenced
+    // in place, with the packed data before, between and after them.
+    const auto& segments = ser.packSegments(1024, large, small, ptr, ptr);
+    BOOST_CHECK_EQUAL(segments.size(), 5U);
+    BOOST_CHECK(segments[1].data == reinterpret_cast<const char*>(large.data()));
+    BOOST_CHECK(segments[3].data == reinterpret_cast<const char*>(small.at("b").data()));
+    BOOST_CHECK_EQUAL(ser.packSize(), reference.size());
+
+    std::vector<char> message;
+    for (const auto& segment : segments)
+        message.insert(message.end(), segment.data, segment.data + segment.size);
+    BOOST_CHECK(message == reference);
+
+    ser.buffer() = message;
+    std::vector<double> large_out;
+    std::map<std::string, std::vector<int>> small_out;
+    std::shared_ptr<std::string> ptr1_out, ptr2_out;
+    ser.unpack(large_out, small_out, ptr1_out, ptr2_out);
+    BOOST_CHECK(large_out == large);
+    BOOST_CHECK(small_out == small);
+    BOOST_CHECK_EQUAL(*ptr1_out, *ptr);
+    BOOST_CHECK(ptr1_out == ptr2_out);
+    BOOST_CHECK_EQUAL(ser.position(), message.size());
+}
+
+namespace {
+
 bool init_unit_test_func()
 {
     return true;
@@ -56,6 +56,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstddef>
 #include <ctime>
 #include <exception>
@@ -1911,6 +1912,33 @@ BOOST_AUTO_TEST_CASE(skip_unknown_var) {
     BOOST_CHECK( !ecl_sum_has_field_var( resp, "FGST" ) );
 }
 
+BOOST_AUTO_TEST_CASE(deferred_substep_output) {
+    setup cfg( "test_summary_deferred_substep_output" );
+
+    out::Summary writer(cfg.config, cfg.es, cfg.grid, cfg.schedule, cfg.name);
+    writer.setFlushInterval(std::chrono::hours{1});
+
+    SummaryState st(TimeService::now(), cfg.es.runspec().udqParams().undefinedValue());
+    writer.eval( st, 1, 2 *  day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 1, true);
+    writer.write();
+
+    writer.eval( st, 1, 5 *  day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 1, true);
+    writer.write();
+
+    // Substeps are held back until the report step.
+    BOOST_CHECK( !std::filesystem::exists( cfg.name + ".SMSPEC" ) );
+
+    writer.eval( st, 2, 10 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 2, false);
+    writer.write();
+
+    auto res = readsum( cfg.name );
+
+    BOOST_CHECK_EQUAL( res->numberOfTimeSteps(), std::size_t{3} );
+}
+
 BOOST_AUTO_TEST_CASE(region_vars) {
     setup cfg( "region_vars" );
 
@@ -6687,4 +6715,57 @@ BOOST_AUTO_TEST_CASE(append_summary_state) {
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Slots) {
+    SummaryState st(TimeService::now(), 0.0);
+
+    const auto wopr = st.well_slot("OP_1", "WOPR");
+    const auto wopt = st.well_slot("OP_1", "WOPT");
+    BOOST_CHECK( st.has_well_var("OP_1", "WOPR") );
+    BOOST_CHECK( st.well_slot("OP_1", "WOPR") == wopr );
+
+    st.update(wopr, 100);
+    st.update(wopr, 100);
+    st.update(wopt, 100);
+    st.update(wopt, 100);
+    BOOST_CHECK_EQUAL(st.get(wopr), 100);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_1", "WOPR"), 100);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP_1"), 200);
+
+    // Keys added through the general interface keep their slot when
+    // later added as well variables.
+    st.update("WWCT:OP_2", 0.5);
+    const auto wwct = st.slot("WWCT:OP_2");
+    BOOST_CHECK( !st.has_well_var("OP_2", "WWCT") );
+    BOOST_CHECK( st.well_slot("OP_2", "WWCT") == wwct );
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_2", "WWCT"), 0.5);
+
+    const auto ropt = st.region_slot("FIPABC", "ROPT", 3);
+    st.update(ropt, 10);
+    st.update_region_var("FIPABC", "ROPT", 3, 5);
+    BOOST_CHECK_EQUAL(st.get_region_var("FIPABC", "ROPT", 3), 15);
+    BOOST_CHECK_EQUAL(st.get("ROPT_ABC:3"), 15);
+
+    BOOST_CHECK( st.erase_well_var("OP_2", "WWCT") );
+    BOOST_CHECK( !st.has("WWCT:OP_2") );
+    BOOST_CHECK( !st.has_well_var("OP_2", "WWCT") );
+    BOOST_CHECK_EQUAL(st.size(), std::size_t{3});
+
+    auto keys = std::vector<std::string>{};
+    for (const auto& [key, value] : st) {
+        keys.push_back(key);
+    }
+
+    const auto expect = std::vector<std::string> {
+        "WOPR:OP_1", "WOPT:OP_1", "ROPT_ABC:3",
+    };
+    BOOST_CHECK_EQUAL_COLLECTIONS(keys.begin(), keys.end(), expect.begin(), expect.end());
+
+    SummaryState st2(TimeService::now(), 0.0);
+    st2.append(st);
+    st.update(wopr, 50);
+    st2.append(st);
+    BOOST_CHECK_EQUAL(st2.get_well_var("OP_1", "WOPR"), 50);
+    BOOST_CHECK_EQUAL(st2, st);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary_State
@@ -0,0 +1,102 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE TimeService
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <ctime>
+
+namespace {
+
+void checkAgainstGmtime(const Opm::TimeStampUTC& ts, std::time_t t)
+{
+    const auto tm = *std::gmtime(&t);
+
+    BOOST_CHECK_EQUAL(ts.year(), tm.tm_year + 1900);
+    BOOST_CHECK_EQUAL(ts.month(), tm.tm_mon + 1);
+    BOOST_CHECK_EQUAL(ts.day(), tm.tm_mday);
+    BOOST_CHECK_EQUAL(ts.hour(), tm.tm_hour);
+    BOOST_CHECK_EQUAL(ts.minutes(), tm.tm_min);
+    BOOST_CHECK_EQUAL(ts.seconds(), tm.tm_sec);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(TimeStampFromTimeT)
+{
+    for (const auto t : { std::time_t{0}, std::time_t{-1}, std::time_t{951782400},
+                          std::time_t{-2208988800}, std::time_t{4102444799} })
+    {
+        checkAgainstGmtime(Opm::TimeStampUTC { t }, t);
+    }
+
+    const auto start = Opm::TimeService::mkdatetime(2000, 2, 28, 23, 59, 30);
+    BOOST_CHECK_EQUAL(Opm::asTimeT(Opm::TimeStampUTC { start }), start);
+}
+
+BOOST_AUTO_TEST_CASE(CalendarCursorSmallSteps)
+{
+    // Steps of varying size across the leap day of 2000 and into 2001.
+    const auto start = Opm::TimeService::mkdatetime(2000, 2, 20, 6, 0, 0);
+
+    Opm::CalendarCursor cursor;
+    double elapsed = 0.0;
+    double step = 1234.5;
+    while (elapsed < 400.0 * 86400.0) {
+        const auto& ts = cursor.moveTo(start, elapsed);
+        const auto t = Opm::TimeService::advance(start, elapsed);
+
+        BOOST_CHECK_EQUAL(cursor.time(), t);
+        checkAgainstGmtime(ts, t);
+
+        elapsed += step;
+        step = (step > 5.0 * 86400.0) ? 17.0 : step * 1.7;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CalendarCursorJumps)
+{
+    auto cursor = Opm::CalendarCursor { Opm::TimeService::mkdate(2020, 6, 15) };
+    checkAgainstGmtime(cursor.timeStamp(), Opm::TimeService::mkdate(2020, 6, 15));
+
+    // Backwards, and forward by more than a month.
+    for (const auto t : { Opm::TimeService::mkdatetime(2019, 12, 31, 23, 59, 59),
+                          Opm::TimeService::mkdate(1999, 1, 1),
+                          Opm::TimeService::mkdatetime(2024, 2, 29, 12, 0, 0),
+                          Opm::TimeService::mkdate(2024, 3, 1) })
+    {
+        checkAgainstGmtime(cursor.moveTo(t), t);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CalendarCursorDecimalYear)
+{
+    auto cursor = Opm::CalendarCursor { Opm::TimeService::mkdate(2021, 1, 1) };
+    BOOST_CHECK_EQUAL(cursor.decimalYear(), 2021.0);
+
+    // 2024 is a leap year, so July 2nd at noon is the middle of the year.
+    cursor.moveTo(Opm::TimeService::mkdatetime(2024, 7, 2, 0, 0, 0));
+    BOOST_CHECK_CLOSE(cursor.decimalYear(), 2024.0 + 183.0/366.0, 1.0e-12);
+
+    cursor.moveTo(Opm::TimeService::mkdatetime(2023, 12, 31, 12, 0, 0));
+    BOOST_CHECK_CLOSE(cursor.decimalYear(), 2023.0 + 364.5/365.0, 1.0e-12);
+}
@@ -0,0 +1,267 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE test_VFPEvaluator
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    // Multilinear in all arguments, hence reproduced exactly by
+    // multilinear interpolation, also outside the table.
+    double prodBhp(const double flo, const double thp, const double wfr,
+                   const double gfr, const double alq)
+    {
+        return 1.0 + 2.0*flo + 3.0*thp + 0.5*wfr - gfr + 4.0*alq
+            + 0.1*flo*thp + 0.01*wfr*gfr*alq;
+    }
+
+    Opm::VFPProdTable makeProdTable()
+    {
+        using PT = Opm::VFPProdTable;
+
+        const auto flo = std::vector<double> { 0.0, 1.0, 2.0, 3.0, 4.0 };  // uniform
+        const auto thp = std::vector<double> { 1.0, 2.5, 7.0 };            // non-uniform
+        const auto wfr = std::vector<double> { 0.0, 0.5 };
+        const auto gfr = std::vector<double> { 10.0, 20.0, 50.0 };
+        const auto alq = std::vector<double> { 0.0 };
+
+        auto data = std::vector<double>{};
+        for (const auto t : thp) {
+            for (const auto w : wfr) {
+                for (const auto g : gfr) {
+                    for (const auto a : alq) {
+                        for (const auto f : flo) {
+                            data.push_back(prodBhp(f, t, w, g, a));
+                        }
+                    }
+                }
+            }
+        }
+
+        return { 1, 100.0,
+                 PT::FLO_TYPE::FLO_OIL, PT::WFR_TYPE::WFR_WCT,
+                 PT::GFR_TYPE::GFR_GOR, PT::ALQ_TYPE::ALQ_UNDEF,
+                 flo, thp, wfr, gfr, alq, data };
+    }
+
+    Opm::VFPInjTable makeInjTable()
+    {
+        const auto deck = Opm::Parser{}.parseString(R"(
+VFPINJ
+-- Table Depth  Rate   TAB  UNITS  BODY
+       5  32.9   WAT   THP METRIC   BHP /
+-- Rate axis
+1 3 5 /
+-- THP axis
+7 11 /
+-- Table data with THP# <values 1-num_rates>
+1 1.5 2.5 3.5 /
+2 4.5 5.5 6.5 /
+)");
+
+        return { deck["VFPINJ"].back(), Opm::UnitSystem::newMETRIC() };
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Axis)
+
+BOOST_AUTO_TEST_CASE(Uniform_And_Binary_Search_Agree)
+{
+    // Same interval as a linear search from the start of the axis.
+    auto linearLower = [](const std::vector<double>& points, const double x)
+    {
+        std::size_t i = 1;
+        while ((i < points.size() - 1) && (points[i] < x)) { ++i; }
+        return i - 1;
+    };
+
+    const auto uniform = std::vector<double> { 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6 };
+    const auto graded = std::vector<double> { 0.0, 0.01, 0.05, 0.2, 0.3, 0.55, 0.6 };
+
+    const auto uniformAxis = Opm::VFPAxis { uniform };
+    const auto gradedAxis = Opm::VFPAxis { graded };
+
+    for (int i = -20; i <= 80; ++i) {
+        const auto x = i * 0.01;
+
+        const auto bu = uniformAxis.bracket(x);
+        BOOST_CHECK_EQUAL(bu.lower, linearLower(uniform, x));
+        BOOST_CHECK_EQUAL(bu.upper, bu.lower + 1);
+
+        const auto bg = gradedAxis.bracket(x);
+        BOOST_CHECK_EQUAL(bg.lower, linearLower(graded, x));
+        BOOST_CHECK_EQUAL(bg.upper, bg.lower + 1);
+    }
+
+    // Axis points themselves.
+    for (std::size_t i = 0; i < uniform.size(); ++i) {
+        BOOST_CHECK_EQUAL(uniformAxis.bracket(uniform[i]).lower, linearLower(uniform, uniform[i]));
+        BOOST_CHECK_EQUAL(gradedAxis.bracket(graded[i]).lower, linearLower(graded, graded[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Single_Point)
+{
+    const auto axis = Opm::VFPAxis { std::vector<double> { 42.0 } };
+
+    const auto b = axis.bracket(17.0);
+    BOOST_CHECK_EQUAL(b.lower, std::size_t{0});
+    BOOST_CHECK_EQUAL(b.upper, std::size_t{0});
+    BOOST_CHECK_EQUAL(axis.factor(17.0, b), 0.0);
+
+    BOOST_CHECK_THROW(Opm::VFPAxis { std::vector<double>{} }, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Axis
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Production)
+
+BOOST_AUTO_TEST_CASE(Grid_Points)
+{
+    const auto table = makeProdTable();
+    const auto eval = Opm::VFPProdEvaluator { table };
+
+    for (std::size_t t = 0; t < table.getTHPAxis().size(); ++t) {
+        for (std::size_t w = 0; w < table.getWFRAxis().size(); ++w) {
+            for (std::size_t g = 0; g < table.getGFRAxis().size(); ++g) {
+                for (std::size_t f = 0; f < table.getFloAxis().size(); ++f) {
+                    const auto bhp = eval.bhp(table.getFloAxis()[f],
+                                              table.getTHPAxis()[t],
+                                              table.getWFRAxis()[w],
+                                              table.getGFRAxis()[g],
+                                              table.getALQAxis()[0]);
+
+                    BOOST_CHECK_CLOSE(bhp, table(t, w, g, 0, f), 1.0e-10);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Interpolation_And_Extrapolation)
+{
+    const auto eval = Opm::VFPProdEvaluator { makeProdTable() };
+
+    // Inside, below and above the table.
+    const auto points = std::vector<std::vector<double>> {
+        { 0.3, 1.7, 0.25, 12.0, 0.0 },
+        { 3.9, 6.0, 0.10, 45.0, 0.0 },
+        { -1.0, 0.5, -0.1, 5.0, 0.0 },
+        { 5.5, 9.0, 0.8, 70.0, 0.0 },
+    };
+
+    for (const auto& p : points) {
+        BOOST_CHECK_CLOSE(eval.bhp(p[0], p[1], p[2], p[3], p[4]),
+                          prodBhp(p[0], p[1], p[2], p[3], p[4]), 1.0e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Derivatives)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 2>;
+
+    const auto eval = Opm::VFPProdEvaluator { makeProdTable() };
+
+    const auto flo = Eval::createVariable(1.3, 0);
+    const auto thp = Eval::createVariable(4.0, 1);
+    const auto wfr = Eval { 0.2 };
+    const auto gfr = Eval { 30.0 };
+    const auto alq = Eval { 0.0 };
+
+    const auto bhp = eval.bhp(flo, thp, wfr, gfr, alq);
+
+    BOOST_CHECK_CLOSE(bhp.value(), prodBhp(1.3, 4.0, 0.2, 30.0, 0.0), 1.0e-10);
+    BOOST_CHECK_CLOSE(bhp.derivative(0), 2.0 + 0.1*4.0, 1.0e-10);
+    BOOST_CHECK_CLOSE(bhp.derivative(1), 3.0 + 0.1*1.3, 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(Batch_Matches_Single)
+{
+    const auto eval = Opm::VFPProdEvaluator { makeProdTable() };
+
+    const auto flo = std::vector<double> { 0.3, 2.2, 4.0, -0.5 };
+    const auto thp = std::vector<double> { 1.0, 3.3, 6.9, 8.0 };
+    const auto wfr = std::vector<double> { 0.0, 0.1, 0.4, 0.5 };
+    const auto gfr = std::vector<double> { 11.0, 25.0, 49.0, 50.0 };
+    const auto alq = std::vector<double> { 0.0, 0.0, 0.0, 0.0 };
+
+    const auto bhp = eval.bhp(flo, thp, wfr, gfr, alq);
+    BOOST_REQUIRE_EQUAL(bhp.size(), flo.size());
+
+    for (std::size_t i = 0; i < flo.size(); ++i) {
+        BOOST_CHECK_EQUAL(bhp[i], eval.bhp(flo[i], thp[i], wfr[i], gfr[i], alq[i]));
+    }
+
+    const auto shortAlq = std::vector<double> { 0.0 };
+    BOOST_CHECK_THROW(eval.bhp(flo, thp, wfr, gfr, shortAlq), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Production
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Injection)
+
+BOOST_AUTO_TEST_CASE(Bilinear)
+{
+    const auto table = makeInjTable();
+    const auto eval = Opm::VFPInjEvaluator { table };
+
+    const auto& flo = table.getFloAxis();
+    const auto& thp = table.getTHPAxis();
+
+    for (std::size_t t = 0; t < thp.size(); ++t) {
+        for (std::size_t f = 0; f < flo.size(); ++f) {
+            BOOST_CHECK_CLOSE(eval.bhp(flo[f], thp[t]), table(t, f), 1.0e-10);
+        }
+    }
+
+    // Midpoint of the first cell.
+    const auto mid = 0.25 * (table(0, 0) + table(0, 1) + table(1, 0) + table(1, 1));
+    BOOST_CHECK_CLOSE(eval.bhp(0.5*(flo[0] + flo[1]), 0.5*(thp[0] + thp[1])), mid, 1.0e-10);
+
+    const auto fs = std::vector<double> { flo[0], 0.5*(flo[0] + flo[1]), flo[2] };
+    const auto ts = std::vector<double> { thp[1], 0.5*(thp[0] + thp[1]), thp[0] };
+    const auto bhp = eval.bhp(fs, ts);
+    BOOST_REQUIRE_EQUAL(bhp.size(), fs.size());
+    for (std::size_t i = 0; i < fs.size(); ++i) {
+        BOOST_CHECK_EQUAL(bhp[i], eval.bhp(fs[i], ts[i]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Injection
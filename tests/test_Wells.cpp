@@ -22,9 +22,15 @@
 #define BOOST_TEST_MODULE Wells
 #include <boost/test/unit_test.hpp>
 
+#include <cstring>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include <opm/output/data/Wells.hpp>
+#include <opm/output/data/WellsTable.hpp>
+#include <opm/output/data/WellTracerRates.hpp>
 #include <opm/json/JsonObject.hpp>
 
 using namespace Opm;
@@ -156,3 +162,158 @@ BOOST_AUTO_TEST_CASE(get_connections) {
     BOOST_CHECK(json.has_item("OP_1"));
     BOOST_CHECK(json.has_item("OP_2"));
 }
+
+namespace {
+
+    class ByteBuffer
+    {
+    public:
+        template <typename T>
+        void write(const T& value)
+        {
+            if constexpr (std::is_same_v<T, std::string>) {
+                this->write(value.size());
+                this->bytes_.insert(this->bytes_.end(), value.begin(), value.end());
+            }
+            else {
+                const auto* p = reinterpret_cast<const char*>(&value);
+                this->bytes_.insert(this->bytes_.end(), p, p + sizeof(T));
+            }
+        }
+
+        template <typename T>
+        void read(T& value)
+        {
+            if constexpr (std::is_same_v<T, std::string>) {
+                auto n = value.size();
+                this->read(n);
+                value.assign(&this->bytes_[this->pos_], n);
+                this->pos_ += n;
+            }
+            else {
+                std::memcpy(&value, &this->bytes_[this->pos_], sizeof(T));
+                this->pos_ += sizeof(T);
+            }
+        }
+
+    private:
+        std::vector<char> bytes_{};
+        std::size_t pos_{0};
+    };
+
+    data::Wells tableWells()
+    {
+        auto wells = data::Wells{};
+
+        auto& op1 = wells["OP_1"];
+        op1.rates.set(rt::wat, 5.67).set(rt::oil, 6.78);
+        op1.rates.set(rt::tracer, 0.5, "T1");
+        op1.bhp = 1.23;
+        op1.dynamicStatus = WellStatus::SHUT;
+        op1.connections.push_back(data::Connection::serializationTestObject());
+        op1.connections.back().index = 88;
+        op1.connections.push_back(data::Connection::serializationTestObject());
+        op1.connections.back().index = 288;
+        op1.connections.back().rates.set(rt::gas, 25.19);
+        {
+            const auto seg = data::Segment::serializationTestObject();
+            op1.segments.emplace(seg.segNumber, seg);
+        }
+
+        auto& op2 = wells["OP_2"];
+        op2.rates.set(rt::gas, 10.12);
+        op2.thp = 4.56;
+
+        return wells;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(wells_table) {
+    const auto wells = tableWells();
+    const auto table = data::WellsTable { wells };
+
+    BOOST_CHECK_EQUAL(table.numWells(), 2u);
+    BOOST_CHECK_EQUAL(table.numConnections(), 2u);
+    BOOST_CHECK(table.toWells() == wells);
+
+    BOOST_CHECK(! table.handle("NO_SUCH_WELL").has_value());
+
+    const auto op1 = table.handle("OP_1");
+    BOOST_REQUIRE(op1.has_value());
+    BOOST_CHECK_EQUAL(table.name(*op1), "OP_1");
+    BOOST_CHECK_EQUAL(table.rate(*op1, rt::wat), 5.67);
+    BOOST_CHECK(! table.hasRate(*op1, rt::gas));
+    BOOST_CHECK_EQUAL(table.rate(*op1, rt::gas, -1.0), -1.0);
+    BOOST_CHECK_EQUAL(table.tracerRate(*op1, "T1"), 0.5);
+    BOOST_CHECK_EQUAL(table.tracerRate(*op1, "T2", -1.0), -1.0);
+    BOOST_CHECK_EQUAL(table.bhp(*op1), 1.23);
+    BOOST_CHECK(table.dynamicStatus(*op1) == WellStatus::SHUT);
+
+    const auto conn = table.findConnection(*op1, 288);
+    BOOST_REQUIRE(conn.has_value());
+    BOOST_CHECK_EQUAL(table.connectionRate(*conn, rt::gas), 25.19);
+    BOOST_CHECK_EQUAL(table.connectionItem(*conn, data::WellsTable::ConnItem::Pressure), 2.0);
+    BOOST_CHECK(! table.findConnection(*op1, 1234567).has_value());
+
+    BOOST_CHECK_EQUAL(table.get("OP_2", rt::gas), wells.get("OP_2", rt::gas));
+    BOOST_CHECK_EQUAL(table.get("OP_1", 88, rt::wat), wells.get("OP_1", 88, rt::wat));
+    BOOST_CHECK_EQUAL(table.get("NO_SUCH_WELL", rt::wat), 0.0);
+
+    auto buffer = ByteBuffer{};
+    table.write(buffer);
+
+    auto copy = data::WellsTable{};
+    copy.read(buffer);
+    BOOST_CHECK(copy == table);
+}
+
+BOOST_AUTO_TEST_CASE(wells_table_append) {
+    auto wells = tableWells();
+
+    auto op2 = data::Wells{};
+    op2.insert(wells.extract("OP_2"));
+
+    auto table = data::WellsTable { wells };
+    table.append(data::WellsTable { op2 });
+
+    wells.insert(op2.begin(), op2.end());
+    BOOST_CHECK(table.toWells() == wells);
+    BOOST_CHECK(table == data::WellsTable { wells });
+    BOOST_CHECK_EQUAL(*table.handle("OP_2"), 1u);
+
+    BOOST_CHECK_THROW(table.append(data::WellsTable { op2 }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(well_tracer_rates) {
+    auto wells = tableWells();
+    wells["OP_1"].rates.set(rt::tracer, -0.25, "FT1");
+    wells["OP_2"].rates.set(rt::tracer, 1.5, "T2");
+
+    const auto rates = data::WellTracerRates {
+        wells, { "OP_2", "NO_SUCH_WELL", "OP_1" }, { "T1", "FT1", "T2", "T3" }
+    };
+
+    BOOST_CHECK_EQUAL(rates.numWells(), 3u);
+    BOOST_CHECK_EQUAL(rates.numTracers(), 4u);
+
+    // OP_2
+    BOOST_CHECK_EQUAL(rates.rate(0, 0), 0.0);
+    BOOST_CHECK_EQUAL(rates.rate(0, 2), 1.5);
+
+    // NO_SUCH_WELL
+    for (auto tracer = 0*rates.numTracers(); tracer < rates.numTracers(); ++tracer) {
+        BOOST_CHECK_EQUAL(rates.rate(1, tracer), 0.0);
+    }
+
+    // OP_1
+    const auto* op1 = rates.wellRates(2);
+    BOOST_CHECK_EQUAL(op1[0], 0.5);
+    BOOST_CHECK_EQUAL(op1[1], -0.25);
+    BOOST_CHECK_EQUAL(op1[2], 0.0);
+    BOOST_CHECK_EQUAL(op1[3], 0.0);
+
+    for (auto tracer = 0*rates.numTracers(); tracer < rates.numTracers(); ++tracer) {
+        BOOST_CHECK_EQUAL(rates.rate(2, tracer), op1[tracer]);
+    }
+}
@@ -23,10 +23,12 @@
 
 #include <opm/output/data/InterRegFlowMap.hpp>
 
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 #include "tests/MessageBuffer.cpp"
 
@@ -975,4 +977,121 @@ BOOST_AUTO_TEST_CASE(LinearBuffer_ManyReadWrite)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Thread_Buffers)
+{
+    using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+    using Direction = Opm::data::InterRegFlowMap::ReadOnlyWindow::Direction;
+
+    auto flowMap = Opm::data::InterRegFlowMap{};
+    flowMap.addConnection(0, 1, conn_1());
+
+    flowMap.prepareThreadBuffers(3);
+    flowMap.threadBuffer(0).addConnection(0, 1, conn_2());
+    flowMap.threadBuffer(2).addConnection(1, 0, conn_3());
+    flowMap.threadBuffer(2).addConnection(2, 2, conn_1());
+    flowMap.threadBuffer(1).addConnection(3, 1, conn_3());
+
+    BOOST_CHECK_THROW(flowMap.threadBuffer(1).addConnection(-1, 1, conn_1()),
+                      std::invalid_argument);
+
+    flowMap.compress(4);
+
+    {
+        auto flows = flowMap.getInterRegFlows(0, 1);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), 1.3, 1.0e-5);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Water), 3.9, 5.0e-6);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil, Direction::Positive), 1.3, 1.0e-5);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil, Direction::Negative), 0.0, 5.0e-6);
+    }
+
+    {
+        auto flows = flowMap.getInterRegFlows(1, 3);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Gas), 0.4, 5.0e-6);
+    }
+
+    BOOST_CHECK_MESSAGE(! flowMap.getInterRegFlows(0, 2).has_value(),
+                        "Unregistered region pair must NOT have a value");
+
+    // Buffers are emptied by compress().
+    flowMap.compress(4);
+
+    auto flows = flowMap.getInterRegFlows(0, 1);
+    BOOST_REQUIRE(flows.has_value());
+    BOOST_CHECK_CLOSE(flows->first.flow(Component::Oil), 1.3, 1.0e-5);
+}
+
+BOOST_AUTO_TEST_CASE(Tree_Reduce)
+{
+    using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+
+    const auto size = 5;
+
+    auto flowMaps = std::vector<Opm::data::InterRegFlowMap>(size);
+    for (auto rank = 0; rank < size; ++rank) {
+        flowMaps[rank].addConnection(0, 1, conn_1());
+        flowMaps[rank].addConnection(rank % 3, 3, conn_2());
+    }
+
+    // Mailbox keyed by (source, destination).  Senders have higher rank
+    // than receivers, so processing ranks in decreasing order emulates
+    // blocking point-to-point communication.
+    auto mailbox = std::map<std::pair<int, int>, MessageBuffer>{};
+    auto numMessages = 0;
+
+    for (auto rank = size - 1; rank >= 0; --rank) {
+        flowMaps[rank].reduce(rank, size, 4,
+            [rank, &mailbox, &numMessages](const int dest, const Opm::data::InterRegFlowMap& map)
+            {
+                map.write(mailbox[{rank, dest}]);
+                ++numMessages;
+            },
+            [rank, &mailbox](const int src, Opm::data::InterRegFlowMap& map)
+            {
+                map.read(mailbox.at({src, rank}));
+            });
+    }
+
+    BOOST_CHECK_EQUAL(numMessages, size - 1);
+
+    const auto& root = flowMaps.front();
+
+    {
+        auto flows = root.getInterRegFlows(0, 1);
+        BOOST_REQUIRE(flows.has_value());
+        BOOST_CHECK_CLOSE(flows->first.flow(Component::Oil), size * 1.0, 5.0e-6);
+    }
+
+    {
+        // Ranks 0 and 3.
+        auto flows = root.getInterRegFlows(0, 3);
+        BOOST_REQUIRE(flows.has_value());
+        BOOST_CHECK_CLOSE(flows->first.flow(Component::Gas), 2 * 0.2, 5.0e-6);
+    }
+
+    {
+        // Ranks 1 and 4.
+        auto flows = root.getInterRegFlows(1, 3);
+        BOOST_REQUIRE(flows.has_value());
+        BOOST_CHECK_CLOSE(flows->first.flow(Component::Gas), 2 * 0.2, 5.0e-6);
+    }
+
+    {
+        // Rank 2.
+        auto flows = root.getInterRegFlows(2, 3);
+        BOOST_REQUIRE(flows.has_value());
+        BOOST_CHECK_CLOSE(flows->first.flow(Component::Gas), 0.2, 5.0e-6);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // InterRegMap
@@ -35,6 +35,7 @@
 #endif
 
 #include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationExpression.hpp>
 #include <opm/material/densead/Math.hpp>
 
 #include <iostream>
@@ -485,6 +486,50 @@ struct TestEnvBase
     static double myScalarMax(double a, double b)
     { return std::max(a, b); }
 
+    void testExpressions(const Scalar tolerance)
+    {
+        using Opm::DenseAd::lazy;
+
+        const Eval x = asImp_().createVariable(1.234, 0);
+        const Eval y = asImp_().createVariable(4.567, 1);
+        Eval z = asImp_().createVariable(0.891, 0);
+        z.setDerivative(1, -2.5);
+
+        const auto check = [tolerance](const Eval& lazyEval, const Eval& eagerEval, const std::string& what)
+        {
+            const auto isSame = [tolerance](Scalar a, Scalar b)
+            { return std::abs(a - b) <= tolerance*std::max<Scalar>(1.0, std::abs(b)); };
+
+            bool same = isSame(lazyEval.value(), eagerEval.value());
+            for (int i = 0; i < eagerEval.size(); ++i)
+                same = same && isSame(lazyEval.derivative(i), eagerEval.derivative(i));
+
+            if (!same)
+                throw std::logic_error("oops: lazy evaluation of "+what);
+        };
+
+        check(evaluate(lazy(x) + lazy(y)), x + y, "x + y");
+        check(evaluate(lazy(x) - lazy(y)), x - y, "x - y");
+        check(evaluate(lazy(x) * lazy(y)), x * y, "x * y");
+        check(evaluate(lazy(x) / lazy(y)), x / y, "x / y");
+        check(evaluate(-lazy(x)), -x, "-x");
+        check(evaluate(2.0 + lazy(x) - 3.0), x + 2.0 - 3.0, "2 + x - 3");
+        check(evaluate(2.0 - lazy(x)), -x + 2.0, "2 - x");
+        check(evaluate(2.0 * lazy(x) * 3.0), x * 2.0 * 3.0, "2 * x * 3");
+        check(evaluate(lazy(x) / 3.0), x / 3.0, "x / 3");
+        check(evaluate(3.0 / lazy(x)), Opm::DenseAd::pow(x, -1.0) * 3.0, "3 / x");
+        check(evaluate(sqrt(lazy(x))), Opm::DenseAd::sqrt(x), "sqrt(x)");
+        check(evaluate(exp(lazy(x))), Opm::DenseAd::exp(x), "exp(x)");
+        check(evaluate(log(lazy(x))), Opm::DenseAd::log(x), "log(x)");
+        check(evaluate(pow(lazy(x), 1.7)), Opm::DenseAd::pow(x, 1.7), "pow(x, 1.7)");
+        check(evaluate(pow(lazy(x), lazy(y))), Opm::DenseAd::pow(x, y), "pow(x, y)");
+
+        // a nested expression with an operand which depends on both variables
+        check(evaluate(lazy(x) * (1.0 - lazy(y)*lazy(z)) / exp(lazy(z) - lazy(x))),
+              x * (1.0 - y*z) / Opm::DenseAd::exp(z - x),
+              "x * (1 - y*z) / exp(z - x)");
+    }
+
     inline void testAll()
     {
         std::cout << "  Testing operators and constructors\n";
@@ -573,6 +618,9 @@ struct TestEnvBase
                        static_cast<Scalar (*)(Scalar)>(std::log10),
                        1e-6, 1e9);
 
+        std::cout << "  Testing expression templates\n";
+        testExpressions(eps);
+
         while (false) {
             [[maybe_unused]] Scalar val1 = 0.0;
             [[maybe_unused]] Scalar val2 = 1.0;
@@ -674,8 +722,64 @@ struct StaticTestEnv : public TestEnvBase<Opm::DenseAd::Evaluation<Scalar, numDe
     { return Opm::variable<Eval, Scalar>(v, varIdx); }
 };
 
+void testFastSmallVector()
+{
+    using Vector = Opm::FastSmallVector<double, 4>;
+
+    // buffers of the same capacity class are reused
+    {
+        std::size_t capacity = 0;
+        double* p = Opm::detail::FastSmallVectorPool<double>::allocate(9, capacity);
+        if (capacity != 16)
+            throw std::logic_error("Heap buffers of FastSmallVector must have power of two capacities");
+        Opm::detail::FastSmallVectorPool<double>::deallocate(p, capacity);
+        double* q = Opm::detail::FastSmallVectorPool<double>::allocate(12, capacity);
+        if (q != p)
+            throw std::logic_error("Released buffers of FastSmallVector must be reused");
+        Opm::detail::FastSmallVectorPool<double>::deallocate(q, capacity);
+    }
+
+    const auto check = [](const Vector& v, std::size_t size, double offset)
+    {
+        if (v.size() != size)
+            throw std::logic_error("Wrong size of FastSmallVector");
+        for (std::size_t i = 0; i < size; ++i)
+            if (v[i] != offset + i)
+                throw std::logic_error("Wrong element of FastSmallVector");
+    };
+
+    const auto make = [](std::size_t size, double offset)
+    {
+        Vector v(size);
+        for (std::size_t i = 0; i < size; ++i)
+            v[i] = offset + i;
+        return v;
+    };
+
+    // copy and move between the inline and the heap storage
+    Vector a = make(10, 1.0);
+    Vector b = a;
+    check(b, 10, 1.0);
+    b = make(3, 2.0);
+    check(b, 3, 2.0);
+    b = a;
+    check(b, 10, 1.0);
+    a = make(12, 3.0);
+    check(a, 12, 3.0);
+    check(b, 10, 1.0);
+    Vector c(std::move(a));
+    check(c, 12, 3.0);
+    c = make(2, 4.0);
+    check(c, 2, 4.0);
+    c = std::move(b);
+    check(c, 10, 1.0);
+}
+
 int main()
 {
+    std::cout << "Testing FastSmallVector\n";
+    testFastSmallVector();
+
     std::cout << "Testing statically sized evaluations\n";
     std::cout << " -> Scalar == double, n = 15\n";
     StaticTestEnv<double, 15>().testAll();
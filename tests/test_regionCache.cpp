@@ -96,6 +96,28 @@ BOOST_AUTO_TEST_CASE(create)
     BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 11), {"W_6"}));
 }
 
+BOOST_AUTO_TEST_CASE(Rebuild)
+{
+    const auto  deck     = summaryDeck();
+    const auto  es       = Opm::EclipseState { deck };
+    const auto  schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    const auto& grid     = es.getInputGrid();
+
+    auto regCache = Opm::out::RegionCache {
+        {"FIPNUM"}, es.fieldProps(), grid, schedule
+    };
+
+    // Wells already in the cache must not be added a second time.
+    regCache.buildCache({"FIPNUM"}, es.fieldProps(), grid, schedule);
+
+    const auto& top_layer = regCache.connections("FIPNUM", 1);
+    BOOST_CHECK_EQUAL( top_layer.size() , 4U );
+    BOOST_CHECK_EQUAL( top_layer[0].first , "W_1");
+
+    BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 1),  {"W_1", "W_2", "W_3", "W_4"}));
+    BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 11), {"W_6"}));
+}
+
 BOOST_AUTO_TEST_CASE(InactiveLayers)
 {
     const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC